@@ -10,7 +10,12 @@
  * lex.h:     defines BFI_LEX.
  * format.h:  defines BFI_FORMAT_PRETTY.
  * octet.h:   defines BFI_ADD, BFI_MUL and BFI_ADD_*.
- * bfi.h:     defines BFI_RUN and BFI_RUN1.
+ * move.h:    defines the BFI_UNCONS_* and BFI_CONS_MANY_* tables.
+ * prof.h:    defines the tables of BFI_RUN_PROFILE.
+ * sink.h:    defines the tables of BFI_SINKMOVES.
+ * bfi.h:     defines BFI_RUN, BFI_RUN1, BFI_RUN_SLICE, BFI_RUN_CONTINUE,
+ *            BFI_RUN_LIMITED, BFI_RUN_STATS, BFI_RUN_PROFILE,
+ *            BFI_RUN_SAMPLE and BFI_RUN_TRACE.
  * util.h:    defines many macros used by the files above.
  *
  * If you want to understand the implementation, I'd recommend looking over
@@ -19,10 +24,93 @@
 
 # include "machine.h"
 # include "octet.h"
+# include "move.h"
+# include "prof.h"
+# include "sink.h"
 # include "format.h"
 # include "lex.h"
 # include "util.h"
 
+/* BFI_COUNT_FAST_STEPS
+ *  If defined to 1, BFI_RUN_STATS also counts the fast steps. This makes
+ *  every run, counted or not, use about 20% more memory, so it is 0 by
+ *  default, and BFI_RUN_STATS reports the fast steps as 0uncounted.
+ */
+# ifndef BFI_COUNT_FAST_STEPS
+# define BFI_COUNT_FAST_STEPS 0
+# endif
+
+/* BFI_FAST_TICK(f, t)
+ *  Put at the start of every instruction that can take a fast step, where
+ *  'f' and 't' are those of the instruction. With BFI_COUNT_FAST_STEPS, it
+ *  announces the step with f##_TICK(t), so that BFI_FMACHINE_TALLY can see
+ *  it. Otherwise it expands to nothing.
+ */
+# if BFI_COUNT_FAST_STEPS
+# define BFI_FAST_TICK(f, t) f##_TICK(t)
+# else
+# define BFI_FAST_TICK(f, t)
+# endif
+
+/* BFI_CHUNKED_TAPE
+ *  If defined to 1, the octet-lists of the tape use nodes of up to 4 cells,
+ *  as described in "Chunked octet lists" below, instead of one 7c per
+ *  cell. A long tape then takes fewer tokens and nests less. 0 by default.
+ */
+# ifndef BFI_CHUNKED_TAPE
+# define BFI_CHUNKED_TAPE 0
+# endif
+
+/* BFI_ZERO_RUNS
+ *  If defined to 1, a run of zeros in the tape is kept as a single node of
+ *  the octet-lists, as described in "Zero runs" below. This makes programs
+ *  that leave many zero cells between the ones they use take less memory,
+ *  and other programs a bit slower. 0 by default. It cannot be used
+ *  together with BFI_CHUNKED_TAPE.
+ */
+# ifndef BFI_ZERO_RUNS
+# define BFI_ZERO_RUNS 0
+# endif
+
+# if BFI_ZERO_RUNS && BFI_CHUNKED_TAPE
+# error "BFI_ZERO_RUNS cannot be used with BFI_CHUNKED_TAPE"
+# endif
+
+/* BFI_REGISTER_WINDOW
+ *  If defined to 1, BFI_EXEC keeps the 5 cells around the head unpacked next
+ *  to each other in the A register, as described in "Register window"
+ *  below, so that a move within them leaves the octet-lists alone. This
+ *  only pays off for loops that stay among a few cells, and not by much:
+ *  the loop of "pptape loop 1024" gets 16% faster. A move past an end of
+ *  the window costs more than a plain move, so 8 round trips over 256
+ *  cells get 1.4 times slower, and setting 1024 cells 1.3 times slower.
+ *  See "Long tapes" in readme.md. 0 by default.
+ */
+# ifndef BFI_REGISTER_WINDOW
+# define BFI_REGISTER_WINDOW 0
+# endif
+
+/* BFI_TREE_TAPE
+ *  If defined to 1, the tape is a tree of 65536 cells indexed by the
+ *  position of the head, as described in "Tree tape" below, instead of a
+ *  zipper. A move out of a block of 16 cells then costs the same whatever
+ *  its distance, and BFI_PEEPHOLE turns every run of 6next and 6prev into
+ *  a single 6seek. Programs that walk the tape one cell at a time get
+ *  slower. 0 by default. It cannot be used together with the other tape
+ *  options.
+ *  Unlike the zipper, which has no end, this tape wraps around: the cell
+ *  to the left of the first one is the 65536th to its right. A program
+ *  that uses cells more than 65535 apart gets other results than it does
+ *  on the zipper, and no error is reported.
+ */
+# ifndef BFI_TREE_TAPE
+# define BFI_TREE_TAPE 0
+# endif
+
+# if BFI_TREE_TAPE && (BFI_CHUNKED_TAPE || BFI_ZERO_RUNS || BFI_REGISTER_WINDOW)
+# error "BFI_TREE_TAPE cannot be used with another tape option"
+# endif
+
 /* BFI_RUN(code, input)
  * BFI_RUN1(code)
  *    code, input : lexable token sequence
@@ -31,6 +119,106 @@
 # define BFI_RUN(code, input) BFI_FORMAT_PRETTY(BFI_EXEC(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input)))
 # define BFI_RUN1(code) BFI_RUN(code, 0eof)
 
+/* BFI_RUN_STATS(code, input)
+ *    code, input : lexable token sequence
+ *  Like BFI_RUN, but expand to a quaternary tuple (out, len, slow, fast).
+ *  'out' is what BFI_RUN would expand to, 'len' is the number of octets the
+ *  program wrote, and 'slow' and 'fast' are the numbers of slow and fast
+ *  machine steps it took. The numbers are decimal pp-numbers, except that
+ *  'fast' is the token 0uncounted unless BFI_COUNT_FAST_STEPS is 1. A run
+ *  that takes more steps than BFI_RUN allows is aborted with the same error.
+ *
+ *  BFI_RUN_STATS(r (w (_) r), a b c)
+ *    => (abc, 3, 5, 0uncounted)
+ *
+ *  and with BFI_COUNT_FAST_STEPS defined to 1:
+ *
+ *    => (abc, 3, 5, 14)
+ */
+# define BFI_RUN_STATS(code, input) BFI_RUN_STATS_I(BFI_EXEC_STATS(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input)))
+# define BFI_RUN_STATS_I(r) BFI_RUN_STATS_II r
+# define BFI_RUN_STATS_II(o, slow, fast, len) (BFI_FORMAT_PRETTY(o), len, slow, fast)
+
+/* BFI_RUN_PROFILE(code, input)
+ *    code, input : lexable token sequence
+ *  Like BFI_RUN, but expand to a binary tuple (out, report), where 'report'
+ *  tells how many times each instruction of the compiled program has run.
+ *  See BFI_EXEC_PROFILE.
+ *
+ *  BFI_RUN_PROFILE(r (w (_) r), a b c)
+ *    => (abc, (6readA, 1) (6writeA, 3) (fast steps, not counted))
+ *
+ *  and with BFI_COUNT_FAST_STEPS defined to 1:
+ *
+ *    => (abc, (6loopA, 4) (6readA, 4) (6writeA, 3) (6senter, 3) (6sexit, 3))
+ */
+# define BFI_RUN_PROFILE(code, input) BFI_RUN_PROFILE_I(BFI_EXEC_PROFILE(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input)))
+# define BFI_RUN_PROFILE_I(r) BFI_RUN_PROFILE_II r
+# define BFI_RUN_PROFILE_II(o, report) (BFI_FORMAT_PRETTY(o), report)
+
+/* BFI_RUN_SAMPLE(code, input)
+ *    code, input : lexable token sequence
+ *  Like BFI_RUN, but expand to a binary tuple (out, samples), where
+ *  'samples' is a sequence of binary tuples (g, t), one for every time the
+ *  machine suspended itself: 'g' is the instruction about to run, and 't'
+ *  is the instruction word of the top frame. Unlike BFI_RUN_PROFILE, this
+ *  costs little more than BFI_RUN. See BFI_EXEC_SAMPLE.
+ */
+# define BFI_RUN_SAMPLE(code, input) BFI_RUN_SAMPLE_I(BFI_EXEC_SAMPLE(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input)))
+# define BFI_RUN_SAMPLE_I(r) BFI_RUN_SAMPLE_II r
+# define BFI_RUN_SAMPLE_II(o, samples) (BFI_FORMAT_PRETTY(o), samples)
+
+/* BFI_RUN_TRACE(code, input)
+ *    code, input : lexable token sequence
+ *  Like BFI_RUN, but expand to what BFI_EXEC_TRACE gives for the compiled
+ *  program: the octets written, with a (0trace(k, c)) in front of every item
+ *  of the program that runs. The octets are not formatted. pptrace.c turns
+ *  this into the number of iterations of every loop.
+ *
+ *  BFI_RUN_TRACE(r (w r), a 0x00)
+ *    => (0trace((6readA, ~), 0x00))(0trace((6loopA, (6writeA,~)(6readA,~)), 0x61))
+ *       (0trace((6writeA, ~), 0x61))(0x61)(0trace((6readA, ~), 0x61))
+ *       (0trace((6loopA, (6writeA,~)(6readA,~)), 0x00))(0eof)
+ */
+# define BFI_RUN_TRACE(code, input) BFI_EXEC_TRACE(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input))
+
+/* BFI_RUN_SLICE(code, input, n)
+ * BFI_RUN_CONTINUE(state, n)
+ *    code, input : lexable token sequence
+ *    state : portable
+ *    n : integer, 0 <= n < BFI_MACHINE_LEVELS
+ *  Like BFI_RUN, but run at most (2**n * BFI_LINEAR_DEPTH) machine steps.
+ *  Expand to a ternary tuple (c, out, state). 'out' is the sequence of octets
+ *  written in this slice. If 'c' is 1, the program has been suspended, and
+ *  BFI_RUN_CONTINUE(state, n) runs the next slice. If 'c' is 0, the program
+ *  has finished, and 'out' ends with 0eof.
+ *
+ *  Concatenating the 'out's of all slices gives the output of BFI_EXEC, so
+ *  it can be passed to BFI_FORMAT_PRETTY. 'state' does not depend on the
+ *  context it was created in; it can be carried over to another translation
+ *  unit.
+ *
+ *  A slice is also the unit of memory use. GCC frees the memory of a macro
+ *  expansion only when the outermost one is done, so splitting a long run
+ *  into slices of a low level keeps cpp small however long the run is.
+ *  See the memory section of readme.md for measurements.
+ */
+# define BFI_RUN_SLICE(code, input, n) BFI_EXEC_SLICE(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input), n)
+# define BFI_RUN_CONTINUE(state, n) BFI_EXEC_SLICE_END(BFI_FMACHINE_SLICE(n, state))
+
+/* BFI_RUN_LIMITED(code, input, n)
+ *    code, input : lexable token sequence
+ *    n : integer, 0 <= n < BFI_MACHINE_LEVELS
+ *  Like BFI_RUN, but give up after at most (2**n * BFI_LINEAR_DEPTH) machine
+ *  steps, the budget of a slice of level n. If the program has not finished
+ *  by then, expand to what it has written so far, followed by the token
+ *  0timeout. Unlike running out of BFI_MACHINE_LEVELS, this is not an error.
+ *
+ *  BFI_RUN_LIMITED(x (w), 0eof, 0)
+ *    => '\x01''\x01' ... '\x01' 0timeout
+ */
+# define BFI_RUN_LIMITED(code, input, n) BFI_EXEC_LIMITED_END(BFI_EXEC_SLICE_RAW(BFI_BUILD(BFI_OPTIMIZE(BFI_TRANSLATE(code))), BFI_LEX(input), n))
+
 /*** Flat form
  *
  * The flat form of a BF program is designed to be easy to work with.
@@ -56,10 +244,12 @@
  * 6add(N)        : add N to the current cell
  * 6next1         : like 6next, but not repeatable
  * 6prev1         : like 6next, but not repeatable
- * 6nextA(N)      : move ptr to the right by N (1<=N<=4), not repeatable
- * 6nextB(N)      : move ptr to the right by N (1<=N<=4), not repeatable
- * 6prevA(N)      : move ptr to the left by N (1<=N<=4), not repeatable
- * 6prevB(N)      : move ptr to the left by N (1<=N<=4), not repeatable
+ * 6nextA(N)      : move ptr to the right by N (N>=1), not repeatable
+ * 6nextB(N)      : move ptr to the right by N (N>=1), not repeatable
+ * 6prevA(N)      : move ptr to the left by N (N>=1), not repeatable
+ * 6prevB(N)      : move ptr to the left by N (N>=1), not repeatable
+ * 6readA         : like 6read, but not repeatable
+ * 6readB         : like 6read, but not repeatable
  * 6writeA        : like 6write, but not repeatable
  * 6writeB        : like 6write, but not repeatable
  * 6senter        : push the content of the current cell to the stack, then
@@ -67,6 +257,20 @@
  * 6sadd(N)       : add (N * the top item of the stack) to the current cell,
  *                  not repetable. Invalid if the stack is empty
  * 6sexit         : pop the stack, not repeatable
+ * 6seek(D)       : move ptr by the offset D, not repeatable. Only with
+ *                  BFI_TREE_TAPE, see "Tree tape"
+ * 6scanR(N)      : move ptr to the right by N (N>=1) until the current
+ *                  cell is 0x00, not repeatable. BF '[>]' for N = 1
+ * 6scanL(N)      : move ptr to the left by N (N>=1) until the current cell
+ *                  is 0x00, not repeatable. BF '[<]' for N = 1
+ * 6addA(D, N)    : add N to the cell at the offset D from the current one,
+ *                  not repeatable. D is from 0xf8 to 0x08
+ * 6addB(D, N)    : add N to the cell at the offset D from the current one,
+ *                  not repeatable. D is from 0xf8 to 0x08
+ * 6setA(D, N)    : write N to the cell at the offset D from the current
+ *                  one, not repeatable. D is from 0xf8 to 0x08
+ * 6setB(D, N)    : write N to the cell at the offset D from the current
+ *                  one, not repeatable. D is from 0xf8 to 0x08
  *
  * In all cases N is an octet. Items marked as "not repeatable" cannot appear
  * twice in a row. For example, (6writeA)(6writeB) is a valid program, but
@@ -122,7 +326,7 @@
  *    code : flat-form BF program
  *  Expand to an optimized program, also in the flat form.
  */
-# define BFI_OPTIMIZE(code) BFI_PEEPHOLE(BFI_LOOPMUL(code))
+# define BFI_OPTIMIZE(code) BFI_PEEPHOLE(BFI_SCANLOOP(BFI_SINKMOVES(BFI_LOOPMUL(code))))
 
 /* BFI_LOOPMUL(code)
  *    code : flat-form BF program
@@ -158,8 +362,8 @@
 # define BFI_LOOPMUL_PARALLEL_ADDITIVE(pos, inc, i) BFI_IFC(BFI_NULLARYP(BFI_TEST_ZERO_##pos))( \
   (2)((0r)(i)BFI_LOOPMUL_PARALLEL, pos, BFI_ADD(inc, BFI_ADDITIVE_AMOUNT(i))), \
   (2)((0c)(i, 6sadd(BFI_ADDITIVE_AMOUNT(i)))BFI_LOOPMUL_PARALLEL, pos, inc)),
-# define BFI_LOOPMUL_PARALLEL_NEXT(pos, inc, i) (0b)(i)BFI_IFC(BFI_NULLARYP(BFI_TEST_7F_##pos))((1)(BFI_LOOPMUL_PARALLEL_ABORT, i), (2)(BFI_LOOPMUL_PARALLEL, BFI_ADD_0x01_##pos, inc)),
-# define BFI_LOOPMUL_PARALLEL_PREV(pos, inc, i) (0b)(i)BFI_IFC(BFI_NULLARYP(BFI_TEST_80_##pos))((1)(BFI_LOOPMUL_PARALLEL_ABORT, i), (2)(BFI_LOOPMUL_PARALLEL, BFI_ADD_0xff_##pos, inc)),
+# define BFI_LOOPMUL_PARALLEL_NEXT(pos, inc, i) BFI_IFC(BFI_NULLARYP(BFI_TEST_7F_##pos))((1)(BFI_LOOPMUL_PARALLEL_ABORT, i), (2)((0b)(i)BFI_LOOPMUL_PARALLEL, BFI_ADD_0x01_##pos, inc)),
+# define BFI_LOOPMUL_PARALLEL_PREV(pos, inc, i) BFI_IFC(BFI_NULLARYP(BFI_TEST_80_##pos))((1)(BFI_LOOPMUL_PARALLEL_ABORT, i), (2)((0b)(i)BFI_LOOPMUL_PARALLEL, BFI_ADD_0xff_##pos, inc)),
 # define BFI_LOOPMUL_PARALLEL_END(pos, inc, i) BFI_IF(BFI_AND(BFI_NULLARYP(BFI_TEST_ZERO_##pos), BFI_NULLARYP(BFI_TEST_FF_##inc)))(BFI_LOOPMUL_PARALLEL_FINISH, BFI_LOOPMUL_PARALLEL_ABORT)(i,
 # define BFI_LOOPMUL_PARALLEL_FINISH(i, j, c) , 1)BFI_LOOPMUL_GO(j, c)
 
@@ -186,18 +390,251 @@
 # define BFI_LOOPMUL_CHOOSE_0_0b(x) (x)BFI_LOOPMUL_CHOOSE_0_NEXT
 # define BFI_LOOPMUL_CHOOSE_0_0e
 
+/* BFI_SCANLOOP(code)
+ *    code : flat-form BF program
+ *  Turn a loop whose body is a run of 6next into a 6scanR, and a loop whose
+ *  body is a run of 6prev into a 6scanL. Such a loop looks for the next
+ *  zero cell at a fixed stride. A run longer than BFI_PEEPHOLE would put in
+ *  one move is left as it is.
+ *
+ *  With BFI_REGISTER_WINDOW or BFI_TREE_TAPE, the loops are left as they
+ *  are, as these tapes have their own way to move the pointer.
+ *
+ *  BFI_SCANLOOP((6loop)(6next)(6next)(6end(6loop)))
+ *    => (6scanR(0x02))
+ */
+# if BFI_REGISTER_WINDOW || BFI_TREE_TAPE
+# define BFI_SCANLOOP(code) code
+# else
+# define BFI_SCANLOOP(code) BFI_SCANLOOP_I(BFI_SEQ_TO_GUIDE(code))
+# endif
+# define BFI_SCANLOOP_I(g) BFI_SCANLOOP_GO(g
+
+# define BFI_SCANLOOP_GO(i, c) BFI_IF(c)(BFI_SCANLOOP_PROCESS, BFI_EAT)(i
+# define BFI_SCANLOOP_PROCESS(i) BFI_IFN(BFI_TEST_LOOP_##i)(BFI_SCANLOOP_LOOP, BFI_SCANLOOP_OTHER)(i)
+# define BFI_SCANLOOP_OTHER(i) (i)BFI_SCANLOOP_GO(
+# define BFI_SCANLOOP_LOOP(i) BFI_SCANLOOP_START(
+# define BFI_SCANLOOP_START(i, c) BFI_IF(c)(BFI_SCANLOOP_FIRST, BFI_SCANLOOP_FLUSH)((6loop), i
+# define BFI_SCANLOOP_FIRST(acc, i) BFI_SWITCH((BFI_SCANLOOP_DISPATCH_##i, BFI_SCANLOOP_ABORT))(acc, i)
+# define BFI_SCANLOOP_FLUSH(acc, i) acc
+# define BFI_SCANLOOP_ABORT(acc, i) acc BFI_SCANLOOP_PROCESS(i)
+# define BFI_SCANLOOP_MOVE(acc, i) BFI_SCANLOOP_RUN(acc(i), i, 0x01,
+
+# define BFI_SCANLOOP_RUN(acc, base, n, i, c) BFI_IF(c)(BFI_SCANLOOP_RUN_I, BFI_SCANLOOP_RUN_FLUSH)(acc, base, n, i
+# define BFI_SCANLOOP_RUN_I(acc, base, n, i) BFI_IFN(BFI_TEST_END_##i)(BFI_SCANLOOP_FOUND, BFI_SCANLOOP_RUN_II)(acc, base, n, i)
+# define BFI_SCANLOOP_RUN_II(acc, base, n, i) BFI_IF(BFI_AND(BFI_SYM_MATCH(base, i), BFI_NOT(BFI_NULLARYP(BFI_TEST_PEEPHOLE_MOVE_MAX_##n))))(BFI_SCANLOOP_MORE, BFI_SCANLOOP_RUN_ABORT)(acc, base, n, i)
+# define BFI_SCANLOOP_RUN_FLUSH(acc, base, n, i) acc
+# define BFI_SCANLOOP_RUN_ABORT(acc, base, n, i) acc BFI_SCANLOOP_PROCESS(i)
+# define BFI_SCANLOOP_MORE(acc, base, n, i) BFI_SCANLOOP_RUN(acc(i), base, BFI_ADD_0x01_##n,
+# define BFI_SCANLOOP_FOUND(acc, base, n, i) (BFI_SCANLOOP_ITEM_##base(n))BFI_SCANLOOP_GO(
+
+# define BFI_SCANLOOP_DISPATCH_6next BFI_TEST_SUCCESS(BFI_SCANLOOP_MOVE)
+# define BFI_SCANLOOP_DISPATCH_6prev BFI_TEST_SUCCESS(BFI_SCANLOOP_MOVE)
+# define BFI_SCANLOOP_ITEM_6next 6scanR
+# define BFI_SCANLOOP_ITEM_6prev 6scanL
+
+/* BFI_SINKMOVES(code)
+ *    code : flat-form BF program
+ *  Sink the moves of each basic block to its end. A basic block is a run of
+ *  6inc, 6dec, 6add, 6next and 6prev items, and of 6senter items directly
+ *  followed by 6sexit, which is how BFI_LOOPMUL leaves [-]. In a block,
+ *  the pointer stays where the block starts, and each change to a cell up
+ *  to 8 cells away (4 with BFI_CHUNKED_TAPE or BFI_ZERO_RUNS) becomes one
+ *  item that says where the cell is:
+ *    - 6inc, 6dec and 6add become 6addA or 6addB, or stay as they are for
+ *      the current cell
+ *    - 6senter followed by 6sexit becomes 6setA or 6setB, or stays as it is
+ *      for the current cell
+ *    - changes to the same cell that follow each other are merged into one
+ *  The moves of the block are then made at once at its end. A block that
+ *  goes further than that is split where it does so.
+ *
+ *  An item for a cell 'd' cells away walks 'd' cells, so a block that only
+ *  sweeps over the tape gets slower this way. A block is rewritten only if
+ *  it saves moves: each cell the block moves over counts 2, for the walk
+ *  and for the instruction, and each cell the new items and the final
+ *  moves walk counts 1. Other blocks are left as they are, and so is a
+ *  block of moves that ends where it starts, which would otherwise leave
+ *  nothing behind: the items around it may not follow each other, as two
+ *  6sadd in a loop turned by BFI_LOOPMUL, and a program must not be empty.
+ *  The balance is an octet, so a block is also split once it reaches 64
+ *  either way, which settles the part before the split and keeps the
+ *  balance from wrapping around.
+ *
+ *  With BFI_REGISTER_WINDOW or BFI_TREE_TAPE, the program is left as it is.
+ *
+ *  BFI_SINKMOVES((6next)(6next)(6add(0x03))(6prev)(6prev)(6dec))
+ *    => (6addA(0x02, 0x03))(6dec)
+ *  BFI_SINKMOVES((6next)(6senter)(6sexit)(6inc)(6prev)(6write))
+ *    => (6setA(0x01, 0x01))(6write)
+ *  BFI_SINKMOVES((6next)(6inc)(6next)(6inc))
+ *    => (6next)(6inc)(6next)(6inc)
+ *
+ *  The state of the walk is the offset 'o' of the pointer from the start of
+ *  the block, the letter 'x' of the next item put out, the change 'k, d, n'
+ *  that is not put out yet, the balance 'b' of the costs above, and the
+ *  block so far, rewritten as 's' and as it is as 'q'. 'k' is 6add or
+ *  6set, 'd' is the offset of the cell and 'n' the operand. A 6add of 0x00
+ *  is not put out, so the walk starts with one at the offset 0x00. The
+ *  letter is A or B, and alternates between the 6addA, 6addB, 6setA and
+ *  6setB put out, so that none of them follows itself. It is HA or HB after
+ *  a 6add for the current cell, where the next such 6add becomes a
+ *  6addA(0x00, N) or 6addB(0x00, N) instead. 6inc and 6dec stand for a 6add
+ *  of 0x01 and 0xff for the current cell.
+ */
+# if BFI_REGISTER_WINDOW || BFI_TREE_TAPE
+# define BFI_SINKMOVES(code) code
+# else
+# define BFI_SINKMOVES(code) BFI_SINKMOVES_I(BFI_SEQ_TO_GUIDE(code))
+# endif
+# define BFI_SINKMOVES_I(g) BFI_SINKMOVES_GO(0x00, A, 6add, 0x00, 0x00, 0x00, , , g
+
+# define BFI_SINKMOVES_GO(o, x, k, d, n, b, s, q, i, c) BFI_IF(c)(BFI_SINKMOVES_PROCESS, BFI_SINKMOVES_END)(o, x, k, d, n, b, s, q, i
+# define BFI_SINKMOVES_PROCESS(o, x, k, d, n, b, s, q, i) BFI_SWITCH((BFI_SINKMOVES_DISPATCH_##i, BFI_SINKMOVES_OTHER))(o, x, k, d, n, b, s, q, i)
+# define BFI_SINKMOVES_END(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)
+# define BFI_SINKMOVES_OTHER(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)(i)BFI_SINKMOVES_GO(0x00, A, 6add, 0x00, 0x00, 0x00, , ,
+# define BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q) BFI_IFN(BFI_CAT(BFI_TEST_SINKMOVES_GAIN_, BFI_ADD(b, BFI_ADD(BFI_SINKMOVES_CHARGE_##k(d, n), BFI_SINKMOVES_COST_##o))))(BFI_SINKMOVES_NEW, BFI_SINKMOVES_OLD)(o, x, k, d, n, s, q)
+# define BFI_SINKMOVES_NEW(o, x, k, d, n, s, q) BFI_SINKMOVES_NONEMPTY(BFI_REM(s)BFI_SINKMOVES_EMIT_##k(x, d, n)BFI_SINKMOVES_MOVES_##o, q)
+# define BFI_SINKMOVES_NONEMPTY(r, q) BFI_IF(BFI_UNARYP(r))(r, q)
+# define BFI_SINKMOVES_OLD(o, x, k, d, n, s, q) q
+
+# define BFI_SINKMOVES_NEXT(o, x, k, d, n, b, s, q, i) BFI_IFN(BFI_TEST_SINKMOVES_MAX_##o)(BFI_SINKMOVES_SPLIT, BFI_SINKMOVES_STEP)(o, x, k, d, n, b, s, q, i, BFI_ADD_0x01_)
+# define BFI_SINKMOVES_PREV(o, x, k, d, n, b, s, q, i) BFI_IFN(BFI_TEST_SINKMOVES_MIN_##o)(BFI_SINKMOVES_SPLIT, BFI_SINKMOVES_STEP)(o, x, k, d, n, b, s, q, i, BFI_ADD_0xff_)
+# define BFI_SINKMOVES_STEP(o, x, k, d, n, b, s, q, i, m) BFI_SINKMOVES_BOUND(m##o, x, k, d, n, BFI_SINKMOVES_TWICE(b), s, q(i))
+# define BFI_SINKMOVES_TWICE(b) BFI_CAT(BFI_ADD_0x01_, BFI_ADD_0x01_##b)
+# define BFI_SINKMOVES_BOUND(o, x, k, d, n, b, s, q) BFI_IFN(BFI_CAT(BFI_TEST_SINKMOVES_FAR_, b))(BFI_SINKMOVES_CUT, BFI_SINKMOVES_GO)(o, x, k, d, n, b, s, q,
+# define BFI_SINKMOVES_CUT(o, x, k, d, n, b, s, q, i, c) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)BFI_SINKMOVES_GO(0x00, A, 6add, 0x00, 0x00, 0x00, , , i, c)
+# define BFI_SINKMOVES_SPLIT(o, x, k, d, n, b, s, q, i, m) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)BFI_SINKMOVES_GO(m##0x00, A, 6add, 0x00, 0x00, 0x02, , (i),
+
+# define BFI_SINKMOVES_ADDITIVE(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_PUT(o, x, k, d, n, b, s, q(i), 6add, BFI_ADDITIVE_AMOUNT(i))
+# define BFI_SINKMOVES_SENTER(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_CLEAR(o, x, k, d, n, b, s, q,
+# define BFI_SINKMOVES_CLEAR(o, x, k, d, n, b, s, q, i, c) BFI_IF(c)(BFI_SINKMOVES_CLEAR_I, BFI_SINKMOVES_CLEAR_END)(o, x, k, d, n, b, s, q, i
+# define BFI_SINKMOVES_CLEAR_I(o, x, k, d, n, b, s, q, i) BFI_SWITCH((BFI_SINKMOVES_CLEAR_##i, BFI_SINKMOVES_CLEAR_OTHER))(o, x, k, d, n, b, s, q, i)
+# define BFI_SINKMOVES_CLEAR_SET(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_PUT(o, x, k, d, n, b, s, q(6senter)(6sexit), 6set, 0x00)
+# define BFI_SINKMOVES_CLEAR_OTHER(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)(6senter)BFI_SINKMOVES_PROCESS(0x00, A, 6add, 0x00, 0x00, 0x00, , , i)
+# define BFI_SINKMOVES_CLEAR_END(o, x, k, d, n, b, s, q, i) BFI_SINKMOVES_FLUSH(o, x, k, d, n, b, s, q)(6senter)
+
+# define BFI_SINKMOVES_PUT(o, x, k, d, n, b, s, q, j, m) BFI_IF(BFI_SYM_EQ(o, d))(BFI_SINKMOVES_MERGE_##j, BFI_SINKMOVES_SHIFT)(o, x, k, d, n, b, s, q, j, m)
+# define BFI_SINKMOVES_MERGE_6add(o, x, k, d, n, b, s, q, j, m) BFI_SINKMOVES_GO(o, x, k, d, BFI_ADD(n, m), b, s, q,
+# define BFI_SINKMOVES_MERGE_6set(o, x, k, d, n, b, s, q, j, m) BFI_SINKMOVES_GO(o, x, j, d, m, b, s, q,
+# define BFI_SINKMOVES_SHIFT(o, x, k, d, n, b, s, q, j, m) BFI_SINKMOVES_BOUND(o, BFI_SINKMOVES_AFTER_##k(x, d, n), j, o, m, BFI_ADD(b, BFI_SINKMOVES_CHARGE_##k(d, n)), BFI_REM(s)BFI_SINKMOVES_EMIT_##k(x, d, n), q)
+
+# define BFI_SINKMOVES_EMIT_6add(x, d, n) BFI_IFN(BFI_TEST_ZERO_##n)(BFI_EAT_2, BFI_IFN(BFI_TEST_ZERO_##d)(BFI_SINKMOVES_HERE_##x, BFI_SINKMOVES_ADD_##x))(d, n)
+# define BFI_SINKMOVES_EMIT_6set(x, d, n) BFI_IFN(BFI_TEST_ZERO_##d)(BFI_SINKMOVES_CLEAR_HERE, BFI_SINKMOVES_SET_##x)(d, n)
+# define BFI_SINKMOVES_AFTER_6add(x, d, n) BFI_IFN(BFI_TEST_ZERO_##n)(x, BFI_IFN(BFI_TEST_ZERO_##d)(BFI_SINKMOVES_STAY_##x, BFI_SINKMOVES_FLIP_##x))
+# define BFI_SINKMOVES_AFTER_6set(x, d, n) BFI_IFN(BFI_TEST_ZERO_##d)(BFI_IFN(BFI_TEST_ZERO_##n)(x, BFI_SINKMOVES_HOLD_##x), BFI_SINKMOVES_FLIP_##x)
+# define BFI_SINKMOVES_CHARGE_6add(d, n) BFI_IFN(BFI_TEST_ZERO_##n)(0x00, BFI_SINKMOVES_COST_##d)
+# define BFI_SINKMOVES_CHARGE_6set(d, n) BFI_SINKMOVES_COST_##d
+# define BFI_SINKMOVES_CLEAR_HERE(d, n) (6senter)(6sexit)BFI_IFN(BFI_TEST_ZERO_##n)(, BFI_SINKMOVES_HERE_A(d, n))
+
+# define BFI_SINKMOVES_ADD_A(d, n) (6addA(d, n))
+# define BFI_SINKMOVES_ADD_B(d, n) (6addB(d, n))
+# define BFI_SINKMOVES_ADD_HA(d, n) (6addA(d, n))
+# define BFI_SINKMOVES_ADD_HB(d, n) (6addB(d, n))
+# define BFI_SINKMOVES_SET_A(d, n) (6setA(d, n))
+# define BFI_SINKMOVES_SET_B(d, n) (6setB(d, n))
+# define BFI_SINKMOVES_SET_HA(d, n) (6setA(d, n))
+# define BFI_SINKMOVES_SET_HB(d, n) (6setB(d, n))
+# define BFI_SINKMOVES_HERE_A(d, n) BFI_SWITCH((BFI_SINKMOVES_UNIT_##n, (6add(n))))
+# define BFI_SINKMOVES_HERE_B(d, n) BFI_SWITCH((BFI_SINKMOVES_UNIT_##n, (6add(n))))
+# define BFI_SINKMOVES_HERE_HA(d, n) (6addA(d, n))
+# define BFI_SINKMOVES_HERE_HB(d, n) (6addB(d, n))
+# define BFI_SINKMOVES_FLIP_A B
+# define BFI_SINKMOVES_FLIP_B A
+# define BFI_SINKMOVES_FLIP_HA B
+# define BFI_SINKMOVES_FLIP_HB A
+# define BFI_SINKMOVES_STAY_A HA
+# define BFI_SINKMOVES_STAY_B HB
+# define BFI_SINKMOVES_STAY_HA B
+# define BFI_SINKMOVES_STAY_HB A
+# define BFI_SINKMOVES_HOLD_A HA
+# define BFI_SINKMOVES_HOLD_B HB
+# define BFI_SINKMOVES_HOLD_HA HA
+# define BFI_SINKMOVES_HOLD_HB HB
+# define BFI_SINKMOVES_UNIT_0x01 BFI_TEST_SUCCESS((6inc))
+# define BFI_SINKMOVES_UNIT_0xff BFI_TEST_SUCCESS((6dec))
+
+# define BFI_SINKMOVES_DISPATCH_6inc BFI_TEST_SUCCESS(BFI_SINKMOVES_ADDITIVE)
+# define BFI_SINKMOVES_DISPATCH_6dec BFI_TEST_SUCCESS(BFI_SINKMOVES_ADDITIVE)
+# define BFI_SINKMOVES_DISPATCH_6add BFI_TEST_SUCCESS(BFI_SINKMOVES_ADDITIVE)
+# define BFI_SINKMOVES_DISPATCH_6next BFI_TEST_SUCCESS(BFI_SINKMOVES_NEXT)
+# define BFI_SINKMOVES_DISPATCH_6prev BFI_TEST_SUCCESS(BFI_SINKMOVES_PREV)
+# define BFI_SINKMOVES_DISPATCH_6senter BFI_TEST_SUCCESS(BFI_SINKMOVES_SENTER)
+# define BFI_SINKMOVES_CLEAR_6sexit BFI_TEST_SUCCESS(BFI_SINKMOVES_CLEAR_SET)
+
+# if BFI_CHUNKED_TAPE || BFI_ZERO_RUNS
+# define BFI_TEST_SINKMOVES_MAX_0x04 ()
+# define BFI_TEST_SINKMOVES_MIN_0xfc ()
+# else
+# define BFI_TEST_SINKMOVES_MAX_0x08 ()
+# define BFI_TEST_SINKMOVES_MIN_0xf8 ()
+# endif
+
+/* BFI_SINKMOVES_COST_##d
+ *  The cost of an item for the cell at the offset 'd', or of a move by 'd',
+ *  as a negative octet.
+ */
+# define BFI_SINKMOVES_COST_0x00 0x00
+# define BFI_SINKMOVES_COST_0x01 0xff
+# define BFI_SINKMOVES_COST_0x02 0xfe
+# define BFI_SINKMOVES_COST_0x03 0xfd
+# define BFI_SINKMOVES_COST_0x04 0xfc
+# define BFI_SINKMOVES_COST_0x05 0xfb
+# define BFI_SINKMOVES_COST_0x06 0xfa
+# define BFI_SINKMOVES_COST_0x07 0xf9
+# define BFI_SINKMOVES_COST_0x08 0xf8
+# define BFI_SINKMOVES_COST_0xff 0xff
+# define BFI_SINKMOVES_COST_0xfe 0xfe
+# define BFI_SINKMOVES_COST_0xfd 0xfd
+# define BFI_SINKMOVES_COST_0xfc 0xfc
+# define BFI_SINKMOVES_COST_0xfb 0xfb
+# define BFI_SINKMOVES_COST_0xfa 0xfa
+# define BFI_SINKMOVES_COST_0xf9 0xf9
+# define BFI_SINKMOVES_COST_0xf8 0xf8
+
+/* BFI_SINKMOVES_MOVES_##o
+ *  The moves that take the pointer by the offset 'o', from 0xf8 to 0x08.
+ */
+# define BFI_SINKMOVES_MOVES_0x00
+# define BFI_SINKMOVES_MOVES_0x01 (6next)
+# define BFI_SINKMOVES_MOVES_0x02 (6next)BFI_SINKMOVES_MOVES_0x01
+# define BFI_SINKMOVES_MOVES_0x03 (6next)BFI_SINKMOVES_MOVES_0x02
+# define BFI_SINKMOVES_MOVES_0x04 (6next)BFI_SINKMOVES_MOVES_0x03
+# define BFI_SINKMOVES_MOVES_0x05 (6next)BFI_SINKMOVES_MOVES_0x04
+# define BFI_SINKMOVES_MOVES_0x06 (6next)BFI_SINKMOVES_MOVES_0x05
+# define BFI_SINKMOVES_MOVES_0x07 (6next)BFI_SINKMOVES_MOVES_0x06
+# define BFI_SINKMOVES_MOVES_0x08 (6next)BFI_SINKMOVES_MOVES_0x07
+# define BFI_SINKMOVES_MOVES_0xff (6prev)
+# define BFI_SINKMOVES_MOVES_0xfe (6prev)BFI_SINKMOVES_MOVES_0xff
+# define BFI_SINKMOVES_MOVES_0xfd (6prev)BFI_SINKMOVES_MOVES_0xfe
+# define BFI_SINKMOVES_MOVES_0xfc (6prev)BFI_SINKMOVES_MOVES_0xfd
+# define BFI_SINKMOVES_MOVES_0xfb (6prev)BFI_SINKMOVES_MOVES_0xfc
+# define BFI_SINKMOVES_MOVES_0xfa (6prev)BFI_SINKMOVES_MOVES_0xfb
+# define BFI_SINKMOVES_MOVES_0xf9 (6prev)BFI_SINKMOVES_MOVES_0xfa
+# define BFI_SINKMOVES_MOVES_0xf8 (6prev)BFI_SINKMOVES_MOVES_0xf9
+
 /* BFI_PEEPHOLE(code)
  *    code : flat-form BF program
  *  Apply a number of local optimizations:
- *    - Turn a 6write into a 6writeA or 6writeB
+ *    - Turn a 6write into a 6writeA or 6writeB. Same for 6read.
  *    - Turn a 6loop into a 6if it if ends with another loop
  *    - Turn a 6loop into a 6loopA when possible
  *    - Rewrite a sequence of 6next using 6next1, 6nextA and 6nextB.
- *      Same for 6prev.
+ *      Same for 6prev. With BFI_TREE_TAPE, a sequence of 6next and 6prev
+ *      becomes a single 6seek instead.
+ *    - Drop a loop, a 6scanR or a 6scanL that follows the end of a loop or
+ *      a 6scanR or 6scanL, as the current cell is 0x00 there
  *
  *  BFI_PEEPHOLE((6write)(6write)(6write))
  *    => (6writeA)(6writeB)(6writeA)
  *  BFI_PEEPHOLE((6next)(6next)(6next)(6next)(6next)(6next)(6next)(6next)(6next))
+ *    => (6nextA(0x09))
+ *
+ *  A run of more than 0xff moves is split into several instructions. The
+ *  tapes that only know moves of up to 4 cells at once split the run every
+ *  4 moves instead:
+ *
+ *  BFI_PEEPHOLE((6next)(6next)(6next)(6next)(6next)(6next)(6next)(6next)(6next))
  *    => (6nextA(0x04))(6nextB(0x04))(6next1)
  */
 # define BFI_PEEPHOLE(code) BFI_PEEPHOLE_I(BFI_SEQ_TO_GUIDE(code))
@@ -208,6 +645,7 @@
 # define BFI_PEEPHOLE_MOVE(i) BFI_PEEPHOLE_ON_MOVE(0, i, 0x01,
 # define BFI_PEEPHOLE_ALTERNATE(i) (i##A)BFI_PEEPHOLE_ON_ALTERNATE(i,
 # define BFI_PEEPHOLE_END(i) (6end(6loopA))BFI_PEEPHOLE_ON_END(
+# define BFI_PEEPHOLE_SCAN(i) (i)BFI_PEEPHOLE_ON_END(
 
 # define BFI_PEEPHOLE_ON_MOVE(cont, base, cur, i, c) BFI_PEEPHOLE_ON_MOVE_##c(cont, base, cur, i
 # define BFI_PEEPHOLE_ON_MOVE_0(cont, base, cur, i) BFI_PEEPHOLE_MOVE_CREATE(cont, base, cur)
@@ -218,15 +656,19 @@
 # define BFI_PEEPHOLE_MOVE_ADD_0(cont, base, cur) BFI_PEEPHOLE_ON_MOVE(cont, base, BFI_ADD_0x01_##cur,
 # define BFI_PEEPHOLE_MOVE_ADD_1(cont, base, cur) BFI_PEEPHOLE_MOVE_CREATE(cont, base, cur)BFI_PEEPHOLE_ON_MOVE(BFI_NOT(cont), base, 0x01,
 
+# define BFI_TEST_PEEPHOLE_MOVE_MAX_0xff ()
+# if BFI_CHUNKED_TAPE || BFI_ZERO_RUNS || BFI_REGISTER_WINDOW
 # define BFI_TEST_PEEPHOLE_MOVE_MAX_0x04 ()
+# endif
 
 # define BFI_PEEPHOLE_ON_ALTERNATE(base, i, c) BFI_IF(c)(BFI_PEEPHOLE_ALTERNATE_SWITCH, BFI_EAT_2)(base, i
 # define BFI_PEEPHOLE_ALTERNATE_SWITCH(base, i) BFI_IFC(BFI_SYM_MATCH(base, i))((1)(BFI_PEEPHOLE_OTHER, BFI_PCAT(i, B)), (1)(BFI_PEEPHOLE_PROCESS, i)))
 
 # define BFI_PEEPHOLE_ON_END(i, c) BFI_IF(c)(BFI_PEEPHOLE_END_SWITCH, BFI_EAT)(i
-# define BFI_PEEPHOLE_END_SWITCH(i) BFI_IFN(BFI_TEST_LOOP_##i)(BFI_PEEPHOLE_END_LOOP, BFI_IFN(BFI_TEST_END_##i)(BFI_PEEPHOLE_END_END, BFI_PEEPHOLE_PROCESS))(i)
+# define BFI_PEEPHOLE_END_SWITCH(i) BFI_IFN(BFI_TEST_LOOP_##i)(BFI_PEEPHOLE_END_LOOP, BFI_IFN(BFI_TEST_END_##i)(BFI_PEEPHOLE_END_END, BFI_IFN(BFI_TEST_SCAN_##i)(BFI_PEEPHOLE_END_SCAN, BFI_PEEPHOLE_PROCESS)))(i)
 # define BFI_PEEPHOLE_END_LOOP(_) BFI_PEEPHOLE_EAT_LOOP(~,
 # define BFI_PEEPHOLE_END_END(_) (6end(6if))BFI_PEEPHOLE_ON_END(
+# define BFI_PEEPHOLE_END_SCAN(_) BFI_PEEPHOLE_ON_END(
 
 # define BFI_PEEPHOLE_EAT_LOOP(n, i, c) BFI_IF(c)(BFI_PEEPHOLE_EAT_LOOP_NEXT, BFI_EAT_2)(n, i
 # define BFI_PEEPHOLE_EAT_LOOP_NEXT(n, i) BFI_IFC(BFI_NULLARYP(BFI_TEST_END_##i))( \
@@ -235,8 +677,11 @@
 
 # define BFI_PEEPHOLE_DISPATCH_6next BFI_TEST_SUCCESS(BFI_PEEPHOLE_MOVE)
 # define BFI_PEEPHOLE_DISPATCH_6prev BFI_TEST_SUCCESS(BFI_PEEPHOLE_MOVE)
+# define BFI_PEEPHOLE_DISPATCH_6read BFI_TEST_SUCCESS(BFI_PEEPHOLE_ALTERNATE)
 # define BFI_PEEPHOLE_DISPATCH_6write BFI_TEST_SUCCESS(BFI_PEEPHOLE_ALTERNATE)
 # define BFI_PEEPHOLE_DISPATCH_6end BFI_TEST_SUCCESS(BFI_PEEPHOLE_END)
+# define BFI_PEEPHOLE_DISPATCH_6scanR(n) BFI_TEST_SUCCESS(BFI_PEEPHOLE_SCAN)
+# define BFI_PEEPHOLE_DISPATCH_6scanL(n) BFI_TEST_SUCCESS(BFI_PEEPHOLE_SCAN)
 
 /* BFI_ADDITIVEP(item)
  *    item : flat-item
@@ -267,11 +712,16 @@
  *  ::= '(' SIMPLE_I ',' ANY ')'
  *    | '(' OCTET_I ',' OCTET ')'
  *    | '(' LOOP_I ',' PROGRAM ')'
+ *    | '(' '6seek' ',' OFFSET ')'
+ *    | '(' OFFSET_I ',' '(' OCTET ',' OCTET ')' ')'
  * SIMPLE_I ::= <any single-token flat item>
  * OCTET_I ::= '6nextA' | '6nextB' | '6prevA' | '6prevB' | '6sadd'
+ *           | '6scanR' | '6scanL'
  * LOOP_I ::= '6loop' | '6loopA' | '6if'
+ * OFFSET_I ::= '6addA' | '6addB' | '6setA' | '6setB'
  * ANY ::= <any portable>
  * OCTET ::= <any octet>
+ * OFFSET ::= <an offset, as in "Tree tape">
  *
  * In words, a program is a binary sequence whose each item is a pair of
  * a bf-cm instruction (defined below) and its operand. Note that loop
@@ -334,7 +784,16 @@
 # define BFI_UNFLATTEN_DISPATCH_6prev1 BFI_TEST_SUCCESS(()(6prev1,~)BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6prevA(d) BFI_TEST_SUCCESS(()(6prevA,d)BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6prevB(d) BFI_TEST_SUCCESS(()(6prevB,d)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6seek(d) BFI_TEST_SUCCESS(()(6seek,d)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6scanR(d) BFI_TEST_SUCCESS(()(6scanR,d)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6scanL(d) BFI_TEST_SUCCESS(()(6scanL,d)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6addA(a, b) BFI_TEST_SUCCESS(()(6addA,(a, b))BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6addB(a, b) BFI_TEST_SUCCESS(()(6addB,(a, b))BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6setA(a, b) BFI_TEST_SUCCESS(()(6setA,(a, b))BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6setB(a, b) BFI_TEST_SUCCESS(()(6setB,(a, b))BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6read BFI_TEST_SUCCESS(()(6read,~)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6readA BFI_TEST_SUCCESS(()(6readA,~)BFI_EMPTY)
+# define BFI_UNFLATTEN_DISPATCH_6readB BFI_TEST_SUCCESS(()(6readB,~)BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6write BFI_TEST_SUCCESS(()(6write,~)BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6writeA BFI_TEST_SUCCESS(()(6writeA,~)BFI_EMPTY)
 # define BFI_UNFLATTEN_DISPATCH_6writeB BFI_TEST_SUCCESS(()(6writeB,~)BFI_EMPTY)
@@ -367,38 +826,201 @@
 # define BFI_FINST_6exec(f, v, d, t) BFI_EXEC_I(f, v, BFI_FJUMP_TO d)(6tuple_4, ~)(t, BFI_PUSH_END)
 # define BFI_EXEC_I(f, v, jd) f(BFI_REM_4 v, jd
 # define BFI_INITIAL_STATE(input) (7z, 0x00, 7z, input)
+
+/* BFI_EXEC_STATS(code, input)
+ *    code, input : as in BFI_EXEC
+ *  Run the program on the counted machine. Expand to a quaternary tuple
+ *  (out, slow, fast, len), where 'out' is what BFI_EXEC would expand to and
+ *  the rest are as described in BFI_FMACHINE_STATS. The fast steps are only
+ *  counted if BFI_COUNT_FAST_STEPS is 1. Otherwise 'fast' is 0uncounted, so
+ *  that it is not taken for a count of zero.
+ */
+# define BFI_EXEC_STATS(code, input) BFI_EXEC_STATS_I(BFI_FMACHINE_STATS(BFI_INITIAL_STATE(input), 6exec, code))
+# define BFI_EXEC_STATS_I(r) BFI_EXEC_STATS_II r
+# define BFI_EXEC_STATS_II(o, s, t, n) (o(0eof), s, BFI_STATS_FAST(t), n)
+
+# if BFI_COUNT_FAST_STEPS
+# define BFI_STATS_FAST(t) t
+# else
+# define BFI_STATS_FAST(t) 0uncounted
+# endif
+
+/* BFI_EXEC_PROFILE(code, input)
+ *    code, input : as in BFI_EXEC
+ *  Run the program on the counted machine, and count how many times each
+ *  bf-cm instruction runs. Expands to a binary tuple (out, report), where
+ *  'out' is what BFI_EXEC would expand to, and 'report' is a sequence of
+ *  (inst, count), one for each instruction that has run at least once, in
+ *  the order of BFI_PROF_REPORT_I in prof.h. The counts are decimal
+ *  pp-numbers.
+ *
+ *  An instruction that is reached by a fast step is only counted if
+ *  BFI_COUNT_FAST_STEPS is 1. Otherwise only the slow steps are counted,
+ *  and the report ends with (fast steps, not counted), so that it is not
+ *  taken for the whole picture.
+ */
+# define BFI_EXEC_PROFILE(code, input) BFI_EXEC_PROFILE_I(BFI_FMACHINE_TALLY(BFI_INITIAL_STATE(input), 6exec, code, BFI_PROF_TALLY, BFI_PROF_ZERO))
+# define BFI_EXEC_PROFILE_I(r) BFI_EXEC_PROFILE_II r
+# define BFI_EXEC_PROFILE_II(o, a) (o(0eof), BFI_PROF_RESULT(a))
+
+# if BFI_COUNT_FAST_STEPS
+# define BFI_PROF_RESULT(a) BFI_PROF_REPORT(a)
+# else
+# define BFI_PROF_RESULT(a) BFI_PROF_REPORT(a) (fast steps, not counted)
+# endif
+
+/* BFI_EXEC_SAMPLE(code, input)
+ *    code, input : as in BFI_EXEC
+ *  Run the program on the sampled machine. Expand to a binary tuple
+ *  (out, samples), where 'out' is what BFI_EXEC would expand to and
+ *  'samples' is the sequence of the (g, t) of the (0sample(g, t)) items that
+ *  BFI_FMACHINE_SAMPLE put in the output buffer, in order.
+ */
+# define BFI_EXEC_SAMPLE(code, input) BFI_EXEC_SAMPLE_I(BFI_FMACHINE_SAMPLE(BFI_INITIAL_STATE(input), 6exec, code)(0eof))
+# define BFI_EXEC_SAMPLE_I(o) (BFI_SCAN_N(BFI_SEQ_FOR_EACH(BFI_EXEC_SAMPLE_OUT, o, ~)), BFI_SCAN_N(BFI_SEQ_FOR_EACH(BFI_EXEC_SAMPLE_TAKE, o, ~)))
+# define BFI_EXEC_SAMPLE_OUT(x, _) BFI_SWITCH((BFI_EXEC_SAMPLE_DROP_##x, (x)))
+# define BFI_EXEC_SAMPLE_TAKE(x, _) BFI_SWITCH((BFI_EXEC_SAMPLE_KEEP_##x, ))
+# define BFI_EXEC_SAMPLE_DROP_0sample(g, t) BFI_TEST_SUCCESS()
+# define BFI_EXEC_SAMPLE_KEEP_0sample(g, t) BFI_TEST_SUCCESS((g, t))
+
+/* BFI_EXEC_TRACE(code, input)
+ *    code, input : as in BFI_EXEC
+ *  Like BFI_EXEC, but also write a (0trace(k, c)) to the output buffer
+ *  before every item of the program that runs, including every check of a
+ *  loop. 'k' is the item, such as (6add,0x02) or the whole
+ *  (6loopA,(6add,0xff)(6nextA,0x01)), and 'c' is the current cell at that
+ *  point. The records and the octets are in the order they were written.
+ *
+ *  BFI_EXEC_TRACE((6read,~)(6loopA,(6writeA,~)(6read,~)), (0x61)(0x00)(0eof))
+ *    => (0trace((6read, ~), 0x00))(0trace((6loopA, (6writeA,~)(6read,~)), 0x61))
+ *       (0trace((6writeA, ~), 0x61))(0x61)(0trace((6read, ~), 0x61))
+ *       (0trace((6loopA, (6writeA,~)(6read,~)), 0x00))(0eof)
+ */
+# define BFI_EXEC_TRACE(code, input) BFI_FMACHINE_O(BFI_INITIAL_STATE(input), 6texec, code)(0eof)
+
+/* BFI_PROF_TALLY(j, a, o)
+ *  The tally macro of BFI_EXEC_PROFILE. 'a' is a tuple of counters, one for
+ *  each instruction, as described in BFI_FMACHINE_COUNT. The ticks of the
+ *  instructions that have a slot in prof.h are counted, other ticks are
+ *  dropped, and the rest of 'o' is kept. gen_prof.hs lists the counted
+ *  instructions; a new instruction has to be added there.
+ */
+# define BFI_PROF_TALLY(j, a, o) BFI_PROF_TALLY_I(j, a, BFI_SEQ_TO_GUIDE(o))
+# define BFI_PROF_TALLY_I(j, a, g) BFI_PROF_GO(j, a, g
+# define BFI_PROF_GO(j, a, i, c) BFI_IF(c)(BFI_PROF_ITEM, BFI_PROF_END)(j, a, i
+# define BFI_PROF_ITEM(j, a, i) BFI_SWITCH((BFI_PROF_TICK_##i, BFI_PROF_KEEP))(j, a, i)
+# define BFI_PROF_END(j, a, i) j(a,
+# define BFI_PROF_KEEP(j, a, i) (i)BFI_PROF_GO(j, a,
+# define BFI_PROF_SKIP(j, a, i) BFI_PROF_GO(j, a,
+# define BFI_PROF_TICK_0slow(g) BFI_TEST_SUCCESS(BFI_PROF_SLOT(g))
+# define BFI_PROF_TICK_0fast(g) BFI_TEST_SUCCESS(BFI_PROF_SLOT(g))
+# define BFI_PROF_SLOT(g) BFI_SWITCH((BFI_PROF_SLOT_##g, BFI_PROF_SKIP))
+
+/* BFI_PROF_REPORT(a)
+ *  Turn the counters into the report of BFI_EXEC_PROFILE, with the rows in
+ *  the order of gen_prof.hs.
+ */
+# define BFI_PROF_REPORT(a) BFI_PROF_REPORT_I a
+# define BFI_PROF_ROW(x, c) BFI_PROF_ROW_I(x, BFI_FMACHINE_NUMBER(c))
+# define BFI_PROF_ROW_I(x, n) BFI_PROF_ROW_II(x, n)
+# define BFI_PROF_ROW_II(x, n) BFI_SWITCH((BFI_PROF_ZERO_##n, (x, n)))
+# define BFI_PROF_ZERO_0 BFI_TEST_SUCCESS()
+
+/* BFI_EXEC_SLICE(code, input, n)
+ *    code, input : as in BFI_EXEC
+ *    n : integer, 0 <= n < BFI_MACHINE_LEVELS
+ *  Start running the program, and expand to the first slice as described in
+ *  BFI_RUN_SLICE.
+ */
+# define BFI_EXEC_SLICE(code, input, n) BFI_EXEC_SLICE_END(BFI_EXEC_SLICE_RAW(code, input, n))
+# define BFI_EXEC_SLICE_RAW(code, input, n) BFI_FMACHINE_SLICE(n, BFI_FMACHINE_START(BFI_INITIAL_STATE(input), 6exec, code))
+# define BFI_EXEC_SLICE_END(r) BFI_EXEC_SLICE_END_I r
+# define BFI_EXEC_SLICE_END_I(c, o, z) (c, o BFI_UNLESS(c)((0eof)), z)
+
+/* BFI_EXEC_LIMITED_END(r)
+ *    r : the (c, o, z) of BFI_FMACHINE_SLICE
+ *  Format the octets written by the slice, and add 0timeout if it has been
+ *  suspended. The state is dropped.
+ */
+# define BFI_EXEC_LIMITED_END(r) BFI_EXEC_LIMITED_END_I(BFI_REM_3 r)
+# define BFI_EXEC_LIMITED_END_I(r) BFI_EXEC_LIMITED_END_II(r)
+# define BFI_EXEC_LIMITED_END_II(c, o, z) BFI_FORMAT_PRETTY(o (0eof)) BFI_WHEN(c)(0timeout)
 # define BFI_FINST_6tuple_4(f, x1, x2, x3, x4, d, t) f((x1, x2, x3, x4), t, BFI_RETURN
 
 /* bf-cm instructions */
 
 # define BFI_FINST_6next(f, l, c, r, i, d, t) f(BFI_BF_NEXT(l, c, r) BFI_COMMA() i, t, BFI_RETURN
 # define BFI_FINST_6prev(f, l, c, r, i, d, t) f(BFI_BF_PREV(l, c, r) BFI_COMMA() i, t, BFI_RETURN
-# define BFI_FINST_6next1(f, l, c, r, i, d, t) BFI_FINST_##t(f, BFI_CONS(c, l), BFI_HEAD(r), BFI_TAIL(r), i, BFI_EMPTY(
-# define BFI_FINST_6prev1(f, l, c, r, i, d, t) BFI_FINST_##t(f, BFI_TAIL(l), BFI_HEAD(l), BFI_CONS(c, r), i, BFI_EMPTY(
+# define BFI_FINST_6next1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, BFI_CONS(c, l), BFI_HEAD(r), BFI_TAIL(r), i, BFI_EMPTY(
+# define BFI_FINST_6prev1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, BFI_TAIL(l), BFI_HEAD(l), BFI_CONS(c, r), i, BFI_EMPTY(
 
-# define BFI_FINST_6nextA(f, l, c, r, i, d, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MOVE_FORWARD(d, l, c, r)), i, BFI_EMPTY(
-# define BFI_FINST_6nextB(f, l, c, r, i, d, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MOVE_FORWARD(d, l, c, r)), i, BFI_EMPTY(
-# define BFI_FINST_6prevA(f, l, c, r, i, d, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MEM_FLIP(BFI_MOVE_FORWARD(d, r, c, l))), i, BFI_EMPTY(
-# define BFI_FINST_6prevB(f, l, c, r, i, d, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MEM_FLIP(BFI_MOVE_FORWARD(d, r, c, l))), i, BFI_EMPTY(
+# define BFI_FINST_6nextA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MOVE_FORWARD(d, l, c, r)), i, BFI_EMPTY(
+# define BFI_FINST_6nextB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MOVE_FORWARD(d, l, c, r)), i, BFI_EMPTY(
+# define BFI_FINST_6prevA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MEM_FLIP(BFI_MOVE_FORWARD(d, r, c, l))), i, BFI_EMPTY(
+# define BFI_FINST_6prevB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_MEM_FLIP(BFI_MOVE_FORWARD(d, r, c, l))), i, BFI_EMPTY(
 
-# define BFI_FINST_6inc(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, BFI_PCAT(BFI_ADD_0x01_, c), r, i, BFI_EMPTY(
-# define BFI_FINST_6dec(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, BFI_PCAT(BFI_ADD_0xff_, c), r, i, BFI_EMPTY(
+# define BFI_FINST_6inc(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_PCAT(BFI_ADD_0x01_, c), r, i, BFI_EMPTY(
+# define BFI_FINST_6dec(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_PCAT(BFI_ADD_0xff_, c), r, i, BFI_EMPTY(
 # define BFI_FINST_6loop(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF, BFI_LOOP_CONTF)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
 # define BFI_FINST_6loopA(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF_A, BFI_LOOP_CONTF_A)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
 # define BFI_LOOP_ENDF(f, l, c, r, i, d, t, ds) f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, t, BFI_RETURN
-# define BFI_LOOP_ENDF_A(f, l, c, r, i, d, t, ds) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# define BFI_LOOP_ENDF_A(f, l, c, r, i, d, t, ds) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
 # define BFI_LOOP_CONTF(f, l, c, r, i, d, t, ds) f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, ds(6loop, d)(t, BFI_PUSH_END)
 # define BFI_LOOP_CONTF_A(f, l, c, r, i, d, t, ds) f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, ds(6loopA, d)(t, BFI_PUSH_END)
 # define BFI_LOOP_ONCEF(f, l, c, r, i, d, t, ds) f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, ds(t, BFI_PUSH_END)
 # define BFI_FINST_6if(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF_A, BFI_LOOP_ONCEF)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
 # define BFI_FINST_6write(f, l, c, r, i, d, t) (c)f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, t, BFI_RETURN
-# define BFI_FINST_6writeA(f, l, c, r, i, d, t) (c)BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
-# define BFI_FINST_6writeB(f, l, c, r, i, d, t) (c)BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# define BFI_FINST_6writeA(f, l, c, r, i, d, t) (c)BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# define BFI_FINST_6writeB(f, l, c, r, i, d, t) (c)BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
 # define BFI_FINST_6read(f, l, c, r, i, d, t) f(BFI_BF_READ(l, c, r, i), t, BFI_RETURN
-# define BFI_FINST_6add(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, BFI_ADD(d, c), r, i, BFI_EMPTY(
-# define BFI_FINST_6senter(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, 0x00, r, (i)c, BFI_EMPTY(
-# define BFI_FINST_6sexit(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, c, r, BFI_TAKE_PREFIX(i), BFI_EMPTY(
-# define BFI_FINST_6sadd(f, l, c, r, i, d, t) BFI_FINST_##t(f, l, BFI_ADD(BFI_MUL(d, BFI_EAT i), c), r, i, BFI_EMPTY(
+# define BFI_FINST_6readA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_BF_READ(l, c, r, i)), BFI_EMPTY(
+# define BFI_FINST_6readB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_BF_READ(l, c, r, i)), BFI_EMPTY(
+# define BFI_FINST_6add(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_ADD(d, c), r, i, BFI_EMPTY(
+# define BFI_FINST_6senter(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, 0x00, r, (i)c, BFI_EMPTY(
+# define BFI_FINST_6sexit(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, BFI_TAKE_PREFIX(i), BFI_EMPTY(
+# define BFI_FINST_6sadd(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_ADD(BFI_MUL(d, BFI_EAT i), c), r, i, BFI_EMPTY(
+
+/* Traced execution, used by BFI_EXEC_TRACE.
+ *
+ * A traced jump pushes the items of a sequence like BFI_FJUMP_TO, but puts a
+ * 6tlog in front of each of them, with the name of the item as its operand.
+ * 6tlog takes the operand of the item from the next frame, writes a
+ * (0trace(k, c)) to the output buffer, where 'k' is the item and 'c' is the
+ * current cell, and then runs the item as a fast step. The loop items are
+ * renamed to 6tloop, 6tloopA and 6tif, which enter their bodies with a
+ * traced jump, so that the items pushed later are traced too.
+ *
+ * The continuation that follows the items is pushed as usual. It always
+ * starts with 6tlog or 6tuple_4, which is how the traced jump knows where
+ * the items end.
+ */
+# define BFI_FINST_6texec(f, v, d, t) BFI_EXEC_I(f, v, BFI_TRACE_JUMP d)(6tuple_4, ~)(t, BFI_PUSH_END)
+# define BFI_FINST_6tlog(f, l, c, r, i, d, t) BFI_TRACE_PEEK(f, l, c, r, i, d, t, BFI_EMPTY(
+# define BFI_TRACE_PEEK(f, l, c, r, i, k, t, x, u) (0trace((k, x), c))BFI_FINST_##t(f, l, c, r, i, x, u)
+# define BFI_FINST_6tloop(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF, BFI_LOOP_CONTF)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+# define BFI_FINST_6tloopA(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF_A, BFI_LOOP_CONTF_A)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+# define BFI_FINST_6tif(f, l, c, r, i, d, t) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_LOOP_ENDF_A, BFI_LOOP_ONCEF)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+
+# define BFI_TRACE_JUMP(k, x) 6tlog, BFI_TRACE_PUSH_D(k, x)
+# define BFI_TRACE_PUSH_D BFI_DEFER(BFI_TRACE_PUSH)
+# define BFI_TRACE_PUSH(k, x) ,k, BFI_TRACE_RENAME(k)))x,BFI_TRACE_OPEN_0
+# define BFI_TRACE_OPEN_0(k, x) BFI_TRACE_HEAD(k) x,BFI_TRACE_NEXT(k) 1)
+# define BFI_TRACE_OPEN_1(k, x) BFI_TRACE_HEAD(k) x,BFI_TRACE_NEXT(k) 0)
+# define BFI_TRACE_OPEN_NEXT BFI_TRACE_OPEN_CAT(
+# define BFI_TRACE_OPEN_CAT(n) BFI_TRACE_OPEN_##n
+# define BFI_TRACE_LEAVE_NEXT BFI_TRACE_LEAVE_CAT(
+# define BFI_TRACE_LEAVE_CAT(n) BFI_EASY_OPEN_CONT_##n
+# define BFI_TRACE_HEAD(k) BFI_IFN(BFI_TRACE_END_##k)(BFI_TRACE_KEEP, BFI_TRACE_WRAP)(k)
+# define BFI_TRACE_KEEP(k) k))
+# define BFI_TRACE_WRAP(k) 6tlog))k, BFI_TRACE_RENAME(k)))
+# define BFI_TRACE_NEXT(k) BFI_CAT(BFI_IFN(BFI_TRACE_END_##k)(BFI_TRACE_LEAVE_, BFI_TRACE_OPEN_), NEXT)
+# define BFI_TRACE_RENAME(k) BFI_SWITCH((BFI_TRACE_RENAME_##k, k))
+
+# define BFI_TRACE_END_6tlog ()
+# define BFI_TRACE_END_6tuple_4 ()
+# define BFI_TRACE_RENAME_6loop BFI_TEST_SUCCESS(6tloop)
+# define BFI_TRACE_RENAME_6loopA BFI_TEST_SUCCESS(6tloopA)
+# define BFI_TRACE_RENAME_6if BFI_TEST_SUCCESS(6tif)
 
 # define BFI_FINST_6id_4(f, x1, x2, x3, x4, d, t) f(x1 BFI_COMMA() x2 BFI_COMMA() x3 BFI_COMMA() x4, t, BFI_RETURN
 
@@ -457,11 +1079,12 @@
 # define BFI_CONS_7z_I(x) BFI_IFN(BFI_TEST_ZERO_##x)(7z, 7c(x,7z))
 
 /* BFI_MOVE_FORWARD(n, l, c, r)
- *    n : octet, 1 <= n <= 4
+ *    n : octet, 0x02 or more
  *    l : octet-list
  *    c : octet
  *    r : octet-list
- *  Move the zipper (l, c, r) to the right by 'n' items.
+ *  Move the zipper (l, c, r) to the right by 'n' items, using the tables
+ *  of move.h. The chunked and zero-run tapes only extend them up to n = 4.
  *
  *  BFI_MOVE_FORWARD(0x02, 7c(0x18,7c(0x17,7c(0x16,7z))), 0x19, 7c(0x20,7c(0x21,7c(0x22,7z))))
  *    => 7c(0x20,7c(0x19,7c(0x18,7c(0x17,7c(0x16,7z))))), 0x21, 7c(0x22,7z)
@@ -469,28 +1092,953 @@
 # define BFI_MOVE_FORWARD(n, l, c, r) BFI_MOVE_FORWARD_I(n, l, c, BFI_UNCONS_##n##r)
 # define BFI_MOVE_FORWARD_I(n, l, c, g) BFI_CAT(BFI_CONS_MANY_##n, BFI_TAG_##l)(l,c,g
 
-# define BFI_UNCONS_0x017c(h, t) , h, t
-# define BFI_UNCONS_0x027c(h, t) h)BFI_UNCONS_0x01##t
-# define BFI_UNCONS_0x037c(h, t) h,BFI_UNCONS_0x02##t
-# define BFI_UNCONS_0x047c(h, t) h,BFI_UNCONS_0x03##t
+# define BFI_TAG_7c(h, t) 7c
+# define BFI_TAG_7z 7z
+
+/*** Scan loops
+ *
+ * BFI_SCANLOOP turns a loop like [>] or [<<<] into a 6scanR or 6scanL. A
+ * fast step of it tests the current cell and moves on, up to 16 times. If
+ * the zero cell is further away, the instruction runs itself again as a
+ * slow step.
+ *
+ * With a stride of 1, the step only walks down the list it moves into, and
+ * keeps the cells it passes in a sequence. They are put onto the other list
+ * with a single BFI_CONS_MANY at the end of the step, so that list is not
+ * rebuilt for every cell. As these cells are never 0x00, a 7c node is
+ * always the right one to put them in, whichever tape is used.
+ */
 
-# define BFI_UNCONS_0x017z , 0x00, 7z
-# define BFI_UNCONS_0x027z 0x00), 0x00, 7z
-# define BFI_UNCONS_0x037z 0x00,0x00), 0x00, 7z
-# define BFI_UNCONS_0x047z 0x00,0x00,0x00), 0x00, 7z
+/* 6scanR, 6scanL: bf-cm instruction
+ *  Move the pointer to the right (6scanR) or to the left (6scanL) by the
+ *  operand until the current cell is 0x00.
+ */
+# define BFI_FINST_6scanR(f, l, c, r, i, d, t) BFI_SCANLOOP_END(6scanR, f, i, d, t, BFI_IFN(BFI_PCAT(BFI_TEST_ONE_, d))(BFI_SCANLOOP_RIGHT_1, BFI_SCANLOOP_RIGHT)(d, l, c, r))
+# define BFI_FINST_6scanL(f, l, c, r, i, d, t) BFI_SCANLOOP_END(6scanL, f, i, d, t, BFI_IFN(BFI_PCAT(BFI_TEST_ONE_, d))(BFI_SCANLOOP_LEFT_1, BFI_SCANLOOP_LEFT)(d, l, c, r))
+
+# define BFI_SCANLOOP_END(x, f, i, d, t, w) BFI_SCANLOOP_END_I(x, f, i, d, t, w)
+# define BFI_SCANLOOP_END_I(x, f, i, d, t, k, l, c, r) BFI_IF(k)(BFI_SCANLOOP_DONE, BFI_SCANLOOP_AGAIN)(x, f, l, c, r, i, d, t)
+# define BFI_SCANLOOP_DONE(x, f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# define BFI_SCANLOOP_AGAIN(x, f, l, c, r, i, d, t) f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, x, BFI_PASS_AUX d BFI_PUSH(t)
+
+# define BFI_SCANLOOP_RIGHT(n, l, c, r) BFI_SCANLOOP_WALK_16(BFI_SCANLOOP_NEXT, n, l, c, r)
+# define BFI_SCANLOOP_LEFT(n, l, c, r) BFI_SCANLOOP_WALK_16(BFI_SCANLOOP_PREV, n, l, c, r)
+# define BFI_SCANLOOP_NEXT(n, l, c, r) BFI_MOVE_FORWARD(n, l, c, r)
+# define BFI_SCANLOOP_PREV(n, l, c, r) BFI_MEM_FLIP(BFI_MOVE_FORWARD(n, r, c, l))
+
+# define BFI_SCANLOOP_RIGHT_1(n, l, c, r) BFI_SCANLOOP_RIGHT_1_I(l, BFI_SCANLOOP_RUN_0(, c, r))
+# define BFI_SCANLOOP_RIGHT_1_I(l, w) BFI_SCANLOOP_RIGHT_1_II(l, w)
+# define BFI_SCANLOOP_RIGHT_1_II(l, k, m, a, c, r) k, BFI_SCANLOOP_APPLY(m, l BFI_SCANLOOP_FLAT_A a(())), c, r
+# define BFI_SCANLOOP_LEFT_1(n, l, c, r) BFI_SCANLOOP_LEFT_1_I(r, BFI_SCANLOOP_RUN_0(, c, l))
+# define BFI_SCANLOOP_LEFT_1_I(r, w) BFI_SCANLOOP_LEFT_1_II(r, w)
+# define BFI_SCANLOOP_LEFT_1_II(r, k, m, a, c, l) k, l, c, BFI_SCANLOOP_APPLY(m, r BFI_SCANLOOP_FLAT_A a(()))
+
+# define BFI_SCANLOOP_APPLY(m, x) m(x)
+# define BFI_SCANLOOP_KEEP(xs) xs
+# define BFI_SCANLOOP_FLAT_A(x) BFI_IFN(x)(BFI_EAT, BFI_SCANLOOP_FLAT_A_I)(x)
+# define BFI_SCANLOOP_FLAT_A_I(x) , x BFI_SCANLOOP_FLAT_B
+# define BFI_SCANLOOP_FLAT_B(x) BFI_IFN(x)(BFI_EAT, BFI_SCANLOOP_FLAT_B_I)(x)
+# define BFI_SCANLOOP_FLAT_B_I(x) , x BFI_SCANLOOP_FLAT_A
+
+/* BFI_SCANLOOP_RUN_j(a, c, xs)
+ *    a : sequence of the j cells passed so far
+ *    c : octet
+ *    xs : octet-list
+ *  Move to the right on the cell 'c' followed by 'xs', until a 0x00 is
+ *  found, or up to the 16-th cell. Expand to k, m, a, c, xs, where 'k' is 1
+ *  if the 0x00 has been found, and 'm' puts the cells in 'a' onto a list.
+ */
+# define BFI_SCANLOOP_RUN_0(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_0, BFI_SCANLOOP_SKIP_0)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_0(a, c, xs) BFI_SCANLOOP_RUN_1_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_1_I(z) BFI_SCANLOOP_RUN_1(z)
+# define BFI_SCANLOOP_RUN_1(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_1, BFI_SCANLOOP_SKIP_1)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_1(a, c, xs) BFI_SCANLOOP_RUN_2_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_2_I(z) BFI_SCANLOOP_RUN_2(z)
+# define BFI_SCANLOOP_RUN_2(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_2, BFI_SCANLOOP_SKIP_2)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_2(a, c, xs) BFI_SCANLOOP_RUN_3_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_3_I(z) BFI_SCANLOOP_RUN_3(z)
+# define BFI_SCANLOOP_RUN_3(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_3, BFI_SCANLOOP_SKIP_3)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_3(a, c, xs) BFI_SCANLOOP_RUN_4_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_4_I(z) BFI_SCANLOOP_RUN_4(z)
+# define BFI_SCANLOOP_RUN_4(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_4, BFI_SCANLOOP_SKIP_4)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_4(a, c, xs) BFI_SCANLOOP_RUN_5_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_5_I(z) BFI_SCANLOOP_RUN_5(z)
+# define BFI_SCANLOOP_RUN_5(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_5, BFI_SCANLOOP_SKIP_5)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_5(a, c, xs) BFI_SCANLOOP_RUN_6_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_6_I(z) BFI_SCANLOOP_RUN_6(z)
+# define BFI_SCANLOOP_RUN_6(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_6, BFI_SCANLOOP_SKIP_6)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_6(a, c, xs) BFI_SCANLOOP_RUN_7_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_7_I(z) BFI_SCANLOOP_RUN_7(z)
+# define BFI_SCANLOOP_RUN_7(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_7, BFI_SCANLOOP_SKIP_7)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_7(a, c, xs) BFI_SCANLOOP_RUN_8_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_8_I(z) BFI_SCANLOOP_RUN_8(z)
+# define BFI_SCANLOOP_RUN_8(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_8, BFI_SCANLOOP_SKIP_8)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_8(a, c, xs) BFI_SCANLOOP_RUN_9_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_9_I(z) BFI_SCANLOOP_RUN_9(z)
+# define BFI_SCANLOOP_RUN_9(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_9, BFI_SCANLOOP_SKIP_9)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_9(a, c, xs) BFI_SCANLOOP_RUN_10_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_10_I(z) BFI_SCANLOOP_RUN_10(z)
+# define BFI_SCANLOOP_RUN_10(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_10, BFI_SCANLOOP_SKIP_10)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_10(a, c, xs) BFI_SCANLOOP_RUN_11_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_11_I(z) BFI_SCANLOOP_RUN_11(z)
+# define BFI_SCANLOOP_RUN_11(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_11, BFI_SCANLOOP_SKIP_11)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_11(a, c, xs) BFI_SCANLOOP_RUN_12_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_12_I(z) BFI_SCANLOOP_RUN_12(z)
+# define BFI_SCANLOOP_RUN_12(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_12, BFI_SCANLOOP_SKIP_12)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_12(a, c, xs) BFI_SCANLOOP_RUN_13_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_13_I(z) BFI_SCANLOOP_RUN_13(z)
+# define BFI_SCANLOOP_RUN_13(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_13, BFI_SCANLOOP_SKIP_13)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_13(a, c, xs) BFI_SCANLOOP_RUN_14_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_14_I(z) BFI_SCANLOOP_RUN_14(z)
+# define BFI_SCANLOOP_RUN_14(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_14, BFI_SCANLOOP_SKIP_14)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_14(a, c, xs) BFI_SCANLOOP_RUN_15_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_15_I(z) BFI_SCANLOOP_RUN_15(z)
+# define BFI_SCANLOOP_RUN_15(a, c, xs) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_HALT_15, BFI_SCANLOOP_SKIP_15)(a, c, xs)
+# define BFI_SCANLOOP_SKIP_15(a, c, xs) BFI_SCANLOOP_RUN_16_I(a(c) BFI_UNCONS_0x01##xs)
+# define BFI_SCANLOOP_RUN_16_I(z) BFI_SCANLOOP_RUN_16(z)
+# define BFI_SCANLOOP_RUN_16(a, c, xs) 0, BFI_CONS_MANY_0x107c, a, c, xs
+# define BFI_SCANLOOP_HALT_0(a, c, xs) 1, BFI_SCANLOOP_KEEP, a, c, xs
+# define BFI_SCANLOOP_HALT_1(a, c, xs) 1, BFI_CONS_MANY_0x017c, a, c, xs
+# define BFI_SCANLOOP_HALT_2(a, c, xs) 1, BFI_CONS_MANY_0x027c, a, c, xs
+# define BFI_SCANLOOP_HALT_3(a, c, xs) 1, BFI_CONS_MANY_0x037c, a, c, xs
+# define BFI_SCANLOOP_HALT_4(a, c, xs) 1, BFI_CONS_MANY_0x047c, a, c, xs
+# define BFI_SCANLOOP_HALT_5(a, c, xs) 1, BFI_CONS_MANY_0x057c, a, c, xs
+# define BFI_SCANLOOP_HALT_6(a, c, xs) 1, BFI_CONS_MANY_0x067c, a, c, xs
+# define BFI_SCANLOOP_HALT_7(a, c, xs) 1, BFI_CONS_MANY_0x077c, a, c, xs
+# define BFI_SCANLOOP_HALT_8(a, c, xs) 1, BFI_CONS_MANY_0x087c, a, c, xs
+# define BFI_SCANLOOP_HALT_9(a, c, xs) 1, BFI_CONS_MANY_0x097c, a, c, xs
+# define BFI_SCANLOOP_HALT_10(a, c, xs) 1, BFI_CONS_MANY_0x0a7c, a, c, xs
+# define BFI_SCANLOOP_HALT_11(a, c, xs) 1, BFI_CONS_MANY_0x0b7c, a, c, xs
+# define BFI_SCANLOOP_HALT_12(a, c, xs) 1, BFI_CONS_MANY_0x0c7c, a, c, xs
+# define BFI_SCANLOOP_HALT_13(a, c, xs) 1, BFI_CONS_MANY_0x0d7c, a, c, xs
+# define BFI_SCANLOOP_HALT_14(a, c, xs) 1, BFI_CONS_MANY_0x0e7c, a, c, xs
+# define BFI_SCANLOOP_HALT_15(a, c, xs) 1, BFI_CONS_MANY_0x0f7c, a, c, xs
+
+/* BFI_SCANLOOP_WALK_k(m, n, l, c, r)
+ *    m : BFI_SCANLOOP_NEXT or BFI_SCANLOOP_PREV
+ *    n : octet, 0x02 or more
+ *  Move the zipper (l, c, r) with 'm' by 'n' until the current cell is
+ *  0x00, at most 'k' times. Expand to 1, l, c, r if the zero cell has been
+ *  found, or 0, l, c, r if not.
+ */
+# define BFI_SCANLOOP_WALK_16(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_16)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_16(m, n, l, c, r) BFI_SCANLOOP_WALK_15_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_15_I(m, n, z) BFI_SCANLOOP_WALK_15(m, n, z)
+# define BFI_SCANLOOP_WALK_15(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_15)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_15(m, n, l, c, r) BFI_SCANLOOP_WALK_14_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_14_I(m, n, z) BFI_SCANLOOP_WALK_14(m, n, z)
+# define BFI_SCANLOOP_WALK_14(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_14)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_14(m, n, l, c, r) BFI_SCANLOOP_WALK_13_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_13_I(m, n, z) BFI_SCANLOOP_WALK_13(m, n, z)
+# define BFI_SCANLOOP_WALK_13(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_13)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_13(m, n, l, c, r) BFI_SCANLOOP_WALK_12_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_12_I(m, n, z) BFI_SCANLOOP_WALK_12(m, n, z)
+# define BFI_SCANLOOP_WALK_12(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_12)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_12(m, n, l, c, r) BFI_SCANLOOP_WALK_11_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_11_I(m, n, z) BFI_SCANLOOP_WALK_11(m, n, z)
+# define BFI_SCANLOOP_WALK_11(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_11)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_11(m, n, l, c, r) BFI_SCANLOOP_WALK_10_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_10_I(m, n, z) BFI_SCANLOOP_WALK_10(m, n, z)
+# define BFI_SCANLOOP_WALK_10(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_10)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_10(m, n, l, c, r) BFI_SCANLOOP_WALK_9_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_9_I(m, n, z) BFI_SCANLOOP_WALK_9(m, n, z)
+# define BFI_SCANLOOP_WALK_9(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_9)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_9(m, n, l, c, r) BFI_SCANLOOP_WALK_8_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_8_I(m, n, z) BFI_SCANLOOP_WALK_8(m, n, z)
+# define BFI_SCANLOOP_WALK_8(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_8)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_8(m, n, l, c, r) BFI_SCANLOOP_WALK_7_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_7_I(m, n, z) BFI_SCANLOOP_WALK_7(m, n, z)
+# define BFI_SCANLOOP_WALK_7(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_7)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_7(m, n, l, c, r) BFI_SCANLOOP_WALK_6_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_6_I(m, n, z) BFI_SCANLOOP_WALK_6(m, n, z)
+# define BFI_SCANLOOP_WALK_6(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_6)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_6(m, n, l, c, r) BFI_SCANLOOP_WALK_5_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_5_I(m, n, z) BFI_SCANLOOP_WALK_5(m, n, z)
+# define BFI_SCANLOOP_WALK_5(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_5)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_5(m, n, l, c, r) BFI_SCANLOOP_WALK_4_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_4_I(m, n, z) BFI_SCANLOOP_WALK_4(m, n, z)
+# define BFI_SCANLOOP_WALK_4(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_4)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_4(m, n, l, c, r) BFI_SCANLOOP_WALK_3_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_3_I(m, n, z) BFI_SCANLOOP_WALK_3(m, n, z)
+# define BFI_SCANLOOP_WALK_3(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_3)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_3(m, n, l, c, r) BFI_SCANLOOP_WALK_2_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_2_I(m, n, z) BFI_SCANLOOP_WALK_2(m, n, z)
+# define BFI_SCANLOOP_WALK_2(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_2)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_2(m, n, l, c, r) BFI_SCANLOOP_WALK_1_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_1_I(m, n, z) BFI_SCANLOOP_WALK_1(m, n, z)
+# define BFI_SCANLOOP_WALK_1(m, n, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_ZERO_, c))(BFI_SCANLOOP_STOP, BFI_SCANLOOP_STEP_1)(m, n, l, c, r)
+# define BFI_SCANLOOP_STEP_1(m, n, l, c, r) BFI_SCANLOOP_WALK_0_I(m, n, m(n, l, c, r))
+# define BFI_SCANLOOP_WALK_0_I(m, n, z) BFI_SCANLOOP_WALK_0(m, n, z)
+# define BFI_SCANLOOP_WALK_0(m, n, l, c, r) 0, l, c, r
+# define BFI_SCANLOOP_STOP(m, n, l, c, r) 1, l, c, r
+
+/*** Offset arithmetic
+ *
+ * BFI_SINKMOVES leaves the pointer where a basic block starts, and turns
+ * each change to another cell into a 6addA, 6addB, 6setA or 6setB that
+ * carries the offset of the cell. These instructions only rebuild the list
+ * on the side of the cell, up to that cell, and leave the other one alone.
+ */
 
-# define BFI_CONS_MANY_0x017c(t, x0) 7c(x0,t)
-# define BFI_CONS_MANY_0x027c(t, x0, x1) 7c(x1,7c(x0,t))
-# define BFI_CONS_MANY_0x037c(t, x0, x1, x2) 7c(x2,7c(x1,7c(x0,t)))
-# define BFI_CONS_MANY_0x047c(t, x0, x1, x2, x3) 7c(x3,7c(x2,7c(x1,7c(x0,t))))
+/* 6addA, 6addB, 6setA, 6setB: bf-cm instruction
+ *  Add the octet 'n' to the cell at the offset 'd' from the current one
+ *  (6addA, 6addB), or write 'n' to it (6setA, 6setB), where the operand is
+ *  (d, n). 'd' is from 0xf8 to 0x08, as in BFI_SINKMOVES.
+ */
+# define BFI_FINST_6addA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_OFFSET_AT(BFI_ADD, BFI_REM_2 d, l, c, r)), i, BFI_EMPTY(
+# define BFI_FINST_6addB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_OFFSET_AT(BFI_ADD, BFI_REM_2 d, l, c, r)), i, BFI_EMPTY(
+# define BFI_FINST_6setA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_OFFSET_AT(BFI_OFFSET_SET, BFI_REM_2 d, l, c, r)), i, BFI_EMPTY(
+# define BFI_FINST_6setB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_OFFSET_AT(BFI_OFFSET_SET, BFI_REM_2 d, l, c, r)), i, BFI_EMPTY(
+
+/* BFI_OFFSET_AT(m, x, l, c, r)
+ *    m : BFI_ADD or BFI_OFFSET_SET
+ *    x : offset, octet
+ *    l, c, r : zipper
+ *  Replace the cell 'y' at the offset with m(octet, y), and expand to the
+ *  new zipper.
+ */
+# define BFI_OFFSET_AT(m, x, l, c, r) BFI_OFFSET_AT_I(m, x, l, c, r)
+# define BFI_OFFSET_AT_I(m, d, n, l, c, r) BFI_OFFSET_AT_##d(m, n, l, c, r)
+# define BFI_OFFSET_SET(n, x) n
+
+# define BFI_OFFSET_AT_0x00(m, n, l, c, r) l, m(n, c), r
+# define BFI_OFFSET_AT_0x01(m, n, l, c, r) l, c, BFI_OFFSET_PUT_0x01(m, n, r)
+# define BFI_OFFSET_AT_0xff(m, n, l, c, r) BFI_OFFSET_PUT_0x01(m, n, l), c, r
+# define BFI_OFFSET_AT_0x02(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x02, m, n, r)
+# define BFI_OFFSET_AT_0x03(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x03, m, n, r)
+# define BFI_OFFSET_AT_0x04(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x04, m, n, r)
+# define BFI_OFFSET_AT_0x05(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x05, m, n, r)
+# define BFI_OFFSET_AT_0x06(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x06, m, n, r)
+# define BFI_OFFSET_AT_0x07(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x07, m, n, r)
+# define BFI_OFFSET_AT_0x08(m, n, l, c, r) l, c, BFI_OFFSET_PUT(0x08, m, n, r)
+# define BFI_OFFSET_AT_0xfe(m, n, l, c, r) BFI_OFFSET_PUT(0x02, m, n, l), c, r
+# define BFI_OFFSET_AT_0xfd(m, n, l, c, r) BFI_OFFSET_PUT(0x03, m, n, l), c, r
+# define BFI_OFFSET_AT_0xfc(m, n, l, c, r) BFI_OFFSET_PUT(0x04, m, n, l), c, r
+# define BFI_OFFSET_AT_0xfb(m, n, l, c, r) BFI_OFFSET_PUT(0x05, m, n, l), c, r
+# define BFI_OFFSET_AT_0xfa(m, n, l, c, r) BFI_OFFSET_PUT(0x06, m, n, l), c, r
+# define BFI_OFFSET_AT_0xf9(m, n, l, c, r) BFI_OFFSET_PUT(0x07, m, n, l), c, r
+# define BFI_OFFSET_AT_0xf8(m, n, l, c, r) BFI_OFFSET_PUT(0x08, m, n, l), c, r
+
+/* BFI_OFFSET_PUT(k, m, n, xs)
+ *    k : octet, 0x02 or more
+ *    xs : octet-list
+ *  Replace the k-th item 'x' of 'xs' with m(n, x). The first k items are
+ *  taken off with BFI_UNCONS_##k and put back at once with BFI_CONS_MANY,
+ *  in the reverse order, so that only the one list is rebuilt. The chunked
+ *  and zero-run tapes only extend BFI_CONS_MANY up to 4 items, and
+ *  BFI_SINKMOVES keeps to offsets of 4 for them.
+ *
+ *  BFI_OFFSET_PUT(0x02, BFI_ADD, 0x01, 7c(0x05,7c(0x06,7z)))
+ *    => 7c(0x05,7c(0x07,7z))
+ */
+# define BFI_OFFSET_PUT(k, m, n, xs) BFI_OFFSET_PUT_I(k, m, n, BFI_UNCONS_##k##xs)
+# define BFI_OFFSET_PUT_I(k, m, n, g) BFI_OFFSET_PUT_II(k, m, n, (g)
+# define BFI_OFFSET_PUT_II(k, m, n, p, x, t) BFI_OFFSET_PUSH(k, BFI_TAG_##t, t, m(n, x), p)
+# define BFI_OFFSET_PUSH(k, g, t, x, p) BFI_OFFSET_PUSH_I(k, g, t, x, BFI_OFFSET_REV_##k p)
+# define BFI_OFFSET_PUSH_I(k, g, t, x, xs) BFI_CONS_MANY_##k##g(t, x, xs)
+
+# define BFI_OFFSET_PUT_0x01(m, n, xs) BFI_OFFSET_PUT_0x01_I(m, n BFI_UNCONS_0x01##xs)
+# define BFI_OFFSET_PUT_0x01_I(m, z) BFI_OFFSET_PUT_0x01_II(m, z)
+# define BFI_OFFSET_PUT_0x01_II(m, n, h, t) BFI_CONS(m(n, h), t)
+
+/* BFI_OFFSET_REV_##k(x0, ..., xm)
+ *    m = k - 2
+ *  Expand to the items in the reverse order.
+ */
+# define BFI_OFFSET_REV_0x02(x0) x0
+# define BFI_OFFSET_REV_0x03(x0, x1) x1, x0
+# define BFI_OFFSET_REV_0x04(x0, x1, x2) x2, x1, x0
+# define BFI_OFFSET_REV_0x05(x0, x1, x2, x3) x3, x2, x1, x0
+# define BFI_OFFSET_REV_0x06(x0, x1, x2, x3, x4) x4, x3, x2, x1, x0
+# define BFI_OFFSET_REV_0x07(x0, x1, x2, x3, x4, x5) x5, x4, x3, x2, x1, x0
+# define BFI_OFFSET_REV_0x08(x0, x1, x2, x3, x4, x5, x6) x6, x5, x4, x3, x2, x1, x0
+
+/*** Chunked octet lists
+ *
+ * With BFI_CHUNKED_TAPE, an octet-list node can hold up to 4 cells:
+ *
+ * octet-list
+ *  ::= ...
+ *    | '7b' '(' octet ',' octet ',' octet-list ')'
+ *    | '7t' '(' octet ',' octet ',' octet ',' octet-list ')'
+ *    | '7q' '(' octet ',' octet ',' octet ',' octet ',' octet-list ')'
+ *
+ * 7b(a, b, t) is the same list as 7c(a,7c(b,t)), and so on. BFI_CONS fills
+ * the first node up to 4 cells before it starts a new one, and BFI_TAIL
+ * takes a cell off the first node, so the head moves one cell at a time
+ * without rebuilding the rest of the list. The nodes that BFI_MOVE_FORWARD
+ * builds are not merged with the ones they are put in front of.
+ */
+# if BFI_CHUNKED_TAPE
+# define BFI_HEAD_7b(a, b, t) a
+# define BFI_HEAD_7t(a, b, c, t) a
+# define BFI_HEAD_7q(a, b, c, d, t) a
+
+# define BFI_TAIL_7b(a, b, t) 7c(b,t)
+# define BFI_TAIL_7t(a, b, c, t) 7b(b,c,t)
+# define BFI_TAIL_7q(a, b, c, d, t) 7t(b,c,d,t)
+
+# undef BFI_CONS_7c
+# undef BFI_CONS_7c_I
+# define BFI_CONS_7c(a, t) BFI_CONS_7c_I(a, t,
+# define BFI_CONS_7c_I(a, t, x) 7b(x,a,t)
+# define BFI_CONS_7b(a, b, t) BFI_CONS_7b_I(a, b, t,
+# define BFI_CONS_7b_I(a, b, t, x) 7t(x,a,b,t)
+# define BFI_CONS_7t(a, b, c, t) BFI_CONS_7t_I(a, b, c, t,
+# define BFI_CONS_7t_I(a, b, c, t, x) 7q(x,a,b,c,t)
+# define BFI_CONS_7q(a, b, c, d, t) BFI_CONS_7q_I(7q(a,b,c,d,t),
+# define BFI_CONS_7q_I(t, x) 7c(x,t)
+
+# define BFI_UNCONS_0x017b(a, b, t) , a, 7c(b,t)
+# define BFI_UNCONS_0x017t(a, b, c, t) , a, 7b(b,c,t)
+# define BFI_UNCONS_0x017q(a, b, c, d, t) , a, 7t(b,c,d,t)
+
+# define BFI_UNCONS_0x027b(a, b, t) a), b, t
+# define BFI_UNCONS_0x027t(a, b, c, t) a), b, 7c(c,t)
+# define BFI_UNCONS_0x027q(a, b, c, d, t) a), b, 7b(c,d,t)
+
+# define BFI_UNCONS_0x037b(a, b, t) a,b)BFI_UNCONS_0x01##t
+# define BFI_UNCONS_0x037t(a, b, c, t) a,b), c, t
+# define BFI_UNCONS_0x037q(a, b, c, d, t) a,b), c, 7c(d,t)
+
+# define BFI_UNCONS_0x047b(a, b, t) a,b,BFI_UNCONS_0x02##t
+# define BFI_UNCONS_0x047t(a, b, c, t) a,b,c)BFI_UNCONS_0x01##t
+# define BFI_UNCONS_0x047q(a, b, c, d, t) a,b,c), d, t
+
+# undef BFI_CONS_MANY_0x027c
+# undef BFI_CONS_MANY_0x037c
+# undef BFI_CONS_MANY_0x047c
+# undef BFI_CONS_MANY_0x027z
+# undef BFI_CONS_MANY_0x037z
+# undef BFI_CONS_MANY_0x047z
+
+# define BFI_CONS_MANY_0x017b(t, x0) 7c(x0,t)
+# define BFI_CONS_MANY_0x017t(t, x0) 7c(x0,t)
+# define BFI_CONS_MANY_0x017q(t, x0) 7c(x0,t)
+
+# define BFI_CONS_MANY_0x027c(t, x0, x1) 7b(x1,x0,t)
+# define BFI_CONS_MANY_0x027b(t, x0, x1) 7b(x1,x0,t)
+# define BFI_CONS_MANY_0x027t(t, x0, x1) 7b(x1,x0,t)
+# define BFI_CONS_MANY_0x027q(t, x0, x1) 7b(x1,x0,t)
+
+# define BFI_CONS_MANY_0x037c(t, x0, x1, x2) 7t(x2,x1,x0,t)
+# define BFI_CONS_MANY_0x037b(t, x0, x1, x2) 7t(x2,x1,x0,t)
+# define BFI_CONS_MANY_0x037t(t, x0, x1, x2) 7t(x2,x1,x0,t)
+# define BFI_CONS_MANY_0x037q(t, x0, x1, x2) 7t(x2,x1,x0,t)
+
+# define BFI_CONS_MANY_0x047c(t, x0, x1, x2, x3) 7q(x3,x2,x1,x0,t)
+# define BFI_CONS_MANY_0x047b(t, x0, x1, x2, x3) 7q(x3,x2,x1,x0,t)
+# define BFI_CONS_MANY_0x047t(t, x0, x1, x2, x3) 7q(x3,x2,x1,x0,t)
+# define BFI_CONS_MANY_0x047q(t, x0, x1, x2, x3) 7q(x3,x2,x1,x0,t)
 
 # define BFI_CONS_MANY_0x017z(_, x0) BFI_IFN(BFI_TEST_ZERO_##x0)(7z, 7c(x0,7z))
-# define BFI_CONS_MANY_0x027z(_, x0, x1) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x017z(~, x1), 7c(x1,7c(x0,7z)))
-# define BFI_CONS_MANY_0x037z(_, x0, x1, x2) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x027z(~, x1, x2), 7c(x2,7c(x1,7c(x0,7z))))
-# define BFI_CONS_MANY_0x047z(_, x0, x1, x2, x3) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x037z(~, x1, x2, x3), 7c(x3,7c(x2,7c(x1,7c(x0,7z)))))
+# define BFI_CONS_MANY_0x027z(_, x0, x1) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x017z(~, x1), 7b(x1,x0,7z))
+# define BFI_CONS_MANY_0x037z(_, x0, x1, x2) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x027z(~, x1, x2), 7t(x2,x1,x0,7z))
+# define BFI_CONS_MANY_0x047z(_, x0, x1, x2, x3) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x037z(~, x1, x2, x3), 7q(x3,x2,x1,x0,7z))
 
-# define BFI_TAG_7c(h, t) 7c
-# define BFI_TAG_7z 7z
+# define BFI_TAG_7b(a, b, t) 7b
+# define BFI_TAG_7t(a, b, c, t) 7t
+# define BFI_TAG_7q(a, b, c, d, t) 7q
+# endif
+
+/*** Zero runs
+ *
+ * With BFI_ZERO_RUNS, an octet-list can also be a run of zeros:
+ *
+ * octet-list
+ *  ::= ...
+ *    | '7r' '(' octet ',' octet-list ')'
+ *
+ * 7r(n, t) represents 'n' zeros followed by 't', where 'n' is at least 0x02.
+ * BFI_CONS merges a 0x00 into a 7c(0x00, t) or a 7r below it, and a move of
+ * BFI_MOVE_FORWARD that pushes only zeros onto a list adds them to a run at
+ * once. Taking cells off a run splits it one cell at a time, so runs are
+ * only broken up where the head goes. A program that spreads its data out,
+ * such as one that keeps a record in every 8 cells, then has one 7r in
+ * place of several 7c(0x00, ...) between the records.
+ *
+ * A run holds at most 0xff zeros. When it would grow past that, it is
+ * split: the first 0xff zeros stay in it, and the ones left over go in a
+ * run or a 7c(0x00, ...) in front of it, so that a long stretch of zeros is
+ * a chain of full runs.
+ */
+# if BFI_ZERO_RUNS
+# define BFI_HEAD_7r(n, t) 0x00
+# define BFI_TAIL_7r(n, t) BFI_IFN(BFI_ZRUN_TWO_##n)(7c(0x00,t), 7r(BFI_ADD_0xff_##n,t))
+# define BFI_ZRUN_TWO_0x02 ()
+
+# undef BFI_CONS_7c
+# undef BFI_CONS_7c_I
+# define BFI_CONS_7c(h, t) BFI_CONS_7c_I(h, t,
+# define BFI_CONS_7c_I(h, t, x) BFI_IFN(BFI_ZRUN_PAIR_##h##x)(7r(0x02,t), 7c(x,7c(h,t)))
+# define BFI_ZRUN_PAIR_0x000x00 ()
+# define BFI_CONS_7r(n, t) BFI_CONS_7r_I(n, t,
+# define BFI_CONS_7r_I(n, t, x) BFI_IFN(BFI_TEST_ZERO_##x)(BFI_ZRUN_GROW(0x01, n, t), 7c(x,7r(n,t)))
+
+# define BFI_UNCONS_0x017r(n, t) , 0x00, BFI_TAIL_7r(n, t)
+# define BFI_UNCONS_0x027r(n, t) BFI_IFN(BFI_ZRUN_SHORT_0x02_##n)(BFI_ZRUN_UNCONS_SLOW_0x02, BFI_ZRUN_UNCONS_FAST_0x02)(n, t)
+# define BFI_UNCONS_0x037r(n, t) BFI_IFN(BFI_ZRUN_SHORT_0x03_##n)(BFI_ZRUN_UNCONS_SLOW_0x03, BFI_ZRUN_UNCONS_FAST_0x03)(n, t)
+# define BFI_UNCONS_0x047r(n, t) BFI_IFN(BFI_ZRUN_SHORT_0x04_##n)(BFI_ZRUN_UNCONS_SLOW_0x04, BFI_ZRUN_UNCONS_FAST_0x04)(n, t)
+# define BFI_ZRUN_UNCONS_FAST_0x02(n, t) 0x00), 0x00, 7r(BFI_ADD_0xfe(n),t)
+# define BFI_ZRUN_UNCONS_FAST_0x03(n, t) 0x00,0x00), 0x00, 7r(BFI_ADD_0xfd(n),t)
+# define BFI_ZRUN_UNCONS_FAST_0x04(n, t) 0x00,0x00,0x00), 0x00, 7r(BFI_ADD_0xfc(n),t)
+# define BFI_ZRUN_UNCONS_SLOW_0x02(n, t) 0x00)BFI_ZRUN_UNCONS_0x01(BFI_TAIL_7r(n, t))
+# define BFI_ZRUN_UNCONS_SLOW_0x03(n, t) 0x00,BFI_ZRUN_UNCONS_0x02(BFI_TAIL_7r(n, t))
+# define BFI_ZRUN_UNCONS_SLOW_0x04(n, t) 0x00,BFI_ZRUN_UNCONS_0x03(BFI_TAIL_7r(n, t))
+# define BFI_ZRUN_UNCONS_0x01(xs) BFI_ZRUN_UNCONS_0x01_I(xs)
+# define BFI_ZRUN_UNCONS_0x01_I(xs) BFI_UNCONS_0x01##xs
+# define BFI_ZRUN_UNCONS_0x02(xs) BFI_ZRUN_UNCONS_0x02_I(xs)
+# define BFI_ZRUN_UNCONS_0x02_I(xs) BFI_UNCONS_0x02##xs
+# define BFI_ZRUN_UNCONS_0x03(xs) BFI_ZRUN_UNCONS_0x03_I(xs)
+# define BFI_ZRUN_UNCONS_0x03_I(xs) BFI_UNCONS_0x03##xs
+# define BFI_ZRUN_SHORT_0x02_0x02 ()
+# define BFI_ZRUN_SHORT_0x02_0x03 ()
+# define BFI_ZRUN_SHORT_0x03_0x02 ()
+# define BFI_ZRUN_SHORT_0x03_0x03 ()
+# define BFI_ZRUN_SHORT_0x03_0x04 ()
+# define BFI_ZRUN_SHORT_0x04_0x02 ()
+# define BFI_ZRUN_SHORT_0x04_0x03 ()
+# define BFI_ZRUN_SHORT_0x04_0x04 ()
+# define BFI_ZRUN_SHORT_0x04_0x05 ()
+
+# undef BFI_CONS_MANY_0x017c
+# undef BFI_CONS_MANY_0x027c
+# undef BFI_CONS_MANY_0x037c
+# undef BFI_CONS_MANY_0x047c
+# define BFI_CONS_MANY_0x017c(t, x0) BFI_CONS(x0, t)
+# define BFI_CONS_MANY_0x027c(t, x0, x1) BFI_IFN(BFI_ZRUN_PAIR_##x0##x1)(BFI_ZRUN_ADD(0x02, t), BFI_ZRUN_CONS(x1, BFI_CONS(x0, t)))
+# define BFI_CONS_MANY_0x037c(t, x0, x1, x2) BFI_IFN(BFI_ZRUN_PAIR_##x1##x2)(BFI_ZRUN_MANY(0x03, x0, t), 7c(x2,7c(x1,BFI_CONS(x0, t))))
+# define BFI_CONS_MANY_0x047c(t, x0, x1, x2, x3) BFI_IFN(BFI_ZRUN_TRIPLE_##x1##x2##x3)(BFI_ZRUN_MANY(0x04, x0, t), 7c(x3,7c(x2,7c(x1,BFI_CONS(x0, t)))))
+# define BFI_CONS_MANY_0x017r BFI_CONS_MANY_0x017c
+# define BFI_CONS_MANY_0x027r BFI_CONS_MANY_0x027c
+# define BFI_CONS_MANY_0x037r BFI_CONS_MANY_0x037c
+# define BFI_CONS_MANY_0x047r BFI_CONS_MANY_0x047c
+# define BFI_ZRUN_TRIPLE_0x000x000x00 ()
+
+# define BFI_TAG_7r(n, t) 7r
+
+/* BFI_ZRUN_ADD(k, l)
+ *    k : octet, 2 <= k <= 4
+ *    l : octet-list
+ *  Put 'k' zeros in front of 'l', in a run.
+ *
+ * BFI_ZRUN_MANY(k, x, l)
+ *  Put 'x' and then 'k' - 1 zeros in front of 'l'.
+ *
+ * BFI_ZRUN_GROW(k, n, t)
+ *    k : octet, 1 <= k <= 4
+ *  Expand to 7r(n + k, t). If n + k is more than 0xff, the run is split
+ *  into 7r(0xff, t) and the zeros left over in front of it. Whether it is
+ *  is told from 'k' and 'n', as the sum wraps around to octets that a run
+ *  of 0x02 zeros can also grow to.
+ */
+# define BFI_ZRUN_ADD(k, xs) BFI_ZRUN_ADD_I(k, xs)
+# define BFI_ZRUN_ADD_I(k, xs) BFI_ZRUN_ADD_##xs k)
+# define BFI_ZRUN_ADD_7c(h, t) BFI_ZRUN_ADD_7c_I(h, t,
+# define BFI_ZRUN_ADD_7c_I(h, t, k) BFI_IFN(BFI_TEST_ZERO_##h)(BFI_ZRUN_GROW(k, 0x01, t), 7r(k,7c(h,t)))
+# define BFI_ZRUN_ADD_7r(n, t) BFI_ZRUN_ADD_7r_I(n, t,
+# define BFI_ZRUN_ADD_7r_I(n, t, k) BFI_ZRUN_GROW(k, n, t)
+# define BFI_ZRUN_ADD_7z BFI_ZRUN_ADD_7z_I(
+# define BFI_ZRUN_ADD_7z_I(k) 7z
+
+# define BFI_ZRUN_MANY(k, x, xs) BFI_IFN(BFI_TEST_ZERO_##x)(BFI_ZRUN_ADD(k, xs), BFI_ZRUN_ADD(BFI_ADD_0xff_##k, BFI_CONS(x, xs)))
+# define BFI_ZRUN_CONS(x, xs) BFI_ZRUN_CONS_I(x, xs)
+# define BFI_ZRUN_CONS_I(x, xs) BFI_CONS_##xs x)
+
+# define BFI_ZRUN_GROW(k, n, t) BFI_ZRUN_GROW_I(k, n, t)
+# define BFI_ZRUN_GROW_I(k, n, t) BFI_IFN(BFI_ZRUN_FULL_##k##_##n)(BFI_ZRUN_SPLIT, BFI_ZRUN_KEEP)(BFI_ADD(k, n), t)
+# define BFI_ZRUN_KEEP(s, t) 7r(s,t)
+# define BFI_ZRUN_SPLIT(s, t) BFI_ZRUN_SPLIT_I(s, t)
+# define BFI_ZRUN_SPLIT_I(s, t) BFI_ZRUN_EXCESS_##s(7r(0xff,t))
+# define BFI_ZRUN_FULL_0x01_0xff ()
+# define BFI_ZRUN_FULL_0x02_0xfe ()
+# define BFI_ZRUN_FULL_0x02_0xff ()
+# define BFI_ZRUN_FULL_0x03_0xfd ()
+# define BFI_ZRUN_FULL_0x03_0xfe ()
+# define BFI_ZRUN_FULL_0x03_0xff ()
+# define BFI_ZRUN_FULL_0x04_0xfc ()
+# define BFI_ZRUN_FULL_0x04_0xfd ()
+# define BFI_ZRUN_FULL_0x04_0xfe ()
+# define BFI_ZRUN_FULL_0x04_0xff ()
+# define BFI_ZRUN_EXCESS_0x00(t) 7c(0x00,t)
+# define BFI_ZRUN_EXCESS_0x01(t) 7r(0x02,t)
+# define BFI_ZRUN_EXCESS_0x02(t) 7r(0x03,t)
+# define BFI_ZRUN_EXCESS_0x03(t) 7r(0x04,t)
+# endif
+
+/*** Register window
+ *
+ * With BFI_REGISTER_WINDOW, the 'c' of the bf-cm state is not an octet but
+ * a window of the 5 cells around the head:
+ *
+ * window
+ *  ::= '7w' k '(' octet ',' octet ',' octet ',' octet ',' octet ')'
+ *
+ * where 'k', one of 0 to 4, tells which of them is the head. The tape is
+ * 'l' (reversed), the cells of the window, then 'r'. A move that stays in
+ * the window only renames the node, and leaves 'l' and 'r' untouched, so
+ * the loops that walk back and forth over a few cells, such as copy and
+ * move loops, no longer rebuild the head of the lists at every move. A move
+ * past an end of the window shifts it by one cell, which costs what a move
+ * costs without the window.
+ *
+ * BFI_EXEC starts with the head at the leftmost cell of the window.
+ */
+# if BFI_REGISTER_WINDOW
+# undef BFI_INITIAL_STATE
+# define BFI_INITIAL_STATE(input) (7z, 7w0(0x00, 0x00, 0x00, 0x00, 0x00), 7z, input)
+
+# undef BFI_BF_NEXT
+# define BFI_BF_NEXT(l, c, r) BFI_WIN_NEXT(l, c, r)
+# undef BFI_BF_PREV
+# define BFI_BF_PREV(l, c, r) BFI_WIN_PREV(l, c, r)
+# undef BFI_BF_READ_I
+# define BFI_BF_READ_I(hd, i, l, c, r) BFI_IFN(BFI_PCAT(BFI_TEST_EOF_, hd))(BFI_REM_4(l, c, r, i), BFI_REM_4(l, BFI_WIN_SET(hd, c), r, BFI_EAT i))
+# undef BFI_TRACE_PEEK
+# define BFI_TRACE_PEEK(f, l, c, r, i, k, t, x, u) (0trace((k, x), BFI_WIN_CELL(c)))BFI_FINST_##t(f, l, c, r, i, x, u)
+# undef BFI_FINST_6next1
+# define BFI_FINST_6next1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_WIN_NEXT_AM(c)(f, t) l, BFI_WIN_RIGHT(c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6prev1
+# define BFI_FINST_6prev1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_WIN_PREV_AM(c)(f, t) l, BFI_WIN_LEFT(c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6nextA
+# define BFI_FINST_6nextA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_WIN_NEXT_N(d, l, c, r)), i, BFI_EMPTY(
+# undef BFI_FINST_6nextB
+# define BFI_FINST_6nextB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_WIN_NEXT_N(d, l, c, r)), i, BFI_EMPTY(
+# undef BFI_FINST_6prevA
+# define BFI_FINST_6prevA(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_WIN_PREV_N(d, l, c, r)), i, BFI_EMPTY(
+# undef BFI_FINST_6prevB
+# define BFI_FINST_6prevB(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_CALL_BEGIN_2(BFI_FINST_##t, f, BFI_WIN_PREV_N(d, l, c, r)), i, BFI_EMPTY(
+# undef BFI_FINST_6inc
+# define BFI_FINST_6inc(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_WIN_MAP(BFI_PCAT, BFI_ADD_0x01_, c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6dec
+# define BFI_FINST_6dec(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_WIN_MAP(BFI_PCAT, BFI_ADD_0xff_, c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6add
+# define BFI_FINST_6add(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_WIN_MAP(BFI_ADD, d, c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6sadd
+# define BFI_FINST_6sadd(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_WIN_MAP(BFI_ADD, BFI_MUL(d, BFI_EAT i), c), r, i, BFI_EMPTY(
+# undef BFI_FINST_6senter
+# define BFI_FINST_6senter(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, BFI_WIN_SET(0x00, c), r, (i)BFI_WIN_CELL(c), BFI_EMPTY(
+# undef BFI_FINST_6write
+# define BFI_FINST_6write(f, l, c, r, i, d, t) (BFI_WIN_CELL(c))f(l BFI_COMMA() c BFI_COMMA() r BFI_COMMA() i, t, BFI_RETURN
+# undef BFI_FINST_6writeA
+# define BFI_FINST_6writeA(f, l, c, r, i, d, t) (BFI_WIN_CELL(c))BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# undef BFI_FINST_6writeB
+# define BFI_FINST_6writeB(f, l, c, r, i, d, t) (BFI_WIN_CELL(c))BFI_FAST_TICK(f, t) BFI_FINST_##t(f, l, c, r, i, BFI_EMPTY(
+# undef BFI_FINST_6loop
+# define BFI_FINST_6loop(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF, BFI_LOOP_CONTF)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
+# undef BFI_FINST_6loopA
+# define BFI_FINST_6loopA(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF_A, BFI_LOOP_CONTF_A)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
+# undef BFI_FINST_6if
+# define BFI_FINST_6if(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF_A, BFI_LOOP_ONCEF)(f, l, c, r, i, d, t, BFI_FJUMP_TO d)
+# undef BFI_FINST_6tloop
+# define BFI_FINST_6tloop(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF, BFI_LOOP_CONTF)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+# undef BFI_FINST_6tloopA
+# define BFI_FINST_6tloopA(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF_A, BFI_LOOP_CONTF_A)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+# undef BFI_FINST_6tif
+# define BFI_FINST_6tif(f, l, c, r, i, d, t) BFI_IFN(BFI_WIN_TEST_ZERO(c))(BFI_LOOP_ENDF_A, BFI_LOOP_ONCEF)(f, l, c, r, i, d, t, BFI_TRACE_JUMP d)
+
+/* BFI_WIN_CELL(w)
+ *    w : window
+ *  Expand to the head cell of 'w'.
+ */
+# define BFI_WIN_CELL(w) BFI_WIN_CELL_##w
+# define BFI_WIN_CELL_7w0(a, b, c, d, e) a
+# define BFI_WIN_CELL_7w1(a, b, c, d, e) b
+# define BFI_WIN_CELL_7w2(a, b, c, d, e) c
+# define BFI_WIN_CELL_7w3(a, b, c, d, e) d
+# define BFI_WIN_CELL_7w4(a, b, c, d, e) e
+
+/* BFI_WIN_TEST_ZERO(w)
+ *    w : window
+ *  Expand to BFI_TEST_ZERO_##c, where 'c' is the head cell of 'w'.
+ */
+# define BFI_WIN_TEST_ZERO(w) BFI_WIN_TEST_ZERO_##w
+# define BFI_WIN_TEST_ZERO_7w0(a, b, c, d, e) BFI_TEST_ZERO_##a
+# define BFI_WIN_TEST_ZERO_7w1(a, b, c, d, e) BFI_TEST_ZERO_##b
+# define BFI_WIN_TEST_ZERO_7w2(a, b, c, d, e) BFI_TEST_ZERO_##c
+# define BFI_WIN_TEST_ZERO_7w3(a, b, c, d, e) BFI_TEST_ZERO_##d
+# define BFI_WIN_TEST_ZERO_7w4(a, b, c, d, e) BFI_TEST_ZERO_##e
+
+/* BFI_WIN_MAP(m, x, w)
+ *    m : macro
+ *    w : window
+ *  Replace the head cell 'c' of 'w' with m(x, c).
+ *
+ * BFI_WIN_SET(x, w)
+ *  Replace the head cell of 'w' with 'x'.
+ */
+# define BFI_WIN_MAP(m, x, w) BFI_WIN_MAP_##w m, x)
+# define BFI_WIN_SET(x, w) BFI_WIN_MAP_##w BFI_WIN_PUT, x)
+# define BFI_WIN_PUT(x, c) x
+# define BFI_WIN_MAP_7w0(a, b, c, d, e) BFI_WIN_MAP_0(a, b, c, d, e,
+# define BFI_WIN_MAP_7w1(a, b, c, d, e) BFI_WIN_MAP_1(a, b, c, d, e,
+# define BFI_WIN_MAP_7w2(a, b, c, d, e) BFI_WIN_MAP_2(a, b, c, d, e,
+# define BFI_WIN_MAP_7w3(a, b, c, d, e) BFI_WIN_MAP_3(a, b, c, d, e,
+# define BFI_WIN_MAP_7w4(a, b, c, d, e) BFI_WIN_MAP_4(a, b, c, d, e,
+# define BFI_WIN_MAP_0(a, b, c, d, e, m, x) 7w0(m(x, a), b, c, d, e)
+# define BFI_WIN_MAP_1(a, b, c, d, e, m, x) 7w1(a, m(x, b), c, d, e)
+# define BFI_WIN_MAP_2(a, b, c, d, e, m, x) 7w2(a, b, m(x, c), d, e)
+# define BFI_WIN_MAP_3(a, b, c, d, e, m, x) 7w3(a, b, c, m(x, d), e)
+# define BFI_WIN_MAP_4(a, b, c, d, e, m, x) 7w4(a, b, c, d, m(x, e))
+
+/* BFI_WIN_NEXT(l, w, r)
+ * BFI_WIN_PREV(l, w, r)
+ *    l, r : octet-list
+ *    w : window
+ *  Move the head by one cell, and expand to the new 'l, w, r'.
+ *
+ * BFI_WIN_NEXT_N(n, l, w, r)
+ * BFI_WIN_PREV_N(n, l, w, r)
+ *    n : one of 0x02 to 0x04
+ *  Move the head by 'n' cells, one at a time.
+ */
+# define BFI_WIN_NEXT(l, w, r) BFI_WIN_NEXT_##w, l, r)
+# define BFI_WIN_PREV(l, w, r) BFI_WIN_PREV_##w, l, r)
+# define BFI_WIN_NEXT_N(n, l, w, r) BFI_WIN_NEXT_##n(l, w, r)
+# define BFI_WIN_PREV_N(n, l, w, r) BFI_WIN_PREV_##n(l, w, r)
+# define BFI_WIN_NEXT_7w0(a, b, c, d, e) BFI_WIN_STAY(7w1(a, b, c, d, e)
+# define BFI_WIN_NEXT_7w1(a, b, c, d, e) BFI_WIN_STAY(7w2(a, b, c, d, e)
+# define BFI_WIN_NEXT_7w2(a, b, c, d, e) BFI_WIN_STAY(7w3(a, b, c, d, e)
+# define BFI_WIN_NEXT_7w3(a, b, c, d, e) BFI_WIN_STAY(7w4(a, b, c, d, e)
+# define BFI_WIN_NEXT_7w4(a, b, c, d, e) BFI_WIN_SHIFT_R(a, b, c, d, e
+# define BFI_WIN_PREV_7w0(a, b, c, d, e) BFI_WIN_SHIFT_L(a, b, c, d, e
+# define BFI_WIN_PREV_7w1(a, b, c, d, e) BFI_WIN_STAY(7w0(a, b, c, d, e)
+# define BFI_WIN_PREV_7w2(a, b, c, d, e) BFI_WIN_STAY(7w1(a, b, c, d, e)
+# define BFI_WIN_PREV_7w3(a, b, c, d, e) BFI_WIN_STAY(7w2(a, b, c, d, e)
+# define BFI_WIN_PREV_7w4(a, b, c, d, e) BFI_WIN_STAY(7w3(a, b, c, d, e)
+# define BFI_WIN_STAY(w, l, r) l, w, r
+# define BFI_WIN_SHIFT_R(a, b, c, d, e, l, r) BFI_CONS_##l a), 7w4(b, c, d, e, BFI_HEAD_##r), BFI_TAIL_##r
+# define BFI_WIN_SHIFT_L(a, b, c, d, e, l, r) BFI_TAIL_##l, 7w0(BFI_HEAD_##l, a, b, c, d), BFI_CONS_##r e)
+
+# define BFI_WIN_NEXT_0x02(l, w, r) BFI_WIN_AGAIN(BFI_WIN_NEXT, BFI_WIN_NEXT(l, w, r))
+# define BFI_WIN_NEXT_0x03(l, w, r) BFI_WIN_AGAIN(BFI_WIN_NEXT, BFI_WIN_NEXT_0x02(l, w, r))
+# define BFI_WIN_NEXT_0x04(l, w, r) BFI_WIN_AGAIN(BFI_WIN_NEXT, BFI_WIN_NEXT_0x03(l, w, r))
+# define BFI_WIN_PREV_0x02(l, w, r) BFI_WIN_AGAIN(BFI_WIN_PREV, BFI_WIN_PREV(l, w, r))
+# define BFI_WIN_PREV_0x03(l, w, r) BFI_WIN_AGAIN(BFI_WIN_PREV, BFI_WIN_PREV_0x02(l, w, r))
+# define BFI_WIN_PREV_0x04(l, w, r) BFI_WIN_AGAIN(BFI_WIN_PREV, BFI_WIN_PREV_0x03(l, w, r))
+# define BFI_WIN_AGAIN(m, x) m(x)
+
+/* BFI_WIN_NEXT_AM(w)(f, t)
+ * BFI_WIN_PREV_AM(w)(f, t)
+ *    w : window
+ *  Begin the call to the accompanying macro of the instruction 't' for a
+ *  move by one cell. As long as the head stays in 'w', it is BFI_FINST_##t,
+ *  with BFI_WIN_RIGHT(w) (or BFI_WIN_LEFT(w)) as the new window, and 'l'
+ *  and 'r' are passed on as they are. At an end of 'w', it is
+ *  BFI_WIN_SHIFT_AM_R (or BFI_WIN_SHIFT_AM_L), which takes the arguments
+ *  meant for BFI_FINST_##t, shifts the window by one cell, and calls it.
+ */
+# define BFI_WIN_NEXT_AM(w) BFI_WIN_NEXT_AM_##w
+# define BFI_WIN_PREV_AM(w) BFI_WIN_PREV_AM_##w
+# define BFI_WIN_RIGHT(w) BFI_WIN_RIGHT_##w
+# define BFI_WIN_LEFT(w) BFI_WIN_LEFT_##w
+# define BFI_WIN_NEXT_AM_7w0(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_NEXT_AM_7w1(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_NEXT_AM_7w2(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_NEXT_AM_7w3(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_NEXT_AM_7w4(a, b, c, d, e) BFI_WIN_SHIFT_AM_R
+# define BFI_WIN_PREV_AM_7w0(a, b, c, d, e) BFI_WIN_SHIFT_AM_L
+# define BFI_WIN_PREV_AM_7w1(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_PREV_AM_7w2(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_PREV_AM_7w3(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_PREV_AM_7w4(a, b, c, d, e) BFI_WIN_KEEP_AM
+# define BFI_WIN_KEEP_AM(f, t) BFI_FINST_##t(f,
+# define BFI_WIN_SHIFT_AM_R(f, t) BFI_WIN_SHIFT_AM_R_I(f, t,
+# define BFI_WIN_SHIFT_AM_L(f, t) BFI_WIN_SHIFT_AM_L_I(f, t,
+# define BFI_WIN_SHIFT_AM_R_I(f, k, l, w, r, i, d, t) BFI_FINST_##k(f, BFI_WIN_PUSH_L(w, l), BFI_WIN_PULL_R(w, BFI_HEAD_##r), BFI_TAIL_##r, i, d, t)
+# define BFI_WIN_SHIFT_AM_L_I(f, k, l, w, r, i, d, t) BFI_FINST_##k(f, BFI_TAIL_##l, BFI_WIN_PULL_L(w, BFI_HEAD_##l), BFI_WIN_PUSH_R(w, r), i, d, t)
+# define BFI_WIN_PUSH_L(w, l) BFI_WIN_PUSH_L_##w, l)
+# define BFI_WIN_PUSH_L_7w4(a, b, c, d, e) BFI_CONS(a
+# define BFI_WIN_PUSH_R(w, r) BFI_WIN_PUSH_R_##w, r)
+# define BFI_WIN_PUSH_R_7w0(a, b, c, d, e) BFI_CONS(e
+# define BFI_WIN_PULL_R(w, x) BFI_WIN_PULL_R_##w, x)
+# define BFI_WIN_PULL_R_7w4(a, b, c, d, e) BFI_WIN_PULL_R_I(b, c, d, e
+# define BFI_WIN_PULL_R_I(b, c, d, e, x) 7w4(b, c, d, e, x)
+# define BFI_WIN_PULL_L(w, x) BFI_WIN_PULL_L_##w, x)
+# define BFI_WIN_PULL_L_7w0(a, b, c, d, e) BFI_WIN_PULL_L_I(a, b, c, d
+# define BFI_WIN_PULL_L_I(a, b, c, d, x) 7w0(x, a, b, c, d)
+
+# define BFI_WIN_RIGHT_7w0(a, b, c, d, e) 7w1(a, b, c, d, e)
+# define BFI_WIN_RIGHT_7w1(a, b, c, d, e) 7w2(a, b, c, d, e)
+# define BFI_WIN_RIGHT_7w2(a, b, c, d, e) 7w3(a, b, c, d, e)
+# define BFI_WIN_RIGHT_7w3(a, b, c, d, e) 7w4(a, b, c, d, e)
+# define BFI_WIN_RIGHT_7w4(a, b, c, d, e) 7w4(a, b, c, d, e)
+# define BFI_WIN_LEFT_7w0(a, b, c, d, e) 7w0(a, b, c, d, e)
+# define BFI_WIN_LEFT_7w1(a, b, c, d, e) 7w0(a, b, c, d, e)
+# define BFI_WIN_LEFT_7w2(a, b, c, d, e) 7w1(a, b, c, d, e)
+# define BFI_WIN_LEFT_7w3(a, b, c, d, e) 7w2(a, b, c, d, e)
+# define BFI_WIN_LEFT_7w4(a, b, c, d, e) 7w3(a, b, c, d, e)
+# endif
+
+/*** Tree tape
+ *
+ * With BFI_TREE_TAPE, the 'l', 'c' and 'r' of the bf-cm state are a tree,
+ * the current cell and the head:
+ *
+ * tree
+ *  ::= '7n' '(' child ',' ... ',' child ')'      (16 children)
+ *    | '7z'
+ * head
+ *  ::= '(' digit ',' digit ',' digit ',' digit ',' tree ')'
+ * offset
+ *  ::= '(' digit ',' digit ',' digit ',' digit ')'
+ *
+ * A digit is one of the octets 0x00 to 0x0f. The first 4 items of the head
+ * and an offset are numbers below 65536, the most significant digit first.
+ * The children of the root are indexed by the first digit of a position,
+ * theirs by the second, and theirs by the third. Those are the leaves,
+ * whose children are the 16 cells indexed by the last digit. 7z is a tree
+ * of zeros. The tape is 65536 cells long and wraps around, so moving to
+ * the left of the first cell reaches the last.
+ *
+ * The head holds the position of the current cell, and the leaf it is in,
+ * which is not kept up to date in the tree. Neither is the current cell in
+ * the leaf: it is kept in 'c' and only stored when the head moves away. A
+ * move that stays in the leaf only touches the head. A move to another
+ * leaf stores the leaf in the tree and takes the new one out of it,
+ * rebuilding and walking one node of each level, so it costs the same for
+ * any distance. The accompanying macro of a move is chosen from the head,
+ * so that a move in the leaf does not pass the tree through any macro.
+ *
+ * This is what 6seek is for: BFI_PEEPHOLE turns a run of 6next and 6prev
+ * into one 6seek whose operand is the offset the run adds to the
+ * position, leaving the runs of a single move as 6next1 or 6prev1.
+ * Straight-line code that walks one cell at a time gets slower, since a
+ * move costs more than it does on the zipper. 6nextA, 6nextB, 6prevA and
+ * 6prevB are still understood, so that BFI_EXEC runs any program in the
+ * nested form.
+ */
+# if BFI_TREE_TAPE
+# undef BFI_INITIAL_STATE
+# define BFI_INITIAL_STATE(input) (7z, 0x00, (0x00,0x00,0x00,0x00,7z), input)
+
+# undef BFI_BF_NEXT
+# define BFI_BF_NEXT(l, c, r) BFI_TREE_SEEK((0x00,0x00,0x00,0x01), l, c, r)
+# undef BFI_BF_PREV
+# define BFI_BF_PREV(l, c, r) BFI_TREE_SEEK((0x0f,0x0f,0x0f,0x0f), l, c, r)
+# undef BFI_FINST_6next1
+# define BFI_FINST_6next1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_TREE_NEXT_AM(r)(f, t, (0x00,0x00,0x00,0x01), c, r) l, BFI_TREE_NEXT_C(r), BFI_TREE_NEXT_R(c, r), i, BFI_EMPTY(
+# undef BFI_FINST_6prev1
+# define BFI_FINST_6prev1(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_TREE_PREV_AM(r)(f, t, (0x0f,0x0f,0x0f,0x0f), c, r) l, BFI_TREE_PREV_C(r), BFI_TREE_PREV_R(c, r), i, BFI_EMPTY(
+# undef BFI_FINST_6nextA
+# define BFI_FINST_6nextA(f, l, c, r, i, d, t) BFI_FINST_6seek(f, l, c, r, i, BFI_TREE_FORWARD(d), t)
+# undef BFI_FINST_6nextB
+# define BFI_FINST_6nextB(f, l, c, r, i, d, t) BFI_FINST_6seek(f, l, c, r, i, BFI_TREE_FORWARD(d), t)
+# undef BFI_FINST_6prevA
+# define BFI_FINST_6prevA(f, l, c, r, i, d, t) BFI_FINST_6seek(f, l, c, r, i, BFI_TREE_BACKWARD(d), t)
+# undef BFI_FINST_6prevB
+# define BFI_FINST_6prevB(f, l, c, r, i, d, t) BFI_FINST_6seek(f, l, c, r, i, BFI_TREE_BACKWARD(d), t)
+
+/* 6seek: bf-cm instruction
+ *  Move the head by the offset given as the operand.
+ */
+# define BFI_FINST_6seek(f, l, c, r, i, d, t) BFI_FAST_TICK(f, t) BFI_TREE_SEEK_AM(d, r)(f, t, d, c, r) l, BFI_TREE_SEEK_C(d, c, r), BFI_TREE_SEEK_R(d, c, r), i, BFI_EMPTY(
+
+/* The accompanying macro of a move: BFI_TREE_NEAR_AM if it stays in the
+ * leaf, BFI_TREE_FAR_AM otherwise. They are followed by
+ * (f, t, k, c, r) l, c', r', i, and then the d and t of the next frame,
+ * where 'k' is the offset of the move and c' and r' are the state after a
+ * move in the leaf, which BFI_TREE_FAR_AM drops without expanding.
+ */
+# define BFI_TREE_NEAR_AM(f, t, k, c, r) BFI_FINST_##t(f,
+# define BFI_TREE_FAR_AM(f, t, k, c, r) BFI_TREE_FAR_AM_I(f, t, k, c, r,
+# define BFI_TREE_FAR_AM_I(f, u, k, c, r, l, x, y, i, d, t) BFI_CALL_BEGIN_2(BFI_FINST_##u, f, BFI_TREE_SEEK_FAR(k, l, c, r)), i, d, t)
+
+# define BFI_TREE_NEXT_AM(r) BFI_TREE_NEXT_AM_I r
+# define BFI_TREE_NEXT_AM_I(a, b, c, d, l) BFI_IFN(BFI_TREE_LAST_##d)(BFI_TREE_FAR_AM, BFI_TREE_NEAR_AM)
+# define BFI_TREE_NEXT_C(r) BFI_TREE_NEXT_C_I r
+# define BFI_TREE_NEXT_C_I(a, b, c, d, l) BFI_TREE_CELL(BFI_ADD_0x01_##d, l)
+# define BFI_TREE_NEXT_R(x, r) BFI_TREE_NEXT_R_I(x, BFI_TREE_REM r)
+# define BFI_TREE_NEXT_R_I(x, r) BFI_TREE_NEXT_R_II(x, r)
+# define BFI_TREE_NEXT_R_II(x, a, b, c, d, l) (a, b, c, BFI_ADD_0x01_##d, BFI_TREE_PUT_CELL(d, l, x))
+
+# define BFI_TREE_PREV_AM(r) BFI_TREE_PREV_AM_I r
+# define BFI_TREE_PREV_AM_I(a, b, c, d, l) BFI_IFN(BFI_TEST_ZERO_##d)(BFI_TREE_FAR_AM, BFI_TREE_NEAR_AM)
+# define BFI_TREE_PREV_C(r) BFI_TREE_PREV_C_I r
+# define BFI_TREE_PREV_C_I(a, b, c, d, l) BFI_TREE_CELL(BFI_ADD_0xff_##d, l)
+# define BFI_TREE_PREV_R(x, r) BFI_TREE_PREV_R_I(x, BFI_TREE_REM r)
+# define BFI_TREE_PREV_R_I(x, r) BFI_TREE_PREV_R_II(x, r)
+# define BFI_TREE_PREV_R_II(x, a, b, c, d, l) (a, b, c, BFI_ADD_0xff_##d, BFI_TREE_PUT_CELL(d, l, x))
+
+# define BFI_TREE_LAST_0x0f ()
+# define BFI_TREE_REM(a, b, c, d, l) a, b, c, d, l
+
+/* The same for a move by any offset 'k'. The move stays in the leaf if
+ * the upper 3 digits of 'k' are all 0x00 and the last one does not carry,
+ * or all 0x0f and it does.
+ */
+# define BFI_TREE_SEEK_AM(k, r) BFI_TREE_SEEK_AM_I(BFI_REM_4 k, BFI_TREE_REM r)
+# define BFI_TREE_SEEK_AM_I(k, r) BFI_TREE_SEEK_AM_II(k, r)
+# define BFI_TREE_SEEK_AM_II(w, x, y, z, a, b, c, d, l) BFI_TREE_SEEK_AM_III(w, x, y, BFI_TREE_DIGIT(BFI_ADD(d, z)))
+# define BFI_TREE_SEEK_AM_III(w, x, y, q) BFI_TREE_SEEK_AM_IV(w, x, y, q)
+# define BFI_TREE_SEEK_AM_IV(w, x, y, q, e) BFI_IFN(BFI_TREE_NEAR_##w##x##y##q)(BFI_TREE_NEAR_AM, BFI_TREE_FAR_AM)
+# define BFI_TREE_SEEK_C(k, x, r) BFI_TREE_SEEK_C_I(BFI_REM_4 k, x, BFI_TREE_REM r)
+# define BFI_TREE_SEEK_C_I(k, x, r) BFI_TREE_SEEK_C_II(k, x, r)
+# define BFI_TREE_SEEK_C_II(w, x, y, z, v, a, b, c, d, l) BFI_TREE_CELL(BFI_TREE_LOW(d, z), BFI_TREE_PUT_CELL(d, l, v))
+# define BFI_TREE_SEEK_R(k, x, r) BFI_TREE_SEEK_R_I(BFI_REM_4 k, x, BFI_TREE_REM r)
+# define BFI_TREE_SEEK_R_I(k, x, r) BFI_TREE_SEEK_R_II(k, x, r)
+# define BFI_TREE_SEEK_R_II(w, x, y, z, v, a, b, c, d, l) (a, b, c, BFI_TREE_LOW(d, z), BFI_TREE_PUT_CELL(d, l, v))
+# define BFI_TREE_LOW(d, z) BFI_TREE_SND(BFI_TREE_DIGIT(BFI_ADD(d, z)))
+
+# define BFI_TREE_NEAR_0x000x000x000x00 ()
+# define BFI_TREE_NEAR_0x0f0x0f0x0f0x01 ()
+
+/* BFI_TREE_SEEK(k, l, c, r)
+ * BFI_TREE_SEEK_FAR(k, l, c, r)
+ *    k : offset
+ *    l : tree
+ *    c : octet
+ *    r : head
+ *  Move the head by 'k', and expand to the new l, c, r. BFI_TREE_SEEK_FAR
+ *  is for a move to another leaf.
+ */
+# define BFI_TREE_SEEK(k, l, c, r) BFI_TREE_SEEK_AM(k, r)(~, ~, k, c, r) BFI_TREE_SEEK_NEAR
+# define BFI_TREE_SEEK_NEAR(k, l, c, r) l, BFI_TREE_SEEK_C(k, c, r), BFI_TREE_SEEK_R(k, c, r)
+
+/* The peephole pass: a run of moves is added up into an offset. */
+# undef BFI_PEEPHOLE_MOVE
+# define BFI_PEEPHOLE_MOVE(i) BFI_TREE_PEEPHOLE(BFI_TREE_STEP_##i,
+# define BFI_TREE_PEEPHOLE(k, i, c) BFI_TREE_PEEPHOLE_##c(k, i
+# define BFI_TREE_PEEPHOLE_0(k, i) BFI_TREE_PEEPHOLE_EMIT(k)
+# define BFI_TREE_PEEPHOLE_1(k, i) BFI_SWITCH((BFI_TREE_PEEPHOLE_MOVE_##i, BFI_TREE_PEEPHOLE_STOP))(k, i)
+# define BFI_TREE_PEEPHOLE_ADD(k, i) BFI_TREE_PEEPHOLE(BFI_TREE_ADD(k, BFI_TREE_STEP_##i),
+# define BFI_TREE_PEEPHOLE_STOP(k, i) BFI_TREE_PEEPHOLE_EMIT(k)BFI_PEEPHOLE_PROCESS(i)
+# define BFI_TREE_PEEPHOLE_EMIT(k) BFI_TREE_PEEPHOLE_EMIT_I(BFI_REM_4 k, k)
+# define BFI_TREE_PEEPHOLE_EMIT_I(x, k) BFI_TREE_PEEPHOLE_EMIT_II(x, k)
+# define BFI_TREE_PEEPHOLE_EMIT_II(a, b, c, d, k) BFI_SWITCH((BFI_TREE_UNIT_##a##b##c##d, (6seek(k))))
+
+# define BFI_TREE_PEEPHOLE_MOVE_6next BFI_TEST_SUCCESS(BFI_TREE_PEEPHOLE_ADD)
+# define BFI_TREE_PEEPHOLE_MOVE_6prev BFI_TEST_SUCCESS(BFI_TREE_PEEPHOLE_ADD)
+# define BFI_TREE_STEP_6next (0x00,0x00,0x00,0x01)
+# define BFI_TREE_STEP_6prev (0x0f,0x0f,0x0f,0x0f)
+# define BFI_TREE_UNIT_0x000x000x000x00 BFI_TEST_SUCCESS((6id_4))
+# define BFI_TREE_UNIT_0x000x000x000x01 BFI_TEST_SUCCESS((6next1))
+# define BFI_TREE_UNIT_0x0f0x0f0x0f0x0f BFI_TEST_SUCCESS((6prev1))
+
+# define BFI_TREE_FORWARD(n) (0x00,0x00,0x00,n)
+# define BFI_TREE_BACKWARD(n) (0x0f,0x0f,0x0f,BFI_ADD(0x10, BFI_MUL(0xff, n)))
+
+# define BFI_TREE_SEEK_FAR(k, l, c, r) BFI_TREE_SEEK_FAR_I(l, BFI_TREE_ADD(BFI_TREE_POS r, k), c, BFI_TREE_REM r)
+# define BFI_TREE_SEEK_FAR_I(l, p, v, r) BFI_TREE_SEEK_FAR_II(l, p, v, r)
+# define BFI_TREE_SEEK_FAR_II(l, p, v, a, b, c, d, x) BFI_TREE_SEEK_FAR_III(BFI_TREE_STORE(l, a, b, c, BFI_TREE_PUT_CELL(d, x, v)), BFI_REM_4 p)
+# define BFI_TREE_SEEK_FAR_III(l, p) BFI_TREE_SEEK_FAR_IV(l, p)
+# define BFI_TREE_SEEK_FAR_IV(l, a, b, c, d) BFI_TREE_SEEK_FAR_V(l, a, b, c, d, BFI_TREE_SEL(c, BFI_TREE_SEL(b, BFI_TREE_SEL(a, l))))
+# define BFI_TREE_SEEK_FAR_V(l, a, b, c, d, x) l, BFI_TREE_CELL(d, x), (a, b, c, d, x)
+# define BFI_TREE_POS(a, b, c, d, l) (a, b, c, d)
+# define BFI_TREE_SND(x) BFI_SND(x)
+
+/* BFI_TREE_STORE(t, a, b, c, x)
+ *    t, x : tree
+ *    a, b, c : digit
+ *  Expand to 't' with the leaf at a, b, c replaced with 'x'.
+ */
+# define BFI_TREE_STORE(t, a, b, c, x) BFI_TREE_PUT(a, t, BFI_TREE_STORE_I(BFI_TREE_SEL(a, t), b, c, x))
+# define BFI_TREE_STORE_I(t, b, c, x) BFI_TREE_PUT(b, t, BFI_TREE_PUT(c, BFI_TREE_SEL(b, t), x))
+
+/* BFI_TREE_SEL(n, t)
+ * BFI_TREE_CELL(n, t)
+ * BFI_TREE_PUT(n, t, x)
+ * BFI_TREE_PUT_CELL(n, t, x)
+ *    n : digit
+ *    t : tree
+ *  Expand to the child 'n' of 't', or to 't' with that child replaced with
+ *  'x'. The _CELL forms are for the leaves.
+ */
+# define BFI_TREE_SEL(n, t) BFI_TREE_SEL_I(n, t)
+# define BFI_TREE_SEL_I(n, t) BFI_TREE_SEL_##t BFI_LOOKUP_##n)
+# define BFI_TREE_SEL_7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) BFI_TREE_SEL_II(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15,
+# define BFI_TREE_SEL_II(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, m) m(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_SEL_7z BFI_TREE_SEL_ZERO(
+# define BFI_TREE_SEL_ZERO(m) 7z
+# define BFI_TREE_CELL(n, t) BFI_TREE_CELL_I(n, t)
+# define BFI_TREE_CELL_I(n, t) BFI_TREE_CELL_##t BFI_LOOKUP_##n)
+# define BFI_TREE_CELL_7n BFI_TREE_SEL_7n
+# define BFI_TREE_CELL_7z BFI_TREE_CELL_ZERO(
+# define BFI_TREE_CELL_ZERO(m) 0x00
+
+# define BFI_TREE_PUT(n, t, x) BFI_TREE_PUT_I(n, t, x)
+# define BFI_TREE_PUT_I(n, t, x) BFI_TREE_PUT_##t BFI_TREE_PUT_##n, x)
+# define BFI_TREE_PUT_7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) BFI_TREE_PUT_II(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15,
+# define BFI_TREE_PUT_II(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, m, x) m(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_7z BFI_TREE_PUT_II(7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,7z,
+# define BFI_TREE_PUT_CELL(n, t, x) BFI_TREE_PUT_CELL_I(n, t, x)
+# define BFI_TREE_PUT_CELL_I(n, t, x) BFI_TREE_PUT_CELL_##t BFI_TREE_PUT_##n, x)
+# define BFI_TREE_PUT_CELL_7n BFI_TREE_PUT_7n
+# define BFI_TREE_PUT_CELL_7z BFI_TREE_PUT_II(0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+# define BFI_TREE_PUT_0x00(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x01(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x02(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x03(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x04(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x05(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x06(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x07(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x08(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x09(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x, x10, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x0a(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x, x11, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x0b(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x, x12, x13, x14, x15)
+# define BFI_TREE_PUT_0x0c(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x, x13, x14, x15)
+# define BFI_TREE_PUT_0x0d(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x, x14, x15)
+# define BFI_TREE_PUT_0x0e(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x, x15)
+# define BFI_TREE_PUT_0x0f(x, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7n(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x)
+
+/* BFI_TREE_ADD(p, k)
+ *    p, k : offset
+ *  Expand to (p + k) modulo 65536.
+ */
+# define BFI_TREE_ADD(p, k) BFI_TREE_ADD_I(BFI_REM_4 p, BFI_REM_4 k)
+# define BFI_TREE_ADD_I(x, y) BFI_TREE_ADD_II(x, y)
+# define BFI_TREE_ADD_II(a, b, c, d, w, x, y, z) BFI_TREE_ADD_D(a, b, c, w, x, y, BFI_TREE_DIGIT(BFI_ADD(d, z)))
+# define BFI_TREE_ADD_D(a, b, c, w, x, y, q) BFI_TREE_ADD_D_I(a, b, c, w, x, y, q)
+# define BFI_TREE_ADD_D_I(a, b, c, w, x, y, q, d) BFI_TREE_ADD_C(a, b, w, x, BFI_TREE_ADC(q, c, y), d)
+# define BFI_TREE_ADD_C(a, b, w, x, q, d) BFI_TREE_ADD_C_I(a, b, w, x, q, d)
+# define BFI_TREE_ADD_C_I(a, b, w, x, q, c, d) BFI_TREE_ADD_B(a, w, BFI_TREE_ADC(q, b, x), c, d)
+# define BFI_TREE_ADD_B(a, w, q, c, d) BFI_TREE_ADD_B_I(a, w, q, c, d)
+# define BFI_TREE_ADD_B_I(a, w, q, b, c, d) (BFI_TREE_SND(BFI_TREE_ADC(q, a, w)), b, c, d)
+
+/* BFI_TREE_ADC(q, x, y)
+ * BFI_TREE_DIGIT(s)
+ *    q : 0x00 or 0x01
+ *    x, y : digit
+ *    s : octet, s < 0x20
+ *  Expand to 'carry, digit' of (x + y + q), or of 's'.
+ */
+# define BFI_TREE_ADC(q, x, y) BFI_TREE_DIGIT(BFI_ADD(BFI_ADD(x, y), q))
+# define BFI_TREE_DIGIT(s) BFI_TREE_DIGIT_I(s)
+# define BFI_TREE_DIGIT_I(s) BFI_TREE_DIGIT_##s
+# define BFI_TREE_DIGIT_0x00 0x00, 0x00
+# define BFI_TREE_DIGIT_0x01 0x00, 0x01
+# define BFI_TREE_DIGIT_0x02 0x00, 0x02
+# define BFI_TREE_DIGIT_0x03 0x00, 0x03
+# define BFI_TREE_DIGIT_0x04 0x00, 0x04
+# define BFI_TREE_DIGIT_0x05 0x00, 0x05
+# define BFI_TREE_DIGIT_0x06 0x00, 0x06
+# define BFI_TREE_DIGIT_0x07 0x00, 0x07
+# define BFI_TREE_DIGIT_0x08 0x00, 0x08
+# define BFI_TREE_DIGIT_0x09 0x00, 0x09
+# define BFI_TREE_DIGIT_0x0a 0x00, 0x0a
+# define BFI_TREE_DIGIT_0x0b 0x00, 0x0b
+# define BFI_TREE_DIGIT_0x0c 0x00, 0x0c
+# define BFI_TREE_DIGIT_0x0d 0x00, 0x0d
+# define BFI_TREE_DIGIT_0x0e 0x00, 0x0e
+# define BFI_TREE_DIGIT_0x0f 0x00, 0x0f
+# define BFI_TREE_DIGIT_0x10 0x01, 0x00
+# define BFI_TREE_DIGIT_0x11 0x01, 0x01
+# define BFI_TREE_DIGIT_0x12 0x01, 0x02
+# define BFI_TREE_DIGIT_0x13 0x01, 0x03
+# define BFI_TREE_DIGIT_0x14 0x01, 0x04
+# define BFI_TREE_DIGIT_0x15 0x01, 0x05
+# define BFI_TREE_DIGIT_0x16 0x01, 0x06
+# define BFI_TREE_DIGIT_0x17 0x01, 0x07
+# define BFI_TREE_DIGIT_0x18 0x01, 0x08
+# define BFI_TREE_DIGIT_0x19 0x01, 0x09
+# define BFI_TREE_DIGIT_0x1a 0x01, 0x0a
+# define BFI_TREE_DIGIT_0x1b 0x01, 0x0b
+# define BFI_TREE_DIGIT_0x1c 0x01, 0x0c
+# define BFI_TREE_DIGIT_0x1d 0x01, 0x0d
+# define BFI_TREE_DIGIT_0x1e 0x01, 0x0e
+# define BFI_TREE_DIGIT_0x1f 0x01, 0x0f
+# endif
 
 /* BFI_SEQ_REVERSE(seq)
  *    seq : sequence
@@ -558,12 +2106,32 @@
 # define BFI_TEST_ONE_0x01 ()
 # define BFI_TEST_LOOP_6loop ()
 # define BFI_TEST_END_6end ()
+# define BFI_TEST_SCAN_6scanR(n) ()
+# define BFI_TEST_SCAN_6scanL(n) ()
 
 /* Symbols */
 
 # define BFI_SYM_6next(x) x
 # define BFI_SYM_6prev(x) x
+# define BFI_SYM_6read(x) x
 # define BFI_SYM_6write(x) x
+# define BFI_SYM_0xf8(x) x
+# define BFI_SYM_0xf9(x) x
+# define BFI_SYM_0xfa(x) x
+# define BFI_SYM_0xfb(x) x
+# define BFI_SYM_0xfc(x) x
+# define BFI_SYM_0xfd(x) x
+# define BFI_SYM_0xfe(x) x
+# define BFI_SYM_0xff(x) x
+# define BFI_SYM_0x00(x) x
+# define BFI_SYM_0x01(x) x
+# define BFI_SYM_0x02(x) x
+# define BFI_SYM_0x03(x) x
+# define BFI_SYM_0x04(x) x
+# define BFI_SYM_0x05(x) x
+# define BFI_SYM_0x06(x) x
+# define BFI_SYM_0x07(x) x
+# define BFI_SYM_0x08(x) x
 
 /* Debugging */
 
@@ -0,0 +1,139 @@
+import Data.List
+
+-- The largest value accepted for BFI_MACHINE_LEVELS.
+maxLevels :: Int
+maxLevels = 40
+
+defaultLevels :: Int
+defaultLevels = 25
+
+-- The largest value accepted for BFI_MACHINE_FAMILIES. This must agree with
+-- gen_linear.hs.
+maxFamilies :: Int
+maxFamilies = 4
+
+main = mapM_ putStrLn $ concat $ intersperse [""] $
+  [ prolog
+  , knob
+  , fuel
+  , feed
+  , ladder
+  ]
+  ++ map family [0 .. maxFamilies - 1]
+  ++ [epilog]
+
+prolog =
+  [ "# ifndef BFI_LEVELS_H"
+  , "# define BFI_LEVELS_H"
+  , ""
+  , "/* generated by gen_levels.hs */"
+  , ""
+  , "/* BFI_MACHINE_LEVELS"
+  , " *  The number of BFI_FCM{K}_OUTER levels of each machine family. The"
+  , " *  continuation machine aborts after about"
+  , " *  (2**BFI_MACHINE_LEVELS * BFI_LINEAR_DEPTH) slow steps. It must be between"
+  , " *  1 and " ++ show maxLevels ++ ". The default is " ++ show defaultLevels ++ "."
+  , " *"
+  , " *  A level is only entered when the computation outlives all the levels"
+  , " *  below it, so raising the limit does not slow down shorter runs."
+  , " */"
+  ]
+
+epilog = ["# endif"]
+
+knob =
+  [ "# ifndef BFI_MACHINE_LEVELS"
+  , "# define BFI_MACHINE_LEVELS " ++ show defaultLevels
+  , "# endif"
+  , ""
+  , "# if BFI_MACHINE_LEVELS < 1 || BFI_MACHINE_LEVELS > " ++ show maxLevels
+  , "# error \"BFI_MACHINE_LEVELS must be between 1 and " ++ show maxLevels ++ "\""
+  , "# endif"
+  ]
+
+family :: Int -> [String]
+family k = guard $ concat $ intersperse [""] $
+  [ entry k
+  , concatMap (outer k) [0 .. maxLevels - 1] ++ [overflow k maxLevels]
+  , map (inner k) [0 .. maxLevels - 1]
+  , chain k
+  , concatMap (refill k) [2 .. maxLevels - 1]
+  , map (resume k "OUTER" 1) [0 .. maxLevels - 1]
+  ]
+  where
+    guard body
+      | k == 0 = body
+      | otherwise = ["# if BFI_MACHINE_FAMILIES > " ++ show k] ++ body ++ ["# endif"]
+
+entry k =
+  [ "# define " ++ machine k "O" ++ "(v, f, d) BFI_LEFT(" ++ machine k "R" ++ "(BFI_FMACHINE_START_K(" ++ show k ++ ", v, f, d)))()"
+  , "# define " ++ machine k "V" ++ "(v, f, d) BFI_RIGHT(" ++ machine k "R" ++ "(BFI_FMACHINE_START_K(" ++ show k ++ ", v, f, d)))"
+  , "# define " ++ machine k "R" ++ "(z) BFI_FMACHINE_END(" ++ name k "OUTER_C" 0 ++ "(z))"
+  ]
+
+outer :: Int -> Int -> [String]
+outer k 0 = [normal k 0]
+outer k n =
+  [ "# if BFI_MACHINE_LEVELS > " ++ show n
+  , normal k n
+  , "# else"
+  , overflow k n
+  , "# endif"
+  ]
+
+normal k n = "# define " ++ name k "OUTER_C" n ++ "(z) " ++ name k "OUTER_I" n ++ "(" ++ name k "INNER_C" n ++ "(z))"
+
+overflow k n = "# define " ++ name k "OUTER_C" n ++ "(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z"
+
+inner k n = "# define " ++ name k "INNER_C" n ++ "(z) " ++ prefix k ++ "RUN(z, " ++ fuelName n ++ ")"
+
+-- BFI_FMACHINE_FUEL_{N} expands to ",1),2) ... ,N)", which lasts the chain
+-- of step macros for (2**N-1) steps. A step that takes ",E)" with E > 1
+-- first puts BFI_FMACHINE_FUEL_{E-1} in front of the rest of the fuel, so
+-- the fuel is produced as it is used up.
+fuel = ("# define " ++ fuelName 0) : map more [1 .. maxLevels - 1]
+  where more n = "# define " ++ fuelName n ++ " " ++ fuelName (n - 1) ++ "," ++ show n ++ ")"
+
+feed = concatMap more [2 .. maxLevels - 1]
+  where
+    more e =
+      [ "# define BFI_FMACHINE_FEED_0" ++ show e ++ "(k) BFI_FMACHINE_FEED_01(k)"
+      , "# define BFI_FMACHINE_FEED_1" ++ show e ++ "(k) k##_REFILL_" ++ show e ++ "(" ++ fuelName (e - 1) ++ ","
+      , "# define BFI_FMACHINE_EAT_A_" ++ show e ++ "(r) BFI_FMACHINE_EAT_A_1(r)"
+      , "# define BFI_FMACHINE_EAT_B_" ++ show e ++ "(r) BFI_FMACHINE_EAT_B_1(r)"
+      ]
+
+-- BFI_FMACHINE_LADDER_{N} is "(0)(1) ... (N-1)", the levels that
+-- BFI_FCM{K}_OUTER_C_0 goes through when BFI_MACHINE_LEVELS is N.
+-- BFI_FMACHINE_HALVE_{N} is "(N-1)(N-1)", which takes as many steps as the
+-- level N.
+ladder = "# define BFI_FMACHINE_LADDER_1 (0)" : map more [2 .. maxLevels] ++ map halve [1 .. maxLevels - 1]
+  where
+    more n = "# define BFI_FMACHINE_LADDER_" ++ show n ++ " BFI_FMACHINE_LADDER_" ++ show (n - 1) ++ "(" ++ show (n - 1) ++ ")"
+    halve n = "# define BFI_FMACHINE_HALVE_" ++ show n ++ " (" ++ show (n - 1) ++ ")(" ++ show (n - 1) ++ ")"
+
+fuelName :: Int -> String
+fuelName n = "BFI_FMACHINE_FUEL_" ++ show n
+
+chain k = ("# define " ++ prefix k ++ "RUN(z, f) " ++ prefix k ++ "STEP_A(z f,0)") : concat [step "A" "B", step "B" "A"]
+  where
+    step a b =
+      [ "# define " ++ prefix k ++ "STEP_" ++ a ++ "(z, e) " ++ prefix k ++ "GO_" ++ a ++ "(e, BFI_ENTER_LINEAR" ++ show k ++ "(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))"
+      , "# define " ++ prefix k ++ "GO_" ++ a ++ "(e, x) BFI_FMACHINE_FEED(" ++ prefix k ++ "STEP_" ++ b ++ ", e, x"
+      ]
+
+-- A refill for each E, so that the one for ",E)" is never used while the
+-- fuel it has put out is still being taken.
+refill k e = [step "A", step "B"]
+  where step a = "# define " ++ prefix k ++ "STEP_" ++ a ++ "_REFILL_" ++ show e ++ "(f, z, e) " ++ prefix k ++ "STEP_" ++ a ++ "(z f,e)"
+
+resume k kind d n = "# define " ++ name k (kind ++ "_I") n ++ "(x) BFI_FMACHINE_RESUME(" ++ name k (kind ++ "_C") (n + d) ++ ", x)"
+
+name :: Int -> String -> Int -> String
+name k kind n = prefix k ++ kind ++ "_" ++ show n
+
+prefix :: Int -> String
+prefix k = "BFI_FCM" ++ show k ++ "_"
+
+machine :: Int -> String -> String
+machine k m = "BFI_FMACHINE" ++ show k ++ "_" ++ m
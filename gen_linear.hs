@@ -0,0 +1,204 @@
+import Data.Char
+import Data.List
+import System.Directory
+
+-- The driver depths selectable with BFI_LINEAR_DEPTH, in increasing order.
+depths :: [Int]
+depths = [64, 256, 1024, 4096]
+
+defaultDepth :: Int
+defaultDepth = 256
+
+-- The largest value accepted for BFI_MACHINE_FAMILIES.
+maxFamilies :: Int
+maxFamilies = 4
+
+defaultFamilies :: Int
+defaultFamilies = 2
+
+-- linear.h only holds the knobs, the entrances and the first driver of each
+-- chain. The other drivers are split into one header per chain and depth
+-- segment, so that the drivers of a depth or family that is not selected
+-- are not even read.
+main = do
+  createDirectoryIfMissing False "linear"
+  writeFile "linear.h" $ unlines $ concat $ intersperse [""] $
+    [ prolog
+    , knob
+    , pick
+    ]
+    ++ map family [0 .. maxFamilies - 1]
+    ++ [chain counted, chain sampled, epilog]
+  sequence_ [ writeFile (segmentFile k hi) (unlines (segment k s))
+            | k <- map normal [0 .. maxFamilies - 1] ++ [counted, sampled]
+            , s@(_, hi) <- segments ]
+
+-- The depth segments, as (lo, hi) pairs. A segment holds the drivers lo + 1
+-- to hi, and is included when BFI_LINEAR_DEPTH is larger than lo.
+segments :: [(Int, Int)]
+segments = zip (0 : depths) depths
+
+prolog =
+  [ "# ifndef BFI_LINEAR_H"
+  , "# define BFI_LINEAR_H"
+  , ""
+  , "/* generated by gen_linear.hs */"
+  , ""
+  , "/* BFI_LINEAR_DEPTH"
+  , " *  The number of linear driver macros the machine runs through before it"
+  , " *  suspends itself and turns its state back into the portable"
+  , " *  representation. It must be one of " ++ sep ", " (map show depths) ++ "."
+  , " *  The default is " ++ show defaultDepth ++ "."
+  , " *"
+  , " *  A deeper chain means fewer suspensions, but each suspension has to deal"
+  , " *  with a bigger active representation. Define it before including any of"
+  , " *  the bfi headers."
+  , " *"
+  , " * BFI_MACHINE_FAMILIES"
+  , " *  The number of machine families, i.e. the number of continuation machines"
+  , " *  that can be running at the same time, one nested inside another. It must"
+  , " *  be between 1 and " ++ show maxFamilies ++ ". The default is " ++ show defaultFamilies ++ "."
+  , " *"
+  , " *  Every family has its own copy of the linear drivers and of the"
+  , " *  BFI_FCM{K}_* macros, so each one costs about BFI_LINEAR_DEPTH macro"
+  , " *  definitions."
+  , " *"
+  , " * BFI_FLINEARC_*"
+  , " *  An extra set of linear drivers used by BFI_FMACHINE_TALLY. Every driver"
+  , " *  outputs (0slow(0i##f)) when it is called with the instruction f, and"
+  , " *  its _TICK(t) companion outputs (0fast(0i##t)). The 0i prefix keeps the"
+  , " *  instruction name from being expanded."
+  , " *"
+  , " * BFI_FLINEARS_*"
+  , " *  An extra set of linear drivers used by BFI_FMACHINE_SAMPLE. They are"
+  , " *  the normal drivers, except that BFI_FLINEARS_0 suspends the machine"
+  , " *  through BFI_FMACHINE_SAMPLE_SUSPEND."
+  , " *"
+  , " *  The drivers of each set are in linear/, one header per depth segment."
+  , " *  Only the headers for the selected depth and families are included."
+  , " */"
+  ]
+
+epilog = ["# endif"]
+
+knob =
+  [ "# ifndef BFI_LINEAR_DEPTH"
+  , "# define BFI_LINEAR_DEPTH " ++ show defaultDepth
+  , "# endif"
+  , ""
+  , "# ifndef BFI_MACHINE_FAMILIES"
+  , "# define BFI_MACHINE_FAMILIES " ++ show defaultFamilies
+  , "# endif"
+  , ""
+  , "# if BFI_MACHINE_FAMILIES < 1 || BFI_MACHINE_FAMILIES > " ++ show maxFamilies
+  , "# error \"BFI_MACHINE_FAMILIES must be between 1 and " ++ show maxFamilies ++ "\""
+  , "# endif"
+  ]
+
+-- BFI_FMACHINE_PICK() tries the families in order and expands to the number
+-- of the first one that is not running.
+pick =
+  [ "# define BFI_FMACHINE_PICK() " ++ foldr try "BFI_MACHINE_OVERFLOW()" [0 .. maxFamilies - 1]
+  ]
+  where
+    try k rest = "BFI_IF(BFI_FMACHINE_FREEP(" ++ show k ++ "))(" ++ show k ++ ", " ++ rest ++ ")"
+
+-- A set of linear drivers. The drivers of a normal family are named
+-- BFI_FLINEAR{K}_{N}, the counted chain is named BFI_FLINEARC_{N}, and the
+-- sampled chain is named BFI_FLINEARS_{N}.
+data Chain = Chain
+  { tag :: String
+  , slowTick :: String
+  , fastTick :: String
+  , untick :: String
+  , sampler :: Bool
+  }
+
+normal :: Int -> Chain
+normal k = Chain (show k) "" "" "x" False
+
+counted :: Chain
+counted = Chain "C" "(0slow(0i##f))" " (0fast(0i##t))" "BFI_EAT x" False
+
+sampled :: Chain
+sampled = Chain "S" "" "" "x" True
+
+family :: Int -> [String]
+family k = guard $
+  ("# define BFI_ENTER_LINEAR" ++ show k ++ "(r) BFI_ENTER_LINEAR_I r") : chain (normal k)
+  where
+    guard body
+      | k == 0 = body
+      | otherwise = ["# if BFI_MACHINE_FAMILIES > " ++ show k] ++ body ++ ["# endif"]
+
+chain :: Chain -> [String]
+chain k =
+  [ "# define " ++ linearName k 0 ++ "(v, f, ds) " ++ suspend k
+  , tick k 0
+  , "# define " ++ entranceName k 'A' ++ "_TICK(t)" ++ fastTick k
+  , "# define " ++ entranceName k 'B' ++ "_TICK(t)" ++ fastTick k
+  , "# define BFI_FLINEAR" ++ tag k ++ "_ENTRANCE_TEST(x) " ++ untick k
+  , ""
+  ]
+  ++ entrances k
+  ++ concatMap (\s -> "" : include k s) (reverse segments)
+
+-- The sampled chain wraps the A register in parentheses, so that the top
+-- frame can be passed to BFI_FMACHINE_SAMPLE_SUSPEND as its last arguments.
+suspend :: Chain -> String
+suspend k
+  | sampler k = "BFI_FMACHINE_SAMPLE_SUSPEND(f, (v) ds"
+  | otherwise = slowTick k ++ "BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(" ++ tag k ++ "), v, BFI_CLEANUP_REST(~ds"
+
+entrances k = concat (zipWith entrance ("# if" : repeat "# elif") depths) ++
+  [ "# else"
+  , "# error \"BFI_LINEAR_DEPTH must be one of " ++ sep ", " (map show depths) ++ "\""
+  , "# endif"
+  ]
+  where
+    entrance kw d = (kw ++ " BFI_LINEAR_DEPTH == " ++ show d) :
+      [ "# define " ++ entranceName k c ++ "(v, f, ds) " ++ slowTick k ++ step k (d - 2) | c <- "AB" ]
+
+include :: Chain -> (Int, Int) -> [String]
+include k (lo, hi)
+  | lo == 0 = [line]
+  | otherwise = ["# if BFI_LINEAR_DEPTH > " ++ show lo, line, "# endif"]
+  where
+    line = "# include \"" ++ segmentFile k hi ++ "\""
+
+segment :: Chain -> (Int, Int) -> [String]
+segment k (lo, hi) =
+  [ "# ifndef " ++ guard
+  , "# define " ++ guard
+  , ""
+  , "/* generated by gen_linear.hs */"
+  , ""
+  ]
+  ++ concatMap (\n -> [linear k n, tick k n]) [hi, hi - 1 .. lo + 1]
+  ++ ["", "# endif"]
+  where
+    guard = "BFI_LINEAR_" ++ map toUpper (segmentName k hi) ++ "_H"
+
+segmentFile :: Chain -> Int -> String
+segmentFile k hi = "linear/" ++ segmentName k hi ++ ".h"
+
+segmentName :: Chain -> Int -> String
+segmentName k hi = map toLower (tag k) ++ "_" ++ show hi
+
+linear :: Chain -> Int -> String
+linear k n = "# define " ++ linearName k n ++ "(v, f, ds) " ++ slowTick k ++ step k (n - 1)
+
+tick :: Chain -> Int -> String
+tick k n = "# define " ++ linearName k n ++ "_TICK(t)" ++ fastTick k
+
+step :: Chain -> Int -> String
+step k n = "BFI_FINST_##f(" ++ linearName k n ++ ", v ds"
+
+linearName :: Chain -> Int -> String
+linearName k n = "BFI_FLINEAR" ++ tag k ++ "_" ++ show n
+
+entranceName :: Chain -> Char -> String
+entranceName k c = "BFI_FLINEAR" ++ tag k ++ "_ENTRANCE_" ++ [c]
+
+sep :: String -> [String] -> String
+sep c = concat . intersperse c
@@ -0,0 +1,82 @@
+import Data.Word
+import Text.Printf
+import Data.List
+
+main = mapM_ putStrLn $ concat $ intersperse [""] $
+  [ prolog
+  , forAll uncons7c
+  , forAll uncons7z
+  , forAll consMany7c
+  , forAll consMany7z
+  ]
+  ++ [epilog]
+
+prolog =
+  [ "# ifndef BFI_MOVE_H"
+  , "# define BFI_MOVE_H"
+  , ""
+  , "/* generated by gen_move.hs */"
+  , ""
+  , "/* BFI_UNCONS_##n##l"
+  , " * BFI_CONS_MANY_##n##7c(t, x0, ..., xm)"
+  , " * BFI_CONS_MANY_##n##7z(_, x0, ..., xm)"
+  , " *    n : octet, not 0x00, m = n - 1"
+  , " *    l, t : octet-list"
+  , " *    x0, ..., xm : octet"
+  , " *  The tables behind BFI_MOVE_FORWARD in bfi.h."
+  , " *  BFI_UNCONS_##n##l expands to the first m items of 'l', a closing paren,"
+  , " *  then the n-th item and the rest of 'l', separated by commas."
+  , " *  BFI_CONS_MANY_##n##7c pushes x0 to xm onto 't', in this order."
+  , " *  BFI_CONS_MANY_##n##7z does the same onto 7z, but drops leading zeros so"
+  , " *  that the result stays canonical."
+  , " */"
+  ]
+
+epilog = ["# endif"]
+
+uncons7c :: Word8 -> String
+uncons7c n = "# define " ++ name "UNCONS" n "7c" ++ "(h, t) " ++ body
+  where
+    body = case n of
+      1 -> ", h, t"
+      2 -> "h)" ++ name "UNCONS" 1 "##t"
+      _ -> "h," ++ name "UNCONS" (n - 1) "##t"
+
+uncons7z :: Word8 -> String
+uncons7z n = "# define " ++ name "UNCONS" n "7z" ++ " " ++ body
+  where
+    body = case n of
+      1 -> ", 0x00, 7z"
+      2 -> "0x00), 0x00, 7z"
+      _ -> "0x00," ++ name "UNCONS" (n - 1) "7z"
+
+consMany7c :: Word8 -> String
+consMany7c n = "# define " ++ name "CONS_MANY" n "7c" ++ params "t" n ++ " " ++ body
+  where
+    body = foldl (\t x -> "7c(" ++ x ++ "," ++ t ++ ")") "t" (items n)
+
+consMany7z :: Word8 -> String
+consMany7z n = "# define " ++ name "CONS_MANY" n "7z" ++ params "_" n ++ " " ++ body
+  where
+    body = case n of
+      1 -> "BFI_IFN(BFI_TEST_ZERO_##x0)(7z, 7c(x0,7z))"
+      _ -> "BFI_IFN(BFI_TEST_ZERO_##x0)("
+        ++ name "CONS_MANY" (n - 1) "7z" ++ ", " ++ name "CONS_MANY" (n - 1) "7c"
+        ++ ")(" ++ sep ", " ("7c(x0,7z)" : tail (items n)) ++ ")"
+
+params :: String -> Word8 -> String
+params t n = "(" ++ sep ", " (t : items n) ++ ")"
+
+items :: Word8 -> [String]
+items n = map (('x':) . show) [0 .. fromIntegral n - 1 :: Int]
+
+name :: String -> Word8 -> String -> String
+name prefix n tag = "BFI_" ++ prefix ++ "_" ++ pr n ++ tag
+
+sep :: String -> [String] -> String
+sep c = concat . intersperse c
+
+pr :: Word8 -> String
+pr n = printf "0x%02x" n
+
+forAll f = map f [1 .. 0xff]
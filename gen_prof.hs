@@ -0,0 +1,70 @@
+import Data.List
+
+-- The bf-cm instructions counted by BFI_EXEC_PROFILE, in the order of its
+-- report. Every instruction that a compiled program can run belongs here.
+-- The ticks of the rest, such as 6exec, 6tuple_4 and 6stop, which only
+-- start and stop the program, are dropped.
+counted :: [String]
+counted =
+  [ "6inc", "6dec", "6add", "6next", "6prev", "6next1", "6prev1"
+  , "6nextA", "6nextB", "6prevA", "6prevB", "6loop", "6loopA", "6if"
+  , "6read", "6readA", "6readB", "6write", "6writeA", "6writeB"
+  , "6senter", "6sadd", "6sexit", "6id_4", "6seek"
+  , "6scanR", "6scanL", "6addA", "6addB", "6setA", "6setB"
+  ]
+
+main = mapM_ putStrLn $ concat $ intersperse [""] $
+  [ prolog
+  , [zero]
+  , zipWith slot [0 ..] counted
+  , map count slots
+  , map bump slots
+  , [report]
+  , epilog
+  ]
+
+prolog =
+  [ "# ifndef BFI_PROF_H"
+  , "# define BFI_PROF_H"
+  , ""
+  , "/* generated by gen_prof.hs */"
+  , ""
+  , "/* BFI_PROF_ZERO"
+  , " * BFI_PROF_SLOT_0i##g"
+  , " * BFI_PROF_REPORT_I(c0, ..., cm)"
+  , " *    g : instruction"
+  , " *    c0, ..., cm : counter"
+  , " *  The tables behind BFI_EXEC_PROFILE in bfi.h, with one counter for each"
+  , " *  of the " ++ show (length counted) ++ " counted instructions."
+  , " *  BFI_PROF_ZERO is the tuple of counters before the run."
+  , " *  BFI_PROF_SLOT_0i##g is a BFI_SWITCH case for a tick of 'g', which"
+  , " *  bumps the counter of 'g' through BFI_PROF_COUNT_{N} and BFI_PROF_BUMP_{N}."
+  , " *  BFI_PROF_REPORT_I expands to a BFI_PROF_ROW for each counter."
+  , " */"
+  ]
+
+epilog = ["# endif"]
+
+slots :: [Int]
+slots = [0 .. length counted - 1]
+
+zero = "# define BFI_PROF_ZERO (" ++ intercalate ", " (map (const "(0)()") slots) ++ ")"
+
+slot n g = "# define BFI_PROF_SLOT_0i" ++ g ++ " BFI_TEST_SUCCESS(" ++ name "COUNT" n ++ ")"
+
+count n = "# define " ++ name "COUNT" n ++ "(j, a, i) BFI_PROF_GO(j, " ++ name "BUMP" n ++ " a,"
+
+bump n = "# define " ++ name "BUMP" n ++ "(" ++ intercalate ", " params ++ ") (" ++ intercalate ", " (zipWith inc slots params) ++ ")"
+  where
+    inc m c
+      | m == n = "BFI_FMACHINE_INC(" ++ c ++ ")"
+      | otherwise = c
+
+report = "# define BFI_PROF_REPORT_I(" ++ intercalate ", " params ++ ") " ++ unwords (zipWith row counted params)
+  where row g c = "BFI_PROF_ROW(" ++ g ++ ", " ++ c ++ ")"
+
+params :: [String]
+params = map (('c' :) . show) slots
+
+name :: String -> Int -> String
+name kind n = "BFI_PROF_" ++ kind ++ "_" ++ show n
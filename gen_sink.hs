@@ -0,0 +1,40 @@
+import Data.Word
+import Text.Printf
+import Data.List
+
+main = mapM_ putStrLn $ concat $ intersperse [""] $
+  [ prolog
+  , map (test "GAIN") [0x01 .. 0x7f]
+  , map (test "FAR") [far .. 0xff - far + 1]
+  , epilog
+  ]
+
+prolog =
+  [ "# ifndef BFI_SINK_H"
+  , "# define BFI_SINK_H"
+  , ""
+  , "/* generated by gen_sink.hs */"
+  , ""
+  , "/* BFI_TEST_SINKMOVES_GAIN_##b"
+  , " * BFI_TEST_SINKMOVES_FAR_##b"
+  , " *    b : octet"
+  , " *  The tables behind BFI_SINKMOVES in bfi.h, which read 'b' as a signed"
+  , " *  number from -128 to 127."
+  , " *  BFI_TEST_SINKMOVES_GAIN_##b expands to () if 'b' is positive."
+  , " *  BFI_TEST_SINKMOVES_FAR_##b expands to () if 'b' is at least " ++ show far ++ " or"
+  , " *  at most -" ++ show far ++ "."
+  , " */"
+  ]
+
+epilog = ["# endif"]
+
+-- The balance at which a block is split. A block that is split pays at
+-- most two more costs, of at most 8 each, so its balance cannot wrap around.
+far :: Word8
+far = 0x40
+
+test :: String -> Word8 -> String
+test kind b = "# define BFI_TEST_SINKMOVES_" ++ kind ++ "_" ++ pr b ++ " ()"
+
+pr :: Word8 -> String
+pr n = printf "0x%02x" n
@@ -0,0 +1,1772 @@
+# ifndef BFI_LEVELS_H
+# define BFI_LEVELS_H
+
+/* generated by gen_levels.hs */
+
+/* BFI_MACHINE_LEVELS
+ *  The number of BFI_FCM{K}_OUTER levels of each machine family. The
+ *  continuation machine aborts after about
+ *  (2**BFI_MACHINE_LEVELS * BFI_LINEAR_DEPTH) slow steps. It must be between
+ *  1 and 40. The default is 25.
+ *
+ *  A level is only entered when the computation outlives all the levels
+ *  below it, so raising the limit does not slow down shorter runs.
+ */
+
+# ifndef BFI_MACHINE_LEVELS
+# define BFI_MACHINE_LEVELS 25
+# endif
+
+# if BFI_MACHINE_LEVELS < 1 || BFI_MACHINE_LEVELS > 40
+# error "BFI_MACHINE_LEVELS must be between 1 and 40"
+# endif
+
+# define BFI_FMACHINE_FUEL_0
+# define BFI_FMACHINE_FUEL_1 BFI_FMACHINE_FUEL_0,1)
+# define BFI_FMACHINE_FUEL_2 BFI_FMACHINE_FUEL_1,2)
+# define BFI_FMACHINE_FUEL_3 BFI_FMACHINE_FUEL_2,3)
+# define BFI_FMACHINE_FUEL_4 BFI_FMACHINE_FUEL_3,4)
+# define BFI_FMACHINE_FUEL_5 BFI_FMACHINE_FUEL_4,5)
+# define BFI_FMACHINE_FUEL_6 BFI_FMACHINE_FUEL_5,6)
+# define BFI_FMACHINE_FUEL_7 BFI_FMACHINE_FUEL_6,7)
+# define BFI_FMACHINE_FUEL_8 BFI_FMACHINE_FUEL_7,8)
+# define BFI_FMACHINE_FUEL_9 BFI_FMACHINE_FUEL_8,9)
+# define BFI_FMACHINE_FUEL_10 BFI_FMACHINE_FUEL_9,10)
+# define BFI_FMACHINE_FUEL_11 BFI_FMACHINE_FUEL_10,11)
+# define BFI_FMACHINE_FUEL_12 BFI_FMACHINE_FUEL_11,12)
+# define BFI_FMACHINE_FUEL_13 BFI_FMACHINE_FUEL_12,13)
+# define BFI_FMACHINE_FUEL_14 BFI_FMACHINE_FUEL_13,14)
+# define BFI_FMACHINE_FUEL_15 BFI_FMACHINE_FUEL_14,15)
+# define BFI_FMACHINE_FUEL_16 BFI_FMACHINE_FUEL_15,16)
+# define BFI_FMACHINE_FUEL_17 BFI_FMACHINE_FUEL_16,17)
+# define BFI_FMACHINE_FUEL_18 BFI_FMACHINE_FUEL_17,18)
+# define BFI_FMACHINE_FUEL_19 BFI_FMACHINE_FUEL_18,19)
+# define BFI_FMACHINE_FUEL_20 BFI_FMACHINE_FUEL_19,20)
+# define BFI_FMACHINE_FUEL_21 BFI_FMACHINE_FUEL_20,21)
+# define BFI_FMACHINE_FUEL_22 BFI_FMACHINE_FUEL_21,22)
+# define BFI_FMACHINE_FUEL_23 BFI_FMACHINE_FUEL_22,23)
+# define BFI_FMACHINE_FUEL_24 BFI_FMACHINE_FUEL_23,24)
+# define BFI_FMACHINE_FUEL_25 BFI_FMACHINE_FUEL_24,25)
+# define BFI_FMACHINE_FUEL_26 BFI_FMACHINE_FUEL_25,26)
+# define BFI_FMACHINE_FUEL_27 BFI_FMACHINE_FUEL_26,27)
+# define BFI_FMACHINE_FUEL_28 BFI_FMACHINE_FUEL_27,28)
+# define BFI_FMACHINE_FUEL_29 BFI_FMACHINE_FUEL_28,29)
+# define BFI_FMACHINE_FUEL_30 BFI_FMACHINE_FUEL_29,30)
+# define BFI_FMACHINE_FUEL_31 BFI_FMACHINE_FUEL_30,31)
+# define BFI_FMACHINE_FUEL_32 BFI_FMACHINE_FUEL_31,32)
+# define BFI_FMACHINE_FUEL_33 BFI_FMACHINE_FUEL_32,33)
+# define BFI_FMACHINE_FUEL_34 BFI_FMACHINE_FUEL_33,34)
+# define BFI_FMACHINE_FUEL_35 BFI_FMACHINE_FUEL_34,35)
+# define BFI_FMACHINE_FUEL_36 BFI_FMACHINE_FUEL_35,36)
+# define BFI_FMACHINE_FUEL_37 BFI_FMACHINE_FUEL_36,37)
+# define BFI_FMACHINE_FUEL_38 BFI_FMACHINE_FUEL_37,38)
+# define BFI_FMACHINE_FUEL_39 BFI_FMACHINE_FUEL_38,39)
+
+# define BFI_FMACHINE_FEED_02(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_12(k) k##_REFILL_2(BFI_FMACHINE_FUEL_1,
+# define BFI_FMACHINE_EAT_A_2(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_2(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_03(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_13(k) k##_REFILL_3(BFI_FMACHINE_FUEL_2,
+# define BFI_FMACHINE_EAT_A_3(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_3(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_04(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_14(k) k##_REFILL_4(BFI_FMACHINE_FUEL_3,
+# define BFI_FMACHINE_EAT_A_4(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_4(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_05(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_15(k) k##_REFILL_5(BFI_FMACHINE_FUEL_4,
+# define BFI_FMACHINE_EAT_A_5(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_5(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_06(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_16(k) k##_REFILL_6(BFI_FMACHINE_FUEL_5,
+# define BFI_FMACHINE_EAT_A_6(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_6(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_07(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_17(k) k##_REFILL_7(BFI_FMACHINE_FUEL_6,
+# define BFI_FMACHINE_EAT_A_7(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_7(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_08(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_18(k) k##_REFILL_8(BFI_FMACHINE_FUEL_7,
+# define BFI_FMACHINE_EAT_A_8(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_8(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_09(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_19(k) k##_REFILL_9(BFI_FMACHINE_FUEL_8,
+# define BFI_FMACHINE_EAT_A_9(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_9(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_010(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_110(k) k##_REFILL_10(BFI_FMACHINE_FUEL_9,
+# define BFI_FMACHINE_EAT_A_10(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_10(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_011(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_111(k) k##_REFILL_11(BFI_FMACHINE_FUEL_10,
+# define BFI_FMACHINE_EAT_A_11(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_11(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_012(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_112(k) k##_REFILL_12(BFI_FMACHINE_FUEL_11,
+# define BFI_FMACHINE_EAT_A_12(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_12(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_013(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_113(k) k##_REFILL_13(BFI_FMACHINE_FUEL_12,
+# define BFI_FMACHINE_EAT_A_13(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_13(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_014(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_114(k) k##_REFILL_14(BFI_FMACHINE_FUEL_13,
+# define BFI_FMACHINE_EAT_A_14(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_14(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_015(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_115(k) k##_REFILL_15(BFI_FMACHINE_FUEL_14,
+# define BFI_FMACHINE_EAT_A_15(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_15(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_016(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_116(k) k##_REFILL_16(BFI_FMACHINE_FUEL_15,
+# define BFI_FMACHINE_EAT_A_16(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_16(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_017(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_117(k) k##_REFILL_17(BFI_FMACHINE_FUEL_16,
+# define BFI_FMACHINE_EAT_A_17(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_17(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_018(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_118(k) k##_REFILL_18(BFI_FMACHINE_FUEL_17,
+# define BFI_FMACHINE_EAT_A_18(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_18(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_019(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_119(k) k##_REFILL_19(BFI_FMACHINE_FUEL_18,
+# define BFI_FMACHINE_EAT_A_19(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_19(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_020(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_120(k) k##_REFILL_20(BFI_FMACHINE_FUEL_19,
+# define BFI_FMACHINE_EAT_A_20(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_20(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_021(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_121(k) k##_REFILL_21(BFI_FMACHINE_FUEL_20,
+# define BFI_FMACHINE_EAT_A_21(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_21(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_022(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_122(k) k##_REFILL_22(BFI_FMACHINE_FUEL_21,
+# define BFI_FMACHINE_EAT_A_22(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_22(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_023(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_123(k) k##_REFILL_23(BFI_FMACHINE_FUEL_22,
+# define BFI_FMACHINE_EAT_A_23(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_23(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_024(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_124(k) k##_REFILL_24(BFI_FMACHINE_FUEL_23,
+# define BFI_FMACHINE_EAT_A_24(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_24(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_025(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_125(k) k##_REFILL_25(BFI_FMACHINE_FUEL_24,
+# define BFI_FMACHINE_EAT_A_25(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_25(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_026(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_126(k) k##_REFILL_26(BFI_FMACHINE_FUEL_25,
+# define BFI_FMACHINE_EAT_A_26(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_26(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_027(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_127(k) k##_REFILL_27(BFI_FMACHINE_FUEL_26,
+# define BFI_FMACHINE_EAT_A_27(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_27(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_028(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_128(k) k##_REFILL_28(BFI_FMACHINE_FUEL_27,
+# define BFI_FMACHINE_EAT_A_28(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_28(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_029(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_129(k) k##_REFILL_29(BFI_FMACHINE_FUEL_28,
+# define BFI_FMACHINE_EAT_A_29(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_29(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_030(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_130(k) k##_REFILL_30(BFI_FMACHINE_FUEL_29,
+# define BFI_FMACHINE_EAT_A_30(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_30(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_031(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_131(k) k##_REFILL_31(BFI_FMACHINE_FUEL_30,
+# define BFI_FMACHINE_EAT_A_31(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_31(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_032(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_132(k) k##_REFILL_32(BFI_FMACHINE_FUEL_31,
+# define BFI_FMACHINE_EAT_A_32(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_32(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_033(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_133(k) k##_REFILL_33(BFI_FMACHINE_FUEL_32,
+# define BFI_FMACHINE_EAT_A_33(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_33(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_034(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_134(k) k##_REFILL_34(BFI_FMACHINE_FUEL_33,
+# define BFI_FMACHINE_EAT_A_34(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_34(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_035(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_135(k) k##_REFILL_35(BFI_FMACHINE_FUEL_34,
+# define BFI_FMACHINE_EAT_A_35(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_35(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_036(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_136(k) k##_REFILL_36(BFI_FMACHINE_FUEL_35,
+# define BFI_FMACHINE_EAT_A_36(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_36(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_037(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_137(k) k##_REFILL_37(BFI_FMACHINE_FUEL_36,
+# define BFI_FMACHINE_EAT_A_37(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_37(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_038(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_138(k) k##_REFILL_38(BFI_FMACHINE_FUEL_37,
+# define BFI_FMACHINE_EAT_A_38(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_38(r) BFI_FMACHINE_EAT_B_1(r)
+# define BFI_FMACHINE_FEED_039(k) BFI_FMACHINE_FEED_01(k)
+# define BFI_FMACHINE_FEED_139(k) k##_REFILL_39(BFI_FMACHINE_FUEL_38,
+# define BFI_FMACHINE_EAT_A_39(r) BFI_FMACHINE_EAT_A_1(r)
+# define BFI_FMACHINE_EAT_B_39(r) BFI_FMACHINE_EAT_B_1(r)
+
+# define BFI_FMACHINE_LADDER_1 (0)
+# define BFI_FMACHINE_LADDER_2 BFI_FMACHINE_LADDER_1(1)
+# define BFI_FMACHINE_LADDER_3 BFI_FMACHINE_LADDER_2(2)
+# define BFI_FMACHINE_LADDER_4 BFI_FMACHINE_LADDER_3(3)
+# define BFI_FMACHINE_LADDER_5 BFI_FMACHINE_LADDER_4(4)
+# define BFI_FMACHINE_LADDER_6 BFI_FMACHINE_LADDER_5(5)
+# define BFI_FMACHINE_LADDER_7 BFI_FMACHINE_LADDER_6(6)
+# define BFI_FMACHINE_LADDER_8 BFI_FMACHINE_LADDER_7(7)
+# define BFI_FMACHINE_LADDER_9 BFI_FMACHINE_LADDER_8(8)
+# define BFI_FMACHINE_LADDER_10 BFI_FMACHINE_LADDER_9(9)
+# define BFI_FMACHINE_LADDER_11 BFI_FMACHINE_LADDER_10(10)
+# define BFI_FMACHINE_LADDER_12 BFI_FMACHINE_LADDER_11(11)
+# define BFI_FMACHINE_LADDER_13 BFI_FMACHINE_LADDER_12(12)
+# define BFI_FMACHINE_LADDER_14 BFI_FMACHINE_LADDER_13(13)
+# define BFI_FMACHINE_LADDER_15 BFI_FMACHINE_LADDER_14(14)
+# define BFI_FMACHINE_LADDER_16 BFI_FMACHINE_LADDER_15(15)
+# define BFI_FMACHINE_LADDER_17 BFI_FMACHINE_LADDER_16(16)
+# define BFI_FMACHINE_LADDER_18 BFI_FMACHINE_LADDER_17(17)
+# define BFI_FMACHINE_LADDER_19 BFI_FMACHINE_LADDER_18(18)
+# define BFI_FMACHINE_LADDER_20 BFI_FMACHINE_LADDER_19(19)
+# define BFI_FMACHINE_LADDER_21 BFI_FMACHINE_LADDER_20(20)
+# define BFI_FMACHINE_LADDER_22 BFI_FMACHINE_LADDER_21(21)
+# define BFI_FMACHINE_LADDER_23 BFI_FMACHINE_LADDER_22(22)
+# define BFI_FMACHINE_LADDER_24 BFI_FMACHINE_LADDER_23(23)
+# define BFI_FMACHINE_LADDER_25 BFI_FMACHINE_LADDER_24(24)
+# define BFI_FMACHINE_LADDER_26 BFI_FMACHINE_LADDER_25(25)
+# define BFI_FMACHINE_LADDER_27 BFI_FMACHINE_LADDER_26(26)
+# define BFI_FMACHINE_LADDER_28 BFI_FMACHINE_LADDER_27(27)
+# define BFI_FMACHINE_LADDER_29 BFI_FMACHINE_LADDER_28(28)
+# define BFI_FMACHINE_LADDER_30 BFI_FMACHINE_LADDER_29(29)
+# define BFI_FMACHINE_LADDER_31 BFI_FMACHINE_LADDER_30(30)
+# define BFI_FMACHINE_LADDER_32 BFI_FMACHINE_LADDER_31(31)
+# define BFI_FMACHINE_LADDER_33 BFI_FMACHINE_LADDER_32(32)
+# define BFI_FMACHINE_LADDER_34 BFI_FMACHINE_LADDER_33(33)
+# define BFI_FMACHINE_LADDER_35 BFI_FMACHINE_LADDER_34(34)
+# define BFI_FMACHINE_LADDER_36 BFI_FMACHINE_LADDER_35(35)
+# define BFI_FMACHINE_LADDER_37 BFI_FMACHINE_LADDER_36(36)
+# define BFI_FMACHINE_LADDER_38 BFI_FMACHINE_LADDER_37(37)
+# define BFI_FMACHINE_LADDER_39 BFI_FMACHINE_LADDER_38(38)
+# define BFI_FMACHINE_LADDER_40 BFI_FMACHINE_LADDER_39(39)
+# define BFI_FMACHINE_HALVE_1 (0)(0)
+# define BFI_FMACHINE_HALVE_2 (1)(1)
+# define BFI_FMACHINE_HALVE_3 (2)(2)
+# define BFI_FMACHINE_HALVE_4 (3)(3)
+# define BFI_FMACHINE_HALVE_5 (4)(4)
+# define BFI_FMACHINE_HALVE_6 (5)(5)
+# define BFI_FMACHINE_HALVE_7 (6)(6)
+# define BFI_FMACHINE_HALVE_8 (7)(7)
+# define BFI_FMACHINE_HALVE_9 (8)(8)
+# define BFI_FMACHINE_HALVE_10 (9)(9)
+# define BFI_FMACHINE_HALVE_11 (10)(10)
+# define BFI_FMACHINE_HALVE_12 (11)(11)
+# define BFI_FMACHINE_HALVE_13 (12)(12)
+# define BFI_FMACHINE_HALVE_14 (13)(13)
+# define BFI_FMACHINE_HALVE_15 (14)(14)
+# define BFI_FMACHINE_HALVE_16 (15)(15)
+# define BFI_FMACHINE_HALVE_17 (16)(16)
+# define BFI_FMACHINE_HALVE_18 (17)(17)
+# define BFI_FMACHINE_HALVE_19 (18)(18)
+# define BFI_FMACHINE_HALVE_20 (19)(19)
+# define BFI_FMACHINE_HALVE_21 (20)(20)
+# define BFI_FMACHINE_HALVE_22 (21)(21)
+# define BFI_FMACHINE_HALVE_23 (22)(22)
+# define BFI_FMACHINE_HALVE_24 (23)(23)
+# define BFI_FMACHINE_HALVE_25 (24)(24)
+# define BFI_FMACHINE_HALVE_26 (25)(25)
+# define BFI_FMACHINE_HALVE_27 (26)(26)
+# define BFI_FMACHINE_HALVE_28 (27)(27)
+# define BFI_FMACHINE_HALVE_29 (28)(28)
+# define BFI_FMACHINE_HALVE_30 (29)(29)
+# define BFI_FMACHINE_HALVE_31 (30)(30)
+# define BFI_FMACHINE_HALVE_32 (31)(31)
+# define BFI_FMACHINE_HALVE_33 (32)(32)
+# define BFI_FMACHINE_HALVE_34 (33)(33)
+# define BFI_FMACHINE_HALVE_35 (34)(34)
+# define BFI_FMACHINE_HALVE_36 (35)(35)
+# define BFI_FMACHINE_HALVE_37 (36)(36)
+# define BFI_FMACHINE_HALVE_38 (37)(37)
+# define BFI_FMACHINE_HALVE_39 (38)(38)
+
+# define BFI_FMACHINE0_O(v, f, d) BFI_LEFT(BFI_FMACHINE0_R(BFI_FMACHINE_START_K(0, v, f, d)))()
+# define BFI_FMACHINE0_V(v, f, d) BFI_RIGHT(BFI_FMACHINE0_R(BFI_FMACHINE_START_K(0, v, f, d)))
+# define BFI_FMACHINE0_R(z) BFI_FMACHINE_END(BFI_FCM0_OUTER_C_0(z))
+
+# define BFI_FCM0_OUTER_C_0(z) BFI_FCM0_OUTER_I_0(BFI_FCM0_INNER_C_0(z))
+# if BFI_MACHINE_LEVELS > 1
+# define BFI_FCM0_OUTER_C_1(z) BFI_FCM0_OUTER_I_1(BFI_FCM0_INNER_C_1(z))
+# else
+# define BFI_FCM0_OUTER_C_1(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 2
+# define BFI_FCM0_OUTER_C_2(z) BFI_FCM0_OUTER_I_2(BFI_FCM0_INNER_C_2(z))
+# else
+# define BFI_FCM0_OUTER_C_2(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 3
+# define BFI_FCM0_OUTER_C_3(z) BFI_FCM0_OUTER_I_3(BFI_FCM0_INNER_C_3(z))
+# else
+# define BFI_FCM0_OUTER_C_3(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 4
+# define BFI_FCM0_OUTER_C_4(z) BFI_FCM0_OUTER_I_4(BFI_FCM0_INNER_C_4(z))
+# else
+# define BFI_FCM0_OUTER_C_4(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 5
+# define BFI_FCM0_OUTER_C_5(z) BFI_FCM0_OUTER_I_5(BFI_FCM0_INNER_C_5(z))
+# else
+# define BFI_FCM0_OUTER_C_5(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 6
+# define BFI_FCM0_OUTER_C_6(z) BFI_FCM0_OUTER_I_6(BFI_FCM0_INNER_C_6(z))
+# else
+# define BFI_FCM0_OUTER_C_6(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 7
+# define BFI_FCM0_OUTER_C_7(z) BFI_FCM0_OUTER_I_7(BFI_FCM0_INNER_C_7(z))
+# else
+# define BFI_FCM0_OUTER_C_7(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 8
+# define BFI_FCM0_OUTER_C_8(z) BFI_FCM0_OUTER_I_8(BFI_FCM0_INNER_C_8(z))
+# else
+# define BFI_FCM0_OUTER_C_8(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 9
+# define BFI_FCM0_OUTER_C_9(z) BFI_FCM0_OUTER_I_9(BFI_FCM0_INNER_C_9(z))
+# else
+# define BFI_FCM0_OUTER_C_9(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 10
+# define BFI_FCM0_OUTER_C_10(z) BFI_FCM0_OUTER_I_10(BFI_FCM0_INNER_C_10(z))
+# else
+# define BFI_FCM0_OUTER_C_10(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 11
+# define BFI_FCM0_OUTER_C_11(z) BFI_FCM0_OUTER_I_11(BFI_FCM0_INNER_C_11(z))
+# else
+# define BFI_FCM0_OUTER_C_11(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 12
+# define BFI_FCM0_OUTER_C_12(z) BFI_FCM0_OUTER_I_12(BFI_FCM0_INNER_C_12(z))
+# else
+# define BFI_FCM0_OUTER_C_12(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 13
+# define BFI_FCM0_OUTER_C_13(z) BFI_FCM0_OUTER_I_13(BFI_FCM0_INNER_C_13(z))
+# else
+# define BFI_FCM0_OUTER_C_13(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 14
+# define BFI_FCM0_OUTER_C_14(z) BFI_FCM0_OUTER_I_14(BFI_FCM0_INNER_C_14(z))
+# else
+# define BFI_FCM0_OUTER_C_14(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 15
+# define BFI_FCM0_OUTER_C_15(z) BFI_FCM0_OUTER_I_15(BFI_FCM0_INNER_C_15(z))
+# else
+# define BFI_FCM0_OUTER_C_15(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 16
+# define BFI_FCM0_OUTER_C_16(z) BFI_FCM0_OUTER_I_16(BFI_FCM0_INNER_C_16(z))
+# else
+# define BFI_FCM0_OUTER_C_16(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 17
+# define BFI_FCM0_OUTER_C_17(z) BFI_FCM0_OUTER_I_17(BFI_FCM0_INNER_C_17(z))
+# else
+# define BFI_FCM0_OUTER_C_17(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 18
+# define BFI_FCM0_OUTER_C_18(z) BFI_FCM0_OUTER_I_18(BFI_FCM0_INNER_C_18(z))
+# else
+# define BFI_FCM0_OUTER_C_18(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 19
+# define BFI_FCM0_OUTER_C_19(z) BFI_FCM0_OUTER_I_19(BFI_FCM0_INNER_C_19(z))
+# else
+# define BFI_FCM0_OUTER_C_19(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 20
+# define BFI_FCM0_OUTER_C_20(z) BFI_FCM0_OUTER_I_20(BFI_FCM0_INNER_C_20(z))
+# else
+# define BFI_FCM0_OUTER_C_20(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 21
+# define BFI_FCM0_OUTER_C_21(z) BFI_FCM0_OUTER_I_21(BFI_FCM0_INNER_C_21(z))
+# else
+# define BFI_FCM0_OUTER_C_21(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 22
+# define BFI_FCM0_OUTER_C_22(z) BFI_FCM0_OUTER_I_22(BFI_FCM0_INNER_C_22(z))
+# else
+# define BFI_FCM0_OUTER_C_22(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 23
+# define BFI_FCM0_OUTER_C_23(z) BFI_FCM0_OUTER_I_23(BFI_FCM0_INNER_C_23(z))
+# else
+# define BFI_FCM0_OUTER_C_23(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 24
+# define BFI_FCM0_OUTER_C_24(z) BFI_FCM0_OUTER_I_24(BFI_FCM0_INNER_C_24(z))
+# else
+# define BFI_FCM0_OUTER_C_24(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 25
+# define BFI_FCM0_OUTER_C_25(z) BFI_FCM0_OUTER_I_25(BFI_FCM0_INNER_C_25(z))
+# else
+# define BFI_FCM0_OUTER_C_25(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 26
+# define BFI_FCM0_OUTER_C_26(z) BFI_FCM0_OUTER_I_26(BFI_FCM0_INNER_C_26(z))
+# else
+# define BFI_FCM0_OUTER_C_26(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 27
+# define BFI_FCM0_OUTER_C_27(z) BFI_FCM0_OUTER_I_27(BFI_FCM0_INNER_C_27(z))
+# else
+# define BFI_FCM0_OUTER_C_27(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 28
+# define BFI_FCM0_OUTER_C_28(z) BFI_FCM0_OUTER_I_28(BFI_FCM0_INNER_C_28(z))
+# else
+# define BFI_FCM0_OUTER_C_28(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 29
+# define BFI_FCM0_OUTER_C_29(z) BFI_FCM0_OUTER_I_29(BFI_FCM0_INNER_C_29(z))
+# else
+# define BFI_FCM0_OUTER_C_29(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 30
+# define BFI_FCM0_OUTER_C_30(z) BFI_FCM0_OUTER_I_30(BFI_FCM0_INNER_C_30(z))
+# else
+# define BFI_FCM0_OUTER_C_30(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 31
+# define BFI_FCM0_OUTER_C_31(z) BFI_FCM0_OUTER_I_31(BFI_FCM0_INNER_C_31(z))
+# else
+# define BFI_FCM0_OUTER_C_31(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 32
+# define BFI_FCM0_OUTER_C_32(z) BFI_FCM0_OUTER_I_32(BFI_FCM0_INNER_C_32(z))
+# else
+# define BFI_FCM0_OUTER_C_32(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 33
+# define BFI_FCM0_OUTER_C_33(z) BFI_FCM0_OUTER_I_33(BFI_FCM0_INNER_C_33(z))
+# else
+# define BFI_FCM0_OUTER_C_33(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 34
+# define BFI_FCM0_OUTER_C_34(z) BFI_FCM0_OUTER_I_34(BFI_FCM0_INNER_C_34(z))
+# else
+# define BFI_FCM0_OUTER_C_34(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 35
+# define BFI_FCM0_OUTER_C_35(z) BFI_FCM0_OUTER_I_35(BFI_FCM0_INNER_C_35(z))
+# else
+# define BFI_FCM0_OUTER_C_35(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 36
+# define BFI_FCM0_OUTER_C_36(z) BFI_FCM0_OUTER_I_36(BFI_FCM0_INNER_C_36(z))
+# else
+# define BFI_FCM0_OUTER_C_36(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 37
+# define BFI_FCM0_OUTER_C_37(z) BFI_FCM0_OUTER_I_37(BFI_FCM0_INNER_C_37(z))
+# else
+# define BFI_FCM0_OUTER_C_37(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 38
+# define BFI_FCM0_OUTER_C_38(z) BFI_FCM0_OUTER_I_38(BFI_FCM0_INNER_C_38(z))
+# else
+# define BFI_FCM0_OUTER_C_38(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 39
+# define BFI_FCM0_OUTER_C_39(z) BFI_FCM0_OUTER_I_39(BFI_FCM0_INNER_C_39(z))
+# else
+# define BFI_FCM0_OUTER_C_39(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# define BFI_FCM0_OUTER_C_40(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+
+# define BFI_FCM0_INNER_C_0(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_0)
+# define BFI_FCM0_INNER_C_1(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_1)
+# define BFI_FCM0_INNER_C_2(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_2)
+# define BFI_FCM0_INNER_C_3(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_3)
+# define BFI_FCM0_INNER_C_4(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_4)
+# define BFI_FCM0_INNER_C_5(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_5)
+# define BFI_FCM0_INNER_C_6(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_6)
+# define BFI_FCM0_INNER_C_7(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_7)
+# define BFI_FCM0_INNER_C_8(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_8)
+# define BFI_FCM0_INNER_C_9(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_9)
+# define BFI_FCM0_INNER_C_10(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_10)
+# define BFI_FCM0_INNER_C_11(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_11)
+# define BFI_FCM0_INNER_C_12(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_12)
+# define BFI_FCM0_INNER_C_13(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_13)
+# define BFI_FCM0_INNER_C_14(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_14)
+# define BFI_FCM0_INNER_C_15(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_15)
+# define BFI_FCM0_INNER_C_16(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_16)
+# define BFI_FCM0_INNER_C_17(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_17)
+# define BFI_FCM0_INNER_C_18(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_18)
+# define BFI_FCM0_INNER_C_19(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_19)
+# define BFI_FCM0_INNER_C_20(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_20)
+# define BFI_FCM0_INNER_C_21(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_21)
+# define BFI_FCM0_INNER_C_22(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_22)
+# define BFI_FCM0_INNER_C_23(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_23)
+# define BFI_FCM0_INNER_C_24(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_24)
+# define BFI_FCM0_INNER_C_25(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_25)
+# define BFI_FCM0_INNER_C_26(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_26)
+# define BFI_FCM0_INNER_C_27(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_27)
+# define BFI_FCM0_INNER_C_28(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_28)
+# define BFI_FCM0_INNER_C_29(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_29)
+# define BFI_FCM0_INNER_C_30(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_30)
+# define BFI_FCM0_INNER_C_31(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_31)
+# define BFI_FCM0_INNER_C_32(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_32)
+# define BFI_FCM0_INNER_C_33(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_33)
+# define BFI_FCM0_INNER_C_34(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_34)
+# define BFI_FCM0_INNER_C_35(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_35)
+# define BFI_FCM0_INNER_C_36(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_36)
+# define BFI_FCM0_INNER_C_37(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_37)
+# define BFI_FCM0_INNER_C_38(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_38)
+# define BFI_FCM0_INNER_C_39(z) BFI_FCM0_RUN(z, BFI_FMACHINE_FUEL_39)
+
+# define BFI_FCM0_RUN(z, f) BFI_FCM0_STEP_A(z f,0)
+# define BFI_FCM0_STEP_A(z, e) BFI_FCM0_GO_A(e, BFI_ENTER_LINEAR0(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM0_GO_A(e, x) BFI_FMACHINE_FEED(BFI_FCM0_STEP_B, e, x
+# define BFI_FCM0_STEP_B(z, e) BFI_FCM0_GO_B(e, BFI_ENTER_LINEAR0(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM0_GO_B(e, x) BFI_FMACHINE_FEED(BFI_FCM0_STEP_A, e, x
+
+# define BFI_FCM0_STEP_A_REFILL_2(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_2(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_3(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_3(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_4(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_4(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_5(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_5(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_6(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_6(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_7(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_7(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_8(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_8(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_9(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_9(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_10(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_10(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_11(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_11(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_12(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_12(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_13(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_13(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_14(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_14(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_15(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_15(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_16(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_16(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_17(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_17(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_18(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_18(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_19(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_19(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_20(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_20(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_21(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_21(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_22(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_22(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_23(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_23(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_24(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_24(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_25(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_25(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_26(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_26(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_27(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_27(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_28(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_28(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_29(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_29(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_30(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_30(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_31(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_31(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_32(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_32(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_33(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_33(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_34(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_34(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_35(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_35(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_36(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_36(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_37(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_37(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_38(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_38(f, z, e) BFI_FCM0_STEP_B(z f,e)
+# define BFI_FCM0_STEP_A_REFILL_39(f, z, e) BFI_FCM0_STEP_A(z f,e)
+# define BFI_FCM0_STEP_B_REFILL_39(f, z, e) BFI_FCM0_STEP_B(z f,e)
+
+# define BFI_FCM0_OUTER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_1, x)
+# define BFI_FCM0_OUTER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_2, x)
+# define BFI_FCM0_OUTER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_3, x)
+# define BFI_FCM0_OUTER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_4, x)
+# define BFI_FCM0_OUTER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_5, x)
+# define BFI_FCM0_OUTER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_6, x)
+# define BFI_FCM0_OUTER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_7, x)
+# define BFI_FCM0_OUTER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_8, x)
+# define BFI_FCM0_OUTER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_9, x)
+# define BFI_FCM0_OUTER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_10, x)
+# define BFI_FCM0_OUTER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_11, x)
+# define BFI_FCM0_OUTER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_12, x)
+# define BFI_FCM0_OUTER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_13, x)
+# define BFI_FCM0_OUTER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_14, x)
+# define BFI_FCM0_OUTER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_15, x)
+# define BFI_FCM0_OUTER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_16, x)
+# define BFI_FCM0_OUTER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_17, x)
+# define BFI_FCM0_OUTER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_18, x)
+# define BFI_FCM0_OUTER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_19, x)
+# define BFI_FCM0_OUTER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_20, x)
+# define BFI_FCM0_OUTER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_21, x)
+# define BFI_FCM0_OUTER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_22, x)
+# define BFI_FCM0_OUTER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_23, x)
+# define BFI_FCM0_OUTER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_24, x)
+# define BFI_FCM0_OUTER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_25, x)
+# define BFI_FCM0_OUTER_I_25(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_26, x)
+# define BFI_FCM0_OUTER_I_26(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_27, x)
+# define BFI_FCM0_OUTER_I_27(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_28, x)
+# define BFI_FCM0_OUTER_I_28(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_29, x)
+# define BFI_FCM0_OUTER_I_29(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_30, x)
+# define BFI_FCM0_OUTER_I_30(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_31, x)
+# define BFI_FCM0_OUTER_I_31(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_32, x)
+# define BFI_FCM0_OUTER_I_32(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_33, x)
+# define BFI_FCM0_OUTER_I_33(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_34, x)
+# define BFI_FCM0_OUTER_I_34(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_35, x)
+# define BFI_FCM0_OUTER_I_35(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_36, x)
+# define BFI_FCM0_OUTER_I_36(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_37, x)
+# define BFI_FCM0_OUTER_I_37(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_38, x)
+# define BFI_FCM0_OUTER_I_38(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_39, x)
+# define BFI_FCM0_OUTER_I_39(x) BFI_FMACHINE_RESUME(BFI_FCM0_OUTER_C_40, x)
+
+# if BFI_MACHINE_FAMILIES > 1
+# define BFI_FMACHINE1_O(v, f, d) BFI_LEFT(BFI_FMACHINE1_R(BFI_FMACHINE_START_K(1, v, f, d)))()
+# define BFI_FMACHINE1_V(v, f, d) BFI_RIGHT(BFI_FMACHINE1_R(BFI_FMACHINE_START_K(1, v, f, d)))
+# define BFI_FMACHINE1_R(z) BFI_FMACHINE_END(BFI_FCM1_OUTER_C_0(z))
+
+# define BFI_FCM1_OUTER_C_0(z) BFI_FCM1_OUTER_I_0(BFI_FCM1_INNER_C_0(z))
+# if BFI_MACHINE_LEVELS > 1
+# define BFI_FCM1_OUTER_C_1(z) BFI_FCM1_OUTER_I_1(BFI_FCM1_INNER_C_1(z))
+# else
+# define BFI_FCM1_OUTER_C_1(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 2
+# define BFI_FCM1_OUTER_C_2(z) BFI_FCM1_OUTER_I_2(BFI_FCM1_INNER_C_2(z))
+# else
+# define BFI_FCM1_OUTER_C_2(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 3
+# define BFI_FCM1_OUTER_C_3(z) BFI_FCM1_OUTER_I_3(BFI_FCM1_INNER_C_3(z))
+# else
+# define BFI_FCM1_OUTER_C_3(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 4
+# define BFI_FCM1_OUTER_C_4(z) BFI_FCM1_OUTER_I_4(BFI_FCM1_INNER_C_4(z))
+# else
+# define BFI_FCM1_OUTER_C_4(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 5
+# define BFI_FCM1_OUTER_C_5(z) BFI_FCM1_OUTER_I_5(BFI_FCM1_INNER_C_5(z))
+# else
+# define BFI_FCM1_OUTER_C_5(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 6
+# define BFI_FCM1_OUTER_C_6(z) BFI_FCM1_OUTER_I_6(BFI_FCM1_INNER_C_6(z))
+# else
+# define BFI_FCM1_OUTER_C_6(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 7
+# define BFI_FCM1_OUTER_C_7(z) BFI_FCM1_OUTER_I_7(BFI_FCM1_INNER_C_7(z))
+# else
+# define BFI_FCM1_OUTER_C_7(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 8
+# define BFI_FCM1_OUTER_C_8(z) BFI_FCM1_OUTER_I_8(BFI_FCM1_INNER_C_8(z))
+# else
+# define BFI_FCM1_OUTER_C_8(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 9
+# define BFI_FCM1_OUTER_C_9(z) BFI_FCM1_OUTER_I_9(BFI_FCM1_INNER_C_9(z))
+# else
+# define BFI_FCM1_OUTER_C_9(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 10
+# define BFI_FCM1_OUTER_C_10(z) BFI_FCM1_OUTER_I_10(BFI_FCM1_INNER_C_10(z))
+# else
+# define BFI_FCM1_OUTER_C_10(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 11
+# define BFI_FCM1_OUTER_C_11(z) BFI_FCM1_OUTER_I_11(BFI_FCM1_INNER_C_11(z))
+# else
+# define BFI_FCM1_OUTER_C_11(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 12
+# define BFI_FCM1_OUTER_C_12(z) BFI_FCM1_OUTER_I_12(BFI_FCM1_INNER_C_12(z))
+# else
+# define BFI_FCM1_OUTER_C_12(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 13
+# define BFI_FCM1_OUTER_C_13(z) BFI_FCM1_OUTER_I_13(BFI_FCM1_INNER_C_13(z))
+# else
+# define BFI_FCM1_OUTER_C_13(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 14
+# define BFI_FCM1_OUTER_C_14(z) BFI_FCM1_OUTER_I_14(BFI_FCM1_INNER_C_14(z))
+# else
+# define BFI_FCM1_OUTER_C_14(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 15
+# define BFI_FCM1_OUTER_C_15(z) BFI_FCM1_OUTER_I_15(BFI_FCM1_INNER_C_15(z))
+# else
+# define BFI_FCM1_OUTER_C_15(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 16
+# define BFI_FCM1_OUTER_C_16(z) BFI_FCM1_OUTER_I_16(BFI_FCM1_INNER_C_16(z))
+# else
+# define BFI_FCM1_OUTER_C_16(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 17
+# define BFI_FCM1_OUTER_C_17(z) BFI_FCM1_OUTER_I_17(BFI_FCM1_INNER_C_17(z))
+# else
+# define BFI_FCM1_OUTER_C_17(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 18
+# define BFI_FCM1_OUTER_C_18(z) BFI_FCM1_OUTER_I_18(BFI_FCM1_INNER_C_18(z))
+# else
+# define BFI_FCM1_OUTER_C_18(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 19
+# define BFI_FCM1_OUTER_C_19(z) BFI_FCM1_OUTER_I_19(BFI_FCM1_INNER_C_19(z))
+# else
+# define BFI_FCM1_OUTER_C_19(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 20
+# define BFI_FCM1_OUTER_C_20(z) BFI_FCM1_OUTER_I_20(BFI_FCM1_INNER_C_20(z))
+# else
+# define BFI_FCM1_OUTER_C_20(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 21
+# define BFI_FCM1_OUTER_C_21(z) BFI_FCM1_OUTER_I_21(BFI_FCM1_INNER_C_21(z))
+# else
+# define BFI_FCM1_OUTER_C_21(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 22
+# define BFI_FCM1_OUTER_C_22(z) BFI_FCM1_OUTER_I_22(BFI_FCM1_INNER_C_22(z))
+# else
+# define BFI_FCM1_OUTER_C_22(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 23
+# define BFI_FCM1_OUTER_C_23(z) BFI_FCM1_OUTER_I_23(BFI_FCM1_INNER_C_23(z))
+# else
+# define BFI_FCM1_OUTER_C_23(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 24
+# define BFI_FCM1_OUTER_C_24(z) BFI_FCM1_OUTER_I_24(BFI_FCM1_INNER_C_24(z))
+# else
+# define BFI_FCM1_OUTER_C_24(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 25
+# define BFI_FCM1_OUTER_C_25(z) BFI_FCM1_OUTER_I_25(BFI_FCM1_INNER_C_25(z))
+# else
+# define BFI_FCM1_OUTER_C_25(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 26
+# define BFI_FCM1_OUTER_C_26(z) BFI_FCM1_OUTER_I_26(BFI_FCM1_INNER_C_26(z))
+# else
+# define BFI_FCM1_OUTER_C_26(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 27
+# define BFI_FCM1_OUTER_C_27(z) BFI_FCM1_OUTER_I_27(BFI_FCM1_INNER_C_27(z))
+# else
+# define BFI_FCM1_OUTER_C_27(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 28
+# define BFI_FCM1_OUTER_C_28(z) BFI_FCM1_OUTER_I_28(BFI_FCM1_INNER_C_28(z))
+# else
+# define BFI_FCM1_OUTER_C_28(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 29
+# define BFI_FCM1_OUTER_C_29(z) BFI_FCM1_OUTER_I_29(BFI_FCM1_INNER_C_29(z))
+# else
+# define BFI_FCM1_OUTER_C_29(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 30
+# define BFI_FCM1_OUTER_C_30(z) BFI_FCM1_OUTER_I_30(BFI_FCM1_INNER_C_30(z))
+# else
+# define BFI_FCM1_OUTER_C_30(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 31
+# define BFI_FCM1_OUTER_C_31(z) BFI_FCM1_OUTER_I_31(BFI_FCM1_INNER_C_31(z))
+# else
+# define BFI_FCM1_OUTER_C_31(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 32
+# define BFI_FCM1_OUTER_C_32(z) BFI_FCM1_OUTER_I_32(BFI_FCM1_INNER_C_32(z))
+# else
+# define BFI_FCM1_OUTER_C_32(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 33
+# define BFI_FCM1_OUTER_C_33(z) BFI_FCM1_OUTER_I_33(BFI_FCM1_INNER_C_33(z))
+# else
+# define BFI_FCM1_OUTER_C_33(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 34
+# define BFI_FCM1_OUTER_C_34(z) BFI_FCM1_OUTER_I_34(BFI_FCM1_INNER_C_34(z))
+# else
+# define BFI_FCM1_OUTER_C_34(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 35
+# define BFI_FCM1_OUTER_C_35(z) BFI_FCM1_OUTER_I_35(BFI_FCM1_INNER_C_35(z))
+# else
+# define BFI_FCM1_OUTER_C_35(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 36
+# define BFI_FCM1_OUTER_C_36(z) BFI_FCM1_OUTER_I_36(BFI_FCM1_INNER_C_36(z))
+# else
+# define BFI_FCM1_OUTER_C_36(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 37
+# define BFI_FCM1_OUTER_C_37(z) BFI_FCM1_OUTER_I_37(BFI_FCM1_INNER_C_37(z))
+# else
+# define BFI_FCM1_OUTER_C_37(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 38
+# define BFI_FCM1_OUTER_C_38(z) BFI_FCM1_OUTER_I_38(BFI_FCM1_INNER_C_38(z))
+# else
+# define BFI_FCM1_OUTER_C_38(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 39
+# define BFI_FCM1_OUTER_C_39(z) BFI_FCM1_OUTER_I_39(BFI_FCM1_INNER_C_39(z))
+# else
+# define BFI_FCM1_OUTER_C_39(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# define BFI_FCM1_OUTER_C_40(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+
+# define BFI_FCM1_INNER_C_0(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_0)
+# define BFI_FCM1_INNER_C_1(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_1)
+# define BFI_FCM1_INNER_C_2(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_2)
+# define BFI_FCM1_INNER_C_3(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_3)
+# define BFI_FCM1_INNER_C_4(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_4)
+# define BFI_FCM1_INNER_C_5(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_5)
+# define BFI_FCM1_INNER_C_6(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_6)
+# define BFI_FCM1_INNER_C_7(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_7)
+# define BFI_FCM1_INNER_C_8(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_8)
+# define BFI_FCM1_INNER_C_9(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_9)
+# define BFI_FCM1_INNER_C_10(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_10)
+# define BFI_FCM1_INNER_C_11(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_11)
+# define BFI_FCM1_INNER_C_12(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_12)
+# define BFI_FCM1_INNER_C_13(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_13)
+# define BFI_FCM1_INNER_C_14(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_14)
+# define BFI_FCM1_INNER_C_15(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_15)
+# define BFI_FCM1_INNER_C_16(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_16)
+# define BFI_FCM1_INNER_C_17(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_17)
+# define BFI_FCM1_INNER_C_18(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_18)
+# define BFI_FCM1_INNER_C_19(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_19)
+# define BFI_FCM1_INNER_C_20(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_20)
+# define BFI_FCM1_INNER_C_21(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_21)
+# define BFI_FCM1_INNER_C_22(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_22)
+# define BFI_FCM1_INNER_C_23(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_23)
+# define BFI_FCM1_INNER_C_24(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_24)
+# define BFI_FCM1_INNER_C_25(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_25)
+# define BFI_FCM1_INNER_C_26(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_26)
+# define BFI_FCM1_INNER_C_27(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_27)
+# define BFI_FCM1_INNER_C_28(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_28)
+# define BFI_FCM1_INNER_C_29(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_29)
+# define BFI_FCM1_INNER_C_30(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_30)
+# define BFI_FCM1_INNER_C_31(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_31)
+# define BFI_FCM1_INNER_C_32(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_32)
+# define BFI_FCM1_INNER_C_33(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_33)
+# define BFI_FCM1_INNER_C_34(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_34)
+# define BFI_FCM1_INNER_C_35(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_35)
+# define BFI_FCM1_INNER_C_36(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_36)
+# define BFI_FCM1_INNER_C_37(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_37)
+# define BFI_FCM1_INNER_C_38(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_38)
+# define BFI_FCM1_INNER_C_39(z) BFI_FCM1_RUN(z, BFI_FMACHINE_FUEL_39)
+
+# define BFI_FCM1_RUN(z, f) BFI_FCM1_STEP_A(z f,0)
+# define BFI_FCM1_STEP_A(z, e) BFI_FCM1_GO_A(e, BFI_ENTER_LINEAR1(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM1_GO_A(e, x) BFI_FMACHINE_FEED(BFI_FCM1_STEP_B, e, x
+# define BFI_FCM1_STEP_B(z, e) BFI_FCM1_GO_B(e, BFI_ENTER_LINEAR1(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM1_GO_B(e, x) BFI_FMACHINE_FEED(BFI_FCM1_STEP_A, e, x
+
+# define BFI_FCM1_STEP_A_REFILL_2(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_2(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_3(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_3(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_4(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_4(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_5(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_5(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_6(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_6(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_7(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_7(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_8(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_8(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_9(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_9(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_10(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_10(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_11(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_11(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_12(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_12(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_13(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_13(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_14(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_14(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_15(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_15(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_16(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_16(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_17(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_17(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_18(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_18(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_19(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_19(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_20(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_20(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_21(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_21(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_22(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_22(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_23(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_23(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_24(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_24(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_25(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_25(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_26(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_26(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_27(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_27(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_28(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_28(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_29(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_29(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_30(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_30(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_31(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_31(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_32(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_32(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_33(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_33(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_34(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_34(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_35(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_35(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_36(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_36(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_37(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_37(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_38(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_38(f, z, e) BFI_FCM1_STEP_B(z f,e)
+# define BFI_FCM1_STEP_A_REFILL_39(f, z, e) BFI_FCM1_STEP_A(z f,e)
+# define BFI_FCM1_STEP_B_REFILL_39(f, z, e) BFI_FCM1_STEP_B(z f,e)
+
+# define BFI_FCM1_OUTER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_1, x)
+# define BFI_FCM1_OUTER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_2, x)
+# define BFI_FCM1_OUTER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_3, x)
+# define BFI_FCM1_OUTER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_4, x)
+# define BFI_FCM1_OUTER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_5, x)
+# define BFI_FCM1_OUTER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_6, x)
+# define BFI_FCM1_OUTER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_7, x)
+# define BFI_FCM1_OUTER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_8, x)
+# define BFI_FCM1_OUTER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_9, x)
+# define BFI_FCM1_OUTER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_10, x)
+# define BFI_FCM1_OUTER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_11, x)
+# define BFI_FCM1_OUTER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_12, x)
+# define BFI_FCM1_OUTER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_13, x)
+# define BFI_FCM1_OUTER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_14, x)
+# define BFI_FCM1_OUTER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_15, x)
+# define BFI_FCM1_OUTER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_16, x)
+# define BFI_FCM1_OUTER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_17, x)
+# define BFI_FCM1_OUTER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_18, x)
+# define BFI_FCM1_OUTER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_19, x)
+# define BFI_FCM1_OUTER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_20, x)
+# define BFI_FCM1_OUTER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_21, x)
+# define BFI_FCM1_OUTER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_22, x)
+# define BFI_FCM1_OUTER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_23, x)
+# define BFI_FCM1_OUTER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_24, x)
+# define BFI_FCM1_OUTER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_25, x)
+# define BFI_FCM1_OUTER_I_25(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_26, x)
+# define BFI_FCM1_OUTER_I_26(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_27, x)
+# define BFI_FCM1_OUTER_I_27(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_28, x)
+# define BFI_FCM1_OUTER_I_28(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_29, x)
+# define BFI_FCM1_OUTER_I_29(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_30, x)
+# define BFI_FCM1_OUTER_I_30(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_31, x)
+# define BFI_FCM1_OUTER_I_31(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_32, x)
+# define BFI_FCM1_OUTER_I_32(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_33, x)
+# define BFI_FCM1_OUTER_I_33(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_34, x)
+# define BFI_FCM1_OUTER_I_34(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_35, x)
+# define BFI_FCM1_OUTER_I_35(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_36, x)
+# define BFI_FCM1_OUTER_I_36(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_37, x)
+# define BFI_FCM1_OUTER_I_37(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_38, x)
+# define BFI_FCM1_OUTER_I_38(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_39, x)
+# define BFI_FCM1_OUTER_I_39(x) BFI_FMACHINE_RESUME(BFI_FCM1_OUTER_C_40, x)
+# endif
+
+# if BFI_MACHINE_FAMILIES > 2
+# define BFI_FMACHINE2_O(v, f, d) BFI_LEFT(BFI_FMACHINE2_R(BFI_FMACHINE_START_K(2, v, f, d)))()
+# define BFI_FMACHINE2_V(v, f, d) BFI_RIGHT(BFI_FMACHINE2_R(BFI_FMACHINE_START_K(2, v, f, d)))
+# define BFI_FMACHINE2_R(z) BFI_FMACHINE_END(BFI_FCM2_OUTER_C_0(z))
+
+# define BFI_FCM2_OUTER_C_0(z) BFI_FCM2_OUTER_I_0(BFI_FCM2_INNER_C_0(z))
+# if BFI_MACHINE_LEVELS > 1
+# define BFI_FCM2_OUTER_C_1(z) BFI_FCM2_OUTER_I_1(BFI_FCM2_INNER_C_1(z))
+# else
+# define BFI_FCM2_OUTER_C_1(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 2
+# define BFI_FCM2_OUTER_C_2(z) BFI_FCM2_OUTER_I_2(BFI_FCM2_INNER_C_2(z))
+# else
+# define BFI_FCM2_OUTER_C_2(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 3
+# define BFI_FCM2_OUTER_C_3(z) BFI_FCM2_OUTER_I_3(BFI_FCM2_INNER_C_3(z))
+# else
+# define BFI_FCM2_OUTER_C_3(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 4
+# define BFI_FCM2_OUTER_C_4(z) BFI_FCM2_OUTER_I_4(BFI_FCM2_INNER_C_4(z))
+# else
+# define BFI_FCM2_OUTER_C_4(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 5
+# define BFI_FCM2_OUTER_C_5(z) BFI_FCM2_OUTER_I_5(BFI_FCM2_INNER_C_5(z))
+# else
+# define BFI_FCM2_OUTER_C_5(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 6
+# define BFI_FCM2_OUTER_C_6(z) BFI_FCM2_OUTER_I_6(BFI_FCM2_INNER_C_6(z))
+# else
+# define BFI_FCM2_OUTER_C_6(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 7
+# define BFI_FCM2_OUTER_C_7(z) BFI_FCM2_OUTER_I_7(BFI_FCM2_INNER_C_7(z))
+# else
+# define BFI_FCM2_OUTER_C_7(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 8
+# define BFI_FCM2_OUTER_C_8(z) BFI_FCM2_OUTER_I_8(BFI_FCM2_INNER_C_8(z))
+# else
+# define BFI_FCM2_OUTER_C_8(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 9
+# define BFI_FCM2_OUTER_C_9(z) BFI_FCM2_OUTER_I_9(BFI_FCM2_INNER_C_9(z))
+# else
+# define BFI_FCM2_OUTER_C_9(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 10
+# define BFI_FCM2_OUTER_C_10(z) BFI_FCM2_OUTER_I_10(BFI_FCM2_INNER_C_10(z))
+# else
+# define BFI_FCM2_OUTER_C_10(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 11
+# define BFI_FCM2_OUTER_C_11(z) BFI_FCM2_OUTER_I_11(BFI_FCM2_INNER_C_11(z))
+# else
+# define BFI_FCM2_OUTER_C_11(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 12
+# define BFI_FCM2_OUTER_C_12(z) BFI_FCM2_OUTER_I_12(BFI_FCM2_INNER_C_12(z))
+# else
+# define BFI_FCM2_OUTER_C_12(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 13
+# define BFI_FCM2_OUTER_C_13(z) BFI_FCM2_OUTER_I_13(BFI_FCM2_INNER_C_13(z))
+# else
+# define BFI_FCM2_OUTER_C_13(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 14
+# define BFI_FCM2_OUTER_C_14(z) BFI_FCM2_OUTER_I_14(BFI_FCM2_INNER_C_14(z))
+# else
+# define BFI_FCM2_OUTER_C_14(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 15
+# define BFI_FCM2_OUTER_C_15(z) BFI_FCM2_OUTER_I_15(BFI_FCM2_INNER_C_15(z))
+# else
+# define BFI_FCM2_OUTER_C_15(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 16
+# define BFI_FCM2_OUTER_C_16(z) BFI_FCM2_OUTER_I_16(BFI_FCM2_INNER_C_16(z))
+# else
+# define BFI_FCM2_OUTER_C_16(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 17
+# define BFI_FCM2_OUTER_C_17(z) BFI_FCM2_OUTER_I_17(BFI_FCM2_INNER_C_17(z))
+# else
+# define BFI_FCM2_OUTER_C_17(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 18
+# define BFI_FCM2_OUTER_C_18(z) BFI_FCM2_OUTER_I_18(BFI_FCM2_INNER_C_18(z))
+# else
+# define BFI_FCM2_OUTER_C_18(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 19
+# define BFI_FCM2_OUTER_C_19(z) BFI_FCM2_OUTER_I_19(BFI_FCM2_INNER_C_19(z))
+# else
+# define BFI_FCM2_OUTER_C_19(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 20
+# define BFI_FCM2_OUTER_C_20(z) BFI_FCM2_OUTER_I_20(BFI_FCM2_INNER_C_20(z))
+# else
+# define BFI_FCM2_OUTER_C_20(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 21
+# define BFI_FCM2_OUTER_C_21(z) BFI_FCM2_OUTER_I_21(BFI_FCM2_INNER_C_21(z))
+# else
+# define BFI_FCM2_OUTER_C_21(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 22
+# define BFI_FCM2_OUTER_C_22(z) BFI_FCM2_OUTER_I_22(BFI_FCM2_INNER_C_22(z))
+# else
+# define BFI_FCM2_OUTER_C_22(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 23
+# define BFI_FCM2_OUTER_C_23(z) BFI_FCM2_OUTER_I_23(BFI_FCM2_INNER_C_23(z))
+# else
+# define BFI_FCM2_OUTER_C_23(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 24
+# define BFI_FCM2_OUTER_C_24(z) BFI_FCM2_OUTER_I_24(BFI_FCM2_INNER_C_24(z))
+# else
+# define BFI_FCM2_OUTER_C_24(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 25
+# define BFI_FCM2_OUTER_C_25(z) BFI_FCM2_OUTER_I_25(BFI_FCM2_INNER_C_25(z))
+# else
+# define BFI_FCM2_OUTER_C_25(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 26
+# define BFI_FCM2_OUTER_C_26(z) BFI_FCM2_OUTER_I_26(BFI_FCM2_INNER_C_26(z))
+# else
+# define BFI_FCM2_OUTER_C_26(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 27
+# define BFI_FCM2_OUTER_C_27(z) BFI_FCM2_OUTER_I_27(BFI_FCM2_INNER_C_27(z))
+# else
+# define BFI_FCM2_OUTER_C_27(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 28
+# define BFI_FCM2_OUTER_C_28(z) BFI_FCM2_OUTER_I_28(BFI_FCM2_INNER_C_28(z))
+# else
+# define BFI_FCM2_OUTER_C_28(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 29
+# define BFI_FCM2_OUTER_C_29(z) BFI_FCM2_OUTER_I_29(BFI_FCM2_INNER_C_29(z))
+# else
+# define BFI_FCM2_OUTER_C_29(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 30
+# define BFI_FCM2_OUTER_C_30(z) BFI_FCM2_OUTER_I_30(BFI_FCM2_INNER_C_30(z))
+# else
+# define BFI_FCM2_OUTER_C_30(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 31
+# define BFI_FCM2_OUTER_C_31(z) BFI_FCM2_OUTER_I_31(BFI_FCM2_INNER_C_31(z))
+# else
+# define BFI_FCM2_OUTER_C_31(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 32
+# define BFI_FCM2_OUTER_C_32(z) BFI_FCM2_OUTER_I_32(BFI_FCM2_INNER_C_32(z))
+# else
+# define BFI_FCM2_OUTER_C_32(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 33
+# define BFI_FCM2_OUTER_C_33(z) BFI_FCM2_OUTER_I_33(BFI_FCM2_INNER_C_33(z))
+# else
+# define BFI_FCM2_OUTER_C_33(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 34
+# define BFI_FCM2_OUTER_C_34(z) BFI_FCM2_OUTER_I_34(BFI_FCM2_INNER_C_34(z))
+# else
+# define BFI_FCM2_OUTER_C_34(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 35
+# define BFI_FCM2_OUTER_C_35(z) BFI_FCM2_OUTER_I_35(BFI_FCM2_INNER_C_35(z))
+# else
+# define BFI_FCM2_OUTER_C_35(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 36
+# define BFI_FCM2_OUTER_C_36(z) BFI_FCM2_OUTER_I_36(BFI_FCM2_INNER_C_36(z))
+# else
+# define BFI_FCM2_OUTER_C_36(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 37
+# define BFI_FCM2_OUTER_C_37(z) BFI_FCM2_OUTER_I_37(BFI_FCM2_INNER_C_37(z))
+# else
+# define BFI_FCM2_OUTER_C_37(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 38
+# define BFI_FCM2_OUTER_C_38(z) BFI_FCM2_OUTER_I_38(BFI_FCM2_INNER_C_38(z))
+# else
+# define BFI_FCM2_OUTER_C_38(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 39
+# define BFI_FCM2_OUTER_C_39(z) BFI_FCM2_OUTER_I_39(BFI_FCM2_INNER_C_39(z))
+# else
+# define BFI_FCM2_OUTER_C_39(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# define BFI_FCM2_OUTER_C_40(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+
+# define BFI_FCM2_INNER_C_0(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_0)
+# define BFI_FCM2_INNER_C_1(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_1)
+# define BFI_FCM2_INNER_C_2(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_2)
+# define BFI_FCM2_INNER_C_3(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_3)
+# define BFI_FCM2_INNER_C_4(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_4)
+# define BFI_FCM2_INNER_C_5(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_5)
+# define BFI_FCM2_INNER_C_6(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_6)
+# define BFI_FCM2_INNER_C_7(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_7)
+# define BFI_FCM2_INNER_C_8(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_8)
+# define BFI_FCM2_INNER_C_9(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_9)
+# define BFI_FCM2_INNER_C_10(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_10)
+# define BFI_FCM2_INNER_C_11(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_11)
+# define BFI_FCM2_INNER_C_12(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_12)
+# define BFI_FCM2_INNER_C_13(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_13)
+# define BFI_FCM2_INNER_C_14(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_14)
+# define BFI_FCM2_INNER_C_15(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_15)
+# define BFI_FCM2_INNER_C_16(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_16)
+# define BFI_FCM2_INNER_C_17(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_17)
+# define BFI_FCM2_INNER_C_18(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_18)
+# define BFI_FCM2_INNER_C_19(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_19)
+# define BFI_FCM2_INNER_C_20(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_20)
+# define BFI_FCM2_INNER_C_21(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_21)
+# define BFI_FCM2_INNER_C_22(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_22)
+# define BFI_FCM2_INNER_C_23(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_23)
+# define BFI_FCM2_INNER_C_24(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_24)
+# define BFI_FCM2_INNER_C_25(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_25)
+# define BFI_FCM2_INNER_C_26(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_26)
+# define BFI_FCM2_INNER_C_27(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_27)
+# define BFI_FCM2_INNER_C_28(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_28)
+# define BFI_FCM2_INNER_C_29(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_29)
+# define BFI_FCM2_INNER_C_30(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_30)
+# define BFI_FCM2_INNER_C_31(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_31)
+# define BFI_FCM2_INNER_C_32(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_32)
+# define BFI_FCM2_INNER_C_33(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_33)
+# define BFI_FCM2_INNER_C_34(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_34)
+# define BFI_FCM2_INNER_C_35(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_35)
+# define BFI_FCM2_INNER_C_36(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_36)
+# define BFI_FCM2_INNER_C_37(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_37)
+# define BFI_FCM2_INNER_C_38(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_38)
+# define BFI_FCM2_INNER_C_39(z) BFI_FCM2_RUN(z, BFI_FMACHINE_FUEL_39)
+
+# define BFI_FCM2_RUN(z, f) BFI_FCM2_STEP_A(z f,0)
+# define BFI_FCM2_STEP_A(z, e) BFI_FCM2_GO_A(e, BFI_ENTER_LINEAR2(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM2_GO_A(e, x) BFI_FMACHINE_FEED(BFI_FCM2_STEP_B, e, x
+# define BFI_FCM2_STEP_B(z, e) BFI_FCM2_GO_B(e, BFI_ENTER_LINEAR2(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM2_GO_B(e, x) BFI_FMACHINE_FEED(BFI_FCM2_STEP_A, e, x
+
+# define BFI_FCM2_STEP_A_REFILL_2(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_2(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_3(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_3(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_4(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_4(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_5(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_5(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_6(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_6(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_7(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_7(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_8(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_8(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_9(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_9(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_10(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_10(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_11(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_11(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_12(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_12(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_13(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_13(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_14(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_14(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_15(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_15(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_16(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_16(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_17(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_17(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_18(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_18(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_19(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_19(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_20(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_20(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_21(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_21(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_22(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_22(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_23(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_23(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_24(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_24(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_25(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_25(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_26(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_26(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_27(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_27(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_28(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_28(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_29(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_29(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_30(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_30(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_31(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_31(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_32(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_32(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_33(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_33(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_34(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_34(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_35(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_35(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_36(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_36(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_37(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_37(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_38(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_38(f, z, e) BFI_FCM2_STEP_B(z f,e)
+# define BFI_FCM2_STEP_A_REFILL_39(f, z, e) BFI_FCM2_STEP_A(z f,e)
+# define BFI_FCM2_STEP_B_REFILL_39(f, z, e) BFI_FCM2_STEP_B(z f,e)
+
+# define BFI_FCM2_OUTER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_1, x)
+# define BFI_FCM2_OUTER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_2, x)
+# define BFI_FCM2_OUTER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_3, x)
+# define BFI_FCM2_OUTER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_4, x)
+# define BFI_FCM2_OUTER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_5, x)
+# define BFI_FCM2_OUTER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_6, x)
+# define BFI_FCM2_OUTER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_7, x)
+# define BFI_FCM2_OUTER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_8, x)
+# define BFI_FCM2_OUTER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_9, x)
+# define BFI_FCM2_OUTER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_10, x)
+# define BFI_FCM2_OUTER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_11, x)
+# define BFI_FCM2_OUTER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_12, x)
+# define BFI_FCM2_OUTER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_13, x)
+# define BFI_FCM2_OUTER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_14, x)
+# define BFI_FCM2_OUTER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_15, x)
+# define BFI_FCM2_OUTER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_16, x)
+# define BFI_FCM2_OUTER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_17, x)
+# define BFI_FCM2_OUTER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_18, x)
+# define BFI_FCM2_OUTER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_19, x)
+# define BFI_FCM2_OUTER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_20, x)
+# define BFI_FCM2_OUTER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_21, x)
+# define BFI_FCM2_OUTER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_22, x)
+# define BFI_FCM2_OUTER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_23, x)
+# define BFI_FCM2_OUTER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_24, x)
+# define BFI_FCM2_OUTER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_25, x)
+# define BFI_FCM2_OUTER_I_25(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_26, x)
+# define BFI_FCM2_OUTER_I_26(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_27, x)
+# define BFI_FCM2_OUTER_I_27(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_28, x)
+# define BFI_FCM2_OUTER_I_28(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_29, x)
+# define BFI_FCM2_OUTER_I_29(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_30, x)
+# define BFI_FCM2_OUTER_I_30(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_31, x)
+# define BFI_FCM2_OUTER_I_31(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_32, x)
+# define BFI_FCM2_OUTER_I_32(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_33, x)
+# define BFI_FCM2_OUTER_I_33(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_34, x)
+# define BFI_FCM2_OUTER_I_34(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_35, x)
+# define BFI_FCM2_OUTER_I_35(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_36, x)
+# define BFI_FCM2_OUTER_I_36(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_37, x)
+# define BFI_FCM2_OUTER_I_37(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_38, x)
+# define BFI_FCM2_OUTER_I_38(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_39, x)
+# define BFI_FCM2_OUTER_I_39(x) BFI_FMACHINE_RESUME(BFI_FCM2_OUTER_C_40, x)
+# endif
+
+# if BFI_MACHINE_FAMILIES > 3
+# define BFI_FMACHINE3_O(v, f, d) BFI_LEFT(BFI_FMACHINE3_R(BFI_FMACHINE_START_K(3, v, f, d)))()
+# define BFI_FMACHINE3_V(v, f, d) BFI_RIGHT(BFI_FMACHINE3_R(BFI_FMACHINE_START_K(3, v, f, d)))
+# define BFI_FMACHINE3_R(z) BFI_FMACHINE_END(BFI_FCM3_OUTER_C_0(z))
+
+# define BFI_FCM3_OUTER_C_0(z) BFI_FCM3_OUTER_I_0(BFI_FCM3_INNER_C_0(z))
+# if BFI_MACHINE_LEVELS > 1
+# define BFI_FCM3_OUTER_C_1(z) BFI_FCM3_OUTER_I_1(BFI_FCM3_INNER_C_1(z))
+# else
+# define BFI_FCM3_OUTER_C_1(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 2
+# define BFI_FCM3_OUTER_C_2(z) BFI_FCM3_OUTER_I_2(BFI_FCM3_INNER_C_2(z))
+# else
+# define BFI_FCM3_OUTER_C_2(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 3
+# define BFI_FCM3_OUTER_C_3(z) BFI_FCM3_OUTER_I_3(BFI_FCM3_INNER_C_3(z))
+# else
+# define BFI_FCM3_OUTER_C_3(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 4
+# define BFI_FCM3_OUTER_C_4(z) BFI_FCM3_OUTER_I_4(BFI_FCM3_INNER_C_4(z))
+# else
+# define BFI_FCM3_OUTER_C_4(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 5
+# define BFI_FCM3_OUTER_C_5(z) BFI_FCM3_OUTER_I_5(BFI_FCM3_INNER_C_5(z))
+# else
+# define BFI_FCM3_OUTER_C_5(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 6
+# define BFI_FCM3_OUTER_C_6(z) BFI_FCM3_OUTER_I_6(BFI_FCM3_INNER_C_6(z))
+# else
+# define BFI_FCM3_OUTER_C_6(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 7
+# define BFI_FCM3_OUTER_C_7(z) BFI_FCM3_OUTER_I_7(BFI_FCM3_INNER_C_7(z))
+# else
+# define BFI_FCM3_OUTER_C_7(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 8
+# define BFI_FCM3_OUTER_C_8(z) BFI_FCM3_OUTER_I_8(BFI_FCM3_INNER_C_8(z))
+# else
+# define BFI_FCM3_OUTER_C_8(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 9
+# define BFI_FCM3_OUTER_C_9(z) BFI_FCM3_OUTER_I_9(BFI_FCM3_INNER_C_9(z))
+# else
+# define BFI_FCM3_OUTER_C_9(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 10
+# define BFI_FCM3_OUTER_C_10(z) BFI_FCM3_OUTER_I_10(BFI_FCM3_INNER_C_10(z))
+# else
+# define BFI_FCM3_OUTER_C_10(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 11
+# define BFI_FCM3_OUTER_C_11(z) BFI_FCM3_OUTER_I_11(BFI_FCM3_INNER_C_11(z))
+# else
+# define BFI_FCM3_OUTER_C_11(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 12
+# define BFI_FCM3_OUTER_C_12(z) BFI_FCM3_OUTER_I_12(BFI_FCM3_INNER_C_12(z))
+# else
+# define BFI_FCM3_OUTER_C_12(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 13
+# define BFI_FCM3_OUTER_C_13(z) BFI_FCM3_OUTER_I_13(BFI_FCM3_INNER_C_13(z))
+# else
+# define BFI_FCM3_OUTER_C_13(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 14
+# define BFI_FCM3_OUTER_C_14(z) BFI_FCM3_OUTER_I_14(BFI_FCM3_INNER_C_14(z))
+# else
+# define BFI_FCM3_OUTER_C_14(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 15
+# define BFI_FCM3_OUTER_C_15(z) BFI_FCM3_OUTER_I_15(BFI_FCM3_INNER_C_15(z))
+# else
+# define BFI_FCM3_OUTER_C_15(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 16
+# define BFI_FCM3_OUTER_C_16(z) BFI_FCM3_OUTER_I_16(BFI_FCM3_INNER_C_16(z))
+# else
+# define BFI_FCM3_OUTER_C_16(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 17
+# define BFI_FCM3_OUTER_C_17(z) BFI_FCM3_OUTER_I_17(BFI_FCM3_INNER_C_17(z))
+# else
+# define BFI_FCM3_OUTER_C_17(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 18
+# define BFI_FCM3_OUTER_C_18(z) BFI_FCM3_OUTER_I_18(BFI_FCM3_INNER_C_18(z))
+# else
+# define BFI_FCM3_OUTER_C_18(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 19
+# define BFI_FCM3_OUTER_C_19(z) BFI_FCM3_OUTER_I_19(BFI_FCM3_INNER_C_19(z))
+# else
+# define BFI_FCM3_OUTER_C_19(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 20
+# define BFI_FCM3_OUTER_C_20(z) BFI_FCM3_OUTER_I_20(BFI_FCM3_INNER_C_20(z))
+# else
+# define BFI_FCM3_OUTER_C_20(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 21
+# define BFI_FCM3_OUTER_C_21(z) BFI_FCM3_OUTER_I_21(BFI_FCM3_INNER_C_21(z))
+# else
+# define BFI_FCM3_OUTER_C_21(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 22
+# define BFI_FCM3_OUTER_C_22(z) BFI_FCM3_OUTER_I_22(BFI_FCM3_INNER_C_22(z))
+# else
+# define BFI_FCM3_OUTER_C_22(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 23
+# define BFI_FCM3_OUTER_C_23(z) BFI_FCM3_OUTER_I_23(BFI_FCM3_INNER_C_23(z))
+# else
+# define BFI_FCM3_OUTER_C_23(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 24
+# define BFI_FCM3_OUTER_C_24(z) BFI_FCM3_OUTER_I_24(BFI_FCM3_INNER_C_24(z))
+# else
+# define BFI_FCM3_OUTER_C_24(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 25
+# define BFI_FCM3_OUTER_C_25(z) BFI_FCM3_OUTER_I_25(BFI_FCM3_INNER_C_25(z))
+# else
+# define BFI_FCM3_OUTER_C_25(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 26
+# define BFI_FCM3_OUTER_C_26(z) BFI_FCM3_OUTER_I_26(BFI_FCM3_INNER_C_26(z))
+# else
+# define BFI_FCM3_OUTER_C_26(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 27
+# define BFI_FCM3_OUTER_C_27(z) BFI_FCM3_OUTER_I_27(BFI_FCM3_INNER_C_27(z))
+# else
+# define BFI_FCM3_OUTER_C_27(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 28
+# define BFI_FCM3_OUTER_C_28(z) BFI_FCM3_OUTER_I_28(BFI_FCM3_INNER_C_28(z))
+# else
+# define BFI_FCM3_OUTER_C_28(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 29
+# define BFI_FCM3_OUTER_C_29(z) BFI_FCM3_OUTER_I_29(BFI_FCM3_INNER_C_29(z))
+# else
+# define BFI_FCM3_OUTER_C_29(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 30
+# define BFI_FCM3_OUTER_C_30(z) BFI_FCM3_OUTER_I_30(BFI_FCM3_INNER_C_30(z))
+# else
+# define BFI_FCM3_OUTER_C_30(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 31
+# define BFI_FCM3_OUTER_C_31(z) BFI_FCM3_OUTER_I_31(BFI_FCM3_INNER_C_31(z))
+# else
+# define BFI_FCM3_OUTER_C_31(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 32
+# define BFI_FCM3_OUTER_C_32(z) BFI_FCM3_OUTER_I_32(BFI_FCM3_INNER_C_32(z))
+# else
+# define BFI_FCM3_OUTER_C_32(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 33
+# define BFI_FCM3_OUTER_C_33(z) BFI_FCM3_OUTER_I_33(BFI_FCM3_INNER_C_33(z))
+# else
+# define BFI_FCM3_OUTER_C_33(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 34
+# define BFI_FCM3_OUTER_C_34(z) BFI_FCM3_OUTER_I_34(BFI_FCM3_INNER_C_34(z))
+# else
+# define BFI_FCM3_OUTER_C_34(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 35
+# define BFI_FCM3_OUTER_C_35(z) BFI_FCM3_OUTER_I_35(BFI_FCM3_INNER_C_35(z))
+# else
+# define BFI_FCM3_OUTER_C_35(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 36
+# define BFI_FCM3_OUTER_C_36(z) BFI_FCM3_OUTER_I_36(BFI_FCM3_INNER_C_36(z))
+# else
+# define BFI_FCM3_OUTER_C_36(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 37
+# define BFI_FCM3_OUTER_C_37(z) BFI_FCM3_OUTER_I_37(BFI_FCM3_INNER_C_37(z))
+# else
+# define BFI_FCM3_OUTER_C_37(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 38
+# define BFI_FCM3_OUTER_C_38(z) BFI_FCM3_OUTER_I_38(BFI_FCM3_INNER_C_38(z))
+# else
+# define BFI_FCM3_OUTER_C_38(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# if BFI_MACHINE_LEVELS > 39
+# define BFI_FCM3_OUTER_C_39(z) BFI_FCM3_OUTER_I_39(BFI_FCM3_INNER_C_39(z))
+# else
+# define BFI_FCM3_OUTER_C_39(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+# endif
+# define BFI_FCM3_OUTER_C_40(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
+
+# define BFI_FCM3_INNER_C_0(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_0)
+# define BFI_FCM3_INNER_C_1(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_1)
+# define BFI_FCM3_INNER_C_2(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_2)
+# define BFI_FCM3_INNER_C_3(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_3)
+# define BFI_FCM3_INNER_C_4(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_4)
+# define BFI_FCM3_INNER_C_5(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_5)
+# define BFI_FCM3_INNER_C_6(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_6)
+# define BFI_FCM3_INNER_C_7(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_7)
+# define BFI_FCM3_INNER_C_8(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_8)
+# define BFI_FCM3_INNER_C_9(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_9)
+# define BFI_FCM3_INNER_C_10(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_10)
+# define BFI_FCM3_INNER_C_11(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_11)
+# define BFI_FCM3_INNER_C_12(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_12)
+# define BFI_FCM3_INNER_C_13(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_13)
+# define BFI_FCM3_INNER_C_14(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_14)
+# define BFI_FCM3_INNER_C_15(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_15)
+# define BFI_FCM3_INNER_C_16(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_16)
+# define BFI_FCM3_INNER_C_17(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_17)
+# define BFI_FCM3_INNER_C_18(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_18)
+# define BFI_FCM3_INNER_C_19(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_19)
+# define BFI_FCM3_INNER_C_20(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_20)
+# define BFI_FCM3_INNER_C_21(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_21)
+# define BFI_FCM3_INNER_C_22(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_22)
+# define BFI_FCM3_INNER_C_23(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_23)
+# define BFI_FCM3_INNER_C_24(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_24)
+# define BFI_FCM3_INNER_C_25(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_25)
+# define BFI_FCM3_INNER_C_26(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_26)
+# define BFI_FCM3_INNER_C_27(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_27)
+# define BFI_FCM3_INNER_C_28(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_28)
+# define BFI_FCM3_INNER_C_29(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_29)
+# define BFI_FCM3_INNER_C_30(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_30)
+# define BFI_FCM3_INNER_C_31(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_31)
+# define BFI_FCM3_INNER_C_32(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_32)
+# define BFI_FCM3_INNER_C_33(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_33)
+# define BFI_FCM3_INNER_C_34(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_34)
+# define BFI_FCM3_INNER_C_35(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_35)
+# define BFI_FCM3_INNER_C_36(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_36)
+# define BFI_FCM3_INNER_C_37(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_37)
+# define BFI_FCM3_INNER_C_38(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_38)
+# define BFI_FCM3_INNER_C_39(z) BFI_FCM3_RUN(z, BFI_FMACHINE_FUEL_39)
+
+# define BFI_FCM3_RUN(z, f) BFI_FCM3_STEP_A(z f,0)
+# define BFI_FCM3_STEP_A(z, e) BFI_FCM3_GO_A(e, BFI_ENTER_LINEAR3(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM3_GO_A(e, x) BFI_FMACHINE_FEED(BFI_FCM3_STEP_B, e, x
+# define BFI_FCM3_STEP_B(z, e) BFI_FCM3_GO_B(e, BFI_ENTER_LINEAR3(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END)))
+# define BFI_FCM3_GO_B(e, x) BFI_FMACHINE_FEED(BFI_FCM3_STEP_A, e, x
+
+# define BFI_FCM3_STEP_A_REFILL_2(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_2(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_3(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_3(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_4(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_4(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_5(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_5(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_6(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_6(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_7(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_7(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_8(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_8(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_9(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_9(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_10(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_10(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_11(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_11(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_12(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_12(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_13(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_13(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_14(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_14(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_15(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_15(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_16(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_16(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_17(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_17(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_18(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_18(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_19(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_19(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_20(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_20(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_21(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_21(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_22(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_22(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_23(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_23(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_24(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_24(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_25(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_25(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_26(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_26(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_27(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_27(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_28(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_28(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_29(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_29(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_30(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_30(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_31(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_31(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_32(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_32(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_33(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_33(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_34(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_34(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_35(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_35(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_36(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_36(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_37(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_37(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_38(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_38(f, z, e) BFI_FCM3_STEP_B(z f,e)
+# define BFI_FCM3_STEP_A_REFILL_39(f, z, e) BFI_FCM3_STEP_A(z f,e)
+# define BFI_FCM3_STEP_B_REFILL_39(f, z, e) BFI_FCM3_STEP_B(z f,e)
+
+# define BFI_FCM3_OUTER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_1, x)
+# define BFI_FCM3_OUTER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_2, x)
+# define BFI_FCM3_OUTER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_3, x)
+# define BFI_FCM3_OUTER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_4, x)
+# define BFI_FCM3_OUTER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_5, x)
+# define BFI_FCM3_OUTER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_6, x)
+# define BFI_FCM3_OUTER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_7, x)
+# define BFI_FCM3_OUTER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_8, x)
+# define BFI_FCM3_OUTER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_9, x)
+# define BFI_FCM3_OUTER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_10, x)
+# define BFI_FCM3_OUTER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_11, x)
+# define BFI_FCM3_OUTER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_12, x)
+# define BFI_FCM3_OUTER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_13, x)
+# define BFI_FCM3_OUTER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_14, x)
+# define BFI_FCM3_OUTER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_15, x)
+# define BFI_FCM3_OUTER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_16, x)
+# define BFI_FCM3_OUTER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_17, x)
+# define BFI_FCM3_OUTER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_18, x)
+# define BFI_FCM3_OUTER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_19, x)
+# define BFI_FCM3_OUTER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_20, x)
+# define BFI_FCM3_OUTER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_21, x)
+# define BFI_FCM3_OUTER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_22, x)
+# define BFI_FCM3_OUTER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_23, x)
+# define BFI_FCM3_OUTER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_24, x)
+# define BFI_FCM3_OUTER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_25, x)
+# define BFI_FCM3_OUTER_I_25(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_26, x)
+# define BFI_FCM3_OUTER_I_26(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_27, x)
+# define BFI_FCM3_OUTER_I_27(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_28, x)
+# define BFI_FCM3_OUTER_I_28(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_29, x)
+# define BFI_FCM3_OUTER_I_29(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_30, x)
+# define BFI_FCM3_OUTER_I_30(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_31, x)
+# define BFI_FCM3_OUTER_I_31(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_32, x)
+# define BFI_FCM3_OUTER_I_32(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_33, x)
+# define BFI_FCM3_OUTER_I_33(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_34, x)
+# define BFI_FCM3_OUTER_I_34(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_35, x)
+# define BFI_FCM3_OUTER_I_35(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_36, x)
+# define BFI_FCM3_OUTER_I_36(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_37, x)
+# define BFI_FCM3_OUTER_I_37(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_38, x)
+# define BFI_FCM3_OUTER_I_38(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_39, x)
+# define BFI_FCM3_OUTER_I_39(x) BFI_FMACHINE_RESUME(BFI_FCM3_OUTER_C_40, x)
+# endif
+
+# endif
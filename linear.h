@@ -0,0 +1,280 @@
+# ifndef BFI_LINEAR_H
+# define BFI_LINEAR_H
+
+/* generated by gen_linear.hs */
+
+/* BFI_LINEAR_DEPTH
+ *  The number of linear driver macros the machine runs through before it
+ *  suspends itself and turns its state back into the portable
+ *  representation. It must be one of 64, 256, 1024, 4096.
+ *  The default is 256.
+ *
+ *  A deeper chain means fewer suspensions, but each suspension has to deal
+ *  with a bigger active representation. Define it before including any of
+ *  the bfi headers.
+ *
+ * BFI_MACHINE_FAMILIES
+ *  The number of machine families, i.e. the number of continuation machines
+ *  that can be running at the same time, one nested inside another. It must
+ *  be between 1 and 4. The default is 2.
+ *
+ *  Every family has its own copy of the linear drivers and of the
+ *  BFI_FCM{K}_* macros, so each one costs about BFI_LINEAR_DEPTH macro
+ *  definitions.
+ *
+ * BFI_FLINEARC_*
+ *  An extra set of linear drivers used by BFI_FMACHINE_TALLY. Every driver
+ *  outputs (0slow(0i##f)) when it is called with the instruction f, and
+ *  its _TICK(t) companion outputs (0fast(0i##t)). The 0i prefix keeps the
+ *  instruction name from being expanded.
+ *
+ * BFI_FLINEARS_*
+ *  An extra set of linear drivers used by BFI_FMACHINE_SAMPLE. They are
+ *  the normal drivers, except that BFI_FLINEARS_0 suspends the machine
+ *  through BFI_FMACHINE_SAMPLE_SUSPEND.
+ *
+ *  The drivers of each set are in linear/, one header per depth segment.
+ *  Only the headers for the selected depth and families are included.
+ */
+
+# ifndef BFI_LINEAR_DEPTH
+# define BFI_LINEAR_DEPTH 256
+# endif
+
+# ifndef BFI_MACHINE_FAMILIES
+# define BFI_MACHINE_FAMILIES 2
+# endif
+
+# if BFI_MACHINE_FAMILIES < 1 || BFI_MACHINE_FAMILIES > 4
+# error "BFI_MACHINE_FAMILIES must be between 1 and 4"
+# endif
+
+# define BFI_FMACHINE_PICK() BFI_IF(BFI_FMACHINE_FREEP(0))(0, BFI_IF(BFI_FMACHINE_FREEP(1))(1, BFI_IF(BFI_FMACHINE_FREEP(2))(2, BFI_IF(BFI_FMACHINE_FREEP(3))(3, BFI_MACHINE_OVERFLOW()))))
+
+# define BFI_ENTER_LINEAR0(r) BFI_ENTER_LINEAR_I r
+# define BFI_FLINEAR0_0(v, f, ds) BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(0), v, BFI_CLEANUP_REST(~ds
+# define BFI_FLINEAR0_0_TICK(t)
+# define BFI_FLINEAR0_ENTRANCE_A_TICK(t)
+# define BFI_FLINEAR0_ENTRANCE_B_TICK(t)
+# define BFI_FLINEAR0_ENTRANCE_TEST(x) x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEAR0_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_62, v ds
+# define BFI_FLINEAR0_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEAR0_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_254, v ds
+# define BFI_FLINEAR0_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEAR0_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1022, v ds
+# define BFI_FLINEAR0_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEAR0_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4094, v ds
+# define BFI_FLINEAR0_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/0_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/0_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/0_256.h"
+# endif
+
+# include "linear/0_64.h"
+
+# if BFI_MACHINE_FAMILIES > 1
+# define BFI_ENTER_LINEAR1(r) BFI_ENTER_LINEAR_I r
+# define BFI_FLINEAR1_0(v, f, ds) BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(1), v, BFI_CLEANUP_REST(~ds
+# define BFI_FLINEAR1_0_TICK(t)
+# define BFI_FLINEAR1_ENTRANCE_A_TICK(t)
+# define BFI_FLINEAR1_ENTRANCE_B_TICK(t)
+# define BFI_FLINEAR1_ENTRANCE_TEST(x) x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEAR1_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_62, v ds
+# define BFI_FLINEAR1_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEAR1_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_254, v ds
+# define BFI_FLINEAR1_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEAR1_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1022, v ds
+# define BFI_FLINEAR1_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEAR1_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4094, v ds
+# define BFI_FLINEAR1_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/1_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/1_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/1_256.h"
+# endif
+
+# include "linear/1_64.h"
+# endif
+
+# if BFI_MACHINE_FAMILIES > 2
+# define BFI_ENTER_LINEAR2(r) BFI_ENTER_LINEAR_I r
+# define BFI_FLINEAR2_0(v, f, ds) BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(2), v, BFI_CLEANUP_REST(~ds
+# define BFI_FLINEAR2_0_TICK(t)
+# define BFI_FLINEAR2_ENTRANCE_A_TICK(t)
+# define BFI_FLINEAR2_ENTRANCE_B_TICK(t)
+# define BFI_FLINEAR2_ENTRANCE_TEST(x) x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEAR2_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_62, v ds
+# define BFI_FLINEAR2_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEAR2_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_254, v ds
+# define BFI_FLINEAR2_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEAR2_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1022, v ds
+# define BFI_FLINEAR2_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEAR2_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4094, v ds
+# define BFI_FLINEAR2_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/2_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/2_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/2_256.h"
+# endif
+
+# include "linear/2_64.h"
+# endif
+
+# if BFI_MACHINE_FAMILIES > 3
+# define BFI_ENTER_LINEAR3(r) BFI_ENTER_LINEAR_I r
+# define BFI_FLINEAR3_0(v, f, ds) BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(3), v, BFI_CLEANUP_REST(~ds
+# define BFI_FLINEAR3_0_TICK(t)
+# define BFI_FLINEAR3_ENTRANCE_A_TICK(t)
+# define BFI_FLINEAR3_ENTRANCE_B_TICK(t)
+# define BFI_FLINEAR3_ENTRANCE_TEST(x) x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEAR3_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_62, v ds
+# define BFI_FLINEAR3_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEAR3_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_254, v ds
+# define BFI_FLINEAR3_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEAR3_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1022, v ds
+# define BFI_FLINEAR3_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEAR3_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4094, v ds
+# define BFI_FLINEAR3_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/3_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/3_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/3_256.h"
+# endif
+
+# include "linear/3_64.h"
+# endif
+
+# define BFI_FLINEARC_0(v, f, ds) (0slow(0i##f))BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(C), v, BFI_CLEANUP_REST(~ds
+# define BFI_FLINEARC_0_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_ENTRANCE_A_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_ENTRANCE_B_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_ENTRANCE_TEST(x) BFI_EAT x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEARC_ENTRANCE_A(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_62, v ds
+# define BFI_FLINEARC_ENTRANCE_B(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEARC_ENTRANCE_A(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_254, v ds
+# define BFI_FLINEARC_ENTRANCE_B(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEARC_ENTRANCE_A(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1022, v ds
+# define BFI_FLINEARC_ENTRANCE_B(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEARC_ENTRANCE_A(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4094, v ds
+# define BFI_FLINEARC_ENTRANCE_B(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/c_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/c_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/c_256.h"
+# endif
+
+# include "linear/c_64.h"
+
+# define BFI_FLINEARS_0(v, f, ds) BFI_FMACHINE_SAMPLE_SUSPEND(f, (v) ds
+# define BFI_FLINEARS_0_TICK(t)
+# define BFI_FLINEARS_ENTRANCE_A_TICK(t)
+# define BFI_FLINEARS_ENTRANCE_B_TICK(t)
+# define BFI_FLINEARS_ENTRANCE_TEST(x) x
+
+# if BFI_LINEAR_DEPTH == 64
+# define BFI_FLINEARS_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_62, v ds
+# define BFI_FLINEARS_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_62, v ds
+# elif BFI_LINEAR_DEPTH == 256
+# define BFI_FLINEARS_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_254, v ds
+# define BFI_FLINEARS_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_254, v ds
+# elif BFI_LINEAR_DEPTH == 1024
+# define BFI_FLINEARS_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1022, v ds
+# define BFI_FLINEARS_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1022, v ds
+# elif BFI_LINEAR_DEPTH == 4096
+# define BFI_FLINEARS_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4094, v ds
+# define BFI_FLINEARS_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4094, v ds
+# else
+# error "BFI_LINEAR_DEPTH must be one of 64, 256, 1024, 4096"
+# endif
+
+# if BFI_LINEAR_DEPTH > 1024
+# include "linear/s_4096.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 256
+# include "linear/s_1024.h"
+# endif
+
+# if BFI_LINEAR_DEPTH > 64
+# include "linear/s_256.h"
+# endif
+
+# include "linear/s_64.h"
+
+# endif
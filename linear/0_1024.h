@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_0_1024_H
+# define BFI_LINEAR_0_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR0_1024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1023, v ds
+# define BFI_FLINEAR0_1024_TICK(t)
+# define BFI_FLINEAR0_1023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1022, v ds
+# define BFI_FLINEAR0_1023_TICK(t)
+# define BFI_FLINEAR0_1022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1021, v ds
+# define BFI_FLINEAR0_1022_TICK(t)
+# define BFI_FLINEAR0_1021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1020, v ds
+# define BFI_FLINEAR0_1021_TICK(t)
+# define BFI_FLINEAR0_1020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1019, v ds
+# define BFI_FLINEAR0_1020_TICK(t)
+# define BFI_FLINEAR0_1019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1018, v ds
+# define BFI_FLINEAR0_1019_TICK(t)
+# define BFI_FLINEAR0_1018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1017, v ds
+# define BFI_FLINEAR0_1018_TICK(t)
+# define BFI_FLINEAR0_1017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1016, v ds
+# define BFI_FLINEAR0_1017_TICK(t)
+# define BFI_FLINEAR0_1016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1015, v ds
+# define BFI_FLINEAR0_1016_TICK(t)
+# define BFI_FLINEAR0_1015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1014, v ds
+# define BFI_FLINEAR0_1015_TICK(t)
+# define BFI_FLINEAR0_1014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1013, v ds
+# define BFI_FLINEAR0_1014_TICK(t)
+# define BFI_FLINEAR0_1013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1012, v ds
+# define BFI_FLINEAR0_1013_TICK(t)
+# define BFI_FLINEAR0_1012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1011, v ds
+# define BFI_FLINEAR0_1012_TICK(t)
+# define BFI_FLINEAR0_1011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1010, v ds
+# define BFI_FLINEAR0_1011_TICK(t)
+# define BFI_FLINEAR0_1010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1009, v ds
+# define BFI_FLINEAR0_1010_TICK(t)
+# define BFI_FLINEAR0_1009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1008, v ds
+# define BFI_FLINEAR0_1009_TICK(t)
+# define BFI_FLINEAR0_1008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1007, v ds
+# define BFI_FLINEAR0_1008_TICK(t)
+# define BFI_FLINEAR0_1007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1006, v ds
+# define BFI_FLINEAR0_1007_TICK(t)
+# define BFI_FLINEAR0_1006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1005, v ds
+# define BFI_FLINEAR0_1006_TICK(t)
+# define BFI_FLINEAR0_1005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1004, v ds
+# define BFI_FLINEAR0_1005_TICK(t)
+# define BFI_FLINEAR0_1004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1003, v ds
+# define BFI_FLINEAR0_1004_TICK(t)
+# define BFI_FLINEAR0_1003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1002, v ds
+# define BFI_FLINEAR0_1003_TICK(t)
+# define BFI_FLINEAR0_1002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1001, v ds
+# define BFI_FLINEAR0_1002_TICK(t)
+# define BFI_FLINEAR0_1001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1000, v ds
+# define BFI_FLINEAR0_1001_TICK(t)
+# define BFI_FLINEAR0_1000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_999, v ds
+# define BFI_FLINEAR0_1000_TICK(t)
+# define BFI_FLINEAR0_999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_998, v ds
+# define BFI_FLINEAR0_999_TICK(t)
+# define BFI_FLINEAR0_998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_997, v ds
+# define BFI_FLINEAR0_998_TICK(t)
+# define BFI_FLINEAR0_997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_996, v ds
+# define BFI_FLINEAR0_997_TICK(t)
+# define BFI_FLINEAR0_996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_995, v ds
+# define BFI_FLINEAR0_996_TICK(t)
+# define BFI_FLINEAR0_995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_994, v ds
+# define BFI_FLINEAR0_995_TICK(t)
+# define BFI_FLINEAR0_994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_993, v ds
+# define BFI_FLINEAR0_994_TICK(t)
+# define BFI_FLINEAR0_993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_992, v ds
+# define BFI_FLINEAR0_993_TICK(t)
+# define BFI_FLINEAR0_992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_991, v ds
+# define BFI_FLINEAR0_992_TICK(t)
+# define BFI_FLINEAR0_991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_990, v ds
+# define BFI_FLINEAR0_991_TICK(t)
+# define BFI_FLINEAR0_990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_989, v ds
+# define BFI_FLINEAR0_990_TICK(t)
+# define BFI_FLINEAR0_989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_988, v ds
+# define BFI_FLINEAR0_989_TICK(t)
+# define BFI_FLINEAR0_988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_987, v ds
+# define BFI_FLINEAR0_988_TICK(t)
+# define BFI_FLINEAR0_987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_986, v ds
+# define BFI_FLINEAR0_987_TICK(t)
+# define BFI_FLINEAR0_986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_985, v ds
+# define BFI_FLINEAR0_986_TICK(t)
+# define BFI_FLINEAR0_985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_984, v ds
+# define BFI_FLINEAR0_985_TICK(t)
+# define BFI_FLINEAR0_984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_983, v ds
+# define BFI_FLINEAR0_984_TICK(t)
+# define BFI_FLINEAR0_983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_982, v ds
+# define BFI_FLINEAR0_983_TICK(t)
+# define BFI_FLINEAR0_982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_981, v ds
+# define BFI_FLINEAR0_982_TICK(t)
+# define BFI_FLINEAR0_981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_980, v ds
+# define BFI_FLINEAR0_981_TICK(t)
+# define BFI_FLINEAR0_980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_979, v ds
+# define BFI_FLINEAR0_980_TICK(t)
+# define BFI_FLINEAR0_979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_978, v ds
+# define BFI_FLINEAR0_979_TICK(t)
+# define BFI_FLINEAR0_978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_977, v ds
+# define BFI_FLINEAR0_978_TICK(t)
+# define BFI_FLINEAR0_977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_976, v ds
+# define BFI_FLINEAR0_977_TICK(t)
+# define BFI_FLINEAR0_976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_975, v ds
+# define BFI_FLINEAR0_976_TICK(t)
+# define BFI_FLINEAR0_975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_974, v ds
+# define BFI_FLINEAR0_975_TICK(t)
+# define BFI_FLINEAR0_974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_973, v ds
+# define BFI_FLINEAR0_974_TICK(t)
+# define BFI_FLINEAR0_973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_972, v ds
+# define BFI_FLINEAR0_973_TICK(t)
+# define BFI_FLINEAR0_972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_971, v ds
+# define BFI_FLINEAR0_972_TICK(t)
+# define BFI_FLINEAR0_971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_970, v ds
+# define BFI_FLINEAR0_971_TICK(t)
+# define BFI_FLINEAR0_970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_969, v ds
+# define BFI_FLINEAR0_970_TICK(t)
+# define BFI_FLINEAR0_969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_968, v ds
+# define BFI_FLINEAR0_969_TICK(t)
+# define BFI_FLINEAR0_968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_967, v ds
+# define BFI_FLINEAR0_968_TICK(t)
+# define BFI_FLINEAR0_967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_966, v ds
+# define BFI_FLINEAR0_967_TICK(t)
+# define BFI_FLINEAR0_966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_965, v ds
+# define BFI_FLINEAR0_966_TICK(t)
+# define BFI_FLINEAR0_965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_964, v ds
+# define BFI_FLINEAR0_965_TICK(t)
+# define BFI_FLINEAR0_964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_963, v ds
+# define BFI_FLINEAR0_964_TICK(t)
+# define BFI_FLINEAR0_963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_962, v ds
+# define BFI_FLINEAR0_963_TICK(t)
+# define BFI_FLINEAR0_962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_961, v ds
+# define BFI_FLINEAR0_962_TICK(t)
+# define BFI_FLINEAR0_961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_960, v ds
+# define BFI_FLINEAR0_961_TICK(t)
+# define BFI_FLINEAR0_960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_959, v ds
+# define BFI_FLINEAR0_960_TICK(t)
+# define BFI_FLINEAR0_959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_958, v ds
+# define BFI_FLINEAR0_959_TICK(t)
+# define BFI_FLINEAR0_958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_957, v ds
+# define BFI_FLINEAR0_958_TICK(t)
+# define BFI_FLINEAR0_957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_956, v ds
+# define BFI_FLINEAR0_957_TICK(t)
+# define BFI_FLINEAR0_956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_955, v ds
+# define BFI_FLINEAR0_956_TICK(t)
+# define BFI_FLINEAR0_955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_954, v ds
+# define BFI_FLINEAR0_955_TICK(t)
+# define BFI_FLINEAR0_954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_953, v ds
+# define BFI_FLINEAR0_954_TICK(t)
+# define BFI_FLINEAR0_953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_952, v ds
+# define BFI_FLINEAR0_953_TICK(t)
+# define BFI_FLINEAR0_952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_951, v ds
+# define BFI_FLINEAR0_952_TICK(t)
+# define BFI_FLINEAR0_951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_950, v ds
+# define BFI_FLINEAR0_951_TICK(t)
+# define BFI_FLINEAR0_950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_949, v ds
+# define BFI_FLINEAR0_950_TICK(t)
+# define BFI_FLINEAR0_949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_948, v ds
+# define BFI_FLINEAR0_949_TICK(t)
+# define BFI_FLINEAR0_948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_947, v ds
+# define BFI_FLINEAR0_948_TICK(t)
+# define BFI_FLINEAR0_947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_946, v ds
+# define BFI_FLINEAR0_947_TICK(t)
+# define BFI_FLINEAR0_946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_945, v ds
+# define BFI_FLINEAR0_946_TICK(t)
+# define BFI_FLINEAR0_945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_944, v ds
+# define BFI_FLINEAR0_945_TICK(t)
+# define BFI_FLINEAR0_944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_943, v ds
+# define BFI_FLINEAR0_944_TICK(t)
+# define BFI_FLINEAR0_943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_942, v ds
+# define BFI_FLINEAR0_943_TICK(t)
+# define BFI_FLINEAR0_942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_941, v ds
+# define BFI_FLINEAR0_942_TICK(t)
+# define BFI_FLINEAR0_941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_940, v ds
+# define BFI_FLINEAR0_941_TICK(t)
+# define BFI_FLINEAR0_940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_939, v ds
+# define BFI_FLINEAR0_940_TICK(t)
+# define BFI_FLINEAR0_939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_938, v ds
+# define BFI_FLINEAR0_939_TICK(t)
+# define BFI_FLINEAR0_938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_937, v ds
+# define BFI_FLINEAR0_938_TICK(t)
+# define BFI_FLINEAR0_937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_936, v ds
+# define BFI_FLINEAR0_937_TICK(t)
+# define BFI_FLINEAR0_936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_935, v ds
+# define BFI_FLINEAR0_936_TICK(t)
+# define BFI_FLINEAR0_935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_934, v ds
+# define BFI_FLINEAR0_935_TICK(t)
+# define BFI_FLINEAR0_934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_933, v ds
+# define BFI_FLINEAR0_934_TICK(t)
+# define BFI_FLINEAR0_933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_932, v ds
+# define BFI_FLINEAR0_933_TICK(t)
+# define BFI_FLINEAR0_932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_931, v ds
+# define BFI_FLINEAR0_932_TICK(t)
+# define BFI_FLINEAR0_931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_930, v ds
+# define BFI_FLINEAR0_931_TICK(t)
+# define BFI_FLINEAR0_930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_929, v ds
+# define BFI_FLINEAR0_930_TICK(t)
+# define BFI_FLINEAR0_929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_928, v ds
+# define BFI_FLINEAR0_929_TICK(t)
+# define BFI_FLINEAR0_928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_927, v ds
+# define BFI_FLINEAR0_928_TICK(t)
+# define BFI_FLINEAR0_927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_926, v ds
+# define BFI_FLINEAR0_927_TICK(t)
+# define BFI_FLINEAR0_926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_925, v ds
+# define BFI_FLINEAR0_926_TICK(t)
+# define BFI_FLINEAR0_925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_924, v ds
+# define BFI_FLINEAR0_925_TICK(t)
+# define BFI_FLINEAR0_924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_923, v ds
+# define BFI_FLINEAR0_924_TICK(t)
+# define BFI_FLINEAR0_923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_922, v ds
+# define BFI_FLINEAR0_923_TICK(t)
+# define BFI_FLINEAR0_922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_921, v ds
+# define BFI_FLINEAR0_922_TICK(t)
+# define BFI_FLINEAR0_921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_920, v ds
+# define BFI_FLINEAR0_921_TICK(t)
+# define BFI_FLINEAR0_920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_919, v ds
+# define BFI_FLINEAR0_920_TICK(t)
+# define BFI_FLINEAR0_919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_918, v ds
+# define BFI_FLINEAR0_919_TICK(t)
+# define BFI_FLINEAR0_918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_917, v ds
+# define BFI_FLINEAR0_918_TICK(t)
+# define BFI_FLINEAR0_917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_916, v ds
+# define BFI_FLINEAR0_917_TICK(t)
+# define BFI_FLINEAR0_916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_915, v ds
+# define BFI_FLINEAR0_916_TICK(t)
+# define BFI_FLINEAR0_915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_914, v ds
+# define BFI_FLINEAR0_915_TICK(t)
+# define BFI_FLINEAR0_914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_913, v ds
+# define BFI_FLINEAR0_914_TICK(t)
+# define BFI_FLINEAR0_913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_912, v ds
+# define BFI_FLINEAR0_913_TICK(t)
+# define BFI_FLINEAR0_912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_911, v ds
+# define BFI_FLINEAR0_912_TICK(t)
+# define BFI_FLINEAR0_911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_910, v ds
+# define BFI_FLINEAR0_911_TICK(t)
+# define BFI_FLINEAR0_910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_909, v ds
+# define BFI_FLINEAR0_910_TICK(t)
+# define BFI_FLINEAR0_909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_908, v ds
+# define BFI_FLINEAR0_909_TICK(t)
+# define BFI_FLINEAR0_908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_907, v ds
+# define BFI_FLINEAR0_908_TICK(t)
+# define BFI_FLINEAR0_907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_906, v ds
+# define BFI_FLINEAR0_907_TICK(t)
+# define BFI_FLINEAR0_906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_905, v ds
+# define BFI_FLINEAR0_906_TICK(t)
+# define BFI_FLINEAR0_905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_904, v ds
+# define BFI_FLINEAR0_905_TICK(t)
+# define BFI_FLINEAR0_904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_903, v ds
+# define BFI_FLINEAR0_904_TICK(t)
+# define BFI_FLINEAR0_903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_902, v ds
+# define BFI_FLINEAR0_903_TICK(t)
+# define BFI_FLINEAR0_902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_901, v ds
+# define BFI_FLINEAR0_902_TICK(t)
+# define BFI_FLINEAR0_901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_900, v ds
+# define BFI_FLINEAR0_901_TICK(t)
+# define BFI_FLINEAR0_900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_899, v ds
+# define BFI_FLINEAR0_900_TICK(t)
+# define BFI_FLINEAR0_899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_898, v ds
+# define BFI_FLINEAR0_899_TICK(t)
+# define BFI_FLINEAR0_898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_897, v ds
+# define BFI_FLINEAR0_898_TICK(t)
+# define BFI_FLINEAR0_897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_896, v ds
+# define BFI_FLINEAR0_897_TICK(t)
+# define BFI_FLINEAR0_896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_895, v ds
+# define BFI_FLINEAR0_896_TICK(t)
+# define BFI_FLINEAR0_895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_894, v ds
+# define BFI_FLINEAR0_895_TICK(t)
+# define BFI_FLINEAR0_894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_893, v ds
+# define BFI_FLINEAR0_894_TICK(t)
+# define BFI_FLINEAR0_893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_892, v ds
+# define BFI_FLINEAR0_893_TICK(t)
+# define BFI_FLINEAR0_892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_891, v ds
+# define BFI_FLINEAR0_892_TICK(t)
+# define BFI_FLINEAR0_891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_890, v ds
+# define BFI_FLINEAR0_891_TICK(t)
+# define BFI_FLINEAR0_890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_889, v ds
+# define BFI_FLINEAR0_890_TICK(t)
+# define BFI_FLINEAR0_889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_888, v ds
+# define BFI_FLINEAR0_889_TICK(t)
+# define BFI_FLINEAR0_888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_887, v ds
+# define BFI_FLINEAR0_888_TICK(t)
+# define BFI_FLINEAR0_887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_886, v ds
+# define BFI_FLINEAR0_887_TICK(t)
+# define BFI_FLINEAR0_886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_885, v ds
+# define BFI_FLINEAR0_886_TICK(t)
+# define BFI_FLINEAR0_885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_884, v ds
+# define BFI_FLINEAR0_885_TICK(t)
+# define BFI_FLINEAR0_884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_883, v ds
+# define BFI_FLINEAR0_884_TICK(t)
+# define BFI_FLINEAR0_883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_882, v ds
+# define BFI_FLINEAR0_883_TICK(t)
+# define BFI_FLINEAR0_882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_881, v ds
+# define BFI_FLINEAR0_882_TICK(t)
+# define BFI_FLINEAR0_881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_880, v ds
+# define BFI_FLINEAR0_881_TICK(t)
+# define BFI_FLINEAR0_880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_879, v ds
+# define BFI_FLINEAR0_880_TICK(t)
+# define BFI_FLINEAR0_879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_878, v ds
+# define BFI_FLINEAR0_879_TICK(t)
+# define BFI_FLINEAR0_878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_877, v ds
+# define BFI_FLINEAR0_878_TICK(t)
+# define BFI_FLINEAR0_877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_876, v ds
+# define BFI_FLINEAR0_877_TICK(t)
+# define BFI_FLINEAR0_876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_875, v ds
+# define BFI_FLINEAR0_876_TICK(t)
+# define BFI_FLINEAR0_875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_874, v ds
+# define BFI_FLINEAR0_875_TICK(t)
+# define BFI_FLINEAR0_874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_873, v ds
+# define BFI_FLINEAR0_874_TICK(t)
+# define BFI_FLINEAR0_873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_872, v ds
+# define BFI_FLINEAR0_873_TICK(t)
+# define BFI_FLINEAR0_872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_871, v ds
+# define BFI_FLINEAR0_872_TICK(t)
+# define BFI_FLINEAR0_871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_870, v ds
+# define BFI_FLINEAR0_871_TICK(t)
+# define BFI_FLINEAR0_870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_869, v ds
+# define BFI_FLINEAR0_870_TICK(t)
+# define BFI_FLINEAR0_869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_868, v ds
+# define BFI_FLINEAR0_869_TICK(t)
+# define BFI_FLINEAR0_868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_867, v ds
+# define BFI_FLINEAR0_868_TICK(t)
+# define BFI_FLINEAR0_867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_866, v ds
+# define BFI_FLINEAR0_867_TICK(t)
+# define BFI_FLINEAR0_866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_865, v ds
+# define BFI_FLINEAR0_866_TICK(t)
+# define BFI_FLINEAR0_865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_864, v ds
+# define BFI_FLINEAR0_865_TICK(t)
+# define BFI_FLINEAR0_864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_863, v ds
+# define BFI_FLINEAR0_864_TICK(t)
+# define BFI_FLINEAR0_863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_862, v ds
+# define BFI_FLINEAR0_863_TICK(t)
+# define BFI_FLINEAR0_862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_861, v ds
+# define BFI_FLINEAR0_862_TICK(t)
+# define BFI_FLINEAR0_861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_860, v ds
+# define BFI_FLINEAR0_861_TICK(t)
+# define BFI_FLINEAR0_860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_859, v ds
+# define BFI_FLINEAR0_860_TICK(t)
+# define BFI_FLINEAR0_859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_858, v ds
+# define BFI_FLINEAR0_859_TICK(t)
+# define BFI_FLINEAR0_858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_857, v ds
+# define BFI_FLINEAR0_858_TICK(t)
+# define BFI_FLINEAR0_857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_856, v ds
+# define BFI_FLINEAR0_857_TICK(t)
+# define BFI_FLINEAR0_856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_855, v ds
+# define BFI_FLINEAR0_856_TICK(t)
+# define BFI_FLINEAR0_855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_854, v ds
+# define BFI_FLINEAR0_855_TICK(t)
+# define BFI_FLINEAR0_854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_853, v ds
+# define BFI_FLINEAR0_854_TICK(t)
+# define BFI_FLINEAR0_853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_852, v ds
+# define BFI_FLINEAR0_853_TICK(t)
+# define BFI_FLINEAR0_852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_851, v ds
+# define BFI_FLINEAR0_852_TICK(t)
+# define BFI_FLINEAR0_851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_850, v ds
+# define BFI_FLINEAR0_851_TICK(t)
+# define BFI_FLINEAR0_850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_849, v ds
+# define BFI_FLINEAR0_850_TICK(t)
+# define BFI_FLINEAR0_849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_848, v ds
+# define BFI_FLINEAR0_849_TICK(t)
+# define BFI_FLINEAR0_848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_847, v ds
+# define BFI_FLINEAR0_848_TICK(t)
+# define BFI_FLINEAR0_847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_846, v ds
+# define BFI_FLINEAR0_847_TICK(t)
+# define BFI_FLINEAR0_846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_845, v ds
+# define BFI_FLINEAR0_846_TICK(t)
+# define BFI_FLINEAR0_845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_844, v ds
+# define BFI_FLINEAR0_845_TICK(t)
+# define BFI_FLINEAR0_844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_843, v ds
+# define BFI_FLINEAR0_844_TICK(t)
+# define BFI_FLINEAR0_843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_842, v ds
+# define BFI_FLINEAR0_843_TICK(t)
+# define BFI_FLINEAR0_842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_841, v ds
+# define BFI_FLINEAR0_842_TICK(t)
+# define BFI_FLINEAR0_841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_840, v ds
+# define BFI_FLINEAR0_841_TICK(t)
+# define BFI_FLINEAR0_840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_839, v ds
+# define BFI_FLINEAR0_840_TICK(t)
+# define BFI_FLINEAR0_839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_838, v ds
+# define BFI_FLINEAR0_839_TICK(t)
+# define BFI_FLINEAR0_838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_837, v ds
+# define BFI_FLINEAR0_838_TICK(t)
+# define BFI_FLINEAR0_837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_836, v ds
+# define BFI_FLINEAR0_837_TICK(t)
+# define BFI_FLINEAR0_836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_835, v ds
+# define BFI_FLINEAR0_836_TICK(t)
+# define BFI_FLINEAR0_835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_834, v ds
+# define BFI_FLINEAR0_835_TICK(t)
+# define BFI_FLINEAR0_834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_833, v ds
+# define BFI_FLINEAR0_834_TICK(t)
+# define BFI_FLINEAR0_833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_832, v ds
+# define BFI_FLINEAR0_833_TICK(t)
+# define BFI_FLINEAR0_832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_831, v ds
+# define BFI_FLINEAR0_832_TICK(t)
+# define BFI_FLINEAR0_831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_830, v ds
+# define BFI_FLINEAR0_831_TICK(t)
+# define BFI_FLINEAR0_830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_829, v ds
+# define BFI_FLINEAR0_830_TICK(t)
+# define BFI_FLINEAR0_829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_828, v ds
+# define BFI_FLINEAR0_829_TICK(t)
+# define BFI_FLINEAR0_828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_827, v ds
+# define BFI_FLINEAR0_828_TICK(t)
+# define BFI_FLINEAR0_827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_826, v ds
+# define BFI_FLINEAR0_827_TICK(t)
+# define BFI_FLINEAR0_826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_825, v ds
+# define BFI_FLINEAR0_826_TICK(t)
+# define BFI_FLINEAR0_825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_824, v ds
+# define BFI_FLINEAR0_825_TICK(t)
+# define BFI_FLINEAR0_824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_823, v ds
+# define BFI_FLINEAR0_824_TICK(t)
+# define BFI_FLINEAR0_823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_822, v ds
+# define BFI_FLINEAR0_823_TICK(t)
+# define BFI_FLINEAR0_822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_821, v ds
+# define BFI_FLINEAR0_822_TICK(t)
+# define BFI_FLINEAR0_821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_820, v ds
+# define BFI_FLINEAR0_821_TICK(t)
+# define BFI_FLINEAR0_820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_819, v ds
+# define BFI_FLINEAR0_820_TICK(t)
+# define BFI_FLINEAR0_819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_818, v ds
+# define BFI_FLINEAR0_819_TICK(t)
+# define BFI_FLINEAR0_818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_817, v ds
+# define BFI_FLINEAR0_818_TICK(t)
+# define BFI_FLINEAR0_817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_816, v ds
+# define BFI_FLINEAR0_817_TICK(t)
+# define BFI_FLINEAR0_816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_815, v ds
+# define BFI_FLINEAR0_816_TICK(t)
+# define BFI_FLINEAR0_815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_814, v ds
+# define BFI_FLINEAR0_815_TICK(t)
+# define BFI_FLINEAR0_814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_813, v ds
+# define BFI_FLINEAR0_814_TICK(t)
+# define BFI_FLINEAR0_813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_812, v ds
+# define BFI_FLINEAR0_813_TICK(t)
+# define BFI_FLINEAR0_812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_811, v ds
+# define BFI_FLINEAR0_812_TICK(t)
+# define BFI_FLINEAR0_811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_810, v ds
+# define BFI_FLINEAR0_811_TICK(t)
+# define BFI_FLINEAR0_810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_809, v ds
+# define BFI_FLINEAR0_810_TICK(t)
+# define BFI_FLINEAR0_809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_808, v ds
+# define BFI_FLINEAR0_809_TICK(t)
+# define BFI_FLINEAR0_808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_807, v ds
+# define BFI_FLINEAR0_808_TICK(t)
+# define BFI_FLINEAR0_807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_806, v ds
+# define BFI_FLINEAR0_807_TICK(t)
+# define BFI_FLINEAR0_806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_805, v ds
+# define BFI_FLINEAR0_806_TICK(t)
+# define BFI_FLINEAR0_805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_804, v ds
+# define BFI_FLINEAR0_805_TICK(t)
+# define BFI_FLINEAR0_804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_803, v ds
+# define BFI_FLINEAR0_804_TICK(t)
+# define BFI_FLINEAR0_803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_802, v ds
+# define BFI_FLINEAR0_803_TICK(t)
+# define BFI_FLINEAR0_802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_801, v ds
+# define BFI_FLINEAR0_802_TICK(t)
+# define BFI_FLINEAR0_801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_800, v ds
+# define BFI_FLINEAR0_801_TICK(t)
+# define BFI_FLINEAR0_800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_799, v ds
+# define BFI_FLINEAR0_800_TICK(t)
+# define BFI_FLINEAR0_799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_798, v ds
+# define BFI_FLINEAR0_799_TICK(t)
+# define BFI_FLINEAR0_798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_797, v ds
+# define BFI_FLINEAR0_798_TICK(t)
+# define BFI_FLINEAR0_797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_796, v ds
+# define BFI_FLINEAR0_797_TICK(t)
+# define BFI_FLINEAR0_796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_795, v ds
+# define BFI_FLINEAR0_796_TICK(t)
+# define BFI_FLINEAR0_795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_794, v ds
+# define BFI_FLINEAR0_795_TICK(t)
+# define BFI_FLINEAR0_794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_793, v ds
+# define BFI_FLINEAR0_794_TICK(t)
+# define BFI_FLINEAR0_793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_792, v ds
+# define BFI_FLINEAR0_793_TICK(t)
+# define BFI_FLINEAR0_792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_791, v ds
+# define BFI_FLINEAR0_792_TICK(t)
+# define BFI_FLINEAR0_791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_790, v ds
+# define BFI_FLINEAR0_791_TICK(t)
+# define BFI_FLINEAR0_790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_789, v ds
+# define BFI_FLINEAR0_790_TICK(t)
+# define BFI_FLINEAR0_789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_788, v ds
+# define BFI_FLINEAR0_789_TICK(t)
+# define BFI_FLINEAR0_788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_787, v ds
+# define BFI_FLINEAR0_788_TICK(t)
+# define BFI_FLINEAR0_787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_786, v ds
+# define BFI_FLINEAR0_787_TICK(t)
+# define BFI_FLINEAR0_786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_785, v ds
+# define BFI_FLINEAR0_786_TICK(t)
+# define BFI_FLINEAR0_785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_784, v ds
+# define BFI_FLINEAR0_785_TICK(t)
+# define BFI_FLINEAR0_784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_783, v ds
+# define BFI_FLINEAR0_784_TICK(t)
+# define BFI_FLINEAR0_783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_782, v ds
+# define BFI_FLINEAR0_783_TICK(t)
+# define BFI_FLINEAR0_782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_781, v ds
+# define BFI_FLINEAR0_782_TICK(t)
+# define BFI_FLINEAR0_781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_780, v ds
+# define BFI_FLINEAR0_781_TICK(t)
+# define BFI_FLINEAR0_780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_779, v ds
+# define BFI_FLINEAR0_780_TICK(t)
+# define BFI_FLINEAR0_779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_778, v ds
+# define BFI_FLINEAR0_779_TICK(t)
+# define BFI_FLINEAR0_778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_777, v ds
+# define BFI_FLINEAR0_778_TICK(t)
+# define BFI_FLINEAR0_777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_776, v ds
+# define BFI_FLINEAR0_777_TICK(t)
+# define BFI_FLINEAR0_776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_775, v ds
+# define BFI_FLINEAR0_776_TICK(t)
+# define BFI_FLINEAR0_775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_774, v ds
+# define BFI_FLINEAR0_775_TICK(t)
+# define BFI_FLINEAR0_774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_773, v ds
+# define BFI_FLINEAR0_774_TICK(t)
+# define BFI_FLINEAR0_773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_772, v ds
+# define BFI_FLINEAR0_773_TICK(t)
+# define BFI_FLINEAR0_772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_771, v ds
+# define BFI_FLINEAR0_772_TICK(t)
+# define BFI_FLINEAR0_771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_770, v ds
+# define BFI_FLINEAR0_771_TICK(t)
+# define BFI_FLINEAR0_770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_769, v ds
+# define BFI_FLINEAR0_770_TICK(t)
+# define BFI_FLINEAR0_769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_768, v ds
+# define BFI_FLINEAR0_769_TICK(t)
+# define BFI_FLINEAR0_768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_767, v ds
+# define BFI_FLINEAR0_768_TICK(t)
+# define BFI_FLINEAR0_767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_766, v ds
+# define BFI_FLINEAR0_767_TICK(t)
+# define BFI_FLINEAR0_766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_765, v ds
+# define BFI_FLINEAR0_766_TICK(t)
+# define BFI_FLINEAR0_765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_764, v ds
+# define BFI_FLINEAR0_765_TICK(t)
+# define BFI_FLINEAR0_764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_763, v ds
+# define BFI_FLINEAR0_764_TICK(t)
+# define BFI_FLINEAR0_763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_762, v ds
+# define BFI_FLINEAR0_763_TICK(t)
+# define BFI_FLINEAR0_762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_761, v ds
+# define BFI_FLINEAR0_762_TICK(t)
+# define BFI_FLINEAR0_761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_760, v ds
+# define BFI_FLINEAR0_761_TICK(t)
+# define BFI_FLINEAR0_760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_759, v ds
+# define BFI_FLINEAR0_760_TICK(t)
+# define BFI_FLINEAR0_759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_758, v ds
+# define BFI_FLINEAR0_759_TICK(t)
+# define BFI_FLINEAR0_758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_757, v ds
+# define BFI_FLINEAR0_758_TICK(t)
+# define BFI_FLINEAR0_757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_756, v ds
+# define BFI_FLINEAR0_757_TICK(t)
+# define BFI_FLINEAR0_756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_755, v ds
+# define BFI_FLINEAR0_756_TICK(t)
+# define BFI_FLINEAR0_755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_754, v ds
+# define BFI_FLINEAR0_755_TICK(t)
+# define BFI_FLINEAR0_754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_753, v ds
+# define BFI_FLINEAR0_754_TICK(t)
+# define BFI_FLINEAR0_753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_752, v ds
+# define BFI_FLINEAR0_753_TICK(t)
+# define BFI_FLINEAR0_752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_751, v ds
+# define BFI_FLINEAR0_752_TICK(t)
+# define BFI_FLINEAR0_751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_750, v ds
+# define BFI_FLINEAR0_751_TICK(t)
+# define BFI_FLINEAR0_750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_749, v ds
+# define BFI_FLINEAR0_750_TICK(t)
+# define BFI_FLINEAR0_749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_748, v ds
+# define BFI_FLINEAR0_749_TICK(t)
+# define BFI_FLINEAR0_748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_747, v ds
+# define BFI_FLINEAR0_748_TICK(t)
+# define BFI_FLINEAR0_747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_746, v ds
+# define BFI_FLINEAR0_747_TICK(t)
+# define BFI_FLINEAR0_746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_745, v ds
+# define BFI_FLINEAR0_746_TICK(t)
+# define BFI_FLINEAR0_745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_744, v ds
+# define BFI_FLINEAR0_745_TICK(t)
+# define BFI_FLINEAR0_744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_743, v ds
+# define BFI_FLINEAR0_744_TICK(t)
+# define BFI_FLINEAR0_743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_742, v ds
+# define BFI_FLINEAR0_743_TICK(t)
+# define BFI_FLINEAR0_742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_741, v ds
+# define BFI_FLINEAR0_742_TICK(t)
+# define BFI_FLINEAR0_741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_740, v ds
+# define BFI_FLINEAR0_741_TICK(t)
+# define BFI_FLINEAR0_740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_739, v ds
+# define BFI_FLINEAR0_740_TICK(t)
+# define BFI_FLINEAR0_739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_738, v ds
+# define BFI_FLINEAR0_739_TICK(t)
+# define BFI_FLINEAR0_738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_737, v ds
+# define BFI_FLINEAR0_738_TICK(t)
+# define BFI_FLINEAR0_737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_736, v ds
+# define BFI_FLINEAR0_737_TICK(t)
+# define BFI_FLINEAR0_736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_735, v ds
+# define BFI_FLINEAR0_736_TICK(t)
+# define BFI_FLINEAR0_735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_734, v ds
+# define BFI_FLINEAR0_735_TICK(t)
+# define BFI_FLINEAR0_734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_733, v ds
+# define BFI_FLINEAR0_734_TICK(t)
+# define BFI_FLINEAR0_733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_732, v ds
+# define BFI_FLINEAR0_733_TICK(t)
+# define BFI_FLINEAR0_732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_731, v ds
+# define BFI_FLINEAR0_732_TICK(t)
+# define BFI_FLINEAR0_731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_730, v ds
+# define BFI_FLINEAR0_731_TICK(t)
+# define BFI_FLINEAR0_730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_729, v ds
+# define BFI_FLINEAR0_730_TICK(t)
+# define BFI_FLINEAR0_729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_728, v ds
+# define BFI_FLINEAR0_729_TICK(t)
+# define BFI_FLINEAR0_728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_727, v ds
+# define BFI_FLINEAR0_728_TICK(t)
+# define BFI_FLINEAR0_727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_726, v ds
+# define BFI_FLINEAR0_727_TICK(t)
+# define BFI_FLINEAR0_726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_725, v ds
+# define BFI_FLINEAR0_726_TICK(t)
+# define BFI_FLINEAR0_725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_724, v ds
+# define BFI_FLINEAR0_725_TICK(t)
+# define BFI_FLINEAR0_724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_723, v ds
+# define BFI_FLINEAR0_724_TICK(t)
+# define BFI_FLINEAR0_723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_722, v ds
+# define BFI_FLINEAR0_723_TICK(t)
+# define BFI_FLINEAR0_722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_721, v ds
+# define BFI_FLINEAR0_722_TICK(t)
+# define BFI_FLINEAR0_721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_720, v ds
+# define BFI_FLINEAR0_721_TICK(t)
+# define BFI_FLINEAR0_720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_719, v ds
+# define BFI_FLINEAR0_720_TICK(t)
+# define BFI_FLINEAR0_719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_718, v ds
+# define BFI_FLINEAR0_719_TICK(t)
+# define BFI_FLINEAR0_718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_717, v ds
+# define BFI_FLINEAR0_718_TICK(t)
+# define BFI_FLINEAR0_717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_716, v ds
+# define BFI_FLINEAR0_717_TICK(t)
+# define BFI_FLINEAR0_716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_715, v ds
+# define BFI_FLINEAR0_716_TICK(t)
+# define BFI_FLINEAR0_715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_714, v ds
+# define BFI_FLINEAR0_715_TICK(t)
+# define BFI_FLINEAR0_714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_713, v ds
+# define BFI_FLINEAR0_714_TICK(t)
+# define BFI_FLINEAR0_713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_712, v ds
+# define BFI_FLINEAR0_713_TICK(t)
+# define BFI_FLINEAR0_712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_711, v ds
+# define BFI_FLINEAR0_712_TICK(t)
+# define BFI_FLINEAR0_711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_710, v ds
+# define BFI_FLINEAR0_711_TICK(t)
+# define BFI_FLINEAR0_710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_709, v ds
+# define BFI_FLINEAR0_710_TICK(t)
+# define BFI_FLINEAR0_709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_708, v ds
+# define BFI_FLINEAR0_709_TICK(t)
+# define BFI_FLINEAR0_708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_707, v ds
+# define BFI_FLINEAR0_708_TICK(t)
+# define BFI_FLINEAR0_707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_706, v ds
+# define BFI_FLINEAR0_707_TICK(t)
+# define BFI_FLINEAR0_706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_705, v ds
+# define BFI_FLINEAR0_706_TICK(t)
+# define BFI_FLINEAR0_705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_704, v ds
+# define BFI_FLINEAR0_705_TICK(t)
+# define BFI_FLINEAR0_704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_703, v ds
+# define BFI_FLINEAR0_704_TICK(t)
+# define BFI_FLINEAR0_703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_702, v ds
+# define BFI_FLINEAR0_703_TICK(t)
+# define BFI_FLINEAR0_702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_701, v ds
+# define BFI_FLINEAR0_702_TICK(t)
+# define BFI_FLINEAR0_701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_700, v ds
+# define BFI_FLINEAR0_701_TICK(t)
+# define BFI_FLINEAR0_700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_699, v ds
+# define BFI_FLINEAR0_700_TICK(t)
+# define BFI_FLINEAR0_699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_698, v ds
+# define BFI_FLINEAR0_699_TICK(t)
+# define BFI_FLINEAR0_698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_697, v ds
+# define BFI_FLINEAR0_698_TICK(t)
+# define BFI_FLINEAR0_697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_696, v ds
+# define BFI_FLINEAR0_697_TICK(t)
+# define BFI_FLINEAR0_696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_695, v ds
+# define BFI_FLINEAR0_696_TICK(t)
+# define BFI_FLINEAR0_695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_694, v ds
+# define BFI_FLINEAR0_695_TICK(t)
+# define BFI_FLINEAR0_694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_693, v ds
+# define BFI_FLINEAR0_694_TICK(t)
+# define BFI_FLINEAR0_693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_692, v ds
+# define BFI_FLINEAR0_693_TICK(t)
+# define BFI_FLINEAR0_692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_691, v ds
+# define BFI_FLINEAR0_692_TICK(t)
+# define BFI_FLINEAR0_691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_690, v ds
+# define BFI_FLINEAR0_691_TICK(t)
+# define BFI_FLINEAR0_690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_689, v ds
+# define BFI_FLINEAR0_690_TICK(t)
+# define BFI_FLINEAR0_689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_688, v ds
+# define BFI_FLINEAR0_689_TICK(t)
+# define BFI_FLINEAR0_688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_687, v ds
+# define BFI_FLINEAR0_688_TICK(t)
+# define BFI_FLINEAR0_687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_686, v ds
+# define BFI_FLINEAR0_687_TICK(t)
+# define BFI_FLINEAR0_686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_685, v ds
+# define BFI_FLINEAR0_686_TICK(t)
+# define BFI_FLINEAR0_685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_684, v ds
+# define BFI_FLINEAR0_685_TICK(t)
+# define BFI_FLINEAR0_684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_683, v ds
+# define BFI_FLINEAR0_684_TICK(t)
+# define BFI_FLINEAR0_683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_682, v ds
+# define BFI_FLINEAR0_683_TICK(t)
+# define BFI_FLINEAR0_682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_681, v ds
+# define BFI_FLINEAR0_682_TICK(t)
+# define BFI_FLINEAR0_681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_680, v ds
+# define BFI_FLINEAR0_681_TICK(t)
+# define BFI_FLINEAR0_680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_679, v ds
+# define BFI_FLINEAR0_680_TICK(t)
+# define BFI_FLINEAR0_679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_678, v ds
+# define BFI_FLINEAR0_679_TICK(t)
+# define BFI_FLINEAR0_678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_677, v ds
+# define BFI_FLINEAR0_678_TICK(t)
+# define BFI_FLINEAR0_677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_676, v ds
+# define BFI_FLINEAR0_677_TICK(t)
+# define BFI_FLINEAR0_676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_675, v ds
+# define BFI_FLINEAR0_676_TICK(t)
+# define BFI_FLINEAR0_675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_674, v ds
+# define BFI_FLINEAR0_675_TICK(t)
+# define BFI_FLINEAR0_674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_673, v ds
+# define BFI_FLINEAR0_674_TICK(t)
+# define BFI_FLINEAR0_673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_672, v ds
+# define BFI_FLINEAR0_673_TICK(t)
+# define BFI_FLINEAR0_672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_671, v ds
+# define BFI_FLINEAR0_672_TICK(t)
+# define BFI_FLINEAR0_671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_670, v ds
+# define BFI_FLINEAR0_671_TICK(t)
+# define BFI_FLINEAR0_670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_669, v ds
+# define BFI_FLINEAR0_670_TICK(t)
+# define BFI_FLINEAR0_669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_668, v ds
+# define BFI_FLINEAR0_669_TICK(t)
+# define BFI_FLINEAR0_668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_667, v ds
+# define BFI_FLINEAR0_668_TICK(t)
+# define BFI_FLINEAR0_667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_666, v ds
+# define BFI_FLINEAR0_667_TICK(t)
+# define BFI_FLINEAR0_666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_665, v ds
+# define BFI_FLINEAR0_666_TICK(t)
+# define BFI_FLINEAR0_665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_664, v ds
+# define BFI_FLINEAR0_665_TICK(t)
+# define BFI_FLINEAR0_664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_663, v ds
+# define BFI_FLINEAR0_664_TICK(t)
+# define BFI_FLINEAR0_663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_662, v ds
+# define BFI_FLINEAR0_663_TICK(t)
+# define BFI_FLINEAR0_662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_661, v ds
+# define BFI_FLINEAR0_662_TICK(t)
+# define BFI_FLINEAR0_661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_660, v ds
+# define BFI_FLINEAR0_661_TICK(t)
+# define BFI_FLINEAR0_660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_659, v ds
+# define BFI_FLINEAR0_660_TICK(t)
+# define BFI_FLINEAR0_659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_658, v ds
+# define BFI_FLINEAR0_659_TICK(t)
+# define BFI_FLINEAR0_658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_657, v ds
+# define BFI_FLINEAR0_658_TICK(t)
+# define BFI_FLINEAR0_657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_656, v ds
+# define BFI_FLINEAR0_657_TICK(t)
+# define BFI_FLINEAR0_656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_655, v ds
+# define BFI_FLINEAR0_656_TICK(t)
+# define BFI_FLINEAR0_655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_654, v ds
+# define BFI_FLINEAR0_655_TICK(t)
+# define BFI_FLINEAR0_654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_653, v ds
+# define BFI_FLINEAR0_654_TICK(t)
+# define BFI_FLINEAR0_653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_652, v ds
+# define BFI_FLINEAR0_653_TICK(t)
+# define BFI_FLINEAR0_652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_651, v ds
+# define BFI_FLINEAR0_652_TICK(t)
+# define BFI_FLINEAR0_651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_650, v ds
+# define BFI_FLINEAR0_651_TICK(t)
+# define BFI_FLINEAR0_650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_649, v ds
+# define BFI_FLINEAR0_650_TICK(t)
+# define BFI_FLINEAR0_649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_648, v ds
+# define BFI_FLINEAR0_649_TICK(t)
+# define BFI_FLINEAR0_648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_647, v ds
+# define BFI_FLINEAR0_648_TICK(t)
+# define BFI_FLINEAR0_647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_646, v ds
+# define BFI_FLINEAR0_647_TICK(t)
+# define BFI_FLINEAR0_646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_645, v ds
+# define BFI_FLINEAR0_646_TICK(t)
+# define BFI_FLINEAR0_645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_644, v ds
+# define BFI_FLINEAR0_645_TICK(t)
+# define BFI_FLINEAR0_644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_643, v ds
+# define BFI_FLINEAR0_644_TICK(t)
+# define BFI_FLINEAR0_643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_642, v ds
+# define BFI_FLINEAR0_643_TICK(t)
+# define BFI_FLINEAR0_642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_641, v ds
+# define BFI_FLINEAR0_642_TICK(t)
+# define BFI_FLINEAR0_641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_640, v ds
+# define BFI_FLINEAR0_641_TICK(t)
+# define BFI_FLINEAR0_640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_639, v ds
+# define BFI_FLINEAR0_640_TICK(t)
+# define BFI_FLINEAR0_639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_638, v ds
+# define BFI_FLINEAR0_639_TICK(t)
+# define BFI_FLINEAR0_638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_637, v ds
+# define BFI_FLINEAR0_638_TICK(t)
+# define BFI_FLINEAR0_637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_636, v ds
+# define BFI_FLINEAR0_637_TICK(t)
+# define BFI_FLINEAR0_636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_635, v ds
+# define BFI_FLINEAR0_636_TICK(t)
+# define BFI_FLINEAR0_635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_634, v ds
+# define BFI_FLINEAR0_635_TICK(t)
+# define BFI_FLINEAR0_634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_633, v ds
+# define BFI_FLINEAR0_634_TICK(t)
+# define BFI_FLINEAR0_633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_632, v ds
+# define BFI_FLINEAR0_633_TICK(t)
+# define BFI_FLINEAR0_632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_631, v ds
+# define BFI_FLINEAR0_632_TICK(t)
+# define BFI_FLINEAR0_631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_630, v ds
+# define BFI_FLINEAR0_631_TICK(t)
+# define BFI_FLINEAR0_630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_629, v ds
+# define BFI_FLINEAR0_630_TICK(t)
+# define BFI_FLINEAR0_629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_628, v ds
+# define BFI_FLINEAR0_629_TICK(t)
+# define BFI_FLINEAR0_628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_627, v ds
+# define BFI_FLINEAR0_628_TICK(t)
+# define BFI_FLINEAR0_627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_626, v ds
+# define BFI_FLINEAR0_627_TICK(t)
+# define BFI_FLINEAR0_626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_625, v ds
+# define BFI_FLINEAR0_626_TICK(t)
+# define BFI_FLINEAR0_625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_624, v ds
+# define BFI_FLINEAR0_625_TICK(t)
+# define BFI_FLINEAR0_624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_623, v ds
+# define BFI_FLINEAR0_624_TICK(t)
+# define BFI_FLINEAR0_623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_622, v ds
+# define BFI_FLINEAR0_623_TICK(t)
+# define BFI_FLINEAR0_622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_621, v ds
+# define BFI_FLINEAR0_622_TICK(t)
+# define BFI_FLINEAR0_621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_620, v ds
+# define BFI_FLINEAR0_621_TICK(t)
+# define BFI_FLINEAR0_620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_619, v ds
+# define BFI_FLINEAR0_620_TICK(t)
+# define BFI_FLINEAR0_619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_618, v ds
+# define BFI_FLINEAR0_619_TICK(t)
+# define BFI_FLINEAR0_618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_617, v ds
+# define BFI_FLINEAR0_618_TICK(t)
+# define BFI_FLINEAR0_617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_616, v ds
+# define BFI_FLINEAR0_617_TICK(t)
+# define BFI_FLINEAR0_616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_615, v ds
+# define BFI_FLINEAR0_616_TICK(t)
+# define BFI_FLINEAR0_615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_614, v ds
+# define BFI_FLINEAR0_615_TICK(t)
+# define BFI_FLINEAR0_614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_613, v ds
+# define BFI_FLINEAR0_614_TICK(t)
+# define BFI_FLINEAR0_613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_612, v ds
+# define BFI_FLINEAR0_613_TICK(t)
+# define BFI_FLINEAR0_612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_611, v ds
+# define BFI_FLINEAR0_612_TICK(t)
+# define BFI_FLINEAR0_611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_610, v ds
+# define BFI_FLINEAR0_611_TICK(t)
+# define BFI_FLINEAR0_610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_609, v ds
+# define BFI_FLINEAR0_610_TICK(t)
+# define BFI_FLINEAR0_609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_608, v ds
+# define BFI_FLINEAR0_609_TICK(t)
+# define BFI_FLINEAR0_608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_607, v ds
+# define BFI_FLINEAR0_608_TICK(t)
+# define BFI_FLINEAR0_607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_606, v ds
+# define BFI_FLINEAR0_607_TICK(t)
+# define BFI_FLINEAR0_606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_605, v ds
+# define BFI_FLINEAR0_606_TICK(t)
+# define BFI_FLINEAR0_605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_604, v ds
+# define BFI_FLINEAR0_605_TICK(t)
+# define BFI_FLINEAR0_604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_603, v ds
+# define BFI_FLINEAR0_604_TICK(t)
+# define BFI_FLINEAR0_603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_602, v ds
+# define BFI_FLINEAR0_603_TICK(t)
+# define BFI_FLINEAR0_602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_601, v ds
+# define BFI_FLINEAR0_602_TICK(t)
+# define BFI_FLINEAR0_601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_600, v ds
+# define BFI_FLINEAR0_601_TICK(t)
+# define BFI_FLINEAR0_600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_599, v ds
+# define BFI_FLINEAR0_600_TICK(t)
+# define BFI_FLINEAR0_599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_598, v ds
+# define BFI_FLINEAR0_599_TICK(t)
+# define BFI_FLINEAR0_598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_597, v ds
+# define BFI_FLINEAR0_598_TICK(t)
+# define BFI_FLINEAR0_597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_596, v ds
+# define BFI_FLINEAR0_597_TICK(t)
+# define BFI_FLINEAR0_596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_595, v ds
+# define BFI_FLINEAR0_596_TICK(t)
+# define BFI_FLINEAR0_595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_594, v ds
+# define BFI_FLINEAR0_595_TICK(t)
+# define BFI_FLINEAR0_594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_593, v ds
+# define BFI_FLINEAR0_594_TICK(t)
+# define BFI_FLINEAR0_593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_592, v ds
+# define BFI_FLINEAR0_593_TICK(t)
+# define BFI_FLINEAR0_592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_591, v ds
+# define BFI_FLINEAR0_592_TICK(t)
+# define BFI_FLINEAR0_591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_590, v ds
+# define BFI_FLINEAR0_591_TICK(t)
+# define BFI_FLINEAR0_590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_589, v ds
+# define BFI_FLINEAR0_590_TICK(t)
+# define BFI_FLINEAR0_589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_588, v ds
+# define BFI_FLINEAR0_589_TICK(t)
+# define BFI_FLINEAR0_588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_587, v ds
+# define BFI_FLINEAR0_588_TICK(t)
+# define BFI_FLINEAR0_587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_586, v ds
+# define BFI_FLINEAR0_587_TICK(t)
+# define BFI_FLINEAR0_586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_585, v ds
+# define BFI_FLINEAR0_586_TICK(t)
+# define BFI_FLINEAR0_585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_584, v ds
+# define BFI_FLINEAR0_585_TICK(t)
+# define BFI_FLINEAR0_584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_583, v ds
+# define BFI_FLINEAR0_584_TICK(t)
+# define BFI_FLINEAR0_583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_582, v ds
+# define BFI_FLINEAR0_583_TICK(t)
+# define BFI_FLINEAR0_582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_581, v ds
+# define BFI_FLINEAR0_582_TICK(t)
+# define BFI_FLINEAR0_581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_580, v ds
+# define BFI_FLINEAR0_581_TICK(t)
+# define BFI_FLINEAR0_580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_579, v ds
+# define BFI_FLINEAR0_580_TICK(t)
+# define BFI_FLINEAR0_579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_578, v ds
+# define BFI_FLINEAR0_579_TICK(t)
+# define BFI_FLINEAR0_578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_577, v ds
+# define BFI_FLINEAR0_578_TICK(t)
+# define BFI_FLINEAR0_577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_576, v ds
+# define BFI_FLINEAR0_577_TICK(t)
+# define BFI_FLINEAR0_576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_575, v ds
+# define BFI_FLINEAR0_576_TICK(t)
+# define BFI_FLINEAR0_575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_574, v ds
+# define BFI_FLINEAR0_575_TICK(t)
+# define BFI_FLINEAR0_574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_573, v ds
+# define BFI_FLINEAR0_574_TICK(t)
+# define BFI_FLINEAR0_573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_572, v ds
+# define BFI_FLINEAR0_573_TICK(t)
+# define BFI_FLINEAR0_572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_571, v ds
+# define BFI_FLINEAR0_572_TICK(t)
+# define BFI_FLINEAR0_571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_570, v ds
+# define BFI_FLINEAR0_571_TICK(t)
+# define BFI_FLINEAR0_570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_569, v ds
+# define BFI_FLINEAR0_570_TICK(t)
+# define BFI_FLINEAR0_569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_568, v ds
+# define BFI_FLINEAR0_569_TICK(t)
+# define BFI_FLINEAR0_568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_567, v ds
+# define BFI_FLINEAR0_568_TICK(t)
+# define BFI_FLINEAR0_567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_566, v ds
+# define BFI_FLINEAR0_567_TICK(t)
+# define BFI_FLINEAR0_566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_565, v ds
+# define BFI_FLINEAR0_566_TICK(t)
+# define BFI_FLINEAR0_565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_564, v ds
+# define BFI_FLINEAR0_565_TICK(t)
+# define BFI_FLINEAR0_564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_563, v ds
+# define BFI_FLINEAR0_564_TICK(t)
+# define BFI_FLINEAR0_563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_562, v ds
+# define BFI_FLINEAR0_563_TICK(t)
+# define BFI_FLINEAR0_562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_561, v ds
+# define BFI_FLINEAR0_562_TICK(t)
+# define BFI_FLINEAR0_561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_560, v ds
+# define BFI_FLINEAR0_561_TICK(t)
+# define BFI_FLINEAR0_560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_559, v ds
+# define BFI_FLINEAR0_560_TICK(t)
+# define BFI_FLINEAR0_559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_558, v ds
+# define BFI_FLINEAR0_559_TICK(t)
+# define BFI_FLINEAR0_558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_557, v ds
+# define BFI_FLINEAR0_558_TICK(t)
+# define BFI_FLINEAR0_557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_556, v ds
+# define BFI_FLINEAR0_557_TICK(t)
+# define BFI_FLINEAR0_556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_555, v ds
+# define BFI_FLINEAR0_556_TICK(t)
+# define BFI_FLINEAR0_555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_554, v ds
+# define BFI_FLINEAR0_555_TICK(t)
+# define BFI_FLINEAR0_554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_553, v ds
+# define BFI_FLINEAR0_554_TICK(t)
+# define BFI_FLINEAR0_553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_552, v ds
+# define BFI_FLINEAR0_553_TICK(t)
+# define BFI_FLINEAR0_552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_551, v ds
+# define BFI_FLINEAR0_552_TICK(t)
+# define BFI_FLINEAR0_551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_550, v ds
+# define BFI_FLINEAR0_551_TICK(t)
+# define BFI_FLINEAR0_550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_549, v ds
+# define BFI_FLINEAR0_550_TICK(t)
+# define BFI_FLINEAR0_549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_548, v ds
+# define BFI_FLINEAR0_549_TICK(t)
+# define BFI_FLINEAR0_548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_547, v ds
+# define BFI_FLINEAR0_548_TICK(t)
+# define BFI_FLINEAR0_547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_546, v ds
+# define BFI_FLINEAR0_547_TICK(t)
+# define BFI_FLINEAR0_546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_545, v ds
+# define BFI_FLINEAR0_546_TICK(t)
+# define BFI_FLINEAR0_545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_544, v ds
+# define BFI_FLINEAR0_545_TICK(t)
+# define BFI_FLINEAR0_544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_543, v ds
+# define BFI_FLINEAR0_544_TICK(t)
+# define BFI_FLINEAR0_543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_542, v ds
+# define BFI_FLINEAR0_543_TICK(t)
+# define BFI_FLINEAR0_542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_541, v ds
+# define BFI_FLINEAR0_542_TICK(t)
+# define BFI_FLINEAR0_541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_540, v ds
+# define BFI_FLINEAR0_541_TICK(t)
+# define BFI_FLINEAR0_540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_539, v ds
+# define BFI_FLINEAR0_540_TICK(t)
+# define BFI_FLINEAR0_539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_538, v ds
+# define BFI_FLINEAR0_539_TICK(t)
+# define BFI_FLINEAR0_538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_537, v ds
+# define BFI_FLINEAR0_538_TICK(t)
+# define BFI_FLINEAR0_537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_536, v ds
+# define BFI_FLINEAR0_537_TICK(t)
+# define BFI_FLINEAR0_536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_535, v ds
+# define BFI_FLINEAR0_536_TICK(t)
+# define BFI_FLINEAR0_535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_534, v ds
+# define BFI_FLINEAR0_535_TICK(t)
+# define BFI_FLINEAR0_534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_533, v ds
+# define BFI_FLINEAR0_534_TICK(t)
+# define BFI_FLINEAR0_533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_532, v ds
+# define BFI_FLINEAR0_533_TICK(t)
+# define BFI_FLINEAR0_532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_531, v ds
+# define BFI_FLINEAR0_532_TICK(t)
+# define BFI_FLINEAR0_531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_530, v ds
+# define BFI_FLINEAR0_531_TICK(t)
+# define BFI_FLINEAR0_530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_529, v ds
+# define BFI_FLINEAR0_530_TICK(t)
+# define BFI_FLINEAR0_529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_528, v ds
+# define BFI_FLINEAR0_529_TICK(t)
+# define BFI_FLINEAR0_528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_527, v ds
+# define BFI_FLINEAR0_528_TICK(t)
+# define BFI_FLINEAR0_527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_526, v ds
+# define BFI_FLINEAR0_527_TICK(t)
+# define BFI_FLINEAR0_526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_525, v ds
+# define BFI_FLINEAR0_526_TICK(t)
+# define BFI_FLINEAR0_525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_524, v ds
+# define BFI_FLINEAR0_525_TICK(t)
+# define BFI_FLINEAR0_524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_523, v ds
+# define BFI_FLINEAR0_524_TICK(t)
+# define BFI_FLINEAR0_523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_522, v ds
+# define BFI_FLINEAR0_523_TICK(t)
+# define BFI_FLINEAR0_522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_521, v ds
+# define BFI_FLINEAR0_522_TICK(t)
+# define BFI_FLINEAR0_521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_520, v ds
+# define BFI_FLINEAR0_521_TICK(t)
+# define BFI_FLINEAR0_520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_519, v ds
+# define BFI_FLINEAR0_520_TICK(t)
+# define BFI_FLINEAR0_519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_518, v ds
+# define BFI_FLINEAR0_519_TICK(t)
+# define BFI_FLINEAR0_518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_517, v ds
+# define BFI_FLINEAR0_518_TICK(t)
+# define BFI_FLINEAR0_517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_516, v ds
+# define BFI_FLINEAR0_517_TICK(t)
+# define BFI_FLINEAR0_516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_515, v ds
+# define BFI_FLINEAR0_516_TICK(t)
+# define BFI_FLINEAR0_515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_514, v ds
+# define BFI_FLINEAR0_515_TICK(t)
+# define BFI_FLINEAR0_514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_513, v ds
+# define BFI_FLINEAR0_514_TICK(t)
+# define BFI_FLINEAR0_513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_512, v ds
+# define BFI_FLINEAR0_513_TICK(t)
+# define BFI_FLINEAR0_512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_511, v ds
+# define BFI_FLINEAR0_512_TICK(t)
+# define BFI_FLINEAR0_511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_510, v ds
+# define BFI_FLINEAR0_511_TICK(t)
+# define BFI_FLINEAR0_510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_509, v ds
+# define BFI_FLINEAR0_510_TICK(t)
+# define BFI_FLINEAR0_509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_508, v ds
+# define BFI_FLINEAR0_509_TICK(t)
+# define BFI_FLINEAR0_508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_507, v ds
+# define BFI_FLINEAR0_508_TICK(t)
+# define BFI_FLINEAR0_507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_506, v ds
+# define BFI_FLINEAR0_507_TICK(t)
+# define BFI_FLINEAR0_506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_505, v ds
+# define BFI_FLINEAR0_506_TICK(t)
+# define BFI_FLINEAR0_505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_504, v ds
+# define BFI_FLINEAR0_505_TICK(t)
+# define BFI_FLINEAR0_504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_503, v ds
+# define BFI_FLINEAR0_504_TICK(t)
+# define BFI_FLINEAR0_503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_502, v ds
+# define BFI_FLINEAR0_503_TICK(t)
+# define BFI_FLINEAR0_502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_501, v ds
+# define BFI_FLINEAR0_502_TICK(t)
+# define BFI_FLINEAR0_501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_500, v ds
+# define BFI_FLINEAR0_501_TICK(t)
+# define BFI_FLINEAR0_500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_499, v ds
+# define BFI_FLINEAR0_500_TICK(t)
+# define BFI_FLINEAR0_499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_498, v ds
+# define BFI_FLINEAR0_499_TICK(t)
+# define BFI_FLINEAR0_498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_497, v ds
+# define BFI_FLINEAR0_498_TICK(t)
+# define BFI_FLINEAR0_497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_496, v ds
+# define BFI_FLINEAR0_497_TICK(t)
+# define BFI_FLINEAR0_496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_495, v ds
+# define BFI_FLINEAR0_496_TICK(t)
+# define BFI_FLINEAR0_495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_494, v ds
+# define BFI_FLINEAR0_495_TICK(t)
+# define BFI_FLINEAR0_494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_493, v ds
+# define BFI_FLINEAR0_494_TICK(t)
+# define BFI_FLINEAR0_493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_492, v ds
+# define BFI_FLINEAR0_493_TICK(t)
+# define BFI_FLINEAR0_492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_491, v ds
+# define BFI_FLINEAR0_492_TICK(t)
+# define BFI_FLINEAR0_491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_490, v ds
+# define BFI_FLINEAR0_491_TICK(t)
+# define BFI_FLINEAR0_490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_489, v ds
+# define BFI_FLINEAR0_490_TICK(t)
+# define BFI_FLINEAR0_489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_488, v ds
+# define BFI_FLINEAR0_489_TICK(t)
+# define BFI_FLINEAR0_488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_487, v ds
+# define BFI_FLINEAR0_488_TICK(t)
+# define BFI_FLINEAR0_487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_486, v ds
+# define BFI_FLINEAR0_487_TICK(t)
+# define BFI_FLINEAR0_486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_485, v ds
+# define BFI_FLINEAR0_486_TICK(t)
+# define BFI_FLINEAR0_485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_484, v ds
+# define BFI_FLINEAR0_485_TICK(t)
+# define BFI_FLINEAR0_484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_483, v ds
+# define BFI_FLINEAR0_484_TICK(t)
+# define BFI_FLINEAR0_483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_482, v ds
+# define BFI_FLINEAR0_483_TICK(t)
+# define BFI_FLINEAR0_482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_481, v ds
+# define BFI_FLINEAR0_482_TICK(t)
+# define BFI_FLINEAR0_481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_480, v ds
+# define BFI_FLINEAR0_481_TICK(t)
+# define BFI_FLINEAR0_480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_479, v ds
+# define BFI_FLINEAR0_480_TICK(t)
+# define BFI_FLINEAR0_479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_478, v ds
+# define BFI_FLINEAR0_479_TICK(t)
+# define BFI_FLINEAR0_478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_477, v ds
+# define BFI_FLINEAR0_478_TICK(t)
+# define BFI_FLINEAR0_477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_476, v ds
+# define BFI_FLINEAR0_477_TICK(t)
+# define BFI_FLINEAR0_476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_475, v ds
+# define BFI_FLINEAR0_476_TICK(t)
+# define BFI_FLINEAR0_475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_474, v ds
+# define BFI_FLINEAR0_475_TICK(t)
+# define BFI_FLINEAR0_474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_473, v ds
+# define BFI_FLINEAR0_474_TICK(t)
+# define BFI_FLINEAR0_473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_472, v ds
+# define BFI_FLINEAR0_473_TICK(t)
+# define BFI_FLINEAR0_472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_471, v ds
+# define BFI_FLINEAR0_472_TICK(t)
+# define BFI_FLINEAR0_471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_470, v ds
+# define BFI_FLINEAR0_471_TICK(t)
+# define BFI_FLINEAR0_470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_469, v ds
+# define BFI_FLINEAR0_470_TICK(t)
+# define BFI_FLINEAR0_469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_468, v ds
+# define BFI_FLINEAR0_469_TICK(t)
+# define BFI_FLINEAR0_468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_467, v ds
+# define BFI_FLINEAR0_468_TICK(t)
+# define BFI_FLINEAR0_467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_466, v ds
+# define BFI_FLINEAR0_467_TICK(t)
+# define BFI_FLINEAR0_466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_465, v ds
+# define BFI_FLINEAR0_466_TICK(t)
+# define BFI_FLINEAR0_465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_464, v ds
+# define BFI_FLINEAR0_465_TICK(t)
+# define BFI_FLINEAR0_464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_463, v ds
+# define BFI_FLINEAR0_464_TICK(t)
+# define BFI_FLINEAR0_463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_462, v ds
+# define BFI_FLINEAR0_463_TICK(t)
+# define BFI_FLINEAR0_462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_461, v ds
+# define BFI_FLINEAR0_462_TICK(t)
+# define BFI_FLINEAR0_461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_460, v ds
+# define BFI_FLINEAR0_461_TICK(t)
+# define BFI_FLINEAR0_460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_459, v ds
+# define BFI_FLINEAR0_460_TICK(t)
+# define BFI_FLINEAR0_459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_458, v ds
+# define BFI_FLINEAR0_459_TICK(t)
+# define BFI_FLINEAR0_458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_457, v ds
+# define BFI_FLINEAR0_458_TICK(t)
+# define BFI_FLINEAR0_457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_456, v ds
+# define BFI_FLINEAR0_457_TICK(t)
+# define BFI_FLINEAR0_456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_455, v ds
+# define BFI_FLINEAR0_456_TICK(t)
+# define BFI_FLINEAR0_455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_454, v ds
+# define BFI_FLINEAR0_455_TICK(t)
+# define BFI_FLINEAR0_454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_453, v ds
+# define BFI_FLINEAR0_454_TICK(t)
+# define BFI_FLINEAR0_453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_452, v ds
+# define BFI_FLINEAR0_453_TICK(t)
+# define BFI_FLINEAR0_452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_451, v ds
+# define BFI_FLINEAR0_452_TICK(t)
+# define BFI_FLINEAR0_451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_450, v ds
+# define BFI_FLINEAR0_451_TICK(t)
+# define BFI_FLINEAR0_450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_449, v ds
+# define BFI_FLINEAR0_450_TICK(t)
+# define BFI_FLINEAR0_449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_448, v ds
+# define BFI_FLINEAR0_449_TICK(t)
+# define BFI_FLINEAR0_448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_447, v ds
+# define BFI_FLINEAR0_448_TICK(t)
+# define BFI_FLINEAR0_447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_446, v ds
+# define BFI_FLINEAR0_447_TICK(t)
+# define BFI_FLINEAR0_446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_445, v ds
+# define BFI_FLINEAR0_446_TICK(t)
+# define BFI_FLINEAR0_445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_444, v ds
+# define BFI_FLINEAR0_445_TICK(t)
+# define BFI_FLINEAR0_444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_443, v ds
+# define BFI_FLINEAR0_444_TICK(t)
+# define BFI_FLINEAR0_443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_442, v ds
+# define BFI_FLINEAR0_443_TICK(t)
+# define BFI_FLINEAR0_442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_441, v ds
+# define BFI_FLINEAR0_442_TICK(t)
+# define BFI_FLINEAR0_441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_440, v ds
+# define BFI_FLINEAR0_441_TICK(t)
+# define BFI_FLINEAR0_440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_439, v ds
+# define BFI_FLINEAR0_440_TICK(t)
+# define BFI_FLINEAR0_439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_438, v ds
+# define BFI_FLINEAR0_439_TICK(t)
+# define BFI_FLINEAR0_438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_437, v ds
+# define BFI_FLINEAR0_438_TICK(t)
+# define BFI_FLINEAR0_437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_436, v ds
+# define BFI_FLINEAR0_437_TICK(t)
+# define BFI_FLINEAR0_436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_435, v ds
+# define BFI_FLINEAR0_436_TICK(t)
+# define BFI_FLINEAR0_435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_434, v ds
+# define BFI_FLINEAR0_435_TICK(t)
+# define BFI_FLINEAR0_434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_433, v ds
+# define BFI_FLINEAR0_434_TICK(t)
+# define BFI_FLINEAR0_433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_432, v ds
+# define BFI_FLINEAR0_433_TICK(t)
+# define BFI_FLINEAR0_432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_431, v ds
+# define BFI_FLINEAR0_432_TICK(t)
+# define BFI_FLINEAR0_431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_430, v ds
+# define BFI_FLINEAR0_431_TICK(t)
+# define BFI_FLINEAR0_430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_429, v ds
+# define BFI_FLINEAR0_430_TICK(t)
+# define BFI_FLINEAR0_429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_428, v ds
+# define BFI_FLINEAR0_429_TICK(t)
+# define BFI_FLINEAR0_428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_427, v ds
+# define BFI_FLINEAR0_428_TICK(t)
+# define BFI_FLINEAR0_427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_426, v ds
+# define BFI_FLINEAR0_427_TICK(t)
+# define BFI_FLINEAR0_426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_425, v ds
+# define BFI_FLINEAR0_426_TICK(t)
+# define BFI_FLINEAR0_425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_424, v ds
+# define BFI_FLINEAR0_425_TICK(t)
+# define BFI_FLINEAR0_424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_423, v ds
+# define BFI_FLINEAR0_424_TICK(t)
+# define BFI_FLINEAR0_423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_422, v ds
+# define BFI_FLINEAR0_423_TICK(t)
+# define BFI_FLINEAR0_422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_421, v ds
+# define BFI_FLINEAR0_422_TICK(t)
+# define BFI_FLINEAR0_421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_420, v ds
+# define BFI_FLINEAR0_421_TICK(t)
+# define BFI_FLINEAR0_420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_419, v ds
+# define BFI_FLINEAR0_420_TICK(t)
+# define BFI_FLINEAR0_419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_418, v ds
+# define BFI_FLINEAR0_419_TICK(t)
+# define BFI_FLINEAR0_418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_417, v ds
+# define BFI_FLINEAR0_418_TICK(t)
+# define BFI_FLINEAR0_417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_416, v ds
+# define BFI_FLINEAR0_417_TICK(t)
+# define BFI_FLINEAR0_416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_415, v ds
+# define BFI_FLINEAR0_416_TICK(t)
+# define BFI_FLINEAR0_415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_414, v ds
+# define BFI_FLINEAR0_415_TICK(t)
+# define BFI_FLINEAR0_414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_413, v ds
+# define BFI_FLINEAR0_414_TICK(t)
+# define BFI_FLINEAR0_413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_412, v ds
+# define BFI_FLINEAR0_413_TICK(t)
+# define BFI_FLINEAR0_412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_411, v ds
+# define BFI_FLINEAR0_412_TICK(t)
+# define BFI_FLINEAR0_411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_410, v ds
+# define BFI_FLINEAR0_411_TICK(t)
+# define BFI_FLINEAR0_410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_409, v ds
+# define BFI_FLINEAR0_410_TICK(t)
+# define BFI_FLINEAR0_409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_408, v ds
+# define BFI_FLINEAR0_409_TICK(t)
+# define BFI_FLINEAR0_408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_407, v ds
+# define BFI_FLINEAR0_408_TICK(t)
+# define BFI_FLINEAR0_407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_406, v ds
+# define BFI_FLINEAR0_407_TICK(t)
+# define BFI_FLINEAR0_406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_405, v ds
+# define BFI_FLINEAR0_406_TICK(t)
+# define BFI_FLINEAR0_405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_404, v ds
+# define BFI_FLINEAR0_405_TICK(t)
+# define BFI_FLINEAR0_404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_403, v ds
+# define BFI_FLINEAR0_404_TICK(t)
+# define BFI_FLINEAR0_403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_402, v ds
+# define BFI_FLINEAR0_403_TICK(t)
+# define BFI_FLINEAR0_402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_401, v ds
+# define BFI_FLINEAR0_402_TICK(t)
+# define BFI_FLINEAR0_401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_400, v ds
+# define BFI_FLINEAR0_401_TICK(t)
+# define BFI_FLINEAR0_400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_399, v ds
+# define BFI_FLINEAR0_400_TICK(t)
+# define BFI_FLINEAR0_399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_398, v ds
+# define BFI_FLINEAR0_399_TICK(t)
+# define BFI_FLINEAR0_398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_397, v ds
+# define BFI_FLINEAR0_398_TICK(t)
+# define BFI_FLINEAR0_397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_396, v ds
+# define BFI_FLINEAR0_397_TICK(t)
+# define BFI_FLINEAR0_396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_395, v ds
+# define BFI_FLINEAR0_396_TICK(t)
+# define BFI_FLINEAR0_395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_394, v ds
+# define BFI_FLINEAR0_395_TICK(t)
+# define BFI_FLINEAR0_394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_393, v ds
+# define BFI_FLINEAR0_394_TICK(t)
+# define BFI_FLINEAR0_393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_392, v ds
+# define BFI_FLINEAR0_393_TICK(t)
+# define BFI_FLINEAR0_392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_391, v ds
+# define BFI_FLINEAR0_392_TICK(t)
+# define BFI_FLINEAR0_391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_390, v ds
+# define BFI_FLINEAR0_391_TICK(t)
+# define BFI_FLINEAR0_390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_389, v ds
+# define BFI_FLINEAR0_390_TICK(t)
+# define BFI_FLINEAR0_389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_388, v ds
+# define BFI_FLINEAR0_389_TICK(t)
+# define BFI_FLINEAR0_388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_387, v ds
+# define BFI_FLINEAR0_388_TICK(t)
+# define BFI_FLINEAR0_387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_386, v ds
+# define BFI_FLINEAR0_387_TICK(t)
+# define BFI_FLINEAR0_386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_385, v ds
+# define BFI_FLINEAR0_386_TICK(t)
+# define BFI_FLINEAR0_385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_384, v ds
+# define BFI_FLINEAR0_385_TICK(t)
+# define BFI_FLINEAR0_384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_383, v ds
+# define BFI_FLINEAR0_384_TICK(t)
+# define BFI_FLINEAR0_383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_382, v ds
+# define BFI_FLINEAR0_383_TICK(t)
+# define BFI_FLINEAR0_382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_381, v ds
+# define BFI_FLINEAR0_382_TICK(t)
+# define BFI_FLINEAR0_381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_380, v ds
+# define BFI_FLINEAR0_381_TICK(t)
+# define BFI_FLINEAR0_380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_379, v ds
+# define BFI_FLINEAR0_380_TICK(t)
+# define BFI_FLINEAR0_379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_378, v ds
+# define BFI_FLINEAR0_379_TICK(t)
+# define BFI_FLINEAR0_378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_377, v ds
+# define BFI_FLINEAR0_378_TICK(t)
+# define BFI_FLINEAR0_377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_376, v ds
+# define BFI_FLINEAR0_377_TICK(t)
+# define BFI_FLINEAR0_376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_375, v ds
+# define BFI_FLINEAR0_376_TICK(t)
+# define BFI_FLINEAR0_375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_374, v ds
+# define BFI_FLINEAR0_375_TICK(t)
+# define BFI_FLINEAR0_374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_373, v ds
+# define BFI_FLINEAR0_374_TICK(t)
+# define BFI_FLINEAR0_373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_372, v ds
+# define BFI_FLINEAR0_373_TICK(t)
+# define BFI_FLINEAR0_372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_371, v ds
+# define BFI_FLINEAR0_372_TICK(t)
+# define BFI_FLINEAR0_371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_370, v ds
+# define BFI_FLINEAR0_371_TICK(t)
+# define BFI_FLINEAR0_370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_369, v ds
+# define BFI_FLINEAR0_370_TICK(t)
+# define BFI_FLINEAR0_369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_368, v ds
+# define BFI_FLINEAR0_369_TICK(t)
+# define BFI_FLINEAR0_368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_367, v ds
+# define BFI_FLINEAR0_368_TICK(t)
+# define BFI_FLINEAR0_367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_366, v ds
+# define BFI_FLINEAR0_367_TICK(t)
+# define BFI_FLINEAR0_366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_365, v ds
+# define BFI_FLINEAR0_366_TICK(t)
+# define BFI_FLINEAR0_365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_364, v ds
+# define BFI_FLINEAR0_365_TICK(t)
+# define BFI_FLINEAR0_364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_363, v ds
+# define BFI_FLINEAR0_364_TICK(t)
+# define BFI_FLINEAR0_363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_362, v ds
+# define BFI_FLINEAR0_363_TICK(t)
+# define BFI_FLINEAR0_362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_361, v ds
+# define BFI_FLINEAR0_362_TICK(t)
+# define BFI_FLINEAR0_361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_360, v ds
+# define BFI_FLINEAR0_361_TICK(t)
+# define BFI_FLINEAR0_360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_359, v ds
+# define BFI_FLINEAR0_360_TICK(t)
+# define BFI_FLINEAR0_359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_358, v ds
+# define BFI_FLINEAR0_359_TICK(t)
+# define BFI_FLINEAR0_358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_357, v ds
+# define BFI_FLINEAR0_358_TICK(t)
+# define BFI_FLINEAR0_357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_356, v ds
+# define BFI_FLINEAR0_357_TICK(t)
+# define BFI_FLINEAR0_356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_355, v ds
+# define BFI_FLINEAR0_356_TICK(t)
+# define BFI_FLINEAR0_355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_354, v ds
+# define BFI_FLINEAR0_355_TICK(t)
+# define BFI_FLINEAR0_354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_353, v ds
+# define BFI_FLINEAR0_354_TICK(t)
+# define BFI_FLINEAR0_353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_352, v ds
+# define BFI_FLINEAR0_353_TICK(t)
+# define BFI_FLINEAR0_352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_351, v ds
+# define BFI_FLINEAR0_352_TICK(t)
+# define BFI_FLINEAR0_351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_350, v ds
+# define BFI_FLINEAR0_351_TICK(t)
+# define BFI_FLINEAR0_350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_349, v ds
+# define BFI_FLINEAR0_350_TICK(t)
+# define BFI_FLINEAR0_349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_348, v ds
+# define BFI_FLINEAR0_349_TICK(t)
+# define BFI_FLINEAR0_348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_347, v ds
+# define BFI_FLINEAR0_348_TICK(t)
+# define BFI_FLINEAR0_347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_346, v ds
+# define BFI_FLINEAR0_347_TICK(t)
+# define BFI_FLINEAR0_346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_345, v ds
+# define BFI_FLINEAR0_346_TICK(t)
+# define BFI_FLINEAR0_345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_344, v ds
+# define BFI_FLINEAR0_345_TICK(t)
+# define BFI_FLINEAR0_344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_343, v ds
+# define BFI_FLINEAR0_344_TICK(t)
+# define BFI_FLINEAR0_343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_342, v ds
+# define BFI_FLINEAR0_343_TICK(t)
+# define BFI_FLINEAR0_342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_341, v ds
+# define BFI_FLINEAR0_342_TICK(t)
+# define BFI_FLINEAR0_341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_340, v ds
+# define BFI_FLINEAR0_341_TICK(t)
+# define BFI_FLINEAR0_340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_339, v ds
+# define BFI_FLINEAR0_340_TICK(t)
+# define BFI_FLINEAR0_339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_338, v ds
+# define BFI_FLINEAR0_339_TICK(t)
+# define BFI_FLINEAR0_338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_337, v ds
+# define BFI_FLINEAR0_338_TICK(t)
+# define BFI_FLINEAR0_337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_336, v ds
+# define BFI_FLINEAR0_337_TICK(t)
+# define BFI_FLINEAR0_336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_335, v ds
+# define BFI_FLINEAR0_336_TICK(t)
+# define BFI_FLINEAR0_335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_334, v ds
+# define BFI_FLINEAR0_335_TICK(t)
+# define BFI_FLINEAR0_334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_333, v ds
+# define BFI_FLINEAR0_334_TICK(t)
+# define BFI_FLINEAR0_333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_332, v ds
+# define BFI_FLINEAR0_333_TICK(t)
+# define BFI_FLINEAR0_332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_331, v ds
+# define BFI_FLINEAR0_332_TICK(t)
+# define BFI_FLINEAR0_331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_330, v ds
+# define BFI_FLINEAR0_331_TICK(t)
+# define BFI_FLINEAR0_330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_329, v ds
+# define BFI_FLINEAR0_330_TICK(t)
+# define BFI_FLINEAR0_329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_328, v ds
+# define BFI_FLINEAR0_329_TICK(t)
+# define BFI_FLINEAR0_328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_327, v ds
+# define BFI_FLINEAR0_328_TICK(t)
+# define BFI_FLINEAR0_327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_326, v ds
+# define BFI_FLINEAR0_327_TICK(t)
+# define BFI_FLINEAR0_326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_325, v ds
+# define BFI_FLINEAR0_326_TICK(t)
+# define BFI_FLINEAR0_325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_324, v ds
+# define BFI_FLINEAR0_325_TICK(t)
+# define BFI_FLINEAR0_324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_323, v ds
+# define BFI_FLINEAR0_324_TICK(t)
+# define BFI_FLINEAR0_323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_322, v ds
+# define BFI_FLINEAR0_323_TICK(t)
+# define BFI_FLINEAR0_322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_321, v ds
+# define BFI_FLINEAR0_322_TICK(t)
+# define BFI_FLINEAR0_321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_320, v ds
+# define BFI_FLINEAR0_321_TICK(t)
+# define BFI_FLINEAR0_320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_319, v ds
+# define BFI_FLINEAR0_320_TICK(t)
+# define BFI_FLINEAR0_319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_318, v ds
+# define BFI_FLINEAR0_319_TICK(t)
+# define BFI_FLINEAR0_318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_317, v ds
+# define BFI_FLINEAR0_318_TICK(t)
+# define BFI_FLINEAR0_317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_316, v ds
+# define BFI_FLINEAR0_317_TICK(t)
+# define BFI_FLINEAR0_316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_315, v ds
+# define BFI_FLINEAR0_316_TICK(t)
+# define BFI_FLINEAR0_315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_314, v ds
+# define BFI_FLINEAR0_315_TICK(t)
+# define BFI_FLINEAR0_314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_313, v ds
+# define BFI_FLINEAR0_314_TICK(t)
+# define BFI_FLINEAR0_313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_312, v ds
+# define BFI_FLINEAR0_313_TICK(t)
+# define BFI_FLINEAR0_312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_311, v ds
+# define BFI_FLINEAR0_312_TICK(t)
+# define BFI_FLINEAR0_311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_310, v ds
+# define BFI_FLINEAR0_311_TICK(t)
+# define BFI_FLINEAR0_310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_309, v ds
+# define BFI_FLINEAR0_310_TICK(t)
+# define BFI_FLINEAR0_309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_308, v ds
+# define BFI_FLINEAR0_309_TICK(t)
+# define BFI_FLINEAR0_308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_307, v ds
+# define BFI_FLINEAR0_308_TICK(t)
+# define BFI_FLINEAR0_307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_306, v ds
+# define BFI_FLINEAR0_307_TICK(t)
+# define BFI_FLINEAR0_306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_305, v ds
+# define BFI_FLINEAR0_306_TICK(t)
+# define BFI_FLINEAR0_305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_304, v ds
+# define BFI_FLINEAR0_305_TICK(t)
+# define BFI_FLINEAR0_304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_303, v ds
+# define BFI_FLINEAR0_304_TICK(t)
+# define BFI_FLINEAR0_303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_302, v ds
+# define BFI_FLINEAR0_303_TICK(t)
+# define BFI_FLINEAR0_302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_301, v ds
+# define BFI_FLINEAR0_302_TICK(t)
+# define BFI_FLINEAR0_301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_300, v ds
+# define BFI_FLINEAR0_301_TICK(t)
+# define BFI_FLINEAR0_300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_299, v ds
+# define BFI_FLINEAR0_300_TICK(t)
+# define BFI_FLINEAR0_299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_298, v ds
+# define BFI_FLINEAR0_299_TICK(t)
+# define BFI_FLINEAR0_298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_297, v ds
+# define BFI_FLINEAR0_298_TICK(t)
+# define BFI_FLINEAR0_297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_296, v ds
+# define BFI_FLINEAR0_297_TICK(t)
+# define BFI_FLINEAR0_296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_295, v ds
+# define BFI_FLINEAR0_296_TICK(t)
+# define BFI_FLINEAR0_295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_294, v ds
+# define BFI_FLINEAR0_295_TICK(t)
+# define BFI_FLINEAR0_294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_293, v ds
+# define BFI_FLINEAR0_294_TICK(t)
+# define BFI_FLINEAR0_293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_292, v ds
+# define BFI_FLINEAR0_293_TICK(t)
+# define BFI_FLINEAR0_292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_291, v ds
+# define BFI_FLINEAR0_292_TICK(t)
+# define BFI_FLINEAR0_291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_290, v ds
+# define BFI_FLINEAR0_291_TICK(t)
+# define BFI_FLINEAR0_290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_289, v ds
+# define BFI_FLINEAR0_290_TICK(t)
+# define BFI_FLINEAR0_289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_288, v ds
+# define BFI_FLINEAR0_289_TICK(t)
+# define BFI_FLINEAR0_288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_287, v ds
+# define BFI_FLINEAR0_288_TICK(t)
+# define BFI_FLINEAR0_287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_286, v ds
+# define BFI_FLINEAR0_287_TICK(t)
+# define BFI_FLINEAR0_286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_285, v ds
+# define BFI_FLINEAR0_286_TICK(t)
+# define BFI_FLINEAR0_285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_284, v ds
+# define BFI_FLINEAR0_285_TICK(t)
+# define BFI_FLINEAR0_284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_283, v ds
+# define BFI_FLINEAR0_284_TICK(t)
+# define BFI_FLINEAR0_283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_282, v ds
+# define BFI_FLINEAR0_283_TICK(t)
+# define BFI_FLINEAR0_282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_281, v ds
+# define BFI_FLINEAR0_282_TICK(t)
+# define BFI_FLINEAR0_281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_280, v ds
+# define BFI_FLINEAR0_281_TICK(t)
+# define BFI_FLINEAR0_280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_279, v ds
+# define BFI_FLINEAR0_280_TICK(t)
+# define BFI_FLINEAR0_279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_278, v ds
+# define BFI_FLINEAR0_279_TICK(t)
+# define BFI_FLINEAR0_278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_277, v ds
+# define BFI_FLINEAR0_278_TICK(t)
+# define BFI_FLINEAR0_277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_276, v ds
+# define BFI_FLINEAR0_277_TICK(t)
+# define BFI_FLINEAR0_276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_275, v ds
+# define BFI_FLINEAR0_276_TICK(t)
+# define BFI_FLINEAR0_275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_274, v ds
+# define BFI_FLINEAR0_275_TICK(t)
+# define BFI_FLINEAR0_274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_273, v ds
+# define BFI_FLINEAR0_274_TICK(t)
+# define BFI_FLINEAR0_273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_272, v ds
+# define BFI_FLINEAR0_273_TICK(t)
+# define BFI_FLINEAR0_272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_271, v ds
+# define BFI_FLINEAR0_272_TICK(t)
+# define BFI_FLINEAR0_271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_270, v ds
+# define BFI_FLINEAR0_271_TICK(t)
+# define BFI_FLINEAR0_270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_269, v ds
+# define BFI_FLINEAR0_270_TICK(t)
+# define BFI_FLINEAR0_269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_268, v ds
+# define BFI_FLINEAR0_269_TICK(t)
+# define BFI_FLINEAR0_268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_267, v ds
+# define BFI_FLINEAR0_268_TICK(t)
+# define BFI_FLINEAR0_267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_266, v ds
+# define BFI_FLINEAR0_267_TICK(t)
+# define BFI_FLINEAR0_266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_265, v ds
+# define BFI_FLINEAR0_266_TICK(t)
+# define BFI_FLINEAR0_265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_264, v ds
+# define BFI_FLINEAR0_265_TICK(t)
+# define BFI_FLINEAR0_264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_263, v ds
+# define BFI_FLINEAR0_264_TICK(t)
+# define BFI_FLINEAR0_263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_262, v ds
+# define BFI_FLINEAR0_263_TICK(t)
+# define BFI_FLINEAR0_262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_261, v ds
+# define BFI_FLINEAR0_262_TICK(t)
+# define BFI_FLINEAR0_261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_260, v ds
+# define BFI_FLINEAR0_261_TICK(t)
+# define BFI_FLINEAR0_260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_259, v ds
+# define BFI_FLINEAR0_260_TICK(t)
+# define BFI_FLINEAR0_259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_258, v ds
+# define BFI_FLINEAR0_259_TICK(t)
+# define BFI_FLINEAR0_258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_257, v ds
+# define BFI_FLINEAR0_258_TICK(t)
+# define BFI_FLINEAR0_257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_256, v ds
+# define BFI_FLINEAR0_257_TICK(t)
+
+# endif
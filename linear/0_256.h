@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_0_256_H
+# define BFI_LINEAR_0_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR0_256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_255, v ds
+# define BFI_FLINEAR0_256_TICK(t)
+# define BFI_FLINEAR0_255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_254, v ds
+# define BFI_FLINEAR0_255_TICK(t)
+# define BFI_FLINEAR0_254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_253, v ds
+# define BFI_FLINEAR0_254_TICK(t)
+# define BFI_FLINEAR0_253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_252, v ds
+# define BFI_FLINEAR0_253_TICK(t)
+# define BFI_FLINEAR0_252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_251, v ds
+# define BFI_FLINEAR0_252_TICK(t)
+# define BFI_FLINEAR0_251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_250, v ds
+# define BFI_FLINEAR0_251_TICK(t)
+# define BFI_FLINEAR0_250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_249, v ds
+# define BFI_FLINEAR0_250_TICK(t)
+# define BFI_FLINEAR0_249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_248, v ds
+# define BFI_FLINEAR0_249_TICK(t)
+# define BFI_FLINEAR0_248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_247, v ds
+# define BFI_FLINEAR0_248_TICK(t)
+# define BFI_FLINEAR0_247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_246, v ds
+# define BFI_FLINEAR0_247_TICK(t)
+# define BFI_FLINEAR0_246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_245, v ds
+# define BFI_FLINEAR0_246_TICK(t)
+# define BFI_FLINEAR0_245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_244, v ds
+# define BFI_FLINEAR0_245_TICK(t)
+# define BFI_FLINEAR0_244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_243, v ds
+# define BFI_FLINEAR0_244_TICK(t)
+# define BFI_FLINEAR0_243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_242, v ds
+# define BFI_FLINEAR0_243_TICK(t)
+# define BFI_FLINEAR0_242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_241, v ds
+# define BFI_FLINEAR0_242_TICK(t)
+# define BFI_FLINEAR0_241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_240, v ds
+# define BFI_FLINEAR0_241_TICK(t)
+# define BFI_FLINEAR0_240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_239, v ds
+# define BFI_FLINEAR0_240_TICK(t)
+# define BFI_FLINEAR0_239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_238, v ds
+# define BFI_FLINEAR0_239_TICK(t)
+# define BFI_FLINEAR0_238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_237, v ds
+# define BFI_FLINEAR0_238_TICK(t)
+# define BFI_FLINEAR0_237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_236, v ds
+# define BFI_FLINEAR0_237_TICK(t)
+# define BFI_FLINEAR0_236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_235, v ds
+# define BFI_FLINEAR0_236_TICK(t)
+# define BFI_FLINEAR0_235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_234, v ds
+# define BFI_FLINEAR0_235_TICK(t)
+# define BFI_FLINEAR0_234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_233, v ds
+# define BFI_FLINEAR0_234_TICK(t)
+# define BFI_FLINEAR0_233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_232, v ds
+# define BFI_FLINEAR0_233_TICK(t)
+# define BFI_FLINEAR0_232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_231, v ds
+# define BFI_FLINEAR0_232_TICK(t)
+# define BFI_FLINEAR0_231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_230, v ds
+# define BFI_FLINEAR0_231_TICK(t)
+# define BFI_FLINEAR0_230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_229, v ds
+# define BFI_FLINEAR0_230_TICK(t)
+# define BFI_FLINEAR0_229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_228, v ds
+# define BFI_FLINEAR0_229_TICK(t)
+# define BFI_FLINEAR0_228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_227, v ds
+# define BFI_FLINEAR0_228_TICK(t)
+# define BFI_FLINEAR0_227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_226, v ds
+# define BFI_FLINEAR0_227_TICK(t)
+# define BFI_FLINEAR0_226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_225, v ds
+# define BFI_FLINEAR0_226_TICK(t)
+# define BFI_FLINEAR0_225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_224, v ds
+# define BFI_FLINEAR0_225_TICK(t)
+# define BFI_FLINEAR0_224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_223, v ds
+# define BFI_FLINEAR0_224_TICK(t)
+# define BFI_FLINEAR0_223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_222, v ds
+# define BFI_FLINEAR0_223_TICK(t)
+# define BFI_FLINEAR0_222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_221, v ds
+# define BFI_FLINEAR0_222_TICK(t)
+# define BFI_FLINEAR0_221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_220, v ds
+# define BFI_FLINEAR0_221_TICK(t)
+# define BFI_FLINEAR0_220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_219, v ds
+# define BFI_FLINEAR0_220_TICK(t)
+# define BFI_FLINEAR0_219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_218, v ds
+# define BFI_FLINEAR0_219_TICK(t)
+# define BFI_FLINEAR0_218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_217, v ds
+# define BFI_FLINEAR0_218_TICK(t)
+# define BFI_FLINEAR0_217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_216, v ds
+# define BFI_FLINEAR0_217_TICK(t)
+# define BFI_FLINEAR0_216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_215, v ds
+# define BFI_FLINEAR0_216_TICK(t)
+# define BFI_FLINEAR0_215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_214, v ds
+# define BFI_FLINEAR0_215_TICK(t)
+# define BFI_FLINEAR0_214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_213, v ds
+# define BFI_FLINEAR0_214_TICK(t)
+# define BFI_FLINEAR0_213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_212, v ds
+# define BFI_FLINEAR0_213_TICK(t)
+# define BFI_FLINEAR0_212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_211, v ds
+# define BFI_FLINEAR0_212_TICK(t)
+# define BFI_FLINEAR0_211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_210, v ds
+# define BFI_FLINEAR0_211_TICK(t)
+# define BFI_FLINEAR0_210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_209, v ds
+# define BFI_FLINEAR0_210_TICK(t)
+# define BFI_FLINEAR0_209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_208, v ds
+# define BFI_FLINEAR0_209_TICK(t)
+# define BFI_FLINEAR0_208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_207, v ds
+# define BFI_FLINEAR0_208_TICK(t)
+# define BFI_FLINEAR0_207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_206, v ds
+# define BFI_FLINEAR0_207_TICK(t)
+# define BFI_FLINEAR0_206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_205, v ds
+# define BFI_FLINEAR0_206_TICK(t)
+# define BFI_FLINEAR0_205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_204, v ds
+# define BFI_FLINEAR0_205_TICK(t)
+# define BFI_FLINEAR0_204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_203, v ds
+# define BFI_FLINEAR0_204_TICK(t)
+# define BFI_FLINEAR0_203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_202, v ds
+# define BFI_FLINEAR0_203_TICK(t)
+# define BFI_FLINEAR0_202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_201, v ds
+# define BFI_FLINEAR0_202_TICK(t)
+# define BFI_FLINEAR0_201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_200, v ds
+# define BFI_FLINEAR0_201_TICK(t)
+# define BFI_FLINEAR0_200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_199, v ds
+# define BFI_FLINEAR0_200_TICK(t)
+# define BFI_FLINEAR0_199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_198, v ds
+# define BFI_FLINEAR0_199_TICK(t)
+# define BFI_FLINEAR0_198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_197, v ds
+# define BFI_FLINEAR0_198_TICK(t)
+# define BFI_FLINEAR0_197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_196, v ds
+# define BFI_FLINEAR0_197_TICK(t)
+# define BFI_FLINEAR0_196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_195, v ds
+# define BFI_FLINEAR0_196_TICK(t)
+# define BFI_FLINEAR0_195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_194, v ds
+# define BFI_FLINEAR0_195_TICK(t)
+# define BFI_FLINEAR0_194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_193, v ds
+# define BFI_FLINEAR0_194_TICK(t)
+# define BFI_FLINEAR0_193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_192, v ds
+# define BFI_FLINEAR0_193_TICK(t)
+# define BFI_FLINEAR0_192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_191, v ds
+# define BFI_FLINEAR0_192_TICK(t)
+# define BFI_FLINEAR0_191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_190, v ds
+# define BFI_FLINEAR0_191_TICK(t)
+# define BFI_FLINEAR0_190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_189, v ds
+# define BFI_FLINEAR0_190_TICK(t)
+# define BFI_FLINEAR0_189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_188, v ds
+# define BFI_FLINEAR0_189_TICK(t)
+# define BFI_FLINEAR0_188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_187, v ds
+# define BFI_FLINEAR0_188_TICK(t)
+# define BFI_FLINEAR0_187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_186, v ds
+# define BFI_FLINEAR0_187_TICK(t)
+# define BFI_FLINEAR0_186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_185, v ds
+# define BFI_FLINEAR0_186_TICK(t)
+# define BFI_FLINEAR0_185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_184, v ds
+# define BFI_FLINEAR0_185_TICK(t)
+# define BFI_FLINEAR0_184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_183, v ds
+# define BFI_FLINEAR0_184_TICK(t)
+# define BFI_FLINEAR0_183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_182, v ds
+# define BFI_FLINEAR0_183_TICK(t)
+# define BFI_FLINEAR0_182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_181, v ds
+# define BFI_FLINEAR0_182_TICK(t)
+# define BFI_FLINEAR0_181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_180, v ds
+# define BFI_FLINEAR0_181_TICK(t)
+# define BFI_FLINEAR0_180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_179, v ds
+# define BFI_FLINEAR0_180_TICK(t)
+# define BFI_FLINEAR0_179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_178, v ds
+# define BFI_FLINEAR0_179_TICK(t)
+# define BFI_FLINEAR0_178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_177, v ds
+# define BFI_FLINEAR0_178_TICK(t)
+# define BFI_FLINEAR0_177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_176, v ds
+# define BFI_FLINEAR0_177_TICK(t)
+# define BFI_FLINEAR0_176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_175, v ds
+# define BFI_FLINEAR0_176_TICK(t)
+# define BFI_FLINEAR0_175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_174, v ds
+# define BFI_FLINEAR0_175_TICK(t)
+# define BFI_FLINEAR0_174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_173, v ds
+# define BFI_FLINEAR0_174_TICK(t)
+# define BFI_FLINEAR0_173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_172, v ds
+# define BFI_FLINEAR0_173_TICK(t)
+# define BFI_FLINEAR0_172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_171, v ds
+# define BFI_FLINEAR0_172_TICK(t)
+# define BFI_FLINEAR0_171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_170, v ds
+# define BFI_FLINEAR0_171_TICK(t)
+# define BFI_FLINEAR0_170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_169, v ds
+# define BFI_FLINEAR0_170_TICK(t)
+# define BFI_FLINEAR0_169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_168, v ds
+# define BFI_FLINEAR0_169_TICK(t)
+# define BFI_FLINEAR0_168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_167, v ds
+# define BFI_FLINEAR0_168_TICK(t)
+# define BFI_FLINEAR0_167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_166, v ds
+# define BFI_FLINEAR0_167_TICK(t)
+# define BFI_FLINEAR0_166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_165, v ds
+# define BFI_FLINEAR0_166_TICK(t)
+# define BFI_FLINEAR0_165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_164, v ds
+# define BFI_FLINEAR0_165_TICK(t)
+# define BFI_FLINEAR0_164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_163, v ds
+# define BFI_FLINEAR0_164_TICK(t)
+# define BFI_FLINEAR0_163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_162, v ds
+# define BFI_FLINEAR0_163_TICK(t)
+# define BFI_FLINEAR0_162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_161, v ds
+# define BFI_FLINEAR0_162_TICK(t)
+# define BFI_FLINEAR0_161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_160, v ds
+# define BFI_FLINEAR0_161_TICK(t)
+# define BFI_FLINEAR0_160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_159, v ds
+# define BFI_FLINEAR0_160_TICK(t)
+# define BFI_FLINEAR0_159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_158, v ds
+# define BFI_FLINEAR0_159_TICK(t)
+# define BFI_FLINEAR0_158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_157, v ds
+# define BFI_FLINEAR0_158_TICK(t)
+# define BFI_FLINEAR0_157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_156, v ds
+# define BFI_FLINEAR0_157_TICK(t)
+# define BFI_FLINEAR0_156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_155, v ds
+# define BFI_FLINEAR0_156_TICK(t)
+# define BFI_FLINEAR0_155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_154, v ds
+# define BFI_FLINEAR0_155_TICK(t)
+# define BFI_FLINEAR0_154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_153, v ds
+# define BFI_FLINEAR0_154_TICK(t)
+# define BFI_FLINEAR0_153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_152, v ds
+# define BFI_FLINEAR0_153_TICK(t)
+# define BFI_FLINEAR0_152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_151, v ds
+# define BFI_FLINEAR0_152_TICK(t)
+# define BFI_FLINEAR0_151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_150, v ds
+# define BFI_FLINEAR0_151_TICK(t)
+# define BFI_FLINEAR0_150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_149, v ds
+# define BFI_FLINEAR0_150_TICK(t)
+# define BFI_FLINEAR0_149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_148, v ds
+# define BFI_FLINEAR0_149_TICK(t)
+# define BFI_FLINEAR0_148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_147, v ds
+# define BFI_FLINEAR0_148_TICK(t)
+# define BFI_FLINEAR0_147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_146, v ds
+# define BFI_FLINEAR0_147_TICK(t)
+# define BFI_FLINEAR0_146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_145, v ds
+# define BFI_FLINEAR0_146_TICK(t)
+# define BFI_FLINEAR0_145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_144, v ds
+# define BFI_FLINEAR0_145_TICK(t)
+# define BFI_FLINEAR0_144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_143, v ds
+# define BFI_FLINEAR0_144_TICK(t)
+# define BFI_FLINEAR0_143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_142, v ds
+# define BFI_FLINEAR0_143_TICK(t)
+# define BFI_FLINEAR0_142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_141, v ds
+# define BFI_FLINEAR0_142_TICK(t)
+# define BFI_FLINEAR0_141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_140, v ds
+# define BFI_FLINEAR0_141_TICK(t)
+# define BFI_FLINEAR0_140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_139, v ds
+# define BFI_FLINEAR0_140_TICK(t)
+# define BFI_FLINEAR0_139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_138, v ds
+# define BFI_FLINEAR0_139_TICK(t)
+# define BFI_FLINEAR0_138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_137, v ds
+# define BFI_FLINEAR0_138_TICK(t)
+# define BFI_FLINEAR0_137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_136, v ds
+# define BFI_FLINEAR0_137_TICK(t)
+# define BFI_FLINEAR0_136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_135, v ds
+# define BFI_FLINEAR0_136_TICK(t)
+# define BFI_FLINEAR0_135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_134, v ds
+# define BFI_FLINEAR0_135_TICK(t)
+# define BFI_FLINEAR0_134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_133, v ds
+# define BFI_FLINEAR0_134_TICK(t)
+# define BFI_FLINEAR0_133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_132, v ds
+# define BFI_FLINEAR0_133_TICK(t)
+# define BFI_FLINEAR0_132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_131, v ds
+# define BFI_FLINEAR0_132_TICK(t)
+# define BFI_FLINEAR0_131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_130, v ds
+# define BFI_FLINEAR0_131_TICK(t)
+# define BFI_FLINEAR0_130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_129, v ds
+# define BFI_FLINEAR0_130_TICK(t)
+# define BFI_FLINEAR0_129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_128, v ds
+# define BFI_FLINEAR0_129_TICK(t)
+# define BFI_FLINEAR0_128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_127, v ds
+# define BFI_FLINEAR0_128_TICK(t)
+# define BFI_FLINEAR0_127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_126, v ds
+# define BFI_FLINEAR0_127_TICK(t)
+# define BFI_FLINEAR0_126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_125, v ds
+# define BFI_FLINEAR0_126_TICK(t)
+# define BFI_FLINEAR0_125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_124, v ds
+# define BFI_FLINEAR0_125_TICK(t)
+# define BFI_FLINEAR0_124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_123, v ds
+# define BFI_FLINEAR0_124_TICK(t)
+# define BFI_FLINEAR0_123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_122, v ds
+# define BFI_FLINEAR0_123_TICK(t)
+# define BFI_FLINEAR0_122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_121, v ds
+# define BFI_FLINEAR0_122_TICK(t)
+# define BFI_FLINEAR0_121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_120, v ds
+# define BFI_FLINEAR0_121_TICK(t)
+# define BFI_FLINEAR0_120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_119, v ds
+# define BFI_FLINEAR0_120_TICK(t)
+# define BFI_FLINEAR0_119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_118, v ds
+# define BFI_FLINEAR0_119_TICK(t)
+# define BFI_FLINEAR0_118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_117, v ds
+# define BFI_FLINEAR0_118_TICK(t)
+# define BFI_FLINEAR0_117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_116, v ds
+# define BFI_FLINEAR0_117_TICK(t)
+# define BFI_FLINEAR0_116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_115, v ds
+# define BFI_FLINEAR0_116_TICK(t)
+# define BFI_FLINEAR0_115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_114, v ds
+# define BFI_FLINEAR0_115_TICK(t)
+# define BFI_FLINEAR0_114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_113, v ds
+# define BFI_FLINEAR0_114_TICK(t)
+# define BFI_FLINEAR0_113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_112, v ds
+# define BFI_FLINEAR0_113_TICK(t)
+# define BFI_FLINEAR0_112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_111, v ds
+# define BFI_FLINEAR0_112_TICK(t)
+# define BFI_FLINEAR0_111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_110, v ds
+# define BFI_FLINEAR0_111_TICK(t)
+# define BFI_FLINEAR0_110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_109, v ds
+# define BFI_FLINEAR0_110_TICK(t)
+# define BFI_FLINEAR0_109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_108, v ds
+# define BFI_FLINEAR0_109_TICK(t)
+# define BFI_FLINEAR0_108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_107, v ds
+# define BFI_FLINEAR0_108_TICK(t)
+# define BFI_FLINEAR0_107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_106, v ds
+# define BFI_FLINEAR0_107_TICK(t)
+# define BFI_FLINEAR0_106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_105, v ds
+# define BFI_FLINEAR0_106_TICK(t)
+# define BFI_FLINEAR0_105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_104, v ds
+# define BFI_FLINEAR0_105_TICK(t)
+# define BFI_FLINEAR0_104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_103, v ds
+# define BFI_FLINEAR0_104_TICK(t)
+# define BFI_FLINEAR0_103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_102, v ds
+# define BFI_FLINEAR0_103_TICK(t)
+# define BFI_FLINEAR0_102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_101, v ds
+# define BFI_FLINEAR0_102_TICK(t)
+# define BFI_FLINEAR0_101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_100, v ds
+# define BFI_FLINEAR0_101_TICK(t)
+# define BFI_FLINEAR0_100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_99, v ds
+# define BFI_FLINEAR0_100_TICK(t)
+# define BFI_FLINEAR0_99(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_98, v ds
+# define BFI_FLINEAR0_99_TICK(t)
+# define BFI_FLINEAR0_98(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_97, v ds
+# define BFI_FLINEAR0_98_TICK(t)
+# define BFI_FLINEAR0_97(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_96, v ds
+# define BFI_FLINEAR0_97_TICK(t)
+# define BFI_FLINEAR0_96(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_95, v ds
+# define BFI_FLINEAR0_96_TICK(t)
+# define BFI_FLINEAR0_95(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_94, v ds
+# define BFI_FLINEAR0_95_TICK(t)
+# define BFI_FLINEAR0_94(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_93, v ds
+# define BFI_FLINEAR0_94_TICK(t)
+# define BFI_FLINEAR0_93(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_92, v ds
+# define BFI_FLINEAR0_93_TICK(t)
+# define BFI_FLINEAR0_92(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_91, v ds
+# define BFI_FLINEAR0_92_TICK(t)
+# define BFI_FLINEAR0_91(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_90, v ds
+# define BFI_FLINEAR0_91_TICK(t)
+# define BFI_FLINEAR0_90(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_89, v ds
+# define BFI_FLINEAR0_90_TICK(t)
+# define BFI_FLINEAR0_89(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_88, v ds
+# define BFI_FLINEAR0_89_TICK(t)
+# define BFI_FLINEAR0_88(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_87, v ds
+# define BFI_FLINEAR0_88_TICK(t)
+# define BFI_FLINEAR0_87(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_86, v ds
+# define BFI_FLINEAR0_87_TICK(t)
+# define BFI_FLINEAR0_86(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_85, v ds
+# define BFI_FLINEAR0_86_TICK(t)
+# define BFI_FLINEAR0_85(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_84, v ds
+# define BFI_FLINEAR0_85_TICK(t)
+# define BFI_FLINEAR0_84(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_83, v ds
+# define BFI_FLINEAR0_84_TICK(t)
+# define BFI_FLINEAR0_83(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_82, v ds
+# define BFI_FLINEAR0_83_TICK(t)
+# define BFI_FLINEAR0_82(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_81, v ds
+# define BFI_FLINEAR0_82_TICK(t)
+# define BFI_FLINEAR0_81(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_80, v ds
+# define BFI_FLINEAR0_81_TICK(t)
+# define BFI_FLINEAR0_80(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_79, v ds
+# define BFI_FLINEAR0_80_TICK(t)
+# define BFI_FLINEAR0_79(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_78, v ds
+# define BFI_FLINEAR0_79_TICK(t)
+# define BFI_FLINEAR0_78(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_77, v ds
+# define BFI_FLINEAR0_78_TICK(t)
+# define BFI_FLINEAR0_77(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_76, v ds
+# define BFI_FLINEAR0_77_TICK(t)
+# define BFI_FLINEAR0_76(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_75, v ds
+# define BFI_FLINEAR0_76_TICK(t)
+# define BFI_FLINEAR0_75(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_74, v ds
+# define BFI_FLINEAR0_75_TICK(t)
+# define BFI_FLINEAR0_74(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_73, v ds
+# define BFI_FLINEAR0_74_TICK(t)
+# define BFI_FLINEAR0_73(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_72, v ds
+# define BFI_FLINEAR0_73_TICK(t)
+# define BFI_FLINEAR0_72(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_71, v ds
+# define BFI_FLINEAR0_72_TICK(t)
+# define BFI_FLINEAR0_71(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_70, v ds
+# define BFI_FLINEAR0_71_TICK(t)
+# define BFI_FLINEAR0_70(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_69, v ds
+# define BFI_FLINEAR0_70_TICK(t)
+# define BFI_FLINEAR0_69(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_68, v ds
+# define BFI_FLINEAR0_69_TICK(t)
+# define BFI_FLINEAR0_68(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_67, v ds
+# define BFI_FLINEAR0_68_TICK(t)
+# define BFI_FLINEAR0_67(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_66, v ds
+# define BFI_FLINEAR0_67_TICK(t)
+# define BFI_FLINEAR0_66(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_65, v ds
+# define BFI_FLINEAR0_66_TICK(t)
+# define BFI_FLINEAR0_65(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_64, v ds
+# define BFI_FLINEAR0_65_TICK(t)
+
+# endif
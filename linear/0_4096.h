@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_0_4096_H
+# define BFI_LINEAR_0_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR0_4096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4095, v ds
+# define BFI_FLINEAR0_4096_TICK(t)
+# define BFI_FLINEAR0_4095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4094, v ds
+# define BFI_FLINEAR0_4095_TICK(t)
+# define BFI_FLINEAR0_4094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4093, v ds
+# define BFI_FLINEAR0_4094_TICK(t)
+# define BFI_FLINEAR0_4093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4092, v ds
+# define BFI_FLINEAR0_4093_TICK(t)
+# define BFI_FLINEAR0_4092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4091, v ds
+# define BFI_FLINEAR0_4092_TICK(t)
+# define BFI_FLINEAR0_4091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4090, v ds
+# define BFI_FLINEAR0_4091_TICK(t)
+# define BFI_FLINEAR0_4090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4089, v ds
+# define BFI_FLINEAR0_4090_TICK(t)
+# define BFI_FLINEAR0_4089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4088, v ds
+# define BFI_FLINEAR0_4089_TICK(t)
+# define BFI_FLINEAR0_4088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4087, v ds
+# define BFI_FLINEAR0_4088_TICK(t)
+# define BFI_FLINEAR0_4087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4086, v ds
+# define BFI_FLINEAR0_4087_TICK(t)
+# define BFI_FLINEAR0_4086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4085, v ds
+# define BFI_FLINEAR0_4086_TICK(t)
+# define BFI_FLINEAR0_4085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4084, v ds
+# define BFI_FLINEAR0_4085_TICK(t)
+# define BFI_FLINEAR0_4084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4083, v ds
+# define BFI_FLINEAR0_4084_TICK(t)
+# define BFI_FLINEAR0_4083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4082, v ds
+# define BFI_FLINEAR0_4083_TICK(t)
+# define BFI_FLINEAR0_4082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4081, v ds
+# define BFI_FLINEAR0_4082_TICK(t)
+# define BFI_FLINEAR0_4081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4080, v ds
+# define BFI_FLINEAR0_4081_TICK(t)
+# define BFI_FLINEAR0_4080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4079, v ds
+# define BFI_FLINEAR0_4080_TICK(t)
+# define BFI_FLINEAR0_4079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4078, v ds
+# define BFI_FLINEAR0_4079_TICK(t)
+# define BFI_FLINEAR0_4078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4077, v ds
+# define BFI_FLINEAR0_4078_TICK(t)
+# define BFI_FLINEAR0_4077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4076, v ds
+# define BFI_FLINEAR0_4077_TICK(t)
+# define BFI_FLINEAR0_4076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4075, v ds
+# define BFI_FLINEAR0_4076_TICK(t)
+# define BFI_FLINEAR0_4075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4074, v ds
+# define BFI_FLINEAR0_4075_TICK(t)
+# define BFI_FLINEAR0_4074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4073, v ds
+# define BFI_FLINEAR0_4074_TICK(t)
+# define BFI_FLINEAR0_4073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4072, v ds
+# define BFI_FLINEAR0_4073_TICK(t)
+# define BFI_FLINEAR0_4072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4071, v ds
+# define BFI_FLINEAR0_4072_TICK(t)
+# define BFI_FLINEAR0_4071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4070, v ds
+# define BFI_FLINEAR0_4071_TICK(t)
+# define BFI_FLINEAR0_4070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4069, v ds
+# define BFI_FLINEAR0_4070_TICK(t)
+# define BFI_FLINEAR0_4069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4068, v ds
+# define BFI_FLINEAR0_4069_TICK(t)
+# define BFI_FLINEAR0_4068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4067, v ds
+# define BFI_FLINEAR0_4068_TICK(t)
+# define BFI_FLINEAR0_4067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4066, v ds
+# define BFI_FLINEAR0_4067_TICK(t)
+# define BFI_FLINEAR0_4066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4065, v ds
+# define BFI_FLINEAR0_4066_TICK(t)
+# define BFI_FLINEAR0_4065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4064, v ds
+# define BFI_FLINEAR0_4065_TICK(t)
+# define BFI_FLINEAR0_4064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4063, v ds
+# define BFI_FLINEAR0_4064_TICK(t)
+# define BFI_FLINEAR0_4063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4062, v ds
+# define BFI_FLINEAR0_4063_TICK(t)
+# define BFI_FLINEAR0_4062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4061, v ds
+# define BFI_FLINEAR0_4062_TICK(t)
+# define BFI_FLINEAR0_4061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4060, v ds
+# define BFI_FLINEAR0_4061_TICK(t)
+# define BFI_FLINEAR0_4060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4059, v ds
+# define BFI_FLINEAR0_4060_TICK(t)
+# define BFI_FLINEAR0_4059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4058, v ds
+# define BFI_FLINEAR0_4059_TICK(t)
+# define BFI_FLINEAR0_4058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4057, v ds
+# define BFI_FLINEAR0_4058_TICK(t)
+# define BFI_FLINEAR0_4057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4056, v ds
+# define BFI_FLINEAR0_4057_TICK(t)
+# define BFI_FLINEAR0_4056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4055, v ds
+# define BFI_FLINEAR0_4056_TICK(t)
+# define BFI_FLINEAR0_4055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4054, v ds
+# define BFI_FLINEAR0_4055_TICK(t)
+# define BFI_FLINEAR0_4054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4053, v ds
+# define BFI_FLINEAR0_4054_TICK(t)
+# define BFI_FLINEAR0_4053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4052, v ds
+# define BFI_FLINEAR0_4053_TICK(t)
+# define BFI_FLINEAR0_4052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4051, v ds
+# define BFI_FLINEAR0_4052_TICK(t)
+# define BFI_FLINEAR0_4051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4050, v ds
+# define BFI_FLINEAR0_4051_TICK(t)
+# define BFI_FLINEAR0_4050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4049, v ds
+# define BFI_FLINEAR0_4050_TICK(t)
+# define BFI_FLINEAR0_4049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4048, v ds
+# define BFI_FLINEAR0_4049_TICK(t)
+# define BFI_FLINEAR0_4048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4047, v ds
+# define BFI_FLINEAR0_4048_TICK(t)
+# define BFI_FLINEAR0_4047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4046, v ds
+# define BFI_FLINEAR0_4047_TICK(t)
+# define BFI_FLINEAR0_4046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4045, v ds
+# define BFI_FLINEAR0_4046_TICK(t)
+# define BFI_FLINEAR0_4045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4044, v ds
+# define BFI_FLINEAR0_4045_TICK(t)
+# define BFI_FLINEAR0_4044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4043, v ds
+# define BFI_FLINEAR0_4044_TICK(t)
+# define BFI_FLINEAR0_4043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4042, v ds
+# define BFI_FLINEAR0_4043_TICK(t)
+# define BFI_FLINEAR0_4042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4041, v ds
+# define BFI_FLINEAR0_4042_TICK(t)
+# define BFI_FLINEAR0_4041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4040, v ds
+# define BFI_FLINEAR0_4041_TICK(t)
+# define BFI_FLINEAR0_4040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4039, v ds
+# define BFI_FLINEAR0_4040_TICK(t)
+# define BFI_FLINEAR0_4039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4038, v ds
+# define BFI_FLINEAR0_4039_TICK(t)
+# define BFI_FLINEAR0_4038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4037, v ds
+# define BFI_FLINEAR0_4038_TICK(t)
+# define BFI_FLINEAR0_4037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4036, v ds
+# define BFI_FLINEAR0_4037_TICK(t)
+# define BFI_FLINEAR0_4036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4035, v ds
+# define BFI_FLINEAR0_4036_TICK(t)
+# define BFI_FLINEAR0_4035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4034, v ds
+# define BFI_FLINEAR0_4035_TICK(t)
+# define BFI_FLINEAR0_4034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4033, v ds
+# define BFI_FLINEAR0_4034_TICK(t)
+# define BFI_FLINEAR0_4033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4032, v ds
+# define BFI_FLINEAR0_4033_TICK(t)
+# define BFI_FLINEAR0_4032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4031, v ds
+# define BFI_FLINEAR0_4032_TICK(t)
+# define BFI_FLINEAR0_4031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4030, v ds
+# define BFI_FLINEAR0_4031_TICK(t)
+# define BFI_FLINEAR0_4030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4029, v ds
+# define BFI_FLINEAR0_4030_TICK(t)
+# define BFI_FLINEAR0_4029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4028, v ds
+# define BFI_FLINEAR0_4029_TICK(t)
+# define BFI_FLINEAR0_4028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4027, v ds
+# define BFI_FLINEAR0_4028_TICK(t)
+# define BFI_FLINEAR0_4027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4026, v ds
+# define BFI_FLINEAR0_4027_TICK(t)
+# define BFI_FLINEAR0_4026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4025, v ds
+# define BFI_FLINEAR0_4026_TICK(t)
+# define BFI_FLINEAR0_4025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4024, v ds
+# define BFI_FLINEAR0_4025_TICK(t)
+# define BFI_FLINEAR0_4024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4023, v ds
+# define BFI_FLINEAR0_4024_TICK(t)
+# define BFI_FLINEAR0_4023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4022, v ds
+# define BFI_FLINEAR0_4023_TICK(t)
+# define BFI_FLINEAR0_4022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4021, v ds
+# define BFI_FLINEAR0_4022_TICK(t)
+# define BFI_FLINEAR0_4021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4020, v ds
+# define BFI_FLINEAR0_4021_TICK(t)
+# define BFI_FLINEAR0_4020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4019, v ds
+# define BFI_FLINEAR0_4020_TICK(t)
+# define BFI_FLINEAR0_4019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4018, v ds
+# define BFI_FLINEAR0_4019_TICK(t)
+# define BFI_FLINEAR0_4018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4017, v ds
+# define BFI_FLINEAR0_4018_TICK(t)
+# define BFI_FLINEAR0_4017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4016, v ds
+# define BFI_FLINEAR0_4017_TICK(t)
+# define BFI_FLINEAR0_4016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4015, v ds
+# define BFI_FLINEAR0_4016_TICK(t)
+# define BFI_FLINEAR0_4015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4014, v ds
+# define BFI_FLINEAR0_4015_TICK(t)
+# define BFI_FLINEAR0_4014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4013, v ds
+# define BFI_FLINEAR0_4014_TICK(t)
+# define BFI_FLINEAR0_4013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4012, v ds
+# define BFI_FLINEAR0_4013_TICK(t)
+# define BFI_FLINEAR0_4012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4011, v ds
+# define BFI_FLINEAR0_4012_TICK(t)
+# define BFI_FLINEAR0_4011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4010, v ds
+# define BFI_FLINEAR0_4011_TICK(t)
+# define BFI_FLINEAR0_4010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4009, v ds
+# define BFI_FLINEAR0_4010_TICK(t)
+# define BFI_FLINEAR0_4009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4008, v ds
+# define BFI_FLINEAR0_4009_TICK(t)
+# define BFI_FLINEAR0_4008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4007, v ds
+# define BFI_FLINEAR0_4008_TICK(t)
+# define BFI_FLINEAR0_4007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4006, v ds
+# define BFI_FLINEAR0_4007_TICK(t)
+# define BFI_FLINEAR0_4006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4005, v ds
+# define BFI_FLINEAR0_4006_TICK(t)
+# define BFI_FLINEAR0_4005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4004, v ds
+# define BFI_FLINEAR0_4005_TICK(t)
+# define BFI_FLINEAR0_4004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4003, v ds
+# define BFI_FLINEAR0_4004_TICK(t)
+# define BFI_FLINEAR0_4003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4002, v ds
+# define BFI_FLINEAR0_4003_TICK(t)
+# define BFI_FLINEAR0_4002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4001, v ds
+# define BFI_FLINEAR0_4002_TICK(t)
+# define BFI_FLINEAR0_4001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4000, v ds
+# define BFI_FLINEAR0_4001_TICK(t)
+# define BFI_FLINEAR0_4000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3999, v ds
+# define BFI_FLINEAR0_4000_TICK(t)
+# define BFI_FLINEAR0_3999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3998, v ds
+# define BFI_FLINEAR0_3999_TICK(t)
+# define BFI_FLINEAR0_3998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3997, v ds
+# define BFI_FLINEAR0_3998_TICK(t)
+# define BFI_FLINEAR0_3997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3996, v ds
+# define BFI_FLINEAR0_3997_TICK(t)
+# define BFI_FLINEAR0_3996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3995, v ds
+# define BFI_FLINEAR0_3996_TICK(t)
+# define BFI_FLINEAR0_3995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3994, v ds
+# define BFI_FLINEAR0_3995_TICK(t)
+# define BFI_FLINEAR0_3994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3993, v ds
+# define BFI_FLINEAR0_3994_TICK(t)
+# define BFI_FLINEAR0_3993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3992, v ds
+# define BFI_FLINEAR0_3993_TICK(t)
+# define BFI_FLINEAR0_3992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3991, v ds
+# define BFI_FLINEAR0_3992_TICK(t)
+# define BFI_FLINEAR0_3991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3990, v ds
+# define BFI_FLINEAR0_3991_TICK(t)
+# define BFI_FLINEAR0_3990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3989, v ds
+# define BFI_FLINEAR0_3990_TICK(t)
+# define BFI_FLINEAR0_3989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3988, v ds
+# define BFI_FLINEAR0_3989_TICK(t)
+# define BFI_FLINEAR0_3988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3987, v ds
+# define BFI_FLINEAR0_3988_TICK(t)
+# define BFI_FLINEAR0_3987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3986, v ds
+# define BFI_FLINEAR0_3987_TICK(t)
+# define BFI_FLINEAR0_3986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3985, v ds
+# define BFI_FLINEAR0_3986_TICK(t)
+# define BFI_FLINEAR0_3985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3984, v ds
+# define BFI_FLINEAR0_3985_TICK(t)
+# define BFI_FLINEAR0_3984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3983, v ds
+# define BFI_FLINEAR0_3984_TICK(t)
+# define BFI_FLINEAR0_3983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3982, v ds
+# define BFI_FLINEAR0_3983_TICK(t)
+# define BFI_FLINEAR0_3982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3981, v ds
+# define BFI_FLINEAR0_3982_TICK(t)
+# define BFI_FLINEAR0_3981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3980, v ds
+# define BFI_FLINEAR0_3981_TICK(t)
+# define BFI_FLINEAR0_3980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3979, v ds
+# define BFI_FLINEAR0_3980_TICK(t)
+# define BFI_FLINEAR0_3979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3978, v ds
+# define BFI_FLINEAR0_3979_TICK(t)
+# define BFI_FLINEAR0_3978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3977, v ds
+# define BFI_FLINEAR0_3978_TICK(t)
+# define BFI_FLINEAR0_3977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3976, v ds
+# define BFI_FLINEAR0_3977_TICK(t)
+# define BFI_FLINEAR0_3976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3975, v ds
+# define BFI_FLINEAR0_3976_TICK(t)
+# define BFI_FLINEAR0_3975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3974, v ds
+# define BFI_FLINEAR0_3975_TICK(t)
+# define BFI_FLINEAR0_3974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3973, v ds
+# define BFI_FLINEAR0_3974_TICK(t)
+# define BFI_FLINEAR0_3973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3972, v ds
+# define BFI_FLINEAR0_3973_TICK(t)
+# define BFI_FLINEAR0_3972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3971, v ds
+# define BFI_FLINEAR0_3972_TICK(t)
+# define BFI_FLINEAR0_3971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3970, v ds
+# define BFI_FLINEAR0_3971_TICK(t)
+# define BFI_FLINEAR0_3970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3969, v ds
+# define BFI_FLINEAR0_3970_TICK(t)
+# define BFI_FLINEAR0_3969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3968, v ds
+# define BFI_FLINEAR0_3969_TICK(t)
+# define BFI_FLINEAR0_3968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3967, v ds
+# define BFI_FLINEAR0_3968_TICK(t)
+# define BFI_FLINEAR0_3967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3966, v ds
+# define BFI_FLINEAR0_3967_TICK(t)
+# define BFI_FLINEAR0_3966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3965, v ds
+# define BFI_FLINEAR0_3966_TICK(t)
+# define BFI_FLINEAR0_3965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3964, v ds
+# define BFI_FLINEAR0_3965_TICK(t)
+# define BFI_FLINEAR0_3964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3963, v ds
+# define BFI_FLINEAR0_3964_TICK(t)
+# define BFI_FLINEAR0_3963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3962, v ds
+# define BFI_FLINEAR0_3963_TICK(t)
+# define BFI_FLINEAR0_3962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3961, v ds
+# define BFI_FLINEAR0_3962_TICK(t)
+# define BFI_FLINEAR0_3961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3960, v ds
+# define BFI_FLINEAR0_3961_TICK(t)
+# define BFI_FLINEAR0_3960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3959, v ds
+# define BFI_FLINEAR0_3960_TICK(t)
+# define BFI_FLINEAR0_3959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3958, v ds
+# define BFI_FLINEAR0_3959_TICK(t)
+# define BFI_FLINEAR0_3958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3957, v ds
+# define BFI_FLINEAR0_3958_TICK(t)
+# define BFI_FLINEAR0_3957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3956, v ds
+# define BFI_FLINEAR0_3957_TICK(t)
+# define BFI_FLINEAR0_3956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3955, v ds
+# define BFI_FLINEAR0_3956_TICK(t)
+# define BFI_FLINEAR0_3955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3954, v ds
+# define BFI_FLINEAR0_3955_TICK(t)
+# define BFI_FLINEAR0_3954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3953, v ds
+# define BFI_FLINEAR0_3954_TICK(t)
+# define BFI_FLINEAR0_3953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3952, v ds
+# define BFI_FLINEAR0_3953_TICK(t)
+# define BFI_FLINEAR0_3952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3951, v ds
+# define BFI_FLINEAR0_3952_TICK(t)
+# define BFI_FLINEAR0_3951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3950, v ds
+# define BFI_FLINEAR0_3951_TICK(t)
+# define BFI_FLINEAR0_3950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3949, v ds
+# define BFI_FLINEAR0_3950_TICK(t)
+# define BFI_FLINEAR0_3949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3948, v ds
+# define BFI_FLINEAR0_3949_TICK(t)
+# define BFI_FLINEAR0_3948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3947, v ds
+# define BFI_FLINEAR0_3948_TICK(t)
+# define BFI_FLINEAR0_3947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3946, v ds
+# define BFI_FLINEAR0_3947_TICK(t)
+# define BFI_FLINEAR0_3946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3945, v ds
+# define BFI_FLINEAR0_3946_TICK(t)
+# define BFI_FLINEAR0_3945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3944, v ds
+# define BFI_FLINEAR0_3945_TICK(t)
+# define BFI_FLINEAR0_3944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3943, v ds
+# define BFI_FLINEAR0_3944_TICK(t)
+# define BFI_FLINEAR0_3943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3942, v ds
+# define BFI_FLINEAR0_3943_TICK(t)
+# define BFI_FLINEAR0_3942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3941, v ds
+# define BFI_FLINEAR0_3942_TICK(t)
+# define BFI_FLINEAR0_3941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3940, v ds
+# define BFI_FLINEAR0_3941_TICK(t)
+# define BFI_FLINEAR0_3940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3939, v ds
+# define BFI_FLINEAR0_3940_TICK(t)
+# define BFI_FLINEAR0_3939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3938, v ds
+# define BFI_FLINEAR0_3939_TICK(t)
+# define BFI_FLINEAR0_3938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3937, v ds
+# define BFI_FLINEAR0_3938_TICK(t)
+# define BFI_FLINEAR0_3937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3936, v ds
+# define BFI_FLINEAR0_3937_TICK(t)
+# define BFI_FLINEAR0_3936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3935, v ds
+# define BFI_FLINEAR0_3936_TICK(t)
+# define BFI_FLINEAR0_3935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3934, v ds
+# define BFI_FLINEAR0_3935_TICK(t)
+# define BFI_FLINEAR0_3934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3933, v ds
+# define BFI_FLINEAR0_3934_TICK(t)
+# define BFI_FLINEAR0_3933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3932, v ds
+# define BFI_FLINEAR0_3933_TICK(t)
+# define BFI_FLINEAR0_3932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3931, v ds
+# define BFI_FLINEAR0_3932_TICK(t)
+# define BFI_FLINEAR0_3931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3930, v ds
+# define BFI_FLINEAR0_3931_TICK(t)
+# define BFI_FLINEAR0_3930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3929, v ds
+# define BFI_FLINEAR0_3930_TICK(t)
+# define BFI_FLINEAR0_3929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3928, v ds
+# define BFI_FLINEAR0_3929_TICK(t)
+# define BFI_FLINEAR0_3928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3927, v ds
+# define BFI_FLINEAR0_3928_TICK(t)
+# define BFI_FLINEAR0_3927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3926, v ds
+# define BFI_FLINEAR0_3927_TICK(t)
+# define BFI_FLINEAR0_3926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3925, v ds
+# define BFI_FLINEAR0_3926_TICK(t)
+# define BFI_FLINEAR0_3925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3924, v ds
+# define BFI_FLINEAR0_3925_TICK(t)
+# define BFI_FLINEAR0_3924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3923, v ds
+# define BFI_FLINEAR0_3924_TICK(t)
+# define BFI_FLINEAR0_3923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3922, v ds
+# define BFI_FLINEAR0_3923_TICK(t)
+# define BFI_FLINEAR0_3922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3921, v ds
+# define BFI_FLINEAR0_3922_TICK(t)
+# define BFI_FLINEAR0_3921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3920, v ds
+# define BFI_FLINEAR0_3921_TICK(t)
+# define BFI_FLINEAR0_3920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3919, v ds
+# define BFI_FLINEAR0_3920_TICK(t)
+# define BFI_FLINEAR0_3919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3918, v ds
+# define BFI_FLINEAR0_3919_TICK(t)
+# define BFI_FLINEAR0_3918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3917, v ds
+# define BFI_FLINEAR0_3918_TICK(t)
+# define BFI_FLINEAR0_3917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3916, v ds
+# define BFI_FLINEAR0_3917_TICK(t)
+# define BFI_FLINEAR0_3916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3915, v ds
+# define BFI_FLINEAR0_3916_TICK(t)
+# define BFI_FLINEAR0_3915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3914, v ds
+# define BFI_FLINEAR0_3915_TICK(t)
+# define BFI_FLINEAR0_3914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3913, v ds
+# define BFI_FLINEAR0_3914_TICK(t)
+# define BFI_FLINEAR0_3913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3912, v ds
+# define BFI_FLINEAR0_3913_TICK(t)
+# define BFI_FLINEAR0_3912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3911, v ds
+# define BFI_FLINEAR0_3912_TICK(t)
+# define BFI_FLINEAR0_3911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3910, v ds
+# define BFI_FLINEAR0_3911_TICK(t)
+# define BFI_FLINEAR0_3910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3909, v ds
+# define BFI_FLINEAR0_3910_TICK(t)
+# define BFI_FLINEAR0_3909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3908, v ds
+# define BFI_FLINEAR0_3909_TICK(t)
+# define BFI_FLINEAR0_3908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3907, v ds
+# define BFI_FLINEAR0_3908_TICK(t)
+# define BFI_FLINEAR0_3907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3906, v ds
+# define BFI_FLINEAR0_3907_TICK(t)
+# define BFI_FLINEAR0_3906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3905, v ds
+# define BFI_FLINEAR0_3906_TICK(t)
+# define BFI_FLINEAR0_3905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3904, v ds
+# define BFI_FLINEAR0_3905_TICK(t)
+# define BFI_FLINEAR0_3904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3903, v ds
+# define BFI_FLINEAR0_3904_TICK(t)
+# define BFI_FLINEAR0_3903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3902, v ds
+# define BFI_FLINEAR0_3903_TICK(t)
+# define BFI_FLINEAR0_3902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3901, v ds
+# define BFI_FLINEAR0_3902_TICK(t)
+# define BFI_FLINEAR0_3901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3900, v ds
+# define BFI_FLINEAR0_3901_TICK(t)
+# define BFI_FLINEAR0_3900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3899, v ds
+# define BFI_FLINEAR0_3900_TICK(t)
+# define BFI_FLINEAR0_3899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3898, v ds
+# define BFI_FLINEAR0_3899_TICK(t)
+# define BFI_FLINEAR0_3898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3897, v ds
+# define BFI_FLINEAR0_3898_TICK(t)
+# define BFI_FLINEAR0_3897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3896, v ds
+# define BFI_FLINEAR0_3897_TICK(t)
+# define BFI_FLINEAR0_3896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3895, v ds
+# define BFI_FLINEAR0_3896_TICK(t)
+# define BFI_FLINEAR0_3895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3894, v ds
+# define BFI_FLINEAR0_3895_TICK(t)
+# define BFI_FLINEAR0_3894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3893, v ds
+# define BFI_FLINEAR0_3894_TICK(t)
+# define BFI_FLINEAR0_3893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3892, v ds
+# define BFI_FLINEAR0_3893_TICK(t)
+# define BFI_FLINEAR0_3892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3891, v ds
+# define BFI_FLINEAR0_3892_TICK(t)
+# define BFI_FLINEAR0_3891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3890, v ds
+# define BFI_FLINEAR0_3891_TICK(t)
+# define BFI_FLINEAR0_3890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3889, v ds
+# define BFI_FLINEAR0_3890_TICK(t)
+# define BFI_FLINEAR0_3889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3888, v ds
+# define BFI_FLINEAR0_3889_TICK(t)
+# define BFI_FLINEAR0_3888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3887, v ds
+# define BFI_FLINEAR0_3888_TICK(t)
+# define BFI_FLINEAR0_3887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3886, v ds
+# define BFI_FLINEAR0_3887_TICK(t)
+# define BFI_FLINEAR0_3886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3885, v ds
+# define BFI_FLINEAR0_3886_TICK(t)
+# define BFI_FLINEAR0_3885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3884, v ds
+# define BFI_FLINEAR0_3885_TICK(t)
+# define BFI_FLINEAR0_3884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3883, v ds
+# define BFI_FLINEAR0_3884_TICK(t)
+# define BFI_FLINEAR0_3883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3882, v ds
+# define BFI_FLINEAR0_3883_TICK(t)
+# define BFI_FLINEAR0_3882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3881, v ds
+# define BFI_FLINEAR0_3882_TICK(t)
+# define BFI_FLINEAR0_3881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3880, v ds
+# define BFI_FLINEAR0_3881_TICK(t)
+# define BFI_FLINEAR0_3880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3879, v ds
+# define BFI_FLINEAR0_3880_TICK(t)
+# define BFI_FLINEAR0_3879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3878, v ds
+# define BFI_FLINEAR0_3879_TICK(t)
+# define BFI_FLINEAR0_3878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3877, v ds
+# define BFI_FLINEAR0_3878_TICK(t)
+# define BFI_FLINEAR0_3877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3876, v ds
+# define BFI_FLINEAR0_3877_TICK(t)
+# define BFI_FLINEAR0_3876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3875, v ds
+# define BFI_FLINEAR0_3876_TICK(t)
+# define BFI_FLINEAR0_3875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3874, v ds
+# define BFI_FLINEAR0_3875_TICK(t)
+# define BFI_FLINEAR0_3874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3873, v ds
+# define BFI_FLINEAR0_3874_TICK(t)
+# define BFI_FLINEAR0_3873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3872, v ds
+# define BFI_FLINEAR0_3873_TICK(t)
+# define BFI_FLINEAR0_3872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3871, v ds
+# define BFI_FLINEAR0_3872_TICK(t)
+# define BFI_FLINEAR0_3871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3870, v ds
+# define BFI_FLINEAR0_3871_TICK(t)
+# define BFI_FLINEAR0_3870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3869, v ds
+# define BFI_FLINEAR0_3870_TICK(t)
+# define BFI_FLINEAR0_3869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3868, v ds
+# define BFI_FLINEAR0_3869_TICK(t)
+# define BFI_FLINEAR0_3868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3867, v ds
+# define BFI_FLINEAR0_3868_TICK(t)
+# define BFI_FLINEAR0_3867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3866, v ds
+# define BFI_FLINEAR0_3867_TICK(t)
+# define BFI_FLINEAR0_3866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3865, v ds
+# define BFI_FLINEAR0_3866_TICK(t)
+# define BFI_FLINEAR0_3865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3864, v ds
+# define BFI_FLINEAR0_3865_TICK(t)
+# define BFI_FLINEAR0_3864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3863, v ds
+# define BFI_FLINEAR0_3864_TICK(t)
+# define BFI_FLINEAR0_3863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3862, v ds
+# define BFI_FLINEAR0_3863_TICK(t)
+# define BFI_FLINEAR0_3862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3861, v ds
+# define BFI_FLINEAR0_3862_TICK(t)
+# define BFI_FLINEAR0_3861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3860, v ds
+# define BFI_FLINEAR0_3861_TICK(t)
+# define BFI_FLINEAR0_3860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3859, v ds
+# define BFI_FLINEAR0_3860_TICK(t)
+# define BFI_FLINEAR0_3859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3858, v ds
+# define BFI_FLINEAR0_3859_TICK(t)
+# define BFI_FLINEAR0_3858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3857, v ds
+# define BFI_FLINEAR0_3858_TICK(t)
+# define BFI_FLINEAR0_3857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3856, v ds
+# define BFI_FLINEAR0_3857_TICK(t)
+# define BFI_FLINEAR0_3856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3855, v ds
+# define BFI_FLINEAR0_3856_TICK(t)
+# define BFI_FLINEAR0_3855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3854, v ds
+# define BFI_FLINEAR0_3855_TICK(t)
+# define BFI_FLINEAR0_3854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3853, v ds
+# define BFI_FLINEAR0_3854_TICK(t)
+# define BFI_FLINEAR0_3853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3852, v ds
+# define BFI_FLINEAR0_3853_TICK(t)
+# define BFI_FLINEAR0_3852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3851, v ds
+# define BFI_FLINEAR0_3852_TICK(t)
+# define BFI_FLINEAR0_3851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3850, v ds
+# define BFI_FLINEAR0_3851_TICK(t)
+# define BFI_FLINEAR0_3850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3849, v ds
+# define BFI_FLINEAR0_3850_TICK(t)
+# define BFI_FLINEAR0_3849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3848, v ds
+# define BFI_FLINEAR0_3849_TICK(t)
+# define BFI_FLINEAR0_3848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3847, v ds
+# define BFI_FLINEAR0_3848_TICK(t)
+# define BFI_FLINEAR0_3847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3846, v ds
+# define BFI_FLINEAR0_3847_TICK(t)
+# define BFI_FLINEAR0_3846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3845, v ds
+# define BFI_FLINEAR0_3846_TICK(t)
+# define BFI_FLINEAR0_3845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3844, v ds
+# define BFI_FLINEAR0_3845_TICK(t)
+# define BFI_FLINEAR0_3844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3843, v ds
+# define BFI_FLINEAR0_3844_TICK(t)
+# define BFI_FLINEAR0_3843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3842, v ds
+# define BFI_FLINEAR0_3843_TICK(t)
+# define BFI_FLINEAR0_3842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3841, v ds
+# define BFI_FLINEAR0_3842_TICK(t)
+# define BFI_FLINEAR0_3841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3840, v ds
+# define BFI_FLINEAR0_3841_TICK(t)
+# define BFI_FLINEAR0_3840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3839, v ds
+# define BFI_FLINEAR0_3840_TICK(t)
+# define BFI_FLINEAR0_3839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3838, v ds
+# define BFI_FLINEAR0_3839_TICK(t)
+# define BFI_FLINEAR0_3838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3837, v ds
+# define BFI_FLINEAR0_3838_TICK(t)
+# define BFI_FLINEAR0_3837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3836, v ds
+# define BFI_FLINEAR0_3837_TICK(t)
+# define BFI_FLINEAR0_3836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3835, v ds
+# define BFI_FLINEAR0_3836_TICK(t)
+# define BFI_FLINEAR0_3835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3834, v ds
+# define BFI_FLINEAR0_3835_TICK(t)
+# define BFI_FLINEAR0_3834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3833, v ds
+# define BFI_FLINEAR0_3834_TICK(t)
+# define BFI_FLINEAR0_3833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3832, v ds
+# define BFI_FLINEAR0_3833_TICK(t)
+# define BFI_FLINEAR0_3832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3831, v ds
+# define BFI_FLINEAR0_3832_TICK(t)
+# define BFI_FLINEAR0_3831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3830, v ds
+# define BFI_FLINEAR0_3831_TICK(t)
+# define BFI_FLINEAR0_3830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3829, v ds
+# define BFI_FLINEAR0_3830_TICK(t)
+# define BFI_FLINEAR0_3829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3828, v ds
+# define BFI_FLINEAR0_3829_TICK(t)
+# define BFI_FLINEAR0_3828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3827, v ds
+# define BFI_FLINEAR0_3828_TICK(t)
+# define BFI_FLINEAR0_3827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3826, v ds
+# define BFI_FLINEAR0_3827_TICK(t)
+# define BFI_FLINEAR0_3826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3825, v ds
+# define BFI_FLINEAR0_3826_TICK(t)
+# define BFI_FLINEAR0_3825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3824, v ds
+# define BFI_FLINEAR0_3825_TICK(t)
+# define BFI_FLINEAR0_3824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3823, v ds
+# define BFI_FLINEAR0_3824_TICK(t)
+# define BFI_FLINEAR0_3823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3822, v ds
+# define BFI_FLINEAR0_3823_TICK(t)
+# define BFI_FLINEAR0_3822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3821, v ds
+# define BFI_FLINEAR0_3822_TICK(t)
+# define BFI_FLINEAR0_3821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3820, v ds
+# define BFI_FLINEAR0_3821_TICK(t)
+# define BFI_FLINEAR0_3820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3819, v ds
+# define BFI_FLINEAR0_3820_TICK(t)
+# define BFI_FLINEAR0_3819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3818, v ds
+# define BFI_FLINEAR0_3819_TICK(t)
+# define BFI_FLINEAR0_3818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3817, v ds
+# define BFI_FLINEAR0_3818_TICK(t)
+# define BFI_FLINEAR0_3817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3816, v ds
+# define BFI_FLINEAR0_3817_TICK(t)
+# define BFI_FLINEAR0_3816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3815, v ds
+# define BFI_FLINEAR0_3816_TICK(t)
+# define BFI_FLINEAR0_3815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3814, v ds
+# define BFI_FLINEAR0_3815_TICK(t)
+# define BFI_FLINEAR0_3814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3813, v ds
+# define BFI_FLINEAR0_3814_TICK(t)
+# define BFI_FLINEAR0_3813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3812, v ds
+# define BFI_FLINEAR0_3813_TICK(t)
+# define BFI_FLINEAR0_3812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3811, v ds
+# define BFI_FLINEAR0_3812_TICK(t)
+# define BFI_FLINEAR0_3811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3810, v ds
+# define BFI_FLINEAR0_3811_TICK(t)
+# define BFI_FLINEAR0_3810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3809, v ds
+# define BFI_FLINEAR0_3810_TICK(t)
+# define BFI_FLINEAR0_3809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3808, v ds
+# define BFI_FLINEAR0_3809_TICK(t)
+# define BFI_FLINEAR0_3808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3807, v ds
+# define BFI_FLINEAR0_3808_TICK(t)
+# define BFI_FLINEAR0_3807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3806, v ds
+# define BFI_FLINEAR0_3807_TICK(t)
+# define BFI_FLINEAR0_3806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3805, v ds
+# define BFI_FLINEAR0_3806_TICK(t)
+# define BFI_FLINEAR0_3805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3804, v ds
+# define BFI_FLINEAR0_3805_TICK(t)
+# define BFI_FLINEAR0_3804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3803, v ds
+# define BFI_FLINEAR0_3804_TICK(t)
+# define BFI_FLINEAR0_3803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3802, v ds
+# define BFI_FLINEAR0_3803_TICK(t)
+# define BFI_FLINEAR0_3802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3801, v ds
+# define BFI_FLINEAR0_3802_TICK(t)
+# define BFI_FLINEAR0_3801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3800, v ds
+# define BFI_FLINEAR0_3801_TICK(t)
+# define BFI_FLINEAR0_3800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3799, v ds
+# define BFI_FLINEAR0_3800_TICK(t)
+# define BFI_FLINEAR0_3799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3798, v ds
+# define BFI_FLINEAR0_3799_TICK(t)
+# define BFI_FLINEAR0_3798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3797, v ds
+# define BFI_FLINEAR0_3798_TICK(t)
+# define BFI_FLINEAR0_3797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3796, v ds
+# define BFI_FLINEAR0_3797_TICK(t)
+# define BFI_FLINEAR0_3796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3795, v ds
+# define BFI_FLINEAR0_3796_TICK(t)
+# define BFI_FLINEAR0_3795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3794, v ds
+# define BFI_FLINEAR0_3795_TICK(t)
+# define BFI_FLINEAR0_3794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3793, v ds
+# define BFI_FLINEAR0_3794_TICK(t)
+# define BFI_FLINEAR0_3793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3792, v ds
+# define BFI_FLINEAR0_3793_TICK(t)
+# define BFI_FLINEAR0_3792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3791, v ds
+# define BFI_FLINEAR0_3792_TICK(t)
+# define BFI_FLINEAR0_3791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3790, v ds
+# define BFI_FLINEAR0_3791_TICK(t)
+# define BFI_FLINEAR0_3790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3789, v ds
+# define BFI_FLINEAR0_3790_TICK(t)
+# define BFI_FLINEAR0_3789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3788, v ds
+# define BFI_FLINEAR0_3789_TICK(t)
+# define BFI_FLINEAR0_3788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3787, v ds
+# define BFI_FLINEAR0_3788_TICK(t)
+# define BFI_FLINEAR0_3787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3786, v ds
+# define BFI_FLINEAR0_3787_TICK(t)
+# define BFI_FLINEAR0_3786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3785, v ds
+# define BFI_FLINEAR0_3786_TICK(t)
+# define BFI_FLINEAR0_3785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3784, v ds
+# define BFI_FLINEAR0_3785_TICK(t)
+# define BFI_FLINEAR0_3784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3783, v ds
+# define BFI_FLINEAR0_3784_TICK(t)
+# define BFI_FLINEAR0_3783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3782, v ds
+# define BFI_FLINEAR0_3783_TICK(t)
+# define BFI_FLINEAR0_3782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3781, v ds
+# define BFI_FLINEAR0_3782_TICK(t)
+# define BFI_FLINEAR0_3781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3780, v ds
+# define BFI_FLINEAR0_3781_TICK(t)
+# define BFI_FLINEAR0_3780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3779, v ds
+# define BFI_FLINEAR0_3780_TICK(t)
+# define BFI_FLINEAR0_3779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3778, v ds
+# define BFI_FLINEAR0_3779_TICK(t)
+# define BFI_FLINEAR0_3778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3777, v ds
+# define BFI_FLINEAR0_3778_TICK(t)
+# define BFI_FLINEAR0_3777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3776, v ds
+# define BFI_FLINEAR0_3777_TICK(t)
+# define BFI_FLINEAR0_3776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3775, v ds
+# define BFI_FLINEAR0_3776_TICK(t)
+# define BFI_FLINEAR0_3775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3774, v ds
+# define BFI_FLINEAR0_3775_TICK(t)
+# define BFI_FLINEAR0_3774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3773, v ds
+# define BFI_FLINEAR0_3774_TICK(t)
+# define BFI_FLINEAR0_3773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3772, v ds
+# define BFI_FLINEAR0_3773_TICK(t)
+# define BFI_FLINEAR0_3772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3771, v ds
+# define BFI_FLINEAR0_3772_TICK(t)
+# define BFI_FLINEAR0_3771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3770, v ds
+# define BFI_FLINEAR0_3771_TICK(t)
+# define BFI_FLINEAR0_3770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3769, v ds
+# define BFI_FLINEAR0_3770_TICK(t)
+# define BFI_FLINEAR0_3769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3768, v ds
+# define BFI_FLINEAR0_3769_TICK(t)
+# define BFI_FLINEAR0_3768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3767, v ds
+# define BFI_FLINEAR0_3768_TICK(t)
+# define BFI_FLINEAR0_3767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3766, v ds
+# define BFI_FLINEAR0_3767_TICK(t)
+# define BFI_FLINEAR0_3766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3765, v ds
+# define BFI_FLINEAR0_3766_TICK(t)
+# define BFI_FLINEAR0_3765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3764, v ds
+# define BFI_FLINEAR0_3765_TICK(t)
+# define BFI_FLINEAR0_3764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3763, v ds
+# define BFI_FLINEAR0_3764_TICK(t)
+# define BFI_FLINEAR0_3763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3762, v ds
+# define BFI_FLINEAR0_3763_TICK(t)
+# define BFI_FLINEAR0_3762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3761, v ds
+# define BFI_FLINEAR0_3762_TICK(t)
+# define BFI_FLINEAR0_3761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3760, v ds
+# define BFI_FLINEAR0_3761_TICK(t)
+# define BFI_FLINEAR0_3760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3759, v ds
+# define BFI_FLINEAR0_3760_TICK(t)
+# define BFI_FLINEAR0_3759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3758, v ds
+# define BFI_FLINEAR0_3759_TICK(t)
+# define BFI_FLINEAR0_3758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3757, v ds
+# define BFI_FLINEAR0_3758_TICK(t)
+# define BFI_FLINEAR0_3757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3756, v ds
+# define BFI_FLINEAR0_3757_TICK(t)
+# define BFI_FLINEAR0_3756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3755, v ds
+# define BFI_FLINEAR0_3756_TICK(t)
+# define BFI_FLINEAR0_3755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3754, v ds
+# define BFI_FLINEAR0_3755_TICK(t)
+# define BFI_FLINEAR0_3754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3753, v ds
+# define BFI_FLINEAR0_3754_TICK(t)
+# define BFI_FLINEAR0_3753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3752, v ds
+# define BFI_FLINEAR0_3753_TICK(t)
+# define BFI_FLINEAR0_3752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3751, v ds
+# define BFI_FLINEAR0_3752_TICK(t)
+# define BFI_FLINEAR0_3751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3750, v ds
+# define BFI_FLINEAR0_3751_TICK(t)
+# define BFI_FLINEAR0_3750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3749, v ds
+# define BFI_FLINEAR0_3750_TICK(t)
+# define BFI_FLINEAR0_3749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3748, v ds
+# define BFI_FLINEAR0_3749_TICK(t)
+# define BFI_FLINEAR0_3748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3747, v ds
+# define BFI_FLINEAR0_3748_TICK(t)
+# define BFI_FLINEAR0_3747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3746, v ds
+# define BFI_FLINEAR0_3747_TICK(t)
+# define BFI_FLINEAR0_3746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3745, v ds
+# define BFI_FLINEAR0_3746_TICK(t)
+# define BFI_FLINEAR0_3745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3744, v ds
+# define BFI_FLINEAR0_3745_TICK(t)
+# define BFI_FLINEAR0_3744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3743, v ds
+# define BFI_FLINEAR0_3744_TICK(t)
+# define BFI_FLINEAR0_3743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3742, v ds
+# define BFI_FLINEAR0_3743_TICK(t)
+# define BFI_FLINEAR0_3742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3741, v ds
+# define BFI_FLINEAR0_3742_TICK(t)
+# define BFI_FLINEAR0_3741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3740, v ds
+# define BFI_FLINEAR0_3741_TICK(t)
+# define BFI_FLINEAR0_3740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3739, v ds
+# define BFI_FLINEAR0_3740_TICK(t)
+# define BFI_FLINEAR0_3739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3738, v ds
+# define BFI_FLINEAR0_3739_TICK(t)
+# define BFI_FLINEAR0_3738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3737, v ds
+# define BFI_FLINEAR0_3738_TICK(t)
+# define BFI_FLINEAR0_3737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3736, v ds
+# define BFI_FLINEAR0_3737_TICK(t)
+# define BFI_FLINEAR0_3736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3735, v ds
+# define BFI_FLINEAR0_3736_TICK(t)
+# define BFI_FLINEAR0_3735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3734, v ds
+# define BFI_FLINEAR0_3735_TICK(t)
+# define BFI_FLINEAR0_3734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3733, v ds
+# define BFI_FLINEAR0_3734_TICK(t)
+# define BFI_FLINEAR0_3733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3732, v ds
+# define BFI_FLINEAR0_3733_TICK(t)
+# define BFI_FLINEAR0_3732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3731, v ds
+# define BFI_FLINEAR0_3732_TICK(t)
+# define BFI_FLINEAR0_3731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3730, v ds
+# define BFI_FLINEAR0_3731_TICK(t)
+# define BFI_FLINEAR0_3730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3729, v ds
+# define BFI_FLINEAR0_3730_TICK(t)
+# define BFI_FLINEAR0_3729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3728, v ds
+# define BFI_FLINEAR0_3729_TICK(t)
+# define BFI_FLINEAR0_3728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3727, v ds
+# define BFI_FLINEAR0_3728_TICK(t)
+# define BFI_FLINEAR0_3727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3726, v ds
+# define BFI_FLINEAR0_3727_TICK(t)
+# define BFI_FLINEAR0_3726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3725, v ds
+# define BFI_FLINEAR0_3726_TICK(t)
+# define BFI_FLINEAR0_3725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3724, v ds
+# define BFI_FLINEAR0_3725_TICK(t)
+# define BFI_FLINEAR0_3724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3723, v ds
+# define BFI_FLINEAR0_3724_TICK(t)
+# define BFI_FLINEAR0_3723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3722, v ds
+# define BFI_FLINEAR0_3723_TICK(t)
+# define BFI_FLINEAR0_3722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3721, v ds
+# define BFI_FLINEAR0_3722_TICK(t)
+# define BFI_FLINEAR0_3721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3720, v ds
+# define BFI_FLINEAR0_3721_TICK(t)
+# define BFI_FLINEAR0_3720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3719, v ds
+# define BFI_FLINEAR0_3720_TICK(t)
+# define BFI_FLINEAR0_3719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3718, v ds
+# define BFI_FLINEAR0_3719_TICK(t)
+# define BFI_FLINEAR0_3718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3717, v ds
+# define BFI_FLINEAR0_3718_TICK(t)
+# define BFI_FLINEAR0_3717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3716, v ds
+# define BFI_FLINEAR0_3717_TICK(t)
+# define BFI_FLINEAR0_3716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3715, v ds
+# define BFI_FLINEAR0_3716_TICK(t)
+# define BFI_FLINEAR0_3715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3714, v ds
+# define BFI_FLINEAR0_3715_TICK(t)
+# define BFI_FLINEAR0_3714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3713, v ds
+# define BFI_FLINEAR0_3714_TICK(t)
+# define BFI_FLINEAR0_3713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3712, v ds
+# define BFI_FLINEAR0_3713_TICK(t)
+# define BFI_FLINEAR0_3712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3711, v ds
+# define BFI_FLINEAR0_3712_TICK(t)
+# define BFI_FLINEAR0_3711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3710, v ds
+# define BFI_FLINEAR0_3711_TICK(t)
+# define BFI_FLINEAR0_3710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3709, v ds
+# define BFI_FLINEAR0_3710_TICK(t)
+# define BFI_FLINEAR0_3709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3708, v ds
+# define BFI_FLINEAR0_3709_TICK(t)
+# define BFI_FLINEAR0_3708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3707, v ds
+# define BFI_FLINEAR0_3708_TICK(t)
+# define BFI_FLINEAR0_3707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3706, v ds
+# define BFI_FLINEAR0_3707_TICK(t)
+# define BFI_FLINEAR0_3706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3705, v ds
+# define BFI_FLINEAR0_3706_TICK(t)
+# define BFI_FLINEAR0_3705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3704, v ds
+# define BFI_FLINEAR0_3705_TICK(t)
+# define BFI_FLINEAR0_3704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3703, v ds
+# define BFI_FLINEAR0_3704_TICK(t)
+# define BFI_FLINEAR0_3703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3702, v ds
+# define BFI_FLINEAR0_3703_TICK(t)
+# define BFI_FLINEAR0_3702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3701, v ds
+# define BFI_FLINEAR0_3702_TICK(t)
+# define BFI_FLINEAR0_3701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3700, v ds
+# define BFI_FLINEAR0_3701_TICK(t)
+# define BFI_FLINEAR0_3700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3699, v ds
+# define BFI_FLINEAR0_3700_TICK(t)
+# define BFI_FLINEAR0_3699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3698, v ds
+# define BFI_FLINEAR0_3699_TICK(t)
+# define BFI_FLINEAR0_3698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3697, v ds
+# define BFI_FLINEAR0_3698_TICK(t)
+# define BFI_FLINEAR0_3697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3696, v ds
+# define BFI_FLINEAR0_3697_TICK(t)
+# define BFI_FLINEAR0_3696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3695, v ds
+# define BFI_FLINEAR0_3696_TICK(t)
+# define BFI_FLINEAR0_3695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3694, v ds
+# define BFI_FLINEAR0_3695_TICK(t)
+# define BFI_FLINEAR0_3694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3693, v ds
+# define BFI_FLINEAR0_3694_TICK(t)
+# define BFI_FLINEAR0_3693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3692, v ds
+# define BFI_FLINEAR0_3693_TICK(t)
+# define BFI_FLINEAR0_3692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3691, v ds
+# define BFI_FLINEAR0_3692_TICK(t)
+# define BFI_FLINEAR0_3691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3690, v ds
+# define BFI_FLINEAR0_3691_TICK(t)
+# define BFI_FLINEAR0_3690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3689, v ds
+# define BFI_FLINEAR0_3690_TICK(t)
+# define BFI_FLINEAR0_3689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3688, v ds
+# define BFI_FLINEAR0_3689_TICK(t)
+# define BFI_FLINEAR0_3688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3687, v ds
+# define BFI_FLINEAR0_3688_TICK(t)
+# define BFI_FLINEAR0_3687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3686, v ds
+# define BFI_FLINEAR0_3687_TICK(t)
+# define BFI_FLINEAR0_3686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3685, v ds
+# define BFI_FLINEAR0_3686_TICK(t)
+# define BFI_FLINEAR0_3685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3684, v ds
+# define BFI_FLINEAR0_3685_TICK(t)
+# define BFI_FLINEAR0_3684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3683, v ds
+# define BFI_FLINEAR0_3684_TICK(t)
+# define BFI_FLINEAR0_3683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3682, v ds
+# define BFI_FLINEAR0_3683_TICK(t)
+# define BFI_FLINEAR0_3682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3681, v ds
+# define BFI_FLINEAR0_3682_TICK(t)
+# define BFI_FLINEAR0_3681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3680, v ds
+# define BFI_FLINEAR0_3681_TICK(t)
+# define BFI_FLINEAR0_3680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3679, v ds
+# define BFI_FLINEAR0_3680_TICK(t)
+# define BFI_FLINEAR0_3679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3678, v ds
+# define BFI_FLINEAR0_3679_TICK(t)
+# define BFI_FLINEAR0_3678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3677, v ds
+# define BFI_FLINEAR0_3678_TICK(t)
+# define BFI_FLINEAR0_3677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3676, v ds
+# define BFI_FLINEAR0_3677_TICK(t)
+# define BFI_FLINEAR0_3676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3675, v ds
+# define BFI_FLINEAR0_3676_TICK(t)
+# define BFI_FLINEAR0_3675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3674, v ds
+# define BFI_FLINEAR0_3675_TICK(t)
+# define BFI_FLINEAR0_3674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3673, v ds
+# define BFI_FLINEAR0_3674_TICK(t)
+# define BFI_FLINEAR0_3673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3672, v ds
+# define BFI_FLINEAR0_3673_TICK(t)
+# define BFI_FLINEAR0_3672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3671, v ds
+# define BFI_FLINEAR0_3672_TICK(t)
+# define BFI_FLINEAR0_3671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3670, v ds
+# define BFI_FLINEAR0_3671_TICK(t)
+# define BFI_FLINEAR0_3670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3669, v ds
+# define BFI_FLINEAR0_3670_TICK(t)
+# define BFI_FLINEAR0_3669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3668, v ds
+# define BFI_FLINEAR0_3669_TICK(t)
+# define BFI_FLINEAR0_3668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3667, v ds
+# define BFI_FLINEAR0_3668_TICK(t)
+# define BFI_FLINEAR0_3667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3666, v ds
+# define BFI_FLINEAR0_3667_TICK(t)
+# define BFI_FLINEAR0_3666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3665, v ds
+# define BFI_FLINEAR0_3666_TICK(t)
+# define BFI_FLINEAR0_3665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3664, v ds
+# define BFI_FLINEAR0_3665_TICK(t)
+# define BFI_FLINEAR0_3664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3663, v ds
+# define BFI_FLINEAR0_3664_TICK(t)
+# define BFI_FLINEAR0_3663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3662, v ds
+# define BFI_FLINEAR0_3663_TICK(t)
+# define BFI_FLINEAR0_3662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3661, v ds
+# define BFI_FLINEAR0_3662_TICK(t)
+# define BFI_FLINEAR0_3661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3660, v ds
+# define BFI_FLINEAR0_3661_TICK(t)
+# define BFI_FLINEAR0_3660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3659, v ds
+# define BFI_FLINEAR0_3660_TICK(t)
+# define BFI_FLINEAR0_3659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3658, v ds
+# define BFI_FLINEAR0_3659_TICK(t)
+# define BFI_FLINEAR0_3658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3657, v ds
+# define BFI_FLINEAR0_3658_TICK(t)
+# define BFI_FLINEAR0_3657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3656, v ds
+# define BFI_FLINEAR0_3657_TICK(t)
+# define BFI_FLINEAR0_3656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3655, v ds
+# define BFI_FLINEAR0_3656_TICK(t)
+# define BFI_FLINEAR0_3655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3654, v ds
+# define BFI_FLINEAR0_3655_TICK(t)
+# define BFI_FLINEAR0_3654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3653, v ds
+# define BFI_FLINEAR0_3654_TICK(t)
+# define BFI_FLINEAR0_3653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3652, v ds
+# define BFI_FLINEAR0_3653_TICK(t)
+# define BFI_FLINEAR0_3652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3651, v ds
+# define BFI_FLINEAR0_3652_TICK(t)
+# define BFI_FLINEAR0_3651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3650, v ds
+# define BFI_FLINEAR0_3651_TICK(t)
+# define BFI_FLINEAR0_3650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3649, v ds
+# define BFI_FLINEAR0_3650_TICK(t)
+# define BFI_FLINEAR0_3649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3648, v ds
+# define BFI_FLINEAR0_3649_TICK(t)
+# define BFI_FLINEAR0_3648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3647, v ds
+# define BFI_FLINEAR0_3648_TICK(t)
+# define BFI_FLINEAR0_3647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3646, v ds
+# define BFI_FLINEAR0_3647_TICK(t)
+# define BFI_FLINEAR0_3646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3645, v ds
+# define BFI_FLINEAR0_3646_TICK(t)
+# define BFI_FLINEAR0_3645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3644, v ds
+# define BFI_FLINEAR0_3645_TICK(t)
+# define BFI_FLINEAR0_3644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3643, v ds
+# define BFI_FLINEAR0_3644_TICK(t)
+# define BFI_FLINEAR0_3643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3642, v ds
+# define BFI_FLINEAR0_3643_TICK(t)
+# define BFI_FLINEAR0_3642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3641, v ds
+# define BFI_FLINEAR0_3642_TICK(t)
+# define BFI_FLINEAR0_3641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3640, v ds
+# define BFI_FLINEAR0_3641_TICK(t)
+# define BFI_FLINEAR0_3640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3639, v ds
+# define BFI_FLINEAR0_3640_TICK(t)
+# define BFI_FLINEAR0_3639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3638, v ds
+# define BFI_FLINEAR0_3639_TICK(t)
+# define BFI_FLINEAR0_3638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3637, v ds
+# define BFI_FLINEAR0_3638_TICK(t)
+# define BFI_FLINEAR0_3637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3636, v ds
+# define BFI_FLINEAR0_3637_TICK(t)
+# define BFI_FLINEAR0_3636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3635, v ds
+# define BFI_FLINEAR0_3636_TICK(t)
+# define BFI_FLINEAR0_3635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3634, v ds
+# define BFI_FLINEAR0_3635_TICK(t)
+# define BFI_FLINEAR0_3634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3633, v ds
+# define BFI_FLINEAR0_3634_TICK(t)
+# define BFI_FLINEAR0_3633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3632, v ds
+# define BFI_FLINEAR0_3633_TICK(t)
+# define BFI_FLINEAR0_3632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3631, v ds
+# define BFI_FLINEAR0_3632_TICK(t)
+# define BFI_FLINEAR0_3631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3630, v ds
+# define BFI_FLINEAR0_3631_TICK(t)
+# define BFI_FLINEAR0_3630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3629, v ds
+# define BFI_FLINEAR0_3630_TICK(t)
+# define BFI_FLINEAR0_3629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3628, v ds
+# define BFI_FLINEAR0_3629_TICK(t)
+# define BFI_FLINEAR0_3628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3627, v ds
+# define BFI_FLINEAR0_3628_TICK(t)
+# define BFI_FLINEAR0_3627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3626, v ds
+# define BFI_FLINEAR0_3627_TICK(t)
+# define BFI_FLINEAR0_3626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3625, v ds
+# define BFI_FLINEAR0_3626_TICK(t)
+# define BFI_FLINEAR0_3625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3624, v ds
+# define BFI_FLINEAR0_3625_TICK(t)
+# define BFI_FLINEAR0_3624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3623, v ds
+# define BFI_FLINEAR0_3624_TICK(t)
+# define BFI_FLINEAR0_3623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3622, v ds
+# define BFI_FLINEAR0_3623_TICK(t)
+# define BFI_FLINEAR0_3622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3621, v ds
+# define BFI_FLINEAR0_3622_TICK(t)
+# define BFI_FLINEAR0_3621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3620, v ds
+# define BFI_FLINEAR0_3621_TICK(t)
+# define BFI_FLINEAR0_3620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3619, v ds
+# define BFI_FLINEAR0_3620_TICK(t)
+# define BFI_FLINEAR0_3619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3618, v ds
+# define BFI_FLINEAR0_3619_TICK(t)
+# define BFI_FLINEAR0_3618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3617, v ds
+# define BFI_FLINEAR0_3618_TICK(t)
+# define BFI_FLINEAR0_3617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3616, v ds
+# define BFI_FLINEAR0_3617_TICK(t)
+# define BFI_FLINEAR0_3616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3615, v ds
+# define BFI_FLINEAR0_3616_TICK(t)
+# define BFI_FLINEAR0_3615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3614, v ds
+# define BFI_FLINEAR0_3615_TICK(t)
+# define BFI_FLINEAR0_3614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3613, v ds
+# define BFI_FLINEAR0_3614_TICK(t)
+# define BFI_FLINEAR0_3613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3612, v ds
+# define BFI_FLINEAR0_3613_TICK(t)
+# define BFI_FLINEAR0_3612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3611, v ds
+# define BFI_FLINEAR0_3612_TICK(t)
+# define BFI_FLINEAR0_3611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3610, v ds
+# define BFI_FLINEAR0_3611_TICK(t)
+# define BFI_FLINEAR0_3610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3609, v ds
+# define BFI_FLINEAR0_3610_TICK(t)
+# define BFI_FLINEAR0_3609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3608, v ds
+# define BFI_FLINEAR0_3609_TICK(t)
+# define BFI_FLINEAR0_3608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3607, v ds
+# define BFI_FLINEAR0_3608_TICK(t)
+# define BFI_FLINEAR0_3607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3606, v ds
+# define BFI_FLINEAR0_3607_TICK(t)
+# define BFI_FLINEAR0_3606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3605, v ds
+# define BFI_FLINEAR0_3606_TICK(t)
+# define BFI_FLINEAR0_3605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3604, v ds
+# define BFI_FLINEAR0_3605_TICK(t)
+# define BFI_FLINEAR0_3604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3603, v ds
+# define BFI_FLINEAR0_3604_TICK(t)
+# define BFI_FLINEAR0_3603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3602, v ds
+# define BFI_FLINEAR0_3603_TICK(t)
+# define BFI_FLINEAR0_3602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3601, v ds
+# define BFI_FLINEAR0_3602_TICK(t)
+# define BFI_FLINEAR0_3601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3600, v ds
+# define BFI_FLINEAR0_3601_TICK(t)
+# define BFI_FLINEAR0_3600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3599, v ds
+# define BFI_FLINEAR0_3600_TICK(t)
+# define BFI_FLINEAR0_3599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3598, v ds
+# define BFI_FLINEAR0_3599_TICK(t)
+# define BFI_FLINEAR0_3598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3597, v ds
+# define BFI_FLINEAR0_3598_TICK(t)
+# define BFI_FLINEAR0_3597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3596, v ds
+# define BFI_FLINEAR0_3597_TICK(t)
+# define BFI_FLINEAR0_3596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3595, v ds
+# define BFI_FLINEAR0_3596_TICK(t)
+# define BFI_FLINEAR0_3595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3594, v ds
+# define BFI_FLINEAR0_3595_TICK(t)
+# define BFI_FLINEAR0_3594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3593, v ds
+# define BFI_FLINEAR0_3594_TICK(t)
+# define BFI_FLINEAR0_3593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3592, v ds
+# define BFI_FLINEAR0_3593_TICK(t)
+# define BFI_FLINEAR0_3592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3591, v ds
+# define BFI_FLINEAR0_3592_TICK(t)
+# define BFI_FLINEAR0_3591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3590, v ds
+# define BFI_FLINEAR0_3591_TICK(t)
+# define BFI_FLINEAR0_3590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3589, v ds
+# define BFI_FLINEAR0_3590_TICK(t)
+# define BFI_FLINEAR0_3589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3588, v ds
+# define BFI_FLINEAR0_3589_TICK(t)
+# define BFI_FLINEAR0_3588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3587, v ds
+# define BFI_FLINEAR0_3588_TICK(t)
+# define BFI_FLINEAR0_3587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3586, v ds
+# define BFI_FLINEAR0_3587_TICK(t)
+# define BFI_FLINEAR0_3586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3585, v ds
+# define BFI_FLINEAR0_3586_TICK(t)
+# define BFI_FLINEAR0_3585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3584, v ds
+# define BFI_FLINEAR0_3585_TICK(t)
+# define BFI_FLINEAR0_3584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3583, v ds
+# define BFI_FLINEAR0_3584_TICK(t)
+# define BFI_FLINEAR0_3583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3582, v ds
+# define BFI_FLINEAR0_3583_TICK(t)
+# define BFI_FLINEAR0_3582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3581, v ds
+# define BFI_FLINEAR0_3582_TICK(t)
+# define BFI_FLINEAR0_3581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3580, v ds
+# define BFI_FLINEAR0_3581_TICK(t)
+# define BFI_FLINEAR0_3580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3579, v ds
+# define BFI_FLINEAR0_3580_TICK(t)
+# define BFI_FLINEAR0_3579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3578, v ds
+# define BFI_FLINEAR0_3579_TICK(t)
+# define BFI_FLINEAR0_3578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3577, v ds
+# define BFI_FLINEAR0_3578_TICK(t)
+# define BFI_FLINEAR0_3577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3576, v ds
+# define BFI_FLINEAR0_3577_TICK(t)
+# define BFI_FLINEAR0_3576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3575, v ds
+# define BFI_FLINEAR0_3576_TICK(t)
+# define BFI_FLINEAR0_3575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3574, v ds
+# define BFI_FLINEAR0_3575_TICK(t)
+# define BFI_FLINEAR0_3574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3573, v ds
+# define BFI_FLINEAR0_3574_TICK(t)
+# define BFI_FLINEAR0_3573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3572, v ds
+# define BFI_FLINEAR0_3573_TICK(t)
+# define BFI_FLINEAR0_3572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3571, v ds
+# define BFI_FLINEAR0_3572_TICK(t)
+# define BFI_FLINEAR0_3571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3570, v ds
+# define BFI_FLINEAR0_3571_TICK(t)
+# define BFI_FLINEAR0_3570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3569, v ds
+# define BFI_FLINEAR0_3570_TICK(t)
+# define BFI_FLINEAR0_3569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3568, v ds
+# define BFI_FLINEAR0_3569_TICK(t)
+# define BFI_FLINEAR0_3568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3567, v ds
+# define BFI_FLINEAR0_3568_TICK(t)
+# define BFI_FLINEAR0_3567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3566, v ds
+# define BFI_FLINEAR0_3567_TICK(t)
+# define BFI_FLINEAR0_3566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3565, v ds
+# define BFI_FLINEAR0_3566_TICK(t)
+# define BFI_FLINEAR0_3565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3564, v ds
+# define BFI_FLINEAR0_3565_TICK(t)
+# define BFI_FLINEAR0_3564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3563, v ds
+# define BFI_FLINEAR0_3564_TICK(t)
+# define BFI_FLINEAR0_3563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3562, v ds
+# define BFI_FLINEAR0_3563_TICK(t)
+# define BFI_FLINEAR0_3562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3561, v ds
+# define BFI_FLINEAR0_3562_TICK(t)
+# define BFI_FLINEAR0_3561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3560, v ds
+# define BFI_FLINEAR0_3561_TICK(t)
+# define BFI_FLINEAR0_3560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3559, v ds
+# define BFI_FLINEAR0_3560_TICK(t)
+# define BFI_FLINEAR0_3559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3558, v ds
+# define BFI_FLINEAR0_3559_TICK(t)
+# define BFI_FLINEAR0_3558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3557, v ds
+# define BFI_FLINEAR0_3558_TICK(t)
+# define BFI_FLINEAR0_3557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3556, v ds
+# define BFI_FLINEAR0_3557_TICK(t)
+# define BFI_FLINEAR0_3556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3555, v ds
+# define BFI_FLINEAR0_3556_TICK(t)
+# define BFI_FLINEAR0_3555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3554, v ds
+# define BFI_FLINEAR0_3555_TICK(t)
+# define BFI_FLINEAR0_3554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3553, v ds
+# define BFI_FLINEAR0_3554_TICK(t)
+# define BFI_FLINEAR0_3553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3552, v ds
+# define BFI_FLINEAR0_3553_TICK(t)
+# define BFI_FLINEAR0_3552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3551, v ds
+# define BFI_FLINEAR0_3552_TICK(t)
+# define BFI_FLINEAR0_3551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3550, v ds
+# define BFI_FLINEAR0_3551_TICK(t)
+# define BFI_FLINEAR0_3550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3549, v ds
+# define BFI_FLINEAR0_3550_TICK(t)
+# define BFI_FLINEAR0_3549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3548, v ds
+# define BFI_FLINEAR0_3549_TICK(t)
+# define BFI_FLINEAR0_3548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3547, v ds
+# define BFI_FLINEAR0_3548_TICK(t)
+# define BFI_FLINEAR0_3547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3546, v ds
+# define BFI_FLINEAR0_3547_TICK(t)
+# define BFI_FLINEAR0_3546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3545, v ds
+# define BFI_FLINEAR0_3546_TICK(t)
+# define BFI_FLINEAR0_3545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3544, v ds
+# define BFI_FLINEAR0_3545_TICK(t)
+# define BFI_FLINEAR0_3544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3543, v ds
+# define BFI_FLINEAR0_3544_TICK(t)
+# define BFI_FLINEAR0_3543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3542, v ds
+# define BFI_FLINEAR0_3543_TICK(t)
+# define BFI_FLINEAR0_3542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3541, v ds
+# define BFI_FLINEAR0_3542_TICK(t)
+# define BFI_FLINEAR0_3541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3540, v ds
+# define BFI_FLINEAR0_3541_TICK(t)
+# define BFI_FLINEAR0_3540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3539, v ds
+# define BFI_FLINEAR0_3540_TICK(t)
+# define BFI_FLINEAR0_3539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3538, v ds
+# define BFI_FLINEAR0_3539_TICK(t)
+# define BFI_FLINEAR0_3538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3537, v ds
+# define BFI_FLINEAR0_3538_TICK(t)
+# define BFI_FLINEAR0_3537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3536, v ds
+# define BFI_FLINEAR0_3537_TICK(t)
+# define BFI_FLINEAR0_3536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3535, v ds
+# define BFI_FLINEAR0_3536_TICK(t)
+# define BFI_FLINEAR0_3535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3534, v ds
+# define BFI_FLINEAR0_3535_TICK(t)
+# define BFI_FLINEAR0_3534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3533, v ds
+# define BFI_FLINEAR0_3534_TICK(t)
+# define BFI_FLINEAR0_3533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3532, v ds
+# define BFI_FLINEAR0_3533_TICK(t)
+# define BFI_FLINEAR0_3532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3531, v ds
+# define BFI_FLINEAR0_3532_TICK(t)
+# define BFI_FLINEAR0_3531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3530, v ds
+# define BFI_FLINEAR0_3531_TICK(t)
+# define BFI_FLINEAR0_3530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3529, v ds
+# define BFI_FLINEAR0_3530_TICK(t)
+# define BFI_FLINEAR0_3529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3528, v ds
+# define BFI_FLINEAR0_3529_TICK(t)
+# define BFI_FLINEAR0_3528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3527, v ds
+# define BFI_FLINEAR0_3528_TICK(t)
+# define BFI_FLINEAR0_3527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3526, v ds
+# define BFI_FLINEAR0_3527_TICK(t)
+# define BFI_FLINEAR0_3526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3525, v ds
+# define BFI_FLINEAR0_3526_TICK(t)
+# define BFI_FLINEAR0_3525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3524, v ds
+# define BFI_FLINEAR0_3525_TICK(t)
+# define BFI_FLINEAR0_3524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3523, v ds
+# define BFI_FLINEAR0_3524_TICK(t)
+# define BFI_FLINEAR0_3523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3522, v ds
+# define BFI_FLINEAR0_3523_TICK(t)
+# define BFI_FLINEAR0_3522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3521, v ds
+# define BFI_FLINEAR0_3522_TICK(t)
+# define BFI_FLINEAR0_3521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3520, v ds
+# define BFI_FLINEAR0_3521_TICK(t)
+# define BFI_FLINEAR0_3520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3519, v ds
+# define BFI_FLINEAR0_3520_TICK(t)
+# define BFI_FLINEAR0_3519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3518, v ds
+# define BFI_FLINEAR0_3519_TICK(t)
+# define BFI_FLINEAR0_3518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3517, v ds
+# define BFI_FLINEAR0_3518_TICK(t)
+# define BFI_FLINEAR0_3517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3516, v ds
+# define BFI_FLINEAR0_3517_TICK(t)
+# define BFI_FLINEAR0_3516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3515, v ds
+# define BFI_FLINEAR0_3516_TICK(t)
+# define BFI_FLINEAR0_3515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3514, v ds
+# define BFI_FLINEAR0_3515_TICK(t)
+# define BFI_FLINEAR0_3514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3513, v ds
+# define BFI_FLINEAR0_3514_TICK(t)
+# define BFI_FLINEAR0_3513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3512, v ds
+# define BFI_FLINEAR0_3513_TICK(t)
+# define BFI_FLINEAR0_3512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3511, v ds
+# define BFI_FLINEAR0_3512_TICK(t)
+# define BFI_FLINEAR0_3511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3510, v ds
+# define BFI_FLINEAR0_3511_TICK(t)
+# define BFI_FLINEAR0_3510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3509, v ds
+# define BFI_FLINEAR0_3510_TICK(t)
+# define BFI_FLINEAR0_3509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3508, v ds
+# define BFI_FLINEAR0_3509_TICK(t)
+# define BFI_FLINEAR0_3508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3507, v ds
+# define BFI_FLINEAR0_3508_TICK(t)
+# define BFI_FLINEAR0_3507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3506, v ds
+# define BFI_FLINEAR0_3507_TICK(t)
+# define BFI_FLINEAR0_3506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3505, v ds
+# define BFI_FLINEAR0_3506_TICK(t)
+# define BFI_FLINEAR0_3505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3504, v ds
+# define BFI_FLINEAR0_3505_TICK(t)
+# define BFI_FLINEAR0_3504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3503, v ds
+# define BFI_FLINEAR0_3504_TICK(t)
+# define BFI_FLINEAR0_3503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3502, v ds
+# define BFI_FLINEAR0_3503_TICK(t)
+# define BFI_FLINEAR0_3502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3501, v ds
+# define BFI_FLINEAR0_3502_TICK(t)
+# define BFI_FLINEAR0_3501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3500, v ds
+# define BFI_FLINEAR0_3501_TICK(t)
+# define BFI_FLINEAR0_3500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3499, v ds
+# define BFI_FLINEAR0_3500_TICK(t)
+# define BFI_FLINEAR0_3499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3498, v ds
+# define BFI_FLINEAR0_3499_TICK(t)
+# define BFI_FLINEAR0_3498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3497, v ds
+# define BFI_FLINEAR0_3498_TICK(t)
+# define BFI_FLINEAR0_3497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3496, v ds
+# define BFI_FLINEAR0_3497_TICK(t)
+# define BFI_FLINEAR0_3496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3495, v ds
+# define BFI_FLINEAR0_3496_TICK(t)
+# define BFI_FLINEAR0_3495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3494, v ds
+# define BFI_FLINEAR0_3495_TICK(t)
+# define BFI_FLINEAR0_3494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3493, v ds
+# define BFI_FLINEAR0_3494_TICK(t)
+# define BFI_FLINEAR0_3493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3492, v ds
+# define BFI_FLINEAR0_3493_TICK(t)
+# define BFI_FLINEAR0_3492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3491, v ds
+# define BFI_FLINEAR0_3492_TICK(t)
+# define BFI_FLINEAR0_3491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3490, v ds
+# define BFI_FLINEAR0_3491_TICK(t)
+# define BFI_FLINEAR0_3490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3489, v ds
+# define BFI_FLINEAR0_3490_TICK(t)
+# define BFI_FLINEAR0_3489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3488, v ds
+# define BFI_FLINEAR0_3489_TICK(t)
+# define BFI_FLINEAR0_3488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3487, v ds
+# define BFI_FLINEAR0_3488_TICK(t)
+# define BFI_FLINEAR0_3487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3486, v ds
+# define BFI_FLINEAR0_3487_TICK(t)
+# define BFI_FLINEAR0_3486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3485, v ds
+# define BFI_FLINEAR0_3486_TICK(t)
+# define BFI_FLINEAR0_3485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3484, v ds
+# define BFI_FLINEAR0_3485_TICK(t)
+# define BFI_FLINEAR0_3484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3483, v ds
+# define BFI_FLINEAR0_3484_TICK(t)
+# define BFI_FLINEAR0_3483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3482, v ds
+# define BFI_FLINEAR0_3483_TICK(t)
+# define BFI_FLINEAR0_3482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3481, v ds
+# define BFI_FLINEAR0_3482_TICK(t)
+# define BFI_FLINEAR0_3481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3480, v ds
+# define BFI_FLINEAR0_3481_TICK(t)
+# define BFI_FLINEAR0_3480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3479, v ds
+# define BFI_FLINEAR0_3480_TICK(t)
+# define BFI_FLINEAR0_3479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3478, v ds
+# define BFI_FLINEAR0_3479_TICK(t)
+# define BFI_FLINEAR0_3478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3477, v ds
+# define BFI_FLINEAR0_3478_TICK(t)
+# define BFI_FLINEAR0_3477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3476, v ds
+# define BFI_FLINEAR0_3477_TICK(t)
+# define BFI_FLINEAR0_3476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3475, v ds
+# define BFI_FLINEAR0_3476_TICK(t)
+# define BFI_FLINEAR0_3475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3474, v ds
+# define BFI_FLINEAR0_3475_TICK(t)
+# define BFI_FLINEAR0_3474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3473, v ds
+# define BFI_FLINEAR0_3474_TICK(t)
+# define BFI_FLINEAR0_3473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3472, v ds
+# define BFI_FLINEAR0_3473_TICK(t)
+# define BFI_FLINEAR0_3472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3471, v ds
+# define BFI_FLINEAR0_3472_TICK(t)
+# define BFI_FLINEAR0_3471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3470, v ds
+# define BFI_FLINEAR0_3471_TICK(t)
+# define BFI_FLINEAR0_3470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3469, v ds
+# define BFI_FLINEAR0_3470_TICK(t)
+# define BFI_FLINEAR0_3469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3468, v ds
+# define BFI_FLINEAR0_3469_TICK(t)
+# define BFI_FLINEAR0_3468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3467, v ds
+# define BFI_FLINEAR0_3468_TICK(t)
+# define BFI_FLINEAR0_3467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3466, v ds
+# define BFI_FLINEAR0_3467_TICK(t)
+# define BFI_FLINEAR0_3466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3465, v ds
+# define BFI_FLINEAR0_3466_TICK(t)
+# define BFI_FLINEAR0_3465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3464, v ds
+# define BFI_FLINEAR0_3465_TICK(t)
+# define BFI_FLINEAR0_3464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3463, v ds
+# define BFI_FLINEAR0_3464_TICK(t)
+# define BFI_FLINEAR0_3463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3462, v ds
+# define BFI_FLINEAR0_3463_TICK(t)
+# define BFI_FLINEAR0_3462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3461, v ds
+# define BFI_FLINEAR0_3462_TICK(t)
+# define BFI_FLINEAR0_3461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3460, v ds
+# define BFI_FLINEAR0_3461_TICK(t)
+# define BFI_FLINEAR0_3460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3459, v ds
+# define BFI_FLINEAR0_3460_TICK(t)
+# define BFI_FLINEAR0_3459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3458, v ds
+# define BFI_FLINEAR0_3459_TICK(t)
+# define BFI_FLINEAR0_3458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3457, v ds
+# define BFI_FLINEAR0_3458_TICK(t)
+# define BFI_FLINEAR0_3457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3456, v ds
+# define BFI_FLINEAR0_3457_TICK(t)
+# define BFI_FLINEAR0_3456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3455, v ds
+# define BFI_FLINEAR0_3456_TICK(t)
+# define BFI_FLINEAR0_3455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3454, v ds
+# define BFI_FLINEAR0_3455_TICK(t)
+# define BFI_FLINEAR0_3454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3453, v ds
+# define BFI_FLINEAR0_3454_TICK(t)
+# define BFI_FLINEAR0_3453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3452, v ds
+# define BFI_FLINEAR0_3453_TICK(t)
+# define BFI_FLINEAR0_3452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3451, v ds
+# define BFI_FLINEAR0_3452_TICK(t)
+# define BFI_FLINEAR0_3451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3450, v ds
+# define BFI_FLINEAR0_3451_TICK(t)
+# define BFI_FLINEAR0_3450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3449, v ds
+# define BFI_FLINEAR0_3450_TICK(t)
+# define BFI_FLINEAR0_3449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3448, v ds
+# define BFI_FLINEAR0_3449_TICK(t)
+# define BFI_FLINEAR0_3448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3447, v ds
+# define BFI_FLINEAR0_3448_TICK(t)
+# define BFI_FLINEAR0_3447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3446, v ds
+# define BFI_FLINEAR0_3447_TICK(t)
+# define BFI_FLINEAR0_3446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3445, v ds
+# define BFI_FLINEAR0_3446_TICK(t)
+# define BFI_FLINEAR0_3445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3444, v ds
+# define BFI_FLINEAR0_3445_TICK(t)
+# define BFI_FLINEAR0_3444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3443, v ds
+# define BFI_FLINEAR0_3444_TICK(t)
+# define BFI_FLINEAR0_3443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3442, v ds
+# define BFI_FLINEAR0_3443_TICK(t)
+# define BFI_FLINEAR0_3442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3441, v ds
+# define BFI_FLINEAR0_3442_TICK(t)
+# define BFI_FLINEAR0_3441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3440, v ds
+# define BFI_FLINEAR0_3441_TICK(t)
+# define BFI_FLINEAR0_3440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3439, v ds
+# define BFI_FLINEAR0_3440_TICK(t)
+# define BFI_FLINEAR0_3439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3438, v ds
+# define BFI_FLINEAR0_3439_TICK(t)
+# define BFI_FLINEAR0_3438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3437, v ds
+# define BFI_FLINEAR0_3438_TICK(t)
+# define BFI_FLINEAR0_3437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3436, v ds
+# define BFI_FLINEAR0_3437_TICK(t)
+# define BFI_FLINEAR0_3436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3435, v ds
+# define BFI_FLINEAR0_3436_TICK(t)
+# define BFI_FLINEAR0_3435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3434, v ds
+# define BFI_FLINEAR0_3435_TICK(t)
+# define BFI_FLINEAR0_3434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3433, v ds
+# define BFI_FLINEAR0_3434_TICK(t)
+# define BFI_FLINEAR0_3433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3432, v ds
+# define BFI_FLINEAR0_3433_TICK(t)
+# define BFI_FLINEAR0_3432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3431, v ds
+# define BFI_FLINEAR0_3432_TICK(t)
+# define BFI_FLINEAR0_3431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3430, v ds
+# define BFI_FLINEAR0_3431_TICK(t)
+# define BFI_FLINEAR0_3430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3429, v ds
+# define BFI_FLINEAR0_3430_TICK(t)
+# define BFI_FLINEAR0_3429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3428, v ds
+# define BFI_FLINEAR0_3429_TICK(t)
+# define BFI_FLINEAR0_3428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3427, v ds
+# define BFI_FLINEAR0_3428_TICK(t)
+# define BFI_FLINEAR0_3427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3426, v ds
+# define BFI_FLINEAR0_3427_TICK(t)
+# define BFI_FLINEAR0_3426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3425, v ds
+# define BFI_FLINEAR0_3426_TICK(t)
+# define BFI_FLINEAR0_3425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3424, v ds
+# define BFI_FLINEAR0_3425_TICK(t)
+# define BFI_FLINEAR0_3424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3423, v ds
+# define BFI_FLINEAR0_3424_TICK(t)
+# define BFI_FLINEAR0_3423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3422, v ds
+# define BFI_FLINEAR0_3423_TICK(t)
+# define BFI_FLINEAR0_3422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3421, v ds
+# define BFI_FLINEAR0_3422_TICK(t)
+# define BFI_FLINEAR0_3421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3420, v ds
+# define BFI_FLINEAR0_3421_TICK(t)
+# define BFI_FLINEAR0_3420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3419, v ds
+# define BFI_FLINEAR0_3420_TICK(t)
+# define BFI_FLINEAR0_3419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3418, v ds
+# define BFI_FLINEAR0_3419_TICK(t)
+# define BFI_FLINEAR0_3418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3417, v ds
+# define BFI_FLINEAR0_3418_TICK(t)
+# define BFI_FLINEAR0_3417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3416, v ds
+# define BFI_FLINEAR0_3417_TICK(t)
+# define BFI_FLINEAR0_3416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3415, v ds
+# define BFI_FLINEAR0_3416_TICK(t)
+# define BFI_FLINEAR0_3415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3414, v ds
+# define BFI_FLINEAR0_3415_TICK(t)
+# define BFI_FLINEAR0_3414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3413, v ds
+# define BFI_FLINEAR0_3414_TICK(t)
+# define BFI_FLINEAR0_3413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3412, v ds
+# define BFI_FLINEAR0_3413_TICK(t)
+# define BFI_FLINEAR0_3412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3411, v ds
+# define BFI_FLINEAR0_3412_TICK(t)
+# define BFI_FLINEAR0_3411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3410, v ds
+# define BFI_FLINEAR0_3411_TICK(t)
+# define BFI_FLINEAR0_3410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3409, v ds
+# define BFI_FLINEAR0_3410_TICK(t)
+# define BFI_FLINEAR0_3409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3408, v ds
+# define BFI_FLINEAR0_3409_TICK(t)
+# define BFI_FLINEAR0_3408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3407, v ds
+# define BFI_FLINEAR0_3408_TICK(t)
+# define BFI_FLINEAR0_3407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3406, v ds
+# define BFI_FLINEAR0_3407_TICK(t)
+# define BFI_FLINEAR0_3406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3405, v ds
+# define BFI_FLINEAR0_3406_TICK(t)
+# define BFI_FLINEAR0_3405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3404, v ds
+# define BFI_FLINEAR0_3405_TICK(t)
+# define BFI_FLINEAR0_3404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3403, v ds
+# define BFI_FLINEAR0_3404_TICK(t)
+# define BFI_FLINEAR0_3403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3402, v ds
+# define BFI_FLINEAR0_3403_TICK(t)
+# define BFI_FLINEAR0_3402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3401, v ds
+# define BFI_FLINEAR0_3402_TICK(t)
+# define BFI_FLINEAR0_3401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3400, v ds
+# define BFI_FLINEAR0_3401_TICK(t)
+# define BFI_FLINEAR0_3400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3399, v ds
+# define BFI_FLINEAR0_3400_TICK(t)
+# define BFI_FLINEAR0_3399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3398, v ds
+# define BFI_FLINEAR0_3399_TICK(t)
+# define BFI_FLINEAR0_3398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3397, v ds
+# define BFI_FLINEAR0_3398_TICK(t)
+# define BFI_FLINEAR0_3397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3396, v ds
+# define BFI_FLINEAR0_3397_TICK(t)
+# define BFI_FLINEAR0_3396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3395, v ds
+# define BFI_FLINEAR0_3396_TICK(t)
+# define BFI_FLINEAR0_3395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3394, v ds
+# define BFI_FLINEAR0_3395_TICK(t)
+# define BFI_FLINEAR0_3394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3393, v ds
+# define BFI_FLINEAR0_3394_TICK(t)
+# define BFI_FLINEAR0_3393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3392, v ds
+# define BFI_FLINEAR0_3393_TICK(t)
+# define BFI_FLINEAR0_3392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3391, v ds
+# define BFI_FLINEAR0_3392_TICK(t)
+# define BFI_FLINEAR0_3391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3390, v ds
+# define BFI_FLINEAR0_3391_TICK(t)
+# define BFI_FLINEAR0_3390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3389, v ds
+# define BFI_FLINEAR0_3390_TICK(t)
+# define BFI_FLINEAR0_3389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3388, v ds
+# define BFI_FLINEAR0_3389_TICK(t)
+# define BFI_FLINEAR0_3388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3387, v ds
+# define BFI_FLINEAR0_3388_TICK(t)
+# define BFI_FLINEAR0_3387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3386, v ds
+# define BFI_FLINEAR0_3387_TICK(t)
+# define BFI_FLINEAR0_3386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3385, v ds
+# define BFI_FLINEAR0_3386_TICK(t)
+# define BFI_FLINEAR0_3385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3384, v ds
+# define BFI_FLINEAR0_3385_TICK(t)
+# define BFI_FLINEAR0_3384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3383, v ds
+# define BFI_FLINEAR0_3384_TICK(t)
+# define BFI_FLINEAR0_3383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3382, v ds
+# define BFI_FLINEAR0_3383_TICK(t)
+# define BFI_FLINEAR0_3382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3381, v ds
+# define BFI_FLINEAR0_3382_TICK(t)
+# define BFI_FLINEAR0_3381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3380, v ds
+# define BFI_FLINEAR0_3381_TICK(t)
+# define BFI_FLINEAR0_3380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3379, v ds
+# define BFI_FLINEAR0_3380_TICK(t)
+# define BFI_FLINEAR0_3379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3378, v ds
+# define BFI_FLINEAR0_3379_TICK(t)
+# define BFI_FLINEAR0_3378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3377, v ds
+# define BFI_FLINEAR0_3378_TICK(t)
+# define BFI_FLINEAR0_3377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3376, v ds
+# define BFI_FLINEAR0_3377_TICK(t)
+# define BFI_FLINEAR0_3376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3375, v ds
+# define BFI_FLINEAR0_3376_TICK(t)
+# define BFI_FLINEAR0_3375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3374, v ds
+# define BFI_FLINEAR0_3375_TICK(t)
+# define BFI_FLINEAR0_3374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3373, v ds
+# define BFI_FLINEAR0_3374_TICK(t)
+# define BFI_FLINEAR0_3373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3372, v ds
+# define BFI_FLINEAR0_3373_TICK(t)
+# define BFI_FLINEAR0_3372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3371, v ds
+# define BFI_FLINEAR0_3372_TICK(t)
+# define BFI_FLINEAR0_3371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3370, v ds
+# define BFI_FLINEAR0_3371_TICK(t)
+# define BFI_FLINEAR0_3370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3369, v ds
+# define BFI_FLINEAR0_3370_TICK(t)
+# define BFI_FLINEAR0_3369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3368, v ds
+# define BFI_FLINEAR0_3369_TICK(t)
+# define BFI_FLINEAR0_3368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3367, v ds
+# define BFI_FLINEAR0_3368_TICK(t)
+# define BFI_FLINEAR0_3367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3366, v ds
+# define BFI_FLINEAR0_3367_TICK(t)
+# define BFI_FLINEAR0_3366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3365, v ds
+# define BFI_FLINEAR0_3366_TICK(t)
+# define BFI_FLINEAR0_3365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3364, v ds
+# define BFI_FLINEAR0_3365_TICK(t)
+# define BFI_FLINEAR0_3364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3363, v ds
+# define BFI_FLINEAR0_3364_TICK(t)
+# define BFI_FLINEAR0_3363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3362, v ds
+# define BFI_FLINEAR0_3363_TICK(t)
+# define BFI_FLINEAR0_3362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3361, v ds
+# define BFI_FLINEAR0_3362_TICK(t)
+# define BFI_FLINEAR0_3361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3360, v ds
+# define BFI_FLINEAR0_3361_TICK(t)
+# define BFI_FLINEAR0_3360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3359, v ds
+# define BFI_FLINEAR0_3360_TICK(t)
+# define BFI_FLINEAR0_3359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3358, v ds
+# define BFI_FLINEAR0_3359_TICK(t)
+# define BFI_FLINEAR0_3358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3357, v ds
+# define BFI_FLINEAR0_3358_TICK(t)
+# define BFI_FLINEAR0_3357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3356, v ds
+# define BFI_FLINEAR0_3357_TICK(t)
+# define BFI_FLINEAR0_3356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3355, v ds
+# define BFI_FLINEAR0_3356_TICK(t)
+# define BFI_FLINEAR0_3355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3354, v ds
+# define BFI_FLINEAR0_3355_TICK(t)
+# define BFI_FLINEAR0_3354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3353, v ds
+# define BFI_FLINEAR0_3354_TICK(t)
+# define BFI_FLINEAR0_3353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3352, v ds
+# define BFI_FLINEAR0_3353_TICK(t)
+# define BFI_FLINEAR0_3352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3351, v ds
+# define BFI_FLINEAR0_3352_TICK(t)
+# define BFI_FLINEAR0_3351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3350, v ds
+# define BFI_FLINEAR0_3351_TICK(t)
+# define BFI_FLINEAR0_3350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3349, v ds
+# define BFI_FLINEAR0_3350_TICK(t)
+# define BFI_FLINEAR0_3349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3348, v ds
+# define BFI_FLINEAR0_3349_TICK(t)
+# define BFI_FLINEAR0_3348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3347, v ds
+# define BFI_FLINEAR0_3348_TICK(t)
+# define BFI_FLINEAR0_3347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3346, v ds
+# define BFI_FLINEAR0_3347_TICK(t)
+# define BFI_FLINEAR0_3346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3345, v ds
+# define BFI_FLINEAR0_3346_TICK(t)
+# define BFI_FLINEAR0_3345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3344, v ds
+# define BFI_FLINEAR0_3345_TICK(t)
+# define BFI_FLINEAR0_3344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3343, v ds
+# define BFI_FLINEAR0_3344_TICK(t)
+# define BFI_FLINEAR0_3343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3342, v ds
+# define BFI_FLINEAR0_3343_TICK(t)
+# define BFI_FLINEAR0_3342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3341, v ds
+# define BFI_FLINEAR0_3342_TICK(t)
+# define BFI_FLINEAR0_3341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3340, v ds
+# define BFI_FLINEAR0_3341_TICK(t)
+# define BFI_FLINEAR0_3340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3339, v ds
+# define BFI_FLINEAR0_3340_TICK(t)
+# define BFI_FLINEAR0_3339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3338, v ds
+# define BFI_FLINEAR0_3339_TICK(t)
+# define BFI_FLINEAR0_3338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3337, v ds
+# define BFI_FLINEAR0_3338_TICK(t)
+# define BFI_FLINEAR0_3337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3336, v ds
+# define BFI_FLINEAR0_3337_TICK(t)
+# define BFI_FLINEAR0_3336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3335, v ds
+# define BFI_FLINEAR0_3336_TICK(t)
+# define BFI_FLINEAR0_3335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3334, v ds
+# define BFI_FLINEAR0_3335_TICK(t)
+# define BFI_FLINEAR0_3334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3333, v ds
+# define BFI_FLINEAR0_3334_TICK(t)
+# define BFI_FLINEAR0_3333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3332, v ds
+# define BFI_FLINEAR0_3333_TICK(t)
+# define BFI_FLINEAR0_3332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3331, v ds
+# define BFI_FLINEAR0_3332_TICK(t)
+# define BFI_FLINEAR0_3331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3330, v ds
+# define BFI_FLINEAR0_3331_TICK(t)
+# define BFI_FLINEAR0_3330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3329, v ds
+# define BFI_FLINEAR0_3330_TICK(t)
+# define BFI_FLINEAR0_3329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3328, v ds
+# define BFI_FLINEAR0_3329_TICK(t)
+# define BFI_FLINEAR0_3328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3327, v ds
+# define BFI_FLINEAR0_3328_TICK(t)
+# define BFI_FLINEAR0_3327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3326, v ds
+# define BFI_FLINEAR0_3327_TICK(t)
+# define BFI_FLINEAR0_3326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3325, v ds
+# define BFI_FLINEAR0_3326_TICK(t)
+# define BFI_FLINEAR0_3325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3324, v ds
+# define BFI_FLINEAR0_3325_TICK(t)
+# define BFI_FLINEAR0_3324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3323, v ds
+# define BFI_FLINEAR0_3324_TICK(t)
+# define BFI_FLINEAR0_3323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3322, v ds
+# define BFI_FLINEAR0_3323_TICK(t)
+# define BFI_FLINEAR0_3322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3321, v ds
+# define BFI_FLINEAR0_3322_TICK(t)
+# define BFI_FLINEAR0_3321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3320, v ds
+# define BFI_FLINEAR0_3321_TICK(t)
+# define BFI_FLINEAR0_3320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3319, v ds
+# define BFI_FLINEAR0_3320_TICK(t)
+# define BFI_FLINEAR0_3319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3318, v ds
+# define BFI_FLINEAR0_3319_TICK(t)
+# define BFI_FLINEAR0_3318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3317, v ds
+# define BFI_FLINEAR0_3318_TICK(t)
+# define BFI_FLINEAR0_3317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3316, v ds
+# define BFI_FLINEAR0_3317_TICK(t)
+# define BFI_FLINEAR0_3316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3315, v ds
+# define BFI_FLINEAR0_3316_TICK(t)
+# define BFI_FLINEAR0_3315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3314, v ds
+# define BFI_FLINEAR0_3315_TICK(t)
+# define BFI_FLINEAR0_3314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3313, v ds
+# define BFI_FLINEAR0_3314_TICK(t)
+# define BFI_FLINEAR0_3313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3312, v ds
+# define BFI_FLINEAR0_3313_TICK(t)
+# define BFI_FLINEAR0_3312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3311, v ds
+# define BFI_FLINEAR0_3312_TICK(t)
+# define BFI_FLINEAR0_3311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3310, v ds
+# define BFI_FLINEAR0_3311_TICK(t)
+# define BFI_FLINEAR0_3310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3309, v ds
+# define BFI_FLINEAR0_3310_TICK(t)
+# define BFI_FLINEAR0_3309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3308, v ds
+# define BFI_FLINEAR0_3309_TICK(t)
+# define BFI_FLINEAR0_3308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3307, v ds
+# define BFI_FLINEAR0_3308_TICK(t)
+# define BFI_FLINEAR0_3307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3306, v ds
+# define BFI_FLINEAR0_3307_TICK(t)
+# define BFI_FLINEAR0_3306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3305, v ds
+# define BFI_FLINEAR0_3306_TICK(t)
+# define BFI_FLINEAR0_3305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3304, v ds
+# define BFI_FLINEAR0_3305_TICK(t)
+# define BFI_FLINEAR0_3304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3303, v ds
+# define BFI_FLINEAR0_3304_TICK(t)
+# define BFI_FLINEAR0_3303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3302, v ds
+# define BFI_FLINEAR0_3303_TICK(t)
+# define BFI_FLINEAR0_3302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3301, v ds
+# define BFI_FLINEAR0_3302_TICK(t)
+# define BFI_FLINEAR0_3301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3300, v ds
+# define BFI_FLINEAR0_3301_TICK(t)
+# define BFI_FLINEAR0_3300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3299, v ds
+# define BFI_FLINEAR0_3300_TICK(t)
+# define BFI_FLINEAR0_3299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3298, v ds
+# define BFI_FLINEAR0_3299_TICK(t)
+# define BFI_FLINEAR0_3298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3297, v ds
+# define BFI_FLINEAR0_3298_TICK(t)
+# define BFI_FLINEAR0_3297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3296, v ds
+# define BFI_FLINEAR0_3297_TICK(t)
+# define BFI_FLINEAR0_3296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3295, v ds
+# define BFI_FLINEAR0_3296_TICK(t)
+# define BFI_FLINEAR0_3295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3294, v ds
+# define BFI_FLINEAR0_3295_TICK(t)
+# define BFI_FLINEAR0_3294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3293, v ds
+# define BFI_FLINEAR0_3294_TICK(t)
+# define BFI_FLINEAR0_3293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3292, v ds
+# define BFI_FLINEAR0_3293_TICK(t)
+# define BFI_FLINEAR0_3292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3291, v ds
+# define BFI_FLINEAR0_3292_TICK(t)
+# define BFI_FLINEAR0_3291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3290, v ds
+# define BFI_FLINEAR0_3291_TICK(t)
+# define BFI_FLINEAR0_3290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3289, v ds
+# define BFI_FLINEAR0_3290_TICK(t)
+# define BFI_FLINEAR0_3289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3288, v ds
+# define BFI_FLINEAR0_3289_TICK(t)
+# define BFI_FLINEAR0_3288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3287, v ds
+# define BFI_FLINEAR0_3288_TICK(t)
+# define BFI_FLINEAR0_3287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3286, v ds
+# define BFI_FLINEAR0_3287_TICK(t)
+# define BFI_FLINEAR0_3286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3285, v ds
+# define BFI_FLINEAR0_3286_TICK(t)
+# define BFI_FLINEAR0_3285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3284, v ds
+# define BFI_FLINEAR0_3285_TICK(t)
+# define BFI_FLINEAR0_3284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3283, v ds
+# define BFI_FLINEAR0_3284_TICK(t)
+# define BFI_FLINEAR0_3283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3282, v ds
+# define BFI_FLINEAR0_3283_TICK(t)
+# define BFI_FLINEAR0_3282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3281, v ds
+# define BFI_FLINEAR0_3282_TICK(t)
+# define BFI_FLINEAR0_3281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3280, v ds
+# define BFI_FLINEAR0_3281_TICK(t)
+# define BFI_FLINEAR0_3280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3279, v ds
+# define BFI_FLINEAR0_3280_TICK(t)
+# define BFI_FLINEAR0_3279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3278, v ds
+# define BFI_FLINEAR0_3279_TICK(t)
+# define BFI_FLINEAR0_3278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3277, v ds
+# define BFI_FLINEAR0_3278_TICK(t)
+# define BFI_FLINEAR0_3277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3276, v ds
+# define BFI_FLINEAR0_3277_TICK(t)
+# define BFI_FLINEAR0_3276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3275, v ds
+# define BFI_FLINEAR0_3276_TICK(t)
+# define BFI_FLINEAR0_3275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3274, v ds
+# define BFI_FLINEAR0_3275_TICK(t)
+# define BFI_FLINEAR0_3274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3273, v ds
+# define BFI_FLINEAR0_3274_TICK(t)
+# define BFI_FLINEAR0_3273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3272, v ds
+# define BFI_FLINEAR0_3273_TICK(t)
+# define BFI_FLINEAR0_3272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3271, v ds
+# define BFI_FLINEAR0_3272_TICK(t)
+# define BFI_FLINEAR0_3271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3270, v ds
+# define BFI_FLINEAR0_3271_TICK(t)
+# define BFI_FLINEAR0_3270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3269, v ds
+# define BFI_FLINEAR0_3270_TICK(t)
+# define BFI_FLINEAR0_3269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3268, v ds
+# define BFI_FLINEAR0_3269_TICK(t)
+# define BFI_FLINEAR0_3268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3267, v ds
+# define BFI_FLINEAR0_3268_TICK(t)
+# define BFI_FLINEAR0_3267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3266, v ds
+# define BFI_FLINEAR0_3267_TICK(t)
+# define BFI_FLINEAR0_3266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3265, v ds
+# define BFI_FLINEAR0_3266_TICK(t)
+# define BFI_FLINEAR0_3265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3264, v ds
+# define BFI_FLINEAR0_3265_TICK(t)
+# define BFI_FLINEAR0_3264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3263, v ds
+# define BFI_FLINEAR0_3264_TICK(t)
+# define BFI_FLINEAR0_3263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3262, v ds
+# define BFI_FLINEAR0_3263_TICK(t)
+# define BFI_FLINEAR0_3262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3261, v ds
+# define BFI_FLINEAR0_3262_TICK(t)
+# define BFI_FLINEAR0_3261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3260, v ds
+# define BFI_FLINEAR0_3261_TICK(t)
+# define BFI_FLINEAR0_3260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3259, v ds
+# define BFI_FLINEAR0_3260_TICK(t)
+# define BFI_FLINEAR0_3259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3258, v ds
+# define BFI_FLINEAR0_3259_TICK(t)
+# define BFI_FLINEAR0_3258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3257, v ds
+# define BFI_FLINEAR0_3258_TICK(t)
+# define BFI_FLINEAR0_3257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3256, v ds
+# define BFI_FLINEAR0_3257_TICK(t)
+# define BFI_FLINEAR0_3256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3255, v ds
+# define BFI_FLINEAR0_3256_TICK(t)
+# define BFI_FLINEAR0_3255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3254, v ds
+# define BFI_FLINEAR0_3255_TICK(t)
+# define BFI_FLINEAR0_3254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3253, v ds
+# define BFI_FLINEAR0_3254_TICK(t)
+# define BFI_FLINEAR0_3253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3252, v ds
+# define BFI_FLINEAR0_3253_TICK(t)
+# define BFI_FLINEAR0_3252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3251, v ds
+# define BFI_FLINEAR0_3252_TICK(t)
+# define BFI_FLINEAR0_3251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3250, v ds
+# define BFI_FLINEAR0_3251_TICK(t)
+# define BFI_FLINEAR0_3250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3249, v ds
+# define BFI_FLINEAR0_3250_TICK(t)
+# define BFI_FLINEAR0_3249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3248, v ds
+# define BFI_FLINEAR0_3249_TICK(t)
+# define BFI_FLINEAR0_3248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3247, v ds
+# define BFI_FLINEAR0_3248_TICK(t)
+# define BFI_FLINEAR0_3247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3246, v ds
+# define BFI_FLINEAR0_3247_TICK(t)
+# define BFI_FLINEAR0_3246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3245, v ds
+# define BFI_FLINEAR0_3246_TICK(t)
+# define BFI_FLINEAR0_3245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3244, v ds
+# define BFI_FLINEAR0_3245_TICK(t)
+# define BFI_FLINEAR0_3244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3243, v ds
+# define BFI_FLINEAR0_3244_TICK(t)
+# define BFI_FLINEAR0_3243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3242, v ds
+# define BFI_FLINEAR0_3243_TICK(t)
+# define BFI_FLINEAR0_3242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3241, v ds
+# define BFI_FLINEAR0_3242_TICK(t)
+# define BFI_FLINEAR0_3241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3240, v ds
+# define BFI_FLINEAR0_3241_TICK(t)
+# define BFI_FLINEAR0_3240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3239, v ds
+# define BFI_FLINEAR0_3240_TICK(t)
+# define BFI_FLINEAR0_3239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3238, v ds
+# define BFI_FLINEAR0_3239_TICK(t)
+# define BFI_FLINEAR0_3238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3237, v ds
+# define BFI_FLINEAR0_3238_TICK(t)
+# define BFI_FLINEAR0_3237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3236, v ds
+# define BFI_FLINEAR0_3237_TICK(t)
+# define BFI_FLINEAR0_3236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3235, v ds
+# define BFI_FLINEAR0_3236_TICK(t)
+# define BFI_FLINEAR0_3235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3234, v ds
+# define BFI_FLINEAR0_3235_TICK(t)
+# define BFI_FLINEAR0_3234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3233, v ds
+# define BFI_FLINEAR0_3234_TICK(t)
+# define BFI_FLINEAR0_3233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3232, v ds
+# define BFI_FLINEAR0_3233_TICK(t)
+# define BFI_FLINEAR0_3232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3231, v ds
+# define BFI_FLINEAR0_3232_TICK(t)
+# define BFI_FLINEAR0_3231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3230, v ds
+# define BFI_FLINEAR0_3231_TICK(t)
+# define BFI_FLINEAR0_3230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3229, v ds
+# define BFI_FLINEAR0_3230_TICK(t)
+# define BFI_FLINEAR0_3229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3228, v ds
+# define BFI_FLINEAR0_3229_TICK(t)
+# define BFI_FLINEAR0_3228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3227, v ds
+# define BFI_FLINEAR0_3228_TICK(t)
+# define BFI_FLINEAR0_3227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3226, v ds
+# define BFI_FLINEAR0_3227_TICK(t)
+# define BFI_FLINEAR0_3226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3225, v ds
+# define BFI_FLINEAR0_3226_TICK(t)
+# define BFI_FLINEAR0_3225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3224, v ds
+# define BFI_FLINEAR0_3225_TICK(t)
+# define BFI_FLINEAR0_3224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3223, v ds
+# define BFI_FLINEAR0_3224_TICK(t)
+# define BFI_FLINEAR0_3223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3222, v ds
+# define BFI_FLINEAR0_3223_TICK(t)
+# define BFI_FLINEAR0_3222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3221, v ds
+# define BFI_FLINEAR0_3222_TICK(t)
+# define BFI_FLINEAR0_3221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3220, v ds
+# define BFI_FLINEAR0_3221_TICK(t)
+# define BFI_FLINEAR0_3220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3219, v ds
+# define BFI_FLINEAR0_3220_TICK(t)
+# define BFI_FLINEAR0_3219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3218, v ds
+# define BFI_FLINEAR0_3219_TICK(t)
+# define BFI_FLINEAR0_3218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3217, v ds
+# define BFI_FLINEAR0_3218_TICK(t)
+# define BFI_FLINEAR0_3217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3216, v ds
+# define BFI_FLINEAR0_3217_TICK(t)
+# define BFI_FLINEAR0_3216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3215, v ds
+# define BFI_FLINEAR0_3216_TICK(t)
+# define BFI_FLINEAR0_3215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3214, v ds
+# define BFI_FLINEAR0_3215_TICK(t)
+# define BFI_FLINEAR0_3214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3213, v ds
+# define BFI_FLINEAR0_3214_TICK(t)
+# define BFI_FLINEAR0_3213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3212, v ds
+# define BFI_FLINEAR0_3213_TICK(t)
+# define BFI_FLINEAR0_3212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3211, v ds
+# define BFI_FLINEAR0_3212_TICK(t)
+# define BFI_FLINEAR0_3211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3210, v ds
+# define BFI_FLINEAR0_3211_TICK(t)
+# define BFI_FLINEAR0_3210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3209, v ds
+# define BFI_FLINEAR0_3210_TICK(t)
+# define BFI_FLINEAR0_3209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3208, v ds
+# define BFI_FLINEAR0_3209_TICK(t)
+# define BFI_FLINEAR0_3208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3207, v ds
+# define BFI_FLINEAR0_3208_TICK(t)
+# define BFI_FLINEAR0_3207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3206, v ds
+# define BFI_FLINEAR0_3207_TICK(t)
+# define BFI_FLINEAR0_3206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3205, v ds
+# define BFI_FLINEAR0_3206_TICK(t)
+# define BFI_FLINEAR0_3205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3204, v ds
+# define BFI_FLINEAR0_3205_TICK(t)
+# define BFI_FLINEAR0_3204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3203, v ds
+# define BFI_FLINEAR0_3204_TICK(t)
+# define BFI_FLINEAR0_3203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3202, v ds
+# define BFI_FLINEAR0_3203_TICK(t)
+# define BFI_FLINEAR0_3202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3201, v ds
+# define BFI_FLINEAR0_3202_TICK(t)
+# define BFI_FLINEAR0_3201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3200, v ds
+# define BFI_FLINEAR0_3201_TICK(t)
+# define BFI_FLINEAR0_3200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3199, v ds
+# define BFI_FLINEAR0_3200_TICK(t)
+# define BFI_FLINEAR0_3199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3198, v ds
+# define BFI_FLINEAR0_3199_TICK(t)
+# define BFI_FLINEAR0_3198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3197, v ds
+# define BFI_FLINEAR0_3198_TICK(t)
+# define BFI_FLINEAR0_3197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3196, v ds
+# define BFI_FLINEAR0_3197_TICK(t)
+# define BFI_FLINEAR0_3196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3195, v ds
+# define BFI_FLINEAR0_3196_TICK(t)
+# define BFI_FLINEAR0_3195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3194, v ds
+# define BFI_FLINEAR0_3195_TICK(t)
+# define BFI_FLINEAR0_3194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3193, v ds
+# define BFI_FLINEAR0_3194_TICK(t)
+# define BFI_FLINEAR0_3193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3192, v ds
+# define BFI_FLINEAR0_3193_TICK(t)
+# define BFI_FLINEAR0_3192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3191, v ds
+# define BFI_FLINEAR0_3192_TICK(t)
+# define BFI_FLINEAR0_3191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3190, v ds
+# define BFI_FLINEAR0_3191_TICK(t)
+# define BFI_FLINEAR0_3190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3189, v ds
+# define BFI_FLINEAR0_3190_TICK(t)
+# define BFI_FLINEAR0_3189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3188, v ds
+# define BFI_FLINEAR0_3189_TICK(t)
+# define BFI_FLINEAR0_3188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3187, v ds
+# define BFI_FLINEAR0_3188_TICK(t)
+# define BFI_FLINEAR0_3187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3186, v ds
+# define BFI_FLINEAR0_3187_TICK(t)
+# define BFI_FLINEAR0_3186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3185, v ds
+# define BFI_FLINEAR0_3186_TICK(t)
+# define BFI_FLINEAR0_3185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3184, v ds
+# define BFI_FLINEAR0_3185_TICK(t)
+# define BFI_FLINEAR0_3184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3183, v ds
+# define BFI_FLINEAR0_3184_TICK(t)
+# define BFI_FLINEAR0_3183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3182, v ds
+# define BFI_FLINEAR0_3183_TICK(t)
+# define BFI_FLINEAR0_3182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3181, v ds
+# define BFI_FLINEAR0_3182_TICK(t)
+# define BFI_FLINEAR0_3181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3180, v ds
+# define BFI_FLINEAR0_3181_TICK(t)
+# define BFI_FLINEAR0_3180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3179, v ds
+# define BFI_FLINEAR0_3180_TICK(t)
+# define BFI_FLINEAR0_3179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3178, v ds
+# define BFI_FLINEAR0_3179_TICK(t)
+# define BFI_FLINEAR0_3178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3177, v ds
+# define BFI_FLINEAR0_3178_TICK(t)
+# define BFI_FLINEAR0_3177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3176, v ds
+# define BFI_FLINEAR0_3177_TICK(t)
+# define BFI_FLINEAR0_3176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3175, v ds
+# define BFI_FLINEAR0_3176_TICK(t)
+# define BFI_FLINEAR0_3175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3174, v ds
+# define BFI_FLINEAR0_3175_TICK(t)
+# define BFI_FLINEAR0_3174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3173, v ds
+# define BFI_FLINEAR0_3174_TICK(t)
+# define BFI_FLINEAR0_3173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3172, v ds
+# define BFI_FLINEAR0_3173_TICK(t)
+# define BFI_FLINEAR0_3172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3171, v ds
+# define BFI_FLINEAR0_3172_TICK(t)
+# define BFI_FLINEAR0_3171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3170, v ds
+# define BFI_FLINEAR0_3171_TICK(t)
+# define BFI_FLINEAR0_3170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3169, v ds
+# define BFI_FLINEAR0_3170_TICK(t)
+# define BFI_FLINEAR0_3169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3168, v ds
+# define BFI_FLINEAR0_3169_TICK(t)
+# define BFI_FLINEAR0_3168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3167, v ds
+# define BFI_FLINEAR0_3168_TICK(t)
+# define BFI_FLINEAR0_3167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3166, v ds
+# define BFI_FLINEAR0_3167_TICK(t)
+# define BFI_FLINEAR0_3166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3165, v ds
+# define BFI_FLINEAR0_3166_TICK(t)
+# define BFI_FLINEAR0_3165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3164, v ds
+# define BFI_FLINEAR0_3165_TICK(t)
+# define BFI_FLINEAR0_3164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3163, v ds
+# define BFI_FLINEAR0_3164_TICK(t)
+# define BFI_FLINEAR0_3163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3162, v ds
+# define BFI_FLINEAR0_3163_TICK(t)
+# define BFI_FLINEAR0_3162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3161, v ds
+# define BFI_FLINEAR0_3162_TICK(t)
+# define BFI_FLINEAR0_3161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3160, v ds
+# define BFI_FLINEAR0_3161_TICK(t)
+# define BFI_FLINEAR0_3160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3159, v ds
+# define BFI_FLINEAR0_3160_TICK(t)
+# define BFI_FLINEAR0_3159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3158, v ds
+# define BFI_FLINEAR0_3159_TICK(t)
+# define BFI_FLINEAR0_3158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3157, v ds
+# define BFI_FLINEAR0_3158_TICK(t)
+# define BFI_FLINEAR0_3157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3156, v ds
+# define BFI_FLINEAR0_3157_TICK(t)
+# define BFI_FLINEAR0_3156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3155, v ds
+# define BFI_FLINEAR0_3156_TICK(t)
+# define BFI_FLINEAR0_3155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3154, v ds
+# define BFI_FLINEAR0_3155_TICK(t)
+# define BFI_FLINEAR0_3154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3153, v ds
+# define BFI_FLINEAR0_3154_TICK(t)
+# define BFI_FLINEAR0_3153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3152, v ds
+# define BFI_FLINEAR0_3153_TICK(t)
+# define BFI_FLINEAR0_3152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3151, v ds
+# define BFI_FLINEAR0_3152_TICK(t)
+# define BFI_FLINEAR0_3151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3150, v ds
+# define BFI_FLINEAR0_3151_TICK(t)
+# define BFI_FLINEAR0_3150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3149, v ds
+# define BFI_FLINEAR0_3150_TICK(t)
+# define BFI_FLINEAR0_3149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3148, v ds
+# define BFI_FLINEAR0_3149_TICK(t)
+# define BFI_FLINEAR0_3148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3147, v ds
+# define BFI_FLINEAR0_3148_TICK(t)
+# define BFI_FLINEAR0_3147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3146, v ds
+# define BFI_FLINEAR0_3147_TICK(t)
+# define BFI_FLINEAR0_3146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3145, v ds
+# define BFI_FLINEAR0_3146_TICK(t)
+# define BFI_FLINEAR0_3145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3144, v ds
+# define BFI_FLINEAR0_3145_TICK(t)
+# define BFI_FLINEAR0_3144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3143, v ds
+# define BFI_FLINEAR0_3144_TICK(t)
+# define BFI_FLINEAR0_3143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3142, v ds
+# define BFI_FLINEAR0_3143_TICK(t)
+# define BFI_FLINEAR0_3142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3141, v ds
+# define BFI_FLINEAR0_3142_TICK(t)
+# define BFI_FLINEAR0_3141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3140, v ds
+# define BFI_FLINEAR0_3141_TICK(t)
+# define BFI_FLINEAR0_3140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3139, v ds
+# define BFI_FLINEAR0_3140_TICK(t)
+# define BFI_FLINEAR0_3139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3138, v ds
+# define BFI_FLINEAR0_3139_TICK(t)
+# define BFI_FLINEAR0_3138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3137, v ds
+# define BFI_FLINEAR0_3138_TICK(t)
+# define BFI_FLINEAR0_3137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3136, v ds
+# define BFI_FLINEAR0_3137_TICK(t)
+# define BFI_FLINEAR0_3136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3135, v ds
+# define BFI_FLINEAR0_3136_TICK(t)
+# define BFI_FLINEAR0_3135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3134, v ds
+# define BFI_FLINEAR0_3135_TICK(t)
+# define BFI_FLINEAR0_3134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3133, v ds
+# define BFI_FLINEAR0_3134_TICK(t)
+# define BFI_FLINEAR0_3133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3132, v ds
+# define BFI_FLINEAR0_3133_TICK(t)
+# define BFI_FLINEAR0_3132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3131, v ds
+# define BFI_FLINEAR0_3132_TICK(t)
+# define BFI_FLINEAR0_3131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3130, v ds
+# define BFI_FLINEAR0_3131_TICK(t)
+# define BFI_FLINEAR0_3130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3129, v ds
+# define BFI_FLINEAR0_3130_TICK(t)
+# define BFI_FLINEAR0_3129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3128, v ds
+# define BFI_FLINEAR0_3129_TICK(t)
+# define BFI_FLINEAR0_3128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3127, v ds
+# define BFI_FLINEAR0_3128_TICK(t)
+# define BFI_FLINEAR0_3127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3126, v ds
+# define BFI_FLINEAR0_3127_TICK(t)
+# define BFI_FLINEAR0_3126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3125, v ds
+# define BFI_FLINEAR0_3126_TICK(t)
+# define BFI_FLINEAR0_3125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3124, v ds
+# define BFI_FLINEAR0_3125_TICK(t)
+# define BFI_FLINEAR0_3124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3123, v ds
+# define BFI_FLINEAR0_3124_TICK(t)
+# define BFI_FLINEAR0_3123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3122, v ds
+# define BFI_FLINEAR0_3123_TICK(t)
+# define BFI_FLINEAR0_3122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3121, v ds
+# define BFI_FLINEAR0_3122_TICK(t)
+# define BFI_FLINEAR0_3121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3120, v ds
+# define BFI_FLINEAR0_3121_TICK(t)
+# define BFI_FLINEAR0_3120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3119, v ds
+# define BFI_FLINEAR0_3120_TICK(t)
+# define BFI_FLINEAR0_3119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3118, v ds
+# define BFI_FLINEAR0_3119_TICK(t)
+# define BFI_FLINEAR0_3118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3117, v ds
+# define BFI_FLINEAR0_3118_TICK(t)
+# define BFI_FLINEAR0_3117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3116, v ds
+# define BFI_FLINEAR0_3117_TICK(t)
+# define BFI_FLINEAR0_3116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3115, v ds
+# define BFI_FLINEAR0_3116_TICK(t)
+# define BFI_FLINEAR0_3115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3114, v ds
+# define BFI_FLINEAR0_3115_TICK(t)
+# define BFI_FLINEAR0_3114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3113, v ds
+# define BFI_FLINEAR0_3114_TICK(t)
+# define BFI_FLINEAR0_3113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3112, v ds
+# define BFI_FLINEAR0_3113_TICK(t)
+# define BFI_FLINEAR0_3112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3111, v ds
+# define BFI_FLINEAR0_3112_TICK(t)
+# define BFI_FLINEAR0_3111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3110, v ds
+# define BFI_FLINEAR0_3111_TICK(t)
+# define BFI_FLINEAR0_3110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3109, v ds
+# define BFI_FLINEAR0_3110_TICK(t)
+# define BFI_FLINEAR0_3109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3108, v ds
+# define BFI_FLINEAR0_3109_TICK(t)
+# define BFI_FLINEAR0_3108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3107, v ds
+# define BFI_FLINEAR0_3108_TICK(t)
+# define BFI_FLINEAR0_3107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3106, v ds
+# define BFI_FLINEAR0_3107_TICK(t)
+# define BFI_FLINEAR0_3106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3105, v ds
+# define BFI_FLINEAR0_3106_TICK(t)
+# define BFI_FLINEAR0_3105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3104, v ds
+# define BFI_FLINEAR0_3105_TICK(t)
+# define BFI_FLINEAR0_3104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3103, v ds
+# define BFI_FLINEAR0_3104_TICK(t)
+# define BFI_FLINEAR0_3103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3102, v ds
+# define BFI_FLINEAR0_3103_TICK(t)
+# define BFI_FLINEAR0_3102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3101, v ds
+# define BFI_FLINEAR0_3102_TICK(t)
+# define BFI_FLINEAR0_3101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3100, v ds
+# define BFI_FLINEAR0_3101_TICK(t)
+# define BFI_FLINEAR0_3100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3099, v ds
+# define BFI_FLINEAR0_3100_TICK(t)
+# define BFI_FLINEAR0_3099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3098, v ds
+# define BFI_FLINEAR0_3099_TICK(t)
+# define BFI_FLINEAR0_3098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3097, v ds
+# define BFI_FLINEAR0_3098_TICK(t)
+# define BFI_FLINEAR0_3097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3096, v ds
+# define BFI_FLINEAR0_3097_TICK(t)
+# define BFI_FLINEAR0_3096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3095, v ds
+# define BFI_FLINEAR0_3096_TICK(t)
+# define BFI_FLINEAR0_3095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3094, v ds
+# define BFI_FLINEAR0_3095_TICK(t)
+# define BFI_FLINEAR0_3094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3093, v ds
+# define BFI_FLINEAR0_3094_TICK(t)
+# define BFI_FLINEAR0_3093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3092, v ds
+# define BFI_FLINEAR0_3093_TICK(t)
+# define BFI_FLINEAR0_3092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3091, v ds
+# define BFI_FLINEAR0_3092_TICK(t)
+# define BFI_FLINEAR0_3091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3090, v ds
+# define BFI_FLINEAR0_3091_TICK(t)
+# define BFI_FLINEAR0_3090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3089, v ds
+# define BFI_FLINEAR0_3090_TICK(t)
+# define BFI_FLINEAR0_3089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3088, v ds
+# define BFI_FLINEAR0_3089_TICK(t)
+# define BFI_FLINEAR0_3088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3087, v ds
+# define BFI_FLINEAR0_3088_TICK(t)
+# define BFI_FLINEAR0_3087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3086, v ds
+# define BFI_FLINEAR0_3087_TICK(t)
+# define BFI_FLINEAR0_3086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3085, v ds
+# define BFI_FLINEAR0_3086_TICK(t)
+# define BFI_FLINEAR0_3085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3084, v ds
+# define BFI_FLINEAR0_3085_TICK(t)
+# define BFI_FLINEAR0_3084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3083, v ds
+# define BFI_FLINEAR0_3084_TICK(t)
+# define BFI_FLINEAR0_3083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3082, v ds
+# define BFI_FLINEAR0_3083_TICK(t)
+# define BFI_FLINEAR0_3082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3081, v ds
+# define BFI_FLINEAR0_3082_TICK(t)
+# define BFI_FLINEAR0_3081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3080, v ds
+# define BFI_FLINEAR0_3081_TICK(t)
+# define BFI_FLINEAR0_3080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3079, v ds
+# define BFI_FLINEAR0_3080_TICK(t)
+# define BFI_FLINEAR0_3079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3078, v ds
+# define BFI_FLINEAR0_3079_TICK(t)
+# define BFI_FLINEAR0_3078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3077, v ds
+# define BFI_FLINEAR0_3078_TICK(t)
+# define BFI_FLINEAR0_3077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3076, v ds
+# define BFI_FLINEAR0_3077_TICK(t)
+# define BFI_FLINEAR0_3076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3075, v ds
+# define BFI_FLINEAR0_3076_TICK(t)
+# define BFI_FLINEAR0_3075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3074, v ds
+# define BFI_FLINEAR0_3075_TICK(t)
+# define BFI_FLINEAR0_3074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3073, v ds
+# define BFI_FLINEAR0_3074_TICK(t)
+# define BFI_FLINEAR0_3073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3072, v ds
+# define BFI_FLINEAR0_3073_TICK(t)
+# define BFI_FLINEAR0_3072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3071, v ds
+# define BFI_FLINEAR0_3072_TICK(t)
+# define BFI_FLINEAR0_3071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3070, v ds
+# define BFI_FLINEAR0_3071_TICK(t)
+# define BFI_FLINEAR0_3070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3069, v ds
+# define BFI_FLINEAR0_3070_TICK(t)
+# define BFI_FLINEAR0_3069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3068, v ds
+# define BFI_FLINEAR0_3069_TICK(t)
+# define BFI_FLINEAR0_3068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3067, v ds
+# define BFI_FLINEAR0_3068_TICK(t)
+# define BFI_FLINEAR0_3067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3066, v ds
+# define BFI_FLINEAR0_3067_TICK(t)
+# define BFI_FLINEAR0_3066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3065, v ds
+# define BFI_FLINEAR0_3066_TICK(t)
+# define BFI_FLINEAR0_3065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3064, v ds
+# define BFI_FLINEAR0_3065_TICK(t)
+# define BFI_FLINEAR0_3064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3063, v ds
+# define BFI_FLINEAR0_3064_TICK(t)
+# define BFI_FLINEAR0_3063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3062, v ds
+# define BFI_FLINEAR0_3063_TICK(t)
+# define BFI_FLINEAR0_3062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3061, v ds
+# define BFI_FLINEAR0_3062_TICK(t)
+# define BFI_FLINEAR0_3061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3060, v ds
+# define BFI_FLINEAR0_3061_TICK(t)
+# define BFI_FLINEAR0_3060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3059, v ds
+# define BFI_FLINEAR0_3060_TICK(t)
+# define BFI_FLINEAR0_3059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3058, v ds
+# define BFI_FLINEAR0_3059_TICK(t)
+# define BFI_FLINEAR0_3058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3057, v ds
+# define BFI_FLINEAR0_3058_TICK(t)
+# define BFI_FLINEAR0_3057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3056, v ds
+# define BFI_FLINEAR0_3057_TICK(t)
+# define BFI_FLINEAR0_3056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3055, v ds
+# define BFI_FLINEAR0_3056_TICK(t)
+# define BFI_FLINEAR0_3055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3054, v ds
+# define BFI_FLINEAR0_3055_TICK(t)
+# define BFI_FLINEAR0_3054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3053, v ds
+# define BFI_FLINEAR0_3054_TICK(t)
+# define BFI_FLINEAR0_3053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3052, v ds
+# define BFI_FLINEAR0_3053_TICK(t)
+# define BFI_FLINEAR0_3052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3051, v ds
+# define BFI_FLINEAR0_3052_TICK(t)
+# define BFI_FLINEAR0_3051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3050, v ds
+# define BFI_FLINEAR0_3051_TICK(t)
+# define BFI_FLINEAR0_3050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3049, v ds
+# define BFI_FLINEAR0_3050_TICK(t)
+# define BFI_FLINEAR0_3049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3048, v ds
+# define BFI_FLINEAR0_3049_TICK(t)
+# define BFI_FLINEAR0_3048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3047, v ds
+# define BFI_FLINEAR0_3048_TICK(t)
+# define BFI_FLINEAR0_3047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3046, v ds
+# define BFI_FLINEAR0_3047_TICK(t)
+# define BFI_FLINEAR0_3046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3045, v ds
+# define BFI_FLINEAR0_3046_TICK(t)
+# define BFI_FLINEAR0_3045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3044, v ds
+# define BFI_FLINEAR0_3045_TICK(t)
+# define BFI_FLINEAR0_3044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3043, v ds
+# define BFI_FLINEAR0_3044_TICK(t)
+# define BFI_FLINEAR0_3043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3042, v ds
+# define BFI_FLINEAR0_3043_TICK(t)
+# define BFI_FLINEAR0_3042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3041, v ds
+# define BFI_FLINEAR0_3042_TICK(t)
+# define BFI_FLINEAR0_3041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3040, v ds
+# define BFI_FLINEAR0_3041_TICK(t)
+# define BFI_FLINEAR0_3040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3039, v ds
+# define BFI_FLINEAR0_3040_TICK(t)
+# define BFI_FLINEAR0_3039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3038, v ds
+# define BFI_FLINEAR0_3039_TICK(t)
+# define BFI_FLINEAR0_3038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3037, v ds
+# define BFI_FLINEAR0_3038_TICK(t)
+# define BFI_FLINEAR0_3037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3036, v ds
+# define BFI_FLINEAR0_3037_TICK(t)
+# define BFI_FLINEAR0_3036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3035, v ds
+# define BFI_FLINEAR0_3036_TICK(t)
+# define BFI_FLINEAR0_3035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3034, v ds
+# define BFI_FLINEAR0_3035_TICK(t)
+# define BFI_FLINEAR0_3034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3033, v ds
+# define BFI_FLINEAR0_3034_TICK(t)
+# define BFI_FLINEAR0_3033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3032, v ds
+# define BFI_FLINEAR0_3033_TICK(t)
+# define BFI_FLINEAR0_3032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3031, v ds
+# define BFI_FLINEAR0_3032_TICK(t)
+# define BFI_FLINEAR0_3031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3030, v ds
+# define BFI_FLINEAR0_3031_TICK(t)
+# define BFI_FLINEAR0_3030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3029, v ds
+# define BFI_FLINEAR0_3030_TICK(t)
+# define BFI_FLINEAR0_3029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3028, v ds
+# define BFI_FLINEAR0_3029_TICK(t)
+# define BFI_FLINEAR0_3028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3027, v ds
+# define BFI_FLINEAR0_3028_TICK(t)
+# define BFI_FLINEAR0_3027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3026, v ds
+# define BFI_FLINEAR0_3027_TICK(t)
+# define BFI_FLINEAR0_3026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3025, v ds
+# define BFI_FLINEAR0_3026_TICK(t)
+# define BFI_FLINEAR0_3025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3024, v ds
+# define BFI_FLINEAR0_3025_TICK(t)
+# define BFI_FLINEAR0_3024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3023, v ds
+# define BFI_FLINEAR0_3024_TICK(t)
+# define BFI_FLINEAR0_3023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3022, v ds
+# define BFI_FLINEAR0_3023_TICK(t)
+# define BFI_FLINEAR0_3022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3021, v ds
+# define BFI_FLINEAR0_3022_TICK(t)
+# define BFI_FLINEAR0_3021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3020, v ds
+# define BFI_FLINEAR0_3021_TICK(t)
+# define BFI_FLINEAR0_3020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3019, v ds
+# define BFI_FLINEAR0_3020_TICK(t)
+# define BFI_FLINEAR0_3019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3018, v ds
+# define BFI_FLINEAR0_3019_TICK(t)
+# define BFI_FLINEAR0_3018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3017, v ds
+# define BFI_FLINEAR0_3018_TICK(t)
+# define BFI_FLINEAR0_3017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3016, v ds
+# define BFI_FLINEAR0_3017_TICK(t)
+# define BFI_FLINEAR0_3016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3015, v ds
+# define BFI_FLINEAR0_3016_TICK(t)
+# define BFI_FLINEAR0_3015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3014, v ds
+# define BFI_FLINEAR0_3015_TICK(t)
+# define BFI_FLINEAR0_3014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3013, v ds
+# define BFI_FLINEAR0_3014_TICK(t)
+# define BFI_FLINEAR0_3013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3012, v ds
+# define BFI_FLINEAR0_3013_TICK(t)
+# define BFI_FLINEAR0_3012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3011, v ds
+# define BFI_FLINEAR0_3012_TICK(t)
+# define BFI_FLINEAR0_3011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3010, v ds
+# define BFI_FLINEAR0_3011_TICK(t)
+# define BFI_FLINEAR0_3010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3009, v ds
+# define BFI_FLINEAR0_3010_TICK(t)
+# define BFI_FLINEAR0_3009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3008, v ds
+# define BFI_FLINEAR0_3009_TICK(t)
+# define BFI_FLINEAR0_3008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3007, v ds
+# define BFI_FLINEAR0_3008_TICK(t)
+# define BFI_FLINEAR0_3007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3006, v ds
+# define BFI_FLINEAR0_3007_TICK(t)
+# define BFI_FLINEAR0_3006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3005, v ds
+# define BFI_FLINEAR0_3006_TICK(t)
+# define BFI_FLINEAR0_3005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3004, v ds
+# define BFI_FLINEAR0_3005_TICK(t)
+# define BFI_FLINEAR0_3004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3003, v ds
+# define BFI_FLINEAR0_3004_TICK(t)
+# define BFI_FLINEAR0_3003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3002, v ds
+# define BFI_FLINEAR0_3003_TICK(t)
+# define BFI_FLINEAR0_3002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3001, v ds
+# define BFI_FLINEAR0_3002_TICK(t)
+# define BFI_FLINEAR0_3001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3000, v ds
+# define BFI_FLINEAR0_3001_TICK(t)
+# define BFI_FLINEAR0_3000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2999, v ds
+# define BFI_FLINEAR0_3000_TICK(t)
+# define BFI_FLINEAR0_2999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2998, v ds
+# define BFI_FLINEAR0_2999_TICK(t)
+# define BFI_FLINEAR0_2998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2997, v ds
+# define BFI_FLINEAR0_2998_TICK(t)
+# define BFI_FLINEAR0_2997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2996, v ds
+# define BFI_FLINEAR0_2997_TICK(t)
+# define BFI_FLINEAR0_2996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2995, v ds
+# define BFI_FLINEAR0_2996_TICK(t)
+# define BFI_FLINEAR0_2995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2994, v ds
+# define BFI_FLINEAR0_2995_TICK(t)
+# define BFI_FLINEAR0_2994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2993, v ds
+# define BFI_FLINEAR0_2994_TICK(t)
+# define BFI_FLINEAR0_2993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2992, v ds
+# define BFI_FLINEAR0_2993_TICK(t)
+# define BFI_FLINEAR0_2992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2991, v ds
+# define BFI_FLINEAR0_2992_TICK(t)
+# define BFI_FLINEAR0_2991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2990, v ds
+# define BFI_FLINEAR0_2991_TICK(t)
+# define BFI_FLINEAR0_2990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2989, v ds
+# define BFI_FLINEAR0_2990_TICK(t)
+# define BFI_FLINEAR0_2989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2988, v ds
+# define BFI_FLINEAR0_2989_TICK(t)
+# define BFI_FLINEAR0_2988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2987, v ds
+# define BFI_FLINEAR0_2988_TICK(t)
+# define BFI_FLINEAR0_2987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2986, v ds
+# define BFI_FLINEAR0_2987_TICK(t)
+# define BFI_FLINEAR0_2986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2985, v ds
+# define BFI_FLINEAR0_2986_TICK(t)
+# define BFI_FLINEAR0_2985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2984, v ds
+# define BFI_FLINEAR0_2985_TICK(t)
+# define BFI_FLINEAR0_2984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2983, v ds
+# define BFI_FLINEAR0_2984_TICK(t)
+# define BFI_FLINEAR0_2983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2982, v ds
+# define BFI_FLINEAR0_2983_TICK(t)
+# define BFI_FLINEAR0_2982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2981, v ds
+# define BFI_FLINEAR0_2982_TICK(t)
+# define BFI_FLINEAR0_2981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2980, v ds
+# define BFI_FLINEAR0_2981_TICK(t)
+# define BFI_FLINEAR0_2980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2979, v ds
+# define BFI_FLINEAR0_2980_TICK(t)
+# define BFI_FLINEAR0_2979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2978, v ds
+# define BFI_FLINEAR0_2979_TICK(t)
+# define BFI_FLINEAR0_2978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2977, v ds
+# define BFI_FLINEAR0_2978_TICK(t)
+# define BFI_FLINEAR0_2977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2976, v ds
+# define BFI_FLINEAR0_2977_TICK(t)
+# define BFI_FLINEAR0_2976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2975, v ds
+# define BFI_FLINEAR0_2976_TICK(t)
+# define BFI_FLINEAR0_2975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2974, v ds
+# define BFI_FLINEAR0_2975_TICK(t)
+# define BFI_FLINEAR0_2974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2973, v ds
+# define BFI_FLINEAR0_2974_TICK(t)
+# define BFI_FLINEAR0_2973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2972, v ds
+# define BFI_FLINEAR0_2973_TICK(t)
+# define BFI_FLINEAR0_2972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2971, v ds
+# define BFI_FLINEAR0_2972_TICK(t)
+# define BFI_FLINEAR0_2971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2970, v ds
+# define BFI_FLINEAR0_2971_TICK(t)
+# define BFI_FLINEAR0_2970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2969, v ds
+# define BFI_FLINEAR0_2970_TICK(t)
+# define BFI_FLINEAR0_2969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2968, v ds
+# define BFI_FLINEAR0_2969_TICK(t)
+# define BFI_FLINEAR0_2968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2967, v ds
+# define BFI_FLINEAR0_2968_TICK(t)
+# define BFI_FLINEAR0_2967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2966, v ds
+# define BFI_FLINEAR0_2967_TICK(t)
+# define BFI_FLINEAR0_2966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2965, v ds
+# define BFI_FLINEAR0_2966_TICK(t)
+# define BFI_FLINEAR0_2965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2964, v ds
+# define BFI_FLINEAR0_2965_TICK(t)
+# define BFI_FLINEAR0_2964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2963, v ds
+# define BFI_FLINEAR0_2964_TICK(t)
+# define BFI_FLINEAR0_2963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2962, v ds
+# define BFI_FLINEAR0_2963_TICK(t)
+# define BFI_FLINEAR0_2962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2961, v ds
+# define BFI_FLINEAR0_2962_TICK(t)
+# define BFI_FLINEAR0_2961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2960, v ds
+# define BFI_FLINEAR0_2961_TICK(t)
+# define BFI_FLINEAR0_2960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2959, v ds
+# define BFI_FLINEAR0_2960_TICK(t)
+# define BFI_FLINEAR0_2959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2958, v ds
+# define BFI_FLINEAR0_2959_TICK(t)
+# define BFI_FLINEAR0_2958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2957, v ds
+# define BFI_FLINEAR0_2958_TICK(t)
+# define BFI_FLINEAR0_2957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2956, v ds
+# define BFI_FLINEAR0_2957_TICK(t)
+# define BFI_FLINEAR0_2956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2955, v ds
+# define BFI_FLINEAR0_2956_TICK(t)
+# define BFI_FLINEAR0_2955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2954, v ds
+# define BFI_FLINEAR0_2955_TICK(t)
+# define BFI_FLINEAR0_2954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2953, v ds
+# define BFI_FLINEAR0_2954_TICK(t)
+# define BFI_FLINEAR0_2953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2952, v ds
+# define BFI_FLINEAR0_2953_TICK(t)
+# define BFI_FLINEAR0_2952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2951, v ds
+# define BFI_FLINEAR0_2952_TICK(t)
+# define BFI_FLINEAR0_2951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2950, v ds
+# define BFI_FLINEAR0_2951_TICK(t)
+# define BFI_FLINEAR0_2950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2949, v ds
+# define BFI_FLINEAR0_2950_TICK(t)
+# define BFI_FLINEAR0_2949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2948, v ds
+# define BFI_FLINEAR0_2949_TICK(t)
+# define BFI_FLINEAR0_2948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2947, v ds
+# define BFI_FLINEAR0_2948_TICK(t)
+# define BFI_FLINEAR0_2947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2946, v ds
+# define BFI_FLINEAR0_2947_TICK(t)
+# define BFI_FLINEAR0_2946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2945, v ds
+# define BFI_FLINEAR0_2946_TICK(t)
+# define BFI_FLINEAR0_2945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2944, v ds
+# define BFI_FLINEAR0_2945_TICK(t)
+# define BFI_FLINEAR0_2944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2943, v ds
+# define BFI_FLINEAR0_2944_TICK(t)
+# define BFI_FLINEAR0_2943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2942, v ds
+# define BFI_FLINEAR0_2943_TICK(t)
+# define BFI_FLINEAR0_2942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2941, v ds
+# define BFI_FLINEAR0_2942_TICK(t)
+# define BFI_FLINEAR0_2941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2940, v ds
+# define BFI_FLINEAR0_2941_TICK(t)
+# define BFI_FLINEAR0_2940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2939, v ds
+# define BFI_FLINEAR0_2940_TICK(t)
+# define BFI_FLINEAR0_2939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2938, v ds
+# define BFI_FLINEAR0_2939_TICK(t)
+# define BFI_FLINEAR0_2938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2937, v ds
+# define BFI_FLINEAR0_2938_TICK(t)
+# define BFI_FLINEAR0_2937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2936, v ds
+# define BFI_FLINEAR0_2937_TICK(t)
+# define BFI_FLINEAR0_2936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2935, v ds
+# define BFI_FLINEAR0_2936_TICK(t)
+# define BFI_FLINEAR0_2935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2934, v ds
+# define BFI_FLINEAR0_2935_TICK(t)
+# define BFI_FLINEAR0_2934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2933, v ds
+# define BFI_FLINEAR0_2934_TICK(t)
+# define BFI_FLINEAR0_2933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2932, v ds
+# define BFI_FLINEAR0_2933_TICK(t)
+# define BFI_FLINEAR0_2932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2931, v ds
+# define BFI_FLINEAR0_2932_TICK(t)
+# define BFI_FLINEAR0_2931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2930, v ds
+# define BFI_FLINEAR0_2931_TICK(t)
+# define BFI_FLINEAR0_2930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2929, v ds
+# define BFI_FLINEAR0_2930_TICK(t)
+# define BFI_FLINEAR0_2929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2928, v ds
+# define BFI_FLINEAR0_2929_TICK(t)
+# define BFI_FLINEAR0_2928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2927, v ds
+# define BFI_FLINEAR0_2928_TICK(t)
+# define BFI_FLINEAR0_2927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2926, v ds
+# define BFI_FLINEAR0_2927_TICK(t)
+# define BFI_FLINEAR0_2926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2925, v ds
+# define BFI_FLINEAR0_2926_TICK(t)
+# define BFI_FLINEAR0_2925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2924, v ds
+# define BFI_FLINEAR0_2925_TICK(t)
+# define BFI_FLINEAR0_2924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2923, v ds
+# define BFI_FLINEAR0_2924_TICK(t)
+# define BFI_FLINEAR0_2923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2922, v ds
+# define BFI_FLINEAR0_2923_TICK(t)
+# define BFI_FLINEAR0_2922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2921, v ds
+# define BFI_FLINEAR0_2922_TICK(t)
+# define BFI_FLINEAR0_2921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2920, v ds
+# define BFI_FLINEAR0_2921_TICK(t)
+# define BFI_FLINEAR0_2920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2919, v ds
+# define BFI_FLINEAR0_2920_TICK(t)
+# define BFI_FLINEAR0_2919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2918, v ds
+# define BFI_FLINEAR0_2919_TICK(t)
+# define BFI_FLINEAR0_2918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2917, v ds
+# define BFI_FLINEAR0_2918_TICK(t)
+# define BFI_FLINEAR0_2917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2916, v ds
+# define BFI_FLINEAR0_2917_TICK(t)
+# define BFI_FLINEAR0_2916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2915, v ds
+# define BFI_FLINEAR0_2916_TICK(t)
+# define BFI_FLINEAR0_2915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2914, v ds
+# define BFI_FLINEAR0_2915_TICK(t)
+# define BFI_FLINEAR0_2914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2913, v ds
+# define BFI_FLINEAR0_2914_TICK(t)
+# define BFI_FLINEAR0_2913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2912, v ds
+# define BFI_FLINEAR0_2913_TICK(t)
+# define BFI_FLINEAR0_2912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2911, v ds
+# define BFI_FLINEAR0_2912_TICK(t)
+# define BFI_FLINEAR0_2911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2910, v ds
+# define BFI_FLINEAR0_2911_TICK(t)
+# define BFI_FLINEAR0_2910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2909, v ds
+# define BFI_FLINEAR0_2910_TICK(t)
+# define BFI_FLINEAR0_2909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2908, v ds
+# define BFI_FLINEAR0_2909_TICK(t)
+# define BFI_FLINEAR0_2908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2907, v ds
+# define BFI_FLINEAR0_2908_TICK(t)
+# define BFI_FLINEAR0_2907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2906, v ds
+# define BFI_FLINEAR0_2907_TICK(t)
+# define BFI_FLINEAR0_2906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2905, v ds
+# define BFI_FLINEAR0_2906_TICK(t)
+# define BFI_FLINEAR0_2905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2904, v ds
+# define BFI_FLINEAR0_2905_TICK(t)
+# define BFI_FLINEAR0_2904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2903, v ds
+# define BFI_FLINEAR0_2904_TICK(t)
+# define BFI_FLINEAR0_2903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2902, v ds
+# define BFI_FLINEAR0_2903_TICK(t)
+# define BFI_FLINEAR0_2902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2901, v ds
+# define BFI_FLINEAR0_2902_TICK(t)
+# define BFI_FLINEAR0_2901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2900, v ds
+# define BFI_FLINEAR0_2901_TICK(t)
+# define BFI_FLINEAR0_2900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2899, v ds
+# define BFI_FLINEAR0_2900_TICK(t)
+# define BFI_FLINEAR0_2899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2898, v ds
+# define BFI_FLINEAR0_2899_TICK(t)
+# define BFI_FLINEAR0_2898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2897, v ds
+# define BFI_FLINEAR0_2898_TICK(t)
+# define BFI_FLINEAR0_2897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2896, v ds
+# define BFI_FLINEAR0_2897_TICK(t)
+# define BFI_FLINEAR0_2896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2895, v ds
+# define BFI_FLINEAR0_2896_TICK(t)
+# define BFI_FLINEAR0_2895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2894, v ds
+# define BFI_FLINEAR0_2895_TICK(t)
+# define BFI_FLINEAR0_2894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2893, v ds
+# define BFI_FLINEAR0_2894_TICK(t)
+# define BFI_FLINEAR0_2893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2892, v ds
+# define BFI_FLINEAR0_2893_TICK(t)
+# define BFI_FLINEAR0_2892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2891, v ds
+# define BFI_FLINEAR0_2892_TICK(t)
+# define BFI_FLINEAR0_2891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2890, v ds
+# define BFI_FLINEAR0_2891_TICK(t)
+# define BFI_FLINEAR0_2890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2889, v ds
+# define BFI_FLINEAR0_2890_TICK(t)
+# define BFI_FLINEAR0_2889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2888, v ds
+# define BFI_FLINEAR0_2889_TICK(t)
+# define BFI_FLINEAR0_2888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2887, v ds
+# define BFI_FLINEAR0_2888_TICK(t)
+# define BFI_FLINEAR0_2887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2886, v ds
+# define BFI_FLINEAR0_2887_TICK(t)
+# define BFI_FLINEAR0_2886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2885, v ds
+# define BFI_FLINEAR0_2886_TICK(t)
+# define BFI_FLINEAR0_2885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2884, v ds
+# define BFI_FLINEAR0_2885_TICK(t)
+# define BFI_FLINEAR0_2884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2883, v ds
+# define BFI_FLINEAR0_2884_TICK(t)
+# define BFI_FLINEAR0_2883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2882, v ds
+# define BFI_FLINEAR0_2883_TICK(t)
+# define BFI_FLINEAR0_2882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2881, v ds
+# define BFI_FLINEAR0_2882_TICK(t)
+# define BFI_FLINEAR0_2881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2880, v ds
+# define BFI_FLINEAR0_2881_TICK(t)
+# define BFI_FLINEAR0_2880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2879, v ds
+# define BFI_FLINEAR0_2880_TICK(t)
+# define BFI_FLINEAR0_2879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2878, v ds
+# define BFI_FLINEAR0_2879_TICK(t)
+# define BFI_FLINEAR0_2878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2877, v ds
+# define BFI_FLINEAR0_2878_TICK(t)
+# define BFI_FLINEAR0_2877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2876, v ds
+# define BFI_FLINEAR0_2877_TICK(t)
+# define BFI_FLINEAR0_2876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2875, v ds
+# define BFI_FLINEAR0_2876_TICK(t)
+# define BFI_FLINEAR0_2875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2874, v ds
+# define BFI_FLINEAR0_2875_TICK(t)
+# define BFI_FLINEAR0_2874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2873, v ds
+# define BFI_FLINEAR0_2874_TICK(t)
+# define BFI_FLINEAR0_2873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2872, v ds
+# define BFI_FLINEAR0_2873_TICK(t)
+# define BFI_FLINEAR0_2872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2871, v ds
+# define BFI_FLINEAR0_2872_TICK(t)
+# define BFI_FLINEAR0_2871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2870, v ds
+# define BFI_FLINEAR0_2871_TICK(t)
+# define BFI_FLINEAR0_2870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2869, v ds
+# define BFI_FLINEAR0_2870_TICK(t)
+# define BFI_FLINEAR0_2869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2868, v ds
+# define BFI_FLINEAR0_2869_TICK(t)
+# define BFI_FLINEAR0_2868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2867, v ds
+# define BFI_FLINEAR0_2868_TICK(t)
+# define BFI_FLINEAR0_2867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2866, v ds
+# define BFI_FLINEAR0_2867_TICK(t)
+# define BFI_FLINEAR0_2866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2865, v ds
+# define BFI_FLINEAR0_2866_TICK(t)
+# define BFI_FLINEAR0_2865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2864, v ds
+# define BFI_FLINEAR0_2865_TICK(t)
+# define BFI_FLINEAR0_2864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2863, v ds
+# define BFI_FLINEAR0_2864_TICK(t)
+# define BFI_FLINEAR0_2863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2862, v ds
+# define BFI_FLINEAR0_2863_TICK(t)
+# define BFI_FLINEAR0_2862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2861, v ds
+# define BFI_FLINEAR0_2862_TICK(t)
+# define BFI_FLINEAR0_2861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2860, v ds
+# define BFI_FLINEAR0_2861_TICK(t)
+# define BFI_FLINEAR0_2860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2859, v ds
+# define BFI_FLINEAR0_2860_TICK(t)
+# define BFI_FLINEAR0_2859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2858, v ds
+# define BFI_FLINEAR0_2859_TICK(t)
+# define BFI_FLINEAR0_2858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2857, v ds
+# define BFI_FLINEAR0_2858_TICK(t)
+# define BFI_FLINEAR0_2857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2856, v ds
+# define BFI_FLINEAR0_2857_TICK(t)
+# define BFI_FLINEAR0_2856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2855, v ds
+# define BFI_FLINEAR0_2856_TICK(t)
+# define BFI_FLINEAR0_2855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2854, v ds
+# define BFI_FLINEAR0_2855_TICK(t)
+# define BFI_FLINEAR0_2854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2853, v ds
+# define BFI_FLINEAR0_2854_TICK(t)
+# define BFI_FLINEAR0_2853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2852, v ds
+# define BFI_FLINEAR0_2853_TICK(t)
+# define BFI_FLINEAR0_2852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2851, v ds
+# define BFI_FLINEAR0_2852_TICK(t)
+# define BFI_FLINEAR0_2851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2850, v ds
+# define BFI_FLINEAR0_2851_TICK(t)
+# define BFI_FLINEAR0_2850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2849, v ds
+# define BFI_FLINEAR0_2850_TICK(t)
+# define BFI_FLINEAR0_2849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2848, v ds
+# define BFI_FLINEAR0_2849_TICK(t)
+# define BFI_FLINEAR0_2848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2847, v ds
+# define BFI_FLINEAR0_2848_TICK(t)
+# define BFI_FLINEAR0_2847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2846, v ds
+# define BFI_FLINEAR0_2847_TICK(t)
+# define BFI_FLINEAR0_2846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2845, v ds
+# define BFI_FLINEAR0_2846_TICK(t)
+# define BFI_FLINEAR0_2845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2844, v ds
+# define BFI_FLINEAR0_2845_TICK(t)
+# define BFI_FLINEAR0_2844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2843, v ds
+# define BFI_FLINEAR0_2844_TICK(t)
+# define BFI_FLINEAR0_2843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2842, v ds
+# define BFI_FLINEAR0_2843_TICK(t)
+# define BFI_FLINEAR0_2842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2841, v ds
+# define BFI_FLINEAR0_2842_TICK(t)
+# define BFI_FLINEAR0_2841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2840, v ds
+# define BFI_FLINEAR0_2841_TICK(t)
+# define BFI_FLINEAR0_2840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2839, v ds
+# define BFI_FLINEAR0_2840_TICK(t)
+# define BFI_FLINEAR0_2839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2838, v ds
+# define BFI_FLINEAR0_2839_TICK(t)
+# define BFI_FLINEAR0_2838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2837, v ds
+# define BFI_FLINEAR0_2838_TICK(t)
+# define BFI_FLINEAR0_2837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2836, v ds
+# define BFI_FLINEAR0_2837_TICK(t)
+# define BFI_FLINEAR0_2836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2835, v ds
+# define BFI_FLINEAR0_2836_TICK(t)
+# define BFI_FLINEAR0_2835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2834, v ds
+# define BFI_FLINEAR0_2835_TICK(t)
+# define BFI_FLINEAR0_2834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2833, v ds
+# define BFI_FLINEAR0_2834_TICK(t)
+# define BFI_FLINEAR0_2833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2832, v ds
+# define BFI_FLINEAR0_2833_TICK(t)
+# define BFI_FLINEAR0_2832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2831, v ds
+# define BFI_FLINEAR0_2832_TICK(t)
+# define BFI_FLINEAR0_2831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2830, v ds
+# define BFI_FLINEAR0_2831_TICK(t)
+# define BFI_FLINEAR0_2830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2829, v ds
+# define BFI_FLINEAR0_2830_TICK(t)
+# define BFI_FLINEAR0_2829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2828, v ds
+# define BFI_FLINEAR0_2829_TICK(t)
+# define BFI_FLINEAR0_2828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2827, v ds
+# define BFI_FLINEAR0_2828_TICK(t)
+# define BFI_FLINEAR0_2827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2826, v ds
+# define BFI_FLINEAR0_2827_TICK(t)
+# define BFI_FLINEAR0_2826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2825, v ds
+# define BFI_FLINEAR0_2826_TICK(t)
+# define BFI_FLINEAR0_2825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2824, v ds
+# define BFI_FLINEAR0_2825_TICK(t)
+# define BFI_FLINEAR0_2824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2823, v ds
+# define BFI_FLINEAR0_2824_TICK(t)
+# define BFI_FLINEAR0_2823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2822, v ds
+# define BFI_FLINEAR0_2823_TICK(t)
+# define BFI_FLINEAR0_2822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2821, v ds
+# define BFI_FLINEAR0_2822_TICK(t)
+# define BFI_FLINEAR0_2821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2820, v ds
+# define BFI_FLINEAR0_2821_TICK(t)
+# define BFI_FLINEAR0_2820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2819, v ds
+# define BFI_FLINEAR0_2820_TICK(t)
+# define BFI_FLINEAR0_2819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2818, v ds
+# define BFI_FLINEAR0_2819_TICK(t)
+# define BFI_FLINEAR0_2818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2817, v ds
+# define BFI_FLINEAR0_2818_TICK(t)
+# define BFI_FLINEAR0_2817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2816, v ds
+# define BFI_FLINEAR0_2817_TICK(t)
+# define BFI_FLINEAR0_2816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2815, v ds
+# define BFI_FLINEAR0_2816_TICK(t)
+# define BFI_FLINEAR0_2815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2814, v ds
+# define BFI_FLINEAR0_2815_TICK(t)
+# define BFI_FLINEAR0_2814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2813, v ds
+# define BFI_FLINEAR0_2814_TICK(t)
+# define BFI_FLINEAR0_2813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2812, v ds
+# define BFI_FLINEAR0_2813_TICK(t)
+# define BFI_FLINEAR0_2812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2811, v ds
+# define BFI_FLINEAR0_2812_TICK(t)
+# define BFI_FLINEAR0_2811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2810, v ds
+# define BFI_FLINEAR0_2811_TICK(t)
+# define BFI_FLINEAR0_2810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2809, v ds
+# define BFI_FLINEAR0_2810_TICK(t)
+# define BFI_FLINEAR0_2809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2808, v ds
+# define BFI_FLINEAR0_2809_TICK(t)
+# define BFI_FLINEAR0_2808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2807, v ds
+# define BFI_FLINEAR0_2808_TICK(t)
+# define BFI_FLINEAR0_2807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2806, v ds
+# define BFI_FLINEAR0_2807_TICK(t)
+# define BFI_FLINEAR0_2806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2805, v ds
+# define BFI_FLINEAR0_2806_TICK(t)
+# define BFI_FLINEAR0_2805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2804, v ds
+# define BFI_FLINEAR0_2805_TICK(t)
+# define BFI_FLINEAR0_2804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2803, v ds
+# define BFI_FLINEAR0_2804_TICK(t)
+# define BFI_FLINEAR0_2803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2802, v ds
+# define BFI_FLINEAR0_2803_TICK(t)
+# define BFI_FLINEAR0_2802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2801, v ds
+# define BFI_FLINEAR0_2802_TICK(t)
+# define BFI_FLINEAR0_2801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2800, v ds
+# define BFI_FLINEAR0_2801_TICK(t)
+# define BFI_FLINEAR0_2800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2799, v ds
+# define BFI_FLINEAR0_2800_TICK(t)
+# define BFI_FLINEAR0_2799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2798, v ds
+# define BFI_FLINEAR0_2799_TICK(t)
+# define BFI_FLINEAR0_2798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2797, v ds
+# define BFI_FLINEAR0_2798_TICK(t)
+# define BFI_FLINEAR0_2797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2796, v ds
+# define BFI_FLINEAR0_2797_TICK(t)
+# define BFI_FLINEAR0_2796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2795, v ds
+# define BFI_FLINEAR0_2796_TICK(t)
+# define BFI_FLINEAR0_2795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2794, v ds
+# define BFI_FLINEAR0_2795_TICK(t)
+# define BFI_FLINEAR0_2794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2793, v ds
+# define BFI_FLINEAR0_2794_TICK(t)
+# define BFI_FLINEAR0_2793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2792, v ds
+# define BFI_FLINEAR0_2793_TICK(t)
+# define BFI_FLINEAR0_2792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2791, v ds
+# define BFI_FLINEAR0_2792_TICK(t)
+# define BFI_FLINEAR0_2791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2790, v ds
+# define BFI_FLINEAR0_2791_TICK(t)
+# define BFI_FLINEAR0_2790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2789, v ds
+# define BFI_FLINEAR0_2790_TICK(t)
+# define BFI_FLINEAR0_2789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2788, v ds
+# define BFI_FLINEAR0_2789_TICK(t)
+# define BFI_FLINEAR0_2788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2787, v ds
+# define BFI_FLINEAR0_2788_TICK(t)
+# define BFI_FLINEAR0_2787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2786, v ds
+# define BFI_FLINEAR0_2787_TICK(t)
+# define BFI_FLINEAR0_2786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2785, v ds
+# define BFI_FLINEAR0_2786_TICK(t)
+# define BFI_FLINEAR0_2785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2784, v ds
+# define BFI_FLINEAR0_2785_TICK(t)
+# define BFI_FLINEAR0_2784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2783, v ds
+# define BFI_FLINEAR0_2784_TICK(t)
+# define BFI_FLINEAR0_2783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2782, v ds
+# define BFI_FLINEAR0_2783_TICK(t)
+# define BFI_FLINEAR0_2782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2781, v ds
+# define BFI_FLINEAR0_2782_TICK(t)
+# define BFI_FLINEAR0_2781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2780, v ds
+# define BFI_FLINEAR0_2781_TICK(t)
+# define BFI_FLINEAR0_2780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2779, v ds
+# define BFI_FLINEAR0_2780_TICK(t)
+# define BFI_FLINEAR0_2779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2778, v ds
+# define BFI_FLINEAR0_2779_TICK(t)
+# define BFI_FLINEAR0_2778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2777, v ds
+# define BFI_FLINEAR0_2778_TICK(t)
+# define BFI_FLINEAR0_2777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2776, v ds
+# define BFI_FLINEAR0_2777_TICK(t)
+# define BFI_FLINEAR0_2776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2775, v ds
+# define BFI_FLINEAR0_2776_TICK(t)
+# define BFI_FLINEAR0_2775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2774, v ds
+# define BFI_FLINEAR0_2775_TICK(t)
+# define BFI_FLINEAR0_2774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2773, v ds
+# define BFI_FLINEAR0_2774_TICK(t)
+# define BFI_FLINEAR0_2773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2772, v ds
+# define BFI_FLINEAR0_2773_TICK(t)
+# define BFI_FLINEAR0_2772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2771, v ds
+# define BFI_FLINEAR0_2772_TICK(t)
+# define BFI_FLINEAR0_2771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2770, v ds
+# define BFI_FLINEAR0_2771_TICK(t)
+# define BFI_FLINEAR0_2770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2769, v ds
+# define BFI_FLINEAR0_2770_TICK(t)
+# define BFI_FLINEAR0_2769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2768, v ds
+# define BFI_FLINEAR0_2769_TICK(t)
+# define BFI_FLINEAR0_2768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2767, v ds
+# define BFI_FLINEAR0_2768_TICK(t)
+# define BFI_FLINEAR0_2767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2766, v ds
+# define BFI_FLINEAR0_2767_TICK(t)
+# define BFI_FLINEAR0_2766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2765, v ds
+# define BFI_FLINEAR0_2766_TICK(t)
+# define BFI_FLINEAR0_2765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2764, v ds
+# define BFI_FLINEAR0_2765_TICK(t)
+# define BFI_FLINEAR0_2764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2763, v ds
+# define BFI_FLINEAR0_2764_TICK(t)
+# define BFI_FLINEAR0_2763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2762, v ds
+# define BFI_FLINEAR0_2763_TICK(t)
+# define BFI_FLINEAR0_2762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2761, v ds
+# define BFI_FLINEAR0_2762_TICK(t)
+# define BFI_FLINEAR0_2761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2760, v ds
+# define BFI_FLINEAR0_2761_TICK(t)
+# define BFI_FLINEAR0_2760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2759, v ds
+# define BFI_FLINEAR0_2760_TICK(t)
+# define BFI_FLINEAR0_2759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2758, v ds
+# define BFI_FLINEAR0_2759_TICK(t)
+# define BFI_FLINEAR0_2758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2757, v ds
+# define BFI_FLINEAR0_2758_TICK(t)
+# define BFI_FLINEAR0_2757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2756, v ds
+# define BFI_FLINEAR0_2757_TICK(t)
+# define BFI_FLINEAR0_2756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2755, v ds
+# define BFI_FLINEAR0_2756_TICK(t)
+# define BFI_FLINEAR0_2755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2754, v ds
+# define BFI_FLINEAR0_2755_TICK(t)
+# define BFI_FLINEAR0_2754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2753, v ds
+# define BFI_FLINEAR0_2754_TICK(t)
+# define BFI_FLINEAR0_2753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2752, v ds
+# define BFI_FLINEAR0_2753_TICK(t)
+# define BFI_FLINEAR0_2752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2751, v ds
+# define BFI_FLINEAR0_2752_TICK(t)
+# define BFI_FLINEAR0_2751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2750, v ds
+# define BFI_FLINEAR0_2751_TICK(t)
+# define BFI_FLINEAR0_2750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2749, v ds
+# define BFI_FLINEAR0_2750_TICK(t)
+# define BFI_FLINEAR0_2749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2748, v ds
+# define BFI_FLINEAR0_2749_TICK(t)
+# define BFI_FLINEAR0_2748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2747, v ds
+# define BFI_FLINEAR0_2748_TICK(t)
+# define BFI_FLINEAR0_2747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2746, v ds
+# define BFI_FLINEAR0_2747_TICK(t)
+# define BFI_FLINEAR0_2746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2745, v ds
+# define BFI_FLINEAR0_2746_TICK(t)
+# define BFI_FLINEAR0_2745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2744, v ds
+# define BFI_FLINEAR0_2745_TICK(t)
+# define BFI_FLINEAR0_2744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2743, v ds
+# define BFI_FLINEAR0_2744_TICK(t)
+# define BFI_FLINEAR0_2743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2742, v ds
+# define BFI_FLINEAR0_2743_TICK(t)
+# define BFI_FLINEAR0_2742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2741, v ds
+# define BFI_FLINEAR0_2742_TICK(t)
+# define BFI_FLINEAR0_2741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2740, v ds
+# define BFI_FLINEAR0_2741_TICK(t)
+# define BFI_FLINEAR0_2740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2739, v ds
+# define BFI_FLINEAR0_2740_TICK(t)
+# define BFI_FLINEAR0_2739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2738, v ds
+# define BFI_FLINEAR0_2739_TICK(t)
+# define BFI_FLINEAR0_2738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2737, v ds
+# define BFI_FLINEAR0_2738_TICK(t)
+# define BFI_FLINEAR0_2737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2736, v ds
+# define BFI_FLINEAR0_2737_TICK(t)
+# define BFI_FLINEAR0_2736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2735, v ds
+# define BFI_FLINEAR0_2736_TICK(t)
+# define BFI_FLINEAR0_2735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2734, v ds
+# define BFI_FLINEAR0_2735_TICK(t)
+# define BFI_FLINEAR0_2734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2733, v ds
+# define BFI_FLINEAR0_2734_TICK(t)
+# define BFI_FLINEAR0_2733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2732, v ds
+# define BFI_FLINEAR0_2733_TICK(t)
+# define BFI_FLINEAR0_2732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2731, v ds
+# define BFI_FLINEAR0_2732_TICK(t)
+# define BFI_FLINEAR0_2731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2730, v ds
+# define BFI_FLINEAR0_2731_TICK(t)
+# define BFI_FLINEAR0_2730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2729, v ds
+# define BFI_FLINEAR0_2730_TICK(t)
+# define BFI_FLINEAR0_2729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2728, v ds
+# define BFI_FLINEAR0_2729_TICK(t)
+# define BFI_FLINEAR0_2728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2727, v ds
+# define BFI_FLINEAR0_2728_TICK(t)
+# define BFI_FLINEAR0_2727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2726, v ds
+# define BFI_FLINEAR0_2727_TICK(t)
+# define BFI_FLINEAR0_2726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2725, v ds
+# define BFI_FLINEAR0_2726_TICK(t)
+# define BFI_FLINEAR0_2725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2724, v ds
+# define BFI_FLINEAR0_2725_TICK(t)
+# define BFI_FLINEAR0_2724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2723, v ds
+# define BFI_FLINEAR0_2724_TICK(t)
+# define BFI_FLINEAR0_2723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2722, v ds
+# define BFI_FLINEAR0_2723_TICK(t)
+# define BFI_FLINEAR0_2722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2721, v ds
+# define BFI_FLINEAR0_2722_TICK(t)
+# define BFI_FLINEAR0_2721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2720, v ds
+# define BFI_FLINEAR0_2721_TICK(t)
+# define BFI_FLINEAR0_2720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2719, v ds
+# define BFI_FLINEAR0_2720_TICK(t)
+# define BFI_FLINEAR0_2719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2718, v ds
+# define BFI_FLINEAR0_2719_TICK(t)
+# define BFI_FLINEAR0_2718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2717, v ds
+# define BFI_FLINEAR0_2718_TICK(t)
+# define BFI_FLINEAR0_2717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2716, v ds
+# define BFI_FLINEAR0_2717_TICK(t)
+# define BFI_FLINEAR0_2716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2715, v ds
+# define BFI_FLINEAR0_2716_TICK(t)
+# define BFI_FLINEAR0_2715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2714, v ds
+# define BFI_FLINEAR0_2715_TICK(t)
+# define BFI_FLINEAR0_2714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2713, v ds
+# define BFI_FLINEAR0_2714_TICK(t)
+# define BFI_FLINEAR0_2713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2712, v ds
+# define BFI_FLINEAR0_2713_TICK(t)
+# define BFI_FLINEAR0_2712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2711, v ds
+# define BFI_FLINEAR0_2712_TICK(t)
+# define BFI_FLINEAR0_2711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2710, v ds
+# define BFI_FLINEAR0_2711_TICK(t)
+# define BFI_FLINEAR0_2710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2709, v ds
+# define BFI_FLINEAR0_2710_TICK(t)
+# define BFI_FLINEAR0_2709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2708, v ds
+# define BFI_FLINEAR0_2709_TICK(t)
+# define BFI_FLINEAR0_2708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2707, v ds
+# define BFI_FLINEAR0_2708_TICK(t)
+# define BFI_FLINEAR0_2707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2706, v ds
+# define BFI_FLINEAR0_2707_TICK(t)
+# define BFI_FLINEAR0_2706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2705, v ds
+# define BFI_FLINEAR0_2706_TICK(t)
+# define BFI_FLINEAR0_2705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2704, v ds
+# define BFI_FLINEAR0_2705_TICK(t)
+# define BFI_FLINEAR0_2704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2703, v ds
+# define BFI_FLINEAR0_2704_TICK(t)
+# define BFI_FLINEAR0_2703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2702, v ds
+# define BFI_FLINEAR0_2703_TICK(t)
+# define BFI_FLINEAR0_2702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2701, v ds
+# define BFI_FLINEAR0_2702_TICK(t)
+# define BFI_FLINEAR0_2701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2700, v ds
+# define BFI_FLINEAR0_2701_TICK(t)
+# define BFI_FLINEAR0_2700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2699, v ds
+# define BFI_FLINEAR0_2700_TICK(t)
+# define BFI_FLINEAR0_2699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2698, v ds
+# define BFI_FLINEAR0_2699_TICK(t)
+# define BFI_FLINEAR0_2698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2697, v ds
+# define BFI_FLINEAR0_2698_TICK(t)
+# define BFI_FLINEAR0_2697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2696, v ds
+# define BFI_FLINEAR0_2697_TICK(t)
+# define BFI_FLINEAR0_2696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2695, v ds
+# define BFI_FLINEAR0_2696_TICK(t)
+# define BFI_FLINEAR0_2695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2694, v ds
+# define BFI_FLINEAR0_2695_TICK(t)
+# define BFI_FLINEAR0_2694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2693, v ds
+# define BFI_FLINEAR0_2694_TICK(t)
+# define BFI_FLINEAR0_2693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2692, v ds
+# define BFI_FLINEAR0_2693_TICK(t)
+# define BFI_FLINEAR0_2692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2691, v ds
+# define BFI_FLINEAR0_2692_TICK(t)
+# define BFI_FLINEAR0_2691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2690, v ds
+# define BFI_FLINEAR0_2691_TICK(t)
+# define BFI_FLINEAR0_2690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2689, v ds
+# define BFI_FLINEAR0_2690_TICK(t)
+# define BFI_FLINEAR0_2689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2688, v ds
+# define BFI_FLINEAR0_2689_TICK(t)
+# define BFI_FLINEAR0_2688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2687, v ds
+# define BFI_FLINEAR0_2688_TICK(t)
+# define BFI_FLINEAR0_2687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2686, v ds
+# define BFI_FLINEAR0_2687_TICK(t)
+# define BFI_FLINEAR0_2686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2685, v ds
+# define BFI_FLINEAR0_2686_TICK(t)
+# define BFI_FLINEAR0_2685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2684, v ds
+# define BFI_FLINEAR0_2685_TICK(t)
+# define BFI_FLINEAR0_2684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2683, v ds
+# define BFI_FLINEAR0_2684_TICK(t)
+# define BFI_FLINEAR0_2683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2682, v ds
+# define BFI_FLINEAR0_2683_TICK(t)
+# define BFI_FLINEAR0_2682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2681, v ds
+# define BFI_FLINEAR0_2682_TICK(t)
+# define BFI_FLINEAR0_2681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2680, v ds
+# define BFI_FLINEAR0_2681_TICK(t)
+# define BFI_FLINEAR0_2680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2679, v ds
+# define BFI_FLINEAR0_2680_TICK(t)
+# define BFI_FLINEAR0_2679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2678, v ds
+# define BFI_FLINEAR0_2679_TICK(t)
+# define BFI_FLINEAR0_2678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2677, v ds
+# define BFI_FLINEAR0_2678_TICK(t)
+# define BFI_FLINEAR0_2677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2676, v ds
+# define BFI_FLINEAR0_2677_TICK(t)
+# define BFI_FLINEAR0_2676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2675, v ds
+# define BFI_FLINEAR0_2676_TICK(t)
+# define BFI_FLINEAR0_2675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2674, v ds
+# define BFI_FLINEAR0_2675_TICK(t)
+# define BFI_FLINEAR0_2674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2673, v ds
+# define BFI_FLINEAR0_2674_TICK(t)
+# define BFI_FLINEAR0_2673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2672, v ds
+# define BFI_FLINEAR0_2673_TICK(t)
+# define BFI_FLINEAR0_2672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2671, v ds
+# define BFI_FLINEAR0_2672_TICK(t)
+# define BFI_FLINEAR0_2671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2670, v ds
+# define BFI_FLINEAR0_2671_TICK(t)
+# define BFI_FLINEAR0_2670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2669, v ds
+# define BFI_FLINEAR0_2670_TICK(t)
+# define BFI_FLINEAR0_2669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2668, v ds
+# define BFI_FLINEAR0_2669_TICK(t)
+# define BFI_FLINEAR0_2668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2667, v ds
+# define BFI_FLINEAR0_2668_TICK(t)
+# define BFI_FLINEAR0_2667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2666, v ds
+# define BFI_FLINEAR0_2667_TICK(t)
+# define BFI_FLINEAR0_2666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2665, v ds
+# define BFI_FLINEAR0_2666_TICK(t)
+# define BFI_FLINEAR0_2665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2664, v ds
+# define BFI_FLINEAR0_2665_TICK(t)
+# define BFI_FLINEAR0_2664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2663, v ds
+# define BFI_FLINEAR0_2664_TICK(t)
+# define BFI_FLINEAR0_2663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2662, v ds
+# define BFI_FLINEAR0_2663_TICK(t)
+# define BFI_FLINEAR0_2662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2661, v ds
+# define BFI_FLINEAR0_2662_TICK(t)
+# define BFI_FLINEAR0_2661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2660, v ds
+# define BFI_FLINEAR0_2661_TICK(t)
+# define BFI_FLINEAR0_2660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2659, v ds
+# define BFI_FLINEAR0_2660_TICK(t)
+# define BFI_FLINEAR0_2659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2658, v ds
+# define BFI_FLINEAR0_2659_TICK(t)
+# define BFI_FLINEAR0_2658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2657, v ds
+# define BFI_FLINEAR0_2658_TICK(t)
+# define BFI_FLINEAR0_2657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2656, v ds
+# define BFI_FLINEAR0_2657_TICK(t)
+# define BFI_FLINEAR0_2656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2655, v ds
+# define BFI_FLINEAR0_2656_TICK(t)
+# define BFI_FLINEAR0_2655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2654, v ds
+# define BFI_FLINEAR0_2655_TICK(t)
+# define BFI_FLINEAR0_2654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2653, v ds
+# define BFI_FLINEAR0_2654_TICK(t)
+# define BFI_FLINEAR0_2653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2652, v ds
+# define BFI_FLINEAR0_2653_TICK(t)
+# define BFI_FLINEAR0_2652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2651, v ds
+# define BFI_FLINEAR0_2652_TICK(t)
+# define BFI_FLINEAR0_2651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2650, v ds
+# define BFI_FLINEAR0_2651_TICK(t)
+# define BFI_FLINEAR0_2650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2649, v ds
+# define BFI_FLINEAR0_2650_TICK(t)
+# define BFI_FLINEAR0_2649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2648, v ds
+# define BFI_FLINEAR0_2649_TICK(t)
+# define BFI_FLINEAR0_2648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2647, v ds
+# define BFI_FLINEAR0_2648_TICK(t)
+# define BFI_FLINEAR0_2647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2646, v ds
+# define BFI_FLINEAR0_2647_TICK(t)
+# define BFI_FLINEAR0_2646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2645, v ds
+# define BFI_FLINEAR0_2646_TICK(t)
+# define BFI_FLINEAR0_2645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2644, v ds
+# define BFI_FLINEAR0_2645_TICK(t)
+# define BFI_FLINEAR0_2644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2643, v ds
+# define BFI_FLINEAR0_2644_TICK(t)
+# define BFI_FLINEAR0_2643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2642, v ds
+# define BFI_FLINEAR0_2643_TICK(t)
+# define BFI_FLINEAR0_2642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2641, v ds
+# define BFI_FLINEAR0_2642_TICK(t)
+# define BFI_FLINEAR0_2641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2640, v ds
+# define BFI_FLINEAR0_2641_TICK(t)
+# define BFI_FLINEAR0_2640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2639, v ds
+# define BFI_FLINEAR0_2640_TICK(t)
+# define BFI_FLINEAR0_2639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2638, v ds
+# define BFI_FLINEAR0_2639_TICK(t)
+# define BFI_FLINEAR0_2638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2637, v ds
+# define BFI_FLINEAR0_2638_TICK(t)
+# define BFI_FLINEAR0_2637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2636, v ds
+# define BFI_FLINEAR0_2637_TICK(t)
+# define BFI_FLINEAR0_2636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2635, v ds
+# define BFI_FLINEAR0_2636_TICK(t)
+# define BFI_FLINEAR0_2635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2634, v ds
+# define BFI_FLINEAR0_2635_TICK(t)
+# define BFI_FLINEAR0_2634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2633, v ds
+# define BFI_FLINEAR0_2634_TICK(t)
+# define BFI_FLINEAR0_2633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2632, v ds
+# define BFI_FLINEAR0_2633_TICK(t)
+# define BFI_FLINEAR0_2632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2631, v ds
+# define BFI_FLINEAR0_2632_TICK(t)
+# define BFI_FLINEAR0_2631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2630, v ds
+# define BFI_FLINEAR0_2631_TICK(t)
+# define BFI_FLINEAR0_2630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2629, v ds
+# define BFI_FLINEAR0_2630_TICK(t)
+# define BFI_FLINEAR0_2629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2628, v ds
+# define BFI_FLINEAR0_2629_TICK(t)
+# define BFI_FLINEAR0_2628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2627, v ds
+# define BFI_FLINEAR0_2628_TICK(t)
+# define BFI_FLINEAR0_2627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2626, v ds
+# define BFI_FLINEAR0_2627_TICK(t)
+# define BFI_FLINEAR0_2626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2625, v ds
+# define BFI_FLINEAR0_2626_TICK(t)
+# define BFI_FLINEAR0_2625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2624, v ds
+# define BFI_FLINEAR0_2625_TICK(t)
+# define BFI_FLINEAR0_2624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2623, v ds
+# define BFI_FLINEAR0_2624_TICK(t)
+# define BFI_FLINEAR0_2623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2622, v ds
+# define BFI_FLINEAR0_2623_TICK(t)
+# define BFI_FLINEAR0_2622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2621, v ds
+# define BFI_FLINEAR0_2622_TICK(t)
+# define BFI_FLINEAR0_2621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2620, v ds
+# define BFI_FLINEAR0_2621_TICK(t)
+# define BFI_FLINEAR0_2620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2619, v ds
+# define BFI_FLINEAR0_2620_TICK(t)
+# define BFI_FLINEAR0_2619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2618, v ds
+# define BFI_FLINEAR0_2619_TICK(t)
+# define BFI_FLINEAR0_2618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2617, v ds
+# define BFI_FLINEAR0_2618_TICK(t)
+# define BFI_FLINEAR0_2617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2616, v ds
+# define BFI_FLINEAR0_2617_TICK(t)
+# define BFI_FLINEAR0_2616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2615, v ds
+# define BFI_FLINEAR0_2616_TICK(t)
+# define BFI_FLINEAR0_2615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2614, v ds
+# define BFI_FLINEAR0_2615_TICK(t)
+# define BFI_FLINEAR0_2614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2613, v ds
+# define BFI_FLINEAR0_2614_TICK(t)
+# define BFI_FLINEAR0_2613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2612, v ds
+# define BFI_FLINEAR0_2613_TICK(t)
+# define BFI_FLINEAR0_2612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2611, v ds
+# define BFI_FLINEAR0_2612_TICK(t)
+# define BFI_FLINEAR0_2611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2610, v ds
+# define BFI_FLINEAR0_2611_TICK(t)
+# define BFI_FLINEAR0_2610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2609, v ds
+# define BFI_FLINEAR0_2610_TICK(t)
+# define BFI_FLINEAR0_2609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2608, v ds
+# define BFI_FLINEAR0_2609_TICK(t)
+# define BFI_FLINEAR0_2608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2607, v ds
+# define BFI_FLINEAR0_2608_TICK(t)
+# define BFI_FLINEAR0_2607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2606, v ds
+# define BFI_FLINEAR0_2607_TICK(t)
+# define BFI_FLINEAR0_2606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2605, v ds
+# define BFI_FLINEAR0_2606_TICK(t)
+# define BFI_FLINEAR0_2605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2604, v ds
+# define BFI_FLINEAR0_2605_TICK(t)
+# define BFI_FLINEAR0_2604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2603, v ds
+# define BFI_FLINEAR0_2604_TICK(t)
+# define BFI_FLINEAR0_2603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2602, v ds
+# define BFI_FLINEAR0_2603_TICK(t)
+# define BFI_FLINEAR0_2602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2601, v ds
+# define BFI_FLINEAR0_2602_TICK(t)
+# define BFI_FLINEAR0_2601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2600, v ds
+# define BFI_FLINEAR0_2601_TICK(t)
+# define BFI_FLINEAR0_2600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2599, v ds
+# define BFI_FLINEAR0_2600_TICK(t)
+# define BFI_FLINEAR0_2599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2598, v ds
+# define BFI_FLINEAR0_2599_TICK(t)
+# define BFI_FLINEAR0_2598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2597, v ds
+# define BFI_FLINEAR0_2598_TICK(t)
+# define BFI_FLINEAR0_2597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2596, v ds
+# define BFI_FLINEAR0_2597_TICK(t)
+# define BFI_FLINEAR0_2596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2595, v ds
+# define BFI_FLINEAR0_2596_TICK(t)
+# define BFI_FLINEAR0_2595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2594, v ds
+# define BFI_FLINEAR0_2595_TICK(t)
+# define BFI_FLINEAR0_2594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2593, v ds
+# define BFI_FLINEAR0_2594_TICK(t)
+# define BFI_FLINEAR0_2593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2592, v ds
+# define BFI_FLINEAR0_2593_TICK(t)
+# define BFI_FLINEAR0_2592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2591, v ds
+# define BFI_FLINEAR0_2592_TICK(t)
+# define BFI_FLINEAR0_2591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2590, v ds
+# define BFI_FLINEAR0_2591_TICK(t)
+# define BFI_FLINEAR0_2590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2589, v ds
+# define BFI_FLINEAR0_2590_TICK(t)
+# define BFI_FLINEAR0_2589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2588, v ds
+# define BFI_FLINEAR0_2589_TICK(t)
+# define BFI_FLINEAR0_2588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2587, v ds
+# define BFI_FLINEAR0_2588_TICK(t)
+# define BFI_FLINEAR0_2587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2586, v ds
+# define BFI_FLINEAR0_2587_TICK(t)
+# define BFI_FLINEAR0_2586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2585, v ds
+# define BFI_FLINEAR0_2586_TICK(t)
+# define BFI_FLINEAR0_2585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2584, v ds
+# define BFI_FLINEAR0_2585_TICK(t)
+# define BFI_FLINEAR0_2584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2583, v ds
+# define BFI_FLINEAR0_2584_TICK(t)
+# define BFI_FLINEAR0_2583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2582, v ds
+# define BFI_FLINEAR0_2583_TICK(t)
+# define BFI_FLINEAR0_2582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2581, v ds
+# define BFI_FLINEAR0_2582_TICK(t)
+# define BFI_FLINEAR0_2581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2580, v ds
+# define BFI_FLINEAR0_2581_TICK(t)
+# define BFI_FLINEAR0_2580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2579, v ds
+# define BFI_FLINEAR0_2580_TICK(t)
+# define BFI_FLINEAR0_2579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2578, v ds
+# define BFI_FLINEAR0_2579_TICK(t)
+# define BFI_FLINEAR0_2578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2577, v ds
+# define BFI_FLINEAR0_2578_TICK(t)
+# define BFI_FLINEAR0_2577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2576, v ds
+# define BFI_FLINEAR0_2577_TICK(t)
+# define BFI_FLINEAR0_2576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2575, v ds
+# define BFI_FLINEAR0_2576_TICK(t)
+# define BFI_FLINEAR0_2575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2574, v ds
+# define BFI_FLINEAR0_2575_TICK(t)
+# define BFI_FLINEAR0_2574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2573, v ds
+# define BFI_FLINEAR0_2574_TICK(t)
+# define BFI_FLINEAR0_2573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2572, v ds
+# define BFI_FLINEAR0_2573_TICK(t)
+# define BFI_FLINEAR0_2572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2571, v ds
+# define BFI_FLINEAR0_2572_TICK(t)
+# define BFI_FLINEAR0_2571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2570, v ds
+# define BFI_FLINEAR0_2571_TICK(t)
+# define BFI_FLINEAR0_2570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2569, v ds
+# define BFI_FLINEAR0_2570_TICK(t)
+# define BFI_FLINEAR0_2569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2568, v ds
+# define BFI_FLINEAR0_2569_TICK(t)
+# define BFI_FLINEAR0_2568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2567, v ds
+# define BFI_FLINEAR0_2568_TICK(t)
+# define BFI_FLINEAR0_2567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2566, v ds
+# define BFI_FLINEAR0_2567_TICK(t)
+# define BFI_FLINEAR0_2566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2565, v ds
+# define BFI_FLINEAR0_2566_TICK(t)
+# define BFI_FLINEAR0_2565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2564, v ds
+# define BFI_FLINEAR0_2565_TICK(t)
+# define BFI_FLINEAR0_2564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2563, v ds
+# define BFI_FLINEAR0_2564_TICK(t)
+# define BFI_FLINEAR0_2563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2562, v ds
+# define BFI_FLINEAR0_2563_TICK(t)
+# define BFI_FLINEAR0_2562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2561, v ds
+# define BFI_FLINEAR0_2562_TICK(t)
+# define BFI_FLINEAR0_2561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2560, v ds
+# define BFI_FLINEAR0_2561_TICK(t)
+# define BFI_FLINEAR0_2560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2559, v ds
+# define BFI_FLINEAR0_2560_TICK(t)
+# define BFI_FLINEAR0_2559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2558, v ds
+# define BFI_FLINEAR0_2559_TICK(t)
+# define BFI_FLINEAR0_2558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2557, v ds
+# define BFI_FLINEAR0_2558_TICK(t)
+# define BFI_FLINEAR0_2557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2556, v ds
+# define BFI_FLINEAR0_2557_TICK(t)
+# define BFI_FLINEAR0_2556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2555, v ds
+# define BFI_FLINEAR0_2556_TICK(t)
+# define BFI_FLINEAR0_2555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2554, v ds
+# define BFI_FLINEAR0_2555_TICK(t)
+# define BFI_FLINEAR0_2554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2553, v ds
+# define BFI_FLINEAR0_2554_TICK(t)
+# define BFI_FLINEAR0_2553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2552, v ds
+# define BFI_FLINEAR0_2553_TICK(t)
+# define BFI_FLINEAR0_2552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2551, v ds
+# define BFI_FLINEAR0_2552_TICK(t)
+# define BFI_FLINEAR0_2551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2550, v ds
+# define BFI_FLINEAR0_2551_TICK(t)
+# define BFI_FLINEAR0_2550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2549, v ds
+# define BFI_FLINEAR0_2550_TICK(t)
+# define BFI_FLINEAR0_2549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2548, v ds
+# define BFI_FLINEAR0_2549_TICK(t)
+# define BFI_FLINEAR0_2548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2547, v ds
+# define BFI_FLINEAR0_2548_TICK(t)
+# define BFI_FLINEAR0_2547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2546, v ds
+# define BFI_FLINEAR0_2547_TICK(t)
+# define BFI_FLINEAR0_2546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2545, v ds
+# define BFI_FLINEAR0_2546_TICK(t)
+# define BFI_FLINEAR0_2545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2544, v ds
+# define BFI_FLINEAR0_2545_TICK(t)
+# define BFI_FLINEAR0_2544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2543, v ds
+# define BFI_FLINEAR0_2544_TICK(t)
+# define BFI_FLINEAR0_2543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2542, v ds
+# define BFI_FLINEAR0_2543_TICK(t)
+# define BFI_FLINEAR0_2542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2541, v ds
+# define BFI_FLINEAR0_2542_TICK(t)
+# define BFI_FLINEAR0_2541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2540, v ds
+# define BFI_FLINEAR0_2541_TICK(t)
+# define BFI_FLINEAR0_2540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2539, v ds
+# define BFI_FLINEAR0_2540_TICK(t)
+# define BFI_FLINEAR0_2539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2538, v ds
+# define BFI_FLINEAR0_2539_TICK(t)
+# define BFI_FLINEAR0_2538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2537, v ds
+# define BFI_FLINEAR0_2538_TICK(t)
+# define BFI_FLINEAR0_2537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2536, v ds
+# define BFI_FLINEAR0_2537_TICK(t)
+# define BFI_FLINEAR0_2536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2535, v ds
+# define BFI_FLINEAR0_2536_TICK(t)
+# define BFI_FLINEAR0_2535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2534, v ds
+# define BFI_FLINEAR0_2535_TICK(t)
+# define BFI_FLINEAR0_2534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2533, v ds
+# define BFI_FLINEAR0_2534_TICK(t)
+# define BFI_FLINEAR0_2533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2532, v ds
+# define BFI_FLINEAR0_2533_TICK(t)
+# define BFI_FLINEAR0_2532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2531, v ds
+# define BFI_FLINEAR0_2532_TICK(t)
+# define BFI_FLINEAR0_2531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2530, v ds
+# define BFI_FLINEAR0_2531_TICK(t)
+# define BFI_FLINEAR0_2530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2529, v ds
+# define BFI_FLINEAR0_2530_TICK(t)
+# define BFI_FLINEAR0_2529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2528, v ds
+# define BFI_FLINEAR0_2529_TICK(t)
+# define BFI_FLINEAR0_2528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2527, v ds
+# define BFI_FLINEAR0_2528_TICK(t)
+# define BFI_FLINEAR0_2527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2526, v ds
+# define BFI_FLINEAR0_2527_TICK(t)
+# define BFI_FLINEAR0_2526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2525, v ds
+# define BFI_FLINEAR0_2526_TICK(t)
+# define BFI_FLINEAR0_2525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2524, v ds
+# define BFI_FLINEAR0_2525_TICK(t)
+# define BFI_FLINEAR0_2524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2523, v ds
+# define BFI_FLINEAR0_2524_TICK(t)
+# define BFI_FLINEAR0_2523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2522, v ds
+# define BFI_FLINEAR0_2523_TICK(t)
+# define BFI_FLINEAR0_2522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2521, v ds
+# define BFI_FLINEAR0_2522_TICK(t)
+# define BFI_FLINEAR0_2521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2520, v ds
+# define BFI_FLINEAR0_2521_TICK(t)
+# define BFI_FLINEAR0_2520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2519, v ds
+# define BFI_FLINEAR0_2520_TICK(t)
+# define BFI_FLINEAR0_2519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2518, v ds
+# define BFI_FLINEAR0_2519_TICK(t)
+# define BFI_FLINEAR0_2518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2517, v ds
+# define BFI_FLINEAR0_2518_TICK(t)
+# define BFI_FLINEAR0_2517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2516, v ds
+# define BFI_FLINEAR0_2517_TICK(t)
+# define BFI_FLINEAR0_2516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2515, v ds
+# define BFI_FLINEAR0_2516_TICK(t)
+# define BFI_FLINEAR0_2515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2514, v ds
+# define BFI_FLINEAR0_2515_TICK(t)
+# define BFI_FLINEAR0_2514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2513, v ds
+# define BFI_FLINEAR0_2514_TICK(t)
+# define BFI_FLINEAR0_2513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2512, v ds
+# define BFI_FLINEAR0_2513_TICK(t)
+# define BFI_FLINEAR0_2512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2511, v ds
+# define BFI_FLINEAR0_2512_TICK(t)
+# define BFI_FLINEAR0_2511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2510, v ds
+# define BFI_FLINEAR0_2511_TICK(t)
+# define BFI_FLINEAR0_2510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2509, v ds
+# define BFI_FLINEAR0_2510_TICK(t)
+# define BFI_FLINEAR0_2509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2508, v ds
+# define BFI_FLINEAR0_2509_TICK(t)
+# define BFI_FLINEAR0_2508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2507, v ds
+# define BFI_FLINEAR0_2508_TICK(t)
+# define BFI_FLINEAR0_2507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2506, v ds
+# define BFI_FLINEAR0_2507_TICK(t)
+# define BFI_FLINEAR0_2506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2505, v ds
+# define BFI_FLINEAR0_2506_TICK(t)
+# define BFI_FLINEAR0_2505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2504, v ds
+# define BFI_FLINEAR0_2505_TICK(t)
+# define BFI_FLINEAR0_2504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2503, v ds
+# define BFI_FLINEAR0_2504_TICK(t)
+# define BFI_FLINEAR0_2503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2502, v ds
+# define BFI_FLINEAR0_2503_TICK(t)
+# define BFI_FLINEAR0_2502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2501, v ds
+# define BFI_FLINEAR0_2502_TICK(t)
+# define BFI_FLINEAR0_2501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2500, v ds
+# define BFI_FLINEAR0_2501_TICK(t)
+# define BFI_FLINEAR0_2500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2499, v ds
+# define BFI_FLINEAR0_2500_TICK(t)
+# define BFI_FLINEAR0_2499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2498, v ds
+# define BFI_FLINEAR0_2499_TICK(t)
+# define BFI_FLINEAR0_2498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2497, v ds
+# define BFI_FLINEAR0_2498_TICK(t)
+# define BFI_FLINEAR0_2497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2496, v ds
+# define BFI_FLINEAR0_2497_TICK(t)
+# define BFI_FLINEAR0_2496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2495, v ds
+# define BFI_FLINEAR0_2496_TICK(t)
+# define BFI_FLINEAR0_2495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2494, v ds
+# define BFI_FLINEAR0_2495_TICK(t)
+# define BFI_FLINEAR0_2494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2493, v ds
+# define BFI_FLINEAR0_2494_TICK(t)
+# define BFI_FLINEAR0_2493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2492, v ds
+# define BFI_FLINEAR0_2493_TICK(t)
+# define BFI_FLINEAR0_2492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2491, v ds
+# define BFI_FLINEAR0_2492_TICK(t)
+# define BFI_FLINEAR0_2491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2490, v ds
+# define BFI_FLINEAR0_2491_TICK(t)
+# define BFI_FLINEAR0_2490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2489, v ds
+# define BFI_FLINEAR0_2490_TICK(t)
+# define BFI_FLINEAR0_2489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2488, v ds
+# define BFI_FLINEAR0_2489_TICK(t)
+# define BFI_FLINEAR0_2488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2487, v ds
+# define BFI_FLINEAR0_2488_TICK(t)
+# define BFI_FLINEAR0_2487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2486, v ds
+# define BFI_FLINEAR0_2487_TICK(t)
+# define BFI_FLINEAR0_2486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2485, v ds
+# define BFI_FLINEAR0_2486_TICK(t)
+# define BFI_FLINEAR0_2485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2484, v ds
+# define BFI_FLINEAR0_2485_TICK(t)
+# define BFI_FLINEAR0_2484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2483, v ds
+# define BFI_FLINEAR0_2484_TICK(t)
+# define BFI_FLINEAR0_2483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2482, v ds
+# define BFI_FLINEAR0_2483_TICK(t)
+# define BFI_FLINEAR0_2482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2481, v ds
+# define BFI_FLINEAR0_2482_TICK(t)
+# define BFI_FLINEAR0_2481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2480, v ds
+# define BFI_FLINEAR0_2481_TICK(t)
+# define BFI_FLINEAR0_2480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2479, v ds
+# define BFI_FLINEAR0_2480_TICK(t)
+# define BFI_FLINEAR0_2479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2478, v ds
+# define BFI_FLINEAR0_2479_TICK(t)
+# define BFI_FLINEAR0_2478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2477, v ds
+# define BFI_FLINEAR0_2478_TICK(t)
+# define BFI_FLINEAR0_2477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2476, v ds
+# define BFI_FLINEAR0_2477_TICK(t)
+# define BFI_FLINEAR0_2476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2475, v ds
+# define BFI_FLINEAR0_2476_TICK(t)
+# define BFI_FLINEAR0_2475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2474, v ds
+# define BFI_FLINEAR0_2475_TICK(t)
+# define BFI_FLINEAR0_2474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2473, v ds
+# define BFI_FLINEAR0_2474_TICK(t)
+# define BFI_FLINEAR0_2473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2472, v ds
+# define BFI_FLINEAR0_2473_TICK(t)
+# define BFI_FLINEAR0_2472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2471, v ds
+# define BFI_FLINEAR0_2472_TICK(t)
+# define BFI_FLINEAR0_2471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2470, v ds
+# define BFI_FLINEAR0_2471_TICK(t)
+# define BFI_FLINEAR0_2470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2469, v ds
+# define BFI_FLINEAR0_2470_TICK(t)
+# define BFI_FLINEAR0_2469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2468, v ds
+# define BFI_FLINEAR0_2469_TICK(t)
+# define BFI_FLINEAR0_2468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2467, v ds
+# define BFI_FLINEAR0_2468_TICK(t)
+# define BFI_FLINEAR0_2467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2466, v ds
+# define BFI_FLINEAR0_2467_TICK(t)
+# define BFI_FLINEAR0_2466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2465, v ds
+# define BFI_FLINEAR0_2466_TICK(t)
+# define BFI_FLINEAR0_2465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2464, v ds
+# define BFI_FLINEAR0_2465_TICK(t)
+# define BFI_FLINEAR0_2464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2463, v ds
+# define BFI_FLINEAR0_2464_TICK(t)
+# define BFI_FLINEAR0_2463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2462, v ds
+# define BFI_FLINEAR0_2463_TICK(t)
+# define BFI_FLINEAR0_2462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2461, v ds
+# define BFI_FLINEAR0_2462_TICK(t)
+# define BFI_FLINEAR0_2461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2460, v ds
+# define BFI_FLINEAR0_2461_TICK(t)
+# define BFI_FLINEAR0_2460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2459, v ds
+# define BFI_FLINEAR0_2460_TICK(t)
+# define BFI_FLINEAR0_2459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2458, v ds
+# define BFI_FLINEAR0_2459_TICK(t)
+# define BFI_FLINEAR0_2458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2457, v ds
+# define BFI_FLINEAR0_2458_TICK(t)
+# define BFI_FLINEAR0_2457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2456, v ds
+# define BFI_FLINEAR0_2457_TICK(t)
+# define BFI_FLINEAR0_2456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2455, v ds
+# define BFI_FLINEAR0_2456_TICK(t)
+# define BFI_FLINEAR0_2455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2454, v ds
+# define BFI_FLINEAR0_2455_TICK(t)
+# define BFI_FLINEAR0_2454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2453, v ds
+# define BFI_FLINEAR0_2454_TICK(t)
+# define BFI_FLINEAR0_2453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2452, v ds
+# define BFI_FLINEAR0_2453_TICK(t)
+# define BFI_FLINEAR0_2452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2451, v ds
+# define BFI_FLINEAR0_2452_TICK(t)
+# define BFI_FLINEAR0_2451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2450, v ds
+# define BFI_FLINEAR0_2451_TICK(t)
+# define BFI_FLINEAR0_2450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2449, v ds
+# define BFI_FLINEAR0_2450_TICK(t)
+# define BFI_FLINEAR0_2449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2448, v ds
+# define BFI_FLINEAR0_2449_TICK(t)
+# define BFI_FLINEAR0_2448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2447, v ds
+# define BFI_FLINEAR0_2448_TICK(t)
+# define BFI_FLINEAR0_2447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2446, v ds
+# define BFI_FLINEAR0_2447_TICK(t)
+# define BFI_FLINEAR0_2446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2445, v ds
+# define BFI_FLINEAR0_2446_TICK(t)
+# define BFI_FLINEAR0_2445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2444, v ds
+# define BFI_FLINEAR0_2445_TICK(t)
+# define BFI_FLINEAR0_2444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2443, v ds
+# define BFI_FLINEAR0_2444_TICK(t)
+# define BFI_FLINEAR0_2443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2442, v ds
+# define BFI_FLINEAR0_2443_TICK(t)
+# define BFI_FLINEAR0_2442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2441, v ds
+# define BFI_FLINEAR0_2442_TICK(t)
+# define BFI_FLINEAR0_2441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2440, v ds
+# define BFI_FLINEAR0_2441_TICK(t)
+# define BFI_FLINEAR0_2440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2439, v ds
+# define BFI_FLINEAR0_2440_TICK(t)
+# define BFI_FLINEAR0_2439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2438, v ds
+# define BFI_FLINEAR0_2439_TICK(t)
+# define BFI_FLINEAR0_2438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2437, v ds
+# define BFI_FLINEAR0_2438_TICK(t)
+# define BFI_FLINEAR0_2437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2436, v ds
+# define BFI_FLINEAR0_2437_TICK(t)
+# define BFI_FLINEAR0_2436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2435, v ds
+# define BFI_FLINEAR0_2436_TICK(t)
+# define BFI_FLINEAR0_2435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2434, v ds
+# define BFI_FLINEAR0_2435_TICK(t)
+# define BFI_FLINEAR0_2434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2433, v ds
+# define BFI_FLINEAR0_2434_TICK(t)
+# define BFI_FLINEAR0_2433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2432, v ds
+# define BFI_FLINEAR0_2433_TICK(t)
+# define BFI_FLINEAR0_2432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2431, v ds
+# define BFI_FLINEAR0_2432_TICK(t)
+# define BFI_FLINEAR0_2431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2430, v ds
+# define BFI_FLINEAR0_2431_TICK(t)
+# define BFI_FLINEAR0_2430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2429, v ds
+# define BFI_FLINEAR0_2430_TICK(t)
+# define BFI_FLINEAR0_2429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2428, v ds
+# define BFI_FLINEAR0_2429_TICK(t)
+# define BFI_FLINEAR0_2428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2427, v ds
+# define BFI_FLINEAR0_2428_TICK(t)
+# define BFI_FLINEAR0_2427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2426, v ds
+# define BFI_FLINEAR0_2427_TICK(t)
+# define BFI_FLINEAR0_2426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2425, v ds
+# define BFI_FLINEAR0_2426_TICK(t)
+# define BFI_FLINEAR0_2425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2424, v ds
+# define BFI_FLINEAR0_2425_TICK(t)
+# define BFI_FLINEAR0_2424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2423, v ds
+# define BFI_FLINEAR0_2424_TICK(t)
+# define BFI_FLINEAR0_2423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2422, v ds
+# define BFI_FLINEAR0_2423_TICK(t)
+# define BFI_FLINEAR0_2422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2421, v ds
+# define BFI_FLINEAR0_2422_TICK(t)
+# define BFI_FLINEAR0_2421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2420, v ds
+# define BFI_FLINEAR0_2421_TICK(t)
+# define BFI_FLINEAR0_2420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2419, v ds
+# define BFI_FLINEAR0_2420_TICK(t)
+# define BFI_FLINEAR0_2419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2418, v ds
+# define BFI_FLINEAR0_2419_TICK(t)
+# define BFI_FLINEAR0_2418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2417, v ds
+# define BFI_FLINEAR0_2418_TICK(t)
+# define BFI_FLINEAR0_2417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2416, v ds
+# define BFI_FLINEAR0_2417_TICK(t)
+# define BFI_FLINEAR0_2416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2415, v ds
+# define BFI_FLINEAR0_2416_TICK(t)
+# define BFI_FLINEAR0_2415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2414, v ds
+# define BFI_FLINEAR0_2415_TICK(t)
+# define BFI_FLINEAR0_2414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2413, v ds
+# define BFI_FLINEAR0_2414_TICK(t)
+# define BFI_FLINEAR0_2413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2412, v ds
+# define BFI_FLINEAR0_2413_TICK(t)
+# define BFI_FLINEAR0_2412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2411, v ds
+# define BFI_FLINEAR0_2412_TICK(t)
+# define BFI_FLINEAR0_2411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2410, v ds
+# define BFI_FLINEAR0_2411_TICK(t)
+# define BFI_FLINEAR0_2410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2409, v ds
+# define BFI_FLINEAR0_2410_TICK(t)
+# define BFI_FLINEAR0_2409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2408, v ds
+# define BFI_FLINEAR0_2409_TICK(t)
+# define BFI_FLINEAR0_2408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2407, v ds
+# define BFI_FLINEAR0_2408_TICK(t)
+# define BFI_FLINEAR0_2407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2406, v ds
+# define BFI_FLINEAR0_2407_TICK(t)
+# define BFI_FLINEAR0_2406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2405, v ds
+# define BFI_FLINEAR0_2406_TICK(t)
+# define BFI_FLINEAR0_2405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2404, v ds
+# define BFI_FLINEAR0_2405_TICK(t)
+# define BFI_FLINEAR0_2404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2403, v ds
+# define BFI_FLINEAR0_2404_TICK(t)
+# define BFI_FLINEAR0_2403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2402, v ds
+# define BFI_FLINEAR0_2403_TICK(t)
+# define BFI_FLINEAR0_2402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2401, v ds
+# define BFI_FLINEAR0_2402_TICK(t)
+# define BFI_FLINEAR0_2401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2400, v ds
+# define BFI_FLINEAR0_2401_TICK(t)
+# define BFI_FLINEAR0_2400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2399, v ds
+# define BFI_FLINEAR0_2400_TICK(t)
+# define BFI_FLINEAR0_2399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2398, v ds
+# define BFI_FLINEAR0_2399_TICK(t)
+# define BFI_FLINEAR0_2398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2397, v ds
+# define BFI_FLINEAR0_2398_TICK(t)
+# define BFI_FLINEAR0_2397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2396, v ds
+# define BFI_FLINEAR0_2397_TICK(t)
+# define BFI_FLINEAR0_2396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2395, v ds
+# define BFI_FLINEAR0_2396_TICK(t)
+# define BFI_FLINEAR0_2395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2394, v ds
+# define BFI_FLINEAR0_2395_TICK(t)
+# define BFI_FLINEAR0_2394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2393, v ds
+# define BFI_FLINEAR0_2394_TICK(t)
+# define BFI_FLINEAR0_2393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2392, v ds
+# define BFI_FLINEAR0_2393_TICK(t)
+# define BFI_FLINEAR0_2392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2391, v ds
+# define BFI_FLINEAR0_2392_TICK(t)
+# define BFI_FLINEAR0_2391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2390, v ds
+# define BFI_FLINEAR0_2391_TICK(t)
+# define BFI_FLINEAR0_2390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2389, v ds
+# define BFI_FLINEAR0_2390_TICK(t)
+# define BFI_FLINEAR0_2389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2388, v ds
+# define BFI_FLINEAR0_2389_TICK(t)
+# define BFI_FLINEAR0_2388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2387, v ds
+# define BFI_FLINEAR0_2388_TICK(t)
+# define BFI_FLINEAR0_2387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2386, v ds
+# define BFI_FLINEAR0_2387_TICK(t)
+# define BFI_FLINEAR0_2386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2385, v ds
+# define BFI_FLINEAR0_2386_TICK(t)
+# define BFI_FLINEAR0_2385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2384, v ds
+# define BFI_FLINEAR0_2385_TICK(t)
+# define BFI_FLINEAR0_2384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2383, v ds
+# define BFI_FLINEAR0_2384_TICK(t)
+# define BFI_FLINEAR0_2383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2382, v ds
+# define BFI_FLINEAR0_2383_TICK(t)
+# define BFI_FLINEAR0_2382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2381, v ds
+# define BFI_FLINEAR0_2382_TICK(t)
+# define BFI_FLINEAR0_2381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2380, v ds
+# define BFI_FLINEAR0_2381_TICK(t)
+# define BFI_FLINEAR0_2380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2379, v ds
+# define BFI_FLINEAR0_2380_TICK(t)
+# define BFI_FLINEAR0_2379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2378, v ds
+# define BFI_FLINEAR0_2379_TICK(t)
+# define BFI_FLINEAR0_2378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2377, v ds
+# define BFI_FLINEAR0_2378_TICK(t)
+# define BFI_FLINEAR0_2377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2376, v ds
+# define BFI_FLINEAR0_2377_TICK(t)
+# define BFI_FLINEAR0_2376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2375, v ds
+# define BFI_FLINEAR0_2376_TICK(t)
+# define BFI_FLINEAR0_2375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2374, v ds
+# define BFI_FLINEAR0_2375_TICK(t)
+# define BFI_FLINEAR0_2374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2373, v ds
+# define BFI_FLINEAR0_2374_TICK(t)
+# define BFI_FLINEAR0_2373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2372, v ds
+# define BFI_FLINEAR0_2373_TICK(t)
+# define BFI_FLINEAR0_2372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2371, v ds
+# define BFI_FLINEAR0_2372_TICK(t)
+# define BFI_FLINEAR0_2371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2370, v ds
+# define BFI_FLINEAR0_2371_TICK(t)
+# define BFI_FLINEAR0_2370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2369, v ds
+# define BFI_FLINEAR0_2370_TICK(t)
+# define BFI_FLINEAR0_2369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2368, v ds
+# define BFI_FLINEAR0_2369_TICK(t)
+# define BFI_FLINEAR0_2368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2367, v ds
+# define BFI_FLINEAR0_2368_TICK(t)
+# define BFI_FLINEAR0_2367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2366, v ds
+# define BFI_FLINEAR0_2367_TICK(t)
+# define BFI_FLINEAR0_2366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2365, v ds
+# define BFI_FLINEAR0_2366_TICK(t)
+# define BFI_FLINEAR0_2365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2364, v ds
+# define BFI_FLINEAR0_2365_TICK(t)
+# define BFI_FLINEAR0_2364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2363, v ds
+# define BFI_FLINEAR0_2364_TICK(t)
+# define BFI_FLINEAR0_2363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2362, v ds
+# define BFI_FLINEAR0_2363_TICK(t)
+# define BFI_FLINEAR0_2362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2361, v ds
+# define BFI_FLINEAR0_2362_TICK(t)
+# define BFI_FLINEAR0_2361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2360, v ds
+# define BFI_FLINEAR0_2361_TICK(t)
+# define BFI_FLINEAR0_2360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2359, v ds
+# define BFI_FLINEAR0_2360_TICK(t)
+# define BFI_FLINEAR0_2359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2358, v ds
+# define BFI_FLINEAR0_2359_TICK(t)
+# define BFI_FLINEAR0_2358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2357, v ds
+# define BFI_FLINEAR0_2358_TICK(t)
+# define BFI_FLINEAR0_2357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2356, v ds
+# define BFI_FLINEAR0_2357_TICK(t)
+# define BFI_FLINEAR0_2356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2355, v ds
+# define BFI_FLINEAR0_2356_TICK(t)
+# define BFI_FLINEAR0_2355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2354, v ds
+# define BFI_FLINEAR0_2355_TICK(t)
+# define BFI_FLINEAR0_2354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2353, v ds
+# define BFI_FLINEAR0_2354_TICK(t)
+# define BFI_FLINEAR0_2353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2352, v ds
+# define BFI_FLINEAR0_2353_TICK(t)
+# define BFI_FLINEAR0_2352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2351, v ds
+# define BFI_FLINEAR0_2352_TICK(t)
+# define BFI_FLINEAR0_2351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2350, v ds
+# define BFI_FLINEAR0_2351_TICK(t)
+# define BFI_FLINEAR0_2350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2349, v ds
+# define BFI_FLINEAR0_2350_TICK(t)
+# define BFI_FLINEAR0_2349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2348, v ds
+# define BFI_FLINEAR0_2349_TICK(t)
+# define BFI_FLINEAR0_2348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2347, v ds
+# define BFI_FLINEAR0_2348_TICK(t)
+# define BFI_FLINEAR0_2347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2346, v ds
+# define BFI_FLINEAR0_2347_TICK(t)
+# define BFI_FLINEAR0_2346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2345, v ds
+# define BFI_FLINEAR0_2346_TICK(t)
+# define BFI_FLINEAR0_2345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2344, v ds
+# define BFI_FLINEAR0_2345_TICK(t)
+# define BFI_FLINEAR0_2344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2343, v ds
+# define BFI_FLINEAR0_2344_TICK(t)
+# define BFI_FLINEAR0_2343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2342, v ds
+# define BFI_FLINEAR0_2343_TICK(t)
+# define BFI_FLINEAR0_2342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2341, v ds
+# define BFI_FLINEAR0_2342_TICK(t)
+# define BFI_FLINEAR0_2341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2340, v ds
+# define BFI_FLINEAR0_2341_TICK(t)
+# define BFI_FLINEAR0_2340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2339, v ds
+# define BFI_FLINEAR0_2340_TICK(t)
+# define BFI_FLINEAR0_2339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2338, v ds
+# define BFI_FLINEAR0_2339_TICK(t)
+# define BFI_FLINEAR0_2338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2337, v ds
+# define BFI_FLINEAR0_2338_TICK(t)
+# define BFI_FLINEAR0_2337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2336, v ds
+# define BFI_FLINEAR0_2337_TICK(t)
+# define BFI_FLINEAR0_2336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2335, v ds
+# define BFI_FLINEAR0_2336_TICK(t)
+# define BFI_FLINEAR0_2335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2334, v ds
+# define BFI_FLINEAR0_2335_TICK(t)
+# define BFI_FLINEAR0_2334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2333, v ds
+# define BFI_FLINEAR0_2334_TICK(t)
+# define BFI_FLINEAR0_2333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2332, v ds
+# define BFI_FLINEAR0_2333_TICK(t)
+# define BFI_FLINEAR0_2332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2331, v ds
+# define BFI_FLINEAR0_2332_TICK(t)
+# define BFI_FLINEAR0_2331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2330, v ds
+# define BFI_FLINEAR0_2331_TICK(t)
+# define BFI_FLINEAR0_2330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2329, v ds
+# define BFI_FLINEAR0_2330_TICK(t)
+# define BFI_FLINEAR0_2329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2328, v ds
+# define BFI_FLINEAR0_2329_TICK(t)
+# define BFI_FLINEAR0_2328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2327, v ds
+# define BFI_FLINEAR0_2328_TICK(t)
+# define BFI_FLINEAR0_2327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2326, v ds
+# define BFI_FLINEAR0_2327_TICK(t)
+# define BFI_FLINEAR0_2326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2325, v ds
+# define BFI_FLINEAR0_2326_TICK(t)
+# define BFI_FLINEAR0_2325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2324, v ds
+# define BFI_FLINEAR0_2325_TICK(t)
+# define BFI_FLINEAR0_2324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2323, v ds
+# define BFI_FLINEAR0_2324_TICK(t)
+# define BFI_FLINEAR0_2323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2322, v ds
+# define BFI_FLINEAR0_2323_TICK(t)
+# define BFI_FLINEAR0_2322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2321, v ds
+# define BFI_FLINEAR0_2322_TICK(t)
+# define BFI_FLINEAR0_2321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2320, v ds
+# define BFI_FLINEAR0_2321_TICK(t)
+# define BFI_FLINEAR0_2320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2319, v ds
+# define BFI_FLINEAR0_2320_TICK(t)
+# define BFI_FLINEAR0_2319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2318, v ds
+# define BFI_FLINEAR0_2319_TICK(t)
+# define BFI_FLINEAR0_2318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2317, v ds
+# define BFI_FLINEAR0_2318_TICK(t)
+# define BFI_FLINEAR0_2317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2316, v ds
+# define BFI_FLINEAR0_2317_TICK(t)
+# define BFI_FLINEAR0_2316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2315, v ds
+# define BFI_FLINEAR0_2316_TICK(t)
+# define BFI_FLINEAR0_2315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2314, v ds
+# define BFI_FLINEAR0_2315_TICK(t)
+# define BFI_FLINEAR0_2314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2313, v ds
+# define BFI_FLINEAR0_2314_TICK(t)
+# define BFI_FLINEAR0_2313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2312, v ds
+# define BFI_FLINEAR0_2313_TICK(t)
+# define BFI_FLINEAR0_2312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2311, v ds
+# define BFI_FLINEAR0_2312_TICK(t)
+# define BFI_FLINEAR0_2311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2310, v ds
+# define BFI_FLINEAR0_2311_TICK(t)
+# define BFI_FLINEAR0_2310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2309, v ds
+# define BFI_FLINEAR0_2310_TICK(t)
+# define BFI_FLINEAR0_2309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2308, v ds
+# define BFI_FLINEAR0_2309_TICK(t)
+# define BFI_FLINEAR0_2308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2307, v ds
+# define BFI_FLINEAR0_2308_TICK(t)
+# define BFI_FLINEAR0_2307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2306, v ds
+# define BFI_FLINEAR0_2307_TICK(t)
+# define BFI_FLINEAR0_2306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2305, v ds
+# define BFI_FLINEAR0_2306_TICK(t)
+# define BFI_FLINEAR0_2305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2304, v ds
+# define BFI_FLINEAR0_2305_TICK(t)
+# define BFI_FLINEAR0_2304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2303, v ds
+# define BFI_FLINEAR0_2304_TICK(t)
+# define BFI_FLINEAR0_2303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2302, v ds
+# define BFI_FLINEAR0_2303_TICK(t)
+# define BFI_FLINEAR0_2302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2301, v ds
+# define BFI_FLINEAR0_2302_TICK(t)
+# define BFI_FLINEAR0_2301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2300, v ds
+# define BFI_FLINEAR0_2301_TICK(t)
+# define BFI_FLINEAR0_2300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2299, v ds
+# define BFI_FLINEAR0_2300_TICK(t)
+# define BFI_FLINEAR0_2299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2298, v ds
+# define BFI_FLINEAR0_2299_TICK(t)
+# define BFI_FLINEAR0_2298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2297, v ds
+# define BFI_FLINEAR0_2298_TICK(t)
+# define BFI_FLINEAR0_2297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2296, v ds
+# define BFI_FLINEAR0_2297_TICK(t)
+# define BFI_FLINEAR0_2296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2295, v ds
+# define BFI_FLINEAR0_2296_TICK(t)
+# define BFI_FLINEAR0_2295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2294, v ds
+# define BFI_FLINEAR0_2295_TICK(t)
+# define BFI_FLINEAR0_2294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2293, v ds
+# define BFI_FLINEAR0_2294_TICK(t)
+# define BFI_FLINEAR0_2293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2292, v ds
+# define BFI_FLINEAR0_2293_TICK(t)
+# define BFI_FLINEAR0_2292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2291, v ds
+# define BFI_FLINEAR0_2292_TICK(t)
+# define BFI_FLINEAR0_2291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2290, v ds
+# define BFI_FLINEAR0_2291_TICK(t)
+# define BFI_FLINEAR0_2290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2289, v ds
+# define BFI_FLINEAR0_2290_TICK(t)
+# define BFI_FLINEAR0_2289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2288, v ds
+# define BFI_FLINEAR0_2289_TICK(t)
+# define BFI_FLINEAR0_2288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2287, v ds
+# define BFI_FLINEAR0_2288_TICK(t)
+# define BFI_FLINEAR0_2287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2286, v ds
+# define BFI_FLINEAR0_2287_TICK(t)
+# define BFI_FLINEAR0_2286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2285, v ds
+# define BFI_FLINEAR0_2286_TICK(t)
+# define BFI_FLINEAR0_2285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2284, v ds
+# define BFI_FLINEAR0_2285_TICK(t)
+# define BFI_FLINEAR0_2284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2283, v ds
+# define BFI_FLINEAR0_2284_TICK(t)
+# define BFI_FLINEAR0_2283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2282, v ds
+# define BFI_FLINEAR0_2283_TICK(t)
+# define BFI_FLINEAR0_2282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2281, v ds
+# define BFI_FLINEAR0_2282_TICK(t)
+# define BFI_FLINEAR0_2281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2280, v ds
+# define BFI_FLINEAR0_2281_TICK(t)
+# define BFI_FLINEAR0_2280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2279, v ds
+# define BFI_FLINEAR0_2280_TICK(t)
+# define BFI_FLINEAR0_2279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2278, v ds
+# define BFI_FLINEAR0_2279_TICK(t)
+# define BFI_FLINEAR0_2278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2277, v ds
+# define BFI_FLINEAR0_2278_TICK(t)
+# define BFI_FLINEAR0_2277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2276, v ds
+# define BFI_FLINEAR0_2277_TICK(t)
+# define BFI_FLINEAR0_2276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2275, v ds
+# define BFI_FLINEAR0_2276_TICK(t)
+# define BFI_FLINEAR0_2275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2274, v ds
+# define BFI_FLINEAR0_2275_TICK(t)
+# define BFI_FLINEAR0_2274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2273, v ds
+# define BFI_FLINEAR0_2274_TICK(t)
+# define BFI_FLINEAR0_2273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2272, v ds
+# define BFI_FLINEAR0_2273_TICK(t)
+# define BFI_FLINEAR0_2272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2271, v ds
+# define BFI_FLINEAR0_2272_TICK(t)
+# define BFI_FLINEAR0_2271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2270, v ds
+# define BFI_FLINEAR0_2271_TICK(t)
+# define BFI_FLINEAR0_2270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2269, v ds
+# define BFI_FLINEAR0_2270_TICK(t)
+# define BFI_FLINEAR0_2269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2268, v ds
+# define BFI_FLINEAR0_2269_TICK(t)
+# define BFI_FLINEAR0_2268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2267, v ds
+# define BFI_FLINEAR0_2268_TICK(t)
+# define BFI_FLINEAR0_2267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2266, v ds
+# define BFI_FLINEAR0_2267_TICK(t)
+# define BFI_FLINEAR0_2266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2265, v ds
+# define BFI_FLINEAR0_2266_TICK(t)
+# define BFI_FLINEAR0_2265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2264, v ds
+# define BFI_FLINEAR0_2265_TICK(t)
+# define BFI_FLINEAR0_2264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2263, v ds
+# define BFI_FLINEAR0_2264_TICK(t)
+# define BFI_FLINEAR0_2263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2262, v ds
+# define BFI_FLINEAR0_2263_TICK(t)
+# define BFI_FLINEAR0_2262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2261, v ds
+# define BFI_FLINEAR0_2262_TICK(t)
+# define BFI_FLINEAR0_2261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2260, v ds
+# define BFI_FLINEAR0_2261_TICK(t)
+# define BFI_FLINEAR0_2260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2259, v ds
+# define BFI_FLINEAR0_2260_TICK(t)
+# define BFI_FLINEAR0_2259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2258, v ds
+# define BFI_FLINEAR0_2259_TICK(t)
+# define BFI_FLINEAR0_2258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2257, v ds
+# define BFI_FLINEAR0_2258_TICK(t)
+# define BFI_FLINEAR0_2257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2256, v ds
+# define BFI_FLINEAR0_2257_TICK(t)
+# define BFI_FLINEAR0_2256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2255, v ds
+# define BFI_FLINEAR0_2256_TICK(t)
+# define BFI_FLINEAR0_2255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2254, v ds
+# define BFI_FLINEAR0_2255_TICK(t)
+# define BFI_FLINEAR0_2254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2253, v ds
+# define BFI_FLINEAR0_2254_TICK(t)
+# define BFI_FLINEAR0_2253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2252, v ds
+# define BFI_FLINEAR0_2253_TICK(t)
+# define BFI_FLINEAR0_2252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2251, v ds
+# define BFI_FLINEAR0_2252_TICK(t)
+# define BFI_FLINEAR0_2251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2250, v ds
+# define BFI_FLINEAR0_2251_TICK(t)
+# define BFI_FLINEAR0_2250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2249, v ds
+# define BFI_FLINEAR0_2250_TICK(t)
+# define BFI_FLINEAR0_2249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2248, v ds
+# define BFI_FLINEAR0_2249_TICK(t)
+# define BFI_FLINEAR0_2248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2247, v ds
+# define BFI_FLINEAR0_2248_TICK(t)
+# define BFI_FLINEAR0_2247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2246, v ds
+# define BFI_FLINEAR0_2247_TICK(t)
+# define BFI_FLINEAR0_2246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2245, v ds
+# define BFI_FLINEAR0_2246_TICK(t)
+# define BFI_FLINEAR0_2245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2244, v ds
+# define BFI_FLINEAR0_2245_TICK(t)
+# define BFI_FLINEAR0_2244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2243, v ds
+# define BFI_FLINEAR0_2244_TICK(t)
+# define BFI_FLINEAR0_2243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2242, v ds
+# define BFI_FLINEAR0_2243_TICK(t)
+# define BFI_FLINEAR0_2242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2241, v ds
+# define BFI_FLINEAR0_2242_TICK(t)
+# define BFI_FLINEAR0_2241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2240, v ds
+# define BFI_FLINEAR0_2241_TICK(t)
+# define BFI_FLINEAR0_2240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2239, v ds
+# define BFI_FLINEAR0_2240_TICK(t)
+# define BFI_FLINEAR0_2239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2238, v ds
+# define BFI_FLINEAR0_2239_TICK(t)
+# define BFI_FLINEAR0_2238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2237, v ds
+# define BFI_FLINEAR0_2238_TICK(t)
+# define BFI_FLINEAR0_2237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2236, v ds
+# define BFI_FLINEAR0_2237_TICK(t)
+# define BFI_FLINEAR0_2236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2235, v ds
+# define BFI_FLINEAR0_2236_TICK(t)
+# define BFI_FLINEAR0_2235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2234, v ds
+# define BFI_FLINEAR0_2235_TICK(t)
+# define BFI_FLINEAR0_2234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2233, v ds
+# define BFI_FLINEAR0_2234_TICK(t)
+# define BFI_FLINEAR0_2233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2232, v ds
+# define BFI_FLINEAR0_2233_TICK(t)
+# define BFI_FLINEAR0_2232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2231, v ds
+# define BFI_FLINEAR0_2232_TICK(t)
+# define BFI_FLINEAR0_2231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2230, v ds
+# define BFI_FLINEAR0_2231_TICK(t)
+# define BFI_FLINEAR0_2230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2229, v ds
+# define BFI_FLINEAR0_2230_TICK(t)
+# define BFI_FLINEAR0_2229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2228, v ds
+# define BFI_FLINEAR0_2229_TICK(t)
+# define BFI_FLINEAR0_2228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2227, v ds
+# define BFI_FLINEAR0_2228_TICK(t)
+# define BFI_FLINEAR0_2227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2226, v ds
+# define BFI_FLINEAR0_2227_TICK(t)
+# define BFI_FLINEAR0_2226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2225, v ds
+# define BFI_FLINEAR0_2226_TICK(t)
+# define BFI_FLINEAR0_2225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2224, v ds
+# define BFI_FLINEAR0_2225_TICK(t)
+# define BFI_FLINEAR0_2224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2223, v ds
+# define BFI_FLINEAR0_2224_TICK(t)
+# define BFI_FLINEAR0_2223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2222, v ds
+# define BFI_FLINEAR0_2223_TICK(t)
+# define BFI_FLINEAR0_2222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2221, v ds
+# define BFI_FLINEAR0_2222_TICK(t)
+# define BFI_FLINEAR0_2221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2220, v ds
+# define BFI_FLINEAR0_2221_TICK(t)
+# define BFI_FLINEAR0_2220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2219, v ds
+# define BFI_FLINEAR0_2220_TICK(t)
+# define BFI_FLINEAR0_2219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2218, v ds
+# define BFI_FLINEAR0_2219_TICK(t)
+# define BFI_FLINEAR0_2218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2217, v ds
+# define BFI_FLINEAR0_2218_TICK(t)
+# define BFI_FLINEAR0_2217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2216, v ds
+# define BFI_FLINEAR0_2217_TICK(t)
+# define BFI_FLINEAR0_2216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2215, v ds
+# define BFI_FLINEAR0_2216_TICK(t)
+# define BFI_FLINEAR0_2215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2214, v ds
+# define BFI_FLINEAR0_2215_TICK(t)
+# define BFI_FLINEAR0_2214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2213, v ds
+# define BFI_FLINEAR0_2214_TICK(t)
+# define BFI_FLINEAR0_2213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2212, v ds
+# define BFI_FLINEAR0_2213_TICK(t)
+# define BFI_FLINEAR0_2212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2211, v ds
+# define BFI_FLINEAR0_2212_TICK(t)
+# define BFI_FLINEAR0_2211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2210, v ds
+# define BFI_FLINEAR0_2211_TICK(t)
+# define BFI_FLINEAR0_2210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2209, v ds
+# define BFI_FLINEAR0_2210_TICK(t)
+# define BFI_FLINEAR0_2209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2208, v ds
+# define BFI_FLINEAR0_2209_TICK(t)
+# define BFI_FLINEAR0_2208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2207, v ds
+# define BFI_FLINEAR0_2208_TICK(t)
+# define BFI_FLINEAR0_2207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2206, v ds
+# define BFI_FLINEAR0_2207_TICK(t)
+# define BFI_FLINEAR0_2206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2205, v ds
+# define BFI_FLINEAR0_2206_TICK(t)
+# define BFI_FLINEAR0_2205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2204, v ds
+# define BFI_FLINEAR0_2205_TICK(t)
+# define BFI_FLINEAR0_2204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2203, v ds
+# define BFI_FLINEAR0_2204_TICK(t)
+# define BFI_FLINEAR0_2203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2202, v ds
+# define BFI_FLINEAR0_2203_TICK(t)
+# define BFI_FLINEAR0_2202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2201, v ds
+# define BFI_FLINEAR0_2202_TICK(t)
+# define BFI_FLINEAR0_2201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2200, v ds
+# define BFI_FLINEAR0_2201_TICK(t)
+# define BFI_FLINEAR0_2200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2199, v ds
+# define BFI_FLINEAR0_2200_TICK(t)
+# define BFI_FLINEAR0_2199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2198, v ds
+# define BFI_FLINEAR0_2199_TICK(t)
+# define BFI_FLINEAR0_2198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2197, v ds
+# define BFI_FLINEAR0_2198_TICK(t)
+# define BFI_FLINEAR0_2197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2196, v ds
+# define BFI_FLINEAR0_2197_TICK(t)
+# define BFI_FLINEAR0_2196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2195, v ds
+# define BFI_FLINEAR0_2196_TICK(t)
+# define BFI_FLINEAR0_2195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2194, v ds
+# define BFI_FLINEAR0_2195_TICK(t)
+# define BFI_FLINEAR0_2194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2193, v ds
+# define BFI_FLINEAR0_2194_TICK(t)
+# define BFI_FLINEAR0_2193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2192, v ds
+# define BFI_FLINEAR0_2193_TICK(t)
+# define BFI_FLINEAR0_2192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2191, v ds
+# define BFI_FLINEAR0_2192_TICK(t)
+# define BFI_FLINEAR0_2191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2190, v ds
+# define BFI_FLINEAR0_2191_TICK(t)
+# define BFI_FLINEAR0_2190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2189, v ds
+# define BFI_FLINEAR0_2190_TICK(t)
+# define BFI_FLINEAR0_2189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2188, v ds
+# define BFI_FLINEAR0_2189_TICK(t)
+# define BFI_FLINEAR0_2188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2187, v ds
+# define BFI_FLINEAR0_2188_TICK(t)
+# define BFI_FLINEAR0_2187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2186, v ds
+# define BFI_FLINEAR0_2187_TICK(t)
+# define BFI_FLINEAR0_2186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2185, v ds
+# define BFI_FLINEAR0_2186_TICK(t)
+# define BFI_FLINEAR0_2185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2184, v ds
+# define BFI_FLINEAR0_2185_TICK(t)
+# define BFI_FLINEAR0_2184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2183, v ds
+# define BFI_FLINEAR0_2184_TICK(t)
+# define BFI_FLINEAR0_2183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2182, v ds
+# define BFI_FLINEAR0_2183_TICK(t)
+# define BFI_FLINEAR0_2182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2181, v ds
+# define BFI_FLINEAR0_2182_TICK(t)
+# define BFI_FLINEAR0_2181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2180, v ds
+# define BFI_FLINEAR0_2181_TICK(t)
+# define BFI_FLINEAR0_2180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2179, v ds
+# define BFI_FLINEAR0_2180_TICK(t)
+# define BFI_FLINEAR0_2179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2178, v ds
+# define BFI_FLINEAR0_2179_TICK(t)
+# define BFI_FLINEAR0_2178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2177, v ds
+# define BFI_FLINEAR0_2178_TICK(t)
+# define BFI_FLINEAR0_2177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2176, v ds
+# define BFI_FLINEAR0_2177_TICK(t)
+# define BFI_FLINEAR0_2176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2175, v ds
+# define BFI_FLINEAR0_2176_TICK(t)
+# define BFI_FLINEAR0_2175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2174, v ds
+# define BFI_FLINEAR0_2175_TICK(t)
+# define BFI_FLINEAR0_2174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2173, v ds
+# define BFI_FLINEAR0_2174_TICK(t)
+# define BFI_FLINEAR0_2173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2172, v ds
+# define BFI_FLINEAR0_2173_TICK(t)
+# define BFI_FLINEAR0_2172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2171, v ds
+# define BFI_FLINEAR0_2172_TICK(t)
+# define BFI_FLINEAR0_2171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2170, v ds
+# define BFI_FLINEAR0_2171_TICK(t)
+# define BFI_FLINEAR0_2170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2169, v ds
+# define BFI_FLINEAR0_2170_TICK(t)
+# define BFI_FLINEAR0_2169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2168, v ds
+# define BFI_FLINEAR0_2169_TICK(t)
+# define BFI_FLINEAR0_2168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2167, v ds
+# define BFI_FLINEAR0_2168_TICK(t)
+# define BFI_FLINEAR0_2167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2166, v ds
+# define BFI_FLINEAR0_2167_TICK(t)
+# define BFI_FLINEAR0_2166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2165, v ds
+# define BFI_FLINEAR0_2166_TICK(t)
+# define BFI_FLINEAR0_2165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2164, v ds
+# define BFI_FLINEAR0_2165_TICK(t)
+# define BFI_FLINEAR0_2164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2163, v ds
+# define BFI_FLINEAR0_2164_TICK(t)
+# define BFI_FLINEAR0_2163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2162, v ds
+# define BFI_FLINEAR0_2163_TICK(t)
+# define BFI_FLINEAR0_2162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2161, v ds
+# define BFI_FLINEAR0_2162_TICK(t)
+# define BFI_FLINEAR0_2161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2160, v ds
+# define BFI_FLINEAR0_2161_TICK(t)
+# define BFI_FLINEAR0_2160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2159, v ds
+# define BFI_FLINEAR0_2160_TICK(t)
+# define BFI_FLINEAR0_2159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2158, v ds
+# define BFI_FLINEAR0_2159_TICK(t)
+# define BFI_FLINEAR0_2158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2157, v ds
+# define BFI_FLINEAR0_2158_TICK(t)
+# define BFI_FLINEAR0_2157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2156, v ds
+# define BFI_FLINEAR0_2157_TICK(t)
+# define BFI_FLINEAR0_2156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2155, v ds
+# define BFI_FLINEAR0_2156_TICK(t)
+# define BFI_FLINEAR0_2155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2154, v ds
+# define BFI_FLINEAR0_2155_TICK(t)
+# define BFI_FLINEAR0_2154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2153, v ds
+# define BFI_FLINEAR0_2154_TICK(t)
+# define BFI_FLINEAR0_2153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2152, v ds
+# define BFI_FLINEAR0_2153_TICK(t)
+# define BFI_FLINEAR0_2152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2151, v ds
+# define BFI_FLINEAR0_2152_TICK(t)
+# define BFI_FLINEAR0_2151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2150, v ds
+# define BFI_FLINEAR0_2151_TICK(t)
+# define BFI_FLINEAR0_2150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2149, v ds
+# define BFI_FLINEAR0_2150_TICK(t)
+# define BFI_FLINEAR0_2149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2148, v ds
+# define BFI_FLINEAR0_2149_TICK(t)
+# define BFI_FLINEAR0_2148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2147, v ds
+# define BFI_FLINEAR0_2148_TICK(t)
+# define BFI_FLINEAR0_2147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2146, v ds
+# define BFI_FLINEAR0_2147_TICK(t)
+# define BFI_FLINEAR0_2146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2145, v ds
+# define BFI_FLINEAR0_2146_TICK(t)
+# define BFI_FLINEAR0_2145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2144, v ds
+# define BFI_FLINEAR0_2145_TICK(t)
+# define BFI_FLINEAR0_2144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2143, v ds
+# define BFI_FLINEAR0_2144_TICK(t)
+# define BFI_FLINEAR0_2143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2142, v ds
+# define BFI_FLINEAR0_2143_TICK(t)
+# define BFI_FLINEAR0_2142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2141, v ds
+# define BFI_FLINEAR0_2142_TICK(t)
+# define BFI_FLINEAR0_2141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2140, v ds
+# define BFI_FLINEAR0_2141_TICK(t)
+# define BFI_FLINEAR0_2140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2139, v ds
+# define BFI_FLINEAR0_2140_TICK(t)
+# define BFI_FLINEAR0_2139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2138, v ds
+# define BFI_FLINEAR0_2139_TICK(t)
+# define BFI_FLINEAR0_2138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2137, v ds
+# define BFI_FLINEAR0_2138_TICK(t)
+# define BFI_FLINEAR0_2137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2136, v ds
+# define BFI_FLINEAR0_2137_TICK(t)
+# define BFI_FLINEAR0_2136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2135, v ds
+# define BFI_FLINEAR0_2136_TICK(t)
+# define BFI_FLINEAR0_2135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2134, v ds
+# define BFI_FLINEAR0_2135_TICK(t)
+# define BFI_FLINEAR0_2134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2133, v ds
+# define BFI_FLINEAR0_2134_TICK(t)
+# define BFI_FLINEAR0_2133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2132, v ds
+# define BFI_FLINEAR0_2133_TICK(t)
+# define BFI_FLINEAR0_2132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2131, v ds
+# define BFI_FLINEAR0_2132_TICK(t)
+# define BFI_FLINEAR0_2131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2130, v ds
+# define BFI_FLINEAR0_2131_TICK(t)
+# define BFI_FLINEAR0_2130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2129, v ds
+# define BFI_FLINEAR0_2130_TICK(t)
+# define BFI_FLINEAR0_2129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2128, v ds
+# define BFI_FLINEAR0_2129_TICK(t)
+# define BFI_FLINEAR0_2128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2127, v ds
+# define BFI_FLINEAR0_2128_TICK(t)
+# define BFI_FLINEAR0_2127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2126, v ds
+# define BFI_FLINEAR0_2127_TICK(t)
+# define BFI_FLINEAR0_2126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2125, v ds
+# define BFI_FLINEAR0_2126_TICK(t)
+# define BFI_FLINEAR0_2125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2124, v ds
+# define BFI_FLINEAR0_2125_TICK(t)
+# define BFI_FLINEAR0_2124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2123, v ds
+# define BFI_FLINEAR0_2124_TICK(t)
+# define BFI_FLINEAR0_2123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2122, v ds
+# define BFI_FLINEAR0_2123_TICK(t)
+# define BFI_FLINEAR0_2122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2121, v ds
+# define BFI_FLINEAR0_2122_TICK(t)
+# define BFI_FLINEAR0_2121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2120, v ds
+# define BFI_FLINEAR0_2121_TICK(t)
+# define BFI_FLINEAR0_2120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2119, v ds
+# define BFI_FLINEAR0_2120_TICK(t)
+# define BFI_FLINEAR0_2119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2118, v ds
+# define BFI_FLINEAR0_2119_TICK(t)
+# define BFI_FLINEAR0_2118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2117, v ds
+# define BFI_FLINEAR0_2118_TICK(t)
+# define BFI_FLINEAR0_2117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2116, v ds
+# define BFI_FLINEAR0_2117_TICK(t)
+# define BFI_FLINEAR0_2116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2115, v ds
+# define BFI_FLINEAR0_2116_TICK(t)
+# define BFI_FLINEAR0_2115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2114, v ds
+# define BFI_FLINEAR0_2115_TICK(t)
+# define BFI_FLINEAR0_2114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2113, v ds
+# define BFI_FLINEAR0_2114_TICK(t)
+# define BFI_FLINEAR0_2113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2112, v ds
+# define BFI_FLINEAR0_2113_TICK(t)
+# define BFI_FLINEAR0_2112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2111, v ds
+# define BFI_FLINEAR0_2112_TICK(t)
+# define BFI_FLINEAR0_2111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2110, v ds
+# define BFI_FLINEAR0_2111_TICK(t)
+# define BFI_FLINEAR0_2110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2109, v ds
+# define BFI_FLINEAR0_2110_TICK(t)
+# define BFI_FLINEAR0_2109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2108, v ds
+# define BFI_FLINEAR0_2109_TICK(t)
+# define BFI_FLINEAR0_2108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2107, v ds
+# define BFI_FLINEAR0_2108_TICK(t)
+# define BFI_FLINEAR0_2107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2106, v ds
+# define BFI_FLINEAR0_2107_TICK(t)
+# define BFI_FLINEAR0_2106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2105, v ds
+# define BFI_FLINEAR0_2106_TICK(t)
+# define BFI_FLINEAR0_2105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2104, v ds
+# define BFI_FLINEAR0_2105_TICK(t)
+# define BFI_FLINEAR0_2104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2103, v ds
+# define BFI_FLINEAR0_2104_TICK(t)
+# define BFI_FLINEAR0_2103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2102, v ds
+# define BFI_FLINEAR0_2103_TICK(t)
+# define BFI_FLINEAR0_2102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2101, v ds
+# define BFI_FLINEAR0_2102_TICK(t)
+# define BFI_FLINEAR0_2101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2100, v ds
+# define BFI_FLINEAR0_2101_TICK(t)
+# define BFI_FLINEAR0_2100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2099, v ds
+# define BFI_FLINEAR0_2100_TICK(t)
+# define BFI_FLINEAR0_2099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2098, v ds
+# define BFI_FLINEAR0_2099_TICK(t)
+# define BFI_FLINEAR0_2098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2097, v ds
+# define BFI_FLINEAR0_2098_TICK(t)
+# define BFI_FLINEAR0_2097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2096, v ds
+# define BFI_FLINEAR0_2097_TICK(t)
+# define BFI_FLINEAR0_2096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2095, v ds
+# define BFI_FLINEAR0_2096_TICK(t)
+# define BFI_FLINEAR0_2095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2094, v ds
+# define BFI_FLINEAR0_2095_TICK(t)
+# define BFI_FLINEAR0_2094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2093, v ds
+# define BFI_FLINEAR0_2094_TICK(t)
+# define BFI_FLINEAR0_2093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2092, v ds
+# define BFI_FLINEAR0_2093_TICK(t)
+# define BFI_FLINEAR0_2092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2091, v ds
+# define BFI_FLINEAR0_2092_TICK(t)
+# define BFI_FLINEAR0_2091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2090, v ds
+# define BFI_FLINEAR0_2091_TICK(t)
+# define BFI_FLINEAR0_2090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2089, v ds
+# define BFI_FLINEAR0_2090_TICK(t)
+# define BFI_FLINEAR0_2089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2088, v ds
+# define BFI_FLINEAR0_2089_TICK(t)
+# define BFI_FLINEAR0_2088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2087, v ds
+# define BFI_FLINEAR0_2088_TICK(t)
+# define BFI_FLINEAR0_2087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2086, v ds
+# define BFI_FLINEAR0_2087_TICK(t)
+# define BFI_FLINEAR0_2086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2085, v ds
+# define BFI_FLINEAR0_2086_TICK(t)
+# define BFI_FLINEAR0_2085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2084, v ds
+# define BFI_FLINEAR0_2085_TICK(t)
+# define BFI_FLINEAR0_2084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2083, v ds
+# define BFI_FLINEAR0_2084_TICK(t)
+# define BFI_FLINEAR0_2083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2082, v ds
+# define BFI_FLINEAR0_2083_TICK(t)
+# define BFI_FLINEAR0_2082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2081, v ds
+# define BFI_FLINEAR0_2082_TICK(t)
+# define BFI_FLINEAR0_2081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2080, v ds
+# define BFI_FLINEAR0_2081_TICK(t)
+# define BFI_FLINEAR0_2080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2079, v ds
+# define BFI_FLINEAR0_2080_TICK(t)
+# define BFI_FLINEAR0_2079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2078, v ds
+# define BFI_FLINEAR0_2079_TICK(t)
+# define BFI_FLINEAR0_2078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2077, v ds
+# define BFI_FLINEAR0_2078_TICK(t)
+# define BFI_FLINEAR0_2077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2076, v ds
+# define BFI_FLINEAR0_2077_TICK(t)
+# define BFI_FLINEAR0_2076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2075, v ds
+# define BFI_FLINEAR0_2076_TICK(t)
+# define BFI_FLINEAR0_2075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2074, v ds
+# define BFI_FLINEAR0_2075_TICK(t)
+# define BFI_FLINEAR0_2074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2073, v ds
+# define BFI_FLINEAR0_2074_TICK(t)
+# define BFI_FLINEAR0_2073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2072, v ds
+# define BFI_FLINEAR0_2073_TICK(t)
+# define BFI_FLINEAR0_2072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2071, v ds
+# define BFI_FLINEAR0_2072_TICK(t)
+# define BFI_FLINEAR0_2071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2070, v ds
+# define BFI_FLINEAR0_2071_TICK(t)
+# define BFI_FLINEAR0_2070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2069, v ds
+# define BFI_FLINEAR0_2070_TICK(t)
+# define BFI_FLINEAR0_2069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2068, v ds
+# define BFI_FLINEAR0_2069_TICK(t)
+# define BFI_FLINEAR0_2068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2067, v ds
+# define BFI_FLINEAR0_2068_TICK(t)
+# define BFI_FLINEAR0_2067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2066, v ds
+# define BFI_FLINEAR0_2067_TICK(t)
+# define BFI_FLINEAR0_2066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2065, v ds
+# define BFI_FLINEAR0_2066_TICK(t)
+# define BFI_FLINEAR0_2065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2064, v ds
+# define BFI_FLINEAR0_2065_TICK(t)
+# define BFI_FLINEAR0_2064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2063, v ds
+# define BFI_FLINEAR0_2064_TICK(t)
+# define BFI_FLINEAR0_2063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2062, v ds
+# define BFI_FLINEAR0_2063_TICK(t)
+# define BFI_FLINEAR0_2062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2061, v ds
+# define BFI_FLINEAR0_2062_TICK(t)
+# define BFI_FLINEAR0_2061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2060, v ds
+# define BFI_FLINEAR0_2061_TICK(t)
+# define BFI_FLINEAR0_2060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2059, v ds
+# define BFI_FLINEAR0_2060_TICK(t)
+# define BFI_FLINEAR0_2059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2058, v ds
+# define BFI_FLINEAR0_2059_TICK(t)
+# define BFI_FLINEAR0_2058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2057, v ds
+# define BFI_FLINEAR0_2058_TICK(t)
+# define BFI_FLINEAR0_2057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2056, v ds
+# define BFI_FLINEAR0_2057_TICK(t)
+# define BFI_FLINEAR0_2056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2055, v ds
+# define BFI_FLINEAR0_2056_TICK(t)
+# define BFI_FLINEAR0_2055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2054, v ds
+# define BFI_FLINEAR0_2055_TICK(t)
+# define BFI_FLINEAR0_2054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2053, v ds
+# define BFI_FLINEAR0_2054_TICK(t)
+# define BFI_FLINEAR0_2053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2052, v ds
+# define BFI_FLINEAR0_2053_TICK(t)
+# define BFI_FLINEAR0_2052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2051, v ds
+# define BFI_FLINEAR0_2052_TICK(t)
+# define BFI_FLINEAR0_2051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2050, v ds
+# define BFI_FLINEAR0_2051_TICK(t)
+# define BFI_FLINEAR0_2050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2049, v ds
+# define BFI_FLINEAR0_2050_TICK(t)
+# define BFI_FLINEAR0_2049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2048, v ds
+# define BFI_FLINEAR0_2049_TICK(t)
+# define BFI_FLINEAR0_2048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2047, v ds
+# define BFI_FLINEAR0_2048_TICK(t)
+# define BFI_FLINEAR0_2047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2046, v ds
+# define BFI_FLINEAR0_2047_TICK(t)
+# define BFI_FLINEAR0_2046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2045, v ds
+# define BFI_FLINEAR0_2046_TICK(t)
+# define BFI_FLINEAR0_2045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2044, v ds
+# define BFI_FLINEAR0_2045_TICK(t)
+# define BFI_FLINEAR0_2044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2043, v ds
+# define BFI_FLINEAR0_2044_TICK(t)
+# define BFI_FLINEAR0_2043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2042, v ds
+# define BFI_FLINEAR0_2043_TICK(t)
+# define BFI_FLINEAR0_2042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2041, v ds
+# define BFI_FLINEAR0_2042_TICK(t)
+# define BFI_FLINEAR0_2041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2040, v ds
+# define BFI_FLINEAR0_2041_TICK(t)
+# define BFI_FLINEAR0_2040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2039, v ds
+# define BFI_FLINEAR0_2040_TICK(t)
+# define BFI_FLINEAR0_2039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2038, v ds
+# define BFI_FLINEAR0_2039_TICK(t)
+# define BFI_FLINEAR0_2038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2037, v ds
+# define BFI_FLINEAR0_2038_TICK(t)
+# define BFI_FLINEAR0_2037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2036, v ds
+# define BFI_FLINEAR0_2037_TICK(t)
+# define BFI_FLINEAR0_2036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2035, v ds
+# define BFI_FLINEAR0_2036_TICK(t)
+# define BFI_FLINEAR0_2035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2034, v ds
+# define BFI_FLINEAR0_2035_TICK(t)
+# define BFI_FLINEAR0_2034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2033, v ds
+# define BFI_FLINEAR0_2034_TICK(t)
+# define BFI_FLINEAR0_2033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2032, v ds
+# define BFI_FLINEAR0_2033_TICK(t)
+# define BFI_FLINEAR0_2032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2031, v ds
+# define BFI_FLINEAR0_2032_TICK(t)
+# define BFI_FLINEAR0_2031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2030, v ds
+# define BFI_FLINEAR0_2031_TICK(t)
+# define BFI_FLINEAR0_2030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2029, v ds
+# define BFI_FLINEAR0_2030_TICK(t)
+# define BFI_FLINEAR0_2029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2028, v ds
+# define BFI_FLINEAR0_2029_TICK(t)
+# define BFI_FLINEAR0_2028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2027, v ds
+# define BFI_FLINEAR0_2028_TICK(t)
+# define BFI_FLINEAR0_2027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2026, v ds
+# define BFI_FLINEAR0_2027_TICK(t)
+# define BFI_FLINEAR0_2026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2025, v ds
+# define BFI_FLINEAR0_2026_TICK(t)
+# define BFI_FLINEAR0_2025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2024, v ds
+# define BFI_FLINEAR0_2025_TICK(t)
+# define BFI_FLINEAR0_2024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2023, v ds
+# define BFI_FLINEAR0_2024_TICK(t)
+# define BFI_FLINEAR0_2023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2022, v ds
+# define BFI_FLINEAR0_2023_TICK(t)
+# define BFI_FLINEAR0_2022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2021, v ds
+# define BFI_FLINEAR0_2022_TICK(t)
+# define BFI_FLINEAR0_2021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2020, v ds
+# define BFI_FLINEAR0_2021_TICK(t)
+# define BFI_FLINEAR0_2020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2019, v ds
+# define BFI_FLINEAR0_2020_TICK(t)
+# define BFI_FLINEAR0_2019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2018, v ds
+# define BFI_FLINEAR0_2019_TICK(t)
+# define BFI_FLINEAR0_2018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2017, v ds
+# define BFI_FLINEAR0_2018_TICK(t)
+# define BFI_FLINEAR0_2017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2016, v ds
+# define BFI_FLINEAR0_2017_TICK(t)
+# define BFI_FLINEAR0_2016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2015, v ds
+# define BFI_FLINEAR0_2016_TICK(t)
+# define BFI_FLINEAR0_2015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2014, v ds
+# define BFI_FLINEAR0_2015_TICK(t)
+# define BFI_FLINEAR0_2014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2013, v ds
+# define BFI_FLINEAR0_2014_TICK(t)
+# define BFI_FLINEAR0_2013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2012, v ds
+# define BFI_FLINEAR0_2013_TICK(t)
+# define BFI_FLINEAR0_2012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2011, v ds
+# define BFI_FLINEAR0_2012_TICK(t)
+# define BFI_FLINEAR0_2011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2010, v ds
+# define BFI_FLINEAR0_2011_TICK(t)
+# define BFI_FLINEAR0_2010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2009, v ds
+# define BFI_FLINEAR0_2010_TICK(t)
+# define BFI_FLINEAR0_2009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2008, v ds
+# define BFI_FLINEAR0_2009_TICK(t)
+# define BFI_FLINEAR0_2008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2007, v ds
+# define BFI_FLINEAR0_2008_TICK(t)
+# define BFI_FLINEAR0_2007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2006, v ds
+# define BFI_FLINEAR0_2007_TICK(t)
+# define BFI_FLINEAR0_2006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2005, v ds
+# define BFI_FLINEAR0_2006_TICK(t)
+# define BFI_FLINEAR0_2005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2004, v ds
+# define BFI_FLINEAR0_2005_TICK(t)
+# define BFI_FLINEAR0_2004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2003, v ds
+# define BFI_FLINEAR0_2004_TICK(t)
+# define BFI_FLINEAR0_2003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2002, v ds
+# define BFI_FLINEAR0_2003_TICK(t)
+# define BFI_FLINEAR0_2002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2001, v ds
+# define BFI_FLINEAR0_2002_TICK(t)
+# define BFI_FLINEAR0_2001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2000, v ds
+# define BFI_FLINEAR0_2001_TICK(t)
+# define BFI_FLINEAR0_2000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1999, v ds
+# define BFI_FLINEAR0_2000_TICK(t)
+# define BFI_FLINEAR0_1999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1998, v ds
+# define BFI_FLINEAR0_1999_TICK(t)
+# define BFI_FLINEAR0_1998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1997, v ds
+# define BFI_FLINEAR0_1998_TICK(t)
+# define BFI_FLINEAR0_1997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1996, v ds
+# define BFI_FLINEAR0_1997_TICK(t)
+# define BFI_FLINEAR0_1996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1995, v ds
+# define BFI_FLINEAR0_1996_TICK(t)
+# define BFI_FLINEAR0_1995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1994, v ds
+# define BFI_FLINEAR0_1995_TICK(t)
+# define BFI_FLINEAR0_1994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1993, v ds
+# define BFI_FLINEAR0_1994_TICK(t)
+# define BFI_FLINEAR0_1993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1992, v ds
+# define BFI_FLINEAR0_1993_TICK(t)
+# define BFI_FLINEAR0_1992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1991, v ds
+# define BFI_FLINEAR0_1992_TICK(t)
+# define BFI_FLINEAR0_1991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1990, v ds
+# define BFI_FLINEAR0_1991_TICK(t)
+# define BFI_FLINEAR0_1990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1989, v ds
+# define BFI_FLINEAR0_1990_TICK(t)
+# define BFI_FLINEAR0_1989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1988, v ds
+# define BFI_FLINEAR0_1989_TICK(t)
+# define BFI_FLINEAR0_1988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1987, v ds
+# define BFI_FLINEAR0_1988_TICK(t)
+# define BFI_FLINEAR0_1987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1986, v ds
+# define BFI_FLINEAR0_1987_TICK(t)
+# define BFI_FLINEAR0_1986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1985, v ds
+# define BFI_FLINEAR0_1986_TICK(t)
+# define BFI_FLINEAR0_1985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1984, v ds
+# define BFI_FLINEAR0_1985_TICK(t)
+# define BFI_FLINEAR0_1984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1983, v ds
+# define BFI_FLINEAR0_1984_TICK(t)
+# define BFI_FLINEAR0_1983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1982, v ds
+# define BFI_FLINEAR0_1983_TICK(t)
+# define BFI_FLINEAR0_1982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1981, v ds
+# define BFI_FLINEAR0_1982_TICK(t)
+# define BFI_FLINEAR0_1981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1980, v ds
+# define BFI_FLINEAR0_1981_TICK(t)
+# define BFI_FLINEAR0_1980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1979, v ds
+# define BFI_FLINEAR0_1980_TICK(t)
+# define BFI_FLINEAR0_1979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1978, v ds
+# define BFI_FLINEAR0_1979_TICK(t)
+# define BFI_FLINEAR0_1978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1977, v ds
+# define BFI_FLINEAR0_1978_TICK(t)
+# define BFI_FLINEAR0_1977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1976, v ds
+# define BFI_FLINEAR0_1977_TICK(t)
+# define BFI_FLINEAR0_1976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1975, v ds
+# define BFI_FLINEAR0_1976_TICK(t)
+# define BFI_FLINEAR0_1975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1974, v ds
+# define BFI_FLINEAR0_1975_TICK(t)
+# define BFI_FLINEAR0_1974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1973, v ds
+# define BFI_FLINEAR0_1974_TICK(t)
+# define BFI_FLINEAR0_1973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1972, v ds
+# define BFI_FLINEAR0_1973_TICK(t)
+# define BFI_FLINEAR0_1972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1971, v ds
+# define BFI_FLINEAR0_1972_TICK(t)
+# define BFI_FLINEAR0_1971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1970, v ds
+# define BFI_FLINEAR0_1971_TICK(t)
+# define BFI_FLINEAR0_1970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1969, v ds
+# define BFI_FLINEAR0_1970_TICK(t)
+# define BFI_FLINEAR0_1969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1968, v ds
+# define BFI_FLINEAR0_1969_TICK(t)
+# define BFI_FLINEAR0_1968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1967, v ds
+# define BFI_FLINEAR0_1968_TICK(t)
+# define BFI_FLINEAR0_1967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1966, v ds
+# define BFI_FLINEAR0_1967_TICK(t)
+# define BFI_FLINEAR0_1966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1965, v ds
+# define BFI_FLINEAR0_1966_TICK(t)
+# define BFI_FLINEAR0_1965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1964, v ds
+# define BFI_FLINEAR0_1965_TICK(t)
+# define BFI_FLINEAR0_1964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1963, v ds
+# define BFI_FLINEAR0_1964_TICK(t)
+# define BFI_FLINEAR0_1963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1962, v ds
+# define BFI_FLINEAR0_1963_TICK(t)
+# define BFI_FLINEAR0_1962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1961, v ds
+# define BFI_FLINEAR0_1962_TICK(t)
+# define BFI_FLINEAR0_1961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1960, v ds
+# define BFI_FLINEAR0_1961_TICK(t)
+# define BFI_FLINEAR0_1960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1959, v ds
+# define BFI_FLINEAR0_1960_TICK(t)
+# define BFI_FLINEAR0_1959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1958, v ds
+# define BFI_FLINEAR0_1959_TICK(t)
+# define BFI_FLINEAR0_1958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1957, v ds
+# define BFI_FLINEAR0_1958_TICK(t)
+# define BFI_FLINEAR0_1957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1956, v ds
+# define BFI_FLINEAR0_1957_TICK(t)
+# define BFI_FLINEAR0_1956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1955, v ds
+# define BFI_FLINEAR0_1956_TICK(t)
+# define BFI_FLINEAR0_1955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1954, v ds
+# define BFI_FLINEAR0_1955_TICK(t)
+# define BFI_FLINEAR0_1954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1953, v ds
+# define BFI_FLINEAR0_1954_TICK(t)
+# define BFI_FLINEAR0_1953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1952, v ds
+# define BFI_FLINEAR0_1953_TICK(t)
+# define BFI_FLINEAR0_1952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1951, v ds
+# define BFI_FLINEAR0_1952_TICK(t)
+# define BFI_FLINEAR0_1951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1950, v ds
+# define BFI_FLINEAR0_1951_TICK(t)
+# define BFI_FLINEAR0_1950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1949, v ds
+# define BFI_FLINEAR0_1950_TICK(t)
+# define BFI_FLINEAR0_1949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1948, v ds
+# define BFI_FLINEAR0_1949_TICK(t)
+# define BFI_FLINEAR0_1948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1947, v ds
+# define BFI_FLINEAR0_1948_TICK(t)
+# define BFI_FLINEAR0_1947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1946, v ds
+# define BFI_FLINEAR0_1947_TICK(t)
+# define BFI_FLINEAR0_1946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1945, v ds
+# define BFI_FLINEAR0_1946_TICK(t)
+# define BFI_FLINEAR0_1945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1944, v ds
+# define BFI_FLINEAR0_1945_TICK(t)
+# define BFI_FLINEAR0_1944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1943, v ds
+# define BFI_FLINEAR0_1944_TICK(t)
+# define BFI_FLINEAR0_1943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1942, v ds
+# define BFI_FLINEAR0_1943_TICK(t)
+# define BFI_FLINEAR0_1942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1941, v ds
+# define BFI_FLINEAR0_1942_TICK(t)
+# define BFI_FLINEAR0_1941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1940, v ds
+# define BFI_FLINEAR0_1941_TICK(t)
+# define BFI_FLINEAR0_1940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1939, v ds
+# define BFI_FLINEAR0_1940_TICK(t)
+# define BFI_FLINEAR0_1939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1938, v ds
+# define BFI_FLINEAR0_1939_TICK(t)
+# define BFI_FLINEAR0_1938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1937, v ds
+# define BFI_FLINEAR0_1938_TICK(t)
+# define BFI_FLINEAR0_1937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1936, v ds
+# define BFI_FLINEAR0_1937_TICK(t)
+# define BFI_FLINEAR0_1936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1935, v ds
+# define BFI_FLINEAR0_1936_TICK(t)
+# define BFI_FLINEAR0_1935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1934, v ds
+# define BFI_FLINEAR0_1935_TICK(t)
+# define BFI_FLINEAR0_1934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1933, v ds
+# define BFI_FLINEAR0_1934_TICK(t)
+# define BFI_FLINEAR0_1933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1932, v ds
+# define BFI_FLINEAR0_1933_TICK(t)
+# define BFI_FLINEAR0_1932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1931, v ds
+# define BFI_FLINEAR0_1932_TICK(t)
+# define BFI_FLINEAR0_1931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1930, v ds
+# define BFI_FLINEAR0_1931_TICK(t)
+# define BFI_FLINEAR0_1930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1929, v ds
+# define BFI_FLINEAR0_1930_TICK(t)
+# define BFI_FLINEAR0_1929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1928, v ds
+# define BFI_FLINEAR0_1929_TICK(t)
+# define BFI_FLINEAR0_1928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1927, v ds
+# define BFI_FLINEAR0_1928_TICK(t)
+# define BFI_FLINEAR0_1927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1926, v ds
+# define BFI_FLINEAR0_1927_TICK(t)
+# define BFI_FLINEAR0_1926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1925, v ds
+# define BFI_FLINEAR0_1926_TICK(t)
+# define BFI_FLINEAR0_1925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1924, v ds
+# define BFI_FLINEAR0_1925_TICK(t)
+# define BFI_FLINEAR0_1924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1923, v ds
+# define BFI_FLINEAR0_1924_TICK(t)
+# define BFI_FLINEAR0_1923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1922, v ds
+# define BFI_FLINEAR0_1923_TICK(t)
+# define BFI_FLINEAR0_1922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1921, v ds
+# define BFI_FLINEAR0_1922_TICK(t)
+# define BFI_FLINEAR0_1921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1920, v ds
+# define BFI_FLINEAR0_1921_TICK(t)
+# define BFI_FLINEAR0_1920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1919, v ds
+# define BFI_FLINEAR0_1920_TICK(t)
+# define BFI_FLINEAR0_1919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1918, v ds
+# define BFI_FLINEAR0_1919_TICK(t)
+# define BFI_FLINEAR0_1918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1917, v ds
+# define BFI_FLINEAR0_1918_TICK(t)
+# define BFI_FLINEAR0_1917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1916, v ds
+# define BFI_FLINEAR0_1917_TICK(t)
+# define BFI_FLINEAR0_1916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1915, v ds
+# define BFI_FLINEAR0_1916_TICK(t)
+# define BFI_FLINEAR0_1915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1914, v ds
+# define BFI_FLINEAR0_1915_TICK(t)
+# define BFI_FLINEAR0_1914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1913, v ds
+# define BFI_FLINEAR0_1914_TICK(t)
+# define BFI_FLINEAR0_1913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1912, v ds
+# define BFI_FLINEAR0_1913_TICK(t)
+# define BFI_FLINEAR0_1912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1911, v ds
+# define BFI_FLINEAR0_1912_TICK(t)
+# define BFI_FLINEAR0_1911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1910, v ds
+# define BFI_FLINEAR0_1911_TICK(t)
+# define BFI_FLINEAR0_1910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1909, v ds
+# define BFI_FLINEAR0_1910_TICK(t)
+# define BFI_FLINEAR0_1909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1908, v ds
+# define BFI_FLINEAR0_1909_TICK(t)
+# define BFI_FLINEAR0_1908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1907, v ds
+# define BFI_FLINEAR0_1908_TICK(t)
+# define BFI_FLINEAR0_1907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1906, v ds
+# define BFI_FLINEAR0_1907_TICK(t)
+# define BFI_FLINEAR0_1906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1905, v ds
+# define BFI_FLINEAR0_1906_TICK(t)
+# define BFI_FLINEAR0_1905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1904, v ds
+# define BFI_FLINEAR0_1905_TICK(t)
+# define BFI_FLINEAR0_1904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1903, v ds
+# define BFI_FLINEAR0_1904_TICK(t)
+# define BFI_FLINEAR0_1903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1902, v ds
+# define BFI_FLINEAR0_1903_TICK(t)
+# define BFI_FLINEAR0_1902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1901, v ds
+# define BFI_FLINEAR0_1902_TICK(t)
+# define BFI_FLINEAR0_1901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1900, v ds
+# define BFI_FLINEAR0_1901_TICK(t)
+# define BFI_FLINEAR0_1900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1899, v ds
+# define BFI_FLINEAR0_1900_TICK(t)
+# define BFI_FLINEAR0_1899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1898, v ds
+# define BFI_FLINEAR0_1899_TICK(t)
+# define BFI_FLINEAR0_1898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1897, v ds
+# define BFI_FLINEAR0_1898_TICK(t)
+# define BFI_FLINEAR0_1897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1896, v ds
+# define BFI_FLINEAR0_1897_TICK(t)
+# define BFI_FLINEAR0_1896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1895, v ds
+# define BFI_FLINEAR0_1896_TICK(t)
+# define BFI_FLINEAR0_1895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1894, v ds
+# define BFI_FLINEAR0_1895_TICK(t)
+# define BFI_FLINEAR0_1894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1893, v ds
+# define BFI_FLINEAR0_1894_TICK(t)
+# define BFI_FLINEAR0_1893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1892, v ds
+# define BFI_FLINEAR0_1893_TICK(t)
+# define BFI_FLINEAR0_1892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1891, v ds
+# define BFI_FLINEAR0_1892_TICK(t)
+# define BFI_FLINEAR0_1891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1890, v ds
+# define BFI_FLINEAR0_1891_TICK(t)
+# define BFI_FLINEAR0_1890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1889, v ds
+# define BFI_FLINEAR0_1890_TICK(t)
+# define BFI_FLINEAR0_1889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1888, v ds
+# define BFI_FLINEAR0_1889_TICK(t)
+# define BFI_FLINEAR0_1888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1887, v ds
+# define BFI_FLINEAR0_1888_TICK(t)
+# define BFI_FLINEAR0_1887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1886, v ds
+# define BFI_FLINEAR0_1887_TICK(t)
+# define BFI_FLINEAR0_1886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1885, v ds
+# define BFI_FLINEAR0_1886_TICK(t)
+# define BFI_FLINEAR0_1885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1884, v ds
+# define BFI_FLINEAR0_1885_TICK(t)
+# define BFI_FLINEAR0_1884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1883, v ds
+# define BFI_FLINEAR0_1884_TICK(t)
+# define BFI_FLINEAR0_1883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1882, v ds
+# define BFI_FLINEAR0_1883_TICK(t)
+# define BFI_FLINEAR0_1882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1881, v ds
+# define BFI_FLINEAR0_1882_TICK(t)
+# define BFI_FLINEAR0_1881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1880, v ds
+# define BFI_FLINEAR0_1881_TICK(t)
+# define BFI_FLINEAR0_1880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1879, v ds
+# define BFI_FLINEAR0_1880_TICK(t)
+# define BFI_FLINEAR0_1879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1878, v ds
+# define BFI_FLINEAR0_1879_TICK(t)
+# define BFI_FLINEAR0_1878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1877, v ds
+# define BFI_FLINEAR0_1878_TICK(t)
+# define BFI_FLINEAR0_1877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1876, v ds
+# define BFI_FLINEAR0_1877_TICK(t)
+# define BFI_FLINEAR0_1876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1875, v ds
+# define BFI_FLINEAR0_1876_TICK(t)
+# define BFI_FLINEAR0_1875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1874, v ds
+# define BFI_FLINEAR0_1875_TICK(t)
+# define BFI_FLINEAR0_1874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1873, v ds
+# define BFI_FLINEAR0_1874_TICK(t)
+# define BFI_FLINEAR0_1873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1872, v ds
+# define BFI_FLINEAR0_1873_TICK(t)
+# define BFI_FLINEAR0_1872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1871, v ds
+# define BFI_FLINEAR0_1872_TICK(t)
+# define BFI_FLINEAR0_1871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1870, v ds
+# define BFI_FLINEAR0_1871_TICK(t)
+# define BFI_FLINEAR0_1870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1869, v ds
+# define BFI_FLINEAR0_1870_TICK(t)
+# define BFI_FLINEAR0_1869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1868, v ds
+# define BFI_FLINEAR0_1869_TICK(t)
+# define BFI_FLINEAR0_1868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1867, v ds
+# define BFI_FLINEAR0_1868_TICK(t)
+# define BFI_FLINEAR0_1867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1866, v ds
+# define BFI_FLINEAR0_1867_TICK(t)
+# define BFI_FLINEAR0_1866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1865, v ds
+# define BFI_FLINEAR0_1866_TICK(t)
+# define BFI_FLINEAR0_1865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1864, v ds
+# define BFI_FLINEAR0_1865_TICK(t)
+# define BFI_FLINEAR0_1864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1863, v ds
+# define BFI_FLINEAR0_1864_TICK(t)
+# define BFI_FLINEAR0_1863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1862, v ds
+# define BFI_FLINEAR0_1863_TICK(t)
+# define BFI_FLINEAR0_1862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1861, v ds
+# define BFI_FLINEAR0_1862_TICK(t)
+# define BFI_FLINEAR0_1861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1860, v ds
+# define BFI_FLINEAR0_1861_TICK(t)
+# define BFI_FLINEAR0_1860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1859, v ds
+# define BFI_FLINEAR0_1860_TICK(t)
+# define BFI_FLINEAR0_1859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1858, v ds
+# define BFI_FLINEAR0_1859_TICK(t)
+# define BFI_FLINEAR0_1858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1857, v ds
+# define BFI_FLINEAR0_1858_TICK(t)
+# define BFI_FLINEAR0_1857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1856, v ds
+# define BFI_FLINEAR0_1857_TICK(t)
+# define BFI_FLINEAR0_1856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1855, v ds
+# define BFI_FLINEAR0_1856_TICK(t)
+# define BFI_FLINEAR0_1855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1854, v ds
+# define BFI_FLINEAR0_1855_TICK(t)
+# define BFI_FLINEAR0_1854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1853, v ds
+# define BFI_FLINEAR0_1854_TICK(t)
+# define BFI_FLINEAR0_1853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1852, v ds
+# define BFI_FLINEAR0_1853_TICK(t)
+# define BFI_FLINEAR0_1852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1851, v ds
+# define BFI_FLINEAR0_1852_TICK(t)
+# define BFI_FLINEAR0_1851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1850, v ds
+# define BFI_FLINEAR0_1851_TICK(t)
+# define BFI_FLINEAR0_1850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1849, v ds
+# define BFI_FLINEAR0_1850_TICK(t)
+# define BFI_FLINEAR0_1849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1848, v ds
+# define BFI_FLINEAR0_1849_TICK(t)
+# define BFI_FLINEAR0_1848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1847, v ds
+# define BFI_FLINEAR0_1848_TICK(t)
+# define BFI_FLINEAR0_1847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1846, v ds
+# define BFI_FLINEAR0_1847_TICK(t)
+# define BFI_FLINEAR0_1846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1845, v ds
+# define BFI_FLINEAR0_1846_TICK(t)
+# define BFI_FLINEAR0_1845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1844, v ds
+# define BFI_FLINEAR0_1845_TICK(t)
+# define BFI_FLINEAR0_1844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1843, v ds
+# define BFI_FLINEAR0_1844_TICK(t)
+# define BFI_FLINEAR0_1843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1842, v ds
+# define BFI_FLINEAR0_1843_TICK(t)
+# define BFI_FLINEAR0_1842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1841, v ds
+# define BFI_FLINEAR0_1842_TICK(t)
+# define BFI_FLINEAR0_1841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1840, v ds
+# define BFI_FLINEAR0_1841_TICK(t)
+# define BFI_FLINEAR0_1840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1839, v ds
+# define BFI_FLINEAR0_1840_TICK(t)
+# define BFI_FLINEAR0_1839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1838, v ds
+# define BFI_FLINEAR0_1839_TICK(t)
+# define BFI_FLINEAR0_1838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1837, v ds
+# define BFI_FLINEAR0_1838_TICK(t)
+# define BFI_FLINEAR0_1837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1836, v ds
+# define BFI_FLINEAR0_1837_TICK(t)
+# define BFI_FLINEAR0_1836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1835, v ds
+# define BFI_FLINEAR0_1836_TICK(t)
+# define BFI_FLINEAR0_1835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1834, v ds
+# define BFI_FLINEAR0_1835_TICK(t)
+# define BFI_FLINEAR0_1834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1833, v ds
+# define BFI_FLINEAR0_1834_TICK(t)
+# define BFI_FLINEAR0_1833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1832, v ds
+# define BFI_FLINEAR0_1833_TICK(t)
+# define BFI_FLINEAR0_1832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1831, v ds
+# define BFI_FLINEAR0_1832_TICK(t)
+# define BFI_FLINEAR0_1831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1830, v ds
+# define BFI_FLINEAR0_1831_TICK(t)
+# define BFI_FLINEAR0_1830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1829, v ds
+# define BFI_FLINEAR0_1830_TICK(t)
+# define BFI_FLINEAR0_1829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1828, v ds
+# define BFI_FLINEAR0_1829_TICK(t)
+# define BFI_FLINEAR0_1828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1827, v ds
+# define BFI_FLINEAR0_1828_TICK(t)
+# define BFI_FLINEAR0_1827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1826, v ds
+# define BFI_FLINEAR0_1827_TICK(t)
+# define BFI_FLINEAR0_1826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1825, v ds
+# define BFI_FLINEAR0_1826_TICK(t)
+# define BFI_FLINEAR0_1825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1824, v ds
+# define BFI_FLINEAR0_1825_TICK(t)
+# define BFI_FLINEAR0_1824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1823, v ds
+# define BFI_FLINEAR0_1824_TICK(t)
+# define BFI_FLINEAR0_1823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1822, v ds
+# define BFI_FLINEAR0_1823_TICK(t)
+# define BFI_FLINEAR0_1822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1821, v ds
+# define BFI_FLINEAR0_1822_TICK(t)
+# define BFI_FLINEAR0_1821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1820, v ds
+# define BFI_FLINEAR0_1821_TICK(t)
+# define BFI_FLINEAR0_1820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1819, v ds
+# define BFI_FLINEAR0_1820_TICK(t)
+# define BFI_FLINEAR0_1819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1818, v ds
+# define BFI_FLINEAR0_1819_TICK(t)
+# define BFI_FLINEAR0_1818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1817, v ds
+# define BFI_FLINEAR0_1818_TICK(t)
+# define BFI_FLINEAR0_1817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1816, v ds
+# define BFI_FLINEAR0_1817_TICK(t)
+# define BFI_FLINEAR0_1816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1815, v ds
+# define BFI_FLINEAR0_1816_TICK(t)
+# define BFI_FLINEAR0_1815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1814, v ds
+# define BFI_FLINEAR0_1815_TICK(t)
+# define BFI_FLINEAR0_1814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1813, v ds
+# define BFI_FLINEAR0_1814_TICK(t)
+# define BFI_FLINEAR0_1813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1812, v ds
+# define BFI_FLINEAR0_1813_TICK(t)
+# define BFI_FLINEAR0_1812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1811, v ds
+# define BFI_FLINEAR0_1812_TICK(t)
+# define BFI_FLINEAR0_1811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1810, v ds
+# define BFI_FLINEAR0_1811_TICK(t)
+# define BFI_FLINEAR0_1810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1809, v ds
+# define BFI_FLINEAR0_1810_TICK(t)
+# define BFI_FLINEAR0_1809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1808, v ds
+# define BFI_FLINEAR0_1809_TICK(t)
+# define BFI_FLINEAR0_1808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1807, v ds
+# define BFI_FLINEAR0_1808_TICK(t)
+# define BFI_FLINEAR0_1807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1806, v ds
+# define BFI_FLINEAR0_1807_TICK(t)
+# define BFI_FLINEAR0_1806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1805, v ds
+# define BFI_FLINEAR0_1806_TICK(t)
+# define BFI_FLINEAR0_1805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1804, v ds
+# define BFI_FLINEAR0_1805_TICK(t)
+# define BFI_FLINEAR0_1804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1803, v ds
+# define BFI_FLINEAR0_1804_TICK(t)
+# define BFI_FLINEAR0_1803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1802, v ds
+# define BFI_FLINEAR0_1803_TICK(t)
+# define BFI_FLINEAR0_1802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1801, v ds
+# define BFI_FLINEAR0_1802_TICK(t)
+# define BFI_FLINEAR0_1801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1800, v ds
+# define BFI_FLINEAR0_1801_TICK(t)
+# define BFI_FLINEAR0_1800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1799, v ds
+# define BFI_FLINEAR0_1800_TICK(t)
+# define BFI_FLINEAR0_1799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1798, v ds
+# define BFI_FLINEAR0_1799_TICK(t)
+# define BFI_FLINEAR0_1798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1797, v ds
+# define BFI_FLINEAR0_1798_TICK(t)
+# define BFI_FLINEAR0_1797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1796, v ds
+# define BFI_FLINEAR0_1797_TICK(t)
+# define BFI_FLINEAR0_1796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1795, v ds
+# define BFI_FLINEAR0_1796_TICK(t)
+# define BFI_FLINEAR0_1795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1794, v ds
+# define BFI_FLINEAR0_1795_TICK(t)
+# define BFI_FLINEAR0_1794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1793, v ds
+# define BFI_FLINEAR0_1794_TICK(t)
+# define BFI_FLINEAR0_1793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1792, v ds
+# define BFI_FLINEAR0_1793_TICK(t)
+# define BFI_FLINEAR0_1792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1791, v ds
+# define BFI_FLINEAR0_1792_TICK(t)
+# define BFI_FLINEAR0_1791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1790, v ds
+# define BFI_FLINEAR0_1791_TICK(t)
+# define BFI_FLINEAR0_1790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1789, v ds
+# define BFI_FLINEAR0_1790_TICK(t)
+# define BFI_FLINEAR0_1789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1788, v ds
+# define BFI_FLINEAR0_1789_TICK(t)
+# define BFI_FLINEAR0_1788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1787, v ds
+# define BFI_FLINEAR0_1788_TICK(t)
+# define BFI_FLINEAR0_1787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1786, v ds
+# define BFI_FLINEAR0_1787_TICK(t)
+# define BFI_FLINEAR0_1786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1785, v ds
+# define BFI_FLINEAR0_1786_TICK(t)
+# define BFI_FLINEAR0_1785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1784, v ds
+# define BFI_FLINEAR0_1785_TICK(t)
+# define BFI_FLINEAR0_1784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1783, v ds
+# define BFI_FLINEAR0_1784_TICK(t)
+# define BFI_FLINEAR0_1783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1782, v ds
+# define BFI_FLINEAR0_1783_TICK(t)
+# define BFI_FLINEAR0_1782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1781, v ds
+# define BFI_FLINEAR0_1782_TICK(t)
+# define BFI_FLINEAR0_1781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1780, v ds
+# define BFI_FLINEAR0_1781_TICK(t)
+# define BFI_FLINEAR0_1780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1779, v ds
+# define BFI_FLINEAR0_1780_TICK(t)
+# define BFI_FLINEAR0_1779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1778, v ds
+# define BFI_FLINEAR0_1779_TICK(t)
+# define BFI_FLINEAR0_1778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1777, v ds
+# define BFI_FLINEAR0_1778_TICK(t)
+# define BFI_FLINEAR0_1777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1776, v ds
+# define BFI_FLINEAR0_1777_TICK(t)
+# define BFI_FLINEAR0_1776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1775, v ds
+# define BFI_FLINEAR0_1776_TICK(t)
+# define BFI_FLINEAR0_1775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1774, v ds
+# define BFI_FLINEAR0_1775_TICK(t)
+# define BFI_FLINEAR0_1774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1773, v ds
+# define BFI_FLINEAR0_1774_TICK(t)
+# define BFI_FLINEAR0_1773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1772, v ds
+# define BFI_FLINEAR0_1773_TICK(t)
+# define BFI_FLINEAR0_1772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1771, v ds
+# define BFI_FLINEAR0_1772_TICK(t)
+# define BFI_FLINEAR0_1771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1770, v ds
+# define BFI_FLINEAR0_1771_TICK(t)
+# define BFI_FLINEAR0_1770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1769, v ds
+# define BFI_FLINEAR0_1770_TICK(t)
+# define BFI_FLINEAR0_1769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1768, v ds
+# define BFI_FLINEAR0_1769_TICK(t)
+# define BFI_FLINEAR0_1768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1767, v ds
+# define BFI_FLINEAR0_1768_TICK(t)
+# define BFI_FLINEAR0_1767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1766, v ds
+# define BFI_FLINEAR0_1767_TICK(t)
+# define BFI_FLINEAR0_1766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1765, v ds
+# define BFI_FLINEAR0_1766_TICK(t)
+# define BFI_FLINEAR0_1765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1764, v ds
+# define BFI_FLINEAR0_1765_TICK(t)
+# define BFI_FLINEAR0_1764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1763, v ds
+# define BFI_FLINEAR0_1764_TICK(t)
+# define BFI_FLINEAR0_1763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1762, v ds
+# define BFI_FLINEAR0_1763_TICK(t)
+# define BFI_FLINEAR0_1762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1761, v ds
+# define BFI_FLINEAR0_1762_TICK(t)
+# define BFI_FLINEAR0_1761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1760, v ds
+# define BFI_FLINEAR0_1761_TICK(t)
+# define BFI_FLINEAR0_1760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1759, v ds
+# define BFI_FLINEAR0_1760_TICK(t)
+# define BFI_FLINEAR0_1759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1758, v ds
+# define BFI_FLINEAR0_1759_TICK(t)
+# define BFI_FLINEAR0_1758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1757, v ds
+# define BFI_FLINEAR0_1758_TICK(t)
+# define BFI_FLINEAR0_1757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1756, v ds
+# define BFI_FLINEAR0_1757_TICK(t)
+# define BFI_FLINEAR0_1756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1755, v ds
+# define BFI_FLINEAR0_1756_TICK(t)
+# define BFI_FLINEAR0_1755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1754, v ds
+# define BFI_FLINEAR0_1755_TICK(t)
+# define BFI_FLINEAR0_1754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1753, v ds
+# define BFI_FLINEAR0_1754_TICK(t)
+# define BFI_FLINEAR0_1753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1752, v ds
+# define BFI_FLINEAR0_1753_TICK(t)
+# define BFI_FLINEAR0_1752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1751, v ds
+# define BFI_FLINEAR0_1752_TICK(t)
+# define BFI_FLINEAR0_1751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1750, v ds
+# define BFI_FLINEAR0_1751_TICK(t)
+# define BFI_FLINEAR0_1750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1749, v ds
+# define BFI_FLINEAR0_1750_TICK(t)
+# define BFI_FLINEAR0_1749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1748, v ds
+# define BFI_FLINEAR0_1749_TICK(t)
+# define BFI_FLINEAR0_1748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1747, v ds
+# define BFI_FLINEAR0_1748_TICK(t)
+# define BFI_FLINEAR0_1747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1746, v ds
+# define BFI_FLINEAR0_1747_TICK(t)
+# define BFI_FLINEAR0_1746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1745, v ds
+# define BFI_FLINEAR0_1746_TICK(t)
+# define BFI_FLINEAR0_1745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1744, v ds
+# define BFI_FLINEAR0_1745_TICK(t)
+# define BFI_FLINEAR0_1744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1743, v ds
+# define BFI_FLINEAR0_1744_TICK(t)
+# define BFI_FLINEAR0_1743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1742, v ds
+# define BFI_FLINEAR0_1743_TICK(t)
+# define BFI_FLINEAR0_1742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1741, v ds
+# define BFI_FLINEAR0_1742_TICK(t)
+# define BFI_FLINEAR0_1741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1740, v ds
+# define BFI_FLINEAR0_1741_TICK(t)
+# define BFI_FLINEAR0_1740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1739, v ds
+# define BFI_FLINEAR0_1740_TICK(t)
+# define BFI_FLINEAR0_1739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1738, v ds
+# define BFI_FLINEAR0_1739_TICK(t)
+# define BFI_FLINEAR0_1738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1737, v ds
+# define BFI_FLINEAR0_1738_TICK(t)
+# define BFI_FLINEAR0_1737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1736, v ds
+# define BFI_FLINEAR0_1737_TICK(t)
+# define BFI_FLINEAR0_1736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1735, v ds
+# define BFI_FLINEAR0_1736_TICK(t)
+# define BFI_FLINEAR0_1735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1734, v ds
+# define BFI_FLINEAR0_1735_TICK(t)
+# define BFI_FLINEAR0_1734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1733, v ds
+# define BFI_FLINEAR0_1734_TICK(t)
+# define BFI_FLINEAR0_1733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1732, v ds
+# define BFI_FLINEAR0_1733_TICK(t)
+# define BFI_FLINEAR0_1732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1731, v ds
+# define BFI_FLINEAR0_1732_TICK(t)
+# define BFI_FLINEAR0_1731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1730, v ds
+# define BFI_FLINEAR0_1731_TICK(t)
+# define BFI_FLINEAR0_1730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1729, v ds
+# define BFI_FLINEAR0_1730_TICK(t)
+# define BFI_FLINEAR0_1729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1728, v ds
+# define BFI_FLINEAR0_1729_TICK(t)
+# define BFI_FLINEAR0_1728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1727, v ds
+# define BFI_FLINEAR0_1728_TICK(t)
+# define BFI_FLINEAR0_1727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1726, v ds
+# define BFI_FLINEAR0_1727_TICK(t)
+# define BFI_FLINEAR0_1726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1725, v ds
+# define BFI_FLINEAR0_1726_TICK(t)
+# define BFI_FLINEAR0_1725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1724, v ds
+# define BFI_FLINEAR0_1725_TICK(t)
+# define BFI_FLINEAR0_1724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1723, v ds
+# define BFI_FLINEAR0_1724_TICK(t)
+# define BFI_FLINEAR0_1723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1722, v ds
+# define BFI_FLINEAR0_1723_TICK(t)
+# define BFI_FLINEAR0_1722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1721, v ds
+# define BFI_FLINEAR0_1722_TICK(t)
+# define BFI_FLINEAR0_1721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1720, v ds
+# define BFI_FLINEAR0_1721_TICK(t)
+# define BFI_FLINEAR0_1720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1719, v ds
+# define BFI_FLINEAR0_1720_TICK(t)
+# define BFI_FLINEAR0_1719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1718, v ds
+# define BFI_FLINEAR0_1719_TICK(t)
+# define BFI_FLINEAR0_1718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1717, v ds
+# define BFI_FLINEAR0_1718_TICK(t)
+# define BFI_FLINEAR0_1717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1716, v ds
+# define BFI_FLINEAR0_1717_TICK(t)
+# define BFI_FLINEAR0_1716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1715, v ds
+# define BFI_FLINEAR0_1716_TICK(t)
+# define BFI_FLINEAR0_1715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1714, v ds
+# define BFI_FLINEAR0_1715_TICK(t)
+# define BFI_FLINEAR0_1714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1713, v ds
+# define BFI_FLINEAR0_1714_TICK(t)
+# define BFI_FLINEAR0_1713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1712, v ds
+# define BFI_FLINEAR0_1713_TICK(t)
+# define BFI_FLINEAR0_1712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1711, v ds
+# define BFI_FLINEAR0_1712_TICK(t)
+# define BFI_FLINEAR0_1711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1710, v ds
+# define BFI_FLINEAR0_1711_TICK(t)
+# define BFI_FLINEAR0_1710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1709, v ds
+# define BFI_FLINEAR0_1710_TICK(t)
+# define BFI_FLINEAR0_1709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1708, v ds
+# define BFI_FLINEAR0_1709_TICK(t)
+# define BFI_FLINEAR0_1708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1707, v ds
+# define BFI_FLINEAR0_1708_TICK(t)
+# define BFI_FLINEAR0_1707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1706, v ds
+# define BFI_FLINEAR0_1707_TICK(t)
+# define BFI_FLINEAR0_1706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1705, v ds
+# define BFI_FLINEAR0_1706_TICK(t)
+# define BFI_FLINEAR0_1705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1704, v ds
+# define BFI_FLINEAR0_1705_TICK(t)
+# define BFI_FLINEAR0_1704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1703, v ds
+# define BFI_FLINEAR0_1704_TICK(t)
+# define BFI_FLINEAR0_1703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1702, v ds
+# define BFI_FLINEAR0_1703_TICK(t)
+# define BFI_FLINEAR0_1702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1701, v ds
+# define BFI_FLINEAR0_1702_TICK(t)
+# define BFI_FLINEAR0_1701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1700, v ds
+# define BFI_FLINEAR0_1701_TICK(t)
+# define BFI_FLINEAR0_1700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1699, v ds
+# define BFI_FLINEAR0_1700_TICK(t)
+# define BFI_FLINEAR0_1699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1698, v ds
+# define BFI_FLINEAR0_1699_TICK(t)
+# define BFI_FLINEAR0_1698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1697, v ds
+# define BFI_FLINEAR0_1698_TICK(t)
+# define BFI_FLINEAR0_1697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1696, v ds
+# define BFI_FLINEAR0_1697_TICK(t)
+# define BFI_FLINEAR0_1696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1695, v ds
+# define BFI_FLINEAR0_1696_TICK(t)
+# define BFI_FLINEAR0_1695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1694, v ds
+# define BFI_FLINEAR0_1695_TICK(t)
+# define BFI_FLINEAR0_1694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1693, v ds
+# define BFI_FLINEAR0_1694_TICK(t)
+# define BFI_FLINEAR0_1693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1692, v ds
+# define BFI_FLINEAR0_1693_TICK(t)
+# define BFI_FLINEAR0_1692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1691, v ds
+# define BFI_FLINEAR0_1692_TICK(t)
+# define BFI_FLINEAR0_1691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1690, v ds
+# define BFI_FLINEAR0_1691_TICK(t)
+# define BFI_FLINEAR0_1690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1689, v ds
+# define BFI_FLINEAR0_1690_TICK(t)
+# define BFI_FLINEAR0_1689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1688, v ds
+# define BFI_FLINEAR0_1689_TICK(t)
+# define BFI_FLINEAR0_1688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1687, v ds
+# define BFI_FLINEAR0_1688_TICK(t)
+# define BFI_FLINEAR0_1687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1686, v ds
+# define BFI_FLINEAR0_1687_TICK(t)
+# define BFI_FLINEAR0_1686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1685, v ds
+# define BFI_FLINEAR0_1686_TICK(t)
+# define BFI_FLINEAR0_1685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1684, v ds
+# define BFI_FLINEAR0_1685_TICK(t)
+# define BFI_FLINEAR0_1684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1683, v ds
+# define BFI_FLINEAR0_1684_TICK(t)
+# define BFI_FLINEAR0_1683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1682, v ds
+# define BFI_FLINEAR0_1683_TICK(t)
+# define BFI_FLINEAR0_1682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1681, v ds
+# define BFI_FLINEAR0_1682_TICK(t)
+# define BFI_FLINEAR0_1681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1680, v ds
+# define BFI_FLINEAR0_1681_TICK(t)
+# define BFI_FLINEAR0_1680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1679, v ds
+# define BFI_FLINEAR0_1680_TICK(t)
+# define BFI_FLINEAR0_1679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1678, v ds
+# define BFI_FLINEAR0_1679_TICK(t)
+# define BFI_FLINEAR0_1678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1677, v ds
+# define BFI_FLINEAR0_1678_TICK(t)
+# define BFI_FLINEAR0_1677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1676, v ds
+# define BFI_FLINEAR0_1677_TICK(t)
+# define BFI_FLINEAR0_1676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1675, v ds
+# define BFI_FLINEAR0_1676_TICK(t)
+# define BFI_FLINEAR0_1675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1674, v ds
+# define BFI_FLINEAR0_1675_TICK(t)
+# define BFI_FLINEAR0_1674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1673, v ds
+# define BFI_FLINEAR0_1674_TICK(t)
+# define BFI_FLINEAR0_1673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1672, v ds
+# define BFI_FLINEAR0_1673_TICK(t)
+# define BFI_FLINEAR0_1672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1671, v ds
+# define BFI_FLINEAR0_1672_TICK(t)
+# define BFI_FLINEAR0_1671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1670, v ds
+# define BFI_FLINEAR0_1671_TICK(t)
+# define BFI_FLINEAR0_1670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1669, v ds
+# define BFI_FLINEAR0_1670_TICK(t)
+# define BFI_FLINEAR0_1669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1668, v ds
+# define BFI_FLINEAR0_1669_TICK(t)
+# define BFI_FLINEAR0_1668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1667, v ds
+# define BFI_FLINEAR0_1668_TICK(t)
+# define BFI_FLINEAR0_1667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1666, v ds
+# define BFI_FLINEAR0_1667_TICK(t)
+# define BFI_FLINEAR0_1666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1665, v ds
+# define BFI_FLINEAR0_1666_TICK(t)
+# define BFI_FLINEAR0_1665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1664, v ds
+# define BFI_FLINEAR0_1665_TICK(t)
+# define BFI_FLINEAR0_1664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1663, v ds
+# define BFI_FLINEAR0_1664_TICK(t)
+# define BFI_FLINEAR0_1663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1662, v ds
+# define BFI_FLINEAR0_1663_TICK(t)
+# define BFI_FLINEAR0_1662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1661, v ds
+# define BFI_FLINEAR0_1662_TICK(t)
+# define BFI_FLINEAR0_1661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1660, v ds
+# define BFI_FLINEAR0_1661_TICK(t)
+# define BFI_FLINEAR0_1660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1659, v ds
+# define BFI_FLINEAR0_1660_TICK(t)
+# define BFI_FLINEAR0_1659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1658, v ds
+# define BFI_FLINEAR0_1659_TICK(t)
+# define BFI_FLINEAR0_1658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1657, v ds
+# define BFI_FLINEAR0_1658_TICK(t)
+# define BFI_FLINEAR0_1657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1656, v ds
+# define BFI_FLINEAR0_1657_TICK(t)
+# define BFI_FLINEAR0_1656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1655, v ds
+# define BFI_FLINEAR0_1656_TICK(t)
+# define BFI_FLINEAR0_1655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1654, v ds
+# define BFI_FLINEAR0_1655_TICK(t)
+# define BFI_FLINEAR0_1654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1653, v ds
+# define BFI_FLINEAR0_1654_TICK(t)
+# define BFI_FLINEAR0_1653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1652, v ds
+# define BFI_FLINEAR0_1653_TICK(t)
+# define BFI_FLINEAR0_1652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1651, v ds
+# define BFI_FLINEAR0_1652_TICK(t)
+# define BFI_FLINEAR0_1651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1650, v ds
+# define BFI_FLINEAR0_1651_TICK(t)
+# define BFI_FLINEAR0_1650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1649, v ds
+# define BFI_FLINEAR0_1650_TICK(t)
+# define BFI_FLINEAR0_1649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1648, v ds
+# define BFI_FLINEAR0_1649_TICK(t)
+# define BFI_FLINEAR0_1648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1647, v ds
+# define BFI_FLINEAR0_1648_TICK(t)
+# define BFI_FLINEAR0_1647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1646, v ds
+# define BFI_FLINEAR0_1647_TICK(t)
+# define BFI_FLINEAR0_1646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1645, v ds
+# define BFI_FLINEAR0_1646_TICK(t)
+# define BFI_FLINEAR0_1645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1644, v ds
+# define BFI_FLINEAR0_1645_TICK(t)
+# define BFI_FLINEAR0_1644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1643, v ds
+# define BFI_FLINEAR0_1644_TICK(t)
+# define BFI_FLINEAR0_1643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1642, v ds
+# define BFI_FLINEAR0_1643_TICK(t)
+# define BFI_FLINEAR0_1642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1641, v ds
+# define BFI_FLINEAR0_1642_TICK(t)
+# define BFI_FLINEAR0_1641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1640, v ds
+# define BFI_FLINEAR0_1641_TICK(t)
+# define BFI_FLINEAR0_1640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1639, v ds
+# define BFI_FLINEAR0_1640_TICK(t)
+# define BFI_FLINEAR0_1639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1638, v ds
+# define BFI_FLINEAR0_1639_TICK(t)
+# define BFI_FLINEAR0_1638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1637, v ds
+# define BFI_FLINEAR0_1638_TICK(t)
+# define BFI_FLINEAR0_1637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1636, v ds
+# define BFI_FLINEAR0_1637_TICK(t)
+# define BFI_FLINEAR0_1636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1635, v ds
+# define BFI_FLINEAR0_1636_TICK(t)
+# define BFI_FLINEAR0_1635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1634, v ds
+# define BFI_FLINEAR0_1635_TICK(t)
+# define BFI_FLINEAR0_1634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1633, v ds
+# define BFI_FLINEAR0_1634_TICK(t)
+# define BFI_FLINEAR0_1633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1632, v ds
+# define BFI_FLINEAR0_1633_TICK(t)
+# define BFI_FLINEAR0_1632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1631, v ds
+# define BFI_FLINEAR0_1632_TICK(t)
+# define BFI_FLINEAR0_1631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1630, v ds
+# define BFI_FLINEAR0_1631_TICK(t)
+# define BFI_FLINEAR0_1630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1629, v ds
+# define BFI_FLINEAR0_1630_TICK(t)
+# define BFI_FLINEAR0_1629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1628, v ds
+# define BFI_FLINEAR0_1629_TICK(t)
+# define BFI_FLINEAR0_1628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1627, v ds
+# define BFI_FLINEAR0_1628_TICK(t)
+# define BFI_FLINEAR0_1627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1626, v ds
+# define BFI_FLINEAR0_1627_TICK(t)
+# define BFI_FLINEAR0_1626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1625, v ds
+# define BFI_FLINEAR0_1626_TICK(t)
+# define BFI_FLINEAR0_1625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1624, v ds
+# define BFI_FLINEAR0_1625_TICK(t)
+# define BFI_FLINEAR0_1624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1623, v ds
+# define BFI_FLINEAR0_1624_TICK(t)
+# define BFI_FLINEAR0_1623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1622, v ds
+# define BFI_FLINEAR0_1623_TICK(t)
+# define BFI_FLINEAR0_1622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1621, v ds
+# define BFI_FLINEAR0_1622_TICK(t)
+# define BFI_FLINEAR0_1621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1620, v ds
+# define BFI_FLINEAR0_1621_TICK(t)
+# define BFI_FLINEAR0_1620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1619, v ds
+# define BFI_FLINEAR0_1620_TICK(t)
+# define BFI_FLINEAR0_1619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1618, v ds
+# define BFI_FLINEAR0_1619_TICK(t)
+# define BFI_FLINEAR0_1618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1617, v ds
+# define BFI_FLINEAR0_1618_TICK(t)
+# define BFI_FLINEAR0_1617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1616, v ds
+# define BFI_FLINEAR0_1617_TICK(t)
+# define BFI_FLINEAR0_1616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1615, v ds
+# define BFI_FLINEAR0_1616_TICK(t)
+# define BFI_FLINEAR0_1615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1614, v ds
+# define BFI_FLINEAR0_1615_TICK(t)
+# define BFI_FLINEAR0_1614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1613, v ds
+# define BFI_FLINEAR0_1614_TICK(t)
+# define BFI_FLINEAR0_1613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1612, v ds
+# define BFI_FLINEAR0_1613_TICK(t)
+# define BFI_FLINEAR0_1612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1611, v ds
+# define BFI_FLINEAR0_1612_TICK(t)
+# define BFI_FLINEAR0_1611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1610, v ds
+# define BFI_FLINEAR0_1611_TICK(t)
+# define BFI_FLINEAR0_1610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1609, v ds
+# define BFI_FLINEAR0_1610_TICK(t)
+# define BFI_FLINEAR0_1609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1608, v ds
+# define BFI_FLINEAR0_1609_TICK(t)
+# define BFI_FLINEAR0_1608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1607, v ds
+# define BFI_FLINEAR0_1608_TICK(t)
+# define BFI_FLINEAR0_1607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1606, v ds
+# define BFI_FLINEAR0_1607_TICK(t)
+# define BFI_FLINEAR0_1606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1605, v ds
+# define BFI_FLINEAR0_1606_TICK(t)
+# define BFI_FLINEAR0_1605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1604, v ds
+# define BFI_FLINEAR0_1605_TICK(t)
+# define BFI_FLINEAR0_1604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1603, v ds
+# define BFI_FLINEAR0_1604_TICK(t)
+# define BFI_FLINEAR0_1603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1602, v ds
+# define BFI_FLINEAR0_1603_TICK(t)
+# define BFI_FLINEAR0_1602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1601, v ds
+# define BFI_FLINEAR0_1602_TICK(t)
+# define BFI_FLINEAR0_1601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1600, v ds
+# define BFI_FLINEAR0_1601_TICK(t)
+# define BFI_FLINEAR0_1600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1599, v ds
+# define BFI_FLINEAR0_1600_TICK(t)
+# define BFI_FLINEAR0_1599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1598, v ds
+# define BFI_FLINEAR0_1599_TICK(t)
+# define BFI_FLINEAR0_1598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1597, v ds
+# define BFI_FLINEAR0_1598_TICK(t)
+# define BFI_FLINEAR0_1597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1596, v ds
+# define BFI_FLINEAR0_1597_TICK(t)
+# define BFI_FLINEAR0_1596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1595, v ds
+# define BFI_FLINEAR0_1596_TICK(t)
+# define BFI_FLINEAR0_1595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1594, v ds
+# define BFI_FLINEAR0_1595_TICK(t)
+# define BFI_FLINEAR0_1594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1593, v ds
+# define BFI_FLINEAR0_1594_TICK(t)
+# define BFI_FLINEAR0_1593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1592, v ds
+# define BFI_FLINEAR0_1593_TICK(t)
+# define BFI_FLINEAR0_1592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1591, v ds
+# define BFI_FLINEAR0_1592_TICK(t)
+# define BFI_FLINEAR0_1591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1590, v ds
+# define BFI_FLINEAR0_1591_TICK(t)
+# define BFI_FLINEAR0_1590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1589, v ds
+# define BFI_FLINEAR0_1590_TICK(t)
+# define BFI_FLINEAR0_1589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1588, v ds
+# define BFI_FLINEAR0_1589_TICK(t)
+# define BFI_FLINEAR0_1588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1587, v ds
+# define BFI_FLINEAR0_1588_TICK(t)
+# define BFI_FLINEAR0_1587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1586, v ds
+# define BFI_FLINEAR0_1587_TICK(t)
+# define BFI_FLINEAR0_1586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1585, v ds
+# define BFI_FLINEAR0_1586_TICK(t)
+# define BFI_FLINEAR0_1585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1584, v ds
+# define BFI_FLINEAR0_1585_TICK(t)
+# define BFI_FLINEAR0_1584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1583, v ds
+# define BFI_FLINEAR0_1584_TICK(t)
+# define BFI_FLINEAR0_1583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1582, v ds
+# define BFI_FLINEAR0_1583_TICK(t)
+# define BFI_FLINEAR0_1582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1581, v ds
+# define BFI_FLINEAR0_1582_TICK(t)
+# define BFI_FLINEAR0_1581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1580, v ds
+# define BFI_FLINEAR0_1581_TICK(t)
+# define BFI_FLINEAR0_1580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1579, v ds
+# define BFI_FLINEAR0_1580_TICK(t)
+# define BFI_FLINEAR0_1579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1578, v ds
+# define BFI_FLINEAR0_1579_TICK(t)
+# define BFI_FLINEAR0_1578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1577, v ds
+# define BFI_FLINEAR0_1578_TICK(t)
+# define BFI_FLINEAR0_1577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1576, v ds
+# define BFI_FLINEAR0_1577_TICK(t)
+# define BFI_FLINEAR0_1576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1575, v ds
+# define BFI_FLINEAR0_1576_TICK(t)
+# define BFI_FLINEAR0_1575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1574, v ds
+# define BFI_FLINEAR0_1575_TICK(t)
+# define BFI_FLINEAR0_1574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1573, v ds
+# define BFI_FLINEAR0_1574_TICK(t)
+# define BFI_FLINEAR0_1573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1572, v ds
+# define BFI_FLINEAR0_1573_TICK(t)
+# define BFI_FLINEAR0_1572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1571, v ds
+# define BFI_FLINEAR0_1572_TICK(t)
+# define BFI_FLINEAR0_1571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1570, v ds
+# define BFI_FLINEAR0_1571_TICK(t)
+# define BFI_FLINEAR0_1570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1569, v ds
+# define BFI_FLINEAR0_1570_TICK(t)
+# define BFI_FLINEAR0_1569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1568, v ds
+# define BFI_FLINEAR0_1569_TICK(t)
+# define BFI_FLINEAR0_1568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1567, v ds
+# define BFI_FLINEAR0_1568_TICK(t)
+# define BFI_FLINEAR0_1567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1566, v ds
+# define BFI_FLINEAR0_1567_TICK(t)
+# define BFI_FLINEAR0_1566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1565, v ds
+# define BFI_FLINEAR0_1566_TICK(t)
+# define BFI_FLINEAR0_1565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1564, v ds
+# define BFI_FLINEAR0_1565_TICK(t)
+# define BFI_FLINEAR0_1564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1563, v ds
+# define BFI_FLINEAR0_1564_TICK(t)
+# define BFI_FLINEAR0_1563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1562, v ds
+# define BFI_FLINEAR0_1563_TICK(t)
+# define BFI_FLINEAR0_1562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1561, v ds
+# define BFI_FLINEAR0_1562_TICK(t)
+# define BFI_FLINEAR0_1561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1560, v ds
+# define BFI_FLINEAR0_1561_TICK(t)
+# define BFI_FLINEAR0_1560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1559, v ds
+# define BFI_FLINEAR0_1560_TICK(t)
+# define BFI_FLINEAR0_1559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1558, v ds
+# define BFI_FLINEAR0_1559_TICK(t)
+# define BFI_FLINEAR0_1558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1557, v ds
+# define BFI_FLINEAR0_1558_TICK(t)
+# define BFI_FLINEAR0_1557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1556, v ds
+# define BFI_FLINEAR0_1557_TICK(t)
+# define BFI_FLINEAR0_1556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1555, v ds
+# define BFI_FLINEAR0_1556_TICK(t)
+# define BFI_FLINEAR0_1555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1554, v ds
+# define BFI_FLINEAR0_1555_TICK(t)
+# define BFI_FLINEAR0_1554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1553, v ds
+# define BFI_FLINEAR0_1554_TICK(t)
+# define BFI_FLINEAR0_1553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1552, v ds
+# define BFI_FLINEAR0_1553_TICK(t)
+# define BFI_FLINEAR0_1552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1551, v ds
+# define BFI_FLINEAR0_1552_TICK(t)
+# define BFI_FLINEAR0_1551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1550, v ds
+# define BFI_FLINEAR0_1551_TICK(t)
+# define BFI_FLINEAR0_1550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1549, v ds
+# define BFI_FLINEAR0_1550_TICK(t)
+# define BFI_FLINEAR0_1549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1548, v ds
+# define BFI_FLINEAR0_1549_TICK(t)
+# define BFI_FLINEAR0_1548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1547, v ds
+# define BFI_FLINEAR0_1548_TICK(t)
+# define BFI_FLINEAR0_1547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1546, v ds
+# define BFI_FLINEAR0_1547_TICK(t)
+# define BFI_FLINEAR0_1546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1545, v ds
+# define BFI_FLINEAR0_1546_TICK(t)
+# define BFI_FLINEAR0_1545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1544, v ds
+# define BFI_FLINEAR0_1545_TICK(t)
+# define BFI_FLINEAR0_1544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1543, v ds
+# define BFI_FLINEAR0_1544_TICK(t)
+# define BFI_FLINEAR0_1543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1542, v ds
+# define BFI_FLINEAR0_1543_TICK(t)
+# define BFI_FLINEAR0_1542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1541, v ds
+# define BFI_FLINEAR0_1542_TICK(t)
+# define BFI_FLINEAR0_1541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1540, v ds
+# define BFI_FLINEAR0_1541_TICK(t)
+# define BFI_FLINEAR0_1540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1539, v ds
+# define BFI_FLINEAR0_1540_TICK(t)
+# define BFI_FLINEAR0_1539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1538, v ds
+# define BFI_FLINEAR0_1539_TICK(t)
+# define BFI_FLINEAR0_1538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1537, v ds
+# define BFI_FLINEAR0_1538_TICK(t)
+# define BFI_FLINEAR0_1537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1536, v ds
+# define BFI_FLINEAR0_1537_TICK(t)
+# define BFI_FLINEAR0_1536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1535, v ds
+# define BFI_FLINEAR0_1536_TICK(t)
+# define BFI_FLINEAR0_1535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1534, v ds
+# define BFI_FLINEAR0_1535_TICK(t)
+# define BFI_FLINEAR0_1534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1533, v ds
+# define BFI_FLINEAR0_1534_TICK(t)
+# define BFI_FLINEAR0_1533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1532, v ds
+# define BFI_FLINEAR0_1533_TICK(t)
+# define BFI_FLINEAR0_1532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1531, v ds
+# define BFI_FLINEAR0_1532_TICK(t)
+# define BFI_FLINEAR0_1531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1530, v ds
+# define BFI_FLINEAR0_1531_TICK(t)
+# define BFI_FLINEAR0_1530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1529, v ds
+# define BFI_FLINEAR0_1530_TICK(t)
+# define BFI_FLINEAR0_1529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1528, v ds
+# define BFI_FLINEAR0_1529_TICK(t)
+# define BFI_FLINEAR0_1528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1527, v ds
+# define BFI_FLINEAR0_1528_TICK(t)
+# define BFI_FLINEAR0_1527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1526, v ds
+# define BFI_FLINEAR0_1527_TICK(t)
+# define BFI_FLINEAR0_1526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1525, v ds
+# define BFI_FLINEAR0_1526_TICK(t)
+# define BFI_FLINEAR0_1525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1524, v ds
+# define BFI_FLINEAR0_1525_TICK(t)
+# define BFI_FLINEAR0_1524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1523, v ds
+# define BFI_FLINEAR0_1524_TICK(t)
+# define BFI_FLINEAR0_1523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1522, v ds
+# define BFI_FLINEAR0_1523_TICK(t)
+# define BFI_FLINEAR0_1522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1521, v ds
+# define BFI_FLINEAR0_1522_TICK(t)
+# define BFI_FLINEAR0_1521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1520, v ds
+# define BFI_FLINEAR0_1521_TICK(t)
+# define BFI_FLINEAR0_1520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1519, v ds
+# define BFI_FLINEAR0_1520_TICK(t)
+# define BFI_FLINEAR0_1519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1518, v ds
+# define BFI_FLINEAR0_1519_TICK(t)
+# define BFI_FLINEAR0_1518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1517, v ds
+# define BFI_FLINEAR0_1518_TICK(t)
+# define BFI_FLINEAR0_1517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1516, v ds
+# define BFI_FLINEAR0_1517_TICK(t)
+# define BFI_FLINEAR0_1516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1515, v ds
+# define BFI_FLINEAR0_1516_TICK(t)
+# define BFI_FLINEAR0_1515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1514, v ds
+# define BFI_FLINEAR0_1515_TICK(t)
+# define BFI_FLINEAR0_1514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1513, v ds
+# define BFI_FLINEAR0_1514_TICK(t)
+# define BFI_FLINEAR0_1513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1512, v ds
+# define BFI_FLINEAR0_1513_TICK(t)
+# define BFI_FLINEAR0_1512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1511, v ds
+# define BFI_FLINEAR0_1512_TICK(t)
+# define BFI_FLINEAR0_1511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1510, v ds
+# define BFI_FLINEAR0_1511_TICK(t)
+# define BFI_FLINEAR0_1510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1509, v ds
+# define BFI_FLINEAR0_1510_TICK(t)
+# define BFI_FLINEAR0_1509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1508, v ds
+# define BFI_FLINEAR0_1509_TICK(t)
+# define BFI_FLINEAR0_1508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1507, v ds
+# define BFI_FLINEAR0_1508_TICK(t)
+# define BFI_FLINEAR0_1507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1506, v ds
+# define BFI_FLINEAR0_1507_TICK(t)
+# define BFI_FLINEAR0_1506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1505, v ds
+# define BFI_FLINEAR0_1506_TICK(t)
+# define BFI_FLINEAR0_1505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1504, v ds
+# define BFI_FLINEAR0_1505_TICK(t)
+# define BFI_FLINEAR0_1504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1503, v ds
+# define BFI_FLINEAR0_1504_TICK(t)
+# define BFI_FLINEAR0_1503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1502, v ds
+# define BFI_FLINEAR0_1503_TICK(t)
+# define BFI_FLINEAR0_1502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1501, v ds
+# define BFI_FLINEAR0_1502_TICK(t)
+# define BFI_FLINEAR0_1501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1500, v ds
+# define BFI_FLINEAR0_1501_TICK(t)
+# define BFI_FLINEAR0_1500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1499, v ds
+# define BFI_FLINEAR0_1500_TICK(t)
+# define BFI_FLINEAR0_1499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1498, v ds
+# define BFI_FLINEAR0_1499_TICK(t)
+# define BFI_FLINEAR0_1498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1497, v ds
+# define BFI_FLINEAR0_1498_TICK(t)
+# define BFI_FLINEAR0_1497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1496, v ds
+# define BFI_FLINEAR0_1497_TICK(t)
+# define BFI_FLINEAR0_1496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1495, v ds
+# define BFI_FLINEAR0_1496_TICK(t)
+# define BFI_FLINEAR0_1495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1494, v ds
+# define BFI_FLINEAR0_1495_TICK(t)
+# define BFI_FLINEAR0_1494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1493, v ds
+# define BFI_FLINEAR0_1494_TICK(t)
+# define BFI_FLINEAR0_1493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1492, v ds
+# define BFI_FLINEAR0_1493_TICK(t)
+# define BFI_FLINEAR0_1492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1491, v ds
+# define BFI_FLINEAR0_1492_TICK(t)
+# define BFI_FLINEAR0_1491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1490, v ds
+# define BFI_FLINEAR0_1491_TICK(t)
+# define BFI_FLINEAR0_1490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1489, v ds
+# define BFI_FLINEAR0_1490_TICK(t)
+# define BFI_FLINEAR0_1489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1488, v ds
+# define BFI_FLINEAR0_1489_TICK(t)
+# define BFI_FLINEAR0_1488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1487, v ds
+# define BFI_FLINEAR0_1488_TICK(t)
+# define BFI_FLINEAR0_1487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1486, v ds
+# define BFI_FLINEAR0_1487_TICK(t)
+# define BFI_FLINEAR0_1486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1485, v ds
+# define BFI_FLINEAR0_1486_TICK(t)
+# define BFI_FLINEAR0_1485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1484, v ds
+# define BFI_FLINEAR0_1485_TICK(t)
+# define BFI_FLINEAR0_1484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1483, v ds
+# define BFI_FLINEAR0_1484_TICK(t)
+# define BFI_FLINEAR0_1483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1482, v ds
+# define BFI_FLINEAR0_1483_TICK(t)
+# define BFI_FLINEAR0_1482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1481, v ds
+# define BFI_FLINEAR0_1482_TICK(t)
+# define BFI_FLINEAR0_1481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1480, v ds
+# define BFI_FLINEAR0_1481_TICK(t)
+# define BFI_FLINEAR0_1480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1479, v ds
+# define BFI_FLINEAR0_1480_TICK(t)
+# define BFI_FLINEAR0_1479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1478, v ds
+# define BFI_FLINEAR0_1479_TICK(t)
+# define BFI_FLINEAR0_1478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1477, v ds
+# define BFI_FLINEAR0_1478_TICK(t)
+# define BFI_FLINEAR0_1477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1476, v ds
+# define BFI_FLINEAR0_1477_TICK(t)
+# define BFI_FLINEAR0_1476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1475, v ds
+# define BFI_FLINEAR0_1476_TICK(t)
+# define BFI_FLINEAR0_1475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1474, v ds
+# define BFI_FLINEAR0_1475_TICK(t)
+# define BFI_FLINEAR0_1474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1473, v ds
+# define BFI_FLINEAR0_1474_TICK(t)
+# define BFI_FLINEAR0_1473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1472, v ds
+# define BFI_FLINEAR0_1473_TICK(t)
+# define BFI_FLINEAR0_1472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1471, v ds
+# define BFI_FLINEAR0_1472_TICK(t)
+# define BFI_FLINEAR0_1471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1470, v ds
+# define BFI_FLINEAR0_1471_TICK(t)
+# define BFI_FLINEAR0_1470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1469, v ds
+# define BFI_FLINEAR0_1470_TICK(t)
+# define BFI_FLINEAR0_1469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1468, v ds
+# define BFI_FLINEAR0_1469_TICK(t)
+# define BFI_FLINEAR0_1468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1467, v ds
+# define BFI_FLINEAR0_1468_TICK(t)
+# define BFI_FLINEAR0_1467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1466, v ds
+# define BFI_FLINEAR0_1467_TICK(t)
+# define BFI_FLINEAR0_1466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1465, v ds
+# define BFI_FLINEAR0_1466_TICK(t)
+# define BFI_FLINEAR0_1465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1464, v ds
+# define BFI_FLINEAR0_1465_TICK(t)
+# define BFI_FLINEAR0_1464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1463, v ds
+# define BFI_FLINEAR0_1464_TICK(t)
+# define BFI_FLINEAR0_1463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1462, v ds
+# define BFI_FLINEAR0_1463_TICK(t)
+# define BFI_FLINEAR0_1462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1461, v ds
+# define BFI_FLINEAR0_1462_TICK(t)
+# define BFI_FLINEAR0_1461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1460, v ds
+# define BFI_FLINEAR0_1461_TICK(t)
+# define BFI_FLINEAR0_1460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1459, v ds
+# define BFI_FLINEAR0_1460_TICK(t)
+# define BFI_FLINEAR0_1459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1458, v ds
+# define BFI_FLINEAR0_1459_TICK(t)
+# define BFI_FLINEAR0_1458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1457, v ds
+# define BFI_FLINEAR0_1458_TICK(t)
+# define BFI_FLINEAR0_1457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1456, v ds
+# define BFI_FLINEAR0_1457_TICK(t)
+# define BFI_FLINEAR0_1456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1455, v ds
+# define BFI_FLINEAR0_1456_TICK(t)
+# define BFI_FLINEAR0_1455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1454, v ds
+# define BFI_FLINEAR0_1455_TICK(t)
+# define BFI_FLINEAR0_1454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1453, v ds
+# define BFI_FLINEAR0_1454_TICK(t)
+# define BFI_FLINEAR0_1453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1452, v ds
+# define BFI_FLINEAR0_1453_TICK(t)
+# define BFI_FLINEAR0_1452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1451, v ds
+# define BFI_FLINEAR0_1452_TICK(t)
+# define BFI_FLINEAR0_1451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1450, v ds
+# define BFI_FLINEAR0_1451_TICK(t)
+# define BFI_FLINEAR0_1450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1449, v ds
+# define BFI_FLINEAR0_1450_TICK(t)
+# define BFI_FLINEAR0_1449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1448, v ds
+# define BFI_FLINEAR0_1449_TICK(t)
+# define BFI_FLINEAR0_1448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1447, v ds
+# define BFI_FLINEAR0_1448_TICK(t)
+# define BFI_FLINEAR0_1447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1446, v ds
+# define BFI_FLINEAR0_1447_TICK(t)
+# define BFI_FLINEAR0_1446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1445, v ds
+# define BFI_FLINEAR0_1446_TICK(t)
+# define BFI_FLINEAR0_1445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1444, v ds
+# define BFI_FLINEAR0_1445_TICK(t)
+# define BFI_FLINEAR0_1444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1443, v ds
+# define BFI_FLINEAR0_1444_TICK(t)
+# define BFI_FLINEAR0_1443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1442, v ds
+# define BFI_FLINEAR0_1443_TICK(t)
+# define BFI_FLINEAR0_1442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1441, v ds
+# define BFI_FLINEAR0_1442_TICK(t)
+# define BFI_FLINEAR0_1441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1440, v ds
+# define BFI_FLINEAR0_1441_TICK(t)
+# define BFI_FLINEAR0_1440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1439, v ds
+# define BFI_FLINEAR0_1440_TICK(t)
+# define BFI_FLINEAR0_1439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1438, v ds
+# define BFI_FLINEAR0_1439_TICK(t)
+# define BFI_FLINEAR0_1438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1437, v ds
+# define BFI_FLINEAR0_1438_TICK(t)
+# define BFI_FLINEAR0_1437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1436, v ds
+# define BFI_FLINEAR0_1437_TICK(t)
+# define BFI_FLINEAR0_1436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1435, v ds
+# define BFI_FLINEAR0_1436_TICK(t)
+# define BFI_FLINEAR0_1435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1434, v ds
+# define BFI_FLINEAR0_1435_TICK(t)
+# define BFI_FLINEAR0_1434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1433, v ds
+# define BFI_FLINEAR0_1434_TICK(t)
+# define BFI_FLINEAR0_1433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1432, v ds
+# define BFI_FLINEAR0_1433_TICK(t)
+# define BFI_FLINEAR0_1432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1431, v ds
+# define BFI_FLINEAR0_1432_TICK(t)
+# define BFI_FLINEAR0_1431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1430, v ds
+# define BFI_FLINEAR0_1431_TICK(t)
+# define BFI_FLINEAR0_1430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1429, v ds
+# define BFI_FLINEAR0_1430_TICK(t)
+# define BFI_FLINEAR0_1429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1428, v ds
+# define BFI_FLINEAR0_1429_TICK(t)
+# define BFI_FLINEAR0_1428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1427, v ds
+# define BFI_FLINEAR0_1428_TICK(t)
+# define BFI_FLINEAR0_1427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1426, v ds
+# define BFI_FLINEAR0_1427_TICK(t)
+# define BFI_FLINEAR0_1426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1425, v ds
+# define BFI_FLINEAR0_1426_TICK(t)
+# define BFI_FLINEAR0_1425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1424, v ds
+# define BFI_FLINEAR0_1425_TICK(t)
+# define BFI_FLINEAR0_1424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1423, v ds
+# define BFI_FLINEAR0_1424_TICK(t)
+# define BFI_FLINEAR0_1423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1422, v ds
+# define BFI_FLINEAR0_1423_TICK(t)
+# define BFI_FLINEAR0_1422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1421, v ds
+# define BFI_FLINEAR0_1422_TICK(t)
+# define BFI_FLINEAR0_1421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1420, v ds
+# define BFI_FLINEAR0_1421_TICK(t)
+# define BFI_FLINEAR0_1420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1419, v ds
+# define BFI_FLINEAR0_1420_TICK(t)
+# define BFI_FLINEAR0_1419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1418, v ds
+# define BFI_FLINEAR0_1419_TICK(t)
+# define BFI_FLINEAR0_1418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1417, v ds
+# define BFI_FLINEAR0_1418_TICK(t)
+# define BFI_FLINEAR0_1417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1416, v ds
+# define BFI_FLINEAR0_1417_TICK(t)
+# define BFI_FLINEAR0_1416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1415, v ds
+# define BFI_FLINEAR0_1416_TICK(t)
+# define BFI_FLINEAR0_1415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1414, v ds
+# define BFI_FLINEAR0_1415_TICK(t)
+# define BFI_FLINEAR0_1414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1413, v ds
+# define BFI_FLINEAR0_1414_TICK(t)
+# define BFI_FLINEAR0_1413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1412, v ds
+# define BFI_FLINEAR0_1413_TICK(t)
+# define BFI_FLINEAR0_1412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1411, v ds
+# define BFI_FLINEAR0_1412_TICK(t)
+# define BFI_FLINEAR0_1411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1410, v ds
+# define BFI_FLINEAR0_1411_TICK(t)
+# define BFI_FLINEAR0_1410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1409, v ds
+# define BFI_FLINEAR0_1410_TICK(t)
+# define BFI_FLINEAR0_1409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1408, v ds
+# define BFI_FLINEAR0_1409_TICK(t)
+# define BFI_FLINEAR0_1408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1407, v ds
+# define BFI_FLINEAR0_1408_TICK(t)
+# define BFI_FLINEAR0_1407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1406, v ds
+# define BFI_FLINEAR0_1407_TICK(t)
+# define BFI_FLINEAR0_1406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1405, v ds
+# define BFI_FLINEAR0_1406_TICK(t)
+# define BFI_FLINEAR0_1405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1404, v ds
+# define BFI_FLINEAR0_1405_TICK(t)
+# define BFI_FLINEAR0_1404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1403, v ds
+# define BFI_FLINEAR0_1404_TICK(t)
+# define BFI_FLINEAR0_1403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1402, v ds
+# define BFI_FLINEAR0_1403_TICK(t)
+# define BFI_FLINEAR0_1402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1401, v ds
+# define BFI_FLINEAR0_1402_TICK(t)
+# define BFI_FLINEAR0_1401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1400, v ds
+# define BFI_FLINEAR0_1401_TICK(t)
+# define BFI_FLINEAR0_1400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1399, v ds
+# define BFI_FLINEAR0_1400_TICK(t)
+# define BFI_FLINEAR0_1399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1398, v ds
+# define BFI_FLINEAR0_1399_TICK(t)
+# define BFI_FLINEAR0_1398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1397, v ds
+# define BFI_FLINEAR0_1398_TICK(t)
+# define BFI_FLINEAR0_1397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1396, v ds
+# define BFI_FLINEAR0_1397_TICK(t)
+# define BFI_FLINEAR0_1396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1395, v ds
+# define BFI_FLINEAR0_1396_TICK(t)
+# define BFI_FLINEAR0_1395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1394, v ds
+# define BFI_FLINEAR0_1395_TICK(t)
+# define BFI_FLINEAR0_1394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1393, v ds
+# define BFI_FLINEAR0_1394_TICK(t)
+# define BFI_FLINEAR0_1393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1392, v ds
+# define BFI_FLINEAR0_1393_TICK(t)
+# define BFI_FLINEAR0_1392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1391, v ds
+# define BFI_FLINEAR0_1392_TICK(t)
+# define BFI_FLINEAR0_1391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1390, v ds
+# define BFI_FLINEAR0_1391_TICK(t)
+# define BFI_FLINEAR0_1390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1389, v ds
+# define BFI_FLINEAR0_1390_TICK(t)
+# define BFI_FLINEAR0_1389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1388, v ds
+# define BFI_FLINEAR0_1389_TICK(t)
+# define BFI_FLINEAR0_1388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1387, v ds
+# define BFI_FLINEAR0_1388_TICK(t)
+# define BFI_FLINEAR0_1387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1386, v ds
+# define BFI_FLINEAR0_1387_TICK(t)
+# define BFI_FLINEAR0_1386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1385, v ds
+# define BFI_FLINEAR0_1386_TICK(t)
+# define BFI_FLINEAR0_1385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1384, v ds
+# define BFI_FLINEAR0_1385_TICK(t)
+# define BFI_FLINEAR0_1384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1383, v ds
+# define BFI_FLINEAR0_1384_TICK(t)
+# define BFI_FLINEAR0_1383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1382, v ds
+# define BFI_FLINEAR0_1383_TICK(t)
+# define BFI_FLINEAR0_1382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1381, v ds
+# define BFI_FLINEAR0_1382_TICK(t)
+# define BFI_FLINEAR0_1381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1380, v ds
+# define BFI_FLINEAR0_1381_TICK(t)
+# define BFI_FLINEAR0_1380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1379, v ds
+# define BFI_FLINEAR0_1380_TICK(t)
+# define BFI_FLINEAR0_1379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1378, v ds
+# define BFI_FLINEAR0_1379_TICK(t)
+# define BFI_FLINEAR0_1378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1377, v ds
+# define BFI_FLINEAR0_1378_TICK(t)
+# define BFI_FLINEAR0_1377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1376, v ds
+# define BFI_FLINEAR0_1377_TICK(t)
+# define BFI_FLINEAR0_1376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1375, v ds
+# define BFI_FLINEAR0_1376_TICK(t)
+# define BFI_FLINEAR0_1375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1374, v ds
+# define BFI_FLINEAR0_1375_TICK(t)
+# define BFI_FLINEAR0_1374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1373, v ds
+# define BFI_FLINEAR0_1374_TICK(t)
+# define BFI_FLINEAR0_1373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1372, v ds
+# define BFI_FLINEAR0_1373_TICK(t)
+# define BFI_FLINEAR0_1372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1371, v ds
+# define BFI_FLINEAR0_1372_TICK(t)
+# define BFI_FLINEAR0_1371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1370, v ds
+# define BFI_FLINEAR0_1371_TICK(t)
+# define BFI_FLINEAR0_1370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1369, v ds
+# define BFI_FLINEAR0_1370_TICK(t)
+# define BFI_FLINEAR0_1369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1368, v ds
+# define BFI_FLINEAR0_1369_TICK(t)
+# define BFI_FLINEAR0_1368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1367, v ds
+# define BFI_FLINEAR0_1368_TICK(t)
+# define BFI_FLINEAR0_1367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1366, v ds
+# define BFI_FLINEAR0_1367_TICK(t)
+# define BFI_FLINEAR0_1366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1365, v ds
+# define BFI_FLINEAR0_1366_TICK(t)
+# define BFI_FLINEAR0_1365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1364, v ds
+# define BFI_FLINEAR0_1365_TICK(t)
+# define BFI_FLINEAR0_1364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1363, v ds
+# define BFI_FLINEAR0_1364_TICK(t)
+# define BFI_FLINEAR0_1363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1362, v ds
+# define BFI_FLINEAR0_1363_TICK(t)
+# define BFI_FLINEAR0_1362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1361, v ds
+# define BFI_FLINEAR0_1362_TICK(t)
+# define BFI_FLINEAR0_1361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1360, v ds
+# define BFI_FLINEAR0_1361_TICK(t)
+# define BFI_FLINEAR0_1360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1359, v ds
+# define BFI_FLINEAR0_1360_TICK(t)
+# define BFI_FLINEAR0_1359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1358, v ds
+# define BFI_FLINEAR0_1359_TICK(t)
+# define BFI_FLINEAR0_1358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1357, v ds
+# define BFI_FLINEAR0_1358_TICK(t)
+# define BFI_FLINEAR0_1357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1356, v ds
+# define BFI_FLINEAR0_1357_TICK(t)
+# define BFI_FLINEAR0_1356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1355, v ds
+# define BFI_FLINEAR0_1356_TICK(t)
+# define BFI_FLINEAR0_1355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1354, v ds
+# define BFI_FLINEAR0_1355_TICK(t)
+# define BFI_FLINEAR0_1354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1353, v ds
+# define BFI_FLINEAR0_1354_TICK(t)
+# define BFI_FLINEAR0_1353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1352, v ds
+# define BFI_FLINEAR0_1353_TICK(t)
+# define BFI_FLINEAR0_1352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1351, v ds
+# define BFI_FLINEAR0_1352_TICK(t)
+# define BFI_FLINEAR0_1351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1350, v ds
+# define BFI_FLINEAR0_1351_TICK(t)
+# define BFI_FLINEAR0_1350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1349, v ds
+# define BFI_FLINEAR0_1350_TICK(t)
+# define BFI_FLINEAR0_1349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1348, v ds
+# define BFI_FLINEAR0_1349_TICK(t)
+# define BFI_FLINEAR0_1348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1347, v ds
+# define BFI_FLINEAR0_1348_TICK(t)
+# define BFI_FLINEAR0_1347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1346, v ds
+# define BFI_FLINEAR0_1347_TICK(t)
+# define BFI_FLINEAR0_1346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1345, v ds
+# define BFI_FLINEAR0_1346_TICK(t)
+# define BFI_FLINEAR0_1345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1344, v ds
+# define BFI_FLINEAR0_1345_TICK(t)
+# define BFI_FLINEAR0_1344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1343, v ds
+# define BFI_FLINEAR0_1344_TICK(t)
+# define BFI_FLINEAR0_1343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1342, v ds
+# define BFI_FLINEAR0_1343_TICK(t)
+# define BFI_FLINEAR0_1342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1341, v ds
+# define BFI_FLINEAR0_1342_TICK(t)
+# define BFI_FLINEAR0_1341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1340, v ds
+# define BFI_FLINEAR0_1341_TICK(t)
+# define BFI_FLINEAR0_1340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1339, v ds
+# define BFI_FLINEAR0_1340_TICK(t)
+# define BFI_FLINEAR0_1339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1338, v ds
+# define BFI_FLINEAR0_1339_TICK(t)
+# define BFI_FLINEAR0_1338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1337, v ds
+# define BFI_FLINEAR0_1338_TICK(t)
+# define BFI_FLINEAR0_1337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1336, v ds
+# define BFI_FLINEAR0_1337_TICK(t)
+# define BFI_FLINEAR0_1336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1335, v ds
+# define BFI_FLINEAR0_1336_TICK(t)
+# define BFI_FLINEAR0_1335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1334, v ds
+# define BFI_FLINEAR0_1335_TICK(t)
+# define BFI_FLINEAR0_1334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1333, v ds
+# define BFI_FLINEAR0_1334_TICK(t)
+# define BFI_FLINEAR0_1333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1332, v ds
+# define BFI_FLINEAR0_1333_TICK(t)
+# define BFI_FLINEAR0_1332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1331, v ds
+# define BFI_FLINEAR0_1332_TICK(t)
+# define BFI_FLINEAR0_1331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1330, v ds
+# define BFI_FLINEAR0_1331_TICK(t)
+# define BFI_FLINEAR0_1330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1329, v ds
+# define BFI_FLINEAR0_1330_TICK(t)
+# define BFI_FLINEAR0_1329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1328, v ds
+# define BFI_FLINEAR0_1329_TICK(t)
+# define BFI_FLINEAR0_1328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1327, v ds
+# define BFI_FLINEAR0_1328_TICK(t)
+# define BFI_FLINEAR0_1327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1326, v ds
+# define BFI_FLINEAR0_1327_TICK(t)
+# define BFI_FLINEAR0_1326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1325, v ds
+# define BFI_FLINEAR0_1326_TICK(t)
+# define BFI_FLINEAR0_1325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1324, v ds
+# define BFI_FLINEAR0_1325_TICK(t)
+# define BFI_FLINEAR0_1324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1323, v ds
+# define BFI_FLINEAR0_1324_TICK(t)
+# define BFI_FLINEAR0_1323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1322, v ds
+# define BFI_FLINEAR0_1323_TICK(t)
+# define BFI_FLINEAR0_1322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1321, v ds
+# define BFI_FLINEAR0_1322_TICK(t)
+# define BFI_FLINEAR0_1321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1320, v ds
+# define BFI_FLINEAR0_1321_TICK(t)
+# define BFI_FLINEAR0_1320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1319, v ds
+# define BFI_FLINEAR0_1320_TICK(t)
+# define BFI_FLINEAR0_1319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1318, v ds
+# define BFI_FLINEAR0_1319_TICK(t)
+# define BFI_FLINEAR0_1318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1317, v ds
+# define BFI_FLINEAR0_1318_TICK(t)
+# define BFI_FLINEAR0_1317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1316, v ds
+# define BFI_FLINEAR0_1317_TICK(t)
+# define BFI_FLINEAR0_1316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1315, v ds
+# define BFI_FLINEAR0_1316_TICK(t)
+# define BFI_FLINEAR0_1315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1314, v ds
+# define BFI_FLINEAR0_1315_TICK(t)
+# define BFI_FLINEAR0_1314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1313, v ds
+# define BFI_FLINEAR0_1314_TICK(t)
+# define BFI_FLINEAR0_1313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1312, v ds
+# define BFI_FLINEAR0_1313_TICK(t)
+# define BFI_FLINEAR0_1312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1311, v ds
+# define BFI_FLINEAR0_1312_TICK(t)
+# define BFI_FLINEAR0_1311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1310, v ds
+# define BFI_FLINEAR0_1311_TICK(t)
+# define BFI_FLINEAR0_1310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1309, v ds
+# define BFI_FLINEAR0_1310_TICK(t)
+# define BFI_FLINEAR0_1309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1308, v ds
+# define BFI_FLINEAR0_1309_TICK(t)
+# define BFI_FLINEAR0_1308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1307, v ds
+# define BFI_FLINEAR0_1308_TICK(t)
+# define BFI_FLINEAR0_1307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1306, v ds
+# define BFI_FLINEAR0_1307_TICK(t)
+# define BFI_FLINEAR0_1306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1305, v ds
+# define BFI_FLINEAR0_1306_TICK(t)
+# define BFI_FLINEAR0_1305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1304, v ds
+# define BFI_FLINEAR0_1305_TICK(t)
+# define BFI_FLINEAR0_1304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1303, v ds
+# define BFI_FLINEAR0_1304_TICK(t)
+# define BFI_FLINEAR0_1303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1302, v ds
+# define BFI_FLINEAR0_1303_TICK(t)
+# define BFI_FLINEAR0_1302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1301, v ds
+# define BFI_FLINEAR0_1302_TICK(t)
+# define BFI_FLINEAR0_1301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1300, v ds
+# define BFI_FLINEAR0_1301_TICK(t)
+# define BFI_FLINEAR0_1300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1299, v ds
+# define BFI_FLINEAR0_1300_TICK(t)
+# define BFI_FLINEAR0_1299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1298, v ds
+# define BFI_FLINEAR0_1299_TICK(t)
+# define BFI_FLINEAR0_1298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1297, v ds
+# define BFI_FLINEAR0_1298_TICK(t)
+# define BFI_FLINEAR0_1297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1296, v ds
+# define BFI_FLINEAR0_1297_TICK(t)
+# define BFI_FLINEAR0_1296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1295, v ds
+# define BFI_FLINEAR0_1296_TICK(t)
+# define BFI_FLINEAR0_1295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1294, v ds
+# define BFI_FLINEAR0_1295_TICK(t)
+# define BFI_FLINEAR0_1294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1293, v ds
+# define BFI_FLINEAR0_1294_TICK(t)
+# define BFI_FLINEAR0_1293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1292, v ds
+# define BFI_FLINEAR0_1293_TICK(t)
+# define BFI_FLINEAR0_1292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1291, v ds
+# define BFI_FLINEAR0_1292_TICK(t)
+# define BFI_FLINEAR0_1291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1290, v ds
+# define BFI_FLINEAR0_1291_TICK(t)
+# define BFI_FLINEAR0_1290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1289, v ds
+# define BFI_FLINEAR0_1290_TICK(t)
+# define BFI_FLINEAR0_1289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1288, v ds
+# define BFI_FLINEAR0_1289_TICK(t)
+# define BFI_FLINEAR0_1288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1287, v ds
+# define BFI_FLINEAR0_1288_TICK(t)
+# define BFI_FLINEAR0_1287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1286, v ds
+# define BFI_FLINEAR0_1287_TICK(t)
+# define BFI_FLINEAR0_1286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1285, v ds
+# define BFI_FLINEAR0_1286_TICK(t)
+# define BFI_FLINEAR0_1285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1284, v ds
+# define BFI_FLINEAR0_1285_TICK(t)
+# define BFI_FLINEAR0_1284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1283, v ds
+# define BFI_FLINEAR0_1284_TICK(t)
+# define BFI_FLINEAR0_1283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1282, v ds
+# define BFI_FLINEAR0_1283_TICK(t)
+# define BFI_FLINEAR0_1282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1281, v ds
+# define BFI_FLINEAR0_1282_TICK(t)
+# define BFI_FLINEAR0_1281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1280, v ds
+# define BFI_FLINEAR0_1281_TICK(t)
+# define BFI_FLINEAR0_1280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1279, v ds
+# define BFI_FLINEAR0_1280_TICK(t)
+# define BFI_FLINEAR0_1279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1278, v ds
+# define BFI_FLINEAR0_1279_TICK(t)
+# define BFI_FLINEAR0_1278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1277, v ds
+# define BFI_FLINEAR0_1278_TICK(t)
+# define BFI_FLINEAR0_1277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1276, v ds
+# define BFI_FLINEAR0_1277_TICK(t)
+# define BFI_FLINEAR0_1276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1275, v ds
+# define BFI_FLINEAR0_1276_TICK(t)
+# define BFI_FLINEAR0_1275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1274, v ds
+# define BFI_FLINEAR0_1275_TICK(t)
+# define BFI_FLINEAR0_1274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1273, v ds
+# define BFI_FLINEAR0_1274_TICK(t)
+# define BFI_FLINEAR0_1273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1272, v ds
+# define BFI_FLINEAR0_1273_TICK(t)
+# define BFI_FLINEAR0_1272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1271, v ds
+# define BFI_FLINEAR0_1272_TICK(t)
+# define BFI_FLINEAR0_1271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1270, v ds
+# define BFI_FLINEAR0_1271_TICK(t)
+# define BFI_FLINEAR0_1270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1269, v ds
+# define BFI_FLINEAR0_1270_TICK(t)
+# define BFI_FLINEAR0_1269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1268, v ds
+# define BFI_FLINEAR0_1269_TICK(t)
+# define BFI_FLINEAR0_1268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1267, v ds
+# define BFI_FLINEAR0_1268_TICK(t)
+# define BFI_FLINEAR0_1267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1266, v ds
+# define BFI_FLINEAR0_1267_TICK(t)
+# define BFI_FLINEAR0_1266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1265, v ds
+# define BFI_FLINEAR0_1266_TICK(t)
+# define BFI_FLINEAR0_1265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1264, v ds
+# define BFI_FLINEAR0_1265_TICK(t)
+# define BFI_FLINEAR0_1264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1263, v ds
+# define BFI_FLINEAR0_1264_TICK(t)
+# define BFI_FLINEAR0_1263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1262, v ds
+# define BFI_FLINEAR0_1263_TICK(t)
+# define BFI_FLINEAR0_1262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1261, v ds
+# define BFI_FLINEAR0_1262_TICK(t)
+# define BFI_FLINEAR0_1261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1260, v ds
+# define BFI_FLINEAR0_1261_TICK(t)
+# define BFI_FLINEAR0_1260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1259, v ds
+# define BFI_FLINEAR0_1260_TICK(t)
+# define BFI_FLINEAR0_1259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1258, v ds
+# define BFI_FLINEAR0_1259_TICK(t)
+# define BFI_FLINEAR0_1258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1257, v ds
+# define BFI_FLINEAR0_1258_TICK(t)
+# define BFI_FLINEAR0_1257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1256, v ds
+# define BFI_FLINEAR0_1257_TICK(t)
+# define BFI_FLINEAR0_1256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1255, v ds
+# define BFI_FLINEAR0_1256_TICK(t)
+# define BFI_FLINEAR0_1255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1254, v ds
+# define BFI_FLINEAR0_1255_TICK(t)
+# define BFI_FLINEAR0_1254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1253, v ds
+# define BFI_FLINEAR0_1254_TICK(t)
+# define BFI_FLINEAR0_1253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1252, v ds
+# define BFI_FLINEAR0_1253_TICK(t)
+# define BFI_FLINEAR0_1252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1251, v ds
+# define BFI_FLINEAR0_1252_TICK(t)
+# define BFI_FLINEAR0_1251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1250, v ds
+# define BFI_FLINEAR0_1251_TICK(t)
+# define BFI_FLINEAR0_1250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1249, v ds
+# define BFI_FLINEAR0_1250_TICK(t)
+# define BFI_FLINEAR0_1249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1248, v ds
+# define BFI_FLINEAR0_1249_TICK(t)
+# define BFI_FLINEAR0_1248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1247, v ds
+# define BFI_FLINEAR0_1248_TICK(t)
+# define BFI_FLINEAR0_1247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1246, v ds
+# define BFI_FLINEAR0_1247_TICK(t)
+# define BFI_FLINEAR0_1246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1245, v ds
+# define BFI_FLINEAR0_1246_TICK(t)
+# define BFI_FLINEAR0_1245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1244, v ds
+# define BFI_FLINEAR0_1245_TICK(t)
+# define BFI_FLINEAR0_1244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1243, v ds
+# define BFI_FLINEAR0_1244_TICK(t)
+# define BFI_FLINEAR0_1243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1242, v ds
+# define BFI_FLINEAR0_1243_TICK(t)
+# define BFI_FLINEAR0_1242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1241, v ds
+# define BFI_FLINEAR0_1242_TICK(t)
+# define BFI_FLINEAR0_1241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1240, v ds
+# define BFI_FLINEAR0_1241_TICK(t)
+# define BFI_FLINEAR0_1240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1239, v ds
+# define BFI_FLINEAR0_1240_TICK(t)
+# define BFI_FLINEAR0_1239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1238, v ds
+# define BFI_FLINEAR0_1239_TICK(t)
+# define BFI_FLINEAR0_1238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1237, v ds
+# define BFI_FLINEAR0_1238_TICK(t)
+# define BFI_FLINEAR0_1237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1236, v ds
+# define BFI_FLINEAR0_1237_TICK(t)
+# define BFI_FLINEAR0_1236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1235, v ds
+# define BFI_FLINEAR0_1236_TICK(t)
+# define BFI_FLINEAR0_1235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1234, v ds
+# define BFI_FLINEAR0_1235_TICK(t)
+# define BFI_FLINEAR0_1234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1233, v ds
+# define BFI_FLINEAR0_1234_TICK(t)
+# define BFI_FLINEAR0_1233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1232, v ds
+# define BFI_FLINEAR0_1233_TICK(t)
+# define BFI_FLINEAR0_1232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1231, v ds
+# define BFI_FLINEAR0_1232_TICK(t)
+# define BFI_FLINEAR0_1231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1230, v ds
+# define BFI_FLINEAR0_1231_TICK(t)
+# define BFI_FLINEAR0_1230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1229, v ds
+# define BFI_FLINEAR0_1230_TICK(t)
+# define BFI_FLINEAR0_1229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1228, v ds
+# define BFI_FLINEAR0_1229_TICK(t)
+# define BFI_FLINEAR0_1228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1227, v ds
+# define BFI_FLINEAR0_1228_TICK(t)
+# define BFI_FLINEAR0_1227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1226, v ds
+# define BFI_FLINEAR0_1227_TICK(t)
+# define BFI_FLINEAR0_1226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1225, v ds
+# define BFI_FLINEAR0_1226_TICK(t)
+# define BFI_FLINEAR0_1225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1224, v ds
+# define BFI_FLINEAR0_1225_TICK(t)
+# define BFI_FLINEAR0_1224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1223, v ds
+# define BFI_FLINEAR0_1224_TICK(t)
+# define BFI_FLINEAR0_1223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1222, v ds
+# define BFI_FLINEAR0_1223_TICK(t)
+# define BFI_FLINEAR0_1222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1221, v ds
+# define BFI_FLINEAR0_1222_TICK(t)
+# define BFI_FLINEAR0_1221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1220, v ds
+# define BFI_FLINEAR0_1221_TICK(t)
+# define BFI_FLINEAR0_1220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1219, v ds
+# define BFI_FLINEAR0_1220_TICK(t)
+# define BFI_FLINEAR0_1219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1218, v ds
+# define BFI_FLINEAR0_1219_TICK(t)
+# define BFI_FLINEAR0_1218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1217, v ds
+# define BFI_FLINEAR0_1218_TICK(t)
+# define BFI_FLINEAR0_1217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1216, v ds
+# define BFI_FLINEAR0_1217_TICK(t)
+# define BFI_FLINEAR0_1216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1215, v ds
+# define BFI_FLINEAR0_1216_TICK(t)
+# define BFI_FLINEAR0_1215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1214, v ds
+# define BFI_FLINEAR0_1215_TICK(t)
+# define BFI_FLINEAR0_1214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1213, v ds
+# define BFI_FLINEAR0_1214_TICK(t)
+# define BFI_FLINEAR0_1213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1212, v ds
+# define BFI_FLINEAR0_1213_TICK(t)
+# define BFI_FLINEAR0_1212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1211, v ds
+# define BFI_FLINEAR0_1212_TICK(t)
+# define BFI_FLINEAR0_1211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1210, v ds
+# define BFI_FLINEAR0_1211_TICK(t)
+# define BFI_FLINEAR0_1210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1209, v ds
+# define BFI_FLINEAR0_1210_TICK(t)
+# define BFI_FLINEAR0_1209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1208, v ds
+# define BFI_FLINEAR0_1209_TICK(t)
+# define BFI_FLINEAR0_1208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1207, v ds
+# define BFI_FLINEAR0_1208_TICK(t)
+# define BFI_FLINEAR0_1207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1206, v ds
+# define BFI_FLINEAR0_1207_TICK(t)
+# define BFI_FLINEAR0_1206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1205, v ds
+# define BFI_FLINEAR0_1206_TICK(t)
+# define BFI_FLINEAR0_1205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1204, v ds
+# define BFI_FLINEAR0_1205_TICK(t)
+# define BFI_FLINEAR0_1204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1203, v ds
+# define BFI_FLINEAR0_1204_TICK(t)
+# define BFI_FLINEAR0_1203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1202, v ds
+# define BFI_FLINEAR0_1203_TICK(t)
+# define BFI_FLINEAR0_1202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1201, v ds
+# define BFI_FLINEAR0_1202_TICK(t)
+# define BFI_FLINEAR0_1201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1200, v ds
+# define BFI_FLINEAR0_1201_TICK(t)
+# define BFI_FLINEAR0_1200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1199, v ds
+# define BFI_FLINEAR0_1200_TICK(t)
+# define BFI_FLINEAR0_1199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1198, v ds
+# define BFI_FLINEAR0_1199_TICK(t)
+# define BFI_FLINEAR0_1198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1197, v ds
+# define BFI_FLINEAR0_1198_TICK(t)
+# define BFI_FLINEAR0_1197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1196, v ds
+# define BFI_FLINEAR0_1197_TICK(t)
+# define BFI_FLINEAR0_1196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1195, v ds
+# define BFI_FLINEAR0_1196_TICK(t)
+# define BFI_FLINEAR0_1195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1194, v ds
+# define BFI_FLINEAR0_1195_TICK(t)
+# define BFI_FLINEAR0_1194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1193, v ds
+# define BFI_FLINEAR0_1194_TICK(t)
+# define BFI_FLINEAR0_1193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1192, v ds
+# define BFI_FLINEAR0_1193_TICK(t)
+# define BFI_FLINEAR0_1192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1191, v ds
+# define BFI_FLINEAR0_1192_TICK(t)
+# define BFI_FLINEAR0_1191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1190, v ds
+# define BFI_FLINEAR0_1191_TICK(t)
+# define BFI_FLINEAR0_1190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1189, v ds
+# define BFI_FLINEAR0_1190_TICK(t)
+# define BFI_FLINEAR0_1189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1188, v ds
+# define BFI_FLINEAR0_1189_TICK(t)
+# define BFI_FLINEAR0_1188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1187, v ds
+# define BFI_FLINEAR0_1188_TICK(t)
+# define BFI_FLINEAR0_1187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1186, v ds
+# define BFI_FLINEAR0_1187_TICK(t)
+# define BFI_FLINEAR0_1186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1185, v ds
+# define BFI_FLINEAR0_1186_TICK(t)
+# define BFI_FLINEAR0_1185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1184, v ds
+# define BFI_FLINEAR0_1185_TICK(t)
+# define BFI_FLINEAR0_1184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1183, v ds
+# define BFI_FLINEAR0_1184_TICK(t)
+# define BFI_FLINEAR0_1183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1182, v ds
+# define BFI_FLINEAR0_1183_TICK(t)
+# define BFI_FLINEAR0_1182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1181, v ds
+# define BFI_FLINEAR0_1182_TICK(t)
+# define BFI_FLINEAR0_1181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1180, v ds
+# define BFI_FLINEAR0_1181_TICK(t)
+# define BFI_FLINEAR0_1180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1179, v ds
+# define BFI_FLINEAR0_1180_TICK(t)
+# define BFI_FLINEAR0_1179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1178, v ds
+# define BFI_FLINEAR0_1179_TICK(t)
+# define BFI_FLINEAR0_1178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1177, v ds
+# define BFI_FLINEAR0_1178_TICK(t)
+# define BFI_FLINEAR0_1177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1176, v ds
+# define BFI_FLINEAR0_1177_TICK(t)
+# define BFI_FLINEAR0_1176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1175, v ds
+# define BFI_FLINEAR0_1176_TICK(t)
+# define BFI_FLINEAR0_1175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1174, v ds
+# define BFI_FLINEAR0_1175_TICK(t)
+# define BFI_FLINEAR0_1174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1173, v ds
+# define BFI_FLINEAR0_1174_TICK(t)
+# define BFI_FLINEAR0_1173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1172, v ds
+# define BFI_FLINEAR0_1173_TICK(t)
+# define BFI_FLINEAR0_1172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1171, v ds
+# define BFI_FLINEAR0_1172_TICK(t)
+# define BFI_FLINEAR0_1171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1170, v ds
+# define BFI_FLINEAR0_1171_TICK(t)
+# define BFI_FLINEAR0_1170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1169, v ds
+# define BFI_FLINEAR0_1170_TICK(t)
+# define BFI_FLINEAR0_1169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1168, v ds
+# define BFI_FLINEAR0_1169_TICK(t)
+# define BFI_FLINEAR0_1168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1167, v ds
+# define BFI_FLINEAR0_1168_TICK(t)
+# define BFI_FLINEAR0_1167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1166, v ds
+# define BFI_FLINEAR0_1167_TICK(t)
+# define BFI_FLINEAR0_1166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1165, v ds
+# define BFI_FLINEAR0_1166_TICK(t)
+# define BFI_FLINEAR0_1165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1164, v ds
+# define BFI_FLINEAR0_1165_TICK(t)
+# define BFI_FLINEAR0_1164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1163, v ds
+# define BFI_FLINEAR0_1164_TICK(t)
+# define BFI_FLINEAR0_1163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1162, v ds
+# define BFI_FLINEAR0_1163_TICK(t)
+# define BFI_FLINEAR0_1162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1161, v ds
+# define BFI_FLINEAR0_1162_TICK(t)
+# define BFI_FLINEAR0_1161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1160, v ds
+# define BFI_FLINEAR0_1161_TICK(t)
+# define BFI_FLINEAR0_1160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1159, v ds
+# define BFI_FLINEAR0_1160_TICK(t)
+# define BFI_FLINEAR0_1159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1158, v ds
+# define BFI_FLINEAR0_1159_TICK(t)
+# define BFI_FLINEAR0_1158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1157, v ds
+# define BFI_FLINEAR0_1158_TICK(t)
+# define BFI_FLINEAR0_1157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1156, v ds
+# define BFI_FLINEAR0_1157_TICK(t)
+# define BFI_FLINEAR0_1156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1155, v ds
+# define BFI_FLINEAR0_1156_TICK(t)
+# define BFI_FLINEAR0_1155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1154, v ds
+# define BFI_FLINEAR0_1155_TICK(t)
+# define BFI_FLINEAR0_1154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1153, v ds
+# define BFI_FLINEAR0_1154_TICK(t)
+# define BFI_FLINEAR0_1153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1152, v ds
+# define BFI_FLINEAR0_1153_TICK(t)
+# define BFI_FLINEAR0_1152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1151, v ds
+# define BFI_FLINEAR0_1152_TICK(t)
+# define BFI_FLINEAR0_1151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1150, v ds
+# define BFI_FLINEAR0_1151_TICK(t)
+# define BFI_FLINEAR0_1150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1149, v ds
+# define BFI_FLINEAR0_1150_TICK(t)
+# define BFI_FLINEAR0_1149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1148, v ds
+# define BFI_FLINEAR0_1149_TICK(t)
+# define BFI_FLINEAR0_1148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1147, v ds
+# define BFI_FLINEAR0_1148_TICK(t)
+# define BFI_FLINEAR0_1147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1146, v ds
+# define BFI_FLINEAR0_1147_TICK(t)
+# define BFI_FLINEAR0_1146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1145, v ds
+# define BFI_FLINEAR0_1146_TICK(t)
+# define BFI_FLINEAR0_1145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1144, v ds
+# define BFI_FLINEAR0_1145_TICK(t)
+# define BFI_FLINEAR0_1144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1143, v ds
+# define BFI_FLINEAR0_1144_TICK(t)
+# define BFI_FLINEAR0_1143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1142, v ds
+# define BFI_FLINEAR0_1143_TICK(t)
+# define BFI_FLINEAR0_1142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1141, v ds
+# define BFI_FLINEAR0_1142_TICK(t)
+# define BFI_FLINEAR0_1141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1140, v ds
+# define BFI_FLINEAR0_1141_TICK(t)
+# define BFI_FLINEAR0_1140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1139, v ds
+# define BFI_FLINEAR0_1140_TICK(t)
+# define BFI_FLINEAR0_1139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1138, v ds
+# define BFI_FLINEAR0_1139_TICK(t)
+# define BFI_FLINEAR0_1138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1137, v ds
+# define BFI_FLINEAR0_1138_TICK(t)
+# define BFI_FLINEAR0_1137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1136, v ds
+# define BFI_FLINEAR0_1137_TICK(t)
+# define BFI_FLINEAR0_1136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1135, v ds
+# define BFI_FLINEAR0_1136_TICK(t)
+# define BFI_FLINEAR0_1135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1134, v ds
+# define BFI_FLINEAR0_1135_TICK(t)
+# define BFI_FLINEAR0_1134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1133, v ds
+# define BFI_FLINEAR0_1134_TICK(t)
+# define BFI_FLINEAR0_1133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1132, v ds
+# define BFI_FLINEAR0_1133_TICK(t)
+# define BFI_FLINEAR0_1132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1131, v ds
+# define BFI_FLINEAR0_1132_TICK(t)
+# define BFI_FLINEAR0_1131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1130, v ds
+# define BFI_FLINEAR0_1131_TICK(t)
+# define BFI_FLINEAR0_1130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1129, v ds
+# define BFI_FLINEAR0_1130_TICK(t)
+# define BFI_FLINEAR0_1129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1128, v ds
+# define BFI_FLINEAR0_1129_TICK(t)
+# define BFI_FLINEAR0_1128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1127, v ds
+# define BFI_FLINEAR0_1128_TICK(t)
+# define BFI_FLINEAR0_1127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1126, v ds
+# define BFI_FLINEAR0_1127_TICK(t)
+# define BFI_FLINEAR0_1126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1125, v ds
+# define BFI_FLINEAR0_1126_TICK(t)
+# define BFI_FLINEAR0_1125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1124, v ds
+# define BFI_FLINEAR0_1125_TICK(t)
+# define BFI_FLINEAR0_1124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1123, v ds
+# define BFI_FLINEAR0_1124_TICK(t)
+# define BFI_FLINEAR0_1123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1122, v ds
+# define BFI_FLINEAR0_1123_TICK(t)
+# define BFI_FLINEAR0_1122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1121, v ds
+# define BFI_FLINEAR0_1122_TICK(t)
+# define BFI_FLINEAR0_1121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1120, v ds
+# define BFI_FLINEAR0_1121_TICK(t)
+# define BFI_FLINEAR0_1120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1119, v ds
+# define BFI_FLINEAR0_1120_TICK(t)
+# define BFI_FLINEAR0_1119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1118, v ds
+# define BFI_FLINEAR0_1119_TICK(t)
+# define BFI_FLINEAR0_1118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1117, v ds
+# define BFI_FLINEAR0_1118_TICK(t)
+# define BFI_FLINEAR0_1117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1116, v ds
+# define BFI_FLINEAR0_1117_TICK(t)
+# define BFI_FLINEAR0_1116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1115, v ds
+# define BFI_FLINEAR0_1116_TICK(t)
+# define BFI_FLINEAR0_1115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1114, v ds
+# define BFI_FLINEAR0_1115_TICK(t)
+# define BFI_FLINEAR0_1114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1113, v ds
+# define BFI_FLINEAR0_1114_TICK(t)
+# define BFI_FLINEAR0_1113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1112, v ds
+# define BFI_FLINEAR0_1113_TICK(t)
+# define BFI_FLINEAR0_1112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1111, v ds
+# define BFI_FLINEAR0_1112_TICK(t)
+# define BFI_FLINEAR0_1111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1110, v ds
+# define BFI_FLINEAR0_1111_TICK(t)
+# define BFI_FLINEAR0_1110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1109, v ds
+# define BFI_FLINEAR0_1110_TICK(t)
+# define BFI_FLINEAR0_1109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1108, v ds
+# define BFI_FLINEAR0_1109_TICK(t)
+# define BFI_FLINEAR0_1108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1107, v ds
+# define BFI_FLINEAR0_1108_TICK(t)
+# define BFI_FLINEAR0_1107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1106, v ds
+# define BFI_FLINEAR0_1107_TICK(t)
+# define BFI_FLINEAR0_1106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1105, v ds
+# define BFI_FLINEAR0_1106_TICK(t)
+# define BFI_FLINEAR0_1105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1104, v ds
+# define BFI_FLINEAR0_1105_TICK(t)
+# define BFI_FLINEAR0_1104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1103, v ds
+# define BFI_FLINEAR0_1104_TICK(t)
+# define BFI_FLINEAR0_1103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1102, v ds
+# define BFI_FLINEAR0_1103_TICK(t)
+# define BFI_FLINEAR0_1102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1101, v ds
+# define BFI_FLINEAR0_1102_TICK(t)
+# define BFI_FLINEAR0_1101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1100, v ds
+# define BFI_FLINEAR0_1101_TICK(t)
+# define BFI_FLINEAR0_1100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1099, v ds
+# define BFI_FLINEAR0_1100_TICK(t)
+# define BFI_FLINEAR0_1099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1098, v ds
+# define BFI_FLINEAR0_1099_TICK(t)
+# define BFI_FLINEAR0_1098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1097, v ds
+# define BFI_FLINEAR0_1098_TICK(t)
+# define BFI_FLINEAR0_1097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1096, v ds
+# define BFI_FLINEAR0_1097_TICK(t)
+# define BFI_FLINEAR0_1096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1095, v ds
+# define BFI_FLINEAR0_1096_TICK(t)
+# define BFI_FLINEAR0_1095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1094, v ds
+# define BFI_FLINEAR0_1095_TICK(t)
+# define BFI_FLINEAR0_1094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1093, v ds
+# define BFI_FLINEAR0_1094_TICK(t)
+# define BFI_FLINEAR0_1093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1092, v ds
+# define BFI_FLINEAR0_1093_TICK(t)
+# define BFI_FLINEAR0_1092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1091, v ds
+# define BFI_FLINEAR0_1092_TICK(t)
+# define BFI_FLINEAR0_1091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1090, v ds
+# define BFI_FLINEAR0_1091_TICK(t)
+# define BFI_FLINEAR0_1090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1089, v ds
+# define BFI_FLINEAR0_1090_TICK(t)
+# define BFI_FLINEAR0_1089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1088, v ds
+# define BFI_FLINEAR0_1089_TICK(t)
+# define BFI_FLINEAR0_1088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1087, v ds
+# define BFI_FLINEAR0_1088_TICK(t)
+# define BFI_FLINEAR0_1087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1086, v ds
+# define BFI_FLINEAR0_1087_TICK(t)
+# define BFI_FLINEAR0_1086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1085, v ds
+# define BFI_FLINEAR0_1086_TICK(t)
+# define BFI_FLINEAR0_1085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1084, v ds
+# define BFI_FLINEAR0_1085_TICK(t)
+# define BFI_FLINEAR0_1084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1083, v ds
+# define BFI_FLINEAR0_1084_TICK(t)
+# define BFI_FLINEAR0_1083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1082, v ds
+# define BFI_FLINEAR0_1083_TICK(t)
+# define BFI_FLINEAR0_1082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1081, v ds
+# define BFI_FLINEAR0_1082_TICK(t)
+# define BFI_FLINEAR0_1081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1080, v ds
+# define BFI_FLINEAR0_1081_TICK(t)
+# define BFI_FLINEAR0_1080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1079, v ds
+# define BFI_FLINEAR0_1080_TICK(t)
+# define BFI_FLINEAR0_1079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1078, v ds
+# define BFI_FLINEAR0_1079_TICK(t)
+# define BFI_FLINEAR0_1078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1077, v ds
+# define BFI_FLINEAR0_1078_TICK(t)
+# define BFI_FLINEAR0_1077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1076, v ds
+# define BFI_FLINEAR0_1077_TICK(t)
+# define BFI_FLINEAR0_1076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1075, v ds
+# define BFI_FLINEAR0_1076_TICK(t)
+# define BFI_FLINEAR0_1075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1074, v ds
+# define BFI_FLINEAR0_1075_TICK(t)
+# define BFI_FLINEAR0_1074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1073, v ds
+# define BFI_FLINEAR0_1074_TICK(t)
+# define BFI_FLINEAR0_1073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1072, v ds
+# define BFI_FLINEAR0_1073_TICK(t)
+# define BFI_FLINEAR0_1072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1071, v ds
+# define BFI_FLINEAR0_1072_TICK(t)
+# define BFI_FLINEAR0_1071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1070, v ds
+# define BFI_FLINEAR0_1071_TICK(t)
+# define BFI_FLINEAR0_1070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1069, v ds
+# define BFI_FLINEAR0_1070_TICK(t)
+# define BFI_FLINEAR0_1069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1068, v ds
+# define BFI_FLINEAR0_1069_TICK(t)
+# define BFI_FLINEAR0_1068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1067, v ds
+# define BFI_FLINEAR0_1068_TICK(t)
+# define BFI_FLINEAR0_1067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1066, v ds
+# define BFI_FLINEAR0_1067_TICK(t)
+# define BFI_FLINEAR0_1066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1065, v ds
+# define BFI_FLINEAR0_1066_TICK(t)
+# define BFI_FLINEAR0_1065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1064, v ds
+# define BFI_FLINEAR0_1065_TICK(t)
+# define BFI_FLINEAR0_1064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1063, v ds
+# define BFI_FLINEAR0_1064_TICK(t)
+# define BFI_FLINEAR0_1063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1062, v ds
+# define BFI_FLINEAR0_1063_TICK(t)
+# define BFI_FLINEAR0_1062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1061, v ds
+# define BFI_FLINEAR0_1062_TICK(t)
+# define BFI_FLINEAR0_1061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1060, v ds
+# define BFI_FLINEAR0_1061_TICK(t)
+# define BFI_FLINEAR0_1060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1059, v ds
+# define BFI_FLINEAR0_1060_TICK(t)
+# define BFI_FLINEAR0_1059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1058, v ds
+# define BFI_FLINEAR0_1059_TICK(t)
+# define BFI_FLINEAR0_1058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1057, v ds
+# define BFI_FLINEAR0_1058_TICK(t)
+# define BFI_FLINEAR0_1057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1056, v ds
+# define BFI_FLINEAR0_1057_TICK(t)
+# define BFI_FLINEAR0_1056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1055, v ds
+# define BFI_FLINEAR0_1056_TICK(t)
+# define BFI_FLINEAR0_1055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1054, v ds
+# define BFI_FLINEAR0_1055_TICK(t)
+# define BFI_FLINEAR0_1054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1053, v ds
+# define BFI_FLINEAR0_1054_TICK(t)
+# define BFI_FLINEAR0_1053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1052, v ds
+# define BFI_FLINEAR0_1053_TICK(t)
+# define BFI_FLINEAR0_1052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1051, v ds
+# define BFI_FLINEAR0_1052_TICK(t)
+# define BFI_FLINEAR0_1051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1050, v ds
+# define BFI_FLINEAR0_1051_TICK(t)
+# define BFI_FLINEAR0_1050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1049, v ds
+# define BFI_FLINEAR0_1050_TICK(t)
+# define BFI_FLINEAR0_1049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1048, v ds
+# define BFI_FLINEAR0_1049_TICK(t)
+# define BFI_FLINEAR0_1048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1047, v ds
+# define BFI_FLINEAR0_1048_TICK(t)
+# define BFI_FLINEAR0_1047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1046, v ds
+# define BFI_FLINEAR0_1047_TICK(t)
+# define BFI_FLINEAR0_1046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1045, v ds
+# define BFI_FLINEAR0_1046_TICK(t)
+# define BFI_FLINEAR0_1045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1044, v ds
+# define BFI_FLINEAR0_1045_TICK(t)
+# define BFI_FLINEAR0_1044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1043, v ds
+# define BFI_FLINEAR0_1044_TICK(t)
+# define BFI_FLINEAR0_1043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1042, v ds
+# define BFI_FLINEAR0_1043_TICK(t)
+# define BFI_FLINEAR0_1042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1041, v ds
+# define BFI_FLINEAR0_1042_TICK(t)
+# define BFI_FLINEAR0_1041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1040, v ds
+# define BFI_FLINEAR0_1041_TICK(t)
+# define BFI_FLINEAR0_1040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1039, v ds
+# define BFI_FLINEAR0_1040_TICK(t)
+# define BFI_FLINEAR0_1039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1038, v ds
+# define BFI_FLINEAR0_1039_TICK(t)
+# define BFI_FLINEAR0_1038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1037, v ds
+# define BFI_FLINEAR0_1038_TICK(t)
+# define BFI_FLINEAR0_1037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1036, v ds
+# define BFI_FLINEAR0_1037_TICK(t)
+# define BFI_FLINEAR0_1036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1035, v ds
+# define BFI_FLINEAR0_1036_TICK(t)
+# define BFI_FLINEAR0_1035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1034, v ds
+# define BFI_FLINEAR0_1035_TICK(t)
+# define BFI_FLINEAR0_1034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1033, v ds
+# define BFI_FLINEAR0_1034_TICK(t)
+# define BFI_FLINEAR0_1033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1032, v ds
+# define BFI_FLINEAR0_1033_TICK(t)
+# define BFI_FLINEAR0_1032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1031, v ds
+# define BFI_FLINEAR0_1032_TICK(t)
+# define BFI_FLINEAR0_1031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1030, v ds
+# define BFI_FLINEAR0_1031_TICK(t)
+# define BFI_FLINEAR0_1030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1029, v ds
+# define BFI_FLINEAR0_1030_TICK(t)
+# define BFI_FLINEAR0_1029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1028, v ds
+# define BFI_FLINEAR0_1029_TICK(t)
+# define BFI_FLINEAR0_1028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1027, v ds
+# define BFI_FLINEAR0_1028_TICK(t)
+# define BFI_FLINEAR0_1027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1026, v ds
+# define BFI_FLINEAR0_1027_TICK(t)
+# define BFI_FLINEAR0_1026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1025, v ds
+# define BFI_FLINEAR0_1026_TICK(t)
+# define BFI_FLINEAR0_1025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1024, v ds
+# define BFI_FLINEAR0_1025_TICK(t)
+
+# endif
@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_0_64_H
+# define BFI_LINEAR_0_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR0_64(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_63, v ds
+# define BFI_FLINEAR0_64_TICK(t)
+# define BFI_FLINEAR0_63(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_62, v ds
+# define BFI_FLINEAR0_63_TICK(t)
+# define BFI_FLINEAR0_62(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_61, v ds
+# define BFI_FLINEAR0_62_TICK(t)
+# define BFI_FLINEAR0_61(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_60, v ds
+# define BFI_FLINEAR0_61_TICK(t)
+# define BFI_FLINEAR0_60(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_59, v ds
+# define BFI_FLINEAR0_60_TICK(t)
+# define BFI_FLINEAR0_59(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_58, v ds
+# define BFI_FLINEAR0_59_TICK(t)
+# define BFI_FLINEAR0_58(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_57, v ds
+# define BFI_FLINEAR0_58_TICK(t)
+# define BFI_FLINEAR0_57(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_56, v ds
+# define BFI_FLINEAR0_57_TICK(t)
+# define BFI_FLINEAR0_56(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_55, v ds
+# define BFI_FLINEAR0_56_TICK(t)
+# define BFI_FLINEAR0_55(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_54, v ds
+# define BFI_FLINEAR0_55_TICK(t)
+# define BFI_FLINEAR0_54(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_53, v ds
+# define BFI_FLINEAR0_54_TICK(t)
+# define BFI_FLINEAR0_53(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_52, v ds
+# define BFI_FLINEAR0_53_TICK(t)
+# define BFI_FLINEAR0_52(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_51, v ds
+# define BFI_FLINEAR0_52_TICK(t)
+# define BFI_FLINEAR0_51(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_50, v ds
+# define BFI_FLINEAR0_51_TICK(t)
+# define BFI_FLINEAR0_50(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_49, v ds
+# define BFI_FLINEAR0_50_TICK(t)
+# define BFI_FLINEAR0_49(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_48, v ds
+# define BFI_FLINEAR0_49_TICK(t)
+# define BFI_FLINEAR0_48(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_47, v ds
+# define BFI_FLINEAR0_48_TICK(t)
+# define BFI_FLINEAR0_47(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_46, v ds
+# define BFI_FLINEAR0_47_TICK(t)
+# define BFI_FLINEAR0_46(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_45, v ds
+# define BFI_FLINEAR0_46_TICK(t)
+# define BFI_FLINEAR0_45(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_44, v ds
+# define BFI_FLINEAR0_45_TICK(t)
+# define BFI_FLINEAR0_44(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_43, v ds
+# define BFI_FLINEAR0_44_TICK(t)
+# define BFI_FLINEAR0_43(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_42, v ds
+# define BFI_FLINEAR0_43_TICK(t)
+# define BFI_FLINEAR0_42(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_41, v ds
+# define BFI_FLINEAR0_42_TICK(t)
+# define BFI_FLINEAR0_41(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_40, v ds
+# define BFI_FLINEAR0_41_TICK(t)
+# define BFI_FLINEAR0_40(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_39, v ds
+# define BFI_FLINEAR0_40_TICK(t)
+# define BFI_FLINEAR0_39(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_38, v ds
+# define BFI_FLINEAR0_39_TICK(t)
+# define BFI_FLINEAR0_38(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_37, v ds
+# define BFI_FLINEAR0_38_TICK(t)
+# define BFI_FLINEAR0_37(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_36, v ds
+# define BFI_FLINEAR0_37_TICK(t)
+# define BFI_FLINEAR0_36(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_35, v ds
+# define BFI_FLINEAR0_36_TICK(t)
+# define BFI_FLINEAR0_35(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_34, v ds
+# define BFI_FLINEAR0_35_TICK(t)
+# define BFI_FLINEAR0_34(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_33, v ds
+# define BFI_FLINEAR0_34_TICK(t)
+# define BFI_FLINEAR0_33(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_32, v ds
+# define BFI_FLINEAR0_33_TICK(t)
+# define BFI_FLINEAR0_32(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_31, v ds
+# define BFI_FLINEAR0_32_TICK(t)
+# define BFI_FLINEAR0_31(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_30, v ds
+# define BFI_FLINEAR0_31_TICK(t)
+# define BFI_FLINEAR0_30(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_29, v ds
+# define BFI_FLINEAR0_30_TICK(t)
+# define BFI_FLINEAR0_29(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_28, v ds
+# define BFI_FLINEAR0_29_TICK(t)
+# define BFI_FLINEAR0_28(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_27, v ds
+# define BFI_FLINEAR0_28_TICK(t)
+# define BFI_FLINEAR0_27(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_26, v ds
+# define BFI_FLINEAR0_27_TICK(t)
+# define BFI_FLINEAR0_26(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_25, v ds
+# define BFI_FLINEAR0_26_TICK(t)
+# define BFI_FLINEAR0_25(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_24, v ds
+# define BFI_FLINEAR0_25_TICK(t)
+# define BFI_FLINEAR0_24(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_23, v ds
+# define BFI_FLINEAR0_24_TICK(t)
+# define BFI_FLINEAR0_23(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_22, v ds
+# define BFI_FLINEAR0_23_TICK(t)
+# define BFI_FLINEAR0_22(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_21, v ds
+# define BFI_FLINEAR0_22_TICK(t)
+# define BFI_FLINEAR0_21(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_20, v ds
+# define BFI_FLINEAR0_21_TICK(t)
+# define BFI_FLINEAR0_20(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_19, v ds
+# define BFI_FLINEAR0_20_TICK(t)
+# define BFI_FLINEAR0_19(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_18, v ds
+# define BFI_FLINEAR0_19_TICK(t)
+# define BFI_FLINEAR0_18(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_17, v ds
+# define BFI_FLINEAR0_18_TICK(t)
+# define BFI_FLINEAR0_17(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_16, v ds
+# define BFI_FLINEAR0_17_TICK(t)
+# define BFI_FLINEAR0_16(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_15, v ds
+# define BFI_FLINEAR0_16_TICK(t)
+# define BFI_FLINEAR0_15(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_14, v ds
+# define BFI_FLINEAR0_15_TICK(t)
+# define BFI_FLINEAR0_14(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_13, v ds
+# define BFI_FLINEAR0_14_TICK(t)
+# define BFI_FLINEAR0_13(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_12, v ds
+# define BFI_FLINEAR0_13_TICK(t)
+# define BFI_FLINEAR0_12(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_11, v ds
+# define BFI_FLINEAR0_12_TICK(t)
+# define BFI_FLINEAR0_11(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_10, v ds
+# define BFI_FLINEAR0_11_TICK(t)
+# define BFI_FLINEAR0_10(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_9, v ds
+# define BFI_FLINEAR0_10_TICK(t)
+# define BFI_FLINEAR0_9(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_8, v ds
+# define BFI_FLINEAR0_9_TICK(t)
+# define BFI_FLINEAR0_8(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_7, v ds
+# define BFI_FLINEAR0_8_TICK(t)
+# define BFI_FLINEAR0_7(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_6, v ds
+# define BFI_FLINEAR0_7_TICK(t)
+# define BFI_FLINEAR0_6(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_5, v ds
+# define BFI_FLINEAR0_6_TICK(t)
+# define BFI_FLINEAR0_5(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_4, v ds
+# define BFI_FLINEAR0_5_TICK(t)
+# define BFI_FLINEAR0_4(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_3, v ds
+# define BFI_FLINEAR0_4_TICK(t)
+# define BFI_FLINEAR0_3(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_2, v ds
+# define BFI_FLINEAR0_3_TICK(t)
+# define BFI_FLINEAR0_2(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_1, v ds
+# define BFI_FLINEAR0_2_TICK(t)
+# define BFI_FLINEAR0_1(v, f, ds) BFI_FINST_##f(BFI_FLINEAR0_0, v ds
+# define BFI_FLINEAR0_1_TICK(t)
+
+# endif
@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_1_1024_H
+# define BFI_LINEAR_1_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR1_1024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1023, v ds
+# define BFI_FLINEAR1_1024_TICK(t)
+# define BFI_FLINEAR1_1023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1022, v ds
+# define BFI_FLINEAR1_1023_TICK(t)
+# define BFI_FLINEAR1_1022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1021, v ds
+# define BFI_FLINEAR1_1022_TICK(t)
+# define BFI_FLINEAR1_1021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1020, v ds
+# define BFI_FLINEAR1_1021_TICK(t)
+# define BFI_FLINEAR1_1020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1019, v ds
+# define BFI_FLINEAR1_1020_TICK(t)
+# define BFI_FLINEAR1_1019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1018, v ds
+# define BFI_FLINEAR1_1019_TICK(t)
+# define BFI_FLINEAR1_1018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1017, v ds
+# define BFI_FLINEAR1_1018_TICK(t)
+# define BFI_FLINEAR1_1017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1016, v ds
+# define BFI_FLINEAR1_1017_TICK(t)
+# define BFI_FLINEAR1_1016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1015, v ds
+# define BFI_FLINEAR1_1016_TICK(t)
+# define BFI_FLINEAR1_1015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1014, v ds
+# define BFI_FLINEAR1_1015_TICK(t)
+# define BFI_FLINEAR1_1014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1013, v ds
+# define BFI_FLINEAR1_1014_TICK(t)
+# define BFI_FLINEAR1_1013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1012, v ds
+# define BFI_FLINEAR1_1013_TICK(t)
+# define BFI_FLINEAR1_1012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1011, v ds
+# define BFI_FLINEAR1_1012_TICK(t)
+# define BFI_FLINEAR1_1011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1010, v ds
+# define BFI_FLINEAR1_1011_TICK(t)
+# define BFI_FLINEAR1_1010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1009, v ds
+# define BFI_FLINEAR1_1010_TICK(t)
+# define BFI_FLINEAR1_1009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1008, v ds
+# define BFI_FLINEAR1_1009_TICK(t)
+# define BFI_FLINEAR1_1008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1007, v ds
+# define BFI_FLINEAR1_1008_TICK(t)
+# define BFI_FLINEAR1_1007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1006, v ds
+# define BFI_FLINEAR1_1007_TICK(t)
+# define BFI_FLINEAR1_1006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1005, v ds
+# define BFI_FLINEAR1_1006_TICK(t)
+# define BFI_FLINEAR1_1005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1004, v ds
+# define BFI_FLINEAR1_1005_TICK(t)
+# define BFI_FLINEAR1_1004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1003, v ds
+# define BFI_FLINEAR1_1004_TICK(t)
+# define BFI_FLINEAR1_1003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1002, v ds
+# define BFI_FLINEAR1_1003_TICK(t)
+# define BFI_FLINEAR1_1002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1001, v ds
+# define BFI_FLINEAR1_1002_TICK(t)
+# define BFI_FLINEAR1_1001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1000, v ds
+# define BFI_FLINEAR1_1001_TICK(t)
+# define BFI_FLINEAR1_1000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_999, v ds
+# define BFI_FLINEAR1_1000_TICK(t)
+# define BFI_FLINEAR1_999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_998, v ds
+# define BFI_FLINEAR1_999_TICK(t)
+# define BFI_FLINEAR1_998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_997, v ds
+# define BFI_FLINEAR1_998_TICK(t)
+# define BFI_FLINEAR1_997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_996, v ds
+# define BFI_FLINEAR1_997_TICK(t)
+# define BFI_FLINEAR1_996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_995, v ds
+# define BFI_FLINEAR1_996_TICK(t)
+# define BFI_FLINEAR1_995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_994, v ds
+# define BFI_FLINEAR1_995_TICK(t)
+# define BFI_FLINEAR1_994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_993, v ds
+# define BFI_FLINEAR1_994_TICK(t)
+# define BFI_FLINEAR1_993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_992, v ds
+# define BFI_FLINEAR1_993_TICK(t)
+# define BFI_FLINEAR1_992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_991, v ds
+# define BFI_FLINEAR1_992_TICK(t)
+# define BFI_FLINEAR1_991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_990, v ds
+# define BFI_FLINEAR1_991_TICK(t)
+# define BFI_FLINEAR1_990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_989, v ds
+# define BFI_FLINEAR1_990_TICK(t)
+# define BFI_FLINEAR1_989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_988, v ds
+# define BFI_FLINEAR1_989_TICK(t)
+# define BFI_FLINEAR1_988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_987, v ds
+# define BFI_FLINEAR1_988_TICK(t)
+# define BFI_FLINEAR1_987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_986, v ds
+# define BFI_FLINEAR1_987_TICK(t)
+# define BFI_FLINEAR1_986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_985, v ds
+# define BFI_FLINEAR1_986_TICK(t)
+# define BFI_FLINEAR1_985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_984, v ds
+# define BFI_FLINEAR1_985_TICK(t)
+# define BFI_FLINEAR1_984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_983, v ds
+# define BFI_FLINEAR1_984_TICK(t)
+# define BFI_FLINEAR1_983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_982, v ds
+# define BFI_FLINEAR1_983_TICK(t)
+# define BFI_FLINEAR1_982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_981, v ds
+# define BFI_FLINEAR1_982_TICK(t)
+# define BFI_FLINEAR1_981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_980, v ds
+# define BFI_FLINEAR1_981_TICK(t)
+# define BFI_FLINEAR1_980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_979, v ds
+# define BFI_FLINEAR1_980_TICK(t)
+# define BFI_FLINEAR1_979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_978, v ds
+# define BFI_FLINEAR1_979_TICK(t)
+# define BFI_FLINEAR1_978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_977, v ds
+# define BFI_FLINEAR1_978_TICK(t)
+# define BFI_FLINEAR1_977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_976, v ds
+# define BFI_FLINEAR1_977_TICK(t)
+# define BFI_FLINEAR1_976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_975, v ds
+# define BFI_FLINEAR1_976_TICK(t)
+# define BFI_FLINEAR1_975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_974, v ds
+# define BFI_FLINEAR1_975_TICK(t)
+# define BFI_FLINEAR1_974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_973, v ds
+# define BFI_FLINEAR1_974_TICK(t)
+# define BFI_FLINEAR1_973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_972, v ds
+# define BFI_FLINEAR1_973_TICK(t)
+# define BFI_FLINEAR1_972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_971, v ds
+# define BFI_FLINEAR1_972_TICK(t)
+# define BFI_FLINEAR1_971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_970, v ds
+# define BFI_FLINEAR1_971_TICK(t)
+# define BFI_FLINEAR1_970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_969, v ds
+# define BFI_FLINEAR1_970_TICK(t)
+# define BFI_FLINEAR1_969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_968, v ds
+# define BFI_FLINEAR1_969_TICK(t)
+# define BFI_FLINEAR1_968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_967, v ds
+# define BFI_FLINEAR1_968_TICK(t)
+# define BFI_FLINEAR1_967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_966, v ds
+# define BFI_FLINEAR1_967_TICK(t)
+# define BFI_FLINEAR1_966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_965, v ds
+# define BFI_FLINEAR1_966_TICK(t)
+# define BFI_FLINEAR1_965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_964, v ds
+# define BFI_FLINEAR1_965_TICK(t)
+# define BFI_FLINEAR1_964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_963, v ds
+# define BFI_FLINEAR1_964_TICK(t)
+# define BFI_FLINEAR1_963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_962, v ds
+# define BFI_FLINEAR1_963_TICK(t)
+# define BFI_FLINEAR1_962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_961, v ds
+# define BFI_FLINEAR1_962_TICK(t)
+# define BFI_FLINEAR1_961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_960, v ds
+# define BFI_FLINEAR1_961_TICK(t)
+# define BFI_FLINEAR1_960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_959, v ds
+# define BFI_FLINEAR1_960_TICK(t)
+# define BFI_FLINEAR1_959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_958, v ds
+# define BFI_FLINEAR1_959_TICK(t)
+# define BFI_FLINEAR1_958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_957, v ds
+# define BFI_FLINEAR1_958_TICK(t)
+# define BFI_FLINEAR1_957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_956, v ds
+# define BFI_FLINEAR1_957_TICK(t)
+# define BFI_FLINEAR1_956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_955, v ds
+# define BFI_FLINEAR1_956_TICK(t)
+# define BFI_FLINEAR1_955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_954, v ds
+# define BFI_FLINEAR1_955_TICK(t)
+# define BFI_FLINEAR1_954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_953, v ds
+# define BFI_FLINEAR1_954_TICK(t)
+# define BFI_FLINEAR1_953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_952, v ds
+# define BFI_FLINEAR1_953_TICK(t)
+# define BFI_FLINEAR1_952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_951, v ds
+# define BFI_FLINEAR1_952_TICK(t)
+# define BFI_FLINEAR1_951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_950, v ds
+# define BFI_FLINEAR1_951_TICK(t)
+# define BFI_FLINEAR1_950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_949, v ds
+# define BFI_FLINEAR1_950_TICK(t)
+# define BFI_FLINEAR1_949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_948, v ds
+# define BFI_FLINEAR1_949_TICK(t)
+# define BFI_FLINEAR1_948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_947, v ds
+# define BFI_FLINEAR1_948_TICK(t)
+# define BFI_FLINEAR1_947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_946, v ds
+# define BFI_FLINEAR1_947_TICK(t)
+# define BFI_FLINEAR1_946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_945, v ds
+# define BFI_FLINEAR1_946_TICK(t)
+# define BFI_FLINEAR1_945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_944, v ds
+# define BFI_FLINEAR1_945_TICK(t)
+# define BFI_FLINEAR1_944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_943, v ds
+# define BFI_FLINEAR1_944_TICK(t)
+# define BFI_FLINEAR1_943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_942, v ds
+# define BFI_FLINEAR1_943_TICK(t)
+# define BFI_FLINEAR1_942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_941, v ds
+# define BFI_FLINEAR1_942_TICK(t)
+# define BFI_FLINEAR1_941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_940, v ds
+# define BFI_FLINEAR1_941_TICK(t)
+# define BFI_FLINEAR1_940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_939, v ds
+# define BFI_FLINEAR1_940_TICK(t)
+# define BFI_FLINEAR1_939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_938, v ds
+# define BFI_FLINEAR1_939_TICK(t)
+# define BFI_FLINEAR1_938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_937, v ds
+# define BFI_FLINEAR1_938_TICK(t)
+# define BFI_FLINEAR1_937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_936, v ds
+# define BFI_FLINEAR1_937_TICK(t)
+# define BFI_FLINEAR1_936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_935, v ds
+# define BFI_FLINEAR1_936_TICK(t)
+# define BFI_FLINEAR1_935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_934, v ds
+# define BFI_FLINEAR1_935_TICK(t)
+# define BFI_FLINEAR1_934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_933, v ds
+# define BFI_FLINEAR1_934_TICK(t)
+# define BFI_FLINEAR1_933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_932, v ds
+# define BFI_FLINEAR1_933_TICK(t)
+# define BFI_FLINEAR1_932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_931, v ds
+# define BFI_FLINEAR1_932_TICK(t)
+# define BFI_FLINEAR1_931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_930, v ds
+# define BFI_FLINEAR1_931_TICK(t)
+# define BFI_FLINEAR1_930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_929, v ds
+# define BFI_FLINEAR1_930_TICK(t)
+# define BFI_FLINEAR1_929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_928, v ds
+# define BFI_FLINEAR1_929_TICK(t)
+# define BFI_FLINEAR1_928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_927, v ds
+# define BFI_FLINEAR1_928_TICK(t)
+# define BFI_FLINEAR1_927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_926, v ds
+# define BFI_FLINEAR1_927_TICK(t)
+# define BFI_FLINEAR1_926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_925, v ds
+# define BFI_FLINEAR1_926_TICK(t)
+# define BFI_FLINEAR1_925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_924, v ds
+# define BFI_FLINEAR1_925_TICK(t)
+# define BFI_FLINEAR1_924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_923, v ds
+# define BFI_FLINEAR1_924_TICK(t)
+# define BFI_FLINEAR1_923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_922, v ds
+# define BFI_FLINEAR1_923_TICK(t)
+# define BFI_FLINEAR1_922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_921, v ds
+# define BFI_FLINEAR1_922_TICK(t)
+# define BFI_FLINEAR1_921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_920, v ds
+# define BFI_FLINEAR1_921_TICK(t)
+# define BFI_FLINEAR1_920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_919, v ds
+# define BFI_FLINEAR1_920_TICK(t)
+# define BFI_FLINEAR1_919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_918, v ds
+# define BFI_FLINEAR1_919_TICK(t)
+# define BFI_FLINEAR1_918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_917, v ds
+# define BFI_FLINEAR1_918_TICK(t)
+# define BFI_FLINEAR1_917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_916, v ds
+# define BFI_FLINEAR1_917_TICK(t)
+# define BFI_FLINEAR1_916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_915, v ds
+# define BFI_FLINEAR1_916_TICK(t)
+# define BFI_FLINEAR1_915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_914, v ds
+# define BFI_FLINEAR1_915_TICK(t)
+# define BFI_FLINEAR1_914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_913, v ds
+# define BFI_FLINEAR1_914_TICK(t)
+# define BFI_FLINEAR1_913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_912, v ds
+# define BFI_FLINEAR1_913_TICK(t)
+# define BFI_FLINEAR1_912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_911, v ds
+# define BFI_FLINEAR1_912_TICK(t)
+# define BFI_FLINEAR1_911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_910, v ds
+# define BFI_FLINEAR1_911_TICK(t)
+# define BFI_FLINEAR1_910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_909, v ds
+# define BFI_FLINEAR1_910_TICK(t)
+# define BFI_FLINEAR1_909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_908, v ds
+# define BFI_FLINEAR1_909_TICK(t)
+# define BFI_FLINEAR1_908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_907, v ds
+# define BFI_FLINEAR1_908_TICK(t)
+# define BFI_FLINEAR1_907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_906, v ds
+# define BFI_FLINEAR1_907_TICK(t)
+# define BFI_FLINEAR1_906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_905, v ds
+# define BFI_FLINEAR1_906_TICK(t)
+# define BFI_FLINEAR1_905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_904, v ds
+# define BFI_FLINEAR1_905_TICK(t)
+# define BFI_FLINEAR1_904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_903, v ds
+# define BFI_FLINEAR1_904_TICK(t)
+# define BFI_FLINEAR1_903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_902, v ds
+# define BFI_FLINEAR1_903_TICK(t)
+# define BFI_FLINEAR1_902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_901, v ds
+# define BFI_FLINEAR1_902_TICK(t)
+# define BFI_FLINEAR1_901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_900, v ds
+# define BFI_FLINEAR1_901_TICK(t)
+# define BFI_FLINEAR1_900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_899, v ds
+# define BFI_FLINEAR1_900_TICK(t)
+# define BFI_FLINEAR1_899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_898, v ds
+# define BFI_FLINEAR1_899_TICK(t)
+# define BFI_FLINEAR1_898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_897, v ds
+# define BFI_FLINEAR1_898_TICK(t)
+# define BFI_FLINEAR1_897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_896, v ds
+# define BFI_FLINEAR1_897_TICK(t)
+# define BFI_FLINEAR1_896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_895, v ds
+# define BFI_FLINEAR1_896_TICK(t)
+# define BFI_FLINEAR1_895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_894, v ds
+# define BFI_FLINEAR1_895_TICK(t)
+# define BFI_FLINEAR1_894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_893, v ds
+# define BFI_FLINEAR1_894_TICK(t)
+# define BFI_FLINEAR1_893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_892, v ds
+# define BFI_FLINEAR1_893_TICK(t)
+# define BFI_FLINEAR1_892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_891, v ds
+# define BFI_FLINEAR1_892_TICK(t)
+# define BFI_FLINEAR1_891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_890, v ds
+# define BFI_FLINEAR1_891_TICK(t)
+# define BFI_FLINEAR1_890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_889, v ds
+# define BFI_FLINEAR1_890_TICK(t)
+# define BFI_FLINEAR1_889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_888, v ds
+# define BFI_FLINEAR1_889_TICK(t)
+# define BFI_FLINEAR1_888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_887, v ds
+# define BFI_FLINEAR1_888_TICK(t)
+# define BFI_FLINEAR1_887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_886, v ds
+# define BFI_FLINEAR1_887_TICK(t)
+# define BFI_FLINEAR1_886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_885, v ds
+# define BFI_FLINEAR1_886_TICK(t)
+# define BFI_FLINEAR1_885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_884, v ds
+# define BFI_FLINEAR1_885_TICK(t)
+# define BFI_FLINEAR1_884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_883, v ds
+# define BFI_FLINEAR1_884_TICK(t)
+# define BFI_FLINEAR1_883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_882, v ds
+# define BFI_FLINEAR1_883_TICK(t)
+# define BFI_FLINEAR1_882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_881, v ds
+# define BFI_FLINEAR1_882_TICK(t)
+# define BFI_FLINEAR1_881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_880, v ds
+# define BFI_FLINEAR1_881_TICK(t)
+# define BFI_FLINEAR1_880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_879, v ds
+# define BFI_FLINEAR1_880_TICK(t)
+# define BFI_FLINEAR1_879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_878, v ds
+# define BFI_FLINEAR1_879_TICK(t)
+# define BFI_FLINEAR1_878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_877, v ds
+# define BFI_FLINEAR1_878_TICK(t)
+# define BFI_FLINEAR1_877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_876, v ds
+# define BFI_FLINEAR1_877_TICK(t)
+# define BFI_FLINEAR1_876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_875, v ds
+# define BFI_FLINEAR1_876_TICK(t)
+# define BFI_FLINEAR1_875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_874, v ds
+# define BFI_FLINEAR1_875_TICK(t)
+# define BFI_FLINEAR1_874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_873, v ds
+# define BFI_FLINEAR1_874_TICK(t)
+# define BFI_FLINEAR1_873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_872, v ds
+# define BFI_FLINEAR1_873_TICK(t)
+# define BFI_FLINEAR1_872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_871, v ds
+# define BFI_FLINEAR1_872_TICK(t)
+# define BFI_FLINEAR1_871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_870, v ds
+# define BFI_FLINEAR1_871_TICK(t)
+# define BFI_FLINEAR1_870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_869, v ds
+# define BFI_FLINEAR1_870_TICK(t)
+# define BFI_FLINEAR1_869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_868, v ds
+# define BFI_FLINEAR1_869_TICK(t)
+# define BFI_FLINEAR1_868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_867, v ds
+# define BFI_FLINEAR1_868_TICK(t)
+# define BFI_FLINEAR1_867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_866, v ds
+# define BFI_FLINEAR1_867_TICK(t)
+# define BFI_FLINEAR1_866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_865, v ds
+# define BFI_FLINEAR1_866_TICK(t)
+# define BFI_FLINEAR1_865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_864, v ds
+# define BFI_FLINEAR1_865_TICK(t)
+# define BFI_FLINEAR1_864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_863, v ds
+# define BFI_FLINEAR1_864_TICK(t)
+# define BFI_FLINEAR1_863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_862, v ds
+# define BFI_FLINEAR1_863_TICK(t)
+# define BFI_FLINEAR1_862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_861, v ds
+# define BFI_FLINEAR1_862_TICK(t)
+# define BFI_FLINEAR1_861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_860, v ds
+# define BFI_FLINEAR1_861_TICK(t)
+# define BFI_FLINEAR1_860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_859, v ds
+# define BFI_FLINEAR1_860_TICK(t)
+# define BFI_FLINEAR1_859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_858, v ds
+# define BFI_FLINEAR1_859_TICK(t)
+# define BFI_FLINEAR1_858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_857, v ds
+# define BFI_FLINEAR1_858_TICK(t)
+# define BFI_FLINEAR1_857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_856, v ds
+# define BFI_FLINEAR1_857_TICK(t)
+# define BFI_FLINEAR1_856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_855, v ds
+# define BFI_FLINEAR1_856_TICK(t)
+# define BFI_FLINEAR1_855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_854, v ds
+# define BFI_FLINEAR1_855_TICK(t)
+# define BFI_FLINEAR1_854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_853, v ds
+# define BFI_FLINEAR1_854_TICK(t)
+# define BFI_FLINEAR1_853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_852, v ds
+# define BFI_FLINEAR1_853_TICK(t)
+# define BFI_FLINEAR1_852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_851, v ds
+# define BFI_FLINEAR1_852_TICK(t)
+# define BFI_FLINEAR1_851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_850, v ds
+# define BFI_FLINEAR1_851_TICK(t)
+# define BFI_FLINEAR1_850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_849, v ds
+# define BFI_FLINEAR1_850_TICK(t)
+# define BFI_FLINEAR1_849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_848, v ds
+# define BFI_FLINEAR1_849_TICK(t)
+# define BFI_FLINEAR1_848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_847, v ds
+# define BFI_FLINEAR1_848_TICK(t)
+# define BFI_FLINEAR1_847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_846, v ds
+# define BFI_FLINEAR1_847_TICK(t)
+# define BFI_FLINEAR1_846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_845, v ds
+# define BFI_FLINEAR1_846_TICK(t)
+# define BFI_FLINEAR1_845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_844, v ds
+# define BFI_FLINEAR1_845_TICK(t)
+# define BFI_FLINEAR1_844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_843, v ds
+# define BFI_FLINEAR1_844_TICK(t)
+# define BFI_FLINEAR1_843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_842, v ds
+# define BFI_FLINEAR1_843_TICK(t)
+# define BFI_FLINEAR1_842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_841, v ds
+# define BFI_FLINEAR1_842_TICK(t)
+# define BFI_FLINEAR1_841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_840, v ds
+# define BFI_FLINEAR1_841_TICK(t)
+# define BFI_FLINEAR1_840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_839, v ds
+# define BFI_FLINEAR1_840_TICK(t)
+# define BFI_FLINEAR1_839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_838, v ds
+# define BFI_FLINEAR1_839_TICK(t)
+# define BFI_FLINEAR1_838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_837, v ds
+# define BFI_FLINEAR1_838_TICK(t)
+# define BFI_FLINEAR1_837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_836, v ds
+# define BFI_FLINEAR1_837_TICK(t)
+# define BFI_FLINEAR1_836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_835, v ds
+# define BFI_FLINEAR1_836_TICK(t)
+# define BFI_FLINEAR1_835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_834, v ds
+# define BFI_FLINEAR1_835_TICK(t)
+# define BFI_FLINEAR1_834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_833, v ds
+# define BFI_FLINEAR1_834_TICK(t)
+# define BFI_FLINEAR1_833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_832, v ds
+# define BFI_FLINEAR1_833_TICK(t)
+# define BFI_FLINEAR1_832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_831, v ds
+# define BFI_FLINEAR1_832_TICK(t)
+# define BFI_FLINEAR1_831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_830, v ds
+# define BFI_FLINEAR1_831_TICK(t)
+# define BFI_FLINEAR1_830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_829, v ds
+# define BFI_FLINEAR1_830_TICK(t)
+# define BFI_FLINEAR1_829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_828, v ds
+# define BFI_FLINEAR1_829_TICK(t)
+# define BFI_FLINEAR1_828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_827, v ds
+# define BFI_FLINEAR1_828_TICK(t)
+# define BFI_FLINEAR1_827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_826, v ds
+# define BFI_FLINEAR1_827_TICK(t)
+# define BFI_FLINEAR1_826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_825, v ds
+# define BFI_FLINEAR1_826_TICK(t)
+# define BFI_FLINEAR1_825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_824, v ds
+# define BFI_FLINEAR1_825_TICK(t)
+# define BFI_FLINEAR1_824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_823, v ds
+# define BFI_FLINEAR1_824_TICK(t)
+# define BFI_FLINEAR1_823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_822, v ds
+# define BFI_FLINEAR1_823_TICK(t)
+# define BFI_FLINEAR1_822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_821, v ds
+# define BFI_FLINEAR1_822_TICK(t)
+# define BFI_FLINEAR1_821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_820, v ds
+# define BFI_FLINEAR1_821_TICK(t)
+# define BFI_FLINEAR1_820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_819, v ds
+# define BFI_FLINEAR1_820_TICK(t)
+# define BFI_FLINEAR1_819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_818, v ds
+# define BFI_FLINEAR1_819_TICK(t)
+# define BFI_FLINEAR1_818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_817, v ds
+# define BFI_FLINEAR1_818_TICK(t)
+# define BFI_FLINEAR1_817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_816, v ds
+# define BFI_FLINEAR1_817_TICK(t)
+# define BFI_FLINEAR1_816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_815, v ds
+# define BFI_FLINEAR1_816_TICK(t)
+# define BFI_FLINEAR1_815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_814, v ds
+# define BFI_FLINEAR1_815_TICK(t)
+# define BFI_FLINEAR1_814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_813, v ds
+# define BFI_FLINEAR1_814_TICK(t)
+# define BFI_FLINEAR1_813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_812, v ds
+# define BFI_FLINEAR1_813_TICK(t)
+# define BFI_FLINEAR1_812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_811, v ds
+# define BFI_FLINEAR1_812_TICK(t)
+# define BFI_FLINEAR1_811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_810, v ds
+# define BFI_FLINEAR1_811_TICK(t)
+# define BFI_FLINEAR1_810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_809, v ds
+# define BFI_FLINEAR1_810_TICK(t)
+# define BFI_FLINEAR1_809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_808, v ds
+# define BFI_FLINEAR1_809_TICK(t)
+# define BFI_FLINEAR1_808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_807, v ds
+# define BFI_FLINEAR1_808_TICK(t)
+# define BFI_FLINEAR1_807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_806, v ds
+# define BFI_FLINEAR1_807_TICK(t)
+# define BFI_FLINEAR1_806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_805, v ds
+# define BFI_FLINEAR1_806_TICK(t)
+# define BFI_FLINEAR1_805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_804, v ds
+# define BFI_FLINEAR1_805_TICK(t)
+# define BFI_FLINEAR1_804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_803, v ds
+# define BFI_FLINEAR1_804_TICK(t)
+# define BFI_FLINEAR1_803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_802, v ds
+# define BFI_FLINEAR1_803_TICK(t)
+# define BFI_FLINEAR1_802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_801, v ds
+# define BFI_FLINEAR1_802_TICK(t)
+# define BFI_FLINEAR1_801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_800, v ds
+# define BFI_FLINEAR1_801_TICK(t)
+# define BFI_FLINEAR1_800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_799, v ds
+# define BFI_FLINEAR1_800_TICK(t)
+# define BFI_FLINEAR1_799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_798, v ds
+# define BFI_FLINEAR1_799_TICK(t)
+# define BFI_FLINEAR1_798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_797, v ds
+# define BFI_FLINEAR1_798_TICK(t)
+# define BFI_FLINEAR1_797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_796, v ds
+# define BFI_FLINEAR1_797_TICK(t)
+# define BFI_FLINEAR1_796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_795, v ds
+# define BFI_FLINEAR1_796_TICK(t)
+# define BFI_FLINEAR1_795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_794, v ds
+# define BFI_FLINEAR1_795_TICK(t)
+# define BFI_FLINEAR1_794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_793, v ds
+# define BFI_FLINEAR1_794_TICK(t)
+# define BFI_FLINEAR1_793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_792, v ds
+# define BFI_FLINEAR1_793_TICK(t)
+# define BFI_FLINEAR1_792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_791, v ds
+# define BFI_FLINEAR1_792_TICK(t)
+# define BFI_FLINEAR1_791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_790, v ds
+# define BFI_FLINEAR1_791_TICK(t)
+# define BFI_FLINEAR1_790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_789, v ds
+# define BFI_FLINEAR1_790_TICK(t)
+# define BFI_FLINEAR1_789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_788, v ds
+# define BFI_FLINEAR1_789_TICK(t)
+# define BFI_FLINEAR1_788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_787, v ds
+# define BFI_FLINEAR1_788_TICK(t)
+# define BFI_FLINEAR1_787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_786, v ds
+# define BFI_FLINEAR1_787_TICK(t)
+# define BFI_FLINEAR1_786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_785, v ds
+# define BFI_FLINEAR1_786_TICK(t)
+# define BFI_FLINEAR1_785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_784, v ds
+# define BFI_FLINEAR1_785_TICK(t)
+# define BFI_FLINEAR1_784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_783, v ds
+# define BFI_FLINEAR1_784_TICK(t)
+# define BFI_FLINEAR1_783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_782, v ds
+# define BFI_FLINEAR1_783_TICK(t)
+# define BFI_FLINEAR1_782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_781, v ds
+# define BFI_FLINEAR1_782_TICK(t)
+# define BFI_FLINEAR1_781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_780, v ds
+# define BFI_FLINEAR1_781_TICK(t)
+# define BFI_FLINEAR1_780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_779, v ds
+# define BFI_FLINEAR1_780_TICK(t)
+# define BFI_FLINEAR1_779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_778, v ds
+# define BFI_FLINEAR1_779_TICK(t)
+# define BFI_FLINEAR1_778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_777, v ds
+# define BFI_FLINEAR1_778_TICK(t)
+# define BFI_FLINEAR1_777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_776, v ds
+# define BFI_FLINEAR1_777_TICK(t)
+# define BFI_FLINEAR1_776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_775, v ds
+# define BFI_FLINEAR1_776_TICK(t)
+# define BFI_FLINEAR1_775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_774, v ds
+# define BFI_FLINEAR1_775_TICK(t)
+# define BFI_FLINEAR1_774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_773, v ds
+# define BFI_FLINEAR1_774_TICK(t)
+# define BFI_FLINEAR1_773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_772, v ds
+# define BFI_FLINEAR1_773_TICK(t)
+# define BFI_FLINEAR1_772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_771, v ds
+# define BFI_FLINEAR1_772_TICK(t)
+# define BFI_FLINEAR1_771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_770, v ds
+# define BFI_FLINEAR1_771_TICK(t)
+# define BFI_FLINEAR1_770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_769, v ds
+# define BFI_FLINEAR1_770_TICK(t)
+# define BFI_FLINEAR1_769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_768, v ds
+# define BFI_FLINEAR1_769_TICK(t)
+# define BFI_FLINEAR1_768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_767, v ds
+# define BFI_FLINEAR1_768_TICK(t)
+# define BFI_FLINEAR1_767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_766, v ds
+# define BFI_FLINEAR1_767_TICK(t)
+# define BFI_FLINEAR1_766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_765, v ds
+# define BFI_FLINEAR1_766_TICK(t)
+# define BFI_FLINEAR1_765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_764, v ds
+# define BFI_FLINEAR1_765_TICK(t)
+# define BFI_FLINEAR1_764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_763, v ds
+# define BFI_FLINEAR1_764_TICK(t)
+# define BFI_FLINEAR1_763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_762, v ds
+# define BFI_FLINEAR1_763_TICK(t)
+# define BFI_FLINEAR1_762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_761, v ds
+# define BFI_FLINEAR1_762_TICK(t)
+# define BFI_FLINEAR1_761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_760, v ds
+# define BFI_FLINEAR1_761_TICK(t)
+# define BFI_FLINEAR1_760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_759, v ds
+# define BFI_FLINEAR1_760_TICK(t)
+# define BFI_FLINEAR1_759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_758, v ds
+# define BFI_FLINEAR1_759_TICK(t)
+# define BFI_FLINEAR1_758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_757, v ds
+# define BFI_FLINEAR1_758_TICK(t)
+# define BFI_FLINEAR1_757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_756, v ds
+# define BFI_FLINEAR1_757_TICK(t)
+# define BFI_FLINEAR1_756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_755, v ds
+# define BFI_FLINEAR1_756_TICK(t)
+# define BFI_FLINEAR1_755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_754, v ds
+# define BFI_FLINEAR1_755_TICK(t)
+# define BFI_FLINEAR1_754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_753, v ds
+# define BFI_FLINEAR1_754_TICK(t)
+# define BFI_FLINEAR1_753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_752, v ds
+# define BFI_FLINEAR1_753_TICK(t)
+# define BFI_FLINEAR1_752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_751, v ds
+# define BFI_FLINEAR1_752_TICK(t)
+# define BFI_FLINEAR1_751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_750, v ds
+# define BFI_FLINEAR1_751_TICK(t)
+# define BFI_FLINEAR1_750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_749, v ds
+# define BFI_FLINEAR1_750_TICK(t)
+# define BFI_FLINEAR1_749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_748, v ds
+# define BFI_FLINEAR1_749_TICK(t)
+# define BFI_FLINEAR1_748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_747, v ds
+# define BFI_FLINEAR1_748_TICK(t)
+# define BFI_FLINEAR1_747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_746, v ds
+# define BFI_FLINEAR1_747_TICK(t)
+# define BFI_FLINEAR1_746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_745, v ds
+# define BFI_FLINEAR1_746_TICK(t)
+# define BFI_FLINEAR1_745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_744, v ds
+# define BFI_FLINEAR1_745_TICK(t)
+# define BFI_FLINEAR1_744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_743, v ds
+# define BFI_FLINEAR1_744_TICK(t)
+# define BFI_FLINEAR1_743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_742, v ds
+# define BFI_FLINEAR1_743_TICK(t)
+# define BFI_FLINEAR1_742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_741, v ds
+# define BFI_FLINEAR1_742_TICK(t)
+# define BFI_FLINEAR1_741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_740, v ds
+# define BFI_FLINEAR1_741_TICK(t)
+# define BFI_FLINEAR1_740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_739, v ds
+# define BFI_FLINEAR1_740_TICK(t)
+# define BFI_FLINEAR1_739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_738, v ds
+# define BFI_FLINEAR1_739_TICK(t)
+# define BFI_FLINEAR1_738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_737, v ds
+# define BFI_FLINEAR1_738_TICK(t)
+# define BFI_FLINEAR1_737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_736, v ds
+# define BFI_FLINEAR1_737_TICK(t)
+# define BFI_FLINEAR1_736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_735, v ds
+# define BFI_FLINEAR1_736_TICK(t)
+# define BFI_FLINEAR1_735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_734, v ds
+# define BFI_FLINEAR1_735_TICK(t)
+# define BFI_FLINEAR1_734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_733, v ds
+# define BFI_FLINEAR1_734_TICK(t)
+# define BFI_FLINEAR1_733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_732, v ds
+# define BFI_FLINEAR1_733_TICK(t)
+# define BFI_FLINEAR1_732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_731, v ds
+# define BFI_FLINEAR1_732_TICK(t)
+# define BFI_FLINEAR1_731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_730, v ds
+# define BFI_FLINEAR1_731_TICK(t)
+# define BFI_FLINEAR1_730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_729, v ds
+# define BFI_FLINEAR1_730_TICK(t)
+# define BFI_FLINEAR1_729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_728, v ds
+# define BFI_FLINEAR1_729_TICK(t)
+# define BFI_FLINEAR1_728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_727, v ds
+# define BFI_FLINEAR1_728_TICK(t)
+# define BFI_FLINEAR1_727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_726, v ds
+# define BFI_FLINEAR1_727_TICK(t)
+# define BFI_FLINEAR1_726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_725, v ds
+# define BFI_FLINEAR1_726_TICK(t)
+# define BFI_FLINEAR1_725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_724, v ds
+# define BFI_FLINEAR1_725_TICK(t)
+# define BFI_FLINEAR1_724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_723, v ds
+# define BFI_FLINEAR1_724_TICK(t)
+# define BFI_FLINEAR1_723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_722, v ds
+# define BFI_FLINEAR1_723_TICK(t)
+# define BFI_FLINEAR1_722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_721, v ds
+# define BFI_FLINEAR1_722_TICK(t)
+# define BFI_FLINEAR1_721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_720, v ds
+# define BFI_FLINEAR1_721_TICK(t)
+# define BFI_FLINEAR1_720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_719, v ds
+# define BFI_FLINEAR1_720_TICK(t)
+# define BFI_FLINEAR1_719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_718, v ds
+# define BFI_FLINEAR1_719_TICK(t)
+# define BFI_FLINEAR1_718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_717, v ds
+# define BFI_FLINEAR1_718_TICK(t)
+# define BFI_FLINEAR1_717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_716, v ds
+# define BFI_FLINEAR1_717_TICK(t)
+# define BFI_FLINEAR1_716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_715, v ds
+# define BFI_FLINEAR1_716_TICK(t)
+# define BFI_FLINEAR1_715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_714, v ds
+# define BFI_FLINEAR1_715_TICK(t)
+# define BFI_FLINEAR1_714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_713, v ds
+# define BFI_FLINEAR1_714_TICK(t)
+# define BFI_FLINEAR1_713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_712, v ds
+# define BFI_FLINEAR1_713_TICK(t)
+# define BFI_FLINEAR1_712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_711, v ds
+# define BFI_FLINEAR1_712_TICK(t)
+# define BFI_FLINEAR1_711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_710, v ds
+# define BFI_FLINEAR1_711_TICK(t)
+# define BFI_FLINEAR1_710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_709, v ds
+# define BFI_FLINEAR1_710_TICK(t)
+# define BFI_FLINEAR1_709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_708, v ds
+# define BFI_FLINEAR1_709_TICK(t)
+# define BFI_FLINEAR1_708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_707, v ds
+# define BFI_FLINEAR1_708_TICK(t)
+# define BFI_FLINEAR1_707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_706, v ds
+# define BFI_FLINEAR1_707_TICK(t)
+# define BFI_FLINEAR1_706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_705, v ds
+# define BFI_FLINEAR1_706_TICK(t)
+# define BFI_FLINEAR1_705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_704, v ds
+# define BFI_FLINEAR1_705_TICK(t)
+# define BFI_FLINEAR1_704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_703, v ds
+# define BFI_FLINEAR1_704_TICK(t)
+# define BFI_FLINEAR1_703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_702, v ds
+# define BFI_FLINEAR1_703_TICK(t)
+# define BFI_FLINEAR1_702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_701, v ds
+# define BFI_FLINEAR1_702_TICK(t)
+# define BFI_FLINEAR1_701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_700, v ds
+# define BFI_FLINEAR1_701_TICK(t)
+# define BFI_FLINEAR1_700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_699, v ds
+# define BFI_FLINEAR1_700_TICK(t)
+# define BFI_FLINEAR1_699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_698, v ds
+# define BFI_FLINEAR1_699_TICK(t)
+# define BFI_FLINEAR1_698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_697, v ds
+# define BFI_FLINEAR1_698_TICK(t)
+# define BFI_FLINEAR1_697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_696, v ds
+# define BFI_FLINEAR1_697_TICK(t)
+# define BFI_FLINEAR1_696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_695, v ds
+# define BFI_FLINEAR1_696_TICK(t)
+# define BFI_FLINEAR1_695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_694, v ds
+# define BFI_FLINEAR1_695_TICK(t)
+# define BFI_FLINEAR1_694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_693, v ds
+# define BFI_FLINEAR1_694_TICK(t)
+# define BFI_FLINEAR1_693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_692, v ds
+# define BFI_FLINEAR1_693_TICK(t)
+# define BFI_FLINEAR1_692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_691, v ds
+# define BFI_FLINEAR1_692_TICK(t)
+# define BFI_FLINEAR1_691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_690, v ds
+# define BFI_FLINEAR1_691_TICK(t)
+# define BFI_FLINEAR1_690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_689, v ds
+# define BFI_FLINEAR1_690_TICK(t)
+# define BFI_FLINEAR1_689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_688, v ds
+# define BFI_FLINEAR1_689_TICK(t)
+# define BFI_FLINEAR1_688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_687, v ds
+# define BFI_FLINEAR1_688_TICK(t)
+# define BFI_FLINEAR1_687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_686, v ds
+# define BFI_FLINEAR1_687_TICK(t)
+# define BFI_FLINEAR1_686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_685, v ds
+# define BFI_FLINEAR1_686_TICK(t)
+# define BFI_FLINEAR1_685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_684, v ds
+# define BFI_FLINEAR1_685_TICK(t)
+# define BFI_FLINEAR1_684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_683, v ds
+# define BFI_FLINEAR1_684_TICK(t)
+# define BFI_FLINEAR1_683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_682, v ds
+# define BFI_FLINEAR1_683_TICK(t)
+# define BFI_FLINEAR1_682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_681, v ds
+# define BFI_FLINEAR1_682_TICK(t)
+# define BFI_FLINEAR1_681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_680, v ds
+# define BFI_FLINEAR1_681_TICK(t)
+# define BFI_FLINEAR1_680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_679, v ds
+# define BFI_FLINEAR1_680_TICK(t)
+# define BFI_FLINEAR1_679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_678, v ds
+# define BFI_FLINEAR1_679_TICK(t)
+# define BFI_FLINEAR1_678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_677, v ds
+# define BFI_FLINEAR1_678_TICK(t)
+# define BFI_FLINEAR1_677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_676, v ds
+# define BFI_FLINEAR1_677_TICK(t)
+# define BFI_FLINEAR1_676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_675, v ds
+# define BFI_FLINEAR1_676_TICK(t)
+# define BFI_FLINEAR1_675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_674, v ds
+# define BFI_FLINEAR1_675_TICK(t)
+# define BFI_FLINEAR1_674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_673, v ds
+# define BFI_FLINEAR1_674_TICK(t)
+# define BFI_FLINEAR1_673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_672, v ds
+# define BFI_FLINEAR1_673_TICK(t)
+# define BFI_FLINEAR1_672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_671, v ds
+# define BFI_FLINEAR1_672_TICK(t)
+# define BFI_FLINEAR1_671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_670, v ds
+# define BFI_FLINEAR1_671_TICK(t)
+# define BFI_FLINEAR1_670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_669, v ds
+# define BFI_FLINEAR1_670_TICK(t)
+# define BFI_FLINEAR1_669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_668, v ds
+# define BFI_FLINEAR1_669_TICK(t)
+# define BFI_FLINEAR1_668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_667, v ds
+# define BFI_FLINEAR1_668_TICK(t)
+# define BFI_FLINEAR1_667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_666, v ds
+# define BFI_FLINEAR1_667_TICK(t)
+# define BFI_FLINEAR1_666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_665, v ds
+# define BFI_FLINEAR1_666_TICK(t)
+# define BFI_FLINEAR1_665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_664, v ds
+# define BFI_FLINEAR1_665_TICK(t)
+# define BFI_FLINEAR1_664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_663, v ds
+# define BFI_FLINEAR1_664_TICK(t)
+# define BFI_FLINEAR1_663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_662, v ds
+# define BFI_FLINEAR1_663_TICK(t)
+# define BFI_FLINEAR1_662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_661, v ds
+# define BFI_FLINEAR1_662_TICK(t)
+# define BFI_FLINEAR1_661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_660, v ds
+# define BFI_FLINEAR1_661_TICK(t)
+# define BFI_FLINEAR1_660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_659, v ds
+# define BFI_FLINEAR1_660_TICK(t)
+# define BFI_FLINEAR1_659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_658, v ds
+# define BFI_FLINEAR1_659_TICK(t)
+# define BFI_FLINEAR1_658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_657, v ds
+# define BFI_FLINEAR1_658_TICK(t)
+# define BFI_FLINEAR1_657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_656, v ds
+# define BFI_FLINEAR1_657_TICK(t)
+# define BFI_FLINEAR1_656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_655, v ds
+# define BFI_FLINEAR1_656_TICK(t)
+# define BFI_FLINEAR1_655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_654, v ds
+# define BFI_FLINEAR1_655_TICK(t)
+# define BFI_FLINEAR1_654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_653, v ds
+# define BFI_FLINEAR1_654_TICK(t)
+# define BFI_FLINEAR1_653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_652, v ds
+# define BFI_FLINEAR1_653_TICK(t)
+# define BFI_FLINEAR1_652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_651, v ds
+# define BFI_FLINEAR1_652_TICK(t)
+# define BFI_FLINEAR1_651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_650, v ds
+# define BFI_FLINEAR1_651_TICK(t)
+# define BFI_FLINEAR1_650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_649, v ds
+# define BFI_FLINEAR1_650_TICK(t)
+# define BFI_FLINEAR1_649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_648, v ds
+# define BFI_FLINEAR1_649_TICK(t)
+# define BFI_FLINEAR1_648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_647, v ds
+# define BFI_FLINEAR1_648_TICK(t)
+# define BFI_FLINEAR1_647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_646, v ds
+# define BFI_FLINEAR1_647_TICK(t)
+# define BFI_FLINEAR1_646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_645, v ds
+# define BFI_FLINEAR1_646_TICK(t)
+# define BFI_FLINEAR1_645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_644, v ds
+# define BFI_FLINEAR1_645_TICK(t)
+# define BFI_FLINEAR1_644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_643, v ds
+# define BFI_FLINEAR1_644_TICK(t)
+# define BFI_FLINEAR1_643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_642, v ds
+# define BFI_FLINEAR1_643_TICK(t)
+# define BFI_FLINEAR1_642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_641, v ds
+# define BFI_FLINEAR1_642_TICK(t)
+# define BFI_FLINEAR1_641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_640, v ds
+# define BFI_FLINEAR1_641_TICK(t)
+# define BFI_FLINEAR1_640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_639, v ds
+# define BFI_FLINEAR1_640_TICK(t)
+# define BFI_FLINEAR1_639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_638, v ds
+# define BFI_FLINEAR1_639_TICK(t)
+# define BFI_FLINEAR1_638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_637, v ds
+# define BFI_FLINEAR1_638_TICK(t)
+# define BFI_FLINEAR1_637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_636, v ds
+# define BFI_FLINEAR1_637_TICK(t)
+# define BFI_FLINEAR1_636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_635, v ds
+# define BFI_FLINEAR1_636_TICK(t)
+# define BFI_FLINEAR1_635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_634, v ds
+# define BFI_FLINEAR1_635_TICK(t)
+# define BFI_FLINEAR1_634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_633, v ds
+# define BFI_FLINEAR1_634_TICK(t)
+# define BFI_FLINEAR1_633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_632, v ds
+# define BFI_FLINEAR1_633_TICK(t)
+# define BFI_FLINEAR1_632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_631, v ds
+# define BFI_FLINEAR1_632_TICK(t)
+# define BFI_FLINEAR1_631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_630, v ds
+# define BFI_FLINEAR1_631_TICK(t)
+# define BFI_FLINEAR1_630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_629, v ds
+# define BFI_FLINEAR1_630_TICK(t)
+# define BFI_FLINEAR1_629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_628, v ds
+# define BFI_FLINEAR1_629_TICK(t)
+# define BFI_FLINEAR1_628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_627, v ds
+# define BFI_FLINEAR1_628_TICK(t)
+# define BFI_FLINEAR1_627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_626, v ds
+# define BFI_FLINEAR1_627_TICK(t)
+# define BFI_FLINEAR1_626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_625, v ds
+# define BFI_FLINEAR1_626_TICK(t)
+# define BFI_FLINEAR1_625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_624, v ds
+# define BFI_FLINEAR1_625_TICK(t)
+# define BFI_FLINEAR1_624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_623, v ds
+# define BFI_FLINEAR1_624_TICK(t)
+# define BFI_FLINEAR1_623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_622, v ds
+# define BFI_FLINEAR1_623_TICK(t)
+# define BFI_FLINEAR1_622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_621, v ds
+# define BFI_FLINEAR1_622_TICK(t)
+# define BFI_FLINEAR1_621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_620, v ds
+# define BFI_FLINEAR1_621_TICK(t)
+# define BFI_FLINEAR1_620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_619, v ds
+# define BFI_FLINEAR1_620_TICK(t)
+# define BFI_FLINEAR1_619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_618, v ds
+# define BFI_FLINEAR1_619_TICK(t)
+# define BFI_FLINEAR1_618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_617, v ds
+# define BFI_FLINEAR1_618_TICK(t)
+# define BFI_FLINEAR1_617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_616, v ds
+# define BFI_FLINEAR1_617_TICK(t)
+# define BFI_FLINEAR1_616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_615, v ds
+# define BFI_FLINEAR1_616_TICK(t)
+# define BFI_FLINEAR1_615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_614, v ds
+# define BFI_FLINEAR1_615_TICK(t)
+# define BFI_FLINEAR1_614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_613, v ds
+# define BFI_FLINEAR1_614_TICK(t)
+# define BFI_FLINEAR1_613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_612, v ds
+# define BFI_FLINEAR1_613_TICK(t)
+# define BFI_FLINEAR1_612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_611, v ds
+# define BFI_FLINEAR1_612_TICK(t)
+# define BFI_FLINEAR1_611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_610, v ds
+# define BFI_FLINEAR1_611_TICK(t)
+# define BFI_FLINEAR1_610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_609, v ds
+# define BFI_FLINEAR1_610_TICK(t)
+# define BFI_FLINEAR1_609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_608, v ds
+# define BFI_FLINEAR1_609_TICK(t)
+# define BFI_FLINEAR1_608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_607, v ds
+# define BFI_FLINEAR1_608_TICK(t)
+# define BFI_FLINEAR1_607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_606, v ds
+# define BFI_FLINEAR1_607_TICK(t)
+# define BFI_FLINEAR1_606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_605, v ds
+# define BFI_FLINEAR1_606_TICK(t)
+# define BFI_FLINEAR1_605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_604, v ds
+# define BFI_FLINEAR1_605_TICK(t)
+# define BFI_FLINEAR1_604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_603, v ds
+# define BFI_FLINEAR1_604_TICK(t)
+# define BFI_FLINEAR1_603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_602, v ds
+# define BFI_FLINEAR1_603_TICK(t)
+# define BFI_FLINEAR1_602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_601, v ds
+# define BFI_FLINEAR1_602_TICK(t)
+# define BFI_FLINEAR1_601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_600, v ds
+# define BFI_FLINEAR1_601_TICK(t)
+# define BFI_FLINEAR1_600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_599, v ds
+# define BFI_FLINEAR1_600_TICK(t)
+# define BFI_FLINEAR1_599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_598, v ds
+# define BFI_FLINEAR1_599_TICK(t)
+# define BFI_FLINEAR1_598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_597, v ds
+# define BFI_FLINEAR1_598_TICK(t)
+# define BFI_FLINEAR1_597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_596, v ds
+# define BFI_FLINEAR1_597_TICK(t)
+# define BFI_FLINEAR1_596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_595, v ds
+# define BFI_FLINEAR1_596_TICK(t)
+# define BFI_FLINEAR1_595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_594, v ds
+# define BFI_FLINEAR1_595_TICK(t)
+# define BFI_FLINEAR1_594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_593, v ds
+# define BFI_FLINEAR1_594_TICK(t)
+# define BFI_FLINEAR1_593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_592, v ds
+# define BFI_FLINEAR1_593_TICK(t)
+# define BFI_FLINEAR1_592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_591, v ds
+# define BFI_FLINEAR1_592_TICK(t)
+# define BFI_FLINEAR1_591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_590, v ds
+# define BFI_FLINEAR1_591_TICK(t)
+# define BFI_FLINEAR1_590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_589, v ds
+# define BFI_FLINEAR1_590_TICK(t)
+# define BFI_FLINEAR1_589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_588, v ds
+# define BFI_FLINEAR1_589_TICK(t)
+# define BFI_FLINEAR1_588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_587, v ds
+# define BFI_FLINEAR1_588_TICK(t)
+# define BFI_FLINEAR1_587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_586, v ds
+# define BFI_FLINEAR1_587_TICK(t)
+# define BFI_FLINEAR1_586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_585, v ds
+# define BFI_FLINEAR1_586_TICK(t)
+# define BFI_FLINEAR1_585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_584, v ds
+# define BFI_FLINEAR1_585_TICK(t)
+# define BFI_FLINEAR1_584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_583, v ds
+# define BFI_FLINEAR1_584_TICK(t)
+# define BFI_FLINEAR1_583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_582, v ds
+# define BFI_FLINEAR1_583_TICK(t)
+# define BFI_FLINEAR1_582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_581, v ds
+# define BFI_FLINEAR1_582_TICK(t)
+# define BFI_FLINEAR1_581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_580, v ds
+# define BFI_FLINEAR1_581_TICK(t)
+# define BFI_FLINEAR1_580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_579, v ds
+# define BFI_FLINEAR1_580_TICK(t)
+# define BFI_FLINEAR1_579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_578, v ds
+# define BFI_FLINEAR1_579_TICK(t)
+# define BFI_FLINEAR1_578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_577, v ds
+# define BFI_FLINEAR1_578_TICK(t)
+# define BFI_FLINEAR1_577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_576, v ds
+# define BFI_FLINEAR1_577_TICK(t)
+# define BFI_FLINEAR1_576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_575, v ds
+# define BFI_FLINEAR1_576_TICK(t)
+# define BFI_FLINEAR1_575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_574, v ds
+# define BFI_FLINEAR1_575_TICK(t)
+# define BFI_FLINEAR1_574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_573, v ds
+# define BFI_FLINEAR1_574_TICK(t)
+# define BFI_FLINEAR1_573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_572, v ds
+# define BFI_FLINEAR1_573_TICK(t)
+# define BFI_FLINEAR1_572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_571, v ds
+# define BFI_FLINEAR1_572_TICK(t)
+# define BFI_FLINEAR1_571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_570, v ds
+# define BFI_FLINEAR1_571_TICK(t)
+# define BFI_FLINEAR1_570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_569, v ds
+# define BFI_FLINEAR1_570_TICK(t)
+# define BFI_FLINEAR1_569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_568, v ds
+# define BFI_FLINEAR1_569_TICK(t)
+# define BFI_FLINEAR1_568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_567, v ds
+# define BFI_FLINEAR1_568_TICK(t)
+# define BFI_FLINEAR1_567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_566, v ds
+# define BFI_FLINEAR1_567_TICK(t)
+# define BFI_FLINEAR1_566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_565, v ds
+# define BFI_FLINEAR1_566_TICK(t)
+# define BFI_FLINEAR1_565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_564, v ds
+# define BFI_FLINEAR1_565_TICK(t)
+# define BFI_FLINEAR1_564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_563, v ds
+# define BFI_FLINEAR1_564_TICK(t)
+# define BFI_FLINEAR1_563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_562, v ds
+# define BFI_FLINEAR1_563_TICK(t)
+# define BFI_FLINEAR1_562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_561, v ds
+# define BFI_FLINEAR1_562_TICK(t)
+# define BFI_FLINEAR1_561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_560, v ds
+# define BFI_FLINEAR1_561_TICK(t)
+# define BFI_FLINEAR1_560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_559, v ds
+# define BFI_FLINEAR1_560_TICK(t)
+# define BFI_FLINEAR1_559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_558, v ds
+# define BFI_FLINEAR1_559_TICK(t)
+# define BFI_FLINEAR1_558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_557, v ds
+# define BFI_FLINEAR1_558_TICK(t)
+# define BFI_FLINEAR1_557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_556, v ds
+# define BFI_FLINEAR1_557_TICK(t)
+# define BFI_FLINEAR1_556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_555, v ds
+# define BFI_FLINEAR1_556_TICK(t)
+# define BFI_FLINEAR1_555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_554, v ds
+# define BFI_FLINEAR1_555_TICK(t)
+# define BFI_FLINEAR1_554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_553, v ds
+# define BFI_FLINEAR1_554_TICK(t)
+# define BFI_FLINEAR1_553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_552, v ds
+# define BFI_FLINEAR1_553_TICK(t)
+# define BFI_FLINEAR1_552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_551, v ds
+# define BFI_FLINEAR1_552_TICK(t)
+# define BFI_FLINEAR1_551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_550, v ds
+# define BFI_FLINEAR1_551_TICK(t)
+# define BFI_FLINEAR1_550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_549, v ds
+# define BFI_FLINEAR1_550_TICK(t)
+# define BFI_FLINEAR1_549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_548, v ds
+# define BFI_FLINEAR1_549_TICK(t)
+# define BFI_FLINEAR1_548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_547, v ds
+# define BFI_FLINEAR1_548_TICK(t)
+# define BFI_FLINEAR1_547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_546, v ds
+# define BFI_FLINEAR1_547_TICK(t)
+# define BFI_FLINEAR1_546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_545, v ds
+# define BFI_FLINEAR1_546_TICK(t)
+# define BFI_FLINEAR1_545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_544, v ds
+# define BFI_FLINEAR1_545_TICK(t)
+# define BFI_FLINEAR1_544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_543, v ds
+# define BFI_FLINEAR1_544_TICK(t)
+# define BFI_FLINEAR1_543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_542, v ds
+# define BFI_FLINEAR1_543_TICK(t)
+# define BFI_FLINEAR1_542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_541, v ds
+# define BFI_FLINEAR1_542_TICK(t)
+# define BFI_FLINEAR1_541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_540, v ds
+# define BFI_FLINEAR1_541_TICK(t)
+# define BFI_FLINEAR1_540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_539, v ds
+# define BFI_FLINEAR1_540_TICK(t)
+# define BFI_FLINEAR1_539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_538, v ds
+# define BFI_FLINEAR1_539_TICK(t)
+# define BFI_FLINEAR1_538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_537, v ds
+# define BFI_FLINEAR1_538_TICK(t)
+# define BFI_FLINEAR1_537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_536, v ds
+# define BFI_FLINEAR1_537_TICK(t)
+# define BFI_FLINEAR1_536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_535, v ds
+# define BFI_FLINEAR1_536_TICK(t)
+# define BFI_FLINEAR1_535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_534, v ds
+# define BFI_FLINEAR1_535_TICK(t)
+# define BFI_FLINEAR1_534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_533, v ds
+# define BFI_FLINEAR1_534_TICK(t)
+# define BFI_FLINEAR1_533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_532, v ds
+# define BFI_FLINEAR1_533_TICK(t)
+# define BFI_FLINEAR1_532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_531, v ds
+# define BFI_FLINEAR1_532_TICK(t)
+# define BFI_FLINEAR1_531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_530, v ds
+# define BFI_FLINEAR1_531_TICK(t)
+# define BFI_FLINEAR1_530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_529, v ds
+# define BFI_FLINEAR1_530_TICK(t)
+# define BFI_FLINEAR1_529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_528, v ds
+# define BFI_FLINEAR1_529_TICK(t)
+# define BFI_FLINEAR1_528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_527, v ds
+# define BFI_FLINEAR1_528_TICK(t)
+# define BFI_FLINEAR1_527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_526, v ds
+# define BFI_FLINEAR1_527_TICK(t)
+# define BFI_FLINEAR1_526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_525, v ds
+# define BFI_FLINEAR1_526_TICK(t)
+# define BFI_FLINEAR1_525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_524, v ds
+# define BFI_FLINEAR1_525_TICK(t)
+# define BFI_FLINEAR1_524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_523, v ds
+# define BFI_FLINEAR1_524_TICK(t)
+# define BFI_FLINEAR1_523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_522, v ds
+# define BFI_FLINEAR1_523_TICK(t)
+# define BFI_FLINEAR1_522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_521, v ds
+# define BFI_FLINEAR1_522_TICK(t)
+# define BFI_FLINEAR1_521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_520, v ds
+# define BFI_FLINEAR1_521_TICK(t)
+# define BFI_FLINEAR1_520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_519, v ds
+# define BFI_FLINEAR1_520_TICK(t)
+# define BFI_FLINEAR1_519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_518, v ds
+# define BFI_FLINEAR1_519_TICK(t)
+# define BFI_FLINEAR1_518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_517, v ds
+# define BFI_FLINEAR1_518_TICK(t)
+# define BFI_FLINEAR1_517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_516, v ds
+# define BFI_FLINEAR1_517_TICK(t)
+# define BFI_FLINEAR1_516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_515, v ds
+# define BFI_FLINEAR1_516_TICK(t)
+# define BFI_FLINEAR1_515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_514, v ds
+# define BFI_FLINEAR1_515_TICK(t)
+# define BFI_FLINEAR1_514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_513, v ds
+# define BFI_FLINEAR1_514_TICK(t)
+# define BFI_FLINEAR1_513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_512, v ds
+# define BFI_FLINEAR1_513_TICK(t)
+# define BFI_FLINEAR1_512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_511, v ds
+# define BFI_FLINEAR1_512_TICK(t)
+# define BFI_FLINEAR1_511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_510, v ds
+# define BFI_FLINEAR1_511_TICK(t)
+# define BFI_FLINEAR1_510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_509, v ds
+# define BFI_FLINEAR1_510_TICK(t)
+# define BFI_FLINEAR1_509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_508, v ds
+# define BFI_FLINEAR1_509_TICK(t)
+# define BFI_FLINEAR1_508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_507, v ds
+# define BFI_FLINEAR1_508_TICK(t)
+# define BFI_FLINEAR1_507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_506, v ds
+# define BFI_FLINEAR1_507_TICK(t)
+# define BFI_FLINEAR1_506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_505, v ds
+# define BFI_FLINEAR1_506_TICK(t)
+# define BFI_FLINEAR1_505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_504, v ds
+# define BFI_FLINEAR1_505_TICK(t)
+# define BFI_FLINEAR1_504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_503, v ds
+# define BFI_FLINEAR1_504_TICK(t)
+# define BFI_FLINEAR1_503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_502, v ds
+# define BFI_FLINEAR1_503_TICK(t)
+# define BFI_FLINEAR1_502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_501, v ds
+# define BFI_FLINEAR1_502_TICK(t)
+# define BFI_FLINEAR1_501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_500, v ds
+# define BFI_FLINEAR1_501_TICK(t)
+# define BFI_FLINEAR1_500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_499, v ds
+# define BFI_FLINEAR1_500_TICK(t)
+# define BFI_FLINEAR1_499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_498, v ds
+# define BFI_FLINEAR1_499_TICK(t)
+# define BFI_FLINEAR1_498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_497, v ds
+# define BFI_FLINEAR1_498_TICK(t)
+# define BFI_FLINEAR1_497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_496, v ds
+# define BFI_FLINEAR1_497_TICK(t)
+# define BFI_FLINEAR1_496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_495, v ds
+# define BFI_FLINEAR1_496_TICK(t)
+# define BFI_FLINEAR1_495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_494, v ds
+# define BFI_FLINEAR1_495_TICK(t)
+# define BFI_FLINEAR1_494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_493, v ds
+# define BFI_FLINEAR1_494_TICK(t)
+# define BFI_FLINEAR1_493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_492, v ds
+# define BFI_FLINEAR1_493_TICK(t)
+# define BFI_FLINEAR1_492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_491, v ds
+# define BFI_FLINEAR1_492_TICK(t)
+# define BFI_FLINEAR1_491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_490, v ds
+# define BFI_FLINEAR1_491_TICK(t)
+# define BFI_FLINEAR1_490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_489, v ds
+# define BFI_FLINEAR1_490_TICK(t)
+# define BFI_FLINEAR1_489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_488, v ds
+# define BFI_FLINEAR1_489_TICK(t)
+# define BFI_FLINEAR1_488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_487, v ds
+# define BFI_FLINEAR1_488_TICK(t)
+# define BFI_FLINEAR1_487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_486, v ds
+# define BFI_FLINEAR1_487_TICK(t)
+# define BFI_FLINEAR1_486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_485, v ds
+# define BFI_FLINEAR1_486_TICK(t)
+# define BFI_FLINEAR1_485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_484, v ds
+# define BFI_FLINEAR1_485_TICK(t)
+# define BFI_FLINEAR1_484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_483, v ds
+# define BFI_FLINEAR1_484_TICK(t)
+# define BFI_FLINEAR1_483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_482, v ds
+# define BFI_FLINEAR1_483_TICK(t)
+# define BFI_FLINEAR1_482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_481, v ds
+# define BFI_FLINEAR1_482_TICK(t)
+# define BFI_FLINEAR1_481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_480, v ds
+# define BFI_FLINEAR1_481_TICK(t)
+# define BFI_FLINEAR1_480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_479, v ds
+# define BFI_FLINEAR1_480_TICK(t)
+# define BFI_FLINEAR1_479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_478, v ds
+# define BFI_FLINEAR1_479_TICK(t)
+# define BFI_FLINEAR1_478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_477, v ds
+# define BFI_FLINEAR1_478_TICK(t)
+# define BFI_FLINEAR1_477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_476, v ds
+# define BFI_FLINEAR1_477_TICK(t)
+# define BFI_FLINEAR1_476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_475, v ds
+# define BFI_FLINEAR1_476_TICK(t)
+# define BFI_FLINEAR1_475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_474, v ds
+# define BFI_FLINEAR1_475_TICK(t)
+# define BFI_FLINEAR1_474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_473, v ds
+# define BFI_FLINEAR1_474_TICK(t)
+# define BFI_FLINEAR1_473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_472, v ds
+# define BFI_FLINEAR1_473_TICK(t)
+# define BFI_FLINEAR1_472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_471, v ds
+# define BFI_FLINEAR1_472_TICK(t)
+# define BFI_FLINEAR1_471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_470, v ds
+# define BFI_FLINEAR1_471_TICK(t)
+# define BFI_FLINEAR1_470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_469, v ds
+# define BFI_FLINEAR1_470_TICK(t)
+# define BFI_FLINEAR1_469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_468, v ds
+# define BFI_FLINEAR1_469_TICK(t)
+# define BFI_FLINEAR1_468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_467, v ds
+# define BFI_FLINEAR1_468_TICK(t)
+# define BFI_FLINEAR1_467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_466, v ds
+# define BFI_FLINEAR1_467_TICK(t)
+# define BFI_FLINEAR1_466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_465, v ds
+# define BFI_FLINEAR1_466_TICK(t)
+# define BFI_FLINEAR1_465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_464, v ds
+# define BFI_FLINEAR1_465_TICK(t)
+# define BFI_FLINEAR1_464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_463, v ds
+# define BFI_FLINEAR1_464_TICK(t)
+# define BFI_FLINEAR1_463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_462, v ds
+# define BFI_FLINEAR1_463_TICK(t)
+# define BFI_FLINEAR1_462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_461, v ds
+# define BFI_FLINEAR1_462_TICK(t)
+# define BFI_FLINEAR1_461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_460, v ds
+# define BFI_FLINEAR1_461_TICK(t)
+# define BFI_FLINEAR1_460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_459, v ds
+# define BFI_FLINEAR1_460_TICK(t)
+# define BFI_FLINEAR1_459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_458, v ds
+# define BFI_FLINEAR1_459_TICK(t)
+# define BFI_FLINEAR1_458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_457, v ds
+# define BFI_FLINEAR1_458_TICK(t)
+# define BFI_FLINEAR1_457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_456, v ds
+# define BFI_FLINEAR1_457_TICK(t)
+# define BFI_FLINEAR1_456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_455, v ds
+# define BFI_FLINEAR1_456_TICK(t)
+# define BFI_FLINEAR1_455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_454, v ds
+# define BFI_FLINEAR1_455_TICK(t)
+# define BFI_FLINEAR1_454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_453, v ds
+# define BFI_FLINEAR1_454_TICK(t)
+# define BFI_FLINEAR1_453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_452, v ds
+# define BFI_FLINEAR1_453_TICK(t)
+# define BFI_FLINEAR1_452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_451, v ds
+# define BFI_FLINEAR1_452_TICK(t)
+# define BFI_FLINEAR1_451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_450, v ds
+# define BFI_FLINEAR1_451_TICK(t)
+# define BFI_FLINEAR1_450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_449, v ds
+# define BFI_FLINEAR1_450_TICK(t)
+# define BFI_FLINEAR1_449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_448, v ds
+# define BFI_FLINEAR1_449_TICK(t)
+# define BFI_FLINEAR1_448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_447, v ds
+# define BFI_FLINEAR1_448_TICK(t)
+# define BFI_FLINEAR1_447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_446, v ds
+# define BFI_FLINEAR1_447_TICK(t)
+# define BFI_FLINEAR1_446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_445, v ds
+# define BFI_FLINEAR1_446_TICK(t)
+# define BFI_FLINEAR1_445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_444, v ds
+# define BFI_FLINEAR1_445_TICK(t)
+# define BFI_FLINEAR1_444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_443, v ds
+# define BFI_FLINEAR1_444_TICK(t)
+# define BFI_FLINEAR1_443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_442, v ds
+# define BFI_FLINEAR1_443_TICK(t)
+# define BFI_FLINEAR1_442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_441, v ds
+# define BFI_FLINEAR1_442_TICK(t)
+# define BFI_FLINEAR1_441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_440, v ds
+# define BFI_FLINEAR1_441_TICK(t)
+# define BFI_FLINEAR1_440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_439, v ds
+# define BFI_FLINEAR1_440_TICK(t)
+# define BFI_FLINEAR1_439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_438, v ds
+# define BFI_FLINEAR1_439_TICK(t)
+# define BFI_FLINEAR1_438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_437, v ds
+# define BFI_FLINEAR1_438_TICK(t)
+# define BFI_FLINEAR1_437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_436, v ds
+# define BFI_FLINEAR1_437_TICK(t)
+# define BFI_FLINEAR1_436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_435, v ds
+# define BFI_FLINEAR1_436_TICK(t)
+# define BFI_FLINEAR1_435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_434, v ds
+# define BFI_FLINEAR1_435_TICK(t)
+# define BFI_FLINEAR1_434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_433, v ds
+# define BFI_FLINEAR1_434_TICK(t)
+# define BFI_FLINEAR1_433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_432, v ds
+# define BFI_FLINEAR1_433_TICK(t)
+# define BFI_FLINEAR1_432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_431, v ds
+# define BFI_FLINEAR1_432_TICK(t)
+# define BFI_FLINEAR1_431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_430, v ds
+# define BFI_FLINEAR1_431_TICK(t)
+# define BFI_FLINEAR1_430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_429, v ds
+# define BFI_FLINEAR1_430_TICK(t)
+# define BFI_FLINEAR1_429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_428, v ds
+# define BFI_FLINEAR1_429_TICK(t)
+# define BFI_FLINEAR1_428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_427, v ds
+# define BFI_FLINEAR1_428_TICK(t)
+# define BFI_FLINEAR1_427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_426, v ds
+# define BFI_FLINEAR1_427_TICK(t)
+# define BFI_FLINEAR1_426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_425, v ds
+# define BFI_FLINEAR1_426_TICK(t)
+# define BFI_FLINEAR1_425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_424, v ds
+# define BFI_FLINEAR1_425_TICK(t)
+# define BFI_FLINEAR1_424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_423, v ds
+# define BFI_FLINEAR1_424_TICK(t)
+# define BFI_FLINEAR1_423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_422, v ds
+# define BFI_FLINEAR1_423_TICK(t)
+# define BFI_FLINEAR1_422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_421, v ds
+# define BFI_FLINEAR1_422_TICK(t)
+# define BFI_FLINEAR1_421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_420, v ds
+# define BFI_FLINEAR1_421_TICK(t)
+# define BFI_FLINEAR1_420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_419, v ds
+# define BFI_FLINEAR1_420_TICK(t)
+# define BFI_FLINEAR1_419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_418, v ds
+# define BFI_FLINEAR1_419_TICK(t)
+# define BFI_FLINEAR1_418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_417, v ds
+# define BFI_FLINEAR1_418_TICK(t)
+# define BFI_FLINEAR1_417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_416, v ds
+# define BFI_FLINEAR1_417_TICK(t)
+# define BFI_FLINEAR1_416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_415, v ds
+# define BFI_FLINEAR1_416_TICK(t)
+# define BFI_FLINEAR1_415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_414, v ds
+# define BFI_FLINEAR1_415_TICK(t)
+# define BFI_FLINEAR1_414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_413, v ds
+# define BFI_FLINEAR1_414_TICK(t)
+# define BFI_FLINEAR1_413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_412, v ds
+# define BFI_FLINEAR1_413_TICK(t)
+# define BFI_FLINEAR1_412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_411, v ds
+# define BFI_FLINEAR1_412_TICK(t)
+# define BFI_FLINEAR1_411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_410, v ds
+# define BFI_FLINEAR1_411_TICK(t)
+# define BFI_FLINEAR1_410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_409, v ds
+# define BFI_FLINEAR1_410_TICK(t)
+# define BFI_FLINEAR1_409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_408, v ds
+# define BFI_FLINEAR1_409_TICK(t)
+# define BFI_FLINEAR1_408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_407, v ds
+# define BFI_FLINEAR1_408_TICK(t)
+# define BFI_FLINEAR1_407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_406, v ds
+# define BFI_FLINEAR1_407_TICK(t)
+# define BFI_FLINEAR1_406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_405, v ds
+# define BFI_FLINEAR1_406_TICK(t)
+# define BFI_FLINEAR1_405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_404, v ds
+# define BFI_FLINEAR1_405_TICK(t)
+# define BFI_FLINEAR1_404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_403, v ds
+# define BFI_FLINEAR1_404_TICK(t)
+# define BFI_FLINEAR1_403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_402, v ds
+# define BFI_FLINEAR1_403_TICK(t)
+# define BFI_FLINEAR1_402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_401, v ds
+# define BFI_FLINEAR1_402_TICK(t)
+# define BFI_FLINEAR1_401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_400, v ds
+# define BFI_FLINEAR1_401_TICK(t)
+# define BFI_FLINEAR1_400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_399, v ds
+# define BFI_FLINEAR1_400_TICK(t)
+# define BFI_FLINEAR1_399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_398, v ds
+# define BFI_FLINEAR1_399_TICK(t)
+# define BFI_FLINEAR1_398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_397, v ds
+# define BFI_FLINEAR1_398_TICK(t)
+# define BFI_FLINEAR1_397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_396, v ds
+# define BFI_FLINEAR1_397_TICK(t)
+# define BFI_FLINEAR1_396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_395, v ds
+# define BFI_FLINEAR1_396_TICK(t)
+# define BFI_FLINEAR1_395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_394, v ds
+# define BFI_FLINEAR1_395_TICK(t)
+# define BFI_FLINEAR1_394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_393, v ds
+# define BFI_FLINEAR1_394_TICK(t)
+# define BFI_FLINEAR1_393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_392, v ds
+# define BFI_FLINEAR1_393_TICK(t)
+# define BFI_FLINEAR1_392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_391, v ds
+# define BFI_FLINEAR1_392_TICK(t)
+# define BFI_FLINEAR1_391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_390, v ds
+# define BFI_FLINEAR1_391_TICK(t)
+# define BFI_FLINEAR1_390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_389, v ds
+# define BFI_FLINEAR1_390_TICK(t)
+# define BFI_FLINEAR1_389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_388, v ds
+# define BFI_FLINEAR1_389_TICK(t)
+# define BFI_FLINEAR1_388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_387, v ds
+# define BFI_FLINEAR1_388_TICK(t)
+# define BFI_FLINEAR1_387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_386, v ds
+# define BFI_FLINEAR1_387_TICK(t)
+# define BFI_FLINEAR1_386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_385, v ds
+# define BFI_FLINEAR1_386_TICK(t)
+# define BFI_FLINEAR1_385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_384, v ds
+# define BFI_FLINEAR1_385_TICK(t)
+# define BFI_FLINEAR1_384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_383, v ds
+# define BFI_FLINEAR1_384_TICK(t)
+# define BFI_FLINEAR1_383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_382, v ds
+# define BFI_FLINEAR1_383_TICK(t)
+# define BFI_FLINEAR1_382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_381, v ds
+# define BFI_FLINEAR1_382_TICK(t)
+# define BFI_FLINEAR1_381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_380, v ds
+# define BFI_FLINEAR1_381_TICK(t)
+# define BFI_FLINEAR1_380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_379, v ds
+# define BFI_FLINEAR1_380_TICK(t)
+# define BFI_FLINEAR1_379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_378, v ds
+# define BFI_FLINEAR1_379_TICK(t)
+# define BFI_FLINEAR1_378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_377, v ds
+# define BFI_FLINEAR1_378_TICK(t)
+# define BFI_FLINEAR1_377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_376, v ds
+# define BFI_FLINEAR1_377_TICK(t)
+# define BFI_FLINEAR1_376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_375, v ds
+# define BFI_FLINEAR1_376_TICK(t)
+# define BFI_FLINEAR1_375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_374, v ds
+# define BFI_FLINEAR1_375_TICK(t)
+# define BFI_FLINEAR1_374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_373, v ds
+# define BFI_FLINEAR1_374_TICK(t)
+# define BFI_FLINEAR1_373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_372, v ds
+# define BFI_FLINEAR1_373_TICK(t)
+# define BFI_FLINEAR1_372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_371, v ds
+# define BFI_FLINEAR1_372_TICK(t)
+# define BFI_FLINEAR1_371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_370, v ds
+# define BFI_FLINEAR1_371_TICK(t)
+# define BFI_FLINEAR1_370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_369, v ds
+# define BFI_FLINEAR1_370_TICK(t)
+# define BFI_FLINEAR1_369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_368, v ds
+# define BFI_FLINEAR1_369_TICK(t)
+# define BFI_FLINEAR1_368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_367, v ds
+# define BFI_FLINEAR1_368_TICK(t)
+# define BFI_FLINEAR1_367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_366, v ds
+# define BFI_FLINEAR1_367_TICK(t)
+# define BFI_FLINEAR1_366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_365, v ds
+# define BFI_FLINEAR1_366_TICK(t)
+# define BFI_FLINEAR1_365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_364, v ds
+# define BFI_FLINEAR1_365_TICK(t)
+# define BFI_FLINEAR1_364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_363, v ds
+# define BFI_FLINEAR1_364_TICK(t)
+# define BFI_FLINEAR1_363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_362, v ds
+# define BFI_FLINEAR1_363_TICK(t)
+# define BFI_FLINEAR1_362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_361, v ds
+# define BFI_FLINEAR1_362_TICK(t)
+# define BFI_FLINEAR1_361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_360, v ds
+# define BFI_FLINEAR1_361_TICK(t)
+# define BFI_FLINEAR1_360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_359, v ds
+# define BFI_FLINEAR1_360_TICK(t)
+# define BFI_FLINEAR1_359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_358, v ds
+# define BFI_FLINEAR1_359_TICK(t)
+# define BFI_FLINEAR1_358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_357, v ds
+# define BFI_FLINEAR1_358_TICK(t)
+# define BFI_FLINEAR1_357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_356, v ds
+# define BFI_FLINEAR1_357_TICK(t)
+# define BFI_FLINEAR1_356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_355, v ds
+# define BFI_FLINEAR1_356_TICK(t)
+# define BFI_FLINEAR1_355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_354, v ds
+# define BFI_FLINEAR1_355_TICK(t)
+# define BFI_FLINEAR1_354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_353, v ds
+# define BFI_FLINEAR1_354_TICK(t)
+# define BFI_FLINEAR1_353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_352, v ds
+# define BFI_FLINEAR1_353_TICK(t)
+# define BFI_FLINEAR1_352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_351, v ds
+# define BFI_FLINEAR1_352_TICK(t)
+# define BFI_FLINEAR1_351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_350, v ds
+# define BFI_FLINEAR1_351_TICK(t)
+# define BFI_FLINEAR1_350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_349, v ds
+# define BFI_FLINEAR1_350_TICK(t)
+# define BFI_FLINEAR1_349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_348, v ds
+# define BFI_FLINEAR1_349_TICK(t)
+# define BFI_FLINEAR1_348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_347, v ds
+# define BFI_FLINEAR1_348_TICK(t)
+# define BFI_FLINEAR1_347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_346, v ds
+# define BFI_FLINEAR1_347_TICK(t)
+# define BFI_FLINEAR1_346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_345, v ds
+# define BFI_FLINEAR1_346_TICK(t)
+# define BFI_FLINEAR1_345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_344, v ds
+# define BFI_FLINEAR1_345_TICK(t)
+# define BFI_FLINEAR1_344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_343, v ds
+# define BFI_FLINEAR1_344_TICK(t)
+# define BFI_FLINEAR1_343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_342, v ds
+# define BFI_FLINEAR1_343_TICK(t)
+# define BFI_FLINEAR1_342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_341, v ds
+# define BFI_FLINEAR1_342_TICK(t)
+# define BFI_FLINEAR1_341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_340, v ds
+# define BFI_FLINEAR1_341_TICK(t)
+# define BFI_FLINEAR1_340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_339, v ds
+# define BFI_FLINEAR1_340_TICK(t)
+# define BFI_FLINEAR1_339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_338, v ds
+# define BFI_FLINEAR1_339_TICK(t)
+# define BFI_FLINEAR1_338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_337, v ds
+# define BFI_FLINEAR1_338_TICK(t)
+# define BFI_FLINEAR1_337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_336, v ds
+# define BFI_FLINEAR1_337_TICK(t)
+# define BFI_FLINEAR1_336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_335, v ds
+# define BFI_FLINEAR1_336_TICK(t)
+# define BFI_FLINEAR1_335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_334, v ds
+# define BFI_FLINEAR1_335_TICK(t)
+# define BFI_FLINEAR1_334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_333, v ds
+# define BFI_FLINEAR1_334_TICK(t)
+# define BFI_FLINEAR1_333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_332, v ds
+# define BFI_FLINEAR1_333_TICK(t)
+# define BFI_FLINEAR1_332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_331, v ds
+# define BFI_FLINEAR1_332_TICK(t)
+# define BFI_FLINEAR1_331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_330, v ds
+# define BFI_FLINEAR1_331_TICK(t)
+# define BFI_FLINEAR1_330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_329, v ds
+# define BFI_FLINEAR1_330_TICK(t)
+# define BFI_FLINEAR1_329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_328, v ds
+# define BFI_FLINEAR1_329_TICK(t)
+# define BFI_FLINEAR1_328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_327, v ds
+# define BFI_FLINEAR1_328_TICK(t)
+# define BFI_FLINEAR1_327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_326, v ds
+# define BFI_FLINEAR1_327_TICK(t)
+# define BFI_FLINEAR1_326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_325, v ds
+# define BFI_FLINEAR1_326_TICK(t)
+# define BFI_FLINEAR1_325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_324, v ds
+# define BFI_FLINEAR1_325_TICK(t)
+# define BFI_FLINEAR1_324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_323, v ds
+# define BFI_FLINEAR1_324_TICK(t)
+# define BFI_FLINEAR1_323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_322, v ds
+# define BFI_FLINEAR1_323_TICK(t)
+# define BFI_FLINEAR1_322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_321, v ds
+# define BFI_FLINEAR1_322_TICK(t)
+# define BFI_FLINEAR1_321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_320, v ds
+# define BFI_FLINEAR1_321_TICK(t)
+# define BFI_FLINEAR1_320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_319, v ds
+# define BFI_FLINEAR1_320_TICK(t)
+# define BFI_FLINEAR1_319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_318, v ds
+# define BFI_FLINEAR1_319_TICK(t)
+# define BFI_FLINEAR1_318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_317, v ds
+# define BFI_FLINEAR1_318_TICK(t)
+# define BFI_FLINEAR1_317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_316, v ds
+# define BFI_FLINEAR1_317_TICK(t)
+# define BFI_FLINEAR1_316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_315, v ds
+# define BFI_FLINEAR1_316_TICK(t)
+# define BFI_FLINEAR1_315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_314, v ds
+# define BFI_FLINEAR1_315_TICK(t)
+# define BFI_FLINEAR1_314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_313, v ds
+# define BFI_FLINEAR1_314_TICK(t)
+# define BFI_FLINEAR1_313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_312, v ds
+# define BFI_FLINEAR1_313_TICK(t)
+# define BFI_FLINEAR1_312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_311, v ds
+# define BFI_FLINEAR1_312_TICK(t)
+# define BFI_FLINEAR1_311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_310, v ds
+# define BFI_FLINEAR1_311_TICK(t)
+# define BFI_FLINEAR1_310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_309, v ds
+# define BFI_FLINEAR1_310_TICK(t)
+# define BFI_FLINEAR1_309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_308, v ds
+# define BFI_FLINEAR1_309_TICK(t)
+# define BFI_FLINEAR1_308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_307, v ds
+# define BFI_FLINEAR1_308_TICK(t)
+# define BFI_FLINEAR1_307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_306, v ds
+# define BFI_FLINEAR1_307_TICK(t)
+# define BFI_FLINEAR1_306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_305, v ds
+# define BFI_FLINEAR1_306_TICK(t)
+# define BFI_FLINEAR1_305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_304, v ds
+# define BFI_FLINEAR1_305_TICK(t)
+# define BFI_FLINEAR1_304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_303, v ds
+# define BFI_FLINEAR1_304_TICK(t)
+# define BFI_FLINEAR1_303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_302, v ds
+# define BFI_FLINEAR1_303_TICK(t)
+# define BFI_FLINEAR1_302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_301, v ds
+# define BFI_FLINEAR1_302_TICK(t)
+# define BFI_FLINEAR1_301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_300, v ds
+# define BFI_FLINEAR1_301_TICK(t)
+# define BFI_FLINEAR1_300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_299, v ds
+# define BFI_FLINEAR1_300_TICK(t)
+# define BFI_FLINEAR1_299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_298, v ds
+# define BFI_FLINEAR1_299_TICK(t)
+# define BFI_FLINEAR1_298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_297, v ds
+# define BFI_FLINEAR1_298_TICK(t)
+# define BFI_FLINEAR1_297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_296, v ds
+# define BFI_FLINEAR1_297_TICK(t)
+# define BFI_FLINEAR1_296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_295, v ds
+# define BFI_FLINEAR1_296_TICK(t)
+# define BFI_FLINEAR1_295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_294, v ds
+# define BFI_FLINEAR1_295_TICK(t)
+# define BFI_FLINEAR1_294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_293, v ds
+# define BFI_FLINEAR1_294_TICK(t)
+# define BFI_FLINEAR1_293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_292, v ds
+# define BFI_FLINEAR1_293_TICK(t)
+# define BFI_FLINEAR1_292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_291, v ds
+# define BFI_FLINEAR1_292_TICK(t)
+# define BFI_FLINEAR1_291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_290, v ds
+# define BFI_FLINEAR1_291_TICK(t)
+# define BFI_FLINEAR1_290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_289, v ds
+# define BFI_FLINEAR1_290_TICK(t)
+# define BFI_FLINEAR1_289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_288, v ds
+# define BFI_FLINEAR1_289_TICK(t)
+# define BFI_FLINEAR1_288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_287, v ds
+# define BFI_FLINEAR1_288_TICK(t)
+# define BFI_FLINEAR1_287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_286, v ds
+# define BFI_FLINEAR1_287_TICK(t)
+# define BFI_FLINEAR1_286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_285, v ds
+# define BFI_FLINEAR1_286_TICK(t)
+# define BFI_FLINEAR1_285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_284, v ds
+# define BFI_FLINEAR1_285_TICK(t)
+# define BFI_FLINEAR1_284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_283, v ds
+# define BFI_FLINEAR1_284_TICK(t)
+# define BFI_FLINEAR1_283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_282, v ds
+# define BFI_FLINEAR1_283_TICK(t)
+# define BFI_FLINEAR1_282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_281, v ds
+# define BFI_FLINEAR1_282_TICK(t)
+# define BFI_FLINEAR1_281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_280, v ds
+# define BFI_FLINEAR1_281_TICK(t)
+# define BFI_FLINEAR1_280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_279, v ds
+# define BFI_FLINEAR1_280_TICK(t)
+# define BFI_FLINEAR1_279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_278, v ds
+# define BFI_FLINEAR1_279_TICK(t)
+# define BFI_FLINEAR1_278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_277, v ds
+# define BFI_FLINEAR1_278_TICK(t)
+# define BFI_FLINEAR1_277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_276, v ds
+# define BFI_FLINEAR1_277_TICK(t)
+# define BFI_FLINEAR1_276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_275, v ds
+# define BFI_FLINEAR1_276_TICK(t)
+# define BFI_FLINEAR1_275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_274, v ds
+# define BFI_FLINEAR1_275_TICK(t)
+# define BFI_FLINEAR1_274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_273, v ds
+# define BFI_FLINEAR1_274_TICK(t)
+# define BFI_FLINEAR1_273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_272, v ds
+# define BFI_FLINEAR1_273_TICK(t)
+# define BFI_FLINEAR1_272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_271, v ds
+# define BFI_FLINEAR1_272_TICK(t)
+# define BFI_FLINEAR1_271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_270, v ds
+# define BFI_FLINEAR1_271_TICK(t)
+# define BFI_FLINEAR1_270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_269, v ds
+# define BFI_FLINEAR1_270_TICK(t)
+# define BFI_FLINEAR1_269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_268, v ds
+# define BFI_FLINEAR1_269_TICK(t)
+# define BFI_FLINEAR1_268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_267, v ds
+# define BFI_FLINEAR1_268_TICK(t)
+# define BFI_FLINEAR1_267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_266, v ds
+# define BFI_FLINEAR1_267_TICK(t)
+# define BFI_FLINEAR1_266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_265, v ds
+# define BFI_FLINEAR1_266_TICK(t)
+# define BFI_FLINEAR1_265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_264, v ds
+# define BFI_FLINEAR1_265_TICK(t)
+# define BFI_FLINEAR1_264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_263, v ds
+# define BFI_FLINEAR1_264_TICK(t)
+# define BFI_FLINEAR1_263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_262, v ds
+# define BFI_FLINEAR1_263_TICK(t)
+# define BFI_FLINEAR1_262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_261, v ds
+# define BFI_FLINEAR1_262_TICK(t)
+# define BFI_FLINEAR1_261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_260, v ds
+# define BFI_FLINEAR1_261_TICK(t)
+# define BFI_FLINEAR1_260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_259, v ds
+# define BFI_FLINEAR1_260_TICK(t)
+# define BFI_FLINEAR1_259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_258, v ds
+# define BFI_FLINEAR1_259_TICK(t)
+# define BFI_FLINEAR1_258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_257, v ds
+# define BFI_FLINEAR1_258_TICK(t)
+# define BFI_FLINEAR1_257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_256, v ds
+# define BFI_FLINEAR1_257_TICK(t)
+
+# endif
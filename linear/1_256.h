@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_1_256_H
+# define BFI_LINEAR_1_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR1_256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_255, v ds
+# define BFI_FLINEAR1_256_TICK(t)
+# define BFI_FLINEAR1_255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_254, v ds
+# define BFI_FLINEAR1_255_TICK(t)
+# define BFI_FLINEAR1_254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_253, v ds
+# define BFI_FLINEAR1_254_TICK(t)
+# define BFI_FLINEAR1_253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_252, v ds
+# define BFI_FLINEAR1_253_TICK(t)
+# define BFI_FLINEAR1_252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_251, v ds
+# define BFI_FLINEAR1_252_TICK(t)
+# define BFI_FLINEAR1_251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_250, v ds
+# define BFI_FLINEAR1_251_TICK(t)
+# define BFI_FLINEAR1_250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_249, v ds
+# define BFI_FLINEAR1_250_TICK(t)
+# define BFI_FLINEAR1_249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_248, v ds
+# define BFI_FLINEAR1_249_TICK(t)
+# define BFI_FLINEAR1_248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_247, v ds
+# define BFI_FLINEAR1_248_TICK(t)
+# define BFI_FLINEAR1_247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_246, v ds
+# define BFI_FLINEAR1_247_TICK(t)
+# define BFI_FLINEAR1_246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_245, v ds
+# define BFI_FLINEAR1_246_TICK(t)
+# define BFI_FLINEAR1_245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_244, v ds
+# define BFI_FLINEAR1_245_TICK(t)
+# define BFI_FLINEAR1_244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_243, v ds
+# define BFI_FLINEAR1_244_TICK(t)
+# define BFI_FLINEAR1_243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_242, v ds
+# define BFI_FLINEAR1_243_TICK(t)
+# define BFI_FLINEAR1_242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_241, v ds
+# define BFI_FLINEAR1_242_TICK(t)
+# define BFI_FLINEAR1_241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_240, v ds
+# define BFI_FLINEAR1_241_TICK(t)
+# define BFI_FLINEAR1_240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_239, v ds
+# define BFI_FLINEAR1_240_TICK(t)
+# define BFI_FLINEAR1_239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_238, v ds
+# define BFI_FLINEAR1_239_TICK(t)
+# define BFI_FLINEAR1_238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_237, v ds
+# define BFI_FLINEAR1_238_TICK(t)
+# define BFI_FLINEAR1_237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_236, v ds
+# define BFI_FLINEAR1_237_TICK(t)
+# define BFI_FLINEAR1_236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_235, v ds
+# define BFI_FLINEAR1_236_TICK(t)
+# define BFI_FLINEAR1_235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_234, v ds
+# define BFI_FLINEAR1_235_TICK(t)
+# define BFI_FLINEAR1_234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_233, v ds
+# define BFI_FLINEAR1_234_TICK(t)
+# define BFI_FLINEAR1_233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_232, v ds
+# define BFI_FLINEAR1_233_TICK(t)
+# define BFI_FLINEAR1_232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_231, v ds
+# define BFI_FLINEAR1_232_TICK(t)
+# define BFI_FLINEAR1_231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_230, v ds
+# define BFI_FLINEAR1_231_TICK(t)
+# define BFI_FLINEAR1_230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_229, v ds
+# define BFI_FLINEAR1_230_TICK(t)
+# define BFI_FLINEAR1_229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_228, v ds
+# define BFI_FLINEAR1_229_TICK(t)
+# define BFI_FLINEAR1_228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_227, v ds
+# define BFI_FLINEAR1_228_TICK(t)
+# define BFI_FLINEAR1_227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_226, v ds
+# define BFI_FLINEAR1_227_TICK(t)
+# define BFI_FLINEAR1_226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_225, v ds
+# define BFI_FLINEAR1_226_TICK(t)
+# define BFI_FLINEAR1_225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_224, v ds
+# define BFI_FLINEAR1_225_TICK(t)
+# define BFI_FLINEAR1_224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_223, v ds
+# define BFI_FLINEAR1_224_TICK(t)
+# define BFI_FLINEAR1_223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_222, v ds
+# define BFI_FLINEAR1_223_TICK(t)
+# define BFI_FLINEAR1_222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_221, v ds
+# define BFI_FLINEAR1_222_TICK(t)
+# define BFI_FLINEAR1_221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_220, v ds
+# define BFI_FLINEAR1_221_TICK(t)
+# define BFI_FLINEAR1_220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_219, v ds
+# define BFI_FLINEAR1_220_TICK(t)
+# define BFI_FLINEAR1_219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_218, v ds
+# define BFI_FLINEAR1_219_TICK(t)
+# define BFI_FLINEAR1_218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_217, v ds
+# define BFI_FLINEAR1_218_TICK(t)
+# define BFI_FLINEAR1_217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_216, v ds
+# define BFI_FLINEAR1_217_TICK(t)
+# define BFI_FLINEAR1_216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_215, v ds
+# define BFI_FLINEAR1_216_TICK(t)
+# define BFI_FLINEAR1_215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_214, v ds
+# define BFI_FLINEAR1_215_TICK(t)
+# define BFI_FLINEAR1_214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_213, v ds
+# define BFI_FLINEAR1_214_TICK(t)
+# define BFI_FLINEAR1_213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_212, v ds
+# define BFI_FLINEAR1_213_TICK(t)
+# define BFI_FLINEAR1_212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_211, v ds
+# define BFI_FLINEAR1_212_TICK(t)
+# define BFI_FLINEAR1_211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_210, v ds
+# define BFI_FLINEAR1_211_TICK(t)
+# define BFI_FLINEAR1_210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_209, v ds
+# define BFI_FLINEAR1_210_TICK(t)
+# define BFI_FLINEAR1_209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_208, v ds
+# define BFI_FLINEAR1_209_TICK(t)
+# define BFI_FLINEAR1_208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_207, v ds
+# define BFI_FLINEAR1_208_TICK(t)
+# define BFI_FLINEAR1_207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_206, v ds
+# define BFI_FLINEAR1_207_TICK(t)
+# define BFI_FLINEAR1_206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_205, v ds
+# define BFI_FLINEAR1_206_TICK(t)
+# define BFI_FLINEAR1_205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_204, v ds
+# define BFI_FLINEAR1_205_TICK(t)
+# define BFI_FLINEAR1_204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_203, v ds
+# define BFI_FLINEAR1_204_TICK(t)
+# define BFI_FLINEAR1_203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_202, v ds
+# define BFI_FLINEAR1_203_TICK(t)
+# define BFI_FLINEAR1_202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_201, v ds
+# define BFI_FLINEAR1_202_TICK(t)
+# define BFI_FLINEAR1_201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_200, v ds
+# define BFI_FLINEAR1_201_TICK(t)
+# define BFI_FLINEAR1_200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_199, v ds
+# define BFI_FLINEAR1_200_TICK(t)
+# define BFI_FLINEAR1_199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_198, v ds
+# define BFI_FLINEAR1_199_TICK(t)
+# define BFI_FLINEAR1_198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_197, v ds
+# define BFI_FLINEAR1_198_TICK(t)
+# define BFI_FLINEAR1_197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_196, v ds
+# define BFI_FLINEAR1_197_TICK(t)
+# define BFI_FLINEAR1_196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_195, v ds
+# define BFI_FLINEAR1_196_TICK(t)
+# define BFI_FLINEAR1_195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_194, v ds
+# define BFI_FLINEAR1_195_TICK(t)
+# define BFI_FLINEAR1_194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_193, v ds
+# define BFI_FLINEAR1_194_TICK(t)
+# define BFI_FLINEAR1_193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_192, v ds
+# define BFI_FLINEAR1_193_TICK(t)
+# define BFI_FLINEAR1_192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_191, v ds
+# define BFI_FLINEAR1_192_TICK(t)
+# define BFI_FLINEAR1_191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_190, v ds
+# define BFI_FLINEAR1_191_TICK(t)
+# define BFI_FLINEAR1_190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_189, v ds
+# define BFI_FLINEAR1_190_TICK(t)
+# define BFI_FLINEAR1_189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_188, v ds
+# define BFI_FLINEAR1_189_TICK(t)
+# define BFI_FLINEAR1_188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_187, v ds
+# define BFI_FLINEAR1_188_TICK(t)
+# define BFI_FLINEAR1_187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_186, v ds
+# define BFI_FLINEAR1_187_TICK(t)
+# define BFI_FLINEAR1_186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_185, v ds
+# define BFI_FLINEAR1_186_TICK(t)
+# define BFI_FLINEAR1_185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_184, v ds
+# define BFI_FLINEAR1_185_TICK(t)
+# define BFI_FLINEAR1_184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_183, v ds
+# define BFI_FLINEAR1_184_TICK(t)
+# define BFI_FLINEAR1_183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_182, v ds
+# define BFI_FLINEAR1_183_TICK(t)
+# define BFI_FLINEAR1_182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_181, v ds
+# define BFI_FLINEAR1_182_TICK(t)
+# define BFI_FLINEAR1_181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_180, v ds
+# define BFI_FLINEAR1_181_TICK(t)
+# define BFI_FLINEAR1_180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_179, v ds
+# define BFI_FLINEAR1_180_TICK(t)
+# define BFI_FLINEAR1_179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_178, v ds
+# define BFI_FLINEAR1_179_TICK(t)
+# define BFI_FLINEAR1_178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_177, v ds
+# define BFI_FLINEAR1_178_TICK(t)
+# define BFI_FLINEAR1_177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_176, v ds
+# define BFI_FLINEAR1_177_TICK(t)
+# define BFI_FLINEAR1_176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_175, v ds
+# define BFI_FLINEAR1_176_TICK(t)
+# define BFI_FLINEAR1_175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_174, v ds
+# define BFI_FLINEAR1_175_TICK(t)
+# define BFI_FLINEAR1_174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_173, v ds
+# define BFI_FLINEAR1_174_TICK(t)
+# define BFI_FLINEAR1_173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_172, v ds
+# define BFI_FLINEAR1_173_TICK(t)
+# define BFI_FLINEAR1_172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_171, v ds
+# define BFI_FLINEAR1_172_TICK(t)
+# define BFI_FLINEAR1_171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_170, v ds
+# define BFI_FLINEAR1_171_TICK(t)
+# define BFI_FLINEAR1_170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_169, v ds
+# define BFI_FLINEAR1_170_TICK(t)
+# define BFI_FLINEAR1_169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_168, v ds
+# define BFI_FLINEAR1_169_TICK(t)
+# define BFI_FLINEAR1_168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_167, v ds
+# define BFI_FLINEAR1_168_TICK(t)
+# define BFI_FLINEAR1_167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_166, v ds
+# define BFI_FLINEAR1_167_TICK(t)
+# define BFI_FLINEAR1_166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_165, v ds
+# define BFI_FLINEAR1_166_TICK(t)
+# define BFI_FLINEAR1_165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_164, v ds
+# define BFI_FLINEAR1_165_TICK(t)
+# define BFI_FLINEAR1_164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_163, v ds
+# define BFI_FLINEAR1_164_TICK(t)
+# define BFI_FLINEAR1_163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_162, v ds
+# define BFI_FLINEAR1_163_TICK(t)
+# define BFI_FLINEAR1_162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_161, v ds
+# define BFI_FLINEAR1_162_TICK(t)
+# define BFI_FLINEAR1_161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_160, v ds
+# define BFI_FLINEAR1_161_TICK(t)
+# define BFI_FLINEAR1_160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_159, v ds
+# define BFI_FLINEAR1_160_TICK(t)
+# define BFI_FLINEAR1_159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_158, v ds
+# define BFI_FLINEAR1_159_TICK(t)
+# define BFI_FLINEAR1_158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_157, v ds
+# define BFI_FLINEAR1_158_TICK(t)
+# define BFI_FLINEAR1_157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_156, v ds
+# define BFI_FLINEAR1_157_TICK(t)
+# define BFI_FLINEAR1_156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_155, v ds
+# define BFI_FLINEAR1_156_TICK(t)
+# define BFI_FLINEAR1_155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_154, v ds
+# define BFI_FLINEAR1_155_TICK(t)
+# define BFI_FLINEAR1_154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_153, v ds
+# define BFI_FLINEAR1_154_TICK(t)
+# define BFI_FLINEAR1_153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_152, v ds
+# define BFI_FLINEAR1_153_TICK(t)
+# define BFI_FLINEAR1_152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_151, v ds
+# define BFI_FLINEAR1_152_TICK(t)
+# define BFI_FLINEAR1_151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_150, v ds
+# define BFI_FLINEAR1_151_TICK(t)
+# define BFI_FLINEAR1_150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_149, v ds
+# define BFI_FLINEAR1_150_TICK(t)
+# define BFI_FLINEAR1_149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_148, v ds
+# define BFI_FLINEAR1_149_TICK(t)
+# define BFI_FLINEAR1_148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_147, v ds
+# define BFI_FLINEAR1_148_TICK(t)
+# define BFI_FLINEAR1_147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_146, v ds
+# define BFI_FLINEAR1_147_TICK(t)
+# define BFI_FLINEAR1_146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_145, v ds
+# define BFI_FLINEAR1_146_TICK(t)
+# define BFI_FLINEAR1_145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_144, v ds
+# define BFI_FLINEAR1_145_TICK(t)
+# define BFI_FLINEAR1_144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_143, v ds
+# define BFI_FLINEAR1_144_TICK(t)
+# define BFI_FLINEAR1_143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_142, v ds
+# define BFI_FLINEAR1_143_TICK(t)
+# define BFI_FLINEAR1_142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_141, v ds
+# define BFI_FLINEAR1_142_TICK(t)
+# define BFI_FLINEAR1_141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_140, v ds
+# define BFI_FLINEAR1_141_TICK(t)
+# define BFI_FLINEAR1_140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_139, v ds
+# define BFI_FLINEAR1_140_TICK(t)
+# define BFI_FLINEAR1_139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_138, v ds
+# define BFI_FLINEAR1_139_TICK(t)
+# define BFI_FLINEAR1_138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_137, v ds
+# define BFI_FLINEAR1_138_TICK(t)
+# define BFI_FLINEAR1_137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_136, v ds
+# define BFI_FLINEAR1_137_TICK(t)
+# define BFI_FLINEAR1_136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_135, v ds
+# define BFI_FLINEAR1_136_TICK(t)
+# define BFI_FLINEAR1_135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_134, v ds
+# define BFI_FLINEAR1_135_TICK(t)
+# define BFI_FLINEAR1_134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_133, v ds
+# define BFI_FLINEAR1_134_TICK(t)
+# define BFI_FLINEAR1_133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_132, v ds
+# define BFI_FLINEAR1_133_TICK(t)
+# define BFI_FLINEAR1_132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_131, v ds
+# define BFI_FLINEAR1_132_TICK(t)
+# define BFI_FLINEAR1_131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_130, v ds
+# define BFI_FLINEAR1_131_TICK(t)
+# define BFI_FLINEAR1_130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_129, v ds
+# define BFI_FLINEAR1_130_TICK(t)
+# define BFI_FLINEAR1_129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_128, v ds
+# define BFI_FLINEAR1_129_TICK(t)
+# define BFI_FLINEAR1_128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_127, v ds
+# define BFI_FLINEAR1_128_TICK(t)
+# define BFI_FLINEAR1_127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_126, v ds
+# define BFI_FLINEAR1_127_TICK(t)
+# define BFI_FLINEAR1_126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_125, v ds
+# define BFI_FLINEAR1_126_TICK(t)
+# define BFI_FLINEAR1_125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_124, v ds
+# define BFI_FLINEAR1_125_TICK(t)
+# define BFI_FLINEAR1_124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_123, v ds
+# define BFI_FLINEAR1_124_TICK(t)
+# define BFI_FLINEAR1_123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_122, v ds
+# define BFI_FLINEAR1_123_TICK(t)
+# define BFI_FLINEAR1_122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_121, v ds
+# define BFI_FLINEAR1_122_TICK(t)
+# define BFI_FLINEAR1_121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_120, v ds
+# define BFI_FLINEAR1_121_TICK(t)
+# define BFI_FLINEAR1_120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_119, v ds
+# define BFI_FLINEAR1_120_TICK(t)
+# define BFI_FLINEAR1_119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_118, v ds
+# define BFI_FLINEAR1_119_TICK(t)
+# define BFI_FLINEAR1_118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_117, v ds
+# define BFI_FLINEAR1_118_TICK(t)
+# define BFI_FLINEAR1_117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_116, v ds
+# define BFI_FLINEAR1_117_TICK(t)
+# define BFI_FLINEAR1_116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_115, v ds
+# define BFI_FLINEAR1_116_TICK(t)
+# define BFI_FLINEAR1_115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_114, v ds
+# define BFI_FLINEAR1_115_TICK(t)
+# define BFI_FLINEAR1_114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_113, v ds
+# define BFI_FLINEAR1_114_TICK(t)
+# define BFI_FLINEAR1_113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_112, v ds
+# define BFI_FLINEAR1_113_TICK(t)
+# define BFI_FLINEAR1_112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_111, v ds
+# define BFI_FLINEAR1_112_TICK(t)
+# define BFI_FLINEAR1_111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_110, v ds
+# define BFI_FLINEAR1_111_TICK(t)
+# define BFI_FLINEAR1_110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_109, v ds
+# define BFI_FLINEAR1_110_TICK(t)
+# define BFI_FLINEAR1_109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_108, v ds
+# define BFI_FLINEAR1_109_TICK(t)
+# define BFI_FLINEAR1_108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_107, v ds
+# define BFI_FLINEAR1_108_TICK(t)
+# define BFI_FLINEAR1_107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_106, v ds
+# define BFI_FLINEAR1_107_TICK(t)
+# define BFI_FLINEAR1_106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_105, v ds
+# define BFI_FLINEAR1_106_TICK(t)
+# define BFI_FLINEAR1_105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_104, v ds
+# define BFI_FLINEAR1_105_TICK(t)
+# define BFI_FLINEAR1_104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_103, v ds
+# define BFI_FLINEAR1_104_TICK(t)
+# define BFI_FLINEAR1_103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_102, v ds
+# define BFI_FLINEAR1_103_TICK(t)
+# define BFI_FLINEAR1_102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_101, v ds
+# define BFI_FLINEAR1_102_TICK(t)
+# define BFI_FLINEAR1_101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_100, v ds
+# define BFI_FLINEAR1_101_TICK(t)
+# define BFI_FLINEAR1_100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_99, v ds
+# define BFI_FLINEAR1_100_TICK(t)
+# define BFI_FLINEAR1_99(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_98, v ds
+# define BFI_FLINEAR1_99_TICK(t)
+# define BFI_FLINEAR1_98(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_97, v ds
+# define BFI_FLINEAR1_98_TICK(t)
+# define BFI_FLINEAR1_97(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_96, v ds
+# define BFI_FLINEAR1_97_TICK(t)
+# define BFI_FLINEAR1_96(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_95, v ds
+# define BFI_FLINEAR1_96_TICK(t)
+# define BFI_FLINEAR1_95(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_94, v ds
+# define BFI_FLINEAR1_95_TICK(t)
+# define BFI_FLINEAR1_94(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_93, v ds
+# define BFI_FLINEAR1_94_TICK(t)
+# define BFI_FLINEAR1_93(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_92, v ds
+# define BFI_FLINEAR1_93_TICK(t)
+# define BFI_FLINEAR1_92(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_91, v ds
+# define BFI_FLINEAR1_92_TICK(t)
+# define BFI_FLINEAR1_91(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_90, v ds
+# define BFI_FLINEAR1_91_TICK(t)
+# define BFI_FLINEAR1_90(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_89, v ds
+# define BFI_FLINEAR1_90_TICK(t)
+# define BFI_FLINEAR1_89(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_88, v ds
+# define BFI_FLINEAR1_89_TICK(t)
+# define BFI_FLINEAR1_88(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_87, v ds
+# define BFI_FLINEAR1_88_TICK(t)
+# define BFI_FLINEAR1_87(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_86, v ds
+# define BFI_FLINEAR1_87_TICK(t)
+# define BFI_FLINEAR1_86(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_85, v ds
+# define BFI_FLINEAR1_86_TICK(t)
+# define BFI_FLINEAR1_85(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_84, v ds
+# define BFI_FLINEAR1_85_TICK(t)
+# define BFI_FLINEAR1_84(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_83, v ds
+# define BFI_FLINEAR1_84_TICK(t)
+# define BFI_FLINEAR1_83(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_82, v ds
+# define BFI_FLINEAR1_83_TICK(t)
+# define BFI_FLINEAR1_82(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_81, v ds
+# define BFI_FLINEAR1_82_TICK(t)
+# define BFI_FLINEAR1_81(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_80, v ds
+# define BFI_FLINEAR1_81_TICK(t)
+# define BFI_FLINEAR1_80(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_79, v ds
+# define BFI_FLINEAR1_80_TICK(t)
+# define BFI_FLINEAR1_79(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_78, v ds
+# define BFI_FLINEAR1_79_TICK(t)
+# define BFI_FLINEAR1_78(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_77, v ds
+# define BFI_FLINEAR1_78_TICK(t)
+# define BFI_FLINEAR1_77(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_76, v ds
+# define BFI_FLINEAR1_77_TICK(t)
+# define BFI_FLINEAR1_76(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_75, v ds
+# define BFI_FLINEAR1_76_TICK(t)
+# define BFI_FLINEAR1_75(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_74, v ds
+# define BFI_FLINEAR1_75_TICK(t)
+# define BFI_FLINEAR1_74(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_73, v ds
+# define BFI_FLINEAR1_74_TICK(t)
+# define BFI_FLINEAR1_73(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_72, v ds
+# define BFI_FLINEAR1_73_TICK(t)
+# define BFI_FLINEAR1_72(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_71, v ds
+# define BFI_FLINEAR1_72_TICK(t)
+# define BFI_FLINEAR1_71(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_70, v ds
+# define BFI_FLINEAR1_71_TICK(t)
+# define BFI_FLINEAR1_70(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_69, v ds
+# define BFI_FLINEAR1_70_TICK(t)
+# define BFI_FLINEAR1_69(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_68, v ds
+# define BFI_FLINEAR1_69_TICK(t)
+# define BFI_FLINEAR1_68(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_67, v ds
+# define BFI_FLINEAR1_68_TICK(t)
+# define BFI_FLINEAR1_67(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_66, v ds
+# define BFI_FLINEAR1_67_TICK(t)
+# define BFI_FLINEAR1_66(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_65, v ds
+# define BFI_FLINEAR1_66_TICK(t)
+# define BFI_FLINEAR1_65(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_64, v ds
+# define BFI_FLINEAR1_65_TICK(t)
+
+# endif
@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_1_4096_H
+# define BFI_LINEAR_1_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR1_4096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4095, v ds
+# define BFI_FLINEAR1_4096_TICK(t)
+# define BFI_FLINEAR1_4095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4094, v ds
+# define BFI_FLINEAR1_4095_TICK(t)
+# define BFI_FLINEAR1_4094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4093, v ds
+# define BFI_FLINEAR1_4094_TICK(t)
+# define BFI_FLINEAR1_4093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4092, v ds
+# define BFI_FLINEAR1_4093_TICK(t)
+# define BFI_FLINEAR1_4092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4091, v ds
+# define BFI_FLINEAR1_4092_TICK(t)
+# define BFI_FLINEAR1_4091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4090, v ds
+# define BFI_FLINEAR1_4091_TICK(t)
+# define BFI_FLINEAR1_4090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4089, v ds
+# define BFI_FLINEAR1_4090_TICK(t)
+# define BFI_FLINEAR1_4089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4088, v ds
+# define BFI_FLINEAR1_4089_TICK(t)
+# define BFI_FLINEAR1_4088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4087, v ds
+# define BFI_FLINEAR1_4088_TICK(t)
+# define BFI_FLINEAR1_4087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4086, v ds
+# define BFI_FLINEAR1_4087_TICK(t)
+# define BFI_FLINEAR1_4086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4085, v ds
+# define BFI_FLINEAR1_4086_TICK(t)
+# define BFI_FLINEAR1_4085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4084, v ds
+# define BFI_FLINEAR1_4085_TICK(t)
+# define BFI_FLINEAR1_4084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4083, v ds
+# define BFI_FLINEAR1_4084_TICK(t)
+# define BFI_FLINEAR1_4083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4082, v ds
+# define BFI_FLINEAR1_4083_TICK(t)
+# define BFI_FLINEAR1_4082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4081, v ds
+# define BFI_FLINEAR1_4082_TICK(t)
+# define BFI_FLINEAR1_4081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4080, v ds
+# define BFI_FLINEAR1_4081_TICK(t)
+# define BFI_FLINEAR1_4080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4079, v ds
+# define BFI_FLINEAR1_4080_TICK(t)
+# define BFI_FLINEAR1_4079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4078, v ds
+# define BFI_FLINEAR1_4079_TICK(t)
+# define BFI_FLINEAR1_4078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4077, v ds
+# define BFI_FLINEAR1_4078_TICK(t)
+# define BFI_FLINEAR1_4077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4076, v ds
+# define BFI_FLINEAR1_4077_TICK(t)
+# define BFI_FLINEAR1_4076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4075, v ds
+# define BFI_FLINEAR1_4076_TICK(t)
+# define BFI_FLINEAR1_4075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4074, v ds
+# define BFI_FLINEAR1_4075_TICK(t)
+# define BFI_FLINEAR1_4074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4073, v ds
+# define BFI_FLINEAR1_4074_TICK(t)
+# define BFI_FLINEAR1_4073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4072, v ds
+# define BFI_FLINEAR1_4073_TICK(t)
+# define BFI_FLINEAR1_4072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4071, v ds
+# define BFI_FLINEAR1_4072_TICK(t)
+# define BFI_FLINEAR1_4071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4070, v ds
+# define BFI_FLINEAR1_4071_TICK(t)
+# define BFI_FLINEAR1_4070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4069, v ds
+# define BFI_FLINEAR1_4070_TICK(t)
+# define BFI_FLINEAR1_4069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4068, v ds
+# define BFI_FLINEAR1_4069_TICK(t)
+# define BFI_FLINEAR1_4068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4067, v ds
+# define BFI_FLINEAR1_4068_TICK(t)
+# define BFI_FLINEAR1_4067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4066, v ds
+# define BFI_FLINEAR1_4067_TICK(t)
+# define BFI_FLINEAR1_4066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4065, v ds
+# define BFI_FLINEAR1_4066_TICK(t)
+# define BFI_FLINEAR1_4065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4064, v ds
+# define BFI_FLINEAR1_4065_TICK(t)
+# define BFI_FLINEAR1_4064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4063, v ds
+# define BFI_FLINEAR1_4064_TICK(t)
+# define BFI_FLINEAR1_4063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4062, v ds
+# define BFI_FLINEAR1_4063_TICK(t)
+# define BFI_FLINEAR1_4062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4061, v ds
+# define BFI_FLINEAR1_4062_TICK(t)
+# define BFI_FLINEAR1_4061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4060, v ds
+# define BFI_FLINEAR1_4061_TICK(t)
+# define BFI_FLINEAR1_4060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4059, v ds
+# define BFI_FLINEAR1_4060_TICK(t)
+# define BFI_FLINEAR1_4059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4058, v ds
+# define BFI_FLINEAR1_4059_TICK(t)
+# define BFI_FLINEAR1_4058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4057, v ds
+# define BFI_FLINEAR1_4058_TICK(t)
+# define BFI_FLINEAR1_4057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4056, v ds
+# define BFI_FLINEAR1_4057_TICK(t)
+# define BFI_FLINEAR1_4056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4055, v ds
+# define BFI_FLINEAR1_4056_TICK(t)
+# define BFI_FLINEAR1_4055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4054, v ds
+# define BFI_FLINEAR1_4055_TICK(t)
+# define BFI_FLINEAR1_4054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4053, v ds
+# define BFI_FLINEAR1_4054_TICK(t)
+# define BFI_FLINEAR1_4053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4052, v ds
+# define BFI_FLINEAR1_4053_TICK(t)
+# define BFI_FLINEAR1_4052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4051, v ds
+# define BFI_FLINEAR1_4052_TICK(t)
+# define BFI_FLINEAR1_4051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4050, v ds
+# define BFI_FLINEAR1_4051_TICK(t)
+# define BFI_FLINEAR1_4050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4049, v ds
+# define BFI_FLINEAR1_4050_TICK(t)
+# define BFI_FLINEAR1_4049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4048, v ds
+# define BFI_FLINEAR1_4049_TICK(t)
+# define BFI_FLINEAR1_4048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4047, v ds
+# define BFI_FLINEAR1_4048_TICK(t)
+# define BFI_FLINEAR1_4047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4046, v ds
+# define BFI_FLINEAR1_4047_TICK(t)
+# define BFI_FLINEAR1_4046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4045, v ds
+# define BFI_FLINEAR1_4046_TICK(t)
+# define BFI_FLINEAR1_4045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4044, v ds
+# define BFI_FLINEAR1_4045_TICK(t)
+# define BFI_FLINEAR1_4044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4043, v ds
+# define BFI_FLINEAR1_4044_TICK(t)
+# define BFI_FLINEAR1_4043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4042, v ds
+# define BFI_FLINEAR1_4043_TICK(t)
+# define BFI_FLINEAR1_4042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4041, v ds
+# define BFI_FLINEAR1_4042_TICK(t)
+# define BFI_FLINEAR1_4041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4040, v ds
+# define BFI_FLINEAR1_4041_TICK(t)
+# define BFI_FLINEAR1_4040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4039, v ds
+# define BFI_FLINEAR1_4040_TICK(t)
+# define BFI_FLINEAR1_4039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4038, v ds
+# define BFI_FLINEAR1_4039_TICK(t)
+# define BFI_FLINEAR1_4038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4037, v ds
+# define BFI_FLINEAR1_4038_TICK(t)
+# define BFI_FLINEAR1_4037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4036, v ds
+# define BFI_FLINEAR1_4037_TICK(t)
+# define BFI_FLINEAR1_4036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4035, v ds
+# define BFI_FLINEAR1_4036_TICK(t)
+# define BFI_FLINEAR1_4035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4034, v ds
+# define BFI_FLINEAR1_4035_TICK(t)
+# define BFI_FLINEAR1_4034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4033, v ds
+# define BFI_FLINEAR1_4034_TICK(t)
+# define BFI_FLINEAR1_4033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4032, v ds
+# define BFI_FLINEAR1_4033_TICK(t)
+# define BFI_FLINEAR1_4032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4031, v ds
+# define BFI_FLINEAR1_4032_TICK(t)
+# define BFI_FLINEAR1_4031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4030, v ds
+# define BFI_FLINEAR1_4031_TICK(t)
+# define BFI_FLINEAR1_4030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4029, v ds
+# define BFI_FLINEAR1_4030_TICK(t)
+# define BFI_FLINEAR1_4029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4028, v ds
+# define BFI_FLINEAR1_4029_TICK(t)
+# define BFI_FLINEAR1_4028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4027, v ds
+# define BFI_FLINEAR1_4028_TICK(t)
+# define BFI_FLINEAR1_4027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4026, v ds
+# define BFI_FLINEAR1_4027_TICK(t)
+# define BFI_FLINEAR1_4026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4025, v ds
+# define BFI_FLINEAR1_4026_TICK(t)
+# define BFI_FLINEAR1_4025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4024, v ds
+# define BFI_FLINEAR1_4025_TICK(t)
+# define BFI_FLINEAR1_4024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4023, v ds
+# define BFI_FLINEAR1_4024_TICK(t)
+# define BFI_FLINEAR1_4023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4022, v ds
+# define BFI_FLINEAR1_4023_TICK(t)
+# define BFI_FLINEAR1_4022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4021, v ds
+# define BFI_FLINEAR1_4022_TICK(t)
+# define BFI_FLINEAR1_4021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4020, v ds
+# define BFI_FLINEAR1_4021_TICK(t)
+# define BFI_FLINEAR1_4020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4019, v ds
+# define BFI_FLINEAR1_4020_TICK(t)
+# define BFI_FLINEAR1_4019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4018, v ds
+# define BFI_FLINEAR1_4019_TICK(t)
+# define BFI_FLINEAR1_4018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4017, v ds
+# define BFI_FLINEAR1_4018_TICK(t)
+# define BFI_FLINEAR1_4017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4016, v ds
+# define BFI_FLINEAR1_4017_TICK(t)
+# define BFI_FLINEAR1_4016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4015, v ds
+# define BFI_FLINEAR1_4016_TICK(t)
+# define BFI_FLINEAR1_4015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4014, v ds
+# define BFI_FLINEAR1_4015_TICK(t)
+# define BFI_FLINEAR1_4014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4013, v ds
+# define BFI_FLINEAR1_4014_TICK(t)
+# define BFI_FLINEAR1_4013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4012, v ds
+# define BFI_FLINEAR1_4013_TICK(t)
+# define BFI_FLINEAR1_4012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4011, v ds
+# define BFI_FLINEAR1_4012_TICK(t)
+# define BFI_FLINEAR1_4011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4010, v ds
+# define BFI_FLINEAR1_4011_TICK(t)
+# define BFI_FLINEAR1_4010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4009, v ds
+# define BFI_FLINEAR1_4010_TICK(t)
+# define BFI_FLINEAR1_4009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4008, v ds
+# define BFI_FLINEAR1_4009_TICK(t)
+# define BFI_FLINEAR1_4008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4007, v ds
+# define BFI_FLINEAR1_4008_TICK(t)
+# define BFI_FLINEAR1_4007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4006, v ds
+# define BFI_FLINEAR1_4007_TICK(t)
+# define BFI_FLINEAR1_4006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4005, v ds
+# define BFI_FLINEAR1_4006_TICK(t)
+# define BFI_FLINEAR1_4005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4004, v ds
+# define BFI_FLINEAR1_4005_TICK(t)
+# define BFI_FLINEAR1_4004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4003, v ds
+# define BFI_FLINEAR1_4004_TICK(t)
+# define BFI_FLINEAR1_4003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4002, v ds
+# define BFI_FLINEAR1_4003_TICK(t)
+# define BFI_FLINEAR1_4002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4001, v ds
+# define BFI_FLINEAR1_4002_TICK(t)
+# define BFI_FLINEAR1_4001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4000, v ds
+# define BFI_FLINEAR1_4001_TICK(t)
+# define BFI_FLINEAR1_4000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3999, v ds
+# define BFI_FLINEAR1_4000_TICK(t)
+# define BFI_FLINEAR1_3999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3998, v ds
+# define BFI_FLINEAR1_3999_TICK(t)
+# define BFI_FLINEAR1_3998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3997, v ds
+# define BFI_FLINEAR1_3998_TICK(t)
+# define BFI_FLINEAR1_3997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3996, v ds
+# define BFI_FLINEAR1_3997_TICK(t)
+# define BFI_FLINEAR1_3996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3995, v ds
+# define BFI_FLINEAR1_3996_TICK(t)
+# define BFI_FLINEAR1_3995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3994, v ds
+# define BFI_FLINEAR1_3995_TICK(t)
+# define BFI_FLINEAR1_3994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3993, v ds
+# define BFI_FLINEAR1_3994_TICK(t)
+# define BFI_FLINEAR1_3993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3992, v ds
+# define BFI_FLINEAR1_3993_TICK(t)
+# define BFI_FLINEAR1_3992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3991, v ds
+# define BFI_FLINEAR1_3992_TICK(t)
+# define BFI_FLINEAR1_3991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3990, v ds
+# define BFI_FLINEAR1_3991_TICK(t)
+# define BFI_FLINEAR1_3990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3989, v ds
+# define BFI_FLINEAR1_3990_TICK(t)
+# define BFI_FLINEAR1_3989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3988, v ds
+# define BFI_FLINEAR1_3989_TICK(t)
+# define BFI_FLINEAR1_3988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3987, v ds
+# define BFI_FLINEAR1_3988_TICK(t)
+# define BFI_FLINEAR1_3987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3986, v ds
+# define BFI_FLINEAR1_3987_TICK(t)
+# define BFI_FLINEAR1_3986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3985, v ds
+# define BFI_FLINEAR1_3986_TICK(t)
+# define BFI_FLINEAR1_3985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3984, v ds
+# define BFI_FLINEAR1_3985_TICK(t)
+# define BFI_FLINEAR1_3984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3983, v ds
+# define BFI_FLINEAR1_3984_TICK(t)
+# define BFI_FLINEAR1_3983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3982, v ds
+# define BFI_FLINEAR1_3983_TICK(t)
+# define BFI_FLINEAR1_3982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3981, v ds
+# define BFI_FLINEAR1_3982_TICK(t)
+# define BFI_FLINEAR1_3981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3980, v ds
+# define BFI_FLINEAR1_3981_TICK(t)
+# define BFI_FLINEAR1_3980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3979, v ds
+# define BFI_FLINEAR1_3980_TICK(t)
+# define BFI_FLINEAR1_3979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3978, v ds
+# define BFI_FLINEAR1_3979_TICK(t)
+# define BFI_FLINEAR1_3978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3977, v ds
+# define BFI_FLINEAR1_3978_TICK(t)
+# define BFI_FLINEAR1_3977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3976, v ds
+# define BFI_FLINEAR1_3977_TICK(t)
+# define BFI_FLINEAR1_3976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3975, v ds
+# define BFI_FLINEAR1_3976_TICK(t)
+# define BFI_FLINEAR1_3975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3974, v ds
+# define BFI_FLINEAR1_3975_TICK(t)
+# define BFI_FLINEAR1_3974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3973, v ds
+# define BFI_FLINEAR1_3974_TICK(t)
+# define BFI_FLINEAR1_3973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3972, v ds
+# define BFI_FLINEAR1_3973_TICK(t)
+# define BFI_FLINEAR1_3972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3971, v ds
+# define BFI_FLINEAR1_3972_TICK(t)
+# define BFI_FLINEAR1_3971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3970, v ds
+# define BFI_FLINEAR1_3971_TICK(t)
+# define BFI_FLINEAR1_3970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3969, v ds
+# define BFI_FLINEAR1_3970_TICK(t)
+# define BFI_FLINEAR1_3969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3968, v ds
+# define BFI_FLINEAR1_3969_TICK(t)
+# define BFI_FLINEAR1_3968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3967, v ds
+# define BFI_FLINEAR1_3968_TICK(t)
+# define BFI_FLINEAR1_3967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3966, v ds
+# define BFI_FLINEAR1_3967_TICK(t)
+# define BFI_FLINEAR1_3966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3965, v ds
+# define BFI_FLINEAR1_3966_TICK(t)
+# define BFI_FLINEAR1_3965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3964, v ds
+# define BFI_FLINEAR1_3965_TICK(t)
+# define BFI_FLINEAR1_3964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3963, v ds
+# define BFI_FLINEAR1_3964_TICK(t)
+# define BFI_FLINEAR1_3963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3962, v ds
+# define BFI_FLINEAR1_3963_TICK(t)
+# define BFI_FLINEAR1_3962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3961, v ds
+# define BFI_FLINEAR1_3962_TICK(t)
+# define BFI_FLINEAR1_3961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3960, v ds
+# define BFI_FLINEAR1_3961_TICK(t)
+# define BFI_FLINEAR1_3960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3959, v ds
+# define BFI_FLINEAR1_3960_TICK(t)
+# define BFI_FLINEAR1_3959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3958, v ds
+# define BFI_FLINEAR1_3959_TICK(t)
+# define BFI_FLINEAR1_3958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3957, v ds
+# define BFI_FLINEAR1_3958_TICK(t)
+# define BFI_FLINEAR1_3957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3956, v ds
+# define BFI_FLINEAR1_3957_TICK(t)
+# define BFI_FLINEAR1_3956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3955, v ds
+# define BFI_FLINEAR1_3956_TICK(t)
+# define BFI_FLINEAR1_3955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3954, v ds
+# define BFI_FLINEAR1_3955_TICK(t)
+# define BFI_FLINEAR1_3954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3953, v ds
+# define BFI_FLINEAR1_3954_TICK(t)
+# define BFI_FLINEAR1_3953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3952, v ds
+# define BFI_FLINEAR1_3953_TICK(t)
+# define BFI_FLINEAR1_3952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3951, v ds
+# define BFI_FLINEAR1_3952_TICK(t)
+# define BFI_FLINEAR1_3951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3950, v ds
+# define BFI_FLINEAR1_3951_TICK(t)
+# define BFI_FLINEAR1_3950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3949, v ds
+# define BFI_FLINEAR1_3950_TICK(t)
+# define BFI_FLINEAR1_3949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3948, v ds
+# define BFI_FLINEAR1_3949_TICK(t)
+# define BFI_FLINEAR1_3948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3947, v ds
+# define BFI_FLINEAR1_3948_TICK(t)
+# define BFI_FLINEAR1_3947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3946, v ds
+# define BFI_FLINEAR1_3947_TICK(t)
+# define BFI_FLINEAR1_3946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3945, v ds
+# define BFI_FLINEAR1_3946_TICK(t)
+# define BFI_FLINEAR1_3945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3944, v ds
+# define BFI_FLINEAR1_3945_TICK(t)
+# define BFI_FLINEAR1_3944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3943, v ds
+# define BFI_FLINEAR1_3944_TICK(t)
+# define BFI_FLINEAR1_3943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3942, v ds
+# define BFI_FLINEAR1_3943_TICK(t)
+# define BFI_FLINEAR1_3942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3941, v ds
+# define BFI_FLINEAR1_3942_TICK(t)
+# define BFI_FLINEAR1_3941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3940, v ds
+# define BFI_FLINEAR1_3941_TICK(t)
+# define BFI_FLINEAR1_3940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3939, v ds
+# define BFI_FLINEAR1_3940_TICK(t)
+# define BFI_FLINEAR1_3939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3938, v ds
+# define BFI_FLINEAR1_3939_TICK(t)
+# define BFI_FLINEAR1_3938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3937, v ds
+# define BFI_FLINEAR1_3938_TICK(t)
+# define BFI_FLINEAR1_3937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3936, v ds
+# define BFI_FLINEAR1_3937_TICK(t)
+# define BFI_FLINEAR1_3936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3935, v ds
+# define BFI_FLINEAR1_3936_TICK(t)
+# define BFI_FLINEAR1_3935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3934, v ds
+# define BFI_FLINEAR1_3935_TICK(t)
+# define BFI_FLINEAR1_3934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3933, v ds
+# define BFI_FLINEAR1_3934_TICK(t)
+# define BFI_FLINEAR1_3933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3932, v ds
+# define BFI_FLINEAR1_3933_TICK(t)
+# define BFI_FLINEAR1_3932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3931, v ds
+# define BFI_FLINEAR1_3932_TICK(t)
+# define BFI_FLINEAR1_3931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3930, v ds
+# define BFI_FLINEAR1_3931_TICK(t)
+# define BFI_FLINEAR1_3930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3929, v ds
+# define BFI_FLINEAR1_3930_TICK(t)
+# define BFI_FLINEAR1_3929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3928, v ds
+# define BFI_FLINEAR1_3929_TICK(t)
+# define BFI_FLINEAR1_3928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3927, v ds
+# define BFI_FLINEAR1_3928_TICK(t)
+# define BFI_FLINEAR1_3927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3926, v ds
+# define BFI_FLINEAR1_3927_TICK(t)
+# define BFI_FLINEAR1_3926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3925, v ds
+# define BFI_FLINEAR1_3926_TICK(t)
+# define BFI_FLINEAR1_3925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3924, v ds
+# define BFI_FLINEAR1_3925_TICK(t)
+# define BFI_FLINEAR1_3924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3923, v ds
+# define BFI_FLINEAR1_3924_TICK(t)
+# define BFI_FLINEAR1_3923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3922, v ds
+# define BFI_FLINEAR1_3923_TICK(t)
+# define BFI_FLINEAR1_3922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3921, v ds
+# define BFI_FLINEAR1_3922_TICK(t)
+# define BFI_FLINEAR1_3921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3920, v ds
+# define BFI_FLINEAR1_3921_TICK(t)
+# define BFI_FLINEAR1_3920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3919, v ds
+# define BFI_FLINEAR1_3920_TICK(t)
+# define BFI_FLINEAR1_3919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3918, v ds
+# define BFI_FLINEAR1_3919_TICK(t)
+# define BFI_FLINEAR1_3918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3917, v ds
+# define BFI_FLINEAR1_3918_TICK(t)
+# define BFI_FLINEAR1_3917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3916, v ds
+# define BFI_FLINEAR1_3917_TICK(t)
+# define BFI_FLINEAR1_3916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3915, v ds
+# define BFI_FLINEAR1_3916_TICK(t)
+# define BFI_FLINEAR1_3915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3914, v ds
+# define BFI_FLINEAR1_3915_TICK(t)
+# define BFI_FLINEAR1_3914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3913, v ds
+# define BFI_FLINEAR1_3914_TICK(t)
+# define BFI_FLINEAR1_3913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3912, v ds
+# define BFI_FLINEAR1_3913_TICK(t)
+# define BFI_FLINEAR1_3912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3911, v ds
+# define BFI_FLINEAR1_3912_TICK(t)
+# define BFI_FLINEAR1_3911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3910, v ds
+# define BFI_FLINEAR1_3911_TICK(t)
+# define BFI_FLINEAR1_3910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3909, v ds
+# define BFI_FLINEAR1_3910_TICK(t)
+# define BFI_FLINEAR1_3909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3908, v ds
+# define BFI_FLINEAR1_3909_TICK(t)
+# define BFI_FLINEAR1_3908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3907, v ds
+# define BFI_FLINEAR1_3908_TICK(t)
+# define BFI_FLINEAR1_3907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3906, v ds
+# define BFI_FLINEAR1_3907_TICK(t)
+# define BFI_FLINEAR1_3906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3905, v ds
+# define BFI_FLINEAR1_3906_TICK(t)
+# define BFI_FLINEAR1_3905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3904, v ds
+# define BFI_FLINEAR1_3905_TICK(t)
+# define BFI_FLINEAR1_3904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3903, v ds
+# define BFI_FLINEAR1_3904_TICK(t)
+# define BFI_FLINEAR1_3903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3902, v ds
+# define BFI_FLINEAR1_3903_TICK(t)
+# define BFI_FLINEAR1_3902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3901, v ds
+# define BFI_FLINEAR1_3902_TICK(t)
+# define BFI_FLINEAR1_3901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3900, v ds
+# define BFI_FLINEAR1_3901_TICK(t)
+# define BFI_FLINEAR1_3900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3899, v ds
+# define BFI_FLINEAR1_3900_TICK(t)
+# define BFI_FLINEAR1_3899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3898, v ds
+# define BFI_FLINEAR1_3899_TICK(t)
+# define BFI_FLINEAR1_3898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3897, v ds
+# define BFI_FLINEAR1_3898_TICK(t)
+# define BFI_FLINEAR1_3897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3896, v ds
+# define BFI_FLINEAR1_3897_TICK(t)
+# define BFI_FLINEAR1_3896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3895, v ds
+# define BFI_FLINEAR1_3896_TICK(t)
+# define BFI_FLINEAR1_3895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3894, v ds
+# define BFI_FLINEAR1_3895_TICK(t)
+# define BFI_FLINEAR1_3894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3893, v ds
+# define BFI_FLINEAR1_3894_TICK(t)
+# define BFI_FLINEAR1_3893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3892, v ds
+# define BFI_FLINEAR1_3893_TICK(t)
+# define BFI_FLINEAR1_3892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3891, v ds
+# define BFI_FLINEAR1_3892_TICK(t)
+# define BFI_FLINEAR1_3891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3890, v ds
+# define BFI_FLINEAR1_3891_TICK(t)
+# define BFI_FLINEAR1_3890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3889, v ds
+# define BFI_FLINEAR1_3890_TICK(t)
+# define BFI_FLINEAR1_3889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3888, v ds
+# define BFI_FLINEAR1_3889_TICK(t)
+# define BFI_FLINEAR1_3888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3887, v ds
+# define BFI_FLINEAR1_3888_TICK(t)
+# define BFI_FLINEAR1_3887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3886, v ds
+# define BFI_FLINEAR1_3887_TICK(t)
+# define BFI_FLINEAR1_3886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3885, v ds
+# define BFI_FLINEAR1_3886_TICK(t)
+# define BFI_FLINEAR1_3885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3884, v ds
+# define BFI_FLINEAR1_3885_TICK(t)
+# define BFI_FLINEAR1_3884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3883, v ds
+# define BFI_FLINEAR1_3884_TICK(t)
+# define BFI_FLINEAR1_3883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3882, v ds
+# define BFI_FLINEAR1_3883_TICK(t)
+# define BFI_FLINEAR1_3882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3881, v ds
+# define BFI_FLINEAR1_3882_TICK(t)
+# define BFI_FLINEAR1_3881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3880, v ds
+# define BFI_FLINEAR1_3881_TICK(t)
+# define BFI_FLINEAR1_3880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3879, v ds
+# define BFI_FLINEAR1_3880_TICK(t)
+# define BFI_FLINEAR1_3879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3878, v ds
+# define BFI_FLINEAR1_3879_TICK(t)
+# define BFI_FLINEAR1_3878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3877, v ds
+# define BFI_FLINEAR1_3878_TICK(t)
+# define BFI_FLINEAR1_3877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3876, v ds
+# define BFI_FLINEAR1_3877_TICK(t)
+# define BFI_FLINEAR1_3876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3875, v ds
+# define BFI_FLINEAR1_3876_TICK(t)
+# define BFI_FLINEAR1_3875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3874, v ds
+# define BFI_FLINEAR1_3875_TICK(t)
+# define BFI_FLINEAR1_3874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3873, v ds
+# define BFI_FLINEAR1_3874_TICK(t)
+# define BFI_FLINEAR1_3873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3872, v ds
+# define BFI_FLINEAR1_3873_TICK(t)
+# define BFI_FLINEAR1_3872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3871, v ds
+# define BFI_FLINEAR1_3872_TICK(t)
+# define BFI_FLINEAR1_3871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3870, v ds
+# define BFI_FLINEAR1_3871_TICK(t)
+# define BFI_FLINEAR1_3870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3869, v ds
+# define BFI_FLINEAR1_3870_TICK(t)
+# define BFI_FLINEAR1_3869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3868, v ds
+# define BFI_FLINEAR1_3869_TICK(t)
+# define BFI_FLINEAR1_3868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3867, v ds
+# define BFI_FLINEAR1_3868_TICK(t)
+# define BFI_FLINEAR1_3867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3866, v ds
+# define BFI_FLINEAR1_3867_TICK(t)
+# define BFI_FLINEAR1_3866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3865, v ds
+# define BFI_FLINEAR1_3866_TICK(t)
+# define BFI_FLINEAR1_3865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3864, v ds
+# define BFI_FLINEAR1_3865_TICK(t)
+# define BFI_FLINEAR1_3864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3863, v ds
+# define BFI_FLINEAR1_3864_TICK(t)
+# define BFI_FLINEAR1_3863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3862, v ds
+# define BFI_FLINEAR1_3863_TICK(t)
+# define BFI_FLINEAR1_3862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3861, v ds
+# define BFI_FLINEAR1_3862_TICK(t)
+# define BFI_FLINEAR1_3861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3860, v ds
+# define BFI_FLINEAR1_3861_TICK(t)
+# define BFI_FLINEAR1_3860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3859, v ds
+# define BFI_FLINEAR1_3860_TICK(t)
+# define BFI_FLINEAR1_3859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3858, v ds
+# define BFI_FLINEAR1_3859_TICK(t)
+# define BFI_FLINEAR1_3858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3857, v ds
+# define BFI_FLINEAR1_3858_TICK(t)
+# define BFI_FLINEAR1_3857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3856, v ds
+# define BFI_FLINEAR1_3857_TICK(t)
+# define BFI_FLINEAR1_3856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3855, v ds
+# define BFI_FLINEAR1_3856_TICK(t)
+# define BFI_FLINEAR1_3855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3854, v ds
+# define BFI_FLINEAR1_3855_TICK(t)
+# define BFI_FLINEAR1_3854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3853, v ds
+# define BFI_FLINEAR1_3854_TICK(t)
+# define BFI_FLINEAR1_3853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3852, v ds
+# define BFI_FLINEAR1_3853_TICK(t)
+# define BFI_FLINEAR1_3852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3851, v ds
+# define BFI_FLINEAR1_3852_TICK(t)
+# define BFI_FLINEAR1_3851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3850, v ds
+# define BFI_FLINEAR1_3851_TICK(t)
+# define BFI_FLINEAR1_3850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3849, v ds
+# define BFI_FLINEAR1_3850_TICK(t)
+# define BFI_FLINEAR1_3849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3848, v ds
+# define BFI_FLINEAR1_3849_TICK(t)
+# define BFI_FLINEAR1_3848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3847, v ds
+# define BFI_FLINEAR1_3848_TICK(t)
+# define BFI_FLINEAR1_3847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3846, v ds
+# define BFI_FLINEAR1_3847_TICK(t)
+# define BFI_FLINEAR1_3846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3845, v ds
+# define BFI_FLINEAR1_3846_TICK(t)
+# define BFI_FLINEAR1_3845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3844, v ds
+# define BFI_FLINEAR1_3845_TICK(t)
+# define BFI_FLINEAR1_3844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3843, v ds
+# define BFI_FLINEAR1_3844_TICK(t)
+# define BFI_FLINEAR1_3843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3842, v ds
+# define BFI_FLINEAR1_3843_TICK(t)
+# define BFI_FLINEAR1_3842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3841, v ds
+# define BFI_FLINEAR1_3842_TICK(t)
+# define BFI_FLINEAR1_3841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3840, v ds
+# define BFI_FLINEAR1_3841_TICK(t)
+# define BFI_FLINEAR1_3840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3839, v ds
+# define BFI_FLINEAR1_3840_TICK(t)
+# define BFI_FLINEAR1_3839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3838, v ds
+# define BFI_FLINEAR1_3839_TICK(t)
+# define BFI_FLINEAR1_3838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3837, v ds
+# define BFI_FLINEAR1_3838_TICK(t)
+# define BFI_FLINEAR1_3837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3836, v ds
+# define BFI_FLINEAR1_3837_TICK(t)
+# define BFI_FLINEAR1_3836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3835, v ds
+# define BFI_FLINEAR1_3836_TICK(t)
+# define BFI_FLINEAR1_3835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3834, v ds
+# define BFI_FLINEAR1_3835_TICK(t)
+# define BFI_FLINEAR1_3834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3833, v ds
+# define BFI_FLINEAR1_3834_TICK(t)
+# define BFI_FLINEAR1_3833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3832, v ds
+# define BFI_FLINEAR1_3833_TICK(t)
+# define BFI_FLINEAR1_3832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3831, v ds
+# define BFI_FLINEAR1_3832_TICK(t)
+# define BFI_FLINEAR1_3831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3830, v ds
+# define BFI_FLINEAR1_3831_TICK(t)
+# define BFI_FLINEAR1_3830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3829, v ds
+# define BFI_FLINEAR1_3830_TICK(t)
+# define BFI_FLINEAR1_3829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3828, v ds
+# define BFI_FLINEAR1_3829_TICK(t)
+# define BFI_FLINEAR1_3828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3827, v ds
+# define BFI_FLINEAR1_3828_TICK(t)
+# define BFI_FLINEAR1_3827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3826, v ds
+# define BFI_FLINEAR1_3827_TICK(t)
+# define BFI_FLINEAR1_3826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3825, v ds
+# define BFI_FLINEAR1_3826_TICK(t)
+# define BFI_FLINEAR1_3825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3824, v ds
+# define BFI_FLINEAR1_3825_TICK(t)
+# define BFI_FLINEAR1_3824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3823, v ds
+# define BFI_FLINEAR1_3824_TICK(t)
+# define BFI_FLINEAR1_3823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3822, v ds
+# define BFI_FLINEAR1_3823_TICK(t)
+# define BFI_FLINEAR1_3822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3821, v ds
+# define BFI_FLINEAR1_3822_TICK(t)
+# define BFI_FLINEAR1_3821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3820, v ds
+# define BFI_FLINEAR1_3821_TICK(t)
+# define BFI_FLINEAR1_3820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3819, v ds
+# define BFI_FLINEAR1_3820_TICK(t)
+# define BFI_FLINEAR1_3819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3818, v ds
+# define BFI_FLINEAR1_3819_TICK(t)
+# define BFI_FLINEAR1_3818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3817, v ds
+# define BFI_FLINEAR1_3818_TICK(t)
+# define BFI_FLINEAR1_3817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3816, v ds
+# define BFI_FLINEAR1_3817_TICK(t)
+# define BFI_FLINEAR1_3816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3815, v ds
+# define BFI_FLINEAR1_3816_TICK(t)
+# define BFI_FLINEAR1_3815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3814, v ds
+# define BFI_FLINEAR1_3815_TICK(t)
+# define BFI_FLINEAR1_3814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3813, v ds
+# define BFI_FLINEAR1_3814_TICK(t)
+# define BFI_FLINEAR1_3813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3812, v ds
+# define BFI_FLINEAR1_3813_TICK(t)
+# define BFI_FLINEAR1_3812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3811, v ds
+# define BFI_FLINEAR1_3812_TICK(t)
+# define BFI_FLINEAR1_3811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3810, v ds
+# define BFI_FLINEAR1_3811_TICK(t)
+# define BFI_FLINEAR1_3810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3809, v ds
+# define BFI_FLINEAR1_3810_TICK(t)
+# define BFI_FLINEAR1_3809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3808, v ds
+# define BFI_FLINEAR1_3809_TICK(t)
+# define BFI_FLINEAR1_3808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3807, v ds
+# define BFI_FLINEAR1_3808_TICK(t)
+# define BFI_FLINEAR1_3807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3806, v ds
+# define BFI_FLINEAR1_3807_TICK(t)
+# define BFI_FLINEAR1_3806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3805, v ds
+# define BFI_FLINEAR1_3806_TICK(t)
+# define BFI_FLINEAR1_3805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3804, v ds
+# define BFI_FLINEAR1_3805_TICK(t)
+# define BFI_FLINEAR1_3804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3803, v ds
+# define BFI_FLINEAR1_3804_TICK(t)
+# define BFI_FLINEAR1_3803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3802, v ds
+# define BFI_FLINEAR1_3803_TICK(t)
+# define BFI_FLINEAR1_3802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3801, v ds
+# define BFI_FLINEAR1_3802_TICK(t)
+# define BFI_FLINEAR1_3801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3800, v ds
+# define BFI_FLINEAR1_3801_TICK(t)
+# define BFI_FLINEAR1_3800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3799, v ds
+# define BFI_FLINEAR1_3800_TICK(t)
+# define BFI_FLINEAR1_3799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3798, v ds
+# define BFI_FLINEAR1_3799_TICK(t)
+# define BFI_FLINEAR1_3798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3797, v ds
+# define BFI_FLINEAR1_3798_TICK(t)
+# define BFI_FLINEAR1_3797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3796, v ds
+# define BFI_FLINEAR1_3797_TICK(t)
+# define BFI_FLINEAR1_3796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3795, v ds
+# define BFI_FLINEAR1_3796_TICK(t)
+# define BFI_FLINEAR1_3795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3794, v ds
+# define BFI_FLINEAR1_3795_TICK(t)
+# define BFI_FLINEAR1_3794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3793, v ds
+# define BFI_FLINEAR1_3794_TICK(t)
+# define BFI_FLINEAR1_3793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3792, v ds
+# define BFI_FLINEAR1_3793_TICK(t)
+# define BFI_FLINEAR1_3792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3791, v ds
+# define BFI_FLINEAR1_3792_TICK(t)
+# define BFI_FLINEAR1_3791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3790, v ds
+# define BFI_FLINEAR1_3791_TICK(t)
+# define BFI_FLINEAR1_3790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3789, v ds
+# define BFI_FLINEAR1_3790_TICK(t)
+# define BFI_FLINEAR1_3789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3788, v ds
+# define BFI_FLINEAR1_3789_TICK(t)
+# define BFI_FLINEAR1_3788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3787, v ds
+# define BFI_FLINEAR1_3788_TICK(t)
+# define BFI_FLINEAR1_3787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3786, v ds
+# define BFI_FLINEAR1_3787_TICK(t)
+# define BFI_FLINEAR1_3786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3785, v ds
+# define BFI_FLINEAR1_3786_TICK(t)
+# define BFI_FLINEAR1_3785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3784, v ds
+# define BFI_FLINEAR1_3785_TICK(t)
+# define BFI_FLINEAR1_3784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3783, v ds
+# define BFI_FLINEAR1_3784_TICK(t)
+# define BFI_FLINEAR1_3783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3782, v ds
+# define BFI_FLINEAR1_3783_TICK(t)
+# define BFI_FLINEAR1_3782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3781, v ds
+# define BFI_FLINEAR1_3782_TICK(t)
+# define BFI_FLINEAR1_3781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3780, v ds
+# define BFI_FLINEAR1_3781_TICK(t)
+# define BFI_FLINEAR1_3780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3779, v ds
+# define BFI_FLINEAR1_3780_TICK(t)
+# define BFI_FLINEAR1_3779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3778, v ds
+# define BFI_FLINEAR1_3779_TICK(t)
+# define BFI_FLINEAR1_3778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3777, v ds
+# define BFI_FLINEAR1_3778_TICK(t)
+# define BFI_FLINEAR1_3777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3776, v ds
+# define BFI_FLINEAR1_3777_TICK(t)
+# define BFI_FLINEAR1_3776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3775, v ds
+# define BFI_FLINEAR1_3776_TICK(t)
+# define BFI_FLINEAR1_3775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3774, v ds
+# define BFI_FLINEAR1_3775_TICK(t)
+# define BFI_FLINEAR1_3774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3773, v ds
+# define BFI_FLINEAR1_3774_TICK(t)
+# define BFI_FLINEAR1_3773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3772, v ds
+# define BFI_FLINEAR1_3773_TICK(t)
+# define BFI_FLINEAR1_3772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3771, v ds
+# define BFI_FLINEAR1_3772_TICK(t)
+# define BFI_FLINEAR1_3771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3770, v ds
+# define BFI_FLINEAR1_3771_TICK(t)
+# define BFI_FLINEAR1_3770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3769, v ds
+# define BFI_FLINEAR1_3770_TICK(t)
+# define BFI_FLINEAR1_3769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3768, v ds
+# define BFI_FLINEAR1_3769_TICK(t)
+# define BFI_FLINEAR1_3768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3767, v ds
+# define BFI_FLINEAR1_3768_TICK(t)
+# define BFI_FLINEAR1_3767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3766, v ds
+# define BFI_FLINEAR1_3767_TICK(t)
+# define BFI_FLINEAR1_3766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3765, v ds
+# define BFI_FLINEAR1_3766_TICK(t)
+# define BFI_FLINEAR1_3765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3764, v ds
+# define BFI_FLINEAR1_3765_TICK(t)
+# define BFI_FLINEAR1_3764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3763, v ds
+# define BFI_FLINEAR1_3764_TICK(t)
+# define BFI_FLINEAR1_3763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3762, v ds
+# define BFI_FLINEAR1_3763_TICK(t)
+# define BFI_FLINEAR1_3762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3761, v ds
+# define BFI_FLINEAR1_3762_TICK(t)
+# define BFI_FLINEAR1_3761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3760, v ds
+# define BFI_FLINEAR1_3761_TICK(t)
+# define BFI_FLINEAR1_3760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3759, v ds
+# define BFI_FLINEAR1_3760_TICK(t)
+# define BFI_FLINEAR1_3759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3758, v ds
+# define BFI_FLINEAR1_3759_TICK(t)
+# define BFI_FLINEAR1_3758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3757, v ds
+# define BFI_FLINEAR1_3758_TICK(t)
+# define BFI_FLINEAR1_3757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3756, v ds
+# define BFI_FLINEAR1_3757_TICK(t)
+# define BFI_FLINEAR1_3756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3755, v ds
+# define BFI_FLINEAR1_3756_TICK(t)
+# define BFI_FLINEAR1_3755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3754, v ds
+# define BFI_FLINEAR1_3755_TICK(t)
+# define BFI_FLINEAR1_3754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3753, v ds
+# define BFI_FLINEAR1_3754_TICK(t)
+# define BFI_FLINEAR1_3753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3752, v ds
+# define BFI_FLINEAR1_3753_TICK(t)
+# define BFI_FLINEAR1_3752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3751, v ds
+# define BFI_FLINEAR1_3752_TICK(t)
+# define BFI_FLINEAR1_3751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3750, v ds
+# define BFI_FLINEAR1_3751_TICK(t)
+# define BFI_FLINEAR1_3750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3749, v ds
+# define BFI_FLINEAR1_3750_TICK(t)
+# define BFI_FLINEAR1_3749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3748, v ds
+# define BFI_FLINEAR1_3749_TICK(t)
+# define BFI_FLINEAR1_3748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3747, v ds
+# define BFI_FLINEAR1_3748_TICK(t)
+# define BFI_FLINEAR1_3747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3746, v ds
+# define BFI_FLINEAR1_3747_TICK(t)
+# define BFI_FLINEAR1_3746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3745, v ds
+# define BFI_FLINEAR1_3746_TICK(t)
+# define BFI_FLINEAR1_3745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3744, v ds
+# define BFI_FLINEAR1_3745_TICK(t)
+# define BFI_FLINEAR1_3744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3743, v ds
+# define BFI_FLINEAR1_3744_TICK(t)
+# define BFI_FLINEAR1_3743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3742, v ds
+# define BFI_FLINEAR1_3743_TICK(t)
+# define BFI_FLINEAR1_3742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3741, v ds
+# define BFI_FLINEAR1_3742_TICK(t)
+# define BFI_FLINEAR1_3741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3740, v ds
+# define BFI_FLINEAR1_3741_TICK(t)
+# define BFI_FLINEAR1_3740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3739, v ds
+# define BFI_FLINEAR1_3740_TICK(t)
+# define BFI_FLINEAR1_3739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3738, v ds
+# define BFI_FLINEAR1_3739_TICK(t)
+# define BFI_FLINEAR1_3738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3737, v ds
+# define BFI_FLINEAR1_3738_TICK(t)
+# define BFI_FLINEAR1_3737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3736, v ds
+# define BFI_FLINEAR1_3737_TICK(t)
+# define BFI_FLINEAR1_3736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3735, v ds
+# define BFI_FLINEAR1_3736_TICK(t)
+# define BFI_FLINEAR1_3735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3734, v ds
+# define BFI_FLINEAR1_3735_TICK(t)
+# define BFI_FLINEAR1_3734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3733, v ds
+# define BFI_FLINEAR1_3734_TICK(t)
+# define BFI_FLINEAR1_3733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3732, v ds
+# define BFI_FLINEAR1_3733_TICK(t)
+# define BFI_FLINEAR1_3732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3731, v ds
+# define BFI_FLINEAR1_3732_TICK(t)
+# define BFI_FLINEAR1_3731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3730, v ds
+# define BFI_FLINEAR1_3731_TICK(t)
+# define BFI_FLINEAR1_3730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3729, v ds
+# define BFI_FLINEAR1_3730_TICK(t)
+# define BFI_FLINEAR1_3729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3728, v ds
+# define BFI_FLINEAR1_3729_TICK(t)
+# define BFI_FLINEAR1_3728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3727, v ds
+# define BFI_FLINEAR1_3728_TICK(t)
+# define BFI_FLINEAR1_3727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3726, v ds
+# define BFI_FLINEAR1_3727_TICK(t)
+# define BFI_FLINEAR1_3726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3725, v ds
+# define BFI_FLINEAR1_3726_TICK(t)
+# define BFI_FLINEAR1_3725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3724, v ds
+# define BFI_FLINEAR1_3725_TICK(t)
+# define BFI_FLINEAR1_3724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3723, v ds
+# define BFI_FLINEAR1_3724_TICK(t)
+# define BFI_FLINEAR1_3723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3722, v ds
+# define BFI_FLINEAR1_3723_TICK(t)
+# define BFI_FLINEAR1_3722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3721, v ds
+# define BFI_FLINEAR1_3722_TICK(t)
+# define BFI_FLINEAR1_3721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3720, v ds
+# define BFI_FLINEAR1_3721_TICK(t)
+# define BFI_FLINEAR1_3720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3719, v ds
+# define BFI_FLINEAR1_3720_TICK(t)
+# define BFI_FLINEAR1_3719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3718, v ds
+# define BFI_FLINEAR1_3719_TICK(t)
+# define BFI_FLINEAR1_3718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3717, v ds
+# define BFI_FLINEAR1_3718_TICK(t)
+# define BFI_FLINEAR1_3717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3716, v ds
+# define BFI_FLINEAR1_3717_TICK(t)
+# define BFI_FLINEAR1_3716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3715, v ds
+# define BFI_FLINEAR1_3716_TICK(t)
+# define BFI_FLINEAR1_3715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3714, v ds
+# define BFI_FLINEAR1_3715_TICK(t)
+# define BFI_FLINEAR1_3714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3713, v ds
+# define BFI_FLINEAR1_3714_TICK(t)
+# define BFI_FLINEAR1_3713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3712, v ds
+# define BFI_FLINEAR1_3713_TICK(t)
+# define BFI_FLINEAR1_3712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3711, v ds
+# define BFI_FLINEAR1_3712_TICK(t)
+# define BFI_FLINEAR1_3711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3710, v ds
+# define BFI_FLINEAR1_3711_TICK(t)
+# define BFI_FLINEAR1_3710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3709, v ds
+# define BFI_FLINEAR1_3710_TICK(t)
+# define BFI_FLINEAR1_3709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3708, v ds
+# define BFI_FLINEAR1_3709_TICK(t)
+# define BFI_FLINEAR1_3708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3707, v ds
+# define BFI_FLINEAR1_3708_TICK(t)
+# define BFI_FLINEAR1_3707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3706, v ds
+# define BFI_FLINEAR1_3707_TICK(t)
+# define BFI_FLINEAR1_3706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3705, v ds
+# define BFI_FLINEAR1_3706_TICK(t)
+# define BFI_FLINEAR1_3705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3704, v ds
+# define BFI_FLINEAR1_3705_TICK(t)
+# define BFI_FLINEAR1_3704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3703, v ds
+# define BFI_FLINEAR1_3704_TICK(t)
+# define BFI_FLINEAR1_3703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3702, v ds
+# define BFI_FLINEAR1_3703_TICK(t)
+# define BFI_FLINEAR1_3702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3701, v ds
+# define BFI_FLINEAR1_3702_TICK(t)
+# define BFI_FLINEAR1_3701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3700, v ds
+# define BFI_FLINEAR1_3701_TICK(t)
+# define BFI_FLINEAR1_3700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3699, v ds
+# define BFI_FLINEAR1_3700_TICK(t)
+# define BFI_FLINEAR1_3699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3698, v ds
+# define BFI_FLINEAR1_3699_TICK(t)
+# define BFI_FLINEAR1_3698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3697, v ds
+# define BFI_FLINEAR1_3698_TICK(t)
+# define BFI_FLINEAR1_3697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3696, v ds
+# define BFI_FLINEAR1_3697_TICK(t)
+# define BFI_FLINEAR1_3696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3695, v ds
+# define BFI_FLINEAR1_3696_TICK(t)
+# define BFI_FLINEAR1_3695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3694, v ds
+# define BFI_FLINEAR1_3695_TICK(t)
+# define BFI_FLINEAR1_3694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3693, v ds
+# define BFI_FLINEAR1_3694_TICK(t)
+# define BFI_FLINEAR1_3693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3692, v ds
+# define BFI_FLINEAR1_3693_TICK(t)
+# define BFI_FLINEAR1_3692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3691, v ds
+# define BFI_FLINEAR1_3692_TICK(t)
+# define BFI_FLINEAR1_3691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3690, v ds
+# define BFI_FLINEAR1_3691_TICK(t)
+# define BFI_FLINEAR1_3690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3689, v ds
+# define BFI_FLINEAR1_3690_TICK(t)
+# define BFI_FLINEAR1_3689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3688, v ds
+# define BFI_FLINEAR1_3689_TICK(t)
+# define BFI_FLINEAR1_3688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3687, v ds
+# define BFI_FLINEAR1_3688_TICK(t)
+# define BFI_FLINEAR1_3687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3686, v ds
+# define BFI_FLINEAR1_3687_TICK(t)
+# define BFI_FLINEAR1_3686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3685, v ds
+# define BFI_FLINEAR1_3686_TICK(t)
+# define BFI_FLINEAR1_3685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3684, v ds
+# define BFI_FLINEAR1_3685_TICK(t)
+# define BFI_FLINEAR1_3684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3683, v ds
+# define BFI_FLINEAR1_3684_TICK(t)
+# define BFI_FLINEAR1_3683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3682, v ds
+# define BFI_FLINEAR1_3683_TICK(t)
+# define BFI_FLINEAR1_3682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3681, v ds
+# define BFI_FLINEAR1_3682_TICK(t)
+# define BFI_FLINEAR1_3681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3680, v ds
+# define BFI_FLINEAR1_3681_TICK(t)
+# define BFI_FLINEAR1_3680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3679, v ds
+# define BFI_FLINEAR1_3680_TICK(t)
+# define BFI_FLINEAR1_3679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3678, v ds
+# define BFI_FLINEAR1_3679_TICK(t)
+# define BFI_FLINEAR1_3678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3677, v ds
+# define BFI_FLINEAR1_3678_TICK(t)
+# define BFI_FLINEAR1_3677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3676, v ds
+# define BFI_FLINEAR1_3677_TICK(t)
+# define BFI_FLINEAR1_3676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3675, v ds
+# define BFI_FLINEAR1_3676_TICK(t)
+# define BFI_FLINEAR1_3675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3674, v ds
+# define BFI_FLINEAR1_3675_TICK(t)
+# define BFI_FLINEAR1_3674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3673, v ds
+# define BFI_FLINEAR1_3674_TICK(t)
+# define BFI_FLINEAR1_3673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3672, v ds
+# define BFI_FLINEAR1_3673_TICK(t)
+# define BFI_FLINEAR1_3672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3671, v ds
+# define BFI_FLINEAR1_3672_TICK(t)
+# define BFI_FLINEAR1_3671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3670, v ds
+# define BFI_FLINEAR1_3671_TICK(t)
+# define BFI_FLINEAR1_3670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3669, v ds
+# define BFI_FLINEAR1_3670_TICK(t)
+# define BFI_FLINEAR1_3669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3668, v ds
+# define BFI_FLINEAR1_3669_TICK(t)
+# define BFI_FLINEAR1_3668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3667, v ds
+# define BFI_FLINEAR1_3668_TICK(t)
+# define BFI_FLINEAR1_3667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3666, v ds
+# define BFI_FLINEAR1_3667_TICK(t)
+# define BFI_FLINEAR1_3666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3665, v ds
+# define BFI_FLINEAR1_3666_TICK(t)
+# define BFI_FLINEAR1_3665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3664, v ds
+# define BFI_FLINEAR1_3665_TICK(t)
+# define BFI_FLINEAR1_3664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3663, v ds
+# define BFI_FLINEAR1_3664_TICK(t)
+# define BFI_FLINEAR1_3663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3662, v ds
+# define BFI_FLINEAR1_3663_TICK(t)
+# define BFI_FLINEAR1_3662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3661, v ds
+# define BFI_FLINEAR1_3662_TICK(t)
+# define BFI_FLINEAR1_3661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3660, v ds
+# define BFI_FLINEAR1_3661_TICK(t)
+# define BFI_FLINEAR1_3660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3659, v ds
+# define BFI_FLINEAR1_3660_TICK(t)
+# define BFI_FLINEAR1_3659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3658, v ds
+# define BFI_FLINEAR1_3659_TICK(t)
+# define BFI_FLINEAR1_3658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3657, v ds
+# define BFI_FLINEAR1_3658_TICK(t)
+# define BFI_FLINEAR1_3657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3656, v ds
+# define BFI_FLINEAR1_3657_TICK(t)
+# define BFI_FLINEAR1_3656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3655, v ds
+# define BFI_FLINEAR1_3656_TICK(t)
+# define BFI_FLINEAR1_3655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3654, v ds
+# define BFI_FLINEAR1_3655_TICK(t)
+# define BFI_FLINEAR1_3654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3653, v ds
+# define BFI_FLINEAR1_3654_TICK(t)
+# define BFI_FLINEAR1_3653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3652, v ds
+# define BFI_FLINEAR1_3653_TICK(t)
+# define BFI_FLINEAR1_3652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3651, v ds
+# define BFI_FLINEAR1_3652_TICK(t)
+# define BFI_FLINEAR1_3651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3650, v ds
+# define BFI_FLINEAR1_3651_TICK(t)
+# define BFI_FLINEAR1_3650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3649, v ds
+# define BFI_FLINEAR1_3650_TICK(t)
+# define BFI_FLINEAR1_3649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3648, v ds
+# define BFI_FLINEAR1_3649_TICK(t)
+# define BFI_FLINEAR1_3648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3647, v ds
+# define BFI_FLINEAR1_3648_TICK(t)
+# define BFI_FLINEAR1_3647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3646, v ds
+# define BFI_FLINEAR1_3647_TICK(t)
+# define BFI_FLINEAR1_3646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3645, v ds
+# define BFI_FLINEAR1_3646_TICK(t)
+# define BFI_FLINEAR1_3645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3644, v ds
+# define BFI_FLINEAR1_3645_TICK(t)
+# define BFI_FLINEAR1_3644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3643, v ds
+# define BFI_FLINEAR1_3644_TICK(t)
+# define BFI_FLINEAR1_3643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3642, v ds
+# define BFI_FLINEAR1_3643_TICK(t)
+# define BFI_FLINEAR1_3642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3641, v ds
+# define BFI_FLINEAR1_3642_TICK(t)
+# define BFI_FLINEAR1_3641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3640, v ds
+# define BFI_FLINEAR1_3641_TICK(t)
+# define BFI_FLINEAR1_3640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3639, v ds
+# define BFI_FLINEAR1_3640_TICK(t)
+# define BFI_FLINEAR1_3639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3638, v ds
+# define BFI_FLINEAR1_3639_TICK(t)
+# define BFI_FLINEAR1_3638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3637, v ds
+# define BFI_FLINEAR1_3638_TICK(t)
+# define BFI_FLINEAR1_3637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3636, v ds
+# define BFI_FLINEAR1_3637_TICK(t)
+# define BFI_FLINEAR1_3636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3635, v ds
+# define BFI_FLINEAR1_3636_TICK(t)
+# define BFI_FLINEAR1_3635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3634, v ds
+# define BFI_FLINEAR1_3635_TICK(t)
+# define BFI_FLINEAR1_3634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3633, v ds
+# define BFI_FLINEAR1_3634_TICK(t)
+# define BFI_FLINEAR1_3633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3632, v ds
+# define BFI_FLINEAR1_3633_TICK(t)
+# define BFI_FLINEAR1_3632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3631, v ds
+# define BFI_FLINEAR1_3632_TICK(t)
+# define BFI_FLINEAR1_3631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3630, v ds
+# define BFI_FLINEAR1_3631_TICK(t)
+# define BFI_FLINEAR1_3630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3629, v ds
+# define BFI_FLINEAR1_3630_TICK(t)
+# define BFI_FLINEAR1_3629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3628, v ds
+# define BFI_FLINEAR1_3629_TICK(t)
+# define BFI_FLINEAR1_3628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3627, v ds
+# define BFI_FLINEAR1_3628_TICK(t)
+# define BFI_FLINEAR1_3627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3626, v ds
+# define BFI_FLINEAR1_3627_TICK(t)
+# define BFI_FLINEAR1_3626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3625, v ds
+# define BFI_FLINEAR1_3626_TICK(t)
+# define BFI_FLINEAR1_3625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3624, v ds
+# define BFI_FLINEAR1_3625_TICK(t)
+# define BFI_FLINEAR1_3624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3623, v ds
+# define BFI_FLINEAR1_3624_TICK(t)
+# define BFI_FLINEAR1_3623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3622, v ds
+# define BFI_FLINEAR1_3623_TICK(t)
+# define BFI_FLINEAR1_3622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3621, v ds
+# define BFI_FLINEAR1_3622_TICK(t)
+# define BFI_FLINEAR1_3621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3620, v ds
+# define BFI_FLINEAR1_3621_TICK(t)
+# define BFI_FLINEAR1_3620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3619, v ds
+# define BFI_FLINEAR1_3620_TICK(t)
+# define BFI_FLINEAR1_3619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3618, v ds
+# define BFI_FLINEAR1_3619_TICK(t)
+# define BFI_FLINEAR1_3618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3617, v ds
+# define BFI_FLINEAR1_3618_TICK(t)
+# define BFI_FLINEAR1_3617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3616, v ds
+# define BFI_FLINEAR1_3617_TICK(t)
+# define BFI_FLINEAR1_3616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3615, v ds
+# define BFI_FLINEAR1_3616_TICK(t)
+# define BFI_FLINEAR1_3615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3614, v ds
+# define BFI_FLINEAR1_3615_TICK(t)
+# define BFI_FLINEAR1_3614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3613, v ds
+# define BFI_FLINEAR1_3614_TICK(t)
+# define BFI_FLINEAR1_3613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3612, v ds
+# define BFI_FLINEAR1_3613_TICK(t)
+# define BFI_FLINEAR1_3612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3611, v ds
+# define BFI_FLINEAR1_3612_TICK(t)
+# define BFI_FLINEAR1_3611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3610, v ds
+# define BFI_FLINEAR1_3611_TICK(t)
+# define BFI_FLINEAR1_3610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3609, v ds
+# define BFI_FLINEAR1_3610_TICK(t)
+# define BFI_FLINEAR1_3609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3608, v ds
+# define BFI_FLINEAR1_3609_TICK(t)
+# define BFI_FLINEAR1_3608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3607, v ds
+# define BFI_FLINEAR1_3608_TICK(t)
+# define BFI_FLINEAR1_3607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3606, v ds
+# define BFI_FLINEAR1_3607_TICK(t)
+# define BFI_FLINEAR1_3606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3605, v ds
+# define BFI_FLINEAR1_3606_TICK(t)
+# define BFI_FLINEAR1_3605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3604, v ds
+# define BFI_FLINEAR1_3605_TICK(t)
+# define BFI_FLINEAR1_3604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3603, v ds
+# define BFI_FLINEAR1_3604_TICK(t)
+# define BFI_FLINEAR1_3603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3602, v ds
+# define BFI_FLINEAR1_3603_TICK(t)
+# define BFI_FLINEAR1_3602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3601, v ds
+# define BFI_FLINEAR1_3602_TICK(t)
+# define BFI_FLINEAR1_3601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3600, v ds
+# define BFI_FLINEAR1_3601_TICK(t)
+# define BFI_FLINEAR1_3600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3599, v ds
+# define BFI_FLINEAR1_3600_TICK(t)
+# define BFI_FLINEAR1_3599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3598, v ds
+# define BFI_FLINEAR1_3599_TICK(t)
+# define BFI_FLINEAR1_3598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3597, v ds
+# define BFI_FLINEAR1_3598_TICK(t)
+# define BFI_FLINEAR1_3597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3596, v ds
+# define BFI_FLINEAR1_3597_TICK(t)
+# define BFI_FLINEAR1_3596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3595, v ds
+# define BFI_FLINEAR1_3596_TICK(t)
+# define BFI_FLINEAR1_3595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3594, v ds
+# define BFI_FLINEAR1_3595_TICK(t)
+# define BFI_FLINEAR1_3594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3593, v ds
+# define BFI_FLINEAR1_3594_TICK(t)
+# define BFI_FLINEAR1_3593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3592, v ds
+# define BFI_FLINEAR1_3593_TICK(t)
+# define BFI_FLINEAR1_3592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3591, v ds
+# define BFI_FLINEAR1_3592_TICK(t)
+# define BFI_FLINEAR1_3591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3590, v ds
+# define BFI_FLINEAR1_3591_TICK(t)
+# define BFI_FLINEAR1_3590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3589, v ds
+# define BFI_FLINEAR1_3590_TICK(t)
+# define BFI_FLINEAR1_3589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3588, v ds
+# define BFI_FLINEAR1_3589_TICK(t)
+# define BFI_FLINEAR1_3588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3587, v ds
+# define BFI_FLINEAR1_3588_TICK(t)
+# define BFI_FLINEAR1_3587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3586, v ds
+# define BFI_FLINEAR1_3587_TICK(t)
+# define BFI_FLINEAR1_3586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3585, v ds
+# define BFI_FLINEAR1_3586_TICK(t)
+# define BFI_FLINEAR1_3585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3584, v ds
+# define BFI_FLINEAR1_3585_TICK(t)
+# define BFI_FLINEAR1_3584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3583, v ds
+# define BFI_FLINEAR1_3584_TICK(t)
+# define BFI_FLINEAR1_3583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3582, v ds
+# define BFI_FLINEAR1_3583_TICK(t)
+# define BFI_FLINEAR1_3582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3581, v ds
+# define BFI_FLINEAR1_3582_TICK(t)
+# define BFI_FLINEAR1_3581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3580, v ds
+# define BFI_FLINEAR1_3581_TICK(t)
+# define BFI_FLINEAR1_3580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3579, v ds
+# define BFI_FLINEAR1_3580_TICK(t)
+# define BFI_FLINEAR1_3579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3578, v ds
+# define BFI_FLINEAR1_3579_TICK(t)
+# define BFI_FLINEAR1_3578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3577, v ds
+# define BFI_FLINEAR1_3578_TICK(t)
+# define BFI_FLINEAR1_3577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3576, v ds
+# define BFI_FLINEAR1_3577_TICK(t)
+# define BFI_FLINEAR1_3576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3575, v ds
+# define BFI_FLINEAR1_3576_TICK(t)
+# define BFI_FLINEAR1_3575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3574, v ds
+# define BFI_FLINEAR1_3575_TICK(t)
+# define BFI_FLINEAR1_3574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3573, v ds
+# define BFI_FLINEAR1_3574_TICK(t)
+# define BFI_FLINEAR1_3573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3572, v ds
+# define BFI_FLINEAR1_3573_TICK(t)
+# define BFI_FLINEAR1_3572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3571, v ds
+# define BFI_FLINEAR1_3572_TICK(t)
+# define BFI_FLINEAR1_3571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3570, v ds
+# define BFI_FLINEAR1_3571_TICK(t)
+# define BFI_FLINEAR1_3570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3569, v ds
+# define BFI_FLINEAR1_3570_TICK(t)
+# define BFI_FLINEAR1_3569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3568, v ds
+# define BFI_FLINEAR1_3569_TICK(t)
+# define BFI_FLINEAR1_3568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3567, v ds
+# define BFI_FLINEAR1_3568_TICK(t)
+# define BFI_FLINEAR1_3567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3566, v ds
+# define BFI_FLINEAR1_3567_TICK(t)
+# define BFI_FLINEAR1_3566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3565, v ds
+# define BFI_FLINEAR1_3566_TICK(t)
+# define BFI_FLINEAR1_3565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3564, v ds
+# define BFI_FLINEAR1_3565_TICK(t)
+# define BFI_FLINEAR1_3564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3563, v ds
+# define BFI_FLINEAR1_3564_TICK(t)
+# define BFI_FLINEAR1_3563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3562, v ds
+# define BFI_FLINEAR1_3563_TICK(t)
+# define BFI_FLINEAR1_3562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3561, v ds
+# define BFI_FLINEAR1_3562_TICK(t)
+# define BFI_FLINEAR1_3561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3560, v ds
+# define BFI_FLINEAR1_3561_TICK(t)
+# define BFI_FLINEAR1_3560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3559, v ds
+# define BFI_FLINEAR1_3560_TICK(t)
+# define BFI_FLINEAR1_3559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3558, v ds
+# define BFI_FLINEAR1_3559_TICK(t)
+# define BFI_FLINEAR1_3558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3557, v ds
+# define BFI_FLINEAR1_3558_TICK(t)
+# define BFI_FLINEAR1_3557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3556, v ds
+# define BFI_FLINEAR1_3557_TICK(t)
+# define BFI_FLINEAR1_3556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3555, v ds
+# define BFI_FLINEAR1_3556_TICK(t)
+# define BFI_FLINEAR1_3555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3554, v ds
+# define BFI_FLINEAR1_3555_TICK(t)
+# define BFI_FLINEAR1_3554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3553, v ds
+# define BFI_FLINEAR1_3554_TICK(t)
+# define BFI_FLINEAR1_3553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3552, v ds
+# define BFI_FLINEAR1_3553_TICK(t)
+# define BFI_FLINEAR1_3552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3551, v ds
+# define BFI_FLINEAR1_3552_TICK(t)
+# define BFI_FLINEAR1_3551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3550, v ds
+# define BFI_FLINEAR1_3551_TICK(t)
+# define BFI_FLINEAR1_3550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3549, v ds
+# define BFI_FLINEAR1_3550_TICK(t)
+# define BFI_FLINEAR1_3549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3548, v ds
+# define BFI_FLINEAR1_3549_TICK(t)
+# define BFI_FLINEAR1_3548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3547, v ds
+# define BFI_FLINEAR1_3548_TICK(t)
+# define BFI_FLINEAR1_3547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3546, v ds
+# define BFI_FLINEAR1_3547_TICK(t)
+# define BFI_FLINEAR1_3546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3545, v ds
+# define BFI_FLINEAR1_3546_TICK(t)
+# define BFI_FLINEAR1_3545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3544, v ds
+# define BFI_FLINEAR1_3545_TICK(t)
+# define BFI_FLINEAR1_3544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3543, v ds
+# define BFI_FLINEAR1_3544_TICK(t)
+# define BFI_FLINEAR1_3543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3542, v ds
+# define BFI_FLINEAR1_3543_TICK(t)
+# define BFI_FLINEAR1_3542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3541, v ds
+# define BFI_FLINEAR1_3542_TICK(t)
+# define BFI_FLINEAR1_3541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3540, v ds
+# define BFI_FLINEAR1_3541_TICK(t)
+# define BFI_FLINEAR1_3540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3539, v ds
+# define BFI_FLINEAR1_3540_TICK(t)
+# define BFI_FLINEAR1_3539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3538, v ds
+# define BFI_FLINEAR1_3539_TICK(t)
+# define BFI_FLINEAR1_3538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3537, v ds
+# define BFI_FLINEAR1_3538_TICK(t)
+# define BFI_FLINEAR1_3537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3536, v ds
+# define BFI_FLINEAR1_3537_TICK(t)
+# define BFI_FLINEAR1_3536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3535, v ds
+# define BFI_FLINEAR1_3536_TICK(t)
+# define BFI_FLINEAR1_3535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3534, v ds
+# define BFI_FLINEAR1_3535_TICK(t)
+# define BFI_FLINEAR1_3534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3533, v ds
+# define BFI_FLINEAR1_3534_TICK(t)
+# define BFI_FLINEAR1_3533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3532, v ds
+# define BFI_FLINEAR1_3533_TICK(t)
+# define BFI_FLINEAR1_3532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3531, v ds
+# define BFI_FLINEAR1_3532_TICK(t)
+# define BFI_FLINEAR1_3531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3530, v ds
+# define BFI_FLINEAR1_3531_TICK(t)
+# define BFI_FLINEAR1_3530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3529, v ds
+# define BFI_FLINEAR1_3530_TICK(t)
+# define BFI_FLINEAR1_3529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3528, v ds
+# define BFI_FLINEAR1_3529_TICK(t)
+# define BFI_FLINEAR1_3528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3527, v ds
+# define BFI_FLINEAR1_3528_TICK(t)
+# define BFI_FLINEAR1_3527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3526, v ds
+# define BFI_FLINEAR1_3527_TICK(t)
+# define BFI_FLINEAR1_3526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3525, v ds
+# define BFI_FLINEAR1_3526_TICK(t)
+# define BFI_FLINEAR1_3525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3524, v ds
+# define BFI_FLINEAR1_3525_TICK(t)
+# define BFI_FLINEAR1_3524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3523, v ds
+# define BFI_FLINEAR1_3524_TICK(t)
+# define BFI_FLINEAR1_3523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3522, v ds
+# define BFI_FLINEAR1_3523_TICK(t)
+# define BFI_FLINEAR1_3522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3521, v ds
+# define BFI_FLINEAR1_3522_TICK(t)
+# define BFI_FLINEAR1_3521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3520, v ds
+# define BFI_FLINEAR1_3521_TICK(t)
+# define BFI_FLINEAR1_3520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3519, v ds
+# define BFI_FLINEAR1_3520_TICK(t)
+# define BFI_FLINEAR1_3519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3518, v ds
+# define BFI_FLINEAR1_3519_TICK(t)
+# define BFI_FLINEAR1_3518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3517, v ds
+# define BFI_FLINEAR1_3518_TICK(t)
+# define BFI_FLINEAR1_3517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3516, v ds
+# define BFI_FLINEAR1_3517_TICK(t)
+# define BFI_FLINEAR1_3516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3515, v ds
+# define BFI_FLINEAR1_3516_TICK(t)
+# define BFI_FLINEAR1_3515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3514, v ds
+# define BFI_FLINEAR1_3515_TICK(t)
+# define BFI_FLINEAR1_3514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3513, v ds
+# define BFI_FLINEAR1_3514_TICK(t)
+# define BFI_FLINEAR1_3513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3512, v ds
+# define BFI_FLINEAR1_3513_TICK(t)
+# define BFI_FLINEAR1_3512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3511, v ds
+# define BFI_FLINEAR1_3512_TICK(t)
+# define BFI_FLINEAR1_3511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3510, v ds
+# define BFI_FLINEAR1_3511_TICK(t)
+# define BFI_FLINEAR1_3510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3509, v ds
+# define BFI_FLINEAR1_3510_TICK(t)
+# define BFI_FLINEAR1_3509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3508, v ds
+# define BFI_FLINEAR1_3509_TICK(t)
+# define BFI_FLINEAR1_3508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3507, v ds
+# define BFI_FLINEAR1_3508_TICK(t)
+# define BFI_FLINEAR1_3507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3506, v ds
+# define BFI_FLINEAR1_3507_TICK(t)
+# define BFI_FLINEAR1_3506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3505, v ds
+# define BFI_FLINEAR1_3506_TICK(t)
+# define BFI_FLINEAR1_3505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3504, v ds
+# define BFI_FLINEAR1_3505_TICK(t)
+# define BFI_FLINEAR1_3504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3503, v ds
+# define BFI_FLINEAR1_3504_TICK(t)
+# define BFI_FLINEAR1_3503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3502, v ds
+# define BFI_FLINEAR1_3503_TICK(t)
+# define BFI_FLINEAR1_3502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3501, v ds
+# define BFI_FLINEAR1_3502_TICK(t)
+# define BFI_FLINEAR1_3501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3500, v ds
+# define BFI_FLINEAR1_3501_TICK(t)
+# define BFI_FLINEAR1_3500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3499, v ds
+# define BFI_FLINEAR1_3500_TICK(t)
+# define BFI_FLINEAR1_3499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3498, v ds
+# define BFI_FLINEAR1_3499_TICK(t)
+# define BFI_FLINEAR1_3498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3497, v ds
+# define BFI_FLINEAR1_3498_TICK(t)
+# define BFI_FLINEAR1_3497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3496, v ds
+# define BFI_FLINEAR1_3497_TICK(t)
+# define BFI_FLINEAR1_3496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3495, v ds
+# define BFI_FLINEAR1_3496_TICK(t)
+# define BFI_FLINEAR1_3495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3494, v ds
+# define BFI_FLINEAR1_3495_TICK(t)
+# define BFI_FLINEAR1_3494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3493, v ds
+# define BFI_FLINEAR1_3494_TICK(t)
+# define BFI_FLINEAR1_3493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3492, v ds
+# define BFI_FLINEAR1_3493_TICK(t)
+# define BFI_FLINEAR1_3492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3491, v ds
+# define BFI_FLINEAR1_3492_TICK(t)
+# define BFI_FLINEAR1_3491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3490, v ds
+# define BFI_FLINEAR1_3491_TICK(t)
+# define BFI_FLINEAR1_3490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3489, v ds
+# define BFI_FLINEAR1_3490_TICK(t)
+# define BFI_FLINEAR1_3489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3488, v ds
+# define BFI_FLINEAR1_3489_TICK(t)
+# define BFI_FLINEAR1_3488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3487, v ds
+# define BFI_FLINEAR1_3488_TICK(t)
+# define BFI_FLINEAR1_3487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3486, v ds
+# define BFI_FLINEAR1_3487_TICK(t)
+# define BFI_FLINEAR1_3486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3485, v ds
+# define BFI_FLINEAR1_3486_TICK(t)
+# define BFI_FLINEAR1_3485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3484, v ds
+# define BFI_FLINEAR1_3485_TICK(t)
+# define BFI_FLINEAR1_3484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3483, v ds
+# define BFI_FLINEAR1_3484_TICK(t)
+# define BFI_FLINEAR1_3483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3482, v ds
+# define BFI_FLINEAR1_3483_TICK(t)
+# define BFI_FLINEAR1_3482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3481, v ds
+# define BFI_FLINEAR1_3482_TICK(t)
+# define BFI_FLINEAR1_3481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3480, v ds
+# define BFI_FLINEAR1_3481_TICK(t)
+# define BFI_FLINEAR1_3480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3479, v ds
+# define BFI_FLINEAR1_3480_TICK(t)
+# define BFI_FLINEAR1_3479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3478, v ds
+# define BFI_FLINEAR1_3479_TICK(t)
+# define BFI_FLINEAR1_3478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3477, v ds
+# define BFI_FLINEAR1_3478_TICK(t)
+# define BFI_FLINEAR1_3477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3476, v ds
+# define BFI_FLINEAR1_3477_TICK(t)
+# define BFI_FLINEAR1_3476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3475, v ds
+# define BFI_FLINEAR1_3476_TICK(t)
+# define BFI_FLINEAR1_3475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3474, v ds
+# define BFI_FLINEAR1_3475_TICK(t)
+# define BFI_FLINEAR1_3474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3473, v ds
+# define BFI_FLINEAR1_3474_TICK(t)
+# define BFI_FLINEAR1_3473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3472, v ds
+# define BFI_FLINEAR1_3473_TICK(t)
+# define BFI_FLINEAR1_3472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3471, v ds
+# define BFI_FLINEAR1_3472_TICK(t)
+# define BFI_FLINEAR1_3471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3470, v ds
+# define BFI_FLINEAR1_3471_TICK(t)
+# define BFI_FLINEAR1_3470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3469, v ds
+# define BFI_FLINEAR1_3470_TICK(t)
+# define BFI_FLINEAR1_3469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3468, v ds
+# define BFI_FLINEAR1_3469_TICK(t)
+# define BFI_FLINEAR1_3468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3467, v ds
+# define BFI_FLINEAR1_3468_TICK(t)
+# define BFI_FLINEAR1_3467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3466, v ds
+# define BFI_FLINEAR1_3467_TICK(t)
+# define BFI_FLINEAR1_3466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3465, v ds
+# define BFI_FLINEAR1_3466_TICK(t)
+# define BFI_FLINEAR1_3465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3464, v ds
+# define BFI_FLINEAR1_3465_TICK(t)
+# define BFI_FLINEAR1_3464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3463, v ds
+# define BFI_FLINEAR1_3464_TICK(t)
+# define BFI_FLINEAR1_3463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3462, v ds
+# define BFI_FLINEAR1_3463_TICK(t)
+# define BFI_FLINEAR1_3462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3461, v ds
+# define BFI_FLINEAR1_3462_TICK(t)
+# define BFI_FLINEAR1_3461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3460, v ds
+# define BFI_FLINEAR1_3461_TICK(t)
+# define BFI_FLINEAR1_3460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3459, v ds
+# define BFI_FLINEAR1_3460_TICK(t)
+# define BFI_FLINEAR1_3459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3458, v ds
+# define BFI_FLINEAR1_3459_TICK(t)
+# define BFI_FLINEAR1_3458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3457, v ds
+# define BFI_FLINEAR1_3458_TICK(t)
+# define BFI_FLINEAR1_3457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3456, v ds
+# define BFI_FLINEAR1_3457_TICK(t)
+# define BFI_FLINEAR1_3456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3455, v ds
+# define BFI_FLINEAR1_3456_TICK(t)
+# define BFI_FLINEAR1_3455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3454, v ds
+# define BFI_FLINEAR1_3455_TICK(t)
+# define BFI_FLINEAR1_3454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3453, v ds
+# define BFI_FLINEAR1_3454_TICK(t)
+# define BFI_FLINEAR1_3453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3452, v ds
+# define BFI_FLINEAR1_3453_TICK(t)
+# define BFI_FLINEAR1_3452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3451, v ds
+# define BFI_FLINEAR1_3452_TICK(t)
+# define BFI_FLINEAR1_3451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3450, v ds
+# define BFI_FLINEAR1_3451_TICK(t)
+# define BFI_FLINEAR1_3450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3449, v ds
+# define BFI_FLINEAR1_3450_TICK(t)
+# define BFI_FLINEAR1_3449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3448, v ds
+# define BFI_FLINEAR1_3449_TICK(t)
+# define BFI_FLINEAR1_3448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3447, v ds
+# define BFI_FLINEAR1_3448_TICK(t)
+# define BFI_FLINEAR1_3447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3446, v ds
+# define BFI_FLINEAR1_3447_TICK(t)
+# define BFI_FLINEAR1_3446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3445, v ds
+# define BFI_FLINEAR1_3446_TICK(t)
+# define BFI_FLINEAR1_3445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3444, v ds
+# define BFI_FLINEAR1_3445_TICK(t)
+# define BFI_FLINEAR1_3444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3443, v ds
+# define BFI_FLINEAR1_3444_TICK(t)
+# define BFI_FLINEAR1_3443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3442, v ds
+# define BFI_FLINEAR1_3443_TICK(t)
+# define BFI_FLINEAR1_3442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3441, v ds
+# define BFI_FLINEAR1_3442_TICK(t)
+# define BFI_FLINEAR1_3441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3440, v ds
+# define BFI_FLINEAR1_3441_TICK(t)
+# define BFI_FLINEAR1_3440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3439, v ds
+# define BFI_FLINEAR1_3440_TICK(t)
+# define BFI_FLINEAR1_3439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3438, v ds
+# define BFI_FLINEAR1_3439_TICK(t)
+# define BFI_FLINEAR1_3438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3437, v ds
+# define BFI_FLINEAR1_3438_TICK(t)
+# define BFI_FLINEAR1_3437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3436, v ds
+# define BFI_FLINEAR1_3437_TICK(t)
+# define BFI_FLINEAR1_3436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3435, v ds
+# define BFI_FLINEAR1_3436_TICK(t)
+# define BFI_FLINEAR1_3435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3434, v ds
+# define BFI_FLINEAR1_3435_TICK(t)
+# define BFI_FLINEAR1_3434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3433, v ds
+# define BFI_FLINEAR1_3434_TICK(t)
+# define BFI_FLINEAR1_3433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3432, v ds
+# define BFI_FLINEAR1_3433_TICK(t)
+# define BFI_FLINEAR1_3432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3431, v ds
+# define BFI_FLINEAR1_3432_TICK(t)
+# define BFI_FLINEAR1_3431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3430, v ds
+# define BFI_FLINEAR1_3431_TICK(t)
+# define BFI_FLINEAR1_3430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3429, v ds
+# define BFI_FLINEAR1_3430_TICK(t)
+# define BFI_FLINEAR1_3429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3428, v ds
+# define BFI_FLINEAR1_3429_TICK(t)
+# define BFI_FLINEAR1_3428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3427, v ds
+# define BFI_FLINEAR1_3428_TICK(t)
+# define BFI_FLINEAR1_3427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3426, v ds
+# define BFI_FLINEAR1_3427_TICK(t)
+# define BFI_FLINEAR1_3426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3425, v ds
+# define BFI_FLINEAR1_3426_TICK(t)
+# define BFI_FLINEAR1_3425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3424, v ds
+# define BFI_FLINEAR1_3425_TICK(t)
+# define BFI_FLINEAR1_3424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3423, v ds
+# define BFI_FLINEAR1_3424_TICK(t)
+# define BFI_FLINEAR1_3423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3422, v ds
+# define BFI_FLINEAR1_3423_TICK(t)
+# define BFI_FLINEAR1_3422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3421, v ds
+# define BFI_FLINEAR1_3422_TICK(t)
+# define BFI_FLINEAR1_3421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3420, v ds
+# define BFI_FLINEAR1_3421_TICK(t)
+# define BFI_FLINEAR1_3420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3419, v ds
+# define BFI_FLINEAR1_3420_TICK(t)
+# define BFI_FLINEAR1_3419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3418, v ds
+# define BFI_FLINEAR1_3419_TICK(t)
+# define BFI_FLINEAR1_3418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3417, v ds
+# define BFI_FLINEAR1_3418_TICK(t)
+# define BFI_FLINEAR1_3417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3416, v ds
+# define BFI_FLINEAR1_3417_TICK(t)
+# define BFI_FLINEAR1_3416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3415, v ds
+# define BFI_FLINEAR1_3416_TICK(t)
+# define BFI_FLINEAR1_3415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3414, v ds
+# define BFI_FLINEAR1_3415_TICK(t)
+# define BFI_FLINEAR1_3414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3413, v ds
+# define BFI_FLINEAR1_3414_TICK(t)
+# define BFI_FLINEAR1_3413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3412, v ds
+# define BFI_FLINEAR1_3413_TICK(t)
+# define BFI_FLINEAR1_3412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3411, v ds
+# define BFI_FLINEAR1_3412_TICK(t)
+# define BFI_FLINEAR1_3411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3410, v ds
+# define BFI_FLINEAR1_3411_TICK(t)
+# define BFI_FLINEAR1_3410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3409, v ds
+# define BFI_FLINEAR1_3410_TICK(t)
+# define BFI_FLINEAR1_3409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3408, v ds
+# define BFI_FLINEAR1_3409_TICK(t)
+# define BFI_FLINEAR1_3408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3407, v ds
+# define BFI_FLINEAR1_3408_TICK(t)
+# define BFI_FLINEAR1_3407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3406, v ds
+# define BFI_FLINEAR1_3407_TICK(t)
+# define BFI_FLINEAR1_3406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3405, v ds
+# define BFI_FLINEAR1_3406_TICK(t)
+# define BFI_FLINEAR1_3405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3404, v ds
+# define BFI_FLINEAR1_3405_TICK(t)
+# define BFI_FLINEAR1_3404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3403, v ds
+# define BFI_FLINEAR1_3404_TICK(t)
+# define BFI_FLINEAR1_3403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3402, v ds
+# define BFI_FLINEAR1_3403_TICK(t)
+# define BFI_FLINEAR1_3402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3401, v ds
+# define BFI_FLINEAR1_3402_TICK(t)
+# define BFI_FLINEAR1_3401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3400, v ds
+# define BFI_FLINEAR1_3401_TICK(t)
+# define BFI_FLINEAR1_3400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3399, v ds
+# define BFI_FLINEAR1_3400_TICK(t)
+# define BFI_FLINEAR1_3399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3398, v ds
+# define BFI_FLINEAR1_3399_TICK(t)
+# define BFI_FLINEAR1_3398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3397, v ds
+# define BFI_FLINEAR1_3398_TICK(t)
+# define BFI_FLINEAR1_3397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3396, v ds
+# define BFI_FLINEAR1_3397_TICK(t)
+# define BFI_FLINEAR1_3396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3395, v ds
+# define BFI_FLINEAR1_3396_TICK(t)
+# define BFI_FLINEAR1_3395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3394, v ds
+# define BFI_FLINEAR1_3395_TICK(t)
+# define BFI_FLINEAR1_3394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3393, v ds
+# define BFI_FLINEAR1_3394_TICK(t)
+# define BFI_FLINEAR1_3393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3392, v ds
+# define BFI_FLINEAR1_3393_TICK(t)
+# define BFI_FLINEAR1_3392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3391, v ds
+# define BFI_FLINEAR1_3392_TICK(t)
+# define BFI_FLINEAR1_3391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3390, v ds
+# define BFI_FLINEAR1_3391_TICK(t)
+# define BFI_FLINEAR1_3390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3389, v ds
+# define BFI_FLINEAR1_3390_TICK(t)
+# define BFI_FLINEAR1_3389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3388, v ds
+# define BFI_FLINEAR1_3389_TICK(t)
+# define BFI_FLINEAR1_3388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3387, v ds
+# define BFI_FLINEAR1_3388_TICK(t)
+# define BFI_FLINEAR1_3387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3386, v ds
+# define BFI_FLINEAR1_3387_TICK(t)
+# define BFI_FLINEAR1_3386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3385, v ds
+# define BFI_FLINEAR1_3386_TICK(t)
+# define BFI_FLINEAR1_3385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3384, v ds
+# define BFI_FLINEAR1_3385_TICK(t)
+# define BFI_FLINEAR1_3384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3383, v ds
+# define BFI_FLINEAR1_3384_TICK(t)
+# define BFI_FLINEAR1_3383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3382, v ds
+# define BFI_FLINEAR1_3383_TICK(t)
+# define BFI_FLINEAR1_3382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3381, v ds
+# define BFI_FLINEAR1_3382_TICK(t)
+# define BFI_FLINEAR1_3381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3380, v ds
+# define BFI_FLINEAR1_3381_TICK(t)
+# define BFI_FLINEAR1_3380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3379, v ds
+# define BFI_FLINEAR1_3380_TICK(t)
+# define BFI_FLINEAR1_3379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3378, v ds
+# define BFI_FLINEAR1_3379_TICK(t)
+# define BFI_FLINEAR1_3378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3377, v ds
+# define BFI_FLINEAR1_3378_TICK(t)
+# define BFI_FLINEAR1_3377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3376, v ds
+# define BFI_FLINEAR1_3377_TICK(t)
+# define BFI_FLINEAR1_3376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3375, v ds
+# define BFI_FLINEAR1_3376_TICK(t)
+# define BFI_FLINEAR1_3375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3374, v ds
+# define BFI_FLINEAR1_3375_TICK(t)
+# define BFI_FLINEAR1_3374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3373, v ds
+# define BFI_FLINEAR1_3374_TICK(t)
+# define BFI_FLINEAR1_3373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3372, v ds
+# define BFI_FLINEAR1_3373_TICK(t)
+# define BFI_FLINEAR1_3372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3371, v ds
+# define BFI_FLINEAR1_3372_TICK(t)
+# define BFI_FLINEAR1_3371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3370, v ds
+# define BFI_FLINEAR1_3371_TICK(t)
+# define BFI_FLINEAR1_3370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3369, v ds
+# define BFI_FLINEAR1_3370_TICK(t)
+# define BFI_FLINEAR1_3369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3368, v ds
+# define BFI_FLINEAR1_3369_TICK(t)
+# define BFI_FLINEAR1_3368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3367, v ds
+# define BFI_FLINEAR1_3368_TICK(t)
+# define BFI_FLINEAR1_3367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3366, v ds
+# define BFI_FLINEAR1_3367_TICK(t)
+# define BFI_FLINEAR1_3366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3365, v ds
+# define BFI_FLINEAR1_3366_TICK(t)
+# define BFI_FLINEAR1_3365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3364, v ds
+# define BFI_FLINEAR1_3365_TICK(t)
+# define BFI_FLINEAR1_3364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3363, v ds
+# define BFI_FLINEAR1_3364_TICK(t)
+# define BFI_FLINEAR1_3363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3362, v ds
+# define BFI_FLINEAR1_3363_TICK(t)
+# define BFI_FLINEAR1_3362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3361, v ds
+# define BFI_FLINEAR1_3362_TICK(t)
+# define BFI_FLINEAR1_3361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3360, v ds
+# define BFI_FLINEAR1_3361_TICK(t)
+# define BFI_FLINEAR1_3360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3359, v ds
+# define BFI_FLINEAR1_3360_TICK(t)
+# define BFI_FLINEAR1_3359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3358, v ds
+# define BFI_FLINEAR1_3359_TICK(t)
+# define BFI_FLINEAR1_3358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3357, v ds
+# define BFI_FLINEAR1_3358_TICK(t)
+# define BFI_FLINEAR1_3357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3356, v ds
+# define BFI_FLINEAR1_3357_TICK(t)
+# define BFI_FLINEAR1_3356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3355, v ds
+# define BFI_FLINEAR1_3356_TICK(t)
+# define BFI_FLINEAR1_3355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3354, v ds
+# define BFI_FLINEAR1_3355_TICK(t)
+# define BFI_FLINEAR1_3354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3353, v ds
+# define BFI_FLINEAR1_3354_TICK(t)
+# define BFI_FLINEAR1_3353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3352, v ds
+# define BFI_FLINEAR1_3353_TICK(t)
+# define BFI_FLINEAR1_3352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3351, v ds
+# define BFI_FLINEAR1_3352_TICK(t)
+# define BFI_FLINEAR1_3351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3350, v ds
+# define BFI_FLINEAR1_3351_TICK(t)
+# define BFI_FLINEAR1_3350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3349, v ds
+# define BFI_FLINEAR1_3350_TICK(t)
+# define BFI_FLINEAR1_3349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3348, v ds
+# define BFI_FLINEAR1_3349_TICK(t)
+# define BFI_FLINEAR1_3348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3347, v ds
+# define BFI_FLINEAR1_3348_TICK(t)
+# define BFI_FLINEAR1_3347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3346, v ds
+# define BFI_FLINEAR1_3347_TICK(t)
+# define BFI_FLINEAR1_3346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3345, v ds
+# define BFI_FLINEAR1_3346_TICK(t)
+# define BFI_FLINEAR1_3345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3344, v ds
+# define BFI_FLINEAR1_3345_TICK(t)
+# define BFI_FLINEAR1_3344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3343, v ds
+# define BFI_FLINEAR1_3344_TICK(t)
+# define BFI_FLINEAR1_3343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3342, v ds
+# define BFI_FLINEAR1_3343_TICK(t)
+# define BFI_FLINEAR1_3342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3341, v ds
+# define BFI_FLINEAR1_3342_TICK(t)
+# define BFI_FLINEAR1_3341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3340, v ds
+# define BFI_FLINEAR1_3341_TICK(t)
+# define BFI_FLINEAR1_3340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3339, v ds
+# define BFI_FLINEAR1_3340_TICK(t)
+# define BFI_FLINEAR1_3339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3338, v ds
+# define BFI_FLINEAR1_3339_TICK(t)
+# define BFI_FLINEAR1_3338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3337, v ds
+# define BFI_FLINEAR1_3338_TICK(t)
+# define BFI_FLINEAR1_3337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3336, v ds
+# define BFI_FLINEAR1_3337_TICK(t)
+# define BFI_FLINEAR1_3336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3335, v ds
+# define BFI_FLINEAR1_3336_TICK(t)
+# define BFI_FLINEAR1_3335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3334, v ds
+# define BFI_FLINEAR1_3335_TICK(t)
+# define BFI_FLINEAR1_3334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3333, v ds
+# define BFI_FLINEAR1_3334_TICK(t)
+# define BFI_FLINEAR1_3333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3332, v ds
+# define BFI_FLINEAR1_3333_TICK(t)
+# define BFI_FLINEAR1_3332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3331, v ds
+# define BFI_FLINEAR1_3332_TICK(t)
+# define BFI_FLINEAR1_3331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3330, v ds
+# define BFI_FLINEAR1_3331_TICK(t)
+# define BFI_FLINEAR1_3330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3329, v ds
+# define BFI_FLINEAR1_3330_TICK(t)
+# define BFI_FLINEAR1_3329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3328, v ds
+# define BFI_FLINEAR1_3329_TICK(t)
+# define BFI_FLINEAR1_3328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3327, v ds
+# define BFI_FLINEAR1_3328_TICK(t)
+# define BFI_FLINEAR1_3327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3326, v ds
+# define BFI_FLINEAR1_3327_TICK(t)
+# define BFI_FLINEAR1_3326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3325, v ds
+# define BFI_FLINEAR1_3326_TICK(t)
+# define BFI_FLINEAR1_3325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3324, v ds
+# define BFI_FLINEAR1_3325_TICK(t)
+# define BFI_FLINEAR1_3324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3323, v ds
+# define BFI_FLINEAR1_3324_TICK(t)
+# define BFI_FLINEAR1_3323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3322, v ds
+# define BFI_FLINEAR1_3323_TICK(t)
+# define BFI_FLINEAR1_3322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3321, v ds
+# define BFI_FLINEAR1_3322_TICK(t)
+# define BFI_FLINEAR1_3321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3320, v ds
+# define BFI_FLINEAR1_3321_TICK(t)
+# define BFI_FLINEAR1_3320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3319, v ds
+# define BFI_FLINEAR1_3320_TICK(t)
+# define BFI_FLINEAR1_3319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3318, v ds
+# define BFI_FLINEAR1_3319_TICK(t)
+# define BFI_FLINEAR1_3318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3317, v ds
+# define BFI_FLINEAR1_3318_TICK(t)
+# define BFI_FLINEAR1_3317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3316, v ds
+# define BFI_FLINEAR1_3317_TICK(t)
+# define BFI_FLINEAR1_3316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3315, v ds
+# define BFI_FLINEAR1_3316_TICK(t)
+# define BFI_FLINEAR1_3315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3314, v ds
+# define BFI_FLINEAR1_3315_TICK(t)
+# define BFI_FLINEAR1_3314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3313, v ds
+# define BFI_FLINEAR1_3314_TICK(t)
+# define BFI_FLINEAR1_3313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3312, v ds
+# define BFI_FLINEAR1_3313_TICK(t)
+# define BFI_FLINEAR1_3312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3311, v ds
+# define BFI_FLINEAR1_3312_TICK(t)
+# define BFI_FLINEAR1_3311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3310, v ds
+# define BFI_FLINEAR1_3311_TICK(t)
+# define BFI_FLINEAR1_3310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3309, v ds
+# define BFI_FLINEAR1_3310_TICK(t)
+# define BFI_FLINEAR1_3309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3308, v ds
+# define BFI_FLINEAR1_3309_TICK(t)
+# define BFI_FLINEAR1_3308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3307, v ds
+# define BFI_FLINEAR1_3308_TICK(t)
+# define BFI_FLINEAR1_3307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3306, v ds
+# define BFI_FLINEAR1_3307_TICK(t)
+# define BFI_FLINEAR1_3306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3305, v ds
+# define BFI_FLINEAR1_3306_TICK(t)
+# define BFI_FLINEAR1_3305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3304, v ds
+# define BFI_FLINEAR1_3305_TICK(t)
+# define BFI_FLINEAR1_3304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3303, v ds
+# define BFI_FLINEAR1_3304_TICK(t)
+# define BFI_FLINEAR1_3303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3302, v ds
+# define BFI_FLINEAR1_3303_TICK(t)
+# define BFI_FLINEAR1_3302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3301, v ds
+# define BFI_FLINEAR1_3302_TICK(t)
+# define BFI_FLINEAR1_3301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3300, v ds
+# define BFI_FLINEAR1_3301_TICK(t)
+# define BFI_FLINEAR1_3300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3299, v ds
+# define BFI_FLINEAR1_3300_TICK(t)
+# define BFI_FLINEAR1_3299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3298, v ds
+# define BFI_FLINEAR1_3299_TICK(t)
+# define BFI_FLINEAR1_3298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3297, v ds
+# define BFI_FLINEAR1_3298_TICK(t)
+# define BFI_FLINEAR1_3297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3296, v ds
+# define BFI_FLINEAR1_3297_TICK(t)
+# define BFI_FLINEAR1_3296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3295, v ds
+# define BFI_FLINEAR1_3296_TICK(t)
+# define BFI_FLINEAR1_3295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3294, v ds
+# define BFI_FLINEAR1_3295_TICK(t)
+# define BFI_FLINEAR1_3294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3293, v ds
+# define BFI_FLINEAR1_3294_TICK(t)
+# define BFI_FLINEAR1_3293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3292, v ds
+# define BFI_FLINEAR1_3293_TICK(t)
+# define BFI_FLINEAR1_3292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3291, v ds
+# define BFI_FLINEAR1_3292_TICK(t)
+# define BFI_FLINEAR1_3291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3290, v ds
+# define BFI_FLINEAR1_3291_TICK(t)
+# define BFI_FLINEAR1_3290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3289, v ds
+# define BFI_FLINEAR1_3290_TICK(t)
+# define BFI_FLINEAR1_3289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3288, v ds
+# define BFI_FLINEAR1_3289_TICK(t)
+# define BFI_FLINEAR1_3288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3287, v ds
+# define BFI_FLINEAR1_3288_TICK(t)
+# define BFI_FLINEAR1_3287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3286, v ds
+# define BFI_FLINEAR1_3287_TICK(t)
+# define BFI_FLINEAR1_3286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3285, v ds
+# define BFI_FLINEAR1_3286_TICK(t)
+# define BFI_FLINEAR1_3285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3284, v ds
+# define BFI_FLINEAR1_3285_TICK(t)
+# define BFI_FLINEAR1_3284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3283, v ds
+# define BFI_FLINEAR1_3284_TICK(t)
+# define BFI_FLINEAR1_3283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3282, v ds
+# define BFI_FLINEAR1_3283_TICK(t)
+# define BFI_FLINEAR1_3282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3281, v ds
+# define BFI_FLINEAR1_3282_TICK(t)
+# define BFI_FLINEAR1_3281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3280, v ds
+# define BFI_FLINEAR1_3281_TICK(t)
+# define BFI_FLINEAR1_3280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3279, v ds
+# define BFI_FLINEAR1_3280_TICK(t)
+# define BFI_FLINEAR1_3279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3278, v ds
+# define BFI_FLINEAR1_3279_TICK(t)
+# define BFI_FLINEAR1_3278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3277, v ds
+# define BFI_FLINEAR1_3278_TICK(t)
+# define BFI_FLINEAR1_3277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3276, v ds
+# define BFI_FLINEAR1_3277_TICK(t)
+# define BFI_FLINEAR1_3276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3275, v ds
+# define BFI_FLINEAR1_3276_TICK(t)
+# define BFI_FLINEAR1_3275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3274, v ds
+# define BFI_FLINEAR1_3275_TICK(t)
+# define BFI_FLINEAR1_3274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3273, v ds
+# define BFI_FLINEAR1_3274_TICK(t)
+# define BFI_FLINEAR1_3273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3272, v ds
+# define BFI_FLINEAR1_3273_TICK(t)
+# define BFI_FLINEAR1_3272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3271, v ds
+# define BFI_FLINEAR1_3272_TICK(t)
+# define BFI_FLINEAR1_3271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3270, v ds
+# define BFI_FLINEAR1_3271_TICK(t)
+# define BFI_FLINEAR1_3270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3269, v ds
+# define BFI_FLINEAR1_3270_TICK(t)
+# define BFI_FLINEAR1_3269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3268, v ds
+# define BFI_FLINEAR1_3269_TICK(t)
+# define BFI_FLINEAR1_3268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3267, v ds
+# define BFI_FLINEAR1_3268_TICK(t)
+# define BFI_FLINEAR1_3267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3266, v ds
+# define BFI_FLINEAR1_3267_TICK(t)
+# define BFI_FLINEAR1_3266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3265, v ds
+# define BFI_FLINEAR1_3266_TICK(t)
+# define BFI_FLINEAR1_3265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3264, v ds
+# define BFI_FLINEAR1_3265_TICK(t)
+# define BFI_FLINEAR1_3264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3263, v ds
+# define BFI_FLINEAR1_3264_TICK(t)
+# define BFI_FLINEAR1_3263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3262, v ds
+# define BFI_FLINEAR1_3263_TICK(t)
+# define BFI_FLINEAR1_3262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3261, v ds
+# define BFI_FLINEAR1_3262_TICK(t)
+# define BFI_FLINEAR1_3261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3260, v ds
+# define BFI_FLINEAR1_3261_TICK(t)
+# define BFI_FLINEAR1_3260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3259, v ds
+# define BFI_FLINEAR1_3260_TICK(t)
+# define BFI_FLINEAR1_3259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3258, v ds
+# define BFI_FLINEAR1_3259_TICK(t)
+# define BFI_FLINEAR1_3258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3257, v ds
+# define BFI_FLINEAR1_3258_TICK(t)
+# define BFI_FLINEAR1_3257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3256, v ds
+# define BFI_FLINEAR1_3257_TICK(t)
+# define BFI_FLINEAR1_3256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3255, v ds
+# define BFI_FLINEAR1_3256_TICK(t)
+# define BFI_FLINEAR1_3255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3254, v ds
+# define BFI_FLINEAR1_3255_TICK(t)
+# define BFI_FLINEAR1_3254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3253, v ds
+# define BFI_FLINEAR1_3254_TICK(t)
+# define BFI_FLINEAR1_3253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3252, v ds
+# define BFI_FLINEAR1_3253_TICK(t)
+# define BFI_FLINEAR1_3252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3251, v ds
+# define BFI_FLINEAR1_3252_TICK(t)
+# define BFI_FLINEAR1_3251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3250, v ds
+# define BFI_FLINEAR1_3251_TICK(t)
+# define BFI_FLINEAR1_3250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3249, v ds
+# define BFI_FLINEAR1_3250_TICK(t)
+# define BFI_FLINEAR1_3249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3248, v ds
+# define BFI_FLINEAR1_3249_TICK(t)
+# define BFI_FLINEAR1_3248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3247, v ds
+# define BFI_FLINEAR1_3248_TICK(t)
+# define BFI_FLINEAR1_3247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3246, v ds
+# define BFI_FLINEAR1_3247_TICK(t)
+# define BFI_FLINEAR1_3246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3245, v ds
+# define BFI_FLINEAR1_3246_TICK(t)
+# define BFI_FLINEAR1_3245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3244, v ds
+# define BFI_FLINEAR1_3245_TICK(t)
+# define BFI_FLINEAR1_3244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3243, v ds
+# define BFI_FLINEAR1_3244_TICK(t)
+# define BFI_FLINEAR1_3243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3242, v ds
+# define BFI_FLINEAR1_3243_TICK(t)
+# define BFI_FLINEAR1_3242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3241, v ds
+# define BFI_FLINEAR1_3242_TICK(t)
+# define BFI_FLINEAR1_3241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3240, v ds
+# define BFI_FLINEAR1_3241_TICK(t)
+# define BFI_FLINEAR1_3240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3239, v ds
+# define BFI_FLINEAR1_3240_TICK(t)
+# define BFI_FLINEAR1_3239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3238, v ds
+# define BFI_FLINEAR1_3239_TICK(t)
+# define BFI_FLINEAR1_3238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3237, v ds
+# define BFI_FLINEAR1_3238_TICK(t)
+# define BFI_FLINEAR1_3237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3236, v ds
+# define BFI_FLINEAR1_3237_TICK(t)
+# define BFI_FLINEAR1_3236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3235, v ds
+# define BFI_FLINEAR1_3236_TICK(t)
+# define BFI_FLINEAR1_3235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3234, v ds
+# define BFI_FLINEAR1_3235_TICK(t)
+# define BFI_FLINEAR1_3234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3233, v ds
+# define BFI_FLINEAR1_3234_TICK(t)
+# define BFI_FLINEAR1_3233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3232, v ds
+# define BFI_FLINEAR1_3233_TICK(t)
+# define BFI_FLINEAR1_3232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3231, v ds
+# define BFI_FLINEAR1_3232_TICK(t)
+# define BFI_FLINEAR1_3231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3230, v ds
+# define BFI_FLINEAR1_3231_TICK(t)
+# define BFI_FLINEAR1_3230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3229, v ds
+# define BFI_FLINEAR1_3230_TICK(t)
+# define BFI_FLINEAR1_3229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3228, v ds
+# define BFI_FLINEAR1_3229_TICK(t)
+# define BFI_FLINEAR1_3228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3227, v ds
+# define BFI_FLINEAR1_3228_TICK(t)
+# define BFI_FLINEAR1_3227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3226, v ds
+# define BFI_FLINEAR1_3227_TICK(t)
+# define BFI_FLINEAR1_3226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3225, v ds
+# define BFI_FLINEAR1_3226_TICK(t)
+# define BFI_FLINEAR1_3225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3224, v ds
+# define BFI_FLINEAR1_3225_TICK(t)
+# define BFI_FLINEAR1_3224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3223, v ds
+# define BFI_FLINEAR1_3224_TICK(t)
+# define BFI_FLINEAR1_3223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3222, v ds
+# define BFI_FLINEAR1_3223_TICK(t)
+# define BFI_FLINEAR1_3222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3221, v ds
+# define BFI_FLINEAR1_3222_TICK(t)
+# define BFI_FLINEAR1_3221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3220, v ds
+# define BFI_FLINEAR1_3221_TICK(t)
+# define BFI_FLINEAR1_3220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3219, v ds
+# define BFI_FLINEAR1_3220_TICK(t)
+# define BFI_FLINEAR1_3219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3218, v ds
+# define BFI_FLINEAR1_3219_TICK(t)
+# define BFI_FLINEAR1_3218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3217, v ds
+# define BFI_FLINEAR1_3218_TICK(t)
+# define BFI_FLINEAR1_3217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3216, v ds
+# define BFI_FLINEAR1_3217_TICK(t)
+# define BFI_FLINEAR1_3216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3215, v ds
+# define BFI_FLINEAR1_3216_TICK(t)
+# define BFI_FLINEAR1_3215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3214, v ds
+# define BFI_FLINEAR1_3215_TICK(t)
+# define BFI_FLINEAR1_3214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3213, v ds
+# define BFI_FLINEAR1_3214_TICK(t)
+# define BFI_FLINEAR1_3213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3212, v ds
+# define BFI_FLINEAR1_3213_TICK(t)
+# define BFI_FLINEAR1_3212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3211, v ds
+# define BFI_FLINEAR1_3212_TICK(t)
+# define BFI_FLINEAR1_3211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3210, v ds
+# define BFI_FLINEAR1_3211_TICK(t)
+# define BFI_FLINEAR1_3210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3209, v ds
+# define BFI_FLINEAR1_3210_TICK(t)
+# define BFI_FLINEAR1_3209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3208, v ds
+# define BFI_FLINEAR1_3209_TICK(t)
+# define BFI_FLINEAR1_3208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3207, v ds
+# define BFI_FLINEAR1_3208_TICK(t)
+# define BFI_FLINEAR1_3207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3206, v ds
+# define BFI_FLINEAR1_3207_TICK(t)
+# define BFI_FLINEAR1_3206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3205, v ds
+# define BFI_FLINEAR1_3206_TICK(t)
+# define BFI_FLINEAR1_3205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3204, v ds
+# define BFI_FLINEAR1_3205_TICK(t)
+# define BFI_FLINEAR1_3204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3203, v ds
+# define BFI_FLINEAR1_3204_TICK(t)
+# define BFI_FLINEAR1_3203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3202, v ds
+# define BFI_FLINEAR1_3203_TICK(t)
+# define BFI_FLINEAR1_3202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3201, v ds
+# define BFI_FLINEAR1_3202_TICK(t)
+# define BFI_FLINEAR1_3201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3200, v ds
+# define BFI_FLINEAR1_3201_TICK(t)
+# define BFI_FLINEAR1_3200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3199, v ds
+# define BFI_FLINEAR1_3200_TICK(t)
+# define BFI_FLINEAR1_3199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3198, v ds
+# define BFI_FLINEAR1_3199_TICK(t)
+# define BFI_FLINEAR1_3198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3197, v ds
+# define BFI_FLINEAR1_3198_TICK(t)
+# define BFI_FLINEAR1_3197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3196, v ds
+# define BFI_FLINEAR1_3197_TICK(t)
+# define BFI_FLINEAR1_3196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3195, v ds
+# define BFI_FLINEAR1_3196_TICK(t)
+# define BFI_FLINEAR1_3195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3194, v ds
+# define BFI_FLINEAR1_3195_TICK(t)
+# define BFI_FLINEAR1_3194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3193, v ds
+# define BFI_FLINEAR1_3194_TICK(t)
+# define BFI_FLINEAR1_3193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3192, v ds
+# define BFI_FLINEAR1_3193_TICK(t)
+# define BFI_FLINEAR1_3192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3191, v ds
+# define BFI_FLINEAR1_3192_TICK(t)
+# define BFI_FLINEAR1_3191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3190, v ds
+# define BFI_FLINEAR1_3191_TICK(t)
+# define BFI_FLINEAR1_3190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3189, v ds
+# define BFI_FLINEAR1_3190_TICK(t)
+# define BFI_FLINEAR1_3189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3188, v ds
+# define BFI_FLINEAR1_3189_TICK(t)
+# define BFI_FLINEAR1_3188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3187, v ds
+# define BFI_FLINEAR1_3188_TICK(t)
+# define BFI_FLINEAR1_3187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3186, v ds
+# define BFI_FLINEAR1_3187_TICK(t)
+# define BFI_FLINEAR1_3186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3185, v ds
+# define BFI_FLINEAR1_3186_TICK(t)
+# define BFI_FLINEAR1_3185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3184, v ds
+# define BFI_FLINEAR1_3185_TICK(t)
+# define BFI_FLINEAR1_3184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3183, v ds
+# define BFI_FLINEAR1_3184_TICK(t)
+# define BFI_FLINEAR1_3183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3182, v ds
+# define BFI_FLINEAR1_3183_TICK(t)
+# define BFI_FLINEAR1_3182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3181, v ds
+# define BFI_FLINEAR1_3182_TICK(t)
+# define BFI_FLINEAR1_3181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3180, v ds
+# define BFI_FLINEAR1_3181_TICK(t)
+# define BFI_FLINEAR1_3180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3179, v ds
+# define BFI_FLINEAR1_3180_TICK(t)
+# define BFI_FLINEAR1_3179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3178, v ds
+# define BFI_FLINEAR1_3179_TICK(t)
+# define BFI_FLINEAR1_3178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3177, v ds
+# define BFI_FLINEAR1_3178_TICK(t)
+# define BFI_FLINEAR1_3177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3176, v ds
+# define BFI_FLINEAR1_3177_TICK(t)
+# define BFI_FLINEAR1_3176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3175, v ds
+# define BFI_FLINEAR1_3176_TICK(t)
+# define BFI_FLINEAR1_3175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3174, v ds
+# define BFI_FLINEAR1_3175_TICK(t)
+# define BFI_FLINEAR1_3174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3173, v ds
+# define BFI_FLINEAR1_3174_TICK(t)
+# define BFI_FLINEAR1_3173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3172, v ds
+# define BFI_FLINEAR1_3173_TICK(t)
+# define BFI_FLINEAR1_3172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3171, v ds
+# define BFI_FLINEAR1_3172_TICK(t)
+# define BFI_FLINEAR1_3171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3170, v ds
+# define BFI_FLINEAR1_3171_TICK(t)
+# define BFI_FLINEAR1_3170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3169, v ds
+# define BFI_FLINEAR1_3170_TICK(t)
+# define BFI_FLINEAR1_3169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3168, v ds
+# define BFI_FLINEAR1_3169_TICK(t)
+# define BFI_FLINEAR1_3168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3167, v ds
+# define BFI_FLINEAR1_3168_TICK(t)
+# define BFI_FLINEAR1_3167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3166, v ds
+# define BFI_FLINEAR1_3167_TICK(t)
+# define BFI_FLINEAR1_3166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3165, v ds
+# define BFI_FLINEAR1_3166_TICK(t)
+# define BFI_FLINEAR1_3165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3164, v ds
+# define BFI_FLINEAR1_3165_TICK(t)
+# define BFI_FLINEAR1_3164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3163, v ds
+# define BFI_FLINEAR1_3164_TICK(t)
+# define BFI_FLINEAR1_3163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3162, v ds
+# define BFI_FLINEAR1_3163_TICK(t)
+# define BFI_FLINEAR1_3162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3161, v ds
+# define BFI_FLINEAR1_3162_TICK(t)
+# define BFI_FLINEAR1_3161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3160, v ds
+# define BFI_FLINEAR1_3161_TICK(t)
+# define BFI_FLINEAR1_3160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3159, v ds
+# define BFI_FLINEAR1_3160_TICK(t)
+# define BFI_FLINEAR1_3159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3158, v ds
+# define BFI_FLINEAR1_3159_TICK(t)
+# define BFI_FLINEAR1_3158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3157, v ds
+# define BFI_FLINEAR1_3158_TICK(t)
+# define BFI_FLINEAR1_3157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3156, v ds
+# define BFI_FLINEAR1_3157_TICK(t)
+# define BFI_FLINEAR1_3156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3155, v ds
+# define BFI_FLINEAR1_3156_TICK(t)
+# define BFI_FLINEAR1_3155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3154, v ds
+# define BFI_FLINEAR1_3155_TICK(t)
+# define BFI_FLINEAR1_3154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3153, v ds
+# define BFI_FLINEAR1_3154_TICK(t)
+# define BFI_FLINEAR1_3153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3152, v ds
+# define BFI_FLINEAR1_3153_TICK(t)
+# define BFI_FLINEAR1_3152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3151, v ds
+# define BFI_FLINEAR1_3152_TICK(t)
+# define BFI_FLINEAR1_3151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3150, v ds
+# define BFI_FLINEAR1_3151_TICK(t)
+# define BFI_FLINEAR1_3150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3149, v ds
+# define BFI_FLINEAR1_3150_TICK(t)
+# define BFI_FLINEAR1_3149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3148, v ds
+# define BFI_FLINEAR1_3149_TICK(t)
+# define BFI_FLINEAR1_3148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3147, v ds
+# define BFI_FLINEAR1_3148_TICK(t)
+# define BFI_FLINEAR1_3147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3146, v ds
+# define BFI_FLINEAR1_3147_TICK(t)
+# define BFI_FLINEAR1_3146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3145, v ds
+# define BFI_FLINEAR1_3146_TICK(t)
+# define BFI_FLINEAR1_3145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3144, v ds
+# define BFI_FLINEAR1_3145_TICK(t)
+# define BFI_FLINEAR1_3144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3143, v ds
+# define BFI_FLINEAR1_3144_TICK(t)
+# define BFI_FLINEAR1_3143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3142, v ds
+# define BFI_FLINEAR1_3143_TICK(t)
+# define BFI_FLINEAR1_3142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3141, v ds
+# define BFI_FLINEAR1_3142_TICK(t)
+# define BFI_FLINEAR1_3141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3140, v ds
+# define BFI_FLINEAR1_3141_TICK(t)
+# define BFI_FLINEAR1_3140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3139, v ds
+# define BFI_FLINEAR1_3140_TICK(t)
+# define BFI_FLINEAR1_3139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3138, v ds
+# define BFI_FLINEAR1_3139_TICK(t)
+# define BFI_FLINEAR1_3138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3137, v ds
+# define BFI_FLINEAR1_3138_TICK(t)
+# define BFI_FLINEAR1_3137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3136, v ds
+# define BFI_FLINEAR1_3137_TICK(t)
+# define BFI_FLINEAR1_3136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3135, v ds
+# define BFI_FLINEAR1_3136_TICK(t)
+# define BFI_FLINEAR1_3135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3134, v ds
+# define BFI_FLINEAR1_3135_TICK(t)
+# define BFI_FLINEAR1_3134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3133, v ds
+# define BFI_FLINEAR1_3134_TICK(t)
+# define BFI_FLINEAR1_3133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3132, v ds
+# define BFI_FLINEAR1_3133_TICK(t)
+# define BFI_FLINEAR1_3132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3131, v ds
+# define BFI_FLINEAR1_3132_TICK(t)
+# define BFI_FLINEAR1_3131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3130, v ds
+# define BFI_FLINEAR1_3131_TICK(t)
+# define BFI_FLINEAR1_3130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3129, v ds
+# define BFI_FLINEAR1_3130_TICK(t)
+# define BFI_FLINEAR1_3129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3128, v ds
+# define BFI_FLINEAR1_3129_TICK(t)
+# define BFI_FLINEAR1_3128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3127, v ds
+# define BFI_FLINEAR1_3128_TICK(t)
+# define BFI_FLINEAR1_3127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3126, v ds
+# define BFI_FLINEAR1_3127_TICK(t)
+# define BFI_FLINEAR1_3126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3125, v ds
+# define BFI_FLINEAR1_3126_TICK(t)
+# define BFI_FLINEAR1_3125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3124, v ds
+# define BFI_FLINEAR1_3125_TICK(t)
+# define BFI_FLINEAR1_3124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3123, v ds
+# define BFI_FLINEAR1_3124_TICK(t)
+# define BFI_FLINEAR1_3123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3122, v ds
+# define BFI_FLINEAR1_3123_TICK(t)
+# define BFI_FLINEAR1_3122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3121, v ds
+# define BFI_FLINEAR1_3122_TICK(t)
+# define BFI_FLINEAR1_3121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3120, v ds
+# define BFI_FLINEAR1_3121_TICK(t)
+# define BFI_FLINEAR1_3120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3119, v ds
+# define BFI_FLINEAR1_3120_TICK(t)
+# define BFI_FLINEAR1_3119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3118, v ds
+# define BFI_FLINEAR1_3119_TICK(t)
+# define BFI_FLINEAR1_3118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3117, v ds
+# define BFI_FLINEAR1_3118_TICK(t)
+# define BFI_FLINEAR1_3117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3116, v ds
+# define BFI_FLINEAR1_3117_TICK(t)
+# define BFI_FLINEAR1_3116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3115, v ds
+# define BFI_FLINEAR1_3116_TICK(t)
+# define BFI_FLINEAR1_3115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3114, v ds
+# define BFI_FLINEAR1_3115_TICK(t)
+# define BFI_FLINEAR1_3114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3113, v ds
+# define BFI_FLINEAR1_3114_TICK(t)
+# define BFI_FLINEAR1_3113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3112, v ds
+# define BFI_FLINEAR1_3113_TICK(t)
+# define BFI_FLINEAR1_3112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3111, v ds
+# define BFI_FLINEAR1_3112_TICK(t)
+# define BFI_FLINEAR1_3111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3110, v ds
+# define BFI_FLINEAR1_3111_TICK(t)
+# define BFI_FLINEAR1_3110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3109, v ds
+# define BFI_FLINEAR1_3110_TICK(t)
+# define BFI_FLINEAR1_3109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3108, v ds
+# define BFI_FLINEAR1_3109_TICK(t)
+# define BFI_FLINEAR1_3108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3107, v ds
+# define BFI_FLINEAR1_3108_TICK(t)
+# define BFI_FLINEAR1_3107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3106, v ds
+# define BFI_FLINEAR1_3107_TICK(t)
+# define BFI_FLINEAR1_3106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3105, v ds
+# define BFI_FLINEAR1_3106_TICK(t)
+# define BFI_FLINEAR1_3105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3104, v ds
+# define BFI_FLINEAR1_3105_TICK(t)
+# define BFI_FLINEAR1_3104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3103, v ds
+# define BFI_FLINEAR1_3104_TICK(t)
+# define BFI_FLINEAR1_3103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3102, v ds
+# define BFI_FLINEAR1_3103_TICK(t)
+# define BFI_FLINEAR1_3102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3101, v ds
+# define BFI_FLINEAR1_3102_TICK(t)
+# define BFI_FLINEAR1_3101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3100, v ds
+# define BFI_FLINEAR1_3101_TICK(t)
+# define BFI_FLINEAR1_3100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3099, v ds
+# define BFI_FLINEAR1_3100_TICK(t)
+# define BFI_FLINEAR1_3099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3098, v ds
+# define BFI_FLINEAR1_3099_TICK(t)
+# define BFI_FLINEAR1_3098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3097, v ds
+# define BFI_FLINEAR1_3098_TICK(t)
+# define BFI_FLINEAR1_3097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3096, v ds
+# define BFI_FLINEAR1_3097_TICK(t)
+# define BFI_FLINEAR1_3096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3095, v ds
+# define BFI_FLINEAR1_3096_TICK(t)
+# define BFI_FLINEAR1_3095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3094, v ds
+# define BFI_FLINEAR1_3095_TICK(t)
+# define BFI_FLINEAR1_3094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3093, v ds
+# define BFI_FLINEAR1_3094_TICK(t)
+# define BFI_FLINEAR1_3093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3092, v ds
+# define BFI_FLINEAR1_3093_TICK(t)
+# define BFI_FLINEAR1_3092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3091, v ds
+# define BFI_FLINEAR1_3092_TICK(t)
+# define BFI_FLINEAR1_3091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3090, v ds
+# define BFI_FLINEAR1_3091_TICK(t)
+# define BFI_FLINEAR1_3090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3089, v ds
+# define BFI_FLINEAR1_3090_TICK(t)
+# define BFI_FLINEAR1_3089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3088, v ds
+# define BFI_FLINEAR1_3089_TICK(t)
+# define BFI_FLINEAR1_3088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3087, v ds
+# define BFI_FLINEAR1_3088_TICK(t)
+# define BFI_FLINEAR1_3087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3086, v ds
+# define BFI_FLINEAR1_3087_TICK(t)
+# define BFI_FLINEAR1_3086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3085, v ds
+# define BFI_FLINEAR1_3086_TICK(t)
+# define BFI_FLINEAR1_3085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3084, v ds
+# define BFI_FLINEAR1_3085_TICK(t)
+# define BFI_FLINEAR1_3084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3083, v ds
+# define BFI_FLINEAR1_3084_TICK(t)
+# define BFI_FLINEAR1_3083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3082, v ds
+# define BFI_FLINEAR1_3083_TICK(t)
+# define BFI_FLINEAR1_3082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3081, v ds
+# define BFI_FLINEAR1_3082_TICK(t)
+# define BFI_FLINEAR1_3081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3080, v ds
+# define BFI_FLINEAR1_3081_TICK(t)
+# define BFI_FLINEAR1_3080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3079, v ds
+# define BFI_FLINEAR1_3080_TICK(t)
+# define BFI_FLINEAR1_3079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3078, v ds
+# define BFI_FLINEAR1_3079_TICK(t)
+# define BFI_FLINEAR1_3078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3077, v ds
+# define BFI_FLINEAR1_3078_TICK(t)
+# define BFI_FLINEAR1_3077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3076, v ds
+# define BFI_FLINEAR1_3077_TICK(t)
+# define BFI_FLINEAR1_3076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3075, v ds
+# define BFI_FLINEAR1_3076_TICK(t)
+# define BFI_FLINEAR1_3075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3074, v ds
+# define BFI_FLINEAR1_3075_TICK(t)
+# define BFI_FLINEAR1_3074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3073, v ds
+# define BFI_FLINEAR1_3074_TICK(t)
+# define BFI_FLINEAR1_3073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3072, v ds
+# define BFI_FLINEAR1_3073_TICK(t)
+# define BFI_FLINEAR1_3072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3071, v ds
+# define BFI_FLINEAR1_3072_TICK(t)
+# define BFI_FLINEAR1_3071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3070, v ds
+# define BFI_FLINEAR1_3071_TICK(t)
+# define BFI_FLINEAR1_3070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3069, v ds
+# define BFI_FLINEAR1_3070_TICK(t)
+# define BFI_FLINEAR1_3069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3068, v ds
+# define BFI_FLINEAR1_3069_TICK(t)
+# define BFI_FLINEAR1_3068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3067, v ds
+# define BFI_FLINEAR1_3068_TICK(t)
+# define BFI_FLINEAR1_3067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3066, v ds
+# define BFI_FLINEAR1_3067_TICK(t)
+# define BFI_FLINEAR1_3066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3065, v ds
+# define BFI_FLINEAR1_3066_TICK(t)
+# define BFI_FLINEAR1_3065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3064, v ds
+# define BFI_FLINEAR1_3065_TICK(t)
+# define BFI_FLINEAR1_3064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3063, v ds
+# define BFI_FLINEAR1_3064_TICK(t)
+# define BFI_FLINEAR1_3063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3062, v ds
+# define BFI_FLINEAR1_3063_TICK(t)
+# define BFI_FLINEAR1_3062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3061, v ds
+# define BFI_FLINEAR1_3062_TICK(t)
+# define BFI_FLINEAR1_3061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3060, v ds
+# define BFI_FLINEAR1_3061_TICK(t)
+# define BFI_FLINEAR1_3060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3059, v ds
+# define BFI_FLINEAR1_3060_TICK(t)
+# define BFI_FLINEAR1_3059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3058, v ds
+# define BFI_FLINEAR1_3059_TICK(t)
+# define BFI_FLINEAR1_3058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3057, v ds
+# define BFI_FLINEAR1_3058_TICK(t)
+# define BFI_FLINEAR1_3057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3056, v ds
+# define BFI_FLINEAR1_3057_TICK(t)
+# define BFI_FLINEAR1_3056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3055, v ds
+# define BFI_FLINEAR1_3056_TICK(t)
+# define BFI_FLINEAR1_3055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3054, v ds
+# define BFI_FLINEAR1_3055_TICK(t)
+# define BFI_FLINEAR1_3054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3053, v ds
+# define BFI_FLINEAR1_3054_TICK(t)
+# define BFI_FLINEAR1_3053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3052, v ds
+# define BFI_FLINEAR1_3053_TICK(t)
+# define BFI_FLINEAR1_3052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3051, v ds
+# define BFI_FLINEAR1_3052_TICK(t)
+# define BFI_FLINEAR1_3051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3050, v ds
+# define BFI_FLINEAR1_3051_TICK(t)
+# define BFI_FLINEAR1_3050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3049, v ds
+# define BFI_FLINEAR1_3050_TICK(t)
+# define BFI_FLINEAR1_3049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3048, v ds
+# define BFI_FLINEAR1_3049_TICK(t)
+# define BFI_FLINEAR1_3048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3047, v ds
+# define BFI_FLINEAR1_3048_TICK(t)
+# define BFI_FLINEAR1_3047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3046, v ds
+# define BFI_FLINEAR1_3047_TICK(t)
+# define BFI_FLINEAR1_3046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3045, v ds
+# define BFI_FLINEAR1_3046_TICK(t)
+# define BFI_FLINEAR1_3045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3044, v ds
+# define BFI_FLINEAR1_3045_TICK(t)
+# define BFI_FLINEAR1_3044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3043, v ds
+# define BFI_FLINEAR1_3044_TICK(t)
+# define BFI_FLINEAR1_3043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3042, v ds
+# define BFI_FLINEAR1_3043_TICK(t)
+# define BFI_FLINEAR1_3042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3041, v ds
+# define BFI_FLINEAR1_3042_TICK(t)
+# define BFI_FLINEAR1_3041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3040, v ds
+# define BFI_FLINEAR1_3041_TICK(t)
+# define BFI_FLINEAR1_3040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3039, v ds
+# define BFI_FLINEAR1_3040_TICK(t)
+# define BFI_FLINEAR1_3039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3038, v ds
+# define BFI_FLINEAR1_3039_TICK(t)
+# define BFI_FLINEAR1_3038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3037, v ds
+# define BFI_FLINEAR1_3038_TICK(t)
+# define BFI_FLINEAR1_3037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3036, v ds
+# define BFI_FLINEAR1_3037_TICK(t)
+# define BFI_FLINEAR1_3036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3035, v ds
+# define BFI_FLINEAR1_3036_TICK(t)
+# define BFI_FLINEAR1_3035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3034, v ds
+# define BFI_FLINEAR1_3035_TICK(t)
+# define BFI_FLINEAR1_3034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3033, v ds
+# define BFI_FLINEAR1_3034_TICK(t)
+# define BFI_FLINEAR1_3033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3032, v ds
+# define BFI_FLINEAR1_3033_TICK(t)
+# define BFI_FLINEAR1_3032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3031, v ds
+# define BFI_FLINEAR1_3032_TICK(t)
+# define BFI_FLINEAR1_3031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3030, v ds
+# define BFI_FLINEAR1_3031_TICK(t)
+# define BFI_FLINEAR1_3030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3029, v ds
+# define BFI_FLINEAR1_3030_TICK(t)
+# define BFI_FLINEAR1_3029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3028, v ds
+# define BFI_FLINEAR1_3029_TICK(t)
+# define BFI_FLINEAR1_3028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3027, v ds
+# define BFI_FLINEAR1_3028_TICK(t)
+# define BFI_FLINEAR1_3027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3026, v ds
+# define BFI_FLINEAR1_3027_TICK(t)
+# define BFI_FLINEAR1_3026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3025, v ds
+# define BFI_FLINEAR1_3026_TICK(t)
+# define BFI_FLINEAR1_3025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3024, v ds
+# define BFI_FLINEAR1_3025_TICK(t)
+# define BFI_FLINEAR1_3024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3023, v ds
+# define BFI_FLINEAR1_3024_TICK(t)
+# define BFI_FLINEAR1_3023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3022, v ds
+# define BFI_FLINEAR1_3023_TICK(t)
+# define BFI_FLINEAR1_3022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3021, v ds
+# define BFI_FLINEAR1_3022_TICK(t)
+# define BFI_FLINEAR1_3021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3020, v ds
+# define BFI_FLINEAR1_3021_TICK(t)
+# define BFI_FLINEAR1_3020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3019, v ds
+# define BFI_FLINEAR1_3020_TICK(t)
+# define BFI_FLINEAR1_3019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3018, v ds
+# define BFI_FLINEAR1_3019_TICK(t)
+# define BFI_FLINEAR1_3018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3017, v ds
+# define BFI_FLINEAR1_3018_TICK(t)
+# define BFI_FLINEAR1_3017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3016, v ds
+# define BFI_FLINEAR1_3017_TICK(t)
+# define BFI_FLINEAR1_3016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3015, v ds
+# define BFI_FLINEAR1_3016_TICK(t)
+# define BFI_FLINEAR1_3015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3014, v ds
+# define BFI_FLINEAR1_3015_TICK(t)
+# define BFI_FLINEAR1_3014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3013, v ds
+# define BFI_FLINEAR1_3014_TICK(t)
+# define BFI_FLINEAR1_3013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3012, v ds
+# define BFI_FLINEAR1_3013_TICK(t)
+# define BFI_FLINEAR1_3012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3011, v ds
+# define BFI_FLINEAR1_3012_TICK(t)
+# define BFI_FLINEAR1_3011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3010, v ds
+# define BFI_FLINEAR1_3011_TICK(t)
+# define BFI_FLINEAR1_3010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3009, v ds
+# define BFI_FLINEAR1_3010_TICK(t)
+# define BFI_FLINEAR1_3009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3008, v ds
+# define BFI_FLINEAR1_3009_TICK(t)
+# define BFI_FLINEAR1_3008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3007, v ds
+# define BFI_FLINEAR1_3008_TICK(t)
+# define BFI_FLINEAR1_3007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3006, v ds
+# define BFI_FLINEAR1_3007_TICK(t)
+# define BFI_FLINEAR1_3006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3005, v ds
+# define BFI_FLINEAR1_3006_TICK(t)
+# define BFI_FLINEAR1_3005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3004, v ds
+# define BFI_FLINEAR1_3005_TICK(t)
+# define BFI_FLINEAR1_3004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3003, v ds
+# define BFI_FLINEAR1_3004_TICK(t)
+# define BFI_FLINEAR1_3003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3002, v ds
+# define BFI_FLINEAR1_3003_TICK(t)
+# define BFI_FLINEAR1_3002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3001, v ds
+# define BFI_FLINEAR1_3002_TICK(t)
+# define BFI_FLINEAR1_3001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3000, v ds
+# define BFI_FLINEAR1_3001_TICK(t)
+# define BFI_FLINEAR1_3000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2999, v ds
+# define BFI_FLINEAR1_3000_TICK(t)
+# define BFI_FLINEAR1_2999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2998, v ds
+# define BFI_FLINEAR1_2999_TICK(t)
+# define BFI_FLINEAR1_2998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2997, v ds
+# define BFI_FLINEAR1_2998_TICK(t)
+# define BFI_FLINEAR1_2997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2996, v ds
+# define BFI_FLINEAR1_2997_TICK(t)
+# define BFI_FLINEAR1_2996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2995, v ds
+# define BFI_FLINEAR1_2996_TICK(t)
+# define BFI_FLINEAR1_2995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2994, v ds
+# define BFI_FLINEAR1_2995_TICK(t)
+# define BFI_FLINEAR1_2994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2993, v ds
+# define BFI_FLINEAR1_2994_TICK(t)
+# define BFI_FLINEAR1_2993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2992, v ds
+# define BFI_FLINEAR1_2993_TICK(t)
+# define BFI_FLINEAR1_2992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2991, v ds
+# define BFI_FLINEAR1_2992_TICK(t)
+# define BFI_FLINEAR1_2991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2990, v ds
+# define BFI_FLINEAR1_2991_TICK(t)
+# define BFI_FLINEAR1_2990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2989, v ds
+# define BFI_FLINEAR1_2990_TICK(t)
+# define BFI_FLINEAR1_2989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2988, v ds
+# define BFI_FLINEAR1_2989_TICK(t)
+# define BFI_FLINEAR1_2988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2987, v ds
+# define BFI_FLINEAR1_2988_TICK(t)
+# define BFI_FLINEAR1_2987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2986, v ds
+# define BFI_FLINEAR1_2987_TICK(t)
+# define BFI_FLINEAR1_2986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2985, v ds
+# define BFI_FLINEAR1_2986_TICK(t)
+# define BFI_FLINEAR1_2985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2984, v ds
+# define BFI_FLINEAR1_2985_TICK(t)
+# define BFI_FLINEAR1_2984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2983, v ds
+# define BFI_FLINEAR1_2984_TICK(t)
+# define BFI_FLINEAR1_2983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2982, v ds
+# define BFI_FLINEAR1_2983_TICK(t)
+# define BFI_FLINEAR1_2982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2981, v ds
+# define BFI_FLINEAR1_2982_TICK(t)
+# define BFI_FLINEAR1_2981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2980, v ds
+# define BFI_FLINEAR1_2981_TICK(t)
+# define BFI_FLINEAR1_2980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2979, v ds
+# define BFI_FLINEAR1_2980_TICK(t)
+# define BFI_FLINEAR1_2979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2978, v ds
+# define BFI_FLINEAR1_2979_TICK(t)
+# define BFI_FLINEAR1_2978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2977, v ds
+# define BFI_FLINEAR1_2978_TICK(t)
+# define BFI_FLINEAR1_2977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2976, v ds
+# define BFI_FLINEAR1_2977_TICK(t)
+# define BFI_FLINEAR1_2976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2975, v ds
+# define BFI_FLINEAR1_2976_TICK(t)
+# define BFI_FLINEAR1_2975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2974, v ds
+# define BFI_FLINEAR1_2975_TICK(t)
+# define BFI_FLINEAR1_2974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2973, v ds
+# define BFI_FLINEAR1_2974_TICK(t)
+# define BFI_FLINEAR1_2973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2972, v ds
+# define BFI_FLINEAR1_2973_TICK(t)
+# define BFI_FLINEAR1_2972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2971, v ds
+# define BFI_FLINEAR1_2972_TICK(t)
+# define BFI_FLINEAR1_2971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2970, v ds
+# define BFI_FLINEAR1_2971_TICK(t)
+# define BFI_FLINEAR1_2970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2969, v ds
+# define BFI_FLINEAR1_2970_TICK(t)
+# define BFI_FLINEAR1_2969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2968, v ds
+# define BFI_FLINEAR1_2969_TICK(t)
+# define BFI_FLINEAR1_2968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2967, v ds
+# define BFI_FLINEAR1_2968_TICK(t)
+# define BFI_FLINEAR1_2967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2966, v ds
+# define BFI_FLINEAR1_2967_TICK(t)
+# define BFI_FLINEAR1_2966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2965, v ds
+# define BFI_FLINEAR1_2966_TICK(t)
+# define BFI_FLINEAR1_2965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2964, v ds
+# define BFI_FLINEAR1_2965_TICK(t)
+# define BFI_FLINEAR1_2964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2963, v ds
+# define BFI_FLINEAR1_2964_TICK(t)
+# define BFI_FLINEAR1_2963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2962, v ds
+# define BFI_FLINEAR1_2963_TICK(t)
+# define BFI_FLINEAR1_2962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2961, v ds
+# define BFI_FLINEAR1_2962_TICK(t)
+# define BFI_FLINEAR1_2961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2960, v ds
+# define BFI_FLINEAR1_2961_TICK(t)
+# define BFI_FLINEAR1_2960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2959, v ds
+# define BFI_FLINEAR1_2960_TICK(t)
+# define BFI_FLINEAR1_2959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2958, v ds
+# define BFI_FLINEAR1_2959_TICK(t)
+# define BFI_FLINEAR1_2958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2957, v ds
+# define BFI_FLINEAR1_2958_TICK(t)
+# define BFI_FLINEAR1_2957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2956, v ds
+# define BFI_FLINEAR1_2957_TICK(t)
+# define BFI_FLINEAR1_2956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2955, v ds
+# define BFI_FLINEAR1_2956_TICK(t)
+# define BFI_FLINEAR1_2955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2954, v ds
+# define BFI_FLINEAR1_2955_TICK(t)
+# define BFI_FLINEAR1_2954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2953, v ds
+# define BFI_FLINEAR1_2954_TICK(t)
+# define BFI_FLINEAR1_2953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2952, v ds
+# define BFI_FLINEAR1_2953_TICK(t)
+# define BFI_FLINEAR1_2952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2951, v ds
+# define BFI_FLINEAR1_2952_TICK(t)
+# define BFI_FLINEAR1_2951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2950, v ds
+# define BFI_FLINEAR1_2951_TICK(t)
+# define BFI_FLINEAR1_2950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2949, v ds
+# define BFI_FLINEAR1_2950_TICK(t)
+# define BFI_FLINEAR1_2949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2948, v ds
+# define BFI_FLINEAR1_2949_TICK(t)
+# define BFI_FLINEAR1_2948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2947, v ds
+# define BFI_FLINEAR1_2948_TICK(t)
+# define BFI_FLINEAR1_2947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2946, v ds
+# define BFI_FLINEAR1_2947_TICK(t)
+# define BFI_FLINEAR1_2946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2945, v ds
+# define BFI_FLINEAR1_2946_TICK(t)
+# define BFI_FLINEAR1_2945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2944, v ds
+# define BFI_FLINEAR1_2945_TICK(t)
+# define BFI_FLINEAR1_2944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2943, v ds
+# define BFI_FLINEAR1_2944_TICK(t)
+# define BFI_FLINEAR1_2943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2942, v ds
+# define BFI_FLINEAR1_2943_TICK(t)
+# define BFI_FLINEAR1_2942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2941, v ds
+# define BFI_FLINEAR1_2942_TICK(t)
+# define BFI_FLINEAR1_2941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2940, v ds
+# define BFI_FLINEAR1_2941_TICK(t)
+# define BFI_FLINEAR1_2940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2939, v ds
+# define BFI_FLINEAR1_2940_TICK(t)
+# define BFI_FLINEAR1_2939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2938, v ds
+# define BFI_FLINEAR1_2939_TICK(t)
+# define BFI_FLINEAR1_2938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2937, v ds
+# define BFI_FLINEAR1_2938_TICK(t)
+# define BFI_FLINEAR1_2937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2936, v ds
+# define BFI_FLINEAR1_2937_TICK(t)
+# define BFI_FLINEAR1_2936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2935, v ds
+# define BFI_FLINEAR1_2936_TICK(t)
+# define BFI_FLINEAR1_2935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2934, v ds
+# define BFI_FLINEAR1_2935_TICK(t)
+# define BFI_FLINEAR1_2934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2933, v ds
+# define BFI_FLINEAR1_2934_TICK(t)
+# define BFI_FLINEAR1_2933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2932, v ds
+# define BFI_FLINEAR1_2933_TICK(t)
+# define BFI_FLINEAR1_2932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2931, v ds
+# define BFI_FLINEAR1_2932_TICK(t)
+# define BFI_FLINEAR1_2931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2930, v ds
+# define BFI_FLINEAR1_2931_TICK(t)
+# define BFI_FLINEAR1_2930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2929, v ds
+# define BFI_FLINEAR1_2930_TICK(t)
+# define BFI_FLINEAR1_2929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2928, v ds
+# define BFI_FLINEAR1_2929_TICK(t)
+# define BFI_FLINEAR1_2928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2927, v ds
+# define BFI_FLINEAR1_2928_TICK(t)
+# define BFI_FLINEAR1_2927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2926, v ds
+# define BFI_FLINEAR1_2927_TICK(t)
+# define BFI_FLINEAR1_2926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2925, v ds
+# define BFI_FLINEAR1_2926_TICK(t)
+# define BFI_FLINEAR1_2925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2924, v ds
+# define BFI_FLINEAR1_2925_TICK(t)
+# define BFI_FLINEAR1_2924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2923, v ds
+# define BFI_FLINEAR1_2924_TICK(t)
+# define BFI_FLINEAR1_2923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2922, v ds
+# define BFI_FLINEAR1_2923_TICK(t)
+# define BFI_FLINEAR1_2922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2921, v ds
+# define BFI_FLINEAR1_2922_TICK(t)
+# define BFI_FLINEAR1_2921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2920, v ds
+# define BFI_FLINEAR1_2921_TICK(t)
+# define BFI_FLINEAR1_2920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2919, v ds
+# define BFI_FLINEAR1_2920_TICK(t)
+# define BFI_FLINEAR1_2919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2918, v ds
+# define BFI_FLINEAR1_2919_TICK(t)
+# define BFI_FLINEAR1_2918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2917, v ds
+# define BFI_FLINEAR1_2918_TICK(t)
+# define BFI_FLINEAR1_2917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2916, v ds
+# define BFI_FLINEAR1_2917_TICK(t)
+# define BFI_FLINEAR1_2916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2915, v ds
+# define BFI_FLINEAR1_2916_TICK(t)
+# define BFI_FLINEAR1_2915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2914, v ds
+# define BFI_FLINEAR1_2915_TICK(t)
+# define BFI_FLINEAR1_2914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2913, v ds
+# define BFI_FLINEAR1_2914_TICK(t)
+# define BFI_FLINEAR1_2913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2912, v ds
+# define BFI_FLINEAR1_2913_TICK(t)
+# define BFI_FLINEAR1_2912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2911, v ds
+# define BFI_FLINEAR1_2912_TICK(t)
+# define BFI_FLINEAR1_2911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2910, v ds
+# define BFI_FLINEAR1_2911_TICK(t)
+# define BFI_FLINEAR1_2910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2909, v ds
+# define BFI_FLINEAR1_2910_TICK(t)
+# define BFI_FLINEAR1_2909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2908, v ds
+# define BFI_FLINEAR1_2909_TICK(t)
+# define BFI_FLINEAR1_2908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2907, v ds
+# define BFI_FLINEAR1_2908_TICK(t)
+# define BFI_FLINEAR1_2907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2906, v ds
+# define BFI_FLINEAR1_2907_TICK(t)
+# define BFI_FLINEAR1_2906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2905, v ds
+# define BFI_FLINEAR1_2906_TICK(t)
+# define BFI_FLINEAR1_2905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2904, v ds
+# define BFI_FLINEAR1_2905_TICK(t)
+# define BFI_FLINEAR1_2904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2903, v ds
+# define BFI_FLINEAR1_2904_TICK(t)
+# define BFI_FLINEAR1_2903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2902, v ds
+# define BFI_FLINEAR1_2903_TICK(t)
+# define BFI_FLINEAR1_2902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2901, v ds
+# define BFI_FLINEAR1_2902_TICK(t)
+# define BFI_FLINEAR1_2901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2900, v ds
+# define BFI_FLINEAR1_2901_TICK(t)
+# define BFI_FLINEAR1_2900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2899, v ds
+# define BFI_FLINEAR1_2900_TICK(t)
+# define BFI_FLINEAR1_2899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2898, v ds
+# define BFI_FLINEAR1_2899_TICK(t)
+# define BFI_FLINEAR1_2898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2897, v ds
+# define BFI_FLINEAR1_2898_TICK(t)
+# define BFI_FLINEAR1_2897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2896, v ds
+# define BFI_FLINEAR1_2897_TICK(t)
+# define BFI_FLINEAR1_2896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2895, v ds
+# define BFI_FLINEAR1_2896_TICK(t)
+# define BFI_FLINEAR1_2895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2894, v ds
+# define BFI_FLINEAR1_2895_TICK(t)
+# define BFI_FLINEAR1_2894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2893, v ds
+# define BFI_FLINEAR1_2894_TICK(t)
+# define BFI_FLINEAR1_2893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2892, v ds
+# define BFI_FLINEAR1_2893_TICK(t)
+# define BFI_FLINEAR1_2892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2891, v ds
+# define BFI_FLINEAR1_2892_TICK(t)
+# define BFI_FLINEAR1_2891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2890, v ds
+# define BFI_FLINEAR1_2891_TICK(t)
+# define BFI_FLINEAR1_2890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2889, v ds
+# define BFI_FLINEAR1_2890_TICK(t)
+# define BFI_FLINEAR1_2889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2888, v ds
+# define BFI_FLINEAR1_2889_TICK(t)
+# define BFI_FLINEAR1_2888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2887, v ds
+# define BFI_FLINEAR1_2888_TICK(t)
+# define BFI_FLINEAR1_2887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2886, v ds
+# define BFI_FLINEAR1_2887_TICK(t)
+# define BFI_FLINEAR1_2886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2885, v ds
+# define BFI_FLINEAR1_2886_TICK(t)
+# define BFI_FLINEAR1_2885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2884, v ds
+# define BFI_FLINEAR1_2885_TICK(t)
+# define BFI_FLINEAR1_2884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2883, v ds
+# define BFI_FLINEAR1_2884_TICK(t)
+# define BFI_FLINEAR1_2883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2882, v ds
+# define BFI_FLINEAR1_2883_TICK(t)
+# define BFI_FLINEAR1_2882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2881, v ds
+# define BFI_FLINEAR1_2882_TICK(t)
+# define BFI_FLINEAR1_2881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2880, v ds
+# define BFI_FLINEAR1_2881_TICK(t)
+# define BFI_FLINEAR1_2880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2879, v ds
+# define BFI_FLINEAR1_2880_TICK(t)
+# define BFI_FLINEAR1_2879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2878, v ds
+# define BFI_FLINEAR1_2879_TICK(t)
+# define BFI_FLINEAR1_2878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2877, v ds
+# define BFI_FLINEAR1_2878_TICK(t)
+# define BFI_FLINEAR1_2877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2876, v ds
+# define BFI_FLINEAR1_2877_TICK(t)
+# define BFI_FLINEAR1_2876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2875, v ds
+# define BFI_FLINEAR1_2876_TICK(t)
+# define BFI_FLINEAR1_2875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2874, v ds
+# define BFI_FLINEAR1_2875_TICK(t)
+# define BFI_FLINEAR1_2874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2873, v ds
+# define BFI_FLINEAR1_2874_TICK(t)
+# define BFI_FLINEAR1_2873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2872, v ds
+# define BFI_FLINEAR1_2873_TICK(t)
+# define BFI_FLINEAR1_2872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2871, v ds
+# define BFI_FLINEAR1_2872_TICK(t)
+# define BFI_FLINEAR1_2871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2870, v ds
+# define BFI_FLINEAR1_2871_TICK(t)
+# define BFI_FLINEAR1_2870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2869, v ds
+# define BFI_FLINEAR1_2870_TICK(t)
+# define BFI_FLINEAR1_2869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2868, v ds
+# define BFI_FLINEAR1_2869_TICK(t)
+# define BFI_FLINEAR1_2868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2867, v ds
+# define BFI_FLINEAR1_2868_TICK(t)
+# define BFI_FLINEAR1_2867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2866, v ds
+# define BFI_FLINEAR1_2867_TICK(t)
+# define BFI_FLINEAR1_2866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2865, v ds
+# define BFI_FLINEAR1_2866_TICK(t)
+# define BFI_FLINEAR1_2865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2864, v ds
+# define BFI_FLINEAR1_2865_TICK(t)
+# define BFI_FLINEAR1_2864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2863, v ds
+# define BFI_FLINEAR1_2864_TICK(t)
+# define BFI_FLINEAR1_2863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2862, v ds
+# define BFI_FLINEAR1_2863_TICK(t)
+# define BFI_FLINEAR1_2862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2861, v ds
+# define BFI_FLINEAR1_2862_TICK(t)
+# define BFI_FLINEAR1_2861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2860, v ds
+# define BFI_FLINEAR1_2861_TICK(t)
+# define BFI_FLINEAR1_2860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2859, v ds
+# define BFI_FLINEAR1_2860_TICK(t)
+# define BFI_FLINEAR1_2859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2858, v ds
+# define BFI_FLINEAR1_2859_TICK(t)
+# define BFI_FLINEAR1_2858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2857, v ds
+# define BFI_FLINEAR1_2858_TICK(t)
+# define BFI_FLINEAR1_2857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2856, v ds
+# define BFI_FLINEAR1_2857_TICK(t)
+# define BFI_FLINEAR1_2856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2855, v ds
+# define BFI_FLINEAR1_2856_TICK(t)
+# define BFI_FLINEAR1_2855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2854, v ds
+# define BFI_FLINEAR1_2855_TICK(t)
+# define BFI_FLINEAR1_2854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2853, v ds
+# define BFI_FLINEAR1_2854_TICK(t)
+# define BFI_FLINEAR1_2853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2852, v ds
+# define BFI_FLINEAR1_2853_TICK(t)
+# define BFI_FLINEAR1_2852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2851, v ds
+# define BFI_FLINEAR1_2852_TICK(t)
+# define BFI_FLINEAR1_2851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2850, v ds
+# define BFI_FLINEAR1_2851_TICK(t)
+# define BFI_FLINEAR1_2850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2849, v ds
+# define BFI_FLINEAR1_2850_TICK(t)
+# define BFI_FLINEAR1_2849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2848, v ds
+# define BFI_FLINEAR1_2849_TICK(t)
+# define BFI_FLINEAR1_2848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2847, v ds
+# define BFI_FLINEAR1_2848_TICK(t)
+# define BFI_FLINEAR1_2847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2846, v ds
+# define BFI_FLINEAR1_2847_TICK(t)
+# define BFI_FLINEAR1_2846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2845, v ds
+# define BFI_FLINEAR1_2846_TICK(t)
+# define BFI_FLINEAR1_2845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2844, v ds
+# define BFI_FLINEAR1_2845_TICK(t)
+# define BFI_FLINEAR1_2844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2843, v ds
+# define BFI_FLINEAR1_2844_TICK(t)
+# define BFI_FLINEAR1_2843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2842, v ds
+# define BFI_FLINEAR1_2843_TICK(t)
+# define BFI_FLINEAR1_2842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2841, v ds
+# define BFI_FLINEAR1_2842_TICK(t)
+# define BFI_FLINEAR1_2841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2840, v ds
+# define BFI_FLINEAR1_2841_TICK(t)
+# define BFI_FLINEAR1_2840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2839, v ds
+# define BFI_FLINEAR1_2840_TICK(t)
+# define BFI_FLINEAR1_2839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2838, v ds
+# define BFI_FLINEAR1_2839_TICK(t)
+# define BFI_FLINEAR1_2838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2837, v ds
+# define BFI_FLINEAR1_2838_TICK(t)
+# define BFI_FLINEAR1_2837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2836, v ds
+# define BFI_FLINEAR1_2837_TICK(t)
+# define BFI_FLINEAR1_2836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2835, v ds
+# define BFI_FLINEAR1_2836_TICK(t)
+# define BFI_FLINEAR1_2835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2834, v ds
+# define BFI_FLINEAR1_2835_TICK(t)
+# define BFI_FLINEAR1_2834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2833, v ds
+# define BFI_FLINEAR1_2834_TICK(t)
+# define BFI_FLINEAR1_2833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2832, v ds
+# define BFI_FLINEAR1_2833_TICK(t)
+# define BFI_FLINEAR1_2832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2831, v ds
+# define BFI_FLINEAR1_2832_TICK(t)
+# define BFI_FLINEAR1_2831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2830, v ds
+# define BFI_FLINEAR1_2831_TICK(t)
+# define BFI_FLINEAR1_2830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2829, v ds
+# define BFI_FLINEAR1_2830_TICK(t)
+# define BFI_FLINEAR1_2829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2828, v ds
+# define BFI_FLINEAR1_2829_TICK(t)
+# define BFI_FLINEAR1_2828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2827, v ds
+# define BFI_FLINEAR1_2828_TICK(t)
+# define BFI_FLINEAR1_2827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2826, v ds
+# define BFI_FLINEAR1_2827_TICK(t)
+# define BFI_FLINEAR1_2826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2825, v ds
+# define BFI_FLINEAR1_2826_TICK(t)
+# define BFI_FLINEAR1_2825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2824, v ds
+# define BFI_FLINEAR1_2825_TICK(t)
+# define BFI_FLINEAR1_2824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2823, v ds
+# define BFI_FLINEAR1_2824_TICK(t)
+# define BFI_FLINEAR1_2823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2822, v ds
+# define BFI_FLINEAR1_2823_TICK(t)
+# define BFI_FLINEAR1_2822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2821, v ds
+# define BFI_FLINEAR1_2822_TICK(t)
+# define BFI_FLINEAR1_2821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2820, v ds
+# define BFI_FLINEAR1_2821_TICK(t)
+# define BFI_FLINEAR1_2820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2819, v ds
+# define BFI_FLINEAR1_2820_TICK(t)
+# define BFI_FLINEAR1_2819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2818, v ds
+# define BFI_FLINEAR1_2819_TICK(t)
+# define BFI_FLINEAR1_2818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2817, v ds
+# define BFI_FLINEAR1_2818_TICK(t)
+# define BFI_FLINEAR1_2817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2816, v ds
+# define BFI_FLINEAR1_2817_TICK(t)
+# define BFI_FLINEAR1_2816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2815, v ds
+# define BFI_FLINEAR1_2816_TICK(t)
+# define BFI_FLINEAR1_2815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2814, v ds
+# define BFI_FLINEAR1_2815_TICK(t)
+# define BFI_FLINEAR1_2814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2813, v ds
+# define BFI_FLINEAR1_2814_TICK(t)
+# define BFI_FLINEAR1_2813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2812, v ds
+# define BFI_FLINEAR1_2813_TICK(t)
+# define BFI_FLINEAR1_2812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2811, v ds
+# define BFI_FLINEAR1_2812_TICK(t)
+# define BFI_FLINEAR1_2811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2810, v ds
+# define BFI_FLINEAR1_2811_TICK(t)
+# define BFI_FLINEAR1_2810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2809, v ds
+# define BFI_FLINEAR1_2810_TICK(t)
+# define BFI_FLINEAR1_2809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2808, v ds
+# define BFI_FLINEAR1_2809_TICK(t)
+# define BFI_FLINEAR1_2808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2807, v ds
+# define BFI_FLINEAR1_2808_TICK(t)
+# define BFI_FLINEAR1_2807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2806, v ds
+# define BFI_FLINEAR1_2807_TICK(t)
+# define BFI_FLINEAR1_2806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2805, v ds
+# define BFI_FLINEAR1_2806_TICK(t)
+# define BFI_FLINEAR1_2805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2804, v ds
+# define BFI_FLINEAR1_2805_TICK(t)
+# define BFI_FLINEAR1_2804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2803, v ds
+# define BFI_FLINEAR1_2804_TICK(t)
+# define BFI_FLINEAR1_2803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2802, v ds
+# define BFI_FLINEAR1_2803_TICK(t)
+# define BFI_FLINEAR1_2802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2801, v ds
+# define BFI_FLINEAR1_2802_TICK(t)
+# define BFI_FLINEAR1_2801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2800, v ds
+# define BFI_FLINEAR1_2801_TICK(t)
+# define BFI_FLINEAR1_2800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2799, v ds
+# define BFI_FLINEAR1_2800_TICK(t)
+# define BFI_FLINEAR1_2799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2798, v ds
+# define BFI_FLINEAR1_2799_TICK(t)
+# define BFI_FLINEAR1_2798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2797, v ds
+# define BFI_FLINEAR1_2798_TICK(t)
+# define BFI_FLINEAR1_2797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2796, v ds
+# define BFI_FLINEAR1_2797_TICK(t)
+# define BFI_FLINEAR1_2796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2795, v ds
+# define BFI_FLINEAR1_2796_TICK(t)
+# define BFI_FLINEAR1_2795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2794, v ds
+# define BFI_FLINEAR1_2795_TICK(t)
+# define BFI_FLINEAR1_2794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2793, v ds
+# define BFI_FLINEAR1_2794_TICK(t)
+# define BFI_FLINEAR1_2793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2792, v ds
+# define BFI_FLINEAR1_2793_TICK(t)
+# define BFI_FLINEAR1_2792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2791, v ds
+# define BFI_FLINEAR1_2792_TICK(t)
+# define BFI_FLINEAR1_2791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2790, v ds
+# define BFI_FLINEAR1_2791_TICK(t)
+# define BFI_FLINEAR1_2790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2789, v ds
+# define BFI_FLINEAR1_2790_TICK(t)
+# define BFI_FLINEAR1_2789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2788, v ds
+# define BFI_FLINEAR1_2789_TICK(t)
+# define BFI_FLINEAR1_2788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2787, v ds
+# define BFI_FLINEAR1_2788_TICK(t)
+# define BFI_FLINEAR1_2787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2786, v ds
+# define BFI_FLINEAR1_2787_TICK(t)
+# define BFI_FLINEAR1_2786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2785, v ds
+# define BFI_FLINEAR1_2786_TICK(t)
+# define BFI_FLINEAR1_2785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2784, v ds
+# define BFI_FLINEAR1_2785_TICK(t)
+# define BFI_FLINEAR1_2784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2783, v ds
+# define BFI_FLINEAR1_2784_TICK(t)
+# define BFI_FLINEAR1_2783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2782, v ds
+# define BFI_FLINEAR1_2783_TICK(t)
+# define BFI_FLINEAR1_2782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2781, v ds
+# define BFI_FLINEAR1_2782_TICK(t)
+# define BFI_FLINEAR1_2781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2780, v ds
+# define BFI_FLINEAR1_2781_TICK(t)
+# define BFI_FLINEAR1_2780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2779, v ds
+# define BFI_FLINEAR1_2780_TICK(t)
+# define BFI_FLINEAR1_2779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2778, v ds
+# define BFI_FLINEAR1_2779_TICK(t)
+# define BFI_FLINEAR1_2778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2777, v ds
+# define BFI_FLINEAR1_2778_TICK(t)
+# define BFI_FLINEAR1_2777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2776, v ds
+# define BFI_FLINEAR1_2777_TICK(t)
+# define BFI_FLINEAR1_2776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2775, v ds
+# define BFI_FLINEAR1_2776_TICK(t)
+# define BFI_FLINEAR1_2775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2774, v ds
+# define BFI_FLINEAR1_2775_TICK(t)
+# define BFI_FLINEAR1_2774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2773, v ds
+# define BFI_FLINEAR1_2774_TICK(t)
+# define BFI_FLINEAR1_2773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2772, v ds
+# define BFI_FLINEAR1_2773_TICK(t)
+# define BFI_FLINEAR1_2772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2771, v ds
+# define BFI_FLINEAR1_2772_TICK(t)
+# define BFI_FLINEAR1_2771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2770, v ds
+# define BFI_FLINEAR1_2771_TICK(t)
+# define BFI_FLINEAR1_2770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2769, v ds
+# define BFI_FLINEAR1_2770_TICK(t)
+# define BFI_FLINEAR1_2769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2768, v ds
+# define BFI_FLINEAR1_2769_TICK(t)
+# define BFI_FLINEAR1_2768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2767, v ds
+# define BFI_FLINEAR1_2768_TICK(t)
+# define BFI_FLINEAR1_2767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2766, v ds
+# define BFI_FLINEAR1_2767_TICK(t)
+# define BFI_FLINEAR1_2766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2765, v ds
+# define BFI_FLINEAR1_2766_TICK(t)
+# define BFI_FLINEAR1_2765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2764, v ds
+# define BFI_FLINEAR1_2765_TICK(t)
+# define BFI_FLINEAR1_2764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2763, v ds
+# define BFI_FLINEAR1_2764_TICK(t)
+# define BFI_FLINEAR1_2763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2762, v ds
+# define BFI_FLINEAR1_2763_TICK(t)
+# define BFI_FLINEAR1_2762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2761, v ds
+# define BFI_FLINEAR1_2762_TICK(t)
+# define BFI_FLINEAR1_2761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2760, v ds
+# define BFI_FLINEAR1_2761_TICK(t)
+# define BFI_FLINEAR1_2760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2759, v ds
+# define BFI_FLINEAR1_2760_TICK(t)
+# define BFI_FLINEAR1_2759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2758, v ds
+# define BFI_FLINEAR1_2759_TICK(t)
+# define BFI_FLINEAR1_2758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2757, v ds
+# define BFI_FLINEAR1_2758_TICK(t)
+# define BFI_FLINEAR1_2757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2756, v ds
+# define BFI_FLINEAR1_2757_TICK(t)
+# define BFI_FLINEAR1_2756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2755, v ds
+# define BFI_FLINEAR1_2756_TICK(t)
+# define BFI_FLINEAR1_2755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2754, v ds
+# define BFI_FLINEAR1_2755_TICK(t)
+# define BFI_FLINEAR1_2754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2753, v ds
+# define BFI_FLINEAR1_2754_TICK(t)
+# define BFI_FLINEAR1_2753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2752, v ds
+# define BFI_FLINEAR1_2753_TICK(t)
+# define BFI_FLINEAR1_2752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2751, v ds
+# define BFI_FLINEAR1_2752_TICK(t)
+# define BFI_FLINEAR1_2751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2750, v ds
+# define BFI_FLINEAR1_2751_TICK(t)
+# define BFI_FLINEAR1_2750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2749, v ds
+# define BFI_FLINEAR1_2750_TICK(t)
+# define BFI_FLINEAR1_2749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2748, v ds
+# define BFI_FLINEAR1_2749_TICK(t)
+# define BFI_FLINEAR1_2748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2747, v ds
+# define BFI_FLINEAR1_2748_TICK(t)
+# define BFI_FLINEAR1_2747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2746, v ds
+# define BFI_FLINEAR1_2747_TICK(t)
+# define BFI_FLINEAR1_2746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2745, v ds
+# define BFI_FLINEAR1_2746_TICK(t)
+# define BFI_FLINEAR1_2745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2744, v ds
+# define BFI_FLINEAR1_2745_TICK(t)
+# define BFI_FLINEAR1_2744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2743, v ds
+# define BFI_FLINEAR1_2744_TICK(t)
+# define BFI_FLINEAR1_2743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2742, v ds
+# define BFI_FLINEAR1_2743_TICK(t)
+# define BFI_FLINEAR1_2742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2741, v ds
+# define BFI_FLINEAR1_2742_TICK(t)
+# define BFI_FLINEAR1_2741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2740, v ds
+# define BFI_FLINEAR1_2741_TICK(t)
+# define BFI_FLINEAR1_2740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2739, v ds
+# define BFI_FLINEAR1_2740_TICK(t)
+# define BFI_FLINEAR1_2739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2738, v ds
+# define BFI_FLINEAR1_2739_TICK(t)
+# define BFI_FLINEAR1_2738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2737, v ds
+# define BFI_FLINEAR1_2738_TICK(t)
+# define BFI_FLINEAR1_2737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2736, v ds
+# define BFI_FLINEAR1_2737_TICK(t)
+# define BFI_FLINEAR1_2736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2735, v ds
+# define BFI_FLINEAR1_2736_TICK(t)
+# define BFI_FLINEAR1_2735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2734, v ds
+# define BFI_FLINEAR1_2735_TICK(t)
+# define BFI_FLINEAR1_2734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2733, v ds
+# define BFI_FLINEAR1_2734_TICK(t)
+# define BFI_FLINEAR1_2733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2732, v ds
+# define BFI_FLINEAR1_2733_TICK(t)
+# define BFI_FLINEAR1_2732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2731, v ds
+# define BFI_FLINEAR1_2732_TICK(t)
+# define BFI_FLINEAR1_2731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2730, v ds
+# define BFI_FLINEAR1_2731_TICK(t)
+# define BFI_FLINEAR1_2730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2729, v ds
+# define BFI_FLINEAR1_2730_TICK(t)
+# define BFI_FLINEAR1_2729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2728, v ds
+# define BFI_FLINEAR1_2729_TICK(t)
+# define BFI_FLINEAR1_2728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2727, v ds
+# define BFI_FLINEAR1_2728_TICK(t)
+# define BFI_FLINEAR1_2727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2726, v ds
+# define BFI_FLINEAR1_2727_TICK(t)
+# define BFI_FLINEAR1_2726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2725, v ds
+# define BFI_FLINEAR1_2726_TICK(t)
+# define BFI_FLINEAR1_2725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2724, v ds
+# define BFI_FLINEAR1_2725_TICK(t)
+# define BFI_FLINEAR1_2724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2723, v ds
+# define BFI_FLINEAR1_2724_TICK(t)
+# define BFI_FLINEAR1_2723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2722, v ds
+# define BFI_FLINEAR1_2723_TICK(t)
+# define BFI_FLINEAR1_2722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2721, v ds
+# define BFI_FLINEAR1_2722_TICK(t)
+# define BFI_FLINEAR1_2721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2720, v ds
+# define BFI_FLINEAR1_2721_TICK(t)
+# define BFI_FLINEAR1_2720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2719, v ds
+# define BFI_FLINEAR1_2720_TICK(t)
+# define BFI_FLINEAR1_2719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2718, v ds
+# define BFI_FLINEAR1_2719_TICK(t)
+# define BFI_FLINEAR1_2718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2717, v ds
+# define BFI_FLINEAR1_2718_TICK(t)
+# define BFI_FLINEAR1_2717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2716, v ds
+# define BFI_FLINEAR1_2717_TICK(t)
+# define BFI_FLINEAR1_2716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2715, v ds
+# define BFI_FLINEAR1_2716_TICK(t)
+# define BFI_FLINEAR1_2715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2714, v ds
+# define BFI_FLINEAR1_2715_TICK(t)
+# define BFI_FLINEAR1_2714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2713, v ds
+# define BFI_FLINEAR1_2714_TICK(t)
+# define BFI_FLINEAR1_2713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2712, v ds
+# define BFI_FLINEAR1_2713_TICK(t)
+# define BFI_FLINEAR1_2712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2711, v ds
+# define BFI_FLINEAR1_2712_TICK(t)
+# define BFI_FLINEAR1_2711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2710, v ds
+# define BFI_FLINEAR1_2711_TICK(t)
+# define BFI_FLINEAR1_2710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2709, v ds
+# define BFI_FLINEAR1_2710_TICK(t)
+# define BFI_FLINEAR1_2709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2708, v ds
+# define BFI_FLINEAR1_2709_TICK(t)
+# define BFI_FLINEAR1_2708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2707, v ds
+# define BFI_FLINEAR1_2708_TICK(t)
+# define BFI_FLINEAR1_2707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2706, v ds
+# define BFI_FLINEAR1_2707_TICK(t)
+# define BFI_FLINEAR1_2706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2705, v ds
+# define BFI_FLINEAR1_2706_TICK(t)
+# define BFI_FLINEAR1_2705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2704, v ds
+# define BFI_FLINEAR1_2705_TICK(t)
+# define BFI_FLINEAR1_2704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2703, v ds
+# define BFI_FLINEAR1_2704_TICK(t)
+# define BFI_FLINEAR1_2703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2702, v ds
+# define BFI_FLINEAR1_2703_TICK(t)
+# define BFI_FLINEAR1_2702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2701, v ds
+# define BFI_FLINEAR1_2702_TICK(t)
+# define BFI_FLINEAR1_2701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2700, v ds
+# define BFI_FLINEAR1_2701_TICK(t)
+# define BFI_FLINEAR1_2700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2699, v ds
+# define BFI_FLINEAR1_2700_TICK(t)
+# define BFI_FLINEAR1_2699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2698, v ds
+# define BFI_FLINEAR1_2699_TICK(t)
+# define BFI_FLINEAR1_2698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2697, v ds
+# define BFI_FLINEAR1_2698_TICK(t)
+# define BFI_FLINEAR1_2697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2696, v ds
+# define BFI_FLINEAR1_2697_TICK(t)
+# define BFI_FLINEAR1_2696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2695, v ds
+# define BFI_FLINEAR1_2696_TICK(t)
+# define BFI_FLINEAR1_2695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2694, v ds
+# define BFI_FLINEAR1_2695_TICK(t)
+# define BFI_FLINEAR1_2694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2693, v ds
+# define BFI_FLINEAR1_2694_TICK(t)
+# define BFI_FLINEAR1_2693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2692, v ds
+# define BFI_FLINEAR1_2693_TICK(t)
+# define BFI_FLINEAR1_2692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2691, v ds
+# define BFI_FLINEAR1_2692_TICK(t)
+# define BFI_FLINEAR1_2691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2690, v ds
+# define BFI_FLINEAR1_2691_TICK(t)
+# define BFI_FLINEAR1_2690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2689, v ds
+# define BFI_FLINEAR1_2690_TICK(t)
+# define BFI_FLINEAR1_2689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2688, v ds
+# define BFI_FLINEAR1_2689_TICK(t)
+# define BFI_FLINEAR1_2688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2687, v ds
+# define BFI_FLINEAR1_2688_TICK(t)
+# define BFI_FLINEAR1_2687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2686, v ds
+# define BFI_FLINEAR1_2687_TICK(t)
+# define BFI_FLINEAR1_2686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2685, v ds
+# define BFI_FLINEAR1_2686_TICK(t)
+# define BFI_FLINEAR1_2685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2684, v ds
+# define BFI_FLINEAR1_2685_TICK(t)
+# define BFI_FLINEAR1_2684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2683, v ds
+# define BFI_FLINEAR1_2684_TICK(t)
+# define BFI_FLINEAR1_2683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2682, v ds
+# define BFI_FLINEAR1_2683_TICK(t)
+# define BFI_FLINEAR1_2682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2681, v ds
+# define BFI_FLINEAR1_2682_TICK(t)
+# define BFI_FLINEAR1_2681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2680, v ds
+# define BFI_FLINEAR1_2681_TICK(t)
+# define BFI_FLINEAR1_2680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2679, v ds
+# define BFI_FLINEAR1_2680_TICK(t)
+# define BFI_FLINEAR1_2679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2678, v ds
+# define BFI_FLINEAR1_2679_TICK(t)
+# define BFI_FLINEAR1_2678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2677, v ds
+# define BFI_FLINEAR1_2678_TICK(t)
+# define BFI_FLINEAR1_2677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2676, v ds
+# define BFI_FLINEAR1_2677_TICK(t)
+# define BFI_FLINEAR1_2676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2675, v ds
+# define BFI_FLINEAR1_2676_TICK(t)
+# define BFI_FLINEAR1_2675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2674, v ds
+# define BFI_FLINEAR1_2675_TICK(t)
+# define BFI_FLINEAR1_2674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2673, v ds
+# define BFI_FLINEAR1_2674_TICK(t)
+# define BFI_FLINEAR1_2673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2672, v ds
+# define BFI_FLINEAR1_2673_TICK(t)
+# define BFI_FLINEAR1_2672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2671, v ds
+# define BFI_FLINEAR1_2672_TICK(t)
+# define BFI_FLINEAR1_2671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2670, v ds
+# define BFI_FLINEAR1_2671_TICK(t)
+# define BFI_FLINEAR1_2670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2669, v ds
+# define BFI_FLINEAR1_2670_TICK(t)
+# define BFI_FLINEAR1_2669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2668, v ds
+# define BFI_FLINEAR1_2669_TICK(t)
+# define BFI_FLINEAR1_2668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2667, v ds
+# define BFI_FLINEAR1_2668_TICK(t)
+# define BFI_FLINEAR1_2667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2666, v ds
+# define BFI_FLINEAR1_2667_TICK(t)
+# define BFI_FLINEAR1_2666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2665, v ds
+# define BFI_FLINEAR1_2666_TICK(t)
+# define BFI_FLINEAR1_2665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2664, v ds
+# define BFI_FLINEAR1_2665_TICK(t)
+# define BFI_FLINEAR1_2664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2663, v ds
+# define BFI_FLINEAR1_2664_TICK(t)
+# define BFI_FLINEAR1_2663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2662, v ds
+# define BFI_FLINEAR1_2663_TICK(t)
+# define BFI_FLINEAR1_2662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2661, v ds
+# define BFI_FLINEAR1_2662_TICK(t)
+# define BFI_FLINEAR1_2661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2660, v ds
+# define BFI_FLINEAR1_2661_TICK(t)
+# define BFI_FLINEAR1_2660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2659, v ds
+# define BFI_FLINEAR1_2660_TICK(t)
+# define BFI_FLINEAR1_2659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2658, v ds
+# define BFI_FLINEAR1_2659_TICK(t)
+# define BFI_FLINEAR1_2658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2657, v ds
+# define BFI_FLINEAR1_2658_TICK(t)
+# define BFI_FLINEAR1_2657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2656, v ds
+# define BFI_FLINEAR1_2657_TICK(t)
+# define BFI_FLINEAR1_2656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2655, v ds
+# define BFI_FLINEAR1_2656_TICK(t)
+# define BFI_FLINEAR1_2655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2654, v ds
+# define BFI_FLINEAR1_2655_TICK(t)
+# define BFI_FLINEAR1_2654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2653, v ds
+# define BFI_FLINEAR1_2654_TICK(t)
+# define BFI_FLINEAR1_2653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2652, v ds
+# define BFI_FLINEAR1_2653_TICK(t)
+# define BFI_FLINEAR1_2652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2651, v ds
+# define BFI_FLINEAR1_2652_TICK(t)
+# define BFI_FLINEAR1_2651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2650, v ds
+# define BFI_FLINEAR1_2651_TICK(t)
+# define BFI_FLINEAR1_2650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2649, v ds
+# define BFI_FLINEAR1_2650_TICK(t)
+# define BFI_FLINEAR1_2649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2648, v ds
+# define BFI_FLINEAR1_2649_TICK(t)
+# define BFI_FLINEAR1_2648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2647, v ds
+# define BFI_FLINEAR1_2648_TICK(t)
+# define BFI_FLINEAR1_2647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2646, v ds
+# define BFI_FLINEAR1_2647_TICK(t)
+# define BFI_FLINEAR1_2646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2645, v ds
+# define BFI_FLINEAR1_2646_TICK(t)
+# define BFI_FLINEAR1_2645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2644, v ds
+# define BFI_FLINEAR1_2645_TICK(t)
+# define BFI_FLINEAR1_2644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2643, v ds
+# define BFI_FLINEAR1_2644_TICK(t)
+# define BFI_FLINEAR1_2643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2642, v ds
+# define BFI_FLINEAR1_2643_TICK(t)
+# define BFI_FLINEAR1_2642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2641, v ds
+# define BFI_FLINEAR1_2642_TICK(t)
+# define BFI_FLINEAR1_2641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2640, v ds
+# define BFI_FLINEAR1_2641_TICK(t)
+# define BFI_FLINEAR1_2640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2639, v ds
+# define BFI_FLINEAR1_2640_TICK(t)
+# define BFI_FLINEAR1_2639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2638, v ds
+# define BFI_FLINEAR1_2639_TICK(t)
+# define BFI_FLINEAR1_2638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2637, v ds
+# define BFI_FLINEAR1_2638_TICK(t)
+# define BFI_FLINEAR1_2637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2636, v ds
+# define BFI_FLINEAR1_2637_TICK(t)
+# define BFI_FLINEAR1_2636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2635, v ds
+# define BFI_FLINEAR1_2636_TICK(t)
+# define BFI_FLINEAR1_2635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2634, v ds
+# define BFI_FLINEAR1_2635_TICK(t)
+# define BFI_FLINEAR1_2634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2633, v ds
+# define BFI_FLINEAR1_2634_TICK(t)
+# define BFI_FLINEAR1_2633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2632, v ds
+# define BFI_FLINEAR1_2633_TICK(t)
+# define BFI_FLINEAR1_2632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2631, v ds
+# define BFI_FLINEAR1_2632_TICK(t)
+# define BFI_FLINEAR1_2631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2630, v ds
+# define BFI_FLINEAR1_2631_TICK(t)
+# define BFI_FLINEAR1_2630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2629, v ds
+# define BFI_FLINEAR1_2630_TICK(t)
+# define BFI_FLINEAR1_2629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2628, v ds
+# define BFI_FLINEAR1_2629_TICK(t)
+# define BFI_FLINEAR1_2628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2627, v ds
+# define BFI_FLINEAR1_2628_TICK(t)
+# define BFI_FLINEAR1_2627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2626, v ds
+# define BFI_FLINEAR1_2627_TICK(t)
+# define BFI_FLINEAR1_2626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2625, v ds
+# define BFI_FLINEAR1_2626_TICK(t)
+# define BFI_FLINEAR1_2625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2624, v ds
+# define BFI_FLINEAR1_2625_TICK(t)
+# define BFI_FLINEAR1_2624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2623, v ds
+# define BFI_FLINEAR1_2624_TICK(t)
+# define BFI_FLINEAR1_2623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2622, v ds
+# define BFI_FLINEAR1_2623_TICK(t)
+# define BFI_FLINEAR1_2622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2621, v ds
+# define BFI_FLINEAR1_2622_TICK(t)
+# define BFI_FLINEAR1_2621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2620, v ds
+# define BFI_FLINEAR1_2621_TICK(t)
+# define BFI_FLINEAR1_2620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2619, v ds
+# define BFI_FLINEAR1_2620_TICK(t)
+# define BFI_FLINEAR1_2619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2618, v ds
+# define BFI_FLINEAR1_2619_TICK(t)
+# define BFI_FLINEAR1_2618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2617, v ds
+# define BFI_FLINEAR1_2618_TICK(t)
+# define BFI_FLINEAR1_2617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2616, v ds
+# define BFI_FLINEAR1_2617_TICK(t)
+# define BFI_FLINEAR1_2616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2615, v ds
+# define BFI_FLINEAR1_2616_TICK(t)
+# define BFI_FLINEAR1_2615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2614, v ds
+# define BFI_FLINEAR1_2615_TICK(t)
+# define BFI_FLINEAR1_2614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2613, v ds
+# define BFI_FLINEAR1_2614_TICK(t)
+# define BFI_FLINEAR1_2613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2612, v ds
+# define BFI_FLINEAR1_2613_TICK(t)
+# define BFI_FLINEAR1_2612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2611, v ds
+# define BFI_FLINEAR1_2612_TICK(t)
+# define BFI_FLINEAR1_2611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2610, v ds
+# define BFI_FLINEAR1_2611_TICK(t)
+# define BFI_FLINEAR1_2610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2609, v ds
+# define BFI_FLINEAR1_2610_TICK(t)
+# define BFI_FLINEAR1_2609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2608, v ds
+# define BFI_FLINEAR1_2609_TICK(t)
+# define BFI_FLINEAR1_2608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2607, v ds
+# define BFI_FLINEAR1_2608_TICK(t)
+# define BFI_FLINEAR1_2607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2606, v ds
+# define BFI_FLINEAR1_2607_TICK(t)
+# define BFI_FLINEAR1_2606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2605, v ds
+# define BFI_FLINEAR1_2606_TICK(t)
+# define BFI_FLINEAR1_2605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2604, v ds
+# define BFI_FLINEAR1_2605_TICK(t)
+# define BFI_FLINEAR1_2604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2603, v ds
+# define BFI_FLINEAR1_2604_TICK(t)
+# define BFI_FLINEAR1_2603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2602, v ds
+# define BFI_FLINEAR1_2603_TICK(t)
+# define BFI_FLINEAR1_2602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2601, v ds
+# define BFI_FLINEAR1_2602_TICK(t)
+# define BFI_FLINEAR1_2601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2600, v ds
+# define BFI_FLINEAR1_2601_TICK(t)
+# define BFI_FLINEAR1_2600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2599, v ds
+# define BFI_FLINEAR1_2600_TICK(t)
+# define BFI_FLINEAR1_2599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2598, v ds
+# define BFI_FLINEAR1_2599_TICK(t)
+# define BFI_FLINEAR1_2598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2597, v ds
+# define BFI_FLINEAR1_2598_TICK(t)
+# define BFI_FLINEAR1_2597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2596, v ds
+# define BFI_FLINEAR1_2597_TICK(t)
+# define BFI_FLINEAR1_2596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2595, v ds
+# define BFI_FLINEAR1_2596_TICK(t)
+# define BFI_FLINEAR1_2595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2594, v ds
+# define BFI_FLINEAR1_2595_TICK(t)
+# define BFI_FLINEAR1_2594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2593, v ds
+# define BFI_FLINEAR1_2594_TICK(t)
+# define BFI_FLINEAR1_2593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2592, v ds
+# define BFI_FLINEAR1_2593_TICK(t)
+# define BFI_FLINEAR1_2592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2591, v ds
+# define BFI_FLINEAR1_2592_TICK(t)
+# define BFI_FLINEAR1_2591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2590, v ds
+# define BFI_FLINEAR1_2591_TICK(t)
+# define BFI_FLINEAR1_2590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2589, v ds
+# define BFI_FLINEAR1_2590_TICK(t)
+# define BFI_FLINEAR1_2589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2588, v ds
+# define BFI_FLINEAR1_2589_TICK(t)
+# define BFI_FLINEAR1_2588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2587, v ds
+# define BFI_FLINEAR1_2588_TICK(t)
+# define BFI_FLINEAR1_2587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2586, v ds
+# define BFI_FLINEAR1_2587_TICK(t)
+# define BFI_FLINEAR1_2586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2585, v ds
+# define BFI_FLINEAR1_2586_TICK(t)
+# define BFI_FLINEAR1_2585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2584, v ds
+# define BFI_FLINEAR1_2585_TICK(t)
+# define BFI_FLINEAR1_2584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2583, v ds
+# define BFI_FLINEAR1_2584_TICK(t)
+# define BFI_FLINEAR1_2583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2582, v ds
+# define BFI_FLINEAR1_2583_TICK(t)
+# define BFI_FLINEAR1_2582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2581, v ds
+# define BFI_FLINEAR1_2582_TICK(t)
+# define BFI_FLINEAR1_2581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2580, v ds
+# define BFI_FLINEAR1_2581_TICK(t)
+# define BFI_FLINEAR1_2580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2579, v ds
+# define BFI_FLINEAR1_2580_TICK(t)
+# define BFI_FLINEAR1_2579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2578, v ds
+# define BFI_FLINEAR1_2579_TICK(t)
+# define BFI_FLINEAR1_2578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2577, v ds
+# define BFI_FLINEAR1_2578_TICK(t)
+# define BFI_FLINEAR1_2577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2576, v ds
+# define BFI_FLINEAR1_2577_TICK(t)
+# define BFI_FLINEAR1_2576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2575, v ds
+# define BFI_FLINEAR1_2576_TICK(t)
+# define BFI_FLINEAR1_2575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2574, v ds
+# define BFI_FLINEAR1_2575_TICK(t)
+# define BFI_FLINEAR1_2574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2573, v ds
+# define BFI_FLINEAR1_2574_TICK(t)
+# define BFI_FLINEAR1_2573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2572, v ds
+# define BFI_FLINEAR1_2573_TICK(t)
+# define BFI_FLINEAR1_2572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2571, v ds
+# define BFI_FLINEAR1_2572_TICK(t)
+# define BFI_FLINEAR1_2571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2570, v ds
+# define BFI_FLINEAR1_2571_TICK(t)
+# define BFI_FLINEAR1_2570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2569, v ds
+# define BFI_FLINEAR1_2570_TICK(t)
+# define BFI_FLINEAR1_2569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2568, v ds
+# define BFI_FLINEAR1_2569_TICK(t)
+# define BFI_FLINEAR1_2568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2567, v ds
+# define BFI_FLINEAR1_2568_TICK(t)
+# define BFI_FLINEAR1_2567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2566, v ds
+# define BFI_FLINEAR1_2567_TICK(t)
+# define BFI_FLINEAR1_2566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2565, v ds
+# define BFI_FLINEAR1_2566_TICK(t)
+# define BFI_FLINEAR1_2565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2564, v ds
+# define BFI_FLINEAR1_2565_TICK(t)
+# define BFI_FLINEAR1_2564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2563, v ds
+# define BFI_FLINEAR1_2564_TICK(t)
+# define BFI_FLINEAR1_2563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2562, v ds
+# define BFI_FLINEAR1_2563_TICK(t)
+# define BFI_FLINEAR1_2562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2561, v ds
+# define BFI_FLINEAR1_2562_TICK(t)
+# define BFI_FLINEAR1_2561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2560, v ds
+# define BFI_FLINEAR1_2561_TICK(t)
+# define BFI_FLINEAR1_2560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2559, v ds
+# define BFI_FLINEAR1_2560_TICK(t)
+# define BFI_FLINEAR1_2559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2558, v ds
+# define BFI_FLINEAR1_2559_TICK(t)
+# define BFI_FLINEAR1_2558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2557, v ds
+# define BFI_FLINEAR1_2558_TICK(t)
+# define BFI_FLINEAR1_2557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2556, v ds
+# define BFI_FLINEAR1_2557_TICK(t)
+# define BFI_FLINEAR1_2556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2555, v ds
+# define BFI_FLINEAR1_2556_TICK(t)
+# define BFI_FLINEAR1_2555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2554, v ds
+# define BFI_FLINEAR1_2555_TICK(t)
+# define BFI_FLINEAR1_2554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2553, v ds
+# define BFI_FLINEAR1_2554_TICK(t)
+# define BFI_FLINEAR1_2553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2552, v ds
+# define BFI_FLINEAR1_2553_TICK(t)
+# define BFI_FLINEAR1_2552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2551, v ds
+# define BFI_FLINEAR1_2552_TICK(t)
+# define BFI_FLINEAR1_2551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2550, v ds
+# define BFI_FLINEAR1_2551_TICK(t)
+# define BFI_FLINEAR1_2550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2549, v ds
+# define BFI_FLINEAR1_2550_TICK(t)
+# define BFI_FLINEAR1_2549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2548, v ds
+# define BFI_FLINEAR1_2549_TICK(t)
+# define BFI_FLINEAR1_2548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2547, v ds
+# define BFI_FLINEAR1_2548_TICK(t)
+# define BFI_FLINEAR1_2547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2546, v ds
+# define BFI_FLINEAR1_2547_TICK(t)
+# define BFI_FLINEAR1_2546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2545, v ds
+# define BFI_FLINEAR1_2546_TICK(t)
+# define BFI_FLINEAR1_2545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2544, v ds
+# define BFI_FLINEAR1_2545_TICK(t)
+# define BFI_FLINEAR1_2544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2543, v ds
+# define BFI_FLINEAR1_2544_TICK(t)
+# define BFI_FLINEAR1_2543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2542, v ds
+# define BFI_FLINEAR1_2543_TICK(t)
+# define BFI_FLINEAR1_2542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2541, v ds
+# define BFI_FLINEAR1_2542_TICK(t)
+# define BFI_FLINEAR1_2541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2540, v ds
+# define BFI_FLINEAR1_2541_TICK(t)
+# define BFI_FLINEAR1_2540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2539, v ds
+# define BFI_FLINEAR1_2540_TICK(t)
+# define BFI_FLINEAR1_2539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2538, v ds
+# define BFI_FLINEAR1_2539_TICK(t)
+# define BFI_FLINEAR1_2538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2537, v ds
+# define BFI_FLINEAR1_2538_TICK(t)
+# define BFI_FLINEAR1_2537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2536, v ds
+# define BFI_FLINEAR1_2537_TICK(t)
+# define BFI_FLINEAR1_2536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2535, v ds
+# define BFI_FLINEAR1_2536_TICK(t)
+# define BFI_FLINEAR1_2535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2534, v ds
+# define BFI_FLINEAR1_2535_TICK(t)
+# define BFI_FLINEAR1_2534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2533, v ds
+# define BFI_FLINEAR1_2534_TICK(t)
+# define BFI_FLINEAR1_2533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2532, v ds
+# define BFI_FLINEAR1_2533_TICK(t)
+# define BFI_FLINEAR1_2532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2531, v ds
+# define BFI_FLINEAR1_2532_TICK(t)
+# define BFI_FLINEAR1_2531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2530, v ds
+# define BFI_FLINEAR1_2531_TICK(t)
+# define BFI_FLINEAR1_2530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2529, v ds
+# define BFI_FLINEAR1_2530_TICK(t)
+# define BFI_FLINEAR1_2529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2528, v ds
+# define BFI_FLINEAR1_2529_TICK(t)
+# define BFI_FLINEAR1_2528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2527, v ds
+# define BFI_FLINEAR1_2528_TICK(t)
+# define BFI_FLINEAR1_2527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2526, v ds
+# define BFI_FLINEAR1_2527_TICK(t)
+# define BFI_FLINEAR1_2526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2525, v ds
+# define BFI_FLINEAR1_2526_TICK(t)
+# define BFI_FLINEAR1_2525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2524, v ds
+# define BFI_FLINEAR1_2525_TICK(t)
+# define BFI_FLINEAR1_2524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2523, v ds
+# define BFI_FLINEAR1_2524_TICK(t)
+# define BFI_FLINEAR1_2523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2522, v ds
+# define BFI_FLINEAR1_2523_TICK(t)
+# define BFI_FLINEAR1_2522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2521, v ds
+# define BFI_FLINEAR1_2522_TICK(t)
+# define BFI_FLINEAR1_2521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2520, v ds
+# define BFI_FLINEAR1_2521_TICK(t)
+# define BFI_FLINEAR1_2520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2519, v ds
+# define BFI_FLINEAR1_2520_TICK(t)
+# define BFI_FLINEAR1_2519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2518, v ds
+# define BFI_FLINEAR1_2519_TICK(t)
+# define BFI_FLINEAR1_2518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2517, v ds
+# define BFI_FLINEAR1_2518_TICK(t)
+# define BFI_FLINEAR1_2517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2516, v ds
+# define BFI_FLINEAR1_2517_TICK(t)
+# define BFI_FLINEAR1_2516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2515, v ds
+# define BFI_FLINEAR1_2516_TICK(t)
+# define BFI_FLINEAR1_2515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2514, v ds
+# define BFI_FLINEAR1_2515_TICK(t)
+# define BFI_FLINEAR1_2514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2513, v ds
+# define BFI_FLINEAR1_2514_TICK(t)
+# define BFI_FLINEAR1_2513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2512, v ds
+# define BFI_FLINEAR1_2513_TICK(t)
+# define BFI_FLINEAR1_2512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2511, v ds
+# define BFI_FLINEAR1_2512_TICK(t)
+# define BFI_FLINEAR1_2511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2510, v ds
+# define BFI_FLINEAR1_2511_TICK(t)
+# define BFI_FLINEAR1_2510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2509, v ds
+# define BFI_FLINEAR1_2510_TICK(t)
+# define BFI_FLINEAR1_2509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2508, v ds
+# define BFI_FLINEAR1_2509_TICK(t)
+# define BFI_FLINEAR1_2508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2507, v ds
+# define BFI_FLINEAR1_2508_TICK(t)
+# define BFI_FLINEAR1_2507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2506, v ds
+# define BFI_FLINEAR1_2507_TICK(t)
+# define BFI_FLINEAR1_2506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2505, v ds
+# define BFI_FLINEAR1_2506_TICK(t)
+# define BFI_FLINEAR1_2505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2504, v ds
+# define BFI_FLINEAR1_2505_TICK(t)
+# define BFI_FLINEAR1_2504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2503, v ds
+# define BFI_FLINEAR1_2504_TICK(t)
+# define BFI_FLINEAR1_2503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2502, v ds
+# define BFI_FLINEAR1_2503_TICK(t)
+# define BFI_FLINEAR1_2502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2501, v ds
+# define BFI_FLINEAR1_2502_TICK(t)
+# define BFI_FLINEAR1_2501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2500, v ds
+# define BFI_FLINEAR1_2501_TICK(t)
+# define BFI_FLINEAR1_2500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2499, v ds
+# define BFI_FLINEAR1_2500_TICK(t)
+# define BFI_FLINEAR1_2499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2498, v ds
+# define BFI_FLINEAR1_2499_TICK(t)
+# define BFI_FLINEAR1_2498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2497, v ds
+# define BFI_FLINEAR1_2498_TICK(t)
+# define BFI_FLINEAR1_2497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2496, v ds
+# define BFI_FLINEAR1_2497_TICK(t)
+# define BFI_FLINEAR1_2496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2495, v ds
+# define BFI_FLINEAR1_2496_TICK(t)
+# define BFI_FLINEAR1_2495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2494, v ds
+# define BFI_FLINEAR1_2495_TICK(t)
+# define BFI_FLINEAR1_2494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2493, v ds
+# define BFI_FLINEAR1_2494_TICK(t)
+# define BFI_FLINEAR1_2493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2492, v ds
+# define BFI_FLINEAR1_2493_TICK(t)
+# define BFI_FLINEAR1_2492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2491, v ds
+# define BFI_FLINEAR1_2492_TICK(t)
+# define BFI_FLINEAR1_2491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2490, v ds
+# define BFI_FLINEAR1_2491_TICK(t)
+# define BFI_FLINEAR1_2490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2489, v ds
+# define BFI_FLINEAR1_2490_TICK(t)
+# define BFI_FLINEAR1_2489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2488, v ds
+# define BFI_FLINEAR1_2489_TICK(t)
+# define BFI_FLINEAR1_2488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2487, v ds
+# define BFI_FLINEAR1_2488_TICK(t)
+# define BFI_FLINEAR1_2487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2486, v ds
+# define BFI_FLINEAR1_2487_TICK(t)
+# define BFI_FLINEAR1_2486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2485, v ds
+# define BFI_FLINEAR1_2486_TICK(t)
+# define BFI_FLINEAR1_2485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2484, v ds
+# define BFI_FLINEAR1_2485_TICK(t)
+# define BFI_FLINEAR1_2484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2483, v ds
+# define BFI_FLINEAR1_2484_TICK(t)
+# define BFI_FLINEAR1_2483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2482, v ds
+# define BFI_FLINEAR1_2483_TICK(t)
+# define BFI_FLINEAR1_2482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2481, v ds
+# define BFI_FLINEAR1_2482_TICK(t)
+# define BFI_FLINEAR1_2481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2480, v ds
+# define BFI_FLINEAR1_2481_TICK(t)
+# define BFI_FLINEAR1_2480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2479, v ds
+# define BFI_FLINEAR1_2480_TICK(t)
+# define BFI_FLINEAR1_2479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2478, v ds
+# define BFI_FLINEAR1_2479_TICK(t)
+# define BFI_FLINEAR1_2478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2477, v ds
+# define BFI_FLINEAR1_2478_TICK(t)
+# define BFI_FLINEAR1_2477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2476, v ds
+# define BFI_FLINEAR1_2477_TICK(t)
+# define BFI_FLINEAR1_2476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2475, v ds
+# define BFI_FLINEAR1_2476_TICK(t)
+# define BFI_FLINEAR1_2475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2474, v ds
+# define BFI_FLINEAR1_2475_TICK(t)
+# define BFI_FLINEAR1_2474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2473, v ds
+# define BFI_FLINEAR1_2474_TICK(t)
+# define BFI_FLINEAR1_2473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2472, v ds
+# define BFI_FLINEAR1_2473_TICK(t)
+# define BFI_FLINEAR1_2472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2471, v ds
+# define BFI_FLINEAR1_2472_TICK(t)
+# define BFI_FLINEAR1_2471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2470, v ds
+# define BFI_FLINEAR1_2471_TICK(t)
+# define BFI_FLINEAR1_2470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2469, v ds
+# define BFI_FLINEAR1_2470_TICK(t)
+# define BFI_FLINEAR1_2469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2468, v ds
+# define BFI_FLINEAR1_2469_TICK(t)
+# define BFI_FLINEAR1_2468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2467, v ds
+# define BFI_FLINEAR1_2468_TICK(t)
+# define BFI_FLINEAR1_2467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2466, v ds
+# define BFI_FLINEAR1_2467_TICK(t)
+# define BFI_FLINEAR1_2466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2465, v ds
+# define BFI_FLINEAR1_2466_TICK(t)
+# define BFI_FLINEAR1_2465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2464, v ds
+# define BFI_FLINEAR1_2465_TICK(t)
+# define BFI_FLINEAR1_2464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2463, v ds
+# define BFI_FLINEAR1_2464_TICK(t)
+# define BFI_FLINEAR1_2463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2462, v ds
+# define BFI_FLINEAR1_2463_TICK(t)
+# define BFI_FLINEAR1_2462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2461, v ds
+# define BFI_FLINEAR1_2462_TICK(t)
+# define BFI_FLINEAR1_2461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2460, v ds
+# define BFI_FLINEAR1_2461_TICK(t)
+# define BFI_FLINEAR1_2460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2459, v ds
+# define BFI_FLINEAR1_2460_TICK(t)
+# define BFI_FLINEAR1_2459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2458, v ds
+# define BFI_FLINEAR1_2459_TICK(t)
+# define BFI_FLINEAR1_2458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2457, v ds
+# define BFI_FLINEAR1_2458_TICK(t)
+# define BFI_FLINEAR1_2457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2456, v ds
+# define BFI_FLINEAR1_2457_TICK(t)
+# define BFI_FLINEAR1_2456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2455, v ds
+# define BFI_FLINEAR1_2456_TICK(t)
+# define BFI_FLINEAR1_2455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2454, v ds
+# define BFI_FLINEAR1_2455_TICK(t)
+# define BFI_FLINEAR1_2454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2453, v ds
+# define BFI_FLINEAR1_2454_TICK(t)
+# define BFI_FLINEAR1_2453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2452, v ds
+# define BFI_FLINEAR1_2453_TICK(t)
+# define BFI_FLINEAR1_2452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2451, v ds
+# define BFI_FLINEAR1_2452_TICK(t)
+# define BFI_FLINEAR1_2451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2450, v ds
+# define BFI_FLINEAR1_2451_TICK(t)
+# define BFI_FLINEAR1_2450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2449, v ds
+# define BFI_FLINEAR1_2450_TICK(t)
+# define BFI_FLINEAR1_2449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2448, v ds
+# define BFI_FLINEAR1_2449_TICK(t)
+# define BFI_FLINEAR1_2448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2447, v ds
+# define BFI_FLINEAR1_2448_TICK(t)
+# define BFI_FLINEAR1_2447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2446, v ds
+# define BFI_FLINEAR1_2447_TICK(t)
+# define BFI_FLINEAR1_2446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2445, v ds
+# define BFI_FLINEAR1_2446_TICK(t)
+# define BFI_FLINEAR1_2445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2444, v ds
+# define BFI_FLINEAR1_2445_TICK(t)
+# define BFI_FLINEAR1_2444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2443, v ds
+# define BFI_FLINEAR1_2444_TICK(t)
+# define BFI_FLINEAR1_2443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2442, v ds
+# define BFI_FLINEAR1_2443_TICK(t)
+# define BFI_FLINEAR1_2442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2441, v ds
+# define BFI_FLINEAR1_2442_TICK(t)
+# define BFI_FLINEAR1_2441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2440, v ds
+# define BFI_FLINEAR1_2441_TICK(t)
+# define BFI_FLINEAR1_2440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2439, v ds
+# define BFI_FLINEAR1_2440_TICK(t)
+# define BFI_FLINEAR1_2439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2438, v ds
+# define BFI_FLINEAR1_2439_TICK(t)
+# define BFI_FLINEAR1_2438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2437, v ds
+# define BFI_FLINEAR1_2438_TICK(t)
+# define BFI_FLINEAR1_2437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2436, v ds
+# define BFI_FLINEAR1_2437_TICK(t)
+# define BFI_FLINEAR1_2436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2435, v ds
+# define BFI_FLINEAR1_2436_TICK(t)
+# define BFI_FLINEAR1_2435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2434, v ds
+# define BFI_FLINEAR1_2435_TICK(t)
+# define BFI_FLINEAR1_2434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2433, v ds
+# define BFI_FLINEAR1_2434_TICK(t)
+# define BFI_FLINEAR1_2433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2432, v ds
+# define BFI_FLINEAR1_2433_TICK(t)
+# define BFI_FLINEAR1_2432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2431, v ds
+# define BFI_FLINEAR1_2432_TICK(t)
+# define BFI_FLINEAR1_2431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2430, v ds
+# define BFI_FLINEAR1_2431_TICK(t)
+# define BFI_FLINEAR1_2430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2429, v ds
+# define BFI_FLINEAR1_2430_TICK(t)
+# define BFI_FLINEAR1_2429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2428, v ds
+# define BFI_FLINEAR1_2429_TICK(t)
+# define BFI_FLINEAR1_2428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2427, v ds
+# define BFI_FLINEAR1_2428_TICK(t)
+# define BFI_FLINEAR1_2427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2426, v ds
+# define BFI_FLINEAR1_2427_TICK(t)
+# define BFI_FLINEAR1_2426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2425, v ds
+# define BFI_FLINEAR1_2426_TICK(t)
+# define BFI_FLINEAR1_2425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2424, v ds
+# define BFI_FLINEAR1_2425_TICK(t)
+# define BFI_FLINEAR1_2424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2423, v ds
+# define BFI_FLINEAR1_2424_TICK(t)
+# define BFI_FLINEAR1_2423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2422, v ds
+# define BFI_FLINEAR1_2423_TICK(t)
+# define BFI_FLINEAR1_2422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2421, v ds
+# define BFI_FLINEAR1_2422_TICK(t)
+# define BFI_FLINEAR1_2421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2420, v ds
+# define BFI_FLINEAR1_2421_TICK(t)
+# define BFI_FLINEAR1_2420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2419, v ds
+# define BFI_FLINEAR1_2420_TICK(t)
+# define BFI_FLINEAR1_2419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2418, v ds
+# define BFI_FLINEAR1_2419_TICK(t)
+# define BFI_FLINEAR1_2418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2417, v ds
+# define BFI_FLINEAR1_2418_TICK(t)
+# define BFI_FLINEAR1_2417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2416, v ds
+# define BFI_FLINEAR1_2417_TICK(t)
+# define BFI_FLINEAR1_2416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2415, v ds
+# define BFI_FLINEAR1_2416_TICK(t)
+# define BFI_FLINEAR1_2415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2414, v ds
+# define BFI_FLINEAR1_2415_TICK(t)
+# define BFI_FLINEAR1_2414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2413, v ds
+# define BFI_FLINEAR1_2414_TICK(t)
+# define BFI_FLINEAR1_2413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2412, v ds
+# define BFI_FLINEAR1_2413_TICK(t)
+# define BFI_FLINEAR1_2412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2411, v ds
+# define BFI_FLINEAR1_2412_TICK(t)
+# define BFI_FLINEAR1_2411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2410, v ds
+# define BFI_FLINEAR1_2411_TICK(t)
+# define BFI_FLINEAR1_2410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2409, v ds
+# define BFI_FLINEAR1_2410_TICK(t)
+# define BFI_FLINEAR1_2409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2408, v ds
+# define BFI_FLINEAR1_2409_TICK(t)
+# define BFI_FLINEAR1_2408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2407, v ds
+# define BFI_FLINEAR1_2408_TICK(t)
+# define BFI_FLINEAR1_2407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2406, v ds
+# define BFI_FLINEAR1_2407_TICK(t)
+# define BFI_FLINEAR1_2406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2405, v ds
+# define BFI_FLINEAR1_2406_TICK(t)
+# define BFI_FLINEAR1_2405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2404, v ds
+# define BFI_FLINEAR1_2405_TICK(t)
+# define BFI_FLINEAR1_2404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2403, v ds
+# define BFI_FLINEAR1_2404_TICK(t)
+# define BFI_FLINEAR1_2403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2402, v ds
+# define BFI_FLINEAR1_2403_TICK(t)
+# define BFI_FLINEAR1_2402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2401, v ds
+# define BFI_FLINEAR1_2402_TICK(t)
+# define BFI_FLINEAR1_2401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2400, v ds
+# define BFI_FLINEAR1_2401_TICK(t)
+# define BFI_FLINEAR1_2400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2399, v ds
+# define BFI_FLINEAR1_2400_TICK(t)
+# define BFI_FLINEAR1_2399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2398, v ds
+# define BFI_FLINEAR1_2399_TICK(t)
+# define BFI_FLINEAR1_2398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2397, v ds
+# define BFI_FLINEAR1_2398_TICK(t)
+# define BFI_FLINEAR1_2397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2396, v ds
+# define BFI_FLINEAR1_2397_TICK(t)
+# define BFI_FLINEAR1_2396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2395, v ds
+# define BFI_FLINEAR1_2396_TICK(t)
+# define BFI_FLINEAR1_2395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2394, v ds
+# define BFI_FLINEAR1_2395_TICK(t)
+# define BFI_FLINEAR1_2394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2393, v ds
+# define BFI_FLINEAR1_2394_TICK(t)
+# define BFI_FLINEAR1_2393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2392, v ds
+# define BFI_FLINEAR1_2393_TICK(t)
+# define BFI_FLINEAR1_2392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2391, v ds
+# define BFI_FLINEAR1_2392_TICK(t)
+# define BFI_FLINEAR1_2391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2390, v ds
+# define BFI_FLINEAR1_2391_TICK(t)
+# define BFI_FLINEAR1_2390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2389, v ds
+# define BFI_FLINEAR1_2390_TICK(t)
+# define BFI_FLINEAR1_2389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2388, v ds
+# define BFI_FLINEAR1_2389_TICK(t)
+# define BFI_FLINEAR1_2388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2387, v ds
+# define BFI_FLINEAR1_2388_TICK(t)
+# define BFI_FLINEAR1_2387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2386, v ds
+# define BFI_FLINEAR1_2387_TICK(t)
+# define BFI_FLINEAR1_2386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2385, v ds
+# define BFI_FLINEAR1_2386_TICK(t)
+# define BFI_FLINEAR1_2385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2384, v ds
+# define BFI_FLINEAR1_2385_TICK(t)
+# define BFI_FLINEAR1_2384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2383, v ds
+# define BFI_FLINEAR1_2384_TICK(t)
+# define BFI_FLINEAR1_2383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2382, v ds
+# define BFI_FLINEAR1_2383_TICK(t)
+# define BFI_FLINEAR1_2382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2381, v ds
+# define BFI_FLINEAR1_2382_TICK(t)
+# define BFI_FLINEAR1_2381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2380, v ds
+# define BFI_FLINEAR1_2381_TICK(t)
+# define BFI_FLINEAR1_2380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2379, v ds
+# define BFI_FLINEAR1_2380_TICK(t)
+# define BFI_FLINEAR1_2379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2378, v ds
+# define BFI_FLINEAR1_2379_TICK(t)
+# define BFI_FLINEAR1_2378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2377, v ds
+# define BFI_FLINEAR1_2378_TICK(t)
+# define BFI_FLINEAR1_2377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2376, v ds
+# define BFI_FLINEAR1_2377_TICK(t)
+# define BFI_FLINEAR1_2376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2375, v ds
+# define BFI_FLINEAR1_2376_TICK(t)
+# define BFI_FLINEAR1_2375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2374, v ds
+# define BFI_FLINEAR1_2375_TICK(t)
+# define BFI_FLINEAR1_2374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2373, v ds
+# define BFI_FLINEAR1_2374_TICK(t)
+# define BFI_FLINEAR1_2373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2372, v ds
+# define BFI_FLINEAR1_2373_TICK(t)
+# define BFI_FLINEAR1_2372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2371, v ds
+# define BFI_FLINEAR1_2372_TICK(t)
+# define BFI_FLINEAR1_2371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2370, v ds
+# define BFI_FLINEAR1_2371_TICK(t)
+# define BFI_FLINEAR1_2370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2369, v ds
+# define BFI_FLINEAR1_2370_TICK(t)
+# define BFI_FLINEAR1_2369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2368, v ds
+# define BFI_FLINEAR1_2369_TICK(t)
+# define BFI_FLINEAR1_2368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2367, v ds
+# define BFI_FLINEAR1_2368_TICK(t)
+# define BFI_FLINEAR1_2367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2366, v ds
+# define BFI_FLINEAR1_2367_TICK(t)
+# define BFI_FLINEAR1_2366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2365, v ds
+# define BFI_FLINEAR1_2366_TICK(t)
+# define BFI_FLINEAR1_2365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2364, v ds
+# define BFI_FLINEAR1_2365_TICK(t)
+# define BFI_FLINEAR1_2364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2363, v ds
+# define BFI_FLINEAR1_2364_TICK(t)
+# define BFI_FLINEAR1_2363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2362, v ds
+# define BFI_FLINEAR1_2363_TICK(t)
+# define BFI_FLINEAR1_2362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2361, v ds
+# define BFI_FLINEAR1_2362_TICK(t)
+# define BFI_FLINEAR1_2361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2360, v ds
+# define BFI_FLINEAR1_2361_TICK(t)
+# define BFI_FLINEAR1_2360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2359, v ds
+# define BFI_FLINEAR1_2360_TICK(t)
+# define BFI_FLINEAR1_2359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2358, v ds
+# define BFI_FLINEAR1_2359_TICK(t)
+# define BFI_FLINEAR1_2358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2357, v ds
+# define BFI_FLINEAR1_2358_TICK(t)
+# define BFI_FLINEAR1_2357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2356, v ds
+# define BFI_FLINEAR1_2357_TICK(t)
+# define BFI_FLINEAR1_2356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2355, v ds
+# define BFI_FLINEAR1_2356_TICK(t)
+# define BFI_FLINEAR1_2355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2354, v ds
+# define BFI_FLINEAR1_2355_TICK(t)
+# define BFI_FLINEAR1_2354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2353, v ds
+# define BFI_FLINEAR1_2354_TICK(t)
+# define BFI_FLINEAR1_2353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2352, v ds
+# define BFI_FLINEAR1_2353_TICK(t)
+# define BFI_FLINEAR1_2352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2351, v ds
+# define BFI_FLINEAR1_2352_TICK(t)
+# define BFI_FLINEAR1_2351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2350, v ds
+# define BFI_FLINEAR1_2351_TICK(t)
+# define BFI_FLINEAR1_2350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2349, v ds
+# define BFI_FLINEAR1_2350_TICK(t)
+# define BFI_FLINEAR1_2349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2348, v ds
+# define BFI_FLINEAR1_2349_TICK(t)
+# define BFI_FLINEAR1_2348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2347, v ds
+# define BFI_FLINEAR1_2348_TICK(t)
+# define BFI_FLINEAR1_2347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2346, v ds
+# define BFI_FLINEAR1_2347_TICK(t)
+# define BFI_FLINEAR1_2346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2345, v ds
+# define BFI_FLINEAR1_2346_TICK(t)
+# define BFI_FLINEAR1_2345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2344, v ds
+# define BFI_FLINEAR1_2345_TICK(t)
+# define BFI_FLINEAR1_2344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2343, v ds
+# define BFI_FLINEAR1_2344_TICK(t)
+# define BFI_FLINEAR1_2343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2342, v ds
+# define BFI_FLINEAR1_2343_TICK(t)
+# define BFI_FLINEAR1_2342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2341, v ds
+# define BFI_FLINEAR1_2342_TICK(t)
+# define BFI_FLINEAR1_2341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2340, v ds
+# define BFI_FLINEAR1_2341_TICK(t)
+# define BFI_FLINEAR1_2340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2339, v ds
+# define BFI_FLINEAR1_2340_TICK(t)
+# define BFI_FLINEAR1_2339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2338, v ds
+# define BFI_FLINEAR1_2339_TICK(t)
+# define BFI_FLINEAR1_2338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2337, v ds
+# define BFI_FLINEAR1_2338_TICK(t)
+# define BFI_FLINEAR1_2337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2336, v ds
+# define BFI_FLINEAR1_2337_TICK(t)
+# define BFI_FLINEAR1_2336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2335, v ds
+# define BFI_FLINEAR1_2336_TICK(t)
+# define BFI_FLINEAR1_2335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2334, v ds
+# define BFI_FLINEAR1_2335_TICK(t)
+# define BFI_FLINEAR1_2334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2333, v ds
+# define BFI_FLINEAR1_2334_TICK(t)
+# define BFI_FLINEAR1_2333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2332, v ds
+# define BFI_FLINEAR1_2333_TICK(t)
+# define BFI_FLINEAR1_2332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2331, v ds
+# define BFI_FLINEAR1_2332_TICK(t)
+# define BFI_FLINEAR1_2331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2330, v ds
+# define BFI_FLINEAR1_2331_TICK(t)
+# define BFI_FLINEAR1_2330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2329, v ds
+# define BFI_FLINEAR1_2330_TICK(t)
+# define BFI_FLINEAR1_2329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2328, v ds
+# define BFI_FLINEAR1_2329_TICK(t)
+# define BFI_FLINEAR1_2328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2327, v ds
+# define BFI_FLINEAR1_2328_TICK(t)
+# define BFI_FLINEAR1_2327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2326, v ds
+# define BFI_FLINEAR1_2327_TICK(t)
+# define BFI_FLINEAR1_2326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2325, v ds
+# define BFI_FLINEAR1_2326_TICK(t)
+# define BFI_FLINEAR1_2325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2324, v ds
+# define BFI_FLINEAR1_2325_TICK(t)
+# define BFI_FLINEAR1_2324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2323, v ds
+# define BFI_FLINEAR1_2324_TICK(t)
+# define BFI_FLINEAR1_2323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2322, v ds
+# define BFI_FLINEAR1_2323_TICK(t)
+# define BFI_FLINEAR1_2322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2321, v ds
+# define BFI_FLINEAR1_2322_TICK(t)
+# define BFI_FLINEAR1_2321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2320, v ds
+# define BFI_FLINEAR1_2321_TICK(t)
+# define BFI_FLINEAR1_2320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2319, v ds
+# define BFI_FLINEAR1_2320_TICK(t)
+# define BFI_FLINEAR1_2319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2318, v ds
+# define BFI_FLINEAR1_2319_TICK(t)
+# define BFI_FLINEAR1_2318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2317, v ds
+# define BFI_FLINEAR1_2318_TICK(t)
+# define BFI_FLINEAR1_2317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2316, v ds
+# define BFI_FLINEAR1_2317_TICK(t)
+# define BFI_FLINEAR1_2316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2315, v ds
+# define BFI_FLINEAR1_2316_TICK(t)
+# define BFI_FLINEAR1_2315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2314, v ds
+# define BFI_FLINEAR1_2315_TICK(t)
+# define BFI_FLINEAR1_2314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2313, v ds
+# define BFI_FLINEAR1_2314_TICK(t)
+# define BFI_FLINEAR1_2313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2312, v ds
+# define BFI_FLINEAR1_2313_TICK(t)
+# define BFI_FLINEAR1_2312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2311, v ds
+# define BFI_FLINEAR1_2312_TICK(t)
+# define BFI_FLINEAR1_2311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2310, v ds
+# define BFI_FLINEAR1_2311_TICK(t)
+# define BFI_FLINEAR1_2310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2309, v ds
+# define BFI_FLINEAR1_2310_TICK(t)
+# define BFI_FLINEAR1_2309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2308, v ds
+# define BFI_FLINEAR1_2309_TICK(t)
+# define BFI_FLINEAR1_2308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2307, v ds
+# define BFI_FLINEAR1_2308_TICK(t)
+# define BFI_FLINEAR1_2307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2306, v ds
+# define BFI_FLINEAR1_2307_TICK(t)
+# define BFI_FLINEAR1_2306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2305, v ds
+# define BFI_FLINEAR1_2306_TICK(t)
+# define BFI_FLINEAR1_2305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2304, v ds
+# define BFI_FLINEAR1_2305_TICK(t)
+# define BFI_FLINEAR1_2304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2303, v ds
+# define BFI_FLINEAR1_2304_TICK(t)
+# define BFI_FLINEAR1_2303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2302, v ds
+# define BFI_FLINEAR1_2303_TICK(t)
+# define BFI_FLINEAR1_2302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2301, v ds
+# define BFI_FLINEAR1_2302_TICK(t)
+# define BFI_FLINEAR1_2301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2300, v ds
+# define BFI_FLINEAR1_2301_TICK(t)
+# define BFI_FLINEAR1_2300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2299, v ds
+# define BFI_FLINEAR1_2300_TICK(t)
+# define BFI_FLINEAR1_2299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2298, v ds
+# define BFI_FLINEAR1_2299_TICK(t)
+# define BFI_FLINEAR1_2298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2297, v ds
+# define BFI_FLINEAR1_2298_TICK(t)
+# define BFI_FLINEAR1_2297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2296, v ds
+# define BFI_FLINEAR1_2297_TICK(t)
+# define BFI_FLINEAR1_2296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2295, v ds
+# define BFI_FLINEAR1_2296_TICK(t)
+# define BFI_FLINEAR1_2295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2294, v ds
+# define BFI_FLINEAR1_2295_TICK(t)
+# define BFI_FLINEAR1_2294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2293, v ds
+# define BFI_FLINEAR1_2294_TICK(t)
+# define BFI_FLINEAR1_2293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2292, v ds
+# define BFI_FLINEAR1_2293_TICK(t)
+# define BFI_FLINEAR1_2292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2291, v ds
+# define BFI_FLINEAR1_2292_TICK(t)
+# define BFI_FLINEAR1_2291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2290, v ds
+# define BFI_FLINEAR1_2291_TICK(t)
+# define BFI_FLINEAR1_2290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2289, v ds
+# define BFI_FLINEAR1_2290_TICK(t)
+# define BFI_FLINEAR1_2289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2288, v ds
+# define BFI_FLINEAR1_2289_TICK(t)
+# define BFI_FLINEAR1_2288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2287, v ds
+# define BFI_FLINEAR1_2288_TICK(t)
+# define BFI_FLINEAR1_2287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2286, v ds
+# define BFI_FLINEAR1_2287_TICK(t)
+# define BFI_FLINEAR1_2286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2285, v ds
+# define BFI_FLINEAR1_2286_TICK(t)
+# define BFI_FLINEAR1_2285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2284, v ds
+# define BFI_FLINEAR1_2285_TICK(t)
+# define BFI_FLINEAR1_2284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2283, v ds
+# define BFI_FLINEAR1_2284_TICK(t)
+# define BFI_FLINEAR1_2283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2282, v ds
+# define BFI_FLINEAR1_2283_TICK(t)
+# define BFI_FLINEAR1_2282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2281, v ds
+# define BFI_FLINEAR1_2282_TICK(t)
+# define BFI_FLINEAR1_2281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2280, v ds
+# define BFI_FLINEAR1_2281_TICK(t)
+# define BFI_FLINEAR1_2280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2279, v ds
+# define BFI_FLINEAR1_2280_TICK(t)
+# define BFI_FLINEAR1_2279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2278, v ds
+# define BFI_FLINEAR1_2279_TICK(t)
+# define BFI_FLINEAR1_2278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2277, v ds
+# define BFI_FLINEAR1_2278_TICK(t)
+# define BFI_FLINEAR1_2277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2276, v ds
+# define BFI_FLINEAR1_2277_TICK(t)
+# define BFI_FLINEAR1_2276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2275, v ds
+# define BFI_FLINEAR1_2276_TICK(t)
+# define BFI_FLINEAR1_2275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2274, v ds
+# define BFI_FLINEAR1_2275_TICK(t)
+# define BFI_FLINEAR1_2274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2273, v ds
+# define BFI_FLINEAR1_2274_TICK(t)
+# define BFI_FLINEAR1_2273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2272, v ds
+# define BFI_FLINEAR1_2273_TICK(t)
+# define BFI_FLINEAR1_2272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2271, v ds
+# define BFI_FLINEAR1_2272_TICK(t)
+# define BFI_FLINEAR1_2271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2270, v ds
+# define BFI_FLINEAR1_2271_TICK(t)
+# define BFI_FLINEAR1_2270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2269, v ds
+# define BFI_FLINEAR1_2270_TICK(t)
+# define BFI_FLINEAR1_2269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2268, v ds
+# define BFI_FLINEAR1_2269_TICK(t)
+# define BFI_FLINEAR1_2268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2267, v ds
+# define BFI_FLINEAR1_2268_TICK(t)
+# define BFI_FLINEAR1_2267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2266, v ds
+# define BFI_FLINEAR1_2267_TICK(t)
+# define BFI_FLINEAR1_2266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2265, v ds
+# define BFI_FLINEAR1_2266_TICK(t)
+# define BFI_FLINEAR1_2265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2264, v ds
+# define BFI_FLINEAR1_2265_TICK(t)
+# define BFI_FLINEAR1_2264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2263, v ds
+# define BFI_FLINEAR1_2264_TICK(t)
+# define BFI_FLINEAR1_2263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2262, v ds
+# define BFI_FLINEAR1_2263_TICK(t)
+# define BFI_FLINEAR1_2262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2261, v ds
+# define BFI_FLINEAR1_2262_TICK(t)
+# define BFI_FLINEAR1_2261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2260, v ds
+# define BFI_FLINEAR1_2261_TICK(t)
+# define BFI_FLINEAR1_2260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2259, v ds
+# define BFI_FLINEAR1_2260_TICK(t)
+# define BFI_FLINEAR1_2259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2258, v ds
+# define BFI_FLINEAR1_2259_TICK(t)
+# define BFI_FLINEAR1_2258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2257, v ds
+# define BFI_FLINEAR1_2258_TICK(t)
+# define BFI_FLINEAR1_2257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2256, v ds
+# define BFI_FLINEAR1_2257_TICK(t)
+# define BFI_FLINEAR1_2256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2255, v ds
+# define BFI_FLINEAR1_2256_TICK(t)
+# define BFI_FLINEAR1_2255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2254, v ds
+# define BFI_FLINEAR1_2255_TICK(t)
+# define BFI_FLINEAR1_2254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2253, v ds
+# define BFI_FLINEAR1_2254_TICK(t)
+# define BFI_FLINEAR1_2253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2252, v ds
+# define BFI_FLINEAR1_2253_TICK(t)
+# define BFI_FLINEAR1_2252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2251, v ds
+# define BFI_FLINEAR1_2252_TICK(t)
+# define BFI_FLINEAR1_2251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2250, v ds
+# define BFI_FLINEAR1_2251_TICK(t)
+# define BFI_FLINEAR1_2250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2249, v ds
+# define BFI_FLINEAR1_2250_TICK(t)
+# define BFI_FLINEAR1_2249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2248, v ds
+# define BFI_FLINEAR1_2249_TICK(t)
+# define BFI_FLINEAR1_2248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2247, v ds
+# define BFI_FLINEAR1_2248_TICK(t)
+# define BFI_FLINEAR1_2247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2246, v ds
+# define BFI_FLINEAR1_2247_TICK(t)
+# define BFI_FLINEAR1_2246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2245, v ds
+# define BFI_FLINEAR1_2246_TICK(t)
+# define BFI_FLINEAR1_2245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2244, v ds
+# define BFI_FLINEAR1_2245_TICK(t)
+# define BFI_FLINEAR1_2244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2243, v ds
+# define BFI_FLINEAR1_2244_TICK(t)
+# define BFI_FLINEAR1_2243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2242, v ds
+# define BFI_FLINEAR1_2243_TICK(t)
+# define BFI_FLINEAR1_2242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2241, v ds
+# define BFI_FLINEAR1_2242_TICK(t)
+# define BFI_FLINEAR1_2241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2240, v ds
+# define BFI_FLINEAR1_2241_TICK(t)
+# define BFI_FLINEAR1_2240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2239, v ds
+# define BFI_FLINEAR1_2240_TICK(t)
+# define BFI_FLINEAR1_2239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2238, v ds
+# define BFI_FLINEAR1_2239_TICK(t)
+# define BFI_FLINEAR1_2238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2237, v ds
+# define BFI_FLINEAR1_2238_TICK(t)
+# define BFI_FLINEAR1_2237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2236, v ds
+# define BFI_FLINEAR1_2237_TICK(t)
+# define BFI_FLINEAR1_2236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2235, v ds
+# define BFI_FLINEAR1_2236_TICK(t)
+# define BFI_FLINEAR1_2235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2234, v ds
+# define BFI_FLINEAR1_2235_TICK(t)
+# define BFI_FLINEAR1_2234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2233, v ds
+# define BFI_FLINEAR1_2234_TICK(t)
+# define BFI_FLINEAR1_2233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2232, v ds
+# define BFI_FLINEAR1_2233_TICK(t)
+# define BFI_FLINEAR1_2232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2231, v ds
+# define BFI_FLINEAR1_2232_TICK(t)
+# define BFI_FLINEAR1_2231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2230, v ds
+# define BFI_FLINEAR1_2231_TICK(t)
+# define BFI_FLINEAR1_2230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2229, v ds
+# define BFI_FLINEAR1_2230_TICK(t)
+# define BFI_FLINEAR1_2229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2228, v ds
+# define BFI_FLINEAR1_2229_TICK(t)
+# define BFI_FLINEAR1_2228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2227, v ds
+# define BFI_FLINEAR1_2228_TICK(t)
+# define BFI_FLINEAR1_2227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2226, v ds
+# define BFI_FLINEAR1_2227_TICK(t)
+# define BFI_FLINEAR1_2226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2225, v ds
+# define BFI_FLINEAR1_2226_TICK(t)
+# define BFI_FLINEAR1_2225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2224, v ds
+# define BFI_FLINEAR1_2225_TICK(t)
+# define BFI_FLINEAR1_2224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2223, v ds
+# define BFI_FLINEAR1_2224_TICK(t)
+# define BFI_FLINEAR1_2223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2222, v ds
+# define BFI_FLINEAR1_2223_TICK(t)
+# define BFI_FLINEAR1_2222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2221, v ds
+# define BFI_FLINEAR1_2222_TICK(t)
+# define BFI_FLINEAR1_2221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2220, v ds
+# define BFI_FLINEAR1_2221_TICK(t)
+# define BFI_FLINEAR1_2220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2219, v ds
+# define BFI_FLINEAR1_2220_TICK(t)
+# define BFI_FLINEAR1_2219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2218, v ds
+# define BFI_FLINEAR1_2219_TICK(t)
+# define BFI_FLINEAR1_2218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2217, v ds
+# define BFI_FLINEAR1_2218_TICK(t)
+# define BFI_FLINEAR1_2217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2216, v ds
+# define BFI_FLINEAR1_2217_TICK(t)
+# define BFI_FLINEAR1_2216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2215, v ds
+# define BFI_FLINEAR1_2216_TICK(t)
+# define BFI_FLINEAR1_2215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2214, v ds
+# define BFI_FLINEAR1_2215_TICK(t)
+# define BFI_FLINEAR1_2214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2213, v ds
+# define BFI_FLINEAR1_2214_TICK(t)
+# define BFI_FLINEAR1_2213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2212, v ds
+# define BFI_FLINEAR1_2213_TICK(t)
+# define BFI_FLINEAR1_2212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2211, v ds
+# define BFI_FLINEAR1_2212_TICK(t)
+# define BFI_FLINEAR1_2211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2210, v ds
+# define BFI_FLINEAR1_2211_TICK(t)
+# define BFI_FLINEAR1_2210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2209, v ds
+# define BFI_FLINEAR1_2210_TICK(t)
+# define BFI_FLINEAR1_2209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2208, v ds
+# define BFI_FLINEAR1_2209_TICK(t)
+# define BFI_FLINEAR1_2208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2207, v ds
+# define BFI_FLINEAR1_2208_TICK(t)
+# define BFI_FLINEAR1_2207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2206, v ds
+# define BFI_FLINEAR1_2207_TICK(t)
+# define BFI_FLINEAR1_2206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2205, v ds
+# define BFI_FLINEAR1_2206_TICK(t)
+# define BFI_FLINEAR1_2205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2204, v ds
+# define BFI_FLINEAR1_2205_TICK(t)
+# define BFI_FLINEAR1_2204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2203, v ds
+# define BFI_FLINEAR1_2204_TICK(t)
+# define BFI_FLINEAR1_2203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2202, v ds
+# define BFI_FLINEAR1_2203_TICK(t)
+# define BFI_FLINEAR1_2202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2201, v ds
+# define BFI_FLINEAR1_2202_TICK(t)
+# define BFI_FLINEAR1_2201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2200, v ds
+# define BFI_FLINEAR1_2201_TICK(t)
+# define BFI_FLINEAR1_2200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2199, v ds
+# define BFI_FLINEAR1_2200_TICK(t)
+# define BFI_FLINEAR1_2199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2198, v ds
+# define BFI_FLINEAR1_2199_TICK(t)
+# define BFI_FLINEAR1_2198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2197, v ds
+# define BFI_FLINEAR1_2198_TICK(t)
+# define BFI_FLINEAR1_2197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2196, v ds
+# define BFI_FLINEAR1_2197_TICK(t)
+# define BFI_FLINEAR1_2196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2195, v ds
+# define BFI_FLINEAR1_2196_TICK(t)
+# define BFI_FLINEAR1_2195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2194, v ds
+# define BFI_FLINEAR1_2195_TICK(t)
+# define BFI_FLINEAR1_2194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2193, v ds
+# define BFI_FLINEAR1_2194_TICK(t)
+# define BFI_FLINEAR1_2193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2192, v ds
+# define BFI_FLINEAR1_2193_TICK(t)
+# define BFI_FLINEAR1_2192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2191, v ds
+# define BFI_FLINEAR1_2192_TICK(t)
+# define BFI_FLINEAR1_2191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2190, v ds
+# define BFI_FLINEAR1_2191_TICK(t)
+# define BFI_FLINEAR1_2190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2189, v ds
+# define BFI_FLINEAR1_2190_TICK(t)
+# define BFI_FLINEAR1_2189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2188, v ds
+# define BFI_FLINEAR1_2189_TICK(t)
+# define BFI_FLINEAR1_2188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2187, v ds
+# define BFI_FLINEAR1_2188_TICK(t)
+# define BFI_FLINEAR1_2187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2186, v ds
+# define BFI_FLINEAR1_2187_TICK(t)
+# define BFI_FLINEAR1_2186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2185, v ds
+# define BFI_FLINEAR1_2186_TICK(t)
+# define BFI_FLINEAR1_2185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2184, v ds
+# define BFI_FLINEAR1_2185_TICK(t)
+# define BFI_FLINEAR1_2184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2183, v ds
+# define BFI_FLINEAR1_2184_TICK(t)
+# define BFI_FLINEAR1_2183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2182, v ds
+# define BFI_FLINEAR1_2183_TICK(t)
+# define BFI_FLINEAR1_2182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2181, v ds
+# define BFI_FLINEAR1_2182_TICK(t)
+# define BFI_FLINEAR1_2181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2180, v ds
+# define BFI_FLINEAR1_2181_TICK(t)
+# define BFI_FLINEAR1_2180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2179, v ds
+# define BFI_FLINEAR1_2180_TICK(t)
+# define BFI_FLINEAR1_2179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2178, v ds
+# define BFI_FLINEAR1_2179_TICK(t)
+# define BFI_FLINEAR1_2178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2177, v ds
+# define BFI_FLINEAR1_2178_TICK(t)
+# define BFI_FLINEAR1_2177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2176, v ds
+# define BFI_FLINEAR1_2177_TICK(t)
+# define BFI_FLINEAR1_2176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2175, v ds
+# define BFI_FLINEAR1_2176_TICK(t)
+# define BFI_FLINEAR1_2175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2174, v ds
+# define BFI_FLINEAR1_2175_TICK(t)
+# define BFI_FLINEAR1_2174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2173, v ds
+# define BFI_FLINEAR1_2174_TICK(t)
+# define BFI_FLINEAR1_2173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2172, v ds
+# define BFI_FLINEAR1_2173_TICK(t)
+# define BFI_FLINEAR1_2172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2171, v ds
+# define BFI_FLINEAR1_2172_TICK(t)
+# define BFI_FLINEAR1_2171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2170, v ds
+# define BFI_FLINEAR1_2171_TICK(t)
+# define BFI_FLINEAR1_2170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2169, v ds
+# define BFI_FLINEAR1_2170_TICK(t)
+# define BFI_FLINEAR1_2169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2168, v ds
+# define BFI_FLINEAR1_2169_TICK(t)
+# define BFI_FLINEAR1_2168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2167, v ds
+# define BFI_FLINEAR1_2168_TICK(t)
+# define BFI_FLINEAR1_2167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2166, v ds
+# define BFI_FLINEAR1_2167_TICK(t)
+# define BFI_FLINEAR1_2166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2165, v ds
+# define BFI_FLINEAR1_2166_TICK(t)
+# define BFI_FLINEAR1_2165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2164, v ds
+# define BFI_FLINEAR1_2165_TICK(t)
+# define BFI_FLINEAR1_2164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2163, v ds
+# define BFI_FLINEAR1_2164_TICK(t)
+# define BFI_FLINEAR1_2163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2162, v ds
+# define BFI_FLINEAR1_2163_TICK(t)
+# define BFI_FLINEAR1_2162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2161, v ds
+# define BFI_FLINEAR1_2162_TICK(t)
+# define BFI_FLINEAR1_2161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2160, v ds
+# define BFI_FLINEAR1_2161_TICK(t)
+# define BFI_FLINEAR1_2160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2159, v ds
+# define BFI_FLINEAR1_2160_TICK(t)
+# define BFI_FLINEAR1_2159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2158, v ds
+# define BFI_FLINEAR1_2159_TICK(t)
+# define BFI_FLINEAR1_2158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2157, v ds
+# define BFI_FLINEAR1_2158_TICK(t)
+# define BFI_FLINEAR1_2157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2156, v ds
+# define BFI_FLINEAR1_2157_TICK(t)
+# define BFI_FLINEAR1_2156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2155, v ds
+# define BFI_FLINEAR1_2156_TICK(t)
+# define BFI_FLINEAR1_2155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2154, v ds
+# define BFI_FLINEAR1_2155_TICK(t)
+# define BFI_FLINEAR1_2154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2153, v ds
+# define BFI_FLINEAR1_2154_TICK(t)
+# define BFI_FLINEAR1_2153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2152, v ds
+# define BFI_FLINEAR1_2153_TICK(t)
+# define BFI_FLINEAR1_2152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2151, v ds
+# define BFI_FLINEAR1_2152_TICK(t)
+# define BFI_FLINEAR1_2151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2150, v ds
+# define BFI_FLINEAR1_2151_TICK(t)
+# define BFI_FLINEAR1_2150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2149, v ds
+# define BFI_FLINEAR1_2150_TICK(t)
+# define BFI_FLINEAR1_2149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2148, v ds
+# define BFI_FLINEAR1_2149_TICK(t)
+# define BFI_FLINEAR1_2148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2147, v ds
+# define BFI_FLINEAR1_2148_TICK(t)
+# define BFI_FLINEAR1_2147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2146, v ds
+# define BFI_FLINEAR1_2147_TICK(t)
+# define BFI_FLINEAR1_2146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2145, v ds
+# define BFI_FLINEAR1_2146_TICK(t)
+# define BFI_FLINEAR1_2145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2144, v ds
+# define BFI_FLINEAR1_2145_TICK(t)
+# define BFI_FLINEAR1_2144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2143, v ds
+# define BFI_FLINEAR1_2144_TICK(t)
+# define BFI_FLINEAR1_2143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2142, v ds
+# define BFI_FLINEAR1_2143_TICK(t)
+# define BFI_FLINEAR1_2142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2141, v ds
+# define BFI_FLINEAR1_2142_TICK(t)
+# define BFI_FLINEAR1_2141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2140, v ds
+# define BFI_FLINEAR1_2141_TICK(t)
+# define BFI_FLINEAR1_2140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2139, v ds
+# define BFI_FLINEAR1_2140_TICK(t)
+# define BFI_FLINEAR1_2139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2138, v ds
+# define BFI_FLINEAR1_2139_TICK(t)
+# define BFI_FLINEAR1_2138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2137, v ds
+# define BFI_FLINEAR1_2138_TICK(t)
+# define BFI_FLINEAR1_2137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2136, v ds
+# define BFI_FLINEAR1_2137_TICK(t)
+# define BFI_FLINEAR1_2136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2135, v ds
+# define BFI_FLINEAR1_2136_TICK(t)
+# define BFI_FLINEAR1_2135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2134, v ds
+# define BFI_FLINEAR1_2135_TICK(t)
+# define BFI_FLINEAR1_2134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2133, v ds
+# define BFI_FLINEAR1_2134_TICK(t)
+# define BFI_FLINEAR1_2133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2132, v ds
+# define BFI_FLINEAR1_2133_TICK(t)
+# define BFI_FLINEAR1_2132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2131, v ds
+# define BFI_FLINEAR1_2132_TICK(t)
+# define BFI_FLINEAR1_2131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2130, v ds
+# define BFI_FLINEAR1_2131_TICK(t)
+# define BFI_FLINEAR1_2130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2129, v ds
+# define BFI_FLINEAR1_2130_TICK(t)
+# define BFI_FLINEAR1_2129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2128, v ds
+# define BFI_FLINEAR1_2129_TICK(t)
+# define BFI_FLINEAR1_2128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2127, v ds
+# define BFI_FLINEAR1_2128_TICK(t)
+# define BFI_FLINEAR1_2127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2126, v ds
+# define BFI_FLINEAR1_2127_TICK(t)
+# define BFI_FLINEAR1_2126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2125, v ds
+# define BFI_FLINEAR1_2126_TICK(t)
+# define BFI_FLINEAR1_2125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2124, v ds
+# define BFI_FLINEAR1_2125_TICK(t)
+# define BFI_FLINEAR1_2124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2123, v ds
+# define BFI_FLINEAR1_2124_TICK(t)
+# define BFI_FLINEAR1_2123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2122, v ds
+# define BFI_FLINEAR1_2123_TICK(t)
+# define BFI_FLINEAR1_2122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2121, v ds
+# define BFI_FLINEAR1_2122_TICK(t)
+# define BFI_FLINEAR1_2121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2120, v ds
+# define BFI_FLINEAR1_2121_TICK(t)
+# define BFI_FLINEAR1_2120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2119, v ds
+# define BFI_FLINEAR1_2120_TICK(t)
+# define BFI_FLINEAR1_2119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2118, v ds
+# define BFI_FLINEAR1_2119_TICK(t)
+# define BFI_FLINEAR1_2118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2117, v ds
+# define BFI_FLINEAR1_2118_TICK(t)
+# define BFI_FLINEAR1_2117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2116, v ds
+# define BFI_FLINEAR1_2117_TICK(t)
+# define BFI_FLINEAR1_2116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2115, v ds
+# define BFI_FLINEAR1_2116_TICK(t)
+# define BFI_FLINEAR1_2115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2114, v ds
+# define BFI_FLINEAR1_2115_TICK(t)
+# define BFI_FLINEAR1_2114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2113, v ds
+# define BFI_FLINEAR1_2114_TICK(t)
+# define BFI_FLINEAR1_2113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2112, v ds
+# define BFI_FLINEAR1_2113_TICK(t)
+# define BFI_FLINEAR1_2112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2111, v ds
+# define BFI_FLINEAR1_2112_TICK(t)
+# define BFI_FLINEAR1_2111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2110, v ds
+# define BFI_FLINEAR1_2111_TICK(t)
+# define BFI_FLINEAR1_2110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2109, v ds
+# define BFI_FLINEAR1_2110_TICK(t)
+# define BFI_FLINEAR1_2109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2108, v ds
+# define BFI_FLINEAR1_2109_TICK(t)
+# define BFI_FLINEAR1_2108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2107, v ds
+# define BFI_FLINEAR1_2108_TICK(t)
+# define BFI_FLINEAR1_2107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2106, v ds
+# define BFI_FLINEAR1_2107_TICK(t)
+# define BFI_FLINEAR1_2106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2105, v ds
+# define BFI_FLINEAR1_2106_TICK(t)
+# define BFI_FLINEAR1_2105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2104, v ds
+# define BFI_FLINEAR1_2105_TICK(t)
+# define BFI_FLINEAR1_2104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2103, v ds
+# define BFI_FLINEAR1_2104_TICK(t)
+# define BFI_FLINEAR1_2103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2102, v ds
+# define BFI_FLINEAR1_2103_TICK(t)
+# define BFI_FLINEAR1_2102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2101, v ds
+# define BFI_FLINEAR1_2102_TICK(t)
+# define BFI_FLINEAR1_2101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2100, v ds
+# define BFI_FLINEAR1_2101_TICK(t)
+# define BFI_FLINEAR1_2100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2099, v ds
+# define BFI_FLINEAR1_2100_TICK(t)
+# define BFI_FLINEAR1_2099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2098, v ds
+# define BFI_FLINEAR1_2099_TICK(t)
+# define BFI_FLINEAR1_2098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2097, v ds
+# define BFI_FLINEAR1_2098_TICK(t)
+# define BFI_FLINEAR1_2097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2096, v ds
+# define BFI_FLINEAR1_2097_TICK(t)
+# define BFI_FLINEAR1_2096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2095, v ds
+# define BFI_FLINEAR1_2096_TICK(t)
+# define BFI_FLINEAR1_2095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2094, v ds
+# define BFI_FLINEAR1_2095_TICK(t)
+# define BFI_FLINEAR1_2094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2093, v ds
+# define BFI_FLINEAR1_2094_TICK(t)
+# define BFI_FLINEAR1_2093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2092, v ds
+# define BFI_FLINEAR1_2093_TICK(t)
+# define BFI_FLINEAR1_2092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2091, v ds
+# define BFI_FLINEAR1_2092_TICK(t)
+# define BFI_FLINEAR1_2091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2090, v ds
+# define BFI_FLINEAR1_2091_TICK(t)
+# define BFI_FLINEAR1_2090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2089, v ds
+# define BFI_FLINEAR1_2090_TICK(t)
+# define BFI_FLINEAR1_2089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2088, v ds
+# define BFI_FLINEAR1_2089_TICK(t)
+# define BFI_FLINEAR1_2088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2087, v ds
+# define BFI_FLINEAR1_2088_TICK(t)
+# define BFI_FLINEAR1_2087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2086, v ds
+# define BFI_FLINEAR1_2087_TICK(t)
+# define BFI_FLINEAR1_2086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2085, v ds
+# define BFI_FLINEAR1_2086_TICK(t)
+# define BFI_FLINEAR1_2085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2084, v ds
+# define BFI_FLINEAR1_2085_TICK(t)
+# define BFI_FLINEAR1_2084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2083, v ds
+# define BFI_FLINEAR1_2084_TICK(t)
+# define BFI_FLINEAR1_2083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2082, v ds
+# define BFI_FLINEAR1_2083_TICK(t)
+# define BFI_FLINEAR1_2082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2081, v ds
+# define BFI_FLINEAR1_2082_TICK(t)
+# define BFI_FLINEAR1_2081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2080, v ds
+# define BFI_FLINEAR1_2081_TICK(t)
+# define BFI_FLINEAR1_2080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2079, v ds
+# define BFI_FLINEAR1_2080_TICK(t)
+# define BFI_FLINEAR1_2079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2078, v ds
+# define BFI_FLINEAR1_2079_TICK(t)
+# define BFI_FLINEAR1_2078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2077, v ds
+# define BFI_FLINEAR1_2078_TICK(t)
+# define BFI_FLINEAR1_2077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2076, v ds
+# define BFI_FLINEAR1_2077_TICK(t)
+# define BFI_FLINEAR1_2076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2075, v ds
+# define BFI_FLINEAR1_2076_TICK(t)
+# define BFI_FLINEAR1_2075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2074, v ds
+# define BFI_FLINEAR1_2075_TICK(t)
+# define BFI_FLINEAR1_2074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2073, v ds
+# define BFI_FLINEAR1_2074_TICK(t)
+# define BFI_FLINEAR1_2073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2072, v ds
+# define BFI_FLINEAR1_2073_TICK(t)
+# define BFI_FLINEAR1_2072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2071, v ds
+# define BFI_FLINEAR1_2072_TICK(t)
+# define BFI_FLINEAR1_2071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2070, v ds
+# define BFI_FLINEAR1_2071_TICK(t)
+# define BFI_FLINEAR1_2070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2069, v ds
+# define BFI_FLINEAR1_2070_TICK(t)
+# define BFI_FLINEAR1_2069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2068, v ds
+# define BFI_FLINEAR1_2069_TICK(t)
+# define BFI_FLINEAR1_2068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2067, v ds
+# define BFI_FLINEAR1_2068_TICK(t)
+# define BFI_FLINEAR1_2067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2066, v ds
+# define BFI_FLINEAR1_2067_TICK(t)
+# define BFI_FLINEAR1_2066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2065, v ds
+# define BFI_FLINEAR1_2066_TICK(t)
+# define BFI_FLINEAR1_2065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2064, v ds
+# define BFI_FLINEAR1_2065_TICK(t)
+# define BFI_FLINEAR1_2064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2063, v ds
+# define BFI_FLINEAR1_2064_TICK(t)
+# define BFI_FLINEAR1_2063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2062, v ds
+# define BFI_FLINEAR1_2063_TICK(t)
+# define BFI_FLINEAR1_2062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2061, v ds
+# define BFI_FLINEAR1_2062_TICK(t)
+# define BFI_FLINEAR1_2061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2060, v ds
+# define BFI_FLINEAR1_2061_TICK(t)
+# define BFI_FLINEAR1_2060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2059, v ds
+# define BFI_FLINEAR1_2060_TICK(t)
+# define BFI_FLINEAR1_2059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2058, v ds
+# define BFI_FLINEAR1_2059_TICK(t)
+# define BFI_FLINEAR1_2058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2057, v ds
+# define BFI_FLINEAR1_2058_TICK(t)
+# define BFI_FLINEAR1_2057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2056, v ds
+# define BFI_FLINEAR1_2057_TICK(t)
+# define BFI_FLINEAR1_2056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2055, v ds
+# define BFI_FLINEAR1_2056_TICK(t)
+# define BFI_FLINEAR1_2055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2054, v ds
+# define BFI_FLINEAR1_2055_TICK(t)
+# define BFI_FLINEAR1_2054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2053, v ds
+# define BFI_FLINEAR1_2054_TICK(t)
+# define BFI_FLINEAR1_2053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2052, v ds
+# define BFI_FLINEAR1_2053_TICK(t)
+# define BFI_FLINEAR1_2052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2051, v ds
+# define BFI_FLINEAR1_2052_TICK(t)
+# define BFI_FLINEAR1_2051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2050, v ds
+# define BFI_FLINEAR1_2051_TICK(t)
+# define BFI_FLINEAR1_2050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2049, v ds
+# define BFI_FLINEAR1_2050_TICK(t)
+# define BFI_FLINEAR1_2049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2048, v ds
+# define BFI_FLINEAR1_2049_TICK(t)
+# define BFI_FLINEAR1_2048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2047, v ds
+# define BFI_FLINEAR1_2048_TICK(t)
+# define BFI_FLINEAR1_2047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2046, v ds
+# define BFI_FLINEAR1_2047_TICK(t)
+# define BFI_FLINEAR1_2046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2045, v ds
+# define BFI_FLINEAR1_2046_TICK(t)
+# define BFI_FLINEAR1_2045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2044, v ds
+# define BFI_FLINEAR1_2045_TICK(t)
+# define BFI_FLINEAR1_2044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2043, v ds
+# define BFI_FLINEAR1_2044_TICK(t)
+# define BFI_FLINEAR1_2043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2042, v ds
+# define BFI_FLINEAR1_2043_TICK(t)
+# define BFI_FLINEAR1_2042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2041, v ds
+# define BFI_FLINEAR1_2042_TICK(t)
+# define BFI_FLINEAR1_2041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2040, v ds
+# define BFI_FLINEAR1_2041_TICK(t)
+# define BFI_FLINEAR1_2040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2039, v ds
+# define BFI_FLINEAR1_2040_TICK(t)
+# define BFI_FLINEAR1_2039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2038, v ds
+# define BFI_FLINEAR1_2039_TICK(t)
+# define BFI_FLINEAR1_2038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2037, v ds
+# define BFI_FLINEAR1_2038_TICK(t)
+# define BFI_FLINEAR1_2037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2036, v ds
+# define BFI_FLINEAR1_2037_TICK(t)
+# define BFI_FLINEAR1_2036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2035, v ds
+# define BFI_FLINEAR1_2036_TICK(t)
+# define BFI_FLINEAR1_2035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2034, v ds
+# define BFI_FLINEAR1_2035_TICK(t)
+# define BFI_FLINEAR1_2034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2033, v ds
+# define BFI_FLINEAR1_2034_TICK(t)
+# define BFI_FLINEAR1_2033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2032, v ds
+# define BFI_FLINEAR1_2033_TICK(t)
+# define BFI_FLINEAR1_2032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2031, v ds
+# define BFI_FLINEAR1_2032_TICK(t)
+# define BFI_FLINEAR1_2031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2030, v ds
+# define BFI_FLINEAR1_2031_TICK(t)
+# define BFI_FLINEAR1_2030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2029, v ds
+# define BFI_FLINEAR1_2030_TICK(t)
+# define BFI_FLINEAR1_2029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2028, v ds
+# define BFI_FLINEAR1_2029_TICK(t)
+# define BFI_FLINEAR1_2028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2027, v ds
+# define BFI_FLINEAR1_2028_TICK(t)
+# define BFI_FLINEAR1_2027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2026, v ds
+# define BFI_FLINEAR1_2027_TICK(t)
+# define BFI_FLINEAR1_2026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2025, v ds
+# define BFI_FLINEAR1_2026_TICK(t)
+# define BFI_FLINEAR1_2025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2024, v ds
+# define BFI_FLINEAR1_2025_TICK(t)
+# define BFI_FLINEAR1_2024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2023, v ds
+# define BFI_FLINEAR1_2024_TICK(t)
+# define BFI_FLINEAR1_2023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2022, v ds
+# define BFI_FLINEAR1_2023_TICK(t)
+# define BFI_FLINEAR1_2022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2021, v ds
+# define BFI_FLINEAR1_2022_TICK(t)
+# define BFI_FLINEAR1_2021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2020, v ds
+# define BFI_FLINEAR1_2021_TICK(t)
+# define BFI_FLINEAR1_2020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2019, v ds
+# define BFI_FLINEAR1_2020_TICK(t)
+# define BFI_FLINEAR1_2019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2018, v ds
+# define BFI_FLINEAR1_2019_TICK(t)
+# define BFI_FLINEAR1_2018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2017, v ds
+# define BFI_FLINEAR1_2018_TICK(t)
+# define BFI_FLINEAR1_2017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2016, v ds
+# define BFI_FLINEAR1_2017_TICK(t)
+# define BFI_FLINEAR1_2016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2015, v ds
+# define BFI_FLINEAR1_2016_TICK(t)
+# define BFI_FLINEAR1_2015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2014, v ds
+# define BFI_FLINEAR1_2015_TICK(t)
+# define BFI_FLINEAR1_2014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2013, v ds
+# define BFI_FLINEAR1_2014_TICK(t)
+# define BFI_FLINEAR1_2013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2012, v ds
+# define BFI_FLINEAR1_2013_TICK(t)
+# define BFI_FLINEAR1_2012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2011, v ds
+# define BFI_FLINEAR1_2012_TICK(t)
+# define BFI_FLINEAR1_2011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2010, v ds
+# define BFI_FLINEAR1_2011_TICK(t)
+# define BFI_FLINEAR1_2010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2009, v ds
+# define BFI_FLINEAR1_2010_TICK(t)
+# define BFI_FLINEAR1_2009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2008, v ds
+# define BFI_FLINEAR1_2009_TICK(t)
+# define BFI_FLINEAR1_2008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2007, v ds
+# define BFI_FLINEAR1_2008_TICK(t)
+# define BFI_FLINEAR1_2007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2006, v ds
+# define BFI_FLINEAR1_2007_TICK(t)
+# define BFI_FLINEAR1_2006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2005, v ds
+# define BFI_FLINEAR1_2006_TICK(t)
+# define BFI_FLINEAR1_2005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2004, v ds
+# define BFI_FLINEAR1_2005_TICK(t)
+# define BFI_FLINEAR1_2004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2003, v ds
+# define BFI_FLINEAR1_2004_TICK(t)
+# define BFI_FLINEAR1_2003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2002, v ds
+# define BFI_FLINEAR1_2003_TICK(t)
+# define BFI_FLINEAR1_2002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2001, v ds
+# define BFI_FLINEAR1_2002_TICK(t)
+# define BFI_FLINEAR1_2001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2000, v ds
+# define BFI_FLINEAR1_2001_TICK(t)
+# define BFI_FLINEAR1_2000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1999, v ds
+# define BFI_FLINEAR1_2000_TICK(t)
+# define BFI_FLINEAR1_1999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1998, v ds
+# define BFI_FLINEAR1_1999_TICK(t)
+# define BFI_FLINEAR1_1998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1997, v ds
+# define BFI_FLINEAR1_1998_TICK(t)
+# define BFI_FLINEAR1_1997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1996, v ds
+# define BFI_FLINEAR1_1997_TICK(t)
+# define BFI_FLINEAR1_1996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1995, v ds
+# define BFI_FLINEAR1_1996_TICK(t)
+# define BFI_FLINEAR1_1995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1994, v ds
+# define BFI_FLINEAR1_1995_TICK(t)
+# define BFI_FLINEAR1_1994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1993, v ds
+# define BFI_FLINEAR1_1994_TICK(t)
+# define BFI_FLINEAR1_1993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1992, v ds
+# define BFI_FLINEAR1_1993_TICK(t)
+# define BFI_FLINEAR1_1992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1991, v ds
+# define BFI_FLINEAR1_1992_TICK(t)
+# define BFI_FLINEAR1_1991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1990, v ds
+# define BFI_FLINEAR1_1991_TICK(t)
+# define BFI_FLINEAR1_1990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1989, v ds
+# define BFI_FLINEAR1_1990_TICK(t)
+# define BFI_FLINEAR1_1989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1988, v ds
+# define BFI_FLINEAR1_1989_TICK(t)
+# define BFI_FLINEAR1_1988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1987, v ds
+# define BFI_FLINEAR1_1988_TICK(t)
+# define BFI_FLINEAR1_1987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1986, v ds
+# define BFI_FLINEAR1_1987_TICK(t)
+# define BFI_FLINEAR1_1986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1985, v ds
+# define BFI_FLINEAR1_1986_TICK(t)
+# define BFI_FLINEAR1_1985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1984, v ds
+# define BFI_FLINEAR1_1985_TICK(t)
+# define BFI_FLINEAR1_1984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1983, v ds
+# define BFI_FLINEAR1_1984_TICK(t)
+# define BFI_FLINEAR1_1983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1982, v ds
+# define BFI_FLINEAR1_1983_TICK(t)
+# define BFI_FLINEAR1_1982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1981, v ds
+# define BFI_FLINEAR1_1982_TICK(t)
+# define BFI_FLINEAR1_1981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1980, v ds
+# define BFI_FLINEAR1_1981_TICK(t)
+# define BFI_FLINEAR1_1980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1979, v ds
+# define BFI_FLINEAR1_1980_TICK(t)
+# define BFI_FLINEAR1_1979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1978, v ds
+# define BFI_FLINEAR1_1979_TICK(t)
+# define BFI_FLINEAR1_1978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1977, v ds
+# define BFI_FLINEAR1_1978_TICK(t)
+# define BFI_FLINEAR1_1977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1976, v ds
+# define BFI_FLINEAR1_1977_TICK(t)
+# define BFI_FLINEAR1_1976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1975, v ds
+# define BFI_FLINEAR1_1976_TICK(t)
+# define BFI_FLINEAR1_1975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1974, v ds
+# define BFI_FLINEAR1_1975_TICK(t)
+# define BFI_FLINEAR1_1974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1973, v ds
+# define BFI_FLINEAR1_1974_TICK(t)
+# define BFI_FLINEAR1_1973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1972, v ds
+# define BFI_FLINEAR1_1973_TICK(t)
+# define BFI_FLINEAR1_1972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1971, v ds
+# define BFI_FLINEAR1_1972_TICK(t)
+# define BFI_FLINEAR1_1971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1970, v ds
+# define BFI_FLINEAR1_1971_TICK(t)
+# define BFI_FLINEAR1_1970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1969, v ds
+# define BFI_FLINEAR1_1970_TICK(t)
+# define BFI_FLINEAR1_1969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1968, v ds
+# define BFI_FLINEAR1_1969_TICK(t)
+# define BFI_FLINEAR1_1968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1967, v ds
+# define BFI_FLINEAR1_1968_TICK(t)
+# define BFI_FLINEAR1_1967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1966, v ds
+# define BFI_FLINEAR1_1967_TICK(t)
+# define BFI_FLINEAR1_1966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1965, v ds
+# define BFI_FLINEAR1_1966_TICK(t)
+# define BFI_FLINEAR1_1965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1964, v ds
+# define BFI_FLINEAR1_1965_TICK(t)
+# define BFI_FLINEAR1_1964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1963, v ds
+# define BFI_FLINEAR1_1964_TICK(t)
+# define BFI_FLINEAR1_1963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1962, v ds
+# define BFI_FLINEAR1_1963_TICK(t)
+# define BFI_FLINEAR1_1962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1961, v ds
+# define BFI_FLINEAR1_1962_TICK(t)
+# define BFI_FLINEAR1_1961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1960, v ds
+# define BFI_FLINEAR1_1961_TICK(t)
+# define BFI_FLINEAR1_1960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1959, v ds
+# define BFI_FLINEAR1_1960_TICK(t)
+# define BFI_FLINEAR1_1959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1958, v ds
+# define BFI_FLINEAR1_1959_TICK(t)
+# define BFI_FLINEAR1_1958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1957, v ds
+# define BFI_FLINEAR1_1958_TICK(t)
+# define BFI_FLINEAR1_1957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1956, v ds
+# define BFI_FLINEAR1_1957_TICK(t)
+# define BFI_FLINEAR1_1956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1955, v ds
+# define BFI_FLINEAR1_1956_TICK(t)
+# define BFI_FLINEAR1_1955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1954, v ds
+# define BFI_FLINEAR1_1955_TICK(t)
+# define BFI_FLINEAR1_1954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1953, v ds
+# define BFI_FLINEAR1_1954_TICK(t)
+# define BFI_FLINEAR1_1953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1952, v ds
+# define BFI_FLINEAR1_1953_TICK(t)
+# define BFI_FLINEAR1_1952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1951, v ds
+# define BFI_FLINEAR1_1952_TICK(t)
+# define BFI_FLINEAR1_1951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1950, v ds
+# define BFI_FLINEAR1_1951_TICK(t)
+# define BFI_FLINEAR1_1950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1949, v ds
+# define BFI_FLINEAR1_1950_TICK(t)
+# define BFI_FLINEAR1_1949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1948, v ds
+# define BFI_FLINEAR1_1949_TICK(t)
+# define BFI_FLINEAR1_1948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1947, v ds
+# define BFI_FLINEAR1_1948_TICK(t)
+# define BFI_FLINEAR1_1947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1946, v ds
+# define BFI_FLINEAR1_1947_TICK(t)
+# define BFI_FLINEAR1_1946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1945, v ds
+# define BFI_FLINEAR1_1946_TICK(t)
+# define BFI_FLINEAR1_1945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1944, v ds
+# define BFI_FLINEAR1_1945_TICK(t)
+# define BFI_FLINEAR1_1944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1943, v ds
+# define BFI_FLINEAR1_1944_TICK(t)
+# define BFI_FLINEAR1_1943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1942, v ds
+# define BFI_FLINEAR1_1943_TICK(t)
+# define BFI_FLINEAR1_1942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1941, v ds
+# define BFI_FLINEAR1_1942_TICK(t)
+# define BFI_FLINEAR1_1941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1940, v ds
+# define BFI_FLINEAR1_1941_TICK(t)
+# define BFI_FLINEAR1_1940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1939, v ds
+# define BFI_FLINEAR1_1940_TICK(t)
+# define BFI_FLINEAR1_1939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1938, v ds
+# define BFI_FLINEAR1_1939_TICK(t)
+# define BFI_FLINEAR1_1938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1937, v ds
+# define BFI_FLINEAR1_1938_TICK(t)
+# define BFI_FLINEAR1_1937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1936, v ds
+# define BFI_FLINEAR1_1937_TICK(t)
+# define BFI_FLINEAR1_1936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1935, v ds
+# define BFI_FLINEAR1_1936_TICK(t)
+# define BFI_FLINEAR1_1935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1934, v ds
+# define BFI_FLINEAR1_1935_TICK(t)
+# define BFI_FLINEAR1_1934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1933, v ds
+# define BFI_FLINEAR1_1934_TICK(t)
+# define BFI_FLINEAR1_1933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1932, v ds
+# define BFI_FLINEAR1_1933_TICK(t)
+# define BFI_FLINEAR1_1932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1931, v ds
+# define BFI_FLINEAR1_1932_TICK(t)
+# define BFI_FLINEAR1_1931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1930, v ds
+# define BFI_FLINEAR1_1931_TICK(t)
+# define BFI_FLINEAR1_1930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1929, v ds
+# define BFI_FLINEAR1_1930_TICK(t)
+# define BFI_FLINEAR1_1929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1928, v ds
+# define BFI_FLINEAR1_1929_TICK(t)
+# define BFI_FLINEAR1_1928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1927, v ds
+# define BFI_FLINEAR1_1928_TICK(t)
+# define BFI_FLINEAR1_1927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1926, v ds
+# define BFI_FLINEAR1_1927_TICK(t)
+# define BFI_FLINEAR1_1926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1925, v ds
+# define BFI_FLINEAR1_1926_TICK(t)
+# define BFI_FLINEAR1_1925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1924, v ds
+# define BFI_FLINEAR1_1925_TICK(t)
+# define BFI_FLINEAR1_1924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1923, v ds
+# define BFI_FLINEAR1_1924_TICK(t)
+# define BFI_FLINEAR1_1923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1922, v ds
+# define BFI_FLINEAR1_1923_TICK(t)
+# define BFI_FLINEAR1_1922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1921, v ds
+# define BFI_FLINEAR1_1922_TICK(t)
+# define BFI_FLINEAR1_1921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1920, v ds
+# define BFI_FLINEAR1_1921_TICK(t)
+# define BFI_FLINEAR1_1920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1919, v ds
+# define BFI_FLINEAR1_1920_TICK(t)
+# define BFI_FLINEAR1_1919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1918, v ds
+# define BFI_FLINEAR1_1919_TICK(t)
+# define BFI_FLINEAR1_1918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1917, v ds
+# define BFI_FLINEAR1_1918_TICK(t)
+# define BFI_FLINEAR1_1917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1916, v ds
+# define BFI_FLINEAR1_1917_TICK(t)
+# define BFI_FLINEAR1_1916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1915, v ds
+# define BFI_FLINEAR1_1916_TICK(t)
+# define BFI_FLINEAR1_1915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1914, v ds
+# define BFI_FLINEAR1_1915_TICK(t)
+# define BFI_FLINEAR1_1914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1913, v ds
+# define BFI_FLINEAR1_1914_TICK(t)
+# define BFI_FLINEAR1_1913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1912, v ds
+# define BFI_FLINEAR1_1913_TICK(t)
+# define BFI_FLINEAR1_1912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1911, v ds
+# define BFI_FLINEAR1_1912_TICK(t)
+# define BFI_FLINEAR1_1911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1910, v ds
+# define BFI_FLINEAR1_1911_TICK(t)
+# define BFI_FLINEAR1_1910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1909, v ds
+# define BFI_FLINEAR1_1910_TICK(t)
+# define BFI_FLINEAR1_1909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1908, v ds
+# define BFI_FLINEAR1_1909_TICK(t)
+# define BFI_FLINEAR1_1908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1907, v ds
+# define BFI_FLINEAR1_1908_TICK(t)
+# define BFI_FLINEAR1_1907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1906, v ds
+# define BFI_FLINEAR1_1907_TICK(t)
+# define BFI_FLINEAR1_1906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1905, v ds
+# define BFI_FLINEAR1_1906_TICK(t)
+# define BFI_FLINEAR1_1905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1904, v ds
+# define BFI_FLINEAR1_1905_TICK(t)
+# define BFI_FLINEAR1_1904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1903, v ds
+# define BFI_FLINEAR1_1904_TICK(t)
+# define BFI_FLINEAR1_1903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1902, v ds
+# define BFI_FLINEAR1_1903_TICK(t)
+# define BFI_FLINEAR1_1902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1901, v ds
+# define BFI_FLINEAR1_1902_TICK(t)
+# define BFI_FLINEAR1_1901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1900, v ds
+# define BFI_FLINEAR1_1901_TICK(t)
+# define BFI_FLINEAR1_1900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1899, v ds
+# define BFI_FLINEAR1_1900_TICK(t)
+# define BFI_FLINEAR1_1899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1898, v ds
+# define BFI_FLINEAR1_1899_TICK(t)
+# define BFI_FLINEAR1_1898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1897, v ds
+# define BFI_FLINEAR1_1898_TICK(t)
+# define BFI_FLINEAR1_1897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1896, v ds
+# define BFI_FLINEAR1_1897_TICK(t)
+# define BFI_FLINEAR1_1896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1895, v ds
+# define BFI_FLINEAR1_1896_TICK(t)
+# define BFI_FLINEAR1_1895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1894, v ds
+# define BFI_FLINEAR1_1895_TICK(t)
+# define BFI_FLINEAR1_1894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1893, v ds
+# define BFI_FLINEAR1_1894_TICK(t)
+# define BFI_FLINEAR1_1893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1892, v ds
+# define BFI_FLINEAR1_1893_TICK(t)
+# define BFI_FLINEAR1_1892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1891, v ds
+# define BFI_FLINEAR1_1892_TICK(t)
+# define BFI_FLINEAR1_1891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1890, v ds
+# define BFI_FLINEAR1_1891_TICK(t)
+# define BFI_FLINEAR1_1890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1889, v ds
+# define BFI_FLINEAR1_1890_TICK(t)
+# define BFI_FLINEAR1_1889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1888, v ds
+# define BFI_FLINEAR1_1889_TICK(t)
+# define BFI_FLINEAR1_1888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1887, v ds
+# define BFI_FLINEAR1_1888_TICK(t)
+# define BFI_FLINEAR1_1887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1886, v ds
+# define BFI_FLINEAR1_1887_TICK(t)
+# define BFI_FLINEAR1_1886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1885, v ds
+# define BFI_FLINEAR1_1886_TICK(t)
+# define BFI_FLINEAR1_1885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1884, v ds
+# define BFI_FLINEAR1_1885_TICK(t)
+# define BFI_FLINEAR1_1884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1883, v ds
+# define BFI_FLINEAR1_1884_TICK(t)
+# define BFI_FLINEAR1_1883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1882, v ds
+# define BFI_FLINEAR1_1883_TICK(t)
+# define BFI_FLINEAR1_1882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1881, v ds
+# define BFI_FLINEAR1_1882_TICK(t)
+# define BFI_FLINEAR1_1881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1880, v ds
+# define BFI_FLINEAR1_1881_TICK(t)
+# define BFI_FLINEAR1_1880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1879, v ds
+# define BFI_FLINEAR1_1880_TICK(t)
+# define BFI_FLINEAR1_1879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1878, v ds
+# define BFI_FLINEAR1_1879_TICK(t)
+# define BFI_FLINEAR1_1878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1877, v ds
+# define BFI_FLINEAR1_1878_TICK(t)
+# define BFI_FLINEAR1_1877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1876, v ds
+# define BFI_FLINEAR1_1877_TICK(t)
+# define BFI_FLINEAR1_1876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1875, v ds
+# define BFI_FLINEAR1_1876_TICK(t)
+# define BFI_FLINEAR1_1875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1874, v ds
+# define BFI_FLINEAR1_1875_TICK(t)
+# define BFI_FLINEAR1_1874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1873, v ds
+# define BFI_FLINEAR1_1874_TICK(t)
+# define BFI_FLINEAR1_1873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1872, v ds
+# define BFI_FLINEAR1_1873_TICK(t)
+# define BFI_FLINEAR1_1872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1871, v ds
+# define BFI_FLINEAR1_1872_TICK(t)
+# define BFI_FLINEAR1_1871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1870, v ds
+# define BFI_FLINEAR1_1871_TICK(t)
+# define BFI_FLINEAR1_1870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1869, v ds
+# define BFI_FLINEAR1_1870_TICK(t)
+# define BFI_FLINEAR1_1869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1868, v ds
+# define BFI_FLINEAR1_1869_TICK(t)
+# define BFI_FLINEAR1_1868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1867, v ds
+# define BFI_FLINEAR1_1868_TICK(t)
+# define BFI_FLINEAR1_1867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1866, v ds
+# define BFI_FLINEAR1_1867_TICK(t)
+# define BFI_FLINEAR1_1866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1865, v ds
+# define BFI_FLINEAR1_1866_TICK(t)
+# define BFI_FLINEAR1_1865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1864, v ds
+# define BFI_FLINEAR1_1865_TICK(t)
+# define BFI_FLINEAR1_1864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1863, v ds
+# define BFI_FLINEAR1_1864_TICK(t)
+# define BFI_FLINEAR1_1863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1862, v ds
+# define BFI_FLINEAR1_1863_TICK(t)
+# define BFI_FLINEAR1_1862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1861, v ds
+# define BFI_FLINEAR1_1862_TICK(t)
+# define BFI_FLINEAR1_1861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1860, v ds
+# define BFI_FLINEAR1_1861_TICK(t)
+# define BFI_FLINEAR1_1860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1859, v ds
+# define BFI_FLINEAR1_1860_TICK(t)
+# define BFI_FLINEAR1_1859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1858, v ds
+# define BFI_FLINEAR1_1859_TICK(t)
+# define BFI_FLINEAR1_1858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1857, v ds
+# define BFI_FLINEAR1_1858_TICK(t)
+# define BFI_FLINEAR1_1857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1856, v ds
+# define BFI_FLINEAR1_1857_TICK(t)
+# define BFI_FLINEAR1_1856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1855, v ds
+# define BFI_FLINEAR1_1856_TICK(t)
+# define BFI_FLINEAR1_1855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1854, v ds
+# define BFI_FLINEAR1_1855_TICK(t)
+# define BFI_FLINEAR1_1854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1853, v ds
+# define BFI_FLINEAR1_1854_TICK(t)
+# define BFI_FLINEAR1_1853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1852, v ds
+# define BFI_FLINEAR1_1853_TICK(t)
+# define BFI_FLINEAR1_1852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1851, v ds
+# define BFI_FLINEAR1_1852_TICK(t)
+# define BFI_FLINEAR1_1851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1850, v ds
+# define BFI_FLINEAR1_1851_TICK(t)
+# define BFI_FLINEAR1_1850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1849, v ds
+# define BFI_FLINEAR1_1850_TICK(t)
+# define BFI_FLINEAR1_1849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1848, v ds
+# define BFI_FLINEAR1_1849_TICK(t)
+# define BFI_FLINEAR1_1848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1847, v ds
+# define BFI_FLINEAR1_1848_TICK(t)
+# define BFI_FLINEAR1_1847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1846, v ds
+# define BFI_FLINEAR1_1847_TICK(t)
+# define BFI_FLINEAR1_1846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1845, v ds
+# define BFI_FLINEAR1_1846_TICK(t)
+# define BFI_FLINEAR1_1845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1844, v ds
+# define BFI_FLINEAR1_1845_TICK(t)
+# define BFI_FLINEAR1_1844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1843, v ds
+# define BFI_FLINEAR1_1844_TICK(t)
+# define BFI_FLINEAR1_1843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1842, v ds
+# define BFI_FLINEAR1_1843_TICK(t)
+# define BFI_FLINEAR1_1842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1841, v ds
+# define BFI_FLINEAR1_1842_TICK(t)
+# define BFI_FLINEAR1_1841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1840, v ds
+# define BFI_FLINEAR1_1841_TICK(t)
+# define BFI_FLINEAR1_1840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1839, v ds
+# define BFI_FLINEAR1_1840_TICK(t)
+# define BFI_FLINEAR1_1839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1838, v ds
+# define BFI_FLINEAR1_1839_TICK(t)
+# define BFI_FLINEAR1_1838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1837, v ds
+# define BFI_FLINEAR1_1838_TICK(t)
+# define BFI_FLINEAR1_1837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1836, v ds
+# define BFI_FLINEAR1_1837_TICK(t)
+# define BFI_FLINEAR1_1836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1835, v ds
+# define BFI_FLINEAR1_1836_TICK(t)
+# define BFI_FLINEAR1_1835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1834, v ds
+# define BFI_FLINEAR1_1835_TICK(t)
+# define BFI_FLINEAR1_1834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1833, v ds
+# define BFI_FLINEAR1_1834_TICK(t)
+# define BFI_FLINEAR1_1833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1832, v ds
+# define BFI_FLINEAR1_1833_TICK(t)
+# define BFI_FLINEAR1_1832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1831, v ds
+# define BFI_FLINEAR1_1832_TICK(t)
+# define BFI_FLINEAR1_1831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1830, v ds
+# define BFI_FLINEAR1_1831_TICK(t)
+# define BFI_FLINEAR1_1830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1829, v ds
+# define BFI_FLINEAR1_1830_TICK(t)
+# define BFI_FLINEAR1_1829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1828, v ds
+# define BFI_FLINEAR1_1829_TICK(t)
+# define BFI_FLINEAR1_1828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1827, v ds
+# define BFI_FLINEAR1_1828_TICK(t)
+# define BFI_FLINEAR1_1827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1826, v ds
+# define BFI_FLINEAR1_1827_TICK(t)
+# define BFI_FLINEAR1_1826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1825, v ds
+# define BFI_FLINEAR1_1826_TICK(t)
+# define BFI_FLINEAR1_1825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1824, v ds
+# define BFI_FLINEAR1_1825_TICK(t)
+# define BFI_FLINEAR1_1824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1823, v ds
+# define BFI_FLINEAR1_1824_TICK(t)
+# define BFI_FLINEAR1_1823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1822, v ds
+# define BFI_FLINEAR1_1823_TICK(t)
+# define BFI_FLINEAR1_1822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1821, v ds
+# define BFI_FLINEAR1_1822_TICK(t)
+# define BFI_FLINEAR1_1821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1820, v ds
+# define BFI_FLINEAR1_1821_TICK(t)
+# define BFI_FLINEAR1_1820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1819, v ds
+# define BFI_FLINEAR1_1820_TICK(t)
+# define BFI_FLINEAR1_1819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1818, v ds
+# define BFI_FLINEAR1_1819_TICK(t)
+# define BFI_FLINEAR1_1818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1817, v ds
+# define BFI_FLINEAR1_1818_TICK(t)
+# define BFI_FLINEAR1_1817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1816, v ds
+# define BFI_FLINEAR1_1817_TICK(t)
+# define BFI_FLINEAR1_1816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1815, v ds
+# define BFI_FLINEAR1_1816_TICK(t)
+# define BFI_FLINEAR1_1815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1814, v ds
+# define BFI_FLINEAR1_1815_TICK(t)
+# define BFI_FLINEAR1_1814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1813, v ds
+# define BFI_FLINEAR1_1814_TICK(t)
+# define BFI_FLINEAR1_1813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1812, v ds
+# define BFI_FLINEAR1_1813_TICK(t)
+# define BFI_FLINEAR1_1812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1811, v ds
+# define BFI_FLINEAR1_1812_TICK(t)
+# define BFI_FLINEAR1_1811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1810, v ds
+# define BFI_FLINEAR1_1811_TICK(t)
+# define BFI_FLINEAR1_1810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1809, v ds
+# define BFI_FLINEAR1_1810_TICK(t)
+# define BFI_FLINEAR1_1809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1808, v ds
+# define BFI_FLINEAR1_1809_TICK(t)
+# define BFI_FLINEAR1_1808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1807, v ds
+# define BFI_FLINEAR1_1808_TICK(t)
+# define BFI_FLINEAR1_1807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1806, v ds
+# define BFI_FLINEAR1_1807_TICK(t)
+# define BFI_FLINEAR1_1806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1805, v ds
+# define BFI_FLINEAR1_1806_TICK(t)
+# define BFI_FLINEAR1_1805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1804, v ds
+# define BFI_FLINEAR1_1805_TICK(t)
+# define BFI_FLINEAR1_1804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1803, v ds
+# define BFI_FLINEAR1_1804_TICK(t)
+# define BFI_FLINEAR1_1803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1802, v ds
+# define BFI_FLINEAR1_1803_TICK(t)
+# define BFI_FLINEAR1_1802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1801, v ds
+# define BFI_FLINEAR1_1802_TICK(t)
+# define BFI_FLINEAR1_1801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1800, v ds
+# define BFI_FLINEAR1_1801_TICK(t)
+# define BFI_FLINEAR1_1800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1799, v ds
+# define BFI_FLINEAR1_1800_TICK(t)
+# define BFI_FLINEAR1_1799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1798, v ds
+# define BFI_FLINEAR1_1799_TICK(t)
+# define BFI_FLINEAR1_1798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1797, v ds
+# define BFI_FLINEAR1_1798_TICK(t)
+# define BFI_FLINEAR1_1797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1796, v ds
+# define BFI_FLINEAR1_1797_TICK(t)
+# define BFI_FLINEAR1_1796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1795, v ds
+# define BFI_FLINEAR1_1796_TICK(t)
+# define BFI_FLINEAR1_1795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1794, v ds
+# define BFI_FLINEAR1_1795_TICK(t)
+# define BFI_FLINEAR1_1794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1793, v ds
+# define BFI_FLINEAR1_1794_TICK(t)
+# define BFI_FLINEAR1_1793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1792, v ds
+# define BFI_FLINEAR1_1793_TICK(t)
+# define BFI_FLINEAR1_1792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1791, v ds
+# define BFI_FLINEAR1_1792_TICK(t)
+# define BFI_FLINEAR1_1791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1790, v ds
+# define BFI_FLINEAR1_1791_TICK(t)
+# define BFI_FLINEAR1_1790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1789, v ds
+# define BFI_FLINEAR1_1790_TICK(t)
+# define BFI_FLINEAR1_1789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1788, v ds
+# define BFI_FLINEAR1_1789_TICK(t)
+# define BFI_FLINEAR1_1788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1787, v ds
+# define BFI_FLINEAR1_1788_TICK(t)
+# define BFI_FLINEAR1_1787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1786, v ds
+# define BFI_FLINEAR1_1787_TICK(t)
+# define BFI_FLINEAR1_1786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1785, v ds
+# define BFI_FLINEAR1_1786_TICK(t)
+# define BFI_FLINEAR1_1785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1784, v ds
+# define BFI_FLINEAR1_1785_TICK(t)
+# define BFI_FLINEAR1_1784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1783, v ds
+# define BFI_FLINEAR1_1784_TICK(t)
+# define BFI_FLINEAR1_1783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1782, v ds
+# define BFI_FLINEAR1_1783_TICK(t)
+# define BFI_FLINEAR1_1782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1781, v ds
+# define BFI_FLINEAR1_1782_TICK(t)
+# define BFI_FLINEAR1_1781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1780, v ds
+# define BFI_FLINEAR1_1781_TICK(t)
+# define BFI_FLINEAR1_1780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1779, v ds
+# define BFI_FLINEAR1_1780_TICK(t)
+# define BFI_FLINEAR1_1779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1778, v ds
+# define BFI_FLINEAR1_1779_TICK(t)
+# define BFI_FLINEAR1_1778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1777, v ds
+# define BFI_FLINEAR1_1778_TICK(t)
+# define BFI_FLINEAR1_1777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1776, v ds
+# define BFI_FLINEAR1_1777_TICK(t)
+# define BFI_FLINEAR1_1776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1775, v ds
+# define BFI_FLINEAR1_1776_TICK(t)
+# define BFI_FLINEAR1_1775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1774, v ds
+# define BFI_FLINEAR1_1775_TICK(t)
+# define BFI_FLINEAR1_1774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1773, v ds
+# define BFI_FLINEAR1_1774_TICK(t)
+# define BFI_FLINEAR1_1773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1772, v ds
+# define BFI_FLINEAR1_1773_TICK(t)
+# define BFI_FLINEAR1_1772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1771, v ds
+# define BFI_FLINEAR1_1772_TICK(t)
+# define BFI_FLINEAR1_1771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1770, v ds
+# define BFI_FLINEAR1_1771_TICK(t)
+# define BFI_FLINEAR1_1770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1769, v ds
+# define BFI_FLINEAR1_1770_TICK(t)
+# define BFI_FLINEAR1_1769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1768, v ds
+# define BFI_FLINEAR1_1769_TICK(t)
+# define BFI_FLINEAR1_1768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1767, v ds
+# define BFI_FLINEAR1_1768_TICK(t)
+# define BFI_FLINEAR1_1767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1766, v ds
+# define BFI_FLINEAR1_1767_TICK(t)
+# define BFI_FLINEAR1_1766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1765, v ds
+# define BFI_FLINEAR1_1766_TICK(t)
+# define BFI_FLINEAR1_1765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1764, v ds
+# define BFI_FLINEAR1_1765_TICK(t)
+# define BFI_FLINEAR1_1764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1763, v ds
+# define BFI_FLINEAR1_1764_TICK(t)
+# define BFI_FLINEAR1_1763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1762, v ds
+# define BFI_FLINEAR1_1763_TICK(t)
+# define BFI_FLINEAR1_1762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1761, v ds
+# define BFI_FLINEAR1_1762_TICK(t)
+# define BFI_FLINEAR1_1761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1760, v ds
+# define BFI_FLINEAR1_1761_TICK(t)
+# define BFI_FLINEAR1_1760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1759, v ds
+# define BFI_FLINEAR1_1760_TICK(t)
+# define BFI_FLINEAR1_1759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1758, v ds
+# define BFI_FLINEAR1_1759_TICK(t)
+# define BFI_FLINEAR1_1758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1757, v ds
+# define BFI_FLINEAR1_1758_TICK(t)
+# define BFI_FLINEAR1_1757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1756, v ds
+# define BFI_FLINEAR1_1757_TICK(t)
+# define BFI_FLINEAR1_1756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1755, v ds
+# define BFI_FLINEAR1_1756_TICK(t)
+# define BFI_FLINEAR1_1755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1754, v ds
+# define BFI_FLINEAR1_1755_TICK(t)
+# define BFI_FLINEAR1_1754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1753, v ds
+# define BFI_FLINEAR1_1754_TICK(t)
+# define BFI_FLINEAR1_1753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1752, v ds
+# define BFI_FLINEAR1_1753_TICK(t)
+# define BFI_FLINEAR1_1752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1751, v ds
+# define BFI_FLINEAR1_1752_TICK(t)
+# define BFI_FLINEAR1_1751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1750, v ds
+# define BFI_FLINEAR1_1751_TICK(t)
+# define BFI_FLINEAR1_1750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1749, v ds
+# define BFI_FLINEAR1_1750_TICK(t)
+# define BFI_FLINEAR1_1749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1748, v ds
+# define BFI_FLINEAR1_1749_TICK(t)
+# define BFI_FLINEAR1_1748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1747, v ds
+# define BFI_FLINEAR1_1748_TICK(t)
+# define BFI_FLINEAR1_1747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1746, v ds
+# define BFI_FLINEAR1_1747_TICK(t)
+# define BFI_FLINEAR1_1746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1745, v ds
+# define BFI_FLINEAR1_1746_TICK(t)
+# define BFI_FLINEAR1_1745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1744, v ds
+# define BFI_FLINEAR1_1745_TICK(t)
+# define BFI_FLINEAR1_1744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1743, v ds
+# define BFI_FLINEAR1_1744_TICK(t)
+# define BFI_FLINEAR1_1743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1742, v ds
+# define BFI_FLINEAR1_1743_TICK(t)
+# define BFI_FLINEAR1_1742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1741, v ds
+# define BFI_FLINEAR1_1742_TICK(t)
+# define BFI_FLINEAR1_1741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1740, v ds
+# define BFI_FLINEAR1_1741_TICK(t)
+# define BFI_FLINEAR1_1740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1739, v ds
+# define BFI_FLINEAR1_1740_TICK(t)
+# define BFI_FLINEAR1_1739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1738, v ds
+# define BFI_FLINEAR1_1739_TICK(t)
+# define BFI_FLINEAR1_1738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1737, v ds
+# define BFI_FLINEAR1_1738_TICK(t)
+# define BFI_FLINEAR1_1737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1736, v ds
+# define BFI_FLINEAR1_1737_TICK(t)
+# define BFI_FLINEAR1_1736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1735, v ds
+# define BFI_FLINEAR1_1736_TICK(t)
+# define BFI_FLINEAR1_1735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1734, v ds
+# define BFI_FLINEAR1_1735_TICK(t)
+# define BFI_FLINEAR1_1734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1733, v ds
+# define BFI_FLINEAR1_1734_TICK(t)
+# define BFI_FLINEAR1_1733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1732, v ds
+# define BFI_FLINEAR1_1733_TICK(t)
+# define BFI_FLINEAR1_1732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1731, v ds
+# define BFI_FLINEAR1_1732_TICK(t)
+# define BFI_FLINEAR1_1731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1730, v ds
+# define BFI_FLINEAR1_1731_TICK(t)
+# define BFI_FLINEAR1_1730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1729, v ds
+# define BFI_FLINEAR1_1730_TICK(t)
+# define BFI_FLINEAR1_1729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1728, v ds
+# define BFI_FLINEAR1_1729_TICK(t)
+# define BFI_FLINEAR1_1728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1727, v ds
+# define BFI_FLINEAR1_1728_TICK(t)
+# define BFI_FLINEAR1_1727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1726, v ds
+# define BFI_FLINEAR1_1727_TICK(t)
+# define BFI_FLINEAR1_1726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1725, v ds
+# define BFI_FLINEAR1_1726_TICK(t)
+# define BFI_FLINEAR1_1725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1724, v ds
+# define BFI_FLINEAR1_1725_TICK(t)
+# define BFI_FLINEAR1_1724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1723, v ds
+# define BFI_FLINEAR1_1724_TICK(t)
+# define BFI_FLINEAR1_1723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1722, v ds
+# define BFI_FLINEAR1_1723_TICK(t)
+# define BFI_FLINEAR1_1722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1721, v ds
+# define BFI_FLINEAR1_1722_TICK(t)
+# define BFI_FLINEAR1_1721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1720, v ds
+# define BFI_FLINEAR1_1721_TICK(t)
+# define BFI_FLINEAR1_1720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1719, v ds
+# define BFI_FLINEAR1_1720_TICK(t)
+# define BFI_FLINEAR1_1719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1718, v ds
+# define BFI_FLINEAR1_1719_TICK(t)
+# define BFI_FLINEAR1_1718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1717, v ds
+# define BFI_FLINEAR1_1718_TICK(t)
+# define BFI_FLINEAR1_1717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1716, v ds
+# define BFI_FLINEAR1_1717_TICK(t)
+# define BFI_FLINEAR1_1716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1715, v ds
+# define BFI_FLINEAR1_1716_TICK(t)
+# define BFI_FLINEAR1_1715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1714, v ds
+# define BFI_FLINEAR1_1715_TICK(t)
+# define BFI_FLINEAR1_1714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1713, v ds
+# define BFI_FLINEAR1_1714_TICK(t)
+# define BFI_FLINEAR1_1713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1712, v ds
+# define BFI_FLINEAR1_1713_TICK(t)
+# define BFI_FLINEAR1_1712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1711, v ds
+# define BFI_FLINEAR1_1712_TICK(t)
+# define BFI_FLINEAR1_1711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1710, v ds
+# define BFI_FLINEAR1_1711_TICK(t)
+# define BFI_FLINEAR1_1710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1709, v ds
+# define BFI_FLINEAR1_1710_TICK(t)
+# define BFI_FLINEAR1_1709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1708, v ds
+# define BFI_FLINEAR1_1709_TICK(t)
+# define BFI_FLINEAR1_1708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1707, v ds
+# define BFI_FLINEAR1_1708_TICK(t)
+# define BFI_FLINEAR1_1707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1706, v ds
+# define BFI_FLINEAR1_1707_TICK(t)
+# define BFI_FLINEAR1_1706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1705, v ds
+# define BFI_FLINEAR1_1706_TICK(t)
+# define BFI_FLINEAR1_1705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1704, v ds
+# define BFI_FLINEAR1_1705_TICK(t)
+# define BFI_FLINEAR1_1704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1703, v ds
+# define BFI_FLINEAR1_1704_TICK(t)
+# define BFI_FLINEAR1_1703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1702, v ds
+# define BFI_FLINEAR1_1703_TICK(t)
+# define BFI_FLINEAR1_1702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1701, v ds
+# define BFI_FLINEAR1_1702_TICK(t)
+# define BFI_FLINEAR1_1701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1700, v ds
+# define BFI_FLINEAR1_1701_TICK(t)
+# define BFI_FLINEAR1_1700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1699, v ds
+# define BFI_FLINEAR1_1700_TICK(t)
+# define BFI_FLINEAR1_1699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1698, v ds
+# define BFI_FLINEAR1_1699_TICK(t)
+# define BFI_FLINEAR1_1698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1697, v ds
+# define BFI_FLINEAR1_1698_TICK(t)
+# define BFI_FLINEAR1_1697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1696, v ds
+# define BFI_FLINEAR1_1697_TICK(t)
+# define BFI_FLINEAR1_1696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1695, v ds
+# define BFI_FLINEAR1_1696_TICK(t)
+# define BFI_FLINEAR1_1695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1694, v ds
+# define BFI_FLINEAR1_1695_TICK(t)
+# define BFI_FLINEAR1_1694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1693, v ds
+# define BFI_FLINEAR1_1694_TICK(t)
+# define BFI_FLINEAR1_1693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1692, v ds
+# define BFI_FLINEAR1_1693_TICK(t)
+# define BFI_FLINEAR1_1692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1691, v ds
+# define BFI_FLINEAR1_1692_TICK(t)
+# define BFI_FLINEAR1_1691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1690, v ds
+# define BFI_FLINEAR1_1691_TICK(t)
+# define BFI_FLINEAR1_1690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1689, v ds
+# define BFI_FLINEAR1_1690_TICK(t)
+# define BFI_FLINEAR1_1689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1688, v ds
+# define BFI_FLINEAR1_1689_TICK(t)
+# define BFI_FLINEAR1_1688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1687, v ds
+# define BFI_FLINEAR1_1688_TICK(t)
+# define BFI_FLINEAR1_1687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1686, v ds
+# define BFI_FLINEAR1_1687_TICK(t)
+# define BFI_FLINEAR1_1686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1685, v ds
+# define BFI_FLINEAR1_1686_TICK(t)
+# define BFI_FLINEAR1_1685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1684, v ds
+# define BFI_FLINEAR1_1685_TICK(t)
+# define BFI_FLINEAR1_1684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1683, v ds
+# define BFI_FLINEAR1_1684_TICK(t)
+# define BFI_FLINEAR1_1683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1682, v ds
+# define BFI_FLINEAR1_1683_TICK(t)
+# define BFI_FLINEAR1_1682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1681, v ds
+# define BFI_FLINEAR1_1682_TICK(t)
+# define BFI_FLINEAR1_1681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1680, v ds
+# define BFI_FLINEAR1_1681_TICK(t)
+# define BFI_FLINEAR1_1680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1679, v ds
+# define BFI_FLINEAR1_1680_TICK(t)
+# define BFI_FLINEAR1_1679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1678, v ds
+# define BFI_FLINEAR1_1679_TICK(t)
+# define BFI_FLINEAR1_1678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1677, v ds
+# define BFI_FLINEAR1_1678_TICK(t)
+# define BFI_FLINEAR1_1677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1676, v ds
+# define BFI_FLINEAR1_1677_TICK(t)
+# define BFI_FLINEAR1_1676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1675, v ds
+# define BFI_FLINEAR1_1676_TICK(t)
+# define BFI_FLINEAR1_1675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1674, v ds
+# define BFI_FLINEAR1_1675_TICK(t)
+# define BFI_FLINEAR1_1674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1673, v ds
+# define BFI_FLINEAR1_1674_TICK(t)
+# define BFI_FLINEAR1_1673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1672, v ds
+# define BFI_FLINEAR1_1673_TICK(t)
+# define BFI_FLINEAR1_1672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1671, v ds
+# define BFI_FLINEAR1_1672_TICK(t)
+# define BFI_FLINEAR1_1671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1670, v ds
+# define BFI_FLINEAR1_1671_TICK(t)
+# define BFI_FLINEAR1_1670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1669, v ds
+# define BFI_FLINEAR1_1670_TICK(t)
+# define BFI_FLINEAR1_1669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1668, v ds
+# define BFI_FLINEAR1_1669_TICK(t)
+# define BFI_FLINEAR1_1668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1667, v ds
+# define BFI_FLINEAR1_1668_TICK(t)
+# define BFI_FLINEAR1_1667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1666, v ds
+# define BFI_FLINEAR1_1667_TICK(t)
+# define BFI_FLINEAR1_1666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1665, v ds
+# define BFI_FLINEAR1_1666_TICK(t)
+# define BFI_FLINEAR1_1665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1664, v ds
+# define BFI_FLINEAR1_1665_TICK(t)
+# define BFI_FLINEAR1_1664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1663, v ds
+# define BFI_FLINEAR1_1664_TICK(t)
+# define BFI_FLINEAR1_1663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1662, v ds
+# define BFI_FLINEAR1_1663_TICK(t)
+# define BFI_FLINEAR1_1662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1661, v ds
+# define BFI_FLINEAR1_1662_TICK(t)
+# define BFI_FLINEAR1_1661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1660, v ds
+# define BFI_FLINEAR1_1661_TICK(t)
+# define BFI_FLINEAR1_1660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1659, v ds
+# define BFI_FLINEAR1_1660_TICK(t)
+# define BFI_FLINEAR1_1659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1658, v ds
+# define BFI_FLINEAR1_1659_TICK(t)
+# define BFI_FLINEAR1_1658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1657, v ds
+# define BFI_FLINEAR1_1658_TICK(t)
+# define BFI_FLINEAR1_1657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1656, v ds
+# define BFI_FLINEAR1_1657_TICK(t)
+# define BFI_FLINEAR1_1656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1655, v ds
+# define BFI_FLINEAR1_1656_TICK(t)
+# define BFI_FLINEAR1_1655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1654, v ds
+# define BFI_FLINEAR1_1655_TICK(t)
+# define BFI_FLINEAR1_1654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1653, v ds
+# define BFI_FLINEAR1_1654_TICK(t)
+# define BFI_FLINEAR1_1653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1652, v ds
+# define BFI_FLINEAR1_1653_TICK(t)
+# define BFI_FLINEAR1_1652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1651, v ds
+# define BFI_FLINEAR1_1652_TICK(t)
+# define BFI_FLINEAR1_1651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1650, v ds
+# define BFI_FLINEAR1_1651_TICK(t)
+# define BFI_FLINEAR1_1650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1649, v ds
+# define BFI_FLINEAR1_1650_TICK(t)
+# define BFI_FLINEAR1_1649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1648, v ds
+# define BFI_FLINEAR1_1649_TICK(t)
+# define BFI_FLINEAR1_1648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1647, v ds
+# define BFI_FLINEAR1_1648_TICK(t)
+# define BFI_FLINEAR1_1647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1646, v ds
+# define BFI_FLINEAR1_1647_TICK(t)
+# define BFI_FLINEAR1_1646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1645, v ds
+# define BFI_FLINEAR1_1646_TICK(t)
+# define BFI_FLINEAR1_1645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1644, v ds
+# define BFI_FLINEAR1_1645_TICK(t)
+# define BFI_FLINEAR1_1644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1643, v ds
+# define BFI_FLINEAR1_1644_TICK(t)
+# define BFI_FLINEAR1_1643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1642, v ds
+# define BFI_FLINEAR1_1643_TICK(t)
+# define BFI_FLINEAR1_1642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1641, v ds
+# define BFI_FLINEAR1_1642_TICK(t)
+# define BFI_FLINEAR1_1641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1640, v ds
+# define BFI_FLINEAR1_1641_TICK(t)
+# define BFI_FLINEAR1_1640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1639, v ds
+# define BFI_FLINEAR1_1640_TICK(t)
+# define BFI_FLINEAR1_1639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1638, v ds
+# define BFI_FLINEAR1_1639_TICK(t)
+# define BFI_FLINEAR1_1638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1637, v ds
+# define BFI_FLINEAR1_1638_TICK(t)
+# define BFI_FLINEAR1_1637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1636, v ds
+# define BFI_FLINEAR1_1637_TICK(t)
+# define BFI_FLINEAR1_1636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1635, v ds
+# define BFI_FLINEAR1_1636_TICK(t)
+# define BFI_FLINEAR1_1635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1634, v ds
+# define BFI_FLINEAR1_1635_TICK(t)
+# define BFI_FLINEAR1_1634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1633, v ds
+# define BFI_FLINEAR1_1634_TICK(t)
+# define BFI_FLINEAR1_1633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1632, v ds
+# define BFI_FLINEAR1_1633_TICK(t)
+# define BFI_FLINEAR1_1632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1631, v ds
+# define BFI_FLINEAR1_1632_TICK(t)
+# define BFI_FLINEAR1_1631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1630, v ds
+# define BFI_FLINEAR1_1631_TICK(t)
+# define BFI_FLINEAR1_1630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1629, v ds
+# define BFI_FLINEAR1_1630_TICK(t)
+# define BFI_FLINEAR1_1629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1628, v ds
+# define BFI_FLINEAR1_1629_TICK(t)
+# define BFI_FLINEAR1_1628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1627, v ds
+# define BFI_FLINEAR1_1628_TICK(t)
+# define BFI_FLINEAR1_1627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1626, v ds
+# define BFI_FLINEAR1_1627_TICK(t)
+# define BFI_FLINEAR1_1626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1625, v ds
+# define BFI_FLINEAR1_1626_TICK(t)
+# define BFI_FLINEAR1_1625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1624, v ds
+# define BFI_FLINEAR1_1625_TICK(t)
+# define BFI_FLINEAR1_1624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1623, v ds
+# define BFI_FLINEAR1_1624_TICK(t)
+# define BFI_FLINEAR1_1623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1622, v ds
+# define BFI_FLINEAR1_1623_TICK(t)
+# define BFI_FLINEAR1_1622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1621, v ds
+# define BFI_FLINEAR1_1622_TICK(t)
+# define BFI_FLINEAR1_1621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1620, v ds
+# define BFI_FLINEAR1_1621_TICK(t)
+# define BFI_FLINEAR1_1620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1619, v ds
+# define BFI_FLINEAR1_1620_TICK(t)
+# define BFI_FLINEAR1_1619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1618, v ds
+# define BFI_FLINEAR1_1619_TICK(t)
+# define BFI_FLINEAR1_1618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1617, v ds
+# define BFI_FLINEAR1_1618_TICK(t)
+# define BFI_FLINEAR1_1617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1616, v ds
+# define BFI_FLINEAR1_1617_TICK(t)
+# define BFI_FLINEAR1_1616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1615, v ds
+# define BFI_FLINEAR1_1616_TICK(t)
+# define BFI_FLINEAR1_1615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1614, v ds
+# define BFI_FLINEAR1_1615_TICK(t)
+# define BFI_FLINEAR1_1614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1613, v ds
+# define BFI_FLINEAR1_1614_TICK(t)
+# define BFI_FLINEAR1_1613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1612, v ds
+# define BFI_FLINEAR1_1613_TICK(t)
+# define BFI_FLINEAR1_1612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1611, v ds
+# define BFI_FLINEAR1_1612_TICK(t)
+# define BFI_FLINEAR1_1611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1610, v ds
+# define BFI_FLINEAR1_1611_TICK(t)
+# define BFI_FLINEAR1_1610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1609, v ds
+# define BFI_FLINEAR1_1610_TICK(t)
+# define BFI_FLINEAR1_1609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1608, v ds
+# define BFI_FLINEAR1_1609_TICK(t)
+# define BFI_FLINEAR1_1608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1607, v ds
+# define BFI_FLINEAR1_1608_TICK(t)
+# define BFI_FLINEAR1_1607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1606, v ds
+# define BFI_FLINEAR1_1607_TICK(t)
+# define BFI_FLINEAR1_1606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1605, v ds
+# define BFI_FLINEAR1_1606_TICK(t)
+# define BFI_FLINEAR1_1605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1604, v ds
+# define BFI_FLINEAR1_1605_TICK(t)
+# define BFI_FLINEAR1_1604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1603, v ds
+# define BFI_FLINEAR1_1604_TICK(t)
+# define BFI_FLINEAR1_1603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1602, v ds
+# define BFI_FLINEAR1_1603_TICK(t)
+# define BFI_FLINEAR1_1602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1601, v ds
+# define BFI_FLINEAR1_1602_TICK(t)
+# define BFI_FLINEAR1_1601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1600, v ds
+# define BFI_FLINEAR1_1601_TICK(t)
+# define BFI_FLINEAR1_1600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1599, v ds
+# define BFI_FLINEAR1_1600_TICK(t)
+# define BFI_FLINEAR1_1599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1598, v ds
+# define BFI_FLINEAR1_1599_TICK(t)
+# define BFI_FLINEAR1_1598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1597, v ds
+# define BFI_FLINEAR1_1598_TICK(t)
+# define BFI_FLINEAR1_1597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1596, v ds
+# define BFI_FLINEAR1_1597_TICK(t)
+# define BFI_FLINEAR1_1596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1595, v ds
+# define BFI_FLINEAR1_1596_TICK(t)
+# define BFI_FLINEAR1_1595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1594, v ds
+# define BFI_FLINEAR1_1595_TICK(t)
+# define BFI_FLINEAR1_1594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1593, v ds
+# define BFI_FLINEAR1_1594_TICK(t)
+# define BFI_FLINEAR1_1593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1592, v ds
+# define BFI_FLINEAR1_1593_TICK(t)
+# define BFI_FLINEAR1_1592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1591, v ds
+# define BFI_FLINEAR1_1592_TICK(t)
+# define BFI_FLINEAR1_1591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1590, v ds
+# define BFI_FLINEAR1_1591_TICK(t)
+# define BFI_FLINEAR1_1590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1589, v ds
+# define BFI_FLINEAR1_1590_TICK(t)
+# define BFI_FLINEAR1_1589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1588, v ds
+# define BFI_FLINEAR1_1589_TICK(t)
+# define BFI_FLINEAR1_1588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1587, v ds
+# define BFI_FLINEAR1_1588_TICK(t)
+# define BFI_FLINEAR1_1587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1586, v ds
+# define BFI_FLINEAR1_1587_TICK(t)
+# define BFI_FLINEAR1_1586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1585, v ds
+# define BFI_FLINEAR1_1586_TICK(t)
+# define BFI_FLINEAR1_1585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1584, v ds
+# define BFI_FLINEAR1_1585_TICK(t)
+# define BFI_FLINEAR1_1584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1583, v ds
+# define BFI_FLINEAR1_1584_TICK(t)
+# define BFI_FLINEAR1_1583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1582, v ds
+# define BFI_FLINEAR1_1583_TICK(t)
+# define BFI_FLINEAR1_1582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1581, v ds
+# define BFI_FLINEAR1_1582_TICK(t)
+# define BFI_FLINEAR1_1581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1580, v ds
+# define BFI_FLINEAR1_1581_TICK(t)
+# define BFI_FLINEAR1_1580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1579, v ds
+# define BFI_FLINEAR1_1580_TICK(t)
+# define BFI_FLINEAR1_1579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1578, v ds
+# define BFI_FLINEAR1_1579_TICK(t)
+# define BFI_FLINEAR1_1578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1577, v ds
+# define BFI_FLINEAR1_1578_TICK(t)
+# define BFI_FLINEAR1_1577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1576, v ds
+# define BFI_FLINEAR1_1577_TICK(t)
+# define BFI_FLINEAR1_1576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1575, v ds
+# define BFI_FLINEAR1_1576_TICK(t)
+# define BFI_FLINEAR1_1575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1574, v ds
+# define BFI_FLINEAR1_1575_TICK(t)
+# define BFI_FLINEAR1_1574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1573, v ds
+# define BFI_FLINEAR1_1574_TICK(t)
+# define BFI_FLINEAR1_1573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1572, v ds
+# define BFI_FLINEAR1_1573_TICK(t)
+# define BFI_FLINEAR1_1572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1571, v ds
+# define BFI_FLINEAR1_1572_TICK(t)
+# define BFI_FLINEAR1_1571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1570, v ds
+# define BFI_FLINEAR1_1571_TICK(t)
+# define BFI_FLINEAR1_1570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1569, v ds
+# define BFI_FLINEAR1_1570_TICK(t)
+# define BFI_FLINEAR1_1569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1568, v ds
+# define BFI_FLINEAR1_1569_TICK(t)
+# define BFI_FLINEAR1_1568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1567, v ds
+# define BFI_FLINEAR1_1568_TICK(t)
+# define BFI_FLINEAR1_1567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1566, v ds
+# define BFI_FLINEAR1_1567_TICK(t)
+# define BFI_FLINEAR1_1566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1565, v ds
+# define BFI_FLINEAR1_1566_TICK(t)
+# define BFI_FLINEAR1_1565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1564, v ds
+# define BFI_FLINEAR1_1565_TICK(t)
+# define BFI_FLINEAR1_1564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1563, v ds
+# define BFI_FLINEAR1_1564_TICK(t)
+# define BFI_FLINEAR1_1563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1562, v ds
+# define BFI_FLINEAR1_1563_TICK(t)
+# define BFI_FLINEAR1_1562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1561, v ds
+# define BFI_FLINEAR1_1562_TICK(t)
+# define BFI_FLINEAR1_1561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1560, v ds
+# define BFI_FLINEAR1_1561_TICK(t)
+# define BFI_FLINEAR1_1560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1559, v ds
+# define BFI_FLINEAR1_1560_TICK(t)
+# define BFI_FLINEAR1_1559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1558, v ds
+# define BFI_FLINEAR1_1559_TICK(t)
+# define BFI_FLINEAR1_1558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1557, v ds
+# define BFI_FLINEAR1_1558_TICK(t)
+# define BFI_FLINEAR1_1557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1556, v ds
+# define BFI_FLINEAR1_1557_TICK(t)
+# define BFI_FLINEAR1_1556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1555, v ds
+# define BFI_FLINEAR1_1556_TICK(t)
+# define BFI_FLINEAR1_1555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1554, v ds
+# define BFI_FLINEAR1_1555_TICK(t)
+# define BFI_FLINEAR1_1554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1553, v ds
+# define BFI_FLINEAR1_1554_TICK(t)
+# define BFI_FLINEAR1_1553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1552, v ds
+# define BFI_FLINEAR1_1553_TICK(t)
+# define BFI_FLINEAR1_1552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1551, v ds
+# define BFI_FLINEAR1_1552_TICK(t)
+# define BFI_FLINEAR1_1551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1550, v ds
+# define BFI_FLINEAR1_1551_TICK(t)
+# define BFI_FLINEAR1_1550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1549, v ds
+# define BFI_FLINEAR1_1550_TICK(t)
+# define BFI_FLINEAR1_1549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1548, v ds
+# define BFI_FLINEAR1_1549_TICK(t)
+# define BFI_FLINEAR1_1548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1547, v ds
+# define BFI_FLINEAR1_1548_TICK(t)
+# define BFI_FLINEAR1_1547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1546, v ds
+# define BFI_FLINEAR1_1547_TICK(t)
+# define BFI_FLINEAR1_1546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1545, v ds
+# define BFI_FLINEAR1_1546_TICK(t)
+# define BFI_FLINEAR1_1545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1544, v ds
+# define BFI_FLINEAR1_1545_TICK(t)
+# define BFI_FLINEAR1_1544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1543, v ds
+# define BFI_FLINEAR1_1544_TICK(t)
+# define BFI_FLINEAR1_1543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1542, v ds
+# define BFI_FLINEAR1_1543_TICK(t)
+# define BFI_FLINEAR1_1542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1541, v ds
+# define BFI_FLINEAR1_1542_TICK(t)
+# define BFI_FLINEAR1_1541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1540, v ds
+# define BFI_FLINEAR1_1541_TICK(t)
+# define BFI_FLINEAR1_1540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1539, v ds
+# define BFI_FLINEAR1_1540_TICK(t)
+# define BFI_FLINEAR1_1539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1538, v ds
+# define BFI_FLINEAR1_1539_TICK(t)
+# define BFI_FLINEAR1_1538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1537, v ds
+# define BFI_FLINEAR1_1538_TICK(t)
+# define BFI_FLINEAR1_1537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1536, v ds
+# define BFI_FLINEAR1_1537_TICK(t)
+# define BFI_FLINEAR1_1536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1535, v ds
+# define BFI_FLINEAR1_1536_TICK(t)
+# define BFI_FLINEAR1_1535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1534, v ds
+# define BFI_FLINEAR1_1535_TICK(t)
+# define BFI_FLINEAR1_1534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1533, v ds
+# define BFI_FLINEAR1_1534_TICK(t)
+# define BFI_FLINEAR1_1533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1532, v ds
+# define BFI_FLINEAR1_1533_TICK(t)
+# define BFI_FLINEAR1_1532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1531, v ds
+# define BFI_FLINEAR1_1532_TICK(t)
+# define BFI_FLINEAR1_1531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1530, v ds
+# define BFI_FLINEAR1_1531_TICK(t)
+# define BFI_FLINEAR1_1530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1529, v ds
+# define BFI_FLINEAR1_1530_TICK(t)
+# define BFI_FLINEAR1_1529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1528, v ds
+# define BFI_FLINEAR1_1529_TICK(t)
+# define BFI_FLINEAR1_1528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1527, v ds
+# define BFI_FLINEAR1_1528_TICK(t)
+# define BFI_FLINEAR1_1527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1526, v ds
+# define BFI_FLINEAR1_1527_TICK(t)
+# define BFI_FLINEAR1_1526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1525, v ds
+# define BFI_FLINEAR1_1526_TICK(t)
+# define BFI_FLINEAR1_1525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1524, v ds
+# define BFI_FLINEAR1_1525_TICK(t)
+# define BFI_FLINEAR1_1524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1523, v ds
+# define BFI_FLINEAR1_1524_TICK(t)
+# define BFI_FLINEAR1_1523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1522, v ds
+# define BFI_FLINEAR1_1523_TICK(t)
+# define BFI_FLINEAR1_1522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1521, v ds
+# define BFI_FLINEAR1_1522_TICK(t)
+# define BFI_FLINEAR1_1521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1520, v ds
+# define BFI_FLINEAR1_1521_TICK(t)
+# define BFI_FLINEAR1_1520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1519, v ds
+# define BFI_FLINEAR1_1520_TICK(t)
+# define BFI_FLINEAR1_1519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1518, v ds
+# define BFI_FLINEAR1_1519_TICK(t)
+# define BFI_FLINEAR1_1518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1517, v ds
+# define BFI_FLINEAR1_1518_TICK(t)
+# define BFI_FLINEAR1_1517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1516, v ds
+# define BFI_FLINEAR1_1517_TICK(t)
+# define BFI_FLINEAR1_1516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1515, v ds
+# define BFI_FLINEAR1_1516_TICK(t)
+# define BFI_FLINEAR1_1515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1514, v ds
+# define BFI_FLINEAR1_1515_TICK(t)
+# define BFI_FLINEAR1_1514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1513, v ds
+# define BFI_FLINEAR1_1514_TICK(t)
+# define BFI_FLINEAR1_1513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1512, v ds
+# define BFI_FLINEAR1_1513_TICK(t)
+# define BFI_FLINEAR1_1512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1511, v ds
+# define BFI_FLINEAR1_1512_TICK(t)
+# define BFI_FLINEAR1_1511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1510, v ds
+# define BFI_FLINEAR1_1511_TICK(t)
+# define BFI_FLINEAR1_1510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1509, v ds
+# define BFI_FLINEAR1_1510_TICK(t)
+# define BFI_FLINEAR1_1509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1508, v ds
+# define BFI_FLINEAR1_1509_TICK(t)
+# define BFI_FLINEAR1_1508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1507, v ds
+# define BFI_FLINEAR1_1508_TICK(t)
+# define BFI_FLINEAR1_1507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1506, v ds
+# define BFI_FLINEAR1_1507_TICK(t)
+# define BFI_FLINEAR1_1506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1505, v ds
+# define BFI_FLINEAR1_1506_TICK(t)
+# define BFI_FLINEAR1_1505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1504, v ds
+# define BFI_FLINEAR1_1505_TICK(t)
+# define BFI_FLINEAR1_1504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1503, v ds
+# define BFI_FLINEAR1_1504_TICK(t)
+# define BFI_FLINEAR1_1503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1502, v ds
+# define BFI_FLINEAR1_1503_TICK(t)
+# define BFI_FLINEAR1_1502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1501, v ds
+# define BFI_FLINEAR1_1502_TICK(t)
+# define BFI_FLINEAR1_1501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1500, v ds
+# define BFI_FLINEAR1_1501_TICK(t)
+# define BFI_FLINEAR1_1500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1499, v ds
+# define BFI_FLINEAR1_1500_TICK(t)
+# define BFI_FLINEAR1_1499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1498, v ds
+# define BFI_FLINEAR1_1499_TICK(t)
+# define BFI_FLINEAR1_1498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1497, v ds
+# define BFI_FLINEAR1_1498_TICK(t)
+# define BFI_FLINEAR1_1497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1496, v ds
+# define BFI_FLINEAR1_1497_TICK(t)
+# define BFI_FLINEAR1_1496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1495, v ds
+# define BFI_FLINEAR1_1496_TICK(t)
+# define BFI_FLINEAR1_1495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1494, v ds
+# define BFI_FLINEAR1_1495_TICK(t)
+# define BFI_FLINEAR1_1494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1493, v ds
+# define BFI_FLINEAR1_1494_TICK(t)
+# define BFI_FLINEAR1_1493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1492, v ds
+# define BFI_FLINEAR1_1493_TICK(t)
+# define BFI_FLINEAR1_1492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1491, v ds
+# define BFI_FLINEAR1_1492_TICK(t)
+# define BFI_FLINEAR1_1491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1490, v ds
+# define BFI_FLINEAR1_1491_TICK(t)
+# define BFI_FLINEAR1_1490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1489, v ds
+# define BFI_FLINEAR1_1490_TICK(t)
+# define BFI_FLINEAR1_1489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1488, v ds
+# define BFI_FLINEAR1_1489_TICK(t)
+# define BFI_FLINEAR1_1488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1487, v ds
+# define BFI_FLINEAR1_1488_TICK(t)
+# define BFI_FLINEAR1_1487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1486, v ds
+# define BFI_FLINEAR1_1487_TICK(t)
+# define BFI_FLINEAR1_1486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1485, v ds
+# define BFI_FLINEAR1_1486_TICK(t)
+# define BFI_FLINEAR1_1485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1484, v ds
+# define BFI_FLINEAR1_1485_TICK(t)
+# define BFI_FLINEAR1_1484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1483, v ds
+# define BFI_FLINEAR1_1484_TICK(t)
+# define BFI_FLINEAR1_1483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1482, v ds
+# define BFI_FLINEAR1_1483_TICK(t)
+# define BFI_FLINEAR1_1482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1481, v ds
+# define BFI_FLINEAR1_1482_TICK(t)
+# define BFI_FLINEAR1_1481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1480, v ds
+# define BFI_FLINEAR1_1481_TICK(t)
+# define BFI_FLINEAR1_1480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1479, v ds
+# define BFI_FLINEAR1_1480_TICK(t)
+# define BFI_FLINEAR1_1479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1478, v ds
+# define BFI_FLINEAR1_1479_TICK(t)
+# define BFI_FLINEAR1_1478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1477, v ds
+# define BFI_FLINEAR1_1478_TICK(t)
+# define BFI_FLINEAR1_1477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1476, v ds
+# define BFI_FLINEAR1_1477_TICK(t)
+# define BFI_FLINEAR1_1476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1475, v ds
+# define BFI_FLINEAR1_1476_TICK(t)
+# define BFI_FLINEAR1_1475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1474, v ds
+# define BFI_FLINEAR1_1475_TICK(t)
+# define BFI_FLINEAR1_1474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1473, v ds
+# define BFI_FLINEAR1_1474_TICK(t)
+# define BFI_FLINEAR1_1473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1472, v ds
+# define BFI_FLINEAR1_1473_TICK(t)
+# define BFI_FLINEAR1_1472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1471, v ds
+# define BFI_FLINEAR1_1472_TICK(t)
+# define BFI_FLINEAR1_1471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1470, v ds
+# define BFI_FLINEAR1_1471_TICK(t)
+# define BFI_FLINEAR1_1470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1469, v ds
+# define BFI_FLINEAR1_1470_TICK(t)
+# define BFI_FLINEAR1_1469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1468, v ds
+# define BFI_FLINEAR1_1469_TICK(t)
+# define BFI_FLINEAR1_1468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1467, v ds
+# define BFI_FLINEAR1_1468_TICK(t)
+# define BFI_FLINEAR1_1467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1466, v ds
+# define BFI_FLINEAR1_1467_TICK(t)
+# define BFI_FLINEAR1_1466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1465, v ds
+# define BFI_FLINEAR1_1466_TICK(t)
+# define BFI_FLINEAR1_1465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1464, v ds
+# define BFI_FLINEAR1_1465_TICK(t)
+# define BFI_FLINEAR1_1464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1463, v ds
+# define BFI_FLINEAR1_1464_TICK(t)
+# define BFI_FLINEAR1_1463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1462, v ds
+# define BFI_FLINEAR1_1463_TICK(t)
+# define BFI_FLINEAR1_1462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1461, v ds
+# define BFI_FLINEAR1_1462_TICK(t)
+# define BFI_FLINEAR1_1461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1460, v ds
+# define BFI_FLINEAR1_1461_TICK(t)
+# define BFI_FLINEAR1_1460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1459, v ds
+# define BFI_FLINEAR1_1460_TICK(t)
+# define BFI_FLINEAR1_1459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1458, v ds
+# define BFI_FLINEAR1_1459_TICK(t)
+# define BFI_FLINEAR1_1458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1457, v ds
+# define BFI_FLINEAR1_1458_TICK(t)
+# define BFI_FLINEAR1_1457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1456, v ds
+# define BFI_FLINEAR1_1457_TICK(t)
+# define BFI_FLINEAR1_1456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1455, v ds
+# define BFI_FLINEAR1_1456_TICK(t)
+# define BFI_FLINEAR1_1455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1454, v ds
+# define BFI_FLINEAR1_1455_TICK(t)
+# define BFI_FLINEAR1_1454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1453, v ds
+# define BFI_FLINEAR1_1454_TICK(t)
+# define BFI_FLINEAR1_1453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1452, v ds
+# define BFI_FLINEAR1_1453_TICK(t)
+# define BFI_FLINEAR1_1452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1451, v ds
+# define BFI_FLINEAR1_1452_TICK(t)
+# define BFI_FLINEAR1_1451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1450, v ds
+# define BFI_FLINEAR1_1451_TICK(t)
+# define BFI_FLINEAR1_1450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1449, v ds
+# define BFI_FLINEAR1_1450_TICK(t)
+# define BFI_FLINEAR1_1449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1448, v ds
+# define BFI_FLINEAR1_1449_TICK(t)
+# define BFI_FLINEAR1_1448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1447, v ds
+# define BFI_FLINEAR1_1448_TICK(t)
+# define BFI_FLINEAR1_1447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1446, v ds
+# define BFI_FLINEAR1_1447_TICK(t)
+# define BFI_FLINEAR1_1446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1445, v ds
+# define BFI_FLINEAR1_1446_TICK(t)
+# define BFI_FLINEAR1_1445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1444, v ds
+# define BFI_FLINEAR1_1445_TICK(t)
+# define BFI_FLINEAR1_1444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1443, v ds
+# define BFI_FLINEAR1_1444_TICK(t)
+# define BFI_FLINEAR1_1443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1442, v ds
+# define BFI_FLINEAR1_1443_TICK(t)
+# define BFI_FLINEAR1_1442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1441, v ds
+# define BFI_FLINEAR1_1442_TICK(t)
+# define BFI_FLINEAR1_1441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1440, v ds
+# define BFI_FLINEAR1_1441_TICK(t)
+# define BFI_FLINEAR1_1440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1439, v ds
+# define BFI_FLINEAR1_1440_TICK(t)
+# define BFI_FLINEAR1_1439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1438, v ds
+# define BFI_FLINEAR1_1439_TICK(t)
+# define BFI_FLINEAR1_1438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1437, v ds
+# define BFI_FLINEAR1_1438_TICK(t)
+# define BFI_FLINEAR1_1437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1436, v ds
+# define BFI_FLINEAR1_1437_TICK(t)
+# define BFI_FLINEAR1_1436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1435, v ds
+# define BFI_FLINEAR1_1436_TICK(t)
+# define BFI_FLINEAR1_1435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1434, v ds
+# define BFI_FLINEAR1_1435_TICK(t)
+# define BFI_FLINEAR1_1434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1433, v ds
+# define BFI_FLINEAR1_1434_TICK(t)
+# define BFI_FLINEAR1_1433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1432, v ds
+# define BFI_FLINEAR1_1433_TICK(t)
+# define BFI_FLINEAR1_1432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1431, v ds
+# define BFI_FLINEAR1_1432_TICK(t)
+# define BFI_FLINEAR1_1431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1430, v ds
+# define BFI_FLINEAR1_1431_TICK(t)
+# define BFI_FLINEAR1_1430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1429, v ds
+# define BFI_FLINEAR1_1430_TICK(t)
+# define BFI_FLINEAR1_1429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1428, v ds
+# define BFI_FLINEAR1_1429_TICK(t)
+# define BFI_FLINEAR1_1428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1427, v ds
+# define BFI_FLINEAR1_1428_TICK(t)
+# define BFI_FLINEAR1_1427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1426, v ds
+# define BFI_FLINEAR1_1427_TICK(t)
+# define BFI_FLINEAR1_1426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1425, v ds
+# define BFI_FLINEAR1_1426_TICK(t)
+# define BFI_FLINEAR1_1425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1424, v ds
+# define BFI_FLINEAR1_1425_TICK(t)
+# define BFI_FLINEAR1_1424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1423, v ds
+# define BFI_FLINEAR1_1424_TICK(t)
+# define BFI_FLINEAR1_1423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1422, v ds
+# define BFI_FLINEAR1_1423_TICK(t)
+# define BFI_FLINEAR1_1422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1421, v ds
+# define BFI_FLINEAR1_1422_TICK(t)
+# define BFI_FLINEAR1_1421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1420, v ds
+# define BFI_FLINEAR1_1421_TICK(t)
+# define BFI_FLINEAR1_1420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1419, v ds
+# define BFI_FLINEAR1_1420_TICK(t)
+# define BFI_FLINEAR1_1419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1418, v ds
+# define BFI_FLINEAR1_1419_TICK(t)
+# define BFI_FLINEAR1_1418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1417, v ds
+# define BFI_FLINEAR1_1418_TICK(t)
+# define BFI_FLINEAR1_1417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1416, v ds
+# define BFI_FLINEAR1_1417_TICK(t)
+# define BFI_FLINEAR1_1416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1415, v ds
+# define BFI_FLINEAR1_1416_TICK(t)
+# define BFI_FLINEAR1_1415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1414, v ds
+# define BFI_FLINEAR1_1415_TICK(t)
+# define BFI_FLINEAR1_1414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1413, v ds
+# define BFI_FLINEAR1_1414_TICK(t)
+# define BFI_FLINEAR1_1413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1412, v ds
+# define BFI_FLINEAR1_1413_TICK(t)
+# define BFI_FLINEAR1_1412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1411, v ds
+# define BFI_FLINEAR1_1412_TICK(t)
+# define BFI_FLINEAR1_1411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1410, v ds
+# define BFI_FLINEAR1_1411_TICK(t)
+# define BFI_FLINEAR1_1410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1409, v ds
+# define BFI_FLINEAR1_1410_TICK(t)
+# define BFI_FLINEAR1_1409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1408, v ds
+# define BFI_FLINEAR1_1409_TICK(t)
+# define BFI_FLINEAR1_1408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1407, v ds
+# define BFI_FLINEAR1_1408_TICK(t)
+# define BFI_FLINEAR1_1407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1406, v ds
+# define BFI_FLINEAR1_1407_TICK(t)
+# define BFI_FLINEAR1_1406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1405, v ds
+# define BFI_FLINEAR1_1406_TICK(t)
+# define BFI_FLINEAR1_1405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1404, v ds
+# define BFI_FLINEAR1_1405_TICK(t)
+# define BFI_FLINEAR1_1404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1403, v ds
+# define BFI_FLINEAR1_1404_TICK(t)
+# define BFI_FLINEAR1_1403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1402, v ds
+# define BFI_FLINEAR1_1403_TICK(t)
+# define BFI_FLINEAR1_1402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1401, v ds
+# define BFI_FLINEAR1_1402_TICK(t)
+# define BFI_FLINEAR1_1401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1400, v ds
+# define BFI_FLINEAR1_1401_TICK(t)
+# define BFI_FLINEAR1_1400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1399, v ds
+# define BFI_FLINEAR1_1400_TICK(t)
+# define BFI_FLINEAR1_1399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1398, v ds
+# define BFI_FLINEAR1_1399_TICK(t)
+# define BFI_FLINEAR1_1398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1397, v ds
+# define BFI_FLINEAR1_1398_TICK(t)
+# define BFI_FLINEAR1_1397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1396, v ds
+# define BFI_FLINEAR1_1397_TICK(t)
+# define BFI_FLINEAR1_1396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1395, v ds
+# define BFI_FLINEAR1_1396_TICK(t)
+# define BFI_FLINEAR1_1395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1394, v ds
+# define BFI_FLINEAR1_1395_TICK(t)
+# define BFI_FLINEAR1_1394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1393, v ds
+# define BFI_FLINEAR1_1394_TICK(t)
+# define BFI_FLINEAR1_1393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1392, v ds
+# define BFI_FLINEAR1_1393_TICK(t)
+# define BFI_FLINEAR1_1392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1391, v ds
+# define BFI_FLINEAR1_1392_TICK(t)
+# define BFI_FLINEAR1_1391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1390, v ds
+# define BFI_FLINEAR1_1391_TICK(t)
+# define BFI_FLINEAR1_1390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1389, v ds
+# define BFI_FLINEAR1_1390_TICK(t)
+# define BFI_FLINEAR1_1389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1388, v ds
+# define BFI_FLINEAR1_1389_TICK(t)
+# define BFI_FLINEAR1_1388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1387, v ds
+# define BFI_FLINEAR1_1388_TICK(t)
+# define BFI_FLINEAR1_1387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1386, v ds
+# define BFI_FLINEAR1_1387_TICK(t)
+# define BFI_FLINEAR1_1386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1385, v ds
+# define BFI_FLINEAR1_1386_TICK(t)
+# define BFI_FLINEAR1_1385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1384, v ds
+# define BFI_FLINEAR1_1385_TICK(t)
+# define BFI_FLINEAR1_1384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1383, v ds
+# define BFI_FLINEAR1_1384_TICK(t)
+# define BFI_FLINEAR1_1383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1382, v ds
+# define BFI_FLINEAR1_1383_TICK(t)
+# define BFI_FLINEAR1_1382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1381, v ds
+# define BFI_FLINEAR1_1382_TICK(t)
+# define BFI_FLINEAR1_1381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1380, v ds
+# define BFI_FLINEAR1_1381_TICK(t)
+# define BFI_FLINEAR1_1380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1379, v ds
+# define BFI_FLINEAR1_1380_TICK(t)
+# define BFI_FLINEAR1_1379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1378, v ds
+# define BFI_FLINEAR1_1379_TICK(t)
+# define BFI_FLINEAR1_1378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1377, v ds
+# define BFI_FLINEAR1_1378_TICK(t)
+# define BFI_FLINEAR1_1377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1376, v ds
+# define BFI_FLINEAR1_1377_TICK(t)
+# define BFI_FLINEAR1_1376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1375, v ds
+# define BFI_FLINEAR1_1376_TICK(t)
+# define BFI_FLINEAR1_1375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1374, v ds
+# define BFI_FLINEAR1_1375_TICK(t)
+# define BFI_FLINEAR1_1374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1373, v ds
+# define BFI_FLINEAR1_1374_TICK(t)
+# define BFI_FLINEAR1_1373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1372, v ds
+# define BFI_FLINEAR1_1373_TICK(t)
+# define BFI_FLINEAR1_1372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1371, v ds
+# define BFI_FLINEAR1_1372_TICK(t)
+# define BFI_FLINEAR1_1371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1370, v ds
+# define BFI_FLINEAR1_1371_TICK(t)
+# define BFI_FLINEAR1_1370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1369, v ds
+# define BFI_FLINEAR1_1370_TICK(t)
+# define BFI_FLINEAR1_1369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1368, v ds
+# define BFI_FLINEAR1_1369_TICK(t)
+# define BFI_FLINEAR1_1368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1367, v ds
+# define BFI_FLINEAR1_1368_TICK(t)
+# define BFI_FLINEAR1_1367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1366, v ds
+# define BFI_FLINEAR1_1367_TICK(t)
+# define BFI_FLINEAR1_1366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1365, v ds
+# define BFI_FLINEAR1_1366_TICK(t)
+# define BFI_FLINEAR1_1365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1364, v ds
+# define BFI_FLINEAR1_1365_TICK(t)
+# define BFI_FLINEAR1_1364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1363, v ds
+# define BFI_FLINEAR1_1364_TICK(t)
+# define BFI_FLINEAR1_1363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1362, v ds
+# define BFI_FLINEAR1_1363_TICK(t)
+# define BFI_FLINEAR1_1362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1361, v ds
+# define BFI_FLINEAR1_1362_TICK(t)
+# define BFI_FLINEAR1_1361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1360, v ds
+# define BFI_FLINEAR1_1361_TICK(t)
+# define BFI_FLINEAR1_1360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1359, v ds
+# define BFI_FLINEAR1_1360_TICK(t)
+# define BFI_FLINEAR1_1359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1358, v ds
+# define BFI_FLINEAR1_1359_TICK(t)
+# define BFI_FLINEAR1_1358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1357, v ds
+# define BFI_FLINEAR1_1358_TICK(t)
+# define BFI_FLINEAR1_1357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1356, v ds
+# define BFI_FLINEAR1_1357_TICK(t)
+# define BFI_FLINEAR1_1356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1355, v ds
+# define BFI_FLINEAR1_1356_TICK(t)
+# define BFI_FLINEAR1_1355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1354, v ds
+# define BFI_FLINEAR1_1355_TICK(t)
+# define BFI_FLINEAR1_1354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1353, v ds
+# define BFI_FLINEAR1_1354_TICK(t)
+# define BFI_FLINEAR1_1353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1352, v ds
+# define BFI_FLINEAR1_1353_TICK(t)
+# define BFI_FLINEAR1_1352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1351, v ds
+# define BFI_FLINEAR1_1352_TICK(t)
+# define BFI_FLINEAR1_1351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1350, v ds
+# define BFI_FLINEAR1_1351_TICK(t)
+# define BFI_FLINEAR1_1350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1349, v ds
+# define BFI_FLINEAR1_1350_TICK(t)
+# define BFI_FLINEAR1_1349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1348, v ds
+# define BFI_FLINEAR1_1349_TICK(t)
+# define BFI_FLINEAR1_1348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1347, v ds
+# define BFI_FLINEAR1_1348_TICK(t)
+# define BFI_FLINEAR1_1347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1346, v ds
+# define BFI_FLINEAR1_1347_TICK(t)
+# define BFI_FLINEAR1_1346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1345, v ds
+# define BFI_FLINEAR1_1346_TICK(t)
+# define BFI_FLINEAR1_1345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1344, v ds
+# define BFI_FLINEAR1_1345_TICK(t)
+# define BFI_FLINEAR1_1344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1343, v ds
+# define BFI_FLINEAR1_1344_TICK(t)
+# define BFI_FLINEAR1_1343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1342, v ds
+# define BFI_FLINEAR1_1343_TICK(t)
+# define BFI_FLINEAR1_1342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1341, v ds
+# define BFI_FLINEAR1_1342_TICK(t)
+# define BFI_FLINEAR1_1341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1340, v ds
+# define BFI_FLINEAR1_1341_TICK(t)
+# define BFI_FLINEAR1_1340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1339, v ds
+# define BFI_FLINEAR1_1340_TICK(t)
+# define BFI_FLINEAR1_1339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1338, v ds
+# define BFI_FLINEAR1_1339_TICK(t)
+# define BFI_FLINEAR1_1338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1337, v ds
+# define BFI_FLINEAR1_1338_TICK(t)
+# define BFI_FLINEAR1_1337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1336, v ds
+# define BFI_FLINEAR1_1337_TICK(t)
+# define BFI_FLINEAR1_1336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1335, v ds
+# define BFI_FLINEAR1_1336_TICK(t)
+# define BFI_FLINEAR1_1335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1334, v ds
+# define BFI_FLINEAR1_1335_TICK(t)
+# define BFI_FLINEAR1_1334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1333, v ds
+# define BFI_FLINEAR1_1334_TICK(t)
+# define BFI_FLINEAR1_1333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1332, v ds
+# define BFI_FLINEAR1_1333_TICK(t)
+# define BFI_FLINEAR1_1332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1331, v ds
+# define BFI_FLINEAR1_1332_TICK(t)
+# define BFI_FLINEAR1_1331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1330, v ds
+# define BFI_FLINEAR1_1331_TICK(t)
+# define BFI_FLINEAR1_1330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1329, v ds
+# define BFI_FLINEAR1_1330_TICK(t)
+# define BFI_FLINEAR1_1329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1328, v ds
+# define BFI_FLINEAR1_1329_TICK(t)
+# define BFI_FLINEAR1_1328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1327, v ds
+# define BFI_FLINEAR1_1328_TICK(t)
+# define BFI_FLINEAR1_1327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1326, v ds
+# define BFI_FLINEAR1_1327_TICK(t)
+# define BFI_FLINEAR1_1326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1325, v ds
+# define BFI_FLINEAR1_1326_TICK(t)
+# define BFI_FLINEAR1_1325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1324, v ds
+# define BFI_FLINEAR1_1325_TICK(t)
+# define BFI_FLINEAR1_1324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1323, v ds
+# define BFI_FLINEAR1_1324_TICK(t)
+# define BFI_FLINEAR1_1323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1322, v ds
+# define BFI_FLINEAR1_1323_TICK(t)
+# define BFI_FLINEAR1_1322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1321, v ds
+# define BFI_FLINEAR1_1322_TICK(t)
+# define BFI_FLINEAR1_1321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1320, v ds
+# define BFI_FLINEAR1_1321_TICK(t)
+# define BFI_FLINEAR1_1320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1319, v ds
+# define BFI_FLINEAR1_1320_TICK(t)
+# define BFI_FLINEAR1_1319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1318, v ds
+# define BFI_FLINEAR1_1319_TICK(t)
+# define BFI_FLINEAR1_1318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1317, v ds
+# define BFI_FLINEAR1_1318_TICK(t)
+# define BFI_FLINEAR1_1317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1316, v ds
+# define BFI_FLINEAR1_1317_TICK(t)
+# define BFI_FLINEAR1_1316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1315, v ds
+# define BFI_FLINEAR1_1316_TICK(t)
+# define BFI_FLINEAR1_1315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1314, v ds
+# define BFI_FLINEAR1_1315_TICK(t)
+# define BFI_FLINEAR1_1314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1313, v ds
+# define BFI_FLINEAR1_1314_TICK(t)
+# define BFI_FLINEAR1_1313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1312, v ds
+# define BFI_FLINEAR1_1313_TICK(t)
+# define BFI_FLINEAR1_1312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1311, v ds
+# define BFI_FLINEAR1_1312_TICK(t)
+# define BFI_FLINEAR1_1311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1310, v ds
+# define BFI_FLINEAR1_1311_TICK(t)
+# define BFI_FLINEAR1_1310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1309, v ds
+# define BFI_FLINEAR1_1310_TICK(t)
+# define BFI_FLINEAR1_1309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1308, v ds
+# define BFI_FLINEAR1_1309_TICK(t)
+# define BFI_FLINEAR1_1308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1307, v ds
+# define BFI_FLINEAR1_1308_TICK(t)
+# define BFI_FLINEAR1_1307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1306, v ds
+# define BFI_FLINEAR1_1307_TICK(t)
+# define BFI_FLINEAR1_1306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1305, v ds
+# define BFI_FLINEAR1_1306_TICK(t)
+# define BFI_FLINEAR1_1305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1304, v ds
+# define BFI_FLINEAR1_1305_TICK(t)
+# define BFI_FLINEAR1_1304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1303, v ds
+# define BFI_FLINEAR1_1304_TICK(t)
+# define BFI_FLINEAR1_1303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1302, v ds
+# define BFI_FLINEAR1_1303_TICK(t)
+# define BFI_FLINEAR1_1302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1301, v ds
+# define BFI_FLINEAR1_1302_TICK(t)
+# define BFI_FLINEAR1_1301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1300, v ds
+# define BFI_FLINEAR1_1301_TICK(t)
+# define BFI_FLINEAR1_1300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1299, v ds
+# define BFI_FLINEAR1_1300_TICK(t)
+# define BFI_FLINEAR1_1299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1298, v ds
+# define BFI_FLINEAR1_1299_TICK(t)
+# define BFI_FLINEAR1_1298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1297, v ds
+# define BFI_FLINEAR1_1298_TICK(t)
+# define BFI_FLINEAR1_1297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1296, v ds
+# define BFI_FLINEAR1_1297_TICK(t)
+# define BFI_FLINEAR1_1296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1295, v ds
+# define BFI_FLINEAR1_1296_TICK(t)
+# define BFI_FLINEAR1_1295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1294, v ds
+# define BFI_FLINEAR1_1295_TICK(t)
+# define BFI_FLINEAR1_1294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1293, v ds
+# define BFI_FLINEAR1_1294_TICK(t)
+# define BFI_FLINEAR1_1293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1292, v ds
+# define BFI_FLINEAR1_1293_TICK(t)
+# define BFI_FLINEAR1_1292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1291, v ds
+# define BFI_FLINEAR1_1292_TICK(t)
+# define BFI_FLINEAR1_1291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1290, v ds
+# define BFI_FLINEAR1_1291_TICK(t)
+# define BFI_FLINEAR1_1290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1289, v ds
+# define BFI_FLINEAR1_1290_TICK(t)
+# define BFI_FLINEAR1_1289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1288, v ds
+# define BFI_FLINEAR1_1289_TICK(t)
+# define BFI_FLINEAR1_1288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1287, v ds
+# define BFI_FLINEAR1_1288_TICK(t)
+# define BFI_FLINEAR1_1287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1286, v ds
+# define BFI_FLINEAR1_1287_TICK(t)
+# define BFI_FLINEAR1_1286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1285, v ds
+# define BFI_FLINEAR1_1286_TICK(t)
+# define BFI_FLINEAR1_1285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1284, v ds
+# define BFI_FLINEAR1_1285_TICK(t)
+# define BFI_FLINEAR1_1284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1283, v ds
+# define BFI_FLINEAR1_1284_TICK(t)
+# define BFI_FLINEAR1_1283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1282, v ds
+# define BFI_FLINEAR1_1283_TICK(t)
+# define BFI_FLINEAR1_1282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1281, v ds
+# define BFI_FLINEAR1_1282_TICK(t)
+# define BFI_FLINEAR1_1281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1280, v ds
+# define BFI_FLINEAR1_1281_TICK(t)
+# define BFI_FLINEAR1_1280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1279, v ds
+# define BFI_FLINEAR1_1280_TICK(t)
+# define BFI_FLINEAR1_1279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1278, v ds
+# define BFI_FLINEAR1_1279_TICK(t)
+# define BFI_FLINEAR1_1278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1277, v ds
+# define BFI_FLINEAR1_1278_TICK(t)
+# define BFI_FLINEAR1_1277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1276, v ds
+# define BFI_FLINEAR1_1277_TICK(t)
+# define BFI_FLINEAR1_1276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1275, v ds
+# define BFI_FLINEAR1_1276_TICK(t)
+# define BFI_FLINEAR1_1275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1274, v ds
+# define BFI_FLINEAR1_1275_TICK(t)
+# define BFI_FLINEAR1_1274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1273, v ds
+# define BFI_FLINEAR1_1274_TICK(t)
+# define BFI_FLINEAR1_1273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1272, v ds
+# define BFI_FLINEAR1_1273_TICK(t)
+# define BFI_FLINEAR1_1272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1271, v ds
+# define BFI_FLINEAR1_1272_TICK(t)
+# define BFI_FLINEAR1_1271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1270, v ds
+# define BFI_FLINEAR1_1271_TICK(t)
+# define BFI_FLINEAR1_1270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1269, v ds
+# define BFI_FLINEAR1_1270_TICK(t)
+# define BFI_FLINEAR1_1269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1268, v ds
+# define BFI_FLINEAR1_1269_TICK(t)
+# define BFI_FLINEAR1_1268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1267, v ds
+# define BFI_FLINEAR1_1268_TICK(t)
+# define BFI_FLINEAR1_1267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1266, v ds
+# define BFI_FLINEAR1_1267_TICK(t)
+# define BFI_FLINEAR1_1266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1265, v ds
+# define BFI_FLINEAR1_1266_TICK(t)
+# define BFI_FLINEAR1_1265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1264, v ds
+# define BFI_FLINEAR1_1265_TICK(t)
+# define BFI_FLINEAR1_1264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1263, v ds
+# define BFI_FLINEAR1_1264_TICK(t)
+# define BFI_FLINEAR1_1263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1262, v ds
+# define BFI_FLINEAR1_1263_TICK(t)
+# define BFI_FLINEAR1_1262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1261, v ds
+# define BFI_FLINEAR1_1262_TICK(t)
+# define BFI_FLINEAR1_1261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1260, v ds
+# define BFI_FLINEAR1_1261_TICK(t)
+# define BFI_FLINEAR1_1260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1259, v ds
+# define BFI_FLINEAR1_1260_TICK(t)
+# define BFI_FLINEAR1_1259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1258, v ds
+# define BFI_FLINEAR1_1259_TICK(t)
+# define BFI_FLINEAR1_1258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1257, v ds
+# define BFI_FLINEAR1_1258_TICK(t)
+# define BFI_FLINEAR1_1257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1256, v ds
+# define BFI_FLINEAR1_1257_TICK(t)
+# define BFI_FLINEAR1_1256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1255, v ds
+# define BFI_FLINEAR1_1256_TICK(t)
+# define BFI_FLINEAR1_1255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1254, v ds
+# define BFI_FLINEAR1_1255_TICK(t)
+# define BFI_FLINEAR1_1254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1253, v ds
+# define BFI_FLINEAR1_1254_TICK(t)
+# define BFI_FLINEAR1_1253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1252, v ds
+# define BFI_FLINEAR1_1253_TICK(t)
+# define BFI_FLINEAR1_1252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1251, v ds
+# define BFI_FLINEAR1_1252_TICK(t)
+# define BFI_FLINEAR1_1251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1250, v ds
+# define BFI_FLINEAR1_1251_TICK(t)
+# define BFI_FLINEAR1_1250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1249, v ds
+# define BFI_FLINEAR1_1250_TICK(t)
+# define BFI_FLINEAR1_1249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1248, v ds
+# define BFI_FLINEAR1_1249_TICK(t)
+# define BFI_FLINEAR1_1248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1247, v ds
+# define BFI_FLINEAR1_1248_TICK(t)
+# define BFI_FLINEAR1_1247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1246, v ds
+# define BFI_FLINEAR1_1247_TICK(t)
+# define BFI_FLINEAR1_1246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1245, v ds
+# define BFI_FLINEAR1_1246_TICK(t)
+# define BFI_FLINEAR1_1245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1244, v ds
+# define BFI_FLINEAR1_1245_TICK(t)
+# define BFI_FLINEAR1_1244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1243, v ds
+# define BFI_FLINEAR1_1244_TICK(t)
+# define BFI_FLINEAR1_1243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1242, v ds
+# define BFI_FLINEAR1_1243_TICK(t)
+# define BFI_FLINEAR1_1242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1241, v ds
+# define BFI_FLINEAR1_1242_TICK(t)
+# define BFI_FLINEAR1_1241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1240, v ds
+# define BFI_FLINEAR1_1241_TICK(t)
+# define BFI_FLINEAR1_1240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1239, v ds
+# define BFI_FLINEAR1_1240_TICK(t)
+# define BFI_FLINEAR1_1239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1238, v ds
+# define BFI_FLINEAR1_1239_TICK(t)
+# define BFI_FLINEAR1_1238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1237, v ds
+# define BFI_FLINEAR1_1238_TICK(t)
+# define BFI_FLINEAR1_1237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1236, v ds
+# define BFI_FLINEAR1_1237_TICK(t)
+# define BFI_FLINEAR1_1236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1235, v ds
+# define BFI_FLINEAR1_1236_TICK(t)
+# define BFI_FLINEAR1_1235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1234, v ds
+# define BFI_FLINEAR1_1235_TICK(t)
+# define BFI_FLINEAR1_1234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1233, v ds
+# define BFI_FLINEAR1_1234_TICK(t)
+# define BFI_FLINEAR1_1233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1232, v ds
+# define BFI_FLINEAR1_1233_TICK(t)
+# define BFI_FLINEAR1_1232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1231, v ds
+# define BFI_FLINEAR1_1232_TICK(t)
+# define BFI_FLINEAR1_1231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1230, v ds
+# define BFI_FLINEAR1_1231_TICK(t)
+# define BFI_FLINEAR1_1230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1229, v ds
+# define BFI_FLINEAR1_1230_TICK(t)
+# define BFI_FLINEAR1_1229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1228, v ds
+# define BFI_FLINEAR1_1229_TICK(t)
+# define BFI_FLINEAR1_1228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1227, v ds
+# define BFI_FLINEAR1_1228_TICK(t)
+# define BFI_FLINEAR1_1227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1226, v ds
+# define BFI_FLINEAR1_1227_TICK(t)
+# define BFI_FLINEAR1_1226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1225, v ds
+# define BFI_FLINEAR1_1226_TICK(t)
+# define BFI_FLINEAR1_1225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1224, v ds
+# define BFI_FLINEAR1_1225_TICK(t)
+# define BFI_FLINEAR1_1224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1223, v ds
+# define BFI_FLINEAR1_1224_TICK(t)
+# define BFI_FLINEAR1_1223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1222, v ds
+# define BFI_FLINEAR1_1223_TICK(t)
+# define BFI_FLINEAR1_1222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1221, v ds
+# define BFI_FLINEAR1_1222_TICK(t)
+# define BFI_FLINEAR1_1221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1220, v ds
+# define BFI_FLINEAR1_1221_TICK(t)
+# define BFI_FLINEAR1_1220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1219, v ds
+# define BFI_FLINEAR1_1220_TICK(t)
+# define BFI_FLINEAR1_1219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1218, v ds
+# define BFI_FLINEAR1_1219_TICK(t)
+# define BFI_FLINEAR1_1218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1217, v ds
+# define BFI_FLINEAR1_1218_TICK(t)
+# define BFI_FLINEAR1_1217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1216, v ds
+# define BFI_FLINEAR1_1217_TICK(t)
+# define BFI_FLINEAR1_1216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1215, v ds
+# define BFI_FLINEAR1_1216_TICK(t)
+# define BFI_FLINEAR1_1215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1214, v ds
+# define BFI_FLINEAR1_1215_TICK(t)
+# define BFI_FLINEAR1_1214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1213, v ds
+# define BFI_FLINEAR1_1214_TICK(t)
+# define BFI_FLINEAR1_1213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1212, v ds
+# define BFI_FLINEAR1_1213_TICK(t)
+# define BFI_FLINEAR1_1212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1211, v ds
+# define BFI_FLINEAR1_1212_TICK(t)
+# define BFI_FLINEAR1_1211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1210, v ds
+# define BFI_FLINEAR1_1211_TICK(t)
+# define BFI_FLINEAR1_1210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1209, v ds
+# define BFI_FLINEAR1_1210_TICK(t)
+# define BFI_FLINEAR1_1209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1208, v ds
+# define BFI_FLINEAR1_1209_TICK(t)
+# define BFI_FLINEAR1_1208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1207, v ds
+# define BFI_FLINEAR1_1208_TICK(t)
+# define BFI_FLINEAR1_1207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1206, v ds
+# define BFI_FLINEAR1_1207_TICK(t)
+# define BFI_FLINEAR1_1206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1205, v ds
+# define BFI_FLINEAR1_1206_TICK(t)
+# define BFI_FLINEAR1_1205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1204, v ds
+# define BFI_FLINEAR1_1205_TICK(t)
+# define BFI_FLINEAR1_1204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1203, v ds
+# define BFI_FLINEAR1_1204_TICK(t)
+# define BFI_FLINEAR1_1203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1202, v ds
+# define BFI_FLINEAR1_1203_TICK(t)
+# define BFI_FLINEAR1_1202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1201, v ds
+# define BFI_FLINEAR1_1202_TICK(t)
+# define BFI_FLINEAR1_1201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1200, v ds
+# define BFI_FLINEAR1_1201_TICK(t)
+# define BFI_FLINEAR1_1200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1199, v ds
+# define BFI_FLINEAR1_1200_TICK(t)
+# define BFI_FLINEAR1_1199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1198, v ds
+# define BFI_FLINEAR1_1199_TICK(t)
+# define BFI_FLINEAR1_1198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1197, v ds
+# define BFI_FLINEAR1_1198_TICK(t)
+# define BFI_FLINEAR1_1197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1196, v ds
+# define BFI_FLINEAR1_1197_TICK(t)
+# define BFI_FLINEAR1_1196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1195, v ds
+# define BFI_FLINEAR1_1196_TICK(t)
+# define BFI_FLINEAR1_1195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1194, v ds
+# define BFI_FLINEAR1_1195_TICK(t)
+# define BFI_FLINEAR1_1194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1193, v ds
+# define BFI_FLINEAR1_1194_TICK(t)
+# define BFI_FLINEAR1_1193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1192, v ds
+# define BFI_FLINEAR1_1193_TICK(t)
+# define BFI_FLINEAR1_1192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1191, v ds
+# define BFI_FLINEAR1_1192_TICK(t)
+# define BFI_FLINEAR1_1191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1190, v ds
+# define BFI_FLINEAR1_1191_TICK(t)
+# define BFI_FLINEAR1_1190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1189, v ds
+# define BFI_FLINEAR1_1190_TICK(t)
+# define BFI_FLINEAR1_1189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1188, v ds
+# define BFI_FLINEAR1_1189_TICK(t)
+# define BFI_FLINEAR1_1188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1187, v ds
+# define BFI_FLINEAR1_1188_TICK(t)
+# define BFI_FLINEAR1_1187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1186, v ds
+# define BFI_FLINEAR1_1187_TICK(t)
+# define BFI_FLINEAR1_1186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1185, v ds
+# define BFI_FLINEAR1_1186_TICK(t)
+# define BFI_FLINEAR1_1185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1184, v ds
+# define BFI_FLINEAR1_1185_TICK(t)
+# define BFI_FLINEAR1_1184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1183, v ds
+# define BFI_FLINEAR1_1184_TICK(t)
+# define BFI_FLINEAR1_1183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1182, v ds
+# define BFI_FLINEAR1_1183_TICK(t)
+# define BFI_FLINEAR1_1182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1181, v ds
+# define BFI_FLINEAR1_1182_TICK(t)
+# define BFI_FLINEAR1_1181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1180, v ds
+# define BFI_FLINEAR1_1181_TICK(t)
+# define BFI_FLINEAR1_1180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1179, v ds
+# define BFI_FLINEAR1_1180_TICK(t)
+# define BFI_FLINEAR1_1179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1178, v ds
+# define BFI_FLINEAR1_1179_TICK(t)
+# define BFI_FLINEAR1_1178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1177, v ds
+# define BFI_FLINEAR1_1178_TICK(t)
+# define BFI_FLINEAR1_1177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1176, v ds
+# define BFI_FLINEAR1_1177_TICK(t)
+# define BFI_FLINEAR1_1176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1175, v ds
+# define BFI_FLINEAR1_1176_TICK(t)
+# define BFI_FLINEAR1_1175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1174, v ds
+# define BFI_FLINEAR1_1175_TICK(t)
+# define BFI_FLINEAR1_1174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1173, v ds
+# define BFI_FLINEAR1_1174_TICK(t)
+# define BFI_FLINEAR1_1173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1172, v ds
+# define BFI_FLINEAR1_1173_TICK(t)
+# define BFI_FLINEAR1_1172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1171, v ds
+# define BFI_FLINEAR1_1172_TICK(t)
+# define BFI_FLINEAR1_1171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1170, v ds
+# define BFI_FLINEAR1_1171_TICK(t)
+# define BFI_FLINEAR1_1170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1169, v ds
+# define BFI_FLINEAR1_1170_TICK(t)
+# define BFI_FLINEAR1_1169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1168, v ds
+# define BFI_FLINEAR1_1169_TICK(t)
+# define BFI_FLINEAR1_1168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1167, v ds
+# define BFI_FLINEAR1_1168_TICK(t)
+# define BFI_FLINEAR1_1167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1166, v ds
+# define BFI_FLINEAR1_1167_TICK(t)
+# define BFI_FLINEAR1_1166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1165, v ds
+# define BFI_FLINEAR1_1166_TICK(t)
+# define BFI_FLINEAR1_1165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1164, v ds
+# define BFI_FLINEAR1_1165_TICK(t)
+# define BFI_FLINEAR1_1164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1163, v ds
+# define BFI_FLINEAR1_1164_TICK(t)
+# define BFI_FLINEAR1_1163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1162, v ds
+# define BFI_FLINEAR1_1163_TICK(t)
+# define BFI_FLINEAR1_1162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1161, v ds
+# define BFI_FLINEAR1_1162_TICK(t)
+# define BFI_FLINEAR1_1161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1160, v ds
+# define BFI_FLINEAR1_1161_TICK(t)
+# define BFI_FLINEAR1_1160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1159, v ds
+# define BFI_FLINEAR1_1160_TICK(t)
+# define BFI_FLINEAR1_1159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1158, v ds
+# define BFI_FLINEAR1_1159_TICK(t)
+# define BFI_FLINEAR1_1158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1157, v ds
+# define BFI_FLINEAR1_1158_TICK(t)
+# define BFI_FLINEAR1_1157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1156, v ds
+# define BFI_FLINEAR1_1157_TICK(t)
+# define BFI_FLINEAR1_1156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1155, v ds
+# define BFI_FLINEAR1_1156_TICK(t)
+# define BFI_FLINEAR1_1155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1154, v ds
+# define BFI_FLINEAR1_1155_TICK(t)
+# define BFI_FLINEAR1_1154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1153, v ds
+# define BFI_FLINEAR1_1154_TICK(t)
+# define BFI_FLINEAR1_1153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1152, v ds
+# define BFI_FLINEAR1_1153_TICK(t)
+# define BFI_FLINEAR1_1152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1151, v ds
+# define BFI_FLINEAR1_1152_TICK(t)
+# define BFI_FLINEAR1_1151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1150, v ds
+# define BFI_FLINEAR1_1151_TICK(t)
+# define BFI_FLINEAR1_1150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1149, v ds
+# define BFI_FLINEAR1_1150_TICK(t)
+# define BFI_FLINEAR1_1149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1148, v ds
+# define BFI_FLINEAR1_1149_TICK(t)
+# define BFI_FLINEAR1_1148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1147, v ds
+# define BFI_FLINEAR1_1148_TICK(t)
+# define BFI_FLINEAR1_1147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1146, v ds
+# define BFI_FLINEAR1_1147_TICK(t)
+# define BFI_FLINEAR1_1146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1145, v ds
+# define BFI_FLINEAR1_1146_TICK(t)
+# define BFI_FLINEAR1_1145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1144, v ds
+# define BFI_FLINEAR1_1145_TICK(t)
+# define BFI_FLINEAR1_1144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1143, v ds
+# define BFI_FLINEAR1_1144_TICK(t)
+# define BFI_FLINEAR1_1143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1142, v ds
+# define BFI_FLINEAR1_1143_TICK(t)
+# define BFI_FLINEAR1_1142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1141, v ds
+# define BFI_FLINEAR1_1142_TICK(t)
+# define BFI_FLINEAR1_1141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1140, v ds
+# define BFI_FLINEAR1_1141_TICK(t)
+# define BFI_FLINEAR1_1140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1139, v ds
+# define BFI_FLINEAR1_1140_TICK(t)
+# define BFI_FLINEAR1_1139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1138, v ds
+# define BFI_FLINEAR1_1139_TICK(t)
+# define BFI_FLINEAR1_1138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1137, v ds
+# define BFI_FLINEAR1_1138_TICK(t)
+# define BFI_FLINEAR1_1137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1136, v ds
+# define BFI_FLINEAR1_1137_TICK(t)
+# define BFI_FLINEAR1_1136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1135, v ds
+# define BFI_FLINEAR1_1136_TICK(t)
+# define BFI_FLINEAR1_1135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1134, v ds
+# define BFI_FLINEAR1_1135_TICK(t)
+# define BFI_FLINEAR1_1134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1133, v ds
+# define BFI_FLINEAR1_1134_TICK(t)
+# define BFI_FLINEAR1_1133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1132, v ds
+# define BFI_FLINEAR1_1133_TICK(t)
+# define BFI_FLINEAR1_1132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1131, v ds
+# define BFI_FLINEAR1_1132_TICK(t)
+# define BFI_FLINEAR1_1131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1130, v ds
+# define BFI_FLINEAR1_1131_TICK(t)
+# define BFI_FLINEAR1_1130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1129, v ds
+# define BFI_FLINEAR1_1130_TICK(t)
+# define BFI_FLINEAR1_1129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1128, v ds
+# define BFI_FLINEAR1_1129_TICK(t)
+# define BFI_FLINEAR1_1128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1127, v ds
+# define BFI_FLINEAR1_1128_TICK(t)
+# define BFI_FLINEAR1_1127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1126, v ds
+# define BFI_FLINEAR1_1127_TICK(t)
+# define BFI_FLINEAR1_1126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1125, v ds
+# define BFI_FLINEAR1_1126_TICK(t)
+# define BFI_FLINEAR1_1125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1124, v ds
+# define BFI_FLINEAR1_1125_TICK(t)
+# define BFI_FLINEAR1_1124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1123, v ds
+# define BFI_FLINEAR1_1124_TICK(t)
+# define BFI_FLINEAR1_1123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1122, v ds
+# define BFI_FLINEAR1_1123_TICK(t)
+# define BFI_FLINEAR1_1122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1121, v ds
+# define BFI_FLINEAR1_1122_TICK(t)
+# define BFI_FLINEAR1_1121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1120, v ds
+# define BFI_FLINEAR1_1121_TICK(t)
+# define BFI_FLINEAR1_1120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1119, v ds
+# define BFI_FLINEAR1_1120_TICK(t)
+# define BFI_FLINEAR1_1119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1118, v ds
+# define BFI_FLINEAR1_1119_TICK(t)
+# define BFI_FLINEAR1_1118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1117, v ds
+# define BFI_FLINEAR1_1118_TICK(t)
+# define BFI_FLINEAR1_1117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1116, v ds
+# define BFI_FLINEAR1_1117_TICK(t)
+# define BFI_FLINEAR1_1116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1115, v ds
+# define BFI_FLINEAR1_1116_TICK(t)
+# define BFI_FLINEAR1_1115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1114, v ds
+# define BFI_FLINEAR1_1115_TICK(t)
+# define BFI_FLINEAR1_1114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1113, v ds
+# define BFI_FLINEAR1_1114_TICK(t)
+# define BFI_FLINEAR1_1113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1112, v ds
+# define BFI_FLINEAR1_1113_TICK(t)
+# define BFI_FLINEAR1_1112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1111, v ds
+# define BFI_FLINEAR1_1112_TICK(t)
+# define BFI_FLINEAR1_1111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1110, v ds
+# define BFI_FLINEAR1_1111_TICK(t)
+# define BFI_FLINEAR1_1110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1109, v ds
+# define BFI_FLINEAR1_1110_TICK(t)
+# define BFI_FLINEAR1_1109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1108, v ds
+# define BFI_FLINEAR1_1109_TICK(t)
+# define BFI_FLINEAR1_1108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1107, v ds
+# define BFI_FLINEAR1_1108_TICK(t)
+# define BFI_FLINEAR1_1107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1106, v ds
+# define BFI_FLINEAR1_1107_TICK(t)
+# define BFI_FLINEAR1_1106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1105, v ds
+# define BFI_FLINEAR1_1106_TICK(t)
+# define BFI_FLINEAR1_1105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1104, v ds
+# define BFI_FLINEAR1_1105_TICK(t)
+# define BFI_FLINEAR1_1104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1103, v ds
+# define BFI_FLINEAR1_1104_TICK(t)
+# define BFI_FLINEAR1_1103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1102, v ds
+# define BFI_FLINEAR1_1103_TICK(t)
+# define BFI_FLINEAR1_1102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1101, v ds
+# define BFI_FLINEAR1_1102_TICK(t)
+# define BFI_FLINEAR1_1101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1100, v ds
+# define BFI_FLINEAR1_1101_TICK(t)
+# define BFI_FLINEAR1_1100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1099, v ds
+# define BFI_FLINEAR1_1100_TICK(t)
+# define BFI_FLINEAR1_1099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1098, v ds
+# define BFI_FLINEAR1_1099_TICK(t)
+# define BFI_FLINEAR1_1098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1097, v ds
+# define BFI_FLINEAR1_1098_TICK(t)
+# define BFI_FLINEAR1_1097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1096, v ds
+# define BFI_FLINEAR1_1097_TICK(t)
+# define BFI_FLINEAR1_1096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1095, v ds
+# define BFI_FLINEAR1_1096_TICK(t)
+# define BFI_FLINEAR1_1095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1094, v ds
+# define BFI_FLINEAR1_1095_TICK(t)
+# define BFI_FLINEAR1_1094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1093, v ds
+# define BFI_FLINEAR1_1094_TICK(t)
+# define BFI_FLINEAR1_1093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1092, v ds
+# define BFI_FLINEAR1_1093_TICK(t)
+# define BFI_FLINEAR1_1092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1091, v ds
+# define BFI_FLINEAR1_1092_TICK(t)
+# define BFI_FLINEAR1_1091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1090, v ds
+# define BFI_FLINEAR1_1091_TICK(t)
+# define BFI_FLINEAR1_1090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1089, v ds
+# define BFI_FLINEAR1_1090_TICK(t)
+# define BFI_FLINEAR1_1089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1088, v ds
+# define BFI_FLINEAR1_1089_TICK(t)
+# define BFI_FLINEAR1_1088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1087, v ds
+# define BFI_FLINEAR1_1088_TICK(t)
+# define BFI_FLINEAR1_1087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1086, v ds
+# define BFI_FLINEAR1_1087_TICK(t)
+# define BFI_FLINEAR1_1086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1085, v ds
+# define BFI_FLINEAR1_1086_TICK(t)
+# define BFI_FLINEAR1_1085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1084, v ds
+# define BFI_FLINEAR1_1085_TICK(t)
+# define BFI_FLINEAR1_1084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1083, v ds
+# define BFI_FLINEAR1_1084_TICK(t)
+# define BFI_FLINEAR1_1083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1082, v ds
+# define BFI_FLINEAR1_1083_TICK(t)
+# define BFI_FLINEAR1_1082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1081, v ds
+# define BFI_FLINEAR1_1082_TICK(t)
+# define BFI_FLINEAR1_1081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1080, v ds
+# define BFI_FLINEAR1_1081_TICK(t)
+# define BFI_FLINEAR1_1080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1079, v ds
+# define BFI_FLINEAR1_1080_TICK(t)
+# define BFI_FLINEAR1_1079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1078, v ds
+# define BFI_FLINEAR1_1079_TICK(t)
+# define BFI_FLINEAR1_1078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1077, v ds
+# define BFI_FLINEAR1_1078_TICK(t)
+# define BFI_FLINEAR1_1077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1076, v ds
+# define BFI_FLINEAR1_1077_TICK(t)
+# define BFI_FLINEAR1_1076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1075, v ds
+# define BFI_FLINEAR1_1076_TICK(t)
+# define BFI_FLINEAR1_1075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1074, v ds
+# define BFI_FLINEAR1_1075_TICK(t)
+# define BFI_FLINEAR1_1074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1073, v ds
+# define BFI_FLINEAR1_1074_TICK(t)
+# define BFI_FLINEAR1_1073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1072, v ds
+# define BFI_FLINEAR1_1073_TICK(t)
+# define BFI_FLINEAR1_1072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1071, v ds
+# define BFI_FLINEAR1_1072_TICK(t)
+# define BFI_FLINEAR1_1071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1070, v ds
+# define BFI_FLINEAR1_1071_TICK(t)
+# define BFI_FLINEAR1_1070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1069, v ds
+# define BFI_FLINEAR1_1070_TICK(t)
+# define BFI_FLINEAR1_1069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1068, v ds
+# define BFI_FLINEAR1_1069_TICK(t)
+# define BFI_FLINEAR1_1068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1067, v ds
+# define BFI_FLINEAR1_1068_TICK(t)
+# define BFI_FLINEAR1_1067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1066, v ds
+# define BFI_FLINEAR1_1067_TICK(t)
+# define BFI_FLINEAR1_1066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1065, v ds
+# define BFI_FLINEAR1_1066_TICK(t)
+# define BFI_FLINEAR1_1065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1064, v ds
+# define BFI_FLINEAR1_1065_TICK(t)
+# define BFI_FLINEAR1_1064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1063, v ds
+# define BFI_FLINEAR1_1064_TICK(t)
+# define BFI_FLINEAR1_1063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1062, v ds
+# define BFI_FLINEAR1_1063_TICK(t)
+# define BFI_FLINEAR1_1062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1061, v ds
+# define BFI_FLINEAR1_1062_TICK(t)
+# define BFI_FLINEAR1_1061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1060, v ds
+# define BFI_FLINEAR1_1061_TICK(t)
+# define BFI_FLINEAR1_1060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1059, v ds
+# define BFI_FLINEAR1_1060_TICK(t)
+# define BFI_FLINEAR1_1059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1058, v ds
+# define BFI_FLINEAR1_1059_TICK(t)
+# define BFI_FLINEAR1_1058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1057, v ds
+# define BFI_FLINEAR1_1058_TICK(t)
+# define BFI_FLINEAR1_1057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1056, v ds
+# define BFI_FLINEAR1_1057_TICK(t)
+# define BFI_FLINEAR1_1056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1055, v ds
+# define BFI_FLINEAR1_1056_TICK(t)
+# define BFI_FLINEAR1_1055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1054, v ds
+# define BFI_FLINEAR1_1055_TICK(t)
+# define BFI_FLINEAR1_1054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1053, v ds
+# define BFI_FLINEAR1_1054_TICK(t)
+# define BFI_FLINEAR1_1053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1052, v ds
+# define BFI_FLINEAR1_1053_TICK(t)
+# define BFI_FLINEAR1_1052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1051, v ds
+# define BFI_FLINEAR1_1052_TICK(t)
+# define BFI_FLINEAR1_1051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1050, v ds
+# define BFI_FLINEAR1_1051_TICK(t)
+# define BFI_FLINEAR1_1050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1049, v ds
+# define BFI_FLINEAR1_1050_TICK(t)
+# define BFI_FLINEAR1_1049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1048, v ds
+# define BFI_FLINEAR1_1049_TICK(t)
+# define BFI_FLINEAR1_1048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1047, v ds
+# define BFI_FLINEAR1_1048_TICK(t)
+# define BFI_FLINEAR1_1047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1046, v ds
+# define BFI_FLINEAR1_1047_TICK(t)
+# define BFI_FLINEAR1_1046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1045, v ds
+# define BFI_FLINEAR1_1046_TICK(t)
+# define BFI_FLINEAR1_1045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1044, v ds
+# define BFI_FLINEAR1_1045_TICK(t)
+# define BFI_FLINEAR1_1044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1043, v ds
+# define BFI_FLINEAR1_1044_TICK(t)
+# define BFI_FLINEAR1_1043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1042, v ds
+# define BFI_FLINEAR1_1043_TICK(t)
+# define BFI_FLINEAR1_1042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1041, v ds
+# define BFI_FLINEAR1_1042_TICK(t)
+# define BFI_FLINEAR1_1041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1040, v ds
+# define BFI_FLINEAR1_1041_TICK(t)
+# define BFI_FLINEAR1_1040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1039, v ds
+# define BFI_FLINEAR1_1040_TICK(t)
+# define BFI_FLINEAR1_1039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1038, v ds
+# define BFI_FLINEAR1_1039_TICK(t)
+# define BFI_FLINEAR1_1038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1037, v ds
+# define BFI_FLINEAR1_1038_TICK(t)
+# define BFI_FLINEAR1_1037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1036, v ds
+# define BFI_FLINEAR1_1037_TICK(t)
+# define BFI_FLINEAR1_1036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1035, v ds
+# define BFI_FLINEAR1_1036_TICK(t)
+# define BFI_FLINEAR1_1035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1034, v ds
+# define BFI_FLINEAR1_1035_TICK(t)
+# define BFI_FLINEAR1_1034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1033, v ds
+# define BFI_FLINEAR1_1034_TICK(t)
+# define BFI_FLINEAR1_1033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1032, v ds
+# define BFI_FLINEAR1_1033_TICK(t)
+# define BFI_FLINEAR1_1032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1031, v ds
+# define BFI_FLINEAR1_1032_TICK(t)
+# define BFI_FLINEAR1_1031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1030, v ds
+# define BFI_FLINEAR1_1031_TICK(t)
+# define BFI_FLINEAR1_1030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1029, v ds
+# define BFI_FLINEAR1_1030_TICK(t)
+# define BFI_FLINEAR1_1029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1028, v ds
+# define BFI_FLINEAR1_1029_TICK(t)
+# define BFI_FLINEAR1_1028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1027, v ds
+# define BFI_FLINEAR1_1028_TICK(t)
+# define BFI_FLINEAR1_1027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1026, v ds
+# define BFI_FLINEAR1_1027_TICK(t)
+# define BFI_FLINEAR1_1026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1025, v ds
+# define BFI_FLINEAR1_1026_TICK(t)
+# define BFI_FLINEAR1_1025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1024, v ds
+# define BFI_FLINEAR1_1025_TICK(t)
+
+# endif
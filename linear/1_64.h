@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_1_64_H
+# define BFI_LINEAR_1_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR1_64(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_63, v ds
+# define BFI_FLINEAR1_64_TICK(t)
+# define BFI_FLINEAR1_63(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_62, v ds
+# define BFI_FLINEAR1_63_TICK(t)
+# define BFI_FLINEAR1_62(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_61, v ds
+# define BFI_FLINEAR1_62_TICK(t)
+# define BFI_FLINEAR1_61(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_60, v ds
+# define BFI_FLINEAR1_61_TICK(t)
+# define BFI_FLINEAR1_60(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_59, v ds
+# define BFI_FLINEAR1_60_TICK(t)
+# define BFI_FLINEAR1_59(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_58, v ds
+# define BFI_FLINEAR1_59_TICK(t)
+# define BFI_FLINEAR1_58(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_57, v ds
+# define BFI_FLINEAR1_58_TICK(t)
+# define BFI_FLINEAR1_57(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_56, v ds
+# define BFI_FLINEAR1_57_TICK(t)
+# define BFI_FLINEAR1_56(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_55, v ds
+# define BFI_FLINEAR1_56_TICK(t)
+# define BFI_FLINEAR1_55(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_54, v ds
+# define BFI_FLINEAR1_55_TICK(t)
+# define BFI_FLINEAR1_54(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_53, v ds
+# define BFI_FLINEAR1_54_TICK(t)
+# define BFI_FLINEAR1_53(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_52, v ds
+# define BFI_FLINEAR1_53_TICK(t)
+# define BFI_FLINEAR1_52(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_51, v ds
+# define BFI_FLINEAR1_52_TICK(t)
+# define BFI_FLINEAR1_51(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_50, v ds
+# define BFI_FLINEAR1_51_TICK(t)
+# define BFI_FLINEAR1_50(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_49, v ds
+# define BFI_FLINEAR1_50_TICK(t)
+# define BFI_FLINEAR1_49(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_48, v ds
+# define BFI_FLINEAR1_49_TICK(t)
+# define BFI_FLINEAR1_48(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_47, v ds
+# define BFI_FLINEAR1_48_TICK(t)
+# define BFI_FLINEAR1_47(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_46, v ds
+# define BFI_FLINEAR1_47_TICK(t)
+# define BFI_FLINEAR1_46(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_45, v ds
+# define BFI_FLINEAR1_46_TICK(t)
+# define BFI_FLINEAR1_45(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_44, v ds
+# define BFI_FLINEAR1_45_TICK(t)
+# define BFI_FLINEAR1_44(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_43, v ds
+# define BFI_FLINEAR1_44_TICK(t)
+# define BFI_FLINEAR1_43(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_42, v ds
+# define BFI_FLINEAR1_43_TICK(t)
+# define BFI_FLINEAR1_42(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_41, v ds
+# define BFI_FLINEAR1_42_TICK(t)
+# define BFI_FLINEAR1_41(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_40, v ds
+# define BFI_FLINEAR1_41_TICK(t)
+# define BFI_FLINEAR1_40(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_39, v ds
+# define BFI_FLINEAR1_40_TICK(t)
+# define BFI_FLINEAR1_39(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_38, v ds
+# define BFI_FLINEAR1_39_TICK(t)
+# define BFI_FLINEAR1_38(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_37, v ds
+# define BFI_FLINEAR1_38_TICK(t)
+# define BFI_FLINEAR1_37(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_36, v ds
+# define BFI_FLINEAR1_37_TICK(t)
+# define BFI_FLINEAR1_36(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_35, v ds
+# define BFI_FLINEAR1_36_TICK(t)
+# define BFI_FLINEAR1_35(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_34, v ds
+# define BFI_FLINEAR1_35_TICK(t)
+# define BFI_FLINEAR1_34(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_33, v ds
+# define BFI_FLINEAR1_34_TICK(t)
+# define BFI_FLINEAR1_33(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_32, v ds
+# define BFI_FLINEAR1_33_TICK(t)
+# define BFI_FLINEAR1_32(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_31, v ds
+# define BFI_FLINEAR1_32_TICK(t)
+# define BFI_FLINEAR1_31(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_30, v ds
+# define BFI_FLINEAR1_31_TICK(t)
+# define BFI_FLINEAR1_30(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_29, v ds
+# define BFI_FLINEAR1_30_TICK(t)
+# define BFI_FLINEAR1_29(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_28, v ds
+# define BFI_FLINEAR1_29_TICK(t)
+# define BFI_FLINEAR1_28(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_27, v ds
+# define BFI_FLINEAR1_28_TICK(t)
+# define BFI_FLINEAR1_27(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_26, v ds
+# define BFI_FLINEAR1_27_TICK(t)
+# define BFI_FLINEAR1_26(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_25, v ds
+# define BFI_FLINEAR1_26_TICK(t)
+# define BFI_FLINEAR1_25(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_24, v ds
+# define BFI_FLINEAR1_25_TICK(t)
+# define BFI_FLINEAR1_24(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_23, v ds
+# define BFI_FLINEAR1_24_TICK(t)
+# define BFI_FLINEAR1_23(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_22, v ds
+# define BFI_FLINEAR1_23_TICK(t)
+# define BFI_FLINEAR1_22(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_21, v ds
+# define BFI_FLINEAR1_22_TICK(t)
+# define BFI_FLINEAR1_21(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_20, v ds
+# define BFI_FLINEAR1_21_TICK(t)
+# define BFI_FLINEAR1_20(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_19, v ds
+# define BFI_FLINEAR1_20_TICK(t)
+# define BFI_FLINEAR1_19(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_18, v ds
+# define BFI_FLINEAR1_19_TICK(t)
+# define BFI_FLINEAR1_18(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_17, v ds
+# define BFI_FLINEAR1_18_TICK(t)
+# define BFI_FLINEAR1_17(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_16, v ds
+# define BFI_FLINEAR1_17_TICK(t)
+# define BFI_FLINEAR1_16(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_15, v ds
+# define BFI_FLINEAR1_16_TICK(t)
+# define BFI_FLINEAR1_15(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_14, v ds
+# define BFI_FLINEAR1_15_TICK(t)
+# define BFI_FLINEAR1_14(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_13, v ds
+# define BFI_FLINEAR1_14_TICK(t)
+# define BFI_FLINEAR1_13(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_12, v ds
+# define BFI_FLINEAR1_13_TICK(t)
+# define BFI_FLINEAR1_12(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_11, v ds
+# define BFI_FLINEAR1_12_TICK(t)
+# define BFI_FLINEAR1_11(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_10, v ds
+# define BFI_FLINEAR1_11_TICK(t)
+# define BFI_FLINEAR1_10(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_9, v ds
+# define BFI_FLINEAR1_10_TICK(t)
+# define BFI_FLINEAR1_9(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_8, v ds
+# define BFI_FLINEAR1_9_TICK(t)
+# define BFI_FLINEAR1_8(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_7, v ds
+# define BFI_FLINEAR1_8_TICK(t)
+# define BFI_FLINEAR1_7(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_6, v ds
+# define BFI_FLINEAR1_7_TICK(t)
+# define BFI_FLINEAR1_6(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_5, v ds
+# define BFI_FLINEAR1_6_TICK(t)
+# define BFI_FLINEAR1_5(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_4, v ds
+# define BFI_FLINEAR1_5_TICK(t)
+# define BFI_FLINEAR1_4(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_3, v ds
+# define BFI_FLINEAR1_4_TICK(t)
+# define BFI_FLINEAR1_3(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_2, v ds
+# define BFI_FLINEAR1_3_TICK(t)
+# define BFI_FLINEAR1_2(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_1, v ds
+# define BFI_FLINEAR1_2_TICK(t)
+# define BFI_FLINEAR1_1(v, f, ds) BFI_FINST_##f(BFI_FLINEAR1_0, v ds
+# define BFI_FLINEAR1_1_TICK(t)
+
+# endif
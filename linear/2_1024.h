@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_2_1024_H
+# define BFI_LINEAR_2_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR2_1024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1023, v ds
+# define BFI_FLINEAR2_1024_TICK(t)
+# define BFI_FLINEAR2_1023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1022, v ds
+# define BFI_FLINEAR2_1023_TICK(t)
+# define BFI_FLINEAR2_1022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1021, v ds
+# define BFI_FLINEAR2_1022_TICK(t)
+# define BFI_FLINEAR2_1021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1020, v ds
+# define BFI_FLINEAR2_1021_TICK(t)
+# define BFI_FLINEAR2_1020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1019, v ds
+# define BFI_FLINEAR2_1020_TICK(t)
+# define BFI_FLINEAR2_1019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1018, v ds
+# define BFI_FLINEAR2_1019_TICK(t)
+# define BFI_FLINEAR2_1018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1017, v ds
+# define BFI_FLINEAR2_1018_TICK(t)
+# define BFI_FLINEAR2_1017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1016, v ds
+# define BFI_FLINEAR2_1017_TICK(t)
+# define BFI_FLINEAR2_1016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1015, v ds
+# define BFI_FLINEAR2_1016_TICK(t)
+# define BFI_FLINEAR2_1015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1014, v ds
+# define BFI_FLINEAR2_1015_TICK(t)
+# define BFI_FLINEAR2_1014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1013, v ds
+# define BFI_FLINEAR2_1014_TICK(t)
+# define BFI_FLINEAR2_1013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1012, v ds
+# define BFI_FLINEAR2_1013_TICK(t)
+# define BFI_FLINEAR2_1012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1011, v ds
+# define BFI_FLINEAR2_1012_TICK(t)
+# define BFI_FLINEAR2_1011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1010, v ds
+# define BFI_FLINEAR2_1011_TICK(t)
+# define BFI_FLINEAR2_1010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1009, v ds
+# define BFI_FLINEAR2_1010_TICK(t)
+# define BFI_FLINEAR2_1009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1008, v ds
+# define BFI_FLINEAR2_1009_TICK(t)
+# define BFI_FLINEAR2_1008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1007, v ds
+# define BFI_FLINEAR2_1008_TICK(t)
+# define BFI_FLINEAR2_1007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1006, v ds
+# define BFI_FLINEAR2_1007_TICK(t)
+# define BFI_FLINEAR2_1006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1005, v ds
+# define BFI_FLINEAR2_1006_TICK(t)
+# define BFI_FLINEAR2_1005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1004, v ds
+# define BFI_FLINEAR2_1005_TICK(t)
+# define BFI_FLINEAR2_1004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1003, v ds
+# define BFI_FLINEAR2_1004_TICK(t)
+# define BFI_FLINEAR2_1003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1002, v ds
+# define BFI_FLINEAR2_1003_TICK(t)
+# define BFI_FLINEAR2_1002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1001, v ds
+# define BFI_FLINEAR2_1002_TICK(t)
+# define BFI_FLINEAR2_1001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1000, v ds
+# define BFI_FLINEAR2_1001_TICK(t)
+# define BFI_FLINEAR2_1000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_999, v ds
+# define BFI_FLINEAR2_1000_TICK(t)
+# define BFI_FLINEAR2_999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_998, v ds
+# define BFI_FLINEAR2_999_TICK(t)
+# define BFI_FLINEAR2_998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_997, v ds
+# define BFI_FLINEAR2_998_TICK(t)
+# define BFI_FLINEAR2_997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_996, v ds
+# define BFI_FLINEAR2_997_TICK(t)
+# define BFI_FLINEAR2_996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_995, v ds
+# define BFI_FLINEAR2_996_TICK(t)
+# define BFI_FLINEAR2_995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_994, v ds
+# define BFI_FLINEAR2_995_TICK(t)
+# define BFI_FLINEAR2_994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_993, v ds
+# define BFI_FLINEAR2_994_TICK(t)
+# define BFI_FLINEAR2_993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_992, v ds
+# define BFI_FLINEAR2_993_TICK(t)
+# define BFI_FLINEAR2_992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_991, v ds
+# define BFI_FLINEAR2_992_TICK(t)
+# define BFI_FLINEAR2_991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_990, v ds
+# define BFI_FLINEAR2_991_TICK(t)
+# define BFI_FLINEAR2_990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_989, v ds
+# define BFI_FLINEAR2_990_TICK(t)
+# define BFI_FLINEAR2_989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_988, v ds
+# define BFI_FLINEAR2_989_TICK(t)
+# define BFI_FLINEAR2_988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_987, v ds
+# define BFI_FLINEAR2_988_TICK(t)
+# define BFI_FLINEAR2_987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_986, v ds
+# define BFI_FLINEAR2_987_TICK(t)
+# define BFI_FLINEAR2_986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_985, v ds
+# define BFI_FLINEAR2_986_TICK(t)
+# define BFI_FLINEAR2_985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_984, v ds
+# define BFI_FLINEAR2_985_TICK(t)
+# define BFI_FLINEAR2_984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_983, v ds
+# define BFI_FLINEAR2_984_TICK(t)
+# define BFI_FLINEAR2_983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_982, v ds
+# define BFI_FLINEAR2_983_TICK(t)
+# define BFI_FLINEAR2_982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_981, v ds
+# define BFI_FLINEAR2_982_TICK(t)
+# define BFI_FLINEAR2_981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_980, v ds
+# define BFI_FLINEAR2_981_TICK(t)
+# define BFI_FLINEAR2_980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_979, v ds
+# define BFI_FLINEAR2_980_TICK(t)
+# define BFI_FLINEAR2_979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_978, v ds
+# define BFI_FLINEAR2_979_TICK(t)
+# define BFI_FLINEAR2_978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_977, v ds
+# define BFI_FLINEAR2_978_TICK(t)
+# define BFI_FLINEAR2_977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_976, v ds
+# define BFI_FLINEAR2_977_TICK(t)
+# define BFI_FLINEAR2_976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_975, v ds
+# define BFI_FLINEAR2_976_TICK(t)
+# define BFI_FLINEAR2_975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_974, v ds
+# define BFI_FLINEAR2_975_TICK(t)
+# define BFI_FLINEAR2_974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_973, v ds
+# define BFI_FLINEAR2_974_TICK(t)
+# define BFI_FLINEAR2_973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_972, v ds
+# define BFI_FLINEAR2_973_TICK(t)
+# define BFI_FLINEAR2_972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_971, v ds
+# define BFI_FLINEAR2_972_TICK(t)
+# define BFI_FLINEAR2_971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_970, v ds
+# define BFI_FLINEAR2_971_TICK(t)
+# define BFI_FLINEAR2_970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_969, v ds
+# define BFI_FLINEAR2_970_TICK(t)
+# define BFI_FLINEAR2_969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_968, v ds
+# define BFI_FLINEAR2_969_TICK(t)
+# define BFI_FLINEAR2_968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_967, v ds
+# define BFI_FLINEAR2_968_TICK(t)
+# define BFI_FLINEAR2_967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_966, v ds
+# define BFI_FLINEAR2_967_TICK(t)
+# define BFI_FLINEAR2_966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_965, v ds
+# define BFI_FLINEAR2_966_TICK(t)
+# define BFI_FLINEAR2_965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_964, v ds
+# define BFI_FLINEAR2_965_TICK(t)
+# define BFI_FLINEAR2_964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_963, v ds
+# define BFI_FLINEAR2_964_TICK(t)
+# define BFI_FLINEAR2_963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_962, v ds
+# define BFI_FLINEAR2_963_TICK(t)
+# define BFI_FLINEAR2_962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_961, v ds
+# define BFI_FLINEAR2_962_TICK(t)
+# define BFI_FLINEAR2_961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_960, v ds
+# define BFI_FLINEAR2_961_TICK(t)
+# define BFI_FLINEAR2_960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_959, v ds
+# define BFI_FLINEAR2_960_TICK(t)
+# define BFI_FLINEAR2_959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_958, v ds
+# define BFI_FLINEAR2_959_TICK(t)
+# define BFI_FLINEAR2_958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_957, v ds
+# define BFI_FLINEAR2_958_TICK(t)
+# define BFI_FLINEAR2_957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_956, v ds
+# define BFI_FLINEAR2_957_TICK(t)
+# define BFI_FLINEAR2_956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_955, v ds
+# define BFI_FLINEAR2_956_TICK(t)
+# define BFI_FLINEAR2_955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_954, v ds
+# define BFI_FLINEAR2_955_TICK(t)
+# define BFI_FLINEAR2_954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_953, v ds
+# define BFI_FLINEAR2_954_TICK(t)
+# define BFI_FLINEAR2_953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_952, v ds
+# define BFI_FLINEAR2_953_TICK(t)
+# define BFI_FLINEAR2_952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_951, v ds
+# define BFI_FLINEAR2_952_TICK(t)
+# define BFI_FLINEAR2_951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_950, v ds
+# define BFI_FLINEAR2_951_TICK(t)
+# define BFI_FLINEAR2_950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_949, v ds
+# define BFI_FLINEAR2_950_TICK(t)
+# define BFI_FLINEAR2_949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_948, v ds
+# define BFI_FLINEAR2_949_TICK(t)
+# define BFI_FLINEAR2_948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_947, v ds
+# define BFI_FLINEAR2_948_TICK(t)
+# define BFI_FLINEAR2_947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_946, v ds
+# define BFI_FLINEAR2_947_TICK(t)
+# define BFI_FLINEAR2_946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_945, v ds
+# define BFI_FLINEAR2_946_TICK(t)
+# define BFI_FLINEAR2_945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_944, v ds
+# define BFI_FLINEAR2_945_TICK(t)
+# define BFI_FLINEAR2_944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_943, v ds
+# define BFI_FLINEAR2_944_TICK(t)
+# define BFI_FLINEAR2_943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_942, v ds
+# define BFI_FLINEAR2_943_TICK(t)
+# define BFI_FLINEAR2_942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_941, v ds
+# define BFI_FLINEAR2_942_TICK(t)
+# define BFI_FLINEAR2_941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_940, v ds
+# define BFI_FLINEAR2_941_TICK(t)
+# define BFI_FLINEAR2_940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_939, v ds
+# define BFI_FLINEAR2_940_TICK(t)
+# define BFI_FLINEAR2_939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_938, v ds
+# define BFI_FLINEAR2_939_TICK(t)
+# define BFI_FLINEAR2_938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_937, v ds
+# define BFI_FLINEAR2_938_TICK(t)
+# define BFI_FLINEAR2_937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_936, v ds
+# define BFI_FLINEAR2_937_TICK(t)
+# define BFI_FLINEAR2_936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_935, v ds
+# define BFI_FLINEAR2_936_TICK(t)
+# define BFI_FLINEAR2_935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_934, v ds
+# define BFI_FLINEAR2_935_TICK(t)
+# define BFI_FLINEAR2_934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_933, v ds
+# define BFI_FLINEAR2_934_TICK(t)
+# define BFI_FLINEAR2_933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_932, v ds
+# define BFI_FLINEAR2_933_TICK(t)
+# define BFI_FLINEAR2_932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_931, v ds
+# define BFI_FLINEAR2_932_TICK(t)
+# define BFI_FLINEAR2_931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_930, v ds
+# define BFI_FLINEAR2_931_TICK(t)
+# define BFI_FLINEAR2_930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_929, v ds
+# define BFI_FLINEAR2_930_TICK(t)
+# define BFI_FLINEAR2_929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_928, v ds
+# define BFI_FLINEAR2_929_TICK(t)
+# define BFI_FLINEAR2_928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_927, v ds
+# define BFI_FLINEAR2_928_TICK(t)
+# define BFI_FLINEAR2_927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_926, v ds
+# define BFI_FLINEAR2_927_TICK(t)
+# define BFI_FLINEAR2_926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_925, v ds
+# define BFI_FLINEAR2_926_TICK(t)
+# define BFI_FLINEAR2_925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_924, v ds
+# define BFI_FLINEAR2_925_TICK(t)
+# define BFI_FLINEAR2_924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_923, v ds
+# define BFI_FLINEAR2_924_TICK(t)
+# define BFI_FLINEAR2_923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_922, v ds
+# define BFI_FLINEAR2_923_TICK(t)
+# define BFI_FLINEAR2_922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_921, v ds
+# define BFI_FLINEAR2_922_TICK(t)
+# define BFI_FLINEAR2_921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_920, v ds
+# define BFI_FLINEAR2_921_TICK(t)
+# define BFI_FLINEAR2_920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_919, v ds
+# define BFI_FLINEAR2_920_TICK(t)
+# define BFI_FLINEAR2_919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_918, v ds
+# define BFI_FLINEAR2_919_TICK(t)
+# define BFI_FLINEAR2_918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_917, v ds
+# define BFI_FLINEAR2_918_TICK(t)
+# define BFI_FLINEAR2_917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_916, v ds
+# define BFI_FLINEAR2_917_TICK(t)
+# define BFI_FLINEAR2_916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_915, v ds
+# define BFI_FLINEAR2_916_TICK(t)
+# define BFI_FLINEAR2_915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_914, v ds
+# define BFI_FLINEAR2_915_TICK(t)
+# define BFI_FLINEAR2_914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_913, v ds
+# define BFI_FLINEAR2_914_TICK(t)
+# define BFI_FLINEAR2_913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_912, v ds
+# define BFI_FLINEAR2_913_TICK(t)
+# define BFI_FLINEAR2_912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_911, v ds
+# define BFI_FLINEAR2_912_TICK(t)
+# define BFI_FLINEAR2_911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_910, v ds
+# define BFI_FLINEAR2_911_TICK(t)
+# define BFI_FLINEAR2_910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_909, v ds
+# define BFI_FLINEAR2_910_TICK(t)
+# define BFI_FLINEAR2_909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_908, v ds
+# define BFI_FLINEAR2_909_TICK(t)
+# define BFI_FLINEAR2_908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_907, v ds
+# define BFI_FLINEAR2_908_TICK(t)
+# define BFI_FLINEAR2_907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_906, v ds
+# define BFI_FLINEAR2_907_TICK(t)
+# define BFI_FLINEAR2_906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_905, v ds
+# define BFI_FLINEAR2_906_TICK(t)
+# define BFI_FLINEAR2_905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_904, v ds
+# define BFI_FLINEAR2_905_TICK(t)
+# define BFI_FLINEAR2_904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_903, v ds
+# define BFI_FLINEAR2_904_TICK(t)
+# define BFI_FLINEAR2_903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_902, v ds
+# define BFI_FLINEAR2_903_TICK(t)
+# define BFI_FLINEAR2_902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_901, v ds
+# define BFI_FLINEAR2_902_TICK(t)
+# define BFI_FLINEAR2_901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_900, v ds
+# define BFI_FLINEAR2_901_TICK(t)
+# define BFI_FLINEAR2_900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_899, v ds
+# define BFI_FLINEAR2_900_TICK(t)
+# define BFI_FLINEAR2_899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_898, v ds
+# define BFI_FLINEAR2_899_TICK(t)
+# define BFI_FLINEAR2_898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_897, v ds
+# define BFI_FLINEAR2_898_TICK(t)
+# define BFI_FLINEAR2_897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_896, v ds
+# define BFI_FLINEAR2_897_TICK(t)
+# define BFI_FLINEAR2_896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_895, v ds
+# define BFI_FLINEAR2_896_TICK(t)
+# define BFI_FLINEAR2_895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_894, v ds
+# define BFI_FLINEAR2_895_TICK(t)
+# define BFI_FLINEAR2_894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_893, v ds
+# define BFI_FLINEAR2_894_TICK(t)
+# define BFI_FLINEAR2_893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_892, v ds
+# define BFI_FLINEAR2_893_TICK(t)
+# define BFI_FLINEAR2_892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_891, v ds
+# define BFI_FLINEAR2_892_TICK(t)
+# define BFI_FLINEAR2_891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_890, v ds
+# define BFI_FLINEAR2_891_TICK(t)
+# define BFI_FLINEAR2_890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_889, v ds
+# define BFI_FLINEAR2_890_TICK(t)
+# define BFI_FLINEAR2_889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_888, v ds
+# define BFI_FLINEAR2_889_TICK(t)
+# define BFI_FLINEAR2_888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_887, v ds
+# define BFI_FLINEAR2_888_TICK(t)
+# define BFI_FLINEAR2_887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_886, v ds
+# define BFI_FLINEAR2_887_TICK(t)
+# define BFI_FLINEAR2_886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_885, v ds
+# define BFI_FLINEAR2_886_TICK(t)
+# define BFI_FLINEAR2_885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_884, v ds
+# define BFI_FLINEAR2_885_TICK(t)
+# define BFI_FLINEAR2_884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_883, v ds
+# define BFI_FLINEAR2_884_TICK(t)
+# define BFI_FLINEAR2_883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_882, v ds
+# define BFI_FLINEAR2_883_TICK(t)
+# define BFI_FLINEAR2_882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_881, v ds
+# define BFI_FLINEAR2_882_TICK(t)
+# define BFI_FLINEAR2_881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_880, v ds
+# define BFI_FLINEAR2_881_TICK(t)
+# define BFI_FLINEAR2_880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_879, v ds
+# define BFI_FLINEAR2_880_TICK(t)
+# define BFI_FLINEAR2_879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_878, v ds
+# define BFI_FLINEAR2_879_TICK(t)
+# define BFI_FLINEAR2_878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_877, v ds
+# define BFI_FLINEAR2_878_TICK(t)
+# define BFI_FLINEAR2_877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_876, v ds
+# define BFI_FLINEAR2_877_TICK(t)
+# define BFI_FLINEAR2_876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_875, v ds
+# define BFI_FLINEAR2_876_TICK(t)
+# define BFI_FLINEAR2_875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_874, v ds
+# define BFI_FLINEAR2_875_TICK(t)
+# define BFI_FLINEAR2_874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_873, v ds
+# define BFI_FLINEAR2_874_TICK(t)
+# define BFI_FLINEAR2_873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_872, v ds
+# define BFI_FLINEAR2_873_TICK(t)
+# define BFI_FLINEAR2_872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_871, v ds
+# define BFI_FLINEAR2_872_TICK(t)
+# define BFI_FLINEAR2_871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_870, v ds
+# define BFI_FLINEAR2_871_TICK(t)
+# define BFI_FLINEAR2_870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_869, v ds
+# define BFI_FLINEAR2_870_TICK(t)
+# define BFI_FLINEAR2_869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_868, v ds
+# define BFI_FLINEAR2_869_TICK(t)
+# define BFI_FLINEAR2_868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_867, v ds
+# define BFI_FLINEAR2_868_TICK(t)
+# define BFI_FLINEAR2_867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_866, v ds
+# define BFI_FLINEAR2_867_TICK(t)
+# define BFI_FLINEAR2_866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_865, v ds
+# define BFI_FLINEAR2_866_TICK(t)
+# define BFI_FLINEAR2_865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_864, v ds
+# define BFI_FLINEAR2_865_TICK(t)
+# define BFI_FLINEAR2_864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_863, v ds
+# define BFI_FLINEAR2_864_TICK(t)
+# define BFI_FLINEAR2_863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_862, v ds
+# define BFI_FLINEAR2_863_TICK(t)
+# define BFI_FLINEAR2_862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_861, v ds
+# define BFI_FLINEAR2_862_TICK(t)
+# define BFI_FLINEAR2_861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_860, v ds
+# define BFI_FLINEAR2_861_TICK(t)
+# define BFI_FLINEAR2_860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_859, v ds
+# define BFI_FLINEAR2_860_TICK(t)
+# define BFI_FLINEAR2_859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_858, v ds
+# define BFI_FLINEAR2_859_TICK(t)
+# define BFI_FLINEAR2_858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_857, v ds
+# define BFI_FLINEAR2_858_TICK(t)
+# define BFI_FLINEAR2_857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_856, v ds
+# define BFI_FLINEAR2_857_TICK(t)
+# define BFI_FLINEAR2_856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_855, v ds
+# define BFI_FLINEAR2_856_TICK(t)
+# define BFI_FLINEAR2_855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_854, v ds
+# define BFI_FLINEAR2_855_TICK(t)
+# define BFI_FLINEAR2_854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_853, v ds
+# define BFI_FLINEAR2_854_TICK(t)
+# define BFI_FLINEAR2_853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_852, v ds
+# define BFI_FLINEAR2_853_TICK(t)
+# define BFI_FLINEAR2_852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_851, v ds
+# define BFI_FLINEAR2_852_TICK(t)
+# define BFI_FLINEAR2_851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_850, v ds
+# define BFI_FLINEAR2_851_TICK(t)
+# define BFI_FLINEAR2_850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_849, v ds
+# define BFI_FLINEAR2_850_TICK(t)
+# define BFI_FLINEAR2_849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_848, v ds
+# define BFI_FLINEAR2_849_TICK(t)
+# define BFI_FLINEAR2_848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_847, v ds
+# define BFI_FLINEAR2_848_TICK(t)
+# define BFI_FLINEAR2_847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_846, v ds
+# define BFI_FLINEAR2_847_TICK(t)
+# define BFI_FLINEAR2_846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_845, v ds
+# define BFI_FLINEAR2_846_TICK(t)
+# define BFI_FLINEAR2_845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_844, v ds
+# define BFI_FLINEAR2_845_TICK(t)
+# define BFI_FLINEAR2_844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_843, v ds
+# define BFI_FLINEAR2_844_TICK(t)
+# define BFI_FLINEAR2_843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_842, v ds
+# define BFI_FLINEAR2_843_TICK(t)
+# define BFI_FLINEAR2_842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_841, v ds
+# define BFI_FLINEAR2_842_TICK(t)
+# define BFI_FLINEAR2_841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_840, v ds
+# define BFI_FLINEAR2_841_TICK(t)
+# define BFI_FLINEAR2_840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_839, v ds
+# define BFI_FLINEAR2_840_TICK(t)
+# define BFI_FLINEAR2_839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_838, v ds
+# define BFI_FLINEAR2_839_TICK(t)
+# define BFI_FLINEAR2_838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_837, v ds
+# define BFI_FLINEAR2_838_TICK(t)
+# define BFI_FLINEAR2_837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_836, v ds
+# define BFI_FLINEAR2_837_TICK(t)
+# define BFI_FLINEAR2_836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_835, v ds
+# define BFI_FLINEAR2_836_TICK(t)
+# define BFI_FLINEAR2_835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_834, v ds
+# define BFI_FLINEAR2_835_TICK(t)
+# define BFI_FLINEAR2_834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_833, v ds
+# define BFI_FLINEAR2_834_TICK(t)
+# define BFI_FLINEAR2_833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_832, v ds
+# define BFI_FLINEAR2_833_TICK(t)
+# define BFI_FLINEAR2_832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_831, v ds
+# define BFI_FLINEAR2_832_TICK(t)
+# define BFI_FLINEAR2_831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_830, v ds
+# define BFI_FLINEAR2_831_TICK(t)
+# define BFI_FLINEAR2_830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_829, v ds
+# define BFI_FLINEAR2_830_TICK(t)
+# define BFI_FLINEAR2_829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_828, v ds
+# define BFI_FLINEAR2_829_TICK(t)
+# define BFI_FLINEAR2_828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_827, v ds
+# define BFI_FLINEAR2_828_TICK(t)
+# define BFI_FLINEAR2_827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_826, v ds
+# define BFI_FLINEAR2_827_TICK(t)
+# define BFI_FLINEAR2_826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_825, v ds
+# define BFI_FLINEAR2_826_TICK(t)
+# define BFI_FLINEAR2_825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_824, v ds
+# define BFI_FLINEAR2_825_TICK(t)
+# define BFI_FLINEAR2_824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_823, v ds
+# define BFI_FLINEAR2_824_TICK(t)
+# define BFI_FLINEAR2_823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_822, v ds
+# define BFI_FLINEAR2_823_TICK(t)
+# define BFI_FLINEAR2_822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_821, v ds
+# define BFI_FLINEAR2_822_TICK(t)
+# define BFI_FLINEAR2_821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_820, v ds
+# define BFI_FLINEAR2_821_TICK(t)
+# define BFI_FLINEAR2_820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_819, v ds
+# define BFI_FLINEAR2_820_TICK(t)
+# define BFI_FLINEAR2_819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_818, v ds
+# define BFI_FLINEAR2_819_TICK(t)
+# define BFI_FLINEAR2_818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_817, v ds
+# define BFI_FLINEAR2_818_TICK(t)
+# define BFI_FLINEAR2_817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_816, v ds
+# define BFI_FLINEAR2_817_TICK(t)
+# define BFI_FLINEAR2_816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_815, v ds
+# define BFI_FLINEAR2_816_TICK(t)
+# define BFI_FLINEAR2_815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_814, v ds
+# define BFI_FLINEAR2_815_TICK(t)
+# define BFI_FLINEAR2_814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_813, v ds
+# define BFI_FLINEAR2_814_TICK(t)
+# define BFI_FLINEAR2_813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_812, v ds
+# define BFI_FLINEAR2_813_TICK(t)
+# define BFI_FLINEAR2_812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_811, v ds
+# define BFI_FLINEAR2_812_TICK(t)
+# define BFI_FLINEAR2_811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_810, v ds
+# define BFI_FLINEAR2_811_TICK(t)
+# define BFI_FLINEAR2_810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_809, v ds
+# define BFI_FLINEAR2_810_TICK(t)
+# define BFI_FLINEAR2_809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_808, v ds
+# define BFI_FLINEAR2_809_TICK(t)
+# define BFI_FLINEAR2_808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_807, v ds
+# define BFI_FLINEAR2_808_TICK(t)
+# define BFI_FLINEAR2_807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_806, v ds
+# define BFI_FLINEAR2_807_TICK(t)
+# define BFI_FLINEAR2_806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_805, v ds
+# define BFI_FLINEAR2_806_TICK(t)
+# define BFI_FLINEAR2_805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_804, v ds
+# define BFI_FLINEAR2_805_TICK(t)
+# define BFI_FLINEAR2_804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_803, v ds
+# define BFI_FLINEAR2_804_TICK(t)
+# define BFI_FLINEAR2_803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_802, v ds
+# define BFI_FLINEAR2_803_TICK(t)
+# define BFI_FLINEAR2_802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_801, v ds
+# define BFI_FLINEAR2_802_TICK(t)
+# define BFI_FLINEAR2_801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_800, v ds
+# define BFI_FLINEAR2_801_TICK(t)
+# define BFI_FLINEAR2_800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_799, v ds
+# define BFI_FLINEAR2_800_TICK(t)
+# define BFI_FLINEAR2_799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_798, v ds
+# define BFI_FLINEAR2_799_TICK(t)
+# define BFI_FLINEAR2_798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_797, v ds
+# define BFI_FLINEAR2_798_TICK(t)
+# define BFI_FLINEAR2_797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_796, v ds
+# define BFI_FLINEAR2_797_TICK(t)
+# define BFI_FLINEAR2_796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_795, v ds
+# define BFI_FLINEAR2_796_TICK(t)
+# define BFI_FLINEAR2_795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_794, v ds
+# define BFI_FLINEAR2_795_TICK(t)
+# define BFI_FLINEAR2_794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_793, v ds
+# define BFI_FLINEAR2_794_TICK(t)
+# define BFI_FLINEAR2_793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_792, v ds
+# define BFI_FLINEAR2_793_TICK(t)
+# define BFI_FLINEAR2_792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_791, v ds
+# define BFI_FLINEAR2_792_TICK(t)
+# define BFI_FLINEAR2_791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_790, v ds
+# define BFI_FLINEAR2_791_TICK(t)
+# define BFI_FLINEAR2_790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_789, v ds
+# define BFI_FLINEAR2_790_TICK(t)
+# define BFI_FLINEAR2_789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_788, v ds
+# define BFI_FLINEAR2_789_TICK(t)
+# define BFI_FLINEAR2_788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_787, v ds
+# define BFI_FLINEAR2_788_TICK(t)
+# define BFI_FLINEAR2_787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_786, v ds
+# define BFI_FLINEAR2_787_TICK(t)
+# define BFI_FLINEAR2_786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_785, v ds
+# define BFI_FLINEAR2_786_TICK(t)
+# define BFI_FLINEAR2_785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_784, v ds
+# define BFI_FLINEAR2_785_TICK(t)
+# define BFI_FLINEAR2_784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_783, v ds
+# define BFI_FLINEAR2_784_TICK(t)
+# define BFI_FLINEAR2_783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_782, v ds
+# define BFI_FLINEAR2_783_TICK(t)
+# define BFI_FLINEAR2_782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_781, v ds
+# define BFI_FLINEAR2_782_TICK(t)
+# define BFI_FLINEAR2_781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_780, v ds
+# define BFI_FLINEAR2_781_TICK(t)
+# define BFI_FLINEAR2_780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_779, v ds
+# define BFI_FLINEAR2_780_TICK(t)
+# define BFI_FLINEAR2_779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_778, v ds
+# define BFI_FLINEAR2_779_TICK(t)
+# define BFI_FLINEAR2_778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_777, v ds
+# define BFI_FLINEAR2_778_TICK(t)
+# define BFI_FLINEAR2_777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_776, v ds
+# define BFI_FLINEAR2_777_TICK(t)
+# define BFI_FLINEAR2_776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_775, v ds
+# define BFI_FLINEAR2_776_TICK(t)
+# define BFI_FLINEAR2_775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_774, v ds
+# define BFI_FLINEAR2_775_TICK(t)
+# define BFI_FLINEAR2_774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_773, v ds
+# define BFI_FLINEAR2_774_TICK(t)
+# define BFI_FLINEAR2_773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_772, v ds
+# define BFI_FLINEAR2_773_TICK(t)
+# define BFI_FLINEAR2_772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_771, v ds
+# define BFI_FLINEAR2_772_TICK(t)
+# define BFI_FLINEAR2_771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_770, v ds
+# define BFI_FLINEAR2_771_TICK(t)
+# define BFI_FLINEAR2_770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_769, v ds
+# define BFI_FLINEAR2_770_TICK(t)
+# define BFI_FLINEAR2_769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_768, v ds
+# define BFI_FLINEAR2_769_TICK(t)
+# define BFI_FLINEAR2_768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_767, v ds
+# define BFI_FLINEAR2_768_TICK(t)
+# define BFI_FLINEAR2_767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_766, v ds
+# define BFI_FLINEAR2_767_TICK(t)
+# define BFI_FLINEAR2_766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_765, v ds
+# define BFI_FLINEAR2_766_TICK(t)
+# define BFI_FLINEAR2_765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_764, v ds
+# define BFI_FLINEAR2_765_TICK(t)
+# define BFI_FLINEAR2_764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_763, v ds
+# define BFI_FLINEAR2_764_TICK(t)
+# define BFI_FLINEAR2_763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_762, v ds
+# define BFI_FLINEAR2_763_TICK(t)
+# define BFI_FLINEAR2_762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_761, v ds
+# define BFI_FLINEAR2_762_TICK(t)
+# define BFI_FLINEAR2_761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_760, v ds
+# define BFI_FLINEAR2_761_TICK(t)
+# define BFI_FLINEAR2_760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_759, v ds
+# define BFI_FLINEAR2_760_TICK(t)
+# define BFI_FLINEAR2_759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_758, v ds
+# define BFI_FLINEAR2_759_TICK(t)
+# define BFI_FLINEAR2_758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_757, v ds
+# define BFI_FLINEAR2_758_TICK(t)
+# define BFI_FLINEAR2_757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_756, v ds
+# define BFI_FLINEAR2_757_TICK(t)
+# define BFI_FLINEAR2_756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_755, v ds
+# define BFI_FLINEAR2_756_TICK(t)
+# define BFI_FLINEAR2_755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_754, v ds
+# define BFI_FLINEAR2_755_TICK(t)
+# define BFI_FLINEAR2_754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_753, v ds
+# define BFI_FLINEAR2_754_TICK(t)
+# define BFI_FLINEAR2_753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_752, v ds
+# define BFI_FLINEAR2_753_TICK(t)
+# define BFI_FLINEAR2_752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_751, v ds
+# define BFI_FLINEAR2_752_TICK(t)
+# define BFI_FLINEAR2_751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_750, v ds
+# define BFI_FLINEAR2_751_TICK(t)
+# define BFI_FLINEAR2_750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_749, v ds
+# define BFI_FLINEAR2_750_TICK(t)
+# define BFI_FLINEAR2_749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_748, v ds
+# define BFI_FLINEAR2_749_TICK(t)
+# define BFI_FLINEAR2_748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_747, v ds
+# define BFI_FLINEAR2_748_TICK(t)
+# define BFI_FLINEAR2_747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_746, v ds
+# define BFI_FLINEAR2_747_TICK(t)
+# define BFI_FLINEAR2_746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_745, v ds
+# define BFI_FLINEAR2_746_TICK(t)
+# define BFI_FLINEAR2_745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_744, v ds
+# define BFI_FLINEAR2_745_TICK(t)
+# define BFI_FLINEAR2_744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_743, v ds
+# define BFI_FLINEAR2_744_TICK(t)
+# define BFI_FLINEAR2_743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_742, v ds
+# define BFI_FLINEAR2_743_TICK(t)
+# define BFI_FLINEAR2_742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_741, v ds
+# define BFI_FLINEAR2_742_TICK(t)
+# define BFI_FLINEAR2_741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_740, v ds
+# define BFI_FLINEAR2_741_TICK(t)
+# define BFI_FLINEAR2_740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_739, v ds
+# define BFI_FLINEAR2_740_TICK(t)
+# define BFI_FLINEAR2_739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_738, v ds
+# define BFI_FLINEAR2_739_TICK(t)
+# define BFI_FLINEAR2_738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_737, v ds
+# define BFI_FLINEAR2_738_TICK(t)
+# define BFI_FLINEAR2_737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_736, v ds
+# define BFI_FLINEAR2_737_TICK(t)
+# define BFI_FLINEAR2_736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_735, v ds
+# define BFI_FLINEAR2_736_TICK(t)
+# define BFI_FLINEAR2_735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_734, v ds
+# define BFI_FLINEAR2_735_TICK(t)
+# define BFI_FLINEAR2_734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_733, v ds
+# define BFI_FLINEAR2_734_TICK(t)
+# define BFI_FLINEAR2_733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_732, v ds
+# define BFI_FLINEAR2_733_TICK(t)
+# define BFI_FLINEAR2_732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_731, v ds
+# define BFI_FLINEAR2_732_TICK(t)
+# define BFI_FLINEAR2_731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_730, v ds
+# define BFI_FLINEAR2_731_TICK(t)
+# define BFI_FLINEAR2_730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_729, v ds
+# define BFI_FLINEAR2_730_TICK(t)
+# define BFI_FLINEAR2_729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_728, v ds
+# define BFI_FLINEAR2_729_TICK(t)
+# define BFI_FLINEAR2_728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_727, v ds
+# define BFI_FLINEAR2_728_TICK(t)
+# define BFI_FLINEAR2_727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_726, v ds
+# define BFI_FLINEAR2_727_TICK(t)
+# define BFI_FLINEAR2_726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_725, v ds
+# define BFI_FLINEAR2_726_TICK(t)
+# define BFI_FLINEAR2_725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_724, v ds
+# define BFI_FLINEAR2_725_TICK(t)
+# define BFI_FLINEAR2_724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_723, v ds
+# define BFI_FLINEAR2_724_TICK(t)
+# define BFI_FLINEAR2_723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_722, v ds
+# define BFI_FLINEAR2_723_TICK(t)
+# define BFI_FLINEAR2_722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_721, v ds
+# define BFI_FLINEAR2_722_TICK(t)
+# define BFI_FLINEAR2_721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_720, v ds
+# define BFI_FLINEAR2_721_TICK(t)
+# define BFI_FLINEAR2_720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_719, v ds
+# define BFI_FLINEAR2_720_TICK(t)
+# define BFI_FLINEAR2_719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_718, v ds
+# define BFI_FLINEAR2_719_TICK(t)
+# define BFI_FLINEAR2_718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_717, v ds
+# define BFI_FLINEAR2_718_TICK(t)
+# define BFI_FLINEAR2_717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_716, v ds
+# define BFI_FLINEAR2_717_TICK(t)
+# define BFI_FLINEAR2_716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_715, v ds
+# define BFI_FLINEAR2_716_TICK(t)
+# define BFI_FLINEAR2_715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_714, v ds
+# define BFI_FLINEAR2_715_TICK(t)
+# define BFI_FLINEAR2_714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_713, v ds
+# define BFI_FLINEAR2_714_TICK(t)
+# define BFI_FLINEAR2_713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_712, v ds
+# define BFI_FLINEAR2_713_TICK(t)
+# define BFI_FLINEAR2_712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_711, v ds
+# define BFI_FLINEAR2_712_TICK(t)
+# define BFI_FLINEAR2_711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_710, v ds
+# define BFI_FLINEAR2_711_TICK(t)
+# define BFI_FLINEAR2_710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_709, v ds
+# define BFI_FLINEAR2_710_TICK(t)
+# define BFI_FLINEAR2_709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_708, v ds
+# define BFI_FLINEAR2_709_TICK(t)
+# define BFI_FLINEAR2_708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_707, v ds
+# define BFI_FLINEAR2_708_TICK(t)
+# define BFI_FLINEAR2_707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_706, v ds
+# define BFI_FLINEAR2_707_TICK(t)
+# define BFI_FLINEAR2_706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_705, v ds
+# define BFI_FLINEAR2_706_TICK(t)
+# define BFI_FLINEAR2_705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_704, v ds
+# define BFI_FLINEAR2_705_TICK(t)
+# define BFI_FLINEAR2_704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_703, v ds
+# define BFI_FLINEAR2_704_TICK(t)
+# define BFI_FLINEAR2_703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_702, v ds
+# define BFI_FLINEAR2_703_TICK(t)
+# define BFI_FLINEAR2_702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_701, v ds
+# define BFI_FLINEAR2_702_TICK(t)
+# define BFI_FLINEAR2_701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_700, v ds
+# define BFI_FLINEAR2_701_TICK(t)
+# define BFI_FLINEAR2_700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_699, v ds
+# define BFI_FLINEAR2_700_TICK(t)
+# define BFI_FLINEAR2_699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_698, v ds
+# define BFI_FLINEAR2_699_TICK(t)
+# define BFI_FLINEAR2_698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_697, v ds
+# define BFI_FLINEAR2_698_TICK(t)
+# define BFI_FLINEAR2_697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_696, v ds
+# define BFI_FLINEAR2_697_TICK(t)
+# define BFI_FLINEAR2_696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_695, v ds
+# define BFI_FLINEAR2_696_TICK(t)
+# define BFI_FLINEAR2_695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_694, v ds
+# define BFI_FLINEAR2_695_TICK(t)
+# define BFI_FLINEAR2_694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_693, v ds
+# define BFI_FLINEAR2_694_TICK(t)
+# define BFI_FLINEAR2_693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_692, v ds
+# define BFI_FLINEAR2_693_TICK(t)
+# define BFI_FLINEAR2_692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_691, v ds
+# define BFI_FLINEAR2_692_TICK(t)
+# define BFI_FLINEAR2_691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_690, v ds
+# define BFI_FLINEAR2_691_TICK(t)
+# define BFI_FLINEAR2_690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_689, v ds
+# define BFI_FLINEAR2_690_TICK(t)
+# define BFI_FLINEAR2_689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_688, v ds
+# define BFI_FLINEAR2_689_TICK(t)
+# define BFI_FLINEAR2_688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_687, v ds
+# define BFI_FLINEAR2_688_TICK(t)
+# define BFI_FLINEAR2_687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_686, v ds
+# define BFI_FLINEAR2_687_TICK(t)
+# define BFI_FLINEAR2_686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_685, v ds
+# define BFI_FLINEAR2_686_TICK(t)
+# define BFI_FLINEAR2_685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_684, v ds
+# define BFI_FLINEAR2_685_TICK(t)
+# define BFI_FLINEAR2_684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_683, v ds
+# define BFI_FLINEAR2_684_TICK(t)
+# define BFI_FLINEAR2_683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_682, v ds
+# define BFI_FLINEAR2_683_TICK(t)
+# define BFI_FLINEAR2_682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_681, v ds
+# define BFI_FLINEAR2_682_TICK(t)
+# define BFI_FLINEAR2_681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_680, v ds
+# define BFI_FLINEAR2_681_TICK(t)
+# define BFI_FLINEAR2_680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_679, v ds
+# define BFI_FLINEAR2_680_TICK(t)
+# define BFI_FLINEAR2_679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_678, v ds
+# define BFI_FLINEAR2_679_TICK(t)
+# define BFI_FLINEAR2_678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_677, v ds
+# define BFI_FLINEAR2_678_TICK(t)
+# define BFI_FLINEAR2_677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_676, v ds
+# define BFI_FLINEAR2_677_TICK(t)
+# define BFI_FLINEAR2_676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_675, v ds
+# define BFI_FLINEAR2_676_TICK(t)
+# define BFI_FLINEAR2_675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_674, v ds
+# define BFI_FLINEAR2_675_TICK(t)
+# define BFI_FLINEAR2_674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_673, v ds
+# define BFI_FLINEAR2_674_TICK(t)
+# define BFI_FLINEAR2_673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_672, v ds
+# define BFI_FLINEAR2_673_TICK(t)
+# define BFI_FLINEAR2_672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_671, v ds
+# define BFI_FLINEAR2_672_TICK(t)
+# define BFI_FLINEAR2_671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_670, v ds
+# define BFI_FLINEAR2_671_TICK(t)
+# define BFI_FLINEAR2_670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_669, v ds
+# define BFI_FLINEAR2_670_TICK(t)
+# define BFI_FLINEAR2_669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_668, v ds
+# define BFI_FLINEAR2_669_TICK(t)
+# define BFI_FLINEAR2_668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_667, v ds
+# define BFI_FLINEAR2_668_TICK(t)
+# define BFI_FLINEAR2_667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_666, v ds
+# define BFI_FLINEAR2_667_TICK(t)
+# define BFI_FLINEAR2_666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_665, v ds
+# define BFI_FLINEAR2_666_TICK(t)
+# define BFI_FLINEAR2_665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_664, v ds
+# define BFI_FLINEAR2_665_TICK(t)
+# define BFI_FLINEAR2_664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_663, v ds
+# define BFI_FLINEAR2_664_TICK(t)
+# define BFI_FLINEAR2_663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_662, v ds
+# define BFI_FLINEAR2_663_TICK(t)
+# define BFI_FLINEAR2_662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_661, v ds
+# define BFI_FLINEAR2_662_TICK(t)
+# define BFI_FLINEAR2_661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_660, v ds
+# define BFI_FLINEAR2_661_TICK(t)
+# define BFI_FLINEAR2_660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_659, v ds
+# define BFI_FLINEAR2_660_TICK(t)
+# define BFI_FLINEAR2_659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_658, v ds
+# define BFI_FLINEAR2_659_TICK(t)
+# define BFI_FLINEAR2_658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_657, v ds
+# define BFI_FLINEAR2_658_TICK(t)
+# define BFI_FLINEAR2_657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_656, v ds
+# define BFI_FLINEAR2_657_TICK(t)
+# define BFI_FLINEAR2_656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_655, v ds
+# define BFI_FLINEAR2_656_TICK(t)
+# define BFI_FLINEAR2_655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_654, v ds
+# define BFI_FLINEAR2_655_TICK(t)
+# define BFI_FLINEAR2_654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_653, v ds
+# define BFI_FLINEAR2_654_TICK(t)
+# define BFI_FLINEAR2_653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_652, v ds
+# define BFI_FLINEAR2_653_TICK(t)
+# define BFI_FLINEAR2_652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_651, v ds
+# define BFI_FLINEAR2_652_TICK(t)
+# define BFI_FLINEAR2_651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_650, v ds
+# define BFI_FLINEAR2_651_TICK(t)
+# define BFI_FLINEAR2_650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_649, v ds
+# define BFI_FLINEAR2_650_TICK(t)
+# define BFI_FLINEAR2_649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_648, v ds
+# define BFI_FLINEAR2_649_TICK(t)
+# define BFI_FLINEAR2_648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_647, v ds
+# define BFI_FLINEAR2_648_TICK(t)
+# define BFI_FLINEAR2_647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_646, v ds
+# define BFI_FLINEAR2_647_TICK(t)
+# define BFI_FLINEAR2_646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_645, v ds
+# define BFI_FLINEAR2_646_TICK(t)
+# define BFI_FLINEAR2_645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_644, v ds
+# define BFI_FLINEAR2_645_TICK(t)
+# define BFI_FLINEAR2_644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_643, v ds
+# define BFI_FLINEAR2_644_TICK(t)
+# define BFI_FLINEAR2_643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_642, v ds
+# define BFI_FLINEAR2_643_TICK(t)
+# define BFI_FLINEAR2_642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_641, v ds
+# define BFI_FLINEAR2_642_TICK(t)
+# define BFI_FLINEAR2_641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_640, v ds
+# define BFI_FLINEAR2_641_TICK(t)
+# define BFI_FLINEAR2_640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_639, v ds
+# define BFI_FLINEAR2_640_TICK(t)
+# define BFI_FLINEAR2_639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_638, v ds
+# define BFI_FLINEAR2_639_TICK(t)
+# define BFI_FLINEAR2_638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_637, v ds
+# define BFI_FLINEAR2_638_TICK(t)
+# define BFI_FLINEAR2_637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_636, v ds
+# define BFI_FLINEAR2_637_TICK(t)
+# define BFI_FLINEAR2_636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_635, v ds
+# define BFI_FLINEAR2_636_TICK(t)
+# define BFI_FLINEAR2_635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_634, v ds
+# define BFI_FLINEAR2_635_TICK(t)
+# define BFI_FLINEAR2_634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_633, v ds
+# define BFI_FLINEAR2_634_TICK(t)
+# define BFI_FLINEAR2_633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_632, v ds
+# define BFI_FLINEAR2_633_TICK(t)
+# define BFI_FLINEAR2_632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_631, v ds
+# define BFI_FLINEAR2_632_TICK(t)
+# define BFI_FLINEAR2_631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_630, v ds
+# define BFI_FLINEAR2_631_TICK(t)
+# define BFI_FLINEAR2_630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_629, v ds
+# define BFI_FLINEAR2_630_TICK(t)
+# define BFI_FLINEAR2_629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_628, v ds
+# define BFI_FLINEAR2_629_TICK(t)
+# define BFI_FLINEAR2_628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_627, v ds
+# define BFI_FLINEAR2_628_TICK(t)
+# define BFI_FLINEAR2_627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_626, v ds
+# define BFI_FLINEAR2_627_TICK(t)
+# define BFI_FLINEAR2_626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_625, v ds
+# define BFI_FLINEAR2_626_TICK(t)
+# define BFI_FLINEAR2_625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_624, v ds
+# define BFI_FLINEAR2_625_TICK(t)
+# define BFI_FLINEAR2_624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_623, v ds
+# define BFI_FLINEAR2_624_TICK(t)
+# define BFI_FLINEAR2_623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_622, v ds
+# define BFI_FLINEAR2_623_TICK(t)
+# define BFI_FLINEAR2_622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_621, v ds
+# define BFI_FLINEAR2_622_TICK(t)
+# define BFI_FLINEAR2_621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_620, v ds
+# define BFI_FLINEAR2_621_TICK(t)
+# define BFI_FLINEAR2_620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_619, v ds
+# define BFI_FLINEAR2_620_TICK(t)
+# define BFI_FLINEAR2_619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_618, v ds
+# define BFI_FLINEAR2_619_TICK(t)
+# define BFI_FLINEAR2_618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_617, v ds
+# define BFI_FLINEAR2_618_TICK(t)
+# define BFI_FLINEAR2_617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_616, v ds
+# define BFI_FLINEAR2_617_TICK(t)
+# define BFI_FLINEAR2_616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_615, v ds
+# define BFI_FLINEAR2_616_TICK(t)
+# define BFI_FLINEAR2_615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_614, v ds
+# define BFI_FLINEAR2_615_TICK(t)
+# define BFI_FLINEAR2_614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_613, v ds
+# define BFI_FLINEAR2_614_TICK(t)
+# define BFI_FLINEAR2_613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_612, v ds
+# define BFI_FLINEAR2_613_TICK(t)
+# define BFI_FLINEAR2_612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_611, v ds
+# define BFI_FLINEAR2_612_TICK(t)
+# define BFI_FLINEAR2_611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_610, v ds
+# define BFI_FLINEAR2_611_TICK(t)
+# define BFI_FLINEAR2_610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_609, v ds
+# define BFI_FLINEAR2_610_TICK(t)
+# define BFI_FLINEAR2_609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_608, v ds
+# define BFI_FLINEAR2_609_TICK(t)
+# define BFI_FLINEAR2_608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_607, v ds
+# define BFI_FLINEAR2_608_TICK(t)
+# define BFI_FLINEAR2_607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_606, v ds
+# define BFI_FLINEAR2_607_TICK(t)
+# define BFI_FLINEAR2_606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_605, v ds
+# define BFI_FLINEAR2_606_TICK(t)
+# define BFI_FLINEAR2_605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_604, v ds
+# define BFI_FLINEAR2_605_TICK(t)
+# define BFI_FLINEAR2_604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_603, v ds
+# define BFI_FLINEAR2_604_TICK(t)
+# define BFI_FLINEAR2_603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_602, v ds
+# define BFI_FLINEAR2_603_TICK(t)
+# define BFI_FLINEAR2_602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_601, v ds
+# define BFI_FLINEAR2_602_TICK(t)
+# define BFI_FLINEAR2_601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_600, v ds
+# define BFI_FLINEAR2_601_TICK(t)
+# define BFI_FLINEAR2_600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_599, v ds
+# define BFI_FLINEAR2_600_TICK(t)
+# define BFI_FLINEAR2_599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_598, v ds
+# define BFI_FLINEAR2_599_TICK(t)
+# define BFI_FLINEAR2_598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_597, v ds
+# define BFI_FLINEAR2_598_TICK(t)
+# define BFI_FLINEAR2_597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_596, v ds
+# define BFI_FLINEAR2_597_TICK(t)
+# define BFI_FLINEAR2_596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_595, v ds
+# define BFI_FLINEAR2_596_TICK(t)
+# define BFI_FLINEAR2_595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_594, v ds
+# define BFI_FLINEAR2_595_TICK(t)
+# define BFI_FLINEAR2_594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_593, v ds
+# define BFI_FLINEAR2_594_TICK(t)
+# define BFI_FLINEAR2_593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_592, v ds
+# define BFI_FLINEAR2_593_TICK(t)
+# define BFI_FLINEAR2_592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_591, v ds
+# define BFI_FLINEAR2_592_TICK(t)
+# define BFI_FLINEAR2_591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_590, v ds
+# define BFI_FLINEAR2_591_TICK(t)
+# define BFI_FLINEAR2_590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_589, v ds
+# define BFI_FLINEAR2_590_TICK(t)
+# define BFI_FLINEAR2_589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_588, v ds
+# define BFI_FLINEAR2_589_TICK(t)
+# define BFI_FLINEAR2_588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_587, v ds
+# define BFI_FLINEAR2_588_TICK(t)
+# define BFI_FLINEAR2_587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_586, v ds
+# define BFI_FLINEAR2_587_TICK(t)
+# define BFI_FLINEAR2_586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_585, v ds
+# define BFI_FLINEAR2_586_TICK(t)
+# define BFI_FLINEAR2_585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_584, v ds
+# define BFI_FLINEAR2_585_TICK(t)
+# define BFI_FLINEAR2_584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_583, v ds
+# define BFI_FLINEAR2_584_TICK(t)
+# define BFI_FLINEAR2_583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_582, v ds
+# define BFI_FLINEAR2_583_TICK(t)
+# define BFI_FLINEAR2_582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_581, v ds
+# define BFI_FLINEAR2_582_TICK(t)
+# define BFI_FLINEAR2_581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_580, v ds
+# define BFI_FLINEAR2_581_TICK(t)
+# define BFI_FLINEAR2_580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_579, v ds
+# define BFI_FLINEAR2_580_TICK(t)
+# define BFI_FLINEAR2_579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_578, v ds
+# define BFI_FLINEAR2_579_TICK(t)
+# define BFI_FLINEAR2_578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_577, v ds
+# define BFI_FLINEAR2_578_TICK(t)
+# define BFI_FLINEAR2_577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_576, v ds
+# define BFI_FLINEAR2_577_TICK(t)
+# define BFI_FLINEAR2_576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_575, v ds
+# define BFI_FLINEAR2_576_TICK(t)
+# define BFI_FLINEAR2_575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_574, v ds
+# define BFI_FLINEAR2_575_TICK(t)
+# define BFI_FLINEAR2_574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_573, v ds
+# define BFI_FLINEAR2_574_TICK(t)
+# define BFI_FLINEAR2_573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_572, v ds
+# define BFI_FLINEAR2_573_TICK(t)
+# define BFI_FLINEAR2_572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_571, v ds
+# define BFI_FLINEAR2_572_TICK(t)
+# define BFI_FLINEAR2_571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_570, v ds
+# define BFI_FLINEAR2_571_TICK(t)
+# define BFI_FLINEAR2_570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_569, v ds
+# define BFI_FLINEAR2_570_TICK(t)
+# define BFI_FLINEAR2_569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_568, v ds
+# define BFI_FLINEAR2_569_TICK(t)
+# define BFI_FLINEAR2_568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_567, v ds
+# define BFI_FLINEAR2_568_TICK(t)
+# define BFI_FLINEAR2_567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_566, v ds
+# define BFI_FLINEAR2_567_TICK(t)
+# define BFI_FLINEAR2_566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_565, v ds
+# define BFI_FLINEAR2_566_TICK(t)
+# define BFI_FLINEAR2_565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_564, v ds
+# define BFI_FLINEAR2_565_TICK(t)
+# define BFI_FLINEAR2_564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_563, v ds
+# define BFI_FLINEAR2_564_TICK(t)
+# define BFI_FLINEAR2_563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_562, v ds
+# define BFI_FLINEAR2_563_TICK(t)
+# define BFI_FLINEAR2_562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_561, v ds
+# define BFI_FLINEAR2_562_TICK(t)
+# define BFI_FLINEAR2_561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_560, v ds
+# define BFI_FLINEAR2_561_TICK(t)
+# define BFI_FLINEAR2_560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_559, v ds
+# define BFI_FLINEAR2_560_TICK(t)
+# define BFI_FLINEAR2_559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_558, v ds
+# define BFI_FLINEAR2_559_TICK(t)
+# define BFI_FLINEAR2_558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_557, v ds
+# define BFI_FLINEAR2_558_TICK(t)
+# define BFI_FLINEAR2_557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_556, v ds
+# define BFI_FLINEAR2_557_TICK(t)
+# define BFI_FLINEAR2_556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_555, v ds
+# define BFI_FLINEAR2_556_TICK(t)
+# define BFI_FLINEAR2_555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_554, v ds
+# define BFI_FLINEAR2_555_TICK(t)
+# define BFI_FLINEAR2_554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_553, v ds
+# define BFI_FLINEAR2_554_TICK(t)
+# define BFI_FLINEAR2_553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_552, v ds
+# define BFI_FLINEAR2_553_TICK(t)
+# define BFI_FLINEAR2_552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_551, v ds
+# define BFI_FLINEAR2_552_TICK(t)
+# define BFI_FLINEAR2_551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_550, v ds
+# define BFI_FLINEAR2_551_TICK(t)
+# define BFI_FLINEAR2_550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_549, v ds
+# define BFI_FLINEAR2_550_TICK(t)
+# define BFI_FLINEAR2_549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_548, v ds
+# define BFI_FLINEAR2_549_TICK(t)
+# define BFI_FLINEAR2_548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_547, v ds
+# define BFI_FLINEAR2_548_TICK(t)
+# define BFI_FLINEAR2_547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_546, v ds
+# define BFI_FLINEAR2_547_TICK(t)
+# define BFI_FLINEAR2_546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_545, v ds
+# define BFI_FLINEAR2_546_TICK(t)
+# define BFI_FLINEAR2_545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_544, v ds
+# define BFI_FLINEAR2_545_TICK(t)
+# define BFI_FLINEAR2_544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_543, v ds
+# define BFI_FLINEAR2_544_TICK(t)
+# define BFI_FLINEAR2_543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_542, v ds
+# define BFI_FLINEAR2_543_TICK(t)
+# define BFI_FLINEAR2_542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_541, v ds
+# define BFI_FLINEAR2_542_TICK(t)
+# define BFI_FLINEAR2_541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_540, v ds
+# define BFI_FLINEAR2_541_TICK(t)
+# define BFI_FLINEAR2_540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_539, v ds
+# define BFI_FLINEAR2_540_TICK(t)
+# define BFI_FLINEAR2_539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_538, v ds
+# define BFI_FLINEAR2_539_TICK(t)
+# define BFI_FLINEAR2_538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_537, v ds
+# define BFI_FLINEAR2_538_TICK(t)
+# define BFI_FLINEAR2_537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_536, v ds
+# define BFI_FLINEAR2_537_TICK(t)
+# define BFI_FLINEAR2_536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_535, v ds
+# define BFI_FLINEAR2_536_TICK(t)
+# define BFI_FLINEAR2_535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_534, v ds
+# define BFI_FLINEAR2_535_TICK(t)
+# define BFI_FLINEAR2_534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_533, v ds
+# define BFI_FLINEAR2_534_TICK(t)
+# define BFI_FLINEAR2_533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_532, v ds
+# define BFI_FLINEAR2_533_TICK(t)
+# define BFI_FLINEAR2_532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_531, v ds
+# define BFI_FLINEAR2_532_TICK(t)
+# define BFI_FLINEAR2_531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_530, v ds
+# define BFI_FLINEAR2_531_TICK(t)
+# define BFI_FLINEAR2_530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_529, v ds
+# define BFI_FLINEAR2_530_TICK(t)
+# define BFI_FLINEAR2_529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_528, v ds
+# define BFI_FLINEAR2_529_TICK(t)
+# define BFI_FLINEAR2_528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_527, v ds
+# define BFI_FLINEAR2_528_TICK(t)
+# define BFI_FLINEAR2_527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_526, v ds
+# define BFI_FLINEAR2_527_TICK(t)
+# define BFI_FLINEAR2_526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_525, v ds
+# define BFI_FLINEAR2_526_TICK(t)
+# define BFI_FLINEAR2_525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_524, v ds
+# define BFI_FLINEAR2_525_TICK(t)
+# define BFI_FLINEAR2_524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_523, v ds
+# define BFI_FLINEAR2_524_TICK(t)
+# define BFI_FLINEAR2_523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_522, v ds
+# define BFI_FLINEAR2_523_TICK(t)
+# define BFI_FLINEAR2_522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_521, v ds
+# define BFI_FLINEAR2_522_TICK(t)
+# define BFI_FLINEAR2_521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_520, v ds
+# define BFI_FLINEAR2_521_TICK(t)
+# define BFI_FLINEAR2_520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_519, v ds
+# define BFI_FLINEAR2_520_TICK(t)
+# define BFI_FLINEAR2_519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_518, v ds
+# define BFI_FLINEAR2_519_TICK(t)
+# define BFI_FLINEAR2_518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_517, v ds
+# define BFI_FLINEAR2_518_TICK(t)
+# define BFI_FLINEAR2_517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_516, v ds
+# define BFI_FLINEAR2_517_TICK(t)
+# define BFI_FLINEAR2_516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_515, v ds
+# define BFI_FLINEAR2_516_TICK(t)
+# define BFI_FLINEAR2_515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_514, v ds
+# define BFI_FLINEAR2_515_TICK(t)
+# define BFI_FLINEAR2_514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_513, v ds
+# define BFI_FLINEAR2_514_TICK(t)
+# define BFI_FLINEAR2_513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_512, v ds
+# define BFI_FLINEAR2_513_TICK(t)
+# define BFI_FLINEAR2_512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_511, v ds
+# define BFI_FLINEAR2_512_TICK(t)
+# define BFI_FLINEAR2_511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_510, v ds
+# define BFI_FLINEAR2_511_TICK(t)
+# define BFI_FLINEAR2_510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_509, v ds
+# define BFI_FLINEAR2_510_TICK(t)
+# define BFI_FLINEAR2_509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_508, v ds
+# define BFI_FLINEAR2_509_TICK(t)
+# define BFI_FLINEAR2_508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_507, v ds
+# define BFI_FLINEAR2_508_TICK(t)
+# define BFI_FLINEAR2_507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_506, v ds
+# define BFI_FLINEAR2_507_TICK(t)
+# define BFI_FLINEAR2_506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_505, v ds
+# define BFI_FLINEAR2_506_TICK(t)
+# define BFI_FLINEAR2_505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_504, v ds
+# define BFI_FLINEAR2_505_TICK(t)
+# define BFI_FLINEAR2_504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_503, v ds
+# define BFI_FLINEAR2_504_TICK(t)
+# define BFI_FLINEAR2_503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_502, v ds
+# define BFI_FLINEAR2_503_TICK(t)
+# define BFI_FLINEAR2_502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_501, v ds
+# define BFI_FLINEAR2_502_TICK(t)
+# define BFI_FLINEAR2_501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_500, v ds
+# define BFI_FLINEAR2_501_TICK(t)
+# define BFI_FLINEAR2_500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_499, v ds
+# define BFI_FLINEAR2_500_TICK(t)
+# define BFI_FLINEAR2_499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_498, v ds
+# define BFI_FLINEAR2_499_TICK(t)
+# define BFI_FLINEAR2_498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_497, v ds
+# define BFI_FLINEAR2_498_TICK(t)
+# define BFI_FLINEAR2_497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_496, v ds
+# define BFI_FLINEAR2_497_TICK(t)
+# define BFI_FLINEAR2_496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_495, v ds
+# define BFI_FLINEAR2_496_TICK(t)
+# define BFI_FLINEAR2_495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_494, v ds
+# define BFI_FLINEAR2_495_TICK(t)
+# define BFI_FLINEAR2_494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_493, v ds
+# define BFI_FLINEAR2_494_TICK(t)
+# define BFI_FLINEAR2_493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_492, v ds
+# define BFI_FLINEAR2_493_TICK(t)
+# define BFI_FLINEAR2_492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_491, v ds
+# define BFI_FLINEAR2_492_TICK(t)
+# define BFI_FLINEAR2_491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_490, v ds
+# define BFI_FLINEAR2_491_TICK(t)
+# define BFI_FLINEAR2_490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_489, v ds
+# define BFI_FLINEAR2_490_TICK(t)
+# define BFI_FLINEAR2_489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_488, v ds
+# define BFI_FLINEAR2_489_TICK(t)
+# define BFI_FLINEAR2_488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_487, v ds
+# define BFI_FLINEAR2_488_TICK(t)
+# define BFI_FLINEAR2_487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_486, v ds
+# define BFI_FLINEAR2_487_TICK(t)
+# define BFI_FLINEAR2_486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_485, v ds
+# define BFI_FLINEAR2_486_TICK(t)
+# define BFI_FLINEAR2_485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_484, v ds
+# define BFI_FLINEAR2_485_TICK(t)
+# define BFI_FLINEAR2_484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_483, v ds
+# define BFI_FLINEAR2_484_TICK(t)
+# define BFI_FLINEAR2_483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_482, v ds
+# define BFI_FLINEAR2_483_TICK(t)
+# define BFI_FLINEAR2_482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_481, v ds
+# define BFI_FLINEAR2_482_TICK(t)
+# define BFI_FLINEAR2_481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_480, v ds
+# define BFI_FLINEAR2_481_TICK(t)
+# define BFI_FLINEAR2_480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_479, v ds
+# define BFI_FLINEAR2_480_TICK(t)
+# define BFI_FLINEAR2_479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_478, v ds
+# define BFI_FLINEAR2_479_TICK(t)
+# define BFI_FLINEAR2_478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_477, v ds
+# define BFI_FLINEAR2_478_TICK(t)
+# define BFI_FLINEAR2_477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_476, v ds
+# define BFI_FLINEAR2_477_TICK(t)
+# define BFI_FLINEAR2_476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_475, v ds
+# define BFI_FLINEAR2_476_TICK(t)
+# define BFI_FLINEAR2_475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_474, v ds
+# define BFI_FLINEAR2_475_TICK(t)
+# define BFI_FLINEAR2_474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_473, v ds
+# define BFI_FLINEAR2_474_TICK(t)
+# define BFI_FLINEAR2_473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_472, v ds
+# define BFI_FLINEAR2_473_TICK(t)
+# define BFI_FLINEAR2_472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_471, v ds
+# define BFI_FLINEAR2_472_TICK(t)
+# define BFI_FLINEAR2_471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_470, v ds
+# define BFI_FLINEAR2_471_TICK(t)
+# define BFI_FLINEAR2_470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_469, v ds
+# define BFI_FLINEAR2_470_TICK(t)
+# define BFI_FLINEAR2_469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_468, v ds
+# define BFI_FLINEAR2_469_TICK(t)
+# define BFI_FLINEAR2_468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_467, v ds
+# define BFI_FLINEAR2_468_TICK(t)
+# define BFI_FLINEAR2_467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_466, v ds
+# define BFI_FLINEAR2_467_TICK(t)
+# define BFI_FLINEAR2_466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_465, v ds
+# define BFI_FLINEAR2_466_TICK(t)
+# define BFI_FLINEAR2_465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_464, v ds
+# define BFI_FLINEAR2_465_TICK(t)
+# define BFI_FLINEAR2_464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_463, v ds
+# define BFI_FLINEAR2_464_TICK(t)
+# define BFI_FLINEAR2_463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_462, v ds
+# define BFI_FLINEAR2_463_TICK(t)
+# define BFI_FLINEAR2_462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_461, v ds
+# define BFI_FLINEAR2_462_TICK(t)
+# define BFI_FLINEAR2_461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_460, v ds
+# define BFI_FLINEAR2_461_TICK(t)
+# define BFI_FLINEAR2_460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_459, v ds
+# define BFI_FLINEAR2_460_TICK(t)
+# define BFI_FLINEAR2_459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_458, v ds
+# define BFI_FLINEAR2_459_TICK(t)
+# define BFI_FLINEAR2_458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_457, v ds
+# define BFI_FLINEAR2_458_TICK(t)
+# define BFI_FLINEAR2_457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_456, v ds
+# define BFI_FLINEAR2_457_TICK(t)
+# define BFI_FLINEAR2_456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_455, v ds
+# define BFI_FLINEAR2_456_TICK(t)
+# define BFI_FLINEAR2_455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_454, v ds
+# define BFI_FLINEAR2_455_TICK(t)
+# define BFI_FLINEAR2_454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_453, v ds
+# define BFI_FLINEAR2_454_TICK(t)
+# define BFI_FLINEAR2_453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_452, v ds
+# define BFI_FLINEAR2_453_TICK(t)
+# define BFI_FLINEAR2_452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_451, v ds
+# define BFI_FLINEAR2_452_TICK(t)
+# define BFI_FLINEAR2_451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_450, v ds
+# define BFI_FLINEAR2_451_TICK(t)
+# define BFI_FLINEAR2_450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_449, v ds
+# define BFI_FLINEAR2_450_TICK(t)
+# define BFI_FLINEAR2_449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_448, v ds
+# define BFI_FLINEAR2_449_TICK(t)
+# define BFI_FLINEAR2_448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_447, v ds
+# define BFI_FLINEAR2_448_TICK(t)
+# define BFI_FLINEAR2_447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_446, v ds
+# define BFI_FLINEAR2_447_TICK(t)
+# define BFI_FLINEAR2_446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_445, v ds
+# define BFI_FLINEAR2_446_TICK(t)
+# define BFI_FLINEAR2_445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_444, v ds
+# define BFI_FLINEAR2_445_TICK(t)
+# define BFI_FLINEAR2_444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_443, v ds
+# define BFI_FLINEAR2_444_TICK(t)
+# define BFI_FLINEAR2_443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_442, v ds
+# define BFI_FLINEAR2_443_TICK(t)
+# define BFI_FLINEAR2_442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_441, v ds
+# define BFI_FLINEAR2_442_TICK(t)
+# define BFI_FLINEAR2_441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_440, v ds
+# define BFI_FLINEAR2_441_TICK(t)
+# define BFI_FLINEAR2_440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_439, v ds
+# define BFI_FLINEAR2_440_TICK(t)
+# define BFI_FLINEAR2_439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_438, v ds
+# define BFI_FLINEAR2_439_TICK(t)
+# define BFI_FLINEAR2_438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_437, v ds
+# define BFI_FLINEAR2_438_TICK(t)
+# define BFI_FLINEAR2_437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_436, v ds
+# define BFI_FLINEAR2_437_TICK(t)
+# define BFI_FLINEAR2_436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_435, v ds
+# define BFI_FLINEAR2_436_TICK(t)
+# define BFI_FLINEAR2_435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_434, v ds
+# define BFI_FLINEAR2_435_TICK(t)
+# define BFI_FLINEAR2_434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_433, v ds
+# define BFI_FLINEAR2_434_TICK(t)
+# define BFI_FLINEAR2_433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_432, v ds
+# define BFI_FLINEAR2_433_TICK(t)
+# define BFI_FLINEAR2_432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_431, v ds
+# define BFI_FLINEAR2_432_TICK(t)
+# define BFI_FLINEAR2_431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_430, v ds
+# define BFI_FLINEAR2_431_TICK(t)
+# define BFI_FLINEAR2_430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_429, v ds
+# define BFI_FLINEAR2_430_TICK(t)
+# define BFI_FLINEAR2_429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_428, v ds
+# define BFI_FLINEAR2_429_TICK(t)
+# define BFI_FLINEAR2_428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_427, v ds
+# define BFI_FLINEAR2_428_TICK(t)
+# define BFI_FLINEAR2_427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_426, v ds
+# define BFI_FLINEAR2_427_TICK(t)
+# define BFI_FLINEAR2_426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_425, v ds
+# define BFI_FLINEAR2_426_TICK(t)
+# define BFI_FLINEAR2_425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_424, v ds
+# define BFI_FLINEAR2_425_TICK(t)
+# define BFI_FLINEAR2_424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_423, v ds
+# define BFI_FLINEAR2_424_TICK(t)
+# define BFI_FLINEAR2_423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_422, v ds
+# define BFI_FLINEAR2_423_TICK(t)
+# define BFI_FLINEAR2_422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_421, v ds
+# define BFI_FLINEAR2_422_TICK(t)
+# define BFI_FLINEAR2_421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_420, v ds
+# define BFI_FLINEAR2_421_TICK(t)
+# define BFI_FLINEAR2_420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_419, v ds
+# define BFI_FLINEAR2_420_TICK(t)
+# define BFI_FLINEAR2_419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_418, v ds
+# define BFI_FLINEAR2_419_TICK(t)
+# define BFI_FLINEAR2_418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_417, v ds
+# define BFI_FLINEAR2_418_TICK(t)
+# define BFI_FLINEAR2_417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_416, v ds
+# define BFI_FLINEAR2_417_TICK(t)
+# define BFI_FLINEAR2_416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_415, v ds
+# define BFI_FLINEAR2_416_TICK(t)
+# define BFI_FLINEAR2_415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_414, v ds
+# define BFI_FLINEAR2_415_TICK(t)
+# define BFI_FLINEAR2_414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_413, v ds
+# define BFI_FLINEAR2_414_TICK(t)
+# define BFI_FLINEAR2_413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_412, v ds
+# define BFI_FLINEAR2_413_TICK(t)
+# define BFI_FLINEAR2_412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_411, v ds
+# define BFI_FLINEAR2_412_TICK(t)
+# define BFI_FLINEAR2_411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_410, v ds
+# define BFI_FLINEAR2_411_TICK(t)
+# define BFI_FLINEAR2_410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_409, v ds
+# define BFI_FLINEAR2_410_TICK(t)
+# define BFI_FLINEAR2_409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_408, v ds
+# define BFI_FLINEAR2_409_TICK(t)
+# define BFI_FLINEAR2_408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_407, v ds
+# define BFI_FLINEAR2_408_TICK(t)
+# define BFI_FLINEAR2_407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_406, v ds
+# define BFI_FLINEAR2_407_TICK(t)
+# define BFI_FLINEAR2_406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_405, v ds
+# define BFI_FLINEAR2_406_TICK(t)
+# define BFI_FLINEAR2_405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_404, v ds
+# define BFI_FLINEAR2_405_TICK(t)
+# define BFI_FLINEAR2_404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_403, v ds
+# define BFI_FLINEAR2_404_TICK(t)
+# define BFI_FLINEAR2_403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_402, v ds
+# define BFI_FLINEAR2_403_TICK(t)
+# define BFI_FLINEAR2_402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_401, v ds
+# define BFI_FLINEAR2_402_TICK(t)
+# define BFI_FLINEAR2_401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_400, v ds
+# define BFI_FLINEAR2_401_TICK(t)
+# define BFI_FLINEAR2_400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_399, v ds
+# define BFI_FLINEAR2_400_TICK(t)
+# define BFI_FLINEAR2_399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_398, v ds
+# define BFI_FLINEAR2_399_TICK(t)
+# define BFI_FLINEAR2_398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_397, v ds
+# define BFI_FLINEAR2_398_TICK(t)
+# define BFI_FLINEAR2_397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_396, v ds
+# define BFI_FLINEAR2_397_TICK(t)
+# define BFI_FLINEAR2_396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_395, v ds
+# define BFI_FLINEAR2_396_TICK(t)
+# define BFI_FLINEAR2_395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_394, v ds
+# define BFI_FLINEAR2_395_TICK(t)
+# define BFI_FLINEAR2_394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_393, v ds
+# define BFI_FLINEAR2_394_TICK(t)
+# define BFI_FLINEAR2_393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_392, v ds
+# define BFI_FLINEAR2_393_TICK(t)
+# define BFI_FLINEAR2_392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_391, v ds
+# define BFI_FLINEAR2_392_TICK(t)
+# define BFI_FLINEAR2_391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_390, v ds
+# define BFI_FLINEAR2_391_TICK(t)
+# define BFI_FLINEAR2_390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_389, v ds
+# define BFI_FLINEAR2_390_TICK(t)
+# define BFI_FLINEAR2_389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_388, v ds
+# define BFI_FLINEAR2_389_TICK(t)
+# define BFI_FLINEAR2_388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_387, v ds
+# define BFI_FLINEAR2_388_TICK(t)
+# define BFI_FLINEAR2_387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_386, v ds
+# define BFI_FLINEAR2_387_TICK(t)
+# define BFI_FLINEAR2_386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_385, v ds
+# define BFI_FLINEAR2_386_TICK(t)
+# define BFI_FLINEAR2_385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_384, v ds
+# define BFI_FLINEAR2_385_TICK(t)
+# define BFI_FLINEAR2_384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_383, v ds
+# define BFI_FLINEAR2_384_TICK(t)
+# define BFI_FLINEAR2_383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_382, v ds
+# define BFI_FLINEAR2_383_TICK(t)
+# define BFI_FLINEAR2_382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_381, v ds
+# define BFI_FLINEAR2_382_TICK(t)
+# define BFI_FLINEAR2_381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_380, v ds
+# define BFI_FLINEAR2_381_TICK(t)
+# define BFI_FLINEAR2_380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_379, v ds
+# define BFI_FLINEAR2_380_TICK(t)
+# define BFI_FLINEAR2_379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_378, v ds
+# define BFI_FLINEAR2_379_TICK(t)
+# define BFI_FLINEAR2_378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_377, v ds
+# define BFI_FLINEAR2_378_TICK(t)
+# define BFI_FLINEAR2_377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_376, v ds
+# define BFI_FLINEAR2_377_TICK(t)
+# define BFI_FLINEAR2_376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_375, v ds
+# define BFI_FLINEAR2_376_TICK(t)
+# define BFI_FLINEAR2_375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_374, v ds
+# define BFI_FLINEAR2_375_TICK(t)
+# define BFI_FLINEAR2_374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_373, v ds
+# define BFI_FLINEAR2_374_TICK(t)
+# define BFI_FLINEAR2_373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_372, v ds
+# define BFI_FLINEAR2_373_TICK(t)
+# define BFI_FLINEAR2_372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_371, v ds
+# define BFI_FLINEAR2_372_TICK(t)
+# define BFI_FLINEAR2_371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_370, v ds
+# define BFI_FLINEAR2_371_TICK(t)
+# define BFI_FLINEAR2_370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_369, v ds
+# define BFI_FLINEAR2_370_TICK(t)
+# define BFI_FLINEAR2_369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_368, v ds
+# define BFI_FLINEAR2_369_TICK(t)
+# define BFI_FLINEAR2_368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_367, v ds
+# define BFI_FLINEAR2_368_TICK(t)
+# define BFI_FLINEAR2_367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_366, v ds
+# define BFI_FLINEAR2_367_TICK(t)
+# define BFI_FLINEAR2_366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_365, v ds
+# define BFI_FLINEAR2_366_TICK(t)
+# define BFI_FLINEAR2_365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_364, v ds
+# define BFI_FLINEAR2_365_TICK(t)
+# define BFI_FLINEAR2_364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_363, v ds
+# define BFI_FLINEAR2_364_TICK(t)
+# define BFI_FLINEAR2_363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_362, v ds
+# define BFI_FLINEAR2_363_TICK(t)
+# define BFI_FLINEAR2_362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_361, v ds
+# define BFI_FLINEAR2_362_TICK(t)
+# define BFI_FLINEAR2_361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_360, v ds
+# define BFI_FLINEAR2_361_TICK(t)
+# define BFI_FLINEAR2_360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_359, v ds
+# define BFI_FLINEAR2_360_TICK(t)
+# define BFI_FLINEAR2_359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_358, v ds
+# define BFI_FLINEAR2_359_TICK(t)
+# define BFI_FLINEAR2_358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_357, v ds
+# define BFI_FLINEAR2_358_TICK(t)
+# define BFI_FLINEAR2_357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_356, v ds
+# define BFI_FLINEAR2_357_TICK(t)
+# define BFI_FLINEAR2_356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_355, v ds
+# define BFI_FLINEAR2_356_TICK(t)
+# define BFI_FLINEAR2_355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_354, v ds
+# define BFI_FLINEAR2_355_TICK(t)
+# define BFI_FLINEAR2_354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_353, v ds
+# define BFI_FLINEAR2_354_TICK(t)
+# define BFI_FLINEAR2_353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_352, v ds
+# define BFI_FLINEAR2_353_TICK(t)
+# define BFI_FLINEAR2_352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_351, v ds
+# define BFI_FLINEAR2_352_TICK(t)
+# define BFI_FLINEAR2_351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_350, v ds
+# define BFI_FLINEAR2_351_TICK(t)
+# define BFI_FLINEAR2_350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_349, v ds
+# define BFI_FLINEAR2_350_TICK(t)
+# define BFI_FLINEAR2_349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_348, v ds
+# define BFI_FLINEAR2_349_TICK(t)
+# define BFI_FLINEAR2_348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_347, v ds
+# define BFI_FLINEAR2_348_TICK(t)
+# define BFI_FLINEAR2_347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_346, v ds
+# define BFI_FLINEAR2_347_TICK(t)
+# define BFI_FLINEAR2_346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_345, v ds
+# define BFI_FLINEAR2_346_TICK(t)
+# define BFI_FLINEAR2_345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_344, v ds
+# define BFI_FLINEAR2_345_TICK(t)
+# define BFI_FLINEAR2_344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_343, v ds
+# define BFI_FLINEAR2_344_TICK(t)
+# define BFI_FLINEAR2_343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_342, v ds
+# define BFI_FLINEAR2_343_TICK(t)
+# define BFI_FLINEAR2_342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_341, v ds
+# define BFI_FLINEAR2_342_TICK(t)
+# define BFI_FLINEAR2_341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_340, v ds
+# define BFI_FLINEAR2_341_TICK(t)
+# define BFI_FLINEAR2_340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_339, v ds
+# define BFI_FLINEAR2_340_TICK(t)
+# define BFI_FLINEAR2_339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_338, v ds
+# define BFI_FLINEAR2_339_TICK(t)
+# define BFI_FLINEAR2_338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_337, v ds
+# define BFI_FLINEAR2_338_TICK(t)
+# define BFI_FLINEAR2_337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_336, v ds
+# define BFI_FLINEAR2_337_TICK(t)
+# define BFI_FLINEAR2_336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_335, v ds
+# define BFI_FLINEAR2_336_TICK(t)
+# define BFI_FLINEAR2_335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_334, v ds
+# define BFI_FLINEAR2_335_TICK(t)
+# define BFI_FLINEAR2_334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_333, v ds
+# define BFI_FLINEAR2_334_TICK(t)
+# define BFI_FLINEAR2_333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_332, v ds
+# define BFI_FLINEAR2_333_TICK(t)
+# define BFI_FLINEAR2_332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_331, v ds
+# define BFI_FLINEAR2_332_TICK(t)
+# define BFI_FLINEAR2_331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_330, v ds
+# define BFI_FLINEAR2_331_TICK(t)
+# define BFI_FLINEAR2_330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_329, v ds
+# define BFI_FLINEAR2_330_TICK(t)
+# define BFI_FLINEAR2_329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_328, v ds
+# define BFI_FLINEAR2_329_TICK(t)
+# define BFI_FLINEAR2_328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_327, v ds
+# define BFI_FLINEAR2_328_TICK(t)
+# define BFI_FLINEAR2_327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_326, v ds
+# define BFI_FLINEAR2_327_TICK(t)
+# define BFI_FLINEAR2_326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_325, v ds
+# define BFI_FLINEAR2_326_TICK(t)
+# define BFI_FLINEAR2_325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_324, v ds
+# define BFI_FLINEAR2_325_TICK(t)
+# define BFI_FLINEAR2_324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_323, v ds
+# define BFI_FLINEAR2_324_TICK(t)
+# define BFI_FLINEAR2_323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_322, v ds
+# define BFI_FLINEAR2_323_TICK(t)
+# define BFI_FLINEAR2_322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_321, v ds
+# define BFI_FLINEAR2_322_TICK(t)
+# define BFI_FLINEAR2_321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_320, v ds
+# define BFI_FLINEAR2_321_TICK(t)
+# define BFI_FLINEAR2_320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_319, v ds
+# define BFI_FLINEAR2_320_TICK(t)
+# define BFI_FLINEAR2_319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_318, v ds
+# define BFI_FLINEAR2_319_TICK(t)
+# define BFI_FLINEAR2_318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_317, v ds
+# define BFI_FLINEAR2_318_TICK(t)
+# define BFI_FLINEAR2_317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_316, v ds
+# define BFI_FLINEAR2_317_TICK(t)
+# define BFI_FLINEAR2_316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_315, v ds
+# define BFI_FLINEAR2_316_TICK(t)
+# define BFI_FLINEAR2_315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_314, v ds
+# define BFI_FLINEAR2_315_TICK(t)
+# define BFI_FLINEAR2_314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_313, v ds
+# define BFI_FLINEAR2_314_TICK(t)
+# define BFI_FLINEAR2_313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_312, v ds
+# define BFI_FLINEAR2_313_TICK(t)
+# define BFI_FLINEAR2_312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_311, v ds
+# define BFI_FLINEAR2_312_TICK(t)
+# define BFI_FLINEAR2_311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_310, v ds
+# define BFI_FLINEAR2_311_TICK(t)
+# define BFI_FLINEAR2_310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_309, v ds
+# define BFI_FLINEAR2_310_TICK(t)
+# define BFI_FLINEAR2_309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_308, v ds
+# define BFI_FLINEAR2_309_TICK(t)
+# define BFI_FLINEAR2_308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_307, v ds
+# define BFI_FLINEAR2_308_TICK(t)
+# define BFI_FLINEAR2_307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_306, v ds
+# define BFI_FLINEAR2_307_TICK(t)
+# define BFI_FLINEAR2_306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_305, v ds
+# define BFI_FLINEAR2_306_TICK(t)
+# define BFI_FLINEAR2_305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_304, v ds
+# define BFI_FLINEAR2_305_TICK(t)
+# define BFI_FLINEAR2_304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_303, v ds
+# define BFI_FLINEAR2_304_TICK(t)
+# define BFI_FLINEAR2_303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_302, v ds
+# define BFI_FLINEAR2_303_TICK(t)
+# define BFI_FLINEAR2_302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_301, v ds
+# define BFI_FLINEAR2_302_TICK(t)
+# define BFI_FLINEAR2_301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_300, v ds
+# define BFI_FLINEAR2_301_TICK(t)
+# define BFI_FLINEAR2_300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_299, v ds
+# define BFI_FLINEAR2_300_TICK(t)
+# define BFI_FLINEAR2_299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_298, v ds
+# define BFI_FLINEAR2_299_TICK(t)
+# define BFI_FLINEAR2_298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_297, v ds
+# define BFI_FLINEAR2_298_TICK(t)
+# define BFI_FLINEAR2_297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_296, v ds
+# define BFI_FLINEAR2_297_TICK(t)
+# define BFI_FLINEAR2_296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_295, v ds
+# define BFI_FLINEAR2_296_TICK(t)
+# define BFI_FLINEAR2_295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_294, v ds
+# define BFI_FLINEAR2_295_TICK(t)
+# define BFI_FLINEAR2_294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_293, v ds
+# define BFI_FLINEAR2_294_TICK(t)
+# define BFI_FLINEAR2_293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_292, v ds
+# define BFI_FLINEAR2_293_TICK(t)
+# define BFI_FLINEAR2_292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_291, v ds
+# define BFI_FLINEAR2_292_TICK(t)
+# define BFI_FLINEAR2_291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_290, v ds
+# define BFI_FLINEAR2_291_TICK(t)
+# define BFI_FLINEAR2_290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_289, v ds
+# define BFI_FLINEAR2_290_TICK(t)
+# define BFI_FLINEAR2_289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_288, v ds
+# define BFI_FLINEAR2_289_TICK(t)
+# define BFI_FLINEAR2_288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_287, v ds
+# define BFI_FLINEAR2_288_TICK(t)
+# define BFI_FLINEAR2_287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_286, v ds
+# define BFI_FLINEAR2_287_TICK(t)
+# define BFI_FLINEAR2_286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_285, v ds
+# define BFI_FLINEAR2_286_TICK(t)
+# define BFI_FLINEAR2_285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_284, v ds
+# define BFI_FLINEAR2_285_TICK(t)
+# define BFI_FLINEAR2_284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_283, v ds
+# define BFI_FLINEAR2_284_TICK(t)
+# define BFI_FLINEAR2_283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_282, v ds
+# define BFI_FLINEAR2_283_TICK(t)
+# define BFI_FLINEAR2_282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_281, v ds
+# define BFI_FLINEAR2_282_TICK(t)
+# define BFI_FLINEAR2_281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_280, v ds
+# define BFI_FLINEAR2_281_TICK(t)
+# define BFI_FLINEAR2_280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_279, v ds
+# define BFI_FLINEAR2_280_TICK(t)
+# define BFI_FLINEAR2_279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_278, v ds
+# define BFI_FLINEAR2_279_TICK(t)
+# define BFI_FLINEAR2_278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_277, v ds
+# define BFI_FLINEAR2_278_TICK(t)
+# define BFI_FLINEAR2_277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_276, v ds
+# define BFI_FLINEAR2_277_TICK(t)
+# define BFI_FLINEAR2_276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_275, v ds
+# define BFI_FLINEAR2_276_TICK(t)
+# define BFI_FLINEAR2_275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_274, v ds
+# define BFI_FLINEAR2_275_TICK(t)
+# define BFI_FLINEAR2_274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_273, v ds
+# define BFI_FLINEAR2_274_TICK(t)
+# define BFI_FLINEAR2_273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_272, v ds
+# define BFI_FLINEAR2_273_TICK(t)
+# define BFI_FLINEAR2_272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_271, v ds
+# define BFI_FLINEAR2_272_TICK(t)
+# define BFI_FLINEAR2_271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_270, v ds
+# define BFI_FLINEAR2_271_TICK(t)
+# define BFI_FLINEAR2_270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_269, v ds
+# define BFI_FLINEAR2_270_TICK(t)
+# define BFI_FLINEAR2_269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_268, v ds
+# define BFI_FLINEAR2_269_TICK(t)
+# define BFI_FLINEAR2_268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_267, v ds
+# define BFI_FLINEAR2_268_TICK(t)
+# define BFI_FLINEAR2_267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_266, v ds
+# define BFI_FLINEAR2_267_TICK(t)
+# define BFI_FLINEAR2_266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_265, v ds
+# define BFI_FLINEAR2_266_TICK(t)
+# define BFI_FLINEAR2_265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_264, v ds
+# define BFI_FLINEAR2_265_TICK(t)
+# define BFI_FLINEAR2_264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_263, v ds
+# define BFI_FLINEAR2_264_TICK(t)
+# define BFI_FLINEAR2_263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_262, v ds
+# define BFI_FLINEAR2_263_TICK(t)
+# define BFI_FLINEAR2_262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_261, v ds
+# define BFI_FLINEAR2_262_TICK(t)
+# define BFI_FLINEAR2_261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_260, v ds
+# define BFI_FLINEAR2_261_TICK(t)
+# define BFI_FLINEAR2_260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_259, v ds
+# define BFI_FLINEAR2_260_TICK(t)
+# define BFI_FLINEAR2_259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_258, v ds
+# define BFI_FLINEAR2_259_TICK(t)
+# define BFI_FLINEAR2_258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_257, v ds
+# define BFI_FLINEAR2_258_TICK(t)
+# define BFI_FLINEAR2_257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_256, v ds
+# define BFI_FLINEAR2_257_TICK(t)
+
+# endif
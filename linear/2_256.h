@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_2_256_H
+# define BFI_LINEAR_2_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR2_256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_255, v ds
+# define BFI_FLINEAR2_256_TICK(t)
+# define BFI_FLINEAR2_255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_254, v ds
+# define BFI_FLINEAR2_255_TICK(t)
+# define BFI_FLINEAR2_254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_253, v ds
+# define BFI_FLINEAR2_254_TICK(t)
+# define BFI_FLINEAR2_253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_252, v ds
+# define BFI_FLINEAR2_253_TICK(t)
+# define BFI_FLINEAR2_252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_251, v ds
+# define BFI_FLINEAR2_252_TICK(t)
+# define BFI_FLINEAR2_251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_250, v ds
+# define BFI_FLINEAR2_251_TICK(t)
+# define BFI_FLINEAR2_250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_249, v ds
+# define BFI_FLINEAR2_250_TICK(t)
+# define BFI_FLINEAR2_249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_248, v ds
+# define BFI_FLINEAR2_249_TICK(t)
+# define BFI_FLINEAR2_248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_247, v ds
+# define BFI_FLINEAR2_248_TICK(t)
+# define BFI_FLINEAR2_247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_246, v ds
+# define BFI_FLINEAR2_247_TICK(t)
+# define BFI_FLINEAR2_246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_245, v ds
+# define BFI_FLINEAR2_246_TICK(t)
+# define BFI_FLINEAR2_245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_244, v ds
+# define BFI_FLINEAR2_245_TICK(t)
+# define BFI_FLINEAR2_244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_243, v ds
+# define BFI_FLINEAR2_244_TICK(t)
+# define BFI_FLINEAR2_243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_242, v ds
+# define BFI_FLINEAR2_243_TICK(t)
+# define BFI_FLINEAR2_242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_241, v ds
+# define BFI_FLINEAR2_242_TICK(t)
+# define BFI_FLINEAR2_241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_240, v ds
+# define BFI_FLINEAR2_241_TICK(t)
+# define BFI_FLINEAR2_240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_239, v ds
+# define BFI_FLINEAR2_240_TICK(t)
+# define BFI_FLINEAR2_239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_238, v ds
+# define BFI_FLINEAR2_239_TICK(t)
+# define BFI_FLINEAR2_238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_237, v ds
+# define BFI_FLINEAR2_238_TICK(t)
+# define BFI_FLINEAR2_237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_236, v ds
+# define BFI_FLINEAR2_237_TICK(t)
+# define BFI_FLINEAR2_236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_235, v ds
+# define BFI_FLINEAR2_236_TICK(t)
+# define BFI_FLINEAR2_235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_234, v ds
+# define BFI_FLINEAR2_235_TICK(t)
+# define BFI_FLINEAR2_234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_233, v ds
+# define BFI_FLINEAR2_234_TICK(t)
+# define BFI_FLINEAR2_233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_232, v ds
+# define BFI_FLINEAR2_233_TICK(t)
+# define BFI_FLINEAR2_232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_231, v ds
+# define BFI_FLINEAR2_232_TICK(t)
+# define BFI_FLINEAR2_231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_230, v ds
+# define BFI_FLINEAR2_231_TICK(t)
+# define BFI_FLINEAR2_230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_229, v ds
+# define BFI_FLINEAR2_230_TICK(t)
+# define BFI_FLINEAR2_229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_228, v ds
+# define BFI_FLINEAR2_229_TICK(t)
+# define BFI_FLINEAR2_228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_227, v ds
+# define BFI_FLINEAR2_228_TICK(t)
+# define BFI_FLINEAR2_227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_226, v ds
+# define BFI_FLINEAR2_227_TICK(t)
+# define BFI_FLINEAR2_226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_225, v ds
+# define BFI_FLINEAR2_226_TICK(t)
+# define BFI_FLINEAR2_225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_224, v ds
+# define BFI_FLINEAR2_225_TICK(t)
+# define BFI_FLINEAR2_224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_223, v ds
+# define BFI_FLINEAR2_224_TICK(t)
+# define BFI_FLINEAR2_223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_222, v ds
+# define BFI_FLINEAR2_223_TICK(t)
+# define BFI_FLINEAR2_222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_221, v ds
+# define BFI_FLINEAR2_222_TICK(t)
+# define BFI_FLINEAR2_221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_220, v ds
+# define BFI_FLINEAR2_221_TICK(t)
+# define BFI_FLINEAR2_220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_219, v ds
+# define BFI_FLINEAR2_220_TICK(t)
+# define BFI_FLINEAR2_219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_218, v ds
+# define BFI_FLINEAR2_219_TICK(t)
+# define BFI_FLINEAR2_218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_217, v ds
+# define BFI_FLINEAR2_218_TICK(t)
+# define BFI_FLINEAR2_217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_216, v ds
+# define BFI_FLINEAR2_217_TICK(t)
+# define BFI_FLINEAR2_216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_215, v ds
+# define BFI_FLINEAR2_216_TICK(t)
+# define BFI_FLINEAR2_215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_214, v ds
+# define BFI_FLINEAR2_215_TICK(t)
+# define BFI_FLINEAR2_214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_213, v ds
+# define BFI_FLINEAR2_214_TICK(t)
+# define BFI_FLINEAR2_213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_212, v ds
+# define BFI_FLINEAR2_213_TICK(t)
+# define BFI_FLINEAR2_212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_211, v ds
+# define BFI_FLINEAR2_212_TICK(t)
+# define BFI_FLINEAR2_211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_210, v ds
+# define BFI_FLINEAR2_211_TICK(t)
+# define BFI_FLINEAR2_210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_209, v ds
+# define BFI_FLINEAR2_210_TICK(t)
+# define BFI_FLINEAR2_209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_208, v ds
+# define BFI_FLINEAR2_209_TICK(t)
+# define BFI_FLINEAR2_208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_207, v ds
+# define BFI_FLINEAR2_208_TICK(t)
+# define BFI_FLINEAR2_207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_206, v ds
+# define BFI_FLINEAR2_207_TICK(t)
+# define BFI_FLINEAR2_206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_205, v ds
+# define BFI_FLINEAR2_206_TICK(t)
+# define BFI_FLINEAR2_205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_204, v ds
+# define BFI_FLINEAR2_205_TICK(t)
+# define BFI_FLINEAR2_204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_203, v ds
+# define BFI_FLINEAR2_204_TICK(t)
+# define BFI_FLINEAR2_203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_202, v ds
+# define BFI_FLINEAR2_203_TICK(t)
+# define BFI_FLINEAR2_202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_201, v ds
+# define BFI_FLINEAR2_202_TICK(t)
+# define BFI_FLINEAR2_201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_200, v ds
+# define BFI_FLINEAR2_201_TICK(t)
+# define BFI_FLINEAR2_200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_199, v ds
+# define BFI_FLINEAR2_200_TICK(t)
+# define BFI_FLINEAR2_199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_198, v ds
+# define BFI_FLINEAR2_199_TICK(t)
+# define BFI_FLINEAR2_198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_197, v ds
+# define BFI_FLINEAR2_198_TICK(t)
+# define BFI_FLINEAR2_197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_196, v ds
+# define BFI_FLINEAR2_197_TICK(t)
+# define BFI_FLINEAR2_196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_195, v ds
+# define BFI_FLINEAR2_196_TICK(t)
+# define BFI_FLINEAR2_195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_194, v ds
+# define BFI_FLINEAR2_195_TICK(t)
+# define BFI_FLINEAR2_194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_193, v ds
+# define BFI_FLINEAR2_194_TICK(t)
+# define BFI_FLINEAR2_193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_192, v ds
+# define BFI_FLINEAR2_193_TICK(t)
+# define BFI_FLINEAR2_192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_191, v ds
+# define BFI_FLINEAR2_192_TICK(t)
+# define BFI_FLINEAR2_191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_190, v ds
+# define BFI_FLINEAR2_191_TICK(t)
+# define BFI_FLINEAR2_190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_189, v ds
+# define BFI_FLINEAR2_190_TICK(t)
+# define BFI_FLINEAR2_189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_188, v ds
+# define BFI_FLINEAR2_189_TICK(t)
+# define BFI_FLINEAR2_188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_187, v ds
+# define BFI_FLINEAR2_188_TICK(t)
+# define BFI_FLINEAR2_187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_186, v ds
+# define BFI_FLINEAR2_187_TICK(t)
+# define BFI_FLINEAR2_186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_185, v ds
+# define BFI_FLINEAR2_186_TICK(t)
+# define BFI_FLINEAR2_185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_184, v ds
+# define BFI_FLINEAR2_185_TICK(t)
+# define BFI_FLINEAR2_184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_183, v ds
+# define BFI_FLINEAR2_184_TICK(t)
+# define BFI_FLINEAR2_183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_182, v ds
+# define BFI_FLINEAR2_183_TICK(t)
+# define BFI_FLINEAR2_182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_181, v ds
+# define BFI_FLINEAR2_182_TICK(t)
+# define BFI_FLINEAR2_181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_180, v ds
+# define BFI_FLINEAR2_181_TICK(t)
+# define BFI_FLINEAR2_180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_179, v ds
+# define BFI_FLINEAR2_180_TICK(t)
+# define BFI_FLINEAR2_179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_178, v ds
+# define BFI_FLINEAR2_179_TICK(t)
+# define BFI_FLINEAR2_178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_177, v ds
+# define BFI_FLINEAR2_178_TICK(t)
+# define BFI_FLINEAR2_177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_176, v ds
+# define BFI_FLINEAR2_177_TICK(t)
+# define BFI_FLINEAR2_176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_175, v ds
+# define BFI_FLINEAR2_176_TICK(t)
+# define BFI_FLINEAR2_175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_174, v ds
+# define BFI_FLINEAR2_175_TICK(t)
+# define BFI_FLINEAR2_174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_173, v ds
+# define BFI_FLINEAR2_174_TICK(t)
+# define BFI_FLINEAR2_173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_172, v ds
+# define BFI_FLINEAR2_173_TICK(t)
+# define BFI_FLINEAR2_172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_171, v ds
+# define BFI_FLINEAR2_172_TICK(t)
+# define BFI_FLINEAR2_171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_170, v ds
+# define BFI_FLINEAR2_171_TICK(t)
+# define BFI_FLINEAR2_170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_169, v ds
+# define BFI_FLINEAR2_170_TICK(t)
+# define BFI_FLINEAR2_169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_168, v ds
+# define BFI_FLINEAR2_169_TICK(t)
+# define BFI_FLINEAR2_168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_167, v ds
+# define BFI_FLINEAR2_168_TICK(t)
+# define BFI_FLINEAR2_167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_166, v ds
+# define BFI_FLINEAR2_167_TICK(t)
+# define BFI_FLINEAR2_166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_165, v ds
+# define BFI_FLINEAR2_166_TICK(t)
+# define BFI_FLINEAR2_165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_164, v ds
+# define BFI_FLINEAR2_165_TICK(t)
+# define BFI_FLINEAR2_164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_163, v ds
+# define BFI_FLINEAR2_164_TICK(t)
+# define BFI_FLINEAR2_163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_162, v ds
+# define BFI_FLINEAR2_163_TICK(t)
+# define BFI_FLINEAR2_162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_161, v ds
+# define BFI_FLINEAR2_162_TICK(t)
+# define BFI_FLINEAR2_161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_160, v ds
+# define BFI_FLINEAR2_161_TICK(t)
+# define BFI_FLINEAR2_160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_159, v ds
+# define BFI_FLINEAR2_160_TICK(t)
+# define BFI_FLINEAR2_159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_158, v ds
+# define BFI_FLINEAR2_159_TICK(t)
+# define BFI_FLINEAR2_158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_157, v ds
+# define BFI_FLINEAR2_158_TICK(t)
+# define BFI_FLINEAR2_157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_156, v ds
+# define BFI_FLINEAR2_157_TICK(t)
+# define BFI_FLINEAR2_156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_155, v ds
+# define BFI_FLINEAR2_156_TICK(t)
+# define BFI_FLINEAR2_155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_154, v ds
+# define BFI_FLINEAR2_155_TICK(t)
+# define BFI_FLINEAR2_154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_153, v ds
+# define BFI_FLINEAR2_154_TICK(t)
+# define BFI_FLINEAR2_153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_152, v ds
+# define BFI_FLINEAR2_153_TICK(t)
+# define BFI_FLINEAR2_152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_151, v ds
+# define BFI_FLINEAR2_152_TICK(t)
+# define BFI_FLINEAR2_151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_150, v ds
+# define BFI_FLINEAR2_151_TICK(t)
+# define BFI_FLINEAR2_150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_149, v ds
+# define BFI_FLINEAR2_150_TICK(t)
+# define BFI_FLINEAR2_149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_148, v ds
+# define BFI_FLINEAR2_149_TICK(t)
+# define BFI_FLINEAR2_148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_147, v ds
+# define BFI_FLINEAR2_148_TICK(t)
+# define BFI_FLINEAR2_147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_146, v ds
+# define BFI_FLINEAR2_147_TICK(t)
+# define BFI_FLINEAR2_146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_145, v ds
+# define BFI_FLINEAR2_146_TICK(t)
+# define BFI_FLINEAR2_145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_144, v ds
+# define BFI_FLINEAR2_145_TICK(t)
+# define BFI_FLINEAR2_144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_143, v ds
+# define BFI_FLINEAR2_144_TICK(t)
+# define BFI_FLINEAR2_143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_142, v ds
+# define BFI_FLINEAR2_143_TICK(t)
+# define BFI_FLINEAR2_142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_141, v ds
+# define BFI_FLINEAR2_142_TICK(t)
+# define BFI_FLINEAR2_141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_140, v ds
+# define BFI_FLINEAR2_141_TICK(t)
+# define BFI_FLINEAR2_140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_139, v ds
+# define BFI_FLINEAR2_140_TICK(t)
+# define BFI_FLINEAR2_139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_138, v ds
+# define BFI_FLINEAR2_139_TICK(t)
+# define BFI_FLINEAR2_138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_137, v ds
+# define BFI_FLINEAR2_138_TICK(t)
+# define BFI_FLINEAR2_137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_136, v ds
+# define BFI_FLINEAR2_137_TICK(t)
+# define BFI_FLINEAR2_136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_135, v ds
+# define BFI_FLINEAR2_136_TICK(t)
+# define BFI_FLINEAR2_135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_134, v ds
+# define BFI_FLINEAR2_135_TICK(t)
+# define BFI_FLINEAR2_134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_133, v ds
+# define BFI_FLINEAR2_134_TICK(t)
+# define BFI_FLINEAR2_133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_132, v ds
+# define BFI_FLINEAR2_133_TICK(t)
+# define BFI_FLINEAR2_132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_131, v ds
+# define BFI_FLINEAR2_132_TICK(t)
+# define BFI_FLINEAR2_131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_130, v ds
+# define BFI_FLINEAR2_131_TICK(t)
+# define BFI_FLINEAR2_130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_129, v ds
+# define BFI_FLINEAR2_130_TICK(t)
+# define BFI_FLINEAR2_129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_128, v ds
+# define BFI_FLINEAR2_129_TICK(t)
+# define BFI_FLINEAR2_128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_127, v ds
+# define BFI_FLINEAR2_128_TICK(t)
+# define BFI_FLINEAR2_127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_126, v ds
+# define BFI_FLINEAR2_127_TICK(t)
+# define BFI_FLINEAR2_126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_125, v ds
+# define BFI_FLINEAR2_126_TICK(t)
+# define BFI_FLINEAR2_125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_124, v ds
+# define BFI_FLINEAR2_125_TICK(t)
+# define BFI_FLINEAR2_124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_123, v ds
+# define BFI_FLINEAR2_124_TICK(t)
+# define BFI_FLINEAR2_123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_122, v ds
+# define BFI_FLINEAR2_123_TICK(t)
+# define BFI_FLINEAR2_122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_121, v ds
+# define BFI_FLINEAR2_122_TICK(t)
+# define BFI_FLINEAR2_121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_120, v ds
+# define BFI_FLINEAR2_121_TICK(t)
+# define BFI_FLINEAR2_120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_119, v ds
+# define BFI_FLINEAR2_120_TICK(t)
+# define BFI_FLINEAR2_119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_118, v ds
+# define BFI_FLINEAR2_119_TICK(t)
+# define BFI_FLINEAR2_118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_117, v ds
+# define BFI_FLINEAR2_118_TICK(t)
+# define BFI_FLINEAR2_117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_116, v ds
+# define BFI_FLINEAR2_117_TICK(t)
+# define BFI_FLINEAR2_116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_115, v ds
+# define BFI_FLINEAR2_116_TICK(t)
+# define BFI_FLINEAR2_115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_114, v ds
+# define BFI_FLINEAR2_115_TICK(t)
+# define BFI_FLINEAR2_114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_113, v ds
+# define BFI_FLINEAR2_114_TICK(t)
+# define BFI_FLINEAR2_113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_112, v ds
+# define BFI_FLINEAR2_113_TICK(t)
+# define BFI_FLINEAR2_112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_111, v ds
+# define BFI_FLINEAR2_112_TICK(t)
+# define BFI_FLINEAR2_111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_110, v ds
+# define BFI_FLINEAR2_111_TICK(t)
+# define BFI_FLINEAR2_110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_109, v ds
+# define BFI_FLINEAR2_110_TICK(t)
+# define BFI_FLINEAR2_109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_108, v ds
+# define BFI_FLINEAR2_109_TICK(t)
+# define BFI_FLINEAR2_108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_107, v ds
+# define BFI_FLINEAR2_108_TICK(t)
+# define BFI_FLINEAR2_107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_106, v ds
+# define BFI_FLINEAR2_107_TICK(t)
+# define BFI_FLINEAR2_106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_105, v ds
+# define BFI_FLINEAR2_106_TICK(t)
+# define BFI_FLINEAR2_105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_104, v ds
+# define BFI_FLINEAR2_105_TICK(t)
+# define BFI_FLINEAR2_104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_103, v ds
+# define BFI_FLINEAR2_104_TICK(t)
+# define BFI_FLINEAR2_103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_102, v ds
+# define BFI_FLINEAR2_103_TICK(t)
+# define BFI_FLINEAR2_102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_101, v ds
+# define BFI_FLINEAR2_102_TICK(t)
+# define BFI_FLINEAR2_101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_100, v ds
+# define BFI_FLINEAR2_101_TICK(t)
+# define BFI_FLINEAR2_100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_99, v ds
+# define BFI_FLINEAR2_100_TICK(t)
+# define BFI_FLINEAR2_99(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_98, v ds
+# define BFI_FLINEAR2_99_TICK(t)
+# define BFI_FLINEAR2_98(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_97, v ds
+# define BFI_FLINEAR2_98_TICK(t)
+# define BFI_FLINEAR2_97(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_96, v ds
+# define BFI_FLINEAR2_97_TICK(t)
+# define BFI_FLINEAR2_96(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_95, v ds
+# define BFI_FLINEAR2_96_TICK(t)
+# define BFI_FLINEAR2_95(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_94, v ds
+# define BFI_FLINEAR2_95_TICK(t)
+# define BFI_FLINEAR2_94(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_93, v ds
+# define BFI_FLINEAR2_94_TICK(t)
+# define BFI_FLINEAR2_93(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_92, v ds
+# define BFI_FLINEAR2_93_TICK(t)
+# define BFI_FLINEAR2_92(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_91, v ds
+# define BFI_FLINEAR2_92_TICK(t)
+# define BFI_FLINEAR2_91(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_90, v ds
+# define BFI_FLINEAR2_91_TICK(t)
+# define BFI_FLINEAR2_90(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_89, v ds
+# define BFI_FLINEAR2_90_TICK(t)
+# define BFI_FLINEAR2_89(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_88, v ds
+# define BFI_FLINEAR2_89_TICK(t)
+# define BFI_FLINEAR2_88(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_87, v ds
+# define BFI_FLINEAR2_88_TICK(t)
+# define BFI_FLINEAR2_87(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_86, v ds
+# define BFI_FLINEAR2_87_TICK(t)
+# define BFI_FLINEAR2_86(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_85, v ds
+# define BFI_FLINEAR2_86_TICK(t)
+# define BFI_FLINEAR2_85(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_84, v ds
+# define BFI_FLINEAR2_85_TICK(t)
+# define BFI_FLINEAR2_84(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_83, v ds
+# define BFI_FLINEAR2_84_TICK(t)
+# define BFI_FLINEAR2_83(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_82, v ds
+# define BFI_FLINEAR2_83_TICK(t)
+# define BFI_FLINEAR2_82(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_81, v ds
+# define BFI_FLINEAR2_82_TICK(t)
+# define BFI_FLINEAR2_81(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_80, v ds
+# define BFI_FLINEAR2_81_TICK(t)
+# define BFI_FLINEAR2_80(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_79, v ds
+# define BFI_FLINEAR2_80_TICK(t)
+# define BFI_FLINEAR2_79(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_78, v ds
+# define BFI_FLINEAR2_79_TICK(t)
+# define BFI_FLINEAR2_78(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_77, v ds
+# define BFI_FLINEAR2_78_TICK(t)
+# define BFI_FLINEAR2_77(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_76, v ds
+# define BFI_FLINEAR2_77_TICK(t)
+# define BFI_FLINEAR2_76(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_75, v ds
+# define BFI_FLINEAR2_76_TICK(t)
+# define BFI_FLINEAR2_75(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_74, v ds
+# define BFI_FLINEAR2_75_TICK(t)
+# define BFI_FLINEAR2_74(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_73, v ds
+# define BFI_FLINEAR2_74_TICK(t)
+# define BFI_FLINEAR2_73(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_72, v ds
+# define BFI_FLINEAR2_73_TICK(t)
+# define BFI_FLINEAR2_72(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_71, v ds
+# define BFI_FLINEAR2_72_TICK(t)
+# define BFI_FLINEAR2_71(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_70, v ds
+# define BFI_FLINEAR2_71_TICK(t)
+# define BFI_FLINEAR2_70(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_69, v ds
+# define BFI_FLINEAR2_70_TICK(t)
+# define BFI_FLINEAR2_69(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_68, v ds
+# define BFI_FLINEAR2_69_TICK(t)
+# define BFI_FLINEAR2_68(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_67, v ds
+# define BFI_FLINEAR2_68_TICK(t)
+# define BFI_FLINEAR2_67(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_66, v ds
+# define BFI_FLINEAR2_67_TICK(t)
+# define BFI_FLINEAR2_66(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_65, v ds
+# define BFI_FLINEAR2_66_TICK(t)
+# define BFI_FLINEAR2_65(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_64, v ds
+# define BFI_FLINEAR2_65_TICK(t)
+
+# endif
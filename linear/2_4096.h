@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_2_4096_H
+# define BFI_LINEAR_2_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR2_4096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4095, v ds
+# define BFI_FLINEAR2_4096_TICK(t)
+# define BFI_FLINEAR2_4095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4094, v ds
+# define BFI_FLINEAR2_4095_TICK(t)
+# define BFI_FLINEAR2_4094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4093, v ds
+# define BFI_FLINEAR2_4094_TICK(t)
+# define BFI_FLINEAR2_4093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4092, v ds
+# define BFI_FLINEAR2_4093_TICK(t)
+# define BFI_FLINEAR2_4092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4091, v ds
+# define BFI_FLINEAR2_4092_TICK(t)
+# define BFI_FLINEAR2_4091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4090, v ds
+# define BFI_FLINEAR2_4091_TICK(t)
+# define BFI_FLINEAR2_4090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4089, v ds
+# define BFI_FLINEAR2_4090_TICK(t)
+# define BFI_FLINEAR2_4089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4088, v ds
+# define BFI_FLINEAR2_4089_TICK(t)
+# define BFI_FLINEAR2_4088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4087, v ds
+# define BFI_FLINEAR2_4088_TICK(t)
+# define BFI_FLINEAR2_4087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4086, v ds
+# define BFI_FLINEAR2_4087_TICK(t)
+# define BFI_FLINEAR2_4086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4085, v ds
+# define BFI_FLINEAR2_4086_TICK(t)
+# define BFI_FLINEAR2_4085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4084, v ds
+# define BFI_FLINEAR2_4085_TICK(t)
+# define BFI_FLINEAR2_4084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4083, v ds
+# define BFI_FLINEAR2_4084_TICK(t)
+# define BFI_FLINEAR2_4083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4082, v ds
+# define BFI_FLINEAR2_4083_TICK(t)
+# define BFI_FLINEAR2_4082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4081, v ds
+# define BFI_FLINEAR2_4082_TICK(t)
+# define BFI_FLINEAR2_4081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4080, v ds
+# define BFI_FLINEAR2_4081_TICK(t)
+# define BFI_FLINEAR2_4080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4079, v ds
+# define BFI_FLINEAR2_4080_TICK(t)
+# define BFI_FLINEAR2_4079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4078, v ds
+# define BFI_FLINEAR2_4079_TICK(t)
+# define BFI_FLINEAR2_4078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4077, v ds
+# define BFI_FLINEAR2_4078_TICK(t)
+# define BFI_FLINEAR2_4077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4076, v ds
+# define BFI_FLINEAR2_4077_TICK(t)
+# define BFI_FLINEAR2_4076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4075, v ds
+# define BFI_FLINEAR2_4076_TICK(t)
+# define BFI_FLINEAR2_4075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4074, v ds
+# define BFI_FLINEAR2_4075_TICK(t)
+# define BFI_FLINEAR2_4074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4073, v ds
+# define BFI_FLINEAR2_4074_TICK(t)
+# define BFI_FLINEAR2_4073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4072, v ds
+# define BFI_FLINEAR2_4073_TICK(t)
+# define BFI_FLINEAR2_4072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4071, v ds
+# define BFI_FLINEAR2_4072_TICK(t)
+# define BFI_FLINEAR2_4071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4070, v ds
+# define BFI_FLINEAR2_4071_TICK(t)
+# define BFI_FLINEAR2_4070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4069, v ds
+# define BFI_FLINEAR2_4070_TICK(t)
+# define BFI_FLINEAR2_4069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4068, v ds
+# define BFI_FLINEAR2_4069_TICK(t)
+# define BFI_FLINEAR2_4068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4067, v ds
+# define BFI_FLINEAR2_4068_TICK(t)
+# define BFI_FLINEAR2_4067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4066, v ds
+# define BFI_FLINEAR2_4067_TICK(t)
+# define BFI_FLINEAR2_4066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4065, v ds
+# define BFI_FLINEAR2_4066_TICK(t)
+# define BFI_FLINEAR2_4065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4064, v ds
+# define BFI_FLINEAR2_4065_TICK(t)
+# define BFI_FLINEAR2_4064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4063, v ds
+# define BFI_FLINEAR2_4064_TICK(t)
+# define BFI_FLINEAR2_4063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4062, v ds
+# define BFI_FLINEAR2_4063_TICK(t)
+# define BFI_FLINEAR2_4062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4061, v ds
+# define BFI_FLINEAR2_4062_TICK(t)
+# define BFI_FLINEAR2_4061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4060, v ds
+# define BFI_FLINEAR2_4061_TICK(t)
+# define BFI_FLINEAR2_4060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4059, v ds
+# define BFI_FLINEAR2_4060_TICK(t)
+# define BFI_FLINEAR2_4059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4058, v ds
+# define BFI_FLINEAR2_4059_TICK(t)
+# define BFI_FLINEAR2_4058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4057, v ds
+# define BFI_FLINEAR2_4058_TICK(t)
+# define BFI_FLINEAR2_4057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4056, v ds
+# define BFI_FLINEAR2_4057_TICK(t)
+# define BFI_FLINEAR2_4056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4055, v ds
+# define BFI_FLINEAR2_4056_TICK(t)
+# define BFI_FLINEAR2_4055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4054, v ds
+# define BFI_FLINEAR2_4055_TICK(t)
+# define BFI_FLINEAR2_4054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4053, v ds
+# define BFI_FLINEAR2_4054_TICK(t)
+# define BFI_FLINEAR2_4053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4052, v ds
+# define BFI_FLINEAR2_4053_TICK(t)
+# define BFI_FLINEAR2_4052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4051, v ds
+# define BFI_FLINEAR2_4052_TICK(t)
+# define BFI_FLINEAR2_4051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4050, v ds
+# define BFI_FLINEAR2_4051_TICK(t)
+# define BFI_FLINEAR2_4050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4049, v ds
+# define BFI_FLINEAR2_4050_TICK(t)
+# define BFI_FLINEAR2_4049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4048, v ds
+# define BFI_FLINEAR2_4049_TICK(t)
+# define BFI_FLINEAR2_4048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4047, v ds
+# define BFI_FLINEAR2_4048_TICK(t)
+# define BFI_FLINEAR2_4047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4046, v ds
+# define BFI_FLINEAR2_4047_TICK(t)
+# define BFI_FLINEAR2_4046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4045, v ds
+# define BFI_FLINEAR2_4046_TICK(t)
+# define BFI_FLINEAR2_4045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4044, v ds
+# define BFI_FLINEAR2_4045_TICK(t)
+# define BFI_FLINEAR2_4044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4043, v ds
+# define BFI_FLINEAR2_4044_TICK(t)
+# define BFI_FLINEAR2_4043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4042, v ds
+# define BFI_FLINEAR2_4043_TICK(t)
+# define BFI_FLINEAR2_4042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4041, v ds
+# define BFI_FLINEAR2_4042_TICK(t)
+# define BFI_FLINEAR2_4041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4040, v ds
+# define BFI_FLINEAR2_4041_TICK(t)
+# define BFI_FLINEAR2_4040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4039, v ds
+# define BFI_FLINEAR2_4040_TICK(t)
+# define BFI_FLINEAR2_4039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4038, v ds
+# define BFI_FLINEAR2_4039_TICK(t)
+# define BFI_FLINEAR2_4038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4037, v ds
+# define BFI_FLINEAR2_4038_TICK(t)
+# define BFI_FLINEAR2_4037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4036, v ds
+# define BFI_FLINEAR2_4037_TICK(t)
+# define BFI_FLINEAR2_4036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4035, v ds
+# define BFI_FLINEAR2_4036_TICK(t)
+# define BFI_FLINEAR2_4035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4034, v ds
+# define BFI_FLINEAR2_4035_TICK(t)
+# define BFI_FLINEAR2_4034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4033, v ds
+# define BFI_FLINEAR2_4034_TICK(t)
+# define BFI_FLINEAR2_4033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4032, v ds
+# define BFI_FLINEAR2_4033_TICK(t)
+# define BFI_FLINEAR2_4032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4031, v ds
+# define BFI_FLINEAR2_4032_TICK(t)
+# define BFI_FLINEAR2_4031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4030, v ds
+# define BFI_FLINEAR2_4031_TICK(t)
+# define BFI_FLINEAR2_4030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4029, v ds
+# define BFI_FLINEAR2_4030_TICK(t)
+# define BFI_FLINEAR2_4029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4028, v ds
+# define BFI_FLINEAR2_4029_TICK(t)
+# define BFI_FLINEAR2_4028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4027, v ds
+# define BFI_FLINEAR2_4028_TICK(t)
+# define BFI_FLINEAR2_4027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4026, v ds
+# define BFI_FLINEAR2_4027_TICK(t)
+# define BFI_FLINEAR2_4026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4025, v ds
+# define BFI_FLINEAR2_4026_TICK(t)
+# define BFI_FLINEAR2_4025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4024, v ds
+# define BFI_FLINEAR2_4025_TICK(t)
+# define BFI_FLINEAR2_4024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4023, v ds
+# define BFI_FLINEAR2_4024_TICK(t)
+# define BFI_FLINEAR2_4023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4022, v ds
+# define BFI_FLINEAR2_4023_TICK(t)
+# define BFI_FLINEAR2_4022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4021, v ds
+# define BFI_FLINEAR2_4022_TICK(t)
+# define BFI_FLINEAR2_4021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4020, v ds
+# define BFI_FLINEAR2_4021_TICK(t)
+# define BFI_FLINEAR2_4020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4019, v ds
+# define BFI_FLINEAR2_4020_TICK(t)
+# define BFI_FLINEAR2_4019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4018, v ds
+# define BFI_FLINEAR2_4019_TICK(t)
+# define BFI_FLINEAR2_4018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4017, v ds
+# define BFI_FLINEAR2_4018_TICK(t)
+# define BFI_FLINEAR2_4017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4016, v ds
+# define BFI_FLINEAR2_4017_TICK(t)
+# define BFI_FLINEAR2_4016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4015, v ds
+# define BFI_FLINEAR2_4016_TICK(t)
+# define BFI_FLINEAR2_4015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4014, v ds
+# define BFI_FLINEAR2_4015_TICK(t)
+# define BFI_FLINEAR2_4014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4013, v ds
+# define BFI_FLINEAR2_4014_TICK(t)
+# define BFI_FLINEAR2_4013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4012, v ds
+# define BFI_FLINEAR2_4013_TICK(t)
+# define BFI_FLINEAR2_4012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4011, v ds
+# define BFI_FLINEAR2_4012_TICK(t)
+# define BFI_FLINEAR2_4011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4010, v ds
+# define BFI_FLINEAR2_4011_TICK(t)
+# define BFI_FLINEAR2_4010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4009, v ds
+# define BFI_FLINEAR2_4010_TICK(t)
+# define BFI_FLINEAR2_4009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4008, v ds
+# define BFI_FLINEAR2_4009_TICK(t)
+# define BFI_FLINEAR2_4008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4007, v ds
+# define BFI_FLINEAR2_4008_TICK(t)
+# define BFI_FLINEAR2_4007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4006, v ds
+# define BFI_FLINEAR2_4007_TICK(t)
+# define BFI_FLINEAR2_4006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4005, v ds
+# define BFI_FLINEAR2_4006_TICK(t)
+# define BFI_FLINEAR2_4005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4004, v ds
+# define BFI_FLINEAR2_4005_TICK(t)
+# define BFI_FLINEAR2_4004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4003, v ds
+# define BFI_FLINEAR2_4004_TICK(t)
+# define BFI_FLINEAR2_4003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4002, v ds
+# define BFI_FLINEAR2_4003_TICK(t)
+# define BFI_FLINEAR2_4002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4001, v ds
+# define BFI_FLINEAR2_4002_TICK(t)
+# define BFI_FLINEAR2_4001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4000, v ds
+# define BFI_FLINEAR2_4001_TICK(t)
+# define BFI_FLINEAR2_4000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3999, v ds
+# define BFI_FLINEAR2_4000_TICK(t)
+# define BFI_FLINEAR2_3999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3998, v ds
+# define BFI_FLINEAR2_3999_TICK(t)
+# define BFI_FLINEAR2_3998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3997, v ds
+# define BFI_FLINEAR2_3998_TICK(t)
+# define BFI_FLINEAR2_3997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3996, v ds
+# define BFI_FLINEAR2_3997_TICK(t)
+# define BFI_FLINEAR2_3996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3995, v ds
+# define BFI_FLINEAR2_3996_TICK(t)
+# define BFI_FLINEAR2_3995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3994, v ds
+# define BFI_FLINEAR2_3995_TICK(t)
+# define BFI_FLINEAR2_3994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3993, v ds
+# define BFI_FLINEAR2_3994_TICK(t)
+# define BFI_FLINEAR2_3993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3992, v ds
+# define BFI_FLINEAR2_3993_TICK(t)
+# define BFI_FLINEAR2_3992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3991, v ds
+# define BFI_FLINEAR2_3992_TICK(t)
+# define BFI_FLINEAR2_3991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3990, v ds
+# define BFI_FLINEAR2_3991_TICK(t)
+# define BFI_FLINEAR2_3990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3989, v ds
+# define BFI_FLINEAR2_3990_TICK(t)
+# define BFI_FLINEAR2_3989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3988, v ds
+# define BFI_FLINEAR2_3989_TICK(t)
+# define BFI_FLINEAR2_3988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3987, v ds
+# define BFI_FLINEAR2_3988_TICK(t)
+# define BFI_FLINEAR2_3987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3986, v ds
+# define BFI_FLINEAR2_3987_TICK(t)
+# define BFI_FLINEAR2_3986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3985, v ds
+# define BFI_FLINEAR2_3986_TICK(t)
+# define BFI_FLINEAR2_3985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3984, v ds
+# define BFI_FLINEAR2_3985_TICK(t)
+# define BFI_FLINEAR2_3984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3983, v ds
+# define BFI_FLINEAR2_3984_TICK(t)
+# define BFI_FLINEAR2_3983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3982, v ds
+# define BFI_FLINEAR2_3983_TICK(t)
+# define BFI_FLINEAR2_3982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3981, v ds
+# define BFI_FLINEAR2_3982_TICK(t)
+# define BFI_FLINEAR2_3981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3980, v ds
+# define BFI_FLINEAR2_3981_TICK(t)
+# define BFI_FLINEAR2_3980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3979, v ds
+# define BFI_FLINEAR2_3980_TICK(t)
+# define BFI_FLINEAR2_3979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3978, v ds
+# define BFI_FLINEAR2_3979_TICK(t)
+# define BFI_FLINEAR2_3978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3977, v ds
+# define BFI_FLINEAR2_3978_TICK(t)
+# define BFI_FLINEAR2_3977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3976, v ds
+# define BFI_FLINEAR2_3977_TICK(t)
+# define BFI_FLINEAR2_3976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3975, v ds
+# define BFI_FLINEAR2_3976_TICK(t)
+# define BFI_FLINEAR2_3975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3974, v ds
+# define BFI_FLINEAR2_3975_TICK(t)
+# define BFI_FLINEAR2_3974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3973, v ds
+# define BFI_FLINEAR2_3974_TICK(t)
+# define BFI_FLINEAR2_3973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3972, v ds
+# define BFI_FLINEAR2_3973_TICK(t)
+# define BFI_FLINEAR2_3972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3971, v ds
+# define BFI_FLINEAR2_3972_TICK(t)
+# define BFI_FLINEAR2_3971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3970, v ds
+# define BFI_FLINEAR2_3971_TICK(t)
+# define BFI_FLINEAR2_3970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3969, v ds
+# define BFI_FLINEAR2_3970_TICK(t)
+# define BFI_FLINEAR2_3969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3968, v ds
+# define BFI_FLINEAR2_3969_TICK(t)
+# define BFI_FLINEAR2_3968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3967, v ds
+# define BFI_FLINEAR2_3968_TICK(t)
+# define BFI_FLINEAR2_3967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3966, v ds
+# define BFI_FLINEAR2_3967_TICK(t)
+# define BFI_FLINEAR2_3966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3965, v ds
+# define BFI_FLINEAR2_3966_TICK(t)
+# define BFI_FLINEAR2_3965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3964, v ds
+# define BFI_FLINEAR2_3965_TICK(t)
+# define BFI_FLINEAR2_3964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3963, v ds
+# define BFI_FLINEAR2_3964_TICK(t)
+# define BFI_FLINEAR2_3963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3962, v ds
+# define BFI_FLINEAR2_3963_TICK(t)
+# define BFI_FLINEAR2_3962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3961, v ds
+# define BFI_FLINEAR2_3962_TICK(t)
+# define BFI_FLINEAR2_3961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3960, v ds
+# define BFI_FLINEAR2_3961_TICK(t)
+# define BFI_FLINEAR2_3960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3959, v ds
+# define BFI_FLINEAR2_3960_TICK(t)
+# define BFI_FLINEAR2_3959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3958, v ds
+# define BFI_FLINEAR2_3959_TICK(t)
+# define BFI_FLINEAR2_3958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3957, v ds
+# define BFI_FLINEAR2_3958_TICK(t)
+# define BFI_FLINEAR2_3957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3956, v ds
+# define BFI_FLINEAR2_3957_TICK(t)
+# define BFI_FLINEAR2_3956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3955, v ds
+# define BFI_FLINEAR2_3956_TICK(t)
+# define BFI_FLINEAR2_3955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3954, v ds
+# define BFI_FLINEAR2_3955_TICK(t)
+# define BFI_FLINEAR2_3954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3953, v ds
+# define BFI_FLINEAR2_3954_TICK(t)
+# define BFI_FLINEAR2_3953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3952, v ds
+# define BFI_FLINEAR2_3953_TICK(t)
+# define BFI_FLINEAR2_3952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3951, v ds
+# define BFI_FLINEAR2_3952_TICK(t)
+# define BFI_FLINEAR2_3951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3950, v ds
+# define BFI_FLINEAR2_3951_TICK(t)
+# define BFI_FLINEAR2_3950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3949, v ds
+# define BFI_FLINEAR2_3950_TICK(t)
+# define BFI_FLINEAR2_3949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3948, v ds
+# define BFI_FLINEAR2_3949_TICK(t)
+# define BFI_FLINEAR2_3948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3947, v ds
+# define BFI_FLINEAR2_3948_TICK(t)
+# define BFI_FLINEAR2_3947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3946, v ds
+# define BFI_FLINEAR2_3947_TICK(t)
+# define BFI_FLINEAR2_3946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3945, v ds
+# define BFI_FLINEAR2_3946_TICK(t)
+# define BFI_FLINEAR2_3945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3944, v ds
+# define BFI_FLINEAR2_3945_TICK(t)
+# define BFI_FLINEAR2_3944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3943, v ds
+# define BFI_FLINEAR2_3944_TICK(t)
+# define BFI_FLINEAR2_3943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3942, v ds
+# define BFI_FLINEAR2_3943_TICK(t)
+# define BFI_FLINEAR2_3942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3941, v ds
+# define BFI_FLINEAR2_3942_TICK(t)
+# define BFI_FLINEAR2_3941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3940, v ds
+# define BFI_FLINEAR2_3941_TICK(t)
+# define BFI_FLINEAR2_3940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3939, v ds
+# define BFI_FLINEAR2_3940_TICK(t)
+# define BFI_FLINEAR2_3939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3938, v ds
+# define BFI_FLINEAR2_3939_TICK(t)
+# define BFI_FLINEAR2_3938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3937, v ds
+# define BFI_FLINEAR2_3938_TICK(t)
+# define BFI_FLINEAR2_3937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3936, v ds
+# define BFI_FLINEAR2_3937_TICK(t)
+# define BFI_FLINEAR2_3936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3935, v ds
+# define BFI_FLINEAR2_3936_TICK(t)
+# define BFI_FLINEAR2_3935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3934, v ds
+# define BFI_FLINEAR2_3935_TICK(t)
+# define BFI_FLINEAR2_3934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3933, v ds
+# define BFI_FLINEAR2_3934_TICK(t)
+# define BFI_FLINEAR2_3933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3932, v ds
+# define BFI_FLINEAR2_3933_TICK(t)
+# define BFI_FLINEAR2_3932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3931, v ds
+# define BFI_FLINEAR2_3932_TICK(t)
+# define BFI_FLINEAR2_3931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3930, v ds
+# define BFI_FLINEAR2_3931_TICK(t)
+# define BFI_FLINEAR2_3930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3929, v ds
+# define BFI_FLINEAR2_3930_TICK(t)
+# define BFI_FLINEAR2_3929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3928, v ds
+# define BFI_FLINEAR2_3929_TICK(t)
+# define BFI_FLINEAR2_3928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3927, v ds
+# define BFI_FLINEAR2_3928_TICK(t)
+# define BFI_FLINEAR2_3927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3926, v ds
+# define BFI_FLINEAR2_3927_TICK(t)
+# define BFI_FLINEAR2_3926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3925, v ds
+# define BFI_FLINEAR2_3926_TICK(t)
+# define BFI_FLINEAR2_3925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3924, v ds
+# define BFI_FLINEAR2_3925_TICK(t)
+# define BFI_FLINEAR2_3924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3923, v ds
+# define BFI_FLINEAR2_3924_TICK(t)
+# define BFI_FLINEAR2_3923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3922, v ds
+# define BFI_FLINEAR2_3923_TICK(t)
+# define BFI_FLINEAR2_3922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3921, v ds
+# define BFI_FLINEAR2_3922_TICK(t)
+# define BFI_FLINEAR2_3921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3920, v ds
+# define BFI_FLINEAR2_3921_TICK(t)
+# define BFI_FLINEAR2_3920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3919, v ds
+# define BFI_FLINEAR2_3920_TICK(t)
+# define BFI_FLINEAR2_3919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3918, v ds
+# define BFI_FLINEAR2_3919_TICK(t)
+# define BFI_FLINEAR2_3918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3917, v ds
+# define BFI_FLINEAR2_3918_TICK(t)
+# define BFI_FLINEAR2_3917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3916, v ds
+# define BFI_FLINEAR2_3917_TICK(t)
+# define BFI_FLINEAR2_3916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3915, v ds
+# define BFI_FLINEAR2_3916_TICK(t)
+# define BFI_FLINEAR2_3915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3914, v ds
+# define BFI_FLINEAR2_3915_TICK(t)
+# define BFI_FLINEAR2_3914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3913, v ds
+# define BFI_FLINEAR2_3914_TICK(t)
+# define BFI_FLINEAR2_3913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3912, v ds
+# define BFI_FLINEAR2_3913_TICK(t)
+# define BFI_FLINEAR2_3912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3911, v ds
+# define BFI_FLINEAR2_3912_TICK(t)
+# define BFI_FLINEAR2_3911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3910, v ds
+# define BFI_FLINEAR2_3911_TICK(t)
+# define BFI_FLINEAR2_3910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3909, v ds
+# define BFI_FLINEAR2_3910_TICK(t)
+# define BFI_FLINEAR2_3909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3908, v ds
+# define BFI_FLINEAR2_3909_TICK(t)
+# define BFI_FLINEAR2_3908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3907, v ds
+# define BFI_FLINEAR2_3908_TICK(t)
+# define BFI_FLINEAR2_3907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3906, v ds
+# define BFI_FLINEAR2_3907_TICK(t)
+# define BFI_FLINEAR2_3906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3905, v ds
+# define BFI_FLINEAR2_3906_TICK(t)
+# define BFI_FLINEAR2_3905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3904, v ds
+# define BFI_FLINEAR2_3905_TICK(t)
+# define BFI_FLINEAR2_3904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3903, v ds
+# define BFI_FLINEAR2_3904_TICK(t)
+# define BFI_FLINEAR2_3903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3902, v ds
+# define BFI_FLINEAR2_3903_TICK(t)
+# define BFI_FLINEAR2_3902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3901, v ds
+# define BFI_FLINEAR2_3902_TICK(t)
+# define BFI_FLINEAR2_3901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3900, v ds
+# define BFI_FLINEAR2_3901_TICK(t)
+# define BFI_FLINEAR2_3900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3899, v ds
+# define BFI_FLINEAR2_3900_TICK(t)
+# define BFI_FLINEAR2_3899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3898, v ds
+# define BFI_FLINEAR2_3899_TICK(t)
+# define BFI_FLINEAR2_3898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3897, v ds
+# define BFI_FLINEAR2_3898_TICK(t)
+# define BFI_FLINEAR2_3897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3896, v ds
+# define BFI_FLINEAR2_3897_TICK(t)
+# define BFI_FLINEAR2_3896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3895, v ds
+# define BFI_FLINEAR2_3896_TICK(t)
+# define BFI_FLINEAR2_3895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3894, v ds
+# define BFI_FLINEAR2_3895_TICK(t)
+# define BFI_FLINEAR2_3894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3893, v ds
+# define BFI_FLINEAR2_3894_TICK(t)
+# define BFI_FLINEAR2_3893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3892, v ds
+# define BFI_FLINEAR2_3893_TICK(t)
+# define BFI_FLINEAR2_3892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3891, v ds
+# define BFI_FLINEAR2_3892_TICK(t)
+# define BFI_FLINEAR2_3891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3890, v ds
+# define BFI_FLINEAR2_3891_TICK(t)
+# define BFI_FLINEAR2_3890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3889, v ds
+# define BFI_FLINEAR2_3890_TICK(t)
+# define BFI_FLINEAR2_3889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3888, v ds
+# define BFI_FLINEAR2_3889_TICK(t)
+# define BFI_FLINEAR2_3888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3887, v ds
+# define BFI_FLINEAR2_3888_TICK(t)
+# define BFI_FLINEAR2_3887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3886, v ds
+# define BFI_FLINEAR2_3887_TICK(t)
+# define BFI_FLINEAR2_3886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3885, v ds
+# define BFI_FLINEAR2_3886_TICK(t)
+# define BFI_FLINEAR2_3885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3884, v ds
+# define BFI_FLINEAR2_3885_TICK(t)
+# define BFI_FLINEAR2_3884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3883, v ds
+# define BFI_FLINEAR2_3884_TICK(t)
+# define BFI_FLINEAR2_3883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3882, v ds
+# define BFI_FLINEAR2_3883_TICK(t)
+# define BFI_FLINEAR2_3882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3881, v ds
+# define BFI_FLINEAR2_3882_TICK(t)
+# define BFI_FLINEAR2_3881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3880, v ds
+# define BFI_FLINEAR2_3881_TICK(t)
+# define BFI_FLINEAR2_3880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3879, v ds
+# define BFI_FLINEAR2_3880_TICK(t)
+# define BFI_FLINEAR2_3879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3878, v ds
+# define BFI_FLINEAR2_3879_TICK(t)
+# define BFI_FLINEAR2_3878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3877, v ds
+# define BFI_FLINEAR2_3878_TICK(t)
+# define BFI_FLINEAR2_3877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3876, v ds
+# define BFI_FLINEAR2_3877_TICK(t)
+# define BFI_FLINEAR2_3876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3875, v ds
+# define BFI_FLINEAR2_3876_TICK(t)
+# define BFI_FLINEAR2_3875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3874, v ds
+# define BFI_FLINEAR2_3875_TICK(t)
+# define BFI_FLINEAR2_3874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3873, v ds
+# define BFI_FLINEAR2_3874_TICK(t)
+# define BFI_FLINEAR2_3873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3872, v ds
+# define BFI_FLINEAR2_3873_TICK(t)
+# define BFI_FLINEAR2_3872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3871, v ds
+# define BFI_FLINEAR2_3872_TICK(t)
+# define BFI_FLINEAR2_3871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3870, v ds
+# define BFI_FLINEAR2_3871_TICK(t)
+# define BFI_FLINEAR2_3870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3869, v ds
+# define BFI_FLINEAR2_3870_TICK(t)
+# define BFI_FLINEAR2_3869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3868, v ds
+# define BFI_FLINEAR2_3869_TICK(t)
+# define BFI_FLINEAR2_3868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3867, v ds
+# define BFI_FLINEAR2_3868_TICK(t)
+# define BFI_FLINEAR2_3867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3866, v ds
+# define BFI_FLINEAR2_3867_TICK(t)
+# define BFI_FLINEAR2_3866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3865, v ds
+# define BFI_FLINEAR2_3866_TICK(t)
+# define BFI_FLINEAR2_3865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3864, v ds
+# define BFI_FLINEAR2_3865_TICK(t)
+# define BFI_FLINEAR2_3864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3863, v ds
+# define BFI_FLINEAR2_3864_TICK(t)
+# define BFI_FLINEAR2_3863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3862, v ds
+# define BFI_FLINEAR2_3863_TICK(t)
+# define BFI_FLINEAR2_3862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3861, v ds
+# define BFI_FLINEAR2_3862_TICK(t)
+# define BFI_FLINEAR2_3861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3860, v ds
+# define BFI_FLINEAR2_3861_TICK(t)
+# define BFI_FLINEAR2_3860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3859, v ds
+# define BFI_FLINEAR2_3860_TICK(t)
+# define BFI_FLINEAR2_3859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3858, v ds
+# define BFI_FLINEAR2_3859_TICK(t)
+# define BFI_FLINEAR2_3858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3857, v ds
+# define BFI_FLINEAR2_3858_TICK(t)
+# define BFI_FLINEAR2_3857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3856, v ds
+# define BFI_FLINEAR2_3857_TICK(t)
+# define BFI_FLINEAR2_3856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3855, v ds
+# define BFI_FLINEAR2_3856_TICK(t)
+# define BFI_FLINEAR2_3855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3854, v ds
+# define BFI_FLINEAR2_3855_TICK(t)
+# define BFI_FLINEAR2_3854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3853, v ds
+# define BFI_FLINEAR2_3854_TICK(t)
+# define BFI_FLINEAR2_3853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3852, v ds
+# define BFI_FLINEAR2_3853_TICK(t)
+# define BFI_FLINEAR2_3852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3851, v ds
+# define BFI_FLINEAR2_3852_TICK(t)
+# define BFI_FLINEAR2_3851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3850, v ds
+# define BFI_FLINEAR2_3851_TICK(t)
+# define BFI_FLINEAR2_3850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3849, v ds
+# define BFI_FLINEAR2_3850_TICK(t)
+# define BFI_FLINEAR2_3849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3848, v ds
+# define BFI_FLINEAR2_3849_TICK(t)
+# define BFI_FLINEAR2_3848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3847, v ds
+# define BFI_FLINEAR2_3848_TICK(t)
+# define BFI_FLINEAR2_3847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3846, v ds
+# define BFI_FLINEAR2_3847_TICK(t)
+# define BFI_FLINEAR2_3846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3845, v ds
+# define BFI_FLINEAR2_3846_TICK(t)
+# define BFI_FLINEAR2_3845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3844, v ds
+# define BFI_FLINEAR2_3845_TICK(t)
+# define BFI_FLINEAR2_3844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3843, v ds
+# define BFI_FLINEAR2_3844_TICK(t)
+# define BFI_FLINEAR2_3843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3842, v ds
+# define BFI_FLINEAR2_3843_TICK(t)
+# define BFI_FLINEAR2_3842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3841, v ds
+# define BFI_FLINEAR2_3842_TICK(t)
+# define BFI_FLINEAR2_3841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3840, v ds
+# define BFI_FLINEAR2_3841_TICK(t)
+# define BFI_FLINEAR2_3840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3839, v ds
+# define BFI_FLINEAR2_3840_TICK(t)
+# define BFI_FLINEAR2_3839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3838, v ds
+# define BFI_FLINEAR2_3839_TICK(t)
+# define BFI_FLINEAR2_3838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3837, v ds
+# define BFI_FLINEAR2_3838_TICK(t)
+# define BFI_FLINEAR2_3837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3836, v ds
+# define BFI_FLINEAR2_3837_TICK(t)
+# define BFI_FLINEAR2_3836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3835, v ds
+# define BFI_FLINEAR2_3836_TICK(t)
+# define BFI_FLINEAR2_3835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3834, v ds
+# define BFI_FLINEAR2_3835_TICK(t)
+# define BFI_FLINEAR2_3834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3833, v ds
+# define BFI_FLINEAR2_3834_TICK(t)
+# define BFI_FLINEAR2_3833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3832, v ds
+# define BFI_FLINEAR2_3833_TICK(t)
+# define BFI_FLINEAR2_3832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3831, v ds
+# define BFI_FLINEAR2_3832_TICK(t)
+# define BFI_FLINEAR2_3831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3830, v ds
+# define BFI_FLINEAR2_3831_TICK(t)
+# define BFI_FLINEAR2_3830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3829, v ds
+# define BFI_FLINEAR2_3830_TICK(t)
+# define BFI_FLINEAR2_3829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3828, v ds
+# define BFI_FLINEAR2_3829_TICK(t)
+# define BFI_FLINEAR2_3828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3827, v ds
+# define BFI_FLINEAR2_3828_TICK(t)
+# define BFI_FLINEAR2_3827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3826, v ds
+# define BFI_FLINEAR2_3827_TICK(t)
+# define BFI_FLINEAR2_3826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3825, v ds
+# define BFI_FLINEAR2_3826_TICK(t)
+# define BFI_FLINEAR2_3825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3824, v ds
+# define BFI_FLINEAR2_3825_TICK(t)
+# define BFI_FLINEAR2_3824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3823, v ds
+# define BFI_FLINEAR2_3824_TICK(t)
+# define BFI_FLINEAR2_3823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3822, v ds
+# define BFI_FLINEAR2_3823_TICK(t)
+# define BFI_FLINEAR2_3822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3821, v ds
+# define BFI_FLINEAR2_3822_TICK(t)
+# define BFI_FLINEAR2_3821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3820, v ds
+# define BFI_FLINEAR2_3821_TICK(t)
+# define BFI_FLINEAR2_3820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3819, v ds
+# define BFI_FLINEAR2_3820_TICK(t)
+# define BFI_FLINEAR2_3819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3818, v ds
+# define BFI_FLINEAR2_3819_TICK(t)
+# define BFI_FLINEAR2_3818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3817, v ds
+# define BFI_FLINEAR2_3818_TICK(t)
+# define BFI_FLINEAR2_3817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3816, v ds
+# define BFI_FLINEAR2_3817_TICK(t)
+# define BFI_FLINEAR2_3816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3815, v ds
+# define BFI_FLINEAR2_3816_TICK(t)
+# define BFI_FLINEAR2_3815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3814, v ds
+# define BFI_FLINEAR2_3815_TICK(t)
+# define BFI_FLINEAR2_3814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3813, v ds
+# define BFI_FLINEAR2_3814_TICK(t)
+# define BFI_FLINEAR2_3813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3812, v ds
+# define BFI_FLINEAR2_3813_TICK(t)
+# define BFI_FLINEAR2_3812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3811, v ds
+# define BFI_FLINEAR2_3812_TICK(t)
+# define BFI_FLINEAR2_3811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3810, v ds
+# define BFI_FLINEAR2_3811_TICK(t)
+# define BFI_FLINEAR2_3810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3809, v ds
+# define BFI_FLINEAR2_3810_TICK(t)
+# define BFI_FLINEAR2_3809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3808, v ds
+# define BFI_FLINEAR2_3809_TICK(t)
+# define BFI_FLINEAR2_3808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3807, v ds
+# define BFI_FLINEAR2_3808_TICK(t)
+# define BFI_FLINEAR2_3807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3806, v ds
+# define BFI_FLINEAR2_3807_TICK(t)
+# define BFI_FLINEAR2_3806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3805, v ds
+# define BFI_FLINEAR2_3806_TICK(t)
+# define BFI_FLINEAR2_3805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3804, v ds
+# define BFI_FLINEAR2_3805_TICK(t)
+# define BFI_FLINEAR2_3804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3803, v ds
+# define BFI_FLINEAR2_3804_TICK(t)
+# define BFI_FLINEAR2_3803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3802, v ds
+# define BFI_FLINEAR2_3803_TICK(t)
+# define BFI_FLINEAR2_3802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3801, v ds
+# define BFI_FLINEAR2_3802_TICK(t)
+# define BFI_FLINEAR2_3801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3800, v ds
+# define BFI_FLINEAR2_3801_TICK(t)
+# define BFI_FLINEAR2_3800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3799, v ds
+# define BFI_FLINEAR2_3800_TICK(t)
+# define BFI_FLINEAR2_3799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3798, v ds
+# define BFI_FLINEAR2_3799_TICK(t)
+# define BFI_FLINEAR2_3798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3797, v ds
+# define BFI_FLINEAR2_3798_TICK(t)
+# define BFI_FLINEAR2_3797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3796, v ds
+# define BFI_FLINEAR2_3797_TICK(t)
+# define BFI_FLINEAR2_3796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3795, v ds
+# define BFI_FLINEAR2_3796_TICK(t)
+# define BFI_FLINEAR2_3795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3794, v ds
+# define BFI_FLINEAR2_3795_TICK(t)
+# define BFI_FLINEAR2_3794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3793, v ds
+# define BFI_FLINEAR2_3794_TICK(t)
+# define BFI_FLINEAR2_3793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3792, v ds
+# define BFI_FLINEAR2_3793_TICK(t)
+# define BFI_FLINEAR2_3792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3791, v ds
+# define BFI_FLINEAR2_3792_TICK(t)
+# define BFI_FLINEAR2_3791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3790, v ds
+# define BFI_FLINEAR2_3791_TICK(t)
+# define BFI_FLINEAR2_3790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3789, v ds
+# define BFI_FLINEAR2_3790_TICK(t)
+# define BFI_FLINEAR2_3789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3788, v ds
+# define BFI_FLINEAR2_3789_TICK(t)
+# define BFI_FLINEAR2_3788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3787, v ds
+# define BFI_FLINEAR2_3788_TICK(t)
+# define BFI_FLINEAR2_3787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3786, v ds
+# define BFI_FLINEAR2_3787_TICK(t)
+# define BFI_FLINEAR2_3786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3785, v ds
+# define BFI_FLINEAR2_3786_TICK(t)
+# define BFI_FLINEAR2_3785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3784, v ds
+# define BFI_FLINEAR2_3785_TICK(t)
+# define BFI_FLINEAR2_3784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3783, v ds
+# define BFI_FLINEAR2_3784_TICK(t)
+# define BFI_FLINEAR2_3783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3782, v ds
+# define BFI_FLINEAR2_3783_TICK(t)
+# define BFI_FLINEAR2_3782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3781, v ds
+# define BFI_FLINEAR2_3782_TICK(t)
+# define BFI_FLINEAR2_3781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3780, v ds
+# define BFI_FLINEAR2_3781_TICK(t)
+# define BFI_FLINEAR2_3780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3779, v ds
+# define BFI_FLINEAR2_3780_TICK(t)
+# define BFI_FLINEAR2_3779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3778, v ds
+# define BFI_FLINEAR2_3779_TICK(t)
+# define BFI_FLINEAR2_3778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3777, v ds
+# define BFI_FLINEAR2_3778_TICK(t)
+# define BFI_FLINEAR2_3777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3776, v ds
+# define BFI_FLINEAR2_3777_TICK(t)
+# define BFI_FLINEAR2_3776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3775, v ds
+# define BFI_FLINEAR2_3776_TICK(t)
+# define BFI_FLINEAR2_3775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3774, v ds
+# define BFI_FLINEAR2_3775_TICK(t)
+# define BFI_FLINEAR2_3774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3773, v ds
+# define BFI_FLINEAR2_3774_TICK(t)
+# define BFI_FLINEAR2_3773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3772, v ds
+# define BFI_FLINEAR2_3773_TICK(t)
+# define BFI_FLINEAR2_3772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3771, v ds
+# define BFI_FLINEAR2_3772_TICK(t)
+# define BFI_FLINEAR2_3771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3770, v ds
+# define BFI_FLINEAR2_3771_TICK(t)
+# define BFI_FLINEAR2_3770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3769, v ds
+# define BFI_FLINEAR2_3770_TICK(t)
+# define BFI_FLINEAR2_3769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3768, v ds
+# define BFI_FLINEAR2_3769_TICK(t)
+# define BFI_FLINEAR2_3768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3767, v ds
+# define BFI_FLINEAR2_3768_TICK(t)
+# define BFI_FLINEAR2_3767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3766, v ds
+# define BFI_FLINEAR2_3767_TICK(t)
+# define BFI_FLINEAR2_3766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3765, v ds
+# define BFI_FLINEAR2_3766_TICK(t)
+# define BFI_FLINEAR2_3765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3764, v ds
+# define BFI_FLINEAR2_3765_TICK(t)
+# define BFI_FLINEAR2_3764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3763, v ds
+# define BFI_FLINEAR2_3764_TICK(t)
+# define BFI_FLINEAR2_3763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3762, v ds
+# define BFI_FLINEAR2_3763_TICK(t)
+# define BFI_FLINEAR2_3762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3761, v ds
+# define BFI_FLINEAR2_3762_TICK(t)
+# define BFI_FLINEAR2_3761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3760, v ds
+# define BFI_FLINEAR2_3761_TICK(t)
+# define BFI_FLINEAR2_3760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3759, v ds
+# define BFI_FLINEAR2_3760_TICK(t)
+# define BFI_FLINEAR2_3759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3758, v ds
+# define BFI_FLINEAR2_3759_TICK(t)
+# define BFI_FLINEAR2_3758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3757, v ds
+# define BFI_FLINEAR2_3758_TICK(t)
+# define BFI_FLINEAR2_3757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3756, v ds
+# define BFI_FLINEAR2_3757_TICK(t)
+# define BFI_FLINEAR2_3756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3755, v ds
+# define BFI_FLINEAR2_3756_TICK(t)
+# define BFI_FLINEAR2_3755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3754, v ds
+# define BFI_FLINEAR2_3755_TICK(t)
+# define BFI_FLINEAR2_3754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3753, v ds
+# define BFI_FLINEAR2_3754_TICK(t)
+# define BFI_FLINEAR2_3753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3752, v ds
+# define BFI_FLINEAR2_3753_TICK(t)
+# define BFI_FLINEAR2_3752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3751, v ds
+# define BFI_FLINEAR2_3752_TICK(t)
+# define BFI_FLINEAR2_3751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3750, v ds
+# define BFI_FLINEAR2_3751_TICK(t)
+# define BFI_FLINEAR2_3750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3749, v ds
+# define BFI_FLINEAR2_3750_TICK(t)
+# define BFI_FLINEAR2_3749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3748, v ds
+# define BFI_FLINEAR2_3749_TICK(t)
+# define BFI_FLINEAR2_3748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3747, v ds
+# define BFI_FLINEAR2_3748_TICK(t)
+# define BFI_FLINEAR2_3747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3746, v ds
+# define BFI_FLINEAR2_3747_TICK(t)
+# define BFI_FLINEAR2_3746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3745, v ds
+# define BFI_FLINEAR2_3746_TICK(t)
+# define BFI_FLINEAR2_3745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3744, v ds
+# define BFI_FLINEAR2_3745_TICK(t)
+# define BFI_FLINEAR2_3744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3743, v ds
+# define BFI_FLINEAR2_3744_TICK(t)
+# define BFI_FLINEAR2_3743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3742, v ds
+# define BFI_FLINEAR2_3743_TICK(t)
+# define BFI_FLINEAR2_3742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3741, v ds
+# define BFI_FLINEAR2_3742_TICK(t)
+# define BFI_FLINEAR2_3741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3740, v ds
+# define BFI_FLINEAR2_3741_TICK(t)
+# define BFI_FLINEAR2_3740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3739, v ds
+# define BFI_FLINEAR2_3740_TICK(t)
+# define BFI_FLINEAR2_3739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3738, v ds
+# define BFI_FLINEAR2_3739_TICK(t)
+# define BFI_FLINEAR2_3738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3737, v ds
+# define BFI_FLINEAR2_3738_TICK(t)
+# define BFI_FLINEAR2_3737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3736, v ds
+# define BFI_FLINEAR2_3737_TICK(t)
+# define BFI_FLINEAR2_3736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3735, v ds
+# define BFI_FLINEAR2_3736_TICK(t)
+# define BFI_FLINEAR2_3735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3734, v ds
+# define BFI_FLINEAR2_3735_TICK(t)
+# define BFI_FLINEAR2_3734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3733, v ds
+# define BFI_FLINEAR2_3734_TICK(t)
+# define BFI_FLINEAR2_3733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3732, v ds
+# define BFI_FLINEAR2_3733_TICK(t)
+# define BFI_FLINEAR2_3732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3731, v ds
+# define BFI_FLINEAR2_3732_TICK(t)
+# define BFI_FLINEAR2_3731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3730, v ds
+# define BFI_FLINEAR2_3731_TICK(t)
+# define BFI_FLINEAR2_3730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3729, v ds
+# define BFI_FLINEAR2_3730_TICK(t)
+# define BFI_FLINEAR2_3729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3728, v ds
+# define BFI_FLINEAR2_3729_TICK(t)
+# define BFI_FLINEAR2_3728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3727, v ds
+# define BFI_FLINEAR2_3728_TICK(t)
+# define BFI_FLINEAR2_3727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3726, v ds
+# define BFI_FLINEAR2_3727_TICK(t)
+# define BFI_FLINEAR2_3726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3725, v ds
+# define BFI_FLINEAR2_3726_TICK(t)
+# define BFI_FLINEAR2_3725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3724, v ds
+# define BFI_FLINEAR2_3725_TICK(t)
+# define BFI_FLINEAR2_3724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3723, v ds
+# define BFI_FLINEAR2_3724_TICK(t)
+# define BFI_FLINEAR2_3723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3722, v ds
+# define BFI_FLINEAR2_3723_TICK(t)
+# define BFI_FLINEAR2_3722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3721, v ds
+# define BFI_FLINEAR2_3722_TICK(t)
+# define BFI_FLINEAR2_3721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3720, v ds
+# define BFI_FLINEAR2_3721_TICK(t)
+# define BFI_FLINEAR2_3720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3719, v ds
+# define BFI_FLINEAR2_3720_TICK(t)
+# define BFI_FLINEAR2_3719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3718, v ds
+# define BFI_FLINEAR2_3719_TICK(t)
+# define BFI_FLINEAR2_3718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3717, v ds
+# define BFI_FLINEAR2_3718_TICK(t)
+# define BFI_FLINEAR2_3717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3716, v ds
+# define BFI_FLINEAR2_3717_TICK(t)
+# define BFI_FLINEAR2_3716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3715, v ds
+# define BFI_FLINEAR2_3716_TICK(t)
+# define BFI_FLINEAR2_3715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3714, v ds
+# define BFI_FLINEAR2_3715_TICK(t)
+# define BFI_FLINEAR2_3714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3713, v ds
+# define BFI_FLINEAR2_3714_TICK(t)
+# define BFI_FLINEAR2_3713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3712, v ds
+# define BFI_FLINEAR2_3713_TICK(t)
+# define BFI_FLINEAR2_3712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3711, v ds
+# define BFI_FLINEAR2_3712_TICK(t)
+# define BFI_FLINEAR2_3711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3710, v ds
+# define BFI_FLINEAR2_3711_TICK(t)
+# define BFI_FLINEAR2_3710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3709, v ds
+# define BFI_FLINEAR2_3710_TICK(t)
+# define BFI_FLINEAR2_3709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3708, v ds
+# define BFI_FLINEAR2_3709_TICK(t)
+# define BFI_FLINEAR2_3708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3707, v ds
+# define BFI_FLINEAR2_3708_TICK(t)
+# define BFI_FLINEAR2_3707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3706, v ds
+# define BFI_FLINEAR2_3707_TICK(t)
+# define BFI_FLINEAR2_3706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3705, v ds
+# define BFI_FLINEAR2_3706_TICK(t)
+# define BFI_FLINEAR2_3705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3704, v ds
+# define BFI_FLINEAR2_3705_TICK(t)
+# define BFI_FLINEAR2_3704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3703, v ds
+# define BFI_FLINEAR2_3704_TICK(t)
+# define BFI_FLINEAR2_3703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3702, v ds
+# define BFI_FLINEAR2_3703_TICK(t)
+# define BFI_FLINEAR2_3702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3701, v ds
+# define BFI_FLINEAR2_3702_TICK(t)
+# define BFI_FLINEAR2_3701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3700, v ds
+# define BFI_FLINEAR2_3701_TICK(t)
+# define BFI_FLINEAR2_3700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3699, v ds
+# define BFI_FLINEAR2_3700_TICK(t)
+# define BFI_FLINEAR2_3699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3698, v ds
+# define BFI_FLINEAR2_3699_TICK(t)
+# define BFI_FLINEAR2_3698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3697, v ds
+# define BFI_FLINEAR2_3698_TICK(t)
+# define BFI_FLINEAR2_3697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3696, v ds
+# define BFI_FLINEAR2_3697_TICK(t)
+# define BFI_FLINEAR2_3696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3695, v ds
+# define BFI_FLINEAR2_3696_TICK(t)
+# define BFI_FLINEAR2_3695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3694, v ds
+# define BFI_FLINEAR2_3695_TICK(t)
+# define BFI_FLINEAR2_3694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3693, v ds
+# define BFI_FLINEAR2_3694_TICK(t)
+# define BFI_FLINEAR2_3693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3692, v ds
+# define BFI_FLINEAR2_3693_TICK(t)
+# define BFI_FLINEAR2_3692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3691, v ds
+# define BFI_FLINEAR2_3692_TICK(t)
+# define BFI_FLINEAR2_3691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3690, v ds
+# define BFI_FLINEAR2_3691_TICK(t)
+# define BFI_FLINEAR2_3690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3689, v ds
+# define BFI_FLINEAR2_3690_TICK(t)
+# define BFI_FLINEAR2_3689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3688, v ds
+# define BFI_FLINEAR2_3689_TICK(t)
+# define BFI_FLINEAR2_3688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3687, v ds
+# define BFI_FLINEAR2_3688_TICK(t)
+# define BFI_FLINEAR2_3687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3686, v ds
+# define BFI_FLINEAR2_3687_TICK(t)
+# define BFI_FLINEAR2_3686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3685, v ds
+# define BFI_FLINEAR2_3686_TICK(t)
+# define BFI_FLINEAR2_3685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3684, v ds
+# define BFI_FLINEAR2_3685_TICK(t)
+# define BFI_FLINEAR2_3684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3683, v ds
+# define BFI_FLINEAR2_3684_TICK(t)
+# define BFI_FLINEAR2_3683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3682, v ds
+# define BFI_FLINEAR2_3683_TICK(t)
+# define BFI_FLINEAR2_3682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3681, v ds
+# define BFI_FLINEAR2_3682_TICK(t)
+# define BFI_FLINEAR2_3681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3680, v ds
+# define BFI_FLINEAR2_3681_TICK(t)
+# define BFI_FLINEAR2_3680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3679, v ds
+# define BFI_FLINEAR2_3680_TICK(t)
+# define BFI_FLINEAR2_3679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3678, v ds
+# define BFI_FLINEAR2_3679_TICK(t)
+# define BFI_FLINEAR2_3678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3677, v ds
+# define BFI_FLINEAR2_3678_TICK(t)
+# define BFI_FLINEAR2_3677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3676, v ds
+# define BFI_FLINEAR2_3677_TICK(t)
+# define BFI_FLINEAR2_3676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3675, v ds
+# define BFI_FLINEAR2_3676_TICK(t)
+# define BFI_FLINEAR2_3675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3674, v ds
+# define BFI_FLINEAR2_3675_TICK(t)
+# define BFI_FLINEAR2_3674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3673, v ds
+# define BFI_FLINEAR2_3674_TICK(t)
+# define BFI_FLINEAR2_3673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3672, v ds
+# define BFI_FLINEAR2_3673_TICK(t)
+# define BFI_FLINEAR2_3672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3671, v ds
+# define BFI_FLINEAR2_3672_TICK(t)
+# define BFI_FLINEAR2_3671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3670, v ds
+# define BFI_FLINEAR2_3671_TICK(t)
+# define BFI_FLINEAR2_3670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3669, v ds
+# define BFI_FLINEAR2_3670_TICK(t)
+# define BFI_FLINEAR2_3669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3668, v ds
+# define BFI_FLINEAR2_3669_TICK(t)
+# define BFI_FLINEAR2_3668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3667, v ds
+# define BFI_FLINEAR2_3668_TICK(t)
+# define BFI_FLINEAR2_3667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3666, v ds
+# define BFI_FLINEAR2_3667_TICK(t)
+# define BFI_FLINEAR2_3666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3665, v ds
+# define BFI_FLINEAR2_3666_TICK(t)
+# define BFI_FLINEAR2_3665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3664, v ds
+# define BFI_FLINEAR2_3665_TICK(t)
+# define BFI_FLINEAR2_3664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3663, v ds
+# define BFI_FLINEAR2_3664_TICK(t)
+# define BFI_FLINEAR2_3663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3662, v ds
+# define BFI_FLINEAR2_3663_TICK(t)
+# define BFI_FLINEAR2_3662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3661, v ds
+# define BFI_FLINEAR2_3662_TICK(t)
+# define BFI_FLINEAR2_3661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3660, v ds
+# define BFI_FLINEAR2_3661_TICK(t)
+# define BFI_FLINEAR2_3660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3659, v ds
+# define BFI_FLINEAR2_3660_TICK(t)
+# define BFI_FLINEAR2_3659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3658, v ds
+# define BFI_FLINEAR2_3659_TICK(t)
+# define BFI_FLINEAR2_3658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3657, v ds
+# define BFI_FLINEAR2_3658_TICK(t)
+# define BFI_FLINEAR2_3657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3656, v ds
+# define BFI_FLINEAR2_3657_TICK(t)
+# define BFI_FLINEAR2_3656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3655, v ds
+# define BFI_FLINEAR2_3656_TICK(t)
+# define BFI_FLINEAR2_3655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3654, v ds
+# define BFI_FLINEAR2_3655_TICK(t)
+# define BFI_FLINEAR2_3654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3653, v ds
+# define BFI_FLINEAR2_3654_TICK(t)
+# define BFI_FLINEAR2_3653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3652, v ds
+# define BFI_FLINEAR2_3653_TICK(t)
+# define BFI_FLINEAR2_3652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3651, v ds
+# define BFI_FLINEAR2_3652_TICK(t)
+# define BFI_FLINEAR2_3651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3650, v ds
+# define BFI_FLINEAR2_3651_TICK(t)
+# define BFI_FLINEAR2_3650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3649, v ds
+# define BFI_FLINEAR2_3650_TICK(t)
+# define BFI_FLINEAR2_3649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3648, v ds
+# define BFI_FLINEAR2_3649_TICK(t)
+# define BFI_FLINEAR2_3648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3647, v ds
+# define BFI_FLINEAR2_3648_TICK(t)
+# define BFI_FLINEAR2_3647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3646, v ds
+# define BFI_FLINEAR2_3647_TICK(t)
+# define BFI_FLINEAR2_3646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3645, v ds
+# define BFI_FLINEAR2_3646_TICK(t)
+# define BFI_FLINEAR2_3645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3644, v ds
+# define BFI_FLINEAR2_3645_TICK(t)
+# define BFI_FLINEAR2_3644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3643, v ds
+# define BFI_FLINEAR2_3644_TICK(t)
+# define BFI_FLINEAR2_3643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3642, v ds
+# define BFI_FLINEAR2_3643_TICK(t)
+# define BFI_FLINEAR2_3642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3641, v ds
+# define BFI_FLINEAR2_3642_TICK(t)
+# define BFI_FLINEAR2_3641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3640, v ds
+# define BFI_FLINEAR2_3641_TICK(t)
+# define BFI_FLINEAR2_3640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3639, v ds
+# define BFI_FLINEAR2_3640_TICK(t)
+# define BFI_FLINEAR2_3639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3638, v ds
+# define BFI_FLINEAR2_3639_TICK(t)
+# define BFI_FLINEAR2_3638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3637, v ds
+# define BFI_FLINEAR2_3638_TICK(t)
+# define BFI_FLINEAR2_3637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3636, v ds
+# define BFI_FLINEAR2_3637_TICK(t)
+# define BFI_FLINEAR2_3636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3635, v ds
+# define BFI_FLINEAR2_3636_TICK(t)
+# define BFI_FLINEAR2_3635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3634, v ds
+# define BFI_FLINEAR2_3635_TICK(t)
+# define BFI_FLINEAR2_3634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3633, v ds
+# define BFI_FLINEAR2_3634_TICK(t)
+# define BFI_FLINEAR2_3633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3632, v ds
+# define BFI_FLINEAR2_3633_TICK(t)
+# define BFI_FLINEAR2_3632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3631, v ds
+# define BFI_FLINEAR2_3632_TICK(t)
+# define BFI_FLINEAR2_3631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3630, v ds
+# define BFI_FLINEAR2_3631_TICK(t)
+# define BFI_FLINEAR2_3630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3629, v ds
+# define BFI_FLINEAR2_3630_TICK(t)
+# define BFI_FLINEAR2_3629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3628, v ds
+# define BFI_FLINEAR2_3629_TICK(t)
+# define BFI_FLINEAR2_3628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3627, v ds
+# define BFI_FLINEAR2_3628_TICK(t)
+# define BFI_FLINEAR2_3627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3626, v ds
+# define BFI_FLINEAR2_3627_TICK(t)
+# define BFI_FLINEAR2_3626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3625, v ds
+# define BFI_FLINEAR2_3626_TICK(t)
+# define BFI_FLINEAR2_3625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3624, v ds
+# define BFI_FLINEAR2_3625_TICK(t)
+# define BFI_FLINEAR2_3624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3623, v ds
+# define BFI_FLINEAR2_3624_TICK(t)
+# define BFI_FLINEAR2_3623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3622, v ds
+# define BFI_FLINEAR2_3623_TICK(t)
+# define BFI_FLINEAR2_3622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3621, v ds
+# define BFI_FLINEAR2_3622_TICK(t)
+# define BFI_FLINEAR2_3621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3620, v ds
+# define BFI_FLINEAR2_3621_TICK(t)
+# define BFI_FLINEAR2_3620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3619, v ds
+# define BFI_FLINEAR2_3620_TICK(t)
+# define BFI_FLINEAR2_3619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3618, v ds
+# define BFI_FLINEAR2_3619_TICK(t)
+# define BFI_FLINEAR2_3618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3617, v ds
+# define BFI_FLINEAR2_3618_TICK(t)
+# define BFI_FLINEAR2_3617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3616, v ds
+# define BFI_FLINEAR2_3617_TICK(t)
+# define BFI_FLINEAR2_3616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3615, v ds
+# define BFI_FLINEAR2_3616_TICK(t)
+# define BFI_FLINEAR2_3615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3614, v ds
+# define BFI_FLINEAR2_3615_TICK(t)
+# define BFI_FLINEAR2_3614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3613, v ds
+# define BFI_FLINEAR2_3614_TICK(t)
+# define BFI_FLINEAR2_3613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3612, v ds
+# define BFI_FLINEAR2_3613_TICK(t)
+# define BFI_FLINEAR2_3612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3611, v ds
+# define BFI_FLINEAR2_3612_TICK(t)
+# define BFI_FLINEAR2_3611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3610, v ds
+# define BFI_FLINEAR2_3611_TICK(t)
+# define BFI_FLINEAR2_3610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3609, v ds
+# define BFI_FLINEAR2_3610_TICK(t)
+# define BFI_FLINEAR2_3609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3608, v ds
+# define BFI_FLINEAR2_3609_TICK(t)
+# define BFI_FLINEAR2_3608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3607, v ds
+# define BFI_FLINEAR2_3608_TICK(t)
+# define BFI_FLINEAR2_3607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3606, v ds
+# define BFI_FLINEAR2_3607_TICK(t)
+# define BFI_FLINEAR2_3606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3605, v ds
+# define BFI_FLINEAR2_3606_TICK(t)
+# define BFI_FLINEAR2_3605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3604, v ds
+# define BFI_FLINEAR2_3605_TICK(t)
+# define BFI_FLINEAR2_3604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3603, v ds
+# define BFI_FLINEAR2_3604_TICK(t)
+# define BFI_FLINEAR2_3603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3602, v ds
+# define BFI_FLINEAR2_3603_TICK(t)
+# define BFI_FLINEAR2_3602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3601, v ds
+# define BFI_FLINEAR2_3602_TICK(t)
+# define BFI_FLINEAR2_3601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3600, v ds
+# define BFI_FLINEAR2_3601_TICK(t)
+# define BFI_FLINEAR2_3600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3599, v ds
+# define BFI_FLINEAR2_3600_TICK(t)
+# define BFI_FLINEAR2_3599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3598, v ds
+# define BFI_FLINEAR2_3599_TICK(t)
+# define BFI_FLINEAR2_3598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3597, v ds
+# define BFI_FLINEAR2_3598_TICK(t)
+# define BFI_FLINEAR2_3597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3596, v ds
+# define BFI_FLINEAR2_3597_TICK(t)
+# define BFI_FLINEAR2_3596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3595, v ds
+# define BFI_FLINEAR2_3596_TICK(t)
+# define BFI_FLINEAR2_3595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3594, v ds
+# define BFI_FLINEAR2_3595_TICK(t)
+# define BFI_FLINEAR2_3594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3593, v ds
+# define BFI_FLINEAR2_3594_TICK(t)
+# define BFI_FLINEAR2_3593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3592, v ds
+# define BFI_FLINEAR2_3593_TICK(t)
+# define BFI_FLINEAR2_3592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3591, v ds
+# define BFI_FLINEAR2_3592_TICK(t)
+# define BFI_FLINEAR2_3591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3590, v ds
+# define BFI_FLINEAR2_3591_TICK(t)
+# define BFI_FLINEAR2_3590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3589, v ds
+# define BFI_FLINEAR2_3590_TICK(t)
+# define BFI_FLINEAR2_3589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3588, v ds
+# define BFI_FLINEAR2_3589_TICK(t)
+# define BFI_FLINEAR2_3588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3587, v ds
+# define BFI_FLINEAR2_3588_TICK(t)
+# define BFI_FLINEAR2_3587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3586, v ds
+# define BFI_FLINEAR2_3587_TICK(t)
+# define BFI_FLINEAR2_3586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3585, v ds
+# define BFI_FLINEAR2_3586_TICK(t)
+# define BFI_FLINEAR2_3585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3584, v ds
+# define BFI_FLINEAR2_3585_TICK(t)
+# define BFI_FLINEAR2_3584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3583, v ds
+# define BFI_FLINEAR2_3584_TICK(t)
+# define BFI_FLINEAR2_3583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3582, v ds
+# define BFI_FLINEAR2_3583_TICK(t)
+# define BFI_FLINEAR2_3582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3581, v ds
+# define BFI_FLINEAR2_3582_TICK(t)
+# define BFI_FLINEAR2_3581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3580, v ds
+# define BFI_FLINEAR2_3581_TICK(t)
+# define BFI_FLINEAR2_3580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3579, v ds
+# define BFI_FLINEAR2_3580_TICK(t)
+# define BFI_FLINEAR2_3579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3578, v ds
+# define BFI_FLINEAR2_3579_TICK(t)
+# define BFI_FLINEAR2_3578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3577, v ds
+# define BFI_FLINEAR2_3578_TICK(t)
+# define BFI_FLINEAR2_3577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3576, v ds
+# define BFI_FLINEAR2_3577_TICK(t)
+# define BFI_FLINEAR2_3576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3575, v ds
+# define BFI_FLINEAR2_3576_TICK(t)
+# define BFI_FLINEAR2_3575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3574, v ds
+# define BFI_FLINEAR2_3575_TICK(t)
+# define BFI_FLINEAR2_3574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3573, v ds
+# define BFI_FLINEAR2_3574_TICK(t)
+# define BFI_FLINEAR2_3573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3572, v ds
+# define BFI_FLINEAR2_3573_TICK(t)
+# define BFI_FLINEAR2_3572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3571, v ds
+# define BFI_FLINEAR2_3572_TICK(t)
+# define BFI_FLINEAR2_3571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3570, v ds
+# define BFI_FLINEAR2_3571_TICK(t)
+# define BFI_FLINEAR2_3570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3569, v ds
+# define BFI_FLINEAR2_3570_TICK(t)
+# define BFI_FLINEAR2_3569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3568, v ds
+# define BFI_FLINEAR2_3569_TICK(t)
+# define BFI_FLINEAR2_3568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3567, v ds
+# define BFI_FLINEAR2_3568_TICK(t)
+# define BFI_FLINEAR2_3567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3566, v ds
+# define BFI_FLINEAR2_3567_TICK(t)
+# define BFI_FLINEAR2_3566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3565, v ds
+# define BFI_FLINEAR2_3566_TICK(t)
+# define BFI_FLINEAR2_3565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3564, v ds
+# define BFI_FLINEAR2_3565_TICK(t)
+# define BFI_FLINEAR2_3564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3563, v ds
+# define BFI_FLINEAR2_3564_TICK(t)
+# define BFI_FLINEAR2_3563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3562, v ds
+# define BFI_FLINEAR2_3563_TICK(t)
+# define BFI_FLINEAR2_3562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3561, v ds
+# define BFI_FLINEAR2_3562_TICK(t)
+# define BFI_FLINEAR2_3561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3560, v ds
+# define BFI_FLINEAR2_3561_TICK(t)
+# define BFI_FLINEAR2_3560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3559, v ds
+# define BFI_FLINEAR2_3560_TICK(t)
+# define BFI_FLINEAR2_3559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3558, v ds
+# define BFI_FLINEAR2_3559_TICK(t)
+# define BFI_FLINEAR2_3558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3557, v ds
+# define BFI_FLINEAR2_3558_TICK(t)
+# define BFI_FLINEAR2_3557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3556, v ds
+# define BFI_FLINEAR2_3557_TICK(t)
+# define BFI_FLINEAR2_3556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3555, v ds
+# define BFI_FLINEAR2_3556_TICK(t)
+# define BFI_FLINEAR2_3555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3554, v ds
+# define BFI_FLINEAR2_3555_TICK(t)
+# define BFI_FLINEAR2_3554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3553, v ds
+# define BFI_FLINEAR2_3554_TICK(t)
+# define BFI_FLINEAR2_3553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3552, v ds
+# define BFI_FLINEAR2_3553_TICK(t)
+# define BFI_FLINEAR2_3552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3551, v ds
+# define BFI_FLINEAR2_3552_TICK(t)
+# define BFI_FLINEAR2_3551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3550, v ds
+# define BFI_FLINEAR2_3551_TICK(t)
+# define BFI_FLINEAR2_3550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3549, v ds
+# define BFI_FLINEAR2_3550_TICK(t)
+# define BFI_FLINEAR2_3549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3548, v ds
+# define BFI_FLINEAR2_3549_TICK(t)
+# define BFI_FLINEAR2_3548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3547, v ds
+# define BFI_FLINEAR2_3548_TICK(t)
+# define BFI_FLINEAR2_3547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3546, v ds
+# define BFI_FLINEAR2_3547_TICK(t)
+# define BFI_FLINEAR2_3546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3545, v ds
+# define BFI_FLINEAR2_3546_TICK(t)
+# define BFI_FLINEAR2_3545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3544, v ds
+# define BFI_FLINEAR2_3545_TICK(t)
+# define BFI_FLINEAR2_3544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3543, v ds
+# define BFI_FLINEAR2_3544_TICK(t)
+# define BFI_FLINEAR2_3543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3542, v ds
+# define BFI_FLINEAR2_3543_TICK(t)
+# define BFI_FLINEAR2_3542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3541, v ds
+# define BFI_FLINEAR2_3542_TICK(t)
+# define BFI_FLINEAR2_3541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3540, v ds
+# define BFI_FLINEAR2_3541_TICK(t)
+# define BFI_FLINEAR2_3540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3539, v ds
+# define BFI_FLINEAR2_3540_TICK(t)
+# define BFI_FLINEAR2_3539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3538, v ds
+# define BFI_FLINEAR2_3539_TICK(t)
+# define BFI_FLINEAR2_3538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3537, v ds
+# define BFI_FLINEAR2_3538_TICK(t)
+# define BFI_FLINEAR2_3537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3536, v ds
+# define BFI_FLINEAR2_3537_TICK(t)
+# define BFI_FLINEAR2_3536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3535, v ds
+# define BFI_FLINEAR2_3536_TICK(t)
+# define BFI_FLINEAR2_3535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3534, v ds
+# define BFI_FLINEAR2_3535_TICK(t)
+# define BFI_FLINEAR2_3534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3533, v ds
+# define BFI_FLINEAR2_3534_TICK(t)
+# define BFI_FLINEAR2_3533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3532, v ds
+# define BFI_FLINEAR2_3533_TICK(t)
+# define BFI_FLINEAR2_3532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3531, v ds
+# define BFI_FLINEAR2_3532_TICK(t)
+# define BFI_FLINEAR2_3531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3530, v ds
+# define BFI_FLINEAR2_3531_TICK(t)
+# define BFI_FLINEAR2_3530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3529, v ds
+# define BFI_FLINEAR2_3530_TICK(t)
+# define BFI_FLINEAR2_3529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3528, v ds
+# define BFI_FLINEAR2_3529_TICK(t)
+# define BFI_FLINEAR2_3528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3527, v ds
+# define BFI_FLINEAR2_3528_TICK(t)
+# define BFI_FLINEAR2_3527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3526, v ds
+# define BFI_FLINEAR2_3527_TICK(t)
+# define BFI_FLINEAR2_3526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3525, v ds
+# define BFI_FLINEAR2_3526_TICK(t)
+# define BFI_FLINEAR2_3525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3524, v ds
+# define BFI_FLINEAR2_3525_TICK(t)
+# define BFI_FLINEAR2_3524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3523, v ds
+# define BFI_FLINEAR2_3524_TICK(t)
+# define BFI_FLINEAR2_3523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3522, v ds
+# define BFI_FLINEAR2_3523_TICK(t)
+# define BFI_FLINEAR2_3522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3521, v ds
+# define BFI_FLINEAR2_3522_TICK(t)
+# define BFI_FLINEAR2_3521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3520, v ds
+# define BFI_FLINEAR2_3521_TICK(t)
+# define BFI_FLINEAR2_3520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3519, v ds
+# define BFI_FLINEAR2_3520_TICK(t)
+# define BFI_FLINEAR2_3519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3518, v ds
+# define BFI_FLINEAR2_3519_TICK(t)
+# define BFI_FLINEAR2_3518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3517, v ds
+# define BFI_FLINEAR2_3518_TICK(t)
+# define BFI_FLINEAR2_3517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3516, v ds
+# define BFI_FLINEAR2_3517_TICK(t)
+# define BFI_FLINEAR2_3516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3515, v ds
+# define BFI_FLINEAR2_3516_TICK(t)
+# define BFI_FLINEAR2_3515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3514, v ds
+# define BFI_FLINEAR2_3515_TICK(t)
+# define BFI_FLINEAR2_3514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3513, v ds
+# define BFI_FLINEAR2_3514_TICK(t)
+# define BFI_FLINEAR2_3513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3512, v ds
+# define BFI_FLINEAR2_3513_TICK(t)
+# define BFI_FLINEAR2_3512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3511, v ds
+# define BFI_FLINEAR2_3512_TICK(t)
+# define BFI_FLINEAR2_3511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3510, v ds
+# define BFI_FLINEAR2_3511_TICK(t)
+# define BFI_FLINEAR2_3510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3509, v ds
+# define BFI_FLINEAR2_3510_TICK(t)
+# define BFI_FLINEAR2_3509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3508, v ds
+# define BFI_FLINEAR2_3509_TICK(t)
+# define BFI_FLINEAR2_3508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3507, v ds
+# define BFI_FLINEAR2_3508_TICK(t)
+# define BFI_FLINEAR2_3507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3506, v ds
+# define BFI_FLINEAR2_3507_TICK(t)
+# define BFI_FLINEAR2_3506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3505, v ds
+# define BFI_FLINEAR2_3506_TICK(t)
+# define BFI_FLINEAR2_3505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3504, v ds
+# define BFI_FLINEAR2_3505_TICK(t)
+# define BFI_FLINEAR2_3504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3503, v ds
+# define BFI_FLINEAR2_3504_TICK(t)
+# define BFI_FLINEAR2_3503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3502, v ds
+# define BFI_FLINEAR2_3503_TICK(t)
+# define BFI_FLINEAR2_3502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3501, v ds
+# define BFI_FLINEAR2_3502_TICK(t)
+# define BFI_FLINEAR2_3501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3500, v ds
+# define BFI_FLINEAR2_3501_TICK(t)
+# define BFI_FLINEAR2_3500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3499, v ds
+# define BFI_FLINEAR2_3500_TICK(t)
+# define BFI_FLINEAR2_3499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3498, v ds
+# define BFI_FLINEAR2_3499_TICK(t)
+# define BFI_FLINEAR2_3498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3497, v ds
+# define BFI_FLINEAR2_3498_TICK(t)
+# define BFI_FLINEAR2_3497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3496, v ds
+# define BFI_FLINEAR2_3497_TICK(t)
+# define BFI_FLINEAR2_3496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3495, v ds
+# define BFI_FLINEAR2_3496_TICK(t)
+# define BFI_FLINEAR2_3495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3494, v ds
+# define BFI_FLINEAR2_3495_TICK(t)
+# define BFI_FLINEAR2_3494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3493, v ds
+# define BFI_FLINEAR2_3494_TICK(t)
+# define BFI_FLINEAR2_3493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3492, v ds
+# define BFI_FLINEAR2_3493_TICK(t)
+# define BFI_FLINEAR2_3492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3491, v ds
+# define BFI_FLINEAR2_3492_TICK(t)
+# define BFI_FLINEAR2_3491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3490, v ds
+# define BFI_FLINEAR2_3491_TICK(t)
+# define BFI_FLINEAR2_3490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3489, v ds
+# define BFI_FLINEAR2_3490_TICK(t)
+# define BFI_FLINEAR2_3489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3488, v ds
+# define BFI_FLINEAR2_3489_TICK(t)
+# define BFI_FLINEAR2_3488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3487, v ds
+# define BFI_FLINEAR2_3488_TICK(t)
+# define BFI_FLINEAR2_3487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3486, v ds
+# define BFI_FLINEAR2_3487_TICK(t)
+# define BFI_FLINEAR2_3486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3485, v ds
+# define BFI_FLINEAR2_3486_TICK(t)
+# define BFI_FLINEAR2_3485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3484, v ds
+# define BFI_FLINEAR2_3485_TICK(t)
+# define BFI_FLINEAR2_3484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3483, v ds
+# define BFI_FLINEAR2_3484_TICK(t)
+# define BFI_FLINEAR2_3483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3482, v ds
+# define BFI_FLINEAR2_3483_TICK(t)
+# define BFI_FLINEAR2_3482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3481, v ds
+# define BFI_FLINEAR2_3482_TICK(t)
+# define BFI_FLINEAR2_3481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3480, v ds
+# define BFI_FLINEAR2_3481_TICK(t)
+# define BFI_FLINEAR2_3480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3479, v ds
+# define BFI_FLINEAR2_3480_TICK(t)
+# define BFI_FLINEAR2_3479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3478, v ds
+# define BFI_FLINEAR2_3479_TICK(t)
+# define BFI_FLINEAR2_3478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3477, v ds
+# define BFI_FLINEAR2_3478_TICK(t)
+# define BFI_FLINEAR2_3477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3476, v ds
+# define BFI_FLINEAR2_3477_TICK(t)
+# define BFI_FLINEAR2_3476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3475, v ds
+# define BFI_FLINEAR2_3476_TICK(t)
+# define BFI_FLINEAR2_3475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3474, v ds
+# define BFI_FLINEAR2_3475_TICK(t)
+# define BFI_FLINEAR2_3474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3473, v ds
+# define BFI_FLINEAR2_3474_TICK(t)
+# define BFI_FLINEAR2_3473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3472, v ds
+# define BFI_FLINEAR2_3473_TICK(t)
+# define BFI_FLINEAR2_3472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3471, v ds
+# define BFI_FLINEAR2_3472_TICK(t)
+# define BFI_FLINEAR2_3471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3470, v ds
+# define BFI_FLINEAR2_3471_TICK(t)
+# define BFI_FLINEAR2_3470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3469, v ds
+# define BFI_FLINEAR2_3470_TICK(t)
+# define BFI_FLINEAR2_3469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3468, v ds
+# define BFI_FLINEAR2_3469_TICK(t)
+# define BFI_FLINEAR2_3468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3467, v ds
+# define BFI_FLINEAR2_3468_TICK(t)
+# define BFI_FLINEAR2_3467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3466, v ds
+# define BFI_FLINEAR2_3467_TICK(t)
+# define BFI_FLINEAR2_3466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3465, v ds
+# define BFI_FLINEAR2_3466_TICK(t)
+# define BFI_FLINEAR2_3465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3464, v ds
+# define BFI_FLINEAR2_3465_TICK(t)
+# define BFI_FLINEAR2_3464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3463, v ds
+# define BFI_FLINEAR2_3464_TICK(t)
+# define BFI_FLINEAR2_3463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3462, v ds
+# define BFI_FLINEAR2_3463_TICK(t)
+# define BFI_FLINEAR2_3462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3461, v ds
+# define BFI_FLINEAR2_3462_TICK(t)
+# define BFI_FLINEAR2_3461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3460, v ds
+# define BFI_FLINEAR2_3461_TICK(t)
+# define BFI_FLINEAR2_3460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3459, v ds
+# define BFI_FLINEAR2_3460_TICK(t)
+# define BFI_FLINEAR2_3459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3458, v ds
+# define BFI_FLINEAR2_3459_TICK(t)
+# define BFI_FLINEAR2_3458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3457, v ds
+# define BFI_FLINEAR2_3458_TICK(t)
+# define BFI_FLINEAR2_3457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3456, v ds
+# define BFI_FLINEAR2_3457_TICK(t)
+# define BFI_FLINEAR2_3456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3455, v ds
+# define BFI_FLINEAR2_3456_TICK(t)
+# define BFI_FLINEAR2_3455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3454, v ds
+# define BFI_FLINEAR2_3455_TICK(t)
+# define BFI_FLINEAR2_3454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3453, v ds
+# define BFI_FLINEAR2_3454_TICK(t)
+# define BFI_FLINEAR2_3453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3452, v ds
+# define BFI_FLINEAR2_3453_TICK(t)
+# define BFI_FLINEAR2_3452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3451, v ds
+# define BFI_FLINEAR2_3452_TICK(t)
+# define BFI_FLINEAR2_3451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3450, v ds
+# define BFI_FLINEAR2_3451_TICK(t)
+# define BFI_FLINEAR2_3450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3449, v ds
+# define BFI_FLINEAR2_3450_TICK(t)
+# define BFI_FLINEAR2_3449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3448, v ds
+# define BFI_FLINEAR2_3449_TICK(t)
+# define BFI_FLINEAR2_3448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3447, v ds
+# define BFI_FLINEAR2_3448_TICK(t)
+# define BFI_FLINEAR2_3447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3446, v ds
+# define BFI_FLINEAR2_3447_TICK(t)
+# define BFI_FLINEAR2_3446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3445, v ds
+# define BFI_FLINEAR2_3446_TICK(t)
+# define BFI_FLINEAR2_3445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3444, v ds
+# define BFI_FLINEAR2_3445_TICK(t)
+# define BFI_FLINEAR2_3444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3443, v ds
+# define BFI_FLINEAR2_3444_TICK(t)
+# define BFI_FLINEAR2_3443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3442, v ds
+# define BFI_FLINEAR2_3443_TICK(t)
+# define BFI_FLINEAR2_3442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3441, v ds
+# define BFI_FLINEAR2_3442_TICK(t)
+# define BFI_FLINEAR2_3441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3440, v ds
+# define BFI_FLINEAR2_3441_TICK(t)
+# define BFI_FLINEAR2_3440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3439, v ds
+# define BFI_FLINEAR2_3440_TICK(t)
+# define BFI_FLINEAR2_3439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3438, v ds
+# define BFI_FLINEAR2_3439_TICK(t)
+# define BFI_FLINEAR2_3438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3437, v ds
+# define BFI_FLINEAR2_3438_TICK(t)
+# define BFI_FLINEAR2_3437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3436, v ds
+# define BFI_FLINEAR2_3437_TICK(t)
+# define BFI_FLINEAR2_3436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3435, v ds
+# define BFI_FLINEAR2_3436_TICK(t)
+# define BFI_FLINEAR2_3435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3434, v ds
+# define BFI_FLINEAR2_3435_TICK(t)
+# define BFI_FLINEAR2_3434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3433, v ds
+# define BFI_FLINEAR2_3434_TICK(t)
+# define BFI_FLINEAR2_3433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3432, v ds
+# define BFI_FLINEAR2_3433_TICK(t)
+# define BFI_FLINEAR2_3432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3431, v ds
+# define BFI_FLINEAR2_3432_TICK(t)
+# define BFI_FLINEAR2_3431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3430, v ds
+# define BFI_FLINEAR2_3431_TICK(t)
+# define BFI_FLINEAR2_3430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3429, v ds
+# define BFI_FLINEAR2_3430_TICK(t)
+# define BFI_FLINEAR2_3429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3428, v ds
+# define BFI_FLINEAR2_3429_TICK(t)
+# define BFI_FLINEAR2_3428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3427, v ds
+# define BFI_FLINEAR2_3428_TICK(t)
+# define BFI_FLINEAR2_3427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3426, v ds
+# define BFI_FLINEAR2_3427_TICK(t)
+# define BFI_FLINEAR2_3426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3425, v ds
+# define BFI_FLINEAR2_3426_TICK(t)
+# define BFI_FLINEAR2_3425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3424, v ds
+# define BFI_FLINEAR2_3425_TICK(t)
+# define BFI_FLINEAR2_3424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3423, v ds
+# define BFI_FLINEAR2_3424_TICK(t)
+# define BFI_FLINEAR2_3423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3422, v ds
+# define BFI_FLINEAR2_3423_TICK(t)
+# define BFI_FLINEAR2_3422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3421, v ds
+# define BFI_FLINEAR2_3422_TICK(t)
+# define BFI_FLINEAR2_3421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3420, v ds
+# define BFI_FLINEAR2_3421_TICK(t)
+# define BFI_FLINEAR2_3420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3419, v ds
+# define BFI_FLINEAR2_3420_TICK(t)
+# define BFI_FLINEAR2_3419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3418, v ds
+# define BFI_FLINEAR2_3419_TICK(t)
+# define BFI_FLINEAR2_3418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3417, v ds
+# define BFI_FLINEAR2_3418_TICK(t)
+# define BFI_FLINEAR2_3417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3416, v ds
+# define BFI_FLINEAR2_3417_TICK(t)
+# define BFI_FLINEAR2_3416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3415, v ds
+# define BFI_FLINEAR2_3416_TICK(t)
+# define BFI_FLINEAR2_3415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3414, v ds
+# define BFI_FLINEAR2_3415_TICK(t)
+# define BFI_FLINEAR2_3414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3413, v ds
+# define BFI_FLINEAR2_3414_TICK(t)
+# define BFI_FLINEAR2_3413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3412, v ds
+# define BFI_FLINEAR2_3413_TICK(t)
+# define BFI_FLINEAR2_3412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3411, v ds
+# define BFI_FLINEAR2_3412_TICK(t)
+# define BFI_FLINEAR2_3411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3410, v ds
+# define BFI_FLINEAR2_3411_TICK(t)
+# define BFI_FLINEAR2_3410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3409, v ds
+# define BFI_FLINEAR2_3410_TICK(t)
+# define BFI_FLINEAR2_3409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3408, v ds
+# define BFI_FLINEAR2_3409_TICK(t)
+# define BFI_FLINEAR2_3408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3407, v ds
+# define BFI_FLINEAR2_3408_TICK(t)
+# define BFI_FLINEAR2_3407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3406, v ds
+# define BFI_FLINEAR2_3407_TICK(t)
+# define BFI_FLINEAR2_3406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3405, v ds
+# define BFI_FLINEAR2_3406_TICK(t)
+# define BFI_FLINEAR2_3405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3404, v ds
+# define BFI_FLINEAR2_3405_TICK(t)
+# define BFI_FLINEAR2_3404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3403, v ds
+# define BFI_FLINEAR2_3404_TICK(t)
+# define BFI_FLINEAR2_3403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3402, v ds
+# define BFI_FLINEAR2_3403_TICK(t)
+# define BFI_FLINEAR2_3402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3401, v ds
+# define BFI_FLINEAR2_3402_TICK(t)
+# define BFI_FLINEAR2_3401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3400, v ds
+# define BFI_FLINEAR2_3401_TICK(t)
+# define BFI_FLINEAR2_3400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3399, v ds
+# define BFI_FLINEAR2_3400_TICK(t)
+# define BFI_FLINEAR2_3399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3398, v ds
+# define BFI_FLINEAR2_3399_TICK(t)
+# define BFI_FLINEAR2_3398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3397, v ds
+# define BFI_FLINEAR2_3398_TICK(t)
+# define BFI_FLINEAR2_3397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3396, v ds
+# define BFI_FLINEAR2_3397_TICK(t)
+# define BFI_FLINEAR2_3396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3395, v ds
+# define BFI_FLINEAR2_3396_TICK(t)
+# define BFI_FLINEAR2_3395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3394, v ds
+# define BFI_FLINEAR2_3395_TICK(t)
+# define BFI_FLINEAR2_3394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3393, v ds
+# define BFI_FLINEAR2_3394_TICK(t)
+# define BFI_FLINEAR2_3393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3392, v ds
+# define BFI_FLINEAR2_3393_TICK(t)
+# define BFI_FLINEAR2_3392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3391, v ds
+# define BFI_FLINEAR2_3392_TICK(t)
+# define BFI_FLINEAR2_3391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3390, v ds
+# define BFI_FLINEAR2_3391_TICK(t)
+# define BFI_FLINEAR2_3390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3389, v ds
+# define BFI_FLINEAR2_3390_TICK(t)
+# define BFI_FLINEAR2_3389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3388, v ds
+# define BFI_FLINEAR2_3389_TICK(t)
+# define BFI_FLINEAR2_3388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3387, v ds
+# define BFI_FLINEAR2_3388_TICK(t)
+# define BFI_FLINEAR2_3387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3386, v ds
+# define BFI_FLINEAR2_3387_TICK(t)
+# define BFI_FLINEAR2_3386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3385, v ds
+# define BFI_FLINEAR2_3386_TICK(t)
+# define BFI_FLINEAR2_3385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3384, v ds
+# define BFI_FLINEAR2_3385_TICK(t)
+# define BFI_FLINEAR2_3384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3383, v ds
+# define BFI_FLINEAR2_3384_TICK(t)
+# define BFI_FLINEAR2_3383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3382, v ds
+# define BFI_FLINEAR2_3383_TICK(t)
+# define BFI_FLINEAR2_3382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3381, v ds
+# define BFI_FLINEAR2_3382_TICK(t)
+# define BFI_FLINEAR2_3381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3380, v ds
+# define BFI_FLINEAR2_3381_TICK(t)
+# define BFI_FLINEAR2_3380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3379, v ds
+# define BFI_FLINEAR2_3380_TICK(t)
+# define BFI_FLINEAR2_3379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3378, v ds
+# define BFI_FLINEAR2_3379_TICK(t)
+# define BFI_FLINEAR2_3378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3377, v ds
+# define BFI_FLINEAR2_3378_TICK(t)
+# define BFI_FLINEAR2_3377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3376, v ds
+# define BFI_FLINEAR2_3377_TICK(t)
+# define BFI_FLINEAR2_3376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3375, v ds
+# define BFI_FLINEAR2_3376_TICK(t)
+# define BFI_FLINEAR2_3375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3374, v ds
+# define BFI_FLINEAR2_3375_TICK(t)
+# define BFI_FLINEAR2_3374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3373, v ds
+# define BFI_FLINEAR2_3374_TICK(t)
+# define BFI_FLINEAR2_3373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3372, v ds
+# define BFI_FLINEAR2_3373_TICK(t)
+# define BFI_FLINEAR2_3372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3371, v ds
+# define BFI_FLINEAR2_3372_TICK(t)
+# define BFI_FLINEAR2_3371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3370, v ds
+# define BFI_FLINEAR2_3371_TICK(t)
+# define BFI_FLINEAR2_3370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3369, v ds
+# define BFI_FLINEAR2_3370_TICK(t)
+# define BFI_FLINEAR2_3369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3368, v ds
+# define BFI_FLINEAR2_3369_TICK(t)
+# define BFI_FLINEAR2_3368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3367, v ds
+# define BFI_FLINEAR2_3368_TICK(t)
+# define BFI_FLINEAR2_3367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3366, v ds
+# define BFI_FLINEAR2_3367_TICK(t)
+# define BFI_FLINEAR2_3366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3365, v ds
+# define BFI_FLINEAR2_3366_TICK(t)
+# define BFI_FLINEAR2_3365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3364, v ds
+# define BFI_FLINEAR2_3365_TICK(t)
+# define BFI_FLINEAR2_3364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3363, v ds
+# define BFI_FLINEAR2_3364_TICK(t)
+# define BFI_FLINEAR2_3363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3362, v ds
+# define BFI_FLINEAR2_3363_TICK(t)
+# define BFI_FLINEAR2_3362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3361, v ds
+# define BFI_FLINEAR2_3362_TICK(t)
+# define BFI_FLINEAR2_3361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3360, v ds
+# define BFI_FLINEAR2_3361_TICK(t)
+# define BFI_FLINEAR2_3360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3359, v ds
+# define BFI_FLINEAR2_3360_TICK(t)
+# define BFI_FLINEAR2_3359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3358, v ds
+# define BFI_FLINEAR2_3359_TICK(t)
+# define BFI_FLINEAR2_3358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3357, v ds
+# define BFI_FLINEAR2_3358_TICK(t)
+# define BFI_FLINEAR2_3357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3356, v ds
+# define BFI_FLINEAR2_3357_TICK(t)
+# define BFI_FLINEAR2_3356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3355, v ds
+# define BFI_FLINEAR2_3356_TICK(t)
+# define BFI_FLINEAR2_3355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3354, v ds
+# define BFI_FLINEAR2_3355_TICK(t)
+# define BFI_FLINEAR2_3354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3353, v ds
+# define BFI_FLINEAR2_3354_TICK(t)
+# define BFI_FLINEAR2_3353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3352, v ds
+# define BFI_FLINEAR2_3353_TICK(t)
+# define BFI_FLINEAR2_3352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3351, v ds
+# define BFI_FLINEAR2_3352_TICK(t)
+# define BFI_FLINEAR2_3351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3350, v ds
+# define BFI_FLINEAR2_3351_TICK(t)
+# define BFI_FLINEAR2_3350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3349, v ds
+# define BFI_FLINEAR2_3350_TICK(t)
+# define BFI_FLINEAR2_3349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3348, v ds
+# define BFI_FLINEAR2_3349_TICK(t)
+# define BFI_FLINEAR2_3348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3347, v ds
+# define BFI_FLINEAR2_3348_TICK(t)
+# define BFI_FLINEAR2_3347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3346, v ds
+# define BFI_FLINEAR2_3347_TICK(t)
+# define BFI_FLINEAR2_3346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3345, v ds
+# define BFI_FLINEAR2_3346_TICK(t)
+# define BFI_FLINEAR2_3345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3344, v ds
+# define BFI_FLINEAR2_3345_TICK(t)
+# define BFI_FLINEAR2_3344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3343, v ds
+# define BFI_FLINEAR2_3344_TICK(t)
+# define BFI_FLINEAR2_3343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3342, v ds
+# define BFI_FLINEAR2_3343_TICK(t)
+# define BFI_FLINEAR2_3342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3341, v ds
+# define BFI_FLINEAR2_3342_TICK(t)
+# define BFI_FLINEAR2_3341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3340, v ds
+# define BFI_FLINEAR2_3341_TICK(t)
+# define BFI_FLINEAR2_3340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3339, v ds
+# define BFI_FLINEAR2_3340_TICK(t)
+# define BFI_FLINEAR2_3339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3338, v ds
+# define BFI_FLINEAR2_3339_TICK(t)
+# define BFI_FLINEAR2_3338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3337, v ds
+# define BFI_FLINEAR2_3338_TICK(t)
+# define BFI_FLINEAR2_3337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3336, v ds
+# define BFI_FLINEAR2_3337_TICK(t)
+# define BFI_FLINEAR2_3336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3335, v ds
+# define BFI_FLINEAR2_3336_TICK(t)
+# define BFI_FLINEAR2_3335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3334, v ds
+# define BFI_FLINEAR2_3335_TICK(t)
+# define BFI_FLINEAR2_3334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3333, v ds
+# define BFI_FLINEAR2_3334_TICK(t)
+# define BFI_FLINEAR2_3333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3332, v ds
+# define BFI_FLINEAR2_3333_TICK(t)
+# define BFI_FLINEAR2_3332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3331, v ds
+# define BFI_FLINEAR2_3332_TICK(t)
+# define BFI_FLINEAR2_3331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3330, v ds
+# define BFI_FLINEAR2_3331_TICK(t)
+# define BFI_FLINEAR2_3330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3329, v ds
+# define BFI_FLINEAR2_3330_TICK(t)
+# define BFI_FLINEAR2_3329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3328, v ds
+# define BFI_FLINEAR2_3329_TICK(t)
+# define BFI_FLINEAR2_3328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3327, v ds
+# define BFI_FLINEAR2_3328_TICK(t)
+# define BFI_FLINEAR2_3327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3326, v ds
+# define BFI_FLINEAR2_3327_TICK(t)
+# define BFI_FLINEAR2_3326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3325, v ds
+# define BFI_FLINEAR2_3326_TICK(t)
+# define BFI_FLINEAR2_3325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3324, v ds
+# define BFI_FLINEAR2_3325_TICK(t)
+# define BFI_FLINEAR2_3324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3323, v ds
+# define BFI_FLINEAR2_3324_TICK(t)
+# define BFI_FLINEAR2_3323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3322, v ds
+# define BFI_FLINEAR2_3323_TICK(t)
+# define BFI_FLINEAR2_3322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3321, v ds
+# define BFI_FLINEAR2_3322_TICK(t)
+# define BFI_FLINEAR2_3321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3320, v ds
+# define BFI_FLINEAR2_3321_TICK(t)
+# define BFI_FLINEAR2_3320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3319, v ds
+# define BFI_FLINEAR2_3320_TICK(t)
+# define BFI_FLINEAR2_3319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3318, v ds
+# define BFI_FLINEAR2_3319_TICK(t)
+# define BFI_FLINEAR2_3318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3317, v ds
+# define BFI_FLINEAR2_3318_TICK(t)
+# define BFI_FLINEAR2_3317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3316, v ds
+# define BFI_FLINEAR2_3317_TICK(t)
+# define BFI_FLINEAR2_3316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3315, v ds
+# define BFI_FLINEAR2_3316_TICK(t)
+# define BFI_FLINEAR2_3315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3314, v ds
+# define BFI_FLINEAR2_3315_TICK(t)
+# define BFI_FLINEAR2_3314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3313, v ds
+# define BFI_FLINEAR2_3314_TICK(t)
+# define BFI_FLINEAR2_3313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3312, v ds
+# define BFI_FLINEAR2_3313_TICK(t)
+# define BFI_FLINEAR2_3312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3311, v ds
+# define BFI_FLINEAR2_3312_TICK(t)
+# define BFI_FLINEAR2_3311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3310, v ds
+# define BFI_FLINEAR2_3311_TICK(t)
+# define BFI_FLINEAR2_3310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3309, v ds
+# define BFI_FLINEAR2_3310_TICK(t)
+# define BFI_FLINEAR2_3309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3308, v ds
+# define BFI_FLINEAR2_3309_TICK(t)
+# define BFI_FLINEAR2_3308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3307, v ds
+# define BFI_FLINEAR2_3308_TICK(t)
+# define BFI_FLINEAR2_3307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3306, v ds
+# define BFI_FLINEAR2_3307_TICK(t)
+# define BFI_FLINEAR2_3306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3305, v ds
+# define BFI_FLINEAR2_3306_TICK(t)
+# define BFI_FLINEAR2_3305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3304, v ds
+# define BFI_FLINEAR2_3305_TICK(t)
+# define BFI_FLINEAR2_3304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3303, v ds
+# define BFI_FLINEAR2_3304_TICK(t)
+# define BFI_FLINEAR2_3303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3302, v ds
+# define BFI_FLINEAR2_3303_TICK(t)
+# define BFI_FLINEAR2_3302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3301, v ds
+# define BFI_FLINEAR2_3302_TICK(t)
+# define BFI_FLINEAR2_3301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3300, v ds
+# define BFI_FLINEAR2_3301_TICK(t)
+# define BFI_FLINEAR2_3300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3299, v ds
+# define BFI_FLINEAR2_3300_TICK(t)
+# define BFI_FLINEAR2_3299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3298, v ds
+# define BFI_FLINEAR2_3299_TICK(t)
+# define BFI_FLINEAR2_3298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3297, v ds
+# define BFI_FLINEAR2_3298_TICK(t)
+# define BFI_FLINEAR2_3297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3296, v ds
+# define BFI_FLINEAR2_3297_TICK(t)
+# define BFI_FLINEAR2_3296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3295, v ds
+# define BFI_FLINEAR2_3296_TICK(t)
+# define BFI_FLINEAR2_3295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3294, v ds
+# define BFI_FLINEAR2_3295_TICK(t)
+# define BFI_FLINEAR2_3294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3293, v ds
+# define BFI_FLINEAR2_3294_TICK(t)
+# define BFI_FLINEAR2_3293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3292, v ds
+# define BFI_FLINEAR2_3293_TICK(t)
+# define BFI_FLINEAR2_3292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3291, v ds
+# define BFI_FLINEAR2_3292_TICK(t)
+# define BFI_FLINEAR2_3291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3290, v ds
+# define BFI_FLINEAR2_3291_TICK(t)
+# define BFI_FLINEAR2_3290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3289, v ds
+# define BFI_FLINEAR2_3290_TICK(t)
+# define BFI_FLINEAR2_3289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3288, v ds
+# define BFI_FLINEAR2_3289_TICK(t)
+# define BFI_FLINEAR2_3288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3287, v ds
+# define BFI_FLINEAR2_3288_TICK(t)
+# define BFI_FLINEAR2_3287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3286, v ds
+# define BFI_FLINEAR2_3287_TICK(t)
+# define BFI_FLINEAR2_3286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3285, v ds
+# define BFI_FLINEAR2_3286_TICK(t)
+# define BFI_FLINEAR2_3285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3284, v ds
+# define BFI_FLINEAR2_3285_TICK(t)
+# define BFI_FLINEAR2_3284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3283, v ds
+# define BFI_FLINEAR2_3284_TICK(t)
+# define BFI_FLINEAR2_3283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3282, v ds
+# define BFI_FLINEAR2_3283_TICK(t)
+# define BFI_FLINEAR2_3282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3281, v ds
+# define BFI_FLINEAR2_3282_TICK(t)
+# define BFI_FLINEAR2_3281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3280, v ds
+# define BFI_FLINEAR2_3281_TICK(t)
+# define BFI_FLINEAR2_3280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3279, v ds
+# define BFI_FLINEAR2_3280_TICK(t)
+# define BFI_FLINEAR2_3279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3278, v ds
+# define BFI_FLINEAR2_3279_TICK(t)
+# define BFI_FLINEAR2_3278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3277, v ds
+# define BFI_FLINEAR2_3278_TICK(t)
+# define BFI_FLINEAR2_3277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3276, v ds
+# define BFI_FLINEAR2_3277_TICK(t)
+# define BFI_FLINEAR2_3276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3275, v ds
+# define BFI_FLINEAR2_3276_TICK(t)
+# define BFI_FLINEAR2_3275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3274, v ds
+# define BFI_FLINEAR2_3275_TICK(t)
+# define BFI_FLINEAR2_3274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3273, v ds
+# define BFI_FLINEAR2_3274_TICK(t)
+# define BFI_FLINEAR2_3273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3272, v ds
+# define BFI_FLINEAR2_3273_TICK(t)
+# define BFI_FLINEAR2_3272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3271, v ds
+# define BFI_FLINEAR2_3272_TICK(t)
+# define BFI_FLINEAR2_3271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3270, v ds
+# define BFI_FLINEAR2_3271_TICK(t)
+# define BFI_FLINEAR2_3270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3269, v ds
+# define BFI_FLINEAR2_3270_TICK(t)
+# define BFI_FLINEAR2_3269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3268, v ds
+# define BFI_FLINEAR2_3269_TICK(t)
+# define BFI_FLINEAR2_3268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3267, v ds
+# define BFI_FLINEAR2_3268_TICK(t)
+# define BFI_FLINEAR2_3267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3266, v ds
+# define BFI_FLINEAR2_3267_TICK(t)
+# define BFI_FLINEAR2_3266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3265, v ds
+# define BFI_FLINEAR2_3266_TICK(t)
+# define BFI_FLINEAR2_3265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3264, v ds
+# define BFI_FLINEAR2_3265_TICK(t)
+# define BFI_FLINEAR2_3264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3263, v ds
+# define BFI_FLINEAR2_3264_TICK(t)
+# define BFI_FLINEAR2_3263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3262, v ds
+# define BFI_FLINEAR2_3263_TICK(t)
+# define BFI_FLINEAR2_3262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3261, v ds
+# define BFI_FLINEAR2_3262_TICK(t)
+# define BFI_FLINEAR2_3261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3260, v ds
+# define BFI_FLINEAR2_3261_TICK(t)
+# define BFI_FLINEAR2_3260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3259, v ds
+# define BFI_FLINEAR2_3260_TICK(t)
+# define BFI_FLINEAR2_3259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3258, v ds
+# define BFI_FLINEAR2_3259_TICK(t)
+# define BFI_FLINEAR2_3258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3257, v ds
+# define BFI_FLINEAR2_3258_TICK(t)
+# define BFI_FLINEAR2_3257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3256, v ds
+# define BFI_FLINEAR2_3257_TICK(t)
+# define BFI_FLINEAR2_3256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3255, v ds
+# define BFI_FLINEAR2_3256_TICK(t)
+# define BFI_FLINEAR2_3255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3254, v ds
+# define BFI_FLINEAR2_3255_TICK(t)
+# define BFI_FLINEAR2_3254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3253, v ds
+# define BFI_FLINEAR2_3254_TICK(t)
+# define BFI_FLINEAR2_3253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3252, v ds
+# define BFI_FLINEAR2_3253_TICK(t)
+# define BFI_FLINEAR2_3252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3251, v ds
+# define BFI_FLINEAR2_3252_TICK(t)
+# define BFI_FLINEAR2_3251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3250, v ds
+# define BFI_FLINEAR2_3251_TICK(t)
+# define BFI_FLINEAR2_3250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3249, v ds
+# define BFI_FLINEAR2_3250_TICK(t)
+# define BFI_FLINEAR2_3249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3248, v ds
+# define BFI_FLINEAR2_3249_TICK(t)
+# define BFI_FLINEAR2_3248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3247, v ds
+# define BFI_FLINEAR2_3248_TICK(t)
+# define BFI_FLINEAR2_3247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3246, v ds
+# define BFI_FLINEAR2_3247_TICK(t)
+# define BFI_FLINEAR2_3246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3245, v ds
+# define BFI_FLINEAR2_3246_TICK(t)
+# define BFI_FLINEAR2_3245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3244, v ds
+# define BFI_FLINEAR2_3245_TICK(t)
+# define BFI_FLINEAR2_3244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3243, v ds
+# define BFI_FLINEAR2_3244_TICK(t)
+# define BFI_FLINEAR2_3243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3242, v ds
+# define BFI_FLINEAR2_3243_TICK(t)
+# define BFI_FLINEAR2_3242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3241, v ds
+# define BFI_FLINEAR2_3242_TICK(t)
+# define BFI_FLINEAR2_3241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3240, v ds
+# define BFI_FLINEAR2_3241_TICK(t)
+# define BFI_FLINEAR2_3240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3239, v ds
+# define BFI_FLINEAR2_3240_TICK(t)
+# define BFI_FLINEAR2_3239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3238, v ds
+# define BFI_FLINEAR2_3239_TICK(t)
+# define BFI_FLINEAR2_3238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3237, v ds
+# define BFI_FLINEAR2_3238_TICK(t)
+# define BFI_FLINEAR2_3237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3236, v ds
+# define BFI_FLINEAR2_3237_TICK(t)
+# define BFI_FLINEAR2_3236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3235, v ds
+# define BFI_FLINEAR2_3236_TICK(t)
+# define BFI_FLINEAR2_3235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3234, v ds
+# define BFI_FLINEAR2_3235_TICK(t)
+# define BFI_FLINEAR2_3234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3233, v ds
+# define BFI_FLINEAR2_3234_TICK(t)
+# define BFI_FLINEAR2_3233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3232, v ds
+# define BFI_FLINEAR2_3233_TICK(t)
+# define BFI_FLINEAR2_3232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3231, v ds
+# define BFI_FLINEAR2_3232_TICK(t)
+# define BFI_FLINEAR2_3231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3230, v ds
+# define BFI_FLINEAR2_3231_TICK(t)
+# define BFI_FLINEAR2_3230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3229, v ds
+# define BFI_FLINEAR2_3230_TICK(t)
+# define BFI_FLINEAR2_3229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3228, v ds
+# define BFI_FLINEAR2_3229_TICK(t)
+# define BFI_FLINEAR2_3228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3227, v ds
+# define BFI_FLINEAR2_3228_TICK(t)
+# define BFI_FLINEAR2_3227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3226, v ds
+# define BFI_FLINEAR2_3227_TICK(t)
+# define BFI_FLINEAR2_3226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3225, v ds
+# define BFI_FLINEAR2_3226_TICK(t)
+# define BFI_FLINEAR2_3225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3224, v ds
+# define BFI_FLINEAR2_3225_TICK(t)
+# define BFI_FLINEAR2_3224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3223, v ds
+# define BFI_FLINEAR2_3224_TICK(t)
+# define BFI_FLINEAR2_3223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3222, v ds
+# define BFI_FLINEAR2_3223_TICK(t)
+# define BFI_FLINEAR2_3222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3221, v ds
+# define BFI_FLINEAR2_3222_TICK(t)
+# define BFI_FLINEAR2_3221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3220, v ds
+# define BFI_FLINEAR2_3221_TICK(t)
+# define BFI_FLINEAR2_3220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3219, v ds
+# define BFI_FLINEAR2_3220_TICK(t)
+# define BFI_FLINEAR2_3219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3218, v ds
+# define BFI_FLINEAR2_3219_TICK(t)
+# define BFI_FLINEAR2_3218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3217, v ds
+# define BFI_FLINEAR2_3218_TICK(t)
+# define BFI_FLINEAR2_3217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3216, v ds
+# define BFI_FLINEAR2_3217_TICK(t)
+# define BFI_FLINEAR2_3216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3215, v ds
+# define BFI_FLINEAR2_3216_TICK(t)
+# define BFI_FLINEAR2_3215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3214, v ds
+# define BFI_FLINEAR2_3215_TICK(t)
+# define BFI_FLINEAR2_3214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3213, v ds
+# define BFI_FLINEAR2_3214_TICK(t)
+# define BFI_FLINEAR2_3213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3212, v ds
+# define BFI_FLINEAR2_3213_TICK(t)
+# define BFI_FLINEAR2_3212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3211, v ds
+# define BFI_FLINEAR2_3212_TICK(t)
+# define BFI_FLINEAR2_3211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3210, v ds
+# define BFI_FLINEAR2_3211_TICK(t)
+# define BFI_FLINEAR2_3210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3209, v ds
+# define BFI_FLINEAR2_3210_TICK(t)
+# define BFI_FLINEAR2_3209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3208, v ds
+# define BFI_FLINEAR2_3209_TICK(t)
+# define BFI_FLINEAR2_3208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3207, v ds
+# define BFI_FLINEAR2_3208_TICK(t)
+# define BFI_FLINEAR2_3207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3206, v ds
+# define BFI_FLINEAR2_3207_TICK(t)
+# define BFI_FLINEAR2_3206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3205, v ds
+# define BFI_FLINEAR2_3206_TICK(t)
+# define BFI_FLINEAR2_3205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3204, v ds
+# define BFI_FLINEAR2_3205_TICK(t)
+# define BFI_FLINEAR2_3204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3203, v ds
+# define BFI_FLINEAR2_3204_TICK(t)
+# define BFI_FLINEAR2_3203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3202, v ds
+# define BFI_FLINEAR2_3203_TICK(t)
+# define BFI_FLINEAR2_3202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3201, v ds
+# define BFI_FLINEAR2_3202_TICK(t)
+# define BFI_FLINEAR2_3201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3200, v ds
+# define BFI_FLINEAR2_3201_TICK(t)
+# define BFI_FLINEAR2_3200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3199, v ds
+# define BFI_FLINEAR2_3200_TICK(t)
+# define BFI_FLINEAR2_3199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3198, v ds
+# define BFI_FLINEAR2_3199_TICK(t)
+# define BFI_FLINEAR2_3198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3197, v ds
+# define BFI_FLINEAR2_3198_TICK(t)
+# define BFI_FLINEAR2_3197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3196, v ds
+# define BFI_FLINEAR2_3197_TICK(t)
+# define BFI_FLINEAR2_3196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3195, v ds
+# define BFI_FLINEAR2_3196_TICK(t)
+# define BFI_FLINEAR2_3195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3194, v ds
+# define BFI_FLINEAR2_3195_TICK(t)
+# define BFI_FLINEAR2_3194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3193, v ds
+# define BFI_FLINEAR2_3194_TICK(t)
+# define BFI_FLINEAR2_3193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3192, v ds
+# define BFI_FLINEAR2_3193_TICK(t)
+# define BFI_FLINEAR2_3192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3191, v ds
+# define BFI_FLINEAR2_3192_TICK(t)
+# define BFI_FLINEAR2_3191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3190, v ds
+# define BFI_FLINEAR2_3191_TICK(t)
+# define BFI_FLINEAR2_3190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3189, v ds
+# define BFI_FLINEAR2_3190_TICK(t)
+# define BFI_FLINEAR2_3189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3188, v ds
+# define BFI_FLINEAR2_3189_TICK(t)
+# define BFI_FLINEAR2_3188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3187, v ds
+# define BFI_FLINEAR2_3188_TICK(t)
+# define BFI_FLINEAR2_3187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3186, v ds
+# define BFI_FLINEAR2_3187_TICK(t)
+# define BFI_FLINEAR2_3186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3185, v ds
+# define BFI_FLINEAR2_3186_TICK(t)
+# define BFI_FLINEAR2_3185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3184, v ds
+# define BFI_FLINEAR2_3185_TICK(t)
+# define BFI_FLINEAR2_3184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3183, v ds
+# define BFI_FLINEAR2_3184_TICK(t)
+# define BFI_FLINEAR2_3183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3182, v ds
+# define BFI_FLINEAR2_3183_TICK(t)
+# define BFI_FLINEAR2_3182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3181, v ds
+# define BFI_FLINEAR2_3182_TICK(t)
+# define BFI_FLINEAR2_3181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3180, v ds
+# define BFI_FLINEAR2_3181_TICK(t)
+# define BFI_FLINEAR2_3180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3179, v ds
+# define BFI_FLINEAR2_3180_TICK(t)
+# define BFI_FLINEAR2_3179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3178, v ds
+# define BFI_FLINEAR2_3179_TICK(t)
+# define BFI_FLINEAR2_3178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3177, v ds
+# define BFI_FLINEAR2_3178_TICK(t)
+# define BFI_FLINEAR2_3177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3176, v ds
+# define BFI_FLINEAR2_3177_TICK(t)
+# define BFI_FLINEAR2_3176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3175, v ds
+# define BFI_FLINEAR2_3176_TICK(t)
+# define BFI_FLINEAR2_3175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3174, v ds
+# define BFI_FLINEAR2_3175_TICK(t)
+# define BFI_FLINEAR2_3174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3173, v ds
+# define BFI_FLINEAR2_3174_TICK(t)
+# define BFI_FLINEAR2_3173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3172, v ds
+# define BFI_FLINEAR2_3173_TICK(t)
+# define BFI_FLINEAR2_3172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3171, v ds
+# define BFI_FLINEAR2_3172_TICK(t)
+# define BFI_FLINEAR2_3171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3170, v ds
+# define BFI_FLINEAR2_3171_TICK(t)
+# define BFI_FLINEAR2_3170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3169, v ds
+# define BFI_FLINEAR2_3170_TICK(t)
+# define BFI_FLINEAR2_3169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3168, v ds
+# define BFI_FLINEAR2_3169_TICK(t)
+# define BFI_FLINEAR2_3168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3167, v ds
+# define BFI_FLINEAR2_3168_TICK(t)
+# define BFI_FLINEAR2_3167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3166, v ds
+# define BFI_FLINEAR2_3167_TICK(t)
+# define BFI_FLINEAR2_3166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3165, v ds
+# define BFI_FLINEAR2_3166_TICK(t)
+# define BFI_FLINEAR2_3165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3164, v ds
+# define BFI_FLINEAR2_3165_TICK(t)
+# define BFI_FLINEAR2_3164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3163, v ds
+# define BFI_FLINEAR2_3164_TICK(t)
+# define BFI_FLINEAR2_3163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3162, v ds
+# define BFI_FLINEAR2_3163_TICK(t)
+# define BFI_FLINEAR2_3162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3161, v ds
+# define BFI_FLINEAR2_3162_TICK(t)
+# define BFI_FLINEAR2_3161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3160, v ds
+# define BFI_FLINEAR2_3161_TICK(t)
+# define BFI_FLINEAR2_3160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3159, v ds
+# define BFI_FLINEAR2_3160_TICK(t)
+# define BFI_FLINEAR2_3159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3158, v ds
+# define BFI_FLINEAR2_3159_TICK(t)
+# define BFI_FLINEAR2_3158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3157, v ds
+# define BFI_FLINEAR2_3158_TICK(t)
+# define BFI_FLINEAR2_3157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3156, v ds
+# define BFI_FLINEAR2_3157_TICK(t)
+# define BFI_FLINEAR2_3156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3155, v ds
+# define BFI_FLINEAR2_3156_TICK(t)
+# define BFI_FLINEAR2_3155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3154, v ds
+# define BFI_FLINEAR2_3155_TICK(t)
+# define BFI_FLINEAR2_3154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3153, v ds
+# define BFI_FLINEAR2_3154_TICK(t)
+# define BFI_FLINEAR2_3153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3152, v ds
+# define BFI_FLINEAR2_3153_TICK(t)
+# define BFI_FLINEAR2_3152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3151, v ds
+# define BFI_FLINEAR2_3152_TICK(t)
+# define BFI_FLINEAR2_3151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3150, v ds
+# define BFI_FLINEAR2_3151_TICK(t)
+# define BFI_FLINEAR2_3150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3149, v ds
+# define BFI_FLINEAR2_3150_TICK(t)
+# define BFI_FLINEAR2_3149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3148, v ds
+# define BFI_FLINEAR2_3149_TICK(t)
+# define BFI_FLINEAR2_3148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3147, v ds
+# define BFI_FLINEAR2_3148_TICK(t)
+# define BFI_FLINEAR2_3147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3146, v ds
+# define BFI_FLINEAR2_3147_TICK(t)
+# define BFI_FLINEAR2_3146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3145, v ds
+# define BFI_FLINEAR2_3146_TICK(t)
+# define BFI_FLINEAR2_3145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3144, v ds
+# define BFI_FLINEAR2_3145_TICK(t)
+# define BFI_FLINEAR2_3144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3143, v ds
+# define BFI_FLINEAR2_3144_TICK(t)
+# define BFI_FLINEAR2_3143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3142, v ds
+# define BFI_FLINEAR2_3143_TICK(t)
+# define BFI_FLINEAR2_3142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3141, v ds
+# define BFI_FLINEAR2_3142_TICK(t)
+# define BFI_FLINEAR2_3141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3140, v ds
+# define BFI_FLINEAR2_3141_TICK(t)
+# define BFI_FLINEAR2_3140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3139, v ds
+# define BFI_FLINEAR2_3140_TICK(t)
+# define BFI_FLINEAR2_3139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3138, v ds
+# define BFI_FLINEAR2_3139_TICK(t)
+# define BFI_FLINEAR2_3138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3137, v ds
+# define BFI_FLINEAR2_3138_TICK(t)
+# define BFI_FLINEAR2_3137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3136, v ds
+# define BFI_FLINEAR2_3137_TICK(t)
+# define BFI_FLINEAR2_3136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3135, v ds
+# define BFI_FLINEAR2_3136_TICK(t)
+# define BFI_FLINEAR2_3135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3134, v ds
+# define BFI_FLINEAR2_3135_TICK(t)
+# define BFI_FLINEAR2_3134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3133, v ds
+# define BFI_FLINEAR2_3134_TICK(t)
+# define BFI_FLINEAR2_3133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3132, v ds
+# define BFI_FLINEAR2_3133_TICK(t)
+# define BFI_FLINEAR2_3132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3131, v ds
+# define BFI_FLINEAR2_3132_TICK(t)
+# define BFI_FLINEAR2_3131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3130, v ds
+# define BFI_FLINEAR2_3131_TICK(t)
+# define BFI_FLINEAR2_3130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3129, v ds
+# define BFI_FLINEAR2_3130_TICK(t)
+# define BFI_FLINEAR2_3129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3128, v ds
+# define BFI_FLINEAR2_3129_TICK(t)
+# define BFI_FLINEAR2_3128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3127, v ds
+# define BFI_FLINEAR2_3128_TICK(t)
+# define BFI_FLINEAR2_3127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3126, v ds
+# define BFI_FLINEAR2_3127_TICK(t)
+# define BFI_FLINEAR2_3126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3125, v ds
+# define BFI_FLINEAR2_3126_TICK(t)
+# define BFI_FLINEAR2_3125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3124, v ds
+# define BFI_FLINEAR2_3125_TICK(t)
+# define BFI_FLINEAR2_3124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3123, v ds
+# define BFI_FLINEAR2_3124_TICK(t)
+# define BFI_FLINEAR2_3123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3122, v ds
+# define BFI_FLINEAR2_3123_TICK(t)
+# define BFI_FLINEAR2_3122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3121, v ds
+# define BFI_FLINEAR2_3122_TICK(t)
+# define BFI_FLINEAR2_3121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3120, v ds
+# define BFI_FLINEAR2_3121_TICK(t)
+# define BFI_FLINEAR2_3120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3119, v ds
+# define BFI_FLINEAR2_3120_TICK(t)
+# define BFI_FLINEAR2_3119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3118, v ds
+# define BFI_FLINEAR2_3119_TICK(t)
+# define BFI_FLINEAR2_3118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3117, v ds
+# define BFI_FLINEAR2_3118_TICK(t)
+# define BFI_FLINEAR2_3117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3116, v ds
+# define BFI_FLINEAR2_3117_TICK(t)
+# define BFI_FLINEAR2_3116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3115, v ds
+# define BFI_FLINEAR2_3116_TICK(t)
+# define BFI_FLINEAR2_3115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3114, v ds
+# define BFI_FLINEAR2_3115_TICK(t)
+# define BFI_FLINEAR2_3114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3113, v ds
+# define BFI_FLINEAR2_3114_TICK(t)
+# define BFI_FLINEAR2_3113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3112, v ds
+# define BFI_FLINEAR2_3113_TICK(t)
+# define BFI_FLINEAR2_3112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3111, v ds
+# define BFI_FLINEAR2_3112_TICK(t)
+# define BFI_FLINEAR2_3111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3110, v ds
+# define BFI_FLINEAR2_3111_TICK(t)
+# define BFI_FLINEAR2_3110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3109, v ds
+# define BFI_FLINEAR2_3110_TICK(t)
+# define BFI_FLINEAR2_3109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3108, v ds
+# define BFI_FLINEAR2_3109_TICK(t)
+# define BFI_FLINEAR2_3108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3107, v ds
+# define BFI_FLINEAR2_3108_TICK(t)
+# define BFI_FLINEAR2_3107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3106, v ds
+# define BFI_FLINEAR2_3107_TICK(t)
+# define BFI_FLINEAR2_3106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3105, v ds
+# define BFI_FLINEAR2_3106_TICK(t)
+# define BFI_FLINEAR2_3105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3104, v ds
+# define BFI_FLINEAR2_3105_TICK(t)
+# define BFI_FLINEAR2_3104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3103, v ds
+# define BFI_FLINEAR2_3104_TICK(t)
+# define BFI_FLINEAR2_3103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3102, v ds
+# define BFI_FLINEAR2_3103_TICK(t)
+# define BFI_FLINEAR2_3102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3101, v ds
+# define BFI_FLINEAR2_3102_TICK(t)
+# define BFI_FLINEAR2_3101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3100, v ds
+# define BFI_FLINEAR2_3101_TICK(t)
+# define BFI_FLINEAR2_3100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3099, v ds
+# define BFI_FLINEAR2_3100_TICK(t)
+# define BFI_FLINEAR2_3099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3098, v ds
+# define BFI_FLINEAR2_3099_TICK(t)
+# define BFI_FLINEAR2_3098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3097, v ds
+# define BFI_FLINEAR2_3098_TICK(t)
+# define BFI_FLINEAR2_3097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3096, v ds
+# define BFI_FLINEAR2_3097_TICK(t)
+# define BFI_FLINEAR2_3096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3095, v ds
+# define BFI_FLINEAR2_3096_TICK(t)
+# define BFI_FLINEAR2_3095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3094, v ds
+# define BFI_FLINEAR2_3095_TICK(t)
+# define BFI_FLINEAR2_3094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3093, v ds
+# define BFI_FLINEAR2_3094_TICK(t)
+# define BFI_FLINEAR2_3093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3092, v ds
+# define BFI_FLINEAR2_3093_TICK(t)
+# define BFI_FLINEAR2_3092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3091, v ds
+# define BFI_FLINEAR2_3092_TICK(t)
+# define BFI_FLINEAR2_3091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3090, v ds
+# define BFI_FLINEAR2_3091_TICK(t)
+# define BFI_FLINEAR2_3090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3089, v ds
+# define BFI_FLINEAR2_3090_TICK(t)
+# define BFI_FLINEAR2_3089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3088, v ds
+# define BFI_FLINEAR2_3089_TICK(t)
+# define BFI_FLINEAR2_3088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3087, v ds
+# define BFI_FLINEAR2_3088_TICK(t)
+# define BFI_FLINEAR2_3087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3086, v ds
+# define BFI_FLINEAR2_3087_TICK(t)
+# define BFI_FLINEAR2_3086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3085, v ds
+# define BFI_FLINEAR2_3086_TICK(t)
+# define BFI_FLINEAR2_3085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3084, v ds
+# define BFI_FLINEAR2_3085_TICK(t)
+# define BFI_FLINEAR2_3084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3083, v ds
+# define BFI_FLINEAR2_3084_TICK(t)
+# define BFI_FLINEAR2_3083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3082, v ds
+# define BFI_FLINEAR2_3083_TICK(t)
+# define BFI_FLINEAR2_3082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3081, v ds
+# define BFI_FLINEAR2_3082_TICK(t)
+# define BFI_FLINEAR2_3081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3080, v ds
+# define BFI_FLINEAR2_3081_TICK(t)
+# define BFI_FLINEAR2_3080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3079, v ds
+# define BFI_FLINEAR2_3080_TICK(t)
+# define BFI_FLINEAR2_3079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3078, v ds
+# define BFI_FLINEAR2_3079_TICK(t)
+# define BFI_FLINEAR2_3078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3077, v ds
+# define BFI_FLINEAR2_3078_TICK(t)
+# define BFI_FLINEAR2_3077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3076, v ds
+# define BFI_FLINEAR2_3077_TICK(t)
+# define BFI_FLINEAR2_3076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3075, v ds
+# define BFI_FLINEAR2_3076_TICK(t)
+# define BFI_FLINEAR2_3075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3074, v ds
+# define BFI_FLINEAR2_3075_TICK(t)
+# define BFI_FLINEAR2_3074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3073, v ds
+# define BFI_FLINEAR2_3074_TICK(t)
+# define BFI_FLINEAR2_3073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3072, v ds
+# define BFI_FLINEAR2_3073_TICK(t)
+# define BFI_FLINEAR2_3072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3071, v ds
+# define BFI_FLINEAR2_3072_TICK(t)
+# define BFI_FLINEAR2_3071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3070, v ds
+# define BFI_FLINEAR2_3071_TICK(t)
+# define BFI_FLINEAR2_3070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3069, v ds
+# define BFI_FLINEAR2_3070_TICK(t)
+# define BFI_FLINEAR2_3069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3068, v ds
+# define BFI_FLINEAR2_3069_TICK(t)
+# define BFI_FLINEAR2_3068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3067, v ds
+# define BFI_FLINEAR2_3068_TICK(t)
+# define BFI_FLINEAR2_3067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3066, v ds
+# define BFI_FLINEAR2_3067_TICK(t)
+# define BFI_FLINEAR2_3066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3065, v ds
+# define BFI_FLINEAR2_3066_TICK(t)
+# define BFI_FLINEAR2_3065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3064, v ds
+# define BFI_FLINEAR2_3065_TICK(t)
+# define BFI_FLINEAR2_3064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3063, v ds
+# define BFI_FLINEAR2_3064_TICK(t)
+# define BFI_FLINEAR2_3063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3062, v ds
+# define BFI_FLINEAR2_3063_TICK(t)
+# define BFI_FLINEAR2_3062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3061, v ds
+# define BFI_FLINEAR2_3062_TICK(t)
+# define BFI_FLINEAR2_3061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3060, v ds
+# define BFI_FLINEAR2_3061_TICK(t)
+# define BFI_FLINEAR2_3060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3059, v ds
+# define BFI_FLINEAR2_3060_TICK(t)
+# define BFI_FLINEAR2_3059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3058, v ds
+# define BFI_FLINEAR2_3059_TICK(t)
+# define BFI_FLINEAR2_3058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3057, v ds
+# define BFI_FLINEAR2_3058_TICK(t)
+# define BFI_FLINEAR2_3057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3056, v ds
+# define BFI_FLINEAR2_3057_TICK(t)
+# define BFI_FLINEAR2_3056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3055, v ds
+# define BFI_FLINEAR2_3056_TICK(t)
+# define BFI_FLINEAR2_3055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3054, v ds
+# define BFI_FLINEAR2_3055_TICK(t)
+# define BFI_FLINEAR2_3054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3053, v ds
+# define BFI_FLINEAR2_3054_TICK(t)
+# define BFI_FLINEAR2_3053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3052, v ds
+# define BFI_FLINEAR2_3053_TICK(t)
+# define BFI_FLINEAR2_3052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3051, v ds
+# define BFI_FLINEAR2_3052_TICK(t)
+# define BFI_FLINEAR2_3051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3050, v ds
+# define BFI_FLINEAR2_3051_TICK(t)
+# define BFI_FLINEAR2_3050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3049, v ds
+# define BFI_FLINEAR2_3050_TICK(t)
+# define BFI_FLINEAR2_3049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3048, v ds
+# define BFI_FLINEAR2_3049_TICK(t)
+# define BFI_FLINEAR2_3048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3047, v ds
+# define BFI_FLINEAR2_3048_TICK(t)
+# define BFI_FLINEAR2_3047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3046, v ds
+# define BFI_FLINEAR2_3047_TICK(t)
+# define BFI_FLINEAR2_3046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3045, v ds
+# define BFI_FLINEAR2_3046_TICK(t)
+# define BFI_FLINEAR2_3045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3044, v ds
+# define BFI_FLINEAR2_3045_TICK(t)
+# define BFI_FLINEAR2_3044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3043, v ds
+# define BFI_FLINEAR2_3044_TICK(t)
+# define BFI_FLINEAR2_3043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3042, v ds
+# define BFI_FLINEAR2_3043_TICK(t)
+# define BFI_FLINEAR2_3042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3041, v ds
+# define BFI_FLINEAR2_3042_TICK(t)
+# define BFI_FLINEAR2_3041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3040, v ds
+# define BFI_FLINEAR2_3041_TICK(t)
+# define BFI_FLINEAR2_3040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3039, v ds
+# define BFI_FLINEAR2_3040_TICK(t)
+# define BFI_FLINEAR2_3039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3038, v ds
+# define BFI_FLINEAR2_3039_TICK(t)
+# define BFI_FLINEAR2_3038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3037, v ds
+# define BFI_FLINEAR2_3038_TICK(t)
+# define BFI_FLINEAR2_3037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3036, v ds
+# define BFI_FLINEAR2_3037_TICK(t)
+# define BFI_FLINEAR2_3036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3035, v ds
+# define BFI_FLINEAR2_3036_TICK(t)
+# define BFI_FLINEAR2_3035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3034, v ds
+# define BFI_FLINEAR2_3035_TICK(t)
+# define BFI_FLINEAR2_3034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3033, v ds
+# define BFI_FLINEAR2_3034_TICK(t)
+# define BFI_FLINEAR2_3033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3032, v ds
+# define BFI_FLINEAR2_3033_TICK(t)
+# define BFI_FLINEAR2_3032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3031, v ds
+# define BFI_FLINEAR2_3032_TICK(t)
+# define BFI_FLINEAR2_3031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3030, v ds
+# define BFI_FLINEAR2_3031_TICK(t)
+# define BFI_FLINEAR2_3030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3029, v ds
+# define BFI_FLINEAR2_3030_TICK(t)
+# define BFI_FLINEAR2_3029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3028, v ds
+# define BFI_FLINEAR2_3029_TICK(t)
+# define BFI_FLINEAR2_3028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3027, v ds
+# define BFI_FLINEAR2_3028_TICK(t)
+# define BFI_FLINEAR2_3027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3026, v ds
+# define BFI_FLINEAR2_3027_TICK(t)
+# define BFI_FLINEAR2_3026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3025, v ds
+# define BFI_FLINEAR2_3026_TICK(t)
+# define BFI_FLINEAR2_3025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3024, v ds
+# define BFI_FLINEAR2_3025_TICK(t)
+# define BFI_FLINEAR2_3024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3023, v ds
+# define BFI_FLINEAR2_3024_TICK(t)
+# define BFI_FLINEAR2_3023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3022, v ds
+# define BFI_FLINEAR2_3023_TICK(t)
+# define BFI_FLINEAR2_3022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3021, v ds
+# define BFI_FLINEAR2_3022_TICK(t)
+# define BFI_FLINEAR2_3021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3020, v ds
+# define BFI_FLINEAR2_3021_TICK(t)
+# define BFI_FLINEAR2_3020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3019, v ds
+# define BFI_FLINEAR2_3020_TICK(t)
+# define BFI_FLINEAR2_3019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3018, v ds
+# define BFI_FLINEAR2_3019_TICK(t)
+# define BFI_FLINEAR2_3018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3017, v ds
+# define BFI_FLINEAR2_3018_TICK(t)
+# define BFI_FLINEAR2_3017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3016, v ds
+# define BFI_FLINEAR2_3017_TICK(t)
+# define BFI_FLINEAR2_3016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3015, v ds
+# define BFI_FLINEAR2_3016_TICK(t)
+# define BFI_FLINEAR2_3015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3014, v ds
+# define BFI_FLINEAR2_3015_TICK(t)
+# define BFI_FLINEAR2_3014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3013, v ds
+# define BFI_FLINEAR2_3014_TICK(t)
+# define BFI_FLINEAR2_3013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3012, v ds
+# define BFI_FLINEAR2_3013_TICK(t)
+# define BFI_FLINEAR2_3012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3011, v ds
+# define BFI_FLINEAR2_3012_TICK(t)
+# define BFI_FLINEAR2_3011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3010, v ds
+# define BFI_FLINEAR2_3011_TICK(t)
+# define BFI_FLINEAR2_3010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3009, v ds
+# define BFI_FLINEAR2_3010_TICK(t)
+# define BFI_FLINEAR2_3009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3008, v ds
+# define BFI_FLINEAR2_3009_TICK(t)
+# define BFI_FLINEAR2_3008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3007, v ds
+# define BFI_FLINEAR2_3008_TICK(t)
+# define BFI_FLINEAR2_3007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3006, v ds
+# define BFI_FLINEAR2_3007_TICK(t)
+# define BFI_FLINEAR2_3006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3005, v ds
+# define BFI_FLINEAR2_3006_TICK(t)
+# define BFI_FLINEAR2_3005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3004, v ds
+# define BFI_FLINEAR2_3005_TICK(t)
+# define BFI_FLINEAR2_3004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3003, v ds
+# define BFI_FLINEAR2_3004_TICK(t)
+# define BFI_FLINEAR2_3003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3002, v ds
+# define BFI_FLINEAR2_3003_TICK(t)
+# define BFI_FLINEAR2_3002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3001, v ds
+# define BFI_FLINEAR2_3002_TICK(t)
+# define BFI_FLINEAR2_3001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3000, v ds
+# define BFI_FLINEAR2_3001_TICK(t)
+# define BFI_FLINEAR2_3000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2999, v ds
+# define BFI_FLINEAR2_3000_TICK(t)
+# define BFI_FLINEAR2_2999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2998, v ds
+# define BFI_FLINEAR2_2999_TICK(t)
+# define BFI_FLINEAR2_2998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2997, v ds
+# define BFI_FLINEAR2_2998_TICK(t)
+# define BFI_FLINEAR2_2997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2996, v ds
+# define BFI_FLINEAR2_2997_TICK(t)
+# define BFI_FLINEAR2_2996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2995, v ds
+# define BFI_FLINEAR2_2996_TICK(t)
+# define BFI_FLINEAR2_2995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2994, v ds
+# define BFI_FLINEAR2_2995_TICK(t)
+# define BFI_FLINEAR2_2994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2993, v ds
+# define BFI_FLINEAR2_2994_TICK(t)
+# define BFI_FLINEAR2_2993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2992, v ds
+# define BFI_FLINEAR2_2993_TICK(t)
+# define BFI_FLINEAR2_2992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2991, v ds
+# define BFI_FLINEAR2_2992_TICK(t)
+# define BFI_FLINEAR2_2991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2990, v ds
+# define BFI_FLINEAR2_2991_TICK(t)
+# define BFI_FLINEAR2_2990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2989, v ds
+# define BFI_FLINEAR2_2990_TICK(t)
+# define BFI_FLINEAR2_2989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2988, v ds
+# define BFI_FLINEAR2_2989_TICK(t)
+# define BFI_FLINEAR2_2988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2987, v ds
+# define BFI_FLINEAR2_2988_TICK(t)
+# define BFI_FLINEAR2_2987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2986, v ds
+# define BFI_FLINEAR2_2987_TICK(t)
+# define BFI_FLINEAR2_2986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2985, v ds
+# define BFI_FLINEAR2_2986_TICK(t)
+# define BFI_FLINEAR2_2985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2984, v ds
+# define BFI_FLINEAR2_2985_TICK(t)
+# define BFI_FLINEAR2_2984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2983, v ds
+# define BFI_FLINEAR2_2984_TICK(t)
+# define BFI_FLINEAR2_2983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2982, v ds
+# define BFI_FLINEAR2_2983_TICK(t)
+# define BFI_FLINEAR2_2982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2981, v ds
+# define BFI_FLINEAR2_2982_TICK(t)
+# define BFI_FLINEAR2_2981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2980, v ds
+# define BFI_FLINEAR2_2981_TICK(t)
+# define BFI_FLINEAR2_2980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2979, v ds
+# define BFI_FLINEAR2_2980_TICK(t)
+# define BFI_FLINEAR2_2979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2978, v ds
+# define BFI_FLINEAR2_2979_TICK(t)
+# define BFI_FLINEAR2_2978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2977, v ds
+# define BFI_FLINEAR2_2978_TICK(t)
+# define BFI_FLINEAR2_2977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2976, v ds
+# define BFI_FLINEAR2_2977_TICK(t)
+# define BFI_FLINEAR2_2976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2975, v ds
+# define BFI_FLINEAR2_2976_TICK(t)
+# define BFI_FLINEAR2_2975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2974, v ds
+# define BFI_FLINEAR2_2975_TICK(t)
+# define BFI_FLINEAR2_2974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2973, v ds
+# define BFI_FLINEAR2_2974_TICK(t)
+# define BFI_FLINEAR2_2973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2972, v ds
+# define BFI_FLINEAR2_2973_TICK(t)
+# define BFI_FLINEAR2_2972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2971, v ds
+# define BFI_FLINEAR2_2972_TICK(t)
+# define BFI_FLINEAR2_2971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2970, v ds
+# define BFI_FLINEAR2_2971_TICK(t)
+# define BFI_FLINEAR2_2970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2969, v ds
+# define BFI_FLINEAR2_2970_TICK(t)
+# define BFI_FLINEAR2_2969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2968, v ds
+# define BFI_FLINEAR2_2969_TICK(t)
+# define BFI_FLINEAR2_2968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2967, v ds
+# define BFI_FLINEAR2_2968_TICK(t)
+# define BFI_FLINEAR2_2967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2966, v ds
+# define BFI_FLINEAR2_2967_TICK(t)
+# define BFI_FLINEAR2_2966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2965, v ds
+# define BFI_FLINEAR2_2966_TICK(t)
+# define BFI_FLINEAR2_2965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2964, v ds
+# define BFI_FLINEAR2_2965_TICK(t)
+# define BFI_FLINEAR2_2964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2963, v ds
+# define BFI_FLINEAR2_2964_TICK(t)
+# define BFI_FLINEAR2_2963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2962, v ds
+# define BFI_FLINEAR2_2963_TICK(t)
+# define BFI_FLINEAR2_2962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2961, v ds
+# define BFI_FLINEAR2_2962_TICK(t)
+# define BFI_FLINEAR2_2961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2960, v ds
+# define BFI_FLINEAR2_2961_TICK(t)
+# define BFI_FLINEAR2_2960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2959, v ds
+# define BFI_FLINEAR2_2960_TICK(t)
+# define BFI_FLINEAR2_2959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2958, v ds
+# define BFI_FLINEAR2_2959_TICK(t)
+# define BFI_FLINEAR2_2958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2957, v ds
+# define BFI_FLINEAR2_2958_TICK(t)
+# define BFI_FLINEAR2_2957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2956, v ds
+# define BFI_FLINEAR2_2957_TICK(t)
+# define BFI_FLINEAR2_2956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2955, v ds
+# define BFI_FLINEAR2_2956_TICK(t)
+# define BFI_FLINEAR2_2955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2954, v ds
+# define BFI_FLINEAR2_2955_TICK(t)
+# define BFI_FLINEAR2_2954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2953, v ds
+# define BFI_FLINEAR2_2954_TICK(t)
+# define BFI_FLINEAR2_2953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2952, v ds
+# define BFI_FLINEAR2_2953_TICK(t)
+# define BFI_FLINEAR2_2952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2951, v ds
+# define BFI_FLINEAR2_2952_TICK(t)
+# define BFI_FLINEAR2_2951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2950, v ds
+# define BFI_FLINEAR2_2951_TICK(t)
+# define BFI_FLINEAR2_2950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2949, v ds
+# define BFI_FLINEAR2_2950_TICK(t)
+# define BFI_FLINEAR2_2949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2948, v ds
+# define BFI_FLINEAR2_2949_TICK(t)
+# define BFI_FLINEAR2_2948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2947, v ds
+# define BFI_FLINEAR2_2948_TICK(t)
+# define BFI_FLINEAR2_2947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2946, v ds
+# define BFI_FLINEAR2_2947_TICK(t)
+# define BFI_FLINEAR2_2946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2945, v ds
+# define BFI_FLINEAR2_2946_TICK(t)
+# define BFI_FLINEAR2_2945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2944, v ds
+# define BFI_FLINEAR2_2945_TICK(t)
+# define BFI_FLINEAR2_2944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2943, v ds
+# define BFI_FLINEAR2_2944_TICK(t)
+# define BFI_FLINEAR2_2943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2942, v ds
+# define BFI_FLINEAR2_2943_TICK(t)
+# define BFI_FLINEAR2_2942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2941, v ds
+# define BFI_FLINEAR2_2942_TICK(t)
+# define BFI_FLINEAR2_2941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2940, v ds
+# define BFI_FLINEAR2_2941_TICK(t)
+# define BFI_FLINEAR2_2940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2939, v ds
+# define BFI_FLINEAR2_2940_TICK(t)
+# define BFI_FLINEAR2_2939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2938, v ds
+# define BFI_FLINEAR2_2939_TICK(t)
+# define BFI_FLINEAR2_2938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2937, v ds
+# define BFI_FLINEAR2_2938_TICK(t)
+# define BFI_FLINEAR2_2937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2936, v ds
+# define BFI_FLINEAR2_2937_TICK(t)
+# define BFI_FLINEAR2_2936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2935, v ds
+# define BFI_FLINEAR2_2936_TICK(t)
+# define BFI_FLINEAR2_2935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2934, v ds
+# define BFI_FLINEAR2_2935_TICK(t)
+# define BFI_FLINEAR2_2934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2933, v ds
+# define BFI_FLINEAR2_2934_TICK(t)
+# define BFI_FLINEAR2_2933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2932, v ds
+# define BFI_FLINEAR2_2933_TICK(t)
+# define BFI_FLINEAR2_2932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2931, v ds
+# define BFI_FLINEAR2_2932_TICK(t)
+# define BFI_FLINEAR2_2931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2930, v ds
+# define BFI_FLINEAR2_2931_TICK(t)
+# define BFI_FLINEAR2_2930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2929, v ds
+# define BFI_FLINEAR2_2930_TICK(t)
+# define BFI_FLINEAR2_2929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2928, v ds
+# define BFI_FLINEAR2_2929_TICK(t)
+# define BFI_FLINEAR2_2928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2927, v ds
+# define BFI_FLINEAR2_2928_TICK(t)
+# define BFI_FLINEAR2_2927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2926, v ds
+# define BFI_FLINEAR2_2927_TICK(t)
+# define BFI_FLINEAR2_2926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2925, v ds
+# define BFI_FLINEAR2_2926_TICK(t)
+# define BFI_FLINEAR2_2925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2924, v ds
+# define BFI_FLINEAR2_2925_TICK(t)
+# define BFI_FLINEAR2_2924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2923, v ds
+# define BFI_FLINEAR2_2924_TICK(t)
+# define BFI_FLINEAR2_2923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2922, v ds
+# define BFI_FLINEAR2_2923_TICK(t)
+# define BFI_FLINEAR2_2922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2921, v ds
+# define BFI_FLINEAR2_2922_TICK(t)
+# define BFI_FLINEAR2_2921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2920, v ds
+# define BFI_FLINEAR2_2921_TICK(t)
+# define BFI_FLINEAR2_2920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2919, v ds
+# define BFI_FLINEAR2_2920_TICK(t)
+# define BFI_FLINEAR2_2919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2918, v ds
+# define BFI_FLINEAR2_2919_TICK(t)
+# define BFI_FLINEAR2_2918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2917, v ds
+# define BFI_FLINEAR2_2918_TICK(t)
+# define BFI_FLINEAR2_2917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2916, v ds
+# define BFI_FLINEAR2_2917_TICK(t)
+# define BFI_FLINEAR2_2916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2915, v ds
+# define BFI_FLINEAR2_2916_TICK(t)
+# define BFI_FLINEAR2_2915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2914, v ds
+# define BFI_FLINEAR2_2915_TICK(t)
+# define BFI_FLINEAR2_2914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2913, v ds
+# define BFI_FLINEAR2_2914_TICK(t)
+# define BFI_FLINEAR2_2913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2912, v ds
+# define BFI_FLINEAR2_2913_TICK(t)
+# define BFI_FLINEAR2_2912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2911, v ds
+# define BFI_FLINEAR2_2912_TICK(t)
+# define BFI_FLINEAR2_2911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2910, v ds
+# define BFI_FLINEAR2_2911_TICK(t)
+# define BFI_FLINEAR2_2910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2909, v ds
+# define BFI_FLINEAR2_2910_TICK(t)
+# define BFI_FLINEAR2_2909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2908, v ds
+# define BFI_FLINEAR2_2909_TICK(t)
+# define BFI_FLINEAR2_2908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2907, v ds
+# define BFI_FLINEAR2_2908_TICK(t)
+# define BFI_FLINEAR2_2907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2906, v ds
+# define BFI_FLINEAR2_2907_TICK(t)
+# define BFI_FLINEAR2_2906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2905, v ds
+# define BFI_FLINEAR2_2906_TICK(t)
+# define BFI_FLINEAR2_2905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2904, v ds
+# define BFI_FLINEAR2_2905_TICK(t)
+# define BFI_FLINEAR2_2904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2903, v ds
+# define BFI_FLINEAR2_2904_TICK(t)
+# define BFI_FLINEAR2_2903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2902, v ds
+# define BFI_FLINEAR2_2903_TICK(t)
+# define BFI_FLINEAR2_2902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2901, v ds
+# define BFI_FLINEAR2_2902_TICK(t)
+# define BFI_FLINEAR2_2901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2900, v ds
+# define BFI_FLINEAR2_2901_TICK(t)
+# define BFI_FLINEAR2_2900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2899, v ds
+# define BFI_FLINEAR2_2900_TICK(t)
+# define BFI_FLINEAR2_2899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2898, v ds
+# define BFI_FLINEAR2_2899_TICK(t)
+# define BFI_FLINEAR2_2898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2897, v ds
+# define BFI_FLINEAR2_2898_TICK(t)
+# define BFI_FLINEAR2_2897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2896, v ds
+# define BFI_FLINEAR2_2897_TICK(t)
+# define BFI_FLINEAR2_2896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2895, v ds
+# define BFI_FLINEAR2_2896_TICK(t)
+# define BFI_FLINEAR2_2895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2894, v ds
+# define BFI_FLINEAR2_2895_TICK(t)
+# define BFI_FLINEAR2_2894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2893, v ds
+# define BFI_FLINEAR2_2894_TICK(t)
+# define BFI_FLINEAR2_2893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2892, v ds
+# define BFI_FLINEAR2_2893_TICK(t)
+# define BFI_FLINEAR2_2892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2891, v ds
+# define BFI_FLINEAR2_2892_TICK(t)
+# define BFI_FLINEAR2_2891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2890, v ds
+# define BFI_FLINEAR2_2891_TICK(t)
+# define BFI_FLINEAR2_2890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2889, v ds
+# define BFI_FLINEAR2_2890_TICK(t)
+# define BFI_FLINEAR2_2889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2888, v ds
+# define BFI_FLINEAR2_2889_TICK(t)
+# define BFI_FLINEAR2_2888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2887, v ds
+# define BFI_FLINEAR2_2888_TICK(t)
+# define BFI_FLINEAR2_2887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2886, v ds
+# define BFI_FLINEAR2_2887_TICK(t)
+# define BFI_FLINEAR2_2886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2885, v ds
+# define BFI_FLINEAR2_2886_TICK(t)
+# define BFI_FLINEAR2_2885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2884, v ds
+# define BFI_FLINEAR2_2885_TICK(t)
+# define BFI_FLINEAR2_2884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2883, v ds
+# define BFI_FLINEAR2_2884_TICK(t)
+# define BFI_FLINEAR2_2883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2882, v ds
+# define BFI_FLINEAR2_2883_TICK(t)
+# define BFI_FLINEAR2_2882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2881, v ds
+# define BFI_FLINEAR2_2882_TICK(t)
+# define BFI_FLINEAR2_2881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2880, v ds
+# define BFI_FLINEAR2_2881_TICK(t)
+# define BFI_FLINEAR2_2880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2879, v ds
+# define BFI_FLINEAR2_2880_TICK(t)
+# define BFI_FLINEAR2_2879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2878, v ds
+# define BFI_FLINEAR2_2879_TICK(t)
+# define BFI_FLINEAR2_2878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2877, v ds
+# define BFI_FLINEAR2_2878_TICK(t)
+# define BFI_FLINEAR2_2877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2876, v ds
+# define BFI_FLINEAR2_2877_TICK(t)
+# define BFI_FLINEAR2_2876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2875, v ds
+# define BFI_FLINEAR2_2876_TICK(t)
+# define BFI_FLINEAR2_2875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2874, v ds
+# define BFI_FLINEAR2_2875_TICK(t)
+# define BFI_FLINEAR2_2874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2873, v ds
+# define BFI_FLINEAR2_2874_TICK(t)
+# define BFI_FLINEAR2_2873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2872, v ds
+# define BFI_FLINEAR2_2873_TICK(t)
+# define BFI_FLINEAR2_2872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2871, v ds
+# define BFI_FLINEAR2_2872_TICK(t)
+# define BFI_FLINEAR2_2871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2870, v ds
+# define BFI_FLINEAR2_2871_TICK(t)
+# define BFI_FLINEAR2_2870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2869, v ds
+# define BFI_FLINEAR2_2870_TICK(t)
+# define BFI_FLINEAR2_2869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2868, v ds
+# define BFI_FLINEAR2_2869_TICK(t)
+# define BFI_FLINEAR2_2868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2867, v ds
+# define BFI_FLINEAR2_2868_TICK(t)
+# define BFI_FLINEAR2_2867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2866, v ds
+# define BFI_FLINEAR2_2867_TICK(t)
+# define BFI_FLINEAR2_2866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2865, v ds
+# define BFI_FLINEAR2_2866_TICK(t)
+# define BFI_FLINEAR2_2865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2864, v ds
+# define BFI_FLINEAR2_2865_TICK(t)
+# define BFI_FLINEAR2_2864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2863, v ds
+# define BFI_FLINEAR2_2864_TICK(t)
+# define BFI_FLINEAR2_2863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2862, v ds
+# define BFI_FLINEAR2_2863_TICK(t)
+# define BFI_FLINEAR2_2862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2861, v ds
+# define BFI_FLINEAR2_2862_TICK(t)
+# define BFI_FLINEAR2_2861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2860, v ds
+# define BFI_FLINEAR2_2861_TICK(t)
+# define BFI_FLINEAR2_2860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2859, v ds
+# define BFI_FLINEAR2_2860_TICK(t)
+# define BFI_FLINEAR2_2859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2858, v ds
+# define BFI_FLINEAR2_2859_TICK(t)
+# define BFI_FLINEAR2_2858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2857, v ds
+# define BFI_FLINEAR2_2858_TICK(t)
+# define BFI_FLINEAR2_2857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2856, v ds
+# define BFI_FLINEAR2_2857_TICK(t)
+# define BFI_FLINEAR2_2856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2855, v ds
+# define BFI_FLINEAR2_2856_TICK(t)
+# define BFI_FLINEAR2_2855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2854, v ds
+# define BFI_FLINEAR2_2855_TICK(t)
+# define BFI_FLINEAR2_2854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2853, v ds
+# define BFI_FLINEAR2_2854_TICK(t)
+# define BFI_FLINEAR2_2853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2852, v ds
+# define BFI_FLINEAR2_2853_TICK(t)
+# define BFI_FLINEAR2_2852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2851, v ds
+# define BFI_FLINEAR2_2852_TICK(t)
+# define BFI_FLINEAR2_2851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2850, v ds
+# define BFI_FLINEAR2_2851_TICK(t)
+# define BFI_FLINEAR2_2850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2849, v ds
+# define BFI_FLINEAR2_2850_TICK(t)
+# define BFI_FLINEAR2_2849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2848, v ds
+# define BFI_FLINEAR2_2849_TICK(t)
+# define BFI_FLINEAR2_2848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2847, v ds
+# define BFI_FLINEAR2_2848_TICK(t)
+# define BFI_FLINEAR2_2847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2846, v ds
+# define BFI_FLINEAR2_2847_TICK(t)
+# define BFI_FLINEAR2_2846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2845, v ds
+# define BFI_FLINEAR2_2846_TICK(t)
+# define BFI_FLINEAR2_2845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2844, v ds
+# define BFI_FLINEAR2_2845_TICK(t)
+# define BFI_FLINEAR2_2844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2843, v ds
+# define BFI_FLINEAR2_2844_TICK(t)
+# define BFI_FLINEAR2_2843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2842, v ds
+# define BFI_FLINEAR2_2843_TICK(t)
+# define BFI_FLINEAR2_2842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2841, v ds
+# define BFI_FLINEAR2_2842_TICK(t)
+# define BFI_FLINEAR2_2841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2840, v ds
+# define BFI_FLINEAR2_2841_TICK(t)
+# define BFI_FLINEAR2_2840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2839, v ds
+# define BFI_FLINEAR2_2840_TICK(t)
+# define BFI_FLINEAR2_2839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2838, v ds
+# define BFI_FLINEAR2_2839_TICK(t)
+# define BFI_FLINEAR2_2838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2837, v ds
+# define BFI_FLINEAR2_2838_TICK(t)
+# define BFI_FLINEAR2_2837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2836, v ds
+# define BFI_FLINEAR2_2837_TICK(t)
+# define BFI_FLINEAR2_2836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2835, v ds
+# define BFI_FLINEAR2_2836_TICK(t)
+# define BFI_FLINEAR2_2835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2834, v ds
+# define BFI_FLINEAR2_2835_TICK(t)
+# define BFI_FLINEAR2_2834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2833, v ds
+# define BFI_FLINEAR2_2834_TICK(t)
+# define BFI_FLINEAR2_2833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2832, v ds
+# define BFI_FLINEAR2_2833_TICK(t)
+# define BFI_FLINEAR2_2832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2831, v ds
+# define BFI_FLINEAR2_2832_TICK(t)
+# define BFI_FLINEAR2_2831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2830, v ds
+# define BFI_FLINEAR2_2831_TICK(t)
+# define BFI_FLINEAR2_2830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2829, v ds
+# define BFI_FLINEAR2_2830_TICK(t)
+# define BFI_FLINEAR2_2829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2828, v ds
+# define BFI_FLINEAR2_2829_TICK(t)
+# define BFI_FLINEAR2_2828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2827, v ds
+# define BFI_FLINEAR2_2828_TICK(t)
+# define BFI_FLINEAR2_2827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2826, v ds
+# define BFI_FLINEAR2_2827_TICK(t)
+# define BFI_FLINEAR2_2826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2825, v ds
+# define BFI_FLINEAR2_2826_TICK(t)
+# define BFI_FLINEAR2_2825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2824, v ds
+# define BFI_FLINEAR2_2825_TICK(t)
+# define BFI_FLINEAR2_2824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2823, v ds
+# define BFI_FLINEAR2_2824_TICK(t)
+# define BFI_FLINEAR2_2823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2822, v ds
+# define BFI_FLINEAR2_2823_TICK(t)
+# define BFI_FLINEAR2_2822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2821, v ds
+# define BFI_FLINEAR2_2822_TICK(t)
+# define BFI_FLINEAR2_2821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2820, v ds
+# define BFI_FLINEAR2_2821_TICK(t)
+# define BFI_FLINEAR2_2820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2819, v ds
+# define BFI_FLINEAR2_2820_TICK(t)
+# define BFI_FLINEAR2_2819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2818, v ds
+# define BFI_FLINEAR2_2819_TICK(t)
+# define BFI_FLINEAR2_2818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2817, v ds
+# define BFI_FLINEAR2_2818_TICK(t)
+# define BFI_FLINEAR2_2817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2816, v ds
+# define BFI_FLINEAR2_2817_TICK(t)
+# define BFI_FLINEAR2_2816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2815, v ds
+# define BFI_FLINEAR2_2816_TICK(t)
+# define BFI_FLINEAR2_2815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2814, v ds
+# define BFI_FLINEAR2_2815_TICK(t)
+# define BFI_FLINEAR2_2814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2813, v ds
+# define BFI_FLINEAR2_2814_TICK(t)
+# define BFI_FLINEAR2_2813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2812, v ds
+# define BFI_FLINEAR2_2813_TICK(t)
+# define BFI_FLINEAR2_2812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2811, v ds
+# define BFI_FLINEAR2_2812_TICK(t)
+# define BFI_FLINEAR2_2811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2810, v ds
+# define BFI_FLINEAR2_2811_TICK(t)
+# define BFI_FLINEAR2_2810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2809, v ds
+# define BFI_FLINEAR2_2810_TICK(t)
+# define BFI_FLINEAR2_2809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2808, v ds
+# define BFI_FLINEAR2_2809_TICK(t)
+# define BFI_FLINEAR2_2808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2807, v ds
+# define BFI_FLINEAR2_2808_TICK(t)
+# define BFI_FLINEAR2_2807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2806, v ds
+# define BFI_FLINEAR2_2807_TICK(t)
+# define BFI_FLINEAR2_2806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2805, v ds
+# define BFI_FLINEAR2_2806_TICK(t)
+# define BFI_FLINEAR2_2805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2804, v ds
+# define BFI_FLINEAR2_2805_TICK(t)
+# define BFI_FLINEAR2_2804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2803, v ds
+# define BFI_FLINEAR2_2804_TICK(t)
+# define BFI_FLINEAR2_2803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2802, v ds
+# define BFI_FLINEAR2_2803_TICK(t)
+# define BFI_FLINEAR2_2802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2801, v ds
+# define BFI_FLINEAR2_2802_TICK(t)
+# define BFI_FLINEAR2_2801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2800, v ds
+# define BFI_FLINEAR2_2801_TICK(t)
+# define BFI_FLINEAR2_2800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2799, v ds
+# define BFI_FLINEAR2_2800_TICK(t)
+# define BFI_FLINEAR2_2799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2798, v ds
+# define BFI_FLINEAR2_2799_TICK(t)
+# define BFI_FLINEAR2_2798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2797, v ds
+# define BFI_FLINEAR2_2798_TICK(t)
+# define BFI_FLINEAR2_2797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2796, v ds
+# define BFI_FLINEAR2_2797_TICK(t)
+# define BFI_FLINEAR2_2796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2795, v ds
+# define BFI_FLINEAR2_2796_TICK(t)
+# define BFI_FLINEAR2_2795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2794, v ds
+# define BFI_FLINEAR2_2795_TICK(t)
+# define BFI_FLINEAR2_2794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2793, v ds
+# define BFI_FLINEAR2_2794_TICK(t)
+# define BFI_FLINEAR2_2793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2792, v ds
+# define BFI_FLINEAR2_2793_TICK(t)
+# define BFI_FLINEAR2_2792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2791, v ds
+# define BFI_FLINEAR2_2792_TICK(t)
+# define BFI_FLINEAR2_2791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2790, v ds
+# define BFI_FLINEAR2_2791_TICK(t)
+# define BFI_FLINEAR2_2790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2789, v ds
+# define BFI_FLINEAR2_2790_TICK(t)
+# define BFI_FLINEAR2_2789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2788, v ds
+# define BFI_FLINEAR2_2789_TICK(t)
+# define BFI_FLINEAR2_2788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2787, v ds
+# define BFI_FLINEAR2_2788_TICK(t)
+# define BFI_FLINEAR2_2787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2786, v ds
+# define BFI_FLINEAR2_2787_TICK(t)
+# define BFI_FLINEAR2_2786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2785, v ds
+# define BFI_FLINEAR2_2786_TICK(t)
+# define BFI_FLINEAR2_2785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2784, v ds
+# define BFI_FLINEAR2_2785_TICK(t)
+# define BFI_FLINEAR2_2784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2783, v ds
+# define BFI_FLINEAR2_2784_TICK(t)
+# define BFI_FLINEAR2_2783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2782, v ds
+# define BFI_FLINEAR2_2783_TICK(t)
+# define BFI_FLINEAR2_2782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2781, v ds
+# define BFI_FLINEAR2_2782_TICK(t)
+# define BFI_FLINEAR2_2781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2780, v ds
+# define BFI_FLINEAR2_2781_TICK(t)
+# define BFI_FLINEAR2_2780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2779, v ds
+# define BFI_FLINEAR2_2780_TICK(t)
+# define BFI_FLINEAR2_2779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2778, v ds
+# define BFI_FLINEAR2_2779_TICK(t)
+# define BFI_FLINEAR2_2778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2777, v ds
+# define BFI_FLINEAR2_2778_TICK(t)
+# define BFI_FLINEAR2_2777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2776, v ds
+# define BFI_FLINEAR2_2777_TICK(t)
+# define BFI_FLINEAR2_2776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2775, v ds
+# define BFI_FLINEAR2_2776_TICK(t)
+# define BFI_FLINEAR2_2775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2774, v ds
+# define BFI_FLINEAR2_2775_TICK(t)
+# define BFI_FLINEAR2_2774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2773, v ds
+# define BFI_FLINEAR2_2774_TICK(t)
+# define BFI_FLINEAR2_2773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2772, v ds
+# define BFI_FLINEAR2_2773_TICK(t)
+# define BFI_FLINEAR2_2772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2771, v ds
+# define BFI_FLINEAR2_2772_TICK(t)
+# define BFI_FLINEAR2_2771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2770, v ds
+# define BFI_FLINEAR2_2771_TICK(t)
+# define BFI_FLINEAR2_2770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2769, v ds
+# define BFI_FLINEAR2_2770_TICK(t)
+# define BFI_FLINEAR2_2769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2768, v ds
+# define BFI_FLINEAR2_2769_TICK(t)
+# define BFI_FLINEAR2_2768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2767, v ds
+# define BFI_FLINEAR2_2768_TICK(t)
+# define BFI_FLINEAR2_2767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2766, v ds
+# define BFI_FLINEAR2_2767_TICK(t)
+# define BFI_FLINEAR2_2766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2765, v ds
+# define BFI_FLINEAR2_2766_TICK(t)
+# define BFI_FLINEAR2_2765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2764, v ds
+# define BFI_FLINEAR2_2765_TICK(t)
+# define BFI_FLINEAR2_2764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2763, v ds
+# define BFI_FLINEAR2_2764_TICK(t)
+# define BFI_FLINEAR2_2763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2762, v ds
+# define BFI_FLINEAR2_2763_TICK(t)
+# define BFI_FLINEAR2_2762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2761, v ds
+# define BFI_FLINEAR2_2762_TICK(t)
+# define BFI_FLINEAR2_2761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2760, v ds
+# define BFI_FLINEAR2_2761_TICK(t)
+# define BFI_FLINEAR2_2760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2759, v ds
+# define BFI_FLINEAR2_2760_TICK(t)
+# define BFI_FLINEAR2_2759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2758, v ds
+# define BFI_FLINEAR2_2759_TICK(t)
+# define BFI_FLINEAR2_2758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2757, v ds
+# define BFI_FLINEAR2_2758_TICK(t)
+# define BFI_FLINEAR2_2757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2756, v ds
+# define BFI_FLINEAR2_2757_TICK(t)
+# define BFI_FLINEAR2_2756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2755, v ds
+# define BFI_FLINEAR2_2756_TICK(t)
+# define BFI_FLINEAR2_2755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2754, v ds
+# define BFI_FLINEAR2_2755_TICK(t)
+# define BFI_FLINEAR2_2754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2753, v ds
+# define BFI_FLINEAR2_2754_TICK(t)
+# define BFI_FLINEAR2_2753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2752, v ds
+# define BFI_FLINEAR2_2753_TICK(t)
+# define BFI_FLINEAR2_2752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2751, v ds
+# define BFI_FLINEAR2_2752_TICK(t)
+# define BFI_FLINEAR2_2751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2750, v ds
+# define BFI_FLINEAR2_2751_TICK(t)
+# define BFI_FLINEAR2_2750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2749, v ds
+# define BFI_FLINEAR2_2750_TICK(t)
+# define BFI_FLINEAR2_2749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2748, v ds
+# define BFI_FLINEAR2_2749_TICK(t)
+# define BFI_FLINEAR2_2748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2747, v ds
+# define BFI_FLINEAR2_2748_TICK(t)
+# define BFI_FLINEAR2_2747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2746, v ds
+# define BFI_FLINEAR2_2747_TICK(t)
+# define BFI_FLINEAR2_2746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2745, v ds
+# define BFI_FLINEAR2_2746_TICK(t)
+# define BFI_FLINEAR2_2745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2744, v ds
+# define BFI_FLINEAR2_2745_TICK(t)
+# define BFI_FLINEAR2_2744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2743, v ds
+# define BFI_FLINEAR2_2744_TICK(t)
+# define BFI_FLINEAR2_2743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2742, v ds
+# define BFI_FLINEAR2_2743_TICK(t)
+# define BFI_FLINEAR2_2742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2741, v ds
+# define BFI_FLINEAR2_2742_TICK(t)
+# define BFI_FLINEAR2_2741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2740, v ds
+# define BFI_FLINEAR2_2741_TICK(t)
+# define BFI_FLINEAR2_2740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2739, v ds
+# define BFI_FLINEAR2_2740_TICK(t)
+# define BFI_FLINEAR2_2739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2738, v ds
+# define BFI_FLINEAR2_2739_TICK(t)
+# define BFI_FLINEAR2_2738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2737, v ds
+# define BFI_FLINEAR2_2738_TICK(t)
+# define BFI_FLINEAR2_2737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2736, v ds
+# define BFI_FLINEAR2_2737_TICK(t)
+# define BFI_FLINEAR2_2736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2735, v ds
+# define BFI_FLINEAR2_2736_TICK(t)
+# define BFI_FLINEAR2_2735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2734, v ds
+# define BFI_FLINEAR2_2735_TICK(t)
+# define BFI_FLINEAR2_2734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2733, v ds
+# define BFI_FLINEAR2_2734_TICK(t)
+# define BFI_FLINEAR2_2733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2732, v ds
+# define BFI_FLINEAR2_2733_TICK(t)
+# define BFI_FLINEAR2_2732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2731, v ds
+# define BFI_FLINEAR2_2732_TICK(t)
+# define BFI_FLINEAR2_2731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2730, v ds
+# define BFI_FLINEAR2_2731_TICK(t)
+# define BFI_FLINEAR2_2730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2729, v ds
+# define BFI_FLINEAR2_2730_TICK(t)
+# define BFI_FLINEAR2_2729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2728, v ds
+# define BFI_FLINEAR2_2729_TICK(t)
+# define BFI_FLINEAR2_2728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2727, v ds
+# define BFI_FLINEAR2_2728_TICK(t)
+# define BFI_FLINEAR2_2727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2726, v ds
+# define BFI_FLINEAR2_2727_TICK(t)
+# define BFI_FLINEAR2_2726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2725, v ds
+# define BFI_FLINEAR2_2726_TICK(t)
+# define BFI_FLINEAR2_2725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2724, v ds
+# define BFI_FLINEAR2_2725_TICK(t)
+# define BFI_FLINEAR2_2724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2723, v ds
+# define BFI_FLINEAR2_2724_TICK(t)
+# define BFI_FLINEAR2_2723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2722, v ds
+# define BFI_FLINEAR2_2723_TICK(t)
+# define BFI_FLINEAR2_2722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2721, v ds
+# define BFI_FLINEAR2_2722_TICK(t)
+# define BFI_FLINEAR2_2721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2720, v ds
+# define BFI_FLINEAR2_2721_TICK(t)
+# define BFI_FLINEAR2_2720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2719, v ds
+# define BFI_FLINEAR2_2720_TICK(t)
+# define BFI_FLINEAR2_2719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2718, v ds
+# define BFI_FLINEAR2_2719_TICK(t)
+# define BFI_FLINEAR2_2718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2717, v ds
+# define BFI_FLINEAR2_2718_TICK(t)
+# define BFI_FLINEAR2_2717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2716, v ds
+# define BFI_FLINEAR2_2717_TICK(t)
+# define BFI_FLINEAR2_2716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2715, v ds
+# define BFI_FLINEAR2_2716_TICK(t)
+# define BFI_FLINEAR2_2715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2714, v ds
+# define BFI_FLINEAR2_2715_TICK(t)
+# define BFI_FLINEAR2_2714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2713, v ds
+# define BFI_FLINEAR2_2714_TICK(t)
+# define BFI_FLINEAR2_2713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2712, v ds
+# define BFI_FLINEAR2_2713_TICK(t)
+# define BFI_FLINEAR2_2712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2711, v ds
+# define BFI_FLINEAR2_2712_TICK(t)
+# define BFI_FLINEAR2_2711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2710, v ds
+# define BFI_FLINEAR2_2711_TICK(t)
+# define BFI_FLINEAR2_2710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2709, v ds
+# define BFI_FLINEAR2_2710_TICK(t)
+# define BFI_FLINEAR2_2709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2708, v ds
+# define BFI_FLINEAR2_2709_TICK(t)
+# define BFI_FLINEAR2_2708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2707, v ds
+# define BFI_FLINEAR2_2708_TICK(t)
+# define BFI_FLINEAR2_2707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2706, v ds
+# define BFI_FLINEAR2_2707_TICK(t)
+# define BFI_FLINEAR2_2706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2705, v ds
+# define BFI_FLINEAR2_2706_TICK(t)
+# define BFI_FLINEAR2_2705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2704, v ds
+# define BFI_FLINEAR2_2705_TICK(t)
+# define BFI_FLINEAR2_2704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2703, v ds
+# define BFI_FLINEAR2_2704_TICK(t)
+# define BFI_FLINEAR2_2703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2702, v ds
+# define BFI_FLINEAR2_2703_TICK(t)
+# define BFI_FLINEAR2_2702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2701, v ds
+# define BFI_FLINEAR2_2702_TICK(t)
+# define BFI_FLINEAR2_2701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2700, v ds
+# define BFI_FLINEAR2_2701_TICK(t)
+# define BFI_FLINEAR2_2700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2699, v ds
+# define BFI_FLINEAR2_2700_TICK(t)
+# define BFI_FLINEAR2_2699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2698, v ds
+# define BFI_FLINEAR2_2699_TICK(t)
+# define BFI_FLINEAR2_2698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2697, v ds
+# define BFI_FLINEAR2_2698_TICK(t)
+# define BFI_FLINEAR2_2697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2696, v ds
+# define BFI_FLINEAR2_2697_TICK(t)
+# define BFI_FLINEAR2_2696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2695, v ds
+# define BFI_FLINEAR2_2696_TICK(t)
+# define BFI_FLINEAR2_2695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2694, v ds
+# define BFI_FLINEAR2_2695_TICK(t)
+# define BFI_FLINEAR2_2694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2693, v ds
+# define BFI_FLINEAR2_2694_TICK(t)
+# define BFI_FLINEAR2_2693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2692, v ds
+# define BFI_FLINEAR2_2693_TICK(t)
+# define BFI_FLINEAR2_2692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2691, v ds
+# define BFI_FLINEAR2_2692_TICK(t)
+# define BFI_FLINEAR2_2691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2690, v ds
+# define BFI_FLINEAR2_2691_TICK(t)
+# define BFI_FLINEAR2_2690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2689, v ds
+# define BFI_FLINEAR2_2690_TICK(t)
+# define BFI_FLINEAR2_2689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2688, v ds
+# define BFI_FLINEAR2_2689_TICK(t)
+# define BFI_FLINEAR2_2688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2687, v ds
+# define BFI_FLINEAR2_2688_TICK(t)
+# define BFI_FLINEAR2_2687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2686, v ds
+# define BFI_FLINEAR2_2687_TICK(t)
+# define BFI_FLINEAR2_2686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2685, v ds
+# define BFI_FLINEAR2_2686_TICK(t)
+# define BFI_FLINEAR2_2685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2684, v ds
+# define BFI_FLINEAR2_2685_TICK(t)
+# define BFI_FLINEAR2_2684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2683, v ds
+# define BFI_FLINEAR2_2684_TICK(t)
+# define BFI_FLINEAR2_2683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2682, v ds
+# define BFI_FLINEAR2_2683_TICK(t)
+# define BFI_FLINEAR2_2682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2681, v ds
+# define BFI_FLINEAR2_2682_TICK(t)
+# define BFI_FLINEAR2_2681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2680, v ds
+# define BFI_FLINEAR2_2681_TICK(t)
+# define BFI_FLINEAR2_2680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2679, v ds
+# define BFI_FLINEAR2_2680_TICK(t)
+# define BFI_FLINEAR2_2679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2678, v ds
+# define BFI_FLINEAR2_2679_TICK(t)
+# define BFI_FLINEAR2_2678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2677, v ds
+# define BFI_FLINEAR2_2678_TICK(t)
+# define BFI_FLINEAR2_2677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2676, v ds
+# define BFI_FLINEAR2_2677_TICK(t)
+# define BFI_FLINEAR2_2676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2675, v ds
+# define BFI_FLINEAR2_2676_TICK(t)
+# define BFI_FLINEAR2_2675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2674, v ds
+# define BFI_FLINEAR2_2675_TICK(t)
+# define BFI_FLINEAR2_2674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2673, v ds
+# define BFI_FLINEAR2_2674_TICK(t)
+# define BFI_FLINEAR2_2673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2672, v ds
+# define BFI_FLINEAR2_2673_TICK(t)
+# define BFI_FLINEAR2_2672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2671, v ds
+# define BFI_FLINEAR2_2672_TICK(t)
+# define BFI_FLINEAR2_2671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2670, v ds
+# define BFI_FLINEAR2_2671_TICK(t)
+# define BFI_FLINEAR2_2670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2669, v ds
+# define BFI_FLINEAR2_2670_TICK(t)
+# define BFI_FLINEAR2_2669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2668, v ds
+# define BFI_FLINEAR2_2669_TICK(t)
+# define BFI_FLINEAR2_2668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2667, v ds
+# define BFI_FLINEAR2_2668_TICK(t)
+# define BFI_FLINEAR2_2667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2666, v ds
+# define BFI_FLINEAR2_2667_TICK(t)
+# define BFI_FLINEAR2_2666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2665, v ds
+# define BFI_FLINEAR2_2666_TICK(t)
+# define BFI_FLINEAR2_2665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2664, v ds
+# define BFI_FLINEAR2_2665_TICK(t)
+# define BFI_FLINEAR2_2664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2663, v ds
+# define BFI_FLINEAR2_2664_TICK(t)
+# define BFI_FLINEAR2_2663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2662, v ds
+# define BFI_FLINEAR2_2663_TICK(t)
+# define BFI_FLINEAR2_2662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2661, v ds
+# define BFI_FLINEAR2_2662_TICK(t)
+# define BFI_FLINEAR2_2661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2660, v ds
+# define BFI_FLINEAR2_2661_TICK(t)
+# define BFI_FLINEAR2_2660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2659, v ds
+# define BFI_FLINEAR2_2660_TICK(t)
+# define BFI_FLINEAR2_2659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2658, v ds
+# define BFI_FLINEAR2_2659_TICK(t)
+# define BFI_FLINEAR2_2658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2657, v ds
+# define BFI_FLINEAR2_2658_TICK(t)
+# define BFI_FLINEAR2_2657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2656, v ds
+# define BFI_FLINEAR2_2657_TICK(t)
+# define BFI_FLINEAR2_2656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2655, v ds
+# define BFI_FLINEAR2_2656_TICK(t)
+# define BFI_FLINEAR2_2655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2654, v ds
+# define BFI_FLINEAR2_2655_TICK(t)
+# define BFI_FLINEAR2_2654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2653, v ds
+# define BFI_FLINEAR2_2654_TICK(t)
+# define BFI_FLINEAR2_2653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2652, v ds
+# define BFI_FLINEAR2_2653_TICK(t)
+# define BFI_FLINEAR2_2652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2651, v ds
+# define BFI_FLINEAR2_2652_TICK(t)
+# define BFI_FLINEAR2_2651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2650, v ds
+# define BFI_FLINEAR2_2651_TICK(t)
+# define BFI_FLINEAR2_2650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2649, v ds
+# define BFI_FLINEAR2_2650_TICK(t)
+# define BFI_FLINEAR2_2649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2648, v ds
+# define BFI_FLINEAR2_2649_TICK(t)
+# define BFI_FLINEAR2_2648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2647, v ds
+# define BFI_FLINEAR2_2648_TICK(t)
+# define BFI_FLINEAR2_2647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2646, v ds
+# define BFI_FLINEAR2_2647_TICK(t)
+# define BFI_FLINEAR2_2646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2645, v ds
+# define BFI_FLINEAR2_2646_TICK(t)
+# define BFI_FLINEAR2_2645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2644, v ds
+# define BFI_FLINEAR2_2645_TICK(t)
+# define BFI_FLINEAR2_2644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2643, v ds
+# define BFI_FLINEAR2_2644_TICK(t)
+# define BFI_FLINEAR2_2643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2642, v ds
+# define BFI_FLINEAR2_2643_TICK(t)
+# define BFI_FLINEAR2_2642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2641, v ds
+# define BFI_FLINEAR2_2642_TICK(t)
+# define BFI_FLINEAR2_2641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2640, v ds
+# define BFI_FLINEAR2_2641_TICK(t)
+# define BFI_FLINEAR2_2640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2639, v ds
+# define BFI_FLINEAR2_2640_TICK(t)
+# define BFI_FLINEAR2_2639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2638, v ds
+# define BFI_FLINEAR2_2639_TICK(t)
+# define BFI_FLINEAR2_2638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2637, v ds
+# define BFI_FLINEAR2_2638_TICK(t)
+# define BFI_FLINEAR2_2637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2636, v ds
+# define BFI_FLINEAR2_2637_TICK(t)
+# define BFI_FLINEAR2_2636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2635, v ds
+# define BFI_FLINEAR2_2636_TICK(t)
+# define BFI_FLINEAR2_2635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2634, v ds
+# define BFI_FLINEAR2_2635_TICK(t)
+# define BFI_FLINEAR2_2634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2633, v ds
+# define BFI_FLINEAR2_2634_TICK(t)
+# define BFI_FLINEAR2_2633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2632, v ds
+# define BFI_FLINEAR2_2633_TICK(t)
+# define BFI_FLINEAR2_2632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2631, v ds
+# define BFI_FLINEAR2_2632_TICK(t)
+# define BFI_FLINEAR2_2631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2630, v ds
+# define BFI_FLINEAR2_2631_TICK(t)
+# define BFI_FLINEAR2_2630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2629, v ds
+# define BFI_FLINEAR2_2630_TICK(t)
+# define BFI_FLINEAR2_2629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2628, v ds
+# define BFI_FLINEAR2_2629_TICK(t)
+# define BFI_FLINEAR2_2628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2627, v ds
+# define BFI_FLINEAR2_2628_TICK(t)
+# define BFI_FLINEAR2_2627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2626, v ds
+# define BFI_FLINEAR2_2627_TICK(t)
+# define BFI_FLINEAR2_2626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2625, v ds
+# define BFI_FLINEAR2_2626_TICK(t)
+# define BFI_FLINEAR2_2625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2624, v ds
+# define BFI_FLINEAR2_2625_TICK(t)
+# define BFI_FLINEAR2_2624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2623, v ds
+# define BFI_FLINEAR2_2624_TICK(t)
+# define BFI_FLINEAR2_2623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2622, v ds
+# define BFI_FLINEAR2_2623_TICK(t)
+# define BFI_FLINEAR2_2622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2621, v ds
+# define BFI_FLINEAR2_2622_TICK(t)
+# define BFI_FLINEAR2_2621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2620, v ds
+# define BFI_FLINEAR2_2621_TICK(t)
+# define BFI_FLINEAR2_2620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2619, v ds
+# define BFI_FLINEAR2_2620_TICK(t)
+# define BFI_FLINEAR2_2619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2618, v ds
+# define BFI_FLINEAR2_2619_TICK(t)
+# define BFI_FLINEAR2_2618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2617, v ds
+# define BFI_FLINEAR2_2618_TICK(t)
+# define BFI_FLINEAR2_2617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2616, v ds
+# define BFI_FLINEAR2_2617_TICK(t)
+# define BFI_FLINEAR2_2616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2615, v ds
+# define BFI_FLINEAR2_2616_TICK(t)
+# define BFI_FLINEAR2_2615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2614, v ds
+# define BFI_FLINEAR2_2615_TICK(t)
+# define BFI_FLINEAR2_2614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2613, v ds
+# define BFI_FLINEAR2_2614_TICK(t)
+# define BFI_FLINEAR2_2613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2612, v ds
+# define BFI_FLINEAR2_2613_TICK(t)
+# define BFI_FLINEAR2_2612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2611, v ds
+# define BFI_FLINEAR2_2612_TICK(t)
+# define BFI_FLINEAR2_2611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2610, v ds
+# define BFI_FLINEAR2_2611_TICK(t)
+# define BFI_FLINEAR2_2610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2609, v ds
+# define BFI_FLINEAR2_2610_TICK(t)
+# define BFI_FLINEAR2_2609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2608, v ds
+# define BFI_FLINEAR2_2609_TICK(t)
+# define BFI_FLINEAR2_2608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2607, v ds
+# define BFI_FLINEAR2_2608_TICK(t)
+# define BFI_FLINEAR2_2607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2606, v ds
+# define BFI_FLINEAR2_2607_TICK(t)
+# define BFI_FLINEAR2_2606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2605, v ds
+# define BFI_FLINEAR2_2606_TICK(t)
+# define BFI_FLINEAR2_2605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2604, v ds
+# define BFI_FLINEAR2_2605_TICK(t)
+# define BFI_FLINEAR2_2604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2603, v ds
+# define BFI_FLINEAR2_2604_TICK(t)
+# define BFI_FLINEAR2_2603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2602, v ds
+# define BFI_FLINEAR2_2603_TICK(t)
+# define BFI_FLINEAR2_2602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2601, v ds
+# define BFI_FLINEAR2_2602_TICK(t)
+# define BFI_FLINEAR2_2601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2600, v ds
+# define BFI_FLINEAR2_2601_TICK(t)
+# define BFI_FLINEAR2_2600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2599, v ds
+# define BFI_FLINEAR2_2600_TICK(t)
+# define BFI_FLINEAR2_2599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2598, v ds
+# define BFI_FLINEAR2_2599_TICK(t)
+# define BFI_FLINEAR2_2598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2597, v ds
+# define BFI_FLINEAR2_2598_TICK(t)
+# define BFI_FLINEAR2_2597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2596, v ds
+# define BFI_FLINEAR2_2597_TICK(t)
+# define BFI_FLINEAR2_2596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2595, v ds
+# define BFI_FLINEAR2_2596_TICK(t)
+# define BFI_FLINEAR2_2595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2594, v ds
+# define BFI_FLINEAR2_2595_TICK(t)
+# define BFI_FLINEAR2_2594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2593, v ds
+# define BFI_FLINEAR2_2594_TICK(t)
+# define BFI_FLINEAR2_2593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2592, v ds
+# define BFI_FLINEAR2_2593_TICK(t)
+# define BFI_FLINEAR2_2592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2591, v ds
+# define BFI_FLINEAR2_2592_TICK(t)
+# define BFI_FLINEAR2_2591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2590, v ds
+# define BFI_FLINEAR2_2591_TICK(t)
+# define BFI_FLINEAR2_2590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2589, v ds
+# define BFI_FLINEAR2_2590_TICK(t)
+# define BFI_FLINEAR2_2589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2588, v ds
+# define BFI_FLINEAR2_2589_TICK(t)
+# define BFI_FLINEAR2_2588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2587, v ds
+# define BFI_FLINEAR2_2588_TICK(t)
+# define BFI_FLINEAR2_2587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2586, v ds
+# define BFI_FLINEAR2_2587_TICK(t)
+# define BFI_FLINEAR2_2586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2585, v ds
+# define BFI_FLINEAR2_2586_TICK(t)
+# define BFI_FLINEAR2_2585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2584, v ds
+# define BFI_FLINEAR2_2585_TICK(t)
+# define BFI_FLINEAR2_2584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2583, v ds
+# define BFI_FLINEAR2_2584_TICK(t)
+# define BFI_FLINEAR2_2583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2582, v ds
+# define BFI_FLINEAR2_2583_TICK(t)
+# define BFI_FLINEAR2_2582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2581, v ds
+# define BFI_FLINEAR2_2582_TICK(t)
+# define BFI_FLINEAR2_2581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2580, v ds
+# define BFI_FLINEAR2_2581_TICK(t)
+# define BFI_FLINEAR2_2580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2579, v ds
+# define BFI_FLINEAR2_2580_TICK(t)
+# define BFI_FLINEAR2_2579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2578, v ds
+# define BFI_FLINEAR2_2579_TICK(t)
+# define BFI_FLINEAR2_2578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2577, v ds
+# define BFI_FLINEAR2_2578_TICK(t)
+# define BFI_FLINEAR2_2577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2576, v ds
+# define BFI_FLINEAR2_2577_TICK(t)
+# define BFI_FLINEAR2_2576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2575, v ds
+# define BFI_FLINEAR2_2576_TICK(t)
+# define BFI_FLINEAR2_2575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2574, v ds
+# define BFI_FLINEAR2_2575_TICK(t)
+# define BFI_FLINEAR2_2574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2573, v ds
+# define BFI_FLINEAR2_2574_TICK(t)
+# define BFI_FLINEAR2_2573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2572, v ds
+# define BFI_FLINEAR2_2573_TICK(t)
+# define BFI_FLINEAR2_2572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2571, v ds
+# define BFI_FLINEAR2_2572_TICK(t)
+# define BFI_FLINEAR2_2571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2570, v ds
+# define BFI_FLINEAR2_2571_TICK(t)
+# define BFI_FLINEAR2_2570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2569, v ds
+# define BFI_FLINEAR2_2570_TICK(t)
+# define BFI_FLINEAR2_2569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2568, v ds
+# define BFI_FLINEAR2_2569_TICK(t)
+# define BFI_FLINEAR2_2568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2567, v ds
+# define BFI_FLINEAR2_2568_TICK(t)
+# define BFI_FLINEAR2_2567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2566, v ds
+# define BFI_FLINEAR2_2567_TICK(t)
+# define BFI_FLINEAR2_2566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2565, v ds
+# define BFI_FLINEAR2_2566_TICK(t)
+# define BFI_FLINEAR2_2565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2564, v ds
+# define BFI_FLINEAR2_2565_TICK(t)
+# define BFI_FLINEAR2_2564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2563, v ds
+# define BFI_FLINEAR2_2564_TICK(t)
+# define BFI_FLINEAR2_2563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2562, v ds
+# define BFI_FLINEAR2_2563_TICK(t)
+# define BFI_FLINEAR2_2562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2561, v ds
+# define BFI_FLINEAR2_2562_TICK(t)
+# define BFI_FLINEAR2_2561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2560, v ds
+# define BFI_FLINEAR2_2561_TICK(t)
+# define BFI_FLINEAR2_2560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2559, v ds
+# define BFI_FLINEAR2_2560_TICK(t)
+# define BFI_FLINEAR2_2559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2558, v ds
+# define BFI_FLINEAR2_2559_TICK(t)
+# define BFI_FLINEAR2_2558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2557, v ds
+# define BFI_FLINEAR2_2558_TICK(t)
+# define BFI_FLINEAR2_2557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2556, v ds
+# define BFI_FLINEAR2_2557_TICK(t)
+# define BFI_FLINEAR2_2556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2555, v ds
+# define BFI_FLINEAR2_2556_TICK(t)
+# define BFI_FLINEAR2_2555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2554, v ds
+# define BFI_FLINEAR2_2555_TICK(t)
+# define BFI_FLINEAR2_2554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2553, v ds
+# define BFI_FLINEAR2_2554_TICK(t)
+# define BFI_FLINEAR2_2553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2552, v ds
+# define BFI_FLINEAR2_2553_TICK(t)
+# define BFI_FLINEAR2_2552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2551, v ds
+# define BFI_FLINEAR2_2552_TICK(t)
+# define BFI_FLINEAR2_2551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2550, v ds
+# define BFI_FLINEAR2_2551_TICK(t)
+# define BFI_FLINEAR2_2550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2549, v ds
+# define BFI_FLINEAR2_2550_TICK(t)
+# define BFI_FLINEAR2_2549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2548, v ds
+# define BFI_FLINEAR2_2549_TICK(t)
+# define BFI_FLINEAR2_2548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2547, v ds
+# define BFI_FLINEAR2_2548_TICK(t)
+# define BFI_FLINEAR2_2547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2546, v ds
+# define BFI_FLINEAR2_2547_TICK(t)
+# define BFI_FLINEAR2_2546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2545, v ds
+# define BFI_FLINEAR2_2546_TICK(t)
+# define BFI_FLINEAR2_2545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2544, v ds
+# define BFI_FLINEAR2_2545_TICK(t)
+# define BFI_FLINEAR2_2544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2543, v ds
+# define BFI_FLINEAR2_2544_TICK(t)
+# define BFI_FLINEAR2_2543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2542, v ds
+# define BFI_FLINEAR2_2543_TICK(t)
+# define BFI_FLINEAR2_2542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2541, v ds
+# define BFI_FLINEAR2_2542_TICK(t)
+# define BFI_FLINEAR2_2541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2540, v ds
+# define BFI_FLINEAR2_2541_TICK(t)
+# define BFI_FLINEAR2_2540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2539, v ds
+# define BFI_FLINEAR2_2540_TICK(t)
+# define BFI_FLINEAR2_2539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2538, v ds
+# define BFI_FLINEAR2_2539_TICK(t)
+# define BFI_FLINEAR2_2538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2537, v ds
+# define BFI_FLINEAR2_2538_TICK(t)
+# define BFI_FLINEAR2_2537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2536, v ds
+# define BFI_FLINEAR2_2537_TICK(t)
+# define BFI_FLINEAR2_2536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2535, v ds
+# define BFI_FLINEAR2_2536_TICK(t)
+# define BFI_FLINEAR2_2535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2534, v ds
+# define BFI_FLINEAR2_2535_TICK(t)
+# define BFI_FLINEAR2_2534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2533, v ds
+# define BFI_FLINEAR2_2534_TICK(t)
+# define BFI_FLINEAR2_2533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2532, v ds
+# define BFI_FLINEAR2_2533_TICK(t)
+# define BFI_FLINEAR2_2532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2531, v ds
+# define BFI_FLINEAR2_2532_TICK(t)
+# define BFI_FLINEAR2_2531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2530, v ds
+# define BFI_FLINEAR2_2531_TICK(t)
+# define BFI_FLINEAR2_2530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2529, v ds
+# define BFI_FLINEAR2_2530_TICK(t)
+# define BFI_FLINEAR2_2529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2528, v ds
+# define BFI_FLINEAR2_2529_TICK(t)
+# define BFI_FLINEAR2_2528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2527, v ds
+# define BFI_FLINEAR2_2528_TICK(t)
+# define BFI_FLINEAR2_2527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2526, v ds
+# define BFI_FLINEAR2_2527_TICK(t)
+# define BFI_FLINEAR2_2526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2525, v ds
+# define BFI_FLINEAR2_2526_TICK(t)
+# define BFI_FLINEAR2_2525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2524, v ds
+# define BFI_FLINEAR2_2525_TICK(t)
+# define BFI_FLINEAR2_2524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2523, v ds
+# define BFI_FLINEAR2_2524_TICK(t)
+# define BFI_FLINEAR2_2523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2522, v ds
+# define BFI_FLINEAR2_2523_TICK(t)
+# define BFI_FLINEAR2_2522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2521, v ds
+# define BFI_FLINEAR2_2522_TICK(t)
+# define BFI_FLINEAR2_2521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2520, v ds
+# define BFI_FLINEAR2_2521_TICK(t)
+# define BFI_FLINEAR2_2520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2519, v ds
+# define BFI_FLINEAR2_2520_TICK(t)
+# define BFI_FLINEAR2_2519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2518, v ds
+# define BFI_FLINEAR2_2519_TICK(t)
+# define BFI_FLINEAR2_2518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2517, v ds
+# define BFI_FLINEAR2_2518_TICK(t)
+# define BFI_FLINEAR2_2517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2516, v ds
+# define BFI_FLINEAR2_2517_TICK(t)
+# define BFI_FLINEAR2_2516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2515, v ds
+# define BFI_FLINEAR2_2516_TICK(t)
+# define BFI_FLINEAR2_2515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2514, v ds
+# define BFI_FLINEAR2_2515_TICK(t)
+# define BFI_FLINEAR2_2514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2513, v ds
+# define BFI_FLINEAR2_2514_TICK(t)
+# define BFI_FLINEAR2_2513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2512, v ds
+# define BFI_FLINEAR2_2513_TICK(t)
+# define BFI_FLINEAR2_2512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2511, v ds
+# define BFI_FLINEAR2_2512_TICK(t)
+# define BFI_FLINEAR2_2511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2510, v ds
+# define BFI_FLINEAR2_2511_TICK(t)
+# define BFI_FLINEAR2_2510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2509, v ds
+# define BFI_FLINEAR2_2510_TICK(t)
+# define BFI_FLINEAR2_2509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2508, v ds
+# define BFI_FLINEAR2_2509_TICK(t)
+# define BFI_FLINEAR2_2508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2507, v ds
+# define BFI_FLINEAR2_2508_TICK(t)
+# define BFI_FLINEAR2_2507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2506, v ds
+# define BFI_FLINEAR2_2507_TICK(t)
+# define BFI_FLINEAR2_2506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2505, v ds
+# define BFI_FLINEAR2_2506_TICK(t)
+# define BFI_FLINEAR2_2505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2504, v ds
+# define BFI_FLINEAR2_2505_TICK(t)
+# define BFI_FLINEAR2_2504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2503, v ds
+# define BFI_FLINEAR2_2504_TICK(t)
+# define BFI_FLINEAR2_2503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2502, v ds
+# define BFI_FLINEAR2_2503_TICK(t)
+# define BFI_FLINEAR2_2502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2501, v ds
+# define BFI_FLINEAR2_2502_TICK(t)
+# define BFI_FLINEAR2_2501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2500, v ds
+# define BFI_FLINEAR2_2501_TICK(t)
+# define BFI_FLINEAR2_2500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2499, v ds
+# define BFI_FLINEAR2_2500_TICK(t)
+# define BFI_FLINEAR2_2499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2498, v ds
+# define BFI_FLINEAR2_2499_TICK(t)
+# define BFI_FLINEAR2_2498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2497, v ds
+# define BFI_FLINEAR2_2498_TICK(t)
+# define BFI_FLINEAR2_2497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2496, v ds
+# define BFI_FLINEAR2_2497_TICK(t)
+# define BFI_FLINEAR2_2496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2495, v ds
+# define BFI_FLINEAR2_2496_TICK(t)
+# define BFI_FLINEAR2_2495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2494, v ds
+# define BFI_FLINEAR2_2495_TICK(t)
+# define BFI_FLINEAR2_2494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2493, v ds
+# define BFI_FLINEAR2_2494_TICK(t)
+# define BFI_FLINEAR2_2493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2492, v ds
+# define BFI_FLINEAR2_2493_TICK(t)
+# define BFI_FLINEAR2_2492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2491, v ds
+# define BFI_FLINEAR2_2492_TICK(t)
+# define BFI_FLINEAR2_2491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2490, v ds
+# define BFI_FLINEAR2_2491_TICK(t)
+# define BFI_FLINEAR2_2490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2489, v ds
+# define BFI_FLINEAR2_2490_TICK(t)
+# define BFI_FLINEAR2_2489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2488, v ds
+# define BFI_FLINEAR2_2489_TICK(t)
+# define BFI_FLINEAR2_2488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2487, v ds
+# define BFI_FLINEAR2_2488_TICK(t)
+# define BFI_FLINEAR2_2487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2486, v ds
+# define BFI_FLINEAR2_2487_TICK(t)
+# define BFI_FLINEAR2_2486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2485, v ds
+# define BFI_FLINEAR2_2486_TICK(t)
+# define BFI_FLINEAR2_2485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2484, v ds
+# define BFI_FLINEAR2_2485_TICK(t)
+# define BFI_FLINEAR2_2484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2483, v ds
+# define BFI_FLINEAR2_2484_TICK(t)
+# define BFI_FLINEAR2_2483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2482, v ds
+# define BFI_FLINEAR2_2483_TICK(t)
+# define BFI_FLINEAR2_2482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2481, v ds
+# define BFI_FLINEAR2_2482_TICK(t)
+# define BFI_FLINEAR2_2481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2480, v ds
+# define BFI_FLINEAR2_2481_TICK(t)
+# define BFI_FLINEAR2_2480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2479, v ds
+# define BFI_FLINEAR2_2480_TICK(t)
+# define BFI_FLINEAR2_2479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2478, v ds
+# define BFI_FLINEAR2_2479_TICK(t)
+# define BFI_FLINEAR2_2478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2477, v ds
+# define BFI_FLINEAR2_2478_TICK(t)
+# define BFI_FLINEAR2_2477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2476, v ds
+# define BFI_FLINEAR2_2477_TICK(t)
+# define BFI_FLINEAR2_2476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2475, v ds
+# define BFI_FLINEAR2_2476_TICK(t)
+# define BFI_FLINEAR2_2475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2474, v ds
+# define BFI_FLINEAR2_2475_TICK(t)
+# define BFI_FLINEAR2_2474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2473, v ds
+# define BFI_FLINEAR2_2474_TICK(t)
+# define BFI_FLINEAR2_2473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2472, v ds
+# define BFI_FLINEAR2_2473_TICK(t)
+# define BFI_FLINEAR2_2472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2471, v ds
+# define BFI_FLINEAR2_2472_TICK(t)
+# define BFI_FLINEAR2_2471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2470, v ds
+# define BFI_FLINEAR2_2471_TICK(t)
+# define BFI_FLINEAR2_2470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2469, v ds
+# define BFI_FLINEAR2_2470_TICK(t)
+# define BFI_FLINEAR2_2469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2468, v ds
+# define BFI_FLINEAR2_2469_TICK(t)
+# define BFI_FLINEAR2_2468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2467, v ds
+# define BFI_FLINEAR2_2468_TICK(t)
+# define BFI_FLINEAR2_2467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2466, v ds
+# define BFI_FLINEAR2_2467_TICK(t)
+# define BFI_FLINEAR2_2466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2465, v ds
+# define BFI_FLINEAR2_2466_TICK(t)
+# define BFI_FLINEAR2_2465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2464, v ds
+# define BFI_FLINEAR2_2465_TICK(t)
+# define BFI_FLINEAR2_2464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2463, v ds
+# define BFI_FLINEAR2_2464_TICK(t)
+# define BFI_FLINEAR2_2463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2462, v ds
+# define BFI_FLINEAR2_2463_TICK(t)
+# define BFI_FLINEAR2_2462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2461, v ds
+# define BFI_FLINEAR2_2462_TICK(t)
+# define BFI_FLINEAR2_2461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2460, v ds
+# define BFI_FLINEAR2_2461_TICK(t)
+# define BFI_FLINEAR2_2460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2459, v ds
+# define BFI_FLINEAR2_2460_TICK(t)
+# define BFI_FLINEAR2_2459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2458, v ds
+# define BFI_FLINEAR2_2459_TICK(t)
+# define BFI_FLINEAR2_2458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2457, v ds
+# define BFI_FLINEAR2_2458_TICK(t)
+# define BFI_FLINEAR2_2457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2456, v ds
+# define BFI_FLINEAR2_2457_TICK(t)
+# define BFI_FLINEAR2_2456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2455, v ds
+# define BFI_FLINEAR2_2456_TICK(t)
+# define BFI_FLINEAR2_2455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2454, v ds
+# define BFI_FLINEAR2_2455_TICK(t)
+# define BFI_FLINEAR2_2454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2453, v ds
+# define BFI_FLINEAR2_2454_TICK(t)
+# define BFI_FLINEAR2_2453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2452, v ds
+# define BFI_FLINEAR2_2453_TICK(t)
+# define BFI_FLINEAR2_2452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2451, v ds
+# define BFI_FLINEAR2_2452_TICK(t)
+# define BFI_FLINEAR2_2451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2450, v ds
+# define BFI_FLINEAR2_2451_TICK(t)
+# define BFI_FLINEAR2_2450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2449, v ds
+# define BFI_FLINEAR2_2450_TICK(t)
+# define BFI_FLINEAR2_2449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2448, v ds
+# define BFI_FLINEAR2_2449_TICK(t)
+# define BFI_FLINEAR2_2448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2447, v ds
+# define BFI_FLINEAR2_2448_TICK(t)
+# define BFI_FLINEAR2_2447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2446, v ds
+# define BFI_FLINEAR2_2447_TICK(t)
+# define BFI_FLINEAR2_2446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2445, v ds
+# define BFI_FLINEAR2_2446_TICK(t)
+# define BFI_FLINEAR2_2445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2444, v ds
+# define BFI_FLINEAR2_2445_TICK(t)
+# define BFI_FLINEAR2_2444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2443, v ds
+# define BFI_FLINEAR2_2444_TICK(t)
+# define BFI_FLINEAR2_2443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2442, v ds
+# define BFI_FLINEAR2_2443_TICK(t)
+# define BFI_FLINEAR2_2442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2441, v ds
+# define BFI_FLINEAR2_2442_TICK(t)
+# define BFI_FLINEAR2_2441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2440, v ds
+# define BFI_FLINEAR2_2441_TICK(t)
+# define BFI_FLINEAR2_2440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2439, v ds
+# define BFI_FLINEAR2_2440_TICK(t)
+# define BFI_FLINEAR2_2439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2438, v ds
+# define BFI_FLINEAR2_2439_TICK(t)
+# define BFI_FLINEAR2_2438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2437, v ds
+# define BFI_FLINEAR2_2438_TICK(t)
+# define BFI_FLINEAR2_2437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2436, v ds
+# define BFI_FLINEAR2_2437_TICK(t)
+# define BFI_FLINEAR2_2436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2435, v ds
+# define BFI_FLINEAR2_2436_TICK(t)
+# define BFI_FLINEAR2_2435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2434, v ds
+# define BFI_FLINEAR2_2435_TICK(t)
+# define BFI_FLINEAR2_2434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2433, v ds
+# define BFI_FLINEAR2_2434_TICK(t)
+# define BFI_FLINEAR2_2433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2432, v ds
+# define BFI_FLINEAR2_2433_TICK(t)
+# define BFI_FLINEAR2_2432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2431, v ds
+# define BFI_FLINEAR2_2432_TICK(t)
+# define BFI_FLINEAR2_2431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2430, v ds
+# define BFI_FLINEAR2_2431_TICK(t)
+# define BFI_FLINEAR2_2430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2429, v ds
+# define BFI_FLINEAR2_2430_TICK(t)
+# define BFI_FLINEAR2_2429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2428, v ds
+# define BFI_FLINEAR2_2429_TICK(t)
+# define BFI_FLINEAR2_2428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2427, v ds
+# define BFI_FLINEAR2_2428_TICK(t)
+# define BFI_FLINEAR2_2427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2426, v ds
+# define BFI_FLINEAR2_2427_TICK(t)
+# define BFI_FLINEAR2_2426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2425, v ds
+# define BFI_FLINEAR2_2426_TICK(t)
+# define BFI_FLINEAR2_2425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2424, v ds
+# define BFI_FLINEAR2_2425_TICK(t)
+# define BFI_FLINEAR2_2424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2423, v ds
+# define BFI_FLINEAR2_2424_TICK(t)
+# define BFI_FLINEAR2_2423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2422, v ds
+# define BFI_FLINEAR2_2423_TICK(t)
+# define BFI_FLINEAR2_2422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2421, v ds
+# define BFI_FLINEAR2_2422_TICK(t)
+# define BFI_FLINEAR2_2421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2420, v ds
+# define BFI_FLINEAR2_2421_TICK(t)
+# define BFI_FLINEAR2_2420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2419, v ds
+# define BFI_FLINEAR2_2420_TICK(t)
+# define BFI_FLINEAR2_2419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2418, v ds
+# define BFI_FLINEAR2_2419_TICK(t)
+# define BFI_FLINEAR2_2418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2417, v ds
+# define BFI_FLINEAR2_2418_TICK(t)
+# define BFI_FLINEAR2_2417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2416, v ds
+# define BFI_FLINEAR2_2417_TICK(t)
+# define BFI_FLINEAR2_2416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2415, v ds
+# define BFI_FLINEAR2_2416_TICK(t)
+# define BFI_FLINEAR2_2415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2414, v ds
+# define BFI_FLINEAR2_2415_TICK(t)
+# define BFI_FLINEAR2_2414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2413, v ds
+# define BFI_FLINEAR2_2414_TICK(t)
+# define BFI_FLINEAR2_2413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2412, v ds
+# define BFI_FLINEAR2_2413_TICK(t)
+# define BFI_FLINEAR2_2412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2411, v ds
+# define BFI_FLINEAR2_2412_TICK(t)
+# define BFI_FLINEAR2_2411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2410, v ds
+# define BFI_FLINEAR2_2411_TICK(t)
+# define BFI_FLINEAR2_2410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2409, v ds
+# define BFI_FLINEAR2_2410_TICK(t)
+# define BFI_FLINEAR2_2409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2408, v ds
+# define BFI_FLINEAR2_2409_TICK(t)
+# define BFI_FLINEAR2_2408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2407, v ds
+# define BFI_FLINEAR2_2408_TICK(t)
+# define BFI_FLINEAR2_2407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2406, v ds
+# define BFI_FLINEAR2_2407_TICK(t)
+# define BFI_FLINEAR2_2406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2405, v ds
+# define BFI_FLINEAR2_2406_TICK(t)
+# define BFI_FLINEAR2_2405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2404, v ds
+# define BFI_FLINEAR2_2405_TICK(t)
+# define BFI_FLINEAR2_2404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2403, v ds
+# define BFI_FLINEAR2_2404_TICK(t)
+# define BFI_FLINEAR2_2403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2402, v ds
+# define BFI_FLINEAR2_2403_TICK(t)
+# define BFI_FLINEAR2_2402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2401, v ds
+# define BFI_FLINEAR2_2402_TICK(t)
+# define BFI_FLINEAR2_2401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2400, v ds
+# define BFI_FLINEAR2_2401_TICK(t)
+# define BFI_FLINEAR2_2400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2399, v ds
+# define BFI_FLINEAR2_2400_TICK(t)
+# define BFI_FLINEAR2_2399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2398, v ds
+# define BFI_FLINEAR2_2399_TICK(t)
+# define BFI_FLINEAR2_2398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2397, v ds
+# define BFI_FLINEAR2_2398_TICK(t)
+# define BFI_FLINEAR2_2397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2396, v ds
+# define BFI_FLINEAR2_2397_TICK(t)
+# define BFI_FLINEAR2_2396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2395, v ds
+# define BFI_FLINEAR2_2396_TICK(t)
+# define BFI_FLINEAR2_2395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2394, v ds
+# define BFI_FLINEAR2_2395_TICK(t)
+# define BFI_FLINEAR2_2394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2393, v ds
+# define BFI_FLINEAR2_2394_TICK(t)
+# define BFI_FLINEAR2_2393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2392, v ds
+# define BFI_FLINEAR2_2393_TICK(t)
+# define BFI_FLINEAR2_2392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2391, v ds
+# define BFI_FLINEAR2_2392_TICK(t)
+# define BFI_FLINEAR2_2391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2390, v ds
+# define BFI_FLINEAR2_2391_TICK(t)
+# define BFI_FLINEAR2_2390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2389, v ds
+# define BFI_FLINEAR2_2390_TICK(t)
+# define BFI_FLINEAR2_2389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2388, v ds
+# define BFI_FLINEAR2_2389_TICK(t)
+# define BFI_FLINEAR2_2388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2387, v ds
+# define BFI_FLINEAR2_2388_TICK(t)
+# define BFI_FLINEAR2_2387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2386, v ds
+# define BFI_FLINEAR2_2387_TICK(t)
+# define BFI_FLINEAR2_2386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2385, v ds
+# define BFI_FLINEAR2_2386_TICK(t)
+# define BFI_FLINEAR2_2385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2384, v ds
+# define BFI_FLINEAR2_2385_TICK(t)
+# define BFI_FLINEAR2_2384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2383, v ds
+# define BFI_FLINEAR2_2384_TICK(t)
+# define BFI_FLINEAR2_2383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2382, v ds
+# define BFI_FLINEAR2_2383_TICK(t)
+# define BFI_FLINEAR2_2382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2381, v ds
+# define BFI_FLINEAR2_2382_TICK(t)
+# define BFI_FLINEAR2_2381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2380, v ds
+# define BFI_FLINEAR2_2381_TICK(t)
+# define BFI_FLINEAR2_2380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2379, v ds
+# define BFI_FLINEAR2_2380_TICK(t)
+# define BFI_FLINEAR2_2379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2378, v ds
+# define BFI_FLINEAR2_2379_TICK(t)
+# define BFI_FLINEAR2_2378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2377, v ds
+# define BFI_FLINEAR2_2378_TICK(t)
+# define BFI_FLINEAR2_2377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2376, v ds
+# define BFI_FLINEAR2_2377_TICK(t)
+# define BFI_FLINEAR2_2376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2375, v ds
+# define BFI_FLINEAR2_2376_TICK(t)
+# define BFI_FLINEAR2_2375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2374, v ds
+# define BFI_FLINEAR2_2375_TICK(t)
+# define BFI_FLINEAR2_2374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2373, v ds
+# define BFI_FLINEAR2_2374_TICK(t)
+# define BFI_FLINEAR2_2373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2372, v ds
+# define BFI_FLINEAR2_2373_TICK(t)
+# define BFI_FLINEAR2_2372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2371, v ds
+# define BFI_FLINEAR2_2372_TICK(t)
+# define BFI_FLINEAR2_2371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2370, v ds
+# define BFI_FLINEAR2_2371_TICK(t)
+# define BFI_FLINEAR2_2370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2369, v ds
+# define BFI_FLINEAR2_2370_TICK(t)
+# define BFI_FLINEAR2_2369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2368, v ds
+# define BFI_FLINEAR2_2369_TICK(t)
+# define BFI_FLINEAR2_2368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2367, v ds
+# define BFI_FLINEAR2_2368_TICK(t)
+# define BFI_FLINEAR2_2367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2366, v ds
+# define BFI_FLINEAR2_2367_TICK(t)
+# define BFI_FLINEAR2_2366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2365, v ds
+# define BFI_FLINEAR2_2366_TICK(t)
+# define BFI_FLINEAR2_2365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2364, v ds
+# define BFI_FLINEAR2_2365_TICK(t)
+# define BFI_FLINEAR2_2364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2363, v ds
+# define BFI_FLINEAR2_2364_TICK(t)
+# define BFI_FLINEAR2_2363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2362, v ds
+# define BFI_FLINEAR2_2363_TICK(t)
+# define BFI_FLINEAR2_2362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2361, v ds
+# define BFI_FLINEAR2_2362_TICK(t)
+# define BFI_FLINEAR2_2361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2360, v ds
+# define BFI_FLINEAR2_2361_TICK(t)
+# define BFI_FLINEAR2_2360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2359, v ds
+# define BFI_FLINEAR2_2360_TICK(t)
+# define BFI_FLINEAR2_2359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2358, v ds
+# define BFI_FLINEAR2_2359_TICK(t)
+# define BFI_FLINEAR2_2358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2357, v ds
+# define BFI_FLINEAR2_2358_TICK(t)
+# define BFI_FLINEAR2_2357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2356, v ds
+# define BFI_FLINEAR2_2357_TICK(t)
+# define BFI_FLINEAR2_2356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2355, v ds
+# define BFI_FLINEAR2_2356_TICK(t)
+# define BFI_FLINEAR2_2355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2354, v ds
+# define BFI_FLINEAR2_2355_TICK(t)
+# define BFI_FLINEAR2_2354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2353, v ds
+# define BFI_FLINEAR2_2354_TICK(t)
+# define BFI_FLINEAR2_2353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2352, v ds
+# define BFI_FLINEAR2_2353_TICK(t)
+# define BFI_FLINEAR2_2352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2351, v ds
+# define BFI_FLINEAR2_2352_TICK(t)
+# define BFI_FLINEAR2_2351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2350, v ds
+# define BFI_FLINEAR2_2351_TICK(t)
+# define BFI_FLINEAR2_2350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2349, v ds
+# define BFI_FLINEAR2_2350_TICK(t)
+# define BFI_FLINEAR2_2349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2348, v ds
+# define BFI_FLINEAR2_2349_TICK(t)
+# define BFI_FLINEAR2_2348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2347, v ds
+# define BFI_FLINEAR2_2348_TICK(t)
+# define BFI_FLINEAR2_2347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2346, v ds
+# define BFI_FLINEAR2_2347_TICK(t)
+# define BFI_FLINEAR2_2346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2345, v ds
+# define BFI_FLINEAR2_2346_TICK(t)
+# define BFI_FLINEAR2_2345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2344, v ds
+# define BFI_FLINEAR2_2345_TICK(t)
+# define BFI_FLINEAR2_2344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2343, v ds
+# define BFI_FLINEAR2_2344_TICK(t)
+# define BFI_FLINEAR2_2343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2342, v ds
+# define BFI_FLINEAR2_2343_TICK(t)
+# define BFI_FLINEAR2_2342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2341, v ds
+# define BFI_FLINEAR2_2342_TICK(t)
+# define BFI_FLINEAR2_2341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2340, v ds
+# define BFI_FLINEAR2_2341_TICK(t)
+# define BFI_FLINEAR2_2340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2339, v ds
+# define BFI_FLINEAR2_2340_TICK(t)
+# define BFI_FLINEAR2_2339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2338, v ds
+# define BFI_FLINEAR2_2339_TICK(t)
+# define BFI_FLINEAR2_2338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2337, v ds
+# define BFI_FLINEAR2_2338_TICK(t)
+# define BFI_FLINEAR2_2337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2336, v ds
+# define BFI_FLINEAR2_2337_TICK(t)
+# define BFI_FLINEAR2_2336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2335, v ds
+# define BFI_FLINEAR2_2336_TICK(t)
+# define BFI_FLINEAR2_2335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2334, v ds
+# define BFI_FLINEAR2_2335_TICK(t)
+# define BFI_FLINEAR2_2334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2333, v ds
+# define BFI_FLINEAR2_2334_TICK(t)
+# define BFI_FLINEAR2_2333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2332, v ds
+# define BFI_FLINEAR2_2333_TICK(t)
+# define BFI_FLINEAR2_2332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2331, v ds
+# define BFI_FLINEAR2_2332_TICK(t)
+# define BFI_FLINEAR2_2331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2330, v ds
+# define BFI_FLINEAR2_2331_TICK(t)
+# define BFI_FLINEAR2_2330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2329, v ds
+# define BFI_FLINEAR2_2330_TICK(t)
+# define BFI_FLINEAR2_2329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2328, v ds
+# define BFI_FLINEAR2_2329_TICK(t)
+# define BFI_FLINEAR2_2328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2327, v ds
+# define BFI_FLINEAR2_2328_TICK(t)
+# define BFI_FLINEAR2_2327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2326, v ds
+# define BFI_FLINEAR2_2327_TICK(t)
+# define BFI_FLINEAR2_2326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2325, v ds
+# define BFI_FLINEAR2_2326_TICK(t)
+# define BFI_FLINEAR2_2325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2324, v ds
+# define BFI_FLINEAR2_2325_TICK(t)
+# define BFI_FLINEAR2_2324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2323, v ds
+# define BFI_FLINEAR2_2324_TICK(t)
+# define BFI_FLINEAR2_2323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2322, v ds
+# define BFI_FLINEAR2_2323_TICK(t)
+# define BFI_FLINEAR2_2322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2321, v ds
+# define BFI_FLINEAR2_2322_TICK(t)
+# define BFI_FLINEAR2_2321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2320, v ds
+# define BFI_FLINEAR2_2321_TICK(t)
+# define BFI_FLINEAR2_2320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2319, v ds
+# define BFI_FLINEAR2_2320_TICK(t)
+# define BFI_FLINEAR2_2319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2318, v ds
+# define BFI_FLINEAR2_2319_TICK(t)
+# define BFI_FLINEAR2_2318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2317, v ds
+# define BFI_FLINEAR2_2318_TICK(t)
+# define BFI_FLINEAR2_2317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2316, v ds
+# define BFI_FLINEAR2_2317_TICK(t)
+# define BFI_FLINEAR2_2316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2315, v ds
+# define BFI_FLINEAR2_2316_TICK(t)
+# define BFI_FLINEAR2_2315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2314, v ds
+# define BFI_FLINEAR2_2315_TICK(t)
+# define BFI_FLINEAR2_2314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2313, v ds
+# define BFI_FLINEAR2_2314_TICK(t)
+# define BFI_FLINEAR2_2313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2312, v ds
+# define BFI_FLINEAR2_2313_TICK(t)
+# define BFI_FLINEAR2_2312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2311, v ds
+# define BFI_FLINEAR2_2312_TICK(t)
+# define BFI_FLINEAR2_2311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2310, v ds
+# define BFI_FLINEAR2_2311_TICK(t)
+# define BFI_FLINEAR2_2310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2309, v ds
+# define BFI_FLINEAR2_2310_TICK(t)
+# define BFI_FLINEAR2_2309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2308, v ds
+# define BFI_FLINEAR2_2309_TICK(t)
+# define BFI_FLINEAR2_2308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2307, v ds
+# define BFI_FLINEAR2_2308_TICK(t)
+# define BFI_FLINEAR2_2307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2306, v ds
+# define BFI_FLINEAR2_2307_TICK(t)
+# define BFI_FLINEAR2_2306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2305, v ds
+# define BFI_FLINEAR2_2306_TICK(t)
+# define BFI_FLINEAR2_2305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2304, v ds
+# define BFI_FLINEAR2_2305_TICK(t)
+# define BFI_FLINEAR2_2304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2303, v ds
+# define BFI_FLINEAR2_2304_TICK(t)
+# define BFI_FLINEAR2_2303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2302, v ds
+# define BFI_FLINEAR2_2303_TICK(t)
+# define BFI_FLINEAR2_2302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2301, v ds
+# define BFI_FLINEAR2_2302_TICK(t)
+# define BFI_FLINEAR2_2301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2300, v ds
+# define BFI_FLINEAR2_2301_TICK(t)
+# define BFI_FLINEAR2_2300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2299, v ds
+# define BFI_FLINEAR2_2300_TICK(t)
+# define BFI_FLINEAR2_2299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2298, v ds
+# define BFI_FLINEAR2_2299_TICK(t)
+# define BFI_FLINEAR2_2298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2297, v ds
+# define BFI_FLINEAR2_2298_TICK(t)
+# define BFI_FLINEAR2_2297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2296, v ds
+# define BFI_FLINEAR2_2297_TICK(t)
+# define BFI_FLINEAR2_2296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2295, v ds
+# define BFI_FLINEAR2_2296_TICK(t)
+# define BFI_FLINEAR2_2295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2294, v ds
+# define BFI_FLINEAR2_2295_TICK(t)
+# define BFI_FLINEAR2_2294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2293, v ds
+# define BFI_FLINEAR2_2294_TICK(t)
+# define BFI_FLINEAR2_2293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2292, v ds
+# define BFI_FLINEAR2_2293_TICK(t)
+# define BFI_FLINEAR2_2292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2291, v ds
+# define BFI_FLINEAR2_2292_TICK(t)
+# define BFI_FLINEAR2_2291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2290, v ds
+# define BFI_FLINEAR2_2291_TICK(t)
+# define BFI_FLINEAR2_2290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2289, v ds
+# define BFI_FLINEAR2_2290_TICK(t)
+# define BFI_FLINEAR2_2289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2288, v ds
+# define BFI_FLINEAR2_2289_TICK(t)
+# define BFI_FLINEAR2_2288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2287, v ds
+# define BFI_FLINEAR2_2288_TICK(t)
+# define BFI_FLINEAR2_2287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2286, v ds
+# define BFI_FLINEAR2_2287_TICK(t)
+# define BFI_FLINEAR2_2286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2285, v ds
+# define BFI_FLINEAR2_2286_TICK(t)
+# define BFI_FLINEAR2_2285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2284, v ds
+# define BFI_FLINEAR2_2285_TICK(t)
+# define BFI_FLINEAR2_2284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2283, v ds
+# define BFI_FLINEAR2_2284_TICK(t)
+# define BFI_FLINEAR2_2283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2282, v ds
+# define BFI_FLINEAR2_2283_TICK(t)
+# define BFI_FLINEAR2_2282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2281, v ds
+# define BFI_FLINEAR2_2282_TICK(t)
+# define BFI_FLINEAR2_2281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2280, v ds
+# define BFI_FLINEAR2_2281_TICK(t)
+# define BFI_FLINEAR2_2280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2279, v ds
+# define BFI_FLINEAR2_2280_TICK(t)
+# define BFI_FLINEAR2_2279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2278, v ds
+# define BFI_FLINEAR2_2279_TICK(t)
+# define BFI_FLINEAR2_2278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2277, v ds
+# define BFI_FLINEAR2_2278_TICK(t)
+# define BFI_FLINEAR2_2277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2276, v ds
+# define BFI_FLINEAR2_2277_TICK(t)
+# define BFI_FLINEAR2_2276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2275, v ds
+# define BFI_FLINEAR2_2276_TICK(t)
+# define BFI_FLINEAR2_2275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2274, v ds
+# define BFI_FLINEAR2_2275_TICK(t)
+# define BFI_FLINEAR2_2274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2273, v ds
+# define BFI_FLINEAR2_2274_TICK(t)
+# define BFI_FLINEAR2_2273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2272, v ds
+# define BFI_FLINEAR2_2273_TICK(t)
+# define BFI_FLINEAR2_2272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2271, v ds
+# define BFI_FLINEAR2_2272_TICK(t)
+# define BFI_FLINEAR2_2271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2270, v ds
+# define BFI_FLINEAR2_2271_TICK(t)
+# define BFI_FLINEAR2_2270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2269, v ds
+# define BFI_FLINEAR2_2270_TICK(t)
+# define BFI_FLINEAR2_2269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2268, v ds
+# define BFI_FLINEAR2_2269_TICK(t)
+# define BFI_FLINEAR2_2268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2267, v ds
+# define BFI_FLINEAR2_2268_TICK(t)
+# define BFI_FLINEAR2_2267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2266, v ds
+# define BFI_FLINEAR2_2267_TICK(t)
+# define BFI_FLINEAR2_2266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2265, v ds
+# define BFI_FLINEAR2_2266_TICK(t)
+# define BFI_FLINEAR2_2265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2264, v ds
+# define BFI_FLINEAR2_2265_TICK(t)
+# define BFI_FLINEAR2_2264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2263, v ds
+# define BFI_FLINEAR2_2264_TICK(t)
+# define BFI_FLINEAR2_2263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2262, v ds
+# define BFI_FLINEAR2_2263_TICK(t)
+# define BFI_FLINEAR2_2262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2261, v ds
+# define BFI_FLINEAR2_2262_TICK(t)
+# define BFI_FLINEAR2_2261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2260, v ds
+# define BFI_FLINEAR2_2261_TICK(t)
+# define BFI_FLINEAR2_2260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2259, v ds
+# define BFI_FLINEAR2_2260_TICK(t)
+# define BFI_FLINEAR2_2259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2258, v ds
+# define BFI_FLINEAR2_2259_TICK(t)
+# define BFI_FLINEAR2_2258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2257, v ds
+# define BFI_FLINEAR2_2258_TICK(t)
+# define BFI_FLINEAR2_2257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2256, v ds
+# define BFI_FLINEAR2_2257_TICK(t)
+# define BFI_FLINEAR2_2256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2255, v ds
+# define BFI_FLINEAR2_2256_TICK(t)
+# define BFI_FLINEAR2_2255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2254, v ds
+# define BFI_FLINEAR2_2255_TICK(t)
+# define BFI_FLINEAR2_2254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2253, v ds
+# define BFI_FLINEAR2_2254_TICK(t)
+# define BFI_FLINEAR2_2253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2252, v ds
+# define BFI_FLINEAR2_2253_TICK(t)
+# define BFI_FLINEAR2_2252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2251, v ds
+# define BFI_FLINEAR2_2252_TICK(t)
+# define BFI_FLINEAR2_2251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2250, v ds
+# define BFI_FLINEAR2_2251_TICK(t)
+# define BFI_FLINEAR2_2250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2249, v ds
+# define BFI_FLINEAR2_2250_TICK(t)
+# define BFI_FLINEAR2_2249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2248, v ds
+# define BFI_FLINEAR2_2249_TICK(t)
+# define BFI_FLINEAR2_2248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2247, v ds
+# define BFI_FLINEAR2_2248_TICK(t)
+# define BFI_FLINEAR2_2247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2246, v ds
+# define BFI_FLINEAR2_2247_TICK(t)
+# define BFI_FLINEAR2_2246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2245, v ds
+# define BFI_FLINEAR2_2246_TICK(t)
+# define BFI_FLINEAR2_2245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2244, v ds
+# define BFI_FLINEAR2_2245_TICK(t)
+# define BFI_FLINEAR2_2244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2243, v ds
+# define BFI_FLINEAR2_2244_TICK(t)
+# define BFI_FLINEAR2_2243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2242, v ds
+# define BFI_FLINEAR2_2243_TICK(t)
+# define BFI_FLINEAR2_2242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2241, v ds
+# define BFI_FLINEAR2_2242_TICK(t)
+# define BFI_FLINEAR2_2241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2240, v ds
+# define BFI_FLINEAR2_2241_TICK(t)
+# define BFI_FLINEAR2_2240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2239, v ds
+# define BFI_FLINEAR2_2240_TICK(t)
+# define BFI_FLINEAR2_2239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2238, v ds
+# define BFI_FLINEAR2_2239_TICK(t)
+# define BFI_FLINEAR2_2238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2237, v ds
+# define BFI_FLINEAR2_2238_TICK(t)
+# define BFI_FLINEAR2_2237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2236, v ds
+# define BFI_FLINEAR2_2237_TICK(t)
+# define BFI_FLINEAR2_2236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2235, v ds
+# define BFI_FLINEAR2_2236_TICK(t)
+# define BFI_FLINEAR2_2235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2234, v ds
+# define BFI_FLINEAR2_2235_TICK(t)
+# define BFI_FLINEAR2_2234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2233, v ds
+# define BFI_FLINEAR2_2234_TICK(t)
+# define BFI_FLINEAR2_2233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2232, v ds
+# define BFI_FLINEAR2_2233_TICK(t)
+# define BFI_FLINEAR2_2232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2231, v ds
+# define BFI_FLINEAR2_2232_TICK(t)
+# define BFI_FLINEAR2_2231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2230, v ds
+# define BFI_FLINEAR2_2231_TICK(t)
+# define BFI_FLINEAR2_2230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2229, v ds
+# define BFI_FLINEAR2_2230_TICK(t)
+# define BFI_FLINEAR2_2229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2228, v ds
+# define BFI_FLINEAR2_2229_TICK(t)
+# define BFI_FLINEAR2_2228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2227, v ds
+# define BFI_FLINEAR2_2228_TICK(t)
+# define BFI_FLINEAR2_2227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2226, v ds
+# define BFI_FLINEAR2_2227_TICK(t)
+# define BFI_FLINEAR2_2226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2225, v ds
+# define BFI_FLINEAR2_2226_TICK(t)
+# define BFI_FLINEAR2_2225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2224, v ds
+# define BFI_FLINEAR2_2225_TICK(t)
+# define BFI_FLINEAR2_2224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2223, v ds
+# define BFI_FLINEAR2_2224_TICK(t)
+# define BFI_FLINEAR2_2223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2222, v ds
+# define BFI_FLINEAR2_2223_TICK(t)
+# define BFI_FLINEAR2_2222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2221, v ds
+# define BFI_FLINEAR2_2222_TICK(t)
+# define BFI_FLINEAR2_2221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2220, v ds
+# define BFI_FLINEAR2_2221_TICK(t)
+# define BFI_FLINEAR2_2220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2219, v ds
+# define BFI_FLINEAR2_2220_TICK(t)
+# define BFI_FLINEAR2_2219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2218, v ds
+# define BFI_FLINEAR2_2219_TICK(t)
+# define BFI_FLINEAR2_2218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2217, v ds
+# define BFI_FLINEAR2_2218_TICK(t)
+# define BFI_FLINEAR2_2217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2216, v ds
+# define BFI_FLINEAR2_2217_TICK(t)
+# define BFI_FLINEAR2_2216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2215, v ds
+# define BFI_FLINEAR2_2216_TICK(t)
+# define BFI_FLINEAR2_2215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2214, v ds
+# define BFI_FLINEAR2_2215_TICK(t)
+# define BFI_FLINEAR2_2214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2213, v ds
+# define BFI_FLINEAR2_2214_TICK(t)
+# define BFI_FLINEAR2_2213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2212, v ds
+# define BFI_FLINEAR2_2213_TICK(t)
+# define BFI_FLINEAR2_2212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2211, v ds
+# define BFI_FLINEAR2_2212_TICK(t)
+# define BFI_FLINEAR2_2211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2210, v ds
+# define BFI_FLINEAR2_2211_TICK(t)
+# define BFI_FLINEAR2_2210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2209, v ds
+# define BFI_FLINEAR2_2210_TICK(t)
+# define BFI_FLINEAR2_2209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2208, v ds
+# define BFI_FLINEAR2_2209_TICK(t)
+# define BFI_FLINEAR2_2208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2207, v ds
+# define BFI_FLINEAR2_2208_TICK(t)
+# define BFI_FLINEAR2_2207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2206, v ds
+# define BFI_FLINEAR2_2207_TICK(t)
+# define BFI_FLINEAR2_2206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2205, v ds
+# define BFI_FLINEAR2_2206_TICK(t)
+# define BFI_FLINEAR2_2205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2204, v ds
+# define BFI_FLINEAR2_2205_TICK(t)
+# define BFI_FLINEAR2_2204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2203, v ds
+# define BFI_FLINEAR2_2204_TICK(t)
+# define BFI_FLINEAR2_2203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2202, v ds
+# define BFI_FLINEAR2_2203_TICK(t)
+# define BFI_FLINEAR2_2202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2201, v ds
+# define BFI_FLINEAR2_2202_TICK(t)
+# define BFI_FLINEAR2_2201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2200, v ds
+# define BFI_FLINEAR2_2201_TICK(t)
+# define BFI_FLINEAR2_2200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2199, v ds
+# define BFI_FLINEAR2_2200_TICK(t)
+# define BFI_FLINEAR2_2199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2198, v ds
+# define BFI_FLINEAR2_2199_TICK(t)
+# define BFI_FLINEAR2_2198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2197, v ds
+# define BFI_FLINEAR2_2198_TICK(t)
+# define BFI_FLINEAR2_2197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2196, v ds
+# define BFI_FLINEAR2_2197_TICK(t)
+# define BFI_FLINEAR2_2196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2195, v ds
+# define BFI_FLINEAR2_2196_TICK(t)
+# define BFI_FLINEAR2_2195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2194, v ds
+# define BFI_FLINEAR2_2195_TICK(t)
+# define BFI_FLINEAR2_2194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2193, v ds
+# define BFI_FLINEAR2_2194_TICK(t)
+# define BFI_FLINEAR2_2193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2192, v ds
+# define BFI_FLINEAR2_2193_TICK(t)
+# define BFI_FLINEAR2_2192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2191, v ds
+# define BFI_FLINEAR2_2192_TICK(t)
+# define BFI_FLINEAR2_2191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2190, v ds
+# define BFI_FLINEAR2_2191_TICK(t)
+# define BFI_FLINEAR2_2190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2189, v ds
+# define BFI_FLINEAR2_2190_TICK(t)
+# define BFI_FLINEAR2_2189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2188, v ds
+# define BFI_FLINEAR2_2189_TICK(t)
+# define BFI_FLINEAR2_2188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2187, v ds
+# define BFI_FLINEAR2_2188_TICK(t)
+# define BFI_FLINEAR2_2187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2186, v ds
+# define BFI_FLINEAR2_2187_TICK(t)
+# define BFI_FLINEAR2_2186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2185, v ds
+# define BFI_FLINEAR2_2186_TICK(t)
+# define BFI_FLINEAR2_2185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2184, v ds
+# define BFI_FLINEAR2_2185_TICK(t)
+# define BFI_FLINEAR2_2184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2183, v ds
+# define BFI_FLINEAR2_2184_TICK(t)
+# define BFI_FLINEAR2_2183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2182, v ds
+# define BFI_FLINEAR2_2183_TICK(t)
+# define BFI_FLINEAR2_2182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2181, v ds
+# define BFI_FLINEAR2_2182_TICK(t)
+# define BFI_FLINEAR2_2181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2180, v ds
+# define BFI_FLINEAR2_2181_TICK(t)
+# define BFI_FLINEAR2_2180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2179, v ds
+# define BFI_FLINEAR2_2180_TICK(t)
+# define BFI_FLINEAR2_2179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2178, v ds
+# define BFI_FLINEAR2_2179_TICK(t)
+# define BFI_FLINEAR2_2178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2177, v ds
+# define BFI_FLINEAR2_2178_TICK(t)
+# define BFI_FLINEAR2_2177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2176, v ds
+# define BFI_FLINEAR2_2177_TICK(t)
+# define BFI_FLINEAR2_2176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2175, v ds
+# define BFI_FLINEAR2_2176_TICK(t)
+# define BFI_FLINEAR2_2175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2174, v ds
+# define BFI_FLINEAR2_2175_TICK(t)
+# define BFI_FLINEAR2_2174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2173, v ds
+# define BFI_FLINEAR2_2174_TICK(t)
+# define BFI_FLINEAR2_2173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2172, v ds
+# define BFI_FLINEAR2_2173_TICK(t)
+# define BFI_FLINEAR2_2172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2171, v ds
+# define BFI_FLINEAR2_2172_TICK(t)
+# define BFI_FLINEAR2_2171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2170, v ds
+# define BFI_FLINEAR2_2171_TICK(t)
+# define BFI_FLINEAR2_2170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2169, v ds
+# define BFI_FLINEAR2_2170_TICK(t)
+# define BFI_FLINEAR2_2169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2168, v ds
+# define BFI_FLINEAR2_2169_TICK(t)
+# define BFI_FLINEAR2_2168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2167, v ds
+# define BFI_FLINEAR2_2168_TICK(t)
+# define BFI_FLINEAR2_2167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2166, v ds
+# define BFI_FLINEAR2_2167_TICK(t)
+# define BFI_FLINEAR2_2166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2165, v ds
+# define BFI_FLINEAR2_2166_TICK(t)
+# define BFI_FLINEAR2_2165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2164, v ds
+# define BFI_FLINEAR2_2165_TICK(t)
+# define BFI_FLINEAR2_2164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2163, v ds
+# define BFI_FLINEAR2_2164_TICK(t)
+# define BFI_FLINEAR2_2163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2162, v ds
+# define BFI_FLINEAR2_2163_TICK(t)
+# define BFI_FLINEAR2_2162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2161, v ds
+# define BFI_FLINEAR2_2162_TICK(t)
+# define BFI_FLINEAR2_2161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2160, v ds
+# define BFI_FLINEAR2_2161_TICK(t)
+# define BFI_FLINEAR2_2160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2159, v ds
+# define BFI_FLINEAR2_2160_TICK(t)
+# define BFI_FLINEAR2_2159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2158, v ds
+# define BFI_FLINEAR2_2159_TICK(t)
+# define BFI_FLINEAR2_2158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2157, v ds
+# define BFI_FLINEAR2_2158_TICK(t)
+# define BFI_FLINEAR2_2157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2156, v ds
+# define BFI_FLINEAR2_2157_TICK(t)
+# define BFI_FLINEAR2_2156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2155, v ds
+# define BFI_FLINEAR2_2156_TICK(t)
+# define BFI_FLINEAR2_2155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2154, v ds
+# define BFI_FLINEAR2_2155_TICK(t)
+# define BFI_FLINEAR2_2154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2153, v ds
+# define BFI_FLINEAR2_2154_TICK(t)
+# define BFI_FLINEAR2_2153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2152, v ds
+# define BFI_FLINEAR2_2153_TICK(t)
+# define BFI_FLINEAR2_2152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2151, v ds
+# define BFI_FLINEAR2_2152_TICK(t)
+# define BFI_FLINEAR2_2151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2150, v ds
+# define BFI_FLINEAR2_2151_TICK(t)
+# define BFI_FLINEAR2_2150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2149, v ds
+# define BFI_FLINEAR2_2150_TICK(t)
+# define BFI_FLINEAR2_2149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2148, v ds
+# define BFI_FLINEAR2_2149_TICK(t)
+# define BFI_FLINEAR2_2148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2147, v ds
+# define BFI_FLINEAR2_2148_TICK(t)
+# define BFI_FLINEAR2_2147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2146, v ds
+# define BFI_FLINEAR2_2147_TICK(t)
+# define BFI_FLINEAR2_2146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2145, v ds
+# define BFI_FLINEAR2_2146_TICK(t)
+# define BFI_FLINEAR2_2145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2144, v ds
+# define BFI_FLINEAR2_2145_TICK(t)
+# define BFI_FLINEAR2_2144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2143, v ds
+# define BFI_FLINEAR2_2144_TICK(t)
+# define BFI_FLINEAR2_2143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2142, v ds
+# define BFI_FLINEAR2_2143_TICK(t)
+# define BFI_FLINEAR2_2142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2141, v ds
+# define BFI_FLINEAR2_2142_TICK(t)
+# define BFI_FLINEAR2_2141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2140, v ds
+# define BFI_FLINEAR2_2141_TICK(t)
+# define BFI_FLINEAR2_2140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2139, v ds
+# define BFI_FLINEAR2_2140_TICK(t)
+# define BFI_FLINEAR2_2139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2138, v ds
+# define BFI_FLINEAR2_2139_TICK(t)
+# define BFI_FLINEAR2_2138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2137, v ds
+# define BFI_FLINEAR2_2138_TICK(t)
+# define BFI_FLINEAR2_2137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2136, v ds
+# define BFI_FLINEAR2_2137_TICK(t)
+# define BFI_FLINEAR2_2136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2135, v ds
+# define BFI_FLINEAR2_2136_TICK(t)
+# define BFI_FLINEAR2_2135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2134, v ds
+# define BFI_FLINEAR2_2135_TICK(t)
+# define BFI_FLINEAR2_2134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2133, v ds
+# define BFI_FLINEAR2_2134_TICK(t)
+# define BFI_FLINEAR2_2133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2132, v ds
+# define BFI_FLINEAR2_2133_TICK(t)
+# define BFI_FLINEAR2_2132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2131, v ds
+# define BFI_FLINEAR2_2132_TICK(t)
+# define BFI_FLINEAR2_2131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2130, v ds
+# define BFI_FLINEAR2_2131_TICK(t)
+# define BFI_FLINEAR2_2130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2129, v ds
+# define BFI_FLINEAR2_2130_TICK(t)
+# define BFI_FLINEAR2_2129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2128, v ds
+# define BFI_FLINEAR2_2129_TICK(t)
+# define BFI_FLINEAR2_2128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2127, v ds
+# define BFI_FLINEAR2_2128_TICK(t)
+# define BFI_FLINEAR2_2127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2126, v ds
+# define BFI_FLINEAR2_2127_TICK(t)
+# define BFI_FLINEAR2_2126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2125, v ds
+# define BFI_FLINEAR2_2126_TICK(t)
+# define BFI_FLINEAR2_2125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2124, v ds
+# define BFI_FLINEAR2_2125_TICK(t)
+# define BFI_FLINEAR2_2124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2123, v ds
+# define BFI_FLINEAR2_2124_TICK(t)
+# define BFI_FLINEAR2_2123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2122, v ds
+# define BFI_FLINEAR2_2123_TICK(t)
+# define BFI_FLINEAR2_2122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2121, v ds
+# define BFI_FLINEAR2_2122_TICK(t)
+# define BFI_FLINEAR2_2121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2120, v ds
+# define BFI_FLINEAR2_2121_TICK(t)
+# define BFI_FLINEAR2_2120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2119, v ds
+# define BFI_FLINEAR2_2120_TICK(t)
+# define BFI_FLINEAR2_2119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2118, v ds
+# define BFI_FLINEAR2_2119_TICK(t)
+# define BFI_FLINEAR2_2118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2117, v ds
+# define BFI_FLINEAR2_2118_TICK(t)
+# define BFI_FLINEAR2_2117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2116, v ds
+# define BFI_FLINEAR2_2117_TICK(t)
+# define BFI_FLINEAR2_2116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2115, v ds
+# define BFI_FLINEAR2_2116_TICK(t)
+# define BFI_FLINEAR2_2115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2114, v ds
+# define BFI_FLINEAR2_2115_TICK(t)
+# define BFI_FLINEAR2_2114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2113, v ds
+# define BFI_FLINEAR2_2114_TICK(t)
+# define BFI_FLINEAR2_2113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2112, v ds
+# define BFI_FLINEAR2_2113_TICK(t)
+# define BFI_FLINEAR2_2112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2111, v ds
+# define BFI_FLINEAR2_2112_TICK(t)
+# define BFI_FLINEAR2_2111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2110, v ds
+# define BFI_FLINEAR2_2111_TICK(t)
+# define BFI_FLINEAR2_2110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2109, v ds
+# define BFI_FLINEAR2_2110_TICK(t)
+# define BFI_FLINEAR2_2109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2108, v ds
+# define BFI_FLINEAR2_2109_TICK(t)
+# define BFI_FLINEAR2_2108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2107, v ds
+# define BFI_FLINEAR2_2108_TICK(t)
+# define BFI_FLINEAR2_2107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2106, v ds
+# define BFI_FLINEAR2_2107_TICK(t)
+# define BFI_FLINEAR2_2106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2105, v ds
+# define BFI_FLINEAR2_2106_TICK(t)
+# define BFI_FLINEAR2_2105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2104, v ds
+# define BFI_FLINEAR2_2105_TICK(t)
+# define BFI_FLINEAR2_2104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2103, v ds
+# define BFI_FLINEAR2_2104_TICK(t)
+# define BFI_FLINEAR2_2103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2102, v ds
+# define BFI_FLINEAR2_2103_TICK(t)
+# define BFI_FLINEAR2_2102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2101, v ds
+# define BFI_FLINEAR2_2102_TICK(t)
+# define BFI_FLINEAR2_2101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2100, v ds
+# define BFI_FLINEAR2_2101_TICK(t)
+# define BFI_FLINEAR2_2100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2099, v ds
+# define BFI_FLINEAR2_2100_TICK(t)
+# define BFI_FLINEAR2_2099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2098, v ds
+# define BFI_FLINEAR2_2099_TICK(t)
+# define BFI_FLINEAR2_2098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2097, v ds
+# define BFI_FLINEAR2_2098_TICK(t)
+# define BFI_FLINEAR2_2097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2096, v ds
+# define BFI_FLINEAR2_2097_TICK(t)
+# define BFI_FLINEAR2_2096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2095, v ds
+# define BFI_FLINEAR2_2096_TICK(t)
+# define BFI_FLINEAR2_2095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2094, v ds
+# define BFI_FLINEAR2_2095_TICK(t)
+# define BFI_FLINEAR2_2094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2093, v ds
+# define BFI_FLINEAR2_2094_TICK(t)
+# define BFI_FLINEAR2_2093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2092, v ds
+# define BFI_FLINEAR2_2093_TICK(t)
+# define BFI_FLINEAR2_2092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2091, v ds
+# define BFI_FLINEAR2_2092_TICK(t)
+# define BFI_FLINEAR2_2091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2090, v ds
+# define BFI_FLINEAR2_2091_TICK(t)
+# define BFI_FLINEAR2_2090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2089, v ds
+# define BFI_FLINEAR2_2090_TICK(t)
+# define BFI_FLINEAR2_2089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2088, v ds
+# define BFI_FLINEAR2_2089_TICK(t)
+# define BFI_FLINEAR2_2088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2087, v ds
+# define BFI_FLINEAR2_2088_TICK(t)
+# define BFI_FLINEAR2_2087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2086, v ds
+# define BFI_FLINEAR2_2087_TICK(t)
+# define BFI_FLINEAR2_2086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2085, v ds
+# define BFI_FLINEAR2_2086_TICK(t)
+# define BFI_FLINEAR2_2085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2084, v ds
+# define BFI_FLINEAR2_2085_TICK(t)
+# define BFI_FLINEAR2_2084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2083, v ds
+# define BFI_FLINEAR2_2084_TICK(t)
+# define BFI_FLINEAR2_2083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2082, v ds
+# define BFI_FLINEAR2_2083_TICK(t)
+# define BFI_FLINEAR2_2082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2081, v ds
+# define BFI_FLINEAR2_2082_TICK(t)
+# define BFI_FLINEAR2_2081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2080, v ds
+# define BFI_FLINEAR2_2081_TICK(t)
+# define BFI_FLINEAR2_2080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2079, v ds
+# define BFI_FLINEAR2_2080_TICK(t)
+# define BFI_FLINEAR2_2079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2078, v ds
+# define BFI_FLINEAR2_2079_TICK(t)
+# define BFI_FLINEAR2_2078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2077, v ds
+# define BFI_FLINEAR2_2078_TICK(t)
+# define BFI_FLINEAR2_2077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2076, v ds
+# define BFI_FLINEAR2_2077_TICK(t)
+# define BFI_FLINEAR2_2076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2075, v ds
+# define BFI_FLINEAR2_2076_TICK(t)
+# define BFI_FLINEAR2_2075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2074, v ds
+# define BFI_FLINEAR2_2075_TICK(t)
+# define BFI_FLINEAR2_2074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2073, v ds
+# define BFI_FLINEAR2_2074_TICK(t)
+# define BFI_FLINEAR2_2073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2072, v ds
+# define BFI_FLINEAR2_2073_TICK(t)
+# define BFI_FLINEAR2_2072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2071, v ds
+# define BFI_FLINEAR2_2072_TICK(t)
+# define BFI_FLINEAR2_2071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2070, v ds
+# define BFI_FLINEAR2_2071_TICK(t)
+# define BFI_FLINEAR2_2070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2069, v ds
+# define BFI_FLINEAR2_2070_TICK(t)
+# define BFI_FLINEAR2_2069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2068, v ds
+# define BFI_FLINEAR2_2069_TICK(t)
+# define BFI_FLINEAR2_2068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2067, v ds
+# define BFI_FLINEAR2_2068_TICK(t)
+# define BFI_FLINEAR2_2067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2066, v ds
+# define BFI_FLINEAR2_2067_TICK(t)
+# define BFI_FLINEAR2_2066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2065, v ds
+# define BFI_FLINEAR2_2066_TICK(t)
+# define BFI_FLINEAR2_2065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2064, v ds
+# define BFI_FLINEAR2_2065_TICK(t)
+# define BFI_FLINEAR2_2064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2063, v ds
+# define BFI_FLINEAR2_2064_TICK(t)
+# define BFI_FLINEAR2_2063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2062, v ds
+# define BFI_FLINEAR2_2063_TICK(t)
+# define BFI_FLINEAR2_2062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2061, v ds
+# define BFI_FLINEAR2_2062_TICK(t)
+# define BFI_FLINEAR2_2061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2060, v ds
+# define BFI_FLINEAR2_2061_TICK(t)
+# define BFI_FLINEAR2_2060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2059, v ds
+# define BFI_FLINEAR2_2060_TICK(t)
+# define BFI_FLINEAR2_2059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2058, v ds
+# define BFI_FLINEAR2_2059_TICK(t)
+# define BFI_FLINEAR2_2058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2057, v ds
+# define BFI_FLINEAR2_2058_TICK(t)
+# define BFI_FLINEAR2_2057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2056, v ds
+# define BFI_FLINEAR2_2057_TICK(t)
+# define BFI_FLINEAR2_2056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2055, v ds
+# define BFI_FLINEAR2_2056_TICK(t)
+# define BFI_FLINEAR2_2055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2054, v ds
+# define BFI_FLINEAR2_2055_TICK(t)
+# define BFI_FLINEAR2_2054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2053, v ds
+# define BFI_FLINEAR2_2054_TICK(t)
+# define BFI_FLINEAR2_2053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2052, v ds
+# define BFI_FLINEAR2_2053_TICK(t)
+# define BFI_FLINEAR2_2052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2051, v ds
+# define BFI_FLINEAR2_2052_TICK(t)
+# define BFI_FLINEAR2_2051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2050, v ds
+# define BFI_FLINEAR2_2051_TICK(t)
+# define BFI_FLINEAR2_2050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2049, v ds
+# define BFI_FLINEAR2_2050_TICK(t)
+# define BFI_FLINEAR2_2049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2048, v ds
+# define BFI_FLINEAR2_2049_TICK(t)
+# define BFI_FLINEAR2_2048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2047, v ds
+# define BFI_FLINEAR2_2048_TICK(t)
+# define BFI_FLINEAR2_2047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2046, v ds
+# define BFI_FLINEAR2_2047_TICK(t)
+# define BFI_FLINEAR2_2046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2045, v ds
+# define BFI_FLINEAR2_2046_TICK(t)
+# define BFI_FLINEAR2_2045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2044, v ds
+# define BFI_FLINEAR2_2045_TICK(t)
+# define BFI_FLINEAR2_2044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2043, v ds
+# define BFI_FLINEAR2_2044_TICK(t)
+# define BFI_FLINEAR2_2043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2042, v ds
+# define BFI_FLINEAR2_2043_TICK(t)
+# define BFI_FLINEAR2_2042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2041, v ds
+# define BFI_FLINEAR2_2042_TICK(t)
+# define BFI_FLINEAR2_2041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2040, v ds
+# define BFI_FLINEAR2_2041_TICK(t)
+# define BFI_FLINEAR2_2040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2039, v ds
+# define BFI_FLINEAR2_2040_TICK(t)
+# define BFI_FLINEAR2_2039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2038, v ds
+# define BFI_FLINEAR2_2039_TICK(t)
+# define BFI_FLINEAR2_2038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2037, v ds
+# define BFI_FLINEAR2_2038_TICK(t)
+# define BFI_FLINEAR2_2037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2036, v ds
+# define BFI_FLINEAR2_2037_TICK(t)
+# define BFI_FLINEAR2_2036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2035, v ds
+# define BFI_FLINEAR2_2036_TICK(t)
+# define BFI_FLINEAR2_2035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2034, v ds
+# define BFI_FLINEAR2_2035_TICK(t)
+# define BFI_FLINEAR2_2034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2033, v ds
+# define BFI_FLINEAR2_2034_TICK(t)
+# define BFI_FLINEAR2_2033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2032, v ds
+# define BFI_FLINEAR2_2033_TICK(t)
+# define BFI_FLINEAR2_2032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2031, v ds
+# define BFI_FLINEAR2_2032_TICK(t)
+# define BFI_FLINEAR2_2031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2030, v ds
+# define BFI_FLINEAR2_2031_TICK(t)
+# define BFI_FLINEAR2_2030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2029, v ds
+# define BFI_FLINEAR2_2030_TICK(t)
+# define BFI_FLINEAR2_2029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2028, v ds
+# define BFI_FLINEAR2_2029_TICK(t)
+# define BFI_FLINEAR2_2028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2027, v ds
+# define BFI_FLINEAR2_2028_TICK(t)
+# define BFI_FLINEAR2_2027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2026, v ds
+# define BFI_FLINEAR2_2027_TICK(t)
+# define BFI_FLINEAR2_2026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2025, v ds
+# define BFI_FLINEAR2_2026_TICK(t)
+# define BFI_FLINEAR2_2025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2024, v ds
+# define BFI_FLINEAR2_2025_TICK(t)
+# define BFI_FLINEAR2_2024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2023, v ds
+# define BFI_FLINEAR2_2024_TICK(t)
+# define BFI_FLINEAR2_2023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2022, v ds
+# define BFI_FLINEAR2_2023_TICK(t)
+# define BFI_FLINEAR2_2022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2021, v ds
+# define BFI_FLINEAR2_2022_TICK(t)
+# define BFI_FLINEAR2_2021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2020, v ds
+# define BFI_FLINEAR2_2021_TICK(t)
+# define BFI_FLINEAR2_2020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2019, v ds
+# define BFI_FLINEAR2_2020_TICK(t)
+# define BFI_FLINEAR2_2019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2018, v ds
+# define BFI_FLINEAR2_2019_TICK(t)
+# define BFI_FLINEAR2_2018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2017, v ds
+# define BFI_FLINEAR2_2018_TICK(t)
+# define BFI_FLINEAR2_2017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2016, v ds
+# define BFI_FLINEAR2_2017_TICK(t)
+# define BFI_FLINEAR2_2016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2015, v ds
+# define BFI_FLINEAR2_2016_TICK(t)
+# define BFI_FLINEAR2_2015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2014, v ds
+# define BFI_FLINEAR2_2015_TICK(t)
+# define BFI_FLINEAR2_2014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2013, v ds
+# define BFI_FLINEAR2_2014_TICK(t)
+# define BFI_FLINEAR2_2013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2012, v ds
+# define BFI_FLINEAR2_2013_TICK(t)
+# define BFI_FLINEAR2_2012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2011, v ds
+# define BFI_FLINEAR2_2012_TICK(t)
+# define BFI_FLINEAR2_2011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2010, v ds
+# define BFI_FLINEAR2_2011_TICK(t)
+# define BFI_FLINEAR2_2010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2009, v ds
+# define BFI_FLINEAR2_2010_TICK(t)
+# define BFI_FLINEAR2_2009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2008, v ds
+# define BFI_FLINEAR2_2009_TICK(t)
+# define BFI_FLINEAR2_2008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2007, v ds
+# define BFI_FLINEAR2_2008_TICK(t)
+# define BFI_FLINEAR2_2007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2006, v ds
+# define BFI_FLINEAR2_2007_TICK(t)
+# define BFI_FLINEAR2_2006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2005, v ds
+# define BFI_FLINEAR2_2006_TICK(t)
+# define BFI_FLINEAR2_2005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2004, v ds
+# define BFI_FLINEAR2_2005_TICK(t)
+# define BFI_FLINEAR2_2004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2003, v ds
+# define BFI_FLINEAR2_2004_TICK(t)
+# define BFI_FLINEAR2_2003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2002, v ds
+# define BFI_FLINEAR2_2003_TICK(t)
+# define BFI_FLINEAR2_2002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2001, v ds
+# define BFI_FLINEAR2_2002_TICK(t)
+# define BFI_FLINEAR2_2001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2000, v ds
+# define BFI_FLINEAR2_2001_TICK(t)
+# define BFI_FLINEAR2_2000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1999, v ds
+# define BFI_FLINEAR2_2000_TICK(t)
+# define BFI_FLINEAR2_1999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1998, v ds
+# define BFI_FLINEAR2_1999_TICK(t)
+# define BFI_FLINEAR2_1998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1997, v ds
+# define BFI_FLINEAR2_1998_TICK(t)
+# define BFI_FLINEAR2_1997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1996, v ds
+# define BFI_FLINEAR2_1997_TICK(t)
+# define BFI_FLINEAR2_1996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1995, v ds
+# define BFI_FLINEAR2_1996_TICK(t)
+# define BFI_FLINEAR2_1995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1994, v ds
+# define BFI_FLINEAR2_1995_TICK(t)
+# define BFI_FLINEAR2_1994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1993, v ds
+# define BFI_FLINEAR2_1994_TICK(t)
+# define BFI_FLINEAR2_1993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1992, v ds
+# define BFI_FLINEAR2_1993_TICK(t)
+# define BFI_FLINEAR2_1992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1991, v ds
+# define BFI_FLINEAR2_1992_TICK(t)
+# define BFI_FLINEAR2_1991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1990, v ds
+# define BFI_FLINEAR2_1991_TICK(t)
+# define BFI_FLINEAR2_1990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1989, v ds
+# define BFI_FLINEAR2_1990_TICK(t)
+# define BFI_FLINEAR2_1989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1988, v ds
+# define BFI_FLINEAR2_1989_TICK(t)
+# define BFI_FLINEAR2_1988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1987, v ds
+# define BFI_FLINEAR2_1988_TICK(t)
+# define BFI_FLINEAR2_1987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1986, v ds
+# define BFI_FLINEAR2_1987_TICK(t)
+# define BFI_FLINEAR2_1986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1985, v ds
+# define BFI_FLINEAR2_1986_TICK(t)
+# define BFI_FLINEAR2_1985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1984, v ds
+# define BFI_FLINEAR2_1985_TICK(t)
+# define BFI_FLINEAR2_1984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1983, v ds
+# define BFI_FLINEAR2_1984_TICK(t)
+# define BFI_FLINEAR2_1983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1982, v ds
+# define BFI_FLINEAR2_1983_TICK(t)
+# define BFI_FLINEAR2_1982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1981, v ds
+# define BFI_FLINEAR2_1982_TICK(t)
+# define BFI_FLINEAR2_1981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1980, v ds
+# define BFI_FLINEAR2_1981_TICK(t)
+# define BFI_FLINEAR2_1980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1979, v ds
+# define BFI_FLINEAR2_1980_TICK(t)
+# define BFI_FLINEAR2_1979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1978, v ds
+# define BFI_FLINEAR2_1979_TICK(t)
+# define BFI_FLINEAR2_1978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1977, v ds
+# define BFI_FLINEAR2_1978_TICK(t)
+# define BFI_FLINEAR2_1977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1976, v ds
+# define BFI_FLINEAR2_1977_TICK(t)
+# define BFI_FLINEAR2_1976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1975, v ds
+# define BFI_FLINEAR2_1976_TICK(t)
+# define BFI_FLINEAR2_1975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1974, v ds
+# define BFI_FLINEAR2_1975_TICK(t)
+# define BFI_FLINEAR2_1974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1973, v ds
+# define BFI_FLINEAR2_1974_TICK(t)
+# define BFI_FLINEAR2_1973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1972, v ds
+# define BFI_FLINEAR2_1973_TICK(t)
+# define BFI_FLINEAR2_1972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1971, v ds
+# define BFI_FLINEAR2_1972_TICK(t)
+# define BFI_FLINEAR2_1971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1970, v ds
+# define BFI_FLINEAR2_1971_TICK(t)
+# define BFI_FLINEAR2_1970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1969, v ds
+# define BFI_FLINEAR2_1970_TICK(t)
+# define BFI_FLINEAR2_1969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1968, v ds
+# define BFI_FLINEAR2_1969_TICK(t)
+# define BFI_FLINEAR2_1968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1967, v ds
+# define BFI_FLINEAR2_1968_TICK(t)
+# define BFI_FLINEAR2_1967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1966, v ds
+# define BFI_FLINEAR2_1967_TICK(t)
+# define BFI_FLINEAR2_1966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1965, v ds
+# define BFI_FLINEAR2_1966_TICK(t)
+# define BFI_FLINEAR2_1965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1964, v ds
+# define BFI_FLINEAR2_1965_TICK(t)
+# define BFI_FLINEAR2_1964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1963, v ds
+# define BFI_FLINEAR2_1964_TICK(t)
+# define BFI_FLINEAR2_1963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1962, v ds
+# define BFI_FLINEAR2_1963_TICK(t)
+# define BFI_FLINEAR2_1962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1961, v ds
+# define BFI_FLINEAR2_1962_TICK(t)
+# define BFI_FLINEAR2_1961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1960, v ds
+# define BFI_FLINEAR2_1961_TICK(t)
+# define BFI_FLINEAR2_1960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1959, v ds
+# define BFI_FLINEAR2_1960_TICK(t)
+# define BFI_FLINEAR2_1959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1958, v ds
+# define BFI_FLINEAR2_1959_TICK(t)
+# define BFI_FLINEAR2_1958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1957, v ds
+# define BFI_FLINEAR2_1958_TICK(t)
+# define BFI_FLINEAR2_1957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1956, v ds
+# define BFI_FLINEAR2_1957_TICK(t)
+# define BFI_FLINEAR2_1956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1955, v ds
+# define BFI_FLINEAR2_1956_TICK(t)
+# define BFI_FLINEAR2_1955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1954, v ds
+# define BFI_FLINEAR2_1955_TICK(t)
+# define BFI_FLINEAR2_1954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1953, v ds
+# define BFI_FLINEAR2_1954_TICK(t)
+# define BFI_FLINEAR2_1953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1952, v ds
+# define BFI_FLINEAR2_1953_TICK(t)
+# define BFI_FLINEAR2_1952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1951, v ds
+# define BFI_FLINEAR2_1952_TICK(t)
+# define BFI_FLINEAR2_1951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1950, v ds
+# define BFI_FLINEAR2_1951_TICK(t)
+# define BFI_FLINEAR2_1950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1949, v ds
+# define BFI_FLINEAR2_1950_TICK(t)
+# define BFI_FLINEAR2_1949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1948, v ds
+# define BFI_FLINEAR2_1949_TICK(t)
+# define BFI_FLINEAR2_1948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1947, v ds
+# define BFI_FLINEAR2_1948_TICK(t)
+# define BFI_FLINEAR2_1947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1946, v ds
+# define BFI_FLINEAR2_1947_TICK(t)
+# define BFI_FLINEAR2_1946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1945, v ds
+# define BFI_FLINEAR2_1946_TICK(t)
+# define BFI_FLINEAR2_1945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1944, v ds
+# define BFI_FLINEAR2_1945_TICK(t)
+# define BFI_FLINEAR2_1944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1943, v ds
+# define BFI_FLINEAR2_1944_TICK(t)
+# define BFI_FLINEAR2_1943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1942, v ds
+# define BFI_FLINEAR2_1943_TICK(t)
+# define BFI_FLINEAR2_1942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1941, v ds
+# define BFI_FLINEAR2_1942_TICK(t)
+# define BFI_FLINEAR2_1941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1940, v ds
+# define BFI_FLINEAR2_1941_TICK(t)
+# define BFI_FLINEAR2_1940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1939, v ds
+# define BFI_FLINEAR2_1940_TICK(t)
+# define BFI_FLINEAR2_1939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1938, v ds
+# define BFI_FLINEAR2_1939_TICK(t)
+# define BFI_FLINEAR2_1938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1937, v ds
+# define BFI_FLINEAR2_1938_TICK(t)
+# define BFI_FLINEAR2_1937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1936, v ds
+# define BFI_FLINEAR2_1937_TICK(t)
+# define BFI_FLINEAR2_1936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1935, v ds
+# define BFI_FLINEAR2_1936_TICK(t)
+# define BFI_FLINEAR2_1935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1934, v ds
+# define BFI_FLINEAR2_1935_TICK(t)
+# define BFI_FLINEAR2_1934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1933, v ds
+# define BFI_FLINEAR2_1934_TICK(t)
+# define BFI_FLINEAR2_1933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1932, v ds
+# define BFI_FLINEAR2_1933_TICK(t)
+# define BFI_FLINEAR2_1932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1931, v ds
+# define BFI_FLINEAR2_1932_TICK(t)
+# define BFI_FLINEAR2_1931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1930, v ds
+# define BFI_FLINEAR2_1931_TICK(t)
+# define BFI_FLINEAR2_1930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1929, v ds
+# define BFI_FLINEAR2_1930_TICK(t)
+# define BFI_FLINEAR2_1929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1928, v ds
+# define BFI_FLINEAR2_1929_TICK(t)
+# define BFI_FLINEAR2_1928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1927, v ds
+# define BFI_FLINEAR2_1928_TICK(t)
+# define BFI_FLINEAR2_1927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1926, v ds
+# define BFI_FLINEAR2_1927_TICK(t)
+# define BFI_FLINEAR2_1926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1925, v ds
+# define BFI_FLINEAR2_1926_TICK(t)
+# define BFI_FLINEAR2_1925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1924, v ds
+# define BFI_FLINEAR2_1925_TICK(t)
+# define BFI_FLINEAR2_1924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1923, v ds
+# define BFI_FLINEAR2_1924_TICK(t)
+# define BFI_FLINEAR2_1923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1922, v ds
+# define BFI_FLINEAR2_1923_TICK(t)
+# define BFI_FLINEAR2_1922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1921, v ds
+# define BFI_FLINEAR2_1922_TICK(t)
+# define BFI_FLINEAR2_1921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1920, v ds
+# define BFI_FLINEAR2_1921_TICK(t)
+# define BFI_FLINEAR2_1920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1919, v ds
+# define BFI_FLINEAR2_1920_TICK(t)
+# define BFI_FLINEAR2_1919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1918, v ds
+# define BFI_FLINEAR2_1919_TICK(t)
+# define BFI_FLINEAR2_1918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1917, v ds
+# define BFI_FLINEAR2_1918_TICK(t)
+# define BFI_FLINEAR2_1917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1916, v ds
+# define BFI_FLINEAR2_1917_TICK(t)
+# define BFI_FLINEAR2_1916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1915, v ds
+# define BFI_FLINEAR2_1916_TICK(t)
+# define BFI_FLINEAR2_1915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1914, v ds
+# define BFI_FLINEAR2_1915_TICK(t)
+# define BFI_FLINEAR2_1914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1913, v ds
+# define BFI_FLINEAR2_1914_TICK(t)
+# define BFI_FLINEAR2_1913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1912, v ds
+# define BFI_FLINEAR2_1913_TICK(t)
+# define BFI_FLINEAR2_1912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1911, v ds
+# define BFI_FLINEAR2_1912_TICK(t)
+# define BFI_FLINEAR2_1911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1910, v ds
+# define BFI_FLINEAR2_1911_TICK(t)
+# define BFI_FLINEAR2_1910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1909, v ds
+# define BFI_FLINEAR2_1910_TICK(t)
+# define BFI_FLINEAR2_1909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1908, v ds
+# define BFI_FLINEAR2_1909_TICK(t)
+# define BFI_FLINEAR2_1908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1907, v ds
+# define BFI_FLINEAR2_1908_TICK(t)
+# define BFI_FLINEAR2_1907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1906, v ds
+# define BFI_FLINEAR2_1907_TICK(t)
+# define BFI_FLINEAR2_1906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1905, v ds
+# define BFI_FLINEAR2_1906_TICK(t)
+# define BFI_FLINEAR2_1905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1904, v ds
+# define BFI_FLINEAR2_1905_TICK(t)
+# define BFI_FLINEAR2_1904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1903, v ds
+# define BFI_FLINEAR2_1904_TICK(t)
+# define BFI_FLINEAR2_1903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1902, v ds
+# define BFI_FLINEAR2_1903_TICK(t)
+# define BFI_FLINEAR2_1902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1901, v ds
+# define BFI_FLINEAR2_1902_TICK(t)
+# define BFI_FLINEAR2_1901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1900, v ds
+# define BFI_FLINEAR2_1901_TICK(t)
+# define BFI_FLINEAR2_1900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1899, v ds
+# define BFI_FLINEAR2_1900_TICK(t)
+# define BFI_FLINEAR2_1899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1898, v ds
+# define BFI_FLINEAR2_1899_TICK(t)
+# define BFI_FLINEAR2_1898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1897, v ds
+# define BFI_FLINEAR2_1898_TICK(t)
+# define BFI_FLINEAR2_1897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1896, v ds
+# define BFI_FLINEAR2_1897_TICK(t)
+# define BFI_FLINEAR2_1896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1895, v ds
+# define BFI_FLINEAR2_1896_TICK(t)
+# define BFI_FLINEAR2_1895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1894, v ds
+# define BFI_FLINEAR2_1895_TICK(t)
+# define BFI_FLINEAR2_1894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1893, v ds
+# define BFI_FLINEAR2_1894_TICK(t)
+# define BFI_FLINEAR2_1893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1892, v ds
+# define BFI_FLINEAR2_1893_TICK(t)
+# define BFI_FLINEAR2_1892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1891, v ds
+# define BFI_FLINEAR2_1892_TICK(t)
+# define BFI_FLINEAR2_1891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1890, v ds
+# define BFI_FLINEAR2_1891_TICK(t)
+# define BFI_FLINEAR2_1890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1889, v ds
+# define BFI_FLINEAR2_1890_TICK(t)
+# define BFI_FLINEAR2_1889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1888, v ds
+# define BFI_FLINEAR2_1889_TICK(t)
+# define BFI_FLINEAR2_1888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1887, v ds
+# define BFI_FLINEAR2_1888_TICK(t)
+# define BFI_FLINEAR2_1887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1886, v ds
+# define BFI_FLINEAR2_1887_TICK(t)
+# define BFI_FLINEAR2_1886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1885, v ds
+# define BFI_FLINEAR2_1886_TICK(t)
+# define BFI_FLINEAR2_1885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1884, v ds
+# define BFI_FLINEAR2_1885_TICK(t)
+# define BFI_FLINEAR2_1884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1883, v ds
+# define BFI_FLINEAR2_1884_TICK(t)
+# define BFI_FLINEAR2_1883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1882, v ds
+# define BFI_FLINEAR2_1883_TICK(t)
+# define BFI_FLINEAR2_1882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1881, v ds
+# define BFI_FLINEAR2_1882_TICK(t)
+# define BFI_FLINEAR2_1881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1880, v ds
+# define BFI_FLINEAR2_1881_TICK(t)
+# define BFI_FLINEAR2_1880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1879, v ds
+# define BFI_FLINEAR2_1880_TICK(t)
+# define BFI_FLINEAR2_1879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1878, v ds
+# define BFI_FLINEAR2_1879_TICK(t)
+# define BFI_FLINEAR2_1878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1877, v ds
+# define BFI_FLINEAR2_1878_TICK(t)
+# define BFI_FLINEAR2_1877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1876, v ds
+# define BFI_FLINEAR2_1877_TICK(t)
+# define BFI_FLINEAR2_1876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1875, v ds
+# define BFI_FLINEAR2_1876_TICK(t)
+# define BFI_FLINEAR2_1875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1874, v ds
+# define BFI_FLINEAR2_1875_TICK(t)
+# define BFI_FLINEAR2_1874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1873, v ds
+# define BFI_FLINEAR2_1874_TICK(t)
+# define BFI_FLINEAR2_1873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1872, v ds
+# define BFI_FLINEAR2_1873_TICK(t)
+# define BFI_FLINEAR2_1872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1871, v ds
+# define BFI_FLINEAR2_1872_TICK(t)
+# define BFI_FLINEAR2_1871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1870, v ds
+# define BFI_FLINEAR2_1871_TICK(t)
+# define BFI_FLINEAR2_1870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1869, v ds
+# define BFI_FLINEAR2_1870_TICK(t)
+# define BFI_FLINEAR2_1869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1868, v ds
+# define BFI_FLINEAR2_1869_TICK(t)
+# define BFI_FLINEAR2_1868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1867, v ds
+# define BFI_FLINEAR2_1868_TICK(t)
+# define BFI_FLINEAR2_1867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1866, v ds
+# define BFI_FLINEAR2_1867_TICK(t)
+# define BFI_FLINEAR2_1866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1865, v ds
+# define BFI_FLINEAR2_1866_TICK(t)
+# define BFI_FLINEAR2_1865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1864, v ds
+# define BFI_FLINEAR2_1865_TICK(t)
+# define BFI_FLINEAR2_1864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1863, v ds
+# define BFI_FLINEAR2_1864_TICK(t)
+# define BFI_FLINEAR2_1863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1862, v ds
+# define BFI_FLINEAR2_1863_TICK(t)
+# define BFI_FLINEAR2_1862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1861, v ds
+# define BFI_FLINEAR2_1862_TICK(t)
+# define BFI_FLINEAR2_1861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1860, v ds
+# define BFI_FLINEAR2_1861_TICK(t)
+# define BFI_FLINEAR2_1860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1859, v ds
+# define BFI_FLINEAR2_1860_TICK(t)
+# define BFI_FLINEAR2_1859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1858, v ds
+# define BFI_FLINEAR2_1859_TICK(t)
+# define BFI_FLINEAR2_1858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1857, v ds
+# define BFI_FLINEAR2_1858_TICK(t)
+# define BFI_FLINEAR2_1857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1856, v ds
+# define BFI_FLINEAR2_1857_TICK(t)
+# define BFI_FLINEAR2_1856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1855, v ds
+# define BFI_FLINEAR2_1856_TICK(t)
+# define BFI_FLINEAR2_1855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1854, v ds
+# define BFI_FLINEAR2_1855_TICK(t)
+# define BFI_FLINEAR2_1854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1853, v ds
+# define BFI_FLINEAR2_1854_TICK(t)
+# define BFI_FLINEAR2_1853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1852, v ds
+# define BFI_FLINEAR2_1853_TICK(t)
+# define BFI_FLINEAR2_1852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1851, v ds
+# define BFI_FLINEAR2_1852_TICK(t)
+# define BFI_FLINEAR2_1851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1850, v ds
+# define BFI_FLINEAR2_1851_TICK(t)
+# define BFI_FLINEAR2_1850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1849, v ds
+# define BFI_FLINEAR2_1850_TICK(t)
+# define BFI_FLINEAR2_1849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1848, v ds
+# define BFI_FLINEAR2_1849_TICK(t)
+# define BFI_FLINEAR2_1848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1847, v ds
+# define BFI_FLINEAR2_1848_TICK(t)
+# define BFI_FLINEAR2_1847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1846, v ds
+# define BFI_FLINEAR2_1847_TICK(t)
+# define BFI_FLINEAR2_1846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1845, v ds
+# define BFI_FLINEAR2_1846_TICK(t)
+# define BFI_FLINEAR2_1845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1844, v ds
+# define BFI_FLINEAR2_1845_TICK(t)
+# define BFI_FLINEAR2_1844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1843, v ds
+# define BFI_FLINEAR2_1844_TICK(t)
+# define BFI_FLINEAR2_1843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1842, v ds
+# define BFI_FLINEAR2_1843_TICK(t)
+# define BFI_FLINEAR2_1842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1841, v ds
+# define BFI_FLINEAR2_1842_TICK(t)
+# define BFI_FLINEAR2_1841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1840, v ds
+# define BFI_FLINEAR2_1841_TICK(t)
+# define BFI_FLINEAR2_1840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1839, v ds
+# define BFI_FLINEAR2_1840_TICK(t)
+# define BFI_FLINEAR2_1839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1838, v ds
+# define BFI_FLINEAR2_1839_TICK(t)
+# define BFI_FLINEAR2_1838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1837, v ds
+# define BFI_FLINEAR2_1838_TICK(t)
+# define BFI_FLINEAR2_1837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1836, v ds
+# define BFI_FLINEAR2_1837_TICK(t)
+# define BFI_FLINEAR2_1836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1835, v ds
+# define BFI_FLINEAR2_1836_TICK(t)
+# define BFI_FLINEAR2_1835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1834, v ds
+# define BFI_FLINEAR2_1835_TICK(t)
+# define BFI_FLINEAR2_1834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1833, v ds
+# define BFI_FLINEAR2_1834_TICK(t)
+# define BFI_FLINEAR2_1833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1832, v ds
+# define BFI_FLINEAR2_1833_TICK(t)
+# define BFI_FLINEAR2_1832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1831, v ds
+# define BFI_FLINEAR2_1832_TICK(t)
+# define BFI_FLINEAR2_1831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1830, v ds
+# define BFI_FLINEAR2_1831_TICK(t)
+# define BFI_FLINEAR2_1830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1829, v ds
+# define BFI_FLINEAR2_1830_TICK(t)
+# define BFI_FLINEAR2_1829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1828, v ds
+# define BFI_FLINEAR2_1829_TICK(t)
+# define BFI_FLINEAR2_1828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1827, v ds
+# define BFI_FLINEAR2_1828_TICK(t)
+# define BFI_FLINEAR2_1827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1826, v ds
+# define BFI_FLINEAR2_1827_TICK(t)
+# define BFI_FLINEAR2_1826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1825, v ds
+# define BFI_FLINEAR2_1826_TICK(t)
+# define BFI_FLINEAR2_1825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1824, v ds
+# define BFI_FLINEAR2_1825_TICK(t)
+# define BFI_FLINEAR2_1824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1823, v ds
+# define BFI_FLINEAR2_1824_TICK(t)
+# define BFI_FLINEAR2_1823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1822, v ds
+# define BFI_FLINEAR2_1823_TICK(t)
+# define BFI_FLINEAR2_1822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1821, v ds
+# define BFI_FLINEAR2_1822_TICK(t)
+# define BFI_FLINEAR2_1821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1820, v ds
+# define BFI_FLINEAR2_1821_TICK(t)
+# define BFI_FLINEAR2_1820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1819, v ds
+# define BFI_FLINEAR2_1820_TICK(t)
+# define BFI_FLINEAR2_1819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1818, v ds
+# define BFI_FLINEAR2_1819_TICK(t)
+# define BFI_FLINEAR2_1818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1817, v ds
+# define BFI_FLINEAR2_1818_TICK(t)
+# define BFI_FLINEAR2_1817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1816, v ds
+# define BFI_FLINEAR2_1817_TICK(t)
+# define BFI_FLINEAR2_1816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1815, v ds
+# define BFI_FLINEAR2_1816_TICK(t)
+# define BFI_FLINEAR2_1815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1814, v ds
+# define BFI_FLINEAR2_1815_TICK(t)
+# define BFI_FLINEAR2_1814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1813, v ds
+# define BFI_FLINEAR2_1814_TICK(t)
+# define BFI_FLINEAR2_1813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1812, v ds
+# define BFI_FLINEAR2_1813_TICK(t)
+# define BFI_FLINEAR2_1812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1811, v ds
+# define BFI_FLINEAR2_1812_TICK(t)
+# define BFI_FLINEAR2_1811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1810, v ds
+# define BFI_FLINEAR2_1811_TICK(t)
+# define BFI_FLINEAR2_1810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1809, v ds
+# define BFI_FLINEAR2_1810_TICK(t)
+# define BFI_FLINEAR2_1809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1808, v ds
+# define BFI_FLINEAR2_1809_TICK(t)
+# define BFI_FLINEAR2_1808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1807, v ds
+# define BFI_FLINEAR2_1808_TICK(t)
+# define BFI_FLINEAR2_1807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1806, v ds
+# define BFI_FLINEAR2_1807_TICK(t)
+# define BFI_FLINEAR2_1806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1805, v ds
+# define BFI_FLINEAR2_1806_TICK(t)
+# define BFI_FLINEAR2_1805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1804, v ds
+# define BFI_FLINEAR2_1805_TICK(t)
+# define BFI_FLINEAR2_1804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1803, v ds
+# define BFI_FLINEAR2_1804_TICK(t)
+# define BFI_FLINEAR2_1803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1802, v ds
+# define BFI_FLINEAR2_1803_TICK(t)
+# define BFI_FLINEAR2_1802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1801, v ds
+# define BFI_FLINEAR2_1802_TICK(t)
+# define BFI_FLINEAR2_1801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1800, v ds
+# define BFI_FLINEAR2_1801_TICK(t)
+# define BFI_FLINEAR2_1800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1799, v ds
+# define BFI_FLINEAR2_1800_TICK(t)
+# define BFI_FLINEAR2_1799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1798, v ds
+# define BFI_FLINEAR2_1799_TICK(t)
+# define BFI_FLINEAR2_1798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1797, v ds
+# define BFI_FLINEAR2_1798_TICK(t)
+# define BFI_FLINEAR2_1797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1796, v ds
+# define BFI_FLINEAR2_1797_TICK(t)
+# define BFI_FLINEAR2_1796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1795, v ds
+# define BFI_FLINEAR2_1796_TICK(t)
+# define BFI_FLINEAR2_1795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1794, v ds
+# define BFI_FLINEAR2_1795_TICK(t)
+# define BFI_FLINEAR2_1794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1793, v ds
+# define BFI_FLINEAR2_1794_TICK(t)
+# define BFI_FLINEAR2_1793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1792, v ds
+# define BFI_FLINEAR2_1793_TICK(t)
+# define BFI_FLINEAR2_1792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1791, v ds
+# define BFI_FLINEAR2_1792_TICK(t)
+# define BFI_FLINEAR2_1791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1790, v ds
+# define BFI_FLINEAR2_1791_TICK(t)
+# define BFI_FLINEAR2_1790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1789, v ds
+# define BFI_FLINEAR2_1790_TICK(t)
+# define BFI_FLINEAR2_1789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1788, v ds
+# define BFI_FLINEAR2_1789_TICK(t)
+# define BFI_FLINEAR2_1788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1787, v ds
+# define BFI_FLINEAR2_1788_TICK(t)
+# define BFI_FLINEAR2_1787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1786, v ds
+# define BFI_FLINEAR2_1787_TICK(t)
+# define BFI_FLINEAR2_1786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1785, v ds
+# define BFI_FLINEAR2_1786_TICK(t)
+# define BFI_FLINEAR2_1785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1784, v ds
+# define BFI_FLINEAR2_1785_TICK(t)
+# define BFI_FLINEAR2_1784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1783, v ds
+# define BFI_FLINEAR2_1784_TICK(t)
+# define BFI_FLINEAR2_1783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1782, v ds
+# define BFI_FLINEAR2_1783_TICK(t)
+# define BFI_FLINEAR2_1782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1781, v ds
+# define BFI_FLINEAR2_1782_TICK(t)
+# define BFI_FLINEAR2_1781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1780, v ds
+# define BFI_FLINEAR2_1781_TICK(t)
+# define BFI_FLINEAR2_1780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1779, v ds
+# define BFI_FLINEAR2_1780_TICK(t)
+# define BFI_FLINEAR2_1779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1778, v ds
+# define BFI_FLINEAR2_1779_TICK(t)
+# define BFI_FLINEAR2_1778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1777, v ds
+# define BFI_FLINEAR2_1778_TICK(t)
+# define BFI_FLINEAR2_1777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1776, v ds
+# define BFI_FLINEAR2_1777_TICK(t)
+# define BFI_FLINEAR2_1776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1775, v ds
+# define BFI_FLINEAR2_1776_TICK(t)
+# define BFI_FLINEAR2_1775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1774, v ds
+# define BFI_FLINEAR2_1775_TICK(t)
+# define BFI_FLINEAR2_1774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1773, v ds
+# define BFI_FLINEAR2_1774_TICK(t)
+# define BFI_FLINEAR2_1773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1772, v ds
+# define BFI_FLINEAR2_1773_TICK(t)
+# define BFI_FLINEAR2_1772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1771, v ds
+# define BFI_FLINEAR2_1772_TICK(t)
+# define BFI_FLINEAR2_1771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1770, v ds
+# define BFI_FLINEAR2_1771_TICK(t)
+# define BFI_FLINEAR2_1770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1769, v ds
+# define BFI_FLINEAR2_1770_TICK(t)
+# define BFI_FLINEAR2_1769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1768, v ds
+# define BFI_FLINEAR2_1769_TICK(t)
+# define BFI_FLINEAR2_1768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1767, v ds
+# define BFI_FLINEAR2_1768_TICK(t)
+# define BFI_FLINEAR2_1767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1766, v ds
+# define BFI_FLINEAR2_1767_TICK(t)
+# define BFI_FLINEAR2_1766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1765, v ds
+# define BFI_FLINEAR2_1766_TICK(t)
+# define BFI_FLINEAR2_1765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1764, v ds
+# define BFI_FLINEAR2_1765_TICK(t)
+# define BFI_FLINEAR2_1764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1763, v ds
+# define BFI_FLINEAR2_1764_TICK(t)
+# define BFI_FLINEAR2_1763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1762, v ds
+# define BFI_FLINEAR2_1763_TICK(t)
+# define BFI_FLINEAR2_1762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1761, v ds
+# define BFI_FLINEAR2_1762_TICK(t)
+# define BFI_FLINEAR2_1761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1760, v ds
+# define BFI_FLINEAR2_1761_TICK(t)
+# define BFI_FLINEAR2_1760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1759, v ds
+# define BFI_FLINEAR2_1760_TICK(t)
+# define BFI_FLINEAR2_1759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1758, v ds
+# define BFI_FLINEAR2_1759_TICK(t)
+# define BFI_FLINEAR2_1758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1757, v ds
+# define BFI_FLINEAR2_1758_TICK(t)
+# define BFI_FLINEAR2_1757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1756, v ds
+# define BFI_FLINEAR2_1757_TICK(t)
+# define BFI_FLINEAR2_1756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1755, v ds
+# define BFI_FLINEAR2_1756_TICK(t)
+# define BFI_FLINEAR2_1755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1754, v ds
+# define BFI_FLINEAR2_1755_TICK(t)
+# define BFI_FLINEAR2_1754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1753, v ds
+# define BFI_FLINEAR2_1754_TICK(t)
+# define BFI_FLINEAR2_1753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1752, v ds
+# define BFI_FLINEAR2_1753_TICK(t)
+# define BFI_FLINEAR2_1752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1751, v ds
+# define BFI_FLINEAR2_1752_TICK(t)
+# define BFI_FLINEAR2_1751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1750, v ds
+# define BFI_FLINEAR2_1751_TICK(t)
+# define BFI_FLINEAR2_1750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1749, v ds
+# define BFI_FLINEAR2_1750_TICK(t)
+# define BFI_FLINEAR2_1749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1748, v ds
+# define BFI_FLINEAR2_1749_TICK(t)
+# define BFI_FLINEAR2_1748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1747, v ds
+# define BFI_FLINEAR2_1748_TICK(t)
+# define BFI_FLINEAR2_1747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1746, v ds
+# define BFI_FLINEAR2_1747_TICK(t)
+# define BFI_FLINEAR2_1746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1745, v ds
+# define BFI_FLINEAR2_1746_TICK(t)
+# define BFI_FLINEAR2_1745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1744, v ds
+# define BFI_FLINEAR2_1745_TICK(t)
+# define BFI_FLINEAR2_1744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1743, v ds
+# define BFI_FLINEAR2_1744_TICK(t)
+# define BFI_FLINEAR2_1743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1742, v ds
+# define BFI_FLINEAR2_1743_TICK(t)
+# define BFI_FLINEAR2_1742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1741, v ds
+# define BFI_FLINEAR2_1742_TICK(t)
+# define BFI_FLINEAR2_1741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1740, v ds
+# define BFI_FLINEAR2_1741_TICK(t)
+# define BFI_FLINEAR2_1740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1739, v ds
+# define BFI_FLINEAR2_1740_TICK(t)
+# define BFI_FLINEAR2_1739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1738, v ds
+# define BFI_FLINEAR2_1739_TICK(t)
+# define BFI_FLINEAR2_1738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1737, v ds
+# define BFI_FLINEAR2_1738_TICK(t)
+# define BFI_FLINEAR2_1737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1736, v ds
+# define BFI_FLINEAR2_1737_TICK(t)
+# define BFI_FLINEAR2_1736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1735, v ds
+# define BFI_FLINEAR2_1736_TICK(t)
+# define BFI_FLINEAR2_1735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1734, v ds
+# define BFI_FLINEAR2_1735_TICK(t)
+# define BFI_FLINEAR2_1734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1733, v ds
+# define BFI_FLINEAR2_1734_TICK(t)
+# define BFI_FLINEAR2_1733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1732, v ds
+# define BFI_FLINEAR2_1733_TICK(t)
+# define BFI_FLINEAR2_1732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1731, v ds
+# define BFI_FLINEAR2_1732_TICK(t)
+# define BFI_FLINEAR2_1731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1730, v ds
+# define BFI_FLINEAR2_1731_TICK(t)
+# define BFI_FLINEAR2_1730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1729, v ds
+# define BFI_FLINEAR2_1730_TICK(t)
+# define BFI_FLINEAR2_1729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1728, v ds
+# define BFI_FLINEAR2_1729_TICK(t)
+# define BFI_FLINEAR2_1728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1727, v ds
+# define BFI_FLINEAR2_1728_TICK(t)
+# define BFI_FLINEAR2_1727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1726, v ds
+# define BFI_FLINEAR2_1727_TICK(t)
+# define BFI_FLINEAR2_1726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1725, v ds
+# define BFI_FLINEAR2_1726_TICK(t)
+# define BFI_FLINEAR2_1725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1724, v ds
+# define BFI_FLINEAR2_1725_TICK(t)
+# define BFI_FLINEAR2_1724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1723, v ds
+# define BFI_FLINEAR2_1724_TICK(t)
+# define BFI_FLINEAR2_1723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1722, v ds
+# define BFI_FLINEAR2_1723_TICK(t)
+# define BFI_FLINEAR2_1722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1721, v ds
+# define BFI_FLINEAR2_1722_TICK(t)
+# define BFI_FLINEAR2_1721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1720, v ds
+# define BFI_FLINEAR2_1721_TICK(t)
+# define BFI_FLINEAR2_1720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1719, v ds
+# define BFI_FLINEAR2_1720_TICK(t)
+# define BFI_FLINEAR2_1719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1718, v ds
+# define BFI_FLINEAR2_1719_TICK(t)
+# define BFI_FLINEAR2_1718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1717, v ds
+# define BFI_FLINEAR2_1718_TICK(t)
+# define BFI_FLINEAR2_1717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1716, v ds
+# define BFI_FLINEAR2_1717_TICK(t)
+# define BFI_FLINEAR2_1716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1715, v ds
+# define BFI_FLINEAR2_1716_TICK(t)
+# define BFI_FLINEAR2_1715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1714, v ds
+# define BFI_FLINEAR2_1715_TICK(t)
+# define BFI_FLINEAR2_1714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1713, v ds
+# define BFI_FLINEAR2_1714_TICK(t)
+# define BFI_FLINEAR2_1713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1712, v ds
+# define BFI_FLINEAR2_1713_TICK(t)
+# define BFI_FLINEAR2_1712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1711, v ds
+# define BFI_FLINEAR2_1712_TICK(t)
+# define BFI_FLINEAR2_1711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1710, v ds
+# define BFI_FLINEAR2_1711_TICK(t)
+# define BFI_FLINEAR2_1710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1709, v ds
+# define BFI_FLINEAR2_1710_TICK(t)
+# define BFI_FLINEAR2_1709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1708, v ds
+# define BFI_FLINEAR2_1709_TICK(t)
+# define BFI_FLINEAR2_1708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1707, v ds
+# define BFI_FLINEAR2_1708_TICK(t)
+# define BFI_FLINEAR2_1707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1706, v ds
+# define BFI_FLINEAR2_1707_TICK(t)
+# define BFI_FLINEAR2_1706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1705, v ds
+# define BFI_FLINEAR2_1706_TICK(t)
+# define BFI_FLINEAR2_1705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1704, v ds
+# define BFI_FLINEAR2_1705_TICK(t)
+# define BFI_FLINEAR2_1704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1703, v ds
+# define BFI_FLINEAR2_1704_TICK(t)
+# define BFI_FLINEAR2_1703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1702, v ds
+# define BFI_FLINEAR2_1703_TICK(t)
+# define BFI_FLINEAR2_1702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1701, v ds
+# define BFI_FLINEAR2_1702_TICK(t)
+# define BFI_FLINEAR2_1701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1700, v ds
+# define BFI_FLINEAR2_1701_TICK(t)
+# define BFI_FLINEAR2_1700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1699, v ds
+# define BFI_FLINEAR2_1700_TICK(t)
+# define BFI_FLINEAR2_1699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1698, v ds
+# define BFI_FLINEAR2_1699_TICK(t)
+# define BFI_FLINEAR2_1698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1697, v ds
+# define BFI_FLINEAR2_1698_TICK(t)
+# define BFI_FLINEAR2_1697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1696, v ds
+# define BFI_FLINEAR2_1697_TICK(t)
+# define BFI_FLINEAR2_1696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1695, v ds
+# define BFI_FLINEAR2_1696_TICK(t)
+# define BFI_FLINEAR2_1695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1694, v ds
+# define BFI_FLINEAR2_1695_TICK(t)
+# define BFI_FLINEAR2_1694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1693, v ds
+# define BFI_FLINEAR2_1694_TICK(t)
+# define BFI_FLINEAR2_1693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1692, v ds
+# define BFI_FLINEAR2_1693_TICK(t)
+# define BFI_FLINEAR2_1692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1691, v ds
+# define BFI_FLINEAR2_1692_TICK(t)
+# define BFI_FLINEAR2_1691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1690, v ds
+# define BFI_FLINEAR2_1691_TICK(t)
+# define BFI_FLINEAR2_1690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1689, v ds
+# define BFI_FLINEAR2_1690_TICK(t)
+# define BFI_FLINEAR2_1689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1688, v ds
+# define BFI_FLINEAR2_1689_TICK(t)
+# define BFI_FLINEAR2_1688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1687, v ds
+# define BFI_FLINEAR2_1688_TICK(t)
+# define BFI_FLINEAR2_1687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1686, v ds
+# define BFI_FLINEAR2_1687_TICK(t)
+# define BFI_FLINEAR2_1686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1685, v ds
+# define BFI_FLINEAR2_1686_TICK(t)
+# define BFI_FLINEAR2_1685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1684, v ds
+# define BFI_FLINEAR2_1685_TICK(t)
+# define BFI_FLINEAR2_1684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1683, v ds
+# define BFI_FLINEAR2_1684_TICK(t)
+# define BFI_FLINEAR2_1683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1682, v ds
+# define BFI_FLINEAR2_1683_TICK(t)
+# define BFI_FLINEAR2_1682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1681, v ds
+# define BFI_FLINEAR2_1682_TICK(t)
+# define BFI_FLINEAR2_1681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1680, v ds
+# define BFI_FLINEAR2_1681_TICK(t)
+# define BFI_FLINEAR2_1680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1679, v ds
+# define BFI_FLINEAR2_1680_TICK(t)
+# define BFI_FLINEAR2_1679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1678, v ds
+# define BFI_FLINEAR2_1679_TICK(t)
+# define BFI_FLINEAR2_1678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1677, v ds
+# define BFI_FLINEAR2_1678_TICK(t)
+# define BFI_FLINEAR2_1677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1676, v ds
+# define BFI_FLINEAR2_1677_TICK(t)
+# define BFI_FLINEAR2_1676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1675, v ds
+# define BFI_FLINEAR2_1676_TICK(t)
+# define BFI_FLINEAR2_1675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1674, v ds
+# define BFI_FLINEAR2_1675_TICK(t)
+# define BFI_FLINEAR2_1674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1673, v ds
+# define BFI_FLINEAR2_1674_TICK(t)
+# define BFI_FLINEAR2_1673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1672, v ds
+# define BFI_FLINEAR2_1673_TICK(t)
+# define BFI_FLINEAR2_1672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1671, v ds
+# define BFI_FLINEAR2_1672_TICK(t)
+# define BFI_FLINEAR2_1671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1670, v ds
+# define BFI_FLINEAR2_1671_TICK(t)
+# define BFI_FLINEAR2_1670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1669, v ds
+# define BFI_FLINEAR2_1670_TICK(t)
+# define BFI_FLINEAR2_1669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1668, v ds
+# define BFI_FLINEAR2_1669_TICK(t)
+# define BFI_FLINEAR2_1668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1667, v ds
+# define BFI_FLINEAR2_1668_TICK(t)
+# define BFI_FLINEAR2_1667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1666, v ds
+# define BFI_FLINEAR2_1667_TICK(t)
+# define BFI_FLINEAR2_1666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1665, v ds
+# define BFI_FLINEAR2_1666_TICK(t)
+# define BFI_FLINEAR2_1665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1664, v ds
+# define BFI_FLINEAR2_1665_TICK(t)
+# define BFI_FLINEAR2_1664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1663, v ds
+# define BFI_FLINEAR2_1664_TICK(t)
+# define BFI_FLINEAR2_1663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1662, v ds
+# define BFI_FLINEAR2_1663_TICK(t)
+# define BFI_FLINEAR2_1662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1661, v ds
+# define BFI_FLINEAR2_1662_TICK(t)
+# define BFI_FLINEAR2_1661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1660, v ds
+# define BFI_FLINEAR2_1661_TICK(t)
+# define BFI_FLINEAR2_1660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1659, v ds
+# define BFI_FLINEAR2_1660_TICK(t)
+# define BFI_FLINEAR2_1659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1658, v ds
+# define BFI_FLINEAR2_1659_TICK(t)
+# define BFI_FLINEAR2_1658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1657, v ds
+# define BFI_FLINEAR2_1658_TICK(t)
+# define BFI_FLINEAR2_1657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1656, v ds
+# define BFI_FLINEAR2_1657_TICK(t)
+# define BFI_FLINEAR2_1656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1655, v ds
+# define BFI_FLINEAR2_1656_TICK(t)
+# define BFI_FLINEAR2_1655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1654, v ds
+# define BFI_FLINEAR2_1655_TICK(t)
+# define BFI_FLINEAR2_1654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1653, v ds
+# define BFI_FLINEAR2_1654_TICK(t)
+# define BFI_FLINEAR2_1653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1652, v ds
+# define BFI_FLINEAR2_1653_TICK(t)
+# define BFI_FLINEAR2_1652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1651, v ds
+# define BFI_FLINEAR2_1652_TICK(t)
+# define BFI_FLINEAR2_1651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1650, v ds
+# define BFI_FLINEAR2_1651_TICK(t)
+# define BFI_FLINEAR2_1650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1649, v ds
+# define BFI_FLINEAR2_1650_TICK(t)
+# define BFI_FLINEAR2_1649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1648, v ds
+# define BFI_FLINEAR2_1649_TICK(t)
+# define BFI_FLINEAR2_1648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1647, v ds
+# define BFI_FLINEAR2_1648_TICK(t)
+# define BFI_FLINEAR2_1647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1646, v ds
+# define BFI_FLINEAR2_1647_TICK(t)
+# define BFI_FLINEAR2_1646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1645, v ds
+# define BFI_FLINEAR2_1646_TICK(t)
+# define BFI_FLINEAR2_1645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1644, v ds
+# define BFI_FLINEAR2_1645_TICK(t)
+# define BFI_FLINEAR2_1644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1643, v ds
+# define BFI_FLINEAR2_1644_TICK(t)
+# define BFI_FLINEAR2_1643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1642, v ds
+# define BFI_FLINEAR2_1643_TICK(t)
+# define BFI_FLINEAR2_1642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1641, v ds
+# define BFI_FLINEAR2_1642_TICK(t)
+# define BFI_FLINEAR2_1641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1640, v ds
+# define BFI_FLINEAR2_1641_TICK(t)
+# define BFI_FLINEAR2_1640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1639, v ds
+# define BFI_FLINEAR2_1640_TICK(t)
+# define BFI_FLINEAR2_1639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1638, v ds
+# define BFI_FLINEAR2_1639_TICK(t)
+# define BFI_FLINEAR2_1638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1637, v ds
+# define BFI_FLINEAR2_1638_TICK(t)
+# define BFI_FLINEAR2_1637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1636, v ds
+# define BFI_FLINEAR2_1637_TICK(t)
+# define BFI_FLINEAR2_1636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1635, v ds
+# define BFI_FLINEAR2_1636_TICK(t)
+# define BFI_FLINEAR2_1635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1634, v ds
+# define BFI_FLINEAR2_1635_TICK(t)
+# define BFI_FLINEAR2_1634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1633, v ds
+# define BFI_FLINEAR2_1634_TICK(t)
+# define BFI_FLINEAR2_1633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1632, v ds
+# define BFI_FLINEAR2_1633_TICK(t)
+# define BFI_FLINEAR2_1632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1631, v ds
+# define BFI_FLINEAR2_1632_TICK(t)
+# define BFI_FLINEAR2_1631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1630, v ds
+# define BFI_FLINEAR2_1631_TICK(t)
+# define BFI_FLINEAR2_1630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1629, v ds
+# define BFI_FLINEAR2_1630_TICK(t)
+# define BFI_FLINEAR2_1629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1628, v ds
+# define BFI_FLINEAR2_1629_TICK(t)
+# define BFI_FLINEAR2_1628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1627, v ds
+# define BFI_FLINEAR2_1628_TICK(t)
+# define BFI_FLINEAR2_1627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1626, v ds
+# define BFI_FLINEAR2_1627_TICK(t)
+# define BFI_FLINEAR2_1626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1625, v ds
+# define BFI_FLINEAR2_1626_TICK(t)
+# define BFI_FLINEAR2_1625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1624, v ds
+# define BFI_FLINEAR2_1625_TICK(t)
+# define BFI_FLINEAR2_1624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1623, v ds
+# define BFI_FLINEAR2_1624_TICK(t)
+# define BFI_FLINEAR2_1623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1622, v ds
+# define BFI_FLINEAR2_1623_TICK(t)
+# define BFI_FLINEAR2_1622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1621, v ds
+# define BFI_FLINEAR2_1622_TICK(t)
+# define BFI_FLINEAR2_1621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1620, v ds
+# define BFI_FLINEAR2_1621_TICK(t)
+# define BFI_FLINEAR2_1620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1619, v ds
+# define BFI_FLINEAR2_1620_TICK(t)
+# define BFI_FLINEAR2_1619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1618, v ds
+# define BFI_FLINEAR2_1619_TICK(t)
+# define BFI_FLINEAR2_1618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1617, v ds
+# define BFI_FLINEAR2_1618_TICK(t)
+# define BFI_FLINEAR2_1617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1616, v ds
+# define BFI_FLINEAR2_1617_TICK(t)
+# define BFI_FLINEAR2_1616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1615, v ds
+# define BFI_FLINEAR2_1616_TICK(t)
+# define BFI_FLINEAR2_1615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1614, v ds
+# define BFI_FLINEAR2_1615_TICK(t)
+# define BFI_FLINEAR2_1614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1613, v ds
+# define BFI_FLINEAR2_1614_TICK(t)
+# define BFI_FLINEAR2_1613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1612, v ds
+# define BFI_FLINEAR2_1613_TICK(t)
+# define BFI_FLINEAR2_1612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1611, v ds
+# define BFI_FLINEAR2_1612_TICK(t)
+# define BFI_FLINEAR2_1611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1610, v ds
+# define BFI_FLINEAR2_1611_TICK(t)
+# define BFI_FLINEAR2_1610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1609, v ds
+# define BFI_FLINEAR2_1610_TICK(t)
+# define BFI_FLINEAR2_1609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1608, v ds
+# define BFI_FLINEAR2_1609_TICK(t)
+# define BFI_FLINEAR2_1608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1607, v ds
+# define BFI_FLINEAR2_1608_TICK(t)
+# define BFI_FLINEAR2_1607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1606, v ds
+# define BFI_FLINEAR2_1607_TICK(t)
+# define BFI_FLINEAR2_1606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1605, v ds
+# define BFI_FLINEAR2_1606_TICK(t)
+# define BFI_FLINEAR2_1605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1604, v ds
+# define BFI_FLINEAR2_1605_TICK(t)
+# define BFI_FLINEAR2_1604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1603, v ds
+# define BFI_FLINEAR2_1604_TICK(t)
+# define BFI_FLINEAR2_1603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1602, v ds
+# define BFI_FLINEAR2_1603_TICK(t)
+# define BFI_FLINEAR2_1602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1601, v ds
+# define BFI_FLINEAR2_1602_TICK(t)
+# define BFI_FLINEAR2_1601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1600, v ds
+# define BFI_FLINEAR2_1601_TICK(t)
+# define BFI_FLINEAR2_1600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1599, v ds
+# define BFI_FLINEAR2_1600_TICK(t)
+# define BFI_FLINEAR2_1599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1598, v ds
+# define BFI_FLINEAR2_1599_TICK(t)
+# define BFI_FLINEAR2_1598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1597, v ds
+# define BFI_FLINEAR2_1598_TICK(t)
+# define BFI_FLINEAR2_1597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1596, v ds
+# define BFI_FLINEAR2_1597_TICK(t)
+# define BFI_FLINEAR2_1596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1595, v ds
+# define BFI_FLINEAR2_1596_TICK(t)
+# define BFI_FLINEAR2_1595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1594, v ds
+# define BFI_FLINEAR2_1595_TICK(t)
+# define BFI_FLINEAR2_1594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1593, v ds
+# define BFI_FLINEAR2_1594_TICK(t)
+# define BFI_FLINEAR2_1593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1592, v ds
+# define BFI_FLINEAR2_1593_TICK(t)
+# define BFI_FLINEAR2_1592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1591, v ds
+# define BFI_FLINEAR2_1592_TICK(t)
+# define BFI_FLINEAR2_1591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1590, v ds
+# define BFI_FLINEAR2_1591_TICK(t)
+# define BFI_FLINEAR2_1590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1589, v ds
+# define BFI_FLINEAR2_1590_TICK(t)
+# define BFI_FLINEAR2_1589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1588, v ds
+# define BFI_FLINEAR2_1589_TICK(t)
+# define BFI_FLINEAR2_1588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1587, v ds
+# define BFI_FLINEAR2_1588_TICK(t)
+# define BFI_FLINEAR2_1587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1586, v ds
+# define BFI_FLINEAR2_1587_TICK(t)
+# define BFI_FLINEAR2_1586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1585, v ds
+# define BFI_FLINEAR2_1586_TICK(t)
+# define BFI_FLINEAR2_1585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1584, v ds
+# define BFI_FLINEAR2_1585_TICK(t)
+# define BFI_FLINEAR2_1584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1583, v ds
+# define BFI_FLINEAR2_1584_TICK(t)
+# define BFI_FLINEAR2_1583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1582, v ds
+# define BFI_FLINEAR2_1583_TICK(t)
+# define BFI_FLINEAR2_1582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1581, v ds
+# define BFI_FLINEAR2_1582_TICK(t)
+# define BFI_FLINEAR2_1581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1580, v ds
+# define BFI_FLINEAR2_1581_TICK(t)
+# define BFI_FLINEAR2_1580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1579, v ds
+# define BFI_FLINEAR2_1580_TICK(t)
+# define BFI_FLINEAR2_1579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1578, v ds
+# define BFI_FLINEAR2_1579_TICK(t)
+# define BFI_FLINEAR2_1578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1577, v ds
+# define BFI_FLINEAR2_1578_TICK(t)
+# define BFI_FLINEAR2_1577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1576, v ds
+# define BFI_FLINEAR2_1577_TICK(t)
+# define BFI_FLINEAR2_1576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1575, v ds
+# define BFI_FLINEAR2_1576_TICK(t)
+# define BFI_FLINEAR2_1575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1574, v ds
+# define BFI_FLINEAR2_1575_TICK(t)
+# define BFI_FLINEAR2_1574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1573, v ds
+# define BFI_FLINEAR2_1574_TICK(t)
+# define BFI_FLINEAR2_1573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1572, v ds
+# define BFI_FLINEAR2_1573_TICK(t)
+# define BFI_FLINEAR2_1572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1571, v ds
+# define BFI_FLINEAR2_1572_TICK(t)
+# define BFI_FLINEAR2_1571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1570, v ds
+# define BFI_FLINEAR2_1571_TICK(t)
+# define BFI_FLINEAR2_1570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1569, v ds
+# define BFI_FLINEAR2_1570_TICK(t)
+# define BFI_FLINEAR2_1569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1568, v ds
+# define BFI_FLINEAR2_1569_TICK(t)
+# define BFI_FLINEAR2_1568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1567, v ds
+# define BFI_FLINEAR2_1568_TICK(t)
+# define BFI_FLINEAR2_1567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1566, v ds
+# define BFI_FLINEAR2_1567_TICK(t)
+# define BFI_FLINEAR2_1566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1565, v ds
+# define BFI_FLINEAR2_1566_TICK(t)
+# define BFI_FLINEAR2_1565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1564, v ds
+# define BFI_FLINEAR2_1565_TICK(t)
+# define BFI_FLINEAR2_1564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1563, v ds
+# define BFI_FLINEAR2_1564_TICK(t)
+# define BFI_FLINEAR2_1563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1562, v ds
+# define BFI_FLINEAR2_1563_TICK(t)
+# define BFI_FLINEAR2_1562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1561, v ds
+# define BFI_FLINEAR2_1562_TICK(t)
+# define BFI_FLINEAR2_1561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1560, v ds
+# define BFI_FLINEAR2_1561_TICK(t)
+# define BFI_FLINEAR2_1560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1559, v ds
+# define BFI_FLINEAR2_1560_TICK(t)
+# define BFI_FLINEAR2_1559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1558, v ds
+# define BFI_FLINEAR2_1559_TICK(t)
+# define BFI_FLINEAR2_1558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1557, v ds
+# define BFI_FLINEAR2_1558_TICK(t)
+# define BFI_FLINEAR2_1557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1556, v ds
+# define BFI_FLINEAR2_1557_TICK(t)
+# define BFI_FLINEAR2_1556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1555, v ds
+# define BFI_FLINEAR2_1556_TICK(t)
+# define BFI_FLINEAR2_1555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1554, v ds
+# define BFI_FLINEAR2_1555_TICK(t)
+# define BFI_FLINEAR2_1554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1553, v ds
+# define BFI_FLINEAR2_1554_TICK(t)
+# define BFI_FLINEAR2_1553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1552, v ds
+# define BFI_FLINEAR2_1553_TICK(t)
+# define BFI_FLINEAR2_1552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1551, v ds
+# define BFI_FLINEAR2_1552_TICK(t)
+# define BFI_FLINEAR2_1551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1550, v ds
+# define BFI_FLINEAR2_1551_TICK(t)
+# define BFI_FLINEAR2_1550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1549, v ds
+# define BFI_FLINEAR2_1550_TICK(t)
+# define BFI_FLINEAR2_1549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1548, v ds
+# define BFI_FLINEAR2_1549_TICK(t)
+# define BFI_FLINEAR2_1548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1547, v ds
+# define BFI_FLINEAR2_1548_TICK(t)
+# define BFI_FLINEAR2_1547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1546, v ds
+# define BFI_FLINEAR2_1547_TICK(t)
+# define BFI_FLINEAR2_1546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1545, v ds
+# define BFI_FLINEAR2_1546_TICK(t)
+# define BFI_FLINEAR2_1545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1544, v ds
+# define BFI_FLINEAR2_1545_TICK(t)
+# define BFI_FLINEAR2_1544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1543, v ds
+# define BFI_FLINEAR2_1544_TICK(t)
+# define BFI_FLINEAR2_1543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1542, v ds
+# define BFI_FLINEAR2_1543_TICK(t)
+# define BFI_FLINEAR2_1542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1541, v ds
+# define BFI_FLINEAR2_1542_TICK(t)
+# define BFI_FLINEAR2_1541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1540, v ds
+# define BFI_FLINEAR2_1541_TICK(t)
+# define BFI_FLINEAR2_1540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1539, v ds
+# define BFI_FLINEAR2_1540_TICK(t)
+# define BFI_FLINEAR2_1539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1538, v ds
+# define BFI_FLINEAR2_1539_TICK(t)
+# define BFI_FLINEAR2_1538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1537, v ds
+# define BFI_FLINEAR2_1538_TICK(t)
+# define BFI_FLINEAR2_1537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1536, v ds
+# define BFI_FLINEAR2_1537_TICK(t)
+# define BFI_FLINEAR2_1536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1535, v ds
+# define BFI_FLINEAR2_1536_TICK(t)
+# define BFI_FLINEAR2_1535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1534, v ds
+# define BFI_FLINEAR2_1535_TICK(t)
+# define BFI_FLINEAR2_1534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1533, v ds
+# define BFI_FLINEAR2_1534_TICK(t)
+# define BFI_FLINEAR2_1533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1532, v ds
+# define BFI_FLINEAR2_1533_TICK(t)
+# define BFI_FLINEAR2_1532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1531, v ds
+# define BFI_FLINEAR2_1532_TICK(t)
+# define BFI_FLINEAR2_1531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1530, v ds
+# define BFI_FLINEAR2_1531_TICK(t)
+# define BFI_FLINEAR2_1530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1529, v ds
+# define BFI_FLINEAR2_1530_TICK(t)
+# define BFI_FLINEAR2_1529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1528, v ds
+# define BFI_FLINEAR2_1529_TICK(t)
+# define BFI_FLINEAR2_1528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1527, v ds
+# define BFI_FLINEAR2_1528_TICK(t)
+# define BFI_FLINEAR2_1527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1526, v ds
+# define BFI_FLINEAR2_1527_TICK(t)
+# define BFI_FLINEAR2_1526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1525, v ds
+# define BFI_FLINEAR2_1526_TICK(t)
+# define BFI_FLINEAR2_1525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1524, v ds
+# define BFI_FLINEAR2_1525_TICK(t)
+# define BFI_FLINEAR2_1524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1523, v ds
+# define BFI_FLINEAR2_1524_TICK(t)
+# define BFI_FLINEAR2_1523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1522, v ds
+# define BFI_FLINEAR2_1523_TICK(t)
+# define BFI_FLINEAR2_1522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1521, v ds
+# define BFI_FLINEAR2_1522_TICK(t)
+# define BFI_FLINEAR2_1521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1520, v ds
+# define BFI_FLINEAR2_1521_TICK(t)
+# define BFI_FLINEAR2_1520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1519, v ds
+# define BFI_FLINEAR2_1520_TICK(t)
+# define BFI_FLINEAR2_1519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1518, v ds
+# define BFI_FLINEAR2_1519_TICK(t)
+# define BFI_FLINEAR2_1518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1517, v ds
+# define BFI_FLINEAR2_1518_TICK(t)
+# define BFI_FLINEAR2_1517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1516, v ds
+# define BFI_FLINEAR2_1517_TICK(t)
+# define BFI_FLINEAR2_1516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1515, v ds
+# define BFI_FLINEAR2_1516_TICK(t)
+# define BFI_FLINEAR2_1515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1514, v ds
+# define BFI_FLINEAR2_1515_TICK(t)
+# define BFI_FLINEAR2_1514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1513, v ds
+# define BFI_FLINEAR2_1514_TICK(t)
+# define BFI_FLINEAR2_1513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1512, v ds
+# define BFI_FLINEAR2_1513_TICK(t)
+# define BFI_FLINEAR2_1512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1511, v ds
+# define BFI_FLINEAR2_1512_TICK(t)
+# define BFI_FLINEAR2_1511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1510, v ds
+# define BFI_FLINEAR2_1511_TICK(t)
+# define BFI_FLINEAR2_1510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1509, v ds
+# define BFI_FLINEAR2_1510_TICK(t)
+# define BFI_FLINEAR2_1509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1508, v ds
+# define BFI_FLINEAR2_1509_TICK(t)
+# define BFI_FLINEAR2_1508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1507, v ds
+# define BFI_FLINEAR2_1508_TICK(t)
+# define BFI_FLINEAR2_1507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1506, v ds
+# define BFI_FLINEAR2_1507_TICK(t)
+# define BFI_FLINEAR2_1506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1505, v ds
+# define BFI_FLINEAR2_1506_TICK(t)
+# define BFI_FLINEAR2_1505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1504, v ds
+# define BFI_FLINEAR2_1505_TICK(t)
+# define BFI_FLINEAR2_1504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1503, v ds
+# define BFI_FLINEAR2_1504_TICK(t)
+# define BFI_FLINEAR2_1503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1502, v ds
+# define BFI_FLINEAR2_1503_TICK(t)
+# define BFI_FLINEAR2_1502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1501, v ds
+# define BFI_FLINEAR2_1502_TICK(t)
+# define BFI_FLINEAR2_1501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1500, v ds
+# define BFI_FLINEAR2_1501_TICK(t)
+# define BFI_FLINEAR2_1500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1499, v ds
+# define BFI_FLINEAR2_1500_TICK(t)
+# define BFI_FLINEAR2_1499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1498, v ds
+# define BFI_FLINEAR2_1499_TICK(t)
+# define BFI_FLINEAR2_1498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1497, v ds
+# define BFI_FLINEAR2_1498_TICK(t)
+# define BFI_FLINEAR2_1497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1496, v ds
+# define BFI_FLINEAR2_1497_TICK(t)
+# define BFI_FLINEAR2_1496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1495, v ds
+# define BFI_FLINEAR2_1496_TICK(t)
+# define BFI_FLINEAR2_1495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1494, v ds
+# define BFI_FLINEAR2_1495_TICK(t)
+# define BFI_FLINEAR2_1494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1493, v ds
+# define BFI_FLINEAR2_1494_TICK(t)
+# define BFI_FLINEAR2_1493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1492, v ds
+# define BFI_FLINEAR2_1493_TICK(t)
+# define BFI_FLINEAR2_1492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1491, v ds
+# define BFI_FLINEAR2_1492_TICK(t)
+# define BFI_FLINEAR2_1491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1490, v ds
+# define BFI_FLINEAR2_1491_TICK(t)
+# define BFI_FLINEAR2_1490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1489, v ds
+# define BFI_FLINEAR2_1490_TICK(t)
+# define BFI_FLINEAR2_1489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1488, v ds
+# define BFI_FLINEAR2_1489_TICK(t)
+# define BFI_FLINEAR2_1488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1487, v ds
+# define BFI_FLINEAR2_1488_TICK(t)
+# define BFI_FLINEAR2_1487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1486, v ds
+# define BFI_FLINEAR2_1487_TICK(t)
+# define BFI_FLINEAR2_1486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1485, v ds
+# define BFI_FLINEAR2_1486_TICK(t)
+# define BFI_FLINEAR2_1485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1484, v ds
+# define BFI_FLINEAR2_1485_TICK(t)
+# define BFI_FLINEAR2_1484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1483, v ds
+# define BFI_FLINEAR2_1484_TICK(t)
+# define BFI_FLINEAR2_1483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1482, v ds
+# define BFI_FLINEAR2_1483_TICK(t)
+# define BFI_FLINEAR2_1482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1481, v ds
+# define BFI_FLINEAR2_1482_TICK(t)
+# define BFI_FLINEAR2_1481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1480, v ds
+# define BFI_FLINEAR2_1481_TICK(t)
+# define BFI_FLINEAR2_1480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1479, v ds
+# define BFI_FLINEAR2_1480_TICK(t)
+# define BFI_FLINEAR2_1479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1478, v ds
+# define BFI_FLINEAR2_1479_TICK(t)
+# define BFI_FLINEAR2_1478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1477, v ds
+# define BFI_FLINEAR2_1478_TICK(t)
+# define BFI_FLINEAR2_1477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1476, v ds
+# define BFI_FLINEAR2_1477_TICK(t)
+# define BFI_FLINEAR2_1476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1475, v ds
+# define BFI_FLINEAR2_1476_TICK(t)
+# define BFI_FLINEAR2_1475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1474, v ds
+# define BFI_FLINEAR2_1475_TICK(t)
+# define BFI_FLINEAR2_1474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1473, v ds
+# define BFI_FLINEAR2_1474_TICK(t)
+# define BFI_FLINEAR2_1473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1472, v ds
+# define BFI_FLINEAR2_1473_TICK(t)
+# define BFI_FLINEAR2_1472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1471, v ds
+# define BFI_FLINEAR2_1472_TICK(t)
+# define BFI_FLINEAR2_1471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1470, v ds
+# define BFI_FLINEAR2_1471_TICK(t)
+# define BFI_FLINEAR2_1470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1469, v ds
+# define BFI_FLINEAR2_1470_TICK(t)
+# define BFI_FLINEAR2_1469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1468, v ds
+# define BFI_FLINEAR2_1469_TICK(t)
+# define BFI_FLINEAR2_1468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1467, v ds
+# define BFI_FLINEAR2_1468_TICK(t)
+# define BFI_FLINEAR2_1467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1466, v ds
+# define BFI_FLINEAR2_1467_TICK(t)
+# define BFI_FLINEAR2_1466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1465, v ds
+# define BFI_FLINEAR2_1466_TICK(t)
+# define BFI_FLINEAR2_1465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1464, v ds
+# define BFI_FLINEAR2_1465_TICK(t)
+# define BFI_FLINEAR2_1464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1463, v ds
+# define BFI_FLINEAR2_1464_TICK(t)
+# define BFI_FLINEAR2_1463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1462, v ds
+# define BFI_FLINEAR2_1463_TICK(t)
+# define BFI_FLINEAR2_1462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1461, v ds
+# define BFI_FLINEAR2_1462_TICK(t)
+# define BFI_FLINEAR2_1461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1460, v ds
+# define BFI_FLINEAR2_1461_TICK(t)
+# define BFI_FLINEAR2_1460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1459, v ds
+# define BFI_FLINEAR2_1460_TICK(t)
+# define BFI_FLINEAR2_1459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1458, v ds
+# define BFI_FLINEAR2_1459_TICK(t)
+# define BFI_FLINEAR2_1458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1457, v ds
+# define BFI_FLINEAR2_1458_TICK(t)
+# define BFI_FLINEAR2_1457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1456, v ds
+# define BFI_FLINEAR2_1457_TICK(t)
+# define BFI_FLINEAR2_1456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1455, v ds
+# define BFI_FLINEAR2_1456_TICK(t)
+# define BFI_FLINEAR2_1455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1454, v ds
+# define BFI_FLINEAR2_1455_TICK(t)
+# define BFI_FLINEAR2_1454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1453, v ds
+# define BFI_FLINEAR2_1454_TICK(t)
+# define BFI_FLINEAR2_1453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1452, v ds
+# define BFI_FLINEAR2_1453_TICK(t)
+# define BFI_FLINEAR2_1452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1451, v ds
+# define BFI_FLINEAR2_1452_TICK(t)
+# define BFI_FLINEAR2_1451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1450, v ds
+# define BFI_FLINEAR2_1451_TICK(t)
+# define BFI_FLINEAR2_1450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1449, v ds
+# define BFI_FLINEAR2_1450_TICK(t)
+# define BFI_FLINEAR2_1449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1448, v ds
+# define BFI_FLINEAR2_1449_TICK(t)
+# define BFI_FLINEAR2_1448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1447, v ds
+# define BFI_FLINEAR2_1448_TICK(t)
+# define BFI_FLINEAR2_1447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1446, v ds
+# define BFI_FLINEAR2_1447_TICK(t)
+# define BFI_FLINEAR2_1446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1445, v ds
+# define BFI_FLINEAR2_1446_TICK(t)
+# define BFI_FLINEAR2_1445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1444, v ds
+# define BFI_FLINEAR2_1445_TICK(t)
+# define BFI_FLINEAR2_1444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1443, v ds
+# define BFI_FLINEAR2_1444_TICK(t)
+# define BFI_FLINEAR2_1443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1442, v ds
+# define BFI_FLINEAR2_1443_TICK(t)
+# define BFI_FLINEAR2_1442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1441, v ds
+# define BFI_FLINEAR2_1442_TICK(t)
+# define BFI_FLINEAR2_1441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1440, v ds
+# define BFI_FLINEAR2_1441_TICK(t)
+# define BFI_FLINEAR2_1440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1439, v ds
+# define BFI_FLINEAR2_1440_TICK(t)
+# define BFI_FLINEAR2_1439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1438, v ds
+# define BFI_FLINEAR2_1439_TICK(t)
+# define BFI_FLINEAR2_1438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1437, v ds
+# define BFI_FLINEAR2_1438_TICK(t)
+# define BFI_FLINEAR2_1437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1436, v ds
+# define BFI_FLINEAR2_1437_TICK(t)
+# define BFI_FLINEAR2_1436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1435, v ds
+# define BFI_FLINEAR2_1436_TICK(t)
+# define BFI_FLINEAR2_1435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1434, v ds
+# define BFI_FLINEAR2_1435_TICK(t)
+# define BFI_FLINEAR2_1434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1433, v ds
+# define BFI_FLINEAR2_1434_TICK(t)
+# define BFI_FLINEAR2_1433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1432, v ds
+# define BFI_FLINEAR2_1433_TICK(t)
+# define BFI_FLINEAR2_1432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1431, v ds
+# define BFI_FLINEAR2_1432_TICK(t)
+# define BFI_FLINEAR2_1431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1430, v ds
+# define BFI_FLINEAR2_1431_TICK(t)
+# define BFI_FLINEAR2_1430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1429, v ds
+# define BFI_FLINEAR2_1430_TICK(t)
+# define BFI_FLINEAR2_1429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1428, v ds
+# define BFI_FLINEAR2_1429_TICK(t)
+# define BFI_FLINEAR2_1428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1427, v ds
+# define BFI_FLINEAR2_1428_TICK(t)
+# define BFI_FLINEAR2_1427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1426, v ds
+# define BFI_FLINEAR2_1427_TICK(t)
+# define BFI_FLINEAR2_1426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1425, v ds
+# define BFI_FLINEAR2_1426_TICK(t)
+# define BFI_FLINEAR2_1425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1424, v ds
+# define BFI_FLINEAR2_1425_TICK(t)
+# define BFI_FLINEAR2_1424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1423, v ds
+# define BFI_FLINEAR2_1424_TICK(t)
+# define BFI_FLINEAR2_1423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1422, v ds
+# define BFI_FLINEAR2_1423_TICK(t)
+# define BFI_FLINEAR2_1422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1421, v ds
+# define BFI_FLINEAR2_1422_TICK(t)
+# define BFI_FLINEAR2_1421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1420, v ds
+# define BFI_FLINEAR2_1421_TICK(t)
+# define BFI_FLINEAR2_1420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1419, v ds
+# define BFI_FLINEAR2_1420_TICK(t)
+# define BFI_FLINEAR2_1419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1418, v ds
+# define BFI_FLINEAR2_1419_TICK(t)
+# define BFI_FLINEAR2_1418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1417, v ds
+# define BFI_FLINEAR2_1418_TICK(t)
+# define BFI_FLINEAR2_1417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1416, v ds
+# define BFI_FLINEAR2_1417_TICK(t)
+# define BFI_FLINEAR2_1416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1415, v ds
+# define BFI_FLINEAR2_1416_TICK(t)
+# define BFI_FLINEAR2_1415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1414, v ds
+# define BFI_FLINEAR2_1415_TICK(t)
+# define BFI_FLINEAR2_1414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1413, v ds
+# define BFI_FLINEAR2_1414_TICK(t)
+# define BFI_FLINEAR2_1413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1412, v ds
+# define BFI_FLINEAR2_1413_TICK(t)
+# define BFI_FLINEAR2_1412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1411, v ds
+# define BFI_FLINEAR2_1412_TICK(t)
+# define BFI_FLINEAR2_1411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1410, v ds
+# define BFI_FLINEAR2_1411_TICK(t)
+# define BFI_FLINEAR2_1410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1409, v ds
+# define BFI_FLINEAR2_1410_TICK(t)
+# define BFI_FLINEAR2_1409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1408, v ds
+# define BFI_FLINEAR2_1409_TICK(t)
+# define BFI_FLINEAR2_1408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1407, v ds
+# define BFI_FLINEAR2_1408_TICK(t)
+# define BFI_FLINEAR2_1407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1406, v ds
+# define BFI_FLINEAR2_1407_TICK(t)
+# define BFI_FLINEAR2_1406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1405, v ds
+# define BFI_FLINEAR2_1406_TICK(t)
+# define BFI_FLINEAR2_1405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1404, v ds
+# define BFI_FLINEAR2_1405_TICK(t)
+# define BFI_FLINEAR2_1404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1403, v ds
+# define BFI_FLINEAR2_1404_TICK(t)
+# define BFI_FLINEAR2_1403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1402, v ds
+# define BFI_FLINEAR2_1403_TICK(t)
+# define BFI_FLINEAR2_1402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1401, v ds
+# define BFI_FLINEAR2_1402_TICK(t)
+# define BFI_FLINEAR2_1401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1400, v ds
+# define BFI_FLINEAR2_1401_TICK(t)
+# define BFI_FLINEAR2_1400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1399, v ds
+# define BFI_FLINEAR2_1400_TICK(t)
+# define BFI_FLINEAR2_1399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1398, v ds
+# define BFI_FLINEAR2_1399_TICK(t)
+# define BFI_FLINEAR2_1398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1397, v ds
+# define BFI_FLINEAR2_1398_TICK(t)
+# define BFI_FLINEAR2_1397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1396, v ds
+# define BFI_FLINEAR2_1397_TICK(t)
+# define BFI_FLINEAR2_1396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1395, v ds
+# define BFI_FLINEAR2_1396_TICK(t)
+# define BFI_FLINEAR2_1395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1394, v ds
+# define BFI_FLINEAR2_1395_TICK(t)
+# define BFI_FLINEAR2_1394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1393, v ds
+# define BFI_FLINEAR2_1394_TICK(t)
+# define BFI_FLINEAR2_1393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1392, v ds
+# define BFI_FLINEAR2_1393_TICK(t)
+# define BFI_FLINEAR2_1392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1391, v ds
+# define BFI_FLINEAR2_1392_TICK(t)
+# define BFI_FLINEAR2_1391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1390, v ds
+# define BFI_FLINEAR2_1391_TICK(t)
+# define BFI_FLINEAR2_1390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1389, v ds
+# define BFI_FLINEAR2_1390_TICK(t)
+# define BFI_FLINEAR2_1389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1388, v ds
+# define BFI_FLINEAR2_1389_TICK(t)
+# define BFI_FLINEAR2_1388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1387, v ds
+# define BFI_FLINEAR2_1388_TICK(t)
+# define BFI_FLINEAR2_1387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1386, v ds
+# define BFI_FLINEAR2_1387_TICK(t)
+# define BFI_FLINEAR2_1386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1385, v ds
+# define BFI_FLINEAR2_1386_TICK(t)
+# define BFI_FLINEAR2_1385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1384, v ds
+# define BFI_FLINEAR2_1385_TICK(t)
+# define BFI_FLINEAR2_1384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1383, v ds
+# define BFI_FLINEAR2_1384_TICK(t)
+# define BFI_FLINEAR2_1383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1382, v ds
+# define BFI_FLINEAR2_1383_TICK(t)
+# define BFI_FLINEAR2_1382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1381, v ds
+# define BFI_FLINEAR2_1382_TICK(t)
+# define BFI_FLINEAR2_1381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1380, v ds
+# define BFI_FLINEAR2_1381_TICK(t)
+# define BFI_FLINEAR2_1380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1379, v ds
+# define BFI_FLINEAR2_1380_TICK(t)
+# define BFI_FLINEAR2_1379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1378, v ds
+# define BFI_FLINEAR2_1379_TICK(t)
+# define BFI_FLINEAR2_1378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1377, v ds
+# define BFI_FLINEAR2_1378_TICK(t)
+# define BFI_FLINEAR2_1377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1376, v ds
+# define BFI_FLINEAR2_1377_TICK(t)
+# define BFI_FLINEAR2_1376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1375, v ds
+# define BFI_FLINEAR2_1376_TICK(t)
+# define BFI_FLINEAR2_1375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1374, v ds
+# define BFI_FLINEAR2_1375_TICK(t)
+# define BFI_FLINEAR2_1374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1373, v ds
+# define BFI_FLINEAR2_1374_TICK(t)
+# define BFI_FLINEAR2_1373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1372, v ds
+# define BFI_FLINEAR2_1373_TICK(t)
+# define BFI_FLINEAR2_1372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1371, v ds
+# define BFI_FLINEAR2_1372_TICK(t)
+# define BFI_FLINEAR2_1371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1370, v ds
+# define BFI_FLINEAR2_1371_TICK(t)
+# define BFI_FLINEAR2_1370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1369, v ds
+# define BFI_FLINEAR2_1370_TICK(t)
+# define BFI_FLINEAR2_1369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1368, v ds
+# define BFI_FLINEAR2_1369_TICK(t)
+# define BFI_FLINEAR2_1368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1367, v ds
+# define BFI_FLINEAR2_1368_TICK(t)
+# define BFI_FLINEAR2_1367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1366, v ds
+# define BFI_FLINEAR2_1367_TICK(t)
+# define BFI_FLINEAR2_1366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1365, v ds
+# define BFI_FLINEAR2_1366_TICK(t)
+# define BFI_FLINEAR2_1365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1364, v ds
+# define BFI_FLINEAR2_1365_TICK(t)
+# define BFI_FLINEAR2_1364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1363, v ds
+# define BFI_FLINEAR2_1364_TICK(t)
+# define BFI_FLINEAR2_1363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1362, v ds
+# define BFI_FLINEAR2_1363_TICK(t)
+# define BFI_FLINEAR2_1362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1361, v ds
+# define BFI_FLINEAR2_1362_TICK(t)
+# define BFI_FLINEAR2_1361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1360, v ds
+# define BFI_FLINEAR2_1361_TICK(t)
+# define BFI_FLINEAR2_1360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1359, v ds
+# define BFI_FLINEAR2_1360_TICK(t)
+# define BFI_FLINEAR2_1359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1358, v ds
+# define BFI_FLINEAR2_1359_TICK(t)
+# define BFI_FLINEAR2_1358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1357, v ds
+# define BFI_FLINEAR2_1358_TICK(t)
+# define BFI_FLINEAR2_1357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1356, v ds
+# define BFI_FLINEAR2_1357_TICK(t)
+# define BFI_FLINEAR2_1356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1355, v ds
+# define BFI_FLINEAR2_1356_TICK(t)
+# define BFI_FLINEAR2_1355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1354, v ds
+# define BFI_FLINEAR2_1355_TICK(t)
+# define BFI_FLINEAR2_1354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1353, v ds
+# define BFI_FLINEAR2_1354_TICK(t)
+# define BFI_FLINEAR2_1353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1352, v ds
+# define BFI_FLINEAR2_1353_TICK(t)
+# define BFI_FLINEAR2_1352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1351, v ds
+# define BFI_FLINEAR2_1352_TICK(t)
+# define BFI_FLINEAR2_1351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1350, v ds
+# define BFI_FLINEAR2_1351_TICK(t)
+# define BFI_FLINEAR2_1350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1349, v ds
+# define BFI_FLINEAR2_1350_TICK(t)
+# define BFI_FLINEAR2_1349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1348, v ds
+# define BFI_FLINEAR2_1349_TICK(t)
+# define BFI_FLINEAR2_1348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1347, v ds
+# define BFI_FLINEAR2_1348_TICK(t)
+# define BFI_FLINEAR2_1347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1346, v ds
+# define BFI_FLINEAR2_1347_TICK(t)
+# define BFI_FLINEAR2_1346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1345, v ds
+# define BFI_FLINEAR2_1346_TICK(t)
+# define BFI_FLINEAR2_1345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1344, v ds
+# define BFI_FLINEAR2_1345_TICK(t)
+# define BFI_FLINEAR2_1344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1343, v ds
+# define BFI_FLINEAR2_1344_TICK(t)
+# define BFI_FLINEAR2_1343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1342, v ds
+# define BFI_FLINEAR2_1343_TICK(t)
+# define BFI_FLINEAR2_1342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1341, v ds
+# define BFI_FLINEAR2_1342_TICK(t)
+# define BFI_FLINEAR2_1341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1340, v ds
+# define BFI_FLINEAR2_1341_TICK(t)
+# define BFI_FLINEAR2_1340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1339, v ds
+# define BFI_FLINEAR2_1340_TICK(t)
+# define BFI_FLINEAR2_1339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1338, v ds
+# define BFI_FLINEAR2_1339_TICK(t)
+# define BFI_FLINEAR2_1338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1337, v ds
+# define BFI_FLINEAR2_1338_TICK(t)
+# define BFI_FLINEAR2_1337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1336, v ds
+# define BFI_FLINEAR2_1337_TICK(t)
+# define BFI_FLINEAR2_1336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1335, v ds
+# define BFI_FLINEAR2_1336_TICK(t)
+# define BFI_FLINEAR2_1335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1334, v ds
+# define BFI_FLINEAR2_1335_TICK(t)
+# define BFI_FLINEAR2_1334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1333, v ds
+# define BFI_FLINEAR2_1334_TICK(t)
+# define BFI_FLINEAR2_1333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1332, v ds
+# define BFI_FLINEAR2_1333_TICK(t)
+# define BFI_FLINEAR2_1332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1331, v ds
+# define BFI_FLINEAR2_1332_TICK(t)
+# define BFI_FLINEAR2_1331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1330, v ds
+# define BFI_FLINEAR2_1331_TICK(t)
+# define BFI_FLINEAR2_1330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1329, v ds
+# define BFI_FLINEAR2_1330_TICK(t)
+# define BFI_FLINEAR2_1329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1328, v ds
+# define BFI_FLINEAR2_1329_TICK(t)
+# define BFI_FLINEAR2_1328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1327, v ds
+# define BFI_FLINEAR2_1328_TICK(t)
+# define BFI_FLINEAR2_1327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1326, v ds
+# define BFI_FLINEAR2_1327_TICK(t)
+# define BFI_FLINEAR2_1326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1325, v ds
+# define BFI_FLINEAR2_1326_TICK(t)
+# define BFI_FLINEAR2_1325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1324, v ds
+# define BFI_FLINEAR2_1325_TICK(t)
+# define BFI_FLINEAR2_1324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1323, v ds
+# define BFI_FLINEAR2_1324_TICK(t)
+# define BFI_FLINEAR2_1323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1322, v ds
+# define BFI_FLINEAR2_1323_TICK(t)
+# define BFI_FLINEAR2_1322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1321, v ds
+# define BFI_FLINEAR2_1322_TICK(t)
+# define BFI_FLINEAR2_1321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1320, v ds
+# define BFI_FLINEAR2_1321_TICK(t)
+# define BFI_FLINEAR2_1320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1319, v ds
+# define BFI_FLINEAR2_1320_TICK(t)
+# define BFI_FLINEAR2_1319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1318, v ds
+# define BFI_FLINEAR2_1319_TICK(t)
+# define BFI_FLINEAR2_1318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1317, v ds
+# define BFI_FLINEAR2_1318_TICK(t)
+# define BFI_FLINEAR2_1317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1316, v ds
+# define BFI_FLINEAR2_1317_TICK(t)
+# define BFI_FLINEAR2_1316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1315, v ds
+# define BFI_FLINEAR2_1316_TICK(t)
+# define BFI_FLINEAR2_1315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1314, v ds
+# define BFI_FLINEAR2_1315_TICK(t)
+# define BFI_FLINEAR2_1314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1313, v ds
+# define BFI_FLINEAR2_1314_TICK(t)
+# define BFI_FLINEAR2_1313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1312, v ds
+# define BFI_FLINEAR2_1313_TICK(t)
+# define BFI_FLINEAR2_1312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1311, v ds
+# define BFI_FLINEAR2_1312_TICK(t)
+# define BFI_FLINEAR2_1311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1310, v ds
+# define BFI_FLINEAR2_1311_TICK(t)
+# define BFI_FLINEAR2_1310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1309, v ds
+# define BFI_FLINEAR2_1310_TICK(t)
+# define BFI_FLINEAR2_1309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1308, v ds
+# define BFI_FLINEAR2_1309_TICK(t)
+# define BFI_FLINEAR2_1308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1307, v ds
+# define BFI_FLINEAR2_1308_TICK(t)
+# define BFI_FLINEAR2_1307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1306, v ds
+# define BFI_FLINEAR2_1307_TICK(t)
+# define BFI_FLINEAR2_1306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1305, v ds
+# define BFI_FLINEAR2_1306_TICK(t)
+# define BFI_FLINEAR2_1305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1304, v ds
+# define BFI_FLINEAR2_1305_TICK(t)
+# define BFI_FLINEAR2_1304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1303, v ds
+# define BFI_FLINEAR2_1304_TICK(t)
+# define BFI_FLINEAR2_1303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1302, v ds
+# define BFI_FLINEAR2_1303_TICK(t)
+# define BFI_FLINEAR2_1302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1301, v ds
+# define BFI_FLINEAR2_1302_TICK(t)
+# define BFI_FLINEAR2_1301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1300, v ds
+# define BFI_FLINEAR2_1301_TICK(t)
+# define BFI_FLINEAR2_1300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1299, v ds
+# define BFI_FLINEAR2_1300_TICK(t)
+# define BFI_FLINEAR2_1299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1298, v ds
+# define BFI_FLINEAR2_1299_TICK(t)
+# define BFI_FLINEAR2_1298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1297, v ds
+# define BFI_FLINEAR2_1298_TICK(t)
+# define BFI_FLINEAR2_1297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1296, v ds
+# define BFI_FLINEAR2_1297_TICK(t)
+# define BFI_FLINEAR2_1296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1295, v ds
+# define BFI_FLINEAR2_1296_TICK(t)
+# define BFI_FLINEAR2_1295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1294, v ds
+# define BFI_FLINEAR2_1295_TICK(t)
+# define BFI_FLINEAR2_1294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1293, v ds
+# define BFI_FLINEAR2_1294_TICK(t)
+# define BFI_FLINEAR2_1293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1292, v ds
+# define BFI_FLINEAR2_1293_TICK(t)
+# define BFI_FLINEAR2_1292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1291, v ds
+# define BFI_FLINEAR2_1292_TICK(t)
+# define BFI_FLINEAR2_1291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1290, v ds
+# define BFI_FLINEAR2_1291_TICK(t)
+# define BFI_FLINEAR2_1290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1289, v ds
+# define BFI_FLINEAR2_1290_TICK(t)
+# define BFI_FLINEAR2_1289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1288, v ds
+# define BFI_FLINEAR2_1289_TICK(t)
+# define BFI_FLINEAR2_1288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1287, v ds
+# define BFI_FLINEAR2_1288_TICK(t)
+# define BFI_FLINEAR2_1287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1286, v ds
+# define BFI_FLINEAR2_1287_TICK(t)
+# define BFI_FLINEAR2_1286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1285, v ds
+# define BFI_FLINEAR2_1286_TICK(t)
+# define BFI_FLINEAR2_1285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1284, v ds
+# define BFI_FLINEAR2_1285_TICK(t)
+# define BFI_FLINEAR2_1284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1283, v ds
+# define BFI_FLINEAR2_1284_TICK(t)
+# define BFI_FLINEAR2_1283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1282, v ds
+# define BFI_FLINEAR2_1283_TICK(t)
+# define BFI_FLINEAR2_1282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1281, v ds
+# define BFI_FLINEAR2_1282_TICK(t)
+# define BFI_FLINEAR2_1281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1280, v ds
+# define BFI_FLINEAR2_1281_TICK(t)
+# define BFI_FLINEAR2_1280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1279, v ds
+# define BFI_FLINEAR2_1280_TICK(t)
+# define BFI_FLINEAR2_1279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1278, v ds
+# define BFI_FLINEAR2_1279_TICK(t)
+# define BFI_FLINEAR2_1278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1277, v ds
+# define BFI_FLINEAR2_1278_TICK(t)
+# define BFI_FLINEAR2_1277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1276, v ds
+# define BFI_FLINEAR2_1277_TICK(t)
+# define BFI_FLINEAR2_1276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1275, v ds
+# define BFI_FLINEAR2_1276_TICK(t)
+# define BFI_FLINEAR2_1275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1274, v ds
+# define BFI_FLINEAR2_1275_TICK(t)
+# define BFI_FLINEAR2_1274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1273, v ds
+# define BFI_FLINEAR2_1274_TICK(t)
+# define BFI_FLINEAR2_1273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1272, v ds
+# define BFI_FLINEAR2_1273_TICK(t)
+# define BFI_FLINEAR2_1272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1271, v ds
+# define BFI_FLINEAR2_1272_TICK(t)
+# define BFI_FLINEAR2_1271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1270, v ds
+# define BFI_FLINEAR2_1271_TICK(t)
+# define BFI_FLINEAR2_1270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1269, v ds
+# define BFI_FLINEAR2_1270_TICK(t)
+# define BFI_FLINEAR2_1269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1268, v ds
+# define BFI_FLINEAR2_1269_TICK(t)
+# define BFI_FLINEAR2_1268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1267, v ds
+# define BFI_FLINEAR2_1268_TICK(t)
+# define BFI_FLINEAR2_1267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1266, v ds
+# define BFI_FLINEAR2_1267_TICK(t)
+# define BFI_FLINEAR2_1266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1265, v ds
+# define BFI_FLINEAR2_1266_TICK(t)
+# define BFI_FLINEAR2_1265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1264, v ds
+# define BFI_FLINEAR2_1265_TICK(t)
+# define BFI_FLINEAR2_1264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1263, v ds
+# define BFI_FLINEAR2_1264_TICK(t)
+# define BFI_FLINEAR2_1263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1262, v ds
+# define BFI_FLINEAR2_1263_TICK(t)
+# define BFI_FLINEAR2_1262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1261, v ds
+# define BFI_FLINEAR2_1262_TICK(t)
+# define BFI_FLINEAR2_1261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1260, v ds
+# define BFI_FLINEAR2_1261_TICK(t)
+# define BFI_FLINEAR2_1260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1259, v ds
+# define BFI_FLINEAR2_1260_TICK(t)
+# define BFI_FLINEAR2_1259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1258, v ds
+# define BFI_FLINEAR2_1259_TICK(t)
+# define BFI_FLINEAR2_1258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1257, v ds
+# define BFI_FLINEAR2_1258_TICK(t)
+# define BFI_FLINEAR2_1257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1256, v ds
+# define BFI_FLINEAR2_1257_TICK(t)
+# define BFI_FLINEAR2_1256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1255, v ds
+# define BFI_FLINEAR2_1256_TICK(t)
+# define BFI_FLINEAR2_1255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1254, v ds
+# define BFI_FLINEAR2_1255_TICK(t)
+# define BFI_FLINEAR2_1254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1253, v ds
+# define BFI_FLINEAR2_1254_TICK(t)
+# define BFI_FLINEAR2_1253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1252, v ds
+# define BFI_FLINEAR2_1253_TICK(t)
+# define BFI_FLINEAR2_1252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1251, v ds
+# define BFI_FLINEAR2_1252_TICK(t)
+# define BFI_FLINEAR2_1251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1250, v ds
+# define BFI_FLINEAR2_1251_TICK(t)
+# define BFI_FLINEAR2_1250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1249, v ds
+# define BFI_FLINEAR2_1250_TICK(t)
+# define BFI_FLINEAR2_1249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1248, v ds
+# define BFI_FLINEAR2_1249_TICK(t)
+# define BFI_FLINEAR2_1248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1247, v ds
+# define BFI_FLINEAR2_1248_TICK(t)
+# define BFI_FLINEAR2_1247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1246, v ds
+# define BFI_FLINEAR2_1247_TICK(t)
+# define BFI_FLINEAR2_1246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1245, v ds
+# define BFI_FLINEAR2_1246_TICK(t)
+# define BFI_FLINEAR2_1245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1244, v ds
+# define BFI_FLINEAR2_1245_TICK(t)
+# define BFI_FLINEAR2_1244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1243, v ds
+# define BFI_FLINEAR2_1244_TICK(t)
+# define BFI_FLINEAR2_1243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1242, v ds
+# define BFI_FLINEAR2_1243_TICK(t)
+# define BFI_FLINEAR2_1242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1241, v ds
+# define BFI_FLINEAR2_1242_TICK(t)
+# define BFI_FLINEAR2_1241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1240, v ds
+# define BFI_FLINEAR2_1241_TICK(t)
+# define BFI_FLINEAR2_1240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1239, v ds
+# define BFI_FLINEAR2_1240_TICK(t)
+# define BFI_FLINEAR2_1239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1238, v ds
+# define BFI_FLINEAR2_1239_TICK(t)
+# define BFI_FLINEAR2_1238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1237, v ds
+# define BFI_FLINEAR2_1238_TICK(t)
+# define BFI_FLINEAR2_1237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1236, v ds
+# define BFI_FLINEAR2_1237_TICK(t)
+# define BFI_FLINEAR2_1236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1235, v ds
+# define BFI_FLINEAR2_1236_TICK(t)
+# define BFI_FLINEAR2_1235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1234, v ds
+# define BFI_FLINEAR2_1235_TICK(t)
+# define BFI_FLINEAR2_1234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1233, v ds
+# define BFI_FLINEAR2_1234_TICK(t)
+# define BFI_FLINEAR2_1233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1232, v ds
+# define BFI_FLINEAR2_1233_TICK(t)
+# define BFI_FLINEAR2_1232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1231, v ds
+# define BFI_FLINEAR2_1232_TICK(t)
+# define BFI_FLINEAR2_1231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1230, v ds
+# define BFI_FLINEAR2_1231_TICK(t)
+# define BFI_FLINEAR2_1230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1229, v ds
+# define BFI_FLINEAR2_1230_TICK(t)
+# define BFI_FLINEAR2_1229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1228, v ds
+# define BFI_FLINEAR2_1229_TICK(t)
+# define BFI_FLINEAR2_1228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1227, v ds
+# define BFI_FLINEAR2_1228_TICK(t)
+# define BFI_FLINEAR2_1227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1226, v ds
+# define BFI_FLINEAR2_1227_TICK(t)
+# define BFI_FLINEAR2_1226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1225, v ds
+# define BFI_FLINEAR2_1226_TICK(t)
+# define BFI_FLINEAR2_1225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1224, v ds
+# define BFI_FLINEAR2_1225_TICK(t)
+# define BFI_FLINEAR2_1224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1223, v ds
+# define BFI_FLINEAR2_1224_TICK(t)
+# define BFI_FLINEAR2_1223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1222, v ds
+# define BFI_FLINEAR2_1223_TICK(t)
+# define BFI_FLINEAR2_1222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1221, v ds
+# define BFI_FLINEAR2_1222_TICK(t)
+# define BFI_FLINEAR2_1221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1220, v ds
+# define BFI_FLINEAR2_1221_TICK(t)
+# define BFI_FLINEAR2_1220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1219, v ds
+# define BFI_FLINEAR2_1220_TICK(t)
+# define BFI_FLINEAR2_1219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1218, v ds
+# define BFI_FLINEAR2_1219_TICK(t)
+# define BFI_FLINEAR2_1218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1217, v ds
+# define BFI_FLINEAR2_1218_TICK(t)
+# define BFI_FLINEAR2_1217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1216, v ds
+# define BFI_FLINEAR2_1217_TICK(t)
+# define BFI_FLINEAR2_1216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1215, v ds
+# define BFI_FLINEAR2_1216_TICK(t)
+# define BFI_FLINEAR2_1215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1214, v ds
+# define BFI_FLINEAR2_1215_TICK(t)
+# define BFI_FLINEAR2_1214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1213, v ds
+# define BFI_FLINEAR2_1214_TICK(t)
+# define BFI_FLINEAR2_1213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1212, v ds
+# define BFI_FLINEAR2_1213_TICK(t)
+# define BFI_FLINEAR2_1212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1211, v ds
+# define BFI_FLINEAR2_1212_TICK(t)
+# define BFI_FLINEAR2_1211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1210, v ds
+# define BFI_FLINEAR2_1211_TICK(t)
+# define BFI_FLINEAR2_1210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1209, v ds
+# define BFI_FLINEAR2_1210_TICK(t)
+# define BFI_FLINEAR2_1209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1208, v ds
+# define BFI_FLINEAR2_1209_TICK(t)
+# define BFI_FLINEAR2_1208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1207, v ds
+# define BFI_FLINEAR2_1208_TICK(t)
+# define BFI_FLINEAR2_1207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1206, v ds
+# define BFI_FLINEAR2_1207_TICK(t)
+# define BFI_FLINEAR2_1206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1205, v ds
+# define BFI_FLINEAR2_1206_TICK(t)
+# define BFI_FLINEAR2_1205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1204, v ds
+# define BFI_FLINEAR2_1205_TICK(t)
+# define BFI_FLINEAR2_1204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1203, v ds
+# define BFI_FLINEAR2_1204_TICK(t)
+# define BFI_FLINEAR2_1203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1202, v ds
+# define BFI_FLINEAR2_1203_TICK(t)
+# define BFI_FLINEAR2_1202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1201, v ds
+# define BFI_FLINEAR2_1202_TICK(t)
+# define BFI_FLINEAR2_1201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1200, v ds
+# define BFI_FLINEAR2_1201_TICK(t)
+# define BFI_FLINEAR2_1200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1199, v ds
+# define BFI_FLINEAR2_1200_TICK(t)
+# define BFI_FLINEAR2_1199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1198, v ds
+# define BFI_FLINEAR2_1199_TICK(t)
+# define BFI_FLINEAR2_1198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1197, v ds
+# define BFI_FLINEAR2_1198_TICK(t)
+# define BFI_FLINEAR2_1197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1196, v ds
+# define BFI_FLINEAR2_1197_TICK(t)
+# define BFI_FLINEAR2_1196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1195, v ds
+# define BFI_FLINEAR2_1196_TICK(t)
+# define BFI_FLINEAR2_1195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1194, v ds
+# define BFI_FLINEAR2_1195_TICK(t)
+# define BFI_FLINEAR2_1194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1193, v ds
+# define BFI_FLINEAR2_1194_TICK(t)
+# define BFI_FLINEAR2_1193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1192, v ds
+# define BFI_FLINEAR2_1193_TICK(t)
+# define BFI_FLINEAR2_1192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1191, v ds
+# define BFI_FLINEAR2_1192_TICK(t)
+# define BFI_FLINEAR2_1191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1190, v ds
+# define BFI_FLINEAR2_1191_TICK(t)
+# define BFI_FLINEAR2_1190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1189, v ds
+# define BFI_FLINEAR2_1190_TICK(t)
+# define BFI_FLINEAR2_1189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1188, v ds
+# define BFI_FLINEAR2_1189_TICK(t)
+# define BFI_FLINEAR2_1188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1187, v ds
+# define BFI_FLINEAR2_1188_TICK(t)
+# define BFI_FLINEAR2_1187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1186, v ds
+# define BFI_FLINEAR2_1187_TICK(t)
+# define BFI_FLINEAR2_1186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1185, v ds
+# define BFI_FLINEAR2_1186_TICK(t)
+# define BFI_FLINEAR2_1185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1184, v ds
+# define BFI_FLINEAR2_1185_TICK(t)
+# define BFI_FLINEAR2_1184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1183, v ds
+# define BFI_FLINEAR2_1184_TICK(t)
+# define BFI_FLINEAR2_1183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1182, v ds
+# define BFI_FLINEAR2_1183_TICK(t)
+# define BFI_FLINEAR2_1182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1181, v ds
+# define BFI_FLINEAR2_1182_TICK(t)
+# define BFI_FLINEAR2_1181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1180, v ds
+# define BFI_FLINEAR2_1181_TICK(t)
+# define BFI_FLINEAR2_1180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1179, v ds
+# define BFI_FLINEAR2_1180_TICK(t)
+# define BFI_FLINEAR2_1179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1178, v ds
+# define BFI_FLINEAR2_1179_TICK(t)
+# define BFI_FLINEAR2_1178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1177, v ds
+# define BFI_FLINEAR2_1178_TICK(t)
+# define BFI_FLINEAR2_1177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1176, v ds
+# define BFI_FLINEAR2_1177_TICK(t)
+# define BFI_FLINEAR2_1176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1175, v ds
+# define BFI_FLINEAR2_1176_TICK(t)
+# define BFI_FLINEAR2_1175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1174, v ds
+# define BFI_FLINEAR2_1175_TICK(t)
+# define BFI_FLINEAR2_1174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1173, v ds
+# define BFI_FLINEAR2_1174_TICK(t)
+# define BFI_FLINEAR2_1173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1172, v ds
+# define BFI_FLINEAR2_1173_TICK(t)
+# define BFI_FLINEAR2_1172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1171, v ds
+# define BFI_FLINEAR2_1172_TICK(t)
+# define BFI_FLINEAR2_1171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1170, v ds
+# define BFI_FLINEAR2_1171_TICK(t)
+# define BFI_FLINEAR2_1170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1169, v ds
+# define BFI_FLINEAR2_1170_TICK(t)
+# define BFI_FLINEAR2_1169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1168, v ds
+# define BFI_FLINEAR2_1169_TICK(t)
+# define BFI_FLINEAR2_1168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1167, v ds
+# define BFI_FLINEAR2_1168_TICK(t)
+# define BFI_FLINEAR2_1167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1166, v ds
+# define BFI_FLINEAR2_1167_TICK(t)
+# define BFI_FLINEAR2_1166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1165, v ds
+# define BFI_FLINEAR2_1166_TICK(t)
+# define BFI_FLINEAR2_1165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1164, v ds
+# define BFI_FLINEAR2_1165_TICK(t)
+# define BFI_FLINEAR2_1164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1163, v ds
+# define BFI_FLINEAR2_1164_TICK(t)
+# define BFI_FLINEAR2_1163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1162, v ds
+# define BFI_FLINEAR2_1163_TICK(t)
+# define BFI_FLINEAR2_1162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1161, v ds
+# define BFI_FLINEAR2_1162_TICK(t)
+# define BFI_FLINEAR2_1161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1160, v ds
+# define BFI_FLINEAR2_1161_TICK(t)
+# define BFI_FLINEAR2_1160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1159, v ds
+# define BFI_FLINEAR2_1160_TICK(t)
+# define BFI_FLINEAR2_1159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1158, v ds
+# define BFI_FLINEAR2_1159_TICK(t)
+# define BFI_FLINEAR2_1158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1157, v ds
+# define BFI_FLINEAR2_1158_TICK(t)
+# define BFI_FLINEAR2_1157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1156, v ds
+# define BFI_FLINEAR2_1157_TICK(t)
+# define BFI_FLINEAR2_1156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1155, v ds
+# define BFI_FLINEAR2_1156_TICK(t)
+# define BFI_FLINEAR2_1155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1154, v ds
+# define BFI_FLINEAR2_1155_TICK(t)
+# define BFI_FLINEAR2_1154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1153, v ds
+# define BFI_FLINEAR2_1154_TICK(t)
+# define BFI_FLINEAR2_1153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1152, v ds
+# define BFI_FLINEAR2_1153_TICK(t)
+# define BFI_FLINEAR2_1152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1151, v ds
+# define BFI_FLINEAR2_1152_TICK(t)
+# define BFI_FLINEAR2_1151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1150, v ds
+# define BFI_FLINEAR2_1151_TICK(t)
+# define BFI_FLINEAR2_1150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1149, v ds
+# define BFI_FLINEAR2_1150_TICK(t)
+# define BFI_FLINEAR2_1149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1148, v ds
+# define BFI_FLINEAR2_1149_TICK(t)
+# define BFI_FLINEAR2_1148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1147, v ds
+# define BFI_FLINEAR2_1148_TICK(t)
+# define BFI_FLINEAR2_1147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1146, v ds
+# define BFI_FLINEAR2_1147_TICK(t)
+# define BFI_FLINEAR2_1146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1145, v ds
+# define BFI_FLINEAR2_1146_TICK(t)
+# define BFI_FLINEAR2_1145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1144, v ds
+# define BFI_FLINEAR2_1145_TICK(t)
+# define BFI_FLINEAR2_1144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1143, v ds
+# define BFI_FLINEAR2_1144_TICK(t)
+# define BFI_FLINEAR2_1143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1142, v ds
+# define BFI_FLINEAR2_1143_TICK(t)
+# define BFI_FLINEAR2_1142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1141, v ds
+# define BFI_FLINEAR2_1142_TICK(t)
+# define BFI_FLINEAR2_1141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1140, v ds
+# define BFI_FLINEAR2_1141_TICK(t)
+# define BFI_FLINEAR2_1140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1139, v ds
+# define BFI_FLINEAR2_1140_TICK(t)
+# define BFI_FLINEAR2_1139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1138, v ds
+# define BFI_FLINEAR2_1139_TICK(t)
+# define BFI_FLINEAR2_1138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1137, v ds
+# define BFI_FLINEAR2_1138_TICK(t)
+# define BFI_FLINEAR2_1137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1136, v ds
+# define BFI_FLINEAR2_1137_TICK(t)
+# define BFI_FLINEAR2_1136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1135, v ds
+# define BFI_FLINEAR2_1136_TICK(t)
+# define BFI_FLINEAR2_1135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1134, v ds
+# define BFI_FLINEAR2_1135_TICK(t)
+# define BFI_FLINEAR2_1134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1133, v ds
+# define BFI_FLINEAR2_1134_TICK(t)
+# define BFI_FLINEAR2_1133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1132, v ds
+# define BFI_FLINEAR2_1133_TICK(t)
+# define BFI_FLINEAR2_1132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1131, v ds
+# define BFI_FLINEAR2_1132_TICK(t)
+# define BFI_FLINEAR2_1131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1130, v ds
+# define BFI_FLINEAR2_1131_TICK(t)
+# define BFI_FLINEAR2_1130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1129, v ds
+# define BFI_FLINEAR2_1130_TICK(t)
+# define BFI_FLINEAR2_1129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1128, v ds
+# define BFI_FLINEAR2_1129_TICK(t)
+# define BFI_FLINEAR2_1128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1127, v ds
+# define BFI_FLINEAR2_1128_TICK(t)
+# define BFI_FLINEAR2_1127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1126, v ds
+# define BFI_FLINEAR2_1127_TICK(t)
+# define BFI_FLINEAR2_1126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1125, v ds
+# define BFI_FLINEAR2_1126_TICK(t)
+# define BFI_FLINEAR2_1125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1124, v ds
+# define BFI_FLINEAR2_1125_TICK(t)
+# define BFI_FLINEAR2_1124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1123, v ds
+# define BFI_FLINEAR2_1124_TICK(t)
+# define BFI_FLINEAR2_1123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1122, v ds
+# define BFI_FLINEAR2_1123_TICK(t)
+# define BFI_FLINEAR2_1122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1121, v ds
+# define BFI_FLINEAR2_1122_TICK(t)
+# define BFI_FLINEAR2_1121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1120, v ds
+# define BFI_FLINEAR2_1121_TICK(t)
+# define BFI_FLINEAR2_1120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1119, v ds
+# define BFI_FLINEAR2_1120_TICK(t)
+# define BFI_FLINEAR2_1119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1118, v ds
+# define BFI_FLINEAR2_1119_TICK(t)
+# define BFI_FLINEAR2_1118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1117, v ds
+# define BFI_FLINEAR2_1118_TICK(t)
+# define BFI_FLINEAR2_1117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1116, v ds
+# define BFI_FLINEAR2_1117_TICK(t)
+# define BFI_FLINEAR2_1116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1115, v ds
+# define BFI_FLINEAR2_1116_TICK(t)
+# define BFI_FLINEAR2_1115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1114, v ds
+# define BFI_FLINEAR2_1115_TICK(t)
+# define BFI_FLINEAR2_1114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1113, v ds
+# define BFI_FLINEAR2_1114_TICK(t)
+# define BFI_FLINEAR2_1113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1112, v ds
+# define BFI_FLINEAR2_1113_TICK(t)
+# define BFI_FLINEAR2_1112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1111, v ds
+# define BFI_FLINEAR2_1112_TICK(t)
+# define BFI_FLINEAR2_1111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1110, v ds
+# define BFI_FLINEAR2_1111_TICK(t)
+# define BFI_FLINEAR2_1110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1109, v ds
+# define BFI_FLINEAR2_1110_TICK(t)
+# define BFI_FLINEAR2_1109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1108, v ds
+# define BFI_FLINEAR2_1109_TICK(t)
+# define BFI_FLINEAR2_1108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1107, v ds
+# define BFI_FLINEAR2_1108_TICK(t)
+# define BFI_FLINEAR2_1107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1106, v ds
+# define BFI_FLINEAR2_1107_TICK(t)
+# define BFI_FLINEAR2_1106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1105, v ds
+# define BFI_FLINEAR2_1106_TICK(t)
+# define BFI_FLINEAR2_1105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1104, v ds
+# define BFI_FLINEAR2_1105_TICK(t)
+# define BFI_FLINEAR2_1104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1103, v ds
+# define BFI_FLINEAR2_1104_TICK(t)
+# define BFI_FLINEAR2_1103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1102, v ds
+# define BFI_FLINEAR2_1103_TICK(t)
+# define BFI_FLINEAR2_1102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1101, v ds
+# define BFI_FLINEAR2_1102_TICK(t)
+# define BFI_FLINEAR2_1101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1100, v ds
+# define BFI_FLINEAR2_1101_TICK(t)
+# define BFI_FLINEAR2_1100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1099, v ds
+# define BFI_FLINEAR2_1100_TICK(t)
+# define BFI_FLINEAR2_1099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1098, v ds
+# define BFI_FLINEAR2_1099_TICK(t)
+# define BFI_FLINEAR2_1098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1097, v ds
+# define BFI_FLINEAR2_1098_TICK(t)
+# define BFI_FLINEAR2_1097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1096, v ds
+# define BFI_FLINEAR2_1097_TICK(t)
+# define BFI_FLINEAR2_1096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1095, v ds
+# define BFI_FLINEAR2_1096_TICK(t)
+# define BFI_FLINEAR2_1095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1094, v ds
+# define BFI_FLINEAR2_1095_TICK(t)
+# define BFI_FLINEAR2_1094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1093, v ds
+# define BFI_FLINEAR2_1094_TICK(t)
+# define BFI_FLINEAR2_1093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1092, v ds
+# define BFI_FLINEAR2_1093_TICK(t)
+# define BFI_FLINEAR2_1092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1091, v ds
+# define BFI_FLINEAR2_1092_TICK(t)
+# define BFI_FLINEAR2_1091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1090, v ds
+# define BFI_FLINEAR2_1091_TICK(t)
+# define BFI_FLINEAR2_1090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1089, v ds
+# define BFI_FLINEAR2_1090_TICK(t)
+# define BFI_FLINEAR2_1089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1088, v ds
+# define BFI_FLINEAR2_1089_TICK(t)
+# define BFI_FLINEAR2_1088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1087, v ds
+# define BFI_FLINEAR2_1088_TICK(t)
+# define BFI_FLINEAR2_1087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1086, v ds
+# define BFI_FLINEAR2_1087_TICK(t)
+# define BFI_FLINEAR2_1086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1085, v ds
+# define BFI_FLINEAR2_1086_TICK(t)
+# define BFI_FLINEAR2_1085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1084, v ds
+# define BFI_FLINEAR2_1085_TICK(t)
+# define BFI_FLINEAR2_1084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1083, v ds
+# define BFI_FLINEAR2_1084_TICK(t)
+# define BFI_FLINEAR2_1083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1082, v ds
+# define BFI_FLINEAR2_1083_TICK(t)
+# define BFI_FLINEAR2_1082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1081, v ds
+# define BFI_FLINEAR2_1082_TICK(t)
+# define BFI_FLINEAR2_1081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1080, v ds
+# define BFI_FLINEAR2_1081_TICK(t)
+# define BFI_FLINEAR2_1080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1079, v ds
+# define BFI_FLINEAR2_1080_TICK(t)
+# define BFI_FLINEAR2_1079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1078, v ds
+# define BFI_FLINEAR2_1079_TICK(t)
+# define BFI_FLINEAR2_1078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1077, v ds
+# define BFI_FLINEAR2_1078_TICK(t)
+# define BFI_FLINEAR2_1077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1076, v ds
+# define BFI_FLINEAR2_1077_TICK(t)
+# define BFI_FLINEAR2_1076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1075, v ds
+# define BFI_FLINEAR2_1076_TICK(t)
+# define BFI_FLINEAR2_1075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1074, v ds
+# define BFI_FLINEAR2_1075_TICK(t)
+# define BFI_FLINEAR2_1074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1073, v ds
+# define BFI_FLINEAR2_1074_TICK(t)
+# define BFI_FLINEAR2_1073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1072, v ds
+# define BFI_FLINEAR2_1073_TICK(t)
+# define BFI_FLINEAR2_1072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1071, v ds
+# define BFI_FLINEAR2_1072_TICK(t)
+# define BFI_FLINEAR2_1071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1070, v ds
+# define BFI_FLINEAR2_1071_TICK(t)
+# define BFI_FLINEAR2_1070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1069, v ds
+# define BFI_FLINEAR2_1070_TICK(t)
+# define BFI_FLINEAR2_1069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1068, v ds
+# define BFI_FLINEAR2_1069_TICK(t)
+# define BFI_FLINEAR2_1068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1067, v ds
+# define BFI_FLINEAR2_1068_TICK(t)
+# define BFI_FLINEAR2_1067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1066, v ds
+# define BFI_FLINEAR2_1067_TICK(t)
+# define BFI_FLINEAR2_1066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1065, v ds
+# define BFI_FLINEAR2_1066_TICK(t)
+# define BFI_FLINEAR2_1065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1064, v ds
+# define BFI_FLINEAR2_1065_TICK(t)
+# define BFI_FLINEAR2_1064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1063, v ds
+# define BFI_FLINEAR2_1064_TICK(t)
+# define BFI_FLINEAR2_1063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1062, v ds
+# define BFI_FLINEAR2_1063_TICK(t)
+# define BFI_FLINEAR2_1062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1061, v ds
+# define BFI_FLINEAR2_1062_TICK(t)
+# define BFI_FLINEAR2_1061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1060, v ds
+# define BFI_FLINEAR2_1061_TICK(t)
+# define BFI_FLINEAR2_1060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1059, v ds
+# define BFI_FLINEAR2_1060_TICK(t)
+# define BFI_FLINEAR2_1059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1058, v ds
+# define BFI_FLINEAR2_1059_TICK(t)
+# define BFI_FLINEAR2_1058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1057, v ds
+# define BFI_FLINEAR2_1058_TICK(t)
+# define BFI_FLINEAR2_1057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1056, v ds
+# define BFI_FLINEAR2_1057_TICK(t)
+# define BFI_FLINEAR2_1056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1055, v ds
+# define BFI_FLINEAR2_1056_TICK(t)
+# define BFI_FLINEAR2_1055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1054, v ds
+# define BFI_FLINEAR2_1055_TICK(t)
+# define BFI_FLINEAR2_1054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1053, v ds
+# define BFI_FLINEAR2_1054_TICK(t)
+# define BFI_FLINEAR2_1053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1052, v ds
+# define BFI_FLINEAR2_1053_TICK(t)
+# define BFI_FLINEAR2_1052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1051, v ds
+# define BFI_FLINEAR2_1052_TICK(t)
+# define BFI_FLINEAR2_1051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1050, v ds
+# define BFI_FLINEAR2_1051_TICK(t)
+# define BFI_FLINEAR2_1050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1049, v ds
+# define BFI_FLINEAR2_1050_TICK(t)
+# define BFI_FLINEAR2_1049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1048, v ds
+# define BFI_FLINEAR2_1049_TICK(t)
+# define BFI_FLINEAR2_1048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1047, v ds
+# define BFI_FLINEAR2_1048_TICK(t)
+# define BFI_FLINEAR2_1047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1046, v ds
+# define BFI_FLINEAR2_1047_TICK(t)
+# define BFI_FLINEAR2_1046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1045, v ds
+# define BFI_FLINEAR2_1046_TICK(t)
+# define BFI_FLINEAR2_1045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1044, v ds
+# define BFI_FLINEAR2_1045_TICK(t)
+# define BFI_FLINEAR2_1044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1043, v ds
+# define BFI_FLINEAR2_1044_TICK(t)
+# define BFI_FLINEAR2_1043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1042, v ds
+# define BFI_FLINEAR2_1043_TICK(t)
+# define BFI_FLINEAR2_1042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1041, v ds
+# define BFI_FLINEAR2_1042_TICK(t)
+# define BFI_FLINEAR2_1041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1040, v ds
+# define BFI_FLINEAR2_1041_TICK(t)
+# define BFI_FLINEAR2_1040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1039, v ds
+# define BFI_FLINEAR2_1040_TICK(t)
+# define BFI_FLINEAR2_1039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1038, v ds
+# define BFI_FLINEAR2_1039_TICK(t)
+# define BFI_FLINEAR2_1038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1037, v ds
+# define BFI_FLINEAR2_1038_TICK(t)
+# define BFI_FLINEAR2_1037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1036, v ds
+# define BFI_FLINEAR2_1037_TICK(t)
+# define BFI_FLINEAR2_1036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1035, v ds
+# define BFI_FLINEAR2_1036_TICK(t)
+# define BFI_FLINEAR2_1035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1034, v ds
+# define BFI_FLINEAR2_1035_TICK(t)
+# define BFI_FLINEAR2_1034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1033, v ds
+# define BFI_FLINEAR2_1034_TICK(t)
+# define BFI_FLINEAR2_1033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1032, v ds
+# define BFI_FLINEAR2_1033_TICK(t)
+# define BFI_FLINEAR2_1032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1031, v ds
+# define BFI_FLINEAR2_1032_TICK(t)
+# define BFI_FLINEAR2_1031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1030, v ds
+# define BFI_FLINEAR2_1031_TICK(t)
+# define BFI_FLINEAR2_1030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1029, v ds
+# define BFI_FLINEAR2_1030_TICK(t)
+# define BFI_FLINEAR2_1029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1028, v ds
+# define BFI_FLINEAR2_1029_TICK(t)
+# define BFI_FLINEAR2_1028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1027, v ds
+# define BFI_FLINEAR2_1028_TICK(t)
+# define BFI_FLINEAR2_1027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1026, v ds
+# define BFI_FLINEAR2_1027_TICK(t)
+# define BFI_FLINEAR2_1026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1025, v ds
+# define BFI_FLINEAR2_1026_TICK(t)
+# define BFI_FLINEAR2_1025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1024, v ds
+# define BFI_FLINEAR2_1025_TICK(t)
+
+# endif
@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_2_64_H
+# define BFI_LINEAR_2_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR2_64(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_63, v ds
+# define BFI_FLINEAR2_64_TICK(t)
+# define BFI_FLINEAR2_63(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_62, v ds
+# define BFI_FLINEAR2_63_TICK(t)
+# define BFI_FLINEAR2_62(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_61, v ds
+# define BFI_FLINEAR2_62_TICK(t)
+# define BFI_FLINEAR2_61(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_60, v ds
+# define BFI_FLINEAR2_61_TICK(t)
+# define BFI_FLINEAR2_60(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_59, v ds
+# define BFI_FLINEAR2_60_TICK(t)
+# define BFI_FLINEAR2_59(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_58, v ds
+# define BFI_FLINEAR2_59_TICK(t)
+# define BFI_FLINEAR2_58(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_57, v ds
+# define BFI_FLINEAR2_58_TICK(t)
+# define BFI_FLINEAR2_57(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_56, v ds
+# define BFI_FLINEAR2_57_TICK(t)
+# define BFI_FLINEAR2_56(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_55, v ds
+# define BFI_FLINEAR2_56_TICK(t)
+# define BFI_FLINEAR2_55(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_54, v ds
+# define BFI_FLINEAR2_55_TICK(t)
+# define BFI_FLINEAR2_54(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_53, v ds
+# define BFI_FLINEAR2_54_TICK(t)
+# define BFI_FLINEAR2_53(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_52, v ds
+# define BFI_FLINEAR2_53_TICK(t)
+# define BFI_FLINEAR2_52(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_51, v ds
+# define BFI_FLINEAR2_52_TICK(t)
+# define BFI_FLINEAR2_51(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_50, v ds
+# define BFI_FLINEAR2_51_TICK(t)
+# define BFI_FLINEAR2_50(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_49, v ds
+# define BFI_FLINEAR2_50_TICK(t)
+# define BFI_FLINEAR2_49(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_48, v ds
+# define BFI_FLINEAR2_49_TICK(t)
+# define BFI_FLINEAR2_48(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_47, v ds
+# define BFI_FLINEAR2_48_TICK(t)
+# define BFI_FLINEAR2_47(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_46, v ds
+# define BFI_FLINEAR2_47_TICK(t)
+# define BFI_FLINEAR2_46(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_45, v ds
+# define BFI_FLINEAR2_46_TICK(t)
+# define BFI_FLINEAR2_45(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_44, v ds
+# define BFI_FLINEAR2_45_TICK(t)
+# define BFI_FLINEAR2_44(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_43, v ds
+# define BFI_FLINEAR2_44_TICK(t)
+# define BFI_FLINEAR2_43(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_42, v ds
+# define BFI_FLINEAR2_43_TICK(t)
+# define BFI_FLINEAR2_42(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_41, v ds
+# define BFI_FLINEAR2_42_TICK(t)
+# define BFI_FLINEAR2_41(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_40, v ds
+# define BFI_FLINEAR2_41_TICK(t)
+# define BFI_FLINEAR2_40(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_39, v ds
+# define BFI_FLINEAR2_40_TICK(t)
+# define BFI_FLINEAR2_39(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_38, v ds
+# define BFI_FLINEAR2_39_TICK(t)
+# define BFI_FLINEAR2_38(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_37, v ds
+# define BFI_FLINEAR2_38_TICK(t)
+# define BFI_FLINEAR2_37(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_36, v ds
+# define BFI_FLINEAR2_37_TICK(t)
+# define BFI_FLINEAR2_36(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_35, v ds
+# define BFI_FLINEAR2_36_TICK(t)
+# define BFI_FLINEAR2_35(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_34, v ds
+# define BFI_FLINEAR2_35_TICK(t)
+# define BFI_FLINEAR2_34(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_33, v ds
+# define BFI_FLINEAR2_34_TICK(t)
+# define BFI_FLINEAR2_33(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_32, v ds
+# define BFI_FLINEAR2_33_TICK(t)
+# define BFI_FLINEAR2_32(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_31, v ds
+# define BFI_FLINEAR2_32_TICK(t)
+# define BFI_FLINEAR2_31(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_30, v ds
+# define BFI_FLINEAR2_31_TICK(t)
+# define BFI_FLINEAR2_30(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_29, v ds
+# define BFI_FLINEAR2_30_TICK(t)
+# define BFI_FLINEAR2_29(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_28, v ds
+# define BFI_FLINEAR2_29_TICK(t)
+# define BFI_FLINEAR2_28(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_27, v ds
+# define BFI_FLINEAR2_28_TICK(t)
+# define BFI_FLINEAR2_27(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_26, v ds
+# define BFI_FLINEAR2_27_TICK(t)
+# define BFI_FLINEAR2_26(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_25, v ds
+# define BFI_FLINEAR2_26_TICK(t)
+# define BFI_FLINEAR2_25(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_24, v ds
+# define BFI_FLINEAR2_25_TICK(t)
+# define BFI_FLINEAR2_24(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_23, v ds
+# define BFI_FLINEAR2_24_TICK(t)
+# define BFI_FLINEAR2_23(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_22, v ds
+# define BFI_FLINEAR2_23_TICK(t)
+# define BFI_FLINEAR2_22(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_21, v ds
+# define BFI_FLINEAR2_22_TICK(t)
+# define BFI_FLINEAR2_21(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_20, v ds
+# define BFI_FLINEAR2_21_TICK(t)
+# define BFI_FLINEAR2_20(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_19, v ds
+# define BFI_FLINEAR2_20_TICK(t)
+# define BFI_FLINEAR2_19(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_18, v ds
+# define BFI_FLINEAR2_19_TICK(t)
+# define BFI_FLINEAR2_18(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_17, v ds
+# define BFI_FLINEAR2_18_TICK(t)
+# define BFI_FLINEAR2_17(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_16, v ds
+# define BFI_FLINEAR2_17_TICK(t)
+# define BFI_FLINEAR2_16(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_15, v ds
+# define BFI_FLINEAR2_16_TICK(t)
+# define BFI_FLINEAR2_15(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_14, v ds
+# define BFI_FLINEAR2_15_TICK(t)
+# define BFI_FLINEAR2_14(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_13, v ds
+# define BFI_FLINEAR2_14_TICK(t)
+# define BFI_FLINEAR2_13(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_12, v ds
+# define BFI_FLINEAR2_13_TICK(t)
+# define BFI_FLINEAR2_12(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_11, v ds
+# define BFI_FLINEAR2_12_TICK(t)
+# define BFI_FLINEAR2_11(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_10, v ds
+# define BFI_FLINEAR2_11_TICK(t)
+# define BFI_FLINEAR2_10(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_9, v ds
+# define BFI_FLINEAR2_10_TICK(t)
+# define BFI_FLINEAR2_9(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_8, v ds
+# define BFI_FLINEAR2_9_TICK(t)
+# define BFI_FLINEAR2_8(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_7, v ds
+# define BFI_FLINEAR2_8_TICK(t)
+# define BFI_FLINEAR2_7(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_6, v ds
+# define BFI_FLINEAR2_7_TICK(t)
+# define BFI_FLINEAR2_6(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_5, v ds
+# define BFI_FLINEAR2_6_TICK(t)
+# define BFI_FLINEAR2_5(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_4, v ds
+# define BFI_FLINEAR2_5_TICK(t)
+# define BFI_FLINEAR2_4(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_3, v ds
+# define BFI_FLINEAR2_4_TICK(t)
+# define BFI_FLINEAR2_3(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_2, v ds
+# define BFI_FLINEAR2_3_TICK(t)
+# define BFI_FLINEAR2_2(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_1, v ds
+# define BFI_FLINEAR2_2_TICK(t)
+# define BFI_FLINEAR2_1(v, f, ds) BFI_FINST_##f(BFI_FLINEAR2_0, v ds
+# define BFI_FLINEAR2_1_TICK(t)
+
+# endif
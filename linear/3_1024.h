@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_3_1024_H
+# define BFI_LINEAR_3_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR3_1024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1023, v ds
+# define BFI_FLINEAR3_1024_TICK(t)
+# define BFI_FLINEAR3_1023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1022, v ds
+# define BFI_FLINEAR3_1023_TICK(t)
+# define BFI_FLINEAR3_1022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1021, v ds
+# define BFI_FLINEAR3_1022_TICK(t)
+# define BFI_FLINEAR3_1021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1020, v ds
+# define BFI_FLINEAR3_1021_TICK(t)
+# define BFI_FLINEAR3_1020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1019, v ds
+# define BFI_FLINEAR3_1020_TICK(t)
+# define BFI_FLINEAR3_1019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1018, v ds
+# define BFI_FLINEAR3_1019_TICK(t)
+# define BFI_FLINEAR3_1018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1017, v ds
+# define BFI_FLINEAR3_1018_TICK(t)
+# define BFI_FLINEAR3_1017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1016, v ds
+# define BFI_FLINEAR3_1017_TICK(t)
+# define BFI_FLINEAR3_1016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1015, v ds
+# define BFI_FLINEAR3_1016_TICK(t)
+# define BFI_FLINEAR3_1015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1014, v ds
+# define BFI_FLINEAR3_1015_TICK(t)
+# define BFI_FLINEAR3_1014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1013, v ds
+# define BFI_FLINEAR3_1014_TICK(t)
+# define BFI_FLINEAR3_1013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1012, v ds
+# define BFI_FLINEAR3_1013_TICK(t)
+# define BFI_FLINEAR3_1012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1011, v ds
+# define BFI_FLINEAR3_1012_TICK(t)
+# define BFI_FLINEAR3_1011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1010, v ds
+# define BFI_FLINEAR3_1011_TICK(t)
+# define BFI_FLINEAR3_1010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1009, v ds
+# define BFI_FLINEAR3_1010_TICK(t)
+# define BFI_FLINEAR3_1009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1008, v ds
+# define BFI_FLINEAR3_1009_TICK(t)
+# define BFI_FLINEAR3_1008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1007, v ds
+# define BFI_FLINEAR3_1008_TICK(t)
+# define BFI_FLINEAR3_1007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1006, v ds
+# define BFI_FLINEAR3_1007_TICK(t)
+# define BFI_FLINEAR3_1006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1005, v ds
+# define BFI_FLINEAR3_1006_TICK(t)
+# define BFI_FLINEAR3_1005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1004, v ds
+# define BFI_FLINEAR3_1005_TICK(t)
+# define BFI_FLINEAR3_1004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1003, v ds
+# define BFI_FLINEAR3_1004_TICK(t)
+# define BFI_FLINEAR3_1003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1002, v ds
+# define BFI_FLINEAR3_1003_TICK(t)
+# define BFI_FLINEAR3_1002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1001, v ds
+# define BFI_FLINEAR3_1002_TICK(t)
+# define BFI_FLINEAR3_1001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1000, v ds
+# define BFI_FLINEAR3_1001_TICK(t)
+# define BFI_FLINEAR3_1000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_999, v ds
+# define BFI_FLINEAR3_1000_TICK(t)
+# define BFI_FLINEAR3_999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_998, v ds
+# define BFI_FLINEAR3_999_TICK(t)
+# define BFI_FLINEAR3_998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_997, v ds
+# define BFI_FLINEAR3_998_TICK(t)
+# define BFI_FLINEAR3_997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_996, v ds
+# define BFI_FLINEAR3_997_TICK(t)
+# define BFI_FLINEAR3_996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_995, v ds
+# define BFI_FLINEAR3_996_TICK(t)
+# define BFI_FLINEAR3_995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_994, v ds
+# define BFI_FLINEAR3_995_TICK(t)
+# define BFI_FLINEAR3_994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_993, v ds
+# define BFI_FLINEAR3_994_TICK(t)
+# define BFI_FLINEAR3_993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_992, v ds
+# define BFI_FLINEAR3_993_TICK(t)
+# define BFI_FLINEAR3_992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_991, v ds
+# define BFI_FLINEAR3_992_TICK(t)
+# define BFI_FLINEAR3_991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_990, v ds
+# define BFI_FLINEAR3_991_TICK(t)
+# define BFI_FLINEAR3_990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_989, v ds
+# define BFI_FLINEAR3_990_TICK(t)
+# define BFI_FLINEAR3_989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_988, v ds
+# define BFI_FLINEAR3_989_TICK(t)
+# define BFI_FLINEAR3_988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_987, v ds
+# define BFI_FLINEAR3_988_TICK(t)
+# define BFI_FLINEAR3_987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_986, v ds
+# define BFI_FLINEAR3_987_TICK(t)
+# define BFI_FLINEAR3_986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_985, v ds
+# define BFI_FLINEAR3_986_TICK(t)
+# define BFI_FLINEAR3_985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_984, v ds
+# define BFI_FLINEAR3_985_TICK(t)
+# define BFI_FLINEAR3_984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_983, v ds
+# define BFI_FLINEAR3_984_TICK(t)
+# define BFI_FLINEAR3_983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_982, v ds
+# define BFI_FLINEAR3_983_TICK(t)
+# define BFI_FLINEAR3_982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_981, v ds
+# define BFI_FLINEAR3_982_TICK(t)
+# define BFI_FLINEAR3_981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_980, v ds
+# define BFI_FLINEAR3_981_TICK(t)
+# define BFI_FLINEAR3_980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_979, v ds
+# define BFI_FLINEAR3_980_TICK(t)
+# define BFI_FLINEAR3_979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_978, v ds
+# define BFI_FLINEAR3_979_TICK(t)
+# define BFI_FLINEAR3_978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_977, v ds
+# define BFI_FLINEAR3_978_TICK(t)
+# define BFI_FLINEAR3_977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_976, v ds
+# define BFI_FLINEAR3_977_TICK(t)
+# define BFI_FLINEAR3_976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_975, v ds
+# define BFI_FLINEAR3_976_TICK(t)
+# define BFI_FLINEAR3_975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_974, v ds
+# define BFI_FLINEAR3_975_TICK(t)
+# define BFI_FLINEAR3_974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_973, v ds
+# define BFI_FLINEAR3_974_TICK(t)
+# define BFI_FLINEAR3_973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_972, v ds
+# define BFI_FLINEAR3_973_TICK(t)
+# define BFI_FLINEAR3_972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_971, v ds
+# define BFI_FLINEAR3_972_TICK(t)
+# define BFI_FLINEAR3_971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_970, v ds
+# define BFI_FLINEAR3_971_TICK(t)
+# define BFI_FLINEAR3_970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_969, v ds
+# define BFI_FLINEAR3_970_TICK(t)
+# define BFI_FLINEAR3_969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_968, v ds
+# define BFI_FLINEAR3_969_TICK(t)
+# define BFI_FLINEAR3_968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_967, v ds
+# define BFI_FLINEAR3_968_TICK(t)
+# define BFI_FLINEAR3_967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_966, v ds
+# define BFI_FLINEAR3_967_TICK(t)
+# define BFI_FLINEAR3_966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_965, v ds
+# define BFI_FLINEAR3_966_TICK(t)
+# define BFI_FLINEAR3_965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_964, v ds
+# define BFI_FLINEAR3_965_TICK(t)
+# define BFI_FLINEAR3_964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_963, v ds
+# define BFI_FLINEAR3_964_TICK(t)
+# define BFI_FLINEAR3_963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_962, v ds
+# define BFI_FLINEAR3_963_TICK(t)
+# define BFI_FLINEAR3_962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_961, v ds
+# define BFI_FLINEAR3_962_TICK(t)
+# define BFI_FLINEAR3_961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_960, v ds
+# define BFI_FLINEAR3_961_TICK(t)
+# define BFI_FLINEAR3_960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_959, v ds
+# define BFI_FLINEAR3_960_TICK(t)
+# define BFI_FLINEAR3_959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_958, v ds
+# define BFI_FLINEAR3_959_TICK(t)
+# define BFI_FLINEAR3_958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_957, v ds
+# define BFI_FLINEAR3_958_TICK(t)
+# define BFI_FLINEAR3_957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_956, v ds
+# define BFI_FLINEAR3_957_TICK(t)
+# define BFI_FLINEAR3_956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_955, v ds
+# define BFI_FLINEAR3_956_TICK(t)
+# define BFI_FLINEAR3_955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_954, v ds
+# define BFI_FLINEAR3_955_TICK(t)
+# define BFI_FLINEAR3_954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_953, v ds
+# define BFI_FLINEAR3_954_TICK(t)
+# define BFI_FLINEAR3_953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_952, v ds
+# define BFI_FLINEAR3_953_TICK(t)
+# define BFI_FLINEAR3_952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_951, v ds
+# define BFI_FLINEAR3_952_TICK(t)
+# define BFI_FLINEAR3_951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_950, v ds
+# define BFI_FLINEAR3_951_TICK(t)
+# define BFI_FLINEAR3_950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_949, v ds
+# define BFI_FLINEAR3_950_TICK(t)
+# define BFI_FLINEAR3_949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_948, v ds
+# define BFI_FLINEAR3_949_TICK(t)
+# define BFI_FLINEAR3_948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_947, v ds
+# define BFI_FLINEAR3_948_TICK(t)
+# define BFI_FLINEAR3_947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_946, v ds
+# define BFI_FLINEAR3_947_TICK(t)
+# define BFI_FLINEAR3_946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_945, v ds
+# define BFI_FLINEAR3_946_TICK(t)
+# define BFI_FLINEAR3_945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_944, v ds
+# define BFI_FLINEAR3_945_TICK(t)
+# define BFI_FLINEAR3_944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_943, v ds
+# define BFI_FLINEAR3_944_TICK(t)
+# define BFI_FLINEAR3_943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_942, v ds
+# define BFI_FLINEAR3_943_TICK(t)
+# define BFI_FLINEAR3_942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_941, v ds
+# define BFI_FLINEAR3_942_TICK(t)
+# define BFI_FLINEAR3_941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_940, v ds
+# define BFI_FLINEAR3_941_TICK(t)
+# define BFI_FLINEAR3_940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_939, v ds
+# define BFI_FLINEAR3_940_TICK(t)
+# define BFI_FLINEAR3_939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_938, v ds
+# define BFI_FLINEAR3_939_TICK(t)
+# define BFI_FLINEAR3_938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_937, v ds
+# define BFI_FLINEAR3_938_TICK(t)
+# define BFI_FLINEAR3_937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_936, v ds
+# define BFI_FLINEAR3_937_TICK(t)
+# define BFI_FLINEAR3_936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_935, v ds
+# define BFI_FLINEAR3_936_TICK(t)
+# define BFI_FLINEAR3_935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_934, v ds
+# define BFI_FLINEAR3_935_TICK(t)
+# define BFI_FLINEAR3_934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_933, v ds
+# define BFI_FLINEAR3_934_TICK(t)
+# define BFI_FLINEAR3_933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_932, v ds
+# define BFI_FLINEAR3_933_TICK(t)
+# define BFI_FLINEAR3_932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_931, v ds
+# define BFI_FLINEAR3_932_TICK(t)
+# define BFI_FLINEAR3_931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_930, v ds
+# define BFI_FLINEAR3_931_TICK(t)
+# define BFI_FLINEAR3_930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_929, v ds
+# define BFI_FLINEAR3_930_TICK(t)
+# define BFI_FLINEAR3_929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_928, v ds
+# define BFI_FLINEAR3_929_TICK(t)
+# define BFI_FLINEAR3_928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_927, v ds
+# define BFI_FLINEAR3_928_TICK(t)
+# define BFI_FLINEAR3_927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_926, v ds
+# define BFI_FLINEAR3_927_TICK(t)
+# define BFI_FLINEAR3_926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_925, v ds
+# define BFI_FLINEAR3_926_TICK(t)
+# define BFI_FLINEAR3_925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_924, v ds
+# define BFI_FLINEAR3_925_TICK(t)
+# define BFI_FLINEAR3_924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_923, v ds
+# define BFI_FLINEAR3_924_TICK(t)
+# define BFI_FLINEAR3_923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_922, v ds
+# define BFI_FLINEAR3_923_TICK(t)
+# define BFI_FLINEAR3_922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_921, v ds
+# define BFI_FLINEAR3_922_TICK(t)
+# define BFI_FLINEAR3_921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_920, v ds
+# define BFI_FLINEAR3_921_TICK(t)
+# define BFI_FLINEAR3_920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_919, v ds
+# define BFI_FLINEAR3_920_TICK(t)
+# define BFI_FLINEAR3_919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_918, v ds
+# define BFI_FLINEAR3_919_TICK(t)
+# define BFI_FLINEAR3_918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_917, v ds
+# define BFI_FLINEAR3_918_TICK(t)
+# define BFI_FLINEAR3_917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_916, v ds
+# define BFI_FLINEAR3_917_TICK(t)
+# define BFI_FLINEAR3_916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_915, v ds
+# define BFI_FLINEAR3_916_TICK(t)
+# define BFI_FLINEAR3_915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_914, v ds
+# define BFI_FLINEAR3_915_TICK(t)
+# define BFI_FLINEAR3_914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_913, v ds
+# define BFI_FLINEAR3_914_TICK(t)
+# define BFI_FLINEAR3_913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_912, v ds
+# define BFI_FLINEAR3_913_TICK(t)
+# define BFI_FLINEAR3_912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_911, v ds
+# define BFI_FLINEAR3_912_TICK(t)
+# define BFI_FLINEAR3_911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_910, v ds
+# define BFI_FLINEAR3_911_TICK(t)
+# define BFI_FLINEAR3_910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_909, v ds
+# define BFI_FLINEAR3_910_TICK(t)
+# define BFI_FLINEAR3_909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_908, v ds
+# define BFI_FLINEAR3_909_TICK(t)
+# define BFI_FLINEAR3_908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_907, v ds
+# define BFI_FLINEAR3_908_TICK(t)
+# define BFI_FLINEAR3_907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_906, v ds
+# define BFI_FLINEAR3_907_TICK(t)
+# define BFI_FLINEAR3_906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_905, v ds
+# define BFI_FLINEAR3_906_TICK(t)
+# define BFI_FLINEAR3_905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_904, v ds
+# define BFI_FLINEAR3_905_TICK(t)
+# define BFI_FLINEAR3_904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_903, v ds
+# define BFI_FLINEAR3_904_TICK(t)
+# define BFI_FLINEAR3_903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_902, v ds
+# define BFI_FLINEAR3_903_TICK(t)
+# define BFI_FLINEAR3_902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_901, v ds
+# define BFI_FLINEAR3_902_TICK(t)
+# define BFI_FLINEAR3_901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_900, v ds
+# define BFI_FLINEAR3_901_TICK(t)
+# define BFI_FLINEAR3_900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_899, v ds
+# define BFI_FLINEAR3_900_TICK(t)
+# define BFI_FLINEAR3_899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_898, v ds
+# define BFI_FLINEAR3_899_TICK(t)
+# define BFI_FLINEAR3_898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_897, v ds
+# define BFI_FLINEAR3_898_TICK(t)
+# define BFI_FLINEAR3_897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_896, v ds
+# define BFI_FLINEAR3_897_TICK(t)
+# define BFI_FLINEAR3_896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_895, v ds
+# define BFI_FLINEAR3_896_TICK(t)
+# define BFI_FLINEAR3_895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_894, v ds
+# define BFI_FLINEAR3_895_TICK(t)
+# define BFI_FLINEAR3_894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_893, v ds
+# define BFI_FLINEAR3_894_TICK(t)
+# define BFI_FLINEAR3_893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_892, v ds
+# define BFI_FLINEAR3_893_TICK(t)
+# define BFI_FLINEAR3_892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_891, v ds
+# define BFI_FLINEAR3_892_TICK(t)
+# define BFI_FLINEAR3_891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_890, v ds
+# define BFI_FLINEAR3_891_TICK(t)
+# define BFI_FLINEAR3_890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_889, v ds
+# define BFI_FLINEAR3_890_TICK(t)
+# define BFI_FLINEAR3_889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_888, v ds
+# define BFI_FLINEAR3_889_TICK(t)
+# define BFI_FLINEAR3_888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_887, v ds
+# define BFI_FLINEAR3_888_TICK(t)
+# define BFI_FLINEAR3_887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_886, v ds
+# define BFI_FLINEAR3_887_TICK(t)
+# define BFI_FLINEAR3_886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_885, v ds
+# define BFI_FLINEAR3_886_TICK(t)
+# define BFI_FLINEAR3_885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_884, v ds
+# define BFI_FLINEAR3_885_TICK(t)
+# define BFI_FLINEAR3_884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_883, v ds
+# define BFI_FLINEAR3_884_TICK(t)
+# define BFI_FLINEAR3_883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_882, v ds
+# define BFI_FLINEAR3_883_TICK(t)
+# define BFI_FLINEAR3_882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_881, v ds
+# define BFI_FLINEAR3_882_TICK(t)
+# define BFI_FLINEAR3_881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_880, v ds
+# define BFI_FLINEAR3_881_TICK(t)
+# define BFI_FLINEAR3_880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_879, v ds
+# define BFI_FLINEAR3_880_TICK(t)
+# define BFI_FLINEAR3_879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_878, v ds
+# define BFI_FLINEAR3_879_TICK(t)
+# define BFI_FLINEAR3_878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_877, v ds
+# define BFI_FLINEAR3_878_TICK(t)
+# define BFI_FLINEAR3_877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_876, v ds
+# define BFI_FLINEAR3_877_TICK(t)
+# define BFI_FLINEAR3_876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_875, v ds
+# define BFI_FLINEAR3_876_TICK(t)
+# define BFI_FLINEAR3_875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_874, v ds
+# define BFI_FLINEAR3_875_TICK(t)
+# define BFI_FLINEAR3_874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_873, v ds
+# define BFI_FLINEAR3_874_TICK(t)
+# define BFI_FLINEAR3_873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_872, v ds
+# define BFI_FLINEAR3_873_TICK(t)
+# define BFI_FLINEAR3_872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_871, v ds
+# define BFI_FLINEAR3_872_TICK(t)
+# define BFI_FLINEAR3_871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_870, v ds
+# define BFI_FLINEAR3_871_TICK(t)
+# define BFI_FLINEAR3_870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_869, v ds
+# define BFI_FLINEAR3_870_TICK(t)
+# define BFI_FLINEAR3_869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_868, v ds
+# define BFI_FLINEAR3_869_TICK(t)
+# define BFI_FLINEAR3_868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_867, v ds
+# define BFI_FLINEAR3_868_TICK(t)
+# define BFI_FLINEAR3_867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_866, v ds
+# define BFI_FLINEAR3_867_TICK(t)
+# define BFI_FLINEAR3_866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_865, v ds
+# define BFI_FLINEAR3_866_TICK(t)
+# define BFI_FLINEAR3_865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_864, v ds
+# define BFI_FLINEAR3_865_TICK(t)
+# define BFI_FLINEAR3_864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_863, v ds
+# define BFI_FLINEAR3_864_TICK(t)
+# define BFI_FLINEAR3_863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_862, v ds
+# define BFI_FLINEAR3_863_TICK(t)
+# define BFI_FLINEAR3_862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_861, v ds
+# define BFI_FLINEAR3_862_TICK(t)
+# define BFI_FLINEAR3_861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_860, v ds
+# define BFI_FLINEAR3_861_TICK(t)
+# define BFI_FLINEAR3_860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_859, v ds
+# define BFI_FLINEAR3_860_TICK(t)
+# define BFI_FLINEAR3_859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_858, v ds
+# define BFI_FLINEAR3_859_TICK(t)
+# define BFI_FLINEAR3_858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_857, v ds
+# define BFI_FLINEAR3_858_TICK(t)
+# define BFI_FLINEAR3_857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_856, v ds
+# define BFI_FLINEAR3_857_TICK(t)
+# define BFI_FLINEAR3_856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_855, v ds
+# define BFI_FLINEAR3_856_TICK(t)
+# define BFI_FLINEAR3_855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_854, v ds
+# define BFI_FLINEAR3_855_TICK(t)
+# define BFI_FLINEAR3_854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_853, v ds
+# define BFI_FLINEAR3_854_TICK(t)
+# define BFI_FLINEAR3_853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_852, v ds
+# define BFI_FLINEAR3_853_TICK(t)
+# define BFI_FLINEAR3_852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_851, v ds
+# define BFI_FLINEAR3_852_TICK(t)
+# define BFI_FLINEAR3_851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_850, v ds
+# define BFI_FLINEAR3_851_TICK(t)
+# define BFI_FLINEAR3_850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_849, v ds
+# define BFI_FLINEAR3_850_TICK(t)
+# define BFI_FLINEAR3_849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_848, v ds
+# define BFI_FLINEAR3_849_TICK(t)
+# define BFI_FLINEAR3_848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_847, v ds
+# define BFI_FLINEAR3_848_TICK(t)
+# define BFI_FLINEAR3_847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_846, v ds
+# define BFI_FLINEAR3_847_TICK(t)
+# define BFI_FLINEAR3_846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_845, v ds
+# define BFI_FLINEAR3_846_TICK(t)
+# define BFI_FLINEAR3_845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_844, v ds
+# define BFI_FLINEAR3_845_TICK(t)
+# define BFI_FLINEAR3_844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_843, v ds
+# define BFI_FLINEAR3_844_TICK(t)
+# define BFI_FLINEAR3_843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_842, v ds
+# define BFI_FLINEAR3_843_TICK(t)
+# define BFI_FLINEAR3_842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_841, v ds
+# define BFI_FLINEAR3_842_TICK(t)
+# define BFI_FLINEAR3_841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_840, v ds
+# define BFI_FLINEAR3_841_TICK(t)
+# define BFI_FLINEAR3_840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_839, v ds
+# define BFI_FLINEAR3_840_TICK(t)
+# define BFI_FLINEAR3_839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_838, v ds
+# define BFI_FLINEAR3_839_TICK(t)
+# define BFI_FLINEAR3_838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_837, v ds
+# define BFI_FLINEAR3_838_TICK(t)
+# define BFI_FLINEAR3_837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_836, v ds
+# define BFI_FLINEAR3_837_TICK(t)
+# define BFI_FLINEAR3_836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_835, v ds
+# define BFI_FLINEAR3_836_TICK(t)
+# define BFI_FLINEAR3_835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_834, v ds
+# define BFI_FLINEAR3_835_TICK(t)
+# define BFI_FLINEAR3_834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_833, v ds
+# define BFI_FLINEAR3_834_TICK(t)
+# define BFI_FLINEAR3_833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_832, v ds
+# define BFI_FLINEAR3_833_TICK(t)
+# define BFI_FLINEAR3_832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_831, v ds
+# define BFI_FLINEAR3_832_TICK(t)
+# define BFI_FLINEAR3_831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_830, v ds
+# define BFI_FLINEAR3_831_TICK(t)
+# define BFI_FLINEAR3_830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_829, v ds
+# define BFI_FLINEAR3_830_TICK(t)
+# define BFI_FLINEAR3_829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_828, v ds
+# define BFI_FLINEAR3_829_TICK(t)
+# define BFI_FLINEAR3_828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_827, v ds
+# define BFI_FLINEAR3_828_TICK(t)
+# define BFI_FLINEAR3_827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_826, v ds
+# define BFI_FLINEAR3_827_TICK(t)
+# define BFI_FLINEAR3_826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_825, v ds
+# define BFI_FLINEAR3_826_TICK(t)
+# define BFI_FLINEAR3_825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_824, v ds
+# define BFI_FLINEAR3_825_TICK(t)
+# define BFI_FLINEAR3_824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_823, v ds
+# define BFI_FLINEAR3_824_TICK(t)
+# define BFI_FLINEAR3_823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_822, v ds
+# define BFI_FLINEAR3_823_TICK(t)
+# define BFI_FLINEAR3_822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_821, v ds
+# define BFI_FLINEAR3_822_TICK(t)
+# define BFI_FLINEAR3_821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_820, v ds
+# define BFI_FLINEAR3_821_TICK(t)
+# define BFI_FLINEAR3_820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_819, v ds
+# define BFI_FLINEAR3_820_TICK(t)
+# define BFI_FLINEAR3_819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_818, v ds
+# define BFI_FLINEAR3_819_TICK(t)
+# define BFI_FLINEAR3_818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_817, v ds
+# define BFI_FLINEAR3_818_TICK(t)
+# define BFI_FLINEAR3_817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_816, v ds
+# define BFI_FLINEAR3_817_TICK(t)
+# define BFI_FLINEAR3_816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_815, v ds
+# define BFI_FLINEAR3_816_TICK(t)
+# define BFI_FLINEAR3_815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_814, v ds
+# define BFI_FLINEAR3_815_TICK(t)
+# define BFI_FLINEAR3_814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_813, v ds
+# define BFI_FLINEAR3_814_TICK(t)
+# define BFI_FLINEAR3_813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_812, v ds
+# define BFI_FLINEAR3_813_TICK(t)
+# define BFI_FLINEAR3_812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_811, v ds
+# define BFI_FLINEAR3_812_TICK(t)
+# define BFI_FLINEAR3_811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_810, v ds
+# define BFI_FLINEAR3_811_TICK(t)
+# define BFI_FLINEAR3_810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_809, v ds
+# define BFI_FLINEAR3_810_TICK(t)
+# define BFI_FLINEAR3_809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_808, v ds
+# define BFI_FLINEAR3_809_TICK(t)
+# define BFI_FLINEAR3_808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_807, v ds
+# define BFI_FLINEAR3_808_TICK(t)
+# define BFI_FLINEAR3_807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_806, v ds
+# define BFI_FLINEAR3_807_TICK(t)
+# define BFI_FLINEAR3_806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_805, v ds
+# define BFI_FLINEAR3_806_TICK(t)
+# define BFI_FLINEAR3_805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_804, v ds
+# define BFI_FLINEAR3_805_TICK(t)
+# define BFI_FLINEAR3_804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_803, v ds
+# define BFI_FLINEAR3_804_TICK(t)
+# define BFI_FLINEAR3_803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_802, v ds
+# define BFI_FLINEAR3_803_TICK(t)
+# define BFI_FLINEAR3_802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_801, v ds
+# define BFI_FLINEAR3_802_TICK(t)
+# define BFI_FLINEAR3_801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_800, v ds
+# define BFI_FLINEAR3_801_TICK(t)
+# define BFI_FLINEAR3_800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_799, v ds
+# define BFI_FLINEAR3_800_TICK(t)
+# define BFI_FLINEAR3_799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_798, v ds
+# define BFI_FLINEAR3_799_TICK(t)
+# define BFI_FLINEAR3_798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_797, v ds
+# define BFI_FLINEAR3_798_TICK(t)
+# define BFI_FLINEAR3_797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_796, v ds
+# define BFI_FLINEAR3_797_TICK(t)
+# define BFI_FLINEAR3_796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_795, v ds
+# define BFI_FLINEAR3_796_TICK(t)
+# define BFI_FLINEAR3_795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_794, v ds
+# define BFI_FLINEAR3_795_TICK(t)
+# define BFI_FLINEAR3_794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_793, v ds
+# define BFI_FLINEAR3_794_TICK(t)
+# define BFI_FLINEAR3_793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_792, v ds
+# define BFI_FLINEAR3_793_TICK(t)
+# define BFI_FLINEAR3_792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_791, v ds
+# define BFI_FLINEAR3_792_TICK(t)
+# define BFI_FLINEAR3_791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_790, v ds
+# define BFI_FLINEAR3_791_TICK(t)
+# define BFI_FLINEAR3_790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_789, v ds
+# define BFI_FLINEAR3_790_TICK(t)
+# define BFI_FLINEAR3_789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_788, v ds
+# define BFI_FLINEAR3_789_TICK(t)
+# define BFI_FLINEAR3_788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_787, v ds
+# define BFI_FLINEAR3_788_TICK(t)
+# define BFI_FLINEAR3_787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_786, v ds
+# define BFI_FLINEAR3_787_TICK(t)
+# define BFI_FLINEAR3_786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_785, v ds
+# define BFI_FLINEAR3_786_TICK(t)
+# define BFI_FLINEAR3_785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_784, v ds
+# define BFI_FLINEAR3_785_TICK(t)
+# define BFI_FLINEAR3_784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_783, v ds
+# define BFI_FLINEAR3_784_TICK(t)
+# define BFI_FLINEAR3_783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_782, v ds
+# define BFI_FLINEAR3_783_TICK(t)
+# define BFI_FLINEAR3_782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_781, v ds
+# define BFI_FLINEAR3_782_TICK(t)
+# define BFI_FLINEAR3_781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_780, v ds
+# define BFI_FLINEAR3_781_TICK(t)
+# define BFI_FLINEAR3_780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_779, v ds
+# define BFI_FLINEAR3_780_TICK(t)
+# define BFI_FLINEAR3_779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_778, v ds
+# define BFI_FLINEAR3_779_TICK(t)
+# define BFI_FLINEAR3_778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_777, v ds
+# define BFI_FLINEAR3_778_TICK(t)
+# define BFI_FLINEAR3_777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_776, v ds
+# define BFI_FLINEAR3_777_TICK(t)
+# define BFI_FLINEAR3_776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_775, v ds
+# define BFI_FLINEAR3_776_TICK(t)
+# define BFI_FLINEAR3_775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_774, v ds
+# define BFI_FLINEAR3_775_TICK(t)
+# define BFI_FLINEAR3_774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_773, v ds
+# define BFI_FLINEAR3_774_TICK(t)
+# define BFI_FLINEAR3_773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_772, v ds
+# define BFI_FLINEAR3_773_TICK(t)
+# define BFI_FLINEAR3_772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_771, v ds
+# define BFI_FLINEAR3_772_TICK(t)
+# define BFI_FLINEAR3_771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_770, v ds
+# define BFI_FLINEAR3_771_TICK(t)
+# define BFI_FLINEAR3_770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_769, v ds
+# define BFI_FLINEAR3_770_TICK(t)
+# define BFI_FLINEAR3_769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_768, v ds
+# define BFI_FLINEAR3_769_TICK(t)
+# define BFI_FLINEAR3_768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_767, v ds
+# define BFI_FLINEAR3_768_TICK(t)
+# define BFI_FLINEAR3_767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_766, v ds
+# define BFI_FLINEAR3_767_TICK(t)
+# define BFI_FLINEAR3_766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_765, v ds
+# define BFI_FLINEAR3_766_TICK(t)
+# define BFI_FLINEAR3_765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_764, v ds
+# define BFI_FLINEAR3_765_TICK(t)
+# define BFI_FLINEAR3_764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_763, v ds
+# define BFI_FLINEAR3_764_TICK(t)
+# define BFI_FLINEAR3_763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_762, v ds
+# define BFI_FLINEAR3_763_TICK(t)
+# define BFI_FLINEAR3_762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_761, v ds
+# define BFI_FLINEAR3_762_TICK(t)
+# define BFI_FLINEAR3_761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_760, v ds
+# define BFI_FLINEAR3_761_TICK(t)
+# define BFI_FLINEAR3_760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_759, v ds
+# define BFI_FLINEAR3_760_TICK(t)
+# define BFI_FLINEAR3_759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_758, v ds
+# define BFI_FLINEAR3_759_TICK(t)
+# define BFI_FLINEAR3_758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_757, v ds
+# define BFI_FLINEAR3_758_TICK(t)
+# define BFI_FLINEAR3_757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_756, v ds
+# define BFI_FLINEAR3_757_TICK(t)
+# define BFI_FLINEAR3_756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_755, v ds
+# define BFI_FLINEAR3_756_TICK(t)
+# define BFI_FLINEAR3_755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_754, v ds
+# define BFI_FLINEAR3_755_TICK(t)
+# define BFI_FLINEAR3_754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_753, v ds
+# define BFI_FLINEAR3_754_TICK(t)
+# define BFI_FLINEAR3_753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_752, v ds
+# define BFI_FLINEAR3_753_TICK(t)
+# define BFI_FLINEAR3_752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_751, v ds
+# define BFI_FLINEAR3_752_TICK(t)
+# define BFI_FLINEAR3_751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_750, v ds
+# define BFI_FLINEAR3_751_TICK(t)
+# define BFI_FLINEAR3_750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_749, v ds
+# define BFI_FLINEAR3_750_TICK(t)
+# define BFI_FLINEAR3_749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_748, v ds
+# define BFI_FLINEAR3_749_TICK(t)
+# define BFI_FLINEAR3_748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_747, v ds
+# define BFI_FLINEAR3_748_TICK(t)
+# define BFI_FLINEAR3_747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_746, v ds
+# define BFI_FLINEAR3_747_TICK(t)
+# define BFI_FLINEAR3_746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_745, v ds
+# define BFI_FLINEAR3_746_TICK(t)
+# define BFI_FLINEAR3_745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_744, v ds
+# define BFI_FLINEAR3_745_TICK(t)
+# define BFI_FLINEAR3_744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_743, v ds
+# define BFI_FLINEAR3_744_TICK(t)
+# define BFI_FLINEAR3_743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_742, v ds
+# define BFI_FLINEAR3_743_TICK(t)
+# define BFI_FLINEAR3_742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_741, v ds
+# define BFI_FLINEAR3_742_TICK(t)
+# define BFI_FLINEAR3_741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_740, v ds
+# define BFI_FLINEAR3_741_TICK(t)
+# define BFI_FLINEAR3_740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_739, v ds
+# define BFI_FLINEAR3_740_TICK(t)
+# define BFI_FLINEAR3_739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_738, v ds
+# define BFI_FLINEAR3_739_TICK(t)
+# define BFI_FLINEAR3_738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_737, v ds
+# define BFI_FLINEAR3_738_TICK(t)
+# define BFI_FLINEAR3_737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_736, v ds
+# define BFI_FLINEAR3_737_TICK(t)
+# define BFI_FLINEAR3_736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_735, v ds
+# define BFI_FLINEAR3_736_TICK(t)
+# define BFI_FLINEAR3_735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_734, v ds
+# define BFI_FLINEAR3_735_TICK(t)
+# define BFI_FLINEAR3_734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_733, v ds
+# define BFI_FLINEAR3_734_TICK(t)
+# define BFI_FLINEAR3_733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_732, v ds
+# define BFI_FLINEAR3_733_TICK(t)
+# define BFI_FLINEAR3_732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_731, v ds
+# define BFI_FLINEAR3_732_TICK(t)
+# define BFI_FLINEAR3_731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_730, v ds
+# define BFI_FLINEAR3_731_TICK(t)
+# define BFI_FLINEAR3_730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_729, v ds
+# define BFI_FLINEAR3_730_TICK(t)
+# define BFI_FLINEAR3_729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_728, v ds
+# define BFI_FLINEAR3_729_TICK(t)
+# define BFI_FLINEAR3_728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_727, v ds
+# define BFI_FLINEAR3_728_TICK(t)
+# define BFI_FLINEAR3_727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_726, v ds
+# define BFI_FLINEAR3_727_TICK(t)
+# define BFI_FLINEAR3_726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_725, v ds
+# define BFI_FLINEAR3_726_TICK(t)
+# define BFI_FLINEAR3_725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_724, v ds
+# define BFI_FLINEAR3_725_TICK(t)
+# define BFI_FLINEAR3_724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_723, v ds
+# define BFI_FLINEAR3_724_TICK(t)
+# define BFI_FLINEAR3_723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_722, v ds
+# define BFI_FLINEAR3_723_TICK(t)
+# define BFI_FLINEAR3_722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_721, v ds
+# define BFI_FLINEAR3_722_TICK(t)
+# define BFI_FLINEAR3_721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_720, v ds
+# define BFI_FLINEAR3_721_TICK(t)
+# define BFI_FLINEAR3_720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_719, v ds
+# define BFI_FLINEAR3_720_TICK(t)
+# define BFI_FLINEAR3_719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_718, v ds
+# define BFI_FLINEAR3_719_TICK(t)
+# define BFI_FLINEAR3_718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_717, v ds
+# define BFI_FLINEAR3_718_TICK(t)
+# define BFI_FLINEAR3_717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_716, v ds
+# define BFI_FLINEAR3_717_TICK(t)
+# define BFI_FLINEAR3_716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_715, v ds
+# define BFI_FLINEAR3_716_TICK(t)
+# define BFI_FLINEAR3_715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_714, v ds
+# define BFI_FLINEAR3_715_TICK(t)
+# define BFI_FLINEAR3_714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_713, v ds
+# define BFI_FLINEAR3_714_TICK(t)
+# define BFI_FLINEAR3_713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_712, v ds
+# define BFI_FLINEAR3_713_TICK(t)
+# define BFI_FLINEAR3_712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_711, v ds
+# define BFI_FLINEAR3_712_TICK(t)
+# define BFI_FLINEAR3_711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_710, v ds
+# define BFI_FLINEAR3_711_TICK(t)
+# define BFI_FLINEAR3_710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_709, v ds
+# define BFI_FLINEAR3_710_TICK(t)
+# define BFI_FLINEAR3_709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_708, v ds
+# define BFI_FLINEAR3_709_TICK(t)
+# define BFI_FLINEAR3_708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_707, v ds
+# define BFI_FLINEAR3_708_TICK(t)
+# define BFI_FLINEAR3_707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_706, v ds
+# define BFI_FLINEAR3_707_TICK(t)
+# define BFI_FLINEAR3_706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_705, v ds
+# define BFI_FLINEAR3_706_TICK(t)
+# define BFI_FLINEAR3_705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_704, v ds
+# define BFI_FLINEAR3_705_TICK(t)
+# define BFI_FLINEAR3_704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_703, v ds
+# define BFI_FLINEAR3_704_TICK(t)
+# define BFI_FLINEAR3_703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_702, v ds
+# define BFI_FLINEAR3_703_TICK(t)
+# define BFI_FLINEAR3_702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_701, v ds
+# define BFI_FLINEAR3_702_TICK(t)
+# define BFI_FLINEAR3_701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_700, v ds
+# define BFI_FLINEAR3_701_TICK(t)
+# define BFI_FLINEAR3_700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_699, v ds
+# define BFI_FLINEAR3_700_TICK(t)
+# define BFI_FLINEAR3_699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_698, v ds
+# define BFI_FLINEAR3_699_TICK(t)
+# define BFI_FLINEAR3_698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_697, v ds
+# define BFI_FLINEAR3_698_TICK(t)
+# define BFI_FLINEAR3_697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_696, v ds
+# define BFI_FLINEAR3_697_TICK(t)
+# define BFI_FLINEAR3_696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_695, v ds
+# define BFI_FLINEAR3_696_TICK(t)
+# define BFI_FLINEAR3_695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_694, v ds
+# define BFI_FLINEAR3_695_TICK(t)
+# define BFI_FLINEAR3_694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_693, v ds
+# define BFI_FLINEAR3_694_TICK(t)
+# define BFI_FLINEAR3_693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_692, v ds
+# define BFI_FLINEAR3_693_TICK(t)
+# define BFI_FLINEAR3_692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_691, v ds
+# define BFI_FLINEAR3_692_TICK(t)
+# define BFI_FLINEAR3_691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_690, v ds
+# define BFI_FLINEAR3_691_TICK(t)
+# define BFI_FLINEAR3_690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_689, v ds
+# define BFI_FLINEAR3_690_TICK(t)
+# define BFI_FLINEAR3_689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_688, v ds
+# define BFI_FLINEAR3_689_TICK(t)
+# define BFI_FLINEAR3_688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_687, v ds
+# define BFI_FLINEAR3_688_TICK(t)
+# define BFI_FLINEAR3_687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_686, v ds
+# define BFI_FLINEAR3_687_TICK(t)
+# define BFI_FLINEAR3_686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_685, v ds
+# define BFI_FLINEAR3_686_TICK(t)
+# define BFI_FLINEAR3_685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_684, v ds
+# define BFI_FLINEAR3_685_TICK(t)
+# define BFI_FLINEAR3_684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_683, v ds
+# define BFI_FLINEAR3_684_TICK(t)
+# define BFI_FLINEAR3_683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_682, v ds
+# define BFI_FLINEAR3_683_TICK(t)
+# define BFI_FLINEAR3_682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_681, v ds
+# define BFI_FLINEAR3_682_TICK(t)
+# define BFI_FLINEAR3_681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_680, v ds
+# define BFI_FLINEAR3_681_TICK(t)
+# define BFI_FLINEAR3_680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_679, v ds
+# define BFI_FLINEAR3_680_TICK(t)
+# define BFI_FLINEAR3_679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_678, v ds
+# define BFI_FLINEAR3_679_TICK(t)
+# define BFI_FLINEAR3_678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_677, v ds
+# define BFI_FLINEAR3_678_TICK(t)
+# define BFI_FLINEAR3_677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_676, v ds
+# define BFI_FLINEAR3_677_TICK(t)
+# define BFI_FLINEAR3_676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_675, v ds
+# define BFI_FLINEAR3_676_TICK(t)
+# define BFI_FLINEAR3_675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_674, v ds
+# define BFI_FLINEAR3_675_TICK(t)
+# define BFI_FLINEAR3_674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_673, v ds
+# define BFI_FLINEAR3_674_TICK(t)
+# define BFI_FLINEAR3_673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_672, v ds
+# define BFI_FLINEAR3_673_TICK(t)
+# define BFI_FLINEAR3_672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_671, v ds
+# define BFI_FLINEAR3_672_TICK(t)
+# define BFI_FLINEAR3_671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_670, v ds
+# define BFI_FLINEAR3_671_TICK(t)
+# define BFI_FLINEAR3_670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_669, v ds
+# define BFI_FLINEAR3_670_TICK(t)
+# define BFI_FLINEAR3_669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_668, v ds
+# define BFI_FLINEAR3_669_TICK(t)
+# define BFI_FLINEAR3_668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_667, v ds
+# define BFI_FLINEAR3_668_TICK(t)
+# define BFI_FLINEAR3_667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_666, v ds
+# define BFI_FLINEAR3_667_TICK(t)
+# define BFI_FLINEAR3_666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_665, v ds
+# define BFI_FLINEAR3_666_TICK(t)
+# define BFI_FLINEAR3_665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_664, v ds
+# define BFI_FLINEAR3_665_TICK(t)
+# define BFI_FLINEAR3_664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_663, v ds
+# define BFI_FLINEAR3_664_TICK(t)
+# define BFI_FLINEAR3_663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_662, v ds
+# define BFI_FLINEAR3_663_TICK(t)
+# define BFI_FLINEAR3_662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_661, v ds
+# define BFI_FLINEAR3_662_TICK(t)
+# define BFI_FLINEAR3_661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_660, v ds
+# define BFI_FLINEAR3_661_TICK(t)
+# define BFI_FLINEAR3_660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_659, v ds
+# define BFI_FLINEAR3_660_TICK(t)
+# define BFI_FLINEAR3_659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_658, v ds
+# define BFI_FLINEAR3_659_TICK(t)
+# define BFI_FLINEAR3_658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_657, v ds
+# define BFI_FLINEAR3_658_TICK(t)
+# define BFI_FLINEAR3_657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_656, v ds
+# define BFI_FLINEAR3_657_TICK(t)
+# define BFI_FLINEAR3_656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_655, v ds
+# define BFI_FLINEAR3_656_TICK(t)
+# define BFI_FLINEAR3_655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_654, v ds
+# define BFI_FLINEAR3_655_TICK(t)
+# define BFI_FLINEAR3_654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_653, v ds
+# define BFI_FLINEAR3_654_TICK(t)
+# define BFI_FLINEAR3_653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_652, v ds
+# define BFI_FLINEAR3_653_TICK(t)
+# define BFI_FLINEAR3_652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_651, v ds
+# define BFI_FLINEAR3_652_TICK(t)
+# define BFI_FLINEAR3_651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_650, v ds
+# define BFI_FLINEAR3_651_TICK(t)
+# define BFI_FLINEAR3_650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_649, v ds
+# define BFI_FLINEAR3_650_TICK(t)
+# define BFI_FLINEAR3_649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_648, v ds
+# define BFI_FLINEAR3_649_TICK(t)
+# define BFI_FLINEAR3_648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_647, v ds
+# define BFI_FLINEAR3_648_TICK(t)
+# define BFI_FLINEAR3_647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_646, v ds
+# define BFI_FLINEAR3_647_TICK(t)
+# define BFI_FLINEAR3_646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_645, v ds
+# define BFI_FLINEAR3_646_TICK(t)
+# define BFI_FLINEAR3_645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_644, v ds
+# define BFI_FLINEAR3_645_TICK(t)
+# define BFI_FLINEAR3_644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_643, v ds
+# define BFI_FLINEAR3_644_TICK(t)
+# define BFI_FLINEAR3_643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_642, v ds
+# define BFI_FLINEAR3_643_TICK(t)
+# define BFI_FLINEAR3_642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_641, v ds
+# define BFI_FLINEAR3_642_TICK(t)
+# define BFI_FLINEAR3_641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_640, v ds
+# define BFI_FLINEAR3_641_TICK(t)
+# define BFI_FLINEAR3_640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_639, v ds
+# define BFI_FLINEAR3_640_TICK(t)
+# define BFI_FLINEAR3_639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_638, v ds
+# define BFI_FLINEAR3_639_TICK(t)
+# define BFI_FLINEAR3_638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_637, v ds
+# define BFI_FLINEAR3_638_TICK(t)
+# define BFI_FLINEAR3_637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_636, v ds
+# define BFI_FLINEAR3_637_TICK(t)
+# define BFI_FLINEAR3_636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_635, v ds
+# define BFI_FLINEAR3_636_TICK(t)
+# define BFI_FLINEAR3_635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_634, v ds
+# define BFI_FLINEAR3_635_TICK(t)
+# define BFI_FLINEAR3_634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_633, v ds
+# define BFI_FLINEAR3_634_TICK(t)
+# define BFI_FLINEAR3_633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_632, v ds
+# define BFI_FLINEAR3_633_TICK(t)
+# define BFI_FLINEAR3_632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_631, v ds
+# define BFI_FLINEAR3_632_TICK(t)
+# define BFI_FLINEAR3_631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_630, v ds
+# define BFI_FLINEAR3_631_TICK(t)
+# define BFI_FLINEAR3_630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_629, v ds
+# define BFI_FLINEAR3_630_TICK(t)
+# define BFI_FLINEAR3_629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_628, v ds
+# define BFI_FLINEAR3_629_TICK(t)
+# define BFI_FLINEAR3_628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_627, v ds
+# define BFI_FLINEAR3_628_TICK(t)
+# define BFI_FLINEAR3_627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_626, v ds
+# define BFI_FLINEAR3_627_TICK(t)
+# define BFI_FLINEAR3_626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_625, v ds
+# define BFI_FLINEAR3_626_TICK(t)
+# define BFI_FLINEAR3_625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_624, v ds
+# define BFI_FLINEAR3_625_TICK(t)
+# define BFI_FLINEAR3_624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_623, v ds
+# define BFI_FLINEAR3_624_TICK(t)
+# define BFI_FLINEAR3_623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_622, v ds
+# define BFI_FLINEAR3_623_TICK(t)
+# define BFI_FLINEAR3_622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_621, v ds
+# define BFI_FLINEAR3_622_TICK(t)
+# define BFI_FLINEAR3_621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_620, v ds
+# define BFI_FLINEAR3_621_TICK(t)
+# define BFI_FLINEAR3_620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_619, v ds
+# define BFI_FLINEAR3_620_TICK(t)
+# define BFI_FLINEAR3_619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_618, v ds
+# define BFI_FLINEAR3_619_TICK(t)
+# define BFI_FLINEAR3_618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_617, v ds
+# define BFI_FLINEAR3_618_TICK(t)
+# define BFI_FLINEAR3_617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_616, v ds
+# define BFI_FLINEAR3_617_TICK(t)
+# define BFI_FLINEAR3_616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_615, v ds
+# define BFI_FLINEAR3_616_TICK(t)
+# define BFI_FLINEAR3_615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_614, v ds
+# define BFI_FLINEAR3_615_TICK(t)
+# define BFI_FLINEAR3_614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_613, v ds
+# define BFI_FLINEAR3_614_TICK(t)
+# define BFI_FLINEAR3_613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_612, v ds
+# define BFI_FLINEAR3_613_TICK(t)
+# define BFI_FLINEAR3_612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_611, v ds
+# define BFI_FLINEAR3_612_TICK(t)
+# define BFI_FLINEAR3_611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_610, v ds
+# define BFI_FLINEAR3_611_TICK(t)
+# define BFI_FLINEAR3_610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_609, v ds
+# define BFI_FLINEAR3_610_TICK(t)
+# define BFI_FLINEAR3_609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_608, v ds
+# define BFI_FLINEAR3_609_TICK(t)
+# define BFI_FLINEAR3_608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_607, v ds
+# define BFI_FLINEAR3_608_TICK(t)
+# define BFI_FLINEAR3_607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_606, v ds
+# define BFI_FLINEAR3_607_TICK(t)
+# define BFI_FLINEAR3_606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_605, v ds
+# define BFI_FLINEAR3_606_TICK(t)
+# define BFI_FLINEAR3_605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_604, v ds
+# define BFI_FLINEAR3_605_TICK(t)
+# define BFI_FLINEAR3_604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_603, v ds
+# define BFI_FLINEAR3_604_TICK(t)
+# define BFI_FLINEAR3_603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_602, v ds
+# define BFI_FLINEAR3_603_TICK(t)
+# define BFI_FLINEAR3_602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_601, v ds
+# define BFI_FLINEAR3_602_TICK(t)
+# define BFI_FLINEAR3_601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_600, v ds
+# define BFI_FLINEAR3_601_TICK(t)
+# define BFI_FLINEAR3_600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_599, v ds
+# define BFI_FLINEAR3_600_TICK(t)
+# define BFI_FLINEAR3_599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_598, v ds
+# define BFI_FLINEAR3_599_TICK(t)
+# define BFI_FLINEAR3_598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_597, v ds
+# define BFI_FLINEAR3_598_TICK(t)
+# define BFI_FLINEAR3_597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_596, v ds
+# define BFI_FLINEAR3_597_TICK(t)
+# define BFI_FLINEAR3_596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_595, v ds
+# define BFI_FLINEAR3_596_TICK(t)
+# define BFI_FLINEAR3_595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_594, v ds
+# define BFI_FLINEAR3_595_TICK(t)
+# define BFI_FLINEAR3_594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_593, v ds
+# define BFI_FLINEAR3_594_TICK(t)
+# define BFI_FLINEAR3_593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_592, v ds
+# define BFI_FLINEAR3_593_TICK(t)
+# define BFI_FLINEAR3_592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_591, v ds
+# define BFI_FLINEAR3_592_TICK(t)
+# define BFI_FLINEAR3_591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_590, v ds
+# define BFI_FLINEAR3_591_TICK(t)
+# define BFI_FLINEAR3_590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_589, v ds
+# define BFI_FLINEAR3_590_TICK(t)
+# define BFI_FLINEAR3_589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_588, v ds
+# define BFI_FLINEAR3_589_TICK(t)
+# define BFI_FLINEAR3_588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_587, v ds
+# define BFI_FLINEAR3_588_TICK(t)
+# define BFI_FLINEAR3_587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_586, v ds
+# define BFI_FLINEAR3_587_TICK(t)
+# define BFI_FLINEAR3_586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_585, v ds
+# define BFI_FLINEAR3_586_TICK(t)
+# define BFI_FLINEAR3_585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_584, v ds
+# define BFI_FLINEAR3_585_TICK(t)
+# define BFI_FLINEAR3_584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_583, v ds
+# define BFI_FLINEAR3_584_TICK(t)
+# define BFI_FLINEAR3_583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_582, v ds
+# define BFI_FLINEAR3_583_TICK(t)
+# define BFI_FLINEAR3_582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_581, v ds
+# define BFI_FLINEAR3_582_TICK(t)
+# define BFI_FLINEAR3_581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_580, v ds
+# define BFI_FLINEAR3_581_TICK(t)
+# define BFI_FLINEAR3_580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_579, v ds
+# define BFI_FLINEAR3_580_TICK(t)
+# define BFI_FLINEAR3_579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_578, v ds
+# define BFI_FLINEAR3_579_TICK(t)
+# define BFI_FLINEAR3_578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_577, v ds
+# define BFI_FLINEAR3_578_TICK(t)
+# define BFI_FLINEAR3_577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_576, v ds
+# define BFI_FLINEAR3_577_TICK(t)
+# define BFI_FLINEAR3_576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_575, v ds
+# define BFI_FLINEAR3_576_TICK(t)
+# define BFI_FLINEAR3_575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_574, v ds
+# define BFI_FLINEAR3_575_TICK(t)
+# define BFI_FLINEAR3_574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_573, v ds
+# define BFI_FLINEAR3_574_TICK(t)
+# define BFI_FLINEAR3_573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_572, v ds
+# define BFI_FLINEAR3_573_TICK(t)
+# define BFI_FLINEAR3_572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_571, v ds
+# define BFI_FLINEAR3_572_TICK(t)
+# define BFI_FLINEAR3_571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_570, v ds
+# define BFI_FLINEAR3_571_TICK(t)
+# define BFI_FLINEAR3_570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_569, v ds
+# define BFI_FLINEAR3_570_TICK(t)
+# define BFI_FLINEAR3_569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_568, v ds
+# define BFI_FLINEAR3_569_TICK(t)
+# define BFI_FLINEAR3_568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_567, v ds
+# define BFI_FLINEAR3_568_TICK(t)
+# define BFI_FLINEAR3_567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_566, v ds
+# define BFI_FLINEAR3_567_TICK(t)
+# define BFI_FLINEAR3_566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_565, v ds
+# define BFI_FLINEAR3_566_TICK(t)
+# define BFI_FLINEAR3_565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_564, v ds
+# define BFI_FLINEAR3_565_TICK(t)
+# define BFI_FLINEAR3_564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_563, v ds
+# define BFI_FLINEAR3_564_TICK(t)
+# define BFI_FLINEAR3_563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_562, v ds
+# define BFI_FLINEAR3_563_TICK(t)
+# define BFI_FLINEAR3_562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_561, v ds
+# define BFI_FLINEAR3_562_TICK(t)
+# define BFI_FLINEAR3_561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_560, v ds
+# define BFI_FLINEAR3_561_TICK(t)
+# define BFI_FLINEAR3_560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_559, v ds
+# define BFI_FLINEAR3_560_TICK(t)
+# define BFI_FLINEAR3_559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_558, v ds
+# define BFI_FLINEAR3_559_TICK(t)
+# define BFI_FLINEAR3_558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_557, v ds
+# define BFI_FLINEAR3_558_TICK(t)
+# define BFI_FLINEAR3_557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_556, v ds
+# define BFI_FLINEAR3_557_TICK(t)
+# define BFI_FLINEAR3_556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_555, v ds
+# define BFI_FLINEAR3_556_TICK(t)
+# define BFI_FLINEAR3_555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_554, v ds
+# define BFI_FLINEAR3_555_TICK(t)
+# define BFI_FLINEAR3_554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_553, v ds
+# define BFI_FLINEAR3_554_TICK(t)
+# define BFI_FLINEAR3_553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_552, v ds
+# define BFI_FLINEAR3_553_TICK(t)
+# define BFI_FLINEAR3_552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_551, v ds
+# define BFI_FLINEAR3_552_TICK(t)
+# define BFI_FLINEAR3_551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_550, v ds
+# define BFI_FLINEAR3_551_TICK(t)
+# define BFI_FLINEAR3_550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_549, v ds
+# define BFI_FLINEAR3_550_TICK(t)
+# define BFI_FLINEAR3_549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_548, v ds
+# define BFI_FLINEAR3_549_TICK(t)
+# define BFI_FLINEAR3_548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_547, v ds
+# define BFI_FLINEAR3_548_TICK(t)
+# define BFI_FLINEAR3_547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_546, v ds
+# define BFI_FLINEAR3_547_TICK(t)
+# define BFI_FLINEAR3_546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_545, v ds
+# define BFI_FLINEAR3_546_TICK(t)
+# define BFI_FLINEAR3_545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_544, v ds
+# define BFI_FLINEAR3_545_TICK(t)
+# define BFI_FLINEAR3_544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_543, v ds
+# define BFI_FLINEAR3_544_TICK(t)
+# define BFI_FLINEAR3_543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_542, v ds
+# define BFI_FLINEAR3_543_TICK(t)
+# define BFI_FLINEAR3_542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_541, v ds
+# define BFI_FLINEAR3_542_TICK(t)
+# define BFI_FLINEAR3_541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_540, v ds
+# define BFI_FLINEAR3_541_TICK(t)
+# define BFI_FLINEAR3_540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_539, v ds
+# define BFI_FLINEAR3_540_TICK(t)
+# define BFI_FLINEAR3_539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_538, v ds
+# define BFI_FLINEAR3_539_TICK(t)
+# define BFI_FLINEAR3_538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_537, v ds
+# define BFI_FLINEAR3_538_TICK(t)
+# define BFI_FLINEAR3_537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_536, v ds
+# define BFI_FLINEAR3_537_TICK(t)
+# define BFI_FLINEAR3_536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_535, v ds
+# define BFI_FLINEAR3_536_TICK(t)
+# define BFI_FLINEAR3_535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_534, v ds
+# define BFI_FLINEAR3_535_TICK(t)
+# define BFI_FLINEAR3_534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_533, v ds
+# define BFI_FLINEAR3_534_TICK(t)
+# define BFI_FLINEAR3_533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_532, v ds
+# define BFI_FLINEAR3_533_TICK(t)
+# define BFI_FLINEAR3_532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_531, v ds
+# define BFI_FLINEAR3_532_TICK(t)
+# define BFI_FLINEAR3_531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_530, v ds
+# define BFI_FLINEAR3_531_TICK(t)
+# define BFI_FLINEAR3_530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_529, v ds
+# define BFI_FLINEAR3_530_TICK(t)
+# define BFI_FLINEAR3_529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_528, v ds
+# define BFI_FLINEAR3_529_TICK(t)
+# define BFI_FLINEAR3_528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_527, v ds
+# define BFI_FLINEAR3_528_TICK(t)
+# define BFI_FLINEAR3_527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_526, v ds
+# define BFI_FLINEAR3_527_TICK(t)
+# define BFI_FLINEAR3_526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_525, v ds
+# define BFI_FLINEAR3_526_TICK(t)
+# define BFI_FLINEAR3_525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_524, v ds
+# define BFI_FLINEAR3_525_TICK(t)
+# define BFI_FLINEAR3_524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_523, v ds
+# define BFI_FLINEAR3_524_TICK(t)
+# define BFI_FLINEAR3_523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_522, v ds
+# define BFI_FLINEAR3_523_TICK(t)
+# define BFI_FLINEAR3_522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_521, v ds
+# define BFI_FLINEAR3_522_TICK(t)
+# define BFI_FLINEAR3_521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_520, v ds
+# define BFI_FLINEAR3_521_TICK(t)
+# define BFI_FLINEAR3_520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_519, v ds
+# define BFI_FLINEAR3_520_TICK(t)
+# define BFI_FLINEAR3_519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_518, v ds
+# define BFI_FLINEAR3_519_TICK(t)
+# define BFI_FLINEAR3_518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_517, v ds
+# define BFI_FLINEAR3_518_TICK(t)
+# define BFI_FLINEAR3_517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_516, v ds
+# define BFI_FLINEAR3_517_TICK(t)
+# define BFI_FLINEAR3_516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_515, v ds
+# define BFI_FLINEAR3_516_TICK(t)
+# define BFI_FLINEAR3_515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_514, v ds
+# define BFI_FLINEAR3_515_TICK(t)
+# define BFI_FLINEAR3_514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_513, v ds
+# define BFI_FLINEAR3_514_TICK(t)
+# define BFI_FLINEAR3_513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_512, v ds
+# define BFI_FLINEAR3_513_TICK(t)
+# define BFI_FLINEAR3_512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_511, v ds
+# define BFI_FLINEAR3_512_TICK(t)
+# define BFI_FLINEAR3_511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_510, v ds
+# define BFI_FLINEAR3_511_TICK(t)
+# define BFI_FLINEAR3_510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_509, v ds
+# define BFI_FLINEAR3_510_TICK(t)
+# define BFI_FLINEAR3_509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_508, v ds
+# define BFI_FLINEAR3_509_TICK(t)
+# define BFI_FLINEAR3_508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_507, v ds
+# define BFI_FLINEAR3_508_TICK(t)
+# define BFI_FLINEAR3_507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_506, v ds
+# define BFI_FLINEAR3_507_TICK(t)
+# define BFI_FLINEAR3_506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_505, v ds
+# define BFI_FLINEAR3_506_TICK(t)
+# define BFI_FLINEAR3_505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_504, v ds
+# define BFI_FLINEAR3_505_TICK(t)
+# define BFI_FLINEAR3_504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_503, v ds
+# define BFI_FLINEAR3_504_TICK(t)
+# define BFI_FLINEAR3_503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_502, v ds
+# define BFI_FLINEAR3_503_TICK(t)
+# define BFI_FLINEAR3_502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_501, v ds
+# define BFI_FLINEAR3_502_TICK(t)
+# define BFI_FLINEAR3_501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_500, v ds
+# define BFI_FLINEAR3_501_TICK(t)
+# define BFI_FLINEAR3_500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_499, v ds
+# define BFI_FLINEAR3_500_TICK(t)
+# define BFI_FLINEAR3_499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_498, v ds
+# define BFI_FLINEAR3_499_TICK(t)
+# define BFI_FLINEAR3_498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_497, v ds
+# define BFI_FLINEAR3_498_TICK(t)
+# define BFI_FLINEAR3_497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_496, v ds
+# define BFI_FLINEAR3_497_TICK(t)
+# define BFI_FLINEAR3_496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_495, v ds
+# define BFI_FLINEAR3_496_TICK(t)
+# define BFI_FLINEAR3_495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_494, v ds
+# define BFI_FLINEAR3_495_TICK(t)
+# define BFI_FLINEAR3_494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_493, v ds
+# define BFI_FLINEAR3_494_TICK(t)
+# define BFI_FLINEAR3_493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_492, v ds
+# define BFI_FLINEAR3_493_TICK(t)
+# define BFI_FLINEAR3_492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_491, v ds
+# define BFI_FLINEAR3_492_TICK(t)
+# define BFI_FLINEAR3_491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_490, v ds
+# define BFI_FLINEAR3_491_TICK(t)
+# define BFI_FLINEAR3_490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_489, v ds
+# define BFI_FLINEAR3_490_TICK(t)
+# define BFI_FLINEAR3_489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_488, v ds
+# define BFI_FLINEAR3_489_TICK(t)
+# define BFI_FLINEAR3_488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_487, v ds
+# define BFI_FLINEAR3_488_TICK(t)
+# define BFI_FLINEAR3_487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_486, v ds
+# define BFI_FLINEAR3_487_TICK(t)
+# define BFI_FLINEAR3_486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_485, v ds
+# define BFI_FLINEAR3_486_TICK(t)
+# define BFI_FLINEAR3_485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_484, v ds
+# define BFI_FLINEAR3_485_TICK(t)
+# define BFI_FLINEAR3_484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_483, v ds
+# define BFI_FLINEAR3_484_TICK(t)
+# define BFI_FLINEAR3_483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_482, v ds
+# define BFI_FLINEAR3_483_TICK(t)
+# define BFI_FLINEAR3_482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_481, v ds
+# define BFI_FLINEAR3_482_TICK(t)
+# define BFI_FLINEAR3_481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_480, v ds
+# define BFI_FLINEAR3_481_TICK(t)
+# define BFI_FLINEAR3_480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_479, v ds
+# define BFI_FLINEAR3_480_TICK(t)
+# define BFI_FLINEAR3_479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_478, v ds
+# define BFI_FLINEAR3_479_TICK(t)
+# define BFI_FLINEAR3_478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_477, v ds
+# define BFI_FLINEAR3_478_TICK(t)
+# define BFI_FLINEAR3_477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_476, v ds
+# define BFI_FLINEAR3_477_TICK(t)
+# define BFI_FLINEAR3_476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_475, v ds
+# define BFI_FLINEAR3_476_TICK(t)
+# define BFI_FLINEAR3_475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_474, v ds
+# define BFI_FLINEAR3_475_TICK(t)
+# define BFI_FLINEAR3_474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_473, v ds
+# define BFI_FLINEAR3_474_TICK(t)
+# define BFI_FLINEAR3_473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_472, v ds
+# define BFI_FLINEAR3_473_TICK(t)
+# define BFI_FLINEAR3_472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_471, v ds
+# define BFI_FLINEAR3_472_TICK(t)
+# define BFI_FLINEAR3_471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_470, v ds
+# define BFI_FLINEAR3_471_TICK(t)
+# define BFI_FLINEAR3_470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_469, v ds
+# define BFI_FLINEAR3_470_TICK(t)
+# define BFI_FLINEAR3_469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_468, v ds
+# define BFI_FLINEAR3_469_TICK(t)
+# define BFI_FLINEAR3_468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_467, v ds
+# define BFI_FLINEAR3_468_TICK(t)
+# define BFI_FLINEAR3_467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_466, v ds
+# define BFI_FLINEAR3_467_TICK(t)
+# define BFI_FLINEAR3_466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_465, v ds
+# define BFI_FLINEAR3_466_TICK(t)
+# define BFI_FLINEAR3_465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_464, v ds
+# define BFI_FLINEAR3_465_TICK(t)
+# define BFI_FLINEAR3_464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_463, v ds
+# define BFI_FLINEAR3_464_TICK(t)
+# define BFI_FLINEAR3_463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_462, v ds
+# define BFI_FLINEAR3_463_TICK(t)
+# define BFI_FLINEAR3_462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_461, v ds
+# define BFI_FLINEAR3_462_TICK(t)
+# define BFI_FLINEAR3_461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_460, v ds
+# define BFI_FLINEAR3_461_TICK(t)
+# define BFI_FLINEAR3_460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_459, v ds
+# define BFI_FLINEAR3_460_TICK(t)
+# define BFI_FLINEAR3_459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_458, v ds
+# define BFI_FLINEAR3_459_TICK(t)
+# define BFI_FLINEAR3_458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_457, v ds
+# define BFI_FLINEAR3_458_TICK(t)
+# define BFI_FLINEAR3_457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_456, v ds
+# define BFI_FLINEAR3_457_TICK(t)
+# define BFI_FLINEAR3_456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_455, v ds
+# define BFI_FLINEAR3_456_TICK(t)
+# define BFI_FLINEAR3_455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_454, v ds
+# define BFI_FLINEAR3_455_TICK(t)
+# define BFI_FLINEAR3_454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_453, v ds
+# define BFI_FLINEAR3_454_TICK(t)
+# define BFI_FLINEAR3_453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_452, v ds
+# define BFI_FLINEAR3_453_TICK(t)
+# define BFI_FLINEAR3_452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_451, v ds
+# define BFI_FLINEAR3_452_TICK(t)
+# define BFI_FLINEAR3_451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_450, v ds
+# define BFI_FLINEAR3_451_TICK(t)
+# define BFI_FLINEAR3_450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_449, v ds
+# define BFI_FLINEAR3_450_TICK(t)
+# define BFI_FLINEAR3_449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_448, v ds
+# define BFI_FLINEAR3_449_TICK(t)
+# define BFI_FLINEAR3_448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_447, v ds
+# define BFI_FLINEAR3_448_TICK(t)
+# define BFI_FLINEAR3_447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_446, v ds
+# define BFI_FLINEAR3_447_TICK(t)
+# define BFI_FLINEAR3_446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_445, v ds
+# define BFI_FLINEAR3_446_TICK(t)
+# define BFI_FLINEAR3_445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_444, v ds
+# define BFI_FLINEAR3_445_TICK(t)
+# define BFI_FLINEAR3_444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_443, v ds
+# define BFI_FLINEAR3_444_TICK(t)
+# define BFI_FLINEAR3_443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_442, v ds
+# define BFI_FLINEAR3_443_TICK(t)
+# define BFI_FLINEAR3_442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_441, v ds
+# define BFI_FLINEAR3_442_TICK(t)
+# define BFI_FLINEAR3_441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_440, v ds
+# define BFI_FLINEAR3_441_TICK(t)
+# define BFI_FLINEAR3_440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_439, v ds
+# define BFI_FLINEAR3_440_TICK(t)
+# define BFI_FLINEAR3_439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_438, v ds
+# define BFI_FLINEAR3_439_TICK(t)
+# define BFI_FLINEAR3_438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_437, v ds
+# define BFI_FLINEAR3_438_TICK(t)
+# define BFI_FLINEAR3_437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_436, v ds
+# define BFI_FLINEAR3_437_TICK(t)
+# define BFI_FLINEAR3_436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_435, v ds
+# define BFI_FLINEAR3_436_TICK(t)
+# define BFI_FLINEAR3_435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_434, v ds
+# define BFI_FLINEAR3_435_TICK(t)
+# define BFI_FLINEAR3_434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_433, v ds
+# define BFI_FLINEAR3_434_TICK(t)
+# define BFI_FLINEAR3_433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_432, v ds
+# define BFI_FLINEAR3_433_TICK(t)
+# define BFI_FLINEAR3_432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_431, v ds
+# define BFI_FLINEAR3_432_TICK(t)
+# define BFI_FLINEAR3_431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_430, v ds
+# define BFI_FLINEAR3_431_TICK(t)
+# define BFI_FLINEAR3_430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_429, v ds
+# define BFI_FLINEAR3_430_TICK(t)
+# define BFI_FLINEAR3_429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_428, v ds
+# define BFI_FLINEAR3_429_TICK(t)
+# define BFI_FLINEAR3_428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_427, v ds
+# define BFI_FLINEAR3_428_TICK(t)
+# define BFI_FLINEAR3_427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_426, v ds
+# define BFI_FLINEAR3_427_TICK(t)
+# define BFI_FLINEAR3_426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_425, v ds
+# define BFI_FLINEAR3_426_TICK(t)
+# define BFI_FLINEAR3_425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_424, v ds
+# define BFI_FLINEAR3_425_TICK(t)
+# define BFI_FLINEAR3_424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_423, v ds
+# define BFI_FLINEAR3_424_TICK(t)
+# define BFI_FLINEAR3_423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_422, v ds
+# define BFI_FLINEAR3_423_TICK(t)
+# define BFI_FLINEAR3_422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_421, v ds
+# define BFI_FLINEAR3_422_TICK(t)
+# define BFI_FLINEAR3_421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_420, v ds
+# define BFI_FLINEAR3_421_TICK(t)
+# define BFI_FLINEAR3_420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_419, v ds
+# define BFI_FLINEAR3_420_TICK(t)
+# define BFI_FLINEAR3_419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_418, v ds
+# define BFI_FLINEAR3_419_TICK(t)
+# define BFI_FLINEAR3_418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_417, v ds
+# define BFI_FLINEAR3_418_TICK(t)
+# define BFI_FLINEAR3_417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_416, v ds
+# define BFI_FLINEAR3_417_TICK(t)
+# define BFI_FLINEAR3_416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_415, v ds
+# define BFI_FLINEAR3_416_TICK(t)
+# define BFI_FLINEAR3_415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_414, v ds
+# define BFI_FLINEAR3_415_TICK(t)
+# define BFI_FLINEAR3_414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_413, v ds
+# define BFI_FLINEAR3_414_TICK(t)
+# define BFI_FLINEAR3_413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_412, v ds
+# define BFI_FLINEAR3_413_TICK(t)
+# define BFI_FLINEAR3_412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_411, v ds
+# define BFI_FLINEAR3_412_TICK(t)
+# define BFI_FLINEAR3_411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_410, v ds
+# define BFI_FLINEAR3_411_TICK(t)
+# define BFI_FLINEAR3_410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_409, v ds
+# define BFI_FLINEAR3_410_TICK(t)
+# define BFI_FLINEAR3_409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_408, v ds
+# define BFI_FLINEAR3_409_TICK(t)
+# define BFI_FLINEAR3_408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_407, v ds
+# define BFI_FLINEAR3_408_TICK(t)
+# define BFI_FLINEAR3_407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_406, v ds
+# define BFI_FLINEAR3_407_TICK(t)
+# define BFI_FLINEAR3_406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_405, v ds
+# define BFI_FLINEAR3_406_TICK(t)
+# define BFI_FLINEAR3_405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_404, v ds
+# define BFI_FLINEAR3_405_TICK(t)
+# define BFI_FLINEAR3_404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_403, v ds
+# define BFI_FLINEAR3_404_TICK(t)
+# define BFI_FLINEAR3_403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_402, v ds
+# define BFI_FLINEAR3_403_TICK(t)
+# define BFI_FLINEAR3_402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_401, v ds
+# define BFI_FLINEAR3_402_TICK(t)
+# define BFI_FLINEAR3_401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_400, v ds
+# define BFI_FLINEAR3_401_TICK(t)
+# define BFI_FLINEAR3_400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_399, v ds
+# define BFI_FLINEAR3_400_TICK(t)
+# define BFI_FLINEAR3_399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_398, v ds
+# define BFI_FLINEAR3_399_TICK(t)
+# define BFI_FLINEAR3_398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_397, v ds
+# define BFI_FLINEAR3_398_TICK(t)
+# define BFI_FLINEAR3_397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_396, v ds
+# define BFI_FLINEAR3_397_TICK(t)
+# define BFI_FLINEAR3_396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_395, v ds
+# define BFI_FLINEAR3_396_TICK(t)
+# define BFI_FLINEAR3_395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_394, v ds
+# define BFI_FLINEAR3_395_TICK(t)
+# define BFI_FLINEAR3_394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_393, v ds
+# define BFI_FLINEAR3_394_TICK(t)
+# define BFI_FLINEAR3_393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_392, v ds
+# define BFI_FLINEAR3_393_TICK(t)
+# define BFI_FLINEAR3_392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_391, v ds
+# define BFI_FLINEAR3_392_TICK(t)
+# define BFI_FLINEAR3_391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_390, v ds
+# define BFI_FLINEAR3_391_TICK(t)
+# define BFI_FLINEAR3_390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_389, v ds
+# define BFI_FLINEAR3_390_TICK(t)
+# define BFI_FLINEAR3_389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_388, v ds
+# define BFI_FLINEAR3_389_TICK(t)
+# define BFI_FLINEAR3_388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_387, v ds
+# define BFI_FLINEAR3_388_TICK(t)
+# define BFI_FLINEAR3_387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_386, v ds
+# define BFI_FLINEAR3_387_TICK(t)
+# define BFI_FLINEAR3_386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_385, v ds
+# define BFI_FLINEAR3_386_TICK(t)
+# define BFI_FLINEAR3_385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_384, v ds
+# define BFI_FLINEAR3_385_TICK(t)
+# define BFI_FLINEAR3_384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_383, v ds
+# define BFI_FLINEAR3_384_TICK(t)
+# define BFI_FLINEAR3_383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_382, v ds
+# define BFI_FLINEAR3_383_TICK(t)
+# define BFI_FLINEAR3_382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_381, v ds
+# define BFI_FLINEAR3_382_TICK(t)
+# define BFI_FLINEAR3_381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_380, v ds
+# define BFI_FLINEAR3_381_TICK(t)
+# define BFI_FLINEAR3_380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_379, v ds
+# define BFI_FLINEAR3_380_TICK(t)
+# define BFI_FLINEAR3_379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_378, v ds
+# define BFI_FLINEAR3_379_TICK(t)
+# define BFI_FLINEAR3_378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_377, v ds
+# define BFI_FLINEAR3_378_TICK(t)
+# define BFI_FLINEAR3_377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_376, v ds
+# define BFI_FLINEAR3_377_TICK(t)
+# define BFI_FLINEAR3_376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_375, v ds
+# define BFI_FLINEAR3_376_TICK(t)
+# define BFI_FLINEAR3_375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_374, v ds
+# define BFI_FLINEAR3_375_TICK(t)
+# define BFI_FLINEAR3_374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_373, v ds
+# define BFI_FLINEAR3_374_TICK(t)
+# define BFI_FLINEAR3_373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_372, v ds
+# define BFI_FLINEAR3_373_TICK(t)
+# define BFI_FLINEAR3_372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_371, v ds
+# define BFI_FLINEAR3_372_TICK(t)
+# define BFI_FLINEAR3_371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_370, v ds
+# define BFI_FLINEAR3_371_TICK(t)
+# define BFI_FLINEAR3_370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_369, v ds
+# define BFI_FLINEAR3_370_TICK(t)
+# define BFI_FLINEAR3_369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_368, v ds
+# define BFI_FLINEAR3_369_TICK(t)
+# define BFI_FLINEAR3_368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_367, v ds
+# define BFI_FLINEAR3_368_TICK(t)
+# define BFI_FLINEAR3_367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_366, v ds
+# define BFI_FLINEAR3_367_TICK(t)
+# define BFI_FLINEAR3_366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_365, v ds
+# define BFI_FLINEAR3_366_TICK(t)
+# define BFI_FLINEAR3_365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_364, v ds
+# define BFI_FLINEAR3_365_TICK(t)
+# define BFI_FLINEAR3_364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_363, v ds
+# define BFI_FLINEAR3_364_TICK(t)
+# define BFI_FLINEAR3_363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_362, v ds
+# define BFI_FLINEAR3_363_TICK(t)
+# define BFI_FLINEAR3_362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_361, v ds
+# define BFI_FLINEAR3_362_TICK(t)
+# define BFI_FLINEAR3_361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_360, v ds
+# define BFI_FLINEAR3_361_TICK(t)
+# define BFI_FLINEAR3_360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_359, v ds
+# define BFI_FLINEAR3_360_TICK(t)
+# define BFI_FLINEAR3_359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_358, v ds
+# define BFI_FLINEAR3_359_TICK(t)
+# define BFI_FLINEAR3_358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_357, v ds
+# define BFI_FLINEAR3_358_TICK(t)
+# define BFI_FLINEAR3_357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_356, v ds
+# define BFI_FLINEAR3_357_TICK(t)
+# define BFI_FLINEAR3_356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_355, v ds
+# define BFI_FLINEAR3_356_TICK(t)
+# define BFI_FLINEAR3_355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_354, v ds
+# define BFI_FLINEAR3_355_TICK(t)
+# define BFI_FLINEAR3_354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_353, v ds
+# define BFI_FLINEAR3_354_TICK(t)
+# define BFI_FLINEAR3_353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_352, v ds
+# define BFI_FLINEAR3_353_TICK(t)
+# define BFI_FLINEAR3_352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_351, v ds
+# define BFI_FLINEAR3_352_TICK(t)
+# define BFI_FLINEAR3_351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_350, v ds
+# define BFI_FLINEAR3_351_TICK(t)
+# define BFI_FLINEAR3_350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_349, v ds
+# define BFI_FLINEAR3_350_TICK(t)
+# define BFI_FLINEAR3_349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_348, v ds
+# define BFI_FLINEAR3_349_TICK(t)
+# define BFI_FLINEAR3_348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_347, v ds
+# define BFI_FLINEAR3_348_TICK(t)
+# define BFI_FLINEAR3_347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_346, v ds
+# define BFI_FLINEAR3_347_TICK(t)
+# define BFI_FLINEAR3_346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_345, v ds
+# define BFI_FLINEAR3_346_TICK(t)
+# define BFI_FLINEAR3_345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_344, v ds
+# define BFI_FLINEAR3_345_TICK(t)
+# define BFI_FLINEAR3_344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_343, v ds
+# define BFI_FLINEAR3_344_TICK(t)
+# define BFI_FLINEAR3_343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_342, v ds
+# define BFI_FLINEAR3_343_TICK(t)
+# define BFI_FLINEAR3_342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_341, v ds
+# define BFI_FLINEAR3_342_TICK(t)
+# define BFI_FLINEAR3_341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_340, v ds
+# define BFI_FLINEAR3_341_TICK(t)
+# define BFI_FLINEAR3_340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_339, v ds
+# define BFI_FLINEAR3_340_TICK(t)
+# define BFI_FLINEAR3_339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_338, v ds
+# define BFI_FLINEAR3_339_TICK(t)
+# define BFI_FLINEAR3_338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_337, v ds
+# define BFI_FLINEAR3_338_TICK(t)
+# define BFI_FLINEAR3_337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_336, v ds
+# define BFI_FLINEAR3_337_TICK(t)
+# define BFI_FLINEAR3_336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_335, v ds
+# define BFI_FLINEAR3_336_TICK(t)
+# define BFI_FLINEAR3_335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_334, v ds
+# define BFI_FLINEAR3_335_TICK(t)
+# define BFI_FLINEAR3_334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_333, v ds
+# define BFI_FLINEAR3_334_TICK(t)
+# define BFI_FLINEAR3_333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_332, v ds
+# define BFI_FLINEAR3_333_TICK(t)
+# define BFI_FLINEAR3_332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_331, v ds
+# define BFI_FLINEAR3_332_TICK(t)
+# define BFI_FLINEAR3_331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_330, v ds
+# define BFI_FLINEAR3_331_TICK(t)
+# define BFI_FLINEAR3_330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_329, v ds
+# define BFI_FLINEAR3_330_TICK(t)
+# define BFI_FLINEAR3_329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_328, v ds
+# define BFI_FLINEAR3_329_TICK(t)
+# define BFI_FLINEAR3_328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_327, v ds
+# define BFI_FLINEAR3_328_TICK(t)
+# define BFI_FLINEAR3_327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_326, v ds
+# define BFI_FLINEAR3_327_TICK(t)
+# define BFI_FLINEAR3_326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_325, v ds
+# define BFI_FLINEAR3_326_TICK(t)
+# define BFI_FLINEAR3_325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_324, v ds
+# define BFI_FLINEAR3_325_TICK(t)
+# define BFI_FLINEAR3_324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_323, v ds
+# define BFI_FLINEAR3_324_TICK(t)
+# define BFI_FLINEAR3_323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_322, v ds
+# define BFI_FLINEAR3_323_TICK(t)
+# define BFI_FLINEAR3_322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_321, v ds
+# define BFI_FLINEAR3_322_TICK(t)
+# define BFI_FLINEAR3_321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_320, v ds
+# define BFI_FLINEAR3_321_TICK(t)
+# define BFI_FLINEAR3_320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_319, v ds
+# define BFI_FLINEAR3_320_TICK(t)
+# define BFI_FLINEAR3_319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_318, v ds
+# define BFI_FLINEAR3_319_TICK(t)
+# define BFI_FLINEAR3_318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_317, v ds
+# define BFI_FLINEAR3_318_TICK(t)
+# define BFI_FLINEAR3_317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_316, v ds
+# define BFI_FLINEAR3_317_TICK(t)
+# define BFI_FLINEAR3_316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_315, v ds
+# define BFI_FLINEAR3_316_TICK(t)
+# define BFI_FLINEAR3_315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_314, v ds
+# define BFI_FLINEAR3_315_TICK(t)
+# define BFI_FLINEAR3_314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_313, v ds
+# define BFI_FLINEAR3_314_TICK(t)
+# define BFI_FLINEAR3_313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_312, v ds
+# define BFI_FLINEAR3_313_TICK(t)
+# define BFI_FLINEAR3_312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_311, v ds
+# define BFI_FLINEAR3_312_TICK(t)
+# define BFI_FLINEAR3_311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_310, v ds
+# define BFI_FLINEAR3_311_TICK(t)
+# define BFI_FLINEAR3_310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_309, v ds
+# define BFI_FLINEAR3_310_TICK(t)
+# define BFI_FLINEAR3_309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_308, v ds
+# define BFI_FLINEAR3_309_TICK(t)
+# define BFI_FLINEAR3_308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_307, v ds
+# define BFI_FLINEAR3_308_TICK(t)
+# define BFI_FLINEAR3_307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_306, v ds
+# define BFI_FLINEAR3_307_TICK(t)
+# define BFI_FLINEAR3_306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_305, v ds
+# define BFI_FLINEAR3_306_TICK(t)
+# define BFI_FLINEAR3_305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_304, v ds
+# define BFI_FLINEAR3_305_TICK(t)
+# define BFI_FLINEAR3_304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_303, v ds
+# define BFI_FLINEAR3_304_TICK(t)
+# define BFI_FLINEAR3_303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_302, v ds
+# define BFI_FLINEAR3_303_TICK(t)
+# define BFI_FLINEAR3_302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_301, v ds
+# define BFI_FLINEAR3_302_TICK(t)
+# define BFI_FLINEAR3_301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_300, v ds
+# define BFI_FLINEAR3_301_TICK(t)
+# define BFI_FLINEAR3_300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_299, v ds
+# define BFI_FLINEAR3_300_TICK(t)
+# define BFI_FLINEAR3_299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_298, v ds
+# define BFI_FLINEAR3_299_TICK(t)
+# define BFI_FLINEAR3_298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_297, v ds
+# define BFI_FLINEAR3_298_TICK(t)
+# define BFI_FLINEAR3_297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_296, v ds
+# define BFI_FLINEAR3_297_TICK(t)
+# define BFI_FLINEAR3_296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_295, v ds
+# define BFI_FLINEAR3_296_TICK(t)
+# define BFI_FLINEAR3_295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_294, v ds
+# define BFI_FLINEAR3_295_TICK(t)
+# define BFI_FLINEAR3_294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_293, v ds
+# define BFI_FLINEAR3_294_TICK(t)
+# define BFI_FLINEAR3_293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_292, v ds
+# define BFI_FLINEAR3_293_TICK(t)
+# define BFI_FLINEAR3_292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_291, v ds
+# define BFI_FLINEAR3_292_TICK(t)
+# define BFI_FLINEAR3_291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_290, v ds
+# define BFI_FLINEAR3_291_TICK(t)
+# define BFI_FLINEAR3_290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_289, v ds
+# define BFI_FLINEAR3_290_TICK(t)
+# define BFI_FLINEAR3_289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_288, v ds
+# define BFI_FLINEAR3_289_TICK(t)
+# define BFI_FLINEAR3_288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_287, v ds
+# define BFI_FLINEAR3_288_TICK(t)
+# define BFI_FLINEAR3_287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_286, v ds
+# define BFI_FLINEAR3_287_TICK(t)
+# define BFI_FLINEAR3_286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_285, v ds
+# define BFI_FLINEAR3_286_TICK(t)
+# define BFI_FLINEAR3_285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_284, v ds
+# define BFI_FLINEAR3_285_TICK(t)
+# define BFI_FLINEAR3_284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_283, v ds
+# define BFI_FLINEAR3_284_TICK(t)
+# define BFI_FLINEAR3_283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_282, v ds
+# define BFI_FLINEAR3_283_TICK(t)
+# define BFI_FLINEAR3_282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_281, v ds
+# define BFI_FLINEAR3_282_TICK(t)
+# define BFI_FLINEAR3_281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_280, v ds
+# define BFI_FLINEAR3_281_TICK(t)
+# define BFI_FLINEAR3_280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_279, v ds
+# define BFI_FLINEAR3_280_TICK(t)
+# define BFI_FLINEAR3_279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_278, v ds
+# define BFI_FLINEAR3_279_TICK(t)
+# define BFI_FLINEAR3_278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_277, v ds
+# define BFI_FLINEAR3_278_TICK(t)
+# define BFI_FLINEAR3_277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_276, v ds
+# define BFI_FLINEAR3_277_TICK(t)
+# define BFI_FLINEAR3_276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_275, v ds
+# define BFI_FLINEAR3_276_TICK(t)
+# define BFI_FLINEAR3_275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_274, v ds
+# define BFI_FLINEAR3_275_TICK(t)
+# define BFI_FLINEAR3_274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_273, v ds
+# define BFI_FLINEAR3_274_TICK(t)
+# define BFI_FLINEAR3_273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_272, v ds
+# define BFI_FLINEAR3_273_TICK(t)
+# define BFI_FLINEAR3_272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_271, v ds
+# define BFI_FLINEAR3_272_TICK(t)
+# define BFI_FLINEAR3_271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_270, v ds
+# define BFI_FLINEAR3_271_TICK(t)
+# define BFI_FLINEAR3_270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_269, v ds
+# define BFI_FLINEAR3_270_TICK(t)
+# define BFI_FLINEAR3_269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_268, v ds
+# define BFI_FLINEAR3_269_TICK(t)
+# define BFI_FLINEAR3_268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_267, v ds
+# define BFI_FLINEAR3_268_TICK(t)
+# define BFI_FLINEAR3_267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_266, v ds
+# define BFI_FLINEAR3_267_TICK(t)
+# define BFI_FLINEAR3_266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_265, v ds
+# define BFI_FLINEAR3_266_TICK(t)
+# define BFI_FLINEAR3_265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_264, v ds
+# define BFI_FLINEAR3_265_TICK(t)
+# define BFI_FLINEAR3_264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_263, v ds
+# define BFI_FLINEAR3_264_TICK(t)
+# define BFI_FLINEAR3_263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_262, v ds
+# define BFI_FLINEAR3_263_TICK(t)
+# define BFI_FLINEAR3_262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_261, v ds
+# define BFI_FLINEAR3_262_TICK(t)
+# define BFI_FLINEAR3_261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_260, v ds
+# define BFI_FLINEAR3_261_TICK(t)
+# define BFI_FLINEAR3_260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_259, v ds
+# define BFI_FLINEAR3_260_TICK(t)
+# define BFI_FLINEAR3_259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_258, v ds
+# define BFI_FLINEAR3_259_TICK(t)
+# define BFI_FLINEAR3_258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_257, v ds
+# define BFI_FLINEAR3_258_TICK(t)
+# define BFI_FLINEAR3_257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_256, v ds
+# define BFI_FLINEAR3_257_TICK(t)
+
+# endif
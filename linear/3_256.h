@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_3_256_H
+# define BFI_LINEAR_3_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR3_256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_255, v ds
+# define BFI_FLINEAR3_256_TICK(t)
+# define BFI_FLINEAR3_255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_254, v ds
+# define BFI_FLINEAR3_255_TICK(t)
+# define BFI_FLINEAR3_254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_253, v ds
+# define BFI_FLINEAR3_254_TICK(t)
+# define BFI_FLINEAR3_253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_252, v ds
+# define BFI_FLINEAR3_253_TICK(t)
+# define BFI_FLINEAR3_252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_251, v ds
+# define BFI_FLINEAR3_252_TICK(t)
+# define BFI_FLINEAR3_251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_250, v ds
+# define BFI_FLINEAR3_251_TICK(t)
+# define BFI_FLINEAR3_250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_249, v ds
+# define BFI_FLINEAR3_250_TICK(t)
+# define BFI_FLINEAR3_249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_248, v ds
+# define BFI_FLINEAR3_249_TICK(t)
+# define BFI_FLINEAR3_248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_247, v ds
+# define BFI_FLINEAR3_248_TICK(t)
+# define BFI_FLINEAR3_247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_246, v ds
+# define BFI_FLINEAR3_247_TICK(t)
+# define BFI_FLINEAR3_246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_245, v ds
+# define BFI_FLINEAR3_246_TICK(t)
+# define BFI_FLINEAR3_245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_244, v ds
+# define BFI_FLINEAR3_245_TICK(t)
+# define BFI_FLINEAR3_244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_243, v ds
+# define BFI_FLINEAR3_244_TICK(t)
+# define BFI_FLINEAR3_243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_242, v ds
+# define BFI_FLINEAR3_243_TICK(t)
+# define BFI_FLINEAR3_242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_241, v ds
+# define BFI_FLINEAR3_242_TICK(t)
+# define BFI_FLINEAR3_241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_240, v ds
+# define BFI_FLINEAR3_241_TICK(t)
+# define BFI_FLINEAR3_240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_239, v ds
+# define BFI_FLINEAR3_240_TICK(t)
+# define BFI_FLINEAR3_239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_238, v ds
+# define BFI_FLINEAR3_239_TICK(t)
+# define BFI_FLINEAR3_238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_237, v ds
+# define BFI_FLINEAR3_238_TICK(t)
+# define BFI_FLINEAR3_237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_236, v ds
+# define BFI_FLINEAR3_237_TICK(t)
+# define BFI_FLINEAR3_236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_235, v ds
+# define BFI_FLINEAR3_236_TICK(t)
+# define BFI_FLINEAR3_235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_234, v ds
+# define BFI_FLINEAR3_235_TICK(t)
+# define BFI_FLINEAR3_234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_233, v ds
+# define BFI_FLINEAR3_234_TICK(t)
+# define BFI_FLINEAR3_233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_232, v ds
+# define BFI_FLINEAR3_233_TICK(t)
+# define BFI_FLINEAR3_232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_231, v ds
+# define BFI_FLINEAR3_232_TICK(t)
+# define BFI_FLINEAR3_231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_230, v ds
+# define BFI_FLINEAR3_231_TICK(t)
+# define BFI_FLINEAR3_230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_229, v ds
+# define BFI_FLINEAR3_230_TICK(t)
+# define BFI_FLINEAR3_229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_228, v ds
+# define BFI_FLINEAR3_229_TICK(t)
+# define BFI_FLINEAR3_228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_227, v ds
+# define BFI_FLINEAR3_228_TICK(t)
+# define BFI_FLINEAR3_227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_226, v ds
+# define BFI_FLINEAR3_227_TICK(t)
+# define BFI_FLINEAR3_226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_225, v ds
+# define BFI_FLINEAR3_226_TICK(t)
+# define BFI_FLINEAR3_225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_224, v ds
+# define BFI_FLINEAR3_225_TICK(t)
+# define BFI_FLINEAR3_224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_223, v ds
+# define BFI_FLINEAR3_224_TICK(t)
+# define BFI_FLINEAR3_223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_222, v ds
+# define BFI_FLINEAR3_223_TICK(t)
+# define BFI_FLINEAR3_222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_221, v ds
+# define BFI_FLINEAR3_222_TICK(t)
+# define BFI_FLINEAR3_221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_220, v ds
+# define BFI_FLINEAR3_221_TICK(t)
+# define BFI_FLINEAR3_220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_219, v ds
+# define BFI_FLINEAR3_220_TICK(t)
+# define BFI_FLINEAR3_219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_218, v ds
+# define BFI_FLINEAR3_219_TICK(t)
+# define BFI_FLINEAR3_218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_217, v ds
+# define BFI_FLINEAR3_218_TICK(t)
+# define BFI_FLINEAR3_217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_216, v ds
+# define BFI_FLINEAR3_217_TICK(t)
+# define BFI_FLINEAR3_216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_215, v ds
+# define BFI_FLINEAR3_216_TICK(t)
+# define BFI_FLINEAR3_215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_214, v ds
+# define BFI_FLINEAR3_215_TICK(t)
+# define BFI_FLINEAR3_214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_213, v ds
+# define BFI_FLINEAR3_214_TICK(t)
+# define BFI_FLINEAR3_213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_212, v ds
+# define BFI_FLINEAR3_213_TICK(t)
+# define BFI_FLINEAR3_212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_211, v ds
+# define BFI_FLINEAR3_212_TICK(t)
+# define BFI_FLINEAR3_211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_210, v ds
+# define BFI_FLINEAR3_211_TICK(t)
+# define BFI_FLINEAR3_210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_209, v ds
+# define BFI_FLINEAR3_210_TICK(t)
+# define BFI_FLINEAR3_209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_208, v ds
+# define BFI_FLINEAR3_209_TICK(t)
+# define BFI_FLINEAR3_208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_207, v ds
+# define BFI_FLINEAR3_208_TICK(t)
+# define BFI_FLINEAR3_207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_206, v ds
+# define BFI_FLINEAR3_207_TICK(t)
+# define BFI_FLINEAR3_206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_205, v ds
+# define BFI_FLINEAR3_206_TICK(t)
+# define BFI_FLINEAR3_205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_204, v ds
+# define BFI_FLINEAR3_205_TICK(t)
+# define BFI_FLINEAR3_204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_203, v ds
+# define BFI_FLINEAR3_204_TICK(t)
+# define BFI_FLINEAR3_203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_202, v ds
+# define BFI_FLINEAR3_203_TICK(t)
+# define BFI_FLINEAR3_202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_201, v ds
+# define BFI_FLINEAR3_202_TICK(t)
+# define BFI_FLINEAR3_201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_200, v ds
+# define BFI_FLINEAR3_201_TICK(t)
+# define BFI_FLINEAR3_200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_199, v ds
+# define BFI_FLINEAR3_200_TICK(t)
+# define BFI_FLINEAR3_199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_198, v ds
+# define BFI_FLINEAR3_199_TICK(t)
+# define BFI_FLINEAR3_198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_197, v ds
+# define BFI_FLINEAR3_198_TICK(t)
+# define BFI_FLINEAR3_197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_196, v ds
+# define BFI_FLINEAR3_197_TICK(t)
+# define BFI_FLINEAR3_196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_195, v ds
+# define BFI_FLINEAR3_196_TICK(t)
+# define BFI_FLINEAR3_195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_194, v ds
+# define BFI_FLINEAR3_195_TICK(t)
+# define BFI_FLINEAR3_194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_193, v ds
+# define BFI_FLINEAR3_194_TICK(t)
+# define BFI_FLINEAR3_193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_192, v ds
+# define BFI_FLINEAR3_193_TICK(t)
+# define BFI_FLINEAR3_192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_191, v ds
+# define BFI_FLINEAR3_192_TICK(t)
+# define BFI_FLINEAR3_191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_190, v ds
+# define BFI_FLINEAR3_191_TICK(t)
+# define BFI_FLINEAR3_190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_189, v ds
+# define BFI_FLINEAR3_190_TICK(t)
+# define BFI_FLINEAR3_189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_188, v ds
+# define BFI_FLINEAR3_189_TICK(t)
+# define BFI_FLINEAR3_188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_187, v ds
+# define BFI_FLINEAR3_188_TICK(t)
+# define BFI_FLINEAR3_187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_186, v ds
+# define BFI_FLINEAR3_187_TICK(t)
+# define BFI_FLINEAR3_186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_185, v ds
+# define BFI_FLINEAR3_186_TICK(t)
+# define BFI_FLINEAR3_185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_184, v ds
+# define BFI_FLINEAR3_185_TICK(t)
+# define BFI_FLINEAR3_184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_183, v ds
+# define BFI_FLINEAR3_184_TICK(t)
+# define BFI_FLINEAR3_183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_182, v ds
+# define BFI_FLINEAR3_183_TICK(t)
+# define BFI_FLINEAR3_182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_181, v ds
+# define BFI_FLINEAR3_182_TICK(t)
+# define BFI_FLINEAR3_181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_180, v ds
+# define BFI_FLINEAR3_181_TICK(t)
+# define BFI_FLINEAR3_180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_179, v ds
+# define BFI_FLINEAR3_180_TICK(t)
+# define BFI_FLINEAR3_179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_178, v ds
+# define BFI_FLINEAR3_179_TICK(t)
+# define BFI_FLINEAR3_178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_177, v ds
+# define BFI_FLINEAR3_178_TICK(t)
+# define BFI_FLINEAR3_177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_176, v ds
+# define BFI_FLINEAR3_177_TICK(t)
+# define BFI_FLINEAR3_176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_175, v ds
+# define BFI_FLINEAR3_176_TICK(t)
+# define BFI_FLINEAR3_175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_174, v ds
+# define BFI_FLINEAR3_175_TICK(t)
+# define BFI_FLINEAR3_174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_173, v ds
+# define BFI_FLINEAR3_174_TICK(t)
+# define BFI_FLINEAR3_173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_172, v ds
+# define BFI_FLINEAR3_173_TICK(t)
+# define BFI_FLINEAR3_172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_171, v ds
+# define BFI_FLINEAR3_172_TICK(t)
+# define BFI_FLINEAR3_171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_170, v ds
+# define BFI_FLINEAR3_171_TICK(t)
+# define BFI_FLINEAR3_170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_169, v ds
+# define BFI_FLINEAR3_170_TICK(t)
+# define BFI_FLINEAR3_169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_168, v ds
+# define BFI_FLINEAR3_169_TICK(t)
+# define BFI_FLINEAR3_168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_167, v ds
+# define BFI_FLINEAR3_168_TICK(t)
+# define BFI_FLINEAR3_167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_166, v ds
+# define BFI_FLINEAR3_167_TICK(t)
+# define BFI_FLINEAR3_166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_165, v ds
+# define BFI_FLINEAR3_166_TICK(t)
+# define BFI_FLINEAR3_165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_164, v ds
+# define BFI_FLINEAR3_165_TICK(t)
+# define BFI_FLINEAR3_164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_163, v ds
+# define BFI_FLINEAR3_164_TICK(t)
+# define BFI_FLINEAR3_163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_162, v ds
+# define BFI_FLINEAR3_163_TICK(t)
+# define BFI_FLINEAR3_162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_161, v ds
+# define BFI_FLINEAR3_162_TICK(t)
+# define BFI_FLINEAR3_161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_160, v ds
+# define BFI_FLINEAR3_161_TICK(t)
+# define BFI_FLINEAR3_160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_159, v ds
+# define BFI_FLINEAR3_160_TICK(t)
+# define BFI_FLINEAR3_159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_158, v ds
+# define BFI_FLINEAR3_159_TICK(t)
+# define BFI_FLINEAR3_158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_157, v ds
+# define BFI_FLINEAR3_158_TICK(t)
+# define BFI_FLINEAR3_157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_156, v ds
+# define BFI_FLINEAR3_157_TICK(t)
+# define BFI_FLINEAR3_156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_155, v ds
+# define BFI_FLINEAR3_156_TICK(t)
+# define BFI_FLINEAR3_155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_154, v ds
+# define BFI_FLINEAR3_155_TICK(t)
+# define BFI_FLINEAR3_154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_153, v ds
+# define BFI_FLINEAR3_154_TICK(t)
+# define BFI_FLINEAR3_153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_152, v ds
+# define BFI_FLINEAR3_153_TICK(t)
+# define BFI_FLINEAR3_152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_151, v ds
+# define BFI_FLINEAR3_152_TICK(t)
+# define BFI_FLINEAR3_151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_150, v ds
+# define BFI_FLINEAR3_151_TICK(t)
+# define BFI_FLINEAR3_150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_149, v ds
+# define BFI_FLINEAR3_150_TICK(t)
+# define BFI_FLINEAR3_149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_148, v ds
+# define BFI_FLINEAR3_149_TICK(t)
+# define BFI_FLINEAR3_148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_147, v ds
+# define BFI_FLINEAR3_148_TICK(t)
+# define BFI_FLINEAR3_147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_146, v ds
+# define BFI_FLINEAR3_147_TICK(t)
+# define BFI_FLINEAR3_146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_145, v ds
+# define BFI_FLINEAR3_146_TICK(t)
+# define BFI_FLINEAR3_145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_144, v ds
+# define BFI_FLINEAR3_145_TICK(t)
+# define BFI_FLINEAR3_144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_143, v ds
+# define BFI_FLINEAR3_144_TICK(t)
+# define BFI_FLINEAR3_143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_142, v ds
+# define BFI_FLINEAR3_143_TICK(t)
+# define BFI_FLINEAR3_142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_141, v ds
+# define BFI_FLINEAR3_142_TICK(t)
+# define BFI_FLINEAR3_141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_140, v ds
+# define BFI_FLINEAR3_141_TICK(t)
+# define BFI_FLINEAR3_140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_139, v ds
+# define BFI_FLINEAR3_140_TICK(t)
+# define BFI_FLINEAR3_139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_138, v ds
+# define BFI_FLINEAR3_139_TICK(t)
+# define BFI_FLINEAR3_138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_137, v ds
+# define BFI_FLINEAR3_138_TICK(t)
+# define BFI_FLINEAR3_137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_136, v ds
+# define BFI_FLINEAR3_137_TICK(t)
+# define BFI_FLINEAR3_136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_135, v ds
+# define BFI_FLINEAR3_136_TICK(t)
+# define BFI_FLINEAR3_135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_134, v ds
+# define BFI_FLINEAR3_135_TICK(t)
+# define BFI_FLINEAR3_134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_133, v ds
+# define BFI_FLINEAR3_134_TICK(t)
+# define BFI_FLINEAR3_133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_132, v ds
+# define BFI_FLINEAR3_133_TICK(t)
+# define BFI_FLINEAR3_132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_131, v ds
+# define BFI_FLINEAR3_132_TICK(t)
+# define BFI_FLINEAR3_131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_130, v ds
+# define BFI_FLINEAR3_131_TICK(t)
+# define BFI_FLINEAR3_130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_129, v ds
+# define BFI_FLINEAR3_130_TICK(t)
+# define BFI_FLINEAR3_129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_128, v ds
+# define BFI_FLINEAR3_129_TICK(t)
+# define BFI_FLINEAR3_128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_127, v ds
+# define BFI_FLINEAR3_128_TICK(t)
+# define BFI_FLINEAR3_127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_126, v ds
+# define BFI_FLINEAR3_127_TICK(t)
+# define BFI_FLINEAR3_126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_125, v ds
+# define BFI_FLINEAR3_126_TICK(t)
+# define BFI_FLINEAR3_125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_124, v ds
+# define BFI_FLINEAR3_125_TICK(t)
+# define BFI_FLINEAR3_124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_123, v ds
+# define BFI_FLINEAR3_124_TICK(t)
+# define BFI_FLINEAR3_123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_122, v ds
+# define BFI_FLINEAR3_123_TICK(t)
+# define BFI_FLINEAR3_122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_121, v ds
+# define BFI_FLINEAR3_122_TICK(t)
+# define BFI_FLINEAR3_121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_120, v ds
+# define BFI_FLINEAR3_121_TICK(t)
+# define BFI_FLINEAR3_120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_119, v ds
+# define BFI_FLINEAR3_120_TICK(t)
+# define BFI_FLINEAR3_119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_118, v ds
+# define BFI_FLINEAR3_119_TICK(t)
+# define BFI_FLINEAR3_118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_117, v ds
+# define BFI_FLINEAR3_118_TICK(t)
+# define BFI_FLINEAR3_117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_116, v ds
+# define BFI_FLINEAR3_117_TICK(t)
+# define BFI_FLINEAR3_116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_115, v ds
+# define BFI_FLINEAR3_116_TICK(t)
+# define BFI_FLINEAR3_115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_114, v ds
+# define BFI_FLINEAR3_115_TICK(t)
+# define BFI_FLINEAR3_114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_113, v ds
+# define BFI_FLINEAR3_114_TICK(t)
+# define BFI_FLINEAR3_113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_112, v ds
+# define BFI_FLINEAR3_113_TICK(t)
+# define BFI_FLINEAR3_112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_111, v ds
+# define BFI_FLINEAR3_112_TICK(t)
+# define BFI_FLINEAR3_111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_110, v ds
+# define BFI_FLINEAR3_111_TICK(t)
+# define BFI_FLINEAR3_110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_109, v ds
+# define BFI_FLINEAR3_110_TICK(t)
+# define BFI_FLINEAR3_109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_108, v ds
+# define BFI_FLINEAR3_109_TICK(t)
+# define BFI_FLINEAR3_108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_107, v ds
+# define BFI_FLINEAR3_108_TICK(t)
+# define BFI_FLINEAR3_107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_106, v ds
+# define BFI_FLINEAR3_107_TICK(t)
+# define BFI_FLINEAR3_106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_105, v ds
+# define BFI_FLINEAR3_106_TICK(t)
+# define BFI_FLINEAR3_105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_104, v ds
+# define BFI_FLINEAR3_105_TICK(t)
+# define BFI_FLINEAR3_104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_103, v ds
+# define BFI_FLINEAR3_104_TICK(t)
+# define BFI_FLINEAR3_103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_102, v ds
+# define BFI_FLINEAR3_103_TICK(t)
+# define BFI_FLINEAR3_102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_101, v ds
+# define BFI_FLINEAR3_102_TICK(t)
+# define BFI_FLINEAR3_101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_100, v ds
+# define BFI_FLINEAR3_101_TICK(t)
+# define BFI_FLINEAR3_100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_99, v ds
+# define BFI_FLINEAR3_100_TICK(t)
+# define BFI_FLINEAR3_99(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_98, v ds
+# define BFI_FLINEAR3_99_TICK(t)
+# define BFI_FLINEAR3_98(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_97, v ds
+# define BFI_FLINEAR3_98_TICK(t)
+# define BFI_FLINEAR3_97(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_96, v ds
+# define BFI_FLINEAR3_97_TICK(t)
+# define BFI_FLINEAR3_96(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_95, v ds
+# define BFI_FLINEAR3_96_TICK(t)
+# define BFI_FLINEAR3_95(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_94, v ds
+# define BFI_FLINEAR3_95_TICK(t)
+# define BFI_FLINEAR3_94(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_93, v ds
+# define BFI_FLINEAR3_94_TICK(t)
+# define BFI_FLINEAR3_93(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_92, v ds
+# define BFI_FLINEAR3_93_TICK(t)
+# define BFI_FLINEAR3_92(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_91, v ds
+# define BFI_FLINEAR3_92_TICK(t)
+# define BFI_FLINEAR3_91(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_90, v ds
+# define BFI_FLINEAR3_91_TICK(t)
+# define BFI_FLINEAR3_90(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_89, v ds
+# define BFI_FLINEAR3_90_TICK(t)
+# define BFI_FLINEAR3_89(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_88, v ds
+# define BFI_FLINEAR3_89_TICK(t)
+# define BFI_FLINEAR3_88(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_87, v ds
+# define BFI_FLINEAR3_88_TICK(t)
+# define BFI_FLINEAR3_87(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_86, v ds
+# define BFI_FLINEAR3_87_TICK(t)
+# define BFI_FLINEAR3_86(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_85, v ds
+# define BFI_FLINEAR3_86_TICK(t)
+# define BFI_FLINEAR3_85(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_84, v ds
+# define BFI_FLINEAR3_85_TICK(t)
+# define BFI_FLINEAR3_84(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_83, v ds
+# define BFI_FLINEAR3_84_TICK(t)
+# define BFI_FLINEAR3_83(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_82, v ds
+# define BFI_FLINEAR3_83_TICK(t)
+# define BFI_FLINEAR3_82(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_81, v ds
+# define BFI_FLINEAR3_82_TICK(t)
+# define BFI_FLINEAR3_81(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_80, v ds
+# define BFI_FLINEAR3_81_TICK(t)
+# define BFI_FLINEAR3_80(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_79, v ds
+# define BFI_FLINEAR3_80_TICK(t)
+# define BFI_FLINEAR3_79(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_78, v ds
+# define BFI_FLINEAR3_79_TICK(t)
+# define BFI_FLINEAR3_78(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_77, v ds
+# define BFI_FLINEAR3_78_TICK(t)
+# define BFI_FLINEAR3_77(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_76, v ds
+# define BFI_FLINEAR3_77_TICK(t)
+# define BFI_FLINEAR3_76(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_75, v ds
+# define BFI_FLINEAR3_76_TICK(t)
+# define BFI_FLINEAR3_75(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_74, v ds
+# define BFI_FLINEAR3_75_TICK(t)
+# define BFI_FLINEAR3_74(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_73, v ds
+# define BFI_FLINEAR3_74_TICK(t)
+# define BFI_FLINEAR3_73(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_72, v ds
+# define BFI_FLINEAR3_73_TICK(t)
+# define BFI_FLINEAR3_72(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_71, v ds
+# define BFI_FLINEAR3_72_TICK(t)
+# define BFI_FLINEAR3_71(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_70, v ds
+# define BFI_FLINEAR3_71_TICK(t)
+# define BFI_FLINEAR3_70(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_69, v ds
+# define BFI_FLINEAR3_70_TICK(t)
+# define BFI_FLINEAR3_69(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_68, v ds
+# define BFI_FLINEAR3_69_TICK(t)
+# define BFI_FLINEAR3_68(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_67, v ds
+# define BFI_FLINEAR3_68_TICK(t)
+# define BFI_FLINEAR3_67(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_66, v ds
+# define BFI_FLINEAR3_67_TICK(t)
+# define BFI_FLINEAR3_66(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_65, v ds
+# define BFI_FLINEAR3_66_TICK(t)
+# define BFI_FLINEAR3_65(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_64, v ds
+# define BFI_FLINEAR3_65_TICK(t)
+
+# endif
@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_3_4096_H
+# define BFI_LINEAR_3_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR3_4096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4095, v ds
+# define BFI_FLINEAR3_4096_TICK(t)
+# define BFI_FLINEAR3_4095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4094, v ds
+# define BFI_FLINEAR3_4095_TICK(t)
+# define BFI_FLINEAR3_4094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4093, v ds
+# define BFI_FLINEAR3_4094_TICK(t)
+# define BFI_FLINEAR3_4093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4092, v ds
+# define BFI_FLINEAR3_4093_TICK(t)
+# define BFI_FLINEAR3_4092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4091, v ds
+# define BFI_FLINEAR3_4092_TICK(t)
+# define BFI_FLINEAR3_4091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4090, v ds
+# define BFI_FLINEAR3_4091_TICK(t)
+# define BFI_FLINEAR3_4090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4089, v ds
+# define BFI_FLINEAR3_4090_TICK(t)
+# define BFI_FLINEAR3_4089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4088, v ds
+# define BFI_FLINEAR3_4089_TICK(t)
+# define BFI_FLINEAR3_4088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4087, v ds
+# define BFI_FLINEAR3_4088_TICK(t)
+# define BFI_FLINEAR3_4087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4086, v ds
+# define BFI_FLINEAR3_4087_TICK(t)
+# define BFI_FLINEAR3_4086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4085, v ds
+# define BFI_FLINEAR3_4086_TICK(t)
+# define BFI_FLINEAR3_4085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4084, v ds
+# define BFI_FLINEAR3_4085_TICK(t)
+# define BFI_FLINEAR3_4084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4083, v ds
+# define BFI_FLINEAR3_4084_TICK(t)
+# define BFI_FLINEAR3_4083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4082, v ds
+# define BFI_FLINEAR3_4083_TICK(t)
+# define BFI_FLINEAR3_4082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4081, v ds
+# define BFI_FLINEAR3_4082_TICK(t)
+# define BFI_FLINEAR3_4081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4080, v ds
+# define BFI_FLINEAR3_4081_TICK(t)
+# define BFI_FLINEAR3_4080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4079, v ds
+# define BFI_FLINEAR3_4080_TICK(t)
+# define BFI_FLINEAR3_4079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4078, v ds
+# define BFI_FLINEAR3_4079_TICK(t)
+# define BFI_FLINEAR3_4078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4077, v ds
+# define BFI_FLINEAR3_4078_TICK(t)
+# define BFI_FLINEAR3_4077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4076, v ds
+# define BFI_FLINEAR3_4077_TICK(t)
+# define BFI_FLINEAR3_4076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4075, v ds
+# define BFI_FLINEAR3_4076_TICK(t)
+# define BFI_FLINEAR3_4075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4074, v ds
+# define BFI_FLINEAR3_4075_TICK(t)
+# define BFI_FLINEAR3_4074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4073, v ds
+# define BFI_FLINEAR3_4074_TICK(t)
+# define BFI_FLINEAR3_4073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4072, v ds
+# define BFI_FLINEAR3_4073_TICK(t)
+# define BFI_FLINEAR3_4072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4071, v ds
+# define BFI_FLINEAR3_4072_TICK(t)
+# define BFI_FLINEAR3_4071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4070, v ds
+# define BFI_FLINEAR3_4071_TICK(t)
+# define BFI_FLINEAR3_4070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4069, v ds
+# define BFI_FLINEAR3_4070_TICK(t)
+# define BFI_FLINEAR3_4069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4068, v ds
+# define BFI_FLINEAR3_4069_TICK(t)
+# define BFI_FLINEAR3_4068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4067, v ds
+# define BFI_FLINEAR3_4068_TICK(t)
+# define BFI_FLINEAR3_4067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4066, v ds
+# define BFI_FLINEAR3_4067_TICK(t)
+# define BFI_FLINEAR3_4066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4065, v ds
+# define BFI_FLINEAR3_4066_TICK(t)
+# define BFI_FLINEAR3_4065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4064, v ds
+# define BFI_FLINEAR3_4065_TICK(t)
+# define BFI_FLINEAR3_4064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4063, v ds
+# define BFI_FLINEAR3_4064_TICK(t)
+# define BFI_FLINEAR3_4063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4062, v ds
+# define BFI_FLINEAR3_4063_TICK(t)
+# define BFI_FLINEAR3_4062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4061, v ds
+# define BFI_FLINEAR3_4062_TICK(t)
+# define BFI_FLINEAR3_4061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4060, v ds
+# define BFI_FLINEAR3_4061_TICK(t)
+# define BFI_FLINEAR3_4060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4059, v ds
+# define BFI_FLINEAR3_4060_TICK(t)
+# define BFI_FLINEAR3_4059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4058, v ds
+# define BFI_FLINEAR3_4059_TICK(t)
+# define BFI_FLINEAR3_4058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4057, v ds
+# define BFI_FLINEAR3_4058_TICK(t)
+# define BFI_FLINEAR3_4057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4056, v ds
+# define BFI_FLINEAR3_4057_TICK(t)
+# define BFI_FLINEAR3_4056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4055, v ds
+# define BFI_FLINEAR3_4056_TICK(t)
+# define BFI_FLINEAR3_4055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4054, v ds
+# define BFI_FLINEAR3_4055_TICK(t)
+# define BFI_FLINEAR3_4054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4053, v ds
+# define BFI_FLINEAR3_4054_TICK(t)
+# define BFI_FLINEAR3_4053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4052, v ds
+# define BFI_FLINEAR3_4053_TICK(t)
+# define BFI_FLINEAR3_4052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4051, v ds
+# define BFI_FLINEAR3_4052_TICK(t)
+# define BFI_FLINEAR3_4051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4050, v ds
+# define BFI_FLINEAR3_4051_TICK(t)
+# define BFI_FLINEAR3_4050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4049, v ds
+# define BFI_FLINEAR3_4050_TICK(t)
+# define BFI_FLINEAR3_4049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4048, v ds
+# define BFI_FLINEAR3_4049_TICK(t)
+# define BFI_FLINEAR3_4048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4047, v ds
+# define BFI_FLINEAR3_4048_TICK(t)
+# define BFI_FLINEAR3_4047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4046, v ds
+# define BFI_FLINEAR3_4047_TICK(t)
+# define BFI_FLINEAR3_4046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4045, v ds
+# define BFI_FLINEAR3_4046_TICK(t)
+# define BFI_FLINEAR3_4045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4044, v ds
+# define BFI_FLINEAR3_4045_TICK(t)
+# define BFI_FLINEAR3_4044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4043, v ds
+# define BFI_FLINEAR3_4044_TICK(t)
+# define BFI_FLINEAR3_4043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4042, v ds
+# define BFI_FLINEAR3_4043_TICK(t)
+# define BFI_FLINEAR3_4042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4041, v ds
+# define BFI_FLINEAR3_4042_TICK(t)
+# define BFI_FLINEAR3_4041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4040, v ds
+# define BFI_FLINEAR3_4041_TICK(t)
+# define BFI_FLINEAR3_4040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4039, v ds
+# define BFI_FLINEAR3_4040_TICK(t)
+# define BFI_FLINEAR3_4039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4038, v ds
+# define BFI_FLINEAR3_4039_TICK(t)
+# define BFI_FLINEAR3_4038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4037, v ds
+# define BFI_FLINEAR3_4038_TICK(t)
+# define BFI_FLINEAR3_4037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4036, v ds
+# define BFI_FLINEAR3_4037_TICK(t)
+# define BFI_FLINEAR3_4036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4035, v ds
+# define BFI_FLINEAR3_4036_TICK(t)
+# define BFI_FLINEAR3_4035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4034, v ds
+# define BFI_FLINEAR3_4035_TICK(t)
+# define BFI_FLINEAR3_4034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4033, v ds
+# define BFI_FLINEAR3_4034_TICK(t)
+# define BFI_FLINEAR3_4033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4032, v ds
+# define BFI_FLINEAR3_4033_TICK(t)
+# define BFI_FLINEAR3_4032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4031, v ds
+# define BFI_FLINEAR3_4032_TICK(t)
+# define BFI_FLINEAR3_4031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4030, v ds
+# define BFI_FLINEAR3_4031_TICK(t)
+# define BFI_FLINEAR3_4030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4029, v ds
+# define BFI_FLINEAR3_4030_TICK(t)
+# define BFI_FLINEAR3_4029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4028, v ds
+# define BFI_FLINEAR3_4029_TICK(t)
+# define BFI_FLINEAR3_4028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4027, v ds
+# define BFI_FLINEAR3_4028_TICK(t)
+# define BFI_FLINEAR3_4027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4026, v ds
+# define BFI_FLINEAR3_4027_TICK(t)
+# define BFI_FLINEAR3_4026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4025, v ds
+# define BFI_FLINEAR3_4026_TICK(t)
+# define BFI_FLINEAR3_4025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4024, v ds
+# define BFI_FLINEAR3_4025_TICK(t)
+# define BFI_FLINEAR3_4024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4023, v ds
+# define BFI_FLINEAR3_4024_TICK(t)
+# define BFI_FLINEAR3_4023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4022, v ds
+# define BFI_FLINEAR3_4023_TICK(t)
+# define BFI_FLINEAR3_4022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4021, v ds
+# define BFI_FLINEAR3_4022_TICK(t)
+# define BFI_FLINEAR3_4021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4020, v ds
+# define BFI_FLINEAR3_4021_TICK(t)
+# define BFI_FLINEAR3_4020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4019, v ds
+# define BFI_FLINEAR3_4020_TICK(t)
+# define BFI_FLINEAR3_4019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4018, v ds
+# define BFI_FLINEAR3_4019_TICK(t)
+# define BFI_FLINEAR3_4018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4017, v ds
+# define BFI_FLINEAR3_4018_TICK(t)
+# define BFI_FLINEAR3_4017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4016, v ds
+# define BFI_FLINEAR3_4017_TICK(t)
+# define BFI_FLINEAR3_4016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4015, v ds
+# define BFI_FLINEAR3_4016_TICK(t)
+# define BFI_FLINEAR3_4015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4014, v ds
+# define BFI_FLINEAR3_4015_TICK(t)
+# define BFI_FLINEAR3_4014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4013, v ds
+# define BFI_FLINEAR3_4014_TICK(t)
+# define BFI_FLINEAR3_4013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4012, v ds
+# define BFI_FLINEAR3_4013_TICK(t)
+# define BFI_FLINEAR3_4012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4011, v ds
+# define BFI_FLINEAR3_4012_TICK(t)
+# define BFI_FLINEAR3_4011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4010, v ds
+# define BFI_FLINEAR3_4011_TICK(t)
+# define BFI_FLINEAR3_4010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4009, v ds
+# define BFI_FLINEAR3_4010_TICK(t)
+# define BFI_FLINEAR3_4009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4008, v ds
+# define BFI_FLINEAR3_4009_TICK(t)
+# define BFI_FLINEAR3_4008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4007, v ds
+# define BFI_FLINEAR3_4008_TICK(t)
+# define BFI_FLINEAR3_4007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4006, v ds
+# define BFI_FLINEAR3_4007_TICK(t)
+# define BFI_FLINEAR3_4006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4005, v ds
+# define BFI_FLINEAR3_4006_TICK(t)
+# define BFI_FLINEAR3_4005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4004, v ds
+# define BFI_FLINEAR3_4005_TICK(t)
+# define BFI_FLINEAR3_4004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4003, v ds
+# define BFI_FLINEAR3_4004_TICK(t)
+# define BFI_FLINEAR3_4003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4002, v ds
+# define BFI_FLINEAR3_4003_TICK(t)
+# define BFI_FLINEAR3_4002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4001, v ds
+# define BFI_FLINEAR3_4002_TICK(t)
+# define BFI_FLINEAR3_4001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4000, v ds
+# define BFI_FLINEAR3_4001_TICK(t)
+# define BFI_FLINEAR3_4000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3999, v ds
+# define BFI_FLINEAR3_4000_TICK(t)
+# define BFI_FLINEAR3_3999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3998, v ds
+# define BFI_FLINEAR3_3999_TICK(t)
+# define BFI_FLINEAR3_3998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3997, v ds
+# define BFI_FLINEAR3_3998_TICK(t)
+# define BFI_FLINEAR3_3997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3996, v ds
+# define BFI_FLINEAR3_3997_TICK(t)
+# define BFI_FLINEAR3_3996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3995, v ds
+# define BFI_FLINEAR3_3996_TICK(t)
+# define BFI_FLINEAR3_3995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3994, v ds
+# define BFI_FLINEAR3_3995_TICK(t)
+# define BFI_FLINEAR3_3994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3993, v ds
+# define BFI_FLINEAR3_3994_TICK(t)
+# define BFI_FLINEAR3_3993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3992, v ds
+# define BFI_FLINEAR3_3993_TICK(t)
+# define BFI_FLINEAR3_3992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3991, v ds
+# define BFI_FLINEAR3_3992_TICK(t)
+# define BFI_FLINEAR3_3991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3990, v ds
+# define BFI_FLINEAR3_3991_TICK(t)
+# define BFI_FLINEAR3_3990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3989, v ds
+# define BFI_FLINEAR3_3990_TICK(t)
+# define BFI_FLINEAR3_3989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3988, v ds
+# define BFI_FLINEAR3_3989_TICK(t)
+# define BFI_FLINEAR3_3988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3987, v ds
+# define BFI_FLINEAR3_3988_TICK(t)
+# define BFI_FLINEAR3_3987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3986, v ds
+# define BFI_FLINEAR3_3987_TICK(t)
+# define BFI_FLINEAR3_3986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3985, v ds
+# define BFI_FLINEAR3_3986_TICK(t)
+# define BFI_FLINEAR3_3985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3984, v ds
+# define BFI_FLINEAR3_3985_TICK(t)
+# define BFI_FLINEAR3_3984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3983, v ds
+# define BFI_FLINEAR3_3984_TICK(t)
+# define BFI_FLINEAR3_3983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3982, v ds
+# define BFI_FLINEAR3_3983_TICK(t)
+# define BFI_FLINEAR3_3982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3981, v ds
+# define BFI_FLINEAR3_3982_TICK(t)
+# define BFI_FLINEAR3_3981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3980, v ds
+# define BFI_FLINEAR3_3981_TICK(t)
+# define BFI_FLINEAR3_3980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3979, v ds
+# define BFI_FLINEAR3_3980_TICK(t)
+# define BFI_FLINEAR3_3979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3978, v ds
+# define BFI_FLINEAR3_3979_TICK(t)
+# define BFI_FLINEAR3_3978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3977, v ds
+# define BFI_FLINEAR3_3978_TICK(t)
+# define BFI_FLINEAR3_3977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3976, v ds
+# define BFI_FLINEAR3_3977_TICK(t)
+# define BFI_FLINEAR3_3976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3975, v ds
+# define BFI_FLINEAR3_3976_TICK(t)
+# define BFI_FLINEAR3_3975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3974, v ds
+# define BFI_FLINEAR3_3975_TICK(t)
+# define BFI_FLINEAR3_3974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3973, v ds
+# define BFI_FLINEAR3_3974_TICK(t)
+# define BFI_FLINEAR3_3973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3972, v ds
+# define BFI_FLINEAR3_3973_TICK(t)
+# define BFI_FLINEAR3_3972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3971, v ds
+# define BFI_FLINEAR3_3972_TICK(t)
+# define BFI_FLINEAR3_3971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3970, v ds
+# define BFI_FLINEAR3_3971_TICK(t)
+# define BFI_FLINEAR3_3970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3969, v ds
+# define BFI_FLINEAR3_3970_TICK(t)
+# define BFI_FLINEAR3_3969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3968, v ds
+# define BFI_FLINEAR3_3969_TICK(t)
+# define BFI_FLINEAR3_3968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3967, v ds
+# define BFI_FLINEAR3_3968_TICK(t)
+# define BFI_FLINEAR3_3967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3966, v ds
+# define BFI_FLINEAR3_3967_TICK(t)
+# define BFI_FLINEAR3_3966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3965, v ds
+# define BFI_FLINEAR3_3966_TICK(t)
+# define BFI_FLINEAR3_3965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3964, v ds
+# define BFI_FLINEAR3_3965_TICK(t)
+# define BFI_FLINEAR3_3964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3963, v ds
+# define BFI_FLINEAR3_3964_TICK(t)
+# define BFI_FLINEAR3_3963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3962, v ds
+# define BFI_FLINEAR3_3963_TICK(t)
+# define BFI_FLINEAR3_3962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3961, v ds
+# define BFI_FLINEAR3_3962_TICK(t)
+# define BFI_FLINEAR3_3961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3960, v ds
+# define BFI_FLINEAR3_3961_TICK(t)
+# define BFI_FLINEAR3_3960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3959, v ds
+# define BFI_FLINEAR3_3960_TICK(t)
+# define BFI_FLINEAR3_3959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3958, v ds
+# define BFI_FLINEAR3_3959_TICK(t)
+# define BFI_FLINEAR3_3958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3957, v ds
+# define BFI_FLINEAR3_3958_TICK(t)
+# define BFI_FLINEAR3_3957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3956, v ds
+# define BFI_FLINEAR3_3957_TICK(t)
+# define BFI_FLINEAR3_3956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3955, v ds
+# define BFI_FLINEAR3_3956_TICK(t)
+# define BFI_FLINEAR3_3955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3954, v ds
+# define BFI_FLINEAR3_3955_TICK(t)
+# define BFI_FLINEAR3_3954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3953, v ds
+# define BFI_FLINEAR3_3954_TICK(t)
+# define BFI_FLINEAR3_3953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3952, v ds
+# define BFI_FLINEAR3_3953_TICK(t)
+# define BFI_FLINEAR3_3952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3951, v ds
+# define BFI_FLINEAR3_3952_TICK(t)
+# define BFI_FLINEAR3_3951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3950, v ds
+# define BFI_FLINEAR3_3951_TICK(t)
+# define BFI_FLINEAR3_3950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3949, v ds
+# define BFI_FLINEAR3_3950_TICK(t)
+# define BFI_FLINEAR3_3949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3948, v ds
+# define BFI_FLINEAR3_3949_TICK(t)
+# define BFI_FLINEAR3_3948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3947, v ds
+# define BFI_FLINEAR3_3948_TICK(t)
+# define BFI_FLINEAR3_3947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3946, v ds
+# define BFI_FLINEAR3_3947_TICK(t)
+# define BFI_FLINEAR3_3946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3945, v ds
+# define BFI_FLINEAR3_3946_TICK(t)
+# define BFI_FLINEAR3_3945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3944, v ds
+# define BFI_FLINEAR3_3945_TICK(t)
+# define BFI_FLINEAR3_3944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3943, v ds
+# define BFI_FLINEAR3_3944_TICK(t)
+# define BFI_FLINEAR3_3943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3942, v ds
+# define BFI_FLINEAR3_3943_TICK(t)
+# define BFI_FLINEAR3_3942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3941, v ds
+# define BFI_FLINEAR3_3942_TICK(t)
+# define BFI_FLINEAR3_3941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3940, v ds
+# define BFI_FLINEAR3_3941_TICK(t)
+# define BFI_FLINEAR3_3940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3939, v ds
+# define BFI_FLINEAR3_3940_TICK(t)
+# define BFI_FLINEAR3_3939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3938, v ds
+# define BFI_FLINEAR3_3939_TICK(t)
+# define BFI_FLINEAR3_3938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3937, v ds
+# define BFI_FLINEAR3_3938_TICK(t)
+# define BFI_FLINEAR3_3937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3936, v ds
+# define BFI_FLINEAR3_3937_TICK(t)
+# define BFI_FLINEAR3_3936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3935, v ds
+# define BFI_FLINEAR3_3936_TICK(t)
+# define BFI_FLINEAR3_3935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3934, v ds
+# define BFI_FLINEAR3_3935_TICK(t)
+# define BFI_FLINEAR3_3934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3933, v ds
+# define BFI_FLINEAR3_3934_TICK(t)
+# define BFI_FLINEAR3_3933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3932, v ds
+# define BFI_FLINEAR3_3933_TICK(t)
+# define BFI_FLINEAR3_3932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3931, v ds
+# define BFI_FLINEAR3_3932_TICK(t)
+# define BFI_FLINEAR3_3931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3930, v ds
+# define BFI_FLINEAR3_3931_TICK(t)
+# define BFI_FLINEAR3_3930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3929, v ds
+# define BFI_FLINEAR3_3930_TICK(t)
+# define BFI_FLINEAR3_3929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3928, v ds
+# define BFI_FLINEAR3_3929_TICK(t)
+# define BFI_FLINEAR3_3928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3927, v ds
+# define BFI_FLINEAR3_3928_TICK(t)
+# define BFI_FLINEAR3_3927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3926, v ds
+# define BFI_FLINEAR3_3927_TICK(t)
+# define BFI_FLINEAR3_3926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3925, v ds
+# define BFI_FLINEAR3_3926_TICK(t)
+# define BFI_FLINEAR3_3925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3924, v ds
+# define BFI_FLINEAR3_3925_TICK(t)
+# define BFI_FLINEAR3_3924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3923, v ds
+# define BFI_FLINEAR3_3924_TICK(t)
+# define BFI_FLINEAR3_3923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3922, v ds
+# define BFI_FLINEAR3_3923_TICK(t)
+# define BFI_FLINEAR3_3922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3921, v ds
+# define BFI_FLINEAR3_3922_TICK(t)
+# define BFI_FLINEAR3_3921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3920, v ds
+# define BFI_FLINEAR3_3921_TICK(t)
+# define BFI_FLINEAR3_3920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3919, v ds
+# define BFI_FLINEAR3_3920_TICK(t)
+# define BFI_FLINEAR3_3919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3918, v ds
+# define BFI_FLINEAR3_3919_TICK(t)
+# define BFI_FLINEAR3_3918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3917, v ds
+# define BFI_FLINEAR3_3918_TICK(t)
+# define BFI_FLINEAR3_3917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3916, v ds
+# define BFI_FLINEAR3_3917_TICK(t)
+# define BFI_FLINEAR3_3916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3915, v ds
+# define BFI_FLINEAR3_3916_TICK(t)
+# define BFI_FLINEAR3_3915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3914, v ds
+# define BFI_FLINEAR3_3915_TICK(t)
+# define BFI_FLINEAR3_3914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3913, v ds
+# define BFI_FLINEAR3_3914_TICK(t)
+# define BFI_FLINEAR3_3913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3912, v ds
+# define BFI_FLINEAR3_3913_TICK(t)
+# define BFI_FLINEAR3_3912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3911, v ds
+# define BFI_FLINEAR3_3912_TICK(t)
+# define BFI_FLINEAR3_3911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3910, v ds
+# define BFI_FLINEAR3_3911_TICK(t)
+# define BFI_FLINEAR3_3910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3909, v ds
+# define BFI_FLINEAR3_3910_TICK(t)
+# define BFI_FLINEAR3_3909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3908, v ds
+# define BFI_FLINEAR3_3909_TICK(t)
+# define BFI_FLINEAR3_3908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3907, v ds
+# define BFI_FLINEAR3_3908_TICK(t)
+# define BFI_FLINEAR3_3907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3906, v ds
+# define BFI_FLINEAR3_3907_TICK(t)
+# define BFI_FLINEAR3_3906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3905, v ds
+# define BFI_FLINEAR3_3906_TICK(t)
+# define BFI_FLINEAR3_3905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3904, v ds
+# define BFI_FLINEAR3_3905_TICK(t)
+# define BFI_FLINEAR3_3904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3903, v ds
+# define BFI_FLINEAR3_3904_TICK(t)
+# define BFI_FLINEAR3_3903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3902, v ds
+# define BFI_FLINEAR3_3903_TICK(t)
+# define BFI_FLINEAR3_3902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3901, v ds
+# define BFI_FLINEAR3_3902_TICK(t)
+# define BFI_FLINEAR3_3901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3900, v ds
+# define BFI_FLINEAR3_3901_TICK(t)
+# define BFI_FLINEAR3_3900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3899, v ds
+# define BFI_FLINEAR3_3900_TICK(t)
+# define BFI_FLINEAR3_3899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3898, v ds
+# define BFI_FLINEAR3_3899_TICK(t)
+# define BFI_FLINEAR3_3898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3897, v ds
+# define BFI_FLINEAR3_3898_TICK(t)
+# define BFI_FLINEAR3_3897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3896, v ds
+# define BFI_FLINEAR3_3897_TICK(t)
+# define BFI_FLINEAR3_3896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3895, v ds
+# define BFI_FLINEAR3_3896_TICK(t)
+# define BFI_FLINEAR3_3895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3894, v ds
+# define BFI_FLINEAR3_3895_TICK(t)
+# define BFI_FLINEAR3_3894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3893, v ds
+# define BFI_FLINEAR3_3894_TICK(t)
+# define BFI_FLINEAR3_3893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3892, v ds
+# define BFI_FLINEAR3_3893_TICK(t)
+# define BFI_FLINEAR3_3892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3891, v ds
+# define BFI_FLINEAR3_3892_TICK(t)
+# define BFI_FLINEAR3_3891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3890, v ds
+# define BFI_FLINEAR3_3891_TICK(t)
+# define BFI_FLINEAR3_3890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3889, v ds
+# define BFI_FLINEAR3_3890_TICK(t)
+# define BFI_FLINEAR3_3889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3888, v ds
+# define BFI_FLINEAR3_3889_TICK(t)
+# define BFI_FLINEAR3_3888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3887, v ds
+# define BFI_FLINEAR3_3888_TICK(t)
+# define BFI_FLINEAR3_3887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3886, v ds
+# define BFI_FLINEAR3_3887_TICK(t)
+# define BFI_FLINEAR3_3886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3885, v ds
+# define BFI_FLINEAR3_3886_TICK(t)
+# define BFI_FLINEAR3_3885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3884, v ds
+# define BFI_FLINEAR3_3885_TICK(t)
+# define BFI_FLINEAR3_3884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3883, v ds
+# define BFI_FLINEAR3_3884_TICK(t)
+# define BFI_FLINEAR3_3883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3882, v ds
+# define BFI_FLINEAR3_3883_TICK(t)
+# define BFI_FLINEAR3_3882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3881, v ds
+# define BFI_FLINEAR3_3882_TICK(t)
+# define BFI_FLINEAR3_3881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3880, v ds
+# define BFI_FLINEAR3_3881_TICK(t)
+# define BFI_FLINEAR3_3880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3879, v ds
+# define BFI_FLINEAR3_3880_TICK(t)
+# define BFI_FLINEAR3_3879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3878, v ds
+# define BFI_FLINEAR3_3879_TICK(t)
+# define BFI_FLINEAR3_3878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3877, v ds
+# define BFI_FLINEAR3_3878_TICK(t)
+# define BFI_FLINEAR3_3877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3876, v ds
+# define BFI_FLINEAR3_3877_TICK(t)
+# define BFI_FLINEAR3_3876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3875, v ds
+# define BFI_FLINEAR3_3876_TICK(t)
+# define BFI_FLINEAR3_3875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3874, v ds
+# define BFI_FLINEAR3_3875_TICK(t)
+# define BFI_FLINEAR3_3874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3873, v ds
+# define BFI_FLINEAR3_3874_TICK(t)
+# define BFI_FLINEAR3_3873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3872, v ds
+# define BFI_FLINEAR3_3873_TICK(t)
+# define BFI_FLINEAR3_3872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3871, v ds
+# define BFI_FLINEAR3_3872_TICK(t)
+# define BFI_FLINEAR3_3871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3870, v ds
+# define BFI_FLINEAR3_3871_TICK(t)
+# define BFI_FLINEAR3_3870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3869, v ds
+# define BFI_FLINEAR3_3870_TICK(t)
+# define BFI_FLINEAR3_3869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3868, v ds
+# define BFI_FLINEAR3_3869_TICK(t)
+# define BFI_FLINEAR3_3868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3867, v ds
+# define BFI_FLINEAR3_3868_TICK(t)
+# define BFI_FLINEAR3_3867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3866, v ds
+# define BFI_FLINEAR3_3867_TICK(t)
+# define BFI_FLINEAR3_3866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3865, v ds
+# define BFI_FLINEAR3_3866_TICK(t)
+# define BFI_FLINEAR3_3865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3864, v ds
+# define BFI_FLINEAR3_3865_TICK(t)
+# define BFI_FLINEAR3_3864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3863, v ds
+# define BFI_FLINEAR3_3864_TICK(t)
+# define BFI_FLINEAR3_3863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3862, v ds
+# define BFI_FLINEAR3_3863_TICK(t)
+# define BFI_FLINEAR3_3862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3861, v ds
+# define BFI_FLINEAR3_3862_TICK(t)
+# define BFI_FLINEAR3_3861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3860, v ds
+# define BFI_FLINEAR3_3861_TICK(t)
+# define BFI_FLINEAR3_3860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3859, v ds
+# define BFI_FLINEAR3_3860_TICK(t)
+# define BFI_FLINEAR3_3859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3858, v ds
+# define BFI_FLINEAR3_3859_TICK(t)
+# define BFI_FLINEAR3_3858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3857, v ds
+# define BFI_FLINEAR3_3858_TICK(t)
+# define BFI_FLINEAR3_3857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3856, v ds
+# define BFI_FLINEAR3_3857_TICK(t)
+# define BFI_FLINEAR3_3856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3855, v ds
+# define BFI_FLINEAR3_3856_TICK(t)
+# define BFI_FLINEAR3_3855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3854, v ds
+# define BFI_FLINEAR3_3855_TICK(t)
+# define BFI_FLINEAR3_3854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3853, v ds
+# define BFI_FLINEAR3_3854_TICK(t)
+# define BFI_FLINEAR3_3853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3852, v ds
+# define BFI_FLINEAR3_3853_TICK(t)
+# define BFI_FLINEAR3_3852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3851, v ds
+# define BFI_FLINEAR3_3852_TICK(t)
+# define BFI_FLINEAR3_3851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3850, v ds
+# define BFI_FLINEAR3_3851_TICK(t)
+# define BFI_FLINEAR3_3850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3849, v ds
+# define BFI_FLINEAR3_3850_TICK(t)
+# define BFI_FLINEAR3_3849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3848, v ds
+# define BFI_FLINEAR3_3849_TICK(t)
+# define BFI_FLINEAR3_3848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3847, v ds
+# define BFI_FLINEAR3_3848_TICK(t)
+# define BFI_FLINEAR3_3847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3846, v ds
+# define BFI_FLINEAR3_3847_TICK(t)
+# define BFI_FLINEAR3_3846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3845, v ds
+# define BFI_FLINEAR3_3846_TICK(t)
+# define BFI_FLINEAR3_3845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3844, v ds
+# define BFI_FLINEAR3_3845_TICK(t)
+# define BFI_FLINEAR3_3844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3843, v ds
+# define BFI_FLINEAR3_3844_TICK(t)
+# define BFI_FLINEAR3_3843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3842, v ds
+# define BFI_FLINEAR3_3843_TICK(t)
+# define BFI_FLINEAR3_3842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3841, v ds
+# define BFI_FLINEAR3_3842_TICK(t)
+# define BFI_FLINEAR3_3841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3840, v ds
+# define BFI_FLINEAR3_3841_TICK(t)
+# define BFI_FLINEAR3_3840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3839, v ds
+# define BFI_FLINEAR3_3840_TICK(t)
+# define BFI_FLINEAR3_3839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3838, v ds
+# define BFI_FLINEAR3_3839_TICK(t)
+# define BFI_FLINEAR3_3838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3837, v ds
+# define BFI_FLINEAR3_3838_TICK(t)
+# define BFI_FLINEAR3_3837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3836, v ds
+# define BFI_FLINEAR3_3837_TICK(t)
+# define BFI_FLINEAR3_3836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3835, v ds
+# define BFI_FLINEAR3_3836_TICK(t)
+# define BFI_FLINEAR3_3835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3834, v ds
+# define BFI_FLINEAR3_3835_TICK(t)
+# define BFI_FLINEAR3_3834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3833, v ds
+# define BFI_FLINEAR3_3834_TICK(t)
+# define BFI_FLINEAR3_3833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3832, v ds
+# define BFI_FLINEAR3_3833_TICK(t)
+# define BFI_FLINEAR3_3832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3831, v ds
+# define BFI_FLINEAR3_3832_TICK(t)
+# define BFI_FLINEAR3_3831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3830, v ds
+# define BFI_FLINEAR3_3831_TICK(t)
+# define BFI_FLINEAR3_3830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3829, v ds
+# define BFI_FLINEAR3_3830_TICK(t)
+# define BFI_FLINEAR3_3829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3828, v ds
+# define BFI_FLINEAR3_3829_TICK(t)
+# define BFI_FLINEAR3_3828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3827, v ds
+# define BFI_FLINEAR3_3828_TICK(t)
+# define BFI_FLINEAR3_3827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3826, v ds
+# define BFI_FLINEAR3_3827_TICK(t)
+# define BFI_FLINEAR3_3826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3825, v ds
+# define BFI_FLINEAR3_3826_TICK(t)
+# define BFI_FLINEAR3_3825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3824, v ds
+# define BFI_FLINEAR3_3825_TICK(t)
+# define BFI_FLINEAR3_3824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3823, v ds
+# define BFI_FLINEAR3_3824_TICK(t)
+# define BFI_FLINEAR3_3823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3822, v ds
+# define BFI_FLINEAR3_3823_TICK(t)
+# define BFI_FLINEAR3_3822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3821, v ds
+# define BFI_FLINEAR3_3822_TICK(t)
+# define BFI_FLINEAR3_3821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3820, v ds
+# define BFI_FLINEAR3_3821_TICK(t)
+# define BFI_FLINEAR3_3820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3819, v ds
+# define BFI_FLINEAR3_3820_TICK(t)
+# define BFI_FLINEAR3_3819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3818, v ds
+# define BFI_FLINEAR3_3819_TICK(t)
+# define BFI_FLINEAR3_3818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3817, v ds
+# define BFI_FLINEAR3_3818_TICK(t)
+# define BFI_FLINEAR3_3817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3816, v ds
+# define BFI_FLINEAR3_3817_TICK(t)
+# define BFI_FLINEAR3_3816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3815, v ds
+# define BFI_FLINEAR3_3816_TICK(t)
+# define BFI_FLINEAR3_3815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3814, v ds
+# define BFI_FLINEAR3_3815_TICK(t)
+# define BFI_FLINEAR3_3814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3813, v ds
+# define BFI_FLINEAR3_3814_TICK(t)
+# define BFI_FLINEAR3_3813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3812, v ds
+# define BFI_FLINEAR3_3813_TICK(t)
+# define BFI_FLINEAR3_3812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3811, v ds
+# define BFI_FLINEAR3_3812_TICK(t)
+# define BFI_FLINEAR3_3811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3810, v ds
+# define BFI_FLINEAR3_3811_TICK(t)
+# define BFI_FLINEAR3_3810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3809, v ds
+# define BFI_FLINEAR3_3810_TICK(t)
+# define BFI_FLINEAR3_3809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3808, v ds
+# define BFI_FLINEAR3_3809_TICK(t)
+# define BFI_FLINEAR3_3808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3807, v ds
+# define BFI_FLINEAR3_3808_TICK(t)
+# define BFI_FLINEAR3_3807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3806, v ds
+# define BFI_FLINEAR3_3807_TICK(t)
+# define BFI_FLINEAR3_3806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3805, v ds
+# define BFI_FLINEAR3_3806_TICK(t)
+# define BFI_FLINEAR3_3805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3804, v ds
+# define BFI_FLINEAR3_3805_TICK(t)
+# define BFI_FLINEAR3_3804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3803, v ds
+# define BFI_FLINEAR3_3804_TICK(t)
+# define BFI_FLINEAR3_3803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3802, v ds
+# define BFI_FLINEAR3_3803_TICK(t)
+# define BFI_FLINEAR3_3802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3801, v ds
+# define BFI_FLINEAR3_3802_TICK(t)
+# define BFI_FLINEAR3_3801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3800, v ds
+# define BFI_FLINEAR3_3801_TICK(t)
+# define BFI_FLINEAR3_3800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3799, v ds
+# define BFI_FLINEAR3_3800_TICK(t)
+# define BFI_FLINEAR3_3799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3798, v ds
+# define BFI_FLINEAR3_3799_TICK(t)
+# define BFI_FLINEAR3_3798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3797, v ds
+# define BFI_FLINEAR3_3798_TICK(t)
+# define BFI_FLINEAR3_3797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3796, v ds
+# define BFI_FLINEAR3_3797_TICK(t)
+# define BFI_FLINEAR3_3796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3795, v ds
+# define BFI_FLINEAR3_3796_TICK(t)
+# define BFI_FLINEAR3_3795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3794, v ds
+# define BFI_FLINEAR3_3795_TICK(t)
+# define BFI_FLINEAR3_3794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3793, v ds
+# define BFI_FLINEAR3_3794_TICK(t)
+# define BFI_FLINEAR3_3793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3792, v ds
+# define BFI_FLINEAR3_3793_TICK(t)
+# define BFI_FLINEAR3_3792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3791, v ds
+# define BFI_FLINEAR3_3792_TICK(t)
+# define BFI_FLINEAR3_3791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3790, v ds
+# define BFI_FLINEAR3_3791_TICK(t)
+# define BFI_FLINEAR3_3790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3789, v ds
+# define BFI_FLINEAR3_3790_TICK(t)
+# define BFI_FLINEAR3_3789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3788, v ds
+# define BFI_FLINEAR3_3789_TICK(t)
+# define BFI_FLINEAR3_3788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3787, v ds
+# define BFI_FLINEAR3_3788_TICK(t)
+# define BFI_FLINEAR3_3787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3786, v ds
+# define BFI_FLINEAR3_3787_TICK(t)
+# define BFI_FLINEAR3_3786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3785, v ds
+# define BFI_FLINEAR3_3786_TICK(t)
+# define BFI_FLINEAR3_3785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3784, v ds
+# define BFI_FLINEAR3_3785_TICK(t)
+# define BFI_FLINEAR3_3784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3783, v ds
+# define BFI_FLINEAR3_3784_TICK(t)
+# define BFI_FLINEAR3_3783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3782, v ds
+# define BFI_FLINEAR3_3783_TICK(t)
+# define BFI_FLINEAR3_3782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3781, v ds
+# define BFI_FLINEAR3_3782_TICK(t)
+# define BFI_FLINEAR3_3781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3780, v ds
+# define BFI_FLINEAR3_3781_TICK(t)
+# define BFI_FLINEAR3_3780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3779, v ds
+# define BFI_FLINEAR3_3780_TICK(t)
+# define BFI_FLINEAR3_3779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3778, v ds
+# define BFI_FLINEAR3_3779_TICK(t)
+# define BFI_FLINEAR3_3778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3777, v ds
+# define BFI_FLINEAR3_3778_TICK(t)
+# define BFI_FLINEAR3_3777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3776, v ds
+# define BFI_FLINEAR3_3777_TICK(t)
+# define BFI_FLINEAR3_3776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3775, v ds
+# define BFI_FLINEAR3_3776_TICK(t)
+# define BFI_FLINEAR3_3775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3774, v ds
+# define BFI_FLINEAR3_3775_TICK(t)
+# define BFI_FLINEAR3_3774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3773, v ds
+# define BFI_FLINEAR3_3774_TICK(t)
+# define BFI_FLINEAR3_3773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3772, v ds
+# define BFI_FLINEAR3_3773_TICK(t)
+# define BFI_FLINEAR3_3772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3771, v ds
+# define BFI_FLINEAR3_3772_TICK(t)
+# define BFI_FLINEAR3_3771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3770, v ds
+# define BFI_FLINEAR3_3771_TICK(t)
+# define BFI_FLINEAR3_3770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3769, v ds
+# define BFI_FLINEAR3_3770_TICK(t)
+# define BFI_FLINEAR3_3769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3768, v ds
+# define BFI_FLINEAR3_3769_TICK(t)
+# define BFI_FLINEAR3_3768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3767, v ds
+# define BFI_FLINEAR3_3768_TICK(t)
+# define BFI_FLINEAR3_3767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3766, v ds
+# define BFI_FLINEAR3_3767_TICK(t)
+# define BFI_FLINEAR3_3766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3765, v ds
+# define BFI_FLINEAR3_3766_TICK(t)
+# define BFI_FLINEAR3_3765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3764, v ds
+# define BFI_FLINEAR3_3765_TICK(t)
+# define BFI_FLINEAR3_3764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3763, v ds
+# define BFI_FLINEAR3_3764_TICK(t)
+# define BFI_FLINEAR3_3763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3762, v ds
+# define BFI_FLINEAR3_3763_TICK(t)
+# define BFI_FLINEAR3_3762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3761, v ds
+# define BFI_FLINEAR3_3762_TICK(t)
+# define BFI_FLINEAR3_3761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3760, v ds
+# define BFI_FLINEAR3_3761_TICK(t)
+# define BFI_FLINEAR3_3760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3759, v ds
+# define BFI_FLINEAR3_3760_TICK(t)
+# define BFI_FLINEAR3_3759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3758, v ds
+# define BFI_FLINEAR3_3759_TICK(t)
+# define BFI_FLINEAR3_3758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3757, v ds
+# define BFI_FLINEAR3_3758_TICK(t)
+# define BFI_FLINEAR3_3757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3756, v ds
+# define BFI_FLINEAR3_3757_TICK(t)
+# define BFI_FLINEAR3_3756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3755, v ds
+# define BFI_FLINEAR3_3756_TICK(t)
+# define BFI_FLINEAR3_3755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3754, v ds
+# define BFI_FLINEAR3_3755_TICK(t)
+# define BFI_FLINEAR3_3754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3753, v ds
+# define BFI_FLINEAR3_3754_TICK(t)
+# define BFI_FLINEAR3_3753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3752, v ds
+# define BFI_FLINEAR3_3753_TICK(t)
+# define BFI_FLINEAR3_3752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3751, v ds
+# define BFI_FLINEAR3_3752_TICK(t)
+# define BFI_FLINEAR3_3751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3750, v ds
+# define BFI_FLINEAR3_3751_TICK(t)
+# define BFI_FLINEAR3_3750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3749, v ds
+# define BFI_FLINEAR3_3750_TICK(t)
+# define BFI_FLINEAR3_3749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3748, v ds
+# define BFI_FLINEAR3_3749_TICK(t)
+# define BFI_FLINEAR3_3748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3747, v ds
+# define BFI_FLINEAR3_3748_TICK(t)
+# define BFI_FLINEAR3_3747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3746, v ds
+# define BFI_FLINEAR3_3747_TICK(t)
+# define BFI_FLINEAR3_3746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3745, v ds
+# define BFI_FLINEAR3_3746_TICK(t)
+# define BFI_FLINEAR3_3745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3744, v ds
+# define BFI_FLINEAR3_3745_TICK(t)
+# define BFI_FLINEAR3_3744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3743, v ds
+# define BFI_FLINEAR3_3744_TICK(t)
+# define BFI_FLINEAR3_3743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3742, v ds
+# define BFI_FLINEAR3_3743_TICK(t)
+# define BFI_FLINEAR3_3742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3741, v ds
+# define BFI_FLINEAR3_3742_TICK(t)
+# define BFI_FLINEAR3_3741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3740, v ds
+# define BFI_FLINEAR3_3741_TICK(t)
+# define BFI_FLINEAR3_3740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3739, v ds
+# define BFI_FLINEAR3_3740_TICK(t)
+# define BFI_FLINEAR3_3739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3738, v ds
+# define BFI_FLINEAR3_3739_TICK(t)
+# define BFI_FLINEAR3_3738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3737, v ds
+# define BFI_FLINEAR3_3738_TICK(t)
+# define BFI_FLINEAR3_3737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3736, v ds
+# define BFI_FLINEAR3_3737_TICK(t)
+# define BFI_FLINEAR3_3736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3735, v ds
+# define BFI_FLINEAR3_3736_TICK(t)
+# define BFI_FLINEAR3_3735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3734, v ds
+# define BFI_FLINEAR3_3735_TICK(t)
+# define BFI_FLINEAR3_3734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3733, v ds
+# define BFI_FLINEAR3_3734_TICK(t)
+# define BFI_FLINEAR3_3733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3732, v ds
+# define BFI_FLINEAR3_3733_TICK(t)
+# define BFI_FLINEAR3_3732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3731, v ds
+# define BFI_FLINEAR3_3732_TICK(t)
+# define BFI_FLINEAR3_3731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3730, v ds
+# define BFI_FLINEAR3_3731_TICK(t)
+# define BFI_FLINEAR3_3730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3729, v ds
+# define BFI_FLINEAR3_3730_TICK(t)
+# define BFI_FLINEAR3_3729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3728, v ds
+# define BFI_FLINEAR3_3729_TICK(t)
+# define BFI_FLINEAR3_3728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3727, v ds
+# define BFI_FLINEAR3_3728_TICK(t)
+# define BFI_FLINEAR3_3727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3726, v ds
+# define BFI_FLINEAR3_3727_TICK(t)
+# define BFI_FLINEAR3_3726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3725, v ds
+# define BFI_FLINEAR3_3726_TICK(t)
+# define BFI_FLINEAR3_3725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3724, v ds
+# define BFI_FLINEAR3_3725_TICK(t)
+# define BFI_FLINEAR3_3724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3723, v ds
+# define BFI_FLINEAR3_3724_TICK(t)
+# define BFI_FLINEAR3_3723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3722, v ds
+# define BFI_FLINEAR3_3723_TICK(t)
+# define BFI_FLINEAR3_3722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3721, v ds
+# define BFI_FLINEAR3_3722_TICK(t)
+# define BFI_FLINEAR3_3721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3720, v ds
+# define BFI_FLINEAR3_3721_TICK(t)
+# define BFI_FLINEAR3_3720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3719, v ds
+# define BFI_FLINEAR3_3720_TICK(t)
+# define BFI_FLINEAR3_3719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3718, v ds
+# define BFI_FLINEAR3_3719_TICK(t)
+# define BFI_FLINEAR3_3718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3717, v ds
+# define BFI_FLINEAR3_3718_TICK(t)
+# define BFI_FLINEAR3_3717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3716, v ds
+# define BFI_FLINEAR3_3717_TICK(t)
+# define BFI_FLINEAR3_3716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3715, v ds
+# define BFI_FLINEAR3_3716_TICK(t)
+# define BFI_FLINEAR3_3715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3714, v ds
+# define BFI_FLINEAR3_3715_TICK(t)
+# define BFI_FLINEAR3_3714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3713, v ds
+# define BFI_FLINEAR3_3714_TICK(t)
+# define BFI_FLINEAR3_3713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3712, v ds
+# define BFI_FLINEAR3_3713_TICK(t)
+# define BFI_FLINEAR3_3712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3711, v ds
+# define BFI_FLINEAR3_3712_TICK(t)
+# define BFI_FLINEAR3_3711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3710, v ds
+# define BFI_FLINEAR3_3711_TICK(t)
+# define BFI_FLINEAR3_3710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3709, v ds
+# define BFI_FLINEAR3_3710_TICK(t)
+# define BFI_FLINEAR3_3709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3708, v ds
+# define BFI_FLINEAR3_3709_TICK(t)
+# define BFI_FLINEAR3_3708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3707, v ds
+# define BFI_FLINEAR3_3708_TICK(t)
+# define BFI_FLINEAR3_3707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3706, v ds
+# define BFI_FLINEAR3_3707_TICK(t)
+# define BFI_FLINEAR3_3706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3705, v ds
+# define BFI_FLINEAR3_3706_TICK(t)
+# define BFI_FLINEAR3_3705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3704, v ds
+# define BFI_FLINEAR3_3705_TICK(t)
+# define BFI_FLINEAR3_3704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3703, v ds
+# define BFI_FLINEAR3_3704_TICK(t)
+# define BFI_FLINEAR3_3703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3702, v ds
+# define BFI_FLINEAR3_3703_TICK(t)
+# define BFI_FLINEAR3_3702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3701, v ds
+# define BFI_FLINEAR3_3702_TICK(t)
+# define BFI_FLINEAR3_3701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3700, v ds
+# define BFI_FLINEAR3_3701_TICK(t)
+# define BFI_FLINEAR3_3700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3699, v ds
+# define BFI_FLINEAR3_3700_TICK(t)
+# define BFI_FLINEAR3_3699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3698, v ds
+# define BFI_FLINEAR3_3699_TICK(t)
+# define BFI_FLINEAR3_3698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3697, v ds
+# define BFI_FLINEAR3_3698_TICK(t)
+# define BFI_FLINEAR3_3697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3696, v ds
+# define BFI_FLINEAR3_3697_TICK(t)
+# define BFI_FLINEAR3_3696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3695, v ds
+# define BFI_FLINEAR3_3696_TICK(t)
+# define BFI_FLINEAR3_3695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3694, v ds
+# define BFI_FLINEAR3_3695_TICK(t)
+# define BFI_FLINEAR3_3694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3693, v ds
+# define BFI_FLINEAR3_3694_TICK(t)
+# define BFI_FLINEAR3_3693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3692, v ds
+# define BFI_FLINEAR3_3693_TICK(t)
+# define BFI_FLINEAR3_3692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3691, v ds
+# define BFI_FLINEAR3_3692_TICK(t)
+# define BFI_FLINEAR3_3691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3690, v ds
+# define BFI_FLINEAR3_3691_TICK(t)
+# define BFI_FLINEAR3_3690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3689, v ds
+# define BFI_FLINEAR3_3690_TICK(t)
+# define BFI_FLINEAR3_3689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3688, v ds
+# define BFI_FLINEAR3_3689_TICK(t)
+# define BFI_FLINEAR3_3688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3687, v ds
+# define BFI_FLINEAR3_3688_TICK(t)
+# define BFI_FLINEAR3_3687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3686, v ds
+# define BFI_FLINEAR3_3687_TICK(t)
+# define BFI_FLINEAR3_3686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3685, v ds
+# define BFI_FLINEAR3_3686_TICK(t)
+# define BFI_FLINEAR3_3685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3684, v ds
+# define BFI_FLINEAR3_3685_TICK(t)
+# define BFI_FLINEAR3_3684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3683, v ds
+# define BFI_FLINEAR3_3684_TICK(t)
+# define BFI_FLINEAR3_3683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3682, v ds
+# define BFI_FLINEAR3_3683_TICK(t)
+# define BFI_FLINEAR3_3682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3681, v ds
+# define BFI_FLINEAR3_3682_TICK(t)
+# define BFI_FLINEAR3_3681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3680, v ds
+# define BFI_FLINEAR3_3681_TICK(t)
+# define BFI_FLINEAR3_3680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3679, v ds
+# define BFI_FLINEAR3_3680_TICK(t)
+# define BFI_FLINEAR3_3679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3678, v ds
+# define BFI_FLINEAR3_3679_TICK(t)
+# define BFI_FLINEAR3_3678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3677, v ds
+# define BFI_FLINEAR3_3678_TICK(t)
+# define BFI_FLINEAR3_3677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3676, v ds
+# define BFI_FLINEAR3_3677_TICK(t)
+# define BFI_FLINEAR3_3676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3675, v ds
+# define BFI_FLINEAR3_3676_TICK(t)
+# define BFI_FLINEAR3_3675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3674, v ds
+# define BFI_FLINEAR3_3675_TICK(t)
+# define BFI_FLINEAR3_3674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3673, v ds
+# define BFI_FLINEAR3_3674_TICK(t)
+# define BFI_FLINEAR3_3673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3672, v ds
+# define BFI_FLINEAR3_3673_TICK(t)
+# define BFI_FLINEAR3_3672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3671, v ds
+# define BFI_FLINEAR3_3672_TICK(t)
+# define BFI_FLINEAR3_3671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3670, v ds
+# define BFI_FLINEAR3_3671_TICK(t)
+# define BFI_FLINEAR3_3670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3669, v ds
+# define BFI_FLINEAR3_3670_TICK(t)
+# define BFI_FLINEAR3_3669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3668, v ds
+# define BFI_FLINEAR3_3669_TICK(t)
+# define BFI_FLINEAR3_3668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3667, v ds
+# define BFI_FLINEAR3_3668_TICK(t)
+# define BFI_FLINEAR3_3667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3666, v ds
+# define BFI_FLINEAR3_3667_TICK(t)
+# define BFI_FLINEAR3_3666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3665, v ds
+# define BFI_FLINEAR3_3666_TICK(t)
+# define BFI_FLINEAR3_3665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3664, v ds
+# define BFI_FLINEAR3_3665_TICK(t)
+# define BFI_FLINEAR3_3664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3663, v ds
+# define BFI_FLINEAR3_3664_TICK(t)
+# define BFI_FLINEAR3_3663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3662, v ds
+# define BFI_FLINEAR3_3663_TICK(t)
+# define BFI_FLINEAR3_3662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3661, v ds
+# define BFI_FLINEAR3_3662_TICK(t)
+# define BFI_FLINEAR3_3661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3660, v ds
+# define BFI_FLINEAR3_3661_TICK(t)
+# define BFI_FLINEAR3_3660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3659, v ds
+# define BFI_FLINEAR3_3660_TICK(t)
+# define BFI_FLINEAR3_3659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3658, v ds
+# define BFI_FLINEAR3_3659_TICK(t)
+# define BFI_FLINEAR3_3658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3657, v ds
+# define BFI_FLINEAR3_3658_TICK(t)
+# define BFI_FLINEAR3_3657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3656, v ds
+# define BFI_FLINEAR3_3657_TICK(t)
+# define BFI_FLINEAR3_3656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3655, v ds
+# define BFI_FLINEAR3_3656_TICK(t)
+# define BFI_FLINEAR3_3655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3654, v ds
+# define BFI_FLINEAR3_3655_TICK(t)
+# define BFI_FLINEAR3_3654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3653, v ds
+# define BFI_FLINEAR3_3654_TICK(t)
+# define BFI_FLINEAR3_3653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3652, v ds
+# define BFI_FLINEAR3_3653_TICK(t)
+# define BFI_FLINEAR3_3652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3651, v ds
+# define BFI_FLINEAR3_3652_TICK(t)
+# define BFI_FLINEAR3_3651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3650, v ds
+# define BFI_FLINEAR3_3651_TICK(t)
+# define BFI_FLINEAR3_3650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3649, v ds
+# define BFI_FLINEAR3_3650_TICK(t)
+# define BFI_FLINEAR3_3649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3648, v ds
+# define BFI_FLINEAR3_3649_TICK(t)
+# define BFI_FLINEAR3_3648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3647, v ds
+# define BFI_FLINEAR3_3648_TICK(t)
+# define BFI_FLINEAR3_3647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3646, v ds
+# define BFI_FLINEAR3_3647_TICK(t)
+# define BFI_FLINEAR3_3646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3645, v ds
+# define BFI_FLINEAR3_3646_TICK(t)
+# define BFI_FLINEAR3_3645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3644, v ds
+# define BFI_FLINEAR3_3645_TICK(t)
+# define BFI_FLINEAR3_3644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3643, v ds
+# define BFI_FLINEAR3_3644_TICK(t)
+# define BFI_FLINEAR3_3643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3642, v ds
+# define BFI_FLINEAR3_3643_TICK(t)
+# define BFI_FLINEAR3_3642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3641, v ds
+# define BFI_FLINEAR3_3642_TICK(t)
+# define BFI_FLINEAR3_3641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3640, v ds
+# define BFI_FLINEAR3_3641_TICK(t)
+# define BFI_FLINEAR3_3640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3639, v ds
+# define BFI_FLINEAR3_3640_TICK(t)
+# define BFI_FLINEAR3_3639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3638, v ds
+# define BFI_FLINEAR3_3639_TICK(t)
+# define BFI_FLINEAR3_3638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3637, v ds
+# define BFI_FLINEAR3_3638_TICK(t)
+# define BFI_FLINEAR3_3637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3636, v ds
+# define BFI_FLINEAR3_3637_TICK(t)
+# define BFI_FLINEAR3_3636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3635, v ds
+# define BFI_FLINEAR3_3636_TICK(t)
+# define BFI_FLINEAR3_3635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3634, v ds
+# define BFI_FLINEAR3_3635_TICK(t)
+# define BFI_FLINEAR3_3634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3633, v ds
+# define BFI_FLINEAR3_3634_TICK(t)
+# define BFI_FLINEAR3_3633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3632, v ds
+# define BFI_FLINEAR3_3633_TICK(t)
+# define BFI_FLINEAR3_3632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3631, v ds
+# define BFI_FLINEAR3_3632_TICK(t)
+# define BFI_FLINEAR3_3631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3630, v ds
+# define BFI_FLINEAR3_3631_TICK(t)
+# define BFI_FLINEAR3_3630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3629, v ds
+# define BFI_FLINEAR3_3630_TICK(t)
+# define BFI_FLINEAR3_3629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3628, v ds
+# define BFI_FLINEAR3_3629_TICK(t)
+# define BFI_FLINEAR3_3628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3627, v ds
+# define BFI_FLINEAR3_3628_TICK(t)
+# define BFI_FLINEAR3_3627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3626, v ds
+# define BFI_FLINEAR3_3627_TICK(t)
+# define BFI_FLINEAR3_3626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3625, v ds
+# define BFI_FLINEAR3_3626_TICK(t)
+# define BFI_FLINEAR3_3625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3624, v ds
+# define BFI_FLINEAR3_3625_TICK(t)
+# define BFI_FLINEAR3_3624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3623, v ds
+# define BFI_FLINEAR3_3624_TICK(t)
+# define BFI_FLINEAR3_3623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3622, v ds
+# define BFI_FLINEAR3_3623_TICK(t)
+# define BFI_FLINEAR3_3622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3621, v ds
+# define BFI_FLINEAR3_3622_TICK(t)
+# define BFI_FLINEAR3_3621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3620, v ds
+# define BFI_FLINEAR3_3621_TICK(t)
+# define BFI_FLINEAR3_3620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3619, v ds
+# define BFI_FLINEAR3_3620_TICK(t)
+# define BFI_FLINEAR3_3619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3618, v ds
+# define BFI_FLINEAR3_3619_TICK(t)
+# define BFI_FLINEAR3_3618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3617, v ds
+# define BFI_FLINEAR3_3618_TICK(t)
+# define BFI_FLINEAR3_3617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3616, v ds
+# define BFI_FLINEAR3_3617_TICK(t)
+# define BFI_FLINEAR3_3616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3615, v ds
+# define BFI_FLINEAR3_3616_TICK(t)
+# define BFI_FLINEAR3_3615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3614, v ds
+# define BFI_FLINEAR3_3615_TICK(t)
+# define BFI_FLINEAR3_3614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3613, v ds
+# define BFI_FLINEAR3_3614_TICK(t)
+# define BFI_FLINEAR3_3613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3612, v ds
+# define BFI_FLINEAR3_3613_TICK(t)
+# define BFI_FLINEAR3_3612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3611, v ds
+# define BFI_FLINEAR3_3612_TICK(t)
+# define BFI_FLINEAR3_3611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3610, v ds
+# define BFI_FLINEAR3_3611_TICK(t)
+# define BFI_FLINEAR3_3610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3609, v ds
+# define BFI_FLINEAR3_3610_TICK(t)
+# define BFI_FLINEAR3_3609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3608, v ds
+# define BFI_FLINEAR3_3609_TICK(t)
+# define BFI_FLINEAR3_3608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3607, v ds
+# define BFI_FLINEAR3_3608_TICK(t)
+# define BFI_FLINEAR3_3607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3606, v ds
+# define BFI_FLINEAR3_3607_TICK(t)
+# define BFI_FLINEAR3_3606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3605, v ds
+# define BFI_FLINEAR3_3606_TICK(t)
+# define BFI_FLINEAR3_3605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3604, v ds
+# define BFI_FLINEAR3_3605_TICK(t)
+# define BFI_FLINEAR3_3604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3603, v ds
+# define BFI_FLINEAR3_3604_TICK(t)
+# define BFI_FLINEAR3_3603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3602, v ds
+# define BFI_FLINEAR3_3603_TICK(t)
+# define BFI_FLINEAR3_3602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3601, v ds
+# define BFI_FLINEAR3_3602_TICK(t)
+# define BFI_FLINEAR3_3601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3600, v ds
+# define BFI_FLINEAR3_3601_TICK(t)
+# define BFI_FLINEAR3_3600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3599, v ds
+# define BFI_FLINEAR3_3600_TICK(t)
+# define BFI_FLINEAR3_3599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3598, v ds
+# define BFI_FLINEAR3_3599_TICK(t)
+# define BFI_FLINEAR3_3598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3597, v ds
+# define BFI_FLINEAR3_3598_TICK(t)
+# define BFI_FLINEAR3_3597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3596, v ds
+# define BFI_FLINEAR3_3597_TICK(t)
+# define BFI_FLINEAR3_3596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3595, v ds
+# define BFI_FLINEAR3_3596_TICK(t)
+# define BFI_FLINEAR3_3595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3594, v ds
+# define BFI_FLINEAR3_3595_TICK(t)
+# define BFI_FLINEAR3_3594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3593, v ds
+# define BFI_FLINEAR3_3594_TICK(t)
+# define BFI_FLINEAR3_3593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3592, v ds
+# define BFI_FLINEAR3_3593_TICK(t)
+# define BFI_FLINEAR3_3592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3591, v ds
+# define BFI_FLINEAR3_3592_TICK(t)
+# define BFI_FLINEAR3_3591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3590, v ds
+# define BFI_FLINEAR3_3591_TICK(t)
+# define BFI_FLINEAR3_3590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3589, v ds
+# define BFI_FLINEAR3_3590_TICK(t)
+# define BFI_FLINEAR3_3589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3588, v ds
+# define BFI_FLINEAR3_3589_TICK(t)
+# define BFI_FLINEAR3_3588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3587, v ds
+# define BFI_FLINEAR3_3588_TICK(t)
+# define BFI_FLINEAR3_3587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3586, v ds
+# define BFI_FLINEAR3_3587_TICK(t)
+# define BFI_FLINEAR3_3586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3585, v ds
+# define BFI_FLINEAR3_3586_TICK(t)
+# define BFI_FLINEAR3_3585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3584, v ds
+# define BFI_FLINEAR3_3585_TICK(t)
+# define BFI_FLINEAR3_3584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3583, v ds
+# define BFI_FLINEAR3_3584_TICK(t)
+# define BFI_FLINEAR3_3583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3582, v ds
+# define BFI_FLINEAR3_3583_TICK(t)
+# define BFI_FLINEAR3_3582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3581, v ds
+# define BFI_FLINEAR3_3582_TICK(t)
+# define BFI_FLINEAR3_3581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3580, v ds
+# define BFI_FLINEAR3_3581_TICK(t)
+# define BFI_FLINEAR3_3580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3579, v ds
+# define BFI_FLINEAR3_3580_TICK(t)
+# define BFI_FLINEAR3_3579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3578, v ds
+# define BFI_FLINEAR3_3579_TICK(t)
+# define BFI_FLINEAR3_3578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3577, v ds
+# define BFI_FLINEAR3_3578_TICK(t)
+# define BFI_FLINEAR3_3577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3576, v ds
+# define BFI_FLINEAR3_3577_TICK(t)
+# define BFI_FLINEAR3_3576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3575, v ds
+# define BFI_FLINEAR3_3576_TICK(t)
+# define BFI_FLINEAR3_3575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3574, v ds
+# define BFI_FLINEAR3_3575_TICK(t)
+# define BFI_FLINEAR3_3574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3573, v ds
+# define BFI_FLINEAR3_3574_TICK(t)
+# define BFI_FLINEAR3_3573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3572, v ds
+# define BFI_FLINEAR3_3573_TICK(t)
+# define BFI_FLINEAR3_3572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3571, v ds
+# define BFI_FLINEAR3_3572_TICK(t)
+# define BFI_FLINEAR3_3571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3570, v ds
+# define BFI_FLINEAR3_3571_TICK(t)
+# define BFI_FLINEAR3_3570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3569, v ds
+# define BFI_FLINEAR3_3570_TICK(t)
+# define BFI_FLINEAR3_3569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3568, v ds
+# define BFI_FLINEAR3_3569_TICK(t)
+# define BFI_FLINEAR3_3568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3567, v ds
+# define BFI_FLINEAR3_3568_TICK(t)
+# define BFI_FLINEAR3_3567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3566, v ds
+# define BFI_FLINEAR3_3567_TICK(t)
+# define BFI_FLINEAR3_3566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3565, v ds
+# define BFI_FLINEAR3_3566_TICK(t)
+# define BFI_FLINEAR3_3565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3564, v ds
+# define BFI_FLINEAR3_3565_TICK(t)
+# define BFI_FLINEAR3_3564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3563, v ds
+# define BFI_FLINEAR3_3564_TICK(t)
+# define BFI_FLINEAR3_3563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3562, v ds
+# define BFI_FLINEAR3_3563_TICK(t)
+# define BFI_FLINEAR3_3562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3561, v ds
+# define BFI_FLINEAR3_3562_TICK(t)
+# define BFI_FLINEAR3_3561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3560, v ds
+# define BFI_FLINEAR3_3561_TICK(t)
+# define BFI_FLINEAR3_3560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3559, v ds
+# define BFI_FLINEAR3_3560_TICK(t)
+# define BFI_FLINEAR3_3559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3558, v ds
+# define BFI_FLINEAR3_3559_TICK(t)
+# define BFI_FLINEAR3_3558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3557, v ds
+# define BFI_FLINEAR3_3558_TICK(t)
+# define BFI_FLINEAR3_3557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3556, v ds
+# define BFI_FLINEAR3_3557_TICK(t)
+# define BFI_FLINEAR3_3556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3555, v ds
+# define BFI_FLINEAR3_3556_TICK(t)
+# define BFI_FLINEAR3_3555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3554, v ds
+# define BFI_FLINEAR3_3555_TICK(t)
+# define BFI_FLINEAR3_3554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3553, v ds
+# define BFI_FLINEAR3_3554_TICK(t)
+# define BFI_FLINEAR3_3553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3552, v ds
+# define BFI_FLINEAR3_3553_TICK(t)
+# define BFI_FLINEAR3_3552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3551, v ds
+# define BFI_FLINEAR3_3552_TICK(t)
+# define BFI_FLINEAR3_3551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3550, v ds
+# define BFI_FLINEAR3_3551_TICK(t)
+# define BFI_FLINEAR3_3550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3549, v ds
+# define BFI_FLINEAR3_3550_TICK(t)
+# define BFI_FLINEAR3_3549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3548, v ds
+# define BFI_FLINEAR3_3549_TICK(t)
+# define BFI_FLINEAR3_3548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3547, v ds
+# define BFI_FLINEAR3_3548_TICK(t)
+# define BFI_FLINEAR3_3547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3546, v ds
+# define BFI_FLINEAR3_3547_TICK(t)
+# define BFI_FLINEAR3_3546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3545, v ds
+# define BFI_FLINEAR3_3546_TICK(t)
+# define BFI_FLINEAR3_3545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3544, v ds
+# define BFI_FLINEAR3_3545_TICK(t)
+# define BFI_FLINEAR3_3544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3543, v ds
+# define BFI_FLINEAR3_3544_TICK(t)
+# define BFI_FLINEAR3_3543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3542, v ds
+# define BFI_FLINEAR3_3543_TICK(t)
+# define BFI_FLINEAR3_3542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3541, v ds
+# define BFI_FLINEAR3_3542_TICK(t)
+# define BFI_FLINEAR3_3541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3540, v ds
+# define BFI_FLINEAR3_3541_TICK(t)
+# define BFI_FLINEAR3_3540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3539, v ds
+# define BFI_FLINEAR3_3540_TICK(t)
+# define BFI_FLINEAR3_3539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3538, v ds
+# define BFI_FLINEAR3_3539_TICK(t)
+# define BFI_FLINEAR3_3538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3537, v ds
+# define BFI_FLINEAR3_3538_TICK(t)
+# define BFI_FLINEAR3_3537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3536, v ds
+# define BFI_FLINEAR3_3537_TICK(t)
+# define BFI_FLINEAR3_3536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3535, v ds
+# define BFI_FLINEAR3_3536_TICK(t)
+# define BFI_FLINEAR3_3535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3534, v ds
+# define BFI_FLINEAR3_3535_TICK(t)
+# define BFI_FLINEAR3_3534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3533, v ds
+# define BFI_FLINEAR3_3534_TICK(t)
+# define BFI_FLINEAR3_3533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3532, v ds
+# define BFI_FLINEAR3_3533_TICK(t)
+# define BFI_FLINEAR3_3532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3531, v ds
+# define BFI_FLINEAR3_3532_TICK(t)
+# define BFI_FLINEAR3_3531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3530, v ds
+# define BFI_FLINEAR3_3531_TICK(t)
+# define BFI_FLINEAR3_3530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3529, v ds
+# define BFI_FLINEAR3_3530_TICK(t)
+# define BFI_FLINEAR3_3529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3528, v ds
+# define BFI_FLINEAR3_3529_TICK(t)
+# define BFI_FLINEAR3_3528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3527, v ds
+# define BFI_FLINEAR3_3528_TICK(t)
+# define BFI_FLINEAR3_3527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3526, v ds
+# define BFI_FLINEAR3_3527_TICK(t)
+# define BFI_FLINEAR3_3526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3525, v ds
+# define BFI_FLINEAR3_3526_TICK(t)
+# define BFI_FLINEAR3_3525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3524, v ds
+# define BFI_FLINEAR3_3525_TICK(t)
+# define BFI_FLINEAR3_3524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3523, v ds
+# define BFI_FLINEAR3_3524_TICK(t)
+# define BFI_FLINEAR3_3523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3522, v ds
+# define BFI_FLINEAR3_3523_TICK(t)
+# define BFI_FLINEAR3_3522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3521, v ds
+# define BFI_FLINEAR3_3522_TICK(t)
+# define BFI_FLINEAR3_3521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3520, v ds
+# define BFI_FLINEAR3_3521_TICK(t)
+# define BFI_FLINEAR3_3520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3519, v ds
+# define BFI_FLINEAR3_3520_TICK(t)
+# define BFI_FLINEAR3_3519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3518, v ds
+# define BFI_FLINEAR3_3519_TICK(t)
+# define BFI_FLINEAR3_3518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3517, v ds
+# define BFI_FLINEAR3_3518_TICK(t)
+# define BFI_FLINEAR3_3517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3516, v ds
+# define BFI_FLINEAR3_3517_TICK(t)
+# define BFI_FLINEAR3_3516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3515, v ds
+# define BFI_FLINEAR3_3516_TICK(t)
+# define BFI_FLINEAR3_3515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3514, v ds
+# define BFI_FLINEAR3_3515_TICK(t)
+# define BFI_FLINEAR3_3514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3513, v ds
+# define BFI_FLINEAR3_3514_TICK(t)
+# define BFI_FLINEAR3_3513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3512, v ds
+# define BFI_FLINEAR3_3513_TICK(t)
+# define BFI_FLINEAR3_3512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3511, v ds
+# define BFI_FLINEAR3_3512_TICK(t)
+# define BFI_FLINEAR3_3511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3510, v ds
+# define BFI_FLINEAR3_3511_TICK(t)
+# define BFI_FLINEAR3_3510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3509, v ds
+# define BFI_FLINEAR3_3510_TICK(t)
+# define BFI_FLINEAR3_3509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3508, v ds
+# define BFI_FLINEAR3_3509_TICK(t)
+# define BFI_FLINEAR3_3508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3507, v ds
+# define BFI_FLINEAR3_3508_TICK(t)
+# define BFI_FLINEAR3_3507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3506, v ds
+# define BFI_FLINEAR3_3507_TICK(t)
+# define BFI_FLINEAR3_3506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3505, v ds
+# define BFI_FLINEAR3_3506_TICK(t)
+# define BFI_FLINEAR3_3505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3504, v ds
+# define BFI_FLINEAR3_3505_TICK(t)
+# define BFI_FLINEAR3_3504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3503, v ds
+# define BFI_FLINEAR3_3504_TICK(t)
+# define BFI_FLINEAR3_3503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3502, v ds
+# define BFI_FLINEAR3_3503_TICK(t)
+# define BFI_FLINEAR3_3502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3501, v ds
+# define BFI_FLINEAR3_3502_TICK(t)
+# define BFI_FLINEAR3_3501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3500, v ds
+# define BFI_FLINEAR3_3501_TICK(t)
+# define BFI_FLINEAR3_3500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3499, v ds
+# define BFI_FLINEAR3_3500_TICK(t)
+# define BFI_FLINEAR3_3499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3498, v ds
+# define BFI_FLINEAR3_3499_TICK(t)
+# define BFI_FLINEAR3_3498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3497, v ds
+# define BFI_FLINEAR3_3498_TICK(t)
+# define BFI_FLINEAR3_3497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3496, v ds
+# define BFI_FLINEAR3_3497_TICK(t)
+# define BFI_FLINEAR3_3496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3495, v ds
+# define BFI_FLINEAR3_3496_TICK(t)
+# define BFI_FLINEAR3_3495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3494, v ds
+# define BFI_FLINEAR3_3495_TICK(t)
+# define BFI_FLINEAR3_3494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3493, v ds
+# define BFI_FLINEAR3_3494_TICK(t)
+# define BFI_FLINEAR3_3493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3492, v ds
+# define BFI_FLINEAR3_3493_TICK(t)
+# define BFI_FLINEAR3_3492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3491, v ds
+# define BFI_FLINEAR3_3492_TICK(t)
+# define BFI_FLINEAR3_3491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3490, v ds
+# define BFI_FLINEAR3_3491_TICK(t)
+# define BFI_FLINEAR3_3490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3489, v ds
+# define BFI_FLINEAR3_3490_TICK(t)
+# define BFI_FLINEAR3_3489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3488, v ds
+# define BFI_FLINEAR3_3489_TICK(t)
+# define BFI_FLINEAR3_3488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3487, v ds
+# define BFI_FLINEAR3_3488_TICK(t)
+# define BFI_FLINEAR3_3487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3486, v ds
+# define BFI_FLINEAR3_3487_TICK(t)
+# define BFI_FLINEAR3_3486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3485, v ds
+# define BFI_FLINEAR3_3486_TICK(t)
+# define BFI_FLINEAR3_3485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3484, v ds
+# define BFI_FLINEAR3_3485_TICK(t)
+# define BFI_FLINEAR3_3484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3483, v ds
+# define BFI_FLINEAR3_3484_TICK(t)
+# define BFI_FLINEAR3_3483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3482, v ds
+# define BFI_FLINEAR3_3483_TICK(t)
+# define BFI_FLINEAR3_3482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3481, v ds
+# define BFI_FLINEAR3_3482_TICK(t)
+# define BFI_FLINEAR3_3481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3480, v ds
+# define BFI_FLINEAR3_3481_TICK(t)
+# define BFI_FLINEAR3_3480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3479, v ds
+# define BFI_FLINEAR3_3480_TICK(t)
+# define BFI_FLINEAR3_3479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3478, v ds
+# define BFI_FLINEAR3_3479_TICK(t)
+# define BFI_FLINEAR3_3478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3477, v ds
+# define BFI_FLINEAR3_3478_TICK(t)
+# define BFI_FLINEAR3_3477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3476, v ds
+# define BFI_FLINEAR3_3477_TICK(t)
+# define BFI_FLINEAR3_3476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3475, v ds
+# define BFI_FLINEAR3_3476_TICK(t)
+# define BFI_FLINEAR3_3475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3474, v ds
+# define BFI_FLINEAR3_3475_TICK(t)
+# define BFI_FLINEAR3_3474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3473, v ds
+# define BFI_FLINEAR3_3474_TICK(t)
+# define BFI_FLINEAR3_3473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3472, v ds
+# define BFI_FLINEAR3_3473_TICK(t)
+# define BFI_FLINEAR3_3472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3471, v ds
+# define BFI_FLINEAR3_3472_TICK(t)
+# define BFI_FLINEAR3_3471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3470, v ds
+# define BFI_FLINEAR3_3471_TICK(t)
+# define BFI_FLINEAR3_3470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3469, v ds
+# define BFI_FLINEAR3_3470_TICK(t)
+# define BFI_FLINEAR3_3469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3468, v ds
+# define BFI_FLINEAR3_3469_TICK(t)
+# define BFI_FLINEAR3_3468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3467, v ds
+# define BFI_FLINEAR3_3468_TICK(t)
+# define BFI_FLINEAR3_3467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3466, v ds
+# define BFI_FLINEAR3_3467_TICK(t)
+# define BFI_FLINEAR3_3466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3465, v ds
+# define BFI_FLINEAR3_3466_TICK(t)
+# define BFI_FLINEAR3_3465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3464, v ds
+# define BFI_FLINEAR3_3465_TICK(t)
+# define BFI_FLINEAR3_3464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3463, v ds
+# define BFI_FLINEAR3_3464_TICK(t)
+# define BFI_FLINEAR3_3463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3462, v ds
+# define BFI_FLINEAR3_3463_TICK(t)
+# define BFI_FLINEAR3_3462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3461, v ds
+# define BFI_FLINEAR3_3462_TICK(t)
+# define BFI_FLINEAR3_3461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3460, v ds
+# define BFI_FLINEAR3_3461_TICK(t)
+# define BFI_FLINEAR3_3460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3459, v ds
+# define BFI_FLINEAR3_3460_TICK(t)
+# define BFI_FLINEAR3_3459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3458, v ds
+# define BFI_FLINEAR3_3459_TICK(t)
+# define BFI_FLINEAR3_3458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3457, v ds
+# define BFI_FLINEAR3_3458_TICK(t)
+# define BFI_FLINEAR3_3457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3456, v ds
+# define BFI_FLINEAR3_3457_TICK(t)
+# define BFI_FLINEAR3_3456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3455, v ds
+# define BFI_FLINEAR3_3456_TICK(t)
+# define BFI_FLINEAR3_3455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3454, v ds
+# define BFI_FLINEAR3_3455_TICK(t)
+# define BFI_FLINEAR3_3454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3453, v ds
+# define BFI_FLINEAR3_3454_TICK(t)
+# define BFI_FLINEAR3_3453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3452, v ds
+# define BFI_FLINEAR3_3453_TICK(t)
+# define BFI_FLINEAR3_3452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3451, v ds
+# define BFI_FLINEAR3_3452_TICK(t)
+# define BFI_FLINEAR3_3451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3450, v ds
+# define BFI_FLINEAR3_3451_TICK(t)
+# define BFI_FLINEAR3_3450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3449, v ds
+# define BFI_FLINEAR3_3450_TICK(t)
+# define BFI_FLINEAR3_3449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3448, v ds
+# define BFI_FLINEAR3_3449_TICK(t)
+# define BFI_FLINEAR3_3448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3447, v ds
+# define BFI_FLINEAR3_3448_TICK(t)
+# define BFI_FLINEAR3_3447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3446, v ds
+# define BFI_FLINEAR3_3447_TICK(t)
+# define BFI_FLINEAR3_3446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3445, v ds
+# define BFI_FLINEAR3_3446_TICK(t)
+# define BFI_FLINEAR3_3445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3444, v ds
+# define BFI_FLINEAR3_3445_TICK(t)
+# define BFI_FLINEAR3_3444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3443, v ds
+# define BFI_FLINEAR3_3444_TICK(t)
+# define BFI_FLINEAR3_3443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3442, v ds
+# define BFI_FLINEAR3_3443_TICK(t)
+# define BFI_FLINEAR3_3442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3441, v ds
+# define BFI_FLINEAR3_3442_TICK(t)
+# define BFI_FLINEAR3_3441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3440, v ds
+# define BFI_FLINEAR3_3441_TICK(t)
+# define BFI_FLINEAR3_3440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3439, v ds
+# define BFI_FLINEAR3_3440_TICK(t)
+# define BFI_FLINEAR3_3439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3438, v ds
+# define BFI_FLINEAR3_3439_TICK(t)
+# define BFI_FLINEAR3_3438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3437, v ds
+# define BFI_FLINEAR3_3438_TICK(t)
+# define BFI_FLINEAR3_3437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3436, v ds
+# define BFI_FLINEAR3_3437_TICK(t)
+# define BFI_FLINEAR3_3436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3435, v ds
+# define BFI_FLINEAR3_3436_TICK(t)
+# define BFI_FLINEAR3_3435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3434, v ds
+# define BFI_FLINEAR3_3435_TICK(t)
+# define BFI_FLINEAR3_3434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3433, v ds
+# define BFI_FLINEAR3_3434_TICK(t)
+# define BFI_FLINEAR3_3433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3432, v ds
+# define BFI_FLINEAR3_3433_TICK(t)
+# define BFI_FLINEAR3_3432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3431, v ds
+# define BFI_FLINEAR3_3432_TICK(t)
+# define BFI_FLINEAR3_3431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3430, v ds
+# define BFI_FLINEAR3_3431_TICK(t)
+# define BFI_FLINEAR3_3430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3429, v ds
+# define BFI_FLINEAR3_3430_TICK(t)
+# define BFI_FLINEAR3_3429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3428, v ds
+# define BFI_FLINEAR3_3429_TICK(t)
+# define BFI_FLINEAR3_3428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3427, v ds
+# define BFI_FLINEAR3_3428_TICK(t)
+# define BFI_FLINEAR3_3427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3426, v ds
+# define BFI_FLINEAR3_3427_TICK(t)
+# define BFI_FLINEAR3_3426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3425, v ds
+# define BFI_FLINEAR3_3426_TICK(t)
+# define BFI_FLINEAR3_3425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3424, v ds
+# define BFI_FLINEAR3_3425_TICK(t)
+# define BFI_FLINEAR3_3424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3423, v ds
+# define BFI_FLINEAR3_3424_TICK(t)
+# define BFI_FLINEAR3_3423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3422, v ds
+# define BFI_FLINEAR3_3423_TICK(t)
+# define BFI_FLINEAR3_3422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3421, v ds
+# define BFI_FLINEAR3_3422_TICK(t)
+# define BFI_FLINEAR3_3421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3420, v ds
+# define BFI_FLINEAR3_3421_TICK(t)
+# define BFI_FLINEAR3_3420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3419, v ds
+# define BFI_FLINEAR3_3420_TICK(t)
+# define BFI_FLINEAR3_3419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3418, v ds
+# define BFI_FLINEAR3_3419_TICK(t)
+# define BFI_FLINEAR3_3418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3417, v ds
+# define BFI_FLINEAR3_3418_TICK(t)
+# define BFI_FLINEAR3_3417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3416, v ds
+# define BFI_FLINEAR3_3417_TICK(t)
+# define BFI_FLINEAR3_3416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3415, v ds
+# define BFI_FLINEAR3_3416_TICK(t)
+# define BFI_FLINEAR3_3415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3414, v ds
+# define BFI_FLINEAR3_3415_TICK(t)
+# define BFI_FLINEAR3_3414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3413, v ds
+# define BFI_FLINEAR3_3414_TICK(t)
+# define BFI_FLINEAR3_3413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3412, v ds
+# define BFI_FLINEAR3_3413_TICK(t)
+# define BFI_FLINEAR3_3412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3411, v ds
+# define BFI_FLINEAR3_3412_TICK(t)
+# define BFI_FLINEAR3_3411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3410, v ds
+# define BFI_FLINEAR3_3411_TICK(t)
+# define BFI_FLINEAR3_3410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3409, v ds
+# define BFI_FLINEAR3_3410_TICK(t)
+# define BFI_FLINEAR3_3409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3408, v ds
+# define BFI_FLINEAR3_3409_TICK(t)
+# define BFI_FLINEAR3_3408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3407, v ds
+# define BFI_FLINEAR3_3408_TICK(t)
+# define BFI_FLINEAR3_3407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3406, v ds
+# define BFI_FLINEAR3_3407_TICK(t)
+# define BFI_FLINEAR3_3406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3405, v ds
+# define BFI_FLINEAR3_3406_TICK(t)
+# define BFI_FLINEAR3_3405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3404, v ds
+# define BFI_FLINEAR3_3405_TICK(t)
+# define BFI_FLINEAR3_3404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3403, v ds
+# define BFI_FLINEAR3_3404_TICK(t)
+# define BFI_FLINEAR3_3403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3402, v ds
+# define BFI_FLINEAR3_3403_TICK(t)
+# define BFI_FLINEAR3_3402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3401, v ds
+# define BFI_FLINEAR3_3402_TICK(t)
+# define BFI_FLINEAR3_3401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3400, v ds
+# define BFI_FLINEAR3_3401_TICK(t)
+# define BFI_FLINEAR3_3400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3399, v ds
+# define BFI_FLINEAR3_3400_TICK(t)
+# define BFI_FLINEAR3_3399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3398, v ds
+# define BFI_FLINEAR3_3399_TICK(t)
+# define BFI_FLINEAR3_3398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3397, v ds
+# define BFI_FLINEAR3_3398_TICK(t)
+# define BFI_FLINEAR3_3397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3396, v ds
+# define BFI_FLINEAR3_3397_TICK(t)
+# define BFI_FLINEAR3_3396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3395, v ds
+# define BFI_FLINEAR3_3396_TICK(t)
+# define BFI_FLINEAR3_3395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3394, v ds
+# define BFI_FLINEAR3_3395_TICK(t)
+# define BFI_FLINEAR3_3394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3393, v ds
+# define BFI_FLINEAR3_3394_TICK(t)
+# define BFI_FLINEAR3_3393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3392, v ds
+# define BFI_FLINEAR3_3393_TICK(t)
+# define BFI_FLINEAR3_3392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3391, v ds
+# define BFI_FLINEAR3_3392_TICK(t)
+# define BFI_FLINEAR3_3391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3390, v ds
+# define BFI_FLINEAR3_3391_TICK(t)
+# define BFI_FLINEAR3_3390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3389, v ds
+# define BFI_FLINEAR3_3390_TICK(t)
+# define BFI_FLINEAR3_3389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3388, v ds
+# define BFI_FLINEAR3_3389_TICK(t)
+# define BFI_FLINEAR3_3388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3387, v ds
+# define BFI_FLINEAR3_3388_TICK(t)
+# define BFI_FLINEAR3_3387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3386, v ds
+# define BFI_FLINEAR3_3387_TICK(t)
+# define BFI_FLINEAR3_3386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3385, v ds
+# define BFI_FLINEAR3_3386_TICK(t)
+# define BFI_FLINEAR3_3385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3384, v ds
+# define BFI_FLINEAR3_3385_TICK(t)
+# define BFI_FLINEAR3_3384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3383, v ds
+# define BFI_FLINEAR3_3384_TICK(t)
+# define BFI_FLINEAR3_3383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3382, v ds
+# define BFI_FLINEAR3_3383_TICK(t)
+# define BFI_FLINEAR3_3382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3381, v ds
+# define BFI_FLINEAR3_3382_TICK(t)
+# define BFI_FLINEAR3_3381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3380, v ds
+# define BFI_FLINEAR3_3381_TICK(t)
+# define BFI_FLINEAR3_3380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3379, v ds
+# define BFI_FLINEAR3_3380_TICK(t)
+# define BFI_FLINEAR3_3379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3378, v ds
+# define BFI_FLINEAR3_3379_TICK(t)
+# define BFI_FLINEAR3_3378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3377, v ds
+# define BFI_FLINEAR3_3378_TICK(t)
+# define BFI_FLINEAR3_3377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3376, v ds
+# define BFI_FLINEAR3_3377_TICK(t)
+# define BFI_FLINEAR3_3376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3375, v ds
+# define BFI_FLINEAR3_3376_TICK(t)
+# define BFI_FLINEAR3_3375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3374, v ds
+# define BFI_FLINEAR3_3375_TICK(t)
+# define BFI_FLINEAR3_3374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3373, v ds
+# define BFI_FLINEAR3_3374_TICK(t)
+# define BFI_FLINEAR3_3373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3372, v ds
+# define BFI_FLINEAR3_3373_TICK(t)
+# define BFI_FLINEAR3_3372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3371, v ds
+# define BFI_FLINEAR3_3372_TICK(t)
+# define BFI_FLINEAR3_3371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3370, v ds
+# define BFI_FLINEAR3_3371_TICK(t)
+# define BFI_FLINEAR3_3370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3369, v ds
+# define BFI_FLINEAR3_3370_TICK(t)
+# define BFI_FLINEAR3_3369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3368, v ds
+# define BFI_FLINEAR3_3369_TICK(t)
+# define BFI_FLINEAR3_3368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3367, v ds
+# define BFI_FLINEAR3_3368_TICK(t)
+# define BFI_FLINEAR3_3367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3366, v ds
+# define BFI_FLINEAR3_3367_TICK(t)
+# define BFI_FLINEAR3_3366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3365, v ds
+# define BFI_FLINEAR3_3366_TICK(t)
+# define BFI_FLINEAR3_3365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3364, v ds
+# define BFI_FLINEAR3_3365_TICK(t)
+# define BFI_FLINEAR3_3364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3363, v ds
+# define BFI_FLINEAR3_3364_TICK(t)
+# define BFI_FLINEAR3_3363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3362, v ds
+# define BFI_FLINEAR3_3363_TICK(t)
+# define BFI_FLINEAR3_3362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3361, v ds
+# define BFI_FLINEAR3_3362_TICK(t)
+# define BFI_FLINEAR3_3361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3360, v ds
+# define BFI_FLINEAR3_3361_TICK(t)
+# define BFI_FLINEAR3_3360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3359, v ds
+# define BFI_FLINEAR3_3360_TICK(t)
+# define BFI_FLINEAR3_3359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3358, v ds
+# define BFI_FLINEAR3_3359_TICK(t)
+# define BFI_FLINEAR3_3358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3357, v ds
+# define BFI_FLINEAR3_3358_TICK(t)
+# define BFI_FLINEAR3_3357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3356, v ds
+# define BFI_FLINEAR3_3357_TICK(t)
+# define BFI_FLINEAR3_3356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3355, v ds
+# define BFI_FLINEAR3_3356_TICK(t)
+# define BFI_FLINEAR3_3355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3354, v ds
+# define BFI_FLINEAR3_3355_TICK(t)
+# define BFI_FLINEAR3_3354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3353, v ds
+# define BFI_FLINEAR3_3354_TICK(t)
+# define BFI_FLINEAR3_3353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3352, v ds
+# define BFI_FLINEAR3_3353_TICK(t)
+# define BFI_FLINEAR3_3352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3351, v ds
+# define BFI_FLINEAR3_3352_TICK(t)
+# define BFI_FLINEAR3_3351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3350, v ds
+# define BFI_FLINEAR3_3351_TICK(t)
+# define BFI_FLINEAR3_3350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3349, v ds
+# define BFI_FLINEAR3_3350_TICK(t)
+# define BFI_FLINEAR3_3349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3348, v ds
+# define BFI_FLINEAR3_3349_TICK(t)
+# define BFI_FLINEAR3_3348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3347, v ds
+# define BFI_FLINEAR3_3348_TICK(t)
+# define BFI_FLINEAR3_3347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3346, v ds
+# define BFI_FLINEAR3_3347_TICK(t)
+# define BFI_FLINEAR3_3346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3345, v ds
+# define BFI_FLINEAR3_3346_TICK(t)
+# define BFI_FLINEAR3_3345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3344, v ds
+# define BFI_FLINEAR3_3345_TICK(t)
+# define BFI_FLINEAR3_3344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3343, v ds
+# define BFI_FLINEAR3_3344_TICK(t)
+# define BFI_FLINEAR3_3343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3342, v ds
+# define BFI_FLINEAR3_3343_TICK(t)
+# define BFI_FLINEAR3_3342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3341, v ds
+# define BFI_FLINEAR3_3342_TICK(t)
+# define BFI_FLINEAR3_3341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3340, v ds
+# define BFI_FLINEAR3_3341_TICK(t)
+# define BFI_FLINEAR3_3340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3339, v ds
+# define BFI_FLINEAR3_3340_TICK(t)
+# define BFI_FLINEAR3_3339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3338, v ds
+# define BFI_FLINEAR3_3339_TICK(t)
+# define BFI_FLINEAR3_3338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3337, v ds
+# define BFI_FLINEAR3_3338_TICK(t)
+# define BFI_FLINEAR3_3337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3336, v ds
+# define BFI_FLINEAR3_3337_TICK(t)
+# define BFI_FLINEAR3_3336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3335, v ds
+# define BFI_FLINEAR3_3336_TICK(t)
+# define BFI_FLINEAR3_3335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3334, v ds
+# define BFI_FLINEAR3_3335_TICK(t)
+# define BFI_FLINEAR3_3334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3333, v ds
+# define BFI_FLINEAR3_3334_TICK(t)
+# define BFI_FLINEAR3_3333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3332, v ds
+# define BFI_FLINEAR3_3333_TICK(t)
+# define BFI_FLINEAR3_3332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3331, v ds
+# define BFI_FLINEAR3_3332_TICK(t)
+# define BFI_FLINEAR3_3331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3330, v ds
+# define BFI_FLINEAR3_3331_TICK(t)
+# define BFI_FLINEAR3_3330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3329, v ds
+# define BFI_FLINEAR3_3330_TICK(t)
+# define BFI_FLINEAR3_3329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3328, v ds
+# define BFI_FLINEAR3_3329_TICK(t)
+# define BFI_FLINEAR3_3328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3327, v ds
+# define BFI_FLINEAR3_3328_TICK(t)
+# define BFI_FLINEAR3_3327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3326, v ds
+# define BFI_FLINEAR3_3327_TICK(t)
+# define BFI_FLINEAR3_3326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3325, v ds
+# define BFI_FLINEAR3_3326_TICK(t)
+# define BFI_FLINEAR3_3325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3324, v ds
+# define BFI_FLINEAR3_3325_TICK(t)
+# define BFI_FLINEAR3_3324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3323, v ds
+# define BFI_FLINEAR3_3324_TICK(t)
+# define BFI_FLINEAR3_3323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3322, v ds
+# define BFI_FLINEAR3_3323_TICK(t)
+# define BFI_FLINEAR3_3322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3321, v ds
+# define BFI_FLINEAR3_3322_TICK(t)
+# define BFI_FLINEAR3_3321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3320, v ds
+# define BFI_FLINEAR3_3321_TICK(t)
+# define BFI_FLINEAR3_3320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3319, v ds
+# define BFI_FLINEAR3_3320_TICK(t)
+# define BFI_FLINEAR3_3319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3318, v ds
+# define BFI_FLINEAR3_3319_TICK(t)
+# define BFI_FLINEAR3_3318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3317, v ds
+# define BFI_FLINEAR3_3318_TICK(t)
+# define BFI_FLINEAR3_3317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3316, v ds
+# define BFI_FLINEAR3_3317_TICK(t)
+# define BFI_FLINEAR3_3316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3315, v ds
+# define BFI_FLINEAR3_3316_TICK(t)
+# define BFI_FLINEAR3_3315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3314, v ds
+# define BFI_FLINEAR3_3315_TICK(t)
+# define BFI_FLINEAR3_3314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3313, v ds
+# define BFI_FLINEAR3_3314_TICK(t)
+# define BFI_FLINEAR3_3313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3312, v ds
+# define BFI_FLINEAR3_3313_TICK(t)
+# define BFI_FLINEAR3_3312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3311, v ds
+# define BFI_FLINEAR3_3312_TICK(t)
+# define BFI_FLINEAR3_3311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3310, v ds
+# define BFI_FLINEAR3_3311_TICK(t)
+# define BFI_FLINEAR3_3310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3309, v ds
+# define BFI_FLINEAR3_3310_TICK(t)
+# define BFI_FLINEAR3_3309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3308, v ds
+# define BFI_FLINEAR3_3309_TICK(t)
+# define BFI_FLINEAR3_3308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3307, v ds
+# define BFI_FLINEAR3_3308_TICK(t)
+# define BFI_FLINEAR3_3307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3306, v ds
+# define BFI_FLINEAR3_3307_TICK(t)
+# define BFI_FLINEAR3_3306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3305, v ds
+# define BFI_FLINEAR3_3306_TICK(t)
+# define BFI_FLINEAR3_3305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3304, v ds
+# define BFI_FLINEAR3_3305_TICK(t)
+# define BFI_FLINEAR3_3304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3303, v ds
+# define BFI_FLINEAR3_3304_TICK(t)
+# define BFI_FLINEAR3_3303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3302, v ds
+# define BFI_FLINEAR3_3303_TICK(t)
+# define BFI_FLINEAR3_3302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3301, v ds
+# define BFI_FLINEAR3_3302_TICK(t)
+# define BFI_FLINEAR3_3301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3300, v ds
+# define BFI_FLINEAR3_3301_TICK(t)
+# define BFI_FLINEAR3_3300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3299, v ds
+# define BFI_FLINEAR3_3300_TICK(t)
+# define BFI_FLINEAR3_3299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3298, v ds
+# define BFI_FLINEAR3_3299_TICK(t)
+# define BFI_FLINEAR3_3298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3297, v ds
+# define BFI_FLINEAR3_3298_TICK(t)
+# define BFI_FLINEAR3_3297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3296, v ds
+# define BFI_FLINEAR3_3297_TICK(t)
+# define BFI_FLINEAR3_3296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3295, v ds
+# define BFI_FLINEAR3_3296_TICK(t)
+# define BFI_FLINEAR3_3295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3294, v ds
+# define BFI_FLINEAR3_3295_TICK(t)
+# define BFI_FLINEAR3_3294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3293, v ds
+# define BFI_FLINEAR3_3294_TICK(t)
+# define BFI_FLINEAR3_3293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3292, v ds
+# define BFI_FLINEAR3_3293_TICK(t)
+# define BFI_FLINEAR3_3292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3291, v ds
+# define BFI_FLINEAR3_3292_TICK(t)
+# define BFI_FLINEAR3_3291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3290, v ds
+# define BFI_FLINEAR3_3291_TICK(t)
+# define BFI_FLINEAR3_3290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3289, v ds
+# define BFI_FLINEAR3_3290_TICK(t)
+# define BFI_FLINEAR3_3289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3288, v ds
+# define BFI_FLINEAR3_3289_TICK(t)
+# define BFI_FLINEAR3_3288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3287, v ds
+# define BFI_FLINEAR3_3288_TICK(t)
+# define BFI_FLINEAR3_3287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3286, v ds
+# define BFI_FLINEAR3_3287_TICK(t)
+# define BFI_FLINEAR3_3286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3285, v ds
+# define BFI_FLINEAR3_3286_TICK(t)
+# define BFI_FLINEAR3_3285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3284, v ds
+# define BFI_FLINEAR3_3285_TICK(t)
+# define BFI_FLINEAR3_3284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3283, v ds
+# define BFI_FLINEAR3_3284_TICK(t)
+# define BFI_FLINEAR3_3283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3282, v ds
+# define BFI_FLINEAR3_3283_TICK(t)
+# define BFI_FLINEAR3_3282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3281, v ds
+# define BFI_FLINEAR3_3282_TICK(t)
+# define BFI_FLINEAR3_3281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3280, v ds
+# define BFI_FLINEAR3_3281_TICK(t)
+# define BFI_FLINEAR3_3280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3279, v ds
+# define BFI_FLINEAR3_3280_TICK(t)
+# define BFI_FLINEAR3_3279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3278, v ds
+# define BFI_FLINEAR3_3279_TICK(t)
+# define BFI_FLINEAR3_3278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3277, v ds
+# define BFI_FLINEAR3_3278_TICK(t)
+# define BFI_FLINEAR3_3277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3276, v ds
+# define BFI_FLINEAR3_3277_TICK(t)
+# define BFI_FLINEAR3_3276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3275, v ds
+# define BFI_FLINEAR3_3276_TICK(t)
+# define BFI_FLINEAR3_3275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3274, v ds
+# define BFI_FLINEAR3_3275_TICK(t)
+# define BFI_FLINEAR3_3274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3273, v ds
+# define BFI_FLINEAR3_3274_TICK(t)
+# define BFI_FLINEAR3_3273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3272, v ds
+# define BFI_FLINEAR3_3273_TICK(t)
+# define BFI_FLINEAR3_3272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3271, v ds
+# define BFI_FLINEAR3_3272_TICK(t)
+# define BFI_FLINEAR3_3271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3270, v ds
+# define BFI_FLINEAR3_3271_TICK(t)
+# define BFI_FLINEAR3_3270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3269, v ds
+# define BFI_FLINEAR3_3270_TICK(t)
+# define BFI_FLINEAR3_3269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3268, v ds
+# define BFI_FLINEAR3_3269_TICK(t)
+# define BFI_FLINEAR3_3268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3267, v ds
+# define BFI_FLINEAR3_3268_TICK(t)
+# define BFI_FLINEAR3_3267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3266, v ds
+# define BFI_FLINEAR3_3267_TICK(t)
+# define BFI_FLINEAR3_3266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3265, v ds
+# define BFI_FLINEAR3_3266_TICK(t)
+# define BFI_FLINEAR3_3265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3264, v ds
+# define BFI_FLINEAR3_3265_TICK(t)
+# define BFI_FLINEAR3_3264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3263, v ds
+# define BFI_FLINEAR3_3264_TICK(t)
+# define BFI_FLINEAR3_3263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3262, v ds
+# define BFI_FLINEAR3_3263_TICK(t)
+# define BFI_FLINEAR3_3262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3261, v ds
+# define BFI_FLINEAR3_3262_TICK(t)
+# define BFI_FLINEAR3_3261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3260, v ds
+# define BFI_FLINEAR3_3261_TICK(t)
+# define BFI_FLINEAR3_3260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3259, v ds
+# define BFI_FLINEAR3_3260_TICK(t)
+# define BFI_FLINEAR3_3259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3258, v ds
+# define BFI_FLINEAR3_3259_TICK(t)
+# define BFI_FLINEAR3_3258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3257, v ds
+# define BFI_FLINEAR3_3258_TICK(t)
+# define BFI_FLINEAR3_3257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3256, v ds
+# define BFI_FLINEAR3_3257_TICK(t)
+# define BFI_FLINEAR3_3256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3255, v ds
+# define BFI_FLINEAR3_3256_TICK(t)
+# define BFI_FLINEAR3_3255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3254, v ds
+# define BFI_FLINEAR3_3255_TICK(t)
+# define BFI_FLINEAR3_3254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3253, v ds
+# define BFI_FLINEAR3_3254_TICK(t)
+# define BFI_FLINEAR3_3253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3252, v ds
+# define BFI_FLINEAR3_3253_TICK(t)
+# define BFI_FLINEAR3_3252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3251, v ds
+# define BFI_FLINEAR3_3252_TICK(t)
+# define BFI_FLINEAR3_3251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3250, v ds
+# define BFI_FLINEAR3_3251_TICK(t)
+# define BFI_FLINEAR3_3250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3249, v ds
+# define BFI_FLINEAR3_3250_TICK(t)
+# define BFI_FLINEAR3_3249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3248, v ds
+# define BFI_FLINEAR3_3249_TICK(t)
+# define BFI_FLINEAR3_3248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3247, v ds
+# define BFI_FLINEAR3_3248_TICK(t)
+# define BFI_FLINEAR3_3247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3246, v ds
+# define BFI_FLINEAR3_3247_TICK(t)
+# define BFI_FLINEAR3_3246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3245, v ds
+# define BFI_FLINEAR3_3246_TICK(t)
+# define BFI_FLINEAR3_3245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3244, v ds
+# define BFI_FLINEAR3_3245_TICK(t)
+# define BFI_FLINEAR3_3244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3243, v ds
+# define BFI_FLINEAR3_3244_TICK(t)
+# define BFI_FLINEAR3_3243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3242, v ds
+# define BFI_FLINEAR3_3243_TICK(t)
+# define BFI_FLINEAR3_3242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3241, v ds
+# define BFI_FLINEAR3_3242_TICK(t)
+# define BFI_FLINEAR3_3241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3240, v ds
+# define BFI_FLINEAR3_3241_TICK(t)
+# define BFI_FLINEAR3_3240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3239, v ds
+# define BFI_FLINEAR3_3240_TICK(t)
+# define BFI_FLINEAR3_3239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3238, v ds
+# define BFI_FLINEAR3_3239_TICK(t)
+# define BFI_FLINEAR3_3238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3237, v ds
+# define BFI_FLINEAR3_3238_TICK(t)
+# define BFI_FLINEAR3_3237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3236, v ds
+# define BFI_FLINEAR3_3237_TICK(t)
+# define BFI_FLINEAR3_3236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3235, v ds
+# define BFI_FLINEAR3_3236_TICK(t)
+# define BFI_FLINEAR3_3235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3234, v ds
+# define BFI_FLINEAR3_3235_TICK(t)
+# define BFI_FLINEAR3_3234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3233, v ds
+# define BFI_FLINEAR3_3234_TICK(t)
+# define BFI_FLINEAR3_3233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3232, v ds
+# define BFI_FLINEAR3_3233_TICK(t)
+# define BFI_FLINEAR3_3232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3231, v ds
+# define BFI_FLINEAR3_3232_TICK(t)
+# define BFI_FLINEAR3_3231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3230, v ds
+# define BFI_FLINEAR3_3231_TICK(t)
+# define BFI_FLINEAR3_3230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3229, v ds
+# define BFI_FLINEAR3_3230_TICK(t)
+# define BFI_FLINEAR3_3229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3228, v ds
+# define BFI_FLINEAR3_3229_TICK(t)
+# define BFI_FLINEAR3_3228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3227, v ds
+# define BFI_FLINEAR3_3228_TICK(t)
+# define BFI_FLINEAR3_3227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3226, v ds
+# define BFI_FLINEAR3_3227_TICK(t)
+# define BFI_FLINEAR3_3226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3225, v ds
+# define BFI_FLINEAR3_3226_TICK(t)
+# define BFI_FLINEAR3_3225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3224, v ds
+# define BFI_FLINEAR3_3225_TICK(t)
+# define BFI_FLINEAR3_3224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3223, v ds
+# define BFI_FLINEAR3_3224_TICK(t)
+# define BFI_FLINEAR3_3223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3222, v ds
+# define BFI_FLINEAR3_3223_TICK(t)
+# define BFI_FLINEAR3_3222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3221, v ds
+# define BFI_FLINEAR3_3222_TICK(t)
+# define BFI_FLINEAR3_3221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3220, v ds
+# define BFI_FLINEAR3_3221_TICK(t)
+# define BFI_FLINEAR3_3220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3219, v ds
+# define BFI_FLINEAR3_3220_TICK(t)
+# define BFI_FLINEAR3_3219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3218, v ds
+# define BFI_FLINEAR3_3219_TICK(t)
+# define BFI_FLINEAR3_3218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3217, v ds
+# define BFI_FLINEAR3_3218_TICK(t)
+# define BFI_FLINEAR3_3217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3216, v ds
+# define BFI_FLINEAR3_3217_TICK(t)
+# define BFI_FLINEAR3_3216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3215, v ds
+# define BFI_FLINEAR3_3216_TICK(t)
+# define BFI_FLINEAR3_3215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3214, v ds
+# define BFI_FLINEAR3_3215_TICK(t)
+# define BFI_FLINEAR3_3214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3213, v ds
+# define BFI_FLINEAR3_3214_TICK(t)
+# define BFI_FLINEAR3_3213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3212, v ds
+# define BFI_FLINEAR3_3213_TICK(t)
+# define BFI_FLINEAR3_3212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3211, v ds
+# define BFI_FLINEAR3_3212_TICK(t)
+# define BFI_FLINEAR3_3211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3210, v ds
+# define BFI_FLINEAR3_3211_TICK(t)
+# define BFI_FLINEAR3_3210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3209, v ds
+# define BFI_FLINEAR3_3210_TICK(t)
+# define BFI_FLINEAR3_3209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3208, v ds
+# define BFI_FLINEAR3_3209_TICK(t)
+# define BFI_FLINEAR3_3208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3207, v ds
+# define BFI_FLINEAR3_3208_TICK(t)
+# define BFI_FLINEAR3_3207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3206, v ds
+# define BFI_FLINEAR3_3207_TICK(t)
+# define BFI_FLINEAR3_3206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3205, v ds
+# define BFI_FLINEAR3_3206_TICK(t)
+# define BFI_FLINEAR3_3205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3204, v ds
+# define BFI_FLINEAR3_3205_TICK(t)
+# define BFI_FLINEAR3_3204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3203, v ds
+# define BFI_FLINEAR3_3204_TICK(t)
+# define BFI_FLINEAR3_3203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3202, v ds
+# define BFI_FLINEAR3_3203_TICK(t)
+# define BFI_FLINEAR3_3202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3201, v ds
+# define BFI_FLINEAR3_3202_TICK(t)
+# define BFI_FLINEAR3_3201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3200, v ds
+# define BFI_FLINEAR3_3201_TICK(t)
+# define BFI_FLINEAR3_3200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3199, v ds
+# define BFI_FLINEAR3_3200_TICK(t)
+# define BFI_FLINEAR3_3199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3198, v ds
+# define BFI_FLINEAR3_3199_TICK(t)
+# define BFI_FLINEAR3_3198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3197, v ds
+# define BFI_FLINEAR3_3198_TICK(t)
+# define BFI_FLINEAR3_3197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3196, v ds
+# define BFI_FLINEAR3_3197_TICK(t)
+# define BFI_FLINEAR3_3196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3195, v ds
+# define BFI_FLINEAR3_3196_TICK(t)
+# define BFI_FLINEAR3_3195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3194, v ds
+# define BFI_FLINEAR3_3195_TICK(t)
+# define BFI_FLINEAR3_3194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3193, v ds
+# define BFI_FLINEAR3_3194_TICK(t)
+# define BFI_FLINEAR3_3193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3192, v ds
+# define BFI_FLINEAR3_3193_TICK(t)
+# define BFI_FLINEAR3_3192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3191, v ds
+# define BFI_FLINEAR3_3192_TICK(t)
+# define BFI_FLINEAR3_3191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3190, v ds
+# define BFI_FLINEAR3_3191_TICK(t)
+# define BFI_FLINEAR3_3190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3189, v ds
+# define BFI_FLINEAR3_3190_TICK(t)
+# define BFI_FLINEAR3_3189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3188, v ds
+# define BFI_FLINEAR3_3189_TICK(t)
+# define BFI_FLINEAR3_3188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3187, v ds
+# define BFI_FLINEAR3_3188_TICK(t)
+# define BFI_FLINEAR3_3187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3186, v ds
+# define BFI_FLINEAR3_3187_TICK(t)
+# define BFI_FLINEAR3_3186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3185, v ds
+# define BFI_FLINEAR3_3186_TICK(t)
+# define BFI_FLINEAR3_3185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3184, v ds
+# define BFI_FLINEAR3_3185_TICK(t)
+# define BFI_FLINEAR3_3184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3183, v ds
+# define BFI_FLINEAR3_3184_TICK(t)
+# define BFI_FLINEAR3_3183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3182, v ds
+# define BFI_FLINEAR3_3183_TICK(t)
+# define BFI_FLINEAR3_3182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3181, v ds
+# define BFI_FLINEAR3_3182_TICK(t)
+# define BFI_FLINEAR3_3181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3180, v ds
+# define BFI_FLINEAR3_3181_TICK(t)
+# define BFI_FLINEAR3_3180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3179, v ds
+# define BFI_FLINEAR3_3180_TICK(t)
+# define BFI_FLINEAR3_3179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3178, v ds
+# define BFI_FLINEAR3_3179_TICK(t)
+# define BFI_FLINEAR3_3178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3177, v ds
+# define BFI_FLINEAR3_3178_TICK(t)
+# define BFI_FLINEAR3_3177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3176, v ds
+# define BFI_FLINEAR3_3177_TICK(t)
+# define BFI_FLINEAR3_3176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3175, v ds
+# define BFI_FLINEAR3_3176_TICK(t)
+# define BFI_FLINEAR3_3175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3174, v ds
+# define BFI_FLINEAR3_3175_TICK(t)
+# define BFI_FLINEAR3_3174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3173, v ds
+# define BFI_FLINEAR3_3174_TICK(t)
+# define BFI_FLINEAR3_3173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3172, v ds
+# define BFI_FLINEAR3_3173_TICK(t)
+# define BFI_FLINEAR3_3172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3171, v ds
+# define BFI_FLINEAR3_3172_TICK(t)
+# define BFI_FLINEAR3_3171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3170, v ds
+# define BFI_FLINEAR3_3171_TICK(t)
+# define BFI_FLINEAR3_3170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3169, v ds
+# define BFI_FLINEAR3_3170_TICK(t)
+# define BFI_FLINEAR3_3169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3168, v ds
+# define BFI_FLINEAR3_3169_TICK(t)
+# define BFI_FLINEAR3_3168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3167, v ds
+# define BFI_FLINEAR3_3168_TICK(t)
+# define BFI_FLINEAR3_3167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3166, v ds
+# define BFI_FLINEAR3_3167_TICK(t)
+# define BFI_FLINEAR3_3166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3165, v ds
+# define BFI_FLINEAR3_3166_TICK(t)
+# define BFI_FLINEAR3_3165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3164, v ds
+# define BFI_FLINEAR3_3165_TICK(t)
+# define BFI_FLINEAR3_3164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3163, v ds
+# define BFI_FLINEAR3_3164_TICK(t)
+# define BFI_FLINEAR3_3163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3162, v ds
+# define BFI_FLINEAR3_3163_TICK(t)
+# define BFI_FLINEAR3_3162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3161, v ds
+# define BFI_FLINEAR3_3162_TICK(t)
+# define BFI_FLINEAR3_3161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3160, v ds
+# define BFI_FLINEAR3_3161_TICK(t)
+# define BFI_FLINEAR3_3160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3159, v ds
+# define BFI_FLINEAR3_3160_TICK(t)
+# define BFI_FLINEAR3_3159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3158, v ds
+# define BFI_FLINEAR3_3159_TICK(t)
+# define BFI_FLINEAR3_3158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3157, v ds
+# define BFI_FLINEAR3_3158_TICK(t)
+# define BFI_FLINEAR3_3157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3156, v ds
+# define BFI_FLINEAR3_3157_TICK(t)
+# define BFI_FLINEAR3_3156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3155, v ds
+# define BFI_FLINEAR3_3156_TICK(t)
+# define BFI_FLINEAR3_3155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3154, v ds
+# define BFI_FLINEAR3_3155_TICK(t)
+# define BFI_FLINEAR3_3154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3153, v ds
+# define BFI_FLINEAR3_3154_TICK(t)
+# define BFI_FLINEAR3_3153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3152, v ds
+# define BFI_FLINEAR3_3153_TICK(t)
+# define BFI_FLINEAR3_3152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3151, v ds
+# define BFI_FLINEAR3_3152_TICK(t)
+# define BFI_FLINEAR3_3151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3150, v ds
+# define BFI_FLINEAR3_3151_TICK(t)
+# define BFI_FLINEAR3_3150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3149, v ds
+# define BFI_FLINEAR3_3150_TICK(t)
+# define BFI_FLINEAR3_3149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3148, v ds
+# define BFI_FLINEAR3_3149_TICK(t)
+# define BFI_FLINEAR3_3148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3147, v ds
+# define BFI_FLINEAR3_3148_TICK(t)
+# define BFI_FLINEAR3_3147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3146, v ds
+# define BFI_FLINEAR3_3147_TICK(t)
+# define BFI_FLINEAR3_3146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3145, v ds
+# define BFI_FLINEAR3_3146_TICK(t)
+# define BFI_FLINEAR3_3145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3144, v ds
+# define BFI_FLINEAR3_3145_TICK(t)
+# define BFI_FLINEAR3_3144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3143, v ds
+# define BFI_FLINEAR3_3144_TICK(t)
+# define BFI_FLINEAR3_3143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3142, v ds
+# define BFI_FLINEAR3_3143_TICK(t)
+# define BFI_FLINEAR3_3142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3141, v ds
+# define BFI_FLINEAR3_3142_TICK(t)
+# define BFI_FLINEAR3_3141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3140, v ds
+# define BFI_FLINEAR3_3141_TICK(t)
+# define BFI_FLINEAR3_3140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3139, v ds
+# define BFI_FLINEAR3_3140_TICK(t)
+# define BFI_FLINEAR3_3139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3138, v ds
+# define BFI_FLINEAR3_3139_TICK(t)
+# define BFI_FLINEAR3_3138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3137, v ds
+# define BFI_FLINEAR3_3138_TICK(t)
+# define BFI_FLINEAR3_3137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3136, v ds
+# define BFI_FLINEAR3_3137_TICK(t)
+# define BFI_FLINEAR3_3136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3135, v ds
+# define BFI_FLINEAR3_3136_TICK(t)
+# define BFI_FLINEAR3_3135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3134, v ds
+# define BFI_FLINEAR3_3135_TICK(t)
+# define BFI_FLINEAR3_3134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3133, v ds
+# define BFI_FLINEAR3_3134_TICK(t)
+# define BFI_FLINEAR3_3133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3132, v ds
+# define BFI_FLINEAR3_3133_TICK(t)
+# define BFI_FLINEAR3_3132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3131, v ds
+# define BFI_FLINEAR3_3132_TICK(t)
+# define BFI_FLINEAR3_3131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3130, v ds
+# define BFI_FLINEAR3_3131_TICK(t)
+# define BFI_FLINEAR3_3130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3129, v ds
+# define BFI_FLINEAR3_3130_TICK(t)
+# define BFI_FLINEAR3_3129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3128, v ds
+# define BFI_FLINEAR3_3129_TICK(t)
+# define BFI_FLINEAR3_3128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3127, v ds
+# define BFI_FLINEAR3_3128_TICK(t)
+# define BFI_FLINEAR3_3127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3126, v ds
+# define BFI_FLINEAR3_3127_TICK(t)
+# define BFI_FLINEAR3_3126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3125, v ds
+# define BFI_FLINEAR3_3126_TICK(t)
+# define BFI_FLINEAR3_3125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3124, v ds
+# define BFI_FLINEAR3_3125_TICK(t)
+# define BFI_FLINEAR3_3124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3123, v ds
+# define BFI_FLINEAR3_3124_TICK(t)
+# define BFI_FLINEAR3_3123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3122, v ds
+# define BFI_FLINEAR3_3123_TICK(t)
+# define BFI_FLINEAR3_3122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3121, v ds
+# define BFI_FLINEAR3_3122_TICK(t)
+# define BFI_FLINEAR3_3121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3120, v ds
+# define BFI_FLINEAR3_3121_TICK(t)
+# define BFI_FLINEAR3_3120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3119, v ds
+# define BFI_FLINEAR3_3120_TICK(t)
+# define BFI_FLINEAR3_3119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3118, v ds
+# define BFI_FLINEAR3_3119_TICK(t)
+# define BFI_FLINEAR3_3118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3117, v ds
+# define BFI_FLINEAR3_3118_TICK(t)
+# define BFI_FLINEAR3_3117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3116, v ds
+# define BFI_FLINEAR3_3117_TICK(t)
+# define BFI_FLINEAR3_3116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3115, v ds
+# define BFI_FLINEAR3_3116_TICK(t)
+# define BFI_FLINEAR3_3115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3114, v ds
+# define BFI_FLINEAR3_3115_TICK(t)
+# define BFI_FLINEAR3_3114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3113, v ds
+# define BFI_FLINEAR3_3114_TICK(t)
+# define BFI_FLINEAR3_3113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3112, v ds
+# define BFI_FLINEAR3_3113_TICK(t)
+# define BFI_FLINEAR3_3112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3111, v ds
+# define BFI_FLINEAR3_3112_TICK(t)
+# define BFI_FLINEAR3_3111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3110, v ds
+# define BFI_FLINEAR3_3111_TICK(t)
+# define BFI_FLINEAR3_3110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3109, v ds
+# define BFI_FLINEAR3_3110_TICK(t)
+# define BFI_FLINEAR3_3109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3108, v ds
+# define BFI_FLINEAR3_3109_TICK(t)
+# define BFI_FLINEAR3_3108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3107, v ds
+# define BFI_FLINEAR3_3108_TICK(t)
+# define BFI_FLINEAR3_3107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3106, v ds
+# define BFI_FLINEAR3_3107_TICK(t)
+# define BFI_FLINEAR3_3106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3105, v ds
+# define BFI_FLINEAR3_3106_TICK(t)
+# define BFI_FLINEAR3_3105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3104, v ds
+# define BFI_FLINEAR3_3105_TICK(t)
+# define BFI_FLINEAR3_3104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3103, v ds
+# define BFI_FLINEAR3_3104_TICK(t)
+# define BFI_FLINEAR3_3103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3102, v ds
+# define BFI_FLINEAR3_3103_TICK(t)
+# define BFI_FLINEAR3_3102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3101, v ds
+# define BFI_FLINEAR3_3102_TICK(t)
+# define BFI_FLINEAR3_3101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3100, v ds
+# define BFI_FLINEAR3_3101_TICK(t)
+# define BFI_FLINEAR3_3100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3099, v ds
+# define BFI_FLINEAR3_3100_TICK(t)
+# define BFI_FLINEAR3_3099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3098, v ds
+# define BFI_FLINEAR3_3099_TICK(t)
+# define BFI_FLINEAR3_3098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3097, v ds
+# define BFI_FLINEAR3_3098_TICK(t)
+# define BFI_FLINEAR3_3097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3096, v ds
+# define BFI_FLINEAR3_3097_TICK(t)
+# define BFI_FLINEAR3_3096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3095, v ds
+# define BFI_FLINEAR3_3096_TICK(t)
+# define BFI_FLINEAR3_3095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3094, v ds
+# define BFI_FLINEAR3_3095_TICK(t)
+# define BFI_FLINEAR3_3094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3093, v ds
+# define BFI_FLINEAR3_3094_TICK(t)
+# define BFI_FLINEAR3_3093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3092, v ds
+# define BFI_FLINEAR3_3093_TICK(t)
+# define BFI_FLINEAR3_3092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3091, v ds
+# define BFI_FLINEAR3_3092_TICK(t)
+# define BFI_FLINEAR3_3091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3090, v ds
+# define BFI_FLINEAR3_3091_TICK(t)
+# define BFI_FLINEAR3_3090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3089, v ds
+# define BFI_FLINEAR3_3090_TICK(t)
+# define BFI_FLINEAR3_3089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3088, v ds
+# define BFI_FLINEAR3_3089_TICK(t)
+# define BFI_FLINEAR3_3088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3087, v ds
+# define BFI_FLINEAR3_3088_TICK(t)
+# define BFI_FLINEAR3_3087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3086, v ds
+# define BFI_FLINEAR3_3087_TICK(t)
+# define BFI_FLINEAR3_3086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3085, v ds
+# define BFI_FLINEAR3_3086_TICK(t)
+# define BFI_FLINEAR3_3085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3084, v ds
+# define BFI_FLINEAR3_3085_TICK(t)
+# define BFI_FLINEAR3_3084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3083, v ds
+# define BFI_FLINEAR3_3084_TICK(t)
+# define BFI_FLINEAR3_3083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3082, v ds
+# define BFI_FLINEAR3_3083_TICK(t)
+# define BFI_FLINEAR3_3082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3081, v ds
+# define BFI_FLINEAR3_3082_TICK(t)
+# define BFI_FLINEAR3_3081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3080, v ds
+# define BFI_FLINEAR3_3081_TICK(t)
+# define BFI_FLINEAR3_3080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3079, v ds
+# define BFI_FLINEAR3_3080_TICK(t)
+# define BFI_FLINEAR3_3079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3078, v ds
+# define BFI_FLINEAR3_3079_TICK(t)
+# define BFI_FLINEAR3_3078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3077, v ds
+# define BFI_FLINEAR3_3078_TICK(t)
+# define BFI_FLINEAR3_3077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3076, v ds
+# define BFI_FLINEAR3_3077_TICK(t)
+# define BFI_FLINEAR3_3076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3075, v ds
+# define BFI_FLINEAR3_3076_TICK(t)
+# define BFI_FLINEAR3_3075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3074, v ds
+# define BFI_FLINEAR3_3075_TICK(t)
+# define BFI_FLINEAR3_3074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3073, v ds
+# define BFI_FLINEAR3_3074_TICK(t)
+# define BFI_FLINEAR3_3073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3072, v ds
+# define BFI_FLINEAR3_3073_TICK(t)
+# define BFI_FLINEAR3_3072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3071, v ds
+# define BFI_FLINEAR3_3072_TICK(t)
+# define BFI_FLINEAR3_3071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3070, v ds
+# define BFI_FLINEAR3_3071_TICK(t)
+# define BFI_FLINEAR3_3070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3069, v ds
+# define BFI_FLINEAR3_3070_TICK(t)
+# define BFI_FLINEAR3_3069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3068, v ds
+# define BFI_FLINEAR3_3069_TICK(t)
+# define BFI_FLINEAR3_3068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3067, v ds
+# define BFI_FLINEAR3_3068_TICK(t)
+# define BFI_FLINEAR3_3067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3066, v ds
+# define BFI_FLINEAR3_3067_TICK(t)
+# define BFI_FLINEAR3_3066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3065, v ds
+# define BFI_FLINEAR3_3066_TICK(t)
+# define BFI_FLINEAR3_3065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3064, v ds
+# define BFI_FLINEAR3_3065_TICK(t)
+# define BFI_FLINEAR3_3064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3063, v ds
+# define BFI_FLINEAR3_3064_TICK(t)
+# define BFI_FLINEAR3_3063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3062, v ds
+# define BFI_FLINEAR3_3063_TICK(t)
+# define BFI_FLINEAR3_3062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3061, v ds
+# define BFI_FLINEAR3_3062_TICK(t)
+# define BFI_FLINEAR3_3061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3060, v ds
+# define BFI_FLINEAR3_3061_TICK(t)
+# define BFI_FLINEAR3_3060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3059, v ds
+# define BFI_FLINEAR3_3060_TICK(t)
+# define BFI_FLINEAR3_3059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3058, v ds
+# define BFI_FLINEAR3_3059_TICK(t)
+# define BFI_FLINEAR3_3058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3057, v ds
+# define BFI_FLINEAR3_3058_TICK(t)
+# define BFI_FLINEAR3_3057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3056, v ds
+# define BFI_FLINEAR3_3057_TICK(t)
+# define BFI_FLINEAR3_3056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3055, v ds
+# define BFI_FLINEAR3_3056_TICK(t)
+# define BFI_FLINEAR3_3055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3054, v ds
+# define BFI_FLINEAR3_3055_TICK(t)
+# define BFI_FLINEAR3_3054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3053, v ds
+# define BFI_FLINEAR3_3054_TICK(t)
+# define BFI_FLINEAR3_3053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3052, v ds
+# define BFI_FLINEAR3_3053_TICK(t)
+# define BFI_FLINEAR3_3052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3051, v ds
+# define BFI_FLINEAR3_3052_TICK(t)
+# define BFI_FLINEAR3_3051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3050, v ds
+# define BFI_FLINEAR3_3051_TICK(t)
+# define BFI_FLINEAR3_3050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3049, v ds
+# define BFI_FLINEAR3_3050_TICK(t)
+# define BFI_FLINEAR3_3049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3048, v ds
+# define BFI_FLINEAR3_3049_TICK(t)
+# define BFI_FLINEAR3_3048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3047, v ds
+# define BFI_FLINEAR3_3048_TICK(t)
+# define BFI_FLINEAR3_3047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3046, v ds
+# define BFI_FLINEAR3_3047_TICK(t)
+# define BFI_FLINEAR3_3046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3045, v ds
+# define BFI_FLINEAR3_3046_TICK(t)
+# define BFI_FLINEAR3_3045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3044, v ds
+# define BFI_FLINEAR3_3045_TICK(t)
+# define BFI_FLINEAR3_3044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3043, v ds
+# define BFI_FLINEAR3_3044_TICK(t)
+# define BFI_FLINEAR3_3043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3042, v ds
+# define BFI_FLINEAR3_3043_TICK(t)
+# define BFI_FLINEAR3_3042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3041, v ds
+# define BFI_FLINEAR3_3042_TICK(t)
+# define BFI_FLINEAR3_3041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3040, v ds
+# define BFI_FLINEAR3_3041_TICK(t)
+# define BFI_FLINEAR3_3040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3039, v ds
+# define BFI_FLINEAR3_3040_TICK(t)
+# define BFI_FLINEAR3_3039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3038, v ds
+# define BFI_FLINEAR3_3039_TICK(t)
+# define BFI_FLINEAR3_3038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3037, v ds
+# define BFI_FLINEAR3_3038_TICK(t)
+# define BFI_FLINEAR3_3037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3036, v ds
+# define BFI_FLINEAR3_3037_TICK(t)
+# define BFI_FLINEAR3_3036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3035, v ds
+# define BFI_FLINEAR3_3036_TICK(t)
+# define BFI_FLINEAR3_3035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3034, v ds
+# define BFI_FLINEAR3_3035_TICK(t)
+# define BFI_FLINEAR3_3034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3033, v ds
+# define BFI_FLINEAR3_3034_TICK(t)
+# define BFI_FLINEAR3_3033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3032, v ds
+# define BFI_FLINEAR3_3033_TICK(t)
+# define BFI_FLINEAR3_3032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3031, v ds
+# define BFI_FLINEAR3_3032_TICK(t)
+# define BFI_FLINEAR3_3031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3030, v ds
+# define BFI_FLINEAR3_3031_TICK(t)
+# define BFI_FLINEAR3_3030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3029, v ds
+# define BFI_FLINEAR3_3030_TICK(t)
+# define BFI_FLINEAR3_3029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3028, v ds
+# define BFI_FLINEAR3_3029_TICK(t)
+# define BFI_FLINEAR3_3028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3027, v ds
+# define BFI_FLINEAR3_3028_TICK(t)
+# define BFI_FLINEAR3_3027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3026, v ds
+# define BFI_FLINEAR3_3027_TICK(t)
+# define BFI_FLINEAR3_3026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3025, v ds
+# define BFI_FLINEAR3_3026_TICK(t)
+# define BFI_FLINEAR3_3025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3024, v ds
+# define BFI_FLINEAR3_3025_TICK(t)
+# define BFI_FLINEAR3_3024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3023, v ds
+# define BFI_FLINEAR3_3024_TICK(t)
+# define BFI_FLINEAR3_3023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3022, v ds
+# define BFI_FLINEAR3_3023_TICK(t)
+# define BFI_FLINEAR3_3022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3021, v ds
+# define BFI_FLINEAR3_3022_TICK(t)
+# define BFI_FLINEAR3_3021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3020, v ds
+# define BFI_FLINEAR3_3021_TICK(t)
+# define BFI_FLINEAR3_3020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3019, v ds
+# define BFI_FLINEAR3_3020_TICK(t)
+# define BFI_FLINEAR3_3019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3018, v ds
+# define BFI_FLINEAR3_3019_TICK(t)
+# define BFI_FLINEAR3_3018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3017, v ds
+# define BFI_FLINEAR3_3018_TICK(t)
+# define BFI_FLINEAR3_3017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3016, v ds
+# define BFI_FLINEAR3_3017_TICK(t)
+# define BFI_FLINEAR3_3016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3015, v ds
+# define BFI_FLINEAR3_3016_TICK(t)
+# define BFI_FLINEAR3_3015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3014, v ds
+# define BFI_FLINEAR3_3015_TICK(t)
+# define BFI_FLINEAR3_3014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3013, v ds
+# define BFI_FLINEAR3_3014_TICK(t)
+# define BFI_FLINEAR3_3013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3012, v ds
+# define BFI_FLINEAR3_3013_TICK(t)
+# define BFI_FLINEAR3_3012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3011, v ds
+# define BFI_FLINEAR3_3012_TICK(t)
+# define BFI_FLINEAR3_3011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3010, v ds
+# define BFI_FLINEAR3_3011_TICK(t)
+# define BFI_FLINEAR3_3010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3009, v ds
+# define BFI_FLINEAR3_3010_TICK(t)
+# define BFI_FLINEAR3_3009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3008, v ds
+# define BFI_FLINEAR3_3009_TICK(t)
+# define BFI_FLINEAR3_3008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3007, v ds
+# define BFI_FLINEAR3_3008_TICK(t)
+# define BFI_FLINEAR3_3007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3006, v ds
+# define BFI_FLINEAR3_3007_TICK(t)
+# define BFI_FLINEAR3_3006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3005, v ds
+# define BFI_FLINEAR3_3006_TICK(t)
+# define BFI_FLINEAR3_3005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3004, v ds
+# define BFI_FLINEAR3_3005_TICK(t)
+# define BFI_FLINEAR3_3004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3003, v ds
+# define BFI_FLINEAR3_3004_TICK(t)
+# define BFI_FLINEAR3_3003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3002, v ds
+# define BFI_FLINEAR3_3003_TICK(t)
+# define BFI_FLINEAR3_3002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3001, v ds
+# define BFI_FLINEAR3_3002_TICK(t)
+# define BFI_FLINEAR3_3001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3000, v ds
+# define BFI_FLINEAR3_3001_TICK(t)
+# define BFI_FLINEAR3_3000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2999, v ds
+# define BFI_FLINEAR3_3000_TICK(t)
+# define BFI_FLINEAR3_2999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2998, v ds
+# define BFI_FLINEAR3_2999_TICK(t)
+# define BFI_FLINEAR3_2998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2997, v ds
+# define BFI_FLINEAR3_2998_TICK(t)
+# define BFI_FLINEAR3_2997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2996, v ds
+# define BFI_FLINEAR3_2997_TICK(t)
+# define BFI_FLINEAR3_2996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2995, v ds
+# define BFI_FLINEAR3_2996_TICK(t)
+# define BFI_FLINEAR3_2995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2994, v ds
+# define BFI_FLINEAR3_2995_TICK(t)
+# define BFI_FLINEAR3_2994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2993, v ds
+# define BFI_FLINEAR3_2994_TICK(t)
+# define BFI_FLINEAR3_2993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2992, v ds
+# define BFI_FLINEAR3_2993_TICK(t)
+# define BFI_FLINEAR3_2992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2991, v ds
+# define BFI_FLINEAR3_2992_TICK(t)
+# define BFI_FLINEAR3_2991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2990, v ds
+# define BFI_FLINEAR3_2991_TICK(t)
+# define BFI_FLINEAR3_2990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2989, v ds
+# define BFI_FLINEAR3_2990_TICK(t)
+# define BFI_FLINEAR3_2989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2988, v ds
+# define BFI_FLINEAR3_2989_TICK(t)
+# define BFI_FLINEAR3_2988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2987, v ds
+# define BFI_FLINEAR3_2988_TICK(t)
+# define BFI_FLINEAR3_2987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2986, v ds
+# define BFI_FLINEAR3_2987_TICK(t)
+# define BFI_FLINEAR3_2986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2985, v ds
+# define BFI_FLINEAR3_2986_TICK(t)
+# define BFI_FLINEAR3_2985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2984, v ds
+# define BFI_FLINEAR3_2985_TICK(t)
+# define BFI_FLINEAR3_2984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2983, v ds
+# define BFI_FLINEAR3_2984_TICK(t)
+# define BFI_FLINEAR3_2983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2982, v ds
+# define BFI_FLINEAR3_2983_TICK(t)
+# define BFI_FLINEAR3_2982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2981, v ds
+# define BFI_FLINEAR3_2982_TICK(t)
+# define BFI_FLINEAR3_2981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2980, v ds
+# define BFI_FLINEAR3_2981_TICK(t)
+# define BFI_FLINEAR3_2980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2979, v ds
+# define BFI_FLINEAR3_2980_TICK(t)
+# define BFI_FLINEAR3_2979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2978, v ds
+# define BFI_FLINEAR3_2979_TICK(t)
+# define BFI_FLINEAR3_2978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2977, v ds
+# define BFI_FLINEAR3_2978_TICK(t)
+# define BFI_FLINEAR3_2977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2976, v ds
+# define BFI_FLINEAR3_2977_TICK(t)
+# define BFI_FLINEAR3_2976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2975, v ds
+# define BFI_FLINEAR3_2976_TICK(t)
+# define BFI_FLINEAR3_2975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2974, v ds
+# define BFI_FLINEAR3_2975_TICK(t)
+# define BFI_FLINEAR3_2974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2973, v ds
+# define BFI_FLINEAR3_2974_TICK(t)
+# define BFI_FLINEAR3_2973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2972, v ds
+# define BFI_FLINEAR3_2973_TICK(t)
+# define BFI_FLINEAR3_2972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2971, v ds
+# define BFI_FLINEAR3_2972_TICK(t)
+# define BFI_FLINEAR3_2971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2970, v ds
+# define BFI_FLINEAR3_2971_TICK(t)
+# define BFI_FLINEAR3_2970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2969, v ds
+# define BFI_FLINEAR3_2970_TICK(t)
+# define BFI_FLINEAR3_2969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2968, v ds
+# define BFI_FLINEAR3_2969_TICK(t)
+# define BFI_FLINEAR3_2968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2967, v ds
+# define BFI_FLINEAR3_2968_TICK(t)
+# define BFI_FLINEAR3_2967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2966, v ds
+# define BFI_FLINEAR3_2967_TICK(t)
+# define BFI_FLINEAR3_2966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2965, v ds
+# define BFI_FLINEAR3_2966_TICK(t)
+# define BFI_FLINEAR3_2965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2964, v ds
+# define BFI_FLINEAR3_2965_TICK(t)
+# define BFI_FLINEAR3_2964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2963, v ds
+# define BFI_FLINEAR3_2964_TICK(t)
+# define BFI_FLINEAR3_2963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2962, v ds
+# define BFI_FLINEAR3_2963_TICK(t)
+# define BFI_FLINEAR3_2962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2961, v ds
+# define BFI_FLINEAR3_2962_TICK(t)
+# define BFI_FLINEAR3_2961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2960, v ds
+# define BFI_FLINEAR3_2961_TICK(t)
+# define BFI_FLINEAR3_2960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2959, v ds
+# define BFI_FLINEAR3_2960_TICK(t)
+# define BFI_FLINEAR3_2959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2958, v ds
+# define BFI_FLINEAR3_2959_TICK(t)
+# define BFI_FLINEAR3_2958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2957, v ds
+# define BFI_FLINEAR3_2958_TICK(t)
+# define BFI_FLINEAR3_2957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2956, v ds
+# define BFI_FLINEAR3_2957_TICK(t)
+# define BFI_FLINEAR3_2956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2955, v ds
+# define BFI_FLINEAR3_2956_TICK(t)
+# define BFI_FLINEAR3_2955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2954, v ds
+# define BFI_FLINEAR3_2955_TICK(t)
+# define BFI_FLINEAR3_2954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2953, v ds
+# define BFI_FLINEAR3_2954_TICK(t)
+# define BFI_FLINEAR3_2953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2952, v ds
+# define BFI_FLINEAR3_2953_TICK(t)
+# define BFI_FLINEAR3_2952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2951, v ds
+# define BFI_FLINEAR3_2952_TICK(t)
+# define BFI_FLINEAR3_2951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2950, v ds
+# define BFI_FLINEAR3_2951_TICK(t)
+# define BFI_FLINEAR3_2950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2949, v ds
+# define BFI_FLINEAR3_2950_TICK(t)
+# define BFI_FLINEAR3_2949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2948, v ds
+# define BFI_FLINEAR3_2949_TICK(t)
+# define BFI_FLINEAR3_2948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2947, v ds
+# define BFI_FLINEAR3_2948_TICK(t)
+# define BFI_FLINEAR3_2947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2946, v ds
+# define BFI_FLINEAR3_2947_TICK(t)
+# define BFI_FLINEAR3_2946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2945, v ds
+# define BFI_FLINEAR3_2946_TICK(t)
+# define BFI_FLINEAR3_2945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2944, v ds
+# define BFI_FLINEAR3_2945_TICK(t)
+# define BFI_FLINEAR3_2944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2943, v ds
+# define BFI_FLINEAR3_2944_TICK(t)
+# define BFI_FLINEAR3_2943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2942, v ds
+# define BFI_FLINEAR3_2943_TICK(t)
+# define BFI_FLINEAR3_2942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2941, v ds
+# define BFI_FLINEAR3_2942_TICK(t)
+# define BFI_FLINEAR3_2941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2940, v ds
+# define BFI_FLINEAR3_2941_TICK(t)
+# define BFI_FLINEAR3_2940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2939, v ds
+# define BFI_FLINEAR3_2940_TICK(t)
+# define BFI_FLINEAR3_2939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2938, v ds
+# define BFI_FLINEAR3_2939_TICK(t)
+# define BFI_FLINEAR3_2938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2937, v ds
+# define BFI_FLINEAR3_2938_TICK(t)
+# define BFI_FLINEAR3_2937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2936, v ds
+# define BFI_FLINEAR3_2937_TICK(t)
+# define BFI_FLINEAR3_2936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2935, v ds
+# define BFI_FLINEAR3_2936_TICK(t)
+# define BFI_FLINEAR3_2935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2934, v ds
+# define BFI_FLINEAR3_2935_TICK(t)
+# define BFI_FLINEAR3_2934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2933, v ds
+# define BFI_FLINEAR3_2934_TICK(t)
+# define BFI_FLINEAR3_2933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2932, v ds
+# define BFI_FLINEAR3_2933_TICK(t)
+# define BFI_FLINEAR3_2932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2931, v ds
+# define BFI_FLINEAR3_2932_TICK(t)
+# define BFI_FLINEAR3_2931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2930, v ds
+# define BFI_FLINEAR3_2931_TICK(t)
+# define BFI_FLINEAR3_2930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2929, v ds
+# define BFI_FLINEAR3_2930_TICK(t)
+# define BFI_FLINEAR3_2929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2928, v ds
+# define BFI_FLINEAR3_2929_TICK(t)
+# define BFI_FLINEAR3_2928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2927, v ds
+# define BFI_FLINEAR3_2928_TICK(t)
+# define BFI_FLINEAR3_2927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2926, v ds
+# define BFI_FLINEAR3_2927_TICK(t)
+# define BFI_FLINEAR3_2926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2925, v ds
+# define BFI_FLINEAR3_2926_TICK(t)
+# define BFI_FLINEAR3_2925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2924, v ds
+# define BFI_FLINEAR3_2925_TICK(t)
+# define BFI_FLINEAR3_2924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2923, v ds
+# define BFI_FLINEAR3_2924_TICK(t)
+# define BFI_FLINEAR3_2923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2922, v ds
+# define BFI_FLINEAR3_2923_TICK(t)
+# define BFI_FLINEAR3_2922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2921, v ds
+# define BFI_FLINEAR3_2922_TICK(t)
+# define BFI_FLINEAR3_2921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2920, v ds
+# define BFI_FLINEAR3_2921_TICK(t)
+# define BFI_FLINEAR3_2920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2919, v ds
+# define BFI_FLINEAR3_2920_TICK(t)
+# define BFI_FLINEAR3_2919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2918, v ds
+# define BFI_FLINEAR3_2919_TICK(t)
+# define BFI_FLINEAR3_2918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2917, v ds
+# define BFI_FLINEAR3_2918_TICK(t)
+# define BFI_FLINEAR3_2917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2916, v ds
+# define BFI_FLINEAR3_2917_TICK(t)
+# define BFI_FLINEAR3_2916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2915, v ds
+# define BFI_FLINEAR3_2916_TICK(t)
+# define BFI_FLINEAR3_2915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2914, v ds
+# define BFI_FLINEAR3_2915_TICK(t)
+# define BFI_FLINEAR3_2914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2913, v ds
+# define BFI_FLINEAR3_2914_TICK(t)
+# define BFI_FLINEAR3_2913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2912, v ds
+# define BFI_FLINEAR3_2913_TICK(t)
+# define BFI_FLINEAR3_2912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2911, v ds
+# define BFI_FLINEAR3_2912_TICK(t)
+# define BFI_FLINEAR3_2911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2910, v ds
+# define BFI_FLINEAR3_2911_TICK(t)
+# define BFI_FLINEAR3_2910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2909, v ds
+# define BFI_FLINEAR3_2910_TICK(t)
+# define BFI_FLINEAR3_2909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2908, v ds
+# define BFI_FLINEAR3_2909_TICK(t)
+# define BFI_FLINEAR3_2908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2907, v ds
+# define BFI_FLINEAR3_2908_TICK(t)
+# define BFI_FLINEAR3_2907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2906, v ds
+# define BFI_FLINEAR3_2907_TICK(t)
+# define BFI_FLINEAR3_2906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2905, v ds
+# define BFI_FLINEAR3_2906_TICK(t)
+# define BFI_FLINEAR3_2905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2904, v ds
+# define BFI_FLINEAR3_2905_TICK(t)
+# define BFI_FLINEAR3_2904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2903, v ds
+# define BFI_FLINEAR3_2904_TICK(t)
+# define BFI_FLINEAR3_2903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2902, v ds
+# define BFI_FLINEAR3_2903_TICK(t)
+# define BFI_FLINEAR3_2902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2901, v ds
+# define BFI_FLINEAR3_2902_TICK(t)
+# define BFI_FLINEAR3_2901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2900, v ds
+# define BFI_FLINEAR3_2901_TICK(t)
+# define BFI_FLINEAR3_2900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2899, v ds
+# define BFI_FLINEAR3_2900_TICK(t)
+# define BFI_FLINEAR3_2899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2898, v ds
+# define BFI_FLINEAR3_2899_TICK(t)
+# define BFI_FLINEAR3_2898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2897, v ds
+# define BFI_FLINEAR3_2898_TICK(t)
+# define BFI_FLINEAR3_2897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2896, v ds
+# define BFI_FLINEAR3_2897_TICK(t)
+# define BFI_FLINEAR3_2896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2895, v ds
+# define BFI_FLINEAR3_2896_TICK(t)
+# define BFI_FLINEAR3_2895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2894, v ds
+# define BFI_FLINEAR3_2895_TICK(t)
+# define BFI_FLINEAR3_2894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2893, v ds
+# define BFI_FLINEAR3_2894_TICK(t)
+# define BFI_FLINEAR3_2893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2892, v ds
+# define BFI_FLINEAR3_2893_TICK(t)
+# define BFI_FLINEAR3_2892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2891, v ds
+# define BFI_FLINEAR3_2892_TICK(t)
+# define BFI_FLINEAR3_2891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2890, v ds
+# define BFI_FLINEAR3_2891_TICK(t)
+# define BFI_FLINEAR3_2890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2889, v ds
+# define BFI_FLINEAR3_2890_TICK(t)
+# define BFI_FLINEAR3_2889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2888, v ds
+# define BFI_FLINEAR3_2889_TICK(t)
+# define BFI_FLINEAR3_2888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2887, v ds
+# define BFI_FLINEAR3_2888_TICK(t)
+# define BFI_FLINEAR3_2887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2886, v ds
+# define BFI_FLINEAR3_2887_TICK(t)
+# define BFI_FLINEAR3_2886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2885, v ds
+# define BFI_FLINEAR3_2886_TICK(t)
+# define BFI_FLINEAR3_2885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2884, v ds
+# define BFI_FLINEAR3_2885_TICK(t)
+# define BFI_FLINEAR3_2884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2883, v ds
+# define BFI_FLINEAR3_2884_TICK(t)
+# define BFI_FLINEAR3_2883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2882, v ds
+# define BFI_FLINEAR3_2883_TICK(t)
+# define BFI_FLINEAR3_2882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2881, v ds
+# define BFI_FLINEAR3_2882_TICK(t)
+# define BFI_FLINEAR3_2881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2880, v ds
+# define BFI_FLINEAR3_2881_TICK(t)
+# define BFI_FLINEAR3_2880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2879, v ds
+# define BFI_FLINEAR3_2880_TICK(t)
+# define BFI_FLINEAR3_2879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2878, v ds
+# define BFI_FLINEAR3_2879_TICK(t)
+# define BFI_FLINEAR3_2878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2877, v ds
+# define BFI_FLINEAR3_2878_TICK(t)
+# define BFI_FLINEAR3_2877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2876, v ds
+# define BFI_FLINEAR3_2877_TICK(t)
+# define BFI_FLINEAR3_2876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2875, v ds
+# define BFI_FLINEAR3_2876_TICK(t)
+# define BFI_FLINEAR3_2875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2874, v ds
+# define BFI_FLINEAR3_2875_TICK(t)
+# define BFI_FLINEAR3_2874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2873, v ds
+# define BFI_FLINEAR3_2874_TICK(t)
+# define BFI_FLINEAR3_2873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2872, v ds
+# define BFI_FLINEAR3_2873_TICK(t)
+# define BFI_FLINEAR3_2872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2871, v ds
+# define BFI_FLINEAR3_2872_TICK(t)
+# define BFI_FLINEAR3_2871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2870, v ds
+# define BFI_FLINEAR3_2871_TICK(t)
+# define BFI_FLINEAR3_2870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2869, v ds
+# define BFI_FLINEAR3_2870_TICK(t)
+# define BFI_FLINEAR3_2869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2868, v ds
+# define BFI_FLINEAR3_2869_TICK(t)
+# define BFI_FLINEAR3_2868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2867, v ds
+# define BFI_FLINEAR3_2868_TICK(t)
+# define BFI_FLINEAR3_2867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2866, v ds
+# define BFI_FLINEAR3_2867_TICK(t)
+# define BFI_FLINEAR3_2866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2865, v ds
+# define BFI_FLINEAR3_2866_TICK(t)
+# define BFI_FLINEAR3_2865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2864, v ds
+# define BFI_FLINEAR3_2865_TICK(t)
+# define BFI_FLINEAR3_2864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2863, v ds
+# define BFI_FLINEAR3_2864_TICK(t)
+# define BFI_FLINEAR3_2863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2862, v ds
+# define BFI_FLINEAR3_2863_TICK(t)
+# define BFI_FLINEAR3_2862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2861, v ds
+# define BFI_FLINEAR3_2862_TICK(t)
+# define BFI_FLINEAR3_2861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2860, v ds
+# define BFI_FLINEAR3_2861_TICK(t)
+# define BFI_FLINEAR3_2860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2859, v ds
+# define BFI_FLINEAR3_2860_TICK(t)
+# define BFI_FLINEAR3_2859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2858, v ds
+# define BFI_FLINEAR3_2859_TICK(t)
+# define BFI_FLINEAR3_2858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2857, v ds
+# define BFI_FLINEAR3_2858_TICK(t)
+# define BFI_FLINEAR3_2857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2856, v ds
+# define BFI_FLINEAR3_2857_TICK(t)
+# define BFI_FLINEAR3_2856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2855, v ds
+# define BFI_FLINEAR3_2856_TICK(t)
+# define BFI_FLINEAR3_2855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2854, v ds
+# define BFI_FLINEAR3_2855_TICK(t)
+# define BFI_FLINEAR3_2854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2853, v ds
+# define BFI_FLINEAR3_2854_TICK(t)
+# define BFI_FLINEAR3_2853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2852, v ds
+# define BFI_FLINEAR3_2853_TICK(t)
+# define BFI_FLINEAR3_2852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2851, v ds
+# define BFI_FLINEAR3_2852_TICK(t)
+# define BFI_FLINEAR3_2851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2850, v ds
+# define BFI_FLINEAR3_2851_TICK(t)
+# define BFI_FLINEAR3_2850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2849, v ds
+# define BFI_FLINEAR3_2850_TICK(t)
+# define BFI_FLINEAR3_2849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2848, v ds
+# define BFI_FLINEAR3_2849_TICK(t)
+# define BFI_FLINEAR3_2848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2847, v ds
+# define BFI_FLINEAR3_2848_TICK(t)
+# define BFI_FLINEAR3_2847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2846, v ds
+# define BFI_FLINEAR3_2847_TICK(t)
+# define BFI_FLINEAR3_2846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2845, v ds
+# define BFI_FLINEAR3_2846_TICK(t)
+# define BFI_FLINEAR3_2845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2844, v ds
+# define BFI_FLINEAR3_2845_TICK(t)
+# define BFI_FLINEAR3_2844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2843, v ds
+# define BFI_FLINEAR3_2844_TICK(t)
+# define BFI_FLINEAR3_2843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2842, v ds
+# define BFI_FLINEAR3_2843_TICK(t)
+# define BFI_FLINEAR3_2842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2841, v ds
+# define BFI_FLINEAR3_2842_TICK(t)
+# define BFI_FLINEAR3_2841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2840, v ds
+# define BFI_FLINEAR3_2841_TICK(t)
+# define BFI_FLINEAR3_2840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2839, v ds
+# define BFI_FLINEAR3_2840_TICK(t)
+# define BFI_FLINEAR3_2839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2838, v ds
+# define BFI_FLINEAR3_2839_TICK(t)
+# define BFI_FLINEAR3_2838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2837, v ds
+# define BFI_FLINEAR3_2838_TICK(t)
+# define BFI_FLINEAR3_2837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2836, v ds
+# define BFI_FLINEAR3_2837_TICK(t)
+# define BFI_FLINEAR3_2836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2835, v ds
+# define BFI_FLINEAR3_2836_TICK(t)
+# define BFI_FLINEAR3_2835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2834, v ds
+# define BFI_FLINEAR3_2835_TICK(t)
+# define BFI_FLINEAR3_2834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2833, v ds
+# define BFI_FLINEAR3_2834_TICK(t)
+# define BFI_FLINEAR3_2833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2832, v ds
+# define BFI_FLINEAR3_2833_TICK(t)
+# define BFI_FLINEAR3_2832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2831, v ds
+# define BFI_FLINEAR3_2832_TICK(t)
+# define BFI_FLINEAR3_2831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2830, v ds
+# define BFI_FLINEAR3_2831_TICK(t)
+# define BFI_FLINEAR3_2830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2829, v ds
+# define BFI_FLINEAR3_2830_TICK(t)
+# define BFI_FLINEAR3_2829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2828, v ds
+# define BFI_FLINEAR3_2829_TICK(t)
+# define BFI_FLINEAR3_2828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2827, v ds
+# define BFI_FLINEAR3_2828_TICK(t)
+# define BFI_FLINEAR3_2827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2826, v ds
+# define BFI_FLINEAR3_2827_TICK(t)
+# define BFI_FLINEAR3_2826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2825, v ds
+# define BFI_FLINEAR3_2826_TICK(t)
+# define BFI_FLINEAR3_2825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2824, v ds
+# define BFI_FLINEAR3_2825_TICK(t)
+# define BFI_FLINEAR3_2824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2823, v ds
+# define BFI_FLINEAR3_2824_TICK(t)
+# define BFI_FLINEAR3_2823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2822, v ds
+# define BFI_FLINEAR3_2823_TICK(t)
+# define BFI_FLINEAR3_2822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2821, v ds
+# define BFI_FLINEAR3_2822_TICK(t)
+# define BFI_FLINEAR3_2821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2820, v ds
+# define BFI_FLINEAR3_2821_TICK(t)
+# define BFI_FLINEAR3_2820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2819, v ds
+# define BFI_FLINEAR3_2820_TICK(t)
+# define BFI_FLINEAR3_2819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2818, v ds
+# define BFI_FLINEAR3_2819_TICK(t)
+# define BFI_FLINEAR3_2818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2817, v ds
+# define BFI_FLINEAR3_2818_TICK(t)
+# define BFI_FLINEAR3_2817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2816, v ds
+# define BFI_FLINEAR3_2817_TICK(t)
+# define BFI_FLINEAR3_2816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2815, v ds
+# define BFI_FLINEAR3_2816_TICK(t)
+# define BFI_FLINEAR3_2815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2814, v ds
+# define BFI_FLINEAR3_2815_TICK(t)
+# define BFI_FLINEAR3_2814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2813, v ds
+# define BFI_FLINEAR3_2814_TICK(t)
+# define BFI_FLINEAR3_2813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2812, v ds
+# define BFI_FLINEAR3_2813_TICK(t)
+# define BFI_FLINEAR3_2812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2811, v ds
+# define BFI_FLINEAR3_2812_TICK(t)
+# define BFI_FLINEAR3_2811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2810, v ds
+# define BFI_FLINEAR3_2811_TICK(t)
+# define BFI_FLINEAR3_2810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2809, v ds
+# define BFI_FLINEAR3_2810_TICK(t)
+# define BFI_FLINEAR3_2809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2808, v ds
+# define BFI_FLINEAR3_2809_TICK(t)
+# define BFI_FLINEAR3_2808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2807, v ds
+# define BFI_FLINEAR3_2808_TICK(t)
+# define BFI_FLINEAR3_2807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2806, v ds
+# define BFI_FLINEAR3_2807_TICK(t)
+# define BFI_FLINEAR3_2806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2805, v ds
+# define BFI_FLINEAR3_2806_TICK(t)
+# define BFI_FLINEAR3_2805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2804, v ds
+# define BFI_FLINEAR3_2805_TICK(t)
+# define BFI_FLINEAR3_2804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2803, v ds
+# define BFI_FLINEAR3_2804_TICK(t)
+# define BFI_FLINEAR3_2803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2802, v ds
+# define BFI_FLINEAR3_2803_TICK(t)
+# define BFI_FLINEAR3_2802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2801, v ds
+# define BFI_FLINEAR3_2802_TICK(t)
+# define BFI_FLINEAR3_2801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2800, v ds
+# define BFI_FLINEAR3_2801_TICK(t)
+# define BFI_FLINEAR3_2800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2799, v ds
+# define BFI_FLINEAR3_2800_TICK(t)
+# define BFI_FLINEAR3_2799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2798, v ds
+# define BFI_FLINEAR3_2799_TICK(t)
+# define BFI_FLINEAR3_2798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2797, v ds
+# define BFI_FLINEAR3_2798_TICK(t)
+# define BFI_FLINEAR3_2797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2796, v ds
+# define BFI_FLINEAR3_2797_TICK(t)
+# define BFI_FLINEAR3_2796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2795, v ds
+# define BFI_FLINEAR3_2796_TICK(t)
+# define BFI_FLINEAR3_2795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2794, v ds
+# define BFI_FLINEAR3_2795_TICK(t)
+# define BFI_FLINEAR3_2794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2793, v ds
+# define BFI_FLINEAR3_2794_TICK(t)
+# define BFI_FLINEAR3_2793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2792, v ds
+# define BFI_FLINEAR3_2793_TICK(t)
+# define BFI_FLINEAR3_2792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2791, v ds
+# define BFI_FLINEAR3_2792_TICK(t)
+# define BFI_FLINEAR3_2791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2790, v ds
+# define BFI_FLINEAR3_2791_TICK(t)
+# define BFI_FLINEAR3_2790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2789, v ds
+# define BFI_FLINEAR3_2790_TICK(t)
+# define BFI_FLINEAR3_2789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2788, v ds
+# define BFI_FLINEAR3_2789_TICK(t)
+# define BFI_FLINEAR3_2788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2787, v ds
+# define BFI_FLINEAR3_2788_TICK(t)
+# define BFI_FLINEAR3_2787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2786, v ds
+# define BFI_FLINEAR3_2787_TICK(t)
+# define BFI_FLINEAR3_2786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2785, v ds
+# define BFI_FLINEAR3_2786_TICK(t)
+# define BFI_FLINEAR3_2785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2784, v ds
+# define BFI_FLINEAR3_2785_TICK(t)
+# define BFI_FLINEAR3_2784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2783, v ds
+# define BFI_FLINEAR3_2784_TICK(t)
+# define BFI_FLINEAR3_2783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2782, v ds
+# define BFI_FLINEAR3_2783_TICK(t)
+# define BFI_FLINEAR3_2782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2781, v ds
+# define BFI_FLINEAR3_2782_TICK(t)
+# define BFI_FLINEAR3_2781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2780, v ds
+# define BFI_FLINEAR3_2781_TICK(t)
+# define BFI_FLINEAR3_2780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2779, v ds
+# define BFI_FLINEAR3_2780_TICK(t)
+# define BFI_FLINEAR3_2779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2778, v ds
+# define BFI_FLINEAR3_2779_TICK(t)
+# define BFI_FLINEAR3_2778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2777, v ds
+# define BFI_FLINEAR3_2778_TICK(t)
+# define BFI_FLINEAR3_2777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2776, v ds
+# define BFI_FLINEAR3_2777_TICK(t)
+# define BFI_FLINEAR3_2776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2775, v ds
+# define BFI_FLINEAR3_2776_TICK(t)
+# define BFI_FLINEAR3_2775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2774, v ds
+# define BFI_FLINEAR3_2775_TICK(t)
+# define BFI_FLINEAR3_2774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2773, v ds
+# define BFI_FLINEAR3_2774_TICK(t)
+# define BFI_FLINEAR3_2773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2772, v ds
+# define BFI_FLINEAR3_2773_TICK(t)
+# define BFI_FLINEAR3_2772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2771, v ds
+# define BFI_FLINEAR3_2772_TICK(t)
+# define BFI_FLINEAR3_2771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2770, v ds
+# define BFI_FLINEAR3_2771_TICK(t)
+# define BFI_FLINEAR3_2770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2769, v ds
+# define BFI_FLINEAR3_2770_TICK(t)
+# define BFI_FLINEAR3_2769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2768, v ds
+# define BFI_FLINEAR3_2769_TICK(t)
+# define BFI_FLINEAR3_2768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2767, v ds
+# define BFI_FLINEAR3_2768_TICK(t)
+# define BFI_FLINEAR3_2767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2766, v ds
+# define BFI_FLINEAR3_2767_TICK(t)
+# define BFI_FLINEAR3_2766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2765, v ds
+# define BFI_FLINEAR3_2766_TICK(t)
+# define BFI_FLINEAR3_2765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2764, v ds
+# define BFI_FLINEAR3_2765_TICK(t)
+# define BFI_FLINEAR3_2764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2763, v ds
+# define BFI_FLINEAR3_2764_TICK(t)
+# define BFI_FLINEAR3_2763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2762, v ds
+# define BFI_FLINEAR3_2763_TICK(t)
+# define BFI_FLINEAR3_2762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2761, v ds
+# define BFI_FLINEAR3_2762_TICK(t)
+# define BFI_FLINEAR3_2761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2760, v ds
+# define BFI_FLINEAR3_2761_TICK(t)
+# define BFI_FLINEAR3_2760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2759, v ds
+# define BFI_FLINEAR3_2760_TICK(t)
+# define BFI_FLINEAR3_2759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2758, v ds
+# define BFI_FLINEAR3_2759_TICK(t)
+# define BFI_FLINEAR3_2758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2757, v ds
+# define BFI_FLINEAR3_2758_TICK(t)
+# define BFI_FLINEAR3_2757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2756, v ds
+# define BFI_FLINEAR3_2757_TICK(t)
+# define BFI_FLINEAR3_2756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2755, v ds
+# define BFI_FLINEAR3_2756_TICK(t)
+# define BFI_FLINEAR3_2755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2754, v ds
+# define BFI_FLINEAR3_2755_TICK(t)
+# define BFI_FLINEAR3_2754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2753, v ds
+# define BFI_FLINEAR3_2754_TICK(t)
+# define BFI_FLINEAR3_2753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2752, v ds
+# define BFI_FLINEAR3_2753_TICK(t)
+# define BFI_FLINEAR3_2752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2751, v ds
+# define BFI_FLINEAR3_2752_TICK(t)
+# define BFI_FLINEAR3_2751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2750, v ds
+# define BFI_FLINEAR3_2751_TICK(t)
+# define BFI_FLINEAR3_2750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2749, v ds
+# define BFI_FLINEAR3_2750_TICK(t)
+# define BFI_FLINEAR3_2749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2748, v ds
+# define BFI_FLINEAR3_2749_TICK(t)
+# define BFI_FLINEAR3_2748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2747, v ds
+# define BFI_FLINEAR3_2748_TICK(t)
+# define BFI_FLINEAR3_2747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2746, v ds
+# define BFI_FLINEAR3_2747_TICK(t)
+# define BFI_FLINEAR3_2746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2745, v ds
+# define BFI_FLINEAR3_2746_TICK(t)
+# define BFI_FLINEAR3_2745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2744, v ds
+# define BFI_FLINEAR3_2745_TICK(t)
+# define BFI_FLINEAR3_2744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2743, v ds
+# define BFI_FLINEAR3_2744_TICK(t)
+# define BFI_FLINEAR3_2743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2742, v ds
+# define BFI_FLINEAR3_2743_TICK(t)
+# define BFI_FLINEAR3_2742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2741, v ds
+# define BFI_FLINEAR3_2742_TICK(t)
+# define BFI_FLINEAR3_2741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2740, v ds
+# define BFI_FLINEAR3_2741_TICK(t)
+# define BFI_FLINEAR3_2740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2739, v ds
+# define BFI_FLINEAR3_2740_TICK(t)
+# define BFI_FLINEAR3_2739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2738, v ds
+# define BFI_FLINEAR3_2739_TICK(t)
+# define BFI_FLINEAR3_2738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2737, v ds
+# define BFI_FLINEAR3_2738_TICK(t)
+# define BFI_FLINEAR3_2737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2736, v ds
+# define BFI_FLINEAR3_2737_TICK(t)
+# define BFI_FLINEAR3_2736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2735, v ds
+# define BFI_FLINEAR3_2736_TICK(t)
+# define BFI_FLINEAR3_2735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2734, v ds
+# define BFI_FLINEAR3_2735_TICK(t)
+# define BFI_FLINEAR3_2734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2733, v ds
+# define BFI_FLINEAR3_2734_TICK(t)
+# define BFI_FLINEAR3_2733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2732, v ds
+# define BFI_FLINEAR3_2733_TICK(t)
+# define BFI_FLINEAR3_2732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2731, v ds
+# define BFI_FLINEAR3_2732_TICK(t)
+# define BFI_FLINEAR3_2731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2730, v ds
+# define BFI_FLINEAR3_2731_TICK(t)
+# define BFI_FLINEAR3_2730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2729, v ds
+# define BFI_FLINEAR3_2730_TICK(t)
+# define BFI_FLINEAR3_2729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2728, v ds
+# define BFI_FLINEAR3_2729_TICK(t)
+# define BFI_FLINEAR3_2728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2727, v ds
+# define BFI_FLINEAR3_2728_TICK(t)
+# define BFI_FLINEAR3_2727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2726, v ds
+# define BFI_FLINEAR3_2727_TICK(t)
+# define BFI_FLINEAR3_2726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2725, v ds
+# define BFI_FLINEAR3_2726_TICK(t)
+# define BFI_FLINEAR3_2725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2724, v ds
+# define BFI_FLINEAR3_2725_TICK(t)
+# define BFI_FLINEAR3_2724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2723, v ds
+# define BFI_FLINEAR3_2724_TICK(t)
+# define BFI_FLINEAR3_2723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2722, v ds
+# define BFI_FLINEAR3_2723_TICK(t)
+# define BFI_FLINEAR3_2722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2721, v ds
+# define BFI_FLINEAR3_2722_TICK(t)
+# define BFI_FLINEAR3_2721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2720, v ds
+# define BFI_FLINEAR3_2721_TICK(t)
+# define BFI_FLINEAR3_2720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2719, v ds
+# define BFI_FLINEAR3_2720_TICK(t)
+# define BFI_FLINEAR3_2719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2718, v ds
+# define BFI_FLINEAR3_2719_TICK(t)
+# define BFI_FLINEAR3_2718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2717, v ds
+# define BFI_FLINEAR3_2718_TICK(t)
+# define BFI_FLINEAR3_2717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2716, v ds
+# define BFI_FLINEAR3_2717_TICK(t)
+# define BFI_FLINEAR3_2716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2715, v ds
+# define BFI_FLINEAR3_2716_TICK(t)
+# define BFI_FLINEAR3_2715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2714, v ds
+# define BFI_FLINEAR3_2715_TICK(t)
+# define BFI_FLINEAR3_2714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2713, v ds
+# define BFI_FLINEAR3_2714_TICK(t)
+# define BFI_FLINEAR3_2713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2712, v ds
+# define BFI_FLINEAR3_2713_TICK(t)
+# define BFI_FLINEAR3_2712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2711, v ds
+# define BFI_FLINEAR3_2712_TICK(t)
+# define BFI_FLINEAR3_2711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2710, v ds
+# define BFI_FLINEAR3_2711_TICK(t)
+# define BFI_FLINEAR3_2710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2709, v ds
+# define BFI_FLINEAR3_2710_TICK(t)
+# define BFI_FLINEAR3_2709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2708, v ds
+# define BFI_FLINEAR3_2709_TICK(t)
+# define BFI_FLINEAR3_2708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2707, v ds
+# define BFI_FLINEAR3_2708_TICK(t)
+# define BFI_FLINEAR3_2707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2706, v ds
+# define BFI_FLINEAR3_2707_TICK(t)
+# define BFI_FLINEAR3_2706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2705, v ds
+# define BFI_FLINEAR3_2706_TICK(t)
+# define BFI_FLINEAR3_2705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2704, v ds
+# define BFI_FLINEAR3_2705_TICK(t)
+# define BFI_FLINEAR3_2704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2703, v ds
+# define BFI_FLINEAR3_2704_TICK(t)
+# define BFI_FLINEAR3_2703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2702, v ds
+# define BFI_FLINEAR3_2703_TICK(t)
+# define BFI_FLINEAR3_2702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2701, v ds
+# define BFI_FLINEAR3_2702_TICK(t)
+# define BFI_FLINEAR3_2701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2700, v ds
+# define BFI_FLINEAR3_2701_TICK(t)
+# define BFI_FLINEAR3_2700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2699, v ds
+# define BFI_FLINEAR3_2700_TICK(t)
+# define BFI_FLINEAR3_2699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2698, v ds
+# define BFI_FLINEAR3_2699_TICK(t)
+# define BFI_FLINEAR3_2698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2697, v ds
+# define BFI_FLINEAR3_2698_TICK(t)
+# define BFI_FLINEAR3_2697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2696, v ds
+# define BFI_FLINEAR3_2697_TICK(t)
+# define BFI_FLINEAR3_2696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2695, v ds
+# define BFI_FLINEAR3_2696_TICK(t)
+# define BFI_FLINEAR3_2695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2694, v ds
+# define BFI_FLINEAR3_2695_TICK(t)
+# define BFI_FLINEAR3_2694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2693, v ds
+# define BFI_FLINEAR3_2694_TICK(t)
+# define BFI_FLINEAR3_2693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2692, v ds
+# define BFI_FLINEAR3_2693_TICK(t)
+# define BFI_FLINEAR3_2692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2691, v ds
+# define BFI_FLINEAR3_2692_TICK(t)
+# define BFI_FLINEAR3_2691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2690, v ds
+# define BFI_FLINEAR3_2691_TICK(t)
+# define BFI_FLINEAR3_2690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2689, v ds
+# define BFI_FLINEAR3_2690_TICK(t)
+# define BFI_FLINEAR3_2689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2688, v ds
+# define BFI_FLINEAR3_2689_TICK(t)
+# define BFI_FLINEAR3_2688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2687, v ds
+# define BFI_FLINEAR3_2688_TICK(t)
+# define BFI_FLINEAR3_2687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2686, v ds
+# define BFI_FLINEAR3_2687_TICK(t)
+# define BFI_FLINEAR3_2686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2685, v ds
+# define BFI_FLINEAR3_2686_TICK(t)
+# define BFI_FLINEAR3_2685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2684, v ds
+# define BFI_FLINEAR3_2685_TICK(t)
+# define BFI_FLINEAR3_2684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2683, v ds
+# define BFI_FLINEAR3_2684_TICK(t)
+# define BFI_FLINEAR3_2683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2682, v ds
+# define BFI_FLINEAR3_2683_TICK(t)
+# define BFI_FLINEAR3_2682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2681, v ds
+# define BFI_FLINEAR3_2682_TICK(t)
+# define BFI_FLINEAR3_2681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2680, v ds
+# define BFI_FLINEAR3_2681_TICK(t)
+# define BFI_FLINEAR3_2680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2679, v ds
+# define BFI_FLINEAR3_2680_TICK(t)
+# define BFI_FLINEAR3_2679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2678, v ds
+# define BFI_FLINEAR3_2679_TICK(t)
+# define BFI_FLINEAR3_2678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2677, v ds
+# define BFI_FLINEAR3_2678_TICK(t)
+# define BFI_FLINEAR3_2677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2676, v ds
+# define BFI_FLINEAR3_2677_TICK(t)
+# define BFI_FLINEAR3_2676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2675, v ds
+# define BFI_FLINEAR3_2676_TICK(t)
+# define BFI_FLINEAR3_2675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2674, v ds
+# define BFI_FLINEAR3_2675_TICK(t)
+# define BFI_FLINEAR3_2674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2673, v ds
+# define BFI_FLINEAR3_2674_TICK(t)
+# define BFI_FLINEAR3_2673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2672, v ds
+# define BFI_FLINEAR3_2673_TICK(t)
+# define BFI_FLINEAR3_2672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2671, v ds
+# define BFI_FLINEAR3_2672_TICK(t)
+# define BFI_FLINEAR3_2671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2670, v ds
+# define BFI_FLINEAR3_2671_TICK(t)
+# define BFI_FLINEAR3_2670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2669, v ds
+# define BFI_FLINEAR3_2670_TICK(t)
+# define BFI_FLINEAR3_2669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2668, v ds
+# define BFI_FLINEAR3_2669_TICK(t)
+# define BFI_FLINEAR3_2668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2667, v ds
+# define BFI_FLINEAR3_2668_TICK(t)
+# define BFI_FLINEAR3_2667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2666, v ds
+# define BFI_FLINEAR3_2667_TICK(t)
+# define BFI_FLINEAR3_2666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2665, v ds
+# define BFI_FLINEAR3_2666_TICK(t)
+# define BFI_FLINEAR3_2665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2664, v ds
+# define BFI_FLINEAR3_2665_TICK(t)
+# define BFI_FLINEAR3_2664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2663, v ds
+# define BFI_FLINEAR3_2664_TICK(t)
+# define BFI_FLINEAR3_2663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2662, v ds
+# define BFI_FLINEAR3_2663_TICK(t)
+# define BFI_FLINEAR3_2662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2661, v ds
+# define BFI_FLINEAR3_2662_TICK(t)
+# define BFI_FLINEAR3_2661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2660, v ds
+# define BFI_FLINEAR3_2661_TICK(t)
+# define BFI_FLINEAR3_2660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2659, v ds
+# define BFI_FLINEAR3_2660_TICK(t)
+# define BFI_FLINEAR3_2659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2658, v ds
+# define BFI_FLINEAR3_2659_TICK(t)
+# define BFI_FLINEAR3_2658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2657, v ds
+# define BFI_FLINEAR3_2658_TICK(t)
+# define BFI_FLINEAR3_2657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2656, v ds
+# define BFI_FLINEAR3_2657_TICK(t)
+# define BFI_FLINEAR3_2656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2655, v ds
+# define BFI_FLINEAR3_2656_TICK(t)
+# define BFI_FLINEAR3_2655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2654, v ds
+# define BFI_FLINEAR3_2655_TICK(t)
+# define BFI_FLINEAR3_2654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2653, v ds
+# define BFI_FLINEAR3_2654_TICK(t)
+# define BFI_FLINEAR3_2653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2652, v ds
+# define BFI_FLINEAR3_2653_TICK(t)
+# define BFI_FLINEAR3_2652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2651, v ds
+# define BFI_FLINEAR3_2652_TICK(t)
+# define BFI_FLINEAR3_2651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2650, v ds
+# define BFI_FLINEAR3_2651_TICK(t)
+# define BFI_FLINEAR3_2650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2649, v ds
+# define BFI_FLINEAR3_2650_TICK(t)
+# define BFI_FLINEAR3_2649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2648, v ds
+# define BFI_FLINEAR3_2649_TICK(t)
+# define BFI_FLINEAR3_2648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2647, v ds
+# define BFI_FLINEAR3_2648_TICK(t)
+# define BFI_FLINEAR3_2647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2646, v ds
+# define BFI_FLINEAR3_2647_TICK(t)
+# define BFI_FLINEAR3_2646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2645, v ds
+# define BFI_FLINEAR3_2646_TICK(t)
+# define BFI_FLINEAR3_2645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2644, v ds
+# define BFI_FLINEAR3_2645_TICK(t)
+# define BFI_FLINEAR3_2644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2643, v ds
+# define BFI_FLINEAR3_2644_TICK(t)
+# define BFI_FLINEAR3_2643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2642, v ds
+# define BFI_FLINEAR3_2643_TICK(t)
+# define BFI_FLINEAR3_2642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2641, v ds
+# define BFI_FLINEAR3_2642_TICK(t)
+# define BFI_FLINEAR3_2641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2640, v ds
+# define BFI_FLINEAR3_2641_TICK(t)
+# define BFI_FLINEAR3_2640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2639, v ds
+# define BFI_FLINEAR3_2640_TICK(t)
+# define BFI_FLINEAR3_2639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2638, v ds
+# define BFI_FLINEAR3_2639_TICK(t)
+# define BFI_FLINEAR3_2638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2637, v ds
+# define BFI_FLINEAR3_2638_TICK(t)
+# define BFI_FLINEAR3_2637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2636, v ds
+# define BFI_FLINEAR3_2637_TICK(t)
+# define BFI_FLINEAR3_2636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2635, v ds
+# define BFI_FLINEAR3_2636_TICK(t)
+# define BFI_FLINEAR3_2635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2634, v ds
+# define BFI_FLINEAR3_2635_TICK(t)
+# define BFI_FLINEAR3_2634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2633, v ds
+# define BFI_FLINEAR3_2634_TICK(t)
+# define BFI_FLINEAR3_2633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2632, v ds
+# define BFI_FLINEAR3_2633_TICK(t)
+# define BFI_FLINEAR3_2632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2631, v ds
+# define BFI_FLINEAR3_2632_TICK(t)
+# define BFI_FLINEAR3_2631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2630, v ds
+# define BFI_FLINEAR3_2631_TICK(t)
+# define BFI_FLINEAR3_2630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2629, v ds
+# define BFI_FLINEAR3_2630_TICK(t)
+# define BFI_FLINEAR3_2629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2628, v ds
+# define BFI_FLINEAR3_2629_TICK(t)
+# define BFI_FLINEAR3_2628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2627, v ds
+# define BFI_FLINEAR3_2628_TICK(t)
+# define BFI_FLINEAR3_2627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2626, v ds
+# define BFI_FLINEAR3_2627_TICK(t)
+# define BFI_FLINEAR3_2626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2625, v ds
+# define BFI_FLINEAR3_2626_TICK(t)
+# define BFI_FLINEAR3_2625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2624, v ds
+# define BFI_FLINEAR3_2625_TICK(t)
+# define BFI_FLINEAR3_2624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2623, v ds
+# define BFI_FLINEAR3_2624_TICK(t)
+# define BFI_FLINEAR3_2623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2622, v ds
+# define BFI_FLINEAR3_2623_TICK(t)
+# define BFI_FLINEAR3_2622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2621, v ds
+# define BFI_FLINEAR3_2622_TICK(t)
+# define BFI_FLINEAR3_2621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2620, v ds
+# define BFI_FLINEAR3_2621_TICK(t)
+# define BFI_FLINEAR3_2620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2619, v ds
+# define BFI_FLINEAR3_2620_TICK(t)
+# define BFI_FLINEAR3_2619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2618, v ds
+# define BFI_FLINEAR3_2619_TICK(t)
+# define BFI_FLINEAR3_2618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2617, v ds
+# define BFI_FLINEAR3_2618_TICK(t)
+# define BFI_FLINEAR3_2617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2616, v ds
+# define BFI_FLINEAR3_2617_TICK(t)
+# define BFI_FLINEAR3_2616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2615, v ds
+# define BFI_FLINEAR3_2616_TICK(t)
+# define BFI_FLINEAR3_2615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2614, v ds
+# define BFI_FLINEAR3_2615_TICK(t)
+# define BFI_FLINEAR3_2614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2613, v ds
+# define BFI_FLINEAR3_2614_TICK(t)
+# define BFI_FLINEAR3_2613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2612, v ds
+# define BFI_FLINEAR3_2613_TICK(t)
+# define BFI_FLINEAR3_2612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2611, v ds
+# define BFI_FLINEAR3_2612_TICK(t)
+# define BFI_FLINEAR3_2611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2610, v ds
+# define BFI_FLINEAR3_2611_TICK(t)
+# define BFI_FLINEAR3_2610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2609, v ds
+# define BFI_FLINEAR3_2610_TICK(t)
+# define BFI_FLINEAR3_2609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2608, v ds
+# define BFI_FLINEAR3_2609_TICK(t)
+# define BFI_FLINEAR3_2608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2607, v ds
+# define BFI_FLINEAR3_2608_TICK(t)
+# define BFI_FLINEAR3_2607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2606, v ds
+# define BFI_FLINEAR3_2607_TICK(t)
+# define BFI_FLINEAR3_2606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2605, v ds
+# define BFI_FLINEAR3_2606_TICK(t)
+# define BFI_FLINEAR3_2605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2604, v ds
+# define BFI_FLINEAR3_2605_TICK(t)
+# define BFI_FLINEAR3_2604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2603, v ds
+# define BFI_FLINEAR3_2604_TICK(t)
+# define BFI_FLINEAR3_2603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2602, v ds
+# define BFI_FLINEAR3_2603_TICK(t)
+# define BFI_FLINEAR3_2602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2601, v ds
+# define BFI_FLINEAR3_2602_TICK(t)
+# define BFI_FLINEAR3_2601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2600, v ds
+# define BFI_FLINEAR3_2601_TICK(t)
+# define BFI_FLINEAR3_2600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2599, v ds
+# define BFI_FLINEAR3_2600_TICK(t)
+# define BFI_FLINEAR3_2599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2598, v ds
+# define BFI_FLINEAR3_2599_TICK(t)
+# define BFI_FLINEAR3_2598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2597, v ds
+# define BFI_FLINEAR3_2598_TICK(t)
+# define BFI_FLINEAR3_2597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2596, v ds
+# define BFI_FLINEAR3_2597_TICK(t)
+# define BFI_FLINEAR3_2596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2595, v ds
+# define BFI_FLINEAR3_2596_TICK(t)
+# define BFI_FLINEAR3_2595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2594, v ds
+# define BFI_FLINEAR3_2595_TICK(t)
+# define BFI_FLINEAR3_2594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2593, v ds
+# define BFI_FLINEAR3_2594_TICK(t)
+# define BFI_FLINEAR3_2593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2592, v ds
+# define BFI_FLINEAR3_2593_TICK(t)
+# define BFI_FLINEAR3_2592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2591, v ds
+# define BFI_FLINEAR3_2592_TICK(t)
+# define BFI_FLINEAR3_2591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2590, v ds
+# define BFI_FLINEAR3_2591_TICK(t)
+# define BFI_FLINEAR3_2590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2589, v ds
+# define BFI_FLINEAR3_2590_TICK(t)
+# define BFI_FLINEAR3_2589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2588, v ds
+# define BFI_FLINEAR3_2589_TICK(t)
+# define BFI_FLINEAR3_2588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2587, v ds
+# define BFI_FLINEAR3_2588_TICK(t)
+# define BFI_FLINEAR3_2587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2586, v ds
+# define BFI_FLINEAR3_2587_TICK(t)
+# define BFI_FLINEAR3_2586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2585, v ds
+# define BFI_FLINEAR3_2586_TICK(t)
+# define BFI_FLINEAR3_2585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2584, v ds
+# define BFI_FLINEAR3_2585_TICK(t)
+# define BFI_FLINEAR3_2584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2583, v ds
+# define BFI_FLINEAR3_2584_TICK(t)
+# define BFI_FLINEAR3_2583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2582, v ds
+# define BFI_FLINEAR3_2583_TICK(t)
+# define BFI_FLINEAR3_2582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2581, v ds
+# define BFI_FLINEAR3_2582_TICK(t)
+# define BFI_FLINEAR3_2581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2580, v ds
+# define BFI_FLINEAR3_2581_TICK(t)
+# define BFI_FLINEAR3_2580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2579, v ds
+# define BFI_FLINEAR3_2580_TICK(t)
+# define BFI_FLINEAR3_2579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2578, v ds
+# define BFI_FLINEAR3_2579_TICK(t)
+# define BFI_FLINEAR3_2578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2577, v ds
+# define BFI_FLINEAR3_2578_TICK(t)
+# define BFI_FLINEAR3_2577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2576, v ds
+# define BFI_FLINEAR3_2577_TICK(t)
+# define BFI_FLINEAR3_2576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2575, v ds
+# define BFI_FLINEAR3_2576_TICK(t)
+# define BFI_FLINEAR3_2575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2574, v ds
+# define BFI_FLINEAR3_2575_TICK(t)
+# define BFI_FLINEAR3_2574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2573, v ds
+# define BFI_FLINEAR3_2574_TICK(t)
+# define BFI_FLINEAR3_2573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2572, v ds
+# define BFI_FLINEAR3_2573_TICK(t)
+# define BFI_FLINEAR3_2572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2571, v ds
+# define BFI_FLINEAR3_2572_TICK(t)
+# define BFI_FLINEAR3_2571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2570, v ds
+# define BFI_FLINEAR3_2571_TICK(t)
+# define BFI_FLINEAR3_2570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2569, v ds
+# define BFI_FLINEAR3_2570_TICK(t)
+# define BFI_FLINEAR3_2569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2568, v ds
+# define BFI_FLINEAR3_2569_TICK(t)
+# define BFI_FLINEAR3_2568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2567, v ds
+# define BFI_FLINEAR3_2568_TICK(t)
+# define BFI_FLINEAR3_2567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2566, v ds
+# define BFI_FLINEAR3_2567_TICK(t)
+# define BFI_FLINEAR3_2566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2565, v ds
+# define BFI_FLINEAR3_2566_TICK(t)
+# define BFI_FLINEAR3_2565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2564, v ds
+# define BFI_FLINEAR3_2565_TICK(t)
+# define BFI_FLINEAR3_2564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2563, v ds
+# define BFI_FLINEAR3_2564_TICK(t)
+# define BFI_FLINEAR3_2563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2562, v ds
+# define BFI_FLINEAR3_2563_TICK(t)
+# define BFI_FLINEAR3_2562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2561, v ds
+# define BFI_FLINEAR3_2562_TICK(t)
+# define BFI_FLINEAR3_2561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2560, v ds
+# define BFI_FLINEAR3_2561_TICK(t)
+# define BFI_FLINEAR3_2560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2559, v ds
+# define BFI_FLINEAR3_2560_TICK(t)
+# define BFI_FLINEAR3_2559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2558, v ds
+# define BFI_FLINEAR3_2559_TICK(t)
+# define BFI_FLINEAR3_2558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2557, v ds
+# define BFI_FLINEAR3_2558_TICK(t)
+# define BFI_FLINEAR3_2557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2556, v ds
+# define BFI_FLINEAR3_2557_TICK(t)
+# define BFI_FLINEAR3_2556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2555, v ds
+# define BFI_FLINEAR3_2556_TICK(t)
+# define BFI_FLINEAR3_2555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2554, v ds
+# define BFI_FLINEAR3_2555_TICK(t)
+# define BFI_FLINEAR3_2554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2553, v ds
+# define BFI_FLINEAR3_2554_TICK(t)
+# define BFI_FLINEAR3_2553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2552, v ds
+# define BFI_FLINEAR3_2553_TICK(t)
+# define BFI_FLINEAR3_2552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2551, v ds
+# define BFI_FLINEAR3_2552_TICK(t)
+# define BFI_FLINEAR3_2551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2550, v ds
+# define BFI_FLINEAR3_2551_TICK(t)
+# define BFI_FLINEAR3_2550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2549, v ds
+# define BFI_FLINEAR3_2550_TICK(t)
+# define BFI_FLINEAR3_2549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2548, v ds
+# define BFI_FLINEAR3_2549_TICK(t)
+# define BFI_FLINEAR3_2548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2547, v ds
+# define BFI_FLINEAR3_2548_TICK(t)
+# define BFI_FLINEAR3_2547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2546, v ds
+# define BFI_FLINEAR3_2547_TICK(t)
+# define BFI_FLINEAR3_2546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2545, v ds
+# define BFI_FLINEAR3_2546_TICK(t)
+# define BFI_FLINEAR3_2545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2544, v ds
+# define BFI_FLINEAR3_2545_TICK(t)
+# define BFI_FLINEAR3_2544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2543, v ds
+# define BFI_FLINEAR3_2544_TICK(t)
+# define BFI_FLINEAR3_2543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2542, v ds
+# define BFI_FLINEAR3_2543_TICK(t)
+# define BFI_FLINEAR3_2542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2541, v ds
+# define BFI_FLINEAR3_2542_TICK(t)
+# define BFI_FLINEAR3_2541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2540, v ds
+# define BFI_FLINEAR3_2541_TICK(t)
+# define BFI_FLINEAR3_2540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2539, v ds
+# define BFI_FLINEAR3_2540_TICK(t)
+# define BFI_FLINEAR3_2539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2538, v ds
+# define BFI_FLINEAR3_2539_TICK(t)
+# define BFI_FLINEAR3_2538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2537, v ds
+# define BFI_FLINEAR3_2538_TICK(t)
+# define BFI_FLINEAR3_2537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2536, v ds
+# define BFI_FLINEAR3_2537_TICK(t)
+# define BFI_FLINEAR3_2536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2535, v ds
+# define BFI_FLINEAR3_2536_TICK(t)
+# define BFI_FLINEAR3_2535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2534, v ds
+# define BFI_FLINEAR3_2535_TICK(t)
+# define BFI_FLINEAR3_2534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2533, v ds
+# define BFI_FLINEAR3_2534_TICK(t)
+# define BFI_FLINEAR3_2533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2532, v ds
+# define BFI_FLINEAR3_2533_TICK(t)
+# define BFI_FLINEAR3_2532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2531, v ds
+# define BFI_FLINEAR3_2532_TICK(t)
+# define BFI_FLINEAR3_2531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2530, v ds
+# define BFI_FLINEAR3_2531_TICK(t)
+# define BFI_FLINEAR3_2530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2529, v ds
+# define BFI_FLINEAR3_2530_TICK(t)
+# define BFI_FLINEAR3_2529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2528, v ds
+# define BFI_FLINEAR3_2529_TICK(t)
+# define BFI_FLINEAR3_2528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2527, v ds
+# define BFI_FLINEAR3_2528_TICK(t)
+# define BFI_FLINEAR3_2527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2526, v ds
+# define BFI_FLINEAR3_2527_TICK(t)
+# define BFI_FLINEAR3_2526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2525, v ds
+# define BFI_FLINEAR3_2526_TICK(t)
+# define BFI_FLINEAR3_2525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2524, v ds
+# define BFI_FLINEAR3_2525_TICK(t)
+# define BFI_FLINEAR3_2524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2523, v ds
+# define BFI_FLINEAR3_2524_TICK(t)
+# define BFI_FLINEAR3_2523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2522, v ds
+# define BFI_FLINEAR3_2523_TICK(t)
+# define BFI_FLINEAR3_2522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2521, v ds
+# define BFI_FLINEAR3_2522_TICK(t)
+# define BFI_FLINEAR3_2521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2520, v ds
+# define BFI_FLINEAR3_2521_TICK(t)
+# define BFI_FLINEAR3_2520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2519, v ds
+# define BFI_FLINEAR3_2520_TICK(t)
+# define BFI_FLINEAR3_2519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2518, v ds
+# define BFI_FLINEAR3_2519_TICK(t)
+# define BFI_FLINEAR3_2518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2517, v ds
+# define BFI_FLINEAR3_2518_TICK(t)
+# define BFI_FLINEAR3_2517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2516, v ds
+# define BFI_FLINEAR3_2517_TICK(t)
+# define BFI_FLINEAR3_2516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2515, v ds
+# define BFI_FLINEAR3_2516_TICK(t)
+# define BFI_FLINEAR3_2515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2514, v ds
+# define BFI_FLINEAR3_2515_TICK(t)
+# define BFI_FLINEAR3_2514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2513, v ds
+# define BFI_FLINEAR3_2514_TICK(t)
+# define BFI_FLINEAR3_2513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2512, v ds
+# define BFI_FLINEAR3_2513_TICK(t)
+# define BFI_FLINEAR3_2512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2511, v ds
+# define BFI_FLINEAR3_2512_TICK(t)
+# define BFI_FLINEAR3_2511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2510, v ds
+# define BFI_FLINEAR3_2511_TICK(t)
+# define BFI_FLINEAR3_2510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2509, v ds
+# define BFI_FLINEAR3_2510_TICK(t)
+# define BFI_FLINEAR3_2509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2508, v ds
+# define BFI_FLINEAR3_2509_TICK(t)
+# define BFI_FLINEAR3_2508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2507, v ds
+# define BFI_FLINEAR3_2508_TICK(t)
+# define BFI_FLINEAR3_2507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2506, v ds
+# define BFI_FLINEAR3_2507_TICK(t)
+# define BFI_FLINEAR3_2506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2505, v ds
+# define BFI_FLINEAR3_2506_TICK(t)
+# define BFI_FLINEAR3_2505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2504, v ds
+# define BFI_FLINEAR3_2505_TICK(t)
+# define BFI_FLINEAR3_2504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2503, v ds
+# define BFI_FLINEAR3_2504_TICK(t)
+# define BFI_FLINEAR3_2503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2502, v ds
+# define BFI_FLINEAR3_2503_TICK(t)
+# define BFI_FLINEAR3_2502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2501, v ds
+# define BFI_FLINEAR3_2502_TICK(t)
+# define BFI_FLINEAR3_2501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2500, v ds
+# define BFI_FLINEAR3_2501_TICK(t)
+# define BFI_FLINEAR3_2500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2499, v ds
+# define BFI_FLINEAR3_2500_TICK(t)
+# define BFI_FLINEAR3_2499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2498, v ds
+# define BFI_FLINEAR3_2499_TICK(t)
+# define BFI_FLINEAR3_2498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2497, v ds
+# define BFI_FLINEAR3_2498_TICK(t)
+# define BFI_FLINEAR3_2497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2496, v ds
+# define BFI_FLINEAR3_2497_TICK(t)
+# define BFI_FLINEAR3_2496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2495, v ds
+# define BFI_FLINEAR3_2496_TICK(t)
+# define BFI_FLINEAR3_2495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2494, v ds
+# define BFI_FLINEAR3_2495_TICK(t)
+# define BFI_FLINEAR3_2494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2493, v ds
+# define BFI_FLINEAR3_2494_TICK(t)
+# define BFI_FLINEAR3_2493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2492, v ds
+# define BFI_FLINEAR3_2493_TICK(t)
+# define BFI_FLINEAR3_2492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2491, v ds
+# define BFI_FLINEAR3_2492_TICK(t)
+# define BFI_FLINEAR3_2491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2490, v ds
+# define BFI_FLINEAR3_2491_TICK(t)
+# define BFI_FLINEAR3_2490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2489, v ds
+# define BFI_FLINEAR3_2490_TICK(t)
+# define BFI_FLINEAR3_2489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2488, v ds
+# define BFI_FLINEAR3_2489_TICK(t)
+# define BFI_FLINEAR3_2488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2487, v ds
+# define BFI_FLINEAR3_2488_TICK(t)
+# define BFI_FLINEAR3_2487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2486, v ds
+# define BFI_FLINEAR3_2487_TICK(t)
+# define BFI_FLINEAR3_2486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2485, v ds
+# define BFI_FLINEAR3_2486_TICK(t)
+# define BFI_FLINEAR3_2485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2484, v ds
+# define BFI_FLINEAR3_2485_TICK(t)
+# define BFI_FLINEAR3_2484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2483, v ds
+# define BFI_FLINEAR3_2484_TICK(t)
+# define BFI_FLINEAR3_2483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2482, v ds
+# define BFI_FLINEAR3_2483_TICK(t)
+# define BFI_FLINEAR3_2482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2481, v ds
+# define BFI_FLINEAR3_2482_TICK(t)
+# define BFI_FLINEAR3_2481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2480, v ds
+# define BFI_FLINEAR3_2481_TICK(t)
+# define BFI_FLINEAR3_2480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2479, v ds
+# define BFI_FLINEAR3_2480_TICK(t)
+# define BFI_FLINEAR3_2479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2478, v ds
+# define BFI_FLINEAR3_2479_TICK(t)
+# define BFI_FLINEAR3_2478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2477, v ds
+# define BFI_FLINEAR3_2478_TICK(t)
+# define BFI_FLINEAR3_2477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2476, v ds
+# define BFI_FLINEAR3_2477_TICK(t)
+# define BFI_FLINEAR3_2476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2475, v ds
+# define BFI_FLINEAR3_2476_TICK(t)
+# define BFI_FLINEAR3_2475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2474, v ds
+# define BFI_FLINEAR3_2475_TICK(t)
+# define BFI_FLINEAR3_2474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2473, v ds
+# define BFI_FLINEAR3_2474_TICK(t)
+# define BFI_FLINEAR3_2473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2472, v ds
+# define BFI_FLINEAR3_2473_TICK(t)
+# define BFI_FLINEAR3_2472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2471, v ds
+# define BFI_FLINEAR3_2472_TICK(t)
+# define BFI_FLINEAR3_2471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2470, v ds
+# define BFI_FLINEAR3_2471_TICK(t)
+# define BFI_FLINEAR3_2470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2469, v ds
+# define BFI_FLINEAR3_2470_TICK(t)
+# define BFI_FLINEAR3_2469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2468, v ds
+# define BFI_FLINEAR3_2469_TICK(t)
+# define BFI_FLINEAR3_2468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2467, v ds
+# define BFI_FLINEAR3_2468_TICK(t)
+# define BFI_FLINEAR3_2467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2466, v ds
+# define BFI_FLINEAR3_2467_TICK(t)
+# define BFI_FLINEAR3_2466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2465, v ds
+# define BFI_FLINEAR3_2466_TICK(t)
+# define BFI_FLINEAR3_2465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2464, v ds
+# define BFI_FLINEAR3_2465_TICK(t)
+# define BFI_FLINEAR3_2464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2463, v ds
+# define BFI_FLINEAR3_2464_TICK(t)
+# define BFI_FLINEAR3_2463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2462, v ds
+# define BFI_FLINEAR3_2463_TICK(t)
+# define BFI_FLINEAR3_2462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2461, v ds
+# define BFI_FLINEAR3_2462_TICK(t)
+# define BFI_FLINEAR3_2461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2460, v ds
+# define BFI_FLINEAR3_2461_TICK(t)
+# define BFI_FLINEAR3_2460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2459, v ds
+# define BFI_FLINEAR3_2460_TICK(t)
+# define BFI_FLINEAR3_2459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2458, v ds
+# define BFI_FLINEAR3_2459_TICK(t)
+# define BFI_FLINEAR3_2458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2457, v ds
+# define BFI_FLINEAR3_2458_TICK(t)
+# define BFI_FLINEAR3_2457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2456, v ds
+# define BFI_FLINEAR3_2457_TICK(t)
+# define BFI_FLINEAR3_2456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2455, v ds
+# define BFI_FLINEAR3_2456_TICK(t)
+# define BFI_FLINEAR3_2455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2454, v ds
+# define BFI_FLINEAR3_2455_TICK(t)
+# define BFI_FLINEAR3_2454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2453, v ds
+# define BFI_FLINEAR3_2454_TICK(t)
+# define BFI_FLINEAR3_2453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2452, v ds
+# define BFI_FLINEAR3_2453_TICK(t)
+# define BFI_FLINEAR3_2452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2451, v ds
+# define BFI_FLINEAR3_2452_TICK(t)
+# define BFI_FLINEAR3_2451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2450, v ds
+# define BFI_FLINEAR3_2451_TICK(t)
+# define BFI_FLINEAR3_2450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2449, v ds
+# define BFI_FLINEAR3_2450_TICK(t)
+# define BFI_FLINEAR3_2449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2448, v ds
+# define BFI_FLINEAR3_2449_TICK(t)
+# define BFI_FLINEAR3_2448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2447, v ds
+# define BFI_FLINEAR3_2448_TICK(t)
+# define BFI_FLINEAR3_2447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2446, v ds
+# define BFI_FLINEAR3_2447_TICK(t)
+# define BFI_FLINEAR3_2446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2445, v ds
+# define BFI_FLINEAR3_2446_TICK(t)
+# define BFI_FLINEAR3_2445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2444, v ds
+# define BFI_FLINEAR3_2445_TICK(t)
+# define BFI_FLINEAR3_2444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2443, v ds
+# define BFI_FLINEAR3_2444_TICK(t)
+# define BFI_FLINEAR3_2443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2442, v ds
+# define BFI_FLINEAR3_2443_TICK(t)
+# define BFI_FLINEAR3_2442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2441, v ds
+# define BFI_FLINEAR3_2442_TICK(t)
+# define BFI_FLINEAR3_2441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2440, v ds
+# define BFI_FLINEAR3_2441_TICK(t)
+# define BFI_FLINEAR3_2440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2439, v ds
+# define BFI_FLINEAR3_2440_TICK(t)
+# define BFI_FLINEAR3_2439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2438, v ds
+# define BFI_FLINEAR3_2439_TICK(t)
+# define BFI_FLINEAR3_2438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2437, v ds
+# define BFI_FLINEAR3_2438_TICK(t)
+# define BFI_FLINEAR3_2437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2436, v ds
+# define BFI_FLINEAR3_2437_TICK(t)
+# define BFI_FLINEAR3_2436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2435, v ds
+# define BFI_FLINEAR3_2436_TICK(t)
+# define BFI_FLINEAR3_2435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2434, v ds
+# define BFI_FLINEAR3_2435_TICK(t)
+# define BFI_FLINEAR3_2434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2433, v ds
+# define BFI_FLINEAR3_2434_TICK(t)
+# define BFI_FLINEAR3_2433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2432, v ds
+# define BFI_FLINEAR3_2433_TICK(t)
+# define BFI_FLINEAR3_2432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2431, v ds
+# define BFI_FLINEAR3_2432_TICK(t)
+# define BFI_FLINEAR3_2431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2430, v ds
+# define BFI_FLINEAR3_2431_TICK(t)
+# define BFI_FLINEAR3_2430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2429, v ds
+# define BFI_FLINEAR3_2430_TICK(t)
+# define BFI_FLINEAR3_2429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2428, v ds
+# define BFI_FLINEAR3_2429_TICK(t)
+# define BFI_FLINEAR3_2428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2427, v ds
+# define BFI_FLINEAR3_2428_TICK(t)
+# define BFI_FLINEAR3_2427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2426, v ds
+# define BFI_FLINEAR3_2427_TICK(t)
+# define BFI_FLINEAR3_2426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2425, v ds
+# define BFI_FLINEAR3_2426_TICK(t)
+# define BFI_FLINEAR3_2425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2424, v ds
+# define BFI_FLINEAR3_2425_TICK(t)
+# define BFI_FLINEAR3_2424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2423, v ds
+# define BFI_FLINEAR3_2424_TICK(t)
+# define BFI_FLINEAR3_2423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2422, v ds
+# define BFI_FLINEAR3_2423_TICK(t)
+# define BFI_FLINEAR3_2422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2421, v ds
+# define BFI_FLINEAR3_2422_TICK(t)
+# define BFI_FLINEAR3_2421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2420, v ds
+# define BFI_FLINEAR3_2421_TICK(t)
+# define BFI_FLINEAR3_2420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2419, v ds
+# define BFI_FLINEAR3_2420_TICK(t)
+# define BFI_FLINEAR3_2419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2418, v ds
+# define BFI_FLINEAR3_2419_TICK(t)
+# define BFI_FLINEAR3_2418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2417, v ds
+# define BFI_FLINEAR3_2418_TICK(t)
+# define BFI_FLINEAR3_2417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2416, v ds
+# define BFI_FLINEAR3_2417_TICK(t)
+# define BFI_FLINEAR3_2416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2415, v ds
+# define BFI_FLINEAR3_2416_TICK(t)
+# define BFI_FLINEAR3_2415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2414, v ds
+# define BFI_FLINEAR3_2415_TICK(t)
+# define BFI_FLINEAR3_2414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2413, v ds
+# define BFI_FLINEAR3_2414_TICK(t)
+# define BFI_FLINEAR3_2413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2412, v ds
+# define BFI_FLINEAR3_2413_TICK(t)
+# define BFI_FLINEAR3_2412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2411, v ds
+# define BFI_FLINEAR3_2412_TICK(t)
+# define BFI_FLINEAR3_2411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2410, v ds
+# define BFI_FLINEAR3_2411_TICK(t)
+# define BFI_FLINEAR3_2410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2409, v ds
+# define BFI_FLINEAR3_2410_TICK(t)
+# define BFI_FLINEAR3_2409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2408, v ds
+# define BFI_FLINEAR3_2409_TICK(t)
+# define BFI_FLINEAR3_2408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2407, v ds
+# define BFI_FLINEAR3_2408_TICK(t)
+# define BFI_FLINEAR3_2407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2406, v ds
+# define BFI_FLINEAR3_2407_TICK(t)
+# define BFI_FLINEAR3_2406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2405, v ds
+# define BFI_FLINEAR3_2406_TICK(t)
+# define BFI_FLINEAR3_2405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2404, v ds
+# define BFI_FLINEAR3_2405_TICK(t)
+# define BFI_FLINEAR3_2404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2403, v ds
+# define BFI_FLINEAR3_2404_TICK(t)
+# define BFI_FLINEAR3_2403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2402, v ds
+# define BFI_FLINEAR3_2403_TICK(t)
+# define BFI_FLINEAR3_2402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2401, v ds
+# define BFI_FLINEAR3_2402_TICK(t)
+# define BFI_FLINEAR3_2401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2400, v ds
+# define BFI_FLINEAR3_2401_TICK(t)
+# define BFI_FLINEAR3_2400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2399, v ds
+# define BFI_FLINEAR3_2400_TICK(t)
+# define BFI_FLINEAR3_2399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2398, v ds
+# define BFI_FLINEAR3_2399_TICK(t)
+# define BFI_FLINEAR3_2398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2397, v ds
+# define BFI_FLINEAR3_2398_TICK(t)
+# define BFI_FLINEAR3_2397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2396, v ds
+# define BFI_FLINEAR3_2397_TICK(t)
+# define BFI_FLINEAR3_2396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2395, v ds
+# define BFI_FLINEAR3_2396_TICK(t)
+# define BFI_FLINEAR3_2395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2394, v ds
+# define BFI_FLINEAR3_2395_TICK(t)
+# define BFI_FLINEAR3_2394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2393, v ds
+# define BFI_FLINEAR3_2394_TICK(t)
+# define BFI_FLINEAR3_2393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2392, v ds
+# define BFI_FLINEAR3_2393_TICK(t)
+# define BFI_FLINEAR3_2392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2391, v ds
+# define BFI_FLINEAR3_2392_TICK(t)
+# define BFI_FLINEAR3_2391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2390, v ds
+# define BFI_FLINEAR3_2391_TICK(t)
+# define BFI_FLINEAR3_2390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2389, v ds
+# define BFI_FLINEAR3_2390_TICK(t)
+# define BFI_FLINEAR3_2389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2388, v ds
+# define BFI_FLINEAR3_2389_TICK(t)
+# define BFI_FLINEAR3_2388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2387, v ds
+# define BFI_FLINEAR3_2388_TICK(t)
+# define BFI_FLINEAR3_2387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2386, v ds
+# define BFI_FLINEAR3_2387_TICK(t)
+# define BFI_FLINEAR3_2386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2385, v ds
+# define BFI_FLINEAR3_2386_TICK(t)
+# define BFI_FLINEAR3_2385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2384, v ds
+# define BFI_FLINEAR3_2385_TICK(t)
+# define BFI_FLINEAR3_2384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2383, v ds
+# define BFI_FLINEAR3_2384_TICK(t)
+# define BFI_FLINEAR3_2383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2382, v ds
+# define BFI_FLINEAR3_2383_TICK(t)
+# define BFI_FLINEAR3_2382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2381, v ds
+# define BFI_FLINEAR3_2382_TICK(t)
+# define BFI_FLINEAR3_2381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2380, v ds
+# define BFI_FLINEAR3_2381_TICK(t)
+# define BFI_FLINEAR3_2380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2379, v ds
+# define BFI_FLINEAR3_2380_TICK(t)
+# define BFI_FLINEAR3_2379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2378, v ds
+# define BFI_FLINEAR3_2379_TICK(t)
+# define BFI_FLINEAR3_2378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2377, v ds
+# define BFI_FLINEAR3_2378_TICK(t)
+# define BFI_FLINEAR3_2377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2376, v ds
+# define BFI_FLINEAR3_2377_TICK(t)
+# define BFI_FLINEAR3_2376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2375, v ds
+# define BFI_FLINEAR3_2376_TICK(t)
+# define BFI_FLINEAR3_2375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2374, v ds
+# define BFI_FLINEAR3_2375_TICK(t)
+# define BFI_FLINEAR3_2374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2373, v ds
+# define BFI_FLINEAR3_2374_TICK(t)
+# define BFI_FLINEAR3_2373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2372, v ds
+# define BFI_FLINEAR3_2373_TICK(t)
+# define BFI_FLINEAR3_2372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2371, v ds
+# define BFI_FLINEAR3_2372_TICK(t)
+# define BFI_FLINEAR3_2371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2370, v ds
+# define BFI_FLINEAR3_2371_TICK(t)
+# define BFI_FLINEAR3_2370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2369, v ds
+# define BFI_FLINEAR3_2370_TICK(t)
+# define BFI_FLINEAR3_2369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2368, v ds
+# define BFI_FLINEAR3_2369_TICK(t)
+# define BFI_FLINEAR3_2368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2367, v ds
+# define BFI_FLINEAR3_2368_TICK(t)
+# define BFI_FLINEAR3_2367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2366, v ds
+# define BFI_FLINEAR3_2367_TICK(t)
+# define BFI_FLINEAR3_2366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2365, v ds
+# define BFI_FLINEAR3_2366_TICK(t)
+# define BFI_FLINEAR3_2365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2364, v ds
+# define BFI_FLINEAR3_2365_TICK(t)
+# define BFI_FLINEAR3_2364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2363, v ds
+# define BFI_FLINEAR3_2364_TICK(t)
+# define BFI_FLINEAR3_2363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2362, v ds
+# define BFI_FLINEAR3_2363_TICK(t)
+# define BFI_FLINEAR3_2362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2361, v ds
+# define BFI_FLINEAR3_2362_TICK(t)
+# define BFI_FLINEAR3_2361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2360, v ds
+# define BFI_FLINEAR3_2361_TICK(t)
+# define BFI_FLINEAR3_2360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2359, v ds
+# define BFI_FLINEAR3_2360_TICK(t)
+# define BFI_FLINEAR3_2359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2358, v ds
+# define BFI_FLINEAR3_2359_TICK(t)
+# define BFI_FLINEAR3_2358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2357, v ds
+# define BFI_FLINEAR3_2358_TICK(t)
+# define BFI_FLINEAR3_2357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2356, v ds
+# define BFI_FLINEAR3_2357_TICK(t)
+# define BFI_FLINEAR3_2356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2355, v ds
+# define BFI_FLINEAR3_2356_TICK(t)
+# define BFI_FLINEAR3_2355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2354, v ds
+# define BFI_FLINEAR3_2355_TICK(t)
+# define BFI_FLINEAR3_2354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2353, v ds
+# define BFI_FLINEAR3_2354_TICK(t)
+# define BFI_FLINEAR3_2353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2352, v ds
+# define BFI_FLINEAR3_2353_TICK(t)
+# define BFI_FLINEAR3_2352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2351, v ds
+# define BFI_FLINEAR3_2352_TICK(t)
+# define BFI_FLINEAR3_2351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2350, v ds
+# define BFI_FLINEAR3_2351_TICK(t)
+# define BFI_FLINEAR3_2350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2349, v ds
+# define BFI_FLINEAR3_2350_TICK(t)
+# define BFI_FLINEAR3_2349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2348, v ds
+# define BFI_FLINEAR3_2349_TICK(t)
+# define BFI_FLINEAR3_2348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2347, v ds
+# define BFI_FLINEAR3_2348_TICK(t)
+# define BFI_FLINEAR3_2347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2346, v ds
+# define BFI_FLINEAR3_2347_TICK(t)
+# define BFI_FLINEAR3_2346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2345, v ds
+# define BFI_FLINEAR3_2346_TICK(t)
+# define BFI_FLINEAR3_2345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2344, v ds
+# define BFI_FLINEAR3_2345_TICK(t)
+# define BFI_FLINEAR3_2344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2343, v ds
+# define BFI_FLINEAR3_2344_TICK(t)
+# define BFI_FLINEAR3_2343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2342, v ds
+# define BFI_FLINEAR3_2343_TICK(t)
+# define BFI_FLINEAR3_2342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2341, v ds
+# define BFI_FLINEAR3_2342_TICK(t)
+# define BFI_FLINEAR3_2341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2340, v ds
+# define BFI_FLINEAR3_2341_TICK(t)
+# define BFI_FLINEAR3_2340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2339, v ds
+# define BFI_FLINEAR3_2340_TICK(t)
+# define BFI_FLINEAR3_2339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2338, v ds
+# define BFI_FLINEAR3_2339_TICK(t)
+# define BFI_FLINEAR3_2338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2337, v ds
+# define BFI_FLINEAR3_2338_TICK(t)
+# define BFI_FLINEAR3_2337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2336, v ds
+# define BFI_FLINEAR3_2337_TICK(t)
+# define BFI_FLINEAR3_2336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2335, v ds
+# define BFI_FLINEAR3_2336_TICK(t)
+# define BFI_FLINEAR3_2335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2334, v ds
+# define BFI_FLINEAR3_2335_TICK(t)
+# define BFI_FLINEAR3_2334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2333, v ds
+# define BFI_FLINEAR3_2334_TICK(t)
+# define BFI_FLINEAR3_2333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2332, v ds
+# define BFI_FLINEAR3_2333_TICK(t)
+# define BFI_FLINEAR3_2332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2331, v ds
+# define BFI_FLINEAR3_2332_TICK(t)
+# define BFI_FLINEAR3_2331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2330, v ds
+# define BFI_FLINEAR3_2331_TICK(t)
+# define BFI_FLINEAR3_2330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2329, v ds
+# define BFI_FLINEAR3_2330_TICK(t)
+# define BFI_FLINEAR3_2329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2328, v ds
+# define BFI_FLINEAR3_2329_TICK(t)
+# define BFI_FLINEAR3_2328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2327, v ds
+# define BFI_FLINEAR3_2328_TICK(t)
+# define BFI_FLINEAR3_2327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2326, v ds
+# define BFI_FLINEAR3_2327_TICK(t)
+# define BFI_FLINEAR3_2326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2325, v ds
+# define BFI_FLINEAR3_2326_TICK(t)
+# define BFI_FLINEAR3_2325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2324, v ds
+# define BFI_FLINEAR3_2325_TICK(t)
+# define BFI_FLINEAR3_2324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2323, v ds
+# define BFI_FLINEAR3_2324_TICK(t)
+# define BFI_FLINEAR3_2323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2322, v ds
+# define BFI_FLINEAR3_2323_TICK(t)
+# define BFI_FLINEAR3_2322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2321, v ds
+# define BFI_FLINEAR3_2322_TICK(t)
+# define BFI_FLINEAR3_2321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2320, v ds
+# define BFI_FLINEAR3_2321_TICK(t)
+# define BFI_FLINEAR3_2320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2319, v ds
+# define BFI_FLINEAR3_2320_TICK(t)
+# define BFI_FLINEAR3_2319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2318, v ds
+# define BFI_FLINEAR3_2319_TICK(t)
+# define BFI_FLINEAR3_2318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2317, v ds
+# define BFI_FLINEAR3_2318_TICK(t)
+# define BFI_FLINEAR3_2317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2316, v ds
+# define BFI_FLINEAR3_2317_TICK(t)
+# define BFI_FLINEAR3_2316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2315, v ds
+# define BFI_FLINEAR3_2316_TICK(t)
+# define BFI_FLINEAR3_2315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2314, v ds
+# define BFI_FLINEAR3_2315_TICK(t)
+# define BFI_FLINEAR3_2314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2313, v ds
+# define BFI_FLINEAR3_2314_TICK(t)
+# define BFI_FLINEAR3_2313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2312, v ds
+# define BFI_FLINEAR3_2313_TICK(t)
+# define BFI_FLINEAR3_2312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2311, v ds
+# define BFI_FLINEAR3_2312_TICK(t)
+# define BFI_FLINEAR3_2311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2310, v ds
+# define BFI_FLINEAR3_2311_TICK(t)
+# define BFI_FLINEAR3_2310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2309, v ds
+# define BFI_FLINEAR3_2310_TICK(t)
+# define BFI_FLINEAR3_2309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2308, v ds
+# define BFI_FLINEAR3_2309_TICK(t)
+# define BFI_FLINEAR3_2308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2307, v ds
+# define BFI_FLINEAR3_2308_TICK(t)
+# define BFI_FLINEAR3_2307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2306, v ds
+# define BFI_FLINEAR3_2307_TICK(t)
+# define BFI_FLINEAR3_2306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2305, v ds
+# define BFI_FLINEAR3_2306_TICK(t)
+# define BFI_FLINEAR3_2305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2304, v ds
+# define BFI_FLINEAR3_2305_TICK(t)
+# define BFI_FLINEAR3_2304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2303, v ds
+# define BFI_FLINEAR3_2304_TICK(t)
+# define BFI_FLINEAR3_2303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2302, v ds
+# define BFI_FLINEAR3_2303_TICK(t)
+# define BFI_FLINEAR3_2302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2301, v ds
+# define BFI_FLINEAR3_2302_TICK(t)
+# define BFI_FLINEAR3_2301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2300, v ds
+# define BFI_FLINEAR3_2301_TICK(t)
+# define BFI_FLINEAR3_2300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2299, v ds
+# define BFI_FLINEAR3_2300_TICK(t)
+# define BFI_FLINEAR3_2299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2298, v ds
+# define BFI_FLINEAR3_2299_TICK(t)
+# define BFI_FLINEAR3_2298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2297, v ds
+# define BFI_FLINEAR3_2298_TICK(t)
+# define BFI_FLINEAR3_2297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2296, v ds
+# define BFI_FLINEAR3_2297_TICK(t)
+# define BFI_FLINEAR3_2296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2295, v ds
+# define BFI_FLINEAR3_2296_TICK(t)
+# define BFI_FLINEAR3_2295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2294, v ds
+# define BFI_FLINEAR3_2295_TICK(t)
+# define BFI_FLINEAR3_2294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2293, v ds
+# define BFI_FLINEAR3_2294_TICK(t)
+# define BFI_FLINEAR3_2293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2292, v ds
+# define BFI_FLINEAR3_2293_TICK(t)
+# define BFI_FLINEAR3_2292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2291, v ds
+# define BFI_FLINEAR3_2292_TICK(t)
+# define BFI_FLINEAR3_2291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2290, v ds
+# define BFI_FLINEAR3_2291_TICK(t)
+# define BFI_FLINEAR3_2290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2289, v ds
+# define BFI_FLINEAR3_2290_TICK(t)
+# define BFI_FLINEAR3_2289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2288, v ds
+# define BFI_FLINEAR3_2289_TICK(t)
+# define BFI_FLINEAR3_2288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2287, v ds
+# define BFI_FLINEAR3_2288_TICK(t)
+# define BFI_FLINEAR3_2287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2286, v ds
+# define BFI_FLINEAR3_2287_TICK(t)
+# define BFI_FLINEAR3_2286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2285, v ds
+# define BFI_FLINEAR3_2286_TICK(t)
+# define BFI_FLINEAR3_2285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2284, v ds
+# define BFI_FLINEAR3_2285_TICK(t)
+# define BFI_FLINEAR3_2284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2283, v ds
+# define BFI_FLINEAR3_2284_TICK(t)
+# define BFI_FLINEAR3_2283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2282, v ds
+# define BFI_FLINEAR3_2283_TICK(t)
+# define BFI_FLINEAR3_2282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2281, v ds
+# define BFI_FLINEAR3_2282_TICK(t)
+# define BFI_FLINEAR3_2281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2280, v ds
+# define BFI_FLINEAR3_2281_TICK(t)
+# define BFI_FLINEAR3_2280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2279, v ds
+# define BFI_FLINEAR3_2280_TICK(t)
+# define BFI_FLINEAR3_2279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2278, v ds
+# define BFI_FLINEAR3_2279_TICK(t)
+# define BFI_FLINEAR3_2278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2277, v ds
+# define BFI_FLINEAR3_2278_TICK(t)
+# define BFI_FLINEAR3_2277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2276, v ds
+# define BFI_FLINEAR3_2277_TICK(t)
+# define BFI_FLINEAR3_2276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2275, v ds
+# define BFI_FLINEAR3_2276_TICK(t)
+# define BFI_FLINEAR3_2275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2274, v ds
+# define BFI_FLINEAR3_2275_TICK(t)
+# define BFI_FLINEAR3_2274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2273, v ds
+# define BFI_FLINEAR3_2274_TICK(t)
+# define BFI_FLINEAR3_2273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2272, v ds
+# define BFI_FLINEAR3_2273_TICK(t)
+# define BFI_FLINEAR3_2272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2271, v ds
+# define BFI_FLINEAR3_2272_TICK(t)
+# define BFI_FLINEAR3_2271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2270, v ds
+# define BFI_FLINEAR3_2271_TICK(t)
+# define BFI_FLINEAR3_2270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2269, v ds
+# define BFI_FLINEAR3_2270_TICK(t)
+# define BFI_FLINEAR3_2269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2268, v ds
+# define BFI_FLINEAR3_2269_TICK(t)
+# define BFI_FLINEAR3_2268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2267, v ds
+# define BFI_FLINEAR3_2268_TICK(t)
+# define BFI_FLINEAR3_2267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2266, v ds
+# define BFI_FLINEAR3_2267_TICK(t)
+# define BFI_FLINEAR3_2266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2265, v ds
+# define BFI_FLINEAR3_2266_TICK(t)
+# define BFI_FLINEAR3_2265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2264, v ds
+# define BFI_FLINEAR3_2265_TICK(t)
+# define BFI_FLINEAR3_2264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2263, v ds
+# define BFI_FLINEAR3_2264_TICK(t)
+# define BFI_FLINEAR3_2263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2262, v ds
+# define BFI_FLINEAR3_2263_TICK(t)
+# define BFI_FLINEAR3_2262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2261, v ds
+# define BFI_FLINEAR3_2262_TICK(t)
+# define BFI_FLINEAR3_2261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2260, v ds
+# define BFI_FLINEAR3_2261_TICK(t)
+# define BFI_FLINEAR3_2260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2259, v ds
+# define BFI_FLINEAR3_2260_TICK(t)
+# define BFI_FLINEAR3_2259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2258, v ds
+# define BFI_FLINEAR3_2259_TICK(t)
+# define BFI_FLINEAR3_2258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2257, v ds
+# define BFI_FLINEAR3_2258_TICK(t)
+# define BFI_FLINEAR3_2257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2256, v ds
+# define BFI_FLINEAR3_2257_TICK(t)
+# define BFI_FLINEAR3_2256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2255, v ds
+# define BFI_FLINEAR3_2256_TICK(t)
+# define BFI_FLINEAR3_2255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2254, v ds
+# define BFI_FLINEAR3_2255_TICK(t)
+# define BFI_FLINEAR3_2254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2253, v ds
+# define BFI_FLINEAR3_2254_TICK(t)
+# define BFI_FLINEAR3_2253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2252, v ds
+# define BFI_FLINEAR3_2253_TICK(t)
+# define BFI_FLINEAR3_2252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2251, v ds
+# define BFI_FLINEAR3_2252_TICK(t)
+# define BFI_FLINEAR3_2251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2250, v ds
+# define BFI_FLINEAR3_2251_TICK(t)
+# define BFI_FLINEAR3_2250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2249, v ds
+# define BFI_FLINEAR3_2250_TICK(t)
+# define BFI_FLINEAR3_2249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2248, v ds
+# define BFI_FLINEAR3_2249_TICK(t)
+# define BFI_FLINEAR3_2248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2247, v ds
+# define BFI_FLINEAR3_2248_TICK(t)
+# define BFI_FLINEAR3_2247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2246, v ds
+# define BFI_FLINEAR3_2247_TICK(t)
+# define BFI_FLINEAR3_2246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2245, v ds
+# define BFI_FLINEAR3_2246_TICK(t)
+# define BFI_FLINEAR3_2245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2244, v ds
+# define BFI_FLINEAR3_2245_TICK(t)
+# define BFI_FLINEAR3_2244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2243, v ds
+# define BFI_FLINEAR3_2244_TICK(t)
+# define BFI_FLINEAR3_2243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2242, v ds
+# define BFI_FLINEAR3_2243_TICK(t)
+# define BFI_FLINEAR3_2242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2241, v ds
+# define BFI_FLINEAR3_2242_TICK(t)
+# define BFI_FLINEAR3_2241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2240, v ds
+# define BFI_FLINEAR3_2241_TICK(t)
+# define BFI_FLINEAR3_2240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2239, v ds
+# define BFI_FLINEAR3_2240_TICK(t)
+# define BFI_FLINEAR3_2239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2238, v ds
+# define BFI_FLINEAR3_2239_TICK(t)
+# define BFI_FLINEAR3_2238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2237, v ds
+# define BFI_FLINEAR3_2238_TICK(t)
+# define BFI_FLINEAR3_2237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2236, v ds
+# define BFI_FLINEAR3_2237_TICK(t)
+# define BFI_FLINEAR3_2236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2235, v ds
+# define BFI_FLINEAR3_2236_TICK(t)
+# define BFI_FLINEAR3_2235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2234, v ds
+# define BFI_FLINEAR3_2235_TICK(t)
+# define BFI_FLINEAR3_2234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2233, v ds
+# define BFI_FLINEAR3_2234_TICK(t)
+# define BFI_FLINEAR3_2233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2232, v ds
+# define BFI_FLINEAR3_2233_TICK(t)
+# define BFI_FLINEAR3_2232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2231, v ds
+# define BFI_FLINEAR3_2232_TICK(t)
+# define BFI_FLINEAR3_2231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2230, v ds
+# define BFI_FLINEAR3_2231_TICK(t)
+# define BFI_FLINEAR3_2230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2229, v ds
+# define BFI_FLINEAR3_2230_TICK(t)
+# define BFI_FLINEAR3_2229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2228, v ds
+# define BFI_FLINEAR3_2229_TICK(t)
+# define BFI_FLINEAR3_2228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2227, v ds
+# define BFI_FLINEAR3_2228_TICK(t)
+# define BFI_FLINEAR3_2227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2226, v ds
+# define BFI_FLINEAR3_2227_TICK(t)
+# define BFI_FLINEAR3_2226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2225, v ds
+# define BFI_FLINEAR3_2226_TICK(t)
+# define BFI_FLINEAR3_2225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2224, v ds
+# define BFI_FLINEAR3_2225_TICK(t)
+# define BFI_FLINEAR3_2224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2223, v ds
+# define BFI_FLINEAR3_2224_TICK(t)
+# define BFI_FLINEAR3_2223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2222, v ds
+# define BFI_FLINEAR3_2223_TICK(t)
+# define BFI_FLINEAR3_2222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2221, v ds
+# define BFI_FLINEAR3_2222_TICK(t)
+# define BFI_FLINEAR3_2221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2220, v ds
+# define BFI_FLINEAR3_2221_TICK(t)
+# define BFI_FLINEAR3_2220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2219, v ds
+# define BFI_FLINEAR3_2220_TICK(t)
+# define BFI_FLINEAR3_2219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2218, v ds
+# define BFI_FLINEAR3_2219_TICK(t)
+# define BFI_FLINEAR3_2218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2217, v ds
+# define BFI_FLINEAR3_2218_TICK(t)
+# define BFI_FLINEAR3_2217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2216, v ds
+# define BFI_FLINEAR3_2217_TICK(t)
+# define BFI_FLINEAR3_2216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2215, v ds
+# define BFI_FLINEAR3_2216_TICK(t)
+# define BFI_FLINEAR3_2215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2214, v ds
+# define BFI_FLINEAR3_2215_TICK(t)
+# define BFI_FLINEAR3_2214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2213, v ds
+# define BFI_FLINEAR3_2214_TICK(t)
+# define BFI_FLINEAR3_2213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2212, v ds
+# define BFI_FLINEAR3_2213_TICK(t)
+# define BFI_FLINEAR3_2212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2211, v ds
+# define BFI_FLINEAR3_2212_TICK(t)
+# define BFI_FLINEAR3_2211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2210, v ds
+# define BFI_FLINEAR3_2211_TICK(t)
+# define BFI_FLINEAR3_2210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2209, v ds
+# define BFI_FLINEAR3_2210_TICK(t)
+# define BFI_FLINEAR3_2209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2208, v ds
+# define BFI_FLINEAR3_2209_TICK(t)
+# define BFI_FLINEAR3_2208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2207, v ds
+# define BFI_FLINEAR3_2208_TICK(t)
+# define BFI_FLINEAR3_2207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2206, v ds
+# define BFI_FLINEAR3_2207_TICK(t)
+# define BFI_FLINEAR3_2206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2205, v ds
+# define BFI_FLINEAR3_2206_TICK(t)
+# define BFI_FLINEAR3_2205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2204, v ds
+# define BFI_FLINEAR3_2205_TICK(t)
+# define BFI_FLINEAR3_2204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2203, v ds
+# define BFI_FLINEAR3_2204_TICK(t)
+# define BFI_FLINEAR3_2203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2202, v ds
+# define BFI_FLINEAR3_2203_TICK(t)
+# define BFI_FLINEAR3_2202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2201, v ds
+# define BFI_FLINEAR3_2202_TICK(t)
+# define BFI_FLINEAR3_2201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2200, v ds
+# define BFI_FLINEAR3_2201_TICK(t)
+# define BFI_FLINEAR3_2200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2199, v ds
+# define BFI_FLINEAR3_2200_TICK(t)
+# define BFI_FLINEAR3_2199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2198, v ds
+# define BFI_FLINEAR3_2199_TICK(t)
+# define BFI_FLINEAR3_2198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2197, v ds
+# define BFI_FLINEAR3_2198_TICK(t)
+# define BFI_FLINEAR3_2197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2196, v ds
+# define BFI_FLINEAR3_2197_TICK(t)
+# define BFI_FLINEAR3_2196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2195, v ds
+# define BFI_FLINEAR3_2196_TICK(t)
+# define BFI_FLINEAR3_2195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2194, v ds
+# define BFI_FLINEAR3_2195_TICK(t)
+# define BFI_FLINEAR3_2194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2193, v ds
+# define BFI_FLINEAR3_2194_TICK(t)
+# define BFI_FLINEAR3_2193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2192, v ds
+# define BFI_FLINEAR3_2193_TICK(t)
+# define BFI_FLINEAR3_2192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2191, v ds
+# define BFI_FLINEAR3_2192_TICK(t)
+# define BFI_FLINEAR3_2191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2190, v ds
+# define BFI_FLINEAR3_2191_TICK(t)
+# define BFI_FLINEAR3_2190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2189, v ds
+# define BFI_FLINEAR3_2190_TICK(t)
+# define BFI_FLINEAR3_2189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2188, v ds
+# define BFI_FLINEAR3_2189_TICK(t)
+# define BFI_FLINEAR3_2188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2187, v ds
+# define BFI_FLINEAR3_2188_TICK(t)
+# define BFI_FLINEAR3_2187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2186, v ds
+# define BFI_FLINEAR3_2187_TICK(t)
+# define BFI_FLINEAR3_2186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2185, v ds
+# define BFI_FLINEAR3_2186_TICK(t)
+# define BFI_FLINEAR3_2185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2184, v ds
+# define BFI_FLINEAR3_2185_TICK(t)
+# define BFI_FLINEAR3_2184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2183, v ds
+# define BFI_FLINEAR3_2184_TICK(t)
+# define BFI_FLINEAR3_2183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2182, v ds
+# define BFI_FLINEAR3_2183_TICK(t)
+# define BFI_FLINEAR3_2182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2181, v ds
+# define BFI_FLINEAR3_2182_TICK(t)
+# define BFI_FLINEAR3_2181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2180, v ds
+# define BFI_FLINEAR3_2181_TICK(t)
+# define BFI_FLINEAR3_2180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2179, v ds
+# define BFI_FLINEAR3_2180_TICK(t)
+# define BFI_FLINEAR3_2179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2178, v ds
+# define BFI_FLINEAR3_2179_TICK(t)
+# define BFI_FLINEAR3_2178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2177, v ds
+# define BFI_FLINEAR3_2178_TICK(t)
+# define BFI_FLINEAR3_2177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2176, v ds
+# define BFI_FLINEAR3_2177_TICK(t)
+# define BFI_FLINEAR3_2176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2175, v ds
+# define BFI_FLINEAR3_2176_TICK(t)
+# define BFI_FLINEAR3_2175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2174, v ds
+# define BFI_FLINEAR3_2175_TICK(t)
+# define BFI_FLINEAR3_2174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2173, v ds
+# define BFI_FLINEAR3_2174_TICK(t)
+# define BFI_FLINEAR3_2173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2172, v ds
+# define BFI_FLINEAR3_2173_TICK(t)
+# define BFI_FLINEAR3_2172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2171, v ds
+# define BFI_FLINEAR3_2172_TICK(t)
+# define BFI_FLINEAR3_2171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2170, v ds
+# define BFI_FLINEAR3_2171_TICK(t)
+# define BFI_FLINEAR3_2170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2169, v ds
+# define BFI_FLINEAR3_2170_TICK(t)
+# define BFI_FLINEAR3_2169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2168, v ds
+# define BFI_FLINEAR3_2169_TICK(t)
+# define BFI_FLINEAR3_2168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2167, v ds
+# define BFI_FLINEAR3_2168_TICK(t)
+# define BFI_FLINEAR3_2167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2166, v ds
+# define BFI_FLINEAR3_2167_TICK(t)
+# define BFI_FLINEAR3_2166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2165, v ds
+# define BFI_FLINEAR3_2166_TICK(t)
+# define BFI_FLINEAR3_2165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2164, v ds
+# define BFI_FLINEAR3_2165_TICK(t)
+# define BFI_FLINEAR3_2164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2163, v ds
+# define BFI_FLINEAR3_2164_TICK(t)
+# define BFI_FLINEAR3_2163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2162, v ds
+# define BFI_FLINEAR3_2163_TICK(t)
+# define BFI_FLINEAR3_2162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2161, v ds
+# define BFI_FLINEAR3_2162_TICK(t)
+# define BFI_FLINEAR3_2161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2160, v ds
+# define BFI_FLINEAR3_2161_TICK(t)
+# define BFI_FLINEAR3_2160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2159, v ds
+# define BFI_FLINEAR3_2160_TICK(t)
+# define BFI_FLINEAR3_2159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2158, v ds
+# define BFI_FLINEAR3_2159_TICK(t)
+# define BFI_FLINEAR3_2158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2157, v ds
+# define BFI_FLINEAR3_2158_TICK(t)
+# define BFI_FLINEAR3_2157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2156, v ds
+# define BFI_FLINEAR3_2157_TICK(t)
+# define BFI_FLINEAR3_2156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2155, v ds
+# define BFI_FLINEAR3_2156_TICK(t)
+# define BFI_FLINEAR3_2155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2154, v ds
+# define BFI_FLINEAR3_2155_TICK(t)
+# define BFI_FLINEAR3_2154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2153, v ds
+# define BFI_FLINEAR3_2154_TICK(t)
+# define BFI_FLINEAR3_2153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2152, v ds
+# define BFI_FLINEAR3_2153_TICK(t)
+# define BFI_FLINEAR3_2152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2151, v ds
+# define BFI_FLINEAR3_2152_TICK(t)
+# define BFI_FLINEAR3_2151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2150, v ds
+# define BFI_FLINEAR3_2151_TICK(t)
+# define BFI_FLINEAR3_2150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2149, v ds
+# define BFI_FLINEAR3_2150_TICK(t)
+# define BFI_FLINEAR3_2149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2148, v ds
+# define BFI_FLINEAR3_2149_TICK(t)
+# define BFI_FLINEAR3_2148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2147, v ds
+# define BFI_FLINEAR3_2148_TICK(t)
+# define BFI_FLINEAR3_2147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2146, v ds
+# define BFI_FLINEAR3_2147_TICK(t)
+# define BFI_FLINEAR3_2146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2145, v ds
+# define BFI_FLINEAR3_2146_TICK(t)
+# define BFI_FLINEAR3_2145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2144, v ds
+# define BFI_FLINEAR3_2145_TICK(t)
+# define BFI_FLINEAR3_2144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2143, v ds
+# define BFI_FLINEAR3_2144_TICK(t)
+# define BFI_FLINEAR3_2143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2142, v ds
+# define BFI_FLINEAR3_2143_TICK(t)
+# define BFI_FLINEAR3_2142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2141, v ds
+# define BFI_FLINEAR3_2142_TICK(t)
+# define BFI_FLINEAR3_2141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2140, v ds
+# define BFI_FLINEAR3_2141_TICK(t)
+# define BFI_FLINEAR3_2140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2139, v ds
+# define BFI_FLINEAR3_2140_TICK(t)
+# define BFI_FLINEAR3_2139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2138, v ds
+# define BFI_FLINEAR3_2139_TICK(t)
+# define BFI_FLINEAR3_2138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2137, v ds
+# define BFI_FLINEAR3_2138_TICK(t)
+# define BFI_FLINEAR3_2137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2136, v ds
+# define BFI_FLINEAR3_2137_TICK(t)
+# define BFI_FLINEAR3_2136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2135, v ds
+# define BFI_FLINEAR3_2136_TICK(t)
+# define BFI_FLINEAR3_2135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2134, v ds
+# define BFI_FLINEAR3_2135_TICK(t)
+# define BFI_FLINEAR3_2134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2133, v ds
+# define BFI_FLINEAR3_2134_TICK(t)
+# define BFI_FLINEAR3_2133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2132, v ds
+# define BFI_FLINEAR3_2133_TICK(t)
+# define BFI_FLINEAR3_2132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2131, v ds
+# define BFI_FLINEAR3_2132_TICK(t)
+# define BFI_FLINEAR3_2131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2130, v ds
+# define BFI_FLINEAR3_2131_TICK(t)
+# define BFI_FLINEAR3_2130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2129, v ds
+# define BFI_FLINEAR3_2130_TICK(t)
+# define BFI_FLINEAR3_2129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2128, v ds
+# define BFI_FLINEAR3_2129_TICK(t)
+# define BFI_FLINEAR3_2128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2127, v ds
+# define BFI_FLINEAR3_2128_TICK(t)
+# define BFI_FLINEAR3_2127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2126, v ds
+# define BFI_FLINEAR3_2127_TICK(t)
+# define BFI_FLINEAR3_2126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2125, v ds
+# define BFI_FLINEAR3_2126_TICK(t)
+# define BFI_FLINEAR3_2125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2124, v ds
+# define BFI_FLINEAR3_2125_TICK(t)
+# define BFI_FLINEAR3_2124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2123, v ds
+# define BFI_FLINEAR3_2124_TICK(t)
+# define BFI_FLINEAR3_2123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2122, v ds
+# define BFI_FLINEAR3_2123_TICK(t)
+# define BFI_FLINEAR3_2122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2121, v ds
+# define BFI_FLINEAR3_2122_TICK(t)
+# define BFI_FLINEAR3_2121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2120, v ds
+# define BFI_FLINEAR3_2121_TICK(t)
+# define BFI_FLINEAR3_2120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2119, v ds
+# define BFI_FLINEAR3_2120_TICK(t)
+# define BFI_FLINEAR3_2119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2118, v ds
+# define BFI_FLINEAR3_2119_TICK(t)
+# define BFI_FLINEAR3_2118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2117, v ds
+# define BFI_FLINEAR3_2118_TICK(t)
+# define BFI_FLINEAR3_2117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2116, v ds
+# define BFI_FLINEAR3_2117_TICK(t)
+# define BFI_FLINEAR3_2116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2115, v ds
+# define BFI_FLINEAR3_2116_TICK(t)
+# define BFI_FLINEAR3_2115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2114, v ds
+# define BFI_FLINEAR3_2115_TICK(t)
+# define BFI_FLINEAR3_2114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2113, v ds
+# define BFI_FLINEAR3_2114_TICK(t)
+# define BFI_FLINEAR3_2113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2112, v ds
+# define BFI_FLINEAR3_2113_TICK(t)
+# define BFI_FLINEAR3_2112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2111, v ds
+# define BFI_FLINEAR3_2112_TICK(t)
+# define BFI_FLINEAR3_2111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2110, v ds
+# define BFI_FLINEAR3_2111_TICK(t)
+# define BFI_FLINEAR3_2110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2109, v ds
+# define BFI_FLINEAR3_2110_TICK(t)
+# define BFI_FLINEAR3_2109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2108, v ds
+# define BFI_FLINEAR3_2109_TICK(t)
+# define BFI_FLINEAR3_2108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2107, v ds
+# define BFI_FLINEAR3_2108_TICK(t)
+# define BFI_FLINEAR3_2107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2106, v ds
+# define BFI_FLINEAR3_2107_TICK(t)
+# define BFI_FLINEAR3_2106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2105, v ds
+# define BFI_FLINEAR3_2106_TICK(t)
+# define BFI_FLINEAR3_2105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2104, v ds
+# define BFI_FLINEAR3_2105_TICK(t)
+# define BFI_FLINEAR3_2104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2103, v ds
+# define BFI_FLINEAR3_2104_TICK(t)
+# define BFI_FLINEAR3_2103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2102, v ds
+# define BFI_FLINEAR3_2103_TICK(t)
+# define BFI_FLINEAR3_2102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2101, v ds
+# define BFI_FLINEAR3_2102_TICK(t)
+# define BFI_FLINEAR3_2101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2100, v ds
+# define BFI_FLINEAR3_2101_TICK(t)
+# define BFI_FLINEAR3_2100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2099, v ds
+# define BFI_FLINEAR3_2100_TICK(t)
+# define BFI_FLINEAR3_2099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2098, v ds
+# define BFI_FLINEAR3_2099_TICK(t)
+# define BFI_FLINEAR3_2098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2097, v ds
+# define BFI_FLINEAR3_2098_TICK(t)
+# define BFI_FLINEAR3_2097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2096, v ds
+# define BFI_FLINEAR3_2097_TICK(t)
+# define BFI_FLINEAR3_2096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2095, v ds
+# define BFI_FLINEAR3_2096_TICK(t)
+# define BFI_FLINEAR3_2095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2094, v ds
+# define BFI_FLINEAR3_2095_TICK(t)
+# define BFI_FLINEAR3_2094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2093, v ds
+# define BFI_FLINEAR3_2094_TICK(t)
+# define BFI_FLINEAR3_2093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2092, v ds
+# define BFI_FLINEAR3_2093_TICK(t)
+# define BFI_FLINEAR3_2092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2091, v ds
+# define BFI_FLINEAR3_2092_TICK(t)
+# define BFI_FLINEAR3_2091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2090, v ds
+# define BFI_FLINEAR3_2091_TICK(t)
+# define BFI_FLINEAR3_2090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2089, v ds
+# define BFI_FLINEAR3_2090_TICK(t)
+# define BFI_FLINEAR3_2089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2088, v ds
+# define BFI_FLINEAR3_2089_TICK(t)
+# define BFI_FLINEAR3_2088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2087, v ds
+# define BFI_FLINEAR3_2088_TICK(t)
+# define BFI_FLINEAR3_2087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2086, v ds
+# define BFI_FLINEAR3_2087_TICK(t)
+# define BFI_FLINEAR3_2086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2085, v ds
+# define BFI_FLINEAR3_2086_TICK(t)
+# define BFI_FLINEAR3_2085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2084, v ds
+# define BFI_FLINEAR3_2085_TICK(t)
+# define BFI_FLINEAR3_2084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2083, v ds
+# define BFI_FLINEAR3_2084_TICK(t)
+# define BFI_FLINEAR3_2083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2082, v ds
+# define BFI_FLINEAR3_2083_TICK(t)
+# define BFI_FLINEAR3_2082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2081, v ds
+# define BFI_FLINEAR3_2082_TICK(t)
+# define BFI_FLINEAR3_2081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2080, v ds
+# define BFI_FLINEAR3_2081_TICK(t)
+# define BFI_FLINEAR3_2080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2079, v ds
+# define BFI_FLINEAR3_2080_TICK(t)
+# define BFI_FLINEAR3_2079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2078, v ds
+# define BFI_FLINEAR3_2079_TICK(t)
+# define BFI_FLINEAR3_2078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2077, v ds
+# define BFI_FLINEAR3_2078_TICK(t)
+# define BFI_FLINEAR3_2077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2076, v ds
+# define BFI_FLINEAR3_2077_TICK(t)
+# define BFI_FLINEAR3_2076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2075, v ds
+# define BFI_FLINEAR3_2076_TICK(t)
+# define BFI_FLINEAR3_2075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2074, v ds
+# define BFI_FLINEAR3_2075_TICK(t)
+# define BFI_FLINEAR3_2074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2073, v ds
+# define BFI_FLINEAR3_2074_TICK(t)
+# define BFI_FLINEAR3_2073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2072, v ds
+# define BFI_FLINEAR3_2073_TICK(t)
+# define BFI_FLINEAR3_2072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2071, v ds
+# define BFI_FLINEAR3_2072_TICK(t)
+# define BFI_FLINEAR3_2071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2070, v ds
+# define BFI_FLINEAR3_2071_TICK(t)
+# define BFI_FLINEAR3_2070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2069, v ds
+# define BFI_FLINEAR3_2070_TICK(t)
+# define BFI_FLINEAR3_2069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2068, v ds
+# define BFI_FLINEAR3_2069_TICK(t)
+# define BFI_FLINEAR3_2068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2067, v ds
+# define BFI_FLINEAR3_2068_TICK(t)
+# define BFI_FLINEAR3_2067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2066, v ds
+# define BFI_FLINEAR3_2067_TICK(t)
+# define BFI_FLINEAR3_2066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2065, v ds
+# define BFI_FLINEAR3_2066_TICK(t)
+# define BFI_FLINEAR3_2065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2064, v ds
+# define BFI_FLINEAR3_2065_TICK(t)
+# define BFI_FLINEAR3_2064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2063, v ds
+# define BFI_FLINEAR3_2064_TICK(t)
+# define BFI_FLINEAR3_2063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2062, v ds
+# define BFI_FLINEAR3_2063_TICK(t)
+# define BFI_FLINEAR3_2062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2061, v ds
+# define BFI_FLINEAR3_2062_TICK(t)
+# define BFI_FLINEAR3_2061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2060, v ds
+# define BFI_FLINEAR3_2061_TICK(t)
+# define BFI_FLINEAR3_2060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2059, v ds
+# define BFI_FLINEAR3_2060_TICK(t)
+# define BFI_FLINEAR3_2059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2058, v ds
+# define BFI_FLINEAR3_2059_TICK(t)
+# define BFI_FLINEAR3_2058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2057, v ds
+# define BFI_FLINEAR3_2058_TICK(t)
+# define BFI_FLINEAR3_2057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2056, v ds
+# define BFI_FLINEAR3_2057_TICK(t)
+# define BFI_FLINEAR3_2056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2055, v ds
+# define BFI_FLINEAR3_2056_TICK(t)
+# define BFI_FLINEAR3_2055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2054, v ds
+# define BFI_FLINEAR3_2055_TICK(t)
+# define BFI_FLINEAR3_2054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2053, v ds
+# define BFI_FLINEAR3_2054_TICK(t)
+# define BFI_FLINEAR3_2053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2052, v ds
+# define BFI_FLINEAR3_2053_TICK(t)
+# define BFI_FLINEAR3_2052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2051, v ds
+# define BFI_FLINEAR3_2052_TICK(t)
+# define BFI_FLINEAR3_2051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2050, v ds
+# define BFI_FLINEAR3_2051_TICK(t)
+# define BFI_FLINEAR3_2050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2049, v ds
+# define BFI_FLINEAR3_2050_TICK(t)
+# define BFI_FLINEAR3_2049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2048, v ds
+# define BFI_FLINEAR3_2049_TICK(t)
+# define BFI_FLINEAR3_2048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2047, v ds
+# define BFI_FLINEAR3_2048_TICK(t)
+# define BFI_FLINEAR3_2047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2046, v ds
+# define BFI_FLINEAR3_2047_TICK(t)
+# define BFI_FLINEAR3_2046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2045, v ds
+# define BFI_FLINEAR3_2046_TICK(t)
+# define BFI_FLINEAR3_2045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2044, v ds
+# define BFI_FLINEAR3_2045_TICK(t)
+# define BFI_FLINEAR3_2044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2043, v ds
+# define BFI_FLINEAR3_2044_TICK(t)
+# define BFI_FLINEAR3_2043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2042, v ds
+# define BFI_FLINEAR3_2043_TICK(t)
+# define BFI_FLINEAR3_2042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2041, v ds
+# define BFI_FLINEAR3_2042_TICK(t)
+# define BFI_FLINEAR3_2041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2040, v ds
+# define BFI_FLINEAR3_2041_TICK(t)
+# define BFI_FLINEAR3_2040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2039, v ds
+# define BFI_FLINEAR3_2040_TICK(t)
+# define BFI_FLINEAR3_2039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2038, v ds
+# define BFI_FLINEAR3_2039_TICK(t)
+# define BFI_FLINEAR3_2038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2037, v ds
+# define BFI_FLINEAR3_2038_TICK(t)
+# define BFI_FLINEAR3_2037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2036, v ds
+# define BFI_FLINEAR3_2037_TICK(t)
+# define BFI_FLINEAR3_2036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2035, v ds
+# define BFI_FLINEAR3_2036_TICK(t)
+# define BFI_FLINEAR3_2035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2034, v ds
+# define BFI_FLINEAR3_2035_TICK(t)
+# define BFI_FLINEAR3_2034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2033, v ds
+# define BFI_FLINEAR3_2034_TICK(t)
+# define BFI_FLINEAR3_2033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2032, v ds
+# define BFI_FLINEAR3_2033_TICK(t)
+# define BFI_FLINEAR3_2032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2031, v ds
+# define BFI_FLINEAR3_2032_TICK(t)
+# define BFI_FLINEAR3_2031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2030, v ds
+# define BFI_FLINEAR3_2031_TICK(t)
+# define BFI_FLINEAR3_2030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2029, v ds
+# define BFI_FLINEAR3_2030_TICK(t)
+# define BFI_FLINEAR3_2029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2028, v ds
+# define BFI_FLINEAR3_2029_TICK(t)
+# define BFI_FLINEAR3_2028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2027, v ds
+# define BFI_FLINEAR3_2028_TICK(t)
+# define BFI_FLINEAR3_2027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2026, v ds
+# define BFI_FLINEAR3_2027_TICK(t)
+# define BFI_FLINEAR3_2026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2025, v ds
+# define BFI_FLINEAR3_2026_TICK(t)
+# define BFI_FLINEAR3_2025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2024, v ds
+# define BFI_FLINEAR3_2025_TICK(t)
+# define BFI_FLINEAR3_2024(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2023, v ds
+# define BFI_FLINEAR3_2024_TICK(t)
+# define BFI_FLINEAR3_2023(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2022, v ds
+# define BFI_FLINEAR3_2023_TICK(t)
+# define BFI_FLINEAR3_2022(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2021, v ds
+# define BFI_FLINEAR3_2022_TICK(t)
+# define BFI_FLINEAR3_2021(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2020, v ds
+# define BFI_FLINEAR3_2021_TICK(t)
+# define BFI_FLINEAR3_2020(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2019, v ds
+# define BFI_FLINEAR3_2020_TICK(t)
+# define BFI_FLINEAR3_2019(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2018, v ds
+# define BFI_FLINEAR3_2019_TICK(t)
+# define BFI_FLINEAR3_2018(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2017, v ds
+# define BFI_FLINEAR3_2018_TICK(t)
+# define BFI_FLINEAR3_2017(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2016, v ds
+# define BFI_FLINEAR3_2017_TICK(t)
+# define BFI_FLINEAR3_2016(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2015, v ds
+# define BFI_FLINEAR3_2016_TICK(t)
+# define BFI_FLINEAR3_2015(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2014, v ds
+# define BFI_FLINEAR3_2015_TICK(t)
+# define BFI_FLINEAR3_2014(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2013, v ds
+# define BFI_FLINEAR3_2014_TICK(t)
+# define BFI_FLINEAR3_2013(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2012, v ds
+# define BFI_FLINEAR3_2013_TICK(t)
+# define BFI_FLINEAR3_2012(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2011, v ds
+# define BFI_FLINEAR3_2012_TICK(t)
+# define BFI_FLINEAR3_2011(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2010, v ds
+# define BFI_FLINEAR3_2011_TICK(t)
+# define BFI_FLINEAR3_2010(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2009, v ds
+# define BFI_FLINEAR3_2010_TICK(t)
+# define BFI_FLINEAR3_2009(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2008, v ds
+# define BFI_FLINEAR3_2009_TICK(t)
+# define BFI_FLINEAR3_2008(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2007, v ds
+# define BFI_FLINEAR3_2008_TICK(t)
+# define BFI_FLINEAR3_2007(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2006, v ds
+# define BFI_FLINEAR3_2007_TICK(t)
+# define BFI_FLINEAR3_2006(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2005, v ds
+# define BFI_FLINEAR3_2006_TICK(t)
+# define BFI_FLINEAR3_2005(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2004, v ds
+# define BFI_FLINEAR3_2005_TICK(t)
+# define BFI_FLINEAR3_2004(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2003, v ds
+# define BFI_FLINEAR3_2004_TICK(t)
+# define BFI_FLINEAR3_2003(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2002, v ds
+# define BFI_FLINEAR3_2003_TICK(t)
+# define BFI_FLINEAR3_2002(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2001, v ds
+# define BFI_FLINEAR3_2002_TICK(t)
+# define BFI_FLINEAR3_2001(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2000, v ds
+# define BFI_FLINEAR3_2001_TICK(t)
+# define BFI_FLINEAR3_2000(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1999, v ds
+# define BFI_FLINEAR3_2000_TICK(t)
+# define BFI_FLINEAR3_1999(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1998, v ds
+# define BFI_FLINEAR3_1999_TICK(t)
+# define BFI_FLINEAR3_1998(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1997, v ds
+# define BFI_FLINEAR3_1998_TICK(t)
+# define BFI_FLINEAR3_1997(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1996, v ds
+# define BFI_FLINEAR3_1997_TICK(t)
+# define BFI_FLINEAR3_1996(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1995, v ds
+# define BFI_FLINEAR3_1996_TICK(t)
+# define BFI_FLINEAR3_1995(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1994, v ds
+# define BFI_FLINEAR3_1995_TICK(t)
+# define BFI_FLINEAR3_1994(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1993, v ds
+# define BFI_FLINEAR3_1994_TICK(t)
+# define BFI_FLINEAR3_1993(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1992, v ds
+# define BFI_FLINEAR3_1993_TICK(t)
+# define BFI_FLINEAR3_1992(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1991, v ds
+# define BFI_FLINEAR3_1992_TICK(t)
+# define BFI_FLINEAR3_1991(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1990, v ds
+# define BFI_FLINEAR3_1991_TICK(t)
+# define BFI_FLINEAR3_1990(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1989, v ds
+# define BFI_FLINEAR3_1990_TICK(t)
+# define BFI_FLINEAR3_1989(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1988, v ds
+# define BFI_FLINEAR3_1989_TICK(t)
+# define BFI_FLINEAR3_1988(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1987, v ds
+# define BFI_FLINEAR3_1988_TICK(t)
+# define BFI_FLINEAR3_1987(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1986, v ds
+# define BFI_FLINEAR3_1987_TICK(t)
+# define BFI_FLINEAR3_1986(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1985, v ds
+# define BFI_FLINEAR3_1986_TICK(t)
+# define BFI_FLINEAR3_1985(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1984, v ds
+# define BFI_FLINEAR3_1985_TICK(t)
+# define BFI_FLINEAR3_1984(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1983, v ds
+# define BFI_FLINEAR3_1984_TICK(t)
+# define BFI_FLINEAR3_1983(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1982, v ds
+# define BFI_FLINEAR3_1983_TICK(t)
+# define BFI_FLINEAR3_1982(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1981, v ds
+# define BFI_FLINEAR3_1982_TICK(t)
+# define BFI_FLINEAR3_1981(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1980, v ds
+# define BFI_FLINEAR3_1981_TICK(t)
+# define BFI_FLINEAR3_1980(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1979, v ds
+# define BFI_FLINEAR3_1980_TICK(t)
+# define BFI_FLINEAR3_1979(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1978, v ds
+# define BFI_FLINEAR3_1979_TICK(t)
+# define BFI_FLINEAR3_1978(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1977, v ds
+# define BFI_FLINEAR3_1978_TICK(t)
+# define BFI_FLINEAR3_1977(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1976, v ds
+# define BFI_FLINEAR3_1977_TICK(t)
+# define BFI_FLINEAR3_1976(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1975, v ds
+# define BFI_FLINEAR3_1976_TICK(t)
+# define BFI_FLINEAR3_1975(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1974, v ds
+# define BFI_FLINEAR3_1975_TICK(t)
+# define BFI_FLINEAR3_1974(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1973, v ds
+# define BFI_FLINEAR3_1974_TICK(t)
+# define BFI_FLINEAR3_1973(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1972, v ds
+# define BFI_FLINEAR3_1973_TICK(t)
+# define BFI_FLINEAR3_1972(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1971, v ds
+# define BFI_FLINEAR3_1972_TICK(t)
+# define BFI_FLINEAR3_1971(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1970, v ds
+# define BFI_FLINEAR3_1971_TICK(t)
+# define BFI_FLINEAR3_1970(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1969, v ds
+# define BFI_FLINEAR3_1970_TICK(t)
+# define BFI_FLINEAR3_1969(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1968, v ds
+# define BFI_FLINEAR3_1969_TICK(t)
+# define BFI_FLINEAR3_1968(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1967, v ds
+# define BFI_FLINEAR3_1968_TICK(t)
+# define BFI_FLINEAR3_1967(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1966, v ds
+# define BFI_FLINEAR3_1967_TICK(t)
+# define BFI_FLINEAR3_1966(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1965, v ds
+# define BFI_FLINEAR3_1966_TICK(t)
+# define BFI_FLINEAR3_1965(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1964, v ds
+# define BFI_FLINEAR3_1965_TICK(t)
+# define BFI_FLINEAR3_1964(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1963, v ds
+# define BFI_FLINEAR3_1964_TICK(t)
+# define BFI_FLINEAR3_1963(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1962, v ds
+# define BFI_FLINEAR3_1963_TICK(t)
+# define BFI_FLINEAR3_1962(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1961, v ds
+# define BFI_FLINEAR3_1962_TICK(t)
+# define BFI_FLINEAR3_1961(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1960, v ds
+# define BFI_FLINEAR3_1961_TICK(t)
+# define BFI_FLINEAR3_1960(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1959, v ds
+# define BFI_FLINEAR3_1960_TICK(t)
+# define BFI_FLINEAR3_1959(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1958, v ds
+# define BFI_FLINEAR3_1959_TICK(t)
+# define BFI_FLINEAR3_1958(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1957, v ds
+# define BFI_FLINEAR3_1958_TICK(t)
+# define BFI_FLINEAR3_1957(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1956, v ds
+# define BFI_FLINEAR3_1957_TICK(t)
+# define BFI_FLINEAR3_1956(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1955, v ds
+# define BFI_FLINEAR3_1956_TICK(t)
+# define BFI_FLINEAR3_1955(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1954, v ds
+# define BFI_FLINEAR3_1955_TICK(t)
+# define BFI_FLINEAR3_1954(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1953, v ds
+# define BFI_FLINEAR3_1954_TICK(t)
+# define BFI_FLINEAR3_1953(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1952, v ds
+# define BFI_FLINEAR3_1953_TICK(t)
+# define BFI_FLINEAR3_1952(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1951, v ds
+# define BFI_FLINEAR3_1952_TICK(t)
+# define BFI_FLINEAR3_1951(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1950, v ds
+# define BFI_FLINEAR3_1951_TICK(t)
+# define BFI_FLINEAR3_1950(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1949, v ds
+# define BFI_FLINEAR3_1950_TICK(t)
+# define BFI_FLINEAR3_1949(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1948, v ds
+# define BFI_FLINEAR3_1949_TICK(t)
+# define BFI_FLINEAR3_1948(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1947, v ds
+# define BFI_FLINEAR3_1948_TICK(t)
+# define BFI_FLINEAR3_1947(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1946, v ds
+# define BFI_FLINEAR3_1947_TICK(t)
+# define BFI_FLINEAR3_1946(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1945, v ds
+# define BFI_FLINEAR3_1946_TICK(t)
+# define BFI_FLINEAR3_1945(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1944, v ds
+# define BFI_FLINEAR3_1945_TICK(t)
+# define BFI_FLINEAR3_1944(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1943, v ds
+# define BFI_FLINEAR3_1944_TICK(t)
+# define BFI_FLINEAR3_1943(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1942, v ds
+# define BFI_FLINEAR3_1943_TICK(t)
+# define BFI_FLINEAR3_1942(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1941, v ds
+# define BFI_FLINEAR3_1942_TICK(t)
+# define BFI_FLINEAR3_1941(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1940, v ds
+# define BFI_FLINEAR3_1941_TICK(t)
+# define BFI_FLINEAR3_1940(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1939, v ds
+# define BFI_FLINEAR3_1940_TICK(t)
+# define BFI_FLINEAR3_1939(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1938, v ds
+# define BFI_FLINEAR3_1939_TICK(t)
+# define BFI_FLINEAR3_1938(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1937, v ds
+# define BFI_FLINEAR3_1938_TICK(t)
+# define BFI_FLINEAR3_1937(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1936, v ds
+# define BFI_FLINEAR3_1937_TICK(t)
+# define BFI_FLINEAR3_1936(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1935, v ds
+# define BFI_FLINEAR3_1936_TICK(t)
+# define BFI_FLINEAR3_1935(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1934, v ds
+# define BFI_FLINEAR3_1935_TICK(t)
+# define BFI_FLINEAR3_1934(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1933, v ds
+# define BFI_FLINEAR3_1934_TICK(t)
+# define BFI_FLINEAR3_1933(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1932, v ds
+# define BFI_FLINEAR3_1933_TICK(t)
+# define BFI_FLINEAR3_1932(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1931, v ds
+# define BFI_FLINEAR3_1932_TICK(t)
+# define BFI_FLINEAR3_1931(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1930, v ds
+# define BFI_FLINEAR3_1931_TICK(t)
+# define BFI_FLINEAR3_1930(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1929, v ds
+# define BFI_FLINEAR3_1930_TICK(t)
+# define BFI_FLINEAR3_1929(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1928, v ds
+# define BFI_FLINEAR3_1929_TICK(t)
+# define BFI_FLINEAR3_1928(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1927, v ds
+# define BFI_FLINEAR3_1928_TICK(t)
+# define BFI_FLINEAR3_1927(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1926, v ds
+# define BFI_FLINEAR3_1927_TICK(t)
+# define BFI_FLINEAR3_1926(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1925, v ds
+# define BFI_FLINEAR3_1926_TICK(t)
+# define BFI_FLINEAR3_1925(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1924, v ds
+# define BFI_FLINEAR3_1925_TICK(t)
+# define BFI_FLINEAR3_1924(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1923, v ds
+# define BFI_FLINEAR3_1924_TICK(t)
+# define BFI_FLINEAR3_1923(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1922, v ds
+# define BFI_FLINEAR3_1923_TICK(t)
+# define BFI_FLINEAR3_1922(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1921, v ds
+# define BFI_FLINEAR3_1922_TICK(t)
+# define BFI_FLINEAR3_1921(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1920, v ds
+# define BFI_FLINEAR3_1921_TICK(t)
+# define BFI_FLINEAR3_1920(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1919, v ds
+# define BFI_FLINEAR3_1920_TICK(t)
+# define BFI_FLINEAR3_1919(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1918, v ds
+# define BFI_FLINEAR3_1919_TICK(t)
+# define BFI_FLINEAR3_1918(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1917, v ds
+# define BFI_FLINEAR3_1918_TICK(t)
+# define BFI_FLINEAR3_1917(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1916, v ds
+# define BFI_FLINEAR3_1917_TICK(t)
+# define BFI_FLINEAR3_1916(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1915, v ds
+# define BFI_FLINEAR3_1916_TICK(t)
+# define BFI_FLINEAR3_1915(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1914, v ds
+# define BFI_FLINEAR3_1915_TICK(t)
+# define BFI_FLINEAR3_1914(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1913, v ds
+# define BFI_FLINEAR3_1914_TICK(t)
+# define BFI_FLINEAR3_1913(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1912, v ds
+# define BFI_FLINEAR3_1913_TICK(t)
+# define BFI_FLINEAR3_1912(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1911, v ds
+# define BFI_FLINEAR3_1912_TICK(t)
+# define BFI_FLINEAR3_1911(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1910, v ds
+# define BFI_FLINEAR3_1911_TICK(t)
+# define BFI_FLINEAR3_1910(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1909, v ds
+# define BFI_FLINEAR3_1910_TICK(t)
+# define BFI_FLINEAR3_1909(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1908, v ds
+# define BFI_FLINEAR3_1909_TICK(t)
+# define BFI_FLINEAR3_1908(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1907, v ds
+# define BFI_FLINEAR3_1908_TICK(t)
+# define BFI_FLINEAR3_1907(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1906, v ds
+# define BFI_FLINEAR3_1907_TICK(t)
+# define BFI_FLINEAR3_1906(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1905, v ds
+# define BFI_FLINEAR3_1906_TICK(t)
+# define BFI_FLINEAR3_1905(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1904, v ds
+# define BFI_FLINEAR3_1905_TICK(t)
+# define BFI_FLINEAR3_1904(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1903, v ds
+# define BFI_FLINEAR3_1904_TICK(t)
+# define BFI_FLINEAR3_1903(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1902, v ds
+# define BFI_FLINEAR3_1903_TICK(t)
+# define BFI_FLINEAR3_1902(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1901, v ds
+# define BFI_FLINEAR3_1902_TICK(t)
+# define BFI_FLINEAR3_1901(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1900, v ds
+# define BFI_FLINEAR3_1901_TICK(t)
+# define BFI_FLINEAR3_1900(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1899, v ds
+# define BFI_FLINEAR3_1900_TICK(t)
+# define BFI_FLINEAR3_1899(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1898, v ds
+# define BFI_FLINEAR3_1899_TICK(t)
+# define BFI_FLINEAR3_1898(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1897, v ds
+# define BFI_FLINEAR3_1898_TICK(t)
+# define BFI_FLINEAR3_1897(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1896, v ds
+# define BFI_FLINEAR3_1897_TICK(t)
+# define BFI_FLINEAR3_1896(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1895, v ds
+# define BFI_FLINEAR3_1896_TICK(t)
+# define BFI_FLINEAR3_1895(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1894, v ds
+# define BFI_FLINEAR3_1895_TICK(t)
+# define BFI_FLINEAR3_1894(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1893, v ds
+# define BFI_FLINEAR3_1894_TICK(t)
+# define BFI_FLINEAR3_1893(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1892, v ds
+# define BFI_FLINEAR3_1893_TICK(t)
+# define BFI_FLINEAR3_1892(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1891, v ds
+# define BFI_FLINEAR3_1892_TICK(t)
+# define BFI_FLINEAR3_1891(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1890, v ds
+# define BFI_FLINEAR3_1891_TICK(t)
+# define BFI_FLINEAR3_1890(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1889, v ds
+# define BFI_FLINEAR3_1890_TICK(t)
+# define BFI_FLINEAR3_1889(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1888, v ds
+# define BFI_FLINEAR3_1889_TICK(t)
+# define BFI_FLINEAR3_1888(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1887, v ds
+# define BFI_FLINEAR3_1888_TICK(t)
+# define BFI_FLINEAR3_1887(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1886, v ds
+# define BFI_FLINEAR3_1887_TICK(t)
+# define BFI_FLINEAR3_1886(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1885, v ds
+# define BFI_FLINEAR3_1886_TICK(t)
+# define BFI_FLINEAR3_1885(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1884, v ds
+# define BFI_FLINEAR3_1885_TICK(t)
+# define BFI_FLINEAR3_1884(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1883, v ds
+# define BFI_FLINEAR3_1884_TICK(t)
+# define BFI_FLINEAR3_1883(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1882, v ds
+# define BFI_FLINEAR3_1883_TICK(t)
+# define BFI_FLINEAR3_1882(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1881, v ds
+# define BFI_FLINEAR3_1882_TICK(t)
+# define BFI_FLINEAR3_1881(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1880, v ds
+# define BFI_FLINEAR3_1881_TICK(t)
+# define BFI_FLINEAR3_1880(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1879, v ds
+# define BFI_FLINEAR3_1880_TICK(t)
+# define BFI_FLINEAR3_1879(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1878, v ds
+# define BFI_FLINEAR3_1879_TICK(t)
+# define BFI_FLINEAR3_1878(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1877, v ds
+# define BFI_FLINEAR3_1878_TICK(t)
+# define BFI_FLINEAR3_1877(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1876, v ds
+# define BFI_FLINEAR3_1877_TICK(t)
+# define BFI_FLINEAR3_1876(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1875, v ds
+# define BFI_FLINEAR3_1876_TICK(t)
+# define BFI_FLINEAR3_1875(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1874, v ds
+# define BFI_FLINEAR3_1875_TICK(t)
+# define BFI_FLINEAR3_1874(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1873, v ds
+# define BFI_FLINEAR3_1874_TICK(t)
+# define BFI_FLINEAR3_1873(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1872, v ds
+# define BFI_FLINEAR3_1873_TICK(t)
+# define BFI_FLINEAR3_1872(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1871, v ds
+# define BFI_FLINEAR3_1872_TICK(t)
+# define BFI_FLINEAR3_1871(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1870, v ds
+# define BFI_FLINEAR3_1871_TICK(t)
+# define BFI_FLINEAR3_1870(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1869, v ds
+# define BFI_FLINEAR3_1870_TICK(t)
+# define BFI_FLINEAR3_1869(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1868, v ds
+# define BFI_FLINEAR3_1869_TICK(t)
+# define BFI_FLINEAR3_1868(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1867, v ds
+# define BFI_FLINEAR3_1868_TICK(t)
+# define BFI_FLINEAR3_1867(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1866, v ds
+# define BFI_FLINEAR3_1867_TICK(t)
+# define BFI_FLINEAR3_1866(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1865, v ds
+# define BFI_FLINEAR3_1866_TICK(t)
+# define BFI_FLINEAR3_1865(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1864, v ds
+# define BFI_FLINEAR3_1865_TICK(t)
+# define BFI_FLINEAR3_1864(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1863, v ds
+# define BFI_FLINEAR3_1864_TICK(t)
+# define BFI_FLINEAR3_1863(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1862, v ds
+# define BFI_FLINEAR3_1863_TICK(t)
+# define BFI_FLINEAR3_1862(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1861, v ds
+# define BFI_FLINEAR3_1862_TICK(t)
+# define BFI_FLINEAR3_1861(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1860, v ds
+# define BFI_FLINEAR3_1861_TICK(t)
+# define BFI_FLINEAR3_1860(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1859, v ds
+# define BFI_FLINEAR3_1860_TICK(t)
+# define BFI_FLINEAR3_1859(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1858, v ds
+# define BFI_FLINEAR3_1859_TICK(t)
+# define BFI_FLINEAR3_1858(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1857, v ds
+# define BFI_FLINEAR3_1858_TICK(t)
+# define BFI_FLINEAR3_1857(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1856, v ds
+# define BFI_FLINEAR3_1857_TICK(t)
+# define BFI_FLINEAR3_1856(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1855, v ds
+# define BFI_FLINEAR3_1856_TICK(t)
+# define BFI_FLINEAR3_1855(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1854, v ds
+# define BFI_FLINEAR3_1855_TICK(t)
+# define BFI_FLINEAR3_1854(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1853, v ds
+# define BFI_FLINEAR3_1854_TICK(t)
+# define BFI_FLINEAR3_1853(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1852, v ds
+# define BFI_FLINEAR3_1853_TICK(t)
+# define BFI_FLINEAR3_1852(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1851, v ds
+# define BFI_FLINEAR3_1852_TICK(t)
+# define BFI_FLINEAR3_1851(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1850, v ds
+# define BFI_FLINEAR3_1851_TICK(t)
+# define BFI_FLINEAR3_1850(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1849, v ds
+# define BFI_FLINEAR3_1850_TICK(t)
+# define BFI_FLINEAR3_1849(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1848, v ds
+# define BFI_FLINEAR3_1849_TICK(t)
+# define BFI_FLINEAR3_1848(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1847, v ds
+# define BFI_FLINEAR3_1848_TICK(t)
+# define BFI_FLINEAR3_1847(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1846, v ds
+# define BFI_FLINEAR3_1847_TICK(t)
+# define BFI_FLINEAR3_1846(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1845, v ds
+# define BFI_FLINEAR3_1846_TICK(t)
+# define BFI_FLINEAR3_1845(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1844, v ds
+# define BFI_FLINEAR3_1845_TICK(t)
+# define BFI_FLINEAR3_1844(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1843, v ds
+# define BFI_FLINEAR3_1844_TICK(t)
+# define BFI_FLINEAR3_1843(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1842, v ds
+# define BFI_FLINEAR3_1843_TICK(t)
+# define BFI_FLINEAR3_1842(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1841, v ds
+# define BFI_FLINEAR3_1842_TICK(t)
+# define BFI_FLINEAR3_1841(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1840, v ds
+# define BFI_FLINEAR3_1841_TICK(t)
+# define BFI_FLINEAR3_1840(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1839, v ds
+# define BFI_FLINEAR3_1840_TICK(t)
+# define BFI_FLINEAR3_1839(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1838, v ds
+# define BFI_FLINEAR3_1839_TICK(t)
+# define BFI_FLINEAR3_1838(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1837, v ds
+# define BFI_FLINEAR3_1838_TICK(t)
+# define BFI_FLINEAR3_1837(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1836, v ds
+# define BFI_FLINEAR3_1837_TICK(t)
+# define BFI_FLINEAR3_1836(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1835, v ds
+# define BFI_FLINEAR3_1836_TICK(t)
+# define BFI_FLINEAR3_1835(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1834, v ds
+# define BFI_FLINEAR3_1835_TICK(t)
+# define BFI_FLINEAR3_1834(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1833, v ds
+# define BFI_FLINEAR3_1834_TICK(t)
+# define BFI_FLINEAR3_1833(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1832, v ds
+# define BFI_FLINEAR3_1833_TICK(t)
+# define BFI_FLINEAR3_1832(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1831, v ds
+# define BFI_FLINEAR3_1832_TICK(t)
+# define BFI_FLINEAR3_1831(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1830, v ds
+# define BFI_FLINEAR3_1831_TICK(t)
+# define BFI_FLINEAR3_1830(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1829, v ds
+# define BFI_FLINEAR3_1830_TICK(t)
+# define BFI_FLINEAR3_1829(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1828, v ds
+# define BFI_FLINEAR3_1829_TICK(t)
+# define BFI_FLINEAR3_1828(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1827, v ds
+# define BFI_FLINEAR3_1828_TICK(t)
+# define BFI_FLINEAR3_1827(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1826, v ds
+# define BFI_FLINEAR3_1827_TICK(t)
+# define BFI_FLINEAR3_1826(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1825, v ds
+# define BFI_FLINEAR3_1826_TICK(t)
+# define BFI_FLINEAR3_1825(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1824, v ds
+# define BFI_FLINEAR3_1825_TICK(t)
+# define BFI_FLINEAR3_1824(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1823, v ds
+# define BFI_FLINEAR3_1824_TICK(t)
+# define BFI_FLINEAR3_1823(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1822, v ds
+# define BFI_FLINEAR3_1823_TICK(t)
+# define BFI_FLINEAR3_1822(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1821, v ds
+# define BFI_FLINEAR3_1822_TICK(t)
+# define BFI_FLINEAR3_1821(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1820, v ds
+# define BFI_FLINEAR3_1821_TICK(t)
+# define BFI_FLINEAR3_1820(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1819, v ds
+# define BFI_FLINEAR3_1820_TICK(t)
+# define BFI_FLINEAR3_1819(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1818, v ds
+# define BFI_FLINEAR3_1819_TICK(t)
+# define BFI_FLINEAR3_1818(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1817, v ds
+# define BFI_FLINEAR3_1818_TICK(t)
+# define BFI_FLINEAR3_1817(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1816, v ds
+# define BFI_FLINEAR3_1817_TICK(t)
+# define BFI_FLINEAR3_1816(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1815, v ds
+# define BFI_FLINEAR3_1816_TICK(t)
+# define BFI_FLINEAR3_1815(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1814, v ds
+# define BFI_FLINEAR3_1815_TICK(t)
+# define BFI_FLINEAR3_1814(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1813, v ds
+# define BFI_FLINEAR3_1814_TICK(t)
+# define BFI_FLINEAR3_1813(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1812, v ds
+# define BFI_FLINEAR3_1813_TICK(t)
+# define BFI_FLINEAR3_1812(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1811, v ds
+# define BFI_FLINEAR3_1812_TICK(t)
+# define BFI_FLINEAR3_1811(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1810, v ds
+# define BFI_FLINEAR3_1811_TICK(t)
+# define BFI_FLINEAR3_1810(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1809, v ds
+# define BFI_FLINEAR3_1810_TICK(t)
+# define BFI_FLINEAR3_1809(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1808, v ds
+# define BFI_FLINEAR3_1809_TICK(t)
+# define BFI_FLINEAR3_1808(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1807, v ds
+# define BFI_FLINEAR3_1808_TICK(t)
+# define BFI_FLINEAR3_1807(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1806, v ds
+# define BFI_FLINEAR3_1807_TICK(t)
+# define BFI_FLINEAR3_1806(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1805, v ds
+# define BFI_FLINEAR3_1806_TICK(t)
+# define BFI_FLINEAR3_1805(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1804, v ds
+# define BFI_FLINEAR3_1805_TICK(t)
+# define BFI_FLINEAR3_1804(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1803, v ds
+# define BFI_FLINEAR3_1804_TICK(t)
+# define BFI_FLINEAR3_1803(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1802, v ds
+# define BFI_FLINEAR3_1803_TICK(t)
+# define BFI_FLINEAR3_1802(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1801, v ds
+# define BFI_FLINEAR3_1802_TICK(t)
+# define BFI_FLINEAR3_1801(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1800, v ds
+# define BFI_FLINEAR3_1801_TICK(t)
+# define BFI_FLINEAR3_1800(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1799, v ds
+# define BFI_FLINEAR3_1800_TICK(t)
+# define BFI_FLINEAR3_1799(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1798, v ds
+# define BFI_FLINEAR3_1799_TICK(t)
+# define BFI_FLINEAR3_1798(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1797, v ds
+# define BFI_FLINEAR3_1798_TICK(t)
+# define BFI_FLINEAR3_1797(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1796, v ds
+# define BFI_FLINEAR3_1797_TICK(t)
+# define BFI_FLINEAR3_1796(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1795, v ds
+# define BFI_FLINEAR3_1796_TICK(t)
+# define BFI_FLINEAR3_1795(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1794, v ds
+# define BFI_FLINEAR3_1795_TICK(t)
+# define BFI_FLINEAR3_1794(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1793, v ds
+# define BFI_FLINEAR3_1794_TICK(t)
+# define BFI_FLINEAR3_1793(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1792, v ds
+# define BFI_FLINEAR3_1793_TICK(t)
+# define BFI_FLINEAR3_1792(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1791, v ds
+# define BFI_FLINEAR3_1792_TICK(t)
+# define BFI_FLINEAR3_1791(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1790, v ds
+# define BFI_FLINEAR3_1791_TICK(t)
+# define BFI_FLINEAR3_1790(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1789, v ds
+# define BFI_FLINEAR3_1790_TICK(t)
+# define BFI_FLINEAR3_1789(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1788, v ds
+# define BFI_FLINEAR3_1789_TICK(t)
+# define BFI_FLINEAR3_1788(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1787, v ds
+# define BFI_FLINEAR3_1788_TICK(t)
+# define BFI_FLINEAR3_1787(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1786, v ds
+# define BFI_FLINEAR3_1787_TICK(t)
+# define BFI_FLINEAR3_1786(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1785, v ds
+# define BFI_FLINEAR3_1786_TICK(t)
+# define BFI_FLINEAR3_1785(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1784, v ds
+# define BFI_FLINEAR3_1785_TICK(t)
+# define BFI_FLINEAR3_1784(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1783, v ds
+# define BFI_FLINEAR3_1784_TICK(t)
+# define BFI_FLINEAR3_1783(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1782, v ds
+# define BFI_FLINEAR3_1783_TICK(t)
+# define BFI_FLINEAR3_1782(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1781, v ds
+# define BFI_FLINEAR3_1782_TICK(t)
+# define BFI_FLINEAR3_1781(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1780, v ds
+# define BFI_FLINEAR3_1781_TICK(t)
+# define BFI_FLINEAR3_1780(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1779, v ds
+# define BFI_FLINEAR3_1780_TICK(t)
+# define BFI_FLINEAR3_1779(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1778, v ds
+# define BFI_FLINEAR3_1779_TICK(t)
+# define BFI_FLINEAR3_1778(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1777, v ds
+# define BFI_FLINEAR3_1778_TICK(t)
+# define BFI_FLINEAR3_1777(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1776, v ds
+# define BFI_FLINEAR3_1777_TICK(t)
+# define BFI_FLINEAR3_1776(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1775, v ds
+# define BFI_FLINEAR3_1776_TICK(t)
+# define BFI_FLINEAR3_1775(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1774, v ds
+# define BFI_FLINEAR3_1775_TICK(t)
+# define BFI_FLINEAR3_1774(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1773, v ds
+# define BFI_FLINEAR3_1774_TICK(t)
+# define BFI_FLINEAR3_1773(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1772, v ds
+# define BFI_FLINEAR3_1773_TICK(t)
+# define BFI_FLINEAR3_1772(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1771, v ds
+# define BFI_FLINEAR3_1772_TICK(t)
+# define BFI_FLINEAR3_1771(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1770, v ds
+# define BFI_FLINEAR3_1771_TICK(t)
+# define BFI_FLINEAR3_1770(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1769, v ds
+# define BFI_FLINEAR3_1770_TICK(t)
+# define BFI_FLINEAR3_1769(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1768, v ds
+# define BFI_FLINEAR3_1769_TICK(t)
+# define BFI_FLINEAR3_1768(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1767, v ds
+# define BFI_FLINEAR3_1768_TICK(t)
+# define BFI_FLINEAR3_1767(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1766, v ds
+# define BFI_FLINEAR3_1767_TICK(t)
+# define BFI_FLINEAR3_1766(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1765, v ds
+# define BFI_FLINEAR3_1766_TICK(t)
+# define BFI_FLINEAR3_1765(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1764, v ds
+# define BFI_FLINEAR3_1765_TICK(t)
+# define BFI_FLINEAR3_1764(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1763, v ds
+# define BFI_FLINEAR3_1764_TICK(t)
+# define BFI_FLINEAR3_1763(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1762, v ds
+# define BFI_FLINEAR3_1763_TICK(t)
+# define BFI_FLINEAR3_1762(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1761, v ds
+# define BFI_FLINEAR3_1762_TICK(t)
+# define BFI_FLINEAR3_1761(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1760, v ds
+# define BFI_FLINEAR3_1761_TICK(t)
+# define BFI_FLINEAR3_1760(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1759, v ds
+# define BFI_FLINEAR3_1760_TICK(t)
+# define BFI_FLINEAR3_1759(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1758, v ds
+# define BFI_FLINEAR3_1759_TICK(t)
+# define BFI_FLINEAR3_1758(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1757, v ds
+# define BFI_FLINEAR3_1758_TICK(t)
+# define BFI_FLINEAR3_1757(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1756, v ds
+# define BFI_FLINEAR3_1757_TICK(t)
+# define BFI_FLINEAR3_1756(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1755, v ds
+# define BFI_FLINEAR3_1756_TICK(t)
+# define BFI_FLINEAR3_1755(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1754, v ds
+# define BFI_FLINEAR3_1755_TICK(t)
+# define BFI_FLINEAR3_1754(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1753, v ds
+# define BFI_FLINEAR3_1754_TICK(t)
+# define BFI_FLINEAR3_1753(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1752, v ds
+# define BFI_FLINEAR3_1753_TICK(t)
+# define BFI_FLINEAR3_1752(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1751, v ds
+# define BFI_FLINEAR3_1752_TICK(t)
+# define BFI_FLINEAR3_1751(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1750, v ds
+# define BFI_FLINEAR3_1751_TICK(t)
+# define BFI_FLINEAR3_1750(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1749, v ds
+# define BFI_FLINEAR3_1750_TICK(t)
+# define BFI_FLINEAR3_1749(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1748, v ds
+# define BFI_FLINEAR3_1749_TICK(t)
+# define BFI_FLINEAR3_1748(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1747, v ds
+# define BFI_FLINEAR3_1748_TICK(t)
+# define BFI_FLINEAR3_1747(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1746, v ds
+# define BFI_FLINEAR3_1747_TICK(t)
+# define BFI_FLINEAR3_1746(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1745, v ds
+# define BFI_FLINEAR3_1746_TICK(t)
+# define BFI_FLINEAR3_1745(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1744, v ds
+# define BFI_FLINEAR3_1745_TICK(t)
+# define BFI_FLINEAR3_1744(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1743, v ds
+# define BFI_FLINEAR3_1744_TICK(t)
+# define BFI_FLINEAR3_1743(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1742, v ds
+# define BFI_FLINEAR3_1743_TICK(t)
+# define BFI_FLINEAR3_1742(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1741, v ds
+# define BFI_FLINEAR3_1742_TICK(t)
+# define BFI_FLINEAR3_1741(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1740, v ds
+# define BFI_FLINEAR3_1741_TICK(t)
+# define BFI_FLINEAR3_1740(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1739, v ds
+# define BFI_FLINEAR3_1740_TICK(t)
+# define BFI_FLINEAR3_1739(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1738, v ds
+# define BFI_FLINEAR3_1739_TICK(t)
+# define BFI_FLINEAR3_1738(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1737, v ds
+# define BFI_FLINEAR3_1738_TICK(t)
+# define BFI_FLINEAR3_1737(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1736, v ds
+# define BFI_FLINEAR3_1737_TICK(t)
+# define BFI_FLINEAR3_1736(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1735, v ds
+# define BFI_FLINEAR3_1736_TICK(t)
+# define BFI_FLINEAR3_1735(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1734, v ds
+# define BFI_FLINEAR3_1735_TICK(t)
+# define BFI_FLINEAR3_1734(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1733, v ds
+# define BFI_FLINEAR3_1734_TICK(t)
+# define BFI_FLINEAR3_1733(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1732, v ds
+# define BFI_FLINEAR3_1733_TICK(t)
+# define BFI_FLINEAR3_1732(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1731, v ds
+# define BFI_FLINEAR3_1732_TICK(t)
+# define BFI_FLINEAR3_1731(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1730, v ds
+# define BFI_FLINEAR3_1731_TICK(t)
+# define BFI_FLINEAR3_1730(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1729, v ds
+# define BFI_FLINEAR3_1730_TICK(t)
+# define BFI_FLINEAR3_1729(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1728, v ds
+# define BFI_FLINEAR3_1729_TICK(t)
+# define BFI_FLINEAR3_1728(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1727, v ds
+# define BFI_FLINEAR3_1728_TICK(t)
+# define BFI_FLINEAR3_1727(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1726, v ds
+# define BFI_FLINEAR3_1727_TICK(t)
+# define BFI_FLINEAR3_1726(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1725, v ds
+# define BFI_FLINEAR3_1726_TICK(t)
+# define BFI_FLINEAR3_1725(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1724, v ds
+# define BFI_FLINEAR3_1725_TICK(t)
+# define BFI_FLINEAR3_1724(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1723, v ds
+# define BFI_FLINEAR3_1724_TICK(t)
+# define BFI_FLINEAR3_1723(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1722, v ds
+# define BFI_FLINEAR3_1723_TICK(t)
+# define BFI_FLINEAR3_1722(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1721, v ds
+# define BFI_FLINEAR3_1722_TICK(t)
+# define BFI_FLINEAR3_1721(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1720, v ds
+# define BFI_FLINEAR3_1721_TICK(t)
+# define BFI_FLINEAR3_1720(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1719, v ds
+# define BFI_FLINEAR3_1720_TICK(t)
+# define BFI_FLINEAR3_1719(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1718, v ds
+# define BFI_FLINEAR3_1719_TICK(t)
+# define BFI_FLINEAR3_1718(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1717, v ds
+# define BFI_FLINEAR3_1718_TICK(t)
+# define BFI_FLINEAR3_1717(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1716, v ds
+# define BFI_FLINEAR3_1717_TICK(t)
+# define BFI_FLINEAR3_1716(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1715, v ds
+# define BFI_FLINEAR3_1716_TICK(t)
+# define BFI_FLINEAR3_1715(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1714, v ds
+# define BFI_FLINEAR3_1715_TICK(t)
+# define BFI_FLINEAR3_1714(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1713, v ds
+# define BFI_FLINEAR3_1714_TICK(t)
+# define BFI_FLINEAR3_1713(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1712, v ds
+# define BFI_FLINEAR3_1713_TICK(t)
+# define BFI_FLINEAR3_1712(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1711, v ds
+# define BFI_FLINEAR3_1712_TICK(t)
+# define BFI_FLINEAR3_1711(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1710, v ds
+# define BFI_FLINEAR3_1711_TICK(t)
+# define BFI_FLINEAR3_1710(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1709, v ds
+# define BFI_FLINEAR3_1710_TICK(t)
+# define BFI_FLINEAR3_1709(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1708, v ds
+# define BFI_FLINEAR3_1709_TICK(t)
+# define BFI_FLINEAR3_1708(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1707, v ds
+# define BFI_FLINEAR3_1708_TICK(t)
+# define BFI_FLINEAR3_1707(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1706, v ds
+# define BFI_FLINEAR3_1707_TICK(t)
+# define BFI_FLINEAR3_1706(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1705, v ds
+# define BFI_FLINEAR3_1706_TICK(t)
+# define BFI_FLINEAR3_1705(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1704, v ds
+# define BFI_FLINEAR3_1705_TICK(t)
+# define BFI_FLINEAR3_1704(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1703, v ds
+# define BFI_FLINEAR3_1704_TICK(t)
+# define BFI_FLINEAR3_1703(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1702, v ds
+# define BFI_FLINEAR3_1703_TICK(t)
+# define BFI_FLINEAR3_1702(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1701, v ds
+# define BFI_FLINEAR3_1702_TICK(t)
+# define BFI_FLINEAR3_1701(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1700, v ds
+# define BFI_FLINEAR3_1701_TICK(t)
+# define BFI_FLINEAR3_1700(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1699, v ds
+# define BFI_FLINEAR3_1700_TICK(t)
+# define BFI_FLINEAR3_1699(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1698, v ds
+# define BFI_FLINEAR3_1699_TICK(t)
+# define BFI_FLINEAR3_1698(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1697, v ds
+# define BFI_FLINEAR3_1698_TICK(t)
+# define BFI_FLINEAR3_1697(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1696, v ds
+# define BFI_FLINEAR3_1697_TICK(t)
+# define BFI_FLINEAR3_1696(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1695, v ds
+# define BFI_FLINEAR3_1696_TICK(t)
+# define BFI_FLINEAR3_1695(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1694, v ds
+# define BFI_FLINEAR3_1695_TICK(t)
+# define BFI_FLINEAR3_1694(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1693, v ds
+# define BFI_FLINEAR3_1694_TICK(t)
+# define BFI_FLINEAR3_1693(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1692, v ds
+# define BFI_FLINEAR3_1693_TICK(t)
+# define BFI_FLINEAR3_1692(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1691, v ds
+# define BFI_FLINEAR3_1692_TICK(t)
+# define BFI_FLINEAR3_1691(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1690, v ds
+# define BFI_FLINEAR3_1691_TICK(t)
+# define BFI_FLINEAR3_1690(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1689, v ds
+# define BFI_FLINEAR3_1690_TICK(t)
+# define BFI_FLINEAR3_1689(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1688, v ds
+# define BFI_FLINEAR3_1689_TICK(t)
+# define BFI_FLINEAR3_1688(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1687, v ds
+# define BFI_FLINEAR3_1688_TICK(t)
+# define BFI_FLINEAR3_1687(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1686, v ds
+# define BFI_FLINEAR3_1687_TICK(t)
+# define BFI_FLINEAR3_1686(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1685, v ds
+# define BFI_FLINEAR3_1686_TICK(t)
+# define BFI_FLINEAR3_1685(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1684, v ds
+# define BFI_FLINEAR3_1685_TICK(t)
+# define BFI_FLINEAR3_1684(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1683, v ds
+# define BFI_FLINEAR3_1684_TICK(t)
+# define BFI_FLINEAR3_1683(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1682, v ds
+# define BFI_FLINEAR3_1683_TICK(t)
+# define BFI_FLINEAR3_1682(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1681, v ds
+# define BFI_FLINEAR3_1682_TICK(t)
+# define BFI_FLINEAR3_1681(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1680, v ds
+# define BFI_FLINEAR3_1681_TICK(t)
+# define BFI_FLINEAR3_1680(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1679, v ds
+# define BFI_FLINEAR3_1680_TICK(t)
+# define BFI_FLINEAR3_1679(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1678, v ds
+# define BFI_FLINEAR3_1679_TICK(t)
+# define BFI_FLINEAR3_1678(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1677, v ds
+# define BFI_FLINEAR3_1678_TICK(t)
+# define BFI_FLINEAR3_1677(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1676, v ds
+# define BFI_FLINEAR3_1677_TICK(t)
+# define BFI_FLINEAR3_1676(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1675, v ds
+# define BFI_FLINEAR3_1676_TICK(t)
+# define BFI_FLINEAR3_1675(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1674, v ds
+# define BFI_FLINEAR3_1675_TICK(t)
+# define BFI_FLINEAR3_1674(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1673, v ds
+# define BFI_FLINEAR3_1674_TICK(t)
+# define BFI_FLINEAR3_1673(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1672, v ds
+# define BFI_FLINEAR3_1673_TICK(t)
+# define BFI_FLINEAR3_1672(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1671, v ds
+# define BFI_FLINEAR3_1672_TICK(t)
+# define BFI_FLINEAR3_1671(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1670, v ds
+# define BFI_FLINEAR3_1671_TICK(t)
+# define BFI_FLINEAR3_1670(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1669, v ds
+# define BFI_FLINEAR3_1670_TICK(t)
+# define BFI_FLINEAR3_1669(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1668, v ds
+# define BFI_FLINEAR3_1669_TICK(t)
+# define BFI_FLINEAR3_1668(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1667, v ds
+# define BFI_FLINEAR3_1668_TICK(t)
+# define BFI_FLINEAR3_1667(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1666, v ds
+# define BFI_FLINEAR3_1667_TICK(t)
+# define BFI_FLINEAR3_1666(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1665, v ds
+# define BFI_FLINEAR3_1666_TICK(t)
+# define BFI_FLINEAR3_1665(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1664, v ds
+# define BFI_FLINEAR3_1665_TICK(t)
+# define BFI_FLINEAR3_1664(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1663, v ds
+# define BFI_FLINEAR3_1664_TICK(t)
+# define BFI_FLINEAR3_1663(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1662, v ds
+# define BFI_FLINEAR3_1663_TICK(t)
+# define BFI_FLINEAR3_1662(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1661, v ds
+# define BFI_FLINEAR3_1662_TICK(t)
+# define BFI_FLINEAR3_1661(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1660, v ds
+# define BFI_FLINEAR3_1661_TICK(t)
+# define BFI_FLINEAR3_1660(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1659, v ds
+# define BFI_FLINEAR3_1660_TICK(t)
+# define BFI_FLINEAR3_1659(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1658, v ds
+# define BFI_FLINEAR3_1659_TICK(t)
+# define BFI_FLINEAR3_1658(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1657, v ds
+# define BFI_FLINEAR3_1658_TICK(t)
+# define BFI_FLINEAR3_1657(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1656, v ds
+# define BFI_FLINEAR3_1657_TICK(t)
+# define BFI_FLINEAR3_1656(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1655, v ds
+# define BFI_FLINEAR3_1656_TICK(t)
+# define BFI_FLINEAR3_1655(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1654, v ds
+# define BFI_FLINEAR3_1655_TICK(t)
+# define BFI_FLINEAR3_1654(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1653, v ds
+# define BFI_FLINEAR3_1654_TICK(t)
+# define BFI_FLINEAR3_1653(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1652, v ds
+# define BFI_FLINEAR3_1653_TICK(t)
+# define BFI_FLINEAR3_1652(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1651, v ds
+# define BFI_FLINEAR3_1652_TICK(t)
+# define BFI_FLINEAR3_1651(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1650, v ds
+# define BFI_FLINEAR3_1651_TICK(t)
+# define BFI_FLINEAR3_1650(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1649, v ds
+# define BFI_FLINEAR3_1650_TICK(t)
+# define BFI_FLINEAR3_1649(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1648, v ds
+# define BFI_FLINEAR3_1649_TICK(t)
+# define BFI_FLINEAR3_1648(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1647, v ds
+# define BFI_FLINEAR3_1648_TICK(t)
+# define BFI_FLINEAR3_1647(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1646, v ds
+# define BFI_FLINEAR3_1647_TICK(t)
+# define BFI_FLINEAR3_1646(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1645, v ds
+# define BFI_FLINEAR3_1646_TICK(t)
+# define BFI_FLINEAR3_1645(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1644, v ds
+# define BFI_FLINEAR3_1645_TICK(t)
+# define BFI_FLINEAR3_1644(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1643, v ds
+# define BFI_FLINEAR3_1644_TICK(t)
+# define BFI_FLINEAR3_1643(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1642, v ds
+# define BFI_FLINEAR3_1643_TICK(t)
+# define BFI_FLINEAR3_1642(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1641, v ds
+# define BFI_FLINEAR3_1642_TICK(t)
+# define BFI_FLINEAR3_1641(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1640, v ds
+# define BFI_FLINEAR3_1641_TICK(t)
+# define BFI_FLINEAR3_1640(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1639, v ds
+# define BFI_FLINEAR3_1640_TICK(t)
+# define BFI_FLINEAR3_1639(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1638, v ds
+# define BFI_FLINEAR3_1639_TICK(t)
+# define BFI_FLINEAR3_1638(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1637, v ds
+# define BFI_FLINEAR3_1638_TICK(t)
+# define BFI_FLINEAR3_1637(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1636, v ds
+# define BFI_FLINEAR3_1637_TICK(t)
+# define BFI_FLINEAR3_1636(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1635, v ds
+# define BFI_FLINEAR3_1636_TICK(t)
+# define BFI_FLINEAR3_1635(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1634, v ds
+# define BFI_FLINEAR3_1635_TICK(t)
+# define BFI_FLINEAR3_1634(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1633, v ds
+# define BFI_FLINEAR3_1634_TICK(t)
+# define BFI_FLINEAR3_1633(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1632, v ds
+# define BFI_FLINEAR3_1633_TICK(t)
+# define BFI_FLINEAR3_1632(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1631, v ds
+# define BFI_FLINEAR3_1632_TICK(t)
+# define BFI_FLINEAR3_1631(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1630, v ds
+# define BFI_FLINEAR3_1631_TICK(t)
+# define BFI_FLINEAR3_1630(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1629, v ds
+# define BFI_FLINEAR3_1630_TICK(t)
+# define BFI_FLINEAR3_1629(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1628, v ds
+# define BFI_FLINEAR3_1629_TICK(t)
+# define BFI_FLINEAR3_1628(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1627, v ds
+# define BFI_FLINEAR3_1628_TICK(t)
+# define BFI_FLINEAR3_1627(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1626, v ds
+# define BFI_FLINEAR3_1627_TICK(t)
+# define BFI_FLINEAR3_1626(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1625, v ds
+# define BFI_FLINEAR3_1626_TICK(t)
+# define BFI_FLINEAR3_1625(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1624, v ds
+# define BFI_FLINEAR3_1625_TICK(t)
+# define BFI_FLINEAR3_1624(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1623, v ds
+# define BFI_FLINEAR3_1624_TICK(t)
+# define BFI_FLINEAR3_1623(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1622, v ds
+# define BFI_FLINEAR3_1623_TICK(t)
+# define BFI_FLINEAR3_1622(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1621, v ds
+# define BFI_FLINEAR3_1622_TICK(t)
+# define BFI_FLINEAR3_1621(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1620, v ds
+# define BFI_FLINEAR3_1621_TICK(t)
+# define BFI_FLINEAR3_1620(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1619, v ds
+# define BFI_FLINEAR3_1620_TICK(t)
+# define BFI_FLINEAR3_1619(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1618, v ds
+# define BFI_FLINEAR3_1619_TICK(t)
+# define BFI_FLINEAR3_1618(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1617, v ds
+# define BFI_FLINEAR3_1618_TICK(t)
+# define BFI_FLINEAR3_1617(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1616, v ds
+# define BFI_FLINEAR3_1617_TICK(t)
+# define BFI_FLINEAR3_1616(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1615, v ds
+# define BFI_FLINEAR3_1616_TICK(t)
+# define BFI_FLINEAR3_1615(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1614, v ds
+# define BFI_FLINEAR3_1615_TICK(t)
+# define BFI_FLINEAR3_1614(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1613, v ds
+# define BFI_FLINEAR3_1614_TICK(t)
+# define BFI_FLINEAR3_1613(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1612, v ds
+# define BFI_FLINEAR3_1613_TICK(t)
+# define BFI_FLINEAR3_1612(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1611, v ds
+# define BFI_FLINEAR3_1612_TICK(t)
+# define BFI_FLINEAR3_1611(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1610, v ds
+# define BFI_FLINEAR3_1611_TICK(t)
+# define BFI_FLINEAR3_1610(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1609, v ds
+# define BFI_FLINEAR3_1610_TICK(t)
+# define BFI_FLINEAR3_1609(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1608, v ds
+# define BFI_FLINEAR3_1609_TICK(t)
+# define BFI_FLINEAR3_1608(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1607, v ds
+# define BFI_FLINEAR3_1608_TICK(t)
+# define BFI_FLINEAR3_1607(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1606, v ds
+# define BFI_FLINEAR3_1607_TICK(t)
+# define BFI_FLINEAR3_1606(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1605, v ds
+# define BFI_FLINEAR3_1606_TICK(t)
+# define BFI_FLINEAR3_1605(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1604, v ds
+# define BFI_FLINEAR3_1605_TICK(t)
+# define BFI_FLINEAR3_1604(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1603, v ds
+# define BFI_FLINEAR3_1604_TICK(t)
+# define BFI_FLINEAR3_1603(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1602, v ds
+# define BFI_FLINEAR3_1603_TICK(t)
+# define BFI_FLINEAR3_1602(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1601, v ds
+# define BFI_FLINEAR3_1602_TICK(t)
+# define BFI_FLINEAR3_1601(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1600, v ds
+# define BFI_FLINEAR3_1601_TICK(t)
+# define BFI_FLINEAR3_1600(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1599, v ds
+# define BFI_FLINEAR3_1600_TICK(t)
+# define BFI_FLINEAR3_1599(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1598, v ds
+# define BFI_FLINEAR3_1599_TICK(t)
+# define BFI_FLINEAR3_1598(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1597, v ds
+# define BFI_FLINEAR3_1598_TICK(t)
+# define BFI_FLINEAR3_1597(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1596, v ds
+# define BFI_FLINEAR3_1597_TICK(t)
+# define BFI_FLINEAR3_1596(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1595, v ds
+# define BFI_FLINEAR3_1596_TICK(t)
+# define BFI_FLINEAR3_1595(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1594, v ds
+# define BFI_FLINEAR3_1595_TICK(t)
+# define BFI_FLINEAR3_1594(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1593, v ds
+# define BFI_FLINEAR3_1594_TICK(t)
+# define BFI_FLINEAR3_1593(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1592, v ds
+# define BFI_FLINEAR3_1593_TICK(t)
+# define BFI_FLINEAR3_1592(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1591, v ds
+# define BFI_FLINEAR3_1592_TICK(t)
+# define BFI_FLINEAR3_1591(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1590, v ds
+# define BFI_FLINEAR3_1591_TICK(t)
+# define BFI_FLINEAR3_1590(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1589, v ds
+# define BFI_FLINEAR3_1590_TICK(t)
+# define BFI_FLINEAR3_1589(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1588, v ds
+# define BFI_FLINEAR3_1589_TICK(t)
+# define BFI_FLINEAR3_1588(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1587, v ds
+# define BFI_FLINEAR3_1588_TICK(t)
+# define BFI_FLINEAR3_1587(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1586, v ds
+# define BFI_FLINEAR3_1587_TICK(t)
+# define BFI_FLINEAR3_1586(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1585, v ds
+# define BFI_FLINEAR3_1586_TICK(t)
+# define BFI_FLINEAR3_1585(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1584, v ds
+# define BFI_FLINEAR3_1585_TICK(t)
+# define BFI_FLINEAR3_1584(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1583, v ds
+# define BFI_FLINEAR3_1584_TICK(t)
+# define BFI_FLINEAR3_1583(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1582, v ds
+# define BFI_FLINEAR3_1583_TICK(t)
+# define BFI_FLINEAR3_1582(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1581, v ds
+# define BFI_FLINEAR3_1582_TICK(t)
+# define BFI_FLINEAR3_1581(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1580, v ds
+# define BFI_FLINEAR3_1581_TICK(t)
+# define BFI_FLINEAR3_1580(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1579, v ds
+# define BFI_FLINEAR3_1580_TICK(t)
+# define BFI_FLINEAR3_1579(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1578, v ds
+# define BFI_FLINEAR3_1579_TICK(t)
+# define BFI_FLINEAR3_1578(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1577, v ds
+# define BFI_FLINEAR3_1578_TICK(t)
+# define BFI_FLINEAR3_1577(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1576, v ds
+# define BFI_FLINEAR3_1577_TICK(t)
+# define BFI_FLINEAR3_1576(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1575, v ds
+# define BFI_FLINEAR3_1576_TICK(t)
+# define BFI_FLINEAR3_1575(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1574, v ds
+# define BFI_FLINEAR3_1575_TICK(t)
+# define BFI_FLINEAR3_1574(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1573, v ds
+# define BFI_FLINEAR3_1574_TICK(t)
+# define BFI_FLINEAR3_1573(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1572, v ds
+# define BFI_FLINEAR3_1573_TICK(t)
+# define BFI_FLINEAR3_1572(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1571, v ds
+# define BFI_FLINEAR3_1572_TICK(t)
+# define BFI_FLINEAR3_1571(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1570, v ds
+# define BFI_FLINEAR3_1571_TICK(t)
+# define BFI_FLINEAR3_1570(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1569, v ds
+# define BFI_FLINEAR3_1570_TICK(t)
+# define BFI_FLINEAR3_1569(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1568, v ds
+# define BFI_FLINEAR3_1569_TICK(t)
+# define BFI_FLINEAR3_1568(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1567, v ds
+# define BFI_FLINEAR3_1568_TICK(t)
+# define BFI_FLINEAR3_1567(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1566, v ds
+# define BFI_FLINEAR3_1567_TICK(t)
+# define BFI_FLINEAR3_1566(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1565, v ds
+# define BFI_FLINEAR3_1566_TICK(t)
+# define BFI_FLINEAR3_1565(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1564, v ds
+# define BFI_FLINEAR3_1565_TICK(t)
+# define BFI_FLINEAR3_1564(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1563, v ds
+# define BFI_FLINEAR3_1564_TICK(t)
+# define BFI_FLINEAR3_1563(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1562, v ds
+# define BFI_FLINEAR3_1563_TICK(t)
+# define BFI_FLINEAR3_1562(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1561, v ds
+# define BFI_FLINEAR3_1562_TICK(t)
+# define BFI_FLINEAR3_1561(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1560, v ds
+# define BFI_FLINEAR3_1561_TICK(t)
+# define BFI_FLINEAR3_1560(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1559, v ds
+# define BFI_FLINEAR3_1560_TICK(t)
+# define BFI_FLINEAR3_1559(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1558, v ds
+# define BFI_FLINEAR3_1559_TICK(t)
+# define BFI_FLINEAR3_1558(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1557, v ds
+# define BFI_FLINEAR3_1558_TICK(t)
+# define BFI_FLINEAR3_1557(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1556, v ds
+# define BFI_FLINEAR3_1557_TICK(t)
+# define BFI_FLINEAR3_1556(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1555, v ds
+# define BFI_FLINEAR3_1556_TICK(t)
+# define BFI_FLINEAR3_1555(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1554, v ds
+# define BFI_FLINEAR3_1555_TICK(t)
+# define BFI_FLINEAR3_1554(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1553, v ds
+# define BFI_FLINEAR3_1554_TICK(t)
+# define BFI_FLINEAR3_1553(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1552, v ds
+# define BFI_FLINEAR3_1553_TICK(t)
+# define BFI_FLINEAR3_1552(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1551, v ds
+# define BFI_FLINEAR3_1552_TICK(t)
+# define BFI_FLINEAR3_1551(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1550, v ds
+# define BFI_FLINEAR3_1551_TICK(t)
+# define BFI_FLINEAR3_1550(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1549, v ds
+# define BFI_FLINEAR3_1550_TICK(t)
+# define BFI_FLINEAR3_1549(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1548, v ds
+# define BFI_FLINEAR3_1549_TICK(t)
+# define BFI_FLINEAR3_1548(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1547, v ds
+# define BFI_FLINEAR3_1548_TICK(t)
+# define BFI_FLINEAR3_1547(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1546, v ds
+# define BFI_FLINEAR3_1547_TICK(t)
+# define BFI_FLINEAR3_1546(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1545, v ds
+# define BFI_FLINEAR3_1546_TICK(t)
+# define BFI_FLINEAR3_1545(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1544, v ds
+# define BFI_FLINEAR3_1545_TICK(t)
+# define BFI_FLINEAR3_1544(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1543, v ds
+# define BFI_FLINEAR3_1544_TICK(t)
+# define BFI_FLINEAR3_1543(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1542, v ds
+# define BFI_FLINEAR3_1543_TICK(t)
+# define BFI_FLINEAR3_1542(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1541, v ds
+# define BFI_FLINEAR3_1542_TICK(t)
+# define BFI_FLINEAR3_1541(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1540, v ds
+# define BFI_FLINEAR3_1541_TICK(t)
+# define BFI_FLINEAR3_1540(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1539, v ds
+# define BFI_FLINEAR3_1540_TICK(t)
+# define BFI_FLINEAR3_1539(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1538, v ds
+# define BFI_FLINEAR3_1539_TICK(t)
+# define BFI_FLINEAR3_1538(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1537, v ds
+# define BFI_FLINEAR3_1538_TICK(t)
+# define BFI_FLINEAR3_1537(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1536, v ds
+# define BFI_FLINEAR3_1537_TICK(t)
+# define BFI_FLINEAR3_1536(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1535, v ds
+# define BFI_FLINEAR3_1536_TICK(t)
+# define BFI_FLINEAR3_1535(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1534, v ds
+# define BFI_FLINEAR3_1535_TICK(t)
+# define BFI_FLINEAR3_1534(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1533, v ds
+# define BFI_FLINEAR3_1534_TICK(t)
+# define BFI_FLINEAR3_1533(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1532, v ds
+# define BFI_FLINEAR3_1533_TICK(t)
+# define BFI_FLINEAR3_1532(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1531, v ds
+# define BFI_FLINEAR3_1532_TICK(t)
+# define BFI_FLINEAR3_1531(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1530, v ds
+# define BFI_FLINEAR3_1531_TICK(t)
+# define BFI_FLINEAR3_1530(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1529, v ds
+# define BFI_FLINEAR3_1530_TICK(t)
+# define BFI_FLINEAR3_1529(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1528, v ds
+# define BFI_FLINEAR3_1529_TICK(t)
+# define BFI_FLINEAR3_1528(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1527, v ds
+# define BFI_FLINEAR3_1528_TICK(t)
+# define BFI_FLINEAR3_1527(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1526, v ds
+# define BFI_FLINEAR3_1527_TICK(t)
+# define BFI_FLINEAR3_1526(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1525, v ds
+# define BFI_FLINEAR3_1526_TICK(t)
+# define BFI_FLINEAR3_1525(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1524, v ds
+# define BFI_FLINEAR3_1525_TICK(t)
+# define BFI_FLINEAR3_1524(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1523, v ds
+# define BFI_FLINEAR3_1524_TICK(t)
+# define BFI_FLINEAR3_1523(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1522, v ds
+# define BFI_FLINEAR3_1523_TICK(t)
+# define BFI_FLINEAR3_1522(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1521, v ds
+# define BFI_FLINEAR3_1522_TICK(t)
+# define BFI_FLINEAR3_1521(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1520, v ds
+# define BFI_FLINEAR3_1521_TICK(t)
+# define BFI_FLINEAR3_1520(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1519, v ds
+# define BFI_FLINEAR3_1520_TICK(t)
+# define BFI_FLINEAR3_1519(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1518, v ds
+# define BFI_FLINEAR3_1519_TICK(t)
+# define BFI_FLINEAR3_1518(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1517, v ds
+# define BFI_FLINEAR3_1518_TICK(t)
+# define BFI_FLINEAR3_1517(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1516, v ds
+# define BFI_FLINEAR3_1517_TICK(t)
+# define BFI_FLINEAR3_1516(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1515, v ds
+# define BFI_FLINEAR3_1516_TICK(t)
+# define BFI_FLINEAR3_1515(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1514, v ds
+# define BFI_FLINEAR3_1515_TICK(t)
+# define BFI_FLINEAR3_1514(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1513, v ds
+# define BFI_FLINEAR3_1514_TICK(t)
+# define BFI_FLINEAR3_1513(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1512, v ds
+# define BFI_FLINEAR3_1513_TICK(t)
+# define BFI_FLINEAR3_1512(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1511, v ds
+# define BFI_FLINEAR3_1512_TICK(t)
+# define BFI_FLINEAR3_1511(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1510, v ds
+# define BFI_FLINEAR3_1511_TICK(t)
+# define BFI_FLINEAR3_1510(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1509, v ds
+# define BFI_FLINEAR3_1510_TICK(t)
+# define BFI_FLINEAR3_1509(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1508, v ds
+# define BFI_FLINEAR3_1509_TICK(t)
+# define BFI_FLINEAR3_1508(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1507, v ds
+# define BFI_FLINEAR3_1508_TICK(t)
+# define BFI_FLINEAR3_1507(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1506, v ds
+# define BFI_FLINEAR3_1507_TICK(t)
+# define BFI_FLINEAR3_1506(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1505, v ds
+# define BFI_FLINEAR3_1506_TICK(t)
+# define BFI_FLINEAR3_1505(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1504, v ds
+# define BFI_FLINEAR3_1505_TICK(t)
+# define BFI_FLINEAR3_1504(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1503, v ds
+# define BFI_FLINEAR3_1504_TICK(t)
+# define BFI_FLINEAR3_1503(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1502, v ds
+# define BFI_FLINEAR3_1503_TICK(t)
+# define BFI_FLINEAR3_1502(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1501, v ds
+# define BFI_FLINEAR3_1502_TICK(t)
+# define BFI_FLINEAR3_1501(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1500, v ds
+# define BFI_FLINEAR3_1501_TICK(t)
+# define BFI_FLINEAR3_1500(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1499, v ds
+# define BFI_FLINEAR3_1500_TICK(t)
+# define BFI_FLINEAR3_1499(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1498, v ds
+# define BFI_FLINEAR3_1499_TICK(t)
+# define BFI_FLINEAR3_1498(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1497, v ds
+# define BFI_FLINEAR3_1498_TICK(t)
+# define BFI_FLINEAR3_1497(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1496, v ds
+# define BFI_FLINEAR3_1497_TICK(t)
+# define BFI_FLINEAR3_1496(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1495, v ds
+# define BFI_FLINEAR3_1496_TICK(t)
+# define BFI_FLINEAR3_1495(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1494, v ds
+# define BFI_FLINEAR3_1495_TICK(t)
+# define BFI_FLINEAR3_1494(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1493, v ds
+# define BFI_FLINEAR3_1494_TICK(t)
+# define BFI_FLINEAR3_1493(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1492, v ds
+# define BFI_FLINEAR3_1493_TICK(t)
+# define BFI_FLINEAR3_1492(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1491, v ds
+# define BFI_FLINEAR3_1492_TICK(t)
+# define BFI_FLINEAR3_1491(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1490, v ds
+# define BFI_FLINEAR3_1491_TICK(t)
+# define BFI_FLINEAR3_1490(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1489, v ds
+# define BFI_FLINEAR3_1490_TICK(t)
+# define BFI_FLINEAR3_1489(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1488, v ds
+# define BFI_FLINEAR3_1489_TICK(t)
+# define BFI_FLINEAR3_1488(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1487, v ds
+# define BFI_FLINEAR3_1488_TICK(t)
+# define BFI_FLINEAR3_1487(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1486, v ds
+# define BFI_FLINEAR3_1487_TICK(t)
+# define BFI_FLINEAR3_1486(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1485, v ds
+# define BFI_FLINEAR3_1486_TICK(t)
+# define BFI_FLINEAR3_1485(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1484, v ds
+# define BFI_FLINEAR3_1485_TICK(t)
+# define BFI_FLINEAR3_1484(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1483, v ds
+# define BFI_FLINEAR3_1484_TICK(t)
+# define BFI_FLINEAR3_1483(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1482, v ds
+# define BFI_FLINEAR3_1483_TICK(t)
+# define BFI_FLINEAR3_1482(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1481, v ds
+# define BFI_FLINEAR3_1482_TICK(t)
+# define BFI_FLINEAR3_1481(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1480, v ds
+# define BFI_FLINEAR3_1481_TICK(t)
+# define BFI_FLINEAR3_1480(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1479, v ds
+# define BFI_FLINEAR3_1480_TICK(t)
+# define BFI_FLINEAR3_1479(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1478, v ds
+# define BFI_FLINEAR3_1479_TICK(t)
+# define BFI_FLINEAR3_1478(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1477, v ds
+# define BFI_FLINEAR3_1478_TICK(t)
+# define BFI_FLINEAR3_1477(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1476, v ds
+# define BFI_FLINEAR3_1477_TICK(t)
+# define BFI_FLINEAR3_1476(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1475, v ds
+# define BFI_FLINEAR3_1476_TICK(t)
+# define BFI_FLINEAR3_1475(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1474, v ds
+# define BFI_FLINEAR3_1475_TICK(t)
+# define BFI_FLINEAR3_1474(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1473, v ds
+# define BFI_FLINEAR3_1474_TICK(t)
+# define BFI_FLINEAR3_1473(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1472, v ds
+# define BFI_FLINEAR3_1473_TICK(t)
+# define BFI_FLINEAR3_1472(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1471, v ds
+# define BFI_FLINEAR3_1472_TICK(t)
+# define BFI_FLINEAR3_1471(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1470, v ds
+# define BFI_FLINEAR3_1471_TICK(t)
+# define BFI_FLINEAR3_1470(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1469, v ds
+# define BFI_FLINEAR3_1470_TICK(t)
+# define BFI_FLINEAR3_1469(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1468, v ds
+# define BFI_FLINEAR3_1469_TICK(t)
+# define BFI_FLINEAR3_1468(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1467, v ds
+# define BFI_FLINEAR3_1468_TICK(t)
+# define BFI_FLINEAR3_1467(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1466, v ds
+# define BFI_FLINEAR3_1467_TICK(t)
+# define BFI_FLINEAR3_1466(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1465, v ds
+# define BFI_FLINEAR3_1466_TICK(t)
+# define BFI_FLINEAR3_1465(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1464, v ds
+# define BFI_FLINEAR3_1465_TICK(t)
+# define BFI_FLINEAR3_1464(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1463, v ds
+# define BFI_FLINEAR3_1464_TICK(t)
+# define BFI_FLINEAR3_1463(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1462, v ds
+# define BFI_FLINEAR3_1463_TICK(t)
+# define BFI_FLINEAR3_1462(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1461, v ds
+# define BFI_FLINEAR3_1462_TICK(t)
+# define BFI_FLINEAR3_1461(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1460, v ds
+# define BFI_FLINEAR3_1461_TICK(t)
+# define BFI_FLINEAR3_1460(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1459, v ds
+# define BFI_FLINEAR3_1460_TICK(t)
+# define BFI_FLINEAR3_1459(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1458, v ds
+# define BFI_FLINEAR3_1459_TICK(t)
+# define BFI_FLINEAR3_1458(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1457, v ds
+# define BFI_FLINEAR3_1458_TICK(t)
+# define BFI_FLINEAR3_1457(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1456, v ds
+# define BFI_FLINEAR3_1457_TICK(t)
+# define BFI_FLINEAR3_1456(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1455, v ds
+# define BFI_FLINEAR3_1456_TICK(t)
+# define BFI_FLINEAR3_1455(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1454, v ds
+# define BFI_FLINEAR3_1455_TICK(t)
+# define BFI_FLINEAR3_1454(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1453, v ds
+# define BFI_FLINEAR3_1454_TICK(t)
+# define BFI_FLINEAR3_1453(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1452, v ds
+# define BFI_FLINEAR3_1453_TICK(t)
+# define BFI_FLINEAR3_1452(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1451, v ds
+# define BFI_FLINEAR3_1452_TICK(t)
+# define BFI_FLINEAR3_1451(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1450, v ds
+# define BFI_FLINEAR3_1451_TICK(t)
+# define BFI_FLINEAR3_1450(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1449, v ds
+# define BFI_FLINEAR3_1450_TICK(t)
+# define BFI_FLINEAR3_1449(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1448, v ds
+# define BFI_FLINEAR3_1449_TICK(t)
+# define BFI_FLINEAR3_1448(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1447, v ds
+# define BFI_FLINEAR3_1448_TICK(t)
+# define BFI_FLINEAR3_1447(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1446, v ds
+# define BFI_FLINEAR3_1447_TICK(t)
+# define BFI_FLINEAR3_1446(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1445, v ds
+# define BFI_FLINEAR3_1446_TICK(t)
+# define BFI_FLINEAR3_1445(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1444, v ds
+# define BFI_FLINEAR3_1445_TICK(t)
+# define BFI_FLINEAR3_1444(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1443, v ds
+# define BFI_FLINEAR3_1444_TICK(t)
+# define BFI_FLINEAR3_1443(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1442, v ds
+# define BFI_FLINEAR3_1443_TICK(t)
+# define BFI_FLINEAR3_1442(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1441, v ds
+# define BFI_FLINEAR3_1442_TICK(t)
+# define BFI_FLINEAR3_1441(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1440, v ds
+# define BFI_FLINEAR3_1441_TICK(t)
+# define BFI_FLINEAR3_1440(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1439, v ds
+# define BFI_FLINEAR3_1440_TICK(t)
+# define BFI_FLINEAR3_1439(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1438, v ds
+# define BFI_FLINEAR3_1439_TICK(t)
+# define BFI_FLINEAR3_1438(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1437, v ds
+# define BFI_FLINEAR3_1438_TICK(t)
+# define BFI_FLINEAR3_1437(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1436, v ds
+# define BFI_FLINEAR3_1437_TICK(t)
+# define BFI_FLINEAR3_1436(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1435, v ds
+# define BFI_FLINEAR3_1436_TICK(t)
+# define BFI_FLINEAR3_1435(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1434, v ds
+# define BFI_FLINEAR3_1435_TICK(t)
+# define BFI_FLINEAR3_1434(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1433, v ds
+# define BFI_FLINEAR3_1434_TICK(t)
+# define BFI_FLINEAR3_1433(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1432, v ds
+# define BFI_FLINEAR3_1433_TICK(t)
+# define BFI_FLINEAR3_1432(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1431, v ds
+# define BFI_FLINEAR3_1432_TICK(t)
+# define BFI_FLINEAR3_1431(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1430, v ds
+# define BFI_FLINEAR3_1431_TICK(t)
+# define BFI_FLINEAR3_1430(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1429, v ds
+# define BFI_FLINEAR3_1430_TICK(t)
+# define BFI_FLINEAR3_1429(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1428, v ds
+# define BFI_FLINEAR3_1429_TICK(t)
+# define BFI_FLINEAR3_1428(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1427, v ds
+# define BFI_FLINEAR3_1428_TICK(t)
+# define BFI_FLINEAR3_1427(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1426, v ds
+# define BFI_FLINEAR3_1427_TICK(t)
+# define BFI_FLINEAR3_1426(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1425, v ds
+# define BFI_FLINEAR3_1426_TICK(t)
+# define BFI_FLINEAR3_1425(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1424, v ds
+# define BFI_FLINEAR3_1425_TICK(t)
+# define BFI_FLINEAR3_1424(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1423, v ds
+# define BFI_FLINEAR3_1424_TICK(t)
+# define BFI_FLINEAR3_1423(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1422, v ds
+# define BFI_FLINEAR3_1423_TICK(t)
+# define BFI_FLINEAR3_1422(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1421, v ds
+# define BFI_FLINEAR3_1422_TICK(t)
+# define BFI_FLINEAR3_1421(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1420, v ds
+# define BFI_FLINEAR3_1421_TICK(t)
+# define BFI_FLINEAR3_1420(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1419, v ds
+# define BFI_FLINEAR3_1420_TICK(t)
+# define BFI_FLINEAR3_1419(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1418, v ds
+# define BFI_FLINEAR3_1419_TICK(t)
+# define BFI_FLINEAR3_1418(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1417, v ds
+# define BFI_FLINEAR3_1418_TICK(t)
+# define BFI_FLINEAR3_1417(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1416, v ds
+# define BFI_FLINEAR3_1417_TICK(t)
+# define BFI_FLINEAR3_1416(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1415, v ds
+# define BFI_FLINEAR3_1416_TICK(t)
+# define BFI_FLINEAR3_1415(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1414, v ds
+# define BFI_FLINEAR3_1415_TICK(t)
+# define BFI_FLINEAR3_1414(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1413, v ds
+# define BFI_FLINEAR3_1414_TICK(t)
+# define BFI_FLINEAR3_1413(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1412, v ds
+# define BFI_FLINEAR3_1413_TICK(t)
+# define BFI_FLINEAR3_1412(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1411, v ds
+# define BFI_FLINEAR3_1412_TICK(t)
+# define BFI_FLINEAR3_1411(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1410, v ds
+# define BFI_FLINEAR3_1411_TICK(t)
+# define BFI_FLINEAR3_1410(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1409, v ds
+# define BFI_FLINEAR3_1410_TICK(t)
+# define BFI_FLINEAR3_1409(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1408, v ds
+# define BFI_FLINEAR3_1409_TICK(t)
+# define BFI_FLINEAR3_1408(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1407, v ds
+# define BFI_FLINEAR3_1408_TICK(t)
+# define BFI_FLINEAR3_1407(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1406, v ds
+# define BFI_FLINEAR3_1407_TICK(t)
+# define BFI_FLINEAR3_1406(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1405, v ds
+# define BFI_FLINEAR3_1406_TICK(t)
+# define BFI_FLINEAR3_1405(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1404, v ds
+# define BFI_FLINEAR3_1405_TICK(t)
+# define BFI_FLINEAR3_1404(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1403, v ds
+# define BFI_FLINEAR3_1404_TICK(t)
+# define BFI_FLINEAR3_1403(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1402, v ds
+# define BFI_FLINEAR3_1403_TICK(t)
+# define BFI_FLINEAR3_1402(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1401, v ds
+# define BFI_FLINEAR3_1402_TICK(t)
+# define BFI_FLINEAR3_1401(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1400, v ds
+# define BFI_FLINEAR3_1401_TICK(t)
+# define BFI_FLINEAR3_1400(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1399, v ds
+# define BFI_FLINEAR3_1400_TICK(t)
+# define BFI_FLINEAR3_1399(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1398, v ds
+# define BFI_FLINEAR3_1399_TICK(t)
+# define BFI_FLINEAR3_1398(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1397, v ds
+# define BFI_FLINEAR3_1398_TICK(t)
+# define BFI_FLINEAR3_1397(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1396, v ds
+# define BFI_FLINEAR3_1397_TICK(t)
+# define BFI_FLINEAR3_1396(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1395, v ds
+# define BFI_FLINEAR3_1396_TICK(t)
+# define BFI_FLINEAR3_1395(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1394, v ds
+# define BFI_FLINEAR3_1395_TICK(t)
+# define BFI_FLINEAR3_1394(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1393, v ds
+# define BFI_FLINEAR3_1394_TICK(t)
+# define BFI_FLINEAR3_1393(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1392, v ds
+# define BFI_FLINEAR3_1393_TICK(t)
+# define BFI_FLINEAR3_1392(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1391, v ds
+# define BFI_FLINEAR3_1392_TICK(t)
+# define BFI_FLINEAR3_1391(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1390, v ds
+# define BFI_FLINEAR3_1391_TICK(t)
+# define BFI_FLINEAR3_1390(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1389, v ds
+# define BFI_FLINEAR3_1390_TICK(t)
+# define BFI_FLINEAR3_1389(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1388, v ds
+# define BFI_FLINEAR3_1389_TICK(t)
+# define BFI_FLINEAR3_1388(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1387, v ds
+# define BFI_FLINEAR3_1388_TICK(t)
+# define BFI_FLINEAR3_1387(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1386, v ds
+# define BFI_FLINEAR3_1387_TICK(t)
+# define BFI_FLINEAR3_1386(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1385, v ds
+# define BFI_FLINEAR3_1386_TICK(t)
+# define BFI_FLINEAR3_1385(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1384, v ds
+# define BFI_FLINEAR3_1385_TICK(t)
+# define BFI_FLINEAR3_1384(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1383, v ds
+# define BFI_FLINEAR3_1384_TICK(t)
+# define BFI_FLINEAR3_1383(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1382, v ds
+# define BFI_FLINEAR3_1383_TICK(t)
+# define BFI_FLINEAR3_1382(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1381, v ds
+# define BFI_FLINEAR3_1382_TICK(t)
+# define BFI_FLINEAR3_1381(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1380, v ds
+# define BFI_FLINEAR3_1381_TICK(t)
+# define BFI_FLINEAR3_1380(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1379, v ds
+# define BFI_FLINEAR3_1380_TICK(t)
+# define BFI_FLINEAR3_1379(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1378, v ds
+# define BFI_FLINEAR3_1379_TICK(t)
+# define BFI_FLINEAR3_1378(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1377, v ds
+# define BFI_FLINEAR3_1378_TICK(t)
+# define BFI_FLINEAR3_1377(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1376, v ds
+# define BFI_FLINEAR3_1377_TICK(t)
+# define BFI_FLINEAR3_1376(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1375, v ds
+# define BFI_FLINEAR3_1376_TICK(t)
+# define BFI_FLINEAR3_1375(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1374, v ds
+# define BFI_FLINEAR3_1375_TICK(t)
+# define BFI_FLINEAR3_1374(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1373, v ds
+# define BFI_FLINEAR3_1374_TICK(t)
+# define BFI_FLINEAR3_1373(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1372, v ds
+# define BFI_FLINEAR3_1373_TICK(t)
+# define BFI_FLINEAR3_1372(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1371, v ds
+# define BFI_FLINEAR3_1372_TICK(t)
+# define BFI_FLINEAR3_1371(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1370, v ds
+# define BFI_FLINEAR3_1371_TICK(t)
+# define BFI_FLINEAR3_1370(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1369, v ds
+# define BFI_FLINEAR3_1370_TICK(t)
+# define BFI_FLINEAR3_1369(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1368, v ds
+# define BFI_FLINEAR3_1369_TICK(t)
+# define BFI_FLINEAR3_1368(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1367, v ds
+# define BFI_FLINEAR3_1368_TICK(t)
+# define BFI_FLINEAR3_1367(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1366, v ds
+# define BFI_FLINEAR3_1367_TICK(t)
+# define BFI_FLINEAR3_1366(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1365, v ds
+# define BFI_FLINEAR3_1366_TICK(t)
+# define BFI_FLINEAR3_1365(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1364, v ds
+# define BFI_FLINEAR3_1365_TICK(t)
+# define BFI_FLINEAR3_1364(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1363, v ds
+# define BFI_FLINEAR3_1364_TICK(t)
+# define BFI_FLINEAR3_1363(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1362, v ds
+# define BFI_FLINEAR3_1363_TICK(t)
+# define BFI_FLINEAR3_1362(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1361, v ds
+# define BFI_FLINEAR3_1362_TICK(t)
+# define BFI_FLINEAR3_1361(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1360, v ds
+# define BFI_FLINEAR3_1361_TICK(t)
+# define BFI_FLINEAR3_1360(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1359, v ds
+# define BFI_FLINEAR3_1360_TICK(t)
+# define BFI_FLINEAR3_1359(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1358, v ds
+# define BFI_FLINEAR3_1359_TICK(t)
+# define BFI_FLINEAR3_1358(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1357, v ds
+# define BFI_FLINEAR3_1358_TICK(t)
+# define BFI_FLINEAR3_1357(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1356, v ds
+# define BFI_FLINEAR3_1357_TICK(t)
+# define BFI_FLINEAR3_1356(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1355, v ds
+# define BFI_FLINEAR3_1356_TICK(t)
+# define BFI_FLINEAR3_1355(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1354, v ds
+# define BFI_FLINEAR3_1355_TICK(t)
+# define BFI_FLINEAR3_1354(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1353, v ds
+# define BFI_FLINEAR3_1354_TICK(t)
+# define BFI_FLINEAR3_1353(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1352, v ds
+# define BFI_FLINEAR3_1353_TICK(t)
+# define BFI_FLINEAR3_1352(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1351, v ds
+# define BFI_FLINEAR3_1352_TICK(t)
+# define BFI_FLINEAR3_1351(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1350, v ds
+# define BFI_FLINEAR3_1351_TICK(t)
+# define BFI_FLINEAR3_1350(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1349, v ds
+# define BFI_FLINEAR3_1350_TICK(t)
+# define BFI_FLINEAR3_1349(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1348, v ds
+# define BFI_FLINEAR3_1349_TICK(t)
+# define BFI_FLINEAR3_1348(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1347, v ds
+# define BFI_FLINEAR3_1348_TICK(t)
+# define BFI_FLINEAR3_1347(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1346, v ds
+# define BFI_FLINEAR3_1347_TICK(t)
+# define BFI_FLINEAR3_1346(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1345, v ds
+# define BFI_FLINEAR3_1346_TICK(t)
+# define BFI_FLINEAR3_1345(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1344, v ds
+# define BFI_FLINEAR3_1345_TICK(t)
+# define BFI_FLINEAR3_1344(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1343, v ds
+# define BFI_FLINEAR3_1344_TICK(t)
+# define BFI_FLINEAR3_1343(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1342, v ds
+# define BFI_FLINEAR3_1343_TICK(t)
+# define BFI_FLINEAR3_1342(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1341, v ds
+# define BFI_FLINEAR3_1342_TICK(t)
+# define BFI_FLINEAR3_1341(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1340, v ds
+# define BFI_FLINEAR3_1341_TICK(t)
+# define BFI_FLINEAR3_1340(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1339, v ds
+# define BFI_FLINEAR3_1340_TICK(t)
+# define BFI_FLINEAR3_1339(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1338, v ds
+# define BFI_FLINEAR3_1339_TICK(t)
+# define BFI_FLINEAR3_1338(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1337, v ds
+# define BFI_FLINEAR3_1338_TICK(t)
+# define BFI_FLINEAR3_1337(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1336, v ds
+# define BFI_FLINEAR3_1337_TICK(t)
+# define BFI_FLINEAR3_1336(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1335, v ds
+# define BFI_FLINEAR3_1336_TICK(t)
+# define BFI_FLINEAR3_1335(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1334, v ds
+# define BFI_FLINEAR3_1335_TICK(t)
+# define BFI_FLINEAR3_1334(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1333, v ds
+# define BFI_FLINEAR3_1334_TICK(t)
+# define BFI_FLINEAR3_1333(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1332, v ds
+# define BFI_FLINEAR3_1333_TICK(t)
+# define BFI_FLINEAR3_1332(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1331, v ds
+# define BFI_FLINEAR3_1332_TICK(t)
+# define BFI_FLINEAR3_1331(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1330, v ds
+# define BFI_FLINEAR3_1331_TICK(t)
+# define BFI_FLINEAR3_1330(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1329, v ds
+# define BFI_FLINEAR3_1330_TICK(t)
+# define BFI_FLINEAR3_1329(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1328, v ds
+# define BFI_FLINEAR3_1329_TICK(t)
+# define BFI_FLINEAR3_1328(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1327, v ds
+# define BFI_FLINEAR3_1328_TICK(t)
+# define BFI_FLINEAR3_1327(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1326, v ds
+# define BFI_FLINEAR3_1327_TICK(t)
+# define BFI_FLINEAR3_1326(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1325, v ds
+# define BFI_FLINEAR3_1326_TICK(t)
+# define BFI_FLINEAR3_1325(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1324, v ds
+# define BFI_FLINEAR3_1325_TICK(t)
+# define BFI_FLINEAR3_1324(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1323, v ds
+# define BFI_FLINEAR3_1324_TICK(t)
+# define BFI_FLINEAR3_1323(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1322, v ds
+# define BFI_FLINEAR3_1323_TICK(t)
+# define BFI_FLINEAR3_1322(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1321, v ds
+# define BFI_FLINEAR3_1322_TICK(t)
+# define BFI_FLINEAR3_1321(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1320, v ds
+# define BFI_FLINEAR3_1321_TICK(t)
+# define BFI_FLINEAR3_1320(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1319, v ds
+# define BFI_FLINEAR3_1320_TICK(t)
+# define BFI_FLINEAR3_1319(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1318, v ds
+# define BFI_FLINEAR3_1319_TICK(t)
+# define BFI_FLINEAR3_1318(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1317, v ds
+# define BFI_FLINEAR3_1318_TICK(t)
+# define BFI_FLINEAR3_1317(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1316, v ds
+# define BFI_FLINEAR3_1317_TICK(t)
+# define BFI_FLINEAR3_1316(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1315, v ds
+# define BFI_FLINEAR3_1316_TICK(t)
+# define BFI_FLINEAR3_1315(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1314, v ds
+# define BFI_FLINEAR3_1315_TICK(t)
+# define BFI_FLINEAR3_1314(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1313, v ds
+# define BFI_FLINEAR3_1314_TICK(t)
+# define BFI_FLINEAR3_1313(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1312, v ds
+# define BFI_FLINEAR3_1313_TICK(t)
+# define BFI_FLINEAR3_1312(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1311, v ds
+# define BFI_FLINEAR3_1312_TICK(t)
+# define BFI_FLINEAR3_1311(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1310, v ds
+# define BFI_FLINEAR3_1311_TICK(t)
+# define BFI_FLINEAR3_1310(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1309, v ds
+# define BFI_FLINEAR3_1310_TICK(t)
+# define BFI_FLINEAR3_1309(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1308, v ds
+# define BFI_FLINEAR3_1309_TICK(t)
+# define BFI_FLINEAR3_1308(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1307, v ds
+# define BFI_FLINEAR3_1308_TICK(t)
+# define BFI_FLINEAR3_1307(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1306, v ds
+# define BFI_FLINEAR3_1307_TICK(t)
+# define BFI_FLINEAR3_1306(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1305, v ds
+# define BFI_FLINEAR3_1306_TICK(t)
+# define BFI_FLINEAR3_1305(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1304, v ds
+# define BFI_FLINEAR3_1305_TICK(t)
+# define BFI_FLINEAR3_1304(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1303, v ds
+# define BFI_FLINEAR3_1304_TICK(t)
+# define BFI_FLINEAR3_1303(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1302, v ds
+# define BFI_FLINEAR3_1303_TICK(t)
+# define BFI_FLINEAR3_1302(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1301, v ds
+# define BFI_FLINEAR3_1302_TICK(t)
+# define BFI_FLINEAR3_1301(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1300, v ds
+# define BFI_FLINEAR3_1301_TICK(t)
+# define BFI_FLINEAR3_1300(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1299, v ds
+# define BFI_FLINEAR3_1300_TICK(t)
+# define BFI_FLINEAR3_1299(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1298, v ds
+# define BFI_FLINEAR3_1299_TICK(t)
+# define BFI_FLINEAR3_1298(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1297, v ds
+# define BFI_FLINEAR3_1298_TICK(t)
+# define BFI_FLINEAR3_1297(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1296, v ds
+# define BFI_FLINEAR3_1297_TICK(t)
+# define BFI_FLINEAR3_1296(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1295, v ds
+# define BFI_FLINEAR3_1296_TICK(t)
+# define BFI_FLINEAR3_1295(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1294, v ds
+# define BFI_FLINEAR3_1295_TICK(t)
+# define BFI_FLINEAR3_1294(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1293, v ds
+# define BFI_FLINEAR3_1294_TICK(t)
+# define BFI_FLINEAR3_1293(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1292, v ds
+# define BFI_FLINEAR3_1293_TICK(t)
+# define BFI_FLINEAR3_1292(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1291, v ds
+# define BFI_FLINEAR3_1292_TICK(t)
+# define BFI_FLINEAR3_1291(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1290, v ds
+# define BFI_FLINEAR3_1291_TICK(t)
+# define BFI_FLINEAR3_1290(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1289, v ds
+# define BFI_FLINEAR3_1290_TICK(t)
+# define BFI_FLINEAR3_1289(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1288, v ds
+# define BFI_FLINEAR3_1289_TICK(t)
+# define BFI_FLINEAR3_1288(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1287, v ds
+# define BFI_FLINEAR3_1288_TICK(t)
+# define BFI_FLINEAR3_1287(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1286, v ds
+# define BFI_FLINEAR3_1287_TICK(t)
+# define BFI_FLINEAR3_1286(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1285, v ds
+# define BFI_FLINEAR3_1286_TICK(t)
+# define BFI_FLINEAR3_1285(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1284, v ds
+# define BFI_FLINEAR3_1285_TICK(t)
+# define BFI_FLINEAR3_1284(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1283, v ds
+# define BFI_FLINEAR3_1284_TICK(t)
+# define BFI_FLINEAR3_1283(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1282, v ds
+# define BFI_FLINEAR3_1283_TICK(t)
+# define BFI_FLINEAR3_1282(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1281, v ds
+# define BFI_FLINEAR3_1282_TICK(t)
+# define BFI_FLINEAR3_1281(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1280, v ds
+# define BFI_FLINEAR3_1281_TICK(t)
+# define BFI_FLINEAR3_1280(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1279, v ds
+# define BFI_FLINEAR3_1280_TICK(t)
+# define BFI_FLINEAR3_1279(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1278, v ds
+# define BFI_FLINEAR3_1279_TICK(t)
+# define BFI_FLINEAR3_1278(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1277, v ds
+# define BFI_FLINEAR3_1278_TICK(t)
+# define BFI_FLINEAR3_1277(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1276, v ds
+# define BFI_FLINEAR3_1277_TICK(t)
+# define BFI_FLINEAR3_1276(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1275, v ds
+# define BFI_FLINEAR3_1276_TICK(t)
+# define BFI_FLINEAR3_1275(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1274, v ds
+# define BFI_FLINEAR3_1275_TICK(t)
+# define BFI_FLINEAR3_1274(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1273, v ds
+# define BFI_FLINEAR3_1274_TICK(t)
+# define BFI_FLINEAR3_1273(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1272, v ds
+# define BFI_FLINEAR3_1273_TICK(t)
+# define BFI_FLINEAR3_1272(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1271, v ds
+# define BFI_FLINEAR3_1272_TICK(t)
+# define BFI_FLINEAR3_1271(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1270, v ds
+# define BFI_FLINEAR3_1271_TICK(t)
+# define BFI_FLINEAR3_1270(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1269, v ds
+# define BFI_FLINEAR3_1270_TICK(t)
+# define BFI_FLINEAR3_1269(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1268, v ds
+# define BFI_FLINEAR3_1269_TICK(t)
+# define BFI_FLINEAR3_1268(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1267, v ds
+# define BFI_FLINEAR3_1268_TICK(t)
+# define BFI_FLINEAR3_1267(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1266, v ds
+# define BFI_FLINEAR3_1267_TICK(t)
+# define BFI_FLINEAR3_1266(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1265, v ds
+# define BFI_FLINEAR3_1266_TICK(t)
+# define BFI_FLINEAR3_1265(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1264, v ds
+# define BFI_FLINEAR3_1265_TICK(t)
+# define BFI_FLINEAR3_1264(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1263, v ds
+# define BFI_FLINEAR3_1264_TICK(t)
+# define BFI_FLINEAR3_1263(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1262, v ds
+# define BFI_FLINEAR3_1263_TICK(t)
+# define BFI_FLINEAR3_1262(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1261, v ds
+# define BFI_FLINEAR3_1262_TICK(t)
+# define BFI_FLINEAR3_1261(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1260, v ds
+# define BFI_FLINEAR3_1261_TICK(t)
+# define BFI_FLINEAR3_1260(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1259, v ds
+# define BFI_FLINEAR3_1260_TICK(t)
+# define BFI_FLINEAR3_1259(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1258, v ds
+# define BFI_FLINEAR3_1259_TICK(t)
+# define BFI_FLINEAR3_1258(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1257, v ds
+# define BFI_FLINEAR3_1258_TICK(t)
+# define BFI_FLINEAR3_1257(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1256, v ds
+# define BFI_FLINEAR3_1257_TICK(t)
+# define BFI_FLINEAR3_1256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1255, v ds
+# define BFI_FLINEAR3_1256_TICK(t)
+# define BFI_FLINEAR3_1255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1254, v ds
+# define BFI_FLINEAR3_1255_TICK(t)
+# define BFI_FLINEAR3_1254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1253, v ds
+# define BFI_FLINEAR3_1254_TICK(t)
+# define BFI_FLINEAR3_1253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1252, v ds
+# define BFI_FLINEAR3_1253_TICK(t)
+# define BFI_FLINEAR3_1252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1251, v ds
+# define BFI_FLINEAR3_1252_TICK(t)
+# define BFI_FLINEAR3_1251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1250, v ds
+# define BFI_FLINEAR3_1251_TICK(t)
+# define BFI_FLINEAR3_1250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1249, v ds
+# define BFI_FLINEAR3_1250_TICK(t)
+# define BFI_FLINEAR3_1249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1248, v ds
+# define BFI_FLINEAR3_1249_TICK(t)
+# define BFI_FLINEAR3_1248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1247, v ds
+# define BFI_FLINEAR3_1248_TICK(t)
+# define BFI_FLINEAR3_1247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1246, v ds
+# define BFI_FLINEAR3_1247_TICK(t)
+# define BFI_FLINEAR3_1246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1245, v ds
+# define BFI_FLINEAR3_1246_TICK(t)
+# define BFI_FLINEAR3_1245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1244, v ds
+# define BFI_FLINEAR3_1245_TICK(t)
+# define BFI_FLINEAR3_1244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1243, v ds
+# define BFI_FLINEAR3_1244_TICK(t)
+# define BFI_FLINEAR3_1243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1242, v ds
+# define BFI_FLINEAR3_1243_TICK(t)
+# define BFI_FLINEAR3_1242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1241, v ds
+# define BFI_FLINEAR3_1242_TICK(t)
+# define BFI_FLINEAR3_1241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1240, v ds
+# define BFI_FLINEAR3_1241_TICK(t)
+# define BFI_FLINEAR3_1240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1239, v ds
+# define BFI_FLINEAR3_1240_TICK(t)
+# define BFI_FLINEAR3_1239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1238, v ds
+# define BFI_FLINEAR3_1239_TICK(t)
+# define BFI_FLINEAR3_1238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1237, v ds
+# define BFI_FLINEAR3_1238_TICK(t)
+# define BFI_FLINEAR3_1237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1236, v ds
+# define BFI_FLINEAR3_1237_TICK(t)
+# define BFI_FLINEAR3_1236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1235, v ds
+# define BFI_FLINEAR3_1236_TICK(t)
+# define BFI_FLINEAR3_1235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1234, v ds
+# define BFI_FLINEAR3_1235_TICK(t)
+# define BFI_FLINEAR3_1234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1233, v ds
+# define BFI_FLINEAR3_1234_TICK(t)
+# define BFI_FLINEAR3_1233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1232, v ds
+# define BFI_FLINEAR3_1233_TICK(t)
+# define BFI_FLINEAR3_1232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1231, v ds
+# define BFI_FLINEAR3_1232_TICK(t)
+# define BFI_FLINEAR3_1231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1230, v ds
+# define BFI_FLINEAR3_1231_TICK(t)
+# define BFI_FLINEAR3_1230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1229, v ds
+# define BFI_FLINEAR3_1230_TICK(t)
+# define BFI_FLINEAR3_1229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1228, v ds
+# define BFI_FLINEAR3_1229_TICK(t)
+# define BFI_FLINEAR3_1228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1227, v ds
+# define BFI_FLINEAR3_1228_TICK(t)
+# define BFI_FLINEAR3_1227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1226, v ds
+# define BFI_FLINEAR3_1227_TICK(t)
+# define BFI_FLINEAR3_1226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1225, v ds
+# define BFI_FLINEAR3_1226_TICK(t)
+# define BFI_FLINEAR3_1225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1224, v ds
+# define BFI_FLINEAR3_1225_TICK(t)
+# define BFI_FLINEAR3_1224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1223, v ds
+# define BFI_FLINEAR3_1224_TICK(t)
+# define BFI_FLINEAR3_1223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1222, v ds
+# define BFI_FLINEAR3_1223_TICK(t)
+# define BFI_FLINEAR3_1222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1221, v ds
+# define BFI_FLINEAR3_1222_TICK(t)
+# define BFI_FLINEAR3_1221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1220, v ds
+# define BFI_FLINEAR3_1221_TICK(t)
+# define BFI_FLINEAR3_1220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1219, v ds
+# define BFI_FLINEAR3_1220_TICK(t)
+# define BFI_FLINEAR3_1219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1218, v ds
+# define BFI_FLINEAR3_1219_TICK(t)
+# define BFI_FLINEAR3_1218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1217, v ds
+# define BFI_FLINEAR3_1218_TICK(t)
+# define BFI_FLINEAR3_1217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1216, v ds
+# define BFI_FLINEAR3_1217_TICK(t)
+# define BFI_FLINEAR3_1216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1215, v ds
+# define BFI_FLINEAR3_1216_TICK(t)
+# define BFI_FLINEAR3_1215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1214, v ds
+# define BFI_FLINEAR3_1215_TICK(t)
+# define BFI_FLINEAR3_1214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1213, v ds
+# define BFI_FLINEAR3_1214_TICK(t)
+# define BFI_FLINEAR3_1213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1212, v ds
+# define BFI_FLINEAR3_1213_TICK(t)
+# define BFI_FLINEAR3_1212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1211, v ds
+# define BFI_FLINEAR3_1212_TICK(t)
+# define BFI_FLINEAR3_1211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1210, v ds
+# define BFI_FLINEAR3_1211_TICK(t)
+# define BFI_FLINEAR3_1210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1209, v ds
+# define BFI_FLINEAR3_1210_TICK(t)
+# define BFI_FLINEAR3_1209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1208, v ds
+# define BFI_FLINEAR3_1209_TICK(t)
+# define BFI_FLINEAR3_1208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1207, v ds
+# define BFI_FLINEAR3_1208_TICK(t)
+# define BFI_FLINEAR3_1207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1206, v ds
+# define BFI_FLINEAR3_1207_TICK(t)
+# define BFI_FLINEAR3_1206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1205, v ds
+# define BFI_FLINEAR3_1206_TICK(t)
+# define BFI_FLINEAR3_1205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1204, v ds
+# define BFI_FLINEAR3_1205_TICK(t)
+# define BFI_FLINEAR3_1204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1203, v ds
+# define BFI_FLINEAR3_1204_TICK(t)
+# define BFI_FLINEAR3_1203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1202, v ds
+# define BFI_FLINEAR3_1203_TICK(t)
+# define BFI_FLINEAR3_1202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1201, v ds
+# define BFI_FLINEAR3_1202_TICK(t)
+# define BFI_FLINEAR3_1201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1200, v ds
+# define BFI_FLINEAR3_1201_TICK(t)
+# define BFI_FLINEAR3_1200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1199, v ds
+# define BFI_FLINEAR3_1200_TICK(t)
+# define BFI_FLINEAR3_1199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1198, v ds
+# define BFI_FLINEAR3_1199_TICK(t)
+# define BFI_FLINEAR3_1198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1197, v ds
+# define BFI_FLINEAR3_1198_TICK(t)
+# define BFI_FLINEAR3_1197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1196, v ds
+# define BFI_FLINEAR3_1197_TICK(t)
+# define BFI_FLINEAR3_1196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1195, v ds
+# define BFI_FLINEAR3_1196_TICK(t)
+# define BFI_FLINEAR3_1195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1194, v ds
+# define BFI_FLINEAR3_1195_TICK(t)
+# define BFI_FLINEAR3_1194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1193, v ds
+# define BFI_FLINEAR3_1194_TICK(t)
+# define BFI_FLINEAR3_1193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1192, v ds
+# define BFI_FLINEAR3_1193_TICK(t)
+# define BFI_FLINEAR3_1192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1191, v ds
+# define BFI_FLINEAR3_1192_TICK(t)
+# define BFI_FLINEAR3_1191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1190, v ds
+# define BFI_FLINEAR3_1191_TICK(t)
+# define BFI_FLINEAR3_1190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1189, v ds
+# define BFI_FLINEAR3_1190_TICK(t)
+# define BFI_FLINEAR3_1189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1188, v ds
+# define BFI_FLINEAR3_1189_TICK(t)
+# define BFI_FLINEAR3_1188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1187, v ds
+# define BFI_FLINEAR3_1188_TICK(t)
+# define BFI_FLINEAR3_1187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1186, v ds
+# define BFI_FLINEAR3_1187_TICK(t)
+# define BFI_FLINEAR3_1186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1185, v ds
+# define BFI_FLINEAR3_1186_TICK(t)
+# define BFI_FLINEAR3_1185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1184, v ds
+# define BFI_FLINEAR3_1185_TICK(t)
+# define BFI_FLINEAR3_1184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1183, v ds
+# define BFI_FLINEAR3_1184_TICK(t)
+# define BFI_FLINEAR3_1183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1182, v ds
+# define BFI_FLINEAR3_1183_TICK(t)
+# define BFI_FLINEAR3_1182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1181, v ds
+# define BFI_FLINEAR3_1182_TICK(t)
+# define BFI_FLINEAR3_1181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1180, v ds
+# define BFI_FLINEAR3_1181_TICK(t)
+# define BFI_FLINEAR3_1180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1179, v ds
+# define BFI_FLINEAR3_1180_TICK(t)
+# define BFI_FLINEAR3_1179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1178, v ds
+# define BFI_FLINEAR3_1179_TICK(t)
+# define BFI_FLINEAR3_1178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1177, v ds
+# define BFI_FLINEAR3_1178_TICK(t)
+# define BFI_FLINEAR3_1177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1176, v ds
+# define BFI_FLINEAR3_1177_TICK(t)
+# define BFI_FLINEAR3_1176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1175, v ds
+# define BFI_FLINEAR3_1176_TICK(t)
+# define BFI_FLINEAR3_1175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1174, v ds
+# define BFI_FLINEAR3_1175_TICK(t)
+# define BFI_FLINEAR3_1174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1173, v ds
+# define BFI_FLINEAR3_1174_TICK(t)
+# define BFI_FLINEAR3_1173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1172, v ds
+# define BFI_FLINEAR3_1173_TICK(t)
+# define BFI_FLINEAR3_1172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1171, v ds
+# define BFI_FLINEAR3_1172_TICK(t)
+# define BFI_FLINEAR3_1171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1170, v ds
+# define BFI_FLINEAR3_1171_TICK(t)
+# define BFI_FLINEAR3_1170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1169, v ds
+# define BFI_FLINEAR3_1170_TICK(t)
+# define BFI_FLINEAR3_1169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1168, v ds
+# define BFI_FLINEAR3_1169_TICK(t)
+# define BFI_FLINEAR3_1168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1167, v ds
+# define BFI_FLINEAR3_1168_TICK(t)
+# define BFI_FLINEAR3_1167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1166, v ds
+# define BFI_FLINEAR3_1167_TICK(t)
+# define BFI_FLINEAR3_1166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1165, v ds
+# define BFI_FLINEAR3_1166_TICK(t)
+# define BFI_FLINEAR3_1165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1164, v ds
+# define BFI_FLINEAR3_1165_TICK(t)
+# define BFI_FLINEAR3_1164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1163, v ds
+# define BFI_FLINEAR3_1164_TICK(t)
+# define BFI_FLINEAR3_1163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1162, v ds
+# define BFI_FLINEAR3_1163_TICK(t)
+# define BFI_FLINEAR3_1162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1161, v ds
+# define BFI_FLINEAR3_1162_TICK(t)
+# define BFI_FLINEAR3_1161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1160, v ds
+# define BFI_FLINEAR3_1161_TICK(t)
+# define BFI_FLINEAR3_1160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1159, v ds
+# define BFI_FLINEAR3_1160_TICK(t)
+# define BFI_FLINEAR3_1159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1158, v ds
+# define BFI_FLINEAR3_1159_TICK(t)
+# define BFI_FLINEAR3_1158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1157, v ds
+# define BFI_FLINEAR3_1158_TICK(t)
+# define BFI_FLINEAR3_1157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1156, v ds
+# define BFI_FLINEAR3_1157_TICK(t)
+# define BFI_FLINEAR3_1156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1155, v ds
+# define BFI_FLINEAR3_1156_TICK(t)
+# define BFI_FLINEAR3_1155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1154, v ds
+# define BFI_FLINEAR3_1155_TICK(t)
+# define BFI_FLINEAR3_1154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1153, v ds
+# define BFI_FLINEAR3_1154_TICK(t)
+# define BFI_FLINEAR3_1153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1152, v ds
+# define BFI_FLINEAR3_1153_TICK(t)
+# define BFI_FLINEAR3_1152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1151, v ds
+# define BFI_FLINEAR3_1152_TICK(t)
+# define BFI_FLINEAR3_1151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1150, v ds
+# define BFI_FLINEAR3_1151_TICK(t)
+# define BFI_FLINEAR3_1150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1149, v ds
+# define BFI_FLINEAR3_1150_TICK(t)
+# define BFI_FLINEAR3_1149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1148, v ds
+# define BFI_FLINEAR3_1149_TICK(t)
+# define BFI_FLINEAR3_1148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1147, v ds
+# define BFI_FLINEAR3_1148_TICK(t)
+# define BFI_FLINEAR3_1147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1146, v ds
+# define BFI_FLINEAR3_1147_TICK(t)
+# define BFI_FLINEAR3_1146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1145, v ds
+# define BFI_FLINEAR3_1146_TICK(t)
+# define BFI_FLINEAR3_1145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1144, v ds
+# define BFI_FLINEAR3_1145_TICK(t)
+# define BFI_FLINEAR3_1144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1143, v ds
+# define BFI_FLINEAR3_1144_TICK(t)
+# define BFI_FLINEAR3_1143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1142, v ds
+# define BFI_FLINEAR3_1143_TICK(t)
+# define BFI_FLINEAR3_1142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1141, v ds
+# define BFI_FLINEAR3_1142_TICK(t)
+# define BFI_FLINEAR3_1141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1140, v ds
+# define BFI_FLINEAR3_1141_TICK(t)
+# define BFI_FLINEAR3_1140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1139, v ds
+# define BFI_FLINEAR3_1140_TICK(t)
+# define BFI_FLINEAR3_1139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1138, v ds
+# define BFI_FLINEAR3_1139_TICK(t)
+# define BFI_FLINEAR3_1138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1137, v ds
+# define BFI_FLINEAR3_1138_TICK(t)
+# define BFI_FLINEAR3_1137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1136, v ds
+# define BFI_FLINEAR3_1137_TICK(t)
+# define BFI_FLINEAR3_1136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1135, v ds
+# define BFI_FLINEAR3_1136_TICK(t)
+# define BFI_FLINEAR3_1135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1134, v ds
+# define BFI_FLINEAR3_1135_TICK(t)
+# define BFI_FLINEAR3_1134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1133, v ds
+# define BFI_FLINEAR3_1134_TICK(t)
+# define BFI_FLINEAR3_1133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1132, v ds
+# define BFI_FLINEAR3_1133_TICK(t)
+# define BFI_FLINEAR3_1132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1131, v ds
+# define BFI_FLINEAR3_1132_TICK(t)
+# define BFI_FLINEAR3_1131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1130, v ds
+# define BFI_FLINEAR3_1131_TICK(t)
+# define BFI_FLINEAR3_1130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1129, v ds
+# define BFI_FLINEAR3_1130_TICK(t)
+# define BFI_FLINEAR3_1129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1128, v ds
+# define BFI_FLINEAR3_1129_TICK(t)
+# define BFI_FLINEAR3_1128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1127, v ds
+# define BFI_FLINEAR3_1128_TICK(t)
+# define BFI_FLINEAR3_1127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1126, v ds
+# define BFI_FLINEAR3_1127_TICK(t)
+# define BFI_FLINEAR3_1126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1125, v ds
+# define BFI_FLINEAR3_1126_TICK(t)
+# define BFI_FLINEAR3_1125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1124, v ds
+# define BFI_FLINEAR3_1125_TICK(t)
+# define BFI_FLINEAR3_1124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1123, v ds
+# define BFI_FLINEAR3_1124_TICK(t)
+# define BFI_FLINEAR3_1123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1122, v ds
+# define BFI_FLINEAR3_1123_TICK(t)
+# define BFI_FLINEAR3_1122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1121, v ds
+# define BFI_FLINEAR3_1122_TICK(t)
+# define BFI_FLINEAR3_1121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1120, v ds
+# define BFI_FLINEAR3_1121_TICK(t)
+# define BFI_FLINEAR3_1120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1119, v ds
+# define BFI_FLINEAR3_1120_TICK(t)
+# define BFI_FLINEAR3_1119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1118, v ds
+# define BFI_FLINEAR3_1119_TICK(t)
+# define BFI_FLINEAR3_1118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1117, v ds
+# define BFI_FLINEAR3_1118_TICK(t)
+# define BFI_FLINEAR3_1117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1116, v ds
+# define BFI_FLINEAR3_1117_TICK(t)
+# define BFI_FLINEAR3_1116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1115, v ds
+# define BFI_FLINEAR3_1116_TICK(t)
+# define BFI_FLINEAR3_1115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1114, v ds
+# define BFI_FLINEAR3_1115_TICK(t)
+# define BFI_FLINEAR3_1114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1113, v ds
+# define BFI_FLINEAR3_1114_TICK(t)
+# define BFI_FLINEAR3_1113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1112, v ds
+# define BFI_FLINEAR3_1113_TICK(t)
+# define BFI_FLINEAR3_1112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1111, v ds
+# define BFI_FLINEAR3_1112_TICK(t)
+# define BFI_FLINEAR3_1111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1110, v ds
+# define BFI_FLINEAR3_1111_TICK(t)
+# define BFI_FLINEAR3_1110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1109, v ds
+# define BFI_FLINEAR3_1110_TICK(t)
+# define BFI_FLINEAR3_1109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1108, v ds
+# define BFI_FLINEAR3_1109_TICK(t)
+# define BFI_FLINEAR3_1108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1107, v ds
+# define BFI_FLINEAR3_1108_TICK(t)
+# define BFI_FLINEAR3_1107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1106, v ds
+# define BFI_FLINEAR3_1107_TICK(t)
+# define BFI_FLINEAR3_1106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1105, v ds
+# define BFI_FLINEAR3_1106_TICK(t)
+# define BFI_FLINEAR3_1105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1104, v ds
+# define BFI_FLINEAR3_1105_TICK(t)
+# define BFI_FLINEAR3_1104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1103, v ds
+# define BFI_FLINEAR3_1104_TICK(t)
+# define BFI_FLINEAR3_1103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1102, v ds
+# define BFI_FLINEAR3_1103_TICK(t)
+# define BFI_FLINEAR3_1102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1101, v ds
+# define BFI_FLINEAR3_1102_TICK(t)
+# define BFI_FLINEAR3_1101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1100, v ds
+# define BFI_FLINEAR3_1101_TICK(t)
+# define BFI_FLINEAR3_1100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1099, v ds
+# define BFI_FLINEAR3_1100_TICK(t)
+# define BFI_FLINEAR3_1099(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1098, v ds
+# define BFI_FLINEAR3_1099_TICK(t)
+# define BFI_FLINEAR3_1098(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1097, v ds
+# define BFI_FLINEAR3_1098_TICK(t)
+# define BFI_FLINEAR3_1097(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1096, v ds
+# define BFI_FLINEAR3_1097_TICK(t)
+# define BFI_FLINEAR3_1096(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1095, v ds
+# define BFI_FLINEAR3_1096_TICK(t)
+# define BFI_FLINEAR3_1095(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1094, v ds
+# define BFI_FLINEAR3_1095_TICK(t)
+# define BFI_FLINEAR3_1094(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1093, v ds
+# define BFI_FLINEAR3_1094_TICK(t)
+# define BFI_FLINEAR3_1093(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1092, v ds
+# define BFI_FLINEAR3_1093_TICK(t)
+# define BFI_FLINEAR3_1092(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1091, v ds
+# define BFI_FLINEAR3_1092_TICK(t)
+# define BFI_FLINEAR3_1091(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1090, v ds
+# define BFI_FLINEAR3_1091_TICK(t)
+# define BFI_FLINEAR3_1090(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1089, v ds
+# define BFI_FLINEAR3_1090_TICK(t)
+# define BFI_FLINEAR3_1089(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1088, v ds
+# define BFI_FLINEAR3_1089_TICK(t)
+# define BFI_FLINEAR3_1088(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1087, v ds
+# define BFI_FLINEAR3_1088_TICK(t)
+# define BFI_FLINEAR3_1087(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1086, v ds
+# define BFI_FLINEAR3_1087_TICK(t)
+# define BFI_FLINEAR3_1086(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1085, v ds
+# define BFI_FLINEAR3_1086_TICK(t)
+# define BFI_FLINEAR3_1085(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1084, v ds
+# define BFI_FLINEAR3_1085_TICK(t)
+# define BFI_FLINEAR3_1084(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1083, v ds
+# define BFI_FLINEAR3_1084_TICK(t)
+# define BFI_FLINEAR3_1083(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1082, v ds
+# define BFI_FLINEAR3_1083_TICK(t)
+# define BFI_FLINEAR3_1082(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1081, v ds
+# define BFI_FLINEAR3_1082_TICK(t)
+# define BFI_FLINEAR3_1081(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1080, v ds
+# define BFI_FLINEAR3_1081_TICK(t)
+# define BFI_FLINEAR3_1080(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1079, v ds
+# define BFI_FLINEAR3_1080_TICK(t)
+# define BFI_FLINEAR3_1079(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1078, v ds
+# define BFI_FLINEAR3_1079_TICK(t)
+# define BFI_FLINEAR3_1078(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1077, v ds
+# define BFI_FLINEAR3_1078_TICK(t)
+# define BFI_FLINEAR3_1077(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1076, v ds
+# define BFI_FLINEAR3_1077_TICK(t)
+# define BFI_FLINEAR3_1076(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1075, v ds
+# define BFI_FLINEAR3_1076_TICK(t)
+# define BFI_FLINEAR3_1075(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1074, v ds
+# define BFI_FLINEAR3_1075_TICK(t)
+# define BFI_FLINEAR3_1074(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1073, v ds
+# define BFI_FLINEAR3_1074_TICK(t)
+# define BFI_FLINEAR3_1073(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1072, v ds
+# define BFI_FLINEAR3_1073_TICK(t)
+# define BFI_FLINEAR3_1072(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1071, v ds
+# define BFI_FLINEAR3_1072_TICK(t)
+# define BFI_FLINEAR3_1071(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1070, v ds
+# define BFI_FLINEAR3_1071_TICK(t)
+# define BFI_FLINEAR3_1070(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1069, v ds
+# define BFI_FLINEAR3_1070_TICK(t)
+# define BFI_FLINEAR3_1069(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1068, v ds
+# define BFI_FLINEAR3_1069_TICK(t)
+# define BFI_FLINEAR3_1068(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1067, v ds
+# define BFI_FLINEAR3_1068_TICK(t)
+# define BFI_FLINEAR3_1067(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1066, v ds
+# define BFI_FLINEAR3_1067_TICK(t)
+# define BFI_FLINEAR3_1066(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1065, v ds
+# define BFI_FLINEAR3_1066_TICK(t)
+# define BFI_FLINEAR3_1065(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1064, v ds
+# define BFI_FLINEAR3_1065_TICK(t)
+# define BFI_FLINEAR3_1064(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1063, v ds
+# define BFI_FLINEAR3_1064_TICK(t)
+# define BFI_FLINEAR3_1063(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1062, v ds
+# define BFI_FLINEAR3_1063_TICK(t)
+# define BFI_FLINEAR3_1062(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1061, v ds
+# define BFI_FLINEAR3_1062_TICK(t)
+# define BFI_FLINEAR3_1061(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1060, v ds
+# define BFI_FLINEAR3_1061_TICK(t)
+# define BFI_FLINEAR3_1060(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1059, v ds
+# define BFI_FLINEAR3_1060_TICK(t)
+# define BFI_FLINEAR3_1059(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1058, v ds
+# define BFI_FLINEAR3_1059_TICK(t)
+# define BFI_FLINEAR3_1058(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1057, v ds
+# define BFI_FLINEAR3_1058_TICK(t)
+# define BFI_FLINEAR3_1057(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1056, v ds
+# define BFI_FLINEAR3_1057_TICK(t)
+# define BFI_FLINEAR3_1056(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1055, v ds
+# define BFI_FLINEAR3_1056_TICK(t)
+# define BFI_FLINEAR3_1055(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1054, v ds
+# define BFI_FLINEAR3_1055_TICK(t)
+# define BFI_FLINEAR3_1054(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1053, v ds
+# define BFI_FLINEAR3_1054_TICK(t)
+# define BFI_FLINEAR3_1053(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1052, v ds
+# define BFI_FLINEAR3_1053_TICK(t)
+# define BFI_FLINEAR3_1052(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1051, v ds
+# define BFI_FLINEAR3_1052_TICK(t)
+# define BFI_FLINEAR3_1051(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1050, v ds
+# define BFI_FLINEAR3_1051_TICK(t)
+# define BFI_FLINEAR3_1050(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1049, v ds
+# define BFI_FLINEAR3_1050_TICK(t)
+# define BFI_FLINEAR3_1049(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1048, v ds
+# define BFI_FLINEAR3_1049_TICK(t)
+# define BFI_FLINEAR3_1048(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1047, v ds
+# define BFI_FLINEAR3_1048_TICK(t)
+# define BFI_FLINEAR3_1047(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1046, v ds
+# define BFI_FLINEAR3_1047_TICK(t)
+# define BFI_FLINEAR3_1046(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1045, v ds
+# define BFI_FLINEAR3_1046_TICK(t)
+# define BFI_FLINEAR3_1045(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1044, v ds
+# define BFI_FLINEAR3_1045_TICK(t)
+# define BFI_FLINEAR3_1044(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1043, v ds
+# define BFI_FLINEAR3_1044_TICK(t)
+# define BFI_FLINEAR3_1043(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1042, v ds
+# define BFI_FLINEAR3_1043_TICK(t)
+# define BFI_FLINEAR3_1042(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1041, v ds
+# define BFI_FLINEAR3_1042_TICK(t)
+# define BFI_FLINEAR3_1041(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1040, v ds
+# define BFI_FLINEAR3_1041_TICK(t)
+# define BFI_FLINEAR3_1040(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1039, v ds
+# define BFI_FLINEAR3_1040_TICK(t)
+# define BFI_FLINEAR3_1039(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1038, v ds
+# define BFI_FLINEAR3_1039_TICK(t)
+# define BFI_FLINEAR3_1038(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1037, v ds
+# define BFI_FLINEAR3_1038_TICK(t)
+# define BFI_FLINEAR3_1037(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1036, v ds
+# define BFI_FLINEAR3_1037_TICK(t)
+# define BFI_FLINEAR3_1036(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1035, v ds
+# define BFI_FLINEAR3_1036_TICK(t)
+# define BFI_FLINEAR3_1035(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1034, v ds
+# define BFI_FLINEAR3_1035_TICK(t)
+# define BFI_FLINEAR3_1034(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1033, v ds
+# define BFI_FLINEAR3_1034_TICK(t)
+# define BFI_FLINEAR3_1033(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1032, v ds
+# define BFI_FLINEAR3_1033_TICK(t)
+# define BFI_FLINEAR3_1032(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1031, v ds
+# define BFI_FLINEAR3_1032_TICK(t)
+# define BFI_FLINEAR3_1031(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1030, v ds
+# define BFI_FLINEAR3_1031_TICK(t)
+# define BFI_FLINEAR3_1030(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1029, v ds
+# define BFI_FLINEAR3_1030_TICK(t)
+# define BFI_FLINEAR3_1029(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1028, v ds
+# define BFI_FLINEAR3_1029_TICK(t)
+# define BFI_FLINEAR3_1028(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1027, v ds
+# define BFI_FLINEAR3_1028_TICK(t)
+# define BFI_FLINEAR3_1027(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1026, v ds
+# define BFI_FLINEAR3_1027_TICK(t)
+# define BFI_FLINEAR3_1026(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1025, v ds
+# define BFI_FLINEAR3_1026_TICK(t)
+# define BFI_FLINEAR3_1025(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1024, v ds
+# define BFI_FLINEAR3_1025_TICK(t)
+
+# endif
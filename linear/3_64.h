@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_3_64_H
+# define BFI_LINEAR_3_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEAR3_64(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_63, v ds
+# define BFI_FLINEAR3_64_TICK(t)
+# define BFI_FLINEAR3_63(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_62, v ds
+# define BFI_FLINEAR3_63_TICK(t)
+# define BFI_FLINEAR3_62(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_61, v ds
+# define BFI_FLINEAR3_62_TICK(t)
+# define BFI_FLINEAR3_61(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_60, v ds
+# define BFI_FLINEAR3_61_TICK(t)
+# define BFI_FLINEAR3_60(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_59, v ds
+# define BFI_FLINEAR3_60_TICK(t)
+# define BFI_FLINEAR3_59(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_58, v ds
+# define BFI_FLINEAR3_59_TICK(t)
+# define BFI_FLINEAR3_58(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_57, v ds
+# define BFI_FLINEAR3_58_TICK(t)
+# define BFI_FLINEAR3_57(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_56, v ds
+# define BFI_FLINEAR3_57_TICK(t)
+# define BFI_FLINEAR3_56(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_55, v ds
+# define BFI_FLINEAR3_56_TICK(t)
+# define BFI_FLINEAR3_55(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_54, v ds
+# define BFI_FLINEAR3_55_TICK(t)
+# define BFI_FLINEAR3_54(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_53, v ds
+# define BFI_FLINEAR3_54_TICK(t)
+# define BFI_FLINEAR3_53(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_52, v ds
+# define BFI_FLINEAR3_53_TICK(t)
+# define BFI_FLINEAR3_52(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_51, v ds
+# define BFI_FLINEAR3_52_TICK(t)
+# define BFI_FLINEAR3_51(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_50, v ds
+# define BFI_FLINEAR3_51_TICK(t)
+# define BFI_FLINEAR3_50(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_49, v ds
+# define BFI_FLINEAR3_50_TICK(t)
+# define BFI_FLINEAR3_49(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_48, v ds
+# define BFI_FLINEAR3_49_TICK(t)
+# define BFI_FLINEAR3_48(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_47, v ds
+# define BFI_FLINEAR3_48_TICK(t)
+# define BFI_FLINEAR3_47(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_46, v ds
+# define BFI_FLINEAR3_47_TICK(t)
+# define BFI_FLINEAR3_46(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_45, v ds
+# define BFI_FLINEAR3_46_TICK(t)
+# define BFI_FLINEAR3_45(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_44, v ds
+# define BFI_FLINEAR3_45_TICK(t)
+# define BFI_FLINEAR3_44(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_43, v ds
+# define BFI_FLINEAR3_44_TICK(t)
+# define BFI_FLINEAR3_43(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_42, v ds
+# define BFI_FLINEAR3_43_TICK(t)
+# define BFI_FLINEAR3_42(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_41, v ds
+# define BFI_FLINEAR3_42_TICK(t)
+# define BFI_FLINEAR3_41(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_40, v ds
+# define BFI_FLINEAR3_41_TICK(t)
+# define BFI_FLINEAR3_40(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_39, v ds
+# define BFI_FLINEAR3_40_TICK(t)
+# define BFI_FLINEAR3_39(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_38, v ds
+# define BFI_FLINEAR3_39_TICK(t)
+# define BFI_FLINEAR3_38(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_37, v ds
+# define BFI_FLINEAR3_38_TICK(t)
+# define BFI_FLINEAR3_37(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_36, v ds
+# define BFI_FLINEAR3_37_TICK(t)
+# define BFI_FLINEAR3_36(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_35, v ds
+# define BFI_FLINEAR3_36_TICK(t)
+# define BFI_FLINEAR3_35(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_34, v ds
+# define BFI_FLINEAR3_35_TICK(t)
+# define BFI_FLINEAR3_34(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_33, v ds
+# define BFI_FLINEAR3_34_TICK(t)
+# define BFI_FLINEAR3_33(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_32, v ds
+# define BFI_FLINEAR3_33_TICK(t)
+# define BFI_FLINEAR3_32(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_31, v ds
+# define BFI_FLINEAR3_32_TICK(t)
+# define BFI_FLINEAR3_31(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_30, v ds
+# define BFI_FLINEAR3_31_TICK(t)
+# define BFI_FLINEAR3_30(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_29, v ds
+# define BFI_FLINEAR3_30_TICK(t)
+# define BFI_FLINEAR3_29(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_28, v ds
+# define BFI_FLINEAR3_29_TICK(t)
+# define BFI_FLINEAR3_28(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_27, v ds
+# define BFI_FLINEAR3_28_TICK(t)
+# define BFI_FLINEAR3_27(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_26, v ds
+# define BFI_FLINEAR3_27_TICK(t)
+# define BFI_FLINEAR3_26(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_25, v ds
+# define BFI_FLINEAR3_26_TICK(t)
+# define BFI_FLINEAR3_25(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_24, v ds
+# define BFI_FLINEAR3_25_TICK(t)
+# define BFI_FLINEAR3_24(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_23, v ds
+# define BFI_FLINEAR3_24_TICK(t)
+# define BFI_FLINEAR3_23(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_22, v ds
+# define BFI_FLINEAR3_23_TICK(t)
+# define BFI_FLINEAR3_22(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_21, v ds
+# define BFI_FLINEAR3_22_TICK(t)
+# define BFI_FLINEAR3_21(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_20, v ds
+# define BFI_FLINEAR3_21_TICK(t)
+# define BFI_FLINEAR3_20(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_19, v ds
+# define BFI_FLINEAR3_20_TICK(t)
+# define BFI_FLINEAR3_19(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_18, v ds
+# define BFI_FLINEAR3_19_TICK(t)
+# define BFI_FLINEAR3_18(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_17, v ds
+# define BFI_FLINEAR3_18_TICK(t)
+# define BFI_FLINEAR3_17(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_16, v ds
+# define BFI_FLINEAR3_17_TICK(t)
+# define BFI_FLINEAR3_16(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_15, v ds
+# define BFI_FLINEAR3_16_TICK(t)
+# define BFI_FLINEAR3_15(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_14, v ds
+# define BFI_FLINEAR3_15_TICK(t)
+# define BFI_FLINEAR3_14(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_13, v ds
+# define BFI_FLINEAR3_14_TICK(t)
+# define BFI_FLINEAR3_13(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_12, v ds
+# define BFI_FLINEAR3_13_TICK(t)
+# define BFI_FLINEAR3_12(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_11, v ds
+# define BFI_FLINEAR3_12_TICK(t)
+# define BFI_FLINEAR3_11(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_10, v ds
+# define BFI_FLINEAR3_11_TICK(t)
+# define BFI_FLINEAR3_10(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_9, v ds
+# define BFI_FLINEAR3_10_TICK(t)
+# define BFI_FLINEAR3_9(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_8, v ds
+# define BFI_FLINEAR3_9_TICK(t)
+# define BFI_FLINEAR3_8(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_7, v ds
+# define BFI_FLINEAR3_8_TICK(t)
+# define BFI_FLINEAR3_7(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_6, v ds
+# define BFI_FLINEAR3_7_TICK(t)
+# define BFI_FLINEAR3_6(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_5, v ds
+# define BFI_FLINEAR3_6_TICK(t)
+# define BFI_FLINEAR3_5(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_4, v ds
+# define BFI_FLINEAR3_5_TICK(t)
+# define BFI_FLINEAR3_4(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_3, v ds
+# define BFI_FLINEAR3_4_TICK(t)
+# define BFI_FLINEAR3_3(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_2, v ds
+# define BFI_FLINEAR3_3_TICK(t)
+# define BFI_FLINEAR3_2(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_1, v ds
+# define BFI_FLINEAR3_2_TICK(t)
+# define BFI_FLINEAR3_1(v, f, ds) BFI_FINST_##f(BFI_FLINEAR3_0, v ds
+# define BFI_FLINEAR3_1_TICK(t)
+
+# endif
@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_C_1024_H
+# define BFI_LINEAR_C_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARC_1024(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1023, v ds
+# define BFI_FLINEARC_1024_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1023(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1022, v ds
+# define BFI_FLINEARC_1023_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1022(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1021, v ds
+# define BFI_FLINEARC_1022_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1021(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1020, v ds
+# define BFI_FLINEARC_1021_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1020(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1019, v ds
+# define BFI_FLINEARC_1020_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1019(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1018, v ds
+# define BFI_FLINEARC_1019_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1018(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1017, v ds
+# define BFI_FLINEARC_1018_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1017(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1016, v ds
+# define BFI_FLINEARC_1017_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1016(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1015, v ds
+# define BFI_FLINEARC_1016_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1015(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1014, v ds
+# define BFI_FLINEARC_1015_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1014(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1013, v ds
+# define BFI_FLINEARC_1014_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1013(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1012, v ds
+# define BFI_FLINEARC_1013_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1012(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1011, v ds
+# define BFI_FLINEARC_1012_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1011(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1010, v ds
+# define BFI_FLINEARC_1011_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1010(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1009, v ds
+# define BFI_FLINEARC_1010_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1009(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1008, v ds
+# define BFI_FLINEARC_1009_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1008(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1007, v ds
+# define BFI_FLINEARC_1008_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1007(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1006, v ds
+# define BFI_FLINEARC_1007_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1006(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1005, v ds
+# define BFI_FLINEARC_1006_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1005(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1004, v ds
+# define BFI_FLINEARC_1005_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1004(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1003, v ds
+# define BFI_FLINEARC_1004_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1003(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1002, v ds
+# define BFI_FLINEARC_1003_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1002(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1001, v ds
+# define BFI_FLINEARC_1002_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1001(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1000, v ds
+# define BFI_FLINEARC_1001_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1000(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_999, v ds
+# define BFI_FLINEARC_1000_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_999(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_998, v ds
+# define BFI_FLINEARC_999_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_998(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_997, v ds
+# define BFI_FLINEARC_998_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_997(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_996, v ds
+# define BFI_FLINEARC_997_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_996(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_995, v ds
+# define BFI_FLINEARC_996_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_995(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_994, v ds
+# define BFI_FLINEARC_995_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_994(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_993, v ds
+# define BFI_FLINEARC_994_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_993(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_992, v ds
+# define BFI_FLINEARC_993_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_992(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_991, v ds
+# define BFI_FLINEARC_992_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_991(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_990, v ds
+# define BFI_FLINEARC_991_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_990(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_989, v ds
+# define BFI_FLINEARC_990_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_989(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_988, v ds
+# define BFI_FLINEARC_989_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_988(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_987, v ds
+# define BFI_FLINEARC_988_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_987(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_986, v ds
+# define BFI_FLINEARC_987_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_986(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_985, v ds
+# define BFI_FLINEARC_986_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_985(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_984, v ds
+# define BFI_FLINEARC_985_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_984(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_983, v ds
+# define BFI_FLINEARC_984_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_983(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_982, v ds
+# define BFI_FLINEARC_983_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_982(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_981, v ds
+# define BFI_FLINEARC_982_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_981(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_980, v ds
+# define BFI_FLINEARC_981_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_980(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_979, v ds
+# define BFI_FLINEARC_980_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_979(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_978, v ds
+# define BFI_FLINEARC_979_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_978(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_977, v ds
+# define BFI_FLINEARC_978_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_977(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_976, v ds
+# define BFI_FLINEARC_977_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_976(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_975, v ds
+# define BFI_FLINEARC_976_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_975(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_974, v ds
+# define BFI_FLINEARC_975_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_974(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_973, v ds
+# define BFI_FLINEARC_974_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_973(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_972, v ds
+# define BFI_FLINEARC_973_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_972(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_971, v ds
+# define BFI_FLINEARC_972_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_971(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_970, v ds
+# define BFI_FLINEARC_971_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_970(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_969, v ds
+# define BFI_FLINEARC_970_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_969(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_968, v ds
+# define BFI_FLINEARC_969_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_968(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_967, v ds
+# define BFI_FLINEARC_968_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_967(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_966, v ds
+# define BFI_FLINEARC_967_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_966(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_965, v ds
+# define BFI_FLINEARC_966_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_965(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_964, v ds
+# define BFI_FLINEARC_965_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_964(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_963, v ds
+# define BFI_FLINEARC_964_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_963(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_962, v ds
+# define BFI_FLINEARC_963_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_962(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_961, v ds
+# define BFI_FLINEARC_962_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_961(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_960, v ds
+# define BFI_FLINEARC_961_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_960(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_959, v ds
+# define BFI_FLINEARC_960_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_959(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_958, v ds
+# define BFI_FLINEARC_959_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_958(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_957, v ds
+# define BFI_FLINEARC_958_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_957(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_956, v ds
+# define BFI_FLINEARC_957_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_956(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_955, v ds
+# define BFI_FLINEARC_956_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_955(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_954, v ds
+# define BFI_FLINEARC_955_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_954(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_953, v ds
+# define BFI_FLINEARC_954_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_953(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_952, v ds
+# define BFI_FLINEARC_953_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_952(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_951, v ds
+# define BFI_FLINEARC_952_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_951(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_950, v ds
+# define BFI_FLINEARC_951_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_950(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_949, v ds
+# define BFI_FLINEARC_950_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_949(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_948, v ds
+# define BFI_FLINEARC_949_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_948(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_947, v ds
+# define BFI_FLINEARC_948_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_947(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_946, v ds
+# define BFI_FLINEARC_947_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_946(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_945, v ds
+# define BFI_FLINEARC_946_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_945(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_944, v ds
+# define BFI_FLINEARC_945_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_944(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_943, v ds
+# define BFI_FLINEARC_944_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_943(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_942, v ds
+# define BFI_FLINEARC_943_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_942(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_941, v ds
+# define BFI_FLINEARC_942_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_941(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_940, v ds
+# define BFI_FLINEARC_941_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_940(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_939, v ds
+# define BFI_FLINEARC_940_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_939(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_938, v ds
+# define BFI_FLINEARC_939_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_938(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_937, v ds
+# define BFI_FLINEARC_938_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_937(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_936, v ds
+# define BFI_FLINEARC_937_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_936(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_935, v ds
+# define BFI_FLINEARC_936_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_935(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_934, v ds
+# define BFI_FLINEARC_935_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_934(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_933, v ds
+# define BFI_FLINEARC_934_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_933(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_932, v ds
+# define BFI_FLINEARC_933_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_932(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_931, v ds
+# define BFI_FLINEARC_932_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_931(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_930, v ds
+# define BFI_FLINEARC_931_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_930(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_929, v ds
+# define BFI_FLINEARC_930_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_929(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_928, v ds
+# define BFI_FLINEARC_929_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_928(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_927, v ds
+# define BFI_FLINEARC_928_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_927(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_926, v ds
+# define BFI_FLINEARC_927_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_926(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_925, v ds
+# define BFI_FLINEARC_926_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_925(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_924, v ds
+# define BFI_FLINEARC_925_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_924(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_923, v ds
+# define BFI_FLINEARC_924_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_923(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_922, v ds
+# define BFI_FLINEARC_923_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_922(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_921, v ds
+# define BFI_FLINEARC_922_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_921(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_920, v ds
+# define BFI_FLINEARC_921_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_920(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_919, v ds
+# define BFI_FLINEARC_920_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_919(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_918, v ds
+# define BFI_FLINEARC_919_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_918(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_917, v ds
+# define BFI_FLINEARC_918_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_917(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_916, v ds
+# define BFI_FLINEARC_917_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_916(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_915, v ds
+# define BFI_FLINEARC_916_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_915(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_914, v ds
+# define BFI_FLINEARC_915_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_914(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_913, v ds
+# define BFI_FLINEARC_914_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_913(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_912, v ds
+# define BFI_FLINEARC_913_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_912(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_911, v ds
+# define BFI_FLINEARC_912_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_911(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_910, v ds
+# define BFI_FLINEARC_911_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_910(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_909, v ds
+# define BFI_FLINEARC_910_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_909(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_908, v ds
+# define BFI_FLINEARC_909_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_908(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_907, v ds
+# define BFI_FLINEARC_908_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_907(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_906, v ds
+# define BFI_FLINEARC_907_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_906(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_905, v ds
+# define BFI_FLINEARC_906_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_905(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_904, v ds
+# define BFI_FLINEARC_905_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_904(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_903, v ds
+# define BFI_FLINEARC_904_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_903(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_902, v ds
+# define BFI_FLINEARC_903_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_902(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_901, v ds
+# define BFI_FLINEARC_902_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_901(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_900, v ds
+# define BFI_FLINEARC_901_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_900(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_899, v ds
+# define BFI_FLINEARC_900_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_899(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_898, v ds
+# define BFI_FLINEARC_899_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_898(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_897, v ds
+# define BFI_FLINEARC_898_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_897(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_896, v ds
+# define BFI_FLINEARC_897_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_896(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_895, v ds
+# define BFI_FLINEARC_896_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_895(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_894, v ds
+# define BFI_FLINEARC_895_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_894(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_893, v ds
+# define BFI_FLINEARC_894_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_893(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_892, v ds
+# define BFI_FLINEARC_893_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_892(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_891, v ds
+# define BFI_FLINEARC_892_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_891(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_890, v ds
+# define BFI_FLINEARC_891_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_890(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_889, v ds
+# define BFI_FLINEARC_890_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_889(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_888, v ds
+# define BFI_FLINEARC_889_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_888(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_887, v ds
+# define BFI_FLINEARC_888_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_887(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_886, v ds
+# define BFI_FLINEARC_887_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_886(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_885, v ds
+# define BFI_FLINEARC_886_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_885(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_884, v ds
+# define BFI_FLINEARC_885_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_884(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_883, v ds
+# define BFI_FLINEARC_884_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_883(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_882, v ds
+# define BFI_FLINEARC_883_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_882(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_881, v ds
+# define BFI_FLINEARC_882_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_881(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_880, v ds
+# define BFI_FLINEARC_881_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_880(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_879, v ds
+# define BFI_FLINEARC_880_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_879(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_878, v ds
+# define BFI_FLINEARC_879_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_878(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_877, v ds
+# define BFI_FLINEARC_878_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_877(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_876, v ds
+# define BFI_FLINEARC_877_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_876(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_875, v ds
+# define BFI_FLINEARC_876_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_875(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_874, v ds
+# define BFI_FLINEARC_875_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_874(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_873, v ds
+# define BFI_FLINEARC_874_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_873(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_872, v ds
+# define BFI_FLINEARC_873_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_872(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_871, v ds
+# define BFI_FLINEARC_872_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_871(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_870, v ds
+# define BFI_FLINEARC_871_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_870(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_869, v ds
+# define BFI_FLINEARC_870_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_869(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_868, v ds
+# define BFI_FLINEARC_869_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_868(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_867, v ds
+# define BFI_FLINEARC_868_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_867(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_866, v ds
+# define BFI_FLINEARC_867_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_866(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_865, v ds
+# define BFI_FLINEARC_866_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_865(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_864, v ds
+# define BFI_FLINEARC_865_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_864(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_863, v ds
+# define BFI_FLINEARC_864_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_863(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_862, v ds
+# define BFI_FLINEARC_863_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_862(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_861, v ds
+# define BFI_FLINEARC_862_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_861(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_860, v ds
+# define BFI_FLINEARC_861_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_860(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_859, v ds
+# define BFI_FLINEARC_860_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_859(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_858, v ds
+# define BFI_FLINEARC_859_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_858(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_857, v ds
+# define BFI_FLINEARC_858_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_857(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_856, v ds
+# define BFI_FLINEARC_857_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_856(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_855, v ds
+# define BFI_FLINEARC_856_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_855(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_854, v ds
+# define BFI_FLINEARC_855_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_854(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_853, v ds
+# define BFI_FLINEARC_854_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_853(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_852, v ds
+# define BFI_FLINEARC_853_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_852(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_851, v ds
+# define BFI_FLINEARC_852_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_851(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_850, v ds
+# define BFI_FLINEARC_851_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_850(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_849, v ds
+# define BFI_FLINEARC_850_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_849(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_848, v ds
+# define BFI_FLINEARC_849_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_848(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_847, v ds
+# define BFI_FLINEARC_848_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_847(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_846, v ds
+# define BFI_FLINEARC_847_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_846(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_845, v ds
+# define BFI_FLINEARC_846_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_845(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_844, v ds
+# define BFI_FLINEARC_845_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_844(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_843, v ds
+# define BFI_FLINEARC_844_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_843(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_842, v ds
+# define BFI_FLINEARC_843_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_842(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_841, v ds
+# define BFI_FLINEARC_842_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_841(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_840, v ds
+# define BFI_FLINEARC_841_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_840(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_839, v ds
+# define BFI_FLINEARC_840_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_839(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_838, v ds
+# define BFI_FLINEARC_839_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_838(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_837, v ds
+# define BFI_FLINEARC_838_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_837(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_836, v ds
+# define BFI_FLINEARC_837_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_836(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_835, v ds
+# define BFI_FLINEARC_836_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_835(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_834, v ds
+# define BFI_FLINEARC_835_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_834(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_833, v ds
+# define BFI_FLINEARC_834_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_833(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_832, v ds
+# define BFI_FLINEARC_833_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_832(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_831, v ds
+# define BFI_FLINEARC_832_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_831(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_830, v ds
+# define BFI_FLINEARC_831_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_830(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_829, v ds
+# define BFI_FLINEARC_830_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_829(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_828, v ds
+# define BFI_FLINEARC_829_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_828(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_827, v ds
+# define BFI_FLINEARC_828_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_827(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_826, v ds
+# define BFI_FLINEARC_827_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_826(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_825, v ds
+# define BFI_FLINEARC_826_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_825(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_824, v ds
+# define BFI_FLINEARC_825_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_824(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_823, v ds
+# define BFI_FLINEARC_824_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_823(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_822, v ds
+# define BFI_FLINEARC_823_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_822(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_821, v ds
+# define BFI_FLINEARC_822_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_821(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_820, v ds
+# define BFI_FLINEARC_821_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_820(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_819, v ds
+# define BFI_FLINEARC_820_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_819(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_818, v ds
+# define BFI_FLINEARC_819_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_818(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_817, v ds
+# define BFI_FLINEARC_818_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_817(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_816, v ds
+# define BFI_FLINEARC_817_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_816(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_815, v ds
+# define BFI_FLINEARC_816_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_815(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_814, v ds
+# define BFI_FLINEARC_815_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_814(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_813, v ds
+# define BFI_FLINEARC_814_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_813(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_812, v ds
+# define BFI_FLINEARC_813_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_812(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_811, v ds
+# define BFI_FLINEARC_812_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_811(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_810, v ds
+# define BFI_FLINEARC_811_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_810(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_809, v ds
+# define BFI_FLINEARC_810_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_809(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_808, v ds
+# define BFI_FLINEARC_809_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_808(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_807, v ds
+# define BFI_FLINEARC_808_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_807(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_806, v ds
+# define BFI_FLINEARC_807_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_806(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_805, v ds
+# define BFI_FLINEARC_806_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_805(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_804, v ds
+# define BFI_FLINEARC_805_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_804(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_803, v ds
+# define BFI_FLINEARC_804_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_803(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_802, v ds
+# define BFI_FLINEARC_803_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_802(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_801, v ds
+# define BFI_FLINEARC_802_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_801(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_800, v ds
+# define BFI_FLINEARC_801_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_800(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_799, v ds
+# define BFI_FLINEARC_800_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_799(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_798, v ds
+# define BFI_FLINEARC_799_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_798(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_797, v ds
+# define BFI_FLINEARC_798_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_797(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_796, v ds
+# define BFI_FLINEARC_797_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_796(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_795, v ds
+# define BFI_FLINEARC_796_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_795(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_794, v ds
+# define BFI_FLINEARC_795_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_794(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_793, v ds
+# define BFI_FLINEARC_794_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_793(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_792, v ds
+# define BFI_FLINEARC_793_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_792(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_791, v ds
+# define BFI_FLINEARC_792_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_791(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_790, v ds
+# define BFI_FLINEARC_791_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_790(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_789, v ds
+# define BFI_FLINEARC_790_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_789(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_788, v ds
+# define BFI_FLINEARC_789_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_788(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_787, v ds
+# define BFI_FLINEARC_788_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_787(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_786, v ds
+# define BFI_FLINEARC_787_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_786(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_785, v ds
+# define BFI_FLINEARC_786_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_785(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_784, v ds
+# define BFI_FLINEARC_785_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_784(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_783, v ds
+# define BFI_FLINEARC_784_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_783(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_782, v ds
+# define BFI_FLINEARC_783_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_782(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_781, v ds
+# define BFI_FLINEARC_782_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_781(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_780, v ds
+# define BFI_FLINEARC_781_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_780(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_779, v ds
+# define BFI_FLINEARC_780_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_779(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_778, v ds
+# define BFI_FLINEARC_779_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_778(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_777, v ds
+# define BFI_FLINEARC_778_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_777(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_776, v ds
+# define BFI_FLINEARC_777_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_776(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_775, v ds
+# define BFI_FLINEARC_776_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_775(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_774, v ds
+# define BFI_FLINEARC_775_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_774(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_773, v ds
+# define BFI_FLINEARC_774_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_773(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_772, v ds
+# define BFI_FLINEARC_773_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_772(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_771, v ds
+# define BFI_FLINEARC_772_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_771(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_770, v ds
+# define BFI_FLINEARC_771_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_770(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_769, v ds
+# define BFI_FLINEARC_770_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_769(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_768, v ds
+# define BFI_FLINEARC_769_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_768(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_767, v ds
+# define BFI_FLINEARC_768_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_767(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_766, v ds
+# define BFI_FLINEARC_767_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_766(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_765, v ds
+# define BFI_FLINEARC_766_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_765(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_764, v ds
+# define BFI_FLINEARC_765_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_764(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_763, v ds
+# define BFI_FLINEARC_764_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_763(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_762, v ds
+# define BFI_FLINEARC_763_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_762(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_761, v ds
+# define BFI_FLINEARC_762_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_761(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_760, v ds
+# define BFI_FLINEARC_761_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_760(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_759, v ds
+# define BFI_FLINEARC_760_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_759(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_758, v ds
+# define BFI_FLINEARC_759_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_758(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_757, v ds
+# define BFI_FLINEARC_758_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_757(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_756, v ds
+# define BFI_FLINEARC_757_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_756(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_755, v ds
+# define BFI_FLINEARC_756_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_755(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_754, v ds
+# define BFI_FLINEARC_755_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_754(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_753, v ds
+# define BFI_FLINEARC_754_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_753(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_752, v ds
+# define BFI_FLINEARC_753_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_752(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_751, v ds
+# define BFI_FLINEARC_752_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_751(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_750, v ds
+# define BFI_FLINEARC_751_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_750(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_749, v ds
+# define BFI_FLINEARC_750_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_749(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_748, v ds
+# define BFI_FLINEARC_749_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_748(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_747, v ds
+# define BFI_FLINEARC_748_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_747(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_746, v ds
+# define BFI_FLINEARC_747_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_746(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_745, v ds
+# define BFI_FLINEARC_746_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_745(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_744, v ds
+# define BFI_FLINEARC_745_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_744(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_743, v ds
+# define BFI_FLINEARC_744_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_743(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_742, v ds
+# define BFI_FLINEARC_743_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_742(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_741, v ds
+# define BFI_FLINEARC_742_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_741(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_740, v ds
+# define BFI_FLINEARC_741_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_740(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_739, v ds
+# define BFI_FLINEARC_740_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_739(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_738, v ds
+# define BFI_FLINEARC_739_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_738(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_737, v ds
+# define BFI_FLINEARC_738_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_737(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_736, v ds
+# define BFI_FLINEARC_737_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_736(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_735, v ds
+# define BFI_FLINEARC_736_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_735(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_734, v ds
+# define BFI_FLINEARC_735_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_734(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_733, v ds
+# define BFI_FLINEARC_734_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_733(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_732, v ds
+# define BFI_FLINEARC_733_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_732(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_731, v ds
+# define BFI_FLINEARC_732_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_731(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_730, v ds
+# define BFI_FLINEARC_731_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_730(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_729, v ds
+# define BFI_FLINEARC_730_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_729(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_728, v ds
+# define BFI_FLINEARC_729_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_728(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_727, v ds
+# define BFI_FLINEARC_728_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_727(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_726, v ds
+# define BFI_FLINEARC_727_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_726(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_725, v ds
+# define BFI_FLINEARC_726_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_725(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_724, v ds
+# define BFI_FLINEARC_725_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_724(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_723, v ds
+# define BFI_FLINEARC_724_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_723(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_722, v ds
+# define BFI_FLINEARC_723_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_722(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_721, v ds
+# define BFI_FLINEARC_722_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_721(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_720, v ds
+# define BFI_FLINEARC_721_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_720(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_719, v ds
+# define BFI_FLINEARC_720_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_719(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_718, v ds
+# define BFI_FLINEARC_719_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_718(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_717, v ds
+# define BFI_FLINEARC_718_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_717(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_716, v ds
+# define BFI_FLINEARC_717_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_716(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_715, v ds
+# define BFI_FLINEARC_716_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_715(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_714, v ds
+# define BFI_FLINEARC_715_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_714(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_713, v ds
+# define BFI_FLINEARC_714_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_713(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_712, v ds
+# define BFI_FLINEARC_713_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_712(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_711, v ds
+# define BFI_FLINEARC_712_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_711(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_710, v ds
+# define BFI_FLINEARC_711_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_710(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_709, v ds
+# define BFI_FLINEARC_710_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_709(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_708, v ds
+# define BFI_FLINEARC_709_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_708(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_707, v ds
+# define BFI_FLINEARC_708_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_707(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_706, v ds
+# define BFI_FLINEARC_707_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_706(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_705, v ds
+# define BFI_FLINEARC_706_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_705(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_704, v ds
+# define BFI_FLINEARC_705_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_704(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_703, v ds
+# define BFI_FLINEARC_704_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_703(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_702, v ds
+# define BFI_FLINEARC_703_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_702(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_701, v ds
+# define BFI_FLINEARC_702_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_701(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_700, v ds
+# define BFI_FLINEARC_701_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_700(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_699, v ds
+# define BFI_FLINEARC_700_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_699(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_698, v ds
+# define BFI_FLINEARC_699_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_698(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_697, v ds
+# define BFI_FLINEARC_698_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_697(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_696, v ds
+# define BFI_FLINEARC_697_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_696(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_695, v ds
+# define BFI_FLINEARC_696_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_695(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_694, v ds
+# define BFI_FLINEARC_695_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_694(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_693, v ds
+# define BFI_FLINEARC_694_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_693(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_692, v ds
+# define BFI_FLINEARC_693_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_692(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_691, v ds
+# define BFI_FLINEARC_692_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_691(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_690, v ds
+# define BFI_FLINEARC_691_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_690(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_689, v ds
+# define BFI_FLINEARC_690_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_689(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_688, v ds
+# define BFI_FLINEARC_689_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_688(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_687, v ds
+# define BFI_FLINEARC_688_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_687(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_686, v ds
+# define BFI_FLINEARC_687_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_686(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_685, v ds
+# define BFI_FLINEARC_686_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_685(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_684, v ds
+# define BFI_FLINEARC_685_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_684(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_683, v ds
+# define BFI_FLINEARC_684_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_683(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_682, v ds
+# define BFI_FLINEARC_683_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_682(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_681, v ds
+# define BFI_FLINEARC_682_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_681(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_680, v ds
+# define BFI_FLINEARC_681_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_680(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_679, v ds
+# define BFI_FLINEARC_680_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_679(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_678, v ds
+# define BFI_FLINEARC_679_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_678(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_677, v ds
+# define BFI_FLINEARC_678_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_677(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_676, v ds
+# define BFI_FLINEARC_677_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_676(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_675, v ds
+# define BFI_FLINEARC_676_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_675(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_674, v ds
+# define BFI_FLINEARC_675_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_674(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_673, v ds
+# define BFI_FLINEARC_674_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_673(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_672, v ds
+# define BFI_FLINEARC_673_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_672(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_671, v ds
+# define BFI_FLINEARC_672_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_671(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_670, v ds
+# define BFI_FLINEARC_671_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_670(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_669, v ds
+# define BFI_FLINEARC_670_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_669(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_668, v ds
+# define BFI_FLINEARC_669_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_668(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_667, v ds
+# define BFI_FLINEARC_668_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_667(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_666, v ds
+# define BFI_FLINEARC_667_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_666(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_665, v ds
+# define BFI_FLINEARC_666_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_665(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_664, v ds
+# define BFI_FLINEARC_665_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_664(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_663, v ds
+# define BFI_FLINEARC_664_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_663(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_662, v ds
+# define BFI_FLINEARC_663_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_662(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_661, v ds
+# define BFI_FLINEARC_662_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_661(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_660, v ds
+# define BFI_FLINEARC_661_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_660(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_659, v ds
+# define BFI_FLINEARC_660_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_659(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_658, v ds
+# define BFI_FLINEARC_659_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_658(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_657, v ds
+# define BFI_FLINEARC_658_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_657(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_656, v ds
+# define BFI_FLINEARC_657_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_656(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_655, v ds
+# define BFI_FLINEARC_656_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_655(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_654, v ds
+# define BFI_FLINEARC_655_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_654(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_653, v ds
+# define BFI_FLINEARC_654_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_653(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_652, v ds
+# define BFI_FLINEARC_653_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_652(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_651, v ds
+# define BFI_FLINEARC_652_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_651(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_650, v ds
+# define BFI_FLINEARC_651_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_650(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_649, v ds
+# define BFI_FLINEARC_650_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_649(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_648, v ds
+# define BFI_FLINEARC_649_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_648(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_647, v ds
+# define BFI_FLINEARC_648_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_647(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_646, v ds
+# define BFI_FLINEARC_647_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_646(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_645, v ds
+# define BFI_FLINEARC_646_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_645(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_644, v ds
+# define BFI_FLINEARC_645_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_644(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_643, v ds
+# define BFI_FLINEARC_644_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_643(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_642, v ds
+# define BFI_FLINEARC_643_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_642(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_641, v ds
+# define BFI_FLINEARC_642_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_641(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_640, v ds
+# define BFI_FLINEARC_641_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_640(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_639, v ds
+# define BFI_FLINEARC_640_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_639(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_638, v ds
+# define BFI_FLINEARC_639_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_638(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_637, v ds
+# define BFI_FLINEARC_638_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_637(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_636, v ds
+# define BFI_FLINEARC_637_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_636(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_635, v ds
+# define BFI_FLINEARC_636_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_635(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_634, v ds
+# define BFI_FLINEARC_635_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_634(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_633, v ds
+# define BFI_FLINEARC_634_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_633(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_632, v ds
+# define BFI_FLINEARC_633_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_632(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_631, v ds
+# define BFI_FLINEARC_632_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_631(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_630, v ds
+# define BFI_FLINEARC_631_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_630(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_629, v ds
+# define BFI_FLINEARC_630_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_629(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_628, v ds
+# define BFI_FLINEARC_629_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_628(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_627, v ds
+# define BFI_FLINEARC_628_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_627(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_626, v ds
+# define BFI_FLINEARC_627_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_626(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_625, v ds
+# define BFI_FLINEARC_626_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_625(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_624, v ds
+# define BFI_FLINEARC_625_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_624(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_623, v ds
+# define BFI_FLINEARC_624_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_623(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_622, v ds
+# define BFI_FLINEARC_623_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_622(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_621, v ds
+# define BFI_FLINEARC_622_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_621(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_620, v ds
+# define BFI_FLINEARC_621_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_620(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_619, v ds
+# define BFI_FLINEARC_620_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_619(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_618, v ds
+# define BFI_FLINEARC_619_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_618(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_617, v ds
+# define BFI_FLINEARC_618_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_617(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_616, v ds
+# define BFI_FLINEARC_617_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_616(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_615, v ds
+# define BFI_FLINEARC_616_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_615(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_614, v ds
+# define BFI_FLINEARC_615_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_614(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_613, v ds
+# define BFI_FLINEARC_614_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_613(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_612, v ds
+# define BFI_FLINEARC_613_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_612(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_611, v ds
+# define BFI_FLINEARC_612_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_611(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_610, v ds
+# define BFI_FLINEARC_611_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_610(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_609, v ds
+# define BFI_FLINEARC_610_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_609(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_608, v ds
+# define BFI_FLINEARC_609_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_608(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_607, v ds
+# define BFI_FLINEARC_608_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_607(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_606, v ds
+# define BFI_FLINEARC_607_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_606(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_605, v ds
+# define BFI_FLINEARC_606_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_605(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_604, v ds
+# define BFI_FLINEARC_605_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_604(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_603, v ds
+# define BFI_FLINEARC_604_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_603(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_602, v ds
+# define BFI_FLINEARC_603_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_602(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_601, v ds
+# define BFI_FLINEARC_602_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_601(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_600, v ds
+# define BFI_FLINEARC_601_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_600(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_599, v ds
+# define BFI_FLINEARC_600_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_599(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_598, v ds
+# define BFI_FLINEARC_599_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_598(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_597, v ds
+# define BFI_FLINEARC_598_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_597(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_596, v ds
+# define BFI_FLINEARC_597_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_596(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_595, v ds
+# define BFI_FLINEARC_596_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_595(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_594, v ds
+# define BFI_FLINEARC_595_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_594(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_593, v ds
+# define BFI_FLINEARC_594_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_593(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_592, v ds
+# define BFI_FLINEARC_593_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_592(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_591, v ds
+# define BFI_FLINEARC_592_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_591(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_590, v ds
+# define BFI_FLINEARC_591_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_590(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_589, v ds
+# define BFI_FLINEARC_590_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_589(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_588, v ds
+# define BFI_FLINEARC_589_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_588(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_587, v ds
+# define BFI_FLINEARC_588_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_587(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_586, v ds
+# define BFI_FLINEARC_587_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_586(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_585, v ds
+# define BFI_FLINEARC_586_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_585(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_584, v ds
+# define BFI_FLINEARC_585_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_584(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_583, v ds
+# define BFI_FLINEARC_584_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_583(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_582, v ds
+# define BFI_FLINEARC_583_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_582(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_581, v ds
+# define BFI_FLINEARC_582_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_581(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_580, v ds
+# define BFI_FLINEARC_581_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_580(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_579, v ds
+# define BFI_FLINEARC_580_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_579(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_578, v ds
+# define BFI_FLINEARC_579_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_578(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_577, v ds
+# define BFI_FLINEARC_578_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_577(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_576, v ds
+# define BFI_FLINEARC_577_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_576(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_575, v ds
+# define BFI_FLINEARC_576_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_575(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_574, v ds
+# define BFI_FLINEARC_575_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_574(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_573, v ds
+# define BFI_FLINEARC_574_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_573(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_572, v ds
+# define BFI_FLINEARC_573_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_572(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_571, v ds
+# define BFI_FLINEARC_572_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_571(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_570, v ds
+# define BFI_FLINEARC_571_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_570(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_569, v ds
+# define BFI_FLINEARC_570_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_569(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_568, v ds
+# define BFI_FLINEARC_569_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_568(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_567, v ds
+# define BFI_FLINEARC_568_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_567(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_566, v ds
+# define BFI_FLINEARC_567_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_566(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_565, v ds
+# define BFI_FLINEARC_566_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_565(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_564, v ds
+# define BFI_FLINEARC_565_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_564(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_563, v ds
+# define BFI_FLINEARC_564_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_563(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_562, v ds
+# define BFI_FLINEARC_563_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_562(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_561, v ds
+# define BFI_FLINEARC_562_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_561(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_560, v ds
+# define BFI_FLINEARC_561_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_560(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_559, v ds
+# define BFI_FLINEARC_560_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_559(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_558, v ds
+# define BFI_FLINEARC_559_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_558(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_557, v ds
+# define BFI_FLINEARC_558_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_557(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_556, v ds
+# define BFI_FLINEARC_557_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_556(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_555, v ds
+# define BFI_FLINEARC_556_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_555(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_554, v ds
+# define BFI_FLINEARC_555_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_554(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_553, v ds
+# define BFI_FLINEARC_554_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_553(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_552, v ds
+# define BFI_FLINEARC_553_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_552(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_551, v ds
+# define BFI_FLINEARC_552_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_551(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_550, v ds
+# define BFI_FLINEARC_551_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_550(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_549, v ds
+# define BFI_FLINEARC_550_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_549(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_548, v ds
+# define BFI_FLINEARC_549_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_548(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_547, v ds
+# define BFI_FLINEARC_548_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_547(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_546, v ds
+# define BFI_FLINEARC_547_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_546(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_545, v ds
+# define BFI_FLINEARC_546_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_545(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_544, v ds
+# define BFI_FLINEARC_545_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_544(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_543, v ds
+# define BFI_FLINEARC_544_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_543(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_542, v ds
+# define BFI_FLINEARC_543_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_542(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_541, v ds
+# define BFI_FLINEARC_542_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_541(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_540, v ds
+# define BFI_FLINEARC_541_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_540(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_539, v ds
+# define BFI_FLINEARC_540_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_539(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_538, v ds
+# define BFI_FLINEARC_539_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_538(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_537, v ds
+# define BFI_FLINEARC_538_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_537(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_536, v ds
+# define BFI_FLINEARC_537_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_536(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_535, v ds
+# define BFI_FLINEARC_536_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_535(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_534, v ds
+# define BFI_FLINEARC_535_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_534(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_533, v ds
+# define BFI_FLINEARC_534_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_533(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_532, v ds
+# define BFI_FLINEARC_533_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_532(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_531, v ds
+# define BFI_FLINEARC_532_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_531(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_530, v ds
+# define BFI_FLINEARC_531_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_530(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_529, v ds
+# define BFI_FLINEARC_530_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_529(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_528, v ds
+# define BFI_FLINEARC_529_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_528(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_527, v ds
+# define BFI_FLINEARC_528_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_527(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_526, v ds
+# define BFI_FLINEARC_527_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_526(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_525, v ds
+# define BFI_FLINEARC_526_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_525(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_524, v ds
+# define BFI_FLINEARC_525_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_524(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_523, v ds
+# define BFI_FLINEARC_524_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_523(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_522, v ds
+# define BFI_FLINEARC_523_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_522(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_521, v ds
+# define BFI_FLINEARC_522_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_521(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_520, v ds
+# define BFI_FLINEARC_521_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_520(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_519, v ds
+# define BFI_FLINEARC_520_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_519(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_518, v ds
+# define BFI_FLINEARC_519_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_518(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_517, v ds
+# define BFI_FLINEARC_518_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_517(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_516, v ds
+# define BFI_FLINEARC_517_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_516(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_515, v ds
+# define BFI_FLINEARC_516_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_515(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_514, v ds
+# define BFI_FLINEARC_515_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_514(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_513, v ds
+# define BFI_FLINEARC_514_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_513(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_512, v ds
+# define BFI_FLINEARC_513_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_512(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_511, v ds
+# define BFI_FLINEARC_512_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_511(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_510, v ds
+# define BFI_FLINEARC_511_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_510(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_509, v ds
+# define BFI_FLINEARC_510_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_509(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_508, v ds
+# define BFI_FLINEARC_509_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_508(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_507, v ds
+# define BFI_FLINEARC_508_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_507(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_506, v ds
+# define BFI_FLINEARC_507_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_506(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_505, v ds
+# define BFI_FLINEARC_506_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_505(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_504, v ds
+# define BFI_FLINEARC_505_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_504(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_503, v ds
+# define BFI_FLINEARC_504_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_503(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_502, v ds
+# define BFI_FLINEARC_503_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_502(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_501, v ds
+# define BFI_FLINEARC_502_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_501(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_500, v ds
+# define BFI_FLINEARC_501_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_500(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_499, v ds
+# define BFI_FLINEARC_500_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_499(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_498, v ds
+# define BFI_FLINEARC_499_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_498(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_497, v ds
+# define BFI_FLINEARC_498_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_497(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_496, v ds
+# define BFI_FLINEARC_497_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_496(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_495, v ds
+# define BFI_FLINEARC_496_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_495(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_494, v ds
+# define BFI_FLINEARC_495_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_494(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_493, v ds
+# define BFI_FLINEARC_494_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_493(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_492, v ds
+# define BFI_FLINEARC_493_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_492(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_491, v ds
+# define BFI_FLINEARC_492_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_491(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_490, v ds
+# define BFI_FLINEARC_491_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_490(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_489, v ds
+# define BFI_FLINEARC_490_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_489(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_488, v ds
+# define BFI_FLINEARC_489_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_488(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_487, v ds
+# define BFI_FLINEARC_488_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_487(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_486, v ds
+# define BFI_FLINEARC_487_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_486(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_485, v ds
+# define BFI_FLINEARC_486_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_485(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_484, v ds
+# define BFI_FLINEARC_485_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_484(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_483, v ds
+# define BFI_FLINEARC_484_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_483(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_482, v ds
+# define BFI_FLINEARC_483_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_482(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_481, v ds
+# define BFI_FLINEARC_482_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_481(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_480, v ds
+# define BFI_FLINEARC_481_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_480(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_479, v ds
+# define BFI_FLINEARC_480_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_479(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_478, v ds
+# define BFI_FLINEARC_479_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_478(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_477, v ds
+# define BFI_FLINEARC_478_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_477(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_476, v ds
+# define BFI_FLINEARC_477_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_476(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_475, v ds
+# define BFI_FLINEARC_476_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_475(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_474, v ds
+# define BFI_FLINEARC_475_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_474(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_473, v ds
+# define BFI_FLINEARC_474_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_473(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_472, v ds
+# define BFI_FLINEARC_473_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_472(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_471, v ds
+# define BFI_FLINEARC_472_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_471(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_470, v ds
+# define BFI_FLINEARC_471_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_470(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_469, v ds
+# define BFI_FLINEARC_470_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_469(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_468, v ds
+# define BFI_FLINEARC_469_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_468(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_467, v ds
+# define BFI_FLINEARC_468_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_467(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_466, v ds
+# define BFI_FLINEARC_467_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_466(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_465, v ds
+# define BFI_FLINEARC_466_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_465(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_464, v ds
+# define BFI_FLINEARC_465_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_464(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_463, v ds
+# define BFI_FLINEARC_464_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_463(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_462, v ds
+# define BFI_FLINEARC_463_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_462(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_461, v ds
+# define BFI_FLINEARC_462_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_461(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_460, v ds
+# define BFI_FLINEARC_461_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_460(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_459, v ds
+# define BFI_FLINEARC_460_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_459(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_458, v ds
+# define BFI_FLINEARC_459_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_458(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_457, v ds
+# define BFI_FLINEARC_458_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_457(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_456, v ds
+# define BFI_FLINEARC_457_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_456(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_455, v ds
+# define BFI_FLINEARC_456_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_455(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_454, v ds
+# define BFI_FLINEARC_455_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_454(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_453, v ds
+# define BFI_FLINEARC_454_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_453(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_452, v ds
+# define BFI_FLINEARC_453_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_452(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_451, v ds
+# define BFI_FLINEARC_452_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_451(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_450, v ds
+# define BFI_FLINEARC_451_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_450(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_449, v ds
+# define BFI_FLINEARC_450_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_449(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_448, v ds
+# define BFI_FLINEARC_449_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_448(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_447, v ds
+# define BFI_FLINEARC_448_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_447(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_446, v ds
+# define BFI_FLINEARC_447_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_446(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_445, v ds
+# define BFI_FLINEARC_446_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_445(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_444, v ds
+# define BFI_FLINEARC_445_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_444(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_443, v ds
+# define BFI_FLINEARC_444_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_443(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_442, v ds
+# define BFI_FLINEARC_443_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_442(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_441, v ds
+# define BFI_FLINEARC_442_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_441(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_440, v ds
+# define BFI_FLINEARC_441_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_440(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_439, v ds
+# define BFI_FLINEARC_440_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_439(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_438, v ds
+# define BFI_FLINEARC_439_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_438(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_437, v ds
+# define BFI_FLINEARC_438_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_437(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_436, v ds
+# define BFI_FLINEARC_437_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_436(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_435, v ds
+# define BFI_FLINEARC_436_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_435(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_434, v ds
+# define BFI_FLINEARC_435_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_434(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_433, v ds
+# define BFI_FLINEARC_434_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_433(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_432, v ds
+# define BFI_FLINEARC_433_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_432(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_431, v ds
+# define BFI_FLINEARC_432_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_431(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_430, v ds
+# define BFI_FLINEARC_431_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_430(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_429, v ds
+# define BFI_FLINEARC_430_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_429(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_428, v ds
+# define BFI_FLINEARC_429_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_428(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_427, v ds
+# define BFI_FLINEARC_428_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_427(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_426, v ds
+# define BFI_FLINEARC_427_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_426(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_425, v ds
+# define BFI_FLINEARC_426_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_425(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_424, v ds
+# define BFI_FLINEARC_425_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_424(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_423, v ds
+# define BFI_FLINEARC_424_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_423(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_422, v ds
+# define BFI_FLINEARC_423_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_422(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_421, v ds
+# define BFI_FLINEARC_422_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_421(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_420, v ds
+# define BFI_FLINEARC_421_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_420(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_419, v ds
+# define BFI_FLINEARC_420_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_419(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_418, v ds
+# define BFI_FLINEARC_419_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_418(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_417, v ds
+# define BFI_FLINEARC_418_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_417(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_416, v ds
+# define BFI_FLINEARC_417_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_416(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_415, v ds
+# define BFI_FLINEARC_416_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_415(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_414, v ds
+# define BFI_FLINEARC_415_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_414(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_413, v ds
+# define BFI_FLINEARC_414_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_413(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_412, v ds
+# define BFI_FLINEARC_413_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_412(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_411, v ds
+# define BFI_FLINEARC_412_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_411(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_410, v ds
+# define BFI_FLINEARC_411_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_410(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_409, v ds
+# define BFI_FLINEARC_410_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_409(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_408, v ds
+# define BFI_FLINEARC_409_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_408(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_407, v ds
+# define BFI_FLINEARC_408_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_407(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_406, v ds
+# define BFI_FLINEARC_407_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_406(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_405, v ds
+# define BFI_FLINEARC_406_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_405(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_404, v ds
+# define BFI_FLINEARC_405_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_404(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_403, v ds
+# define BFI_FLINEARC_404_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_403(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_402, v ds
+# define BFI_FLINEARC_403_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_402(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_401, v ds
+# define BFI_FLINEARC_402_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_401(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_400, v ds
+# define BFI_FLINEARC_401_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_400(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_399, v ds
+# define BFI_FLINEARC_400_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_399(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_398, v ds
+# define BFI_FLINEARC_399_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_398(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_397, v ds
+# define BFI_FLINEARC_398_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_397(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_396, v ds
+# define BFI_FLINEARC_397_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_396(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_395, v ds
+# define BFI_FLINEARC_396_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_395(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_394, v ds
+# define BFI_FLINEARC_395_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_394(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_393, v ds
+# define BFI_FLINEARC_394_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_393(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_392, v ds
+# define BFI_FLINEARC_393_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_392(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_391, v ds
+# define BFI_FLINEARC_392_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_391(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_390, v ds
+# define BFI_FLINEARC_391_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_390(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_389, v ds
+# define BFI_FLINEARC_390_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_389(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_388, v ds
+# define BFI_FLINEARC_389_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_388(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_387, v ds
+# define BFI_FLINEARC_388_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_387(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_386, v ds
+# define BFI_FLINEARC_387_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_386(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_385, v ds
+# define BFI_FLINEARC_386_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_385(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_384, v ds
+# define BFI_FLINEARC_385_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_384(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_383, v ds
+# define BFI_FLINEARC_384_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_383(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_382, v ds
+# define BFI_FLINEARC_383_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_382(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_381, v ds
+# define BFI_FLINEARC_382_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_381(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_380, v ds
+# define BFI_FLINEARC_381_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_380(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_379, v ds
+# define BFI_FLINEARC_380_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_379(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_378, v ds
+# define BFI_FLINEARC_379_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_378(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_377, v ds
+# define BFI_FLINEARC_378_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_377(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_376, v ds
+# define BFI_FLINEARC_377_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_376(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_375, v ds
+# define BFI_FLINEARC_376_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_375(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_374, v ds
+# define BFI_FLINEARC_375_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_374(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_373, v ds
+# define BFI_FLINEARC_374_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_373(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_372, v ds
+# define BFI_FLINEARC_373_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_372(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_371, v ds
+# define BFI_FLINEARC_372_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_371(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_370, v ds
+# define BFI_FLINEARC_371_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_370(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_369, v ds
+# define BFI_FLINEARC_370_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_369(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_368, v ds
+# define BFI_FLINEARC_369_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_368(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_367, v ds
+# define BFI_FLINEARC_368_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_367(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_366, v ds
+# define BFI_FLINEARC_367_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_366(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_365, v ds
+# define BFI_FLINEARC_366_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_365(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_364, v ds
+# define BFI_FLINEARC_365_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_364(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_363, v ds
+# define BFI_FLINEARC_364_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_363(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_362, v ds
+# define BFI_FLINEARC_363_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_362(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_361, v ds
+# define BFI_FLINEARC_362_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_361(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_360, v ds
+# define BFI_FLINEARC_361_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_360(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_359, v ds
+# define BFI_FLINEARC_360_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_359(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_358, v ds
+# define BFI_FLINEARC_359_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_358(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_357, v ds
+# define BFI_FLINEARC_358_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_357(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_356, v ds
+# define BFI_FLINEARC_357_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_356(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_355, v ds
+# define BFI_FLINEARC_356_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_355(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_354, v ds
+# define BFI_FLINEARC_355_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_354(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_353, v ds
+# define BFI_FLINEARC_354_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_353(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_352, v ds
+# define BFI_FLINEARC_353_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_352(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_351, v ds
+# define BFI_FLINEARC_352_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_351(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_350, v ds
+# define BFI_FLINEARC_351_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_350(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_349, v ds
+# define BFI_FLINEARC_350_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_349(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_348, v ds
+# define BFI_FLINEARC_349_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_348(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_347, v ds
+# define BFI_FLINEARC_348_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_347(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_346, v ds
+# define BFI_FLINEARC_347_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_346(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_345, v ds
+# define BFI_FLINEARC_346_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_345(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_344, v ds
+# define BFI_FLINEARC_345_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_344(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_343, v ds
+# define BFI_FLINEARC_344_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_343(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_342, v ds
+# define BFI_FLINEARC_343_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_342(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_341, v ds
+# define BFI_FLINEARC_342_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_341(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_340, v ds
+# define BFI_FLINEARC_341_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_340(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_339, v ds
+# define BFI_FLINEARC_340_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_339(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_338, v ds
+# define BFI_FLINEARC_339_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_338(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_337, v ds
+# define BFI_FLINEARC_338_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_337(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_336, v ds
+# define BFI_FLINEARC_337_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_336(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_335, v ds
+# define BFI_FLINEARC_336_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_335(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_334, v ds
+# define BFI_FLINEARC_335_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_334(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_333, v ds
+# define BFI_FLINEARC_334_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_333(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_332, v ds
+# define BFI_FLINEARC_333_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_332(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_331, v ds
+# define BFI_FLINEARC_332_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_331(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_330, v ds
+# define BFI_FLINEARC_331_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_330(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_329, v ds
+# define BFI_FLINEARC_330_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_329(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_328, v ds
+# define BFI_FLINEARC_329_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_328(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_327, v ds
+# define BFI_FLINEARC_328_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_327(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_326, v ds
+# define BFI_FLINEARC_327_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_326(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_325, v ds
+# define BFI_FLINEARC_326_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_325(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_324, v ds
+# define BFI_FLINEARC_325_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_324(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_323, v ds
+# define BFI_FLINEARC_324_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_323(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_322, v ds
+# define BFI_FLINEARC_323_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_322(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_321, v ds
+# define BFI_FLINEARC_322_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_321(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_320, v ds
+# define BFI_FLINEARC_321_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_320(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_319, v ds
+# define BFI_FLINEARC_320_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_319(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_318, v ds
+# define BFI_FLINEARC_319_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_318(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_317, v ds
+# define BFI_FLINEARC_318_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_317(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_316, v ds
+# define BFI_FLINEARC_317_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_316(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_315, v ds
+# define BFI_FLINEARC_316_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_315(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_314, v ds
+# define BFI_FLINEARC_315_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_314(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_313, v ds
+# define BFI_FLINEARC_314_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_313(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_312, v ds
+# define BFI_FLINEARC_313_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_312(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_311, v ds
+# define BFI_FLINEARC_312_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_311(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_310, v ds
+# define BFI_FLINEARC_311_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_310(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_309, v ds
+# define BFI_FLINEARC_310_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_309(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_308, v ds
+# define BFI_FLINEARC_309_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_308(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_307, v ds
+# define BFI_FLINEARC_308_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_307(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_306, v ds
+# define BFI_FLINEARC_307_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_306(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_305, v ds
+# define BFI_FLINEARC_306_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_305(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_304, v ds
+# define BFI_FLINEARC_305_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_304(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_303, v ds
+# define BFI_FLINEARC_304_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_303(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_302, v ds
+# define BFI_FLINEARC_303_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_302(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_301, v ds
+# define BFI_FLINEARC_302_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_301(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_300, v ds
+# define BFI_FLINEARC_301_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_300(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_299, v ds
+# define BFI_FLINEARC_300_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_299(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_298, v ds
+# define BFI_FLINEARC_299_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_298(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_297, v ds
+# define BFI_FLINEARC_298_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_297(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_296, v ds
+# define BFI_FLINEARC_297_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_296(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_295, v ds
+# define BFI_FLINEARC_296_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_295(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_294, v ds
+# define BFI_FLINEARC_295_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_294(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_293, v ds
+# define BFI_FLINEARC_294_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_293(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_292, v ds
+# define BFI_FLINEARC_293_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_292(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_291, v ds
+# define BFI_FLINEARC_292_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_291(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_290, v ds
+# define BFI_FLINEARC_291_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_290(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_289, v ds
+# define BFI_FLINEARC_290_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_289(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_288, v ds
+# define BFI_FLINEARC_289_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_288(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_287, v ds
+# define BFI_FLINEARC_288_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_287(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_286, v ds
+# define BFI_FLINEARC_287_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_286(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_285, v ds
+# define BFI_FLINEARC_286_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_285(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_284, v ds
+# define BFI_FLINEARC_285_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_284(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_283, v ds
+# define BFI_FLINEARC_284_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_283(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_282, v ds
+# define BFI_FLINEARC_283_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_282(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_281, v ds
+# define BFI_FLINEARC_282_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_281(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_280, v ds
+# define BFI_FLINEARC_281_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_280(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_279, v ds
+# define BFI_FLINEARC_280_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_279(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_278, v ds
+# define BFI_FLINEARC_279_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_278(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_277, v ds
+# define BFI_FLINEARC_278_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_277(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_276, v ds
+# define BFI_FLINEARC_277_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_276(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_275, v ds
+# define BFI_FLINEARC_276_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_275(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_274, v ds
+# define BFI_FLINEARC_275_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_274(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_273, v ds
+# define BFI_FLINEARC_274_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_273(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_272, v ds
+# define BFI_FLINEARC_273_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_272(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_271, v ds
+# define BFI_FLINEARC_272_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_271(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_270, v ds
+# define BFI_FLINEARC_271_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_270(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_269, v ds
+# define BFI_FLINEARC_270_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_269(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_268, v ds
+# define BFI_FLINEARC_269_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_268(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_267, v ds
+# define BFI_FLINEARC_268_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_267(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_266, v ds
+# define BFI_FLINEARC_267_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_266(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_265, v ds
+# define BFI_FLINEARC_266_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_265(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_264, v ds
+# define BFI_FLINEARC_265_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_264(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_263, v ds
+# define BFI_FLINEARC_264_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_263(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_262, v ds
+# define BFI_FLINEARC_263_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_262(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_261, v ds
+# define BFI_FLINEARC_262_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_261(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_260, v ds
+# define BFI_FLINEARC_261_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_260(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_259, v ds
+# define BFI_FLINEARC_260_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_259(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_258, v ds
+# define BFI_FLINEARC_259_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_258(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_257, v ds
+# define BFI_FLINEARC_258_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_257(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_256, v ds
+# define BFI_FLINEARC_257_TICK(t) (0fast(0i##t))
+
+# endif
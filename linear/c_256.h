@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_C_256_H
+# define BFI_LINEAR_C_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARC_256(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_255, v ds
+# define BFI_FLINEARC_256_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_255(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_254, v ds
+# define BFI_FLINEARC_255_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_254(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_253, v ds
+# define BFI_FLINEARC_254_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_253(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_252, v ds
+# define BFI_FLINEARC_253_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_252(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_251, v ds
+# define BFI_FLINEARC_252_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_251(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_250, v ds
+# define BFI_FLINEARC_251_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_250(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_249, v ds
+# define BFI_FLINEARC_250_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_249(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_248, v ds
+# define BFI_FLINEARC_249_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_248(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_247, v ds
+# define BFI_FLINEARC_248_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_247(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_246, v ds
+# define BFI_FLINEARC_247_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_246(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_245, v ds
+# define BFI_FLINEARC_246_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_245(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_244, v ds
+# define BFI_FLINEARC_245_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_244(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_243, v ds
+# define BFI_FLINEARC_244_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_243(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_242, v ds
+# define BFI_FLINEARC_243_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_242(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_241, v ds
+# define BFI_FLINEARC_242_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_241(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_240, v ds
+# define BFI_FLINEARC_241_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_240(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_239, v ds
+# define BFI_FLINEARC_240_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_239(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_238, v ds
+# define BFI_FLINEARC_239_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_238(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_237, v ds
+# define BFI_FLINEARC_238_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_237(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_236, v ds
+# define BFI_FLINEARC_237_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_236(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_235, v ds
+# define BFI_FLINEARC_236_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_235(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_234, v ds
+# define BFI_FLINEARC_235_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_234(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_233, v ds
+# define BFI_FLINEARC_234_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_233(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_232, v ds
+# define BFI_FLINEARC_233_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_232(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_231, v ds
+# define BFI_FLINEARC_232_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_231(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_230, v ds
+# define BFI_FLINEARC_231_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_230(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_229, v ds
+# define BFI_FLINEARC_230_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_229(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_228, v ds
+# define BFI_FLINEARC_229_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_228(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_227, v ds
+# define BFI_FLINEARC_228_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_227(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_226, v ds
+# define BFI_FLINEARC_227_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_226(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_225, v ds
+# define BFI_FLINEARC_226_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_225(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_224, v ds
+# define BFI_FLINEARC_225_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_224(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_223, v ds
+# define BFI_FLINEARC_224_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_223(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_222, v ds
+# define BFI_FLINEARC_223_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_222(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_221, v ds
+# define BFI_FLINEARC_222_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_221(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_220, v ds
+# define BFI_FLINEARC_221_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_220(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_219, v ds
+# define BFI_FLINEARC_220_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_219(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_218, v ds
+# define BFI_FLINEARC_219_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_218(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_217, v ds
+# define BFI_FLINEARC_218_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_217(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_216, v ds
+# define BFI_FLINEARC_217_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_216(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_215, v ds
+# define BFI_FLINEARC_216_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_215(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_214, v ds
+# define BFI_FLINEARC_215_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_214(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_213, v ds
+# define BFI_FLINEARC_214_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_213(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_212, v ds
+# define BFI_FLINEARC_213_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_212(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_211, v ds
+# define BFI_FLINEARC_212_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_211(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_210, v ds
+# define BFI_FLINEARC_211_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_210(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_209, v ds
+# define BFI_FLINEARC_210_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_209(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_208, v ds
+# define BFI_FLINEARC_209_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_208(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_207, v ds
+# define BFI_FLINEARC_208_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_207(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_206, v ds
+# define BFI_FLINEARC_207_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_206(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_205, v ds
+# define BFI_FLINEARC_206_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_205(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_204, v ds
+# define BFI_FLINEARC_205_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_204(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_203, v ds
+# define BFI_FLINEARC_204_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_203(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_202, v ds
+# define BFI_FLINEARC_203_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_202(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_201, v ds
+# define BFI_FLINEARC_202_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_201(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_200, v ds
+# define BFI_FLINEARC_201_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_200(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_199, v ds
+# define BFI_FLINEARC_200_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_199(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_198, v ds
+# define BFI_FLINEARC_199_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_198(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_197, v ds
+# define BFI_FLINEARC_198_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_197(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_196, v ds
+# define BFI_FLINEARC_197_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_196(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_195, v ds
+# define BFI_FLINEARC_196_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_195(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_194, v ds
+# define BFI_FLINEARC_195_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_194(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_193, v ds
+# define BFI_FLINEARC_194_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_193(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_192, v ds
+# define BFI_FLINEARC_193_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_192(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_191, v ds
+# define BFI_FLINEARC_192_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_191(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_190, v ds
+# define BFI_FLINEARC_191_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_190(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_189, v ds
+# define BFI_FLINEARC_190_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_189(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_188, v ds
+# define BFI_FLINEARC_189_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_188(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_187, v ds
+# define BFI_FLINEARC_188_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_187(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_186, v ds
+# define BFI_FLINEARC_187_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_186(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_185, v ds
+# define BFI_FLINEARC_186_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_185(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_184, v ds
+# define BFI_FLINEARC_185_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_184(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_183, v ds
+# define BFI_FLINEARC_184_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_183(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_182, v ds
+# define BFI_FLINEARC_183_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_182(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_181, v ds
+# define BFI_FLINEARC_182_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_181(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_180, v ds
+# define BFI_FLINEARC_181_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_180(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_179, v ds
+# define BFI_FLINEARC_180_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_179(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_178, v ds
+# define BFI_FLINEARC_179_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_178(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_177, v ds
+# define BFI_FLINEARC_178_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_177(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_176, v ds
+# define BFI_FLINEARC_177_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_176(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_175, v ds
+# define BFI_FLINEARC_176_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_175(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_174, v ds
+# define BFI_FLINEARC_175_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_174(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_173, v ds
+# define BFI_FLINEARC_174_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_173(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_172, v ds
+# define BFI_FLINEARC_173_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_172(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_171, v ds
+# define BFI_FLINEARC_172_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_171(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_170, v ds
+# define BFI_FLINEARC_171_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_170(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_169, v ds
+# define BFI_FLINEARC_170_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_169(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_168, v ds
+# define BFI_FLINEARC_169_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_168(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_167, v ds
+# define BFI_FLINEARC_168_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_167(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_166, v ds
+# define BFI_FLINEARC_167_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_166(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_165, v ds
+# define BFI_FLINEARC_166_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_165(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_164, v ds
+# define BFI_FLINEARC_165_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_164(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_163, v ds
+# define BFI_FLINEARC_164_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_163(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_162, v ds
+# define BFI_FLINEARC_163_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_162(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_161, v ds
+# define BFI_FLINEARC_162_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_161(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_160, v ds
+# define BFI_FLINEARC_161_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_160(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_159, v ds
+# define BFI_FLINEARC_160_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_159(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_158, v ds
+# define BFI_FLINEARC_159_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_158(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_157, v ds
+# define BFI_FLINEARC_158_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_157(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_156, v ds
+# define BFI_FLINEARC_157_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_156(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_155, v ds
+# define BFI_FLINEARC_156_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_155(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_154, v ds
+# define BFI_FLINEARC_155_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_154(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_153, v ds
+# define BFI_FLINEARC_154_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_153(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_152, v ds
+# define BFI_FLINEARC_153_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_152(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_151, v ds
+# define BFI_FLINEARC_152_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_151(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_150, v ds
+# define BFI_FLINEARC_151_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_150(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_149, v ds
+# define BFI_FLINEARC_150_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_149(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_148, v ds
+# define BFI_FLINEARC_149_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_148(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_147, v ds
+# define BFI_FLINEARC_148_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_147(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_146, v ds
+# define BFI_FLINEARC_147_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_146(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_145, v ds
+# define BFI_FLINEARC_146_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_145(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_144, v ds
+# define BFI_FLINEARC_145_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_144(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_143, v ds
+# define BFI_FLINEARC_144_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_143(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_142, v ds
+# define BFI_FLINEARC_143_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_142(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_141, v ds
+# define BFI_FLINEARC_142_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_141(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_140, v ds
+# define BFI_FLINEARC_141_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_140(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_139, v ds
+# define BFI_FLINEARC_140_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_139(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_138, v ds
+# define BFI_FLINEARC_139_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_138(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_137, v ds
+# define BFI_FLINEARC_138_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_137(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_136, v ds
+# define BFI_FLINEARC_137_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_136(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_135, v ds
+# define BFI_FLINEARC_136_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_135(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_134, v ds
+# define BFI_FLINEARC_135_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_134(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_133, v ds
+# define BFI_FLINEARC_134_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_133(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_132, v ds
+# define BFI_FLINEARC_133_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_132(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_131, v ds
+# define BFI_FLINEARC_132_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_131(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_130, v ds
+# define BFI_FLINEARC_131_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_130(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_129, v ds
+# define BFI_FLINEARC_130_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_129(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_128, v ds
+# define BFI_FLINEARC_129_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_128(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_127, v ds
+# define BFI_FLINEARC_128_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_127(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_126, v ds
+# define BFI_FLINEARC_127_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_126(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_125, v ds
+# define BFI_FLINEARC_126_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_125(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_124, v ds
+# define BFI_FLINEARC_125_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_124(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_123, v ds
+# define BFI_FLINEARC_124_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_123(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_122, v ds
+# define BFI_FLINEARC_123_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_122(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_121, v ds
+# define BFI_FLINEARC_122_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_121(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_120, v ds
+# define BFI_FLINEARC_121_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_120(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_119, v ds
+# define BFI_FLINEARC_120_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_119(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_118, v ds
+# define BFI_FLINEARC_119_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_118(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_117, v ds
+# define BFI_FLINEARC_118_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_117(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_116, v ds
+# define BFI_FLINEARC_117_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_116(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_115, v ds
+# define BFI_FLINEARC_116_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_115(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_114, v ds
+# define BFI_FLINEARC_115_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_114(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_113, v ds
+# define BFI_FLINEARC_114_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_113(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_112, v ds
+# define BFI_FLINEARC_113_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_112(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_111, v ds
+# define BFI_FLINEARC_112_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_111(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_110, v ds
+# define BFI_FLINEARC_111_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_110(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_109, v ds
+# define BFI_FLINEARC_110_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_109(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_108, v ds
+# define BFI_FLINEARC_109_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_108(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_107, v ds
+# define BFI_FLINEARC_108_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_107(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_106, v ds
+# define BFI_FLINEARC_107_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_106(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_105, v ds
+# define BFI_FLINEARC_106_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_105(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_104, v ds
+# define BFI_FLINEARC_105_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_104(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_103, v ds
+# define BFI_FLINEARC_104_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_103(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_102, v ds
+# define BFI_FLINEARC_103_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_102(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_101, v ds
+# define BFI_FLINEARC_102_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_101(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_100, v ds
+# define BFI_FLINEARC_101_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_100(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_99, v ds
+# define BFI_FLINEARC_100_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_99(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_98, v ds
+# define BFI_FLINEARC_99_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_98(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_97, v ds
+# define BFI_FLINEARC_98_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_97(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_96, v ds
+# define BFI_FLINEARC_97_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_96(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_95, v ds
+# define BFI_FLINEARC_96_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_95(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_94, v ds
+# define BFI_FLINEARC_95_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_94(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_93, v ds
+# define BFI_FLINEARC_94_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_93(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_92, v ds
+# define BFI_FLINEARC_93_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_92(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_91, v ds
+# define BFI_FLINEARC_92_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_91(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_90, v ds
+# define BFI_FLINEARC_91_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_90(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_89, v ds
+# define BFI_FLINEARC_90_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_89(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_88, v ds
+# define BFI_FLINEARC_89_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_88(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_87, v ds
+# define BFI_FLINEARC_88_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_87(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_86, v ds
+# define BFI_FLINEARC_87_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_86(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_85, v ds
+# define BFI_FLINEARC_86_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_85(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_84, v ds
+# define BFI_FLINEARC_85_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_84(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_83, v ds
+# define BFI_FLINEARC_84_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_83(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_82, v ds
+# define BFI_FLINEARC_83_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_82(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_81, v ds
+# define BFI_FLINEARC_82_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_81(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_80, v ds
+# define BFI_FLINEARC_81_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_80(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_79, v ds
+# define BFI_FLINEARC_80_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_79(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_78, v ds
+# define BFI_FLINEARC_79_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_78(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_77, v ds
+# define BFI_FLINEARC_78_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_77(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_76, v ds
+# define BFI_FLINEARC_77_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_76(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_75, v ds
+# define BFI_FLINEARC_76_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_75(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_74, v ds
+# define BFI_FLINEARC_75_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_74(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_73, v ds
+# define BFI_FLINEARC_74_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_73(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_72, v ds
+# define BFI_FLINEARC_73_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_72(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_71, v ds
+# define BFI_FLINEARC_72_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_71(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_70, v ds
+# define BFI_FLINEARC_71_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_70(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_69, v ds
+# define BFI_FLINEARC_70_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_69(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_68, v ds
+# define BFI_FLINEARC_69_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_68(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_67, v ds
+# define BFI_FLINEARC_68_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_67(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_66, v ds
+# define BFI_FLINEARC_67_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_66(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_65, v ds
+# define BFI_FLINEARC_66_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_65(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_64, v ds
+# define BFI_FLINEARC_65_TICK(t) (0fast(0i##t))
+
+# endif
@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_C_4096_H
+# define BFI_LINEAR_C_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARC_4096(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4095, v ds
+# define BFI_FLINEARC_4096_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4095(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4094, v ds
+# define BFI_FLINEARC_4095_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4094(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4093, v ds
+# define BFI_FLINEARC_4094_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4093(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4092, v ds
+# define BFI_FLINEARC_4093_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4092(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4091, v ds
+# define BFI_FLINEARC_4092_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4091(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4090, v ds
+# define BFI_FLINEARC_4091_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4090(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4089, v ds
+# define BFI_FLINEARC_4090_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4089(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4088, v ds
+# define BFI_FLINEARC_4089_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4088(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4087, v ds
+# define BFI_FLINEARC_4088_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4087(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4086, v ds
+# define BFI_FLINEARC_4087_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4086(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4085, v ds
+# define BFI_FLINEARC_4086_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4085(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4084, v ds
+# define BFI_FLINEARC_4085_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4084(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4083, v ds
+# define BFI_FLINEARC_4084_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4083(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4082, v ds
+# define BFI_FLINEARC_4083_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4082(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4081, v ds
+# define BFI_FLINEARC_4082_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4081(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4080, v ds
+# define BFI_FLINEARC_4081_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4080(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4079, v ds
+# define BFI_FLINEARC_4080_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4079(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4078, v ds
+# define BFI_FLINEARC_4079_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4078(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4077, v ds
+# define BFI_FLINEARC_4078_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4077(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4076, v ds
+# define BFI_FLINEARC_4077_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4076(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4075, v ds
+# define BFI_FLINEARC_4076_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4075(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4074, v ds
+# define BFI_FLINEARC_4075_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4074(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4073, v ds
+# define BFI_FLINEARC_4074_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4073(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4072, v ds
+# define BFI_FLINEARC_4073_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4072(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4071, v ds
+# define BFI_FLINEARC_4072_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4071(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4070, v ds
+# define BFI_FLINEARC_4071_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4070(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4069, v ds
+# define BFI_FLINEARC_4070_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4069(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4068, v ds
+# define BFI_FLINEARC_4069_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4068(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4067, v ds
+# define BFI_FLINEARC_4068_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4067(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4066, v ds
+# define BFI_FLINEARC_4067_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4066(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4065, v ds
+# define BFI_FLINEARC_4066_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4065(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4064, v ds
+# define BFI_FLINEARC_4065_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4064(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4063, v ds
+# define BFI_FLINEARC_4064_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4063(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4062, v ds
+# define BFI_FLINEARC_4063_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4062(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4061, v ds
+# define BFI_FLINEARC_4062_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4061(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4060, v ds
+# define BFI_FLINEARC_4061_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4060(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4059, v ds
+# define BFI_FLINEARC_4060_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4059(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4058, v ds
+# define BFI_FLINEARC_4059_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4058(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4057, v ds
+# define BFI_FLINEARC_4058_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4057(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4056, v ds
+# define BFI_FLINEARC_4057_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4056(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4055, v ds
+# define BFI_FLINEARC_4056_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4055(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4054, v ds
+# define BFI_FLINEARC_4055_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4054(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4053, v ds
+# define BFI_FLINEARC_4054_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4053(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4052, v ds
+# define BFI_FLINEARC_4053_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4052(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4051, v ds
+# define BFI_FLINEARC_4052_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4051(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4050, v ds
+# define BFI_FLINEARC_4051_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4050(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4049, v ds
+# define BFI_FLINEARC_4050_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4049(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4048, v ds
+# define BFI_FLINEARC_4049_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4048(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4047, v ds
+# define BFI_FLINEARC_4048_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4047(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4046, v ds
+# define BFI_FLINEARC_4047_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4046(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4045, v ds
+# define BFI_FLINEARC_4046_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4045(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4044, v ds
+# define BFI_FLINEARC_4045_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4044(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4043, v ds
+# define BFI_FLINEARC_4044_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4043(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4042, v ds
+# define BFI_FLINEARC_4043_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4042(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4041, v ds
+# define BFI_FLINEARC_4042_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4041(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4040, v ds
+# define BFI_FLINEARC_4041_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4040(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4039, v ds
+# define BFI_FLINEARC_4040_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4039(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4038, v ds
+# define BFI_FLINEARC_4039_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4038(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4037, v ds
+# define BFI_FLINEARC_4038_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4037(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4036, v ds
+# define BFI_FLINEARC_4037_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4036(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4035, v ds
+# define BFI_FLINEARC_4036_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4035(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4034, v ds
+# define BFI_FLINEARC_4035_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4034(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4033, v ds
+# define BFI_FLINEARC_4034_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4033(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4032, v ds
+# define BFI_FLINEARC_4033_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4032(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4031, v ds
+# define BFI_FLINEARC_4032_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4031(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4030, v ds
+# define BFI_FLINEARC_4031_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4030(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4029, v ds
+# define BFI_FLINEARC_4030_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4029(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4028, v ds
+# define BFI_FLINEARC_4029_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4028(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4027, v ds
+# define BFI_FLINEARC_4028_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4027(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4026, v ds
+# define BFI_FLINEARC_4027_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4026(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4025, v ds
+# define BFI_FLINEARC_4026_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4025(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4024, v ds
+# define BFI_FLINEARC_4025_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4024(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4023, v ds
+# define BFI_FLINEARC_4024_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4023(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4022, v ds
+# define BFI_FLINEARC_4023_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4022(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4021, v ds
+# define BFI_FLINEARC_4022_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4021(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4020, v ds
+# define BFI_FLINEARC_4021_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4020(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4019, v ds
+# define BFI_FLINEARC_4020_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4019(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4018, v ds
+# define BFI_FLINEARC_4019_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4018(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4017, v ds
+# define BFI_FLINEARC_4018_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4017(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4016, v ds
+# define BFI_FLINEARC_4017_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4016(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4015, v ds
+# define BFI_FLINEARC_4016_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4015(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4014, v ds
+# define BFI_FLINEARC_4015_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4014(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4013, v ds
+# define BFI_FLINEARC_4014_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4013(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4012, v ds
+# define BFI_FLINEARC_4013_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4012(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4011, v ds
+# define BFI_FLINEARC_4012_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4011(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4010, v ds
+# define BFI_FLINEARC_4011_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4010(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4009, v ds
+# define BFI_FLINEARC_4010_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4009(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4008, v ds
+# define BFI_FLINEARC_4009_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4008(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4007, v ds
+# define BFI_FLINEARC_4008_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4007(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4006, v ds
+# define BFI_FLINEARC_4007_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4006(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4005, v ds
+# define BFI_FLINEARC_4006_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4005(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4004, v ds
+# define BFI_FLINEARC_4005_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4004(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4003, v ds
+# define BFI_FLINEARC_4004_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4003(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4002, v ds
+# define BFI_FLINEARC_4003_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4002(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4001, v ds
+# define BFI_FLINEARC_4002_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4001(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4000, v ds
+# define BFI_FLINEARC_4001_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4000(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3999, v ds
+# define BFI_FLINEARC_4000_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3999(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3998, v ds
+# define BFI_FLINEARC_3999_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3998(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3997, v ds
+# define BFI_FLINEARC_3998_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3997(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3996, v ds
+# define BFI_FLINEARC_3997_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3996(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3995, v ds
+# define BFI_FLINEARC_3996_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3995(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3994, v ds
+# define BFI_FLINEARC_3995_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3994(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3993, v ds
+# define BFI_FLINEARC_3994_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3993(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3992, v ds
+# define BFI_FLINEARC_3993_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3992(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3991, v ds
+# define BFI_FLINEARC_3992_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3991(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3990, v ds
+# define BFI_FLINEARC_3991_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3990(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3989, v ds
+# define BFI_FLINEARC_3990_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3989(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3988, v ds
+# define BFI_FLINEARC_3989_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3988(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3987, v ds
+# define BFI_FLINEARC_3988_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3987(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3986, v ds
+# define BFI_FLINEARC_3987_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3986(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3985, v ds
+# define BFI_FLINEARC_3986_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3985(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3984, v ds
+# define BFI_FLINEARC_3985_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3984(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3983, v ds
+# define BFI_FLINEARC_3984_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3983(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3982, v ds
+# define BFI_FLINEARC_3983_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3982(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3981, v ds
+# define BFI_FLINEARC_3982_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3981(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3980, v ds
+# define BFI_FLINEARC_3981_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3980(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3979, v ds
+# define BFI_FLINEARC_3980_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3979(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3978, v ds
+# define BFI_FLINEARC_3979_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3978(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3977, v ds
+# define BFI_FLINEARC_3978_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3977(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3976, v ds
+# define BFI_FLINEARC_3977_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3976(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3975, v ds
+# define BFI_FLINEARC_3976_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3975(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3974, v ds
+# define BFI_FLINEARC_3975_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3974(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3973, v ds
+# define BFI_FLINEARC_3974_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3973(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3972, v ds
+# define BFI_FLINEARC_3973_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3972(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3971, v ds
+# define BFI_FLINEARC_3972_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3971(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3970, v ds
+# define BFI_FLINEARC_3971_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3970(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3969, v ds
+# define BFI_FLINEARC_3970_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3969(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3968, v ds
+# define BFI_FLINEARC_3969_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3968(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3967, v ds
+# define BFI_FLINEARC_3968_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3967(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3966, v ds
+# define BFI_FLINEARC_3967_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3966(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3965, v ds
+# define BFI_FLINEARC_3966_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3965(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3964, v ds
+# define BFI_FLINEARC_3965_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3964(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3963, v ds
+# define BFI_FLINEARC_3964_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3963(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3962, v ds
+# define BFI_FLINEARC_3963_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3962(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3961, v ds
+# define BFI_FLINEARC_3962_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3961(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3960, v ds
+# define BFI_FLINEARC_3961_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3960(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3959, v ds
+# define BFI_FLINEARC_3960_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3959(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3958, v ds
+# define BFI_FLINEARC_3959_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3958(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3957, v ds
+# define BFI_FLINEARC_3958_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3957(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3956, v ds
+# define BFI_FLINEARC_3957_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3956(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3955, v ds
+# define BFI_FLINEARC_3956_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3955(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3954, v ds
+# define BFI_FLINEARC_3955_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3954(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3953, v ds
+# define BFI_FLINEARC_3954_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3953(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3952, v ds
+# define BFI_FLINEARC_3953_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3952(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3951, v ds
+# define BFI_FLINEARC_3952_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3951(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3950, v ds
+# define BFI_FLINEARC_3951_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3950(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3949, v ds
+# define BFI_FLINEARC_3950_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3949(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3948, v ds
+# define BFI_FLINEARC_3949_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3948(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3947, v ds
+# define BFI_FLINEARC_3948_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3947(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3946, v ds
+# define BFI_FLINEARC_3947_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3946(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3945, v ds
+# define BFI_FLINEARC_3946_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3945(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3944, v ds
+# define BFI_FLINEARC_3945_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3944(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3943, v ds
+# define BFI_FLINEARC_3944_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3943(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3942, v ds
+# define BFI_FLINEARC_3943_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3942(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3941, v ds
+# define BFI_FLINEARC_3942_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3941(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3940, v ds
+# define BFI_FLINEARC_3941_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3940(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3939, v ds
+# define BFI_FLINEARC_3940_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3939(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3938, v ds
+# define BFI_FLINEARC_3939_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3938(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3937, v ds
+# define BFI_FLINEARC_3938_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3937(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3936, v ds
+# define BFI_FLINEARC_3937_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3936(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3935, v ds
+# define BFI_FLINEARC_3936_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3935(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3934, v ds
+# define BFI_FLINEARC_3935_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3934(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3933, v ds
+# define BFI_FLINEARC_3934_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3933(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3932, v ds
+# define BFI_FLINEARC_3933_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3932(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3931, v ds
+# define BFI_FLINEARC_3932_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3931(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3930, v ds
+# define BFI_FLINEARC_3931_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3930(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3929, v ds
+# define BFI_FLINEARC_3930_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3929(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3928, v ds
+# define BFI_FLINEARC_3929_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3928(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3927, v ds
+# define BFI_FLINEARC_3928_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3927(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3926, v ds
+# define BFI_FLINEARC_3927_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3926(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3925, v ds
+# define BFI_FLINEARC_3926_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3925(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3924, v ds
+# define BFI_FLINEARC_3925_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3924(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3923, v ds
+# define BFI_FLINEARC_3924_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3923(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3922, v ds
+# define BFI_FLINEARC_3923_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3922(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3921, v ds
+# define BFI_FLINEARC_3922_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3921(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3920, v ds
+# define BFI_FLINEARC_3921_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3920(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3919, v ds
+# define BFI_FLINEARC_3920_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3919(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3918, v ds
+# define BFI_FLINEARC_3919_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3918(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3917, v ds
+# define BFI_FLINEARC_3918_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3917(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3916, v ds
+# define BFI_FLINEARC_3917_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3916(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3915, v ds
+# define BFI_FLINEARC_3916_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3915(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3914, v ds
+# define BFI_FLINEARC_3915_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3914(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3913, v ds
+# define BFI_FLINEARC_3914_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3913(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3912, v ds
+# define BFI_FLINEARC_3913_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3912(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3911, v ds
+# define BFI_FLINEARC_3912_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3911(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3910, v ds
+# define BFI_FLINEARC_3911_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3910(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3909, v ds
+# define BFI_FLINEARC_3910_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3909(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3908, v ds
+# define BFI_FLINEARC_3909_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3908(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3907, v ds
+# define BFI_FLINEARC_3908_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3907(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3906, v ds
+# define BFI_FLINEARC_3907_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3906(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3905, v ds
+# define BFI_FLINEARC_3906_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3905(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3904, v ds
+# define BFI_FLINEARC_3905_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3904(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3903, v ds
+# define BFI_FLINEARC_3904_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3903(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3902, v ds
+# define BFI_FLINEARC_3903_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3902(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3901, v ds
+# define BFI_FLINEARC_3902_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3901(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3900, v ds
+# define BFI_FLINEARC_3901_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3900(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3899, v ds
+# define BFI_FLINEARC_3900_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3899(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3898, v ds
+# define BFI_FLINEARC_3899_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3898(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3897, v ds
+# define BFI_FLINEARC_3898_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3897(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3896, v ds
+# define BFI_FLINEARC_3897_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3896(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3895, v ds
+# define BFI_FLINEARC_3896_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3895(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3894, v ds
+# define BFI_FLINEARC_3895_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3894(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3893, v ds
+# define BFI_FLINEARC_3894_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3893(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3892, v ds
+# define BFI_FLINEARC_3893_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3892(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3891, v ds
+# define BFI_FLINEARC_3892_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3891(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3890, v ds
+# define BFI_FLINEARC_3891_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3890(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3889, v ds
+# define BFI_FLINEARC_3890_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3889(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3888, v ds
+# define BFI_FLINEARC_3889_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3888(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3887, v ds
+# define BFI_FLINEARC_3888_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3887(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3886, v ds
+# define BFI_FLINEARC_3887_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3886(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3885, v ds
+# define BFI_FLINEARC_3886_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3885(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3884, v ds
+# define BFI_FLINEARC_3885_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3884(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3883, v ds
+# define BFI_FLINEARC_3884_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3883(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3882, v ds
+# define BFI_FLINEARC_3883_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3882(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3881, v ds
+# define BFI_FLINEARC_3882_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3881(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3880, v ds
+# define BFI_FLINEARC_3881_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3880(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3879, v ds
+# define BFI_FLINEARC_3880_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3879(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3878, v ds
+# define BFI_FLINEARC_3879_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3878(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3877, v ds
+# define BFI_FLINEARC_3878_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3877(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3876, v ds
+# define BFI_FLINEARC_3877_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3876(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3875, v ds
+# define BFI_FLINEARC_3876_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3875(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3874, v ds
+# define BFI_FLINEARC_3875_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3874(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3873, v ds
+# define BFI_FLINEARC_3874_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3873(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3872, v ds
+# define BFI_FLINEARC_3873_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3872(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3871, v ds
+# define BFI_FLINEARC_3872_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3871(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3870, v ds
+# define BFI_FLINEARC_3871_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3870(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3869, v ds
+# define BFI_FLINEARC_3870_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3869(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3868, v ds
+# define BFI_FLINEARC_3869_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3868(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3867, v ds
+# define BFI_FLINEARC_3868_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3867(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3866, v ds
+# define BFI_FLINEARC_3867_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3866(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3865, v ds
+# define BFI_FLINEARC_3866_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3865(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3864, v ds
+# define BFI_FLINEARC_3865_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3864(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3863, v ds
+# define BFI_FLINEARC_3864_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3863(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3862, v ds
+# define BFI_FLINEARC_3863_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3862(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3861, v ds
+# define BFI_FLINEARC_3862_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3861(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3860, v ds
+# define BFI_FLINEARC_3861_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3860(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3859, v ds
+# define BFI_FLINEARC_3860_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3859(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3858, v ds
+# define BFI_FLINEARC_3859_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3858(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3857, v ds
+# define BFI_FLINEARC_3858_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3857(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3856, v ds
+# define BFI_FLINEARC_3857_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3856(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3855, v ds
+# define BFI_FLINEARC_3856_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3855(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3854, v ds
+# define BFI_FLINEARC_3855_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3854(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3853, v ds
+# define BFI_FLINEARC_3854_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3853(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3852, v ds
+# define BFI_FLINEARC_3853_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3852(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3851, v ds
+# define BFI_FLINEARC_3852_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3851(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3850, v ds
+# define BFI_FLINEARC_3851_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3850(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3849, v ds
+# define BFI_FLINEARC_3850_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3849(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3848, v ds
+# define BFI_FLINEARC_3849_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3848(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3847, v ds
+# define BFI_FLINEARC_3848_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3847(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3846, v ds
+# define BFI_FLINEARC_3847_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3846(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3845, v ds
+# define BFI_FLINEARC_3846_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3845(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3844, v ds
+# define BFI_FLINEARC_3845_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3844(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3843, v ds
+# define BFI_FLINEARC_3844_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3843(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3842, v ds
+# define BFI_FLINEARC_3843_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3842(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3841, v ds
+# define BFI_FLINEARC_3842_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3841(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3840, v ds
+# define BFI_FLINEARC_3841_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3840(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3839, v ds
+# define BFI_FLINEARC_3840_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3839(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3838, v ds
+# define BFI_FLINEARC_3839_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3838(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3837, v ds
+# define BFI_FLINEARC_3838_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3837(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3836, v ds
+# define BFI_FLINEARC_3837_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3836(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3835, v ds
+# define BFI_FLINEARC_3836_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3835(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3834, v ds
+# define BFI_FLINEARC_3835_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3834(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3833, v ds
+# define BFI_FLINEARC_3834_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3833(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3832, v ds
+# define BFI_FLINEARC_3833_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3832(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3831, v ds
+# define BFI_FLINEARC_3832_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3831(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3830, v ds
+# define BFI_FLINEARC_3831_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3830(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3829, v ds
+# define BFI_FLINEARC_3830_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3829(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3828, v ds
+# define BFI_FLINEARC_3829_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3828(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3827, v ds
+# define BFI_FLINEARC_3828_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3827(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3826, v ds
+# define BFI_FLINEARC_3827_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3826(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3825, v ds
+# define BFI_FLINEARC_3826_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3825(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3824, v ds
+# define BFI_FLINEARC_3825_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3824(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3823, v ds
+# define BFI_FLINEARC_3824_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3823(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3822, v ds
+# define BFI_FLINEARC_3823_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3822(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3821, v ds
+# define BFI_FLINEARC_3822_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3821(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3820, v ds
+# define BFI_FLINEARC_3821_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3820(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3819, v ds
+# define BFI_FLINEARC_3820_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3819(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3818, v ds
+# define BFI_FLINEARC_3819_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3818(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3817, v ds
+# define BFI_FLINEARC_3818_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3817(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3816, v ds
+# define BFI_FLINEARC_3817_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3816(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3815, v ds
+# define BFI_FLINEARC_3816_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3815(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3814, v ds
+# define BFI_FLINEARC_3815_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3814(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3813, v ds
+# define BFI_FLINEARC_3814_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3813(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3812, v ds
+# define BFI_FLINEARC_3813_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3812(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3811, v ds
+# define BFI_FLINEARC_3812_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3811(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3810, v ds
+# define BFI_FLINEARC_3811_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3810(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3809, v ds
+# define BFI_FLINEARC_3810_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3809(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3808, v ds
+# define BFI_FLINEARC_3809_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3808(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3807, v ds
+# define BFI_FLINEARC_3808_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3807(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3806, v ds
+# define BFI_FLINEARC_3807_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3806(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3805, v ds
+# define BFI_FLINEARC_3806_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3805(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3804, v ds
+# define BFI_FLINEARC_3805_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3804(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3803, v ds
+# define BFI_FLINEARC_3804_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3803(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3802, v ds
+# define BFI_FLINEARC_3803_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3802(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3801, v ds
+# define BFI_FLINEARC_3802_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3801(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3800, v ds
+# define BFI_FLINEARC_3801_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3800(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3799, v ds
+# define BFI_FLINEARC_3800_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3799(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3798, v ds
+# define BFI_FLINEARC_3799_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3798(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3797, v ds
+# define BFI_FLINEARC_3798_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3797(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3796, v ds
+# define BFI_FLINEARC_3797_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3796(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3795, v ds
+# define BFI_FLINEARC_3796_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3795(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3794, v ds
+# define BFI_FLINEARC_3795_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3794(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3793, v ds
+# define BFI_FLINEARC_3794_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3793(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3792, v ds
+# define BFI_FLINEARC_3793_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3792(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3791, v ds
+# define BFI_FLINEARC_3792_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3791(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3790, v ds
+# define BFI_FLINEARC_3791_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3790(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3789, v ds
+# define BFI_FLINEARC_3790_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3789(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3788, v ds
+# define BFI_FLINEARC_3789_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3788(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3787, v ds
+# define BFI_FLINEARC_3788_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3787(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3786, v ds
+# define BFI_FLINEARC_3787_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3786(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3785, v ds
+# define BFI_FLINEARC_3786_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3785(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3784, v ds
+# define BFI_FLINEARC_3785_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3784(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3783, v ds
+# define BFI_FLINEARC_3784_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3783(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3782, v ds
+# define BFI_FLINEARC_3783_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3782(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3781, v ds
+# define BFI_FLINEARC_3782_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3781(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3780, v ds
+# define BFI_FLINEARC_3781_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3780(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3779, v ds
+# define BFI_FLINEARC_3780_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3779(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3778, v ds
+# define BFI_FLINEARC_3779_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3778(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3777, v ds
+# define BFI_FLINEARC_3778_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3777(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3776, v ds
+# define BFI_FLINEARC_3777_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3776(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3775, v ds
+# define BFI_FLINEARC_3776_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3775(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3774, v ds
+# define BFI_FLINEARC_3775_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3774(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3773, v ds
+# define BFI_FLINEARC_3774_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3773(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3772, v ds
+# define BFI_FLINEARC_3773_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3772(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3771, v ds
+# define BFI_FLINEARC_3772_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3771(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3770, v ds
+# define BFI_FLINEARC_3771_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3770(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3769, v ds
+# define BFI_FLINEARC_3770_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3769(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3768, v ds
+# define BFI_FLINEARC_3769_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3768(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3767, v ds
+# define BFI_FLINEARC_3768_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3767(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3766, v ds
+# define BFI_FLINEARC_3767_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3766(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3765, v ds
+# define BFI_FLINEARC_3766_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3765(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3764, v ds
+# define BFI_FLINEARC_3765_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3764(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3763, v ds
+# define BFI_FLINEARC_3764_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3763(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3762, v ds
+# define BFI_FLINEARC_3763_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3762(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3761, v ds
+# define BFI_FLINEARC_3762_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3761(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3760, v ds
+# define BFI_FLINEARC_3761_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3760(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3759, v ds
+# define BFI_FLINEARC_3760_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3759(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3758, v ds
+# define BFI_FLINEARC_3759_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3758(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3757, v ds
+# define BFI_FLINEARC_3758_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3757(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3756, v ds
+# define BFI_FLINEARC_3757_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3756(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3755, v ds
+# define BFI_FLINEARC_3756_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3755(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3754, v ds
+# define BFI_FLINEARC_3755_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3754(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3753, v ds
+# define BFI_FLINEARC_3754_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3753(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3752, v ds
+# define BFI_FLINEARC_3753_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3752(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3751, v ds
+# define BFI_FLINEARC_3752_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3751(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3750, v ds
+# define BFI_FLINEARC_3751_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3750(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3749, v ds
+# define BFI_FLINEARC_3750_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3749(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3748, v ds
+# define BFI_FLINEARC_3749_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3748(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3747, v ds
+# define BFI_FLINEARC_3748_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3747(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3746, v ds
+# define BFI_FLINEARC_3747_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3746(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3745, v ds
+# define BFI_FLINEARC_3746_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3745(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3744, v ds
+# define BFI_FLINEARC_3745_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3744(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3743, v ds
+# define BFI_FLINEARC_3744_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3743(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3742, v ds
+# define BFI_FLINEARC_3743_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3742(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3741, v ds
+# define BFI_FLINEARC_3742_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3741(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3740, v ds
+# define BFI_FLINEARC_3741_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3740(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3739, v ds
+# define BFI_FLINEARC_3740_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3739(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3738, v ds
+# define BFI_FLINEARC_3739_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3738(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3737, v ds
+# define BFI_FLINEARC_3738_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3737(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3736, v ds
+# define BFI_FLINEARC_3737_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3736(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3735, v ds
+# define BFI_FLINEARC_3736_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3735(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3734, v ds
+# define BFI_FLINEARC_3735_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3734(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3733, v ds
+# define BFI_FLINEARC_3734_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3733(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3732, v ds
+# define BFI_FLINEARC_3733_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3732(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3731, v ds
+# define BFI_FLINEARC_3732_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3731(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3730, v ds
+# define BFI_FLINEARC_3731_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3730(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3729, v ds
+# define BFI_FLINEARC_3730_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3729(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3728, v ds
+# define BFI_FLINEARC_3729_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3728(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3727, v ds
+# define BFI_FLINEARC_3728_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3727(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3726, v ds
+# define BFI_FLINEARC_3727_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3726(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3725, v ds
+# define BFI_FLINEARC_3726_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3725(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3724, v ds
+# define BFI_FLINEARC_3725_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3724(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3723, v ds
+# define BFI_FLINEARC_3724_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3723(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3722, v ds
+# define BFI_FLINEARC_3723_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3722(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3721, v ds
+# define BFI_FLINEARC_3722_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3721(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3720, v ds
+# define BFI_FLINEARC_3721_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3720(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3719, v ds
+# define BFI_FLINEARC_3720_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3719(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3718, v ds
+# define BFI_FLINEARC_3719_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3718(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3717, v ds
+# define BFI_FLINEARC_3718_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3717(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3716, v ds
+# define BFI_FLINEARC_3717_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3716(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3715, v ds
+# define BFI_FLINEARC_3716_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3715(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3714, v ds
+# define BFI_FLINEARC_3715_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3714(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3713, v ds
+# define BFI_FLINEARC_3714_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3713(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3712, v ds
+# define BFI_FLINEARC_3713_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3712(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3711, v ds
+# define BFI_FLINEARC_3712_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3711(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3710, v ds
+# define BFI_FLINEARC_3711_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3710(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3709, v ds
+# define BFI_FLINEARC_3710_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3709(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3708, v ds
+# define BFI_FLINEARC_3709_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3708(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3707, v ds
+# define BFI_FLINEARC_3708_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3707(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3706, v ds
+# define BFI_FLINEARC_3707_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3706(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3705, v ds
+# define BFI_FLINEARC_3706_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3705(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3704, v ds
+# define BFI_FLINEARC_3705_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3704(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3703, v ds
+# define BFI_FLINEARC_3704_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3703(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3702, v ds
+# define BFI_FLINEARC_3703_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3702(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3701, v ds
+# define BFI_FLINEARC_3702_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3701(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3700, v ds
+# define BFI_FLINEARC_3701_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3700(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3699, v ds
+# define BFI_FLINEARC_3700_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3699(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3698, v ds
+# define BFI_FLINEARC_3699_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3698(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3697, v ds
+# define BFI_FLINEARC_3698_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3697(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3696, v ds
+# define BFI_FLINEARC_3697_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3696(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3695, v ds
+# define BFI_FLINEARC_3696_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3695(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3694, v ds
+# define BFI_FLINEARC_3695_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3694(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3693, v ds
+# define BFI_FLINEARC_3694_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3693(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3692, v ds
+# define BFI_FLINEARC_3693_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3692(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3691, v ds
+# define BFI_FLINEARC_3692_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3691(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3690, v ds
+# define BFI_FLINEARC_3691_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3690(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3689, v ds
+# define BFI_FLINEARC_3690_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3689(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3688, v ds
+# define BFI_FLINEARC_3689_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3688(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3687, v ds
+# define BFI_FLINEARC_3688_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3687(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3686, v ds
+# define BFI_FLINEARC_3687_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3686(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3685, v ds
+# define BFI_FLINEARC_3686_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3685(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3684, v ds
+# define BFI_FLINEARC_3685_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3684(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3683, v ds
+# define BFI_FLINEARC_3684_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3683(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3682, v ds
+# define BFI_FLINEARC_3683_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3682(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3681, v ds
+# define BFI_FLINEARC_3682_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3681(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3680, v ds
+# define BFI_FLINEARC_3681_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3680(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3679, v ds
+# define BFI_FLINEARC_3680_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3679(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3678, v ds
+# define BFI_FLINEARC_3679_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3678(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3677, v ds
+# define BFI_FLINEARC_3678_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3677(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3676, v ds
+# define BFI_FLINEARC_3677_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3676(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3675, v ds
+# define BFI_FLINEARC_3676_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3675(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3674, v ds
+# define BFI_FLINEARC_3675_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3674(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3673, v ds
+# define BFI_FLINEARC_3674_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3673(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3672, v ds
+# define BFI_FLINEARC_3673_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3672(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3671, v ds
+# define BFI_FLINEARC_3672_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3671(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3670, v ds
+# define BFI_FLINEARC_3671_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3670(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3669, v ds
+# define BFI_FLINEARC_3670_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3669(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3668, v ds
+# define BFI_FLINEARC_3669_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3668(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3667, v ds
+# define BFI_FLINEARC_3668_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3667(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3666, v ds
+# define BFI_FLINEARC_3667_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3666(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3665, v ds
+# define BFI_FLINEARC_3666_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3665(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3664, v ds
+# define BFI_FLINEARC_3665_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3664(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3663, v ds
+# define BFI_FLINEARC_3664_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3663(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3662, v ds
+# define BFI_FLINEARC_3663_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3662(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3661, v ds
+# define BFI_FLINEARC_3662_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3661(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3660, v ds
+# define BFI_FLINEARC_3661_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3660(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3659, v ds
+# define BFI_FLINEARC_3660_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3659(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3658, v ds
+# define BFI_FLINEARC_3659_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3658(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3657, v ds
+# define BFI_FLINEARC_3658_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3657(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3656, v ds
+# define BFI_FLINEARC_3657_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3656(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3655, v ds
+# define BFI_FLINEARC_3656_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3655(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3654, v ds
+# define BFI_FLINEARC_3655_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3654(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3653, v ds
+# define BFI_FLINEARC_3654_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3653(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3652, v ds
+# define BFI_FLINEARC_3653_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3652(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3651, v ds
+# define BFI_FLINEARC_3652_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3651(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3650, v ds
+# define BFI_FLINEARC_3651_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3650(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3649, v ds
+# define BFI_FLINEARC_3650_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3649(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3648, v ds
+# define BFI_FLINEARC_3649_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3648(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3647, v ds
+# define BFI_FLINEARC_3648_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3647(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3646, v ds
+# define BFI_FLINEARC_3647_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3646(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3645, v ds
+# define BFI_FLINEARC_3646_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3645(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3644, v ds
+# define BFI_FLINEARC_3645_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3644(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3643, v ds
+# define BFI_FLINEARC_3644_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3643(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3642, v ds
+# define BFI_FLINEARC_3643_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3642(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3641, v ds
+# define BFI_FLINEARC_3642_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3641(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3640, v ds
+# define BFI_FLINEARC_3641_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3640(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3639, v ds
+# define BFI_FLINEARC_3640_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3639(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3638, v ds
+# define BFI_FLINEARC_3639_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3638(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3637, v ds
+# define BFI_FLINEARC_3638_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3637(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3636, v ds
+# define BFI_FLINEARC_3637_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3636(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3635, v ds
+# define BFI_FLINEARC_3636_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3635(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3634, v ds
+# define BFI_FLINEARC_3635_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3634(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3633, v ds
+# define BFI_FLINEARC_3634_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3633(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3632, v ds
+# define BFI_FLINEARC_3633_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3632(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3631, v ds
+# define BFI_FLINEARC_3632_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3631(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3630, v ds
+# define BFI_FLINEARC_3631_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3630(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3629, v ds
+# define BFI_FLINEARC_3630_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3629(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3628, v ds
+# define BFI_FLINEARC_3629_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3628(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3627, v ds
+# define BFI_FLINEARC_3628_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3627(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3626, v ds
+# define BFI_FLINEARC_3627_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3626(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3625, v ds
+# define BFI_FLINEARC_3626_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3625(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3624, v ds
+# define BFI_FLINEARC_3625_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3624(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3623, v ds
+# define BFI_FLINEARC_3624_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3623(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3622, v ds
+# define BFI_FLINEARC_3623_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3622(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3621, v ds
+# define BFI_FLINEARC_3622_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3621(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3620, v ds
+# define BFI_FLINEARC_3621_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3620(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3619, v ds
+# define BFI_FLINEARC_3620_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3619(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3618, v ds
+# define BFI_FLINEARC_3619_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3618(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3617, v ds
+# define BFI_FLINEARC_3618_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3617(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3616, v ds
+# define BFI_FLINEARC_3617_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3616(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3615, v ds
+# define BFI_FLINEARC_3616_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3615(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3614, v ds
+# define BFI_FLINEARC_3615_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3614(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3613, v ds
+# define BFI_FLINEARC_3614_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3613(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3612, v ds
+# define BFI_FLINEARC_3613_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3612(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3611, v ds
+# define BFI_FLINEARC_3612_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3611(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3610, v ds
+# define BFI_FLINEARC_3611_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3610(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3609, v ds
+# define BFI_FLINEARC_3610_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3609(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3608, v ds
+# define BFI_FLINEARC_3609_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3608(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3607, v ds
+# define BFI_FLINEARC_3608_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3607(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3606, v ds
+# define BFI_FLINEARC_3607_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3606(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3605, v ds
+# define BFI_FLINEARC_3606_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3605(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3604, v ds
+# define BFI_FLINEARC_3605_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3604(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3603, v ds
+# define BFI_FLINEARC_3604_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3603(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3602, v ds
+# define BFI_FLINEARC_3603_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3602(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3601, v ds
+# define BFI_FLINEARC_3602_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3601(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3600, v ds
+# define BFI_FLINEARC_3601_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3600(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3599, v ds
+# define BFI_FLINEARC_3600_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3599(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3598, v ds
+# define BFI_FLINEARC_3599_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3598(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3597, v ds
+# define BFI_FLINEARC_3598_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3597(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3596, v ds
+# define BFI_FLINEARC_3597_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3596(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3595, v ds
+# define BFI_FLINEARC_3596_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3595(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3594, v ds
+# define BFI_FLINEARC_3595_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3594(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3593, v ds
+# define BFI_FLINEARC_3594_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3593(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3592, v ds
+# define BFI_FLINEARC_3593_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3592(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3591, v ds
+# define BFI_FLINEARC_3592_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3591(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3590, v ds
+# define BFI_FLINEARC_3591_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3590(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3589, v ds
+# define BFI_FLINEARC_3590_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3589(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3588, v ds
+# define BFI_FLINEARC_3589_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3588(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3587, v ds
+# define BFI_FLINEARC_3588_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3587(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3586, v ds
+# define BFI_FLINEARC_3587_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3586(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3585, v ds
+# define BFI_FLINEARC_3586_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3585(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3584, v ds
+# define BFI_FLINEARC_3585_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3584(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3583, v ds
+# define BFI_FLINEARC_3584_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3583(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3582, v ds
+# define BFI_FLINEARC_3583_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3582(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3581, v ds
+# define BFI_FLINEARC_3582_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3581(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3580, v ds
+# define BFI_FLINEARC_3581_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3580(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3579, v ds
+# define BFI_FLINEARC_3580_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3579(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3578, v ds
+# define BFI_FLINEARC_3579_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3578(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3577, v ds
+# define BFI_FLINEARC_3578_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3577(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3576, v ds
+# define BFI_FLINEARC_3577_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3576(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3575, v ds
+# define BFI_FLINEARC_3576_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3575(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3574, v ds
+# define BFI_FLINEARC_3575_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3574(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3573, v ds
+# define BFI_FLINEARC_3574_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3573(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3572, v ds
+# define BFI_FLINEARC_3573_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3572(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3571, v ds
+# define BFI_FLINEARC_3572_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3571(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3570, v ds
+# define BFI_FLINEARC_3571_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3570(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3569, v ds
+# define BFI_FLINEARC_3570_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3569(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3568, v ds
+# define BFI_FLINEARC_3569_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3568(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3567, v ds
+# define BFI_FLINEARC_3568_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3567(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3566, v ds
+# define BFI_FLINEARC_3567_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3566(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3565, v ds
+# define BFI_FLINEARC_3566_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3565(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3564, v ds
+# define BFI_FLINEARC_3565_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3564(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3563, v ds
+# define BFI_FLINEARC_3564_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3563(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3562, v ds
+# define BFI_FLINEARC_3563_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3562(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3561, v ds
+# define BFI_FLINEARC_3562_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3561(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3560, v ds
+# define BFI_FLINEARC_3561_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3560(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3559, v ds
+# define BFI_FLINEARC_3560_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3559(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3558, v ds
+# define BFI_FLINEARC_3559_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3558(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3557, v ds
+# define BFI_FLINEARC_3558_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3557(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3556, v ds
+# define BFI_FLINEARC_3557_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3556(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3555, v ds
+# define BFI_FLINEARC_3556_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3555(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3554, v ds
+# define BFI_FLINEARC_3555_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3554(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3553, v ds
+# define BFI_FLINEARC_3554_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3553(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3552, v ds
+# define BFI_FLINEARC_3553_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3552(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3551, v ds
+# define BFI_FLINEARC_3552_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3551(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3550, v ds
+# define BFI_FLINEARC_3551_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3550(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3549, v ds
+# define BFI_FLINEARC_3550_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3549(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3548, v ds
+# define BFI_FLINEARC_3549_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3548(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3547, v ds
+# define BFI_FLINEARC_3548_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3547(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3546, v ds
+# define BFI_FLINEARC_3547_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3546(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3545, v ds
+# define BFI_FLINEARC_3546_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3545(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3544, v ds
+# define BFI_FLINEARC_3545_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3544(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3543, v ds
+# define BFI_FLINEARC_3544_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3543(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3542, v ds
+# define BFI_FLINEARC_3543_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3542(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3541, v ds
+# define BFI_FLINEARC_3542_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3541(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3540, v ds
+# define BFI_FLINEARC_3541_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3540(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3539, v ds
+# define BFI_FLINEARC_3540_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3539(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3538, v ds
+# define BFI_FLINEARC_3539_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3538(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3537, v ds
+# define BFI_FLINEARC_3538_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3537(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3536, v ds
+# define BFI_FLINEARC_3537_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3536(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3535, v ds
+# define BFI_FLINEARC_3536_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3535(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3534, v ds
+# define BFI_FLINEARC_3535_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3534(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3533, v ds
+# define BFI_FLINEARC_3534_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3533(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3532, v ds
+# define BFI_FLINEARC_3533_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3532(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3531, v ds
+# define BFI_FLINEARC_3532_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3531(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3530, v ds
+# define BFI_FLINEARC_3531_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3530(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3529, v ds
+# define BFI_FLINEARC_3530_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3529(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3528, v ds
+# define BFI_FLINEARC_3529_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3528(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3527, v ds
+# define BFI_FLINEARC_3528_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3527(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3526, v ds
+# define BFI_FLINEARC_3527_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3526(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3525, v ds
+# define BFI_FLINEARC_3526_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3525(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3524, v ds
+# define BFI_FLINEARC_3525_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3524(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3523, v ds
+# define BFI_FLINEARC_3524_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3523(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3522, v ds
+# define BFI_FLINEARC_3523_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3522(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3521, v ds
+# define BFI_FLINEARC_3522_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3521(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3520, v ds
+# define BFI_FLINEARC_3521_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3520(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3519, v ds
+# define BFI_FLINEARC_3520_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3519(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3518, v ds
+# define BFI_FLINEARC_3519_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3518(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3517, v ds
+# define BFI_FLINEARC_3518_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3517(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3516, v ds
+# define BFI_FLINEARC_3517_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3516(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3515, v ds
+# define BFI_FLINEARC_3516_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3515(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3514, v ds
+# define BFI_FLINEARC_3515_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3514(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3513, v ds
+# define BFI_FLINEARC_3514_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3513(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3512, v ds
+# define BFI_FLINEARC_3513_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3512(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3511, v ds
+# define BFI_FLINEARC_3512_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3511(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3510, v ds
+# define BFI_FLINEARC_3511_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3510(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3509, v ds
+# define BFI_FLINEARC_3510_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3509(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3508, v ds
+# define BFI_FLINEARC_3509_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3508(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3507, v ds
+# define BFI_FLINEARC_3508_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3507(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3506, v ds
+# define BFI_FLINEARC_3507_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3506(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3505, v ds
+# define BFI_FLINEARC_3506_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3505(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3504, v ds
+# define BFI_FLINEARC_3505_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3504(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3503, v ds
+# define BFI_FLINEARC_3504_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3503(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3502, v ds
+# define BFI_FLINEARC_3503_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3502(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3501, v ds
+# define BFI_FLINEARC_3502_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3501(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3500, v ds
+# define BFI_FLINEARC_3501_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3500(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3499, v ds
+# define BFI_FLINEARC_3500_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3499(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3498, v ds
+# define BFI_FLINEARC_3499_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3498(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3497, v ds
+# define BFI_FLINEARC_3498_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3497(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3496, v ds
+# define BFI_FLINEARC_3497_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3496(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3495, v ds
+# define BFI_FLINEARC_3496_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3495(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3494, v ds
+# define BFI_FLINEARC_3495_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3494(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3493, v ds
+# define BFI_FLINEARC_3494_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3493(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3492, v ds
+# define BFI_FLINEARC_3493_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3492(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3491, v ds
+# define BFI_FLINEARC_3492_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3491(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3490, v ds
+# define BFI_FLINEARC_3491_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3490(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3489, v ds
+# define BFI_FLINEARC_3490_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3489(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3488, v ds
+# define BFI_FLINEARC_3489_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3488(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3487, v ds
+# define BFI_FLINEARC_3488_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3487(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3486, v ds
+# define BFI_FLINEARC_3487_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3486(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3485, v ds
+# define BFI_FLINEARC_3486_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3485(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3484, v ds
+# define BFI_FLINEARC_3485_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3484(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3483, v ds
+# define BFI_FLINEARC_3484_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3483(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3482, v ds
+# define BFI_FLINEARC_3483_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3482(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3481, v ds
+# define BFI_FLINEARC_3482_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3481(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3480, v ds
+# define BFI_FLINEARC_3481_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3480(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3479, v ds
+# define BFI_FLINEARC_3480_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3479(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3478, v ds
+# define BFI_FLINEARC_3479_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3478(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3477, v ds
+# define BFI_FLINEARC_3478_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3477(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3476, v ds
+# define BFI_FLINEARC_3477_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3476(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3475, v ds
+# define BFI_FLINEARC_3476_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3475(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3474, v ds
+# define BFI_FLINEARC_3475_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3474(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3473, v ds
+# define BFI_FLINEARC_3474_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3473(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3472, v ds
+# define BFI_FLINEARC_3473_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3472(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3471, v ds
+# define BFI_FLINEARC_3472_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3471(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3470, v ds
+# define BFI_FLINEARC_3471_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3470(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3469, v ds
+# define BFI_FLINEARC_3470_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3469(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3468, v ds
+# define BFI_FLINEARC_3469_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3468(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3467, v ds
+# define BFI_FLINEARC_3468_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3467(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3466, v ds
+# define BFI_FLINEARC_3467_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3466(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3465, v ds
+# define BFI_FLINEARC_3466_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3465(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3464, v ds
+# define BFI_FLINEARC_3465_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3464(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3463, v ds
+# define BFI_FLINEARC_3464_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3463(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3462, v ds
+# define BFI_FLINEARC_3463_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3462(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3461, v ds
+# define BFI_FLINEARC_3462_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3461(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3460, v ds
+# define BFI_FLINEARC_3461_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3460(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3459, v ds
+# define BFI_FLINEARC_3460_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3459(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3458, v ds
+# define BFI_FLINEARC_3459_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3458(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3457, v ds
+# define BFI_FLINEARC_3458_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3457(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3456, v ds
+# define BFI_FLINEARC_3457_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3456(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3455, v ds
+# define BFI_FLINEARC_3456_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3455(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3454, v ds
+# define BFI_FLINEARC_3455_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3454(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3453, v ds
+# define BFI_FLINEARC_3454_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3453(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3452, v ds
+# define BFI_FLINEARC_3453_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3452(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3451, v ds
+# define BFI_FLINEARC_3452_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3451(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3450, v ds
+# define BFI_FLINEARC_3451_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3450(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3449, v ds
+# define BFI_FLINEARC_3450_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3449(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3448, v ds
+# define BFI_FLINEARC_3449_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3448(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3447, v ds
+# define BFI_FLINEARC_3448_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3447(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3446, v ds
+# define BFI_FLINEARC_3447_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3446(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3445, v ds
+# define BFI_FLINEARC_3446_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3445(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3444, v ds
+# define BFI_FLINEARC_3445_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3444(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3443, v ds
+# define BFI_FLINEARC_3444_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3443(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3442, v ds
+# define BFI_FLINEARC_3443_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3442(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3441, v ds
+# define BFI_FLINEARC_3442_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3441(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3440, v ds
+# define BFI_FLINEARC_3441_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3440(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3439, v ds
+# define BFI_FLINEARC_3440_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3439(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3438, v ds
+# define BFI_FLINEARC_3439_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3438(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3437, v ds
+# define BFI_FLINEARC_3438_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3437(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3436, v ds
+# define BFI_FLINEARC_3437_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3436(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3435, v ds
+# define BFI_FLINEARC_3436_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3435(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3434, v ds
+# define BFI_FLINEARC_3435_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3434(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3433, v ds
+# define BFI_FLINEARC_3434_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3433(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3432, v ds
+# define BFI_FLINEARC_3433_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3432(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3431, v ds
+# define BFI_FLINEARC_3432_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3431(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3430, v ds
+# define BFI_FLINEARC_3431_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3430(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3429, v ds
+# define BFI_FLINEARC_3430_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3429(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3428, v ds
+# define BFI_FLINEARC_3429_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3428(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3427, v ds
+# define BFI_FLINEARC_3428_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3427(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3426, v ds
+# define BFI_FLINEARC_3427_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3426(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3425, v ds
+# define BFI_FLINEARC_3426_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3425(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3424, v ds
+# define BFI_FLINEARC_3425_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3424(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3423, v ds
+# define BFI_FLINEARC_3424_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3423(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3422, v ds
+# define BFI_FLINEARC_3423_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3422(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3421, v ds
+# define BFI_FLINEARC_3422_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3421(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3420, v ds
+# define BFI_FLINEARC_3421_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3420(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3419, v ds
+# define BFI_FLINEARC_3420_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3419(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3418, v ds
+# define BFI_FLINEARC_3419_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3418(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3417, v ds
+# define BFI_FLINEARC_3418_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3417(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3416, v ds
+# define BFI_FLINEARC_3417_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3416(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3415, v ds
+# define BFI_FLINEARC_3416_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3415(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3414, v ds
+# define BFI_FLINEARC_3415_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3414(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3413, v ds
+# define BFI_FLINEARC_3414_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3413(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3412, v ds
+# define BFI_FLINEARC_3413_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3412(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3411, v ds
+# define BFI_FLINEARC_3412_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3411(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3410, v ds
+# define BFI_FLINEARC_3411_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3410(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3409, v ds
+# define BFI_FLINEARC_3410_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3409(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3408, v ds
+# define BFI_FLINEARC_3409_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3408(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3407, v ds
+# define BFI_FLINEARC_3408_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3407(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3406, v ds
+# define BFI_FLINEARC_3407_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3406(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3405, v ds
+# define BFI_FLINEARC_3406_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3405(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3404, v ds
+# define BFI_FLINEARC_3405_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3404(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3403, v ds
+# define BFI_FLINEARC_3404_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3403(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3402, v ds
+# define BFI_FLINEARC_3403_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3402(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3401, v ds
+# define BFI_FLINEARC_3402_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3401(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3400, v ds
+# define BFI_FLINEARC_3401_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3400(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3399, v ds
+# define BFI_FLINEARC_3400_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3399(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3398, v ds
+# define BFI_FLINEARC_3399_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3398(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3397, v ds
+# define BFI_FLINEARC_3398_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3397(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3396, v ds
+# define BFI_FLINEARC_3397_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3396(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3395, v ds
+# define BFI_FLINEARC_3396_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3395(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3394, v ds
+# define BFI_FLINEARC_3395_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3394(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3393, v ds
+# define BFI_FLINEARC_3394_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3393(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3392, v ds
+# define BFI_FLINEARC_3393_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3392(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3391, v ds
+# define BFI_FLINEARC_3392_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3391(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3390, v ds
+# define BFI_FLINEARC_3391_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3390(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3389, v ds
+# define BFI_FLINEARC_3390_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3389(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3388, v ds
+# define BFI_FLINEARC_3389_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3388(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3387, v ds
+# define BFI_FLINEARC_3388_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3387(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3386, v ds
+# define BFI_FLINEARC_3387_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3386(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3385, v ds
+# define BFI_FLINEARC_3386_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3385(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3384, v ds
+# define BFI_FLINEARC_3385_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3384(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3383, v ds
+# define BFI_FLINEARC_3384_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3383(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3382, v ds
+# define BFI_FLINEARC_3383_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3382(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3381, v ds
+# define BFI_FLINEARC_3382_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3381(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3380, v ds
+# define BFI_FLINEARC_3381_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3380(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3379, v ds
+# define BFI_FLINEARC_3380_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3379(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3378, v ds
+# define BFI_FLINEARC_3379_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3378(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3377, v ds
+# define BFI_FLINEARC_3378_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3377(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3376, v ds
+# define BFI_FLINEARC_3377_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3376(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3375, v ds
+# define BFI_FLINEARC_3376_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3375(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3374, v ds
+# define BFI_FLINEARC_3375_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3374(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3373, v ds
+# define BFI_FLINEARC_3374_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3373(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3372, v ds
+# define BFI_FLINEARC_3373_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3372(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3371, v ds
+# define BFI_FLINEARC_3372_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3371(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3370, v ds
+# define BFI_FLINEARC_3371_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3370(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3369, v ds
+# define BFI_FLINEARC_3370_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3369(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3368, v ds
+# define BFI_FLINEARC_3369_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3368(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3367, v ds
+# define BFI_FLINEARC_3368_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3367(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3366, v ds
+# define BFI_FLINEARC_3367_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3366(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3365, v ds
+# define BFI_FLINEARC_3366_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3365(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3364, v ds
+# define BFI_FLINEARC_3365_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3364(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3363, v ds
+# define BFI_FLINEARC_3364_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3363(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3362, v ds
+# define BFI_FLINEARC_3363_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3362(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3361, v ds
+# define BFI_FLINEARC_3362_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3361(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3360, v ds
+# define BFI_FLINEARC_3361_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3360(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3359, v ds
+# define BFI_FLINEARC_3360_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3359(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3358, v ds
+# define BFI_FLINEARC_3359_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3358(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3357, v ds
+# define BFI_FLINEARC_3358_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3357(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3356, v ds
+# define BFI_FLINEARC_3357_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3356(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3355, v ds
+# define BFI_FLINEARC_3356_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3355(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3354, v ds
+# define BFI_FLINEARC_3355_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3354(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3353, v ds
+# define BFI_FLINEARC_3354_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3353(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3352, v ds
+# define BFI_FLINEARC_3353_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3352(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3351, v ds
+# define BFI_FLINEARC_3352_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3351(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3350, v ds
+# define BFI_FLINEARC_3351_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3350(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3349, v ds
+# define BFI_FLINEARC_3350_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3349(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3348, v ds
+# define BFI_FLINEARC_3349_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3348(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3347, v ds
+# define BFI_FLINEARC_3348_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3347(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3346, v ds
+# define BFI_FLINEARC_3347_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3346(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3345, v ds
+# define BFI_FLINEARC_3346_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3345(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3344, v ds
+# define BFI_FLINEARC_3345_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3344(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3343, v ds
+# define BFI_FLINEARC_3344_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3343(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3342, v ds
+# define BFI_FLINEARC_3343_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3342(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3341, v ds
+# define BFI_FLINEARC_3342_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3341(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3340, v ds
+# define BFI_FLINEARC_3341_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3340(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3339, v ds
+# define BFI_FLINEARC_3340_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3339(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3338, v ds
+# define BFI_FLINEARC_3339_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3338(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3337, v ds
+# define BFI_FLINEARC_3338_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3337(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3336, v ds
+# define BFI_FLINEARC_3337_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3336(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3335, v ds
+# define BFI_FLINEARC_3336_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3335(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3334, v ds
+# define BFI_FLINEARC_3335_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3334(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3333, v ds
+# define BFI_FLINEARC_3334_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3333(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3332, v ds
+# define BFI_FLINEARC_3333_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3332(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3331, v ds
+# define BFI_FLINEARC_3332_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3331(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3330, v ds
+# define BFI_FLINEARC_3331_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3330(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3329, v ds
+# define BFI_FLINEARC_3330_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3329(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3328, v ds
+# define BFI_FLINEARC_3329_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3328(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3327, v ds
+# define BFI_FLINEARC_3328_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3327(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3326, v ds
+# define BFI_FLINEARC_3327_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3326(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3325, v ds
+# define BFI_FLINEARC_3326_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3325(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3324, v ds
+# define BFI_FLINEARC_3325_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3324(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3323, v ds
+# define BFI_FLINEARC_3324_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3323(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3322, v ds
+# define BFI_FLINEARC_3323_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3322(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3321, v ds
+# define BFI_FLINEARC_3322_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3321(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3320, v ds
+# define BFI_FLINEARC_3321_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3320(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3319, v ds
+# define BFI_FLINEARC_3320_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3319(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3318, v ds
+# define BFI_FLINEARC_3319_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3318(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3317, v ds
+# define BFI_FLINEARC_3318_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3317(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3316, v ds
+# define BFI_FLINEARC_3317_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3316(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3315, v ds
+# define BFI_FLINEARC_3316_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3315(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3314, v ds
+# define BFI_FLINEARC_3315_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3314(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3313, v ds
+# define BFI_FLINEARC_3314_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3313(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3312, v ds
+# define BFI_FLINEARC_3313_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3312(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3311, v ds
+# define BFI_FLINEARC_3312_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3311(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3310, v ds
+# define BFI_FLINEARC_3311_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3310(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3309, v ds
+# define BFI_FLINEARC_3310_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3309(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3308, v ds
+# define BFI_FLINEARC_3309_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3308(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3307, v ds
+# define BFI_FLINEARC_3308_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3307(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3306, v ds
+# define BFI_FLINEARC_3307_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3306(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3305, v ds
+# define BFI_FLINEARC_3306_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3305(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3304, v ds
+# define BFI_FLINEARC_3305_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3304(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3303, v ds
+# define BFI_FLINEARC_3304_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3303(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3302, v ds
+# define BFI_FLINEARC_3303_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3302(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3301, v ds
+# define BFI_FLINEARC_3302_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3301(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3300, v ds
+# define BFI_FLINEARC_3301_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3300(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3299, v ds
+# define BFI_FLINEARC_3300_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3299(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3298, v ds
+# define BFI_FLINEARC_3299_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3298(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3297, v ds
+# define BFI_FLINEARC_3298_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3297(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3296, v ds
+# define BFI_FLINEARC_3297_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3296(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3295, v ds
+# define BFI_FLINEARC_3296_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3295(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3294, v ds
+# define BFI_FLINEARC_3295_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3294(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3293, v ds
+# define BFI_FLINEARC_3294_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3293(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3292, v ds
+# define BFI_FLINEARC_3293_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3292(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3291, v ds
+# define BFI_FLINEARC_3292_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3291(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3290, v ds
+# define BFI_FLINEARC_3291_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3290(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3289, v ds
+# define BFI_FLINEARC_3290_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3289(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3288, v ds
+# define BFI_FLINEARC_3289_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3288(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3287, v ds
+# define BFI_FLINEARC_3288_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3287(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3286, v ds
+# define BFI_FLINEARC_3287_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3286(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3285, v ds
+# define BFI_FLINEARC_3286_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3285(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3284, v ds
+# define BFI_FLINEARC_3285_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3284(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3283, v ds
+# define BFI_FLINEARC_3284_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3283(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3282, v ds
+# define BFI_FLINEARC_3283_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3282(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3281, v ds
+# define BFI_FLINEARC_3282_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3281(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3280, v ds
+# define BFI_FLINEARC_3281_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3280(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3279, v ds
+# define BFI_FLINEARC_3280_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3279(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3278, v ds
+# define BFI_FLINEARC_3279_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3278(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3277, v ds
+# define BFI_FLINEARC_3278_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3277(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3276, v ds
+# define BFI_FLINEARC_3277_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3276(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3275, v ds
+# define BFI_FLINEARC_3276_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3275(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3274, v ds
+# define BFI_FLINEARC_3275_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3274(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3273, v ds
+# define BFI_FLINEARC_3274_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3273(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3272, v ds
+# define BFI_FLINEARC_3273_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3272(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3271, v ds
+# define BFI_FLINEARC_3272_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3271(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3270, v ds
+# define BFI_FLINEARC_3271_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3270(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3269, v ds
+# define BFI_FLINEARC_3270_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3269(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3268, v ds
+# define BFI_FLINEARC_3269_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3268(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3267, v ds
+# define BFI_FLINEARC_3268_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3267(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3266, v ds
+# define BFI_FLINEARC_3267_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3266(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3265, v ds
+# define BFI_FLINEARC_3266_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3265(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3264, v ds
+# define BFI_FLINEARC_3265_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3264(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3263, v ds
+# define BFI_FLINEARC_3264_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3263(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3262, v ds
+# define BFI_FLINEARC_3263_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3262(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3261, v ds
+# define BFI_FLINEARC_3262_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3261(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3260, v ds
+# define BFI_FLINEARC_3261_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3260(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3259, v ds
+# define BFI_FLINEARC_3260_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3259(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3258, v ds
+# define BFI_FLINEARC_3259_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3258(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3257, v ds
+# define BFI_FLINEARC_3258_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3257(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3256, v ds
+# define BFI_FLINEARC_3257_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3256(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3255, v ds
+# define BFI_FLINEARC_3256_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3255(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3254, v ds
+# define BFI_FLINEARC_3255_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3254(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3253, v ds
+# define BFI_FLINEARC_3254_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3253(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3252, v ds
+# define BFI_FLINEARC_3253_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3252(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3251, v ds
+# define BFI_FLINEARC_3252_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3251(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3250, v ds
+# define BFI_FLINEARC_3251_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3250(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3249, v ds
+# define BFI_FLINEARC_3250_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3249(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3248, v ds
+# define BFI_FLINEARC_3249_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3248(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3247, v ds
+# define BFI_FLINEARC_3248_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3247(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3246, v ds
+# define BFI_FLINEARC_3247_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3246(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3245, v ds
+# define BFI_FLINEARC_3246_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3245(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3244, v ds
+# define BFI_FLINEARC_3245_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3244(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3243, v ds
+# define BFI_FLINEARC_3244_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3243(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3242, v ds
+# define BFI_FLINEARC_3243_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3242(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3241, v ds
+# define BFI_FLINEARC_3242_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3241(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3240, v ds
+# define BFI_FLINEARC_3241_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3240(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3239, v ds
+# define BFI_FLINEARC_3240_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3239(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3238, v ds
+# define BFI_FLINEARC_3239_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3238(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3237, v ds
+# define BFI_FLINEARC_3238_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3237(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3236, v ds
+# define BFI_FLINEARC_3237_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3236(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3235, v ds
+# define BFI_FLINEARC_3236_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3235(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3234, v ds
+# define BFI_FLINEARC_3235_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3234(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3233, v ds
+# define BFI_FLINEARC_3234_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3233(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3232, v ds
+# define BFI_FLINEARC_3233_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3232(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3231, v ds
+# define BFI_FLINEARC_3232_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3231(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3230, v ds
+# define BFI_FLINEARC_3231_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3230(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3229, v ds
+# define BFI_FLINEARC_3230_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3229(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3228, v ds
+# define BFI_FLINEARC_3229_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3228(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3227, v ds
+# define BFI_FLINEARC_3228_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3227(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3226, v ds
+# define BFI_FLINEARC_3227_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3226(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3225, v ds
+# define BFI_FLINEARC_3226_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3225(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3224, v ds
+# define BFI_FLINEARC_3225_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3224(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3223, v ds
+# define BFI_FLINEARC_3224_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3223(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3222, v ds
+# define BFI_FLINEARC_3223_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3222(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3221, v ds
+# define BFI_FLINEARC_3222_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3221(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3220, v ds
+# define BFI_FLINEARC_3221_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3220(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3219, v ds
+# define BFI_FLINEARC_3220_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3219(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3218, v ds
+# define BFI_FLINEARC_3219_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3218(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3217, v ds
+# define BFI_FLINEARC_3218_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3217(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3216, v ds
+# define BFI_FLINEARC_3217_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3216(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3215, v ds
+# define BFI_FLINEARC_3216_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3215(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3214, v ds
+# define BFI_FLINEARC_3215_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3214(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3213, v ds
+# define BFI_FLINEARC_3214_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3213(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3212, v ds
+# define BFI_FLINEARC_3213_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3212(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3211, v ds
+# define BFI_FLINEARC_3212_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3211(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3210, v ds
+# define BFI_FLINEARC_3211_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3210(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3209, v ds
+# define BFI_FLINEARC_3210_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3209(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3208, v ds
+# define BFI_FLINEARC_3209_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3208(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3207, v ds
+# define BFI_FLINEARC_3208_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3207(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3206, v ds
+# define BFI_FLINEARC_3207_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3206(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3205, v ds
+# define BFI_FLINEARC_3206_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3205(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3204, v ds
+# define BFI_FLINEARC_3205_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3204(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3203, v ds
+# define BFI_FLINEARC_3204_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3203(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3202, v ds
+# define BFI_FLINEARC_3203_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3202(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3201, v ds
+# define BFI_FLINEARC_3202_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3201(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3200, v ds
+# define BFI_FLINEARC_3201_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3200(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3199, v ds
+# define BFI_FLINEARC_3200_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3199(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3198, v ds
+# define BFI_FLINEARC_3199_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3198(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3197, v ds
+# define BFI_FLINEARC_3198_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3197(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3196, v ds
+# define BFI_FLINEARC_3197_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3196(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3195, v ds
+# define BFI_FLINEARC_3196_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3195(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3194, v ds
+# define BFI_FLINEARC_3195_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3194(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3193, v ds
+# define BFI_FLINEARC_3194_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3193(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3192, v ds
+# define BFI_FLINEARC_3193_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3192(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3191, v ds
+# define BFI_FLINEARC_3192_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3191(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3190, v ds
+# define BFI_FLINEARC_3191_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3190(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3189, v ds
+# define BFI_FLINEARC_3190_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3189(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3188, v ds
+# define BFI_FLINEARC_3189_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3188(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3187, v ds
+# define BFI_FLINEARC_3188_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3187(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3186, v ds
+# define BFI_FLINEARC_3187_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3186(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3185, v ds
+# define BFI_FLINEARC_3186_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3185(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3184, v ds
+# define BFI_FLINEARC_3185_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3184(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3183, v ds
+# define BFI_FLINEARC_3184_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3183(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3182, v ds
+# define BFI_FLINEARC_3183_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3182(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3181, v ds
+# define BFI_FLINEARC_3182_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3181(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3180, v ds
+# define BFI_FLINEARC_3181_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3180(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3179, v ds
+# define BFI_FLINEARC_3180_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3179(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3178, v ds
+# define BFI_FLINEARC_3179_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3178(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3177, v ds
+# define BFI_FLINEARC_3178_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3177(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3176, v ds
+# define BFI_FLINEARC_3177_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3176(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3175, v ds
+# define BFI_FLINEARC_3176_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3175(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3174, v ds
+# define BFI_FLINEARC_3175_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3174(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3173, v ds
+# define BFI_FLINEARC_3174_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3173(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3172, v ds
+# define BFI_FLINEARC_3173_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3172(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3171, v ds
+# define BFI_FLINEARC_3172_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3171(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3170, v ds
+# define BFI_FLINEARC_3171_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3170(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3169, v ds
+# define BFI_FLINEARC_3170_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3169(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3168, v ds
+# define BFI_FLINEARC_3169_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3168(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3167, v ds
+# define BFI_FLINEARC_3168_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3167(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3166, v ds
+# define BFI_FLINEARC_3167_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3166(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3165, v ds
+# define BFI_FLINEARC_3166_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3165(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3164, v ds
+# define BFI_FLINEARC_3165_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3164(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3163, v ds
+# define BFI_FLINEARC_3164_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3163(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3162, v ds
+# define BFI_FLINEARC_3163_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3162(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3161, v ds
+# define BFI_FLINEARC_3162_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3161(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3160, v ds
+# define BFI_FLINEARC_3161_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3160(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3159, v ds
+# define BFI_FLINEARC_3160_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3159(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3158, v ds
+# define BFI_FLINEARC_3159_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3158(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3157, v ds
+# define BFI_FLINEARC_3158_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3157(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3156, v ds
+# define BFI_FLINEARC_3157_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3156(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3155, v ds
+# define BFI_FLINEARC_3156_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3155(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3154, v ds
+# define BFI_FLINEARC_3155_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3154(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3153, v ds
+# define BFI_FLINEARC_3154_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3153(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3152, v ds
+# define BFI_FLINEARC_3153_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3152(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3151, v ds
+# define BFI_FLINEARC_3152_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3151(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3150, v ds
+# define BFI_FLINEARC_3151_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3150(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3149, v ds
+# define BFI_FLINEARC_3150_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3149(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3148, v ds
+# define BFI_FLINEARC_3149_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3148(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3147, v ds
+# define BFI_FLINEARC_3148_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3147(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3146, v ds
+# define BFI_FLINEARC_3147_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3146(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3145, v ds
+# define BFI_FLINEARC_3146_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3145(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3144, v ds
+# define BFI_FLINEARC_3145_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3144(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3143, v ds
+# define BFI_FLINEARC_3144_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3143(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3142, v ds
+# define BFI_FLINEARC_3143_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3142(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3141, v ds
+# define BFI_FLINEARC_3142_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3141(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3140, v ds
+# define BFI_FLINEARC_3141_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3140(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3139, v ds
+# define BFI_FLINEARC_3140_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3139(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3138, v ds
+# define BFI_FLINEARC_3139_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3138(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3137, v ds
+# define BFI_FLINEARC_3138_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3137(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3136, v ds
+# define BFI_FLINEARC_3137_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3136(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3135, v ds
+# define BFI_FLINEARC_3136_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3135(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3134, v ds
+# define BFI_FLINEARC_3135_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3134(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3133, v ds
+# define BFI_FLINEARC_3134_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3133(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3132, v ds
+# define BFI_FLINEARC_3133_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3132(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3131, v ds
+# define BFI_FLINEARC_3132_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3131(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3130, v ds
+# define BFI_FLINEARC_3131_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3130(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3129, v ds
+# define BFI_FLINEARC_3130_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3129(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3128, v ds
+# define BFI_FLINEARC_3129_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3128(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3127, v ds
+# define BFI_FLINEARC_3128_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3127(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3126, v ds
+# define BFI_FLINEARC_3127_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3126(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3125, v ds
+# define BFI_FLINEARC_3126_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3125(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3124, v ds
+# define BFI_FLINEARC_3125_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3124(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3123, v ds
+# define BFI_FLINEARC_3124_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3123(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3122, v ds
+# define BFI_FLINEARC_3123_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3122(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3121, v ds
+# define BFI_FLINEARC_3122_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3121(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3120, v ds
+# define BFI_FLINEARC_3121_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3120(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3119, v ds
+# define BFI_FLINEARC_3120_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3119(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3118, v ds
+# define BFI_FLINEARC_3119_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3118(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3117, v ds
+# define BFI_FLINEARC_3118_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3117(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3116, v ds
+# define BFI_FLINEARC_3117_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3116(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3115, v ds
+# define BFI_FLINEARC_3116_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3115(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3114, v ds
+# define BFI_FLINEARC_3115_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3114(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3113, v ds
+# define BFI_FLINEARC_3114_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3113(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3112, v ds
+# define BFI_FLINEARC_3113_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3112(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3111, v ds
+# define BFI_FLINEARC_3112_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3111(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3110, v ds
+# define BFI_FLINEARC_3111_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3110(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3109, v ds
+# define BFI_FLINEARC_3110_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3109(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3108, v ds
+# define BFI_FLINEARC_3109_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3108(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3107, v ds
+# define BFI_FLINEARC_3108_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3107(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3106, v ds
+# define BFI_FLINEARC_3107_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3106(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3105, v ds
+# define BFI_FLINEARC_3106_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3105(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3104, v ds
+# define BFI_FLINEARC_3105_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3104(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3103, v ds
+# define BFI_FLINEARC_3104_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3103(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3102, v ds
+# define BFI_FLINEARC_3103_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3102(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3101, v ds
+# define BFI_FLINEARC_3102_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3101(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3100, v ds
+# define BFI_FLINEARC_3101_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3100(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3099, v ds
+# define BFI_FLINEARC_3100_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3099(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3098, v ds
+# define BFI_FLINEARC_3099_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3098(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3097, v ds
+# define BFI_FLINEARC_3098_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3097(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3096, v ds
+# define BFI_FLINEARC_3097_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3096(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3095, v ds
+# define BFI_FLINEARC_3096_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3095(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3094, v ds
+# define BFI_FLINEARC_3095_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3094(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3093, v ds
+# define BFI_FLINEARC_3094_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3093(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3092, v ds
+# define BFI_FLINEARC_3093_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3092(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3091, v ds
+# define BFI_FLINEARC_3092_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3091(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3090, v ds
+# define BFI_FLINEARC_3091_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3090(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3089, v ds
+# define BFI_FLINEARC_3090_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3089(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3088, v ds
+# define BFI_FLINEARC_3089_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3088(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3087, v ds
+# define BFI_FLINEARC_3088_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3087(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3086, v ds
+# define BFI_FLINEARC_3087_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3086(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3085, v ds
+# define BFI_FLINEARC_3086_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3085(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3084, v ds
+# define BFI_FLINEARC_3085_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3084(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3083, v ds
+# define BFI_FLINEARC_3084_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3083(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3082, v ds
+# define BFI_FLINEARC_3083_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3082(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3081, v ds
+# define BFI_FLINEARC_3082_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3081(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3080, v ds
+# define BFI_FLINEARC_3081_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3080(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3079, v ds
+# define BFI_FLINEARC_3080_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3079(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3078, v ds
+# define BFI_FLINEARC_3079_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3078(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3077, v ds
+# define BFI_FLINEARC_3078_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3077(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3076, v ds
+# define BFI_FLINEARC_3077_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3076(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3075, v ds
+# define BFI_FLINEARC_3076_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3075(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3074, v ds
+# define BFI_FLINEARC_3075_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3074(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3073, v ds
+# define BFI_FLINEARC_3074_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3073(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3072, v ds
+# define BFI_FLINEARC_3073_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3072(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3071, v ds
+# define BFI_FLINEARC_3072_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3071(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3070, v ds
+# define BFI_FLINEARC_3071_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3070(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3069, v ds
+# define BFI_FLINEARC_3070_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3069(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3068, v ds
+# define BFI_FLINEARC_3069_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3068(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3067, v ds
+# define BFI_FLINEARC_3068_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3067(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3066, v ds
+# define BFI_FLINEARC_3067_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3066(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3065, v ds
+# define BFI_FLINEARC_3066_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3065(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3064, v ds
+# define BFI_FLINEARC_3065_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3064(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3063, v ds
+# define BFI_FLINEARC_3064_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3063(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3062, v ds
+# define BFI_FLINEARC_3063_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3062(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3061, v ds
+# define BFI_FLINEARC_3062_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3061(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3060, v ds
+# define BFI_FLINEARC_3061_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3060(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3059, v ds
+# define BFI_FLINEARC_3060_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3059(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3058, v ds
+# define BFI_FLINEARC_3059_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3058(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3057, v ds
+# define BFI_FLINEARC_3058_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3057(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3056, v ds
+# define BFI_FLINEARC_3057_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3056(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3055, v ds
+# define BFI_FLINEARC_3056_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3055(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3054, v ds
+# define BFI_FLINEARC_3055_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3054(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3053, v ds
+# define BFI_FLINEARC_3054_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3053(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3052, v ds
+# define BFI_FLINEARC_3053_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3052(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3051, v ds
+# define BFI_FLINEARC_3052_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3051(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3050, v ds
+# define BFI_FLINEARC_3051_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3050(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3049, v ds
+# define BFI_FLINEARC_3050_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3049(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3048, v ds
+# define BFI_FLINEARC_3049_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3048(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3047, v ds
+# define BFI_FLINEARC_3048_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3047(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3046, v ds
+# define BFI_FLINEARC_3047_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3046(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3045, v ds
+# define BFI_FLINEARC_3046_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3045(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3044, v ds
+# define BFI_FLINEARC_3045_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3044(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3043, v ds
+# define BFI_FLINEARC_3044_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3043(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3042, v ds
+# define BFI_FLINEARC_3043_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3042(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3041, v ds
+# define BFI_FLINEARC_3042_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3041(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3040, v ds
+# define BFI_FLINEARC_3041_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3040(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3039, v ds
+# define BFI_FLINEARC_3040_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3039(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3038, v ds
+# define BFI_FLINEARC_3039_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3038(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3037, v ds
+# define BFI_FLINEARC_3038_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3037(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3036, v ds
+# define BFI_FLINEARC_3037_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3036(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3035, v ds
+# define BFI_FLINEARC_3036_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3035(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3034, v ds
+# define BFI_FLINEARC_3035_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3034(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3033, v ds
+# define BFI_FLINEARC_3034_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3033(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3032, v ds
+# define BFI_FLINEARC_3033_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3032(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3031, v ds
+# define BFI_FLINEARC_3032_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3031(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3030, v ds
+# define BFI_FLINEARC_3031_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3030(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3029, v ds
+# define BFI_FLINEARC_3030_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3029(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3028, v ds
+# define BFI_FLINEARC_3029_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3028(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3027, v ds
+# define BFI_FLINEARC_3028_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3027(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3026, v ds
+# define BFI_FLINEARC_3027_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3026(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3025, v ds
+# define BFI_FLINEARC_3026_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3025(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3024, v ds
+# define BFI_FLINEARC_3025_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3024(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3023, v ds
+# define BFI_FLINEARC_3024_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3023(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3022, v ds
+# define BFI_FLINEARC_3023_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3022(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3021, v ds
+# define BFI_FLINEARC_3022_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3021(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3020, v ds
+# define BFI_FLINEARC_3021_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3020(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3019, v ds
+# define BFI_FLINEARC_3020_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3019(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3018, v ds
+# define BFI_FLINEARC_3019_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3018(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3017, v ds
+# define BFI_FLINEARC_3018_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3017(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3016, v ds
+# define BFI_FLINEARC_3017_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3016(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3015, v ds
+# define BFI_FLINEARC_3016_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3015(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3014, v ds
+# define BFI_FLINEARC_3015_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3014(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3013, v ds
+# define BFI_FLINEARC_3014_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3013(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3012, v ds
+# define BFI_FLINEARC_3013_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3012(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3011, v ds
+# define BFI_FLINEARC_3012_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3011(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3010, v ds
+# define BFI_FLINEARC_3011_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3010(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3009, v ds
+# define BFI_FLINEARC_3010_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3009(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3008, v ds
+# define BFI_FLINEARC_3009_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3008(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3007, v ds
+# define BFI_FLINEARC_3008_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3007(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3006, v ds
+# define BFI_FLINEARC_3007_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3006(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3005, v ds
+# define BFI_FLINEARC_3006_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3005(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3004, v ds
+# define BFI_FLINEARC_3005_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3004(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3003, v ds
+# define BFI_FLINEARC_3004_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3003(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3002, v ds
+# define BFI_FLINEARC_3003_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3002(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3001, v ds
+# define BFI_FLINEARC_3002_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3001(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3000, v ds
+# define BFI_FLINEARC_3001_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3000(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2999, v ds
+# define BFI_FLINEARC_3000_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2999(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2998, v ds
+# define BFI_FLINEARC_2999_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2998(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2997, v ds
+# define BFI_FLINEARC_2998_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2997(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2996, v ds
+# define BFI_FLINEARC_2997_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2996(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2995, v ds
+# define BFI_FLINEARC_2996_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2995(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2994, v ds
+# define BFI_FLINEARC_2995_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2994(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2993, v ds
+# define BFI_FLINEARC_2994_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2993(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2992, v ds
+# define BFI_FLINEARC_2993_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2992(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2991, v ds
+# define BFI_FLINEARC_2992_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2991(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2990, v ds
+# define BFI_FLINEARC_2991_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2990(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2989, v ds
+# define BFI_FLINEARC_2990_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2989(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2988, v ds
+# define BFI_FLINEARC_2989_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2988(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2987, v ds
+# define BFI_FLINEARC_2988_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2987(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2986, v ds
+# define BFI_FLINEARC_2987_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2986(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2985, v ds
+# define BFI_FLINEARC_2986_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2985(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2984, v ds
+# define BFI_FLINEARC_2985_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2984(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2983, v ds
+# define BFI_FLINEARC_2984_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2983(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2982, v ds
+# define BFI_FLINEARC_2983_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2982(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2981, v ds
+# define BFI_FLINEARC_2982_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2981(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2980, v ds
+# define BFI_FLINEARC_2981_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2980(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2979, v ds
+# define BFI_FLINEARC_2980_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2979(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2978, v ds
+# define BFI_FLINEARC_2979_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2978(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2977, v ds
+# define BFI_FLINEARC_2978_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2977(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2976, v ds
+# define BFI_FLINEARC_2977_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2976(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2975, v ds
+# define BFI_FLINEARC_2976_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2975(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2974, v ds
+# define BFI_FLINEARC_2975_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2974(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2973, v ds
+# define BFI_FLINEARC_2974_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2973(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2972, v ds
+# define BFI_FLINEARC_2973_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2972(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2971, v ds
+# define BFI_FLINEARC_2972_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2971(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2970, v ds
+# define BFI_FLINEARC_2971_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2970(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2969, v ds
+# define BFI_FLINEARC_2970_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2969(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2968, v ds
+# define BFI_FLINEARC_2969_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2968(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2967, v ds
+# define BFI_FLINEARC_2968_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2967(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2966, v ds
+# define BFI_FLINEARC_2967_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2966(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2965, v ds
+# define BFI_FLINEARC_2966_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2965(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2964, v ds
+# define BFI_FLINEARC_2965_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2964(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2963, v ds
+# define BFI_FLINEARC_2964_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2963(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2962, v ds
+# define BFI_FLINEARC_2963_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2962(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2961, v ds
+# define BFI_FLINEARC_2962_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2961(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2960, v ds
+# define BFI_FLINEARC_2961_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2960(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2959, v ds
+# define BFI_FLINEARC_2960_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2959(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2958, v ds
+# define BFI_FLINEARC_2959_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2958(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2957, v ds
+# define BFI_FLINEARC_2958_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2957(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2956, v ds
+# define BFI_FLINEARC_2957_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2956(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2955, v ds
+# define BFI_FLINEARC_2956_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2955(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2954, v ds
+# define BFI_FLINEARC_2955_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2954(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2953, v ds
+# define BFI_FLINEARC_2954_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2953(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2952, v ds
+# define BFI_FLINEARC_2953_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2952(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2951, v ds
+# define BFI_FLINEARC_2952_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2951(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2950, v ds
+# define BFI_FLINEARC_2951_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2950(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2949, v ds
+# define BFI_FLINEARC_2950_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2949(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2948, v ds
+# define BFI_FLINEARC_2949_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2948(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2947, v ds
+# define BFI_FLINEARC_2948_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2947(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2946, v ds
+# define BFI_FLINEARC_2947_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2946(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2945, v ds
+# define BFI_FLINEARC_2946_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2945(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2944, v ds
+# define BFI_FLINEARC_2945_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2944(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2943, v ds
+# define BFI_FLINEARC_2944_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2943(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2942, v ds
+# define BFI_FLINEARC_2943_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2942(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2941, v ds
+# define BFI_FLINEARC_2942_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2941(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2940, v ds
+# define BFI_FLINEARC_2941_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2940(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2939, v ds
+# define BFI_FLINEARC_2940_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2939(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2938, v ds
+# define BFI_FLINEARC_2939_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2938(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2937, v ds
+# define BFI_FLINEARC_2938_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2937(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2936, v ds
+# define BFI_FLINEARC_2937_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2936(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2935, v ds
+# define BFI_FLINEARC_2936_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2935(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2934, v ds
+# define BFI_FLINEARC_2935_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2934(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2933, v ds
+# define BFI_FLINEARC_2934_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2933(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2932, v ds
+# define BFI_FLINEARC_2933_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2932(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2931, v ds
+# define BFI_FLINEARC_2932_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2931(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2930, v ds
+# define BFI_FLINEARC_2931_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2930(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2929, v ds
+# define BFI_FLINEARC_2930_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2929(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2928, v ds
+# define BFI_FLINEARC_2929_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2928(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2927, v ds
+# define BFI_FLINEARC_2928_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2927(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2926, v ds
+# define BFI_FLINEARC_2927_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2926(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2925, v ds
+# define BFI_FLINEARC_2926_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2925(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2924, v ds
+# define BFI_FLINEARC_2925_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2924(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2923, v ds
+# define BFI_FLINEARC_2924_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2923(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2922, v ds
+# define BFI_FLINEARC_2923_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2922(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2921, v ds
+# define BFI_FLINEARC_2922_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2921(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2920, v ds
+# define BFI_FLINEARC_2921_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2920(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2919, v ds
+# define BFI_FLINEARC_2920_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2919(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2918, v ds
+# define BFI_FLINEARC_2919_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2918(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2917, v ds
+# define BFI_FLINEARC_2918_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2917(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2916, v ds
+# define BFI_FLINEARC_2917_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2916(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2915, v ds
+# define BFI_FLINEARC_2916_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2915(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2914, v ds
+# define BFI_FLINEARC_2915_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2914(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2913, v ds
+# define BFI_FLINEARC_2914_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2913(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2912, v ds
+# define BFI_FLINEARC_2913_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2912(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2911, v ds
+# define BFI_FLINEARC_2912_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2911(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2910, v ds
+# define BFI_FLINEARC_2911_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2910(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2909, v ds
+# define BFI_FLINEARC_2910_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2909(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2908, v ds
+# define BFI_FLINEARC_2909_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2908(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2907, v ds
+# define BFI_FLINEARC_2908_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2907(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2906, v ds
+# define BFI_FLINEARC_2907_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2906(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2905, v ds
+# define BFI_FLINEARC_2906_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2905(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2904, v ds
+# define BFI_FLINEARC_2905_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2904(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2903, v ds
+# define BFI_FLINEARC_2904_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2903(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2902, v ds
+# define BFI_FLINEARC_2903_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2902(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2901, v ds
+# define BFI_FLINEARC_2902_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2901(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2900, v ds
+# define BFI_FLINEARC_2901_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2900(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2899, v ds
+# define BFI_FLINEARC_2900_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2899(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2898, v ds
+# define BFI_FLINEARC_2899_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2898(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2897, v ds
+# define BFI_FLINEARC_2898_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2897(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2896, v ds
+# define BFI_FLINEARC_2897_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2896(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2895, v ds
+# define BFI_FLINEARC_2896_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2895(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2894, v ds
+# define BFI_FLINEARC_2895_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2894(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2893, v ds
+# define BFI_FLINEARC_2894_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2893(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2892, v ds
+# define BFI_FLINEARC_2893_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2892(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2891, v ds
+# define BFI_FLINEARC_2892_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2891(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2890, v ds
+# define BFI_FLINEARC_2891_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2890(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2889, v ds
+# define BFI_FLINEARC_2890_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2889(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2888, v ds
+# define BFI_FLINEARC_2889_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2888(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2887, v ds
+# define BFI_FLINEARC_2888_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2887(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2886, v ds
+# define BFI_FLINEARC_2887_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2886(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2885, v ds
+# define BFI_FLINEARC_2886_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2885(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2884, v ds
+# define BFI_FLINEARC_2885_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2884(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2883, v ds
+# define BFI_FLINEARC_2884_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2883(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2882, v ds
+# define BFI_FLINEARC_2883_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2882(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2881, v ds
+# define BFI_FLINEARC_2882_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2881(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2880, v ds
+# define BFI_FLINEARC_2881_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2880(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2879, v ds
+# define BFI_FLINEARC_2880_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2879(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2878, v ds
+# define BFI_FLINEARC_2879_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2878(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2877, v ds
+# define BFI_FLINEARC_2878_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2877(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2876, v ds
+# define BFI_FLINEARC_2877_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2876(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2875, v ds
+# define BFI_FLINEARC_2876_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2875(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2874, v ds
+# define BFI_FLINEARC_2875_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2874(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2873, v ds
+# define BFI_FLINEARC_2874_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2873(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2872, v ds
+# define BFI_FLINEARC_2873_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2872(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2871, v ds
+# define BFI_FLINEARC_2872_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2871(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2870, v ds
+# define BFI_FLINEARC_2871_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2870(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2869, v ds
+# define BFI_FLINEARC_2870_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2869(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2868, v ds
+# define BFI_FLINEARC_2869_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2868(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2867, v ds
+# define BFI_FLINEARC_2868_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2867(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2866, v ds
+# define BFI_FLINEARC_2867_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2866(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2865, v ds
+# define BFI_FLINEARC_2866_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2865(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2864, v ds
+# define BFI_FLINEARC_2865_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2864(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2863, v ds
+# define BFI_FLINEARC_2864_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2863(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2862, v ds
+# define BFI_FLINEARC_2863_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2862(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2861, v ds
+# define BFI_FLINEARC_2862_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2861(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2860, v ds
+# define BFI_FLINEARC_2861_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2860(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2859, v ds
+# define BFI_FLINEARC_2860_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2859(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2858, v ds
+# define BFI_FLINEARC_2859_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2858(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2857, v ds
+# define BFI_FLINEARC_2858_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2857(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2856, v ds
+# define BFI_FLINEARC_2857_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2856(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2855, v ds
+# define BFI_FLINEARC_2856_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2855(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2854, v ds
+# define BFI_FLINEARC_2855_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2854(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2853, v ds
+# define BFI_FLINEARC_2854_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2853(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2852, v ds
+# define BFI_FLINEARC_2853_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2852(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2851, v ds
+# define BFI_FLINEARC_2852_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2851(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2850, v ds
+# define BFI_FLINEARC_2851_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2850(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2849, v ds
+# define BFI_FLINEARC_2850_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2849(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2848, v ds
+# define BFI_FLINEARC_2849_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2848(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2847, v ds
+# define BFI_FLINEARC_2848_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2847(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2846, v ds
+# define BFI_FLINEARC_2847_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2846(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2845, v ds
+# define BFI_FLINEARC_2846_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2845(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2844, v ds
+# define BFI_FLINEARC_2845_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2844(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2843, v ds
+# define BFI_FLINEARC_2844_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2843(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2842, v ds
+# define BFI_FLINEARC_2843_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2842(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2841, v ds
+# define BFI_FLINEARC_2842_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2841(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2840, v ds
+# define BFI_FLINEARC_2841_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2840(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2839, v ds
+# define BFI_FLINEARC_2840_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2839(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2838, v ds
+# define BFI_FLINEARC_2839_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2838(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2837, v ds
+# define BFI_FLINEARC_2838_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2837(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2836, v ds
+# define BFI_FLINEARC_2837_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2836(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2835, v ds
+# define BFI_FLINEARC_2836_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2835(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2834, v ds
+# define BFI_FLINEARC_2835_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2834(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2833, v ds
+# define BFI_FLINEARC_2834_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2833(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2832, v ds
+# define BFI_FLINEARC_2833_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2832(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2831, v ds
+# define BFI_FLINEARC_2832_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2831(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2830, v ds
+# define BFI_FLINEARC_2831_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2830(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2829, v ds
+# define BFI_FLINEARC_2830_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2829(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2828, v ds
+# define BFI_FLINEARC_2829_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2828(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2827, v ds
+# define BFI_FLINEARC_2828_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2827(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2826, v ds
+# define BFI_FLINEARC_2827_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2826(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2825, v ds
+# define BFI_FLINEARC_2826_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2825(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2824, v ds
+# define BFI_FLINEARC_2825_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2824(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2823, v ds
+# define BFI_FLINEARC_2824_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2823(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2822, v ds
+# define BFI_FLINEARC_2823_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2822(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2821, v ds
+# define BFI_FLINEARC_2822_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2821(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2820, v ds
+# define BFI_FLINEARC_2821_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2820(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2819, v ds
+# define BFI_FLINEARC_2820_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2819(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2818, v ds
+# define BFI_FLINEARC_2819_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2818(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2817, v ds
+# define BFI_FLINEARC_2818_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2817(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2816, v ds
+# define BFI_FLINEARC_2817_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2816(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2815, v ds
+# define BFI_FLINEARC_2816_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2815(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2814, v ds
+# define BFI_FLINEARC_2815_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2814(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2813, v ds
+# define BFI_FLINEARC_2814_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2813(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2812, v ds
+# define BFI_FLINEARC_2813_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2812(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2811, v ds
+# define BFI_FLINEARC_2812_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2811(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2810, v ds
+# define BFI_FLINEARC_2811_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2810(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2809, v ds
+# define BFI_FLINEARC_2810_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2809(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2808, v ds
+# define BFI_FLINEARC_2809_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2808(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2807, v ds
+# define BFI_FLINEARC_2808_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2807(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2806, v ds
+# define BFI_FLINEARC_2807_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2806(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2805, v ds
+# define BFI_FLINEARC_2806_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2805(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2804, v ds
+# define BFI_FLINEARC_2805_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2804(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2803, v ds
+# define BFI_FLINEARC_2804_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2803(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2802, v ds
+# define BFI_FLINEARC_2803_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2802(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2801, v ds
+# define BFI_FLINEARC_2802_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2801(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2800, v ds
+# define BFI_FLINEARC_2801_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2800(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2799, v ds
+# define BFI_FLINEARC_2800_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2799(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2798, v ds
+# define BFI_FLINEARC_2799_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2798(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2797, v ds
+# define BFI_FLINEARC_2798_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2797(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2796, v ds
+# define BFI_FLINEARC_2797_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2796(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2795, v ds
+# define BFI_FLINEARC_2796_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2795(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2794, v ds
+# define BFI_FLINEARC_2795_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2794(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2793, v ds
+# define BFI_FLINEARC_2794_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2793(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2792, v ds
+# define BFI_FLINEARC_2793_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2792(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2791, v ds
+# define BFI_FLINEARC_2792_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2791(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2790, v ds
+# define BFI_FLINEARC_2791_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2790(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2789, v ds
+# define BFI_FLINEARC_2790_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2789(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2788, v ds
+# define BFI_FLINEARC_2789_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2788(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2787, v ds
+# define BFI_FLINEARC_2788_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2787(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2786, v ds
+# define BFI_FLINEARC_2787_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2786(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2785, v ds
+# define BFI_FLINEARC_2786_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2785(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2784, v ds
+# define BFI_FLINEARC_2785_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2784(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2783, v ds
+# define BFI_FLINEARC_2784_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2783(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2782, v ds
+# define BFI_FLINEARC_2783_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2782(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2781, v ds
+# define BFI_FLINEARC_2782_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2781(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2780, v ds
+# define BFI_FLINEARC_2781_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2780(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2779, v ds
+# define BFI_FLINEARC_2780_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2779(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2778, v ds
+# define BFI_FLINEARC_2779_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2778(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2777, v ds
+# define BFI_FLINEARC_2778_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2777(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2776, v ds
+# define BFI_FLINEARC_2777_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2776(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2775, v ds
+# define BFI_FLINEARC_2776_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2775(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2774, v ds
+# define BFI_FLINEARC_2775_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2774(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2773, v ds
+# define BFI_FLINEARC_2774_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2773(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2772, v ds
+# define BFI_FLINEARC_2773_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2772(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2771, v ds
+# define BFI_FLINEARC_2772_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2771(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2770, v ds
+# define BFI_FLINEARC_2771_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2770(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2769, v ds
+# define BFI_FLINEARC_2770_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2769(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2768, v ds
+# define BFI_FLINEARC_2769_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2768(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2767, v ds
+# define BFI_FLINEARC_2768_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2767(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2766, v ds
+# define BFI_FLINEARC_2767_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2766(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2765, v ds
+# define BFI_FLINEARC_2766_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2765(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2764, v ds
+# define BFI_FLINEARC_2765_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2764(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2763, v ds
+# define BFI_FLINEARC_2764_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2763(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2762, v ds
+# define BFI_FLINEARC_2763_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2762(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2761, v ds
+# define BFI_FLINEARC_2762_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2761(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2760, v ds
+# define BFI_FLINEARC_2761_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2760(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2759, v ds
+# define BFI_FLINEARC_2760_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2759(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2758, v ds
+# define BFI_FLINEARC_2759_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2758(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2757, v ds
+# define BFI_FLINEARC_2758_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2757(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2756, v ds
+# define BFI_FLINEARC_2757_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2756(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2755, v ds
+# define BFI_FLINEARC_2756_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2755(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2754, v ds
+# define BFI_FLINEARC_2755_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2754(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2753, v ds
+# define BFI_FLINEARC_2754_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2753(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2752, v ds
+# define BFI_FLINEARC_2753_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2752(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2751, v ds
+# define BFI_FLINEARC_2752_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2751(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2750, v ds
+# define BFI_FLINEARC_2751_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2750(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2749, v ds
+# define BFI_FLINEARC_2750_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2749(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2748, v ds
+# define BFI_FLINEARC_2749_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2748(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2747, v ds
+# define BFI_FLINEARC_2748_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2747(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2746, v ds
+# define BFI_FLINEARC_2747_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2746(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2745, v ds
+# define BFI_FLINEARC_2746_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2745(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2744, v ds
+# define BFI_FLINEARC_2745_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2744(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2743, v ds
+# define BFI_FLINEARC_2744_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2743(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2742, v ds
+# define BFI_FLINEARC_2743_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2742(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2741, v ds
+# define BFI_FLINEARC_2742_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2741(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2740, v ds
+# define BFI_FLINEARC_2741_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2740(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2739, v ds
+# define BFI_FLINEARC_2740_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2739(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2738, v ds
+# define BFI_FLINEARC_2739_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2738(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2737, v ds
+# define BFI_FLINEARC_2738_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2737(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2736, v ds
+# define BFI_FLINEARC_2737_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2736(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2735, v ds
+# define BFI_FLINEARC_2736_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2735(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2734, v ds
+# define BFI_FLINEARC_2735_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2734(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2733, v ds
+# define BFI_FLINEARC_2734_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2733(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2732, v ds
+# define BFI_FLINEARC_2733_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2732(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2731, v ds
+# define BFI_FLINEARC_2732_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2731(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2730, v ds
+# define BFI_FLINEARC_2731_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2730(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2729, v ds
+# define BFI_FLINEARC_2730_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2729(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2728, v ds
+# define BFI_FLINEARC_2729_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2728(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2727, v ds
+# define BFI_FLINEARC_2728_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2727(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2726, v ds
+# define BFI_FLINEARC_2727_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2726(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2725, v ds
+# define BFI_FLINEARC_2726_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2725(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2724, v ds
+# define BFI_FLINEARC_2725_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2724(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2723, v ds
+# define BFI_FLINEARC_2724_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2723(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2722, v ds
+# define BFI_FLINEARC_2723_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2722(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2721, v ds
+# define BFI_FLINEARC_2722_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2721(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2720, v ds
+# define BFI_FLINEARC_2721_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2720(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2719, v ds
+# define BFI_FLINEARC_2720_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2719(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2718, v ds
+# define BFI_FLINEARC_2719_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2718(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2717, v ds
+# define BFI_FLINEARC_2718_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2717(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2716, v ds
+# define BFI_FLINEARC_2717_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2716(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2715, v ds
+# define BFI_FLINEARC_2716_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2715(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2714, v ds
+# define BFI_FLINEARC_2715_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2714(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2713, v ds
+# define BFI_FLINEARC_2714_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2713(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2712, v ds
+# define BFI_FLINEARC_2713_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2712(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2711, v ds
+# define BFI_FLINEARC_2712_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2711(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2710, v ds
+# define BFI_FLINEARC_2711_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2710(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2709, v ds
+# define BFI_FLINEARC_2710_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2709(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2708, v ds
+# define BFI_FLINEARC_2709_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2708(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2707, v ds
+# define BFI_FLINEARC_2708_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2707(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2706, v ds
+# define BFI_FLINEARC_2707_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2706(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2705, v ds
+# define BFI_FLINEARC_2706_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2705(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2704, v ds
+# define BFI_FLINEARC_2705_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2704(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2703, v ds
+# define BFI_FLINEARC_2704_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2703(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2702, v ds
+# define BFI_FLINEARC_2703_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2702(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2701, v ds
+# define BFI_FLINEARC_2702_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2701(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2700, v ds
+# define BFI_FLINEARC_2701_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2700(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2699, v ds
+# define BFI_FLINEARC_2700_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2699(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2698, v ds
+# define BFI_FLINEARC_2699_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2698(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2697, v ds
+# define BFI_FLINEARC_2698_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2697(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2696, v ds
+# define BFI_FLINEARC_2697_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2696(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2695, v ds
+# define BFI_FLINEARC_2696_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2695(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2694, v ds
+# define BFI_FLINEARC_2695_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2694(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2693, v ds
+# define BFI_FLINEARC_2694_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2693(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2692, v ds
+# define BFI_FLINEARC_2693_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2692(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2691, v ds
+# define BFI_FLINEARC_2692_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2691(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2690, v ds
+# define BFI_FLINEARC_2691_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2690(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2689, v ds
+# define BFI_FLINEARC_2690_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2689(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2688, v ds
+# define BFI_FLINEARC_2689_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2688(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2687, v ds
+# define BFI_FLINEARC_2688_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2687(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2686, v ds
+# define BFI_FLINEARC_2687_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2686(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2685, v ds
+# define BFI_FLINEARC_2686_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2685(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2684, v ds
+# define BFI_FLINEARC_2685_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2684(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2683, v ds
+# define BFI_FLINEARC_2684_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2683(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2682, v ds
+# define BFI_FLINEARC_2683_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2682(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2681, v ds
+# define BFI_FLINEARC_2682_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2681(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2680, v ds
+# define BFI_FLINEARC_2681_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2680(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2679, v ds
+# define BFI_FLINEARC_2680_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2679(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2678, v ds
+# define BFI_FLINEARC_2679_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2678(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2677, v ds
+# define BFI_FLINEARC_2678_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2677(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2676, v ds
+# define BFI_FLINEARC_2677_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2676(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2675, v ds
+# define BFI_FLINEARC_2676_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2675(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2674, v ds
+# define BFI_FLINEARC_2675_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2674(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2673, v ds
+# define BFI_FLINEARC_2674_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2673(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2672, v ds
+# define BFI_FLINEARC_2673_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2672(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2671, v ds
+# define BFI_FLINEARC_2672_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2671(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2670, v ds
+# define BFI_FLINEARC_2671_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2670(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2669, v ds
+# define BFI_FLINEARC_2670_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2669(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2668, v ds
+# define BFI_FLINEARC_2669_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2668(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2667, v ds
+# define BFI_FLINEARC_2668_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2667(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2666, v ds
+# define BFI_FLINEARC_2667_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2666(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2665, v ds
+# define BFI_FLINEARC_2666_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2665(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2664, v ds
+# define BFI_FLINEARC_2665_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2664(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2663, v ds
+# define BFI_FLINEARC_2664_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2663(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2662, v ds
+# define BFI_FLINEARC_2663_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2662(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2661, v ds
+# define BFI_FLINEARC_2662_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2661(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2660, v ds
+# define BFI_FLINEARC_2661_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2660(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2659, v ds
+# define BFI_FLINEARC_2660_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2659(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2658, v ds
+# define BFI_FLINEARC_2659_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2658(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2657, v ds
+# define BFI_FLINEARC_2658_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2657(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2656, v ds
+# define BFI_FLINEARC_2657_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2656(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2655, v ds
+# define BFI_FLINEARC_2656_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2655(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2654, v ds
+# define BFI_FLINEARC_2655_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2654(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2653, v ds
+# define BFI_FLINEARC_2654_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2653(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2652, v ds
+# define BFI_FLINEARC_2653_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2652(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2651, v ds
+# define BFI_FLINEARC_2652_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2651(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2650, v ds
+# define BFI_FLINEARC_2651_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2650(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2649, v ds
+# define BFI_FLINEARC_2650_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2649(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2648, v ds
+# define BFI_FLINEARC_2649_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2648(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2647, v ds
+# define BFI_FLINEARC_2648_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2647(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2646, v ds
+# define BFI_FLINEARC_2647_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2646(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2645, v ds
+# define BFI_FLINEARC_2646_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2645(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2644, v ds
+# define BFI_FLINEARC_2645_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2644(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2643, v ds
+# define BFI_FLINEARC_2644_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2643(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2642, v ds
+# define BFI_FLINEARC_2643_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2642(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2641, v ds
+# define BFI_FLINEARC_2642_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2641(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2640, v ds
+# define BFI_FLINEARC_2641_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2640(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2639, v ds
+# define BFI_FLINEARC_2640_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2639(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2638, v ds
+# define BFI_FLINEARC_2639_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2638(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2637, v ds
+# define BFI_FLINEARC_2638_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2637(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2636, v ds
+# define BFI_FLINEARC_2637_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2636(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2635, v ds
+# define BFI_FLINEARC_2636_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2635(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2634, v ds
+# define BFI_FLINEARC_2635_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2634(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2633, v ds
+# define BFI_FLINEARC_2634_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2633(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2632, v ds
+# define BFI_FLINEARC_2633_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2632(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2631, v ds
+# define BFI_FLINEARC_2632_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2631(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2630, v ds
+# define BFI_FLINEARC_2631_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2630(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2629, v ds
+# define BFI_FLINEARC_2630_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2629(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2628, v ds
+# define BFI_FLINEARC_2629_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2628(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2627, v ds
+# define BFI_FLINEARC_2628_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2627(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2626, v ds
+# define BFI_FLINEARC_2627_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2626(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2625, v ds
+# define BFI_FLINEARC_2626_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2625(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2624, v ds
+# define BFI_FLINEARC_2625_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2624(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2623, v ds
+# define BFI_FLINEARC_2624_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2623(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2622, v ds
+# define BFI_FLINEARC_2623_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2622(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2621, v ds
+# define BFI_FLINEARC_2622_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2621(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2620, v ds
+# define BFI_FLINEARC_2621_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2620(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2619, v ds
+# define BFI_FLINEARC_2620_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2619(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2618, v ds
+# define BFI_FLINEARC_2619_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2618(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2617, v ds
+# define BFI_FLINEARC_2618_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2617(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2616, v ds
+# define BFI_FLINEARC_2617_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2616(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2615, v ds
+# define BFI_FLINEARC_2616_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2615(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2614, v ds
+# define BFI_FLINEARC_2615_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2614(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2613, v ds
+# define BFI_FLINEARC_2614_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2613(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2612, v ds
+# define BFI_FLINEARC_2613_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2612(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2611, v ds
+# define BFI_FLINEARC_2612_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2611(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2610, v ds
+# define BFI_FLINEARC_2611_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2610(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2609, v ds
+# define BFI_FLINEARC_2610_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2609(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2608, v ds
+# define BFI_FLINEARC_2609_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2608(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2607, v ds
+# define BFI_FLINEARC_2608_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2607(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2606, v ds
+# define BFI_FLINEARC_2607_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2606(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2605, v ds
+# define BFI_FLINEARC_2606_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2605(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2604, v ds
+# define BFI_FLINEARC_2605_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2604(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2603, v ds
+# define BFI_FLINEARC_2604_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2603(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2602, v ds
+# define BFI_FLINEARC_2603_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2602(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2601, v ds
+# define BFI_FLINEARC_2602_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2601(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2600, v ds
+# define BFI_FLINEARC_2601_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2600(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2599, v ds
+# define BFI_FLINEARC_2600_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2599(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2598, v ds
+# define BFI_FLINEARC_2599_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2598(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2597, v ds
+# define BFI_FLINEARC_2598_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2597(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2596, v ds
+# define BFI_FLINEARC_2597_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2596(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2595, v ds
+# define BFI_FLINEARC_2596_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2595(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2594, v ds
+# define BFI_FLINEARC_2595_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2594(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2593, v ds
+# define BFI_FLINEARC_2594_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2593(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2592, v ds
+# define BFI_FLINEARC_2593_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2592(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2591, v ds
+# define BFI_FLINEARC_2592_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2591(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2590, v ds
+# define BFI_FLINEARC_2591_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2590(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2589, v ds
+# define BFI_FLINEARC_2590_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2589(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2588, v ds
+# define BFI_FLINEARC_2589_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2588(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2587, v ds
+# define BFI_FLINEARC_2588_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2587(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2586, v ds
+# define BFI_FLINEARC_2587_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2586(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2585, v ds
+# define BFI_FLINEARC_2586_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2585(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2584, v ds
+# define BFI_FLINEARC_2585_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2584(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2583, v ds
+# define BFI_FLINEARC_2584_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2583(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2582, v ds
+# define BFI_FLINEARC_2583_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2582(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2581, v ds
+# define BFI_FLINEARC_2582_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2581(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2580, v ds
+# define BFI_FLINEARC_2581_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2580(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2579, v ds
+# define BFI_FLINEARC_2580_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2579(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2578, v ds
+# define BFI_FLINEARC_2579_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2578(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2577, v ds
+# define BFI_FLINEARC_2578_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2577(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2576, v ds
+# define BFI_FLINEARC_2577_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2576(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2575, v ds
+# define BFI_FLINEARC_2576_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2575(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2574, v ds
+# define BFI_FLINEARC_2575_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2574(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2573, v ds
+# define BFI_FLINEARC_2574_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2573(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2572, v ds
+# define BFI_FLINEARC_2573_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2572(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2571, v ds
+# define BFI_FLINEARC_2572_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2571(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2570, v ds
+# define BFI_FLINEARC_2571_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2570(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2569, v ds
+# define BFI_FLINEARC_2570_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2569(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2568, v ds
+# define BFI_FLINEARC_2569_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2568(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2567, v ds
+# define BFI_FLINEARC_2568_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2567(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2566, v ds
+# define BFI_FLINEARC_2567_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2566(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2565, v ds
+# define BFI_FLINEARC_2566_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2565(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2564, v ds
+# define BFI_FLINEARC_2565_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2564(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2563, v ds
+# define BFI_FLINEARC_2564_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2563(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2562, v ds
+# define BFI_FLINEARC_2563_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2562(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2561, v ds
+# define BFI_FLINEARC_2562_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2561(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2560, v ds
+# define BFI_FLINEARC_2561_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2560(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2559, v ds
+# define BFI_FLINEARC_2560_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2559(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2558, v ds
+# define BFI_FLINEARC_2559_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2558(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2557, v ds
+# define BFI_FLINEARC_2558_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2557(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2556, v ds
+# define BFI_FLINEARC_2557_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2556(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2555, v ds
+# define BFI_FLINEARC_2556_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2555(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2554, v ds
+# define BFI_FLINEARC_2555_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2554(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2553, v ds
+# define BFI_FLINEARC_2554_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2553(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2552, v ds
+# define BFI_FLINEARC_2553_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2552(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2551, v ds
+# define BFI_FLINEARC_2552_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2551(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2550, v ds
+# define BFI_FLINEARC_2551_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2550(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2549, v ds
+# define BFI_FLINEARC_2550_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2549(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2548, v ds
+# define BFI_FLINEARC_2549_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2548(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2547, v ds
+# define BFI_FLINEARC_2548_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2547(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2546, v ds
+# define BFI_FLINEARC_2547_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2546(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2545, v ds
+# define BFI_FLINEARC_2546_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2545(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2544, v ds
+# define BFI_FLINEARC_2545_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2544(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2543, v ds
+# define BFI_FLINEARC_2544_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2543(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2542, v ds
+# define BFI_FLINEARC_2543_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2542(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2541, v ds
+# define BFI_FLINEARC_2542_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2541(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2540, v ds
+# define BFI_FLINEARC_2541_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2540(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2539, v ds
+# define BFI_FLINEARC_2540_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2539(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2538, v ds
+# define BFI_FLINEARC_2539_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2538(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2537, v ds
+# define BFI_FLINEARC_2538_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2537(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2536, v ds
+# define BFI_FLINEARC_2537_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2536(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2535, v ds
+# define BFI_FLINEARC_2536_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2535(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2534, v ds
+# define BFI_FLINEARC_2535_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2534(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2533, v ds
+# define BFI_FLINEARC_2534_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2533(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2532, v ds
+# define BFI_FLINEARC_2533_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2532(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2531, v ds
+# define BFI_FLINEARC_2532_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2531(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2530, v ds
+# define BFI_FLINEARC_2531_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2530(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2529, v ds
+# define BFI_FLINEARC_2530_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2529(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2528, v ds
+# define BFI_FLINEARC_2529_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2528(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2527, v ds
+# define BFI_FLINEARC_2528_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2527(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2526, v ds
+# define BFI_FLINEARC_2527_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2526(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2525, v ds
+# define BFI_FLINEARC_2526_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2525(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2524, v ds
+# define BFI_FLINEARC_2525_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2524(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2523, v ds
+# define BFI_FLINEARC_2524_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2523(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2522, v ds
+# define BFI_FLINEARC_2523_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2522(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2521, v ds
+# define BFI_FLINEARC_2522_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2521(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2520, v ds
+# define BFI_FLINEARC_2521_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2520(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2519, v ds
+# define BFI_FLINEARC_2520_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2519(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2518, v ds
+# define BFI_FLINEARC_2519_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2518(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2517, v ds
+# define BFI_FLINEARC_2518_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2517(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2516, v ds
+# define BFI_FLINEARC_2517_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2516(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2515, v ds
+# define BFI_FLINEARC_2516_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2515(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2514, v ds
+# define BFI_FLINEARC_2515_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2514(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2513, v ds
+# define BFI_FLINEARC_2514_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2513(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2512, v ds
+# define BFI_FLINEARC_2513_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2512(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2511, v ds
+# define BFI_FLINEARC_2512_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2511(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2510, v ds
+# define BFI_FLINEARC_2511_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2510(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2509, v ds
+# define BFI_FLINEARC_2510_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2509(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2508, v ds
+# define BFI_FLINEARC_2509_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2508(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2507, v ds
+# define BFI_FLINEARC_2508_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2507(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2506, v ds
+# define BFI_FLINEARC_2507_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2506(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2505, v ds
+# define BFI_FLINEARC_2506_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2505(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2504, v ds
+# define BFI_FLINEARC_2505_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2504(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2503, v ds
+# define BFI_FLINEARC_2504_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2503(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2502, v ds
+# define BFI_FLINEARC_2503_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2502(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2501, v ds
+# define BFI_FLINEARC_2502_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2501(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2500, v ds
+# define BFI_FLINEARC_2501_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2500(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2499, v ds
+# define BFI_FLINEARC_2500_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2499(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2498, v ds
+# define BFI_FLINEARC_2499_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2498(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2497, v ds
+# define BFI_FLINEARC_2498_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2497(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2496, v ds
+# define BFI_FLINEARC_2497_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2496(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2495, v ds
+# define BFI_FLINEARC_2496_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2495(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2494, v ds
+# define BFI_FLINEARC_2495_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2494(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2493, v ds
+# define BFI_FLINEARC_2494_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2493(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2492, v ds
+# define BFI_FLINEARC_2493_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2492(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2491, v ds
+# define BFI_FLINEARC_2492_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2491(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2490, v ds
+# define BFI_FLINEARC_2491_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2490(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2489, v ds
+# define BFI_FLINEARC_2490_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2489(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2488, v ds
+# define BFI_FLINEARC_2489_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2488(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2487, v ds
+# define BFI_FLINEARC_2488_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2487(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2486, v ds
+# define BFI_FLINEARC_2487_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2486(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2485, v ds
+# define BFI_FLINEARC_2486_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2485(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2484, v ds
+# define BFI_FLINEARC_2485_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2484(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2483, v ds
+# define BFI_FLINEARC_2484_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2483(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2482, v ds
+# define BFI_FLINEARC_2483_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2482(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2481, v ds
+# define BFI_FLINEARC_2482_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2481(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2480, v ds
+# define BFI_FLINEARC_2481_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2480(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2479, v ds
+# define BFI_FLINEARC_2480_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2479(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2478, v ds
+# define BFI_FLINEARC_2479_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2478(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2477, v ds
+# define BFI_FLINEARC_2478_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2477(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2476, v ds
+# define BFI_FLINEARC_2477_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2476(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2475, v ds
+# define BFI_FLINEARC_2476_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2475(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2474, v ds
+# define BFI_FLINEARC_2475_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2474(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2473, v ds
+# define BFI_FLINEARC_2474_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2473(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2472, v ds
+# define BFI_FLINEARC_2473_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2472(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2471, v ds
+# define BFI_FLINEARC_2472_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2471(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2470, v ds
+# define BFI_FLINEARC_2471_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2470(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2469, v ds
+# define BFI_FLINEARC_2470_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2469(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2468, v ds
+# define BFI_FLINEARC_2469_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2468(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2467, v ds
+# define BFI_FLINEARC_2468_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2467(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2466, v ds
+# define BFI_FLINEARC_2467_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2466(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2465, v ds
+# define BFI_FLINEARC_2466_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2465(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2464, v ds
+# define BFI_FLINEARC_2465_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2464(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2463, v ds
+# define BFI_FLINEARC_2464_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2463(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2462, v ds
+# define BFI_FLINEARC_2463_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2462(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2461, v ds
+# define BFI_FLINEARC_2462_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2461(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2460, v ds
+# define BFI_FLINEARC_2461_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2460(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2459, v ds
+# define BFI_FLINEARC_2460_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2459(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2458, v ds
+# define BFI_FLINEARC_2459_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2458(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2457, v ds
+# define BFI_FLINEARC_2458_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2457(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2456, v ds
+# define BFI_FLINEARC_2457_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2456(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2455, v ds
+# define BFI_FLINEARC_2456_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2455(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2454, v ds
+# define BFI_FLINEARC_2455_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2454(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2453, v ds
+# define BFI_FLINEARC_2454_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2453(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2452, v ds
+# define BFI_FLINEARC_2453_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2452(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2451, v ds
+# define BFI_FLINEARC_2452_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2451(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2450, v ds
+# define BFI_FLINEARC_2451_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2450(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2449, v ds
+# define BFI_FLINEARC_2450_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2449(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2448, v ds
+# define BFI_FLINEARC_2449_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2448(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2447, v ds
+# define BFI_FLINEARC_2448_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2447(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2446, v ds
+# define BFI_FLINEARC_2447_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2446(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2445, v ds
+# define BFI_FLINEARC_2446_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2445(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2444, v ds
+# define BFI_FLINEARC_2445_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2444(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2443, v ds
+# define BFI_FLINEARC_2444_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2443(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2442, v ds
+# define BFI_FLINEARC_2443_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2442(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2441, v ds
+# define BFI_FLINEARC_2442_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2441(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2440, v ds
+# define BFI_FLINEARC_2441_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2440(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2439, v ds
+# define BFI_FLINEARC_2440_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2439(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2438, v ds
+# define BFI_FLINEARC_2439_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2438(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2437, v ds
+# define BFI_FLINEARC_2438_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2437(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2436, v ds
+# define BFI_FLINEARC_2437_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2436(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2435, v ds
+# define BFI_FLINEARC_2436_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2435(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2434, v ds
+# define BFI_FLINEARC_2435_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2434(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2433, v ds
+# define BFI_FLINEARC_2434_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2433(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2432, v ds
+# define BFI_FLINEARC_2433_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2432(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2431, v ds
+# define BFI_FLINEARC_2432_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2431(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2430, v ds
+# define BFI_FLINEARC_2431_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2430(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2429, v ds
+# define BFI_FLINEARC_2430_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2429(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2428, v ds
+# define BFI_FLINEARC_2429_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2428(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2427, v ds
+# define BFI_FLINEARC_2428_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2427(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2426, v ds
+# define BFI_FLINEARC_2427_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2426(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2425, v ds
+# define BFI_FLINEARC_2426_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2425(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2424, v ds
+# define BFI_FLINEARC_2425_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2424(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2423, v ds
+# define BFI_FLINEARC_2424_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2423(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2422, v ds
+# define BFI_FLINEARC_2423_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2422(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2421, v ds
+# define BFI_FLINEARC_2422_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2421(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2420, v ds
+# define BFI_FLINEARC_2421_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2420(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2419, v ds
+# define BFI_FLINEARC_2420_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2419(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2418, v ds
+# define BFI_FLINEARC_2419_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2418(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2417, v ds
+# define BFI_FLINEARC_2418_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2417(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2416, v ds
+# define BFI_FLINEARC_2417_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2416(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2415, v ds
+# define BFI_FLINEARC_2416_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2415(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2414, v ds
+# define BFI_FLINEARC_2415_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2414(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2413, v ds
+# define BFI_FLINEARC_2414_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2413(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2412, v ds
+# define BFI_FLINEARC_2413_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2412(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2411, v ds
+# define BFI_FLINEARC_2412_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2411(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2410, v ds
+# define BFI_FLINEARC_2411_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2410(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2409, v ds
+# define BFI_FLINEARC_2410_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2409(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2408, v ds
+# define BFI_FLINEARC_2409_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2408(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2407, v ds
+# define BFI_FLINEARC_2408_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2407(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2406, v ds
+# define BFI_FLINEARC_2407_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2406(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2405, v ds
+# define BFI_FLINEARC_2406_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2405(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2404, v ds
+# define BFI_FLINEARC_2405_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2404(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2403, v ds
+# define BFI_FLINEARC_2404_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2403(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2402, v ds
+# define BFI_FLINEARC_2403_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2402(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2401, v ds
+# define BFI_FLINEARC_2402_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2401(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2400, v ds
+# define BFI_FLINEARC_2401_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2400(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2399, v ds
+# define BFI_FLINEARC_2400_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2399(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2398, v ds
+# define BFI_FLINEARC_2399_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2398(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2397, v ds
+# define BFI_FLINEARC_2398_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2397(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2396, v ds
+# define BFI_FLINEARC_2397_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2396(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2395, v ds
+# define BFI_FLINEARC_2396_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2395(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2394, v ds
+# define BFI_FLINEARC_2395_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2394(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2393, v ds
+# define BFI_FLINEARC_2394_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2393(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2392, v ds
+# define BFI_FLINEARC_2393_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2392(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2391, v ds
+# define BFI_FLINEARC_2392_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2391(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2390, v ds
+# define BFI_FLINEARC_2391_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2390(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2389, v ds
+# define BFI_FLINEARC_2390_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2389(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2388, v ds
+# define BFI_FLINEARC_2389_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2388(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2387, v ds
+# define BFI_FLINEARC_2388_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2387(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2386, v ds
+# define BFI_FLINEARC_2387_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2386(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2385, v ds
+# define BFI_FLINEARC_2386_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2385(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2384, v ds
+# define BFI_FLINEARC_2385_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2384(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2383, v ds
+# define BFI_FLINEARC_2384_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2383(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2382, v ds
+# define BFI_FLINEARC_2383_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2382(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2381, v ds
+# define BFI_FLINEARC_2382_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2381(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2380, v ds
+# define BFI_FLINEARC_2381_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2380(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2379, v ds
+# define BFI_FLINEARC_2380_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2379(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2378, v ds
+# define BFI_FLINEARC_2379_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2378(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2377, v ds
+# define BFI_FLINEARC_2378_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2377(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2376, v ds
+# define BFI_FLINEARC_2377_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2376(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2375, v ds
+# define BFI_FLINEARC_2376_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2375(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2374, v ds
+# define BFI_FLINEARC_2375_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2374(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2373, v ds
+# define BFI_FLINEARC_2374_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2373(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2372, v ds
+# define BFI_FLINEARC_2373_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2372(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2371, v ds
+# define BFI_FLINEARC_2372_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2371(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2370, v ds
+# define BFI_FLINEARC_2371_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2370(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2369, v ds
+# define BFI_FLINEARC_2370_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2369(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2368, v ds
+# define BFI_FLINEARC_2369_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2368(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2367, v ds
+# define BFI_FLINEARC_2368_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2367(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2366, v ds
+# define BFI_FLINEARC_2367_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2366(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2365, v ds
+# define BFI_FLINEARC_2366_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2365(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2364, v ds
+# define BFI_FLINEARC_2365_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2364(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2363, v ds
+# define BFI_FLINEARC_2364_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2363(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2362, v ds
+# define BFI_FLINEARC_2363_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2362(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2361, v ds
+# define BFI_FLINEARC_2362_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2361(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2360, v ds
+# define BFI_FLINEARC_2361_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2360(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2359, v ds
+# define BFI_FLINEARC_2360_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2359(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2358, v ds
+# define BFI_FLINEARC_2359_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2358(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2357, v ds
+# define BFI_FLINEARC_2358_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2357(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2356, v ds
+# define BFI_FLINEARC_2357_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2356(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2355, v ds
+# define BFI_FLINEARC_2356_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2355(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2354, v ds
+# define BFI_FLINEARC_2355_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2354(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2353, v ds
+# define BFI_FLINEARC_2354_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2353(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2352, v ds
+# define BFI_FLINEARC_2353_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2352(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2351, v ds
+# define BFI_FLINEARC_2352_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2351(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2350, v ds
+# define BFI_FLINEARC_2351_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2350(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2349, v ds
+# define BFI_FLINEARC_2350_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2349(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2348, v ds
+# define BFI_FLINEARC_2349_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2348(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2347, v ds
+# define BFI_FLINEARC_2348_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2347(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2346, v ds
+# define BFI_FLINEARC_2347_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2346(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2345, v ds
+# define BFI_FLINEARC_2346_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2345(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2344, v ds
+# define BFI_FLINEARC_2345_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2344(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2343, v ds
+# define BFI_FLINEARC_2344_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2343(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2342, v ds
+# define BFI_FLINEARC_2343_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2342(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2341, v ds
+# define BFI_FLINEARC_2342_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2341(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2340, v ds
+# define BFI_FLINEARC_2341_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2340(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2339, v ds
+# define BFI_FLINEARC_2340_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2339(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2338, v ds
+# define BFI_FLINEARC_2339_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2338(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2337, v ds
+# define BFI_FLINEARC_2338_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2337(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2336, v ds
+# define BFI_FLINEARC_2337_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2336(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2335, v ds
+# define BFI_FLINEARC_2336_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2335(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2334, v ds
+# define BFI_FLINEARC_2335_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2334(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2333, v ds
+# define BFI_FLINEARC_2334_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2333(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2332, v ds
+# define BFI_FLINEARC_2333_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2332(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2331, v ds
+# define BFI_FLINEARC_2332_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2331(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2330, v ds
+# define BFI_FLINEARC_2331_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2330(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2329, v ds
+# define BFI_FLINEARC_2330_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2329(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2328, v ds
+# define BFI_FLINEARC_2329_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2328(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2327, v ds
+# define BFI_FLINEARC_2328_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2327(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2326, v ds
+# define BFI_FLINEARC_2327_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2326(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2325, v ds
+# define BFI_FLINEARC_2326_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2325(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2324, v ds
+# define BFI_FLINEARC_2325_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2324(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2323, v ds
+# define BFI_FLINEARC_2324_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2323(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2322, v ds
+# define BFI_FLINEARC_2323_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2322(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2321, v ds
+# define BFI_FLINEARC_2322_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2321(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2320, v ds
+# define BFI_FLINEARC_2321_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2320(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2319, v ds
+# define BFI_FLINEARC_2320_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2319(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2318, v ds
+# define BFI_FLINEARC_2319_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2318(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2317, v ds
+# define BFI_FLINEARC_2318_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2317(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2316, v ds
+# define BFI_FLINEARC_2317_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2316(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2315, v ds
+# define BFI_FLINEARC_2316_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2315(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2314, v ds
+# define BFI_FLINEARC_2315_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2314(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2313, v ds
+# define BFI_FLINEARC_2314_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2313(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2312, v ds
+# define BFI_FLINEARC_2313_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2312(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2311, v ds
+# define BFI_FLINEARC_2312_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2311(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2310, v ds
+# define BFI_FLINEARC_2311_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2310(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2309, v ds
+# define BFI_FLINEARC_2310_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2309(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2308, v ds
+# define BFI_FLINEARC_2309_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2308(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2307, v ds
+# define BFI_FLINEARC_2308_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2307(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2306, v ds
+# define BFI_FLINEARC_2307_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2306(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2305, v ds
+# define BFI_FLINEARC_2306_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2305(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2304, v ds
+# define BFI_FLINEARC_2305_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2304(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2303, v ds
+# define BFI_FLINEARC_2304_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2303(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2302, v ds
+# define BFI_FLINEARC_2303_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2302(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2301, v ds
+# define BFI_FLINEARC_2302_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2301(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2300, v ds
+# define BFI_FLINEARC_2301_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2300(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2299, v ds
+# define BFI_FLINEARC_2300_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2299(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2298, v ds
+# define BFI_FLINEARC_2299_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2298(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2297, v ds
+# define BFI_FLINEARC_2298_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2297(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2296, v ds
+# define BFI_FLINEARC_2297_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2296(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2295, v ds
+# define BFI_FLINEARC_2296_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2295(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2294, v ds
+# define BFI_FLINEARC_2295_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2294(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2293, v ds
+# define BFI_FLINEARC_2294_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2293(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2292, v ds
+# define BFI_FLINEARC_2293_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2292(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2291, v ds
+# define BFI_FLINEARC_2292_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2291(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2290, v ds
+# define BFI_FLINEARC_2291_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2290(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2289, v ds
+# define BFI_FLINEARC_2290_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2289(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2288, v ds
+# define BFI_FLINEARC_2289_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2288(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2287, v ds
+# define BFI_FLINEARC_2288_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2287(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2286, v ds
+# define BFI_FLINEARC_2287_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2286(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2285, v ds
+# define BFI_FLINEARC_2286_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2285(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2284, v ds
+# define BFI_FLINEARC_2285_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2284(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2283, v ds
+# define BFI_FLINEARC_2284_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2283(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2282, v ds
+# define BFI_FLINEARC_2283_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2282(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2281, v ds
+# define BFI_FLINEARC_2282_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2281(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2280, v ds
+# define BFI_FLINEARC_2281_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2280(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2279, v ds
+# define BFI_FLINEARC_2280_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2279(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2278, v ds
+# define BFI_FLINEARC_2279_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2278(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2277, v ds
+# define BFI_FLINEARC_2278_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2277(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2276, v ds
+# define BFI_FLINEARC_2277_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2276(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2275, v ds
+# define BFI_FLINEARC_2276_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2275(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2274, v ds
+# define BFI_FLINEARC_2275_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2274(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2273, v ds
+# define BFI_FLINEARC_2274_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2273(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2272, v ds
+# define BFI_FLINEARC_2273_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2272(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2271, v ds
+# define BFI_FLINEARC_2272_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2271(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2270, v ds
+# define BFI_FLINEARC_2271_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2270(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2269, v ds
+# define BFI_FLINEARC_2270_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2269(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2268, v ds
+# define BFI_FLINEARC_2269_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2268(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2267, v ds
+# define BFI_FLINEARC_2268_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2267(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2266, v ds
+# define BFI_FLINEARC_2267_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2266(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2265, v ds
+# define BFI_FLINEARC_2266_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2265(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2264, v ds
+# define BFI_FLINEARC_2265_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2264(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2263, v ds
+# define BFI_FLINEARC_2264_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2263(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2262, v ds
+# define BFI_FLINEARC_2263_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2262(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2261, v ds
+# define BFI_FLINEARC_2262_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2261(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2260, v ds
+# define BFI_FLINEARC_2261_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2260(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2259, v ds
+# define BFI_FLINEARC_2260_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2259(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2258, v ds
+# define BFI_FLINEARC_2259_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2258(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2257, v ds
+# define BFI_FLINEARC_2258_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2257(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2256, v ds
+# define BFI_FLINEARC_2257_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2256(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2255, v ds
+# define BFI_FLINEARC_2256_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2255(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2254, v ds
+# define BFI_FLINEARC_2255_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2254(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2253, v ds
+# define BFI_FLINEARC_2254_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2253(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2252, v ds
+# define BFI_FLINEARC_2253_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2252(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2251, v ds
+# define BFI_FLINEARC_2252_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2251(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2250, v ds
+# define BFI_FLINEARC_2251_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2250(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2249, v ds
+# define BFI_FLINEARC_2250_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2249(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2248, v ds
+# define BFI_FLINEARC_2249_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2248(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2247, v ds
+# define BFI_FLINEARC_2248_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2247(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2246, v ds
+# define BFI_FLINEARC_2247_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2246(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2245, v ds
+# define BFI_FLINEARC_2246_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2245(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2244, v ds
+# define BFI_FLINEARC_2245_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2244(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2243, v ds
+# define BFI_FLINEARC_2244_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2243(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2242, v ds
+# define BFI_FLINEARC_2243_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2242(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2241, v ds
+# define BFI_FLINEARC_2242_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2241(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2240, v ds
+# define BFI_FLINEARC_2241_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2240(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2239, v ds
+# define BFI_FLINEARC_2240_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2239(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2238, v ds
+# define BFI_FLINEARC_2239_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2238(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2237, v ds
+# define BFI_FLINEARC_2238_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2237(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2236, v ds
+# define BFI_FLINEARC_2237_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2236(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2235, v ds
+# define BFI_FLINEARC_2236_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2235(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2234, v ds
+# define BFI_FLINEARC_2235_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2234(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2233, v ds
+# define BFI_FLINEARC_2234_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2233(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2232, v ds
+# define BFI_FLINEARC_2233_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2232(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2231, v ds
+# define BFI_FLINEARC_2232_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2231(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2230, v ds
+# define BFI_FLINEARC_2231_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2230(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2229, v ds
+# define BFI_FLINEARC_2230_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2229(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2228, v ds
+# define BFI_FLINEARC_2229_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2228(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2227, v ds
+# define BFI_FLINEARC_2228_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2227(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2226, v ds
+# define BFI_FLINEARC_2227_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2226(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2225, v ds
+# define BFI_FLINEARC_2226_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2225(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2224, v ds
+# define BFI_FLINEARC_2225_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2224(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2223, v ds
+# define BFI_FLINEARC_2224_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2223(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2222, v ds
+# define BFI_FLINEARC_2223_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2222(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2221, v ds
+# define BFI_FLINEARC_2222_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2221(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2220, v ds
+# define BFI_FLINEARC_2221_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2220(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2219, v ds
+# define BFI_FLINEARC_2220_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2219(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2218, v ds
+# define BFI_FLINEARC_2219_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2218(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2217, v ds
+# define BFI_FLINEARC_2218_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2217(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2216, v ds
+# define BFI_FLINEARC_2217_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2216(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2215, v ds
+# define BFI_FLINEARC_2216_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2215(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2214, v ds
+# define BFI_FLINEARC_2215_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2214(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2213, v ds
+# define BFI_FLINEARC_2214_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2213(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2212, v ds
+# define BFI_FLINEARC_2213_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2212(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2211, v ds
+# define BFI_FLINEARC_2212_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2211(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2210, v ds
+# define BFI_FLINEARC_2211_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2210(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2209, v ds
+# define BFI_FLINEARC_2210_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2209(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2208, v ds
+# define BFI_FLINEARC_2209_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2208(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2207, v ds
+# define BFI_FLINEARC_2208_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2207(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2206, v ds
+# define BFI_FLINEARC_2207_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2206(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2205, v ds
+# define BFI_FLINEARC_2206_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2205(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2204, v ds
+# define BFI_FLINEARC_2205_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2204(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2203, v ds
+# define BFI_FLINEARC_2204_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2203(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2202, v ds
+# define BFI_FLINEARC_2203_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2202(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2201, v ds
+# define BFI_FLINEARC_2202_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2201(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2200, v ds
+# define BFI_FLINEARC_2201_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2200(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2199, v ds
+# define BFI_FLINEARC_2200_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2199(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2198, v ds
+# define BFI_FLINEARC_2199_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2198(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2197, v ds
+# define BFI_FLINEARC_2198_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2197(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2196, v ds
+# define BFI_FLINEARC_2197_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2196(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2195, v ds
+# define BFI_FLINEARC_2196_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2195(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2194, v ds
+# define BFI_FLINEARC_2195_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2194(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2193, v ds
+# define BFI_FLINEARC_2194_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2193(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2192, v ds
+# define BFI_FLINEARC_2193_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2192(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2191, v ds
+# define BFI_FLINEARC_2192_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2191(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2190, v ds
+# define BFI_FLINEARC_2191_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2190(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2189, v ds
+# define BFI_FLINEARC_2190_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2189(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2188, v ds
+# define BFI_FLINEARC_2189_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2188(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2187, v ds
+# define BFI_FLINEARC_2188_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2187(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2186, v ds
+# define BFI_FLINEARC_2187_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2186(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2185, v ds
+# define BFI_FLINEARC_2186_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2185(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2184, v ds
+# define BFI_FLINEARC_2185_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2184(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2183, v ds
+# define BFI_FLINEARC_2184_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2183(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2182, v ds
+# define BFI_FLINEARC_2183_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2182(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2181, v ds
+# define BFI_FLINEARC_2182_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2181(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2180, v ds
+# define BFI_FLINEARC_2181_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2180(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2179, v ds
+# define BFI_FLINEARC_2180_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2179(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2178, v ds
+# define BFI_FLINEARC_2179_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2178(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2177, v ds
+# define BFI_FLINEARC_2178_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2177(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2176, v ds
+# define BFI_FLINEARC_2177_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2176(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2175, v ds
+# define BFI_FLINEARC_2176_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2175(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2174, v ds
+# define BFI_FLINEARC_2175_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2174(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2173, v ds
+# define BFI_FLINEARC_2174_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2173(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2172, v ds
+# define BFI_FLINEARC_2173_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2172(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2171, v ds
+# define BFI_FLINEARC_2172_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2171(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2170, v ds
+# define BFI_FLINEARC_2171_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2170(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2169, v ds
+# define BFI_FLINEARC_2170_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2169(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2168, v ds
+# define BFI_FLINEARC_2169_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2168(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2167, v ds
+# define BFI_FLINEARC_2168_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2167(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2166, v ds
+# define BFI_FLINEARC_2167_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2166(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2165, v ds
+# define BFI_FLINEARC_2166_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2165(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2164, v ds
+# define BFI_FLINEARC_2165_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2164(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2163, v ds
+# define BFI_FLINEARC_2164_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2163(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2162, v ds
+# define BFI_FLINEARC_2163_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2162(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2161, v ds
+# define BFI_FLINEARC_2162_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2161(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2160, v ds
+# define BFI_FLINEARC_2161_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2160(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2159, v ds
+# define BFI_FLINEARC_2160_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2159(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2158, v ds
+# define BFI_FLINEARC_2159_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2158(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2157, v ds
+# define BFI_FLINEARC_2158_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2157(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2156, v ds
+# define BFI_FLINEARC_2157_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2156(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2155, v ds
+# define BFI_FLINEARC_2156_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2155(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2154, v ds
+# define BFI_FLINEARC_2155_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2154(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2153, v ds
+# define BFI_FLINEARC_2154_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2153(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2152, v ds
+# define BFI_FLINEARC_2153_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2152(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2151, v ds
+# define BFI_FLINEARC_2152_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2151(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2150, v ds
+# define BFI_FLINEARC_2151_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2150(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2149, v ds
+# define BFI_FLINEARC_2150_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2149(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2148, v ds
+# define BFI_FLINEARC_2149_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2148(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2147, v ds
+# define BFI_FLINEARC_2148_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2147(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2146, v ds
+# define BFI_FLINEARC_2147_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2146(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2145, v ds
+# define BFI_FLINEARC_2146_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2145(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2144, v ds
+# define BFI_FLINEARC_2145_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2144(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2143, v ds
+# define BFI_FLINEARC_2144_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2143(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2142, v ds
+# define BFI_FLINEARC_2143_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2142(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2141, v ds
+# define BFI_FLINEARC_2142_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2141(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2140, v ds
+# define BFI_FLINEARC_2141_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2140(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2139, v ds
+# define BFI_FLINEARC_2140_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2139(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2138, v ds
+# define BFI_FLINEARC_2139_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2138(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2137, v ds
+# define BFI_FLINEARC_2138_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2137(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2136, v ds
+# define BFI_FLINEARC_2137_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2136(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2135, v ds
+# define BFI_FLINEARC_2136_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2135(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2134, v ds
+# define BFI_FLINEARC_2135_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2134(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2133, v ds
+# define BFI_FLINEARC_2134_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2133(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2132, v ds
+# define BFI_FLINEARC_2133_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2132(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2131, v ds
+# define BFI_FLINEARC_2132_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2131(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2130, v ds
+# define BFI_FLINEARC_2131_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2130(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2129, v ds
+# define BFI_FLINEARC_2130_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2129(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2128, v ds
+# define BFI_FLINEARC_2129_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2128(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2127, v ds
+# define BFI_FLINEARC_2128_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2127(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2126, v ds
+# define BFI_FLINEARC_2127_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2126(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2125, v ds
+# define BFI_FLINEARC_2126_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2125(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2124, v ds
+# define BFI_FLINEARC_2125_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2124(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2123, v ds
+# define BFI_FLINEARC_2124_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2123(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2122, v ds
+# define BFI_FLINEARC_2123_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2122(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2121, v ds
+# define BFI_FLINEARC_2122_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2121(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2120, v ds
+# define BFI_FLINEARC_2121_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2120(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2119, v ds
+# define BFI_FLINEARC_2120_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2119(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2118, v ds
+# define BFI_FLINEARC_2119_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2118(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2117, v ds
+# define BFI_FLINEARC_2118_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2117(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2116, v ds
+# define BFI_FLINEARC_2117_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2116(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2115, v ds
+# define BFI_FLINEARC_2116_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2115(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2114, v ds
+# define BFI_FLINEARC_2115_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2114(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2113, v ds
+# define BFI_FLINEARC_2114_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2113(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2112, v ds
+# define BFI_FLINEARC_2113_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2112(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2111, v ds
+# define BFI_FLINEARC_2112_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2111(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2110, v ds
+# define BFI_FLINEARC_2111_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2110(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2109, v ds
+# define BFI_FLINEARC_2110_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2109(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2108, v ds
+# define BFI_FLINEARC_2109_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2108(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2107, v ds
+# define BFI_FLINEARC_2108_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2107(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2106, v ds
+# define BFI_FLINEARC_2107_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2106(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2105, v ds
+# define BFI_FLINEARC_2106_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2105(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2104, v ds
+# define BFI_FLINEARC_2105_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2104(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2103, v ds
+# define BFI_FLINEARC_2104_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2103(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2102, v ds
+# define BFI_FLINEARC_2103_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2102(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2101, v ds
+# define BFI_FLINEARC_2102_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2101(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2100, v ds
+# define BFI_FLINEARC_2101_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2100(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2099, v ds
+# define BFI_FLINEARC_2100_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2099(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2098, v ds
+# define BFI_FLINEARC_2099_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2098(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2097, v ds
+# define BFI_FLINEARC_2098_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2097(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2096, v ds
+# define BFI_FLINEARC_2097_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2096(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2095, v ds
+# define BFI_FLINEARC_2096_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2095(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2094, v ds
+# define BFI_FLINEARC_2095_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2094(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2093, v ds
+# define BFI_FLINEARC_2094_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2093(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2092, v ds
+# define BFI_FLINEARC_2093_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2092(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2091, v ds
+# define BFI_FLINEARC_2092_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2091(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2090, v ds
+# define BFI_FLINEARC_2091_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2090(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2089, v ds
+# define BFI_FLINEARC_2090_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2089(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2088, v ds
+# define BFI_FLINEARC_2089_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2088(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2087, v ds
+# define BFI_FLINEARC_2088_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2087(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2086, v ds
+# define BFI_FLINEARC_2087_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2086(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2085, v ds
+# define BFI_FLINEARC_2086_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2085(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2084, v ds
+# define BFI_FLINEARC_2085_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2084(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2083, v ds
+# define BFI_FLINEARC_2084_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2083(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2082, v ds
+# define BFI_FLINEARC_2083_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2082(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2081, v ds
+# define BFI_FLINEARC_2082_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2081(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2080, v ds
+# define BFI_FLINEARC_2081_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2080(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2079, v ds
+# define BFI_FLINEARC_2080_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2079(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2078, v ds
+# define BFI_FLINEARC_2079_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2078(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2077, v ds
+# define BFI_FLINEARC_2078_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2077(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2076, v ds
+# define BFI_FLINEARC_2077_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2076(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2075, v ds
+# define BFI_FLINEARC_2076_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2075(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2074, v ds
+# define BFI_FLINEARC_2075_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2074(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2073, v ds
+# define BFI_FLINEARC_2074_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2073(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2072, v ds
+# define BFI_FLINEARC_2073_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2072(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2071, v ds
+# define BFI_FLINEARC_2072_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2071(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2070, v ds
+# define BFI_FLINEARC_2071_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2070(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2069, v ds
+# define BFI_FLINEARC_2070_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2069(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2068, v ds
+# define BFI_FLINEARC_2069_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2068(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2067, v ds
+# define BFI_FLINEARC_2068_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2067(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2066, v ds
+# define BFI_FLINEARC_2067_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2066(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2065, v ds
+# define BFI_FLINEARC_2066_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2065(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2064, v ds
+# define BFI_FLINEARC_2065_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2064(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2063, v ds
+# define BFI_FLINEARC_2064_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2063(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2062, v ds
+# define BFI_FLINEARC_2063_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2062(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2061, v ds
+# define BFI_FLINEARC_2062_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2061(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2060, v ds
+# define BFI_FLINEARC_2061_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2060(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2059, v ds
+# define BFI_FLINEARC_2060_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2059(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2058, v ds
+# define BFI_FLINEARC_2059_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2058(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2057, v ds
+# define BFI_FLINEARC_2058_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2057(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2056, v ds
+# define BFI_FLINEARC_2057_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2056(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2055, v ds
+# define BFI_FLINEARC_2056_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2055(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2054, v ds
+# define BFI_FLINEARC_2055_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2054(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2053, v ds
+# define BFI_FLINEARC_2054_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2053(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2052, v ds
+# define BFI_FLINEARC_2053_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2052(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2051, v ds
+# define BFI_FLINEARC_2052_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2051(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2050, v ds
+# define BFI_FLINEARC_2051_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2050(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2049, v ds
+# define BFI_FLINEARC_2050_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2049(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2048, v ds
+# define BFI_FLINEARC_2049_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2048(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2047, v ds
+# define BFI_FLINEARC_2048_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2047(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2046, v ds
+# define BFI_FLINEARC_2047_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2046(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2045, v ds
+# define BFI_FLINEARC_2046_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2045(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2044, v ds
+# define BFI_FLINEARC_2045_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2044(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2043, v ds
+# define BFI_FLINEARC_2044_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2043(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2042, v ds
+# define BFI_FLINEARC_2043_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2042(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2041, v ds
+# define BFI_FLINEARC_2042_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2041(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2040, v ds
+# define BFI_FLINEARC_2041_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2040(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2039, v ds
+# define BFI_FLINEARC_2040_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2039(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2038, v ds
+# define BFI_FLINEARC_2039_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2038(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2037, v ds
+# define BFI_FLINEARC_2038_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2037(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2036, v ds
+# define BFI_FLINEARC_2037_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2036(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2035, v ds
+# define BFI_FLINEARC_2036_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2035(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2034, v ds
+# define BFI_FLINEARC_2035_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2034(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2033, v ds
+# define BFI_FLINEARC_2034_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2033(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2032, v ds
+# define BFI_FLINEARC_2033_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2032(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2031, v ds
+# define BFI_FLINEARC_2032_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2031(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2030, v ds
+# define BFI_FLINEARC_2031_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2030(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2029, v ds
+# define BFI_FLINEARC_2030_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2029(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2028, v ds
+# define BFI_FLINEARC_2029_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2028(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2027, v ds
+# define BFI_FLINEARC_2028_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2027(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2026, v ds
+# define BFI_FLINEARC_2027_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2026(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2025, v ds
+# define BFI_FLINEARC_2026_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2025(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2024, v ds
+# define BFI_FLINEARC_2025_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2024(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2023, v ds
+# define BFI_FLINEARC_2024_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2023(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2022, v ds
+# define BFI_FLINEARC_2023_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2022(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2021, v ds
+# define BFI_FLINEARC_2022_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2021(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2020, v ds
+# define BFI_FLINEARC_2021_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2020(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2019, v ds
+# define BFI_FLINEARC_2020_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2019(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2018, v ds
+# define BFI_FLINEARC_2019_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2018(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2017, v ds
+# define BFI_FLINEARC_2018_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2017(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2016, v ds
+# define BFI_FLINEARC_2017_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2016(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2015, v ds
+# define BFI_FLINEARC_2016_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2015(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2014, v ds
+# define BFI_FLINEARC_2015_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2014(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2013, v ds
+# define BFI_FLINEARC_2014_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2013(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2012, v ds
+# define BFI_FLINEARC_2013_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2012(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2011, v ds
+# define BFI_FLINEARC_2012_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2011(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2010, v ds
+# define BFI_FLINEARC_2011_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2010(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2009, v ds
+# define BFI_FLINEARC_2010_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2009(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2008, v ds
+# define BFI_FLINEARC_2009_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2008(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2007, v ds
+# define BFI_FLINEARC_2008_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2007(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2006, v ds
+# define BFI_FLINEARC_2007_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2006(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2005, v ds
+# define BFI_FLINEARC_2006_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2005(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2004, v ds
+# define BFI_FLINEARC_2005_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2004(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2003, v ds
+# define BFI_FLINEARC_2004_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2003(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2002, v ds
+# define BFI_FLINEARC_2003_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2002(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2001, v ds
+# define BFI_FLINEARC_2002_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2001(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2000, v ds
+# define BFI_FLINEARC_2001_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2000(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1999, v ds
+# define BFI_FLINEARC_2000_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1999(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1998, v ds
+# define BFI_FLINEARC_1999_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1998(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1997, v ds
+# define BFI_FLINEARC_1998_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1997(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1996, v ds
+# define BFI_FLINEARC_1997_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1996(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1995, v ds
+# define BFI_FLINEARC_1996_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1995(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1994, v ds
+# define BFI_FLINEARC_1995_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1994(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1993, v ds
+# define BFI_FLINEARC_1994_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1993(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1992, v ds
+# define BFI_FLINEARC_1993_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1992(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1991, v ds
+# define BFI_FLINEARC_1992_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1991(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1990, v ds
+# define BFI_FLINEARC_1991_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1990(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1989, v ds
+# define BFI_FLINEARC_1990_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1989(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1988, v ds
+# define BFI_FLINEARC_1989_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1988(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1987, v ds
+# define BFI_FLINEARC_1988_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1987(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1986, v ds
+# define BFI_FLINEARC_1987_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1986(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1985, v ds
+# define BFI_FLINEARC_1986_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1985(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1984, v ds
+# define BFI_FLINEARC_1985_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1984(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1983, v ds
+# define BFI_FLINEARC_1984_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1983(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1982, v ds
+# define BFI_FLINEARC_1983_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1982(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1981, v ds
+# define BFI_FLINEARC_1982_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1981(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1980, v ds
+# define BFI_FLINEARC_1981_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1980(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1979, v ds
+# define BFI_FLINEARC_1980_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1979(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1978, v ds
+# define BFI_FLINEARC_1979_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1978(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1977, v ds
+# define BFI_FLINEARC_1978_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1977(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1976, v ds
+# define BFI_FLINEARC_1977_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1976(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1975, v ds
+# define BFI_FLINEARC_1976_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1975(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1974, v ds
+# define BFI_FLINEARC_1975_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1974(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1973, v ds
+# define BFI_FLINEARC_1974_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1973(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1972, v ds
+# define BFI_FLINEARC_1973_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1972(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1971, v ds
+# define BFI_FLINEARC_1972_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1971(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1970, v ds
+# define BFI_FLINEARC_1971_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1970(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1969, v ds
+# define BFI_FLINEARC_1970_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1969(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1968, v ds
+# define BFI_FLINEARC_1969_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1968(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1967, v ds
+# define BFI_FLINEARC_1968_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1967(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1966, v ds
+# define BFI_FLINEARC_1967_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1966(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1965, v ds
+# define BFI_FLINEARC_1966_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1965(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1964, v ds
+# define BFI_FLINEARC_1965_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1964(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1963, v ds
+# define BFI_FLINEARC_1964_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1963(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1962, v ds
+# define BFI_FLINEARC_1963_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1962(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1961, v ds
+# define BFI_FLINEARC_1962_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1961(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1960, v ds
+# define BFI_FLINEARC_1961_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1960(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1959, v ds
+# define BFI_FLINEARC_1960_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1959(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1958, v ds
+# define BFI_FLINEARC_1959_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1958(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1957, v ds
+# define BFI_FLINEARC_1958_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1957(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1956, v ds
+# define BFI_FLINEARC_1957_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1956(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1955, v ds
+# define BFI_FLINEARC_1956_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1955(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1954, v ds
+# define BFI_FLINEARC_1955_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1954(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1953, v ds
+# define BFI_FLINEARC_1954_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1953(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1952, v ds
+# define BFI_FLINEARC_1953_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1952(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1951, v ds
+# define BFI_FLINEARC_1952_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1951(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1950, v ds
+# define BFI_FLINEARC_1951_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1950(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1949, v ds
+# define BFI_FLINEARC_1950_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1949(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1948, v ds
+# define BFI_FLINEARC_1949_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1948(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1947, v ds
+# define BFI_FLINEARC_1948_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1947(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1946, v ds
+# define BFI_FLINEARC_1947_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1946(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1945, v ds
+# define BFI_FLINEARC_1946_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1945(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1944, v ds
+# define BFI_FLINEARC_1945_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1944(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1943, v ds
+# define BFI_FLINEARC_1944_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1943(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1942, v ds
+# define BFI_FLINEARC_1943_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1942(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1941, v ds
+# define BFI_FLINEARC_1942_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1941(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1940, v ds
+# define BFI_FLINEARC_1941_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1940(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1939, v ds
+# define BFI_FLINEARC_1940_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1939(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1938, v ds
+# define BFI_FLINEARC_1939_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1938(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1937, v ds
+# define BFI_FLINEARC_1938_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1937(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1936, v ds
+# define BFI_FLINEARC_1937_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1936(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1935, v ds
+# define BFI_FLINEARC_1936_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1935(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1934, v ds
+# define BFI_FLINEARC_1935_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1934(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1933, v ds
+# define BFI_FLINEARC_1934_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1933(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1932, v ds
+# define BFI_FLINEARC_1933_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1932(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1931, v ds
+# define BFI_FLINEARC_1932_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1931(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1930, v ds
+# define BFI_FLINEARC_1931_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1930(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1929, v ds
+# define BFI_FLINEARC_1930_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1929(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1928, v ds
+# define BFI_FLINEARC_1929_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1928(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1927, v ds
+# define BFI_FLINEARC_1928_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1927(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1926, v ds
+# define BFI_FLINEARC_1927_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1926(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1925, v ds
+# define BFI_FLINEARC_1926_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1925(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1924, v ds
+# define BFI_FLINEARC_1925_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1924(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1923, v ds
+# define BFI_FLINEARC_1924_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1923(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1922, v ds
+# define BFI_FLINEARC_1923_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1922(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1921, v ds
+# define BFI_FLINEARC_1922_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1921(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1920, v ds
+# define BFI_FLINEARC_1921_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1920(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1919, v ds
+# define BFI_FLINEARC_1920_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1919(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1918, v ds
+# define BFI_FLINEARC_1919_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1918(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1917, v ds
+# define BFI_FLINEARC_1918_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1917(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1916, v ds
+# define BFI_FLINEARC_1917_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1916(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1915, v ds
+# define BFI_FLINEARC_1916_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1915(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1914, v ds
+# define BFI_FLINEARC_1915_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1914(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1913, v ds
+# define BFI_FLINEARC_1914_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1913(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1912, v ds
+# define BFI_FLINEARC_1913_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1912(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1911, v ds
+# define BFI_FLINEARC_1912_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1911(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1910, v ds
+# define BFI_FLINEARC_1911_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1910(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1909, v ds
+# define BFI_FLINEARC_1910_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1909(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1908, v ds
+# define BFI_FLINEARC_1909_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1908(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1907, v ds
+# define BFI_FLINEARC_1908_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1907(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1906, v ds
+# define BFI_FLINEARC_1907_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1906(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1905, v ds
+# define BFI_FLINEARC_1906_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1905(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1904, v ds
+# define BFI_FLINEARC_1905_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1904(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1903, v ds
+# define BFI_FLINEARC_1904_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1903(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1902, v ds
+# define BFI_FLINEARC_1903_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1902(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1901, v ds
+# define BFI_FLINEARC_1902_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1901(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1900, v ds
+# define BFI_FLINEARC_1901_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1900(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1899, v ds
+# define BFI_FLINEARC_1900_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1899(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1898, v ds
+# define BFI_FLINEARC_1899_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1898(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1897, v ds
+# define BFI_FLINEARC_1898_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1897(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1896, v ds
+# define BFI_FLINEARC_1897_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1896(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1895, v ds
+# define BFI_FLINEARC_1896_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1895(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1894, v ds
+# define BFI_FLINEARC_1895_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1894(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1893, v ds
+# define BFI_FLINEARC_1894_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1893(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1892, v ds
+# define BFI_FLINEARC_1893_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1892(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1891, v ds
+# define BFI_FLINEARC_1892_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1891(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1890, v ds
+# define BFI_FLINEARC_1891_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1890(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1889, v ds
+# define BFI_FLINEARC_1890_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1889(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1888, v ds
+# define BFI_FLINEARC_1889_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1888(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1887, v ds
+# define BFI_FLINEARC_1888_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1887(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1886, v ds
+# define BFI_FLINEARC_1887_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1886(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1885, v ds
+# define BFI_FLINEARC_1886_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1885(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1884, v ds
+# define BFI_FLINEARC_1885_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1884(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1883, v ds
+# define BFI_FLINEARC_1884_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1883(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1882, v ds
+# define BFI_FLINEARC_1883_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1882(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1881, v ds
+# define BFI_FLINEARC_1882_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1881(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1880, v ds
+# define BFI_FLINEARC_1881_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1880(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1879, v ds
+# define BFI_FLINEARC_1880_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1879(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1878, v ds
+# define BFI_FLINEARC_1879_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1878(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1877, v ds
+# define BFI_FLINEARC_1878_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1877(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1876, v ds
+# define BFI_FLINEARC_1877_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1876(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1875, v ds
+# define BFI_FLINEARC_1876_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1875(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1874, v ds
+# define BFI_FLINEARC_1875_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1874(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1873, v ds
+# define BFI_FLINEARC_1874_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1873(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1872, v ds
+# define BFI_FLINEARC_1873_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1872(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1871, v ds
+# define BFI_FLINEARC_1872_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1871(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1870, v ds
+# define BFI_FLINEARC_1871_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1870(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1869, v ds
+# define BFI_FLINEARC_1870_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1869(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1868, v ds
+# define BFI_FLINEARC_1869_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1868(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1867, v ds
+# define BFI_FLINEARC_1868_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1867(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1866, v ds
+# define BFI_FLINEARC_1867_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1866(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1865, v ds
+# define BFI_FLINEARC_1866_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1865(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1864, v ds
+# define BFI_FLINEARC_1865_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1864(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1863, v ds
+# define BFI_FLINEARC_1864_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1863(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1862, v ds
+# define BFI_FLINEARC_1863_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1862(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1861, v ds
+# define BFI_FLINEARC_1862_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1861(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1860, v ds
+# define BFI_FLINEARC_1861_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1860(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1859, v ds
+# define BFI_FLINEARC_1860_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1859(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1858, v ds
+# define BFI_FLINEARC_1859_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1858(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1857, v ds
+# define BFI_FLINEARC_1858_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1857(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1856, v ds
+# define BFI_FLINEARC_1857_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1856(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1855, v ds
+# define BFI_FLINEARC_1856_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1855(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1854, v ds
+# define BFI_FLINEARC_1855_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1854(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1853, v ds
+# define BFI_FLINEARC_1854_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1853(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1852, v ds
+# define BFI_FLINEARC_1853_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1852(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1851, v ds
+# define BFI_FLINEARC_1852_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1851(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1850, v ds
+# define BFI_FLINEARC_1851_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1850(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1849, v ds
+# define BFI_FLINEARC_1850_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1849(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1848, v ds
+# define BFI_FLINEARC_1849_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1848(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1847, v ds
+# define BFI_FLINEARC_1848_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1847(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1846, v ds
+# define BFI_FLINEARC_1847_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1846(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1845, v ds
+# define BFI_FLINEARC_1846_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1845(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1844, v ds
+# define BFI_FLINEARC_1845_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1844(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1843, v ds
+# define BFI_FLINEARC_1844_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1843(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1842, v ds
+# define BFI_FLINEARC_1843_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1842(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1841, v ds
+# define BFI_FLINEARC_1842_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1841(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1840, v ds
+# define BFI_FLINEARC_1841_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1840(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1839, v ds
+# define BFI_FLINEARC_1840_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1839(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1838, v ds
+# define BFI_FLINEARC_1839_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1838(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1837, v ds
+# define BFI_FLINEARC_1838_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1837(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1836, v ds
+# define BFI_FLINEARC_1837_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1836(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1835, v ds
+# define BFI_FLINEARC_1836_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1835(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1834, v ds
+# define BFI_FLINEARC_1835_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1834(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1833, v ds
+# define BFI_FLINEARC_1834_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1833(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1832, v ds
+# define BFI_FLINEARC_1833_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1832(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1831, v ds
+# define BFI_FLINEARC_1832_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1831(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1830, v ds
+# define BFI_FLINEARC_1831_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1830(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1829, v ds
+# define BFI_FLINEARC_1830_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1829(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1828, v ds
+# define BFI_FLINEARC_1829_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1828(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1827, v ds
+# define BFI_FLINEARC_1828_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1827(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1826, v ds
+# define BFI_FLINEARC_1827_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1826(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1825, v ds
+# define BFI_FLINEARC_1826_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1825(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1824, v ds
+# define BFI_FLINEARC_1825_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1824(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1823, v ds
+# define BFI_FLINEARC_1824_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1823(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1822, v ds
+# define BFI_FLINEARC_1823_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1822(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1821, v ds
+# define BFI_FLINEARC_1822_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1821(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1820, v ds
+# define BFI_FLINEARC_1821_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1820(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1819, v ds
+# define BFI_FLINEARC_1820_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1819(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1818, v ds
+# define BFI_FLINEARC_1819_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1818(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1817, v ds
+# define BFI_FLINEARC_1818_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1817(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1816, v ds
+# define BFI_FLINEARC_1817_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1816(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1815, v ds
+# define BFI_FLINEARC_1816_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1815(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1814, v ds
+# define BFI_FLINEARC_1815_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1814(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1813, v ds
+# define BFI_FLINEARC_1814_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1813(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1812, v ds
+# define BFI_FLINEARC_1813_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1812(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1811, v ds
+# define BFI_FLINEARC_1812_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1811(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1810, v ds
+# define BFI_FLINEARC_1811_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1810(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1809, v ds
+# define BFI_FLINEARC_1810_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1809(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1808, v ds
+# define BFI_FLINEARC_1809_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1808(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1807, v ds
+# define BFI_FLINEARC_1808_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1807(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1806, v ds
+# define BFI_FLINEARC_1807_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1806(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1805, v ds
+# define BFI_FLINEARC_1806_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1805(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1804, v ds
+# define BFI_FLINEARC_1805_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1804(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1803, v ds
+# define BFI_FLINEARC_1804_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1803(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1802, v ds
+# define BFI_FLINEARC_1803_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1802(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1801, v ds
+# define BFI_FLINEARC_1802_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1801(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1800, v ds
+# define BFI_FLINEARC_1801_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1800(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1799, v ds
+# define BFI_FLINEARC_1800_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1799(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1798, v ds
+# define BFI_FLINEARC_1799_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1798(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1797, v ds
+# define BFI_FLINEARC_1798_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1797(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1796, v ds
+# define BFI_FLINEARC_1797_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1796(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1795, v ds
+# define BFI_FLINEARC_1796_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1795(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1794, v ds
+# define BFI_FLINEARC_1795_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1794(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1793, v ds
+# define BFI_FLINEARC_1794_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1793(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1792, v ds
+# define BFI_FLINEARC_1793_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1792(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1791, v ds
+# define BFI_FLINEARC_1792_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1791(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1790, v ds
+# define BFI_FLINEARC_1791_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1790(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1789, v ds
+# define BFI_FLINEARC_1790_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1789(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1788, v ds
+# define BFI_FLINEARC_1789_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1788(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1787, v ds
+# define BFI_FLINEARC_1788_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1787(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1786, v ds
+# define BFI_FLINEARC_1787_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1786(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1785, v ds
+# define BFI_FLINEARC_1786_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1785(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1784, v ds
+# define BFI_FLINEARC_1785_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1784(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1783, v ds
+# define BFI_FLINEARC_1784_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1783(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1782, v ds
+# define BFI_FLINEARC_1783_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1782(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1781, v ds
+# define BFI_FLINEARC_1782_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1781(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1780, v ds
+# define BFI_FLINEARC_1781_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1780(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1779, v ds
+# define BFI_FLINEARC_1780_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1779(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1778, v ds
+# define BFI_FLINEARC_1779_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1778(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1777, v ds
+# define BFI_FLINEARC_1778_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1777(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1776, v ds
+# define BFI_FLINEARC_1777_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1776(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1775, v ds
+# define BFI_FLINEARC_1776_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1775(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1774, v ds
+# define BFI_FLINEARC_1775_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1774(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1773, v ds
+# define BFI_FLINEARC_1774_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1773(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1772, v ds
+# define BFI_FLINEARC_1773_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1772(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1771, v ds
+# define BFI_FLINEARC_1772_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1771(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1770, v ds
+# define BFI_FLINEARC_1771_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1770(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1769, v ds
+# define BFI_FLINEARC_1770_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1769(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1768, v ds
+# define BFI_FLINEARC_1769_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1768(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1767, v ds
+# define BFI_FLINEARC_1768_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1767(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1766, v ds
+# define BFI_FLINEARC_1767_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1766(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1765, v ds
+# define BFI_FLINEARC_1766_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1765(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1764, v ds
+# define BFI_FLINEARC_1765_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1764(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1763, v ds
+# define BFI_FLINEARC_1764_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1763(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1762, v ds
+# define BFI_FLINEARC_1763_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1762(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1761, v ds
+# define BFI_FLINEARC_1762_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1761(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1760, v ds
+# define BFI_FLINEARC_1761_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1760(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1759, v ds
+# define BFI_FLINEARC_1760_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1759(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1758, v ds
+# define BFI_FLINEARC_1759_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1758(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1757, v ds
+# define BFI_FLINEARC_1758_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1757(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1756, v ds
+# define BFI_FLINEARC_1757_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1756(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1755, v ds
+# define BFI_FLINEARC_1756_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1755(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1754, v ds
+# define BFI_FLINEARC_1755_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1754(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1753, v ds
+# define BFI_FLINEARC_1754_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1753(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1752, v ds
+# define BFI_FLINEARC_1753_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1752(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1751, v ds
+# define BFI_FLINEARC_1752_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1751(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1750, v ds
+# define BFI_FLINEARC_1751_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1750(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1749, v ds
+# define BFI_FLINEARC_1750_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1749(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1748, v ds
+# define BFI_FLINEARC_1749_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1748(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1747, v ds
+# define BFI_FLINEARC_1748_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1747(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1746, v ds
+# define BFI_FLINEARC_1747_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1746(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1745, v ds
+# define BFI_FLINEARC_1746_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1745(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1744, v ds
+# define BFI_FLINEARC_1745_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1744(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1743, v ds
+# define BFI_FLINEARC_1744_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1743(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1742, v ds
+# define BFI_FLINEARC_1743_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1742(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1741, v ds
+# define BFI_FLINEARC_1742_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1741(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1740, v ds
+# define BFI_FLINEARC_1741_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1740(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1739, v ds
+# define BFI_FLINEARC_1740_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1739(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1738, v ds
+# define BFI_FLINEARC_1739_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1738(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1737, v ds
+# define BFI_FLINEARC_1738_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1737(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1736, v ds
+# define BFI_FLINEARC_1737_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1736(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1735, v ds
+# define BFI_FLINEARC_1736_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1735(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1734, v ds
+# define BFI_FLINEARC_1735_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1734(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1733, v ds
+# define BFI_FLINEARC_1734_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1733(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1732, v ds
+# define BFI_FLINEARC_1733_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1732(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1731, v ds
+# define BFI_FLINEARC_1732_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1731(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1730, v ds
+# define BFI_FLINEARC_1731_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1730(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1729, v ds
+# define BFI_FLINEARC_1730_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1729(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1728, v ds
+# define BFI_FLINEARC_1729_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1728(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1727, v ds
+# define BFI_FLINEARC_1728_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1727(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1726, v ds
+# define BFI_FLINEARC_1727_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1726(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1725, v ds
+# define BFI_FLINEARC_1726_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1725(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1724, v ds
+# define BFI_FLINEARC_1725_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1724(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1723, v ds
+# define BFI_FLINEARC_1724_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1723(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1722, v ds
+# define BFI_FLINEARC_1723_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1722(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1721, v ds
+# define BFI_FLINEARC_1722_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1721(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1720, v ds
+# define BFI_FLINEARC_1721_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1720(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1719, v ds
+# define BFI_FLINEARC_1720_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1719(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1718, v ds
+# define BFI_FLINEARC_1719_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1718(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1717, v ds
+# define BFI_FLINEARC_1718_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1717(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1716, v ds
+# define BFI_FLINEARC_1717_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1716(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1715, v ds
+# define BFI_FLINEARC_1716_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1715(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1714, v ds
+# define BFI_FLINEARC_1715_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1714(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1713, v ds
+# define BFI_FLINEARC_1714_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1713(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1712, v ds
+# define BFI_FLINEARC_1713_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1712(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1711, v ds
+# define BFI_FLINEARC_1712_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1711(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1710, v ds
+# define BFI_FLINEARC_1711_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1710(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1709, v ds
+# define BFI_FLINEARC_1710_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1709(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1708, v ds
+# define BFI_FLINEARC_1709_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1708(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1707, v ds
+# define BFI_FLINEARC_1708_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1707(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1706, v ds
+# define BFI_FLINEARC_1707_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1706(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1705, v ds
+# define BFI_FLINEARC_1706_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1705(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1704, v ds
+# define BFI_FLINEARC_1705_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1704(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1703, v ds
+# define BFI_FLINEARC_1704_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1703(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1702, v ds
+# define BFI_FLINEARC_1703_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1702(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1701, v ds
+# define BFI_FLINEARC_1702_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1701(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1700, v ds
+# define BFI_FLINEARC_1701_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1700(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1699, v ds
+# define BFI_FLINEARC_1700_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1699(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1698, v ds
+# define BFI_FLINEARC_1699_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1698(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1697, v ds
+# define BFI_FLINEARC_1698_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1697(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1696, v ds
+# define BFI_FLINEARC_1697_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1696(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1695, v ds
+# define BFI_FLINEARC_1696_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1695(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1694, v ds
+# define BFI_FLINEARC_1695_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1694(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1693, v ds
+# define BFI_FLINEARC_1694_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1693(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1692, v ds
+# define BFI_FLINEARC_1693_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1692(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1691, v ds
+# define BFI_FLINEARC_1692_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1691(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1690, v ds
+# define BFI_FLINEARC_1691_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1690(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1689, v ds
+# define BFI_FLINEARC_1690_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1689(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1688, v ds
+# define BFI_FLINEARC_1689_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1688(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1687, v ds
+# define BFI_FLINEARC_1688_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1687(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1686, v ds
+# define BFI_FLINEARC_1687_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1686(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1685, v ds
+# define BFI_FLINEARC_1686_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1685(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1684, v ds
+# define BFI_FLINEARC_1685_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1684(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1683, v ds
+# define BFI_FLINEARC_1684_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1683(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1682, v ds
+# define BFI_FLINEARC_1683_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1682(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1681, v ds
+# define BFI_FLINEARC_1682_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1681(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1680, v ds
+# define BFI_FLINEARC_1681_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1680(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1679, v ds
+# define BFI_FLINEARC_1680_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1679(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1678, v ds
+# define BFI_FLINEARC_1679_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1678(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1677, v ds
+# define BFI_FLINEARC_1678_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1677(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1676, v ds
+# define BFI_FLINEARC_1677_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1676(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1675, v ds
+# define BFI_FLINEARC_1676_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1675(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1674, v ds
+# define BFI_FLINEARC_1675_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1674(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1673, v ds
+# define BFI_FLINEARC_1674_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1673(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1672, v ds
+# define BFI_FLINEARC_1673_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1672(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1671, v ds
+# define BFI_FLINEARC_1672_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1671(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1670, v ds
+# define BFI_FLINEARC_1671_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1670(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1669, v ds
+# define BFI_FLINEARC_1670_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1669(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1668, v ds
+# define BFI_FLINEARC_1669_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1668(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1667, v ds
+# define BFI_FLINEARC_1668_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1667(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1666, v ds
+# define BFI_FLINEARC_1667_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1666(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1665, v ds
+# define BFI_FLINEARC_1666_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1665(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1664, v ds
+# define BFI_FLINEARC_1665_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1664(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1663, v ds
+# define BFI_FLINEARC_1664_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1663(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1662, v ds
+# define BFI_FLINEARC_1663_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1662(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1661, v ds
+# define BFI_FLINEARC_1662_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1661(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1660, v ds
+# define BFI_FLINEARC_1661_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1660(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1659, v ds
+# define BFI_FLINEARC_1660_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1659(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1658, v ds
+# define BFI_FLINEARC_1659_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1658(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1657, v ds
+# define BFI_FLINEARC_1658_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1657(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1656, v ds
+# define BFI_FLINEARC_1657_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1656(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1655, v ds
+# define BFI_FLINEARC_1656_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1655(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1654, v ds
+# define BFI_FLINEARC_1655_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1654(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1653, v ds
+# define BFI_FLINEARC_1654_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1653(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1652, v ds
+# define BFI_FLINEARC_1653_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1652(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1651, v ds
+# define BFI_FLINEARC_1652_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1651(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1650, v ds
+# define BFI_FLINEARC_1651_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1650(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1649, v ds
+# define BFI_FLINEARC_1650_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1649(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1648, v ds
+# define BFI_FLINEARC_1649_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1648(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1647, v ds
+# define BFI_FLINEARC_1648_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1647(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1646, v ds
+# define BFI_FLINEARC_1647_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1646(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1645, v ds
+# define BFI_FLINEARC_1646_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1645(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1644, v ds
+# define BFI_FLINEARC_1645_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1644(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1643, v ds
+# define BFI_FLINEARC_1644_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1643(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1642, v ds
+# define BFI_FLINEARC_1643_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1642(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1641, v ds
+# define BFI_FLINEARC_1642_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1641(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1640, v ds
+# define BFI_FLINEARC_1641_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1640(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1639, v ds
+# define BFI_FLINEARC_1640_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1639(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1638, v ds
+# define BFI_FLINEARC_1639_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1638(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1637, v ds
+# define BFI_FLINEARC_1638_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1637(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1636, v ds
+# define BFI_FLINEARC_1637_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1636(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1635, v ds
+# define BFI_FLINEARC_1636_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1635(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1634, v ds
+# define BFI_FLINEARC_1635_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1634(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1633, v ds
+# define BFI_FLINEARC_1634_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1633(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1632, v ds
+# define BFI_FLINEARC_1633_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1632(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1631, v ds
+# define BFI_FLINEARC_1632_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1631(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1630, v ds
+# define BFI_FLINEARC_1631_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1630(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1629, v ds
+# define BFI_FLINEARC_1630_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1629(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1628, v ds
+# define BFI_FLINEARC_1629_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1628(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1627, v ds
+# define BFI_FLINEARC_1628_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1627(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1626, v ds
+# define BFI_FLINEARC_1627_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1626(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1625, v ds
+# define BFI_FLINEARC_1626_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1625(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1624, v ds
+# define BFI_FLINEARC_1625_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1624(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1623, v ds
+# define BFI_FLINEARC_1624_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1623(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1622, v ds
+# define BFI_FLINEARC_1623_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1622(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1621, v ds
+# define BFI_FLINEARC_1622_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1621(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1620, v ds
+# define BFI_FLINEARC_1621_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1620(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1619, v ds
+# define BFI_FLINEARC_1620_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1619(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1618, v ds
+# define BFI_FLINEARC_1619_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1618(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1617, v ds
+# define BFI_FLINEARC_1618_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1617(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1616, v ds
+# define BFI_FLINEARC_1617_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1616(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1615, v ds
+# define BFI_FLINEARC_1616_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1615(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1614, v ds
+# define BFI_FLINEARC_1615_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1614(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1613, v ds
+# define BFI_FLINEARC_1614_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1613(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1612, v ds
+# define BFI_FLINEARC_1613_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1612(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1611, v ds
+# define BFI_FLINEARC_1612_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1611(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1610, v ds
+# define BFI_FLINEARC_1611_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1610(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1609, v ds
+# define BFI_FLINEARC_1610_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1609(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1608, v ds
+# define BFI_FLINEARC_1609_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1608(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1607, v ds
+# define BFI_FLINEARC_1608_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1607(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1606, v ds
+# define BFI_FLINEARC_1607_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1606(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1605, v ds
+# define BFI_FLINEARC_1606_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1605(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1604, v ds
+# define BFI_FLINEARC_1605_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1604(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1603, v ds
+# define BFI_FLINEARC_1604_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1603(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1602, v ds
+# define BFI_FLINEARC_1603_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1602(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1601, v ds
+# define BFI_FLINEARC_1602_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1601(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1600, v ds
+# define BFI_FLINEARC_1601_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1600(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1599, v ds
+# define BFI_FLINEARC_1600_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1599(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1598, v ds
+# define BFI_FLINEARC_1599_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1598(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1597, v ds
+# define BFI_FLINEARC_1598_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1597(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1596, v ds
+# define BFI_FLINEARC_1597_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1596(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1595, v ds
+# define BFI_FLINEARC_1596_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1595(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1594, v ds
+# define BFI_FLINEARC_1595_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1594(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1593, v ds
+# define BFI_FLINEARC_1594_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1593(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1592, v ds
+# define BFI_FLINEARC_1593_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1592(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1591, v ds
+# define BFI_FLINEARC_1592_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1591(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1590, v ds
+# define BFI_FLINEARC_1591_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1590(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1589, v ds
+# define BFI_FLINEARC_1590_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1589(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1588, v ds
+# define BFI_FLINEARC_1589_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1588(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1587, v ds
+# define BFI_FLINEARC_1588_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1587(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1586, v ds
+# define BFI_FLINEARC_1587_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1586(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1585, v ds
+# define BFI_FLINEARC_1586_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1585(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1584, v ds
+# define BFI_FLINEARC_1585_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1584(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1583, v ds
+# define BFI_FLINEARC_1584_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1583(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1582, v ds
+# define BFI_FLINEARC_1583_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1582(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1581, v ds
+# define BFI_FLINEARC_1582_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1581(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1580, v ds
+# define BFI_FLINEARC_1581_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1580(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1579, v ds
+# define BFI_FLINEARC_1580_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1579(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1578, v ds
+# define BFI_FLINEARC_1579_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1578(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1577, v ds
+# define BFI_FLINEARC_1578_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1577(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1576, v ds
+# define BFI_FLINEARC_1577_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1576(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1575, v ds
+# define BFI_FLINEARC_1576_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1575(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1574, v ds
+# define BFI_FLINEARC_1575_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1574(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1573, v ds
+# define BFI_FLINEARC_1574_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1573(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1572, v ds
+# define BFI_FLINEARC_1573_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1572(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1571, v ds
+# define BFI_FLINEARC_1572_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1571(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1570, v ds
+# define BFI_FLINEARC_1571_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1570(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1569, v ds
+# define BFI_FLINEARC_1570_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1569(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1568, v ds
+# define BFI_FLINEARC_1569_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1568(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1567, v ds
+# define BFI_FLINEARC_1568_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1567(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1566, v ds
+# define BFI_FLINEARC_1567_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1566(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1565, v ds
+# define BFI_FLINEARC_1566_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1565(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1564, v ds
+# define BFI_FLINEARC_1565_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1564(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1563, v ds
+# define BFI_FLINEARC_1564_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1563(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1562, v ds
+# define BFI_FLINEARC_1563_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1562(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1561, v ds
+# define BFI_FLINEARC_1562_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1561(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1560, v ds
+# define BFI_FLINEARC_1561_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1560(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1559, v ds
+# define BFI_FLINEARC_1560_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1559(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1558, v ds
+# define BFI_FLINEARC_1559_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1558(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1557, v ds
+# define BFI_FLINEARC_1558_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1557(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1556, v ds
+# define BFI_FLINEARC_1557_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1556(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1555, v ds
+# define BFI_FLINEARC_1556_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1555(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1554, v ds
+# define BFI_FLINEARC_1555_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1554(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1553, v ds
+# define BFI_FLINEARC_1554_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1553(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1552, v ds
+# define BFI_FLINEARC_1553_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1552(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1551, v ds
+# define BFI_FLINEARC_1552_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1551(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1550, v ds
+# define BFI_FLINEARC_1551_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1550(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1549, v ds
+# define BFI_FLINEARC_1550_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1549(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1548, v ds
+# define BFI_FLINEARC_1549_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1548(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1547, v ds
+# define BFI_FLINEARC_1548_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1547(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1546, v ds
+# define BFI_FLINEARC_1547_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1546(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1545, v ds
+# define BFI_FLINEARC_1546_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1545(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1544, v ds
+# define BFI_FLINEARC_1545_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1544(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1543, v ds
+# define BFI_FLINEARC_1544_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1543(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1542, v ds
+# define BFI_FLINEARC_1543_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1542(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1541, v ds
+# define BFI_FLINEARC_1542_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1541(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1540, v ds
+# define BFI_FLINEARC_1541_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1540(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1539, v ds
+# define BFI_FLINEARC_1540_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1539(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1538, v ds
+# define BFI_FLINEARC_1539_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1538(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1537, v ds
+# define BFI_FLINEARC_1538_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1537(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1536, v ds
+# define BFI_FLINEARC_1537_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1536(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1535, v ds
+# define BFI_FLINEARC_1536_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1535(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1534, v ds
+# define BFI_FLINEARC_1535_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1534(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1533, v ds
+# define BFI_FLINEARC_1534_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1533(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1532, v ds
+# define BFI_FLINEARC_1533_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1532(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1531, v ds
+# define BFI_FLINEARC_1532_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1531(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1530, v ds
+# define BFI_FLINEARC_1531_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1530(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1529, v ds
+# define BFI_FLINEARC_1530_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1529(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1528, v ds
+# define BFI_FLINEARC_1529_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1528(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1527, v ds
+# define BFI_FLINEARC_1528_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1527(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1526, v ds
+# define BFI_FLINEARC_1527_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1526(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1525, v ds
+# define BFI_FLINEARC_1526_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1525(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1524, v ds
+# define BFI_FLINEARC_1525_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1524(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1523, v ds
+# define BFI_FLINEARC_1524_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1523(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1522, v ds
+# define BFI_FLINEARC_1523_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1522(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1521, v ds
+# define BFI_FLINEARC_1522_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1521(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1520, v ds
+# define BFI_FLINEARC_1521_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1520(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1519, v ds
+# define BFI_FLINEARC_1520_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1519(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1518, v ds
+# define BFI_FLINEARC_1519_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1518(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1517, v ds
+# define BFI_FLINEARC_1518_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1517(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1516, v ds
+# define BFI_FLINEARC_1517_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1516(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1515, v ds
+# define BFI_FLINEARC_1516_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1515(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1514, v ds
+# define BFI_FLINEARC_1515_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1514(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1513, v ds
+# define BFI_FLINEARC_1514_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1513(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1512, v ds
+# define BFI_FLINEARC_1513_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1512(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1511, v ds
+# define BFI_FLINEARC_1512_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1511(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1510, v ds
+# define BFI_FLINEARC_1511_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1510(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1509, v ds
+# define BFI_FLINEARC_1510_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1509(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1508, v ds
+# define BFI_FLINEARC_1509_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1508(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1507, v ds
+# define BFI_FLINEARC_1508_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1507(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1506, v ds
+# define BFI_FLINEARC_1507_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1506(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1505, v ds
+# define BFI_FLINEARC_1506_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1505(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1504, v ds
+# define BFI_FLINEARC_1505_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1504(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1503, v ds
+# define BFI_FLINEARC_1504_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1503(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1502, v ds
+# define BFI_FLINEARC_1503_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1502(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1501, v ds
+# define BFI_FLINEARC_1502_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1501(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1500, v ds
+# define BFI_FLINEARC_1501_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1500(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1499, v ds
+# define BFI_FLINEARC_1500_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1499(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1498, v ds
+# define BFI_FLINEARC_1499_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1498(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1497, v ds
+# define BFI_FLINEARC_1498_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1497(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1496, v ds
+# define BFI_FLINEARC_1497_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1496(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1495, v ds
+# define BFI_FLINEARC_1496_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1495(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1494, v ds
+# define BFI_FLINEARC_1495_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1494(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1493, v ds
+# define BFI_FLINEARC_1494_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1493(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1492, v ds
+# define BFI_FLINEARC_1493_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1492(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1491, v ds
+# define BFI_FLINEARC_1492_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1491(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1490, v ds
+# define BFI_FLINEARC_1491_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1490(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1489, v ds
+# define BFI_FLINEARC_1490_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1489(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1488, v ds
+# define BFI_FLINEARC_1489_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1488(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1487, v ds
+# define BFI_FLINEARC_1488_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1487(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1486, v ds
+# define BFI_FLINEARC_1487_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1486(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1485, v ds
+# define BFI_FLINEARC_1486_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1485(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1484, v ds
+# define BFI_FLINEARC_1485_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1484(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1483, v ds
+# define BFI_FLINEARC_1484_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1483(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1482, v ds
+# define BFI_FLINEARC_1483_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1482(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1481, v ds
+# define BFI_FLINEARC_1482_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1481(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1480, v ds
+# define BFI_FLINEARC_1481_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1480(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1479, v ds
+# define BFI_FLINEARC_1480_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1479(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1478, v ds
+# define BFI_FLINEARC_1479_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1478(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1477, v ds
+# define BFI_FLINEARC_1478_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1477(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1476, v ds
+# define BFI_FLINEARC_1477_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1476(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1475, v ds
+# define BFI_FLINEARC_1476_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1475(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1474, v ds
+# define BFI_FLINEARC_1475_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1474(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1473, v ds
+# define BFI_FLINEARC_1474_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1473(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1472, v ds
+# define BFI_FLINEARC_1473_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1472(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1471, v ds
+# define BFI_FLINEARC_1472_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1471(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1470, v ds
+# define BFI_FLINEARC_1471_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1470(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1469, v ds
+# define BFI_FLINEARC_1470_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1469(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1468, v ds
+# define BFI_FLINEARC_1469_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1468(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1467, v ds
+# define BFI_FLINEARC_1468_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1467(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1466, v ds
+# define BFI_FLINEARC_1467_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1466(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1465, v ds
+# define BFI_FLINEARC_1466_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1465(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1464, v ds
+# define BFI_FLINEARC_1465_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1464(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1463, v ds
+# define BFI_FLINEARC_1464_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1463(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1462, v ds
+# define BFI_FLINEARC_1463_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1462(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1461, v ds
+# define BFI_FLINEARC_1462_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1461(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1460, v ds
+# define BFI_FLINEARC_1461_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1460(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1459, v ds
+# define BFI_FLINEARC_1460_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1459(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1458, v ds
+# define BFI_FLINEARC_1459_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1458(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1457, v ds
+# define BFI_FLINEARC_1458_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1457(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1456, v ds
+# define BFI_FLINEARC_1457_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1456(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1455, v ds
+# define BFI_FLINEARC_1456_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1455(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1454, v ds
+# define BFI_FLINEARC_1455_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1454(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1453, v ds
+# define BFI_FLINEARC_1454_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1453(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1452, v ds
+# define BFI_FLINEARC_1453_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1452(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1451, v ds
+# define BFI_FLINEARC_1452_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1451(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1450, v ds
+# define BFI_FLINEARC_1451_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1450(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1449, v ds
+# define BFI_FLINEARC_1450_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1449(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1448, v ds
+# define BFI_FLINEARC_1449_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1448(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1447, v ds
+# define BFI_FLINEARC_1448_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1447(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1446, v ds
+# define BFI_FLINEARC_1447_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1446(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1445, v ds
+# define BFI_FLINEARC_1446_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1445(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1444, v ds
+# define BFI_FLINEARC_1445_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1444(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1443, v ds
+# define BFI_FLINEARC_1444_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1443(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1442, v ds
+# define BFI_FLINEARC_1443_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1442(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1441, v ds
+# define BFI_FLINEARC_1442_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1441(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1440, v ds
+# define BFI_FLINEARC_1441_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1440(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1439, v ds
+# define BFI_FLINEARC_1440_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1439(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1438, v ds
+# define BFI_FLINEARC_1439_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1438(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1437, v ds
+# define BFI_FLINEARC_1438_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1437(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1436, v ds
+# define BFI_FLINEARC_1437_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1436(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1435, v ds
+# define BFI_FLINEARC_1436_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1435(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1434, v ds
+# define BFI_FLINEARC_1435_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1434(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1433, v ds
+# define BFI_FLINEARC_1434_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1433(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1432, v ds
+# define BFI_FLINEARC_1433_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1432(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1431, v ds
+# define BFI_FLINEARC_1432_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1431(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1430, v ds
+# define BFI_FLINEARC_1431_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1430(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1429, v ds
+# define BFI_FLINEARC_1430_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1429(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1428, v ds
+# define BFI_FLINEARC_1429_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1428(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1427, v ds
+# define BFI_FLINEARC_1428_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1427(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1426, v ds
+# define BFI_FLINEARC_1427_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1426(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1425, v ds
+# define BFI_FLINEARC_1426_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1425(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1424, v ds
+# define BFI_FLINEARC_1425_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1424(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1423, v ds
+# define BFI_FLINEARC_1424_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1423(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1422, v ds
+# define BFI_FLINEARC_1423_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1422(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1421, v ds
+# define BFI_FLINEARC_1422_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1421(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1420, v ds
+# define BFI_FLINEARC_1421_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1420(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1419, v ds
+# define BFI_FLINEARC_1420_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1419(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1418, v ds
+# define BFI_FLINEARC_1419_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1418(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1417, v ds
+# define BFI_FLINEARC_1418_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1417(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1416, v ds
+# define BFI_FLINEARC_1417_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1416(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1415, v ds
+# define BFI_FLINEARC_1416_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1415(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1414, v ds
+# define BFI_FLINEARC_1415_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1414(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1413, v ds
+# define BFI_FLINEARC_1414_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1413(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1412, v ds
+# define BFI_FLINEARC_1413_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1412(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1411, v ds
+# define BFI_FLINEARC_1412_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1411(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1410, v ds
+# define BFI_FLINEARC_1411_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1410(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1409, v ds
+# define BFI_FLINEARC_1410_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1409(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1408, v ds
+# define BFI_FLINEARC_1409_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1408(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1407, v ds
+# define BFI_FLINEARC_1408_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1407(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1406, v ds
+# define BFI_FLINEARC_1407_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1406(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1405, v ds
+# define BFI_FLINEARC_1406_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1405(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1404, v ds
+# define BFI_FLINEARC_1405_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1404(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1403, v ds
+# define BFI_FLINEARC_1404_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1403(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1402, v ds
+# define BFI_FLINEARC_1403_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1402(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1401, v ds
+# define BFI_FLINEARC_1402_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1401(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1400, v ds
+# define BFI_FLINEARC_1401_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1400(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1399, v ds
+# define BFI_FLINEARC_1400_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1399(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1398, v ds
+# define BFI_FLINEARC_1399_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1398(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1397, v ds
+# define BFI_FLINEARC_1398_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1397(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1396, v ds
+# define BFI_FLINEARC_1397_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1396(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1395, v ds
+# define BFI_FLINEARC_1396_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1395(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1394, v ds
+# define BFI_FLINEARC_1395_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1394(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1393, v ds
+# define BFI_FLINEARC_1394_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1393(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1392, v ds
+# define BFI_FLINEARC_1393_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1392(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1391, v ds
+# define BFI_FLINEARC_1392_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1391(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1390, v ds
+# define BFI_FLINEARC_1391_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1390(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1389, v ds
+# define BFI_FLINEARC_1390_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1389(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1388, v ds
+# define BFI_FLINEARC_1389_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1388(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1387, v ds
+# define BFI_FLINEARC_1388_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1387(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1386, v ds
+# define BFI_FLINEARC_1387_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1386(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1385, v ds
+# define BFI_FLINEARC_1386_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1385(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1384, v ds
+# define BFI_FLINEARC_1385_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1384(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1383, v ds
+# define BFI_FLINEARC_1384_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1383(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1382, v ds
+# define BFI_FLINEARC_1383_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1382(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1381, v ds
+# define BFI_FLINEARC_1382_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1381(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1380, v ds
+# define BFI_FLINEARC_1381_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1380(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1379, v ds
+# define BFI_FLINEARC_1380_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1379(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1378, v ds
+# define BFI_FLINEARC_1379_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1378(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1377, v ds
+# define BFI_FLINEARC_1378_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1377(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1376, v ds
+# define BFI_FLINEARC_1377_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1376(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1375, v ds
+# define BFI_FLINEARC_1376_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1375(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1374, v ds
+# define BFI_FLINEARC_1375_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1374(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1373, v ds
+# define BFI_FLINEARC_1374_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1373(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1372, v ds
+# define BFI_FLINEARC_1373_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1372(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1371, v ds
+# define BFI_FLINEARC_1372_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1371(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1370, v ds
+# define BFI_FLINEARC_1371_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1370(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1369, v ds
+# define BFI_FLINEARC_1370_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1369(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1368, v ds
+# define BFI_FLINEARC_1369_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1368(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1367, v ds
+# define BFI_FLINEARC_1368_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1367(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1366, v ds
+# define BFI_FLINEARC_1367_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1366(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1365, v ds
+# define BFI_FLINEARC_1366_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1365(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1364, v ds
+# define BFI_FLINEARC_1365_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1364(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1363, v ds
+# define BFI_FLINEARC_1364_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1363(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1362, v ds
+# define BFI_FLINEARC_1363_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1362(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1361, v ds
+# define BFI_FLINEARC_1362_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1361(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1360, v ds
+# define BFI_FLINEARC_1361_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1360(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1359, v ds
+# define BFI_FLINEARC_1360_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1359(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1358, v ds
+# define BFI_FLINEARC_1359_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1358(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1357, v ds
+# define BFI_FLINEARC_1358_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1357(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1356, v ds
+# define BFI_FLINEARC_1357_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1356(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1355, v ds
+# define BFI_FLINEARC_1356_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1355(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1354, v ds
+# define BFI_FLINEARC_1355_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1354(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1353, v ds
+# define BFI_FLINEARC_1354_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1353(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1352, v ds
+# define BFI_FLINEARC_1353_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1352(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1351, v ds
+# define BFI_FLINEARC_1352_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1351(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1350, v ds
+# define BFI_FLINEARC_1351_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1350(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1349, v ds
+# define BFI_FLINEARC_1350_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1349(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1348, v ds
+# define BFI_FLINEARC_1349_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1348(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1347, v ds
+# define BFI_FLINEARC_1348_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1347(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1346, v ds
+# define BFI_FLINEARC_1347_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1346(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1345, v ds
+# define BFI_FLINEARC_1346_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1345(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1344, v ds
+# define BFI_FLINEARC_1345_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1344(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1343, v ds
+# define BFI_FLINEARC_1344_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1343(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1342, v ds
+# define BFI_FLINEARC_1343_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1342(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1341, v ds
+# define BFI_FLINEARC_1342_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1341(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1340, v ds
+# define BFI_FLINEARC_1341_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1340(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1339, v ds
+# define BFI_FLINEARC_1340_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1339(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1338, v ds
+# define BFI_FLINEARC_1339_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1338(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1337, v ds
+# define BFI_FLINEARC_1338_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1337(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1336, v ds
+# define BFI_FLINEARC_1337_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1336(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1335, v ds
+# define BFI_FLINEARC_1336_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1335(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1334, v ds
+# define BFI_FLINEARC_1335_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1334(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1333, v ds
+# define BFI_FLINEARC_1334_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1333(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1332, v ds
+# define BFI_FLINEARC_1333_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1332(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1331, v ds
+# define BFI_FLINEARC_1332_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1331(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1330, v ds
+# define BFI_FLINEARC_1331_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1330(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1329, v ds
+# define BFI_FLINEARC_1330_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1329(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1328, v ds
+# define BFI_FLINEARC_1329_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1328(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1327, v ds
+# define BFI_FLINEARC_1328_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1327(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1326, v ds
+# define BFI_FLINEARC_1327_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1326(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1325, v ds
+# define BFI_FLINEARC_1326_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1325(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1324, v ds
+# define BFI_FLINEARC_1325_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1324(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1323, v ds
+# define BFI_FLINEARC_1324_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1323(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1322, v ds
+# define BFI_FLINEARC_1323_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1322(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1321, v ds
+# define BFI_FLINEARC_1322_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1321(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1320, v ds
+# define BFI_FLINEARC_1321_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1320(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1319, v ds
+# define BFI_FLINEARC_1320_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1319(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1318, v ds
+# define BFI_FLINEARC_1319_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1318(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1317, v ds
+# define BFI_FLINEARC_1318_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1317(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1316, v ds
+# define BFI_FLINEARC_1317_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1316(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1315, v ds
+# define BFI_FLINEARC_1316_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1315(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1314, v ds
+# define BFI_FLINEARC_1315_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1314(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1313, v ds
+# define BFI_FLINEARC_1314_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1313(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1312, v ds
+# define BFI_FLINEARC_1313_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1312(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1311, v ds
+# define BFI_FLINEARC_1312_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1311(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1310, v ds
+# define BFI_FLINEARC_1311_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1310(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1309, v ds
+# define BFI_FLINEARC_1310_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1309(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1308, v ds
+# define BFI_FLINEARC_1309_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1308(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1307, v ds
+# define BFI_FLINEARC_1308_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1307(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1306, v ds
+# define BFI_FLINEARC_1307_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1306(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1305, v ds
+# define BFI_FLINEARC_1306_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1305(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1304, v ds
+# define BFI_FLINEARC_1305_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1304(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1303, v ds
+# define BFI_FLINEARC_1304_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1303(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1302, v ds
+# define BFI_FLINEARC_1303_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1302(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1301, v ds
+# define BFI_FLINEARC_1302_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1301(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1300, v ds
+# define BFI_FLINEARC_1301_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1300(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1299, v ds
+# define BFI_FLINEARC_1300_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1299(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1298, v ds
+# define BFI_FLINEARC_1299_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1298(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1297, v ds
+# define BFI_FLINEARC_1298_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1297(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1296, v ds
+# define BFI_FLINEARC_1297_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1296(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1295, v ds
+# define BFI_FLINEARC_1296_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1295(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1294, v ds
+# define BFI_FLINEARC_1295_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1294(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1293, v ds
+# define BFI_FLINEARC_1294_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1293(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1292, v ds
+# define BFI_FLINEARC_1293_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1292(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1291, v ds
+# define BFI_FLINEARC_1292_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1291(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1290, v ds
+# define BFI_FLINEARC_1291_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1290(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1289, v ds
+# define BFI_FLINEARC_1290_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1289(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1288, v ds
+# define BFI_FLINEARC_1289_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1288(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1287, v ds
+# define BFI_FLINEARC_1288_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1287(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1286, v ds
+# define BFI_FLINEARC_1287_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1286(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1285, v ds
+# define BFI_FLINEARC_1286_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1285(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1284, v ds
+# define BFI_FLINEARC_1285_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1284(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1283, v ds
+# define BFI_FLINEARC_1284_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1283(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1282, v ds
+# define BFI_FLINEARC_1283_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1282(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1281, v ds
+# define BFI_FLINEARC_1282_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1281(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1280, v ds
+# define BFI_FLINEARC_1281_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1280(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1279, v ds
+# define BFI_FLINEARC_1280_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1279(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1278, v ds
+# define BFI_FLINEARC_1279_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1278(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1277, v ds
+# define BFI_FLINEARC_1278_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1277(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1276, v ds
+# define BFI_FLINEARC_1277_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1276(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1275, v ds
+# define BFI_FLINEARC_1276_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1275(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1274, v ds
+# define BFI_FLINEARC_1275_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1274(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1273, v ds
+# define BFI_FLINEARC_1274_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1273(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1272, v ds
+# define BFI_FLINEARC_1273_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1272(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1271, v ds
+# define BFI_FLINEARC_1272_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1271(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1270, v ds
+# define BFI_FLINEARC_1271_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1270(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1269, v ds
+# define BFI_FLINEARC_1270_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1269(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1268, v ds
+# define BFI_FLINEARC_1269_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1268(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1267, v ds
+# define BFI_FLINEARC_1268_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1267(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1266, v ds
+# define BFI_FLINEARC_1267_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1266(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1265, v ds
+# define BFI_FLINEARC_1266_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1265(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1264, v ds
+# define BFI_FLINEARC_1265_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1264(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1263, v ds
+# define BFI_FLINEARC_1264_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1263(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1262, v ds
+# define BFI_FLINEARC_1263_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1262(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1261, v ds
+# define BFI_FLINEARC_1262_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1261(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1260, v ds
+# define BFI_FLINEARC_1261_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1260(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1259, v ds
+# define BFI_FLINEARC_1260_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1259(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1258, v ds
+# define BFI_FLINEARC_1259_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1258(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1257, v ds
+# define BFI_FLINEARC_1258_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1257(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1256, v ds
+# define BFI_FLINEARC_1257_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1256(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1255, v ds
+# define BFI_FLINEARC_1256_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1255(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1254, v ds
+# define BFI_FLINEARC_1255_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1254(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1253, v ds
+# define BFI_FLINEARC_1254_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1253(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1252, v ds
+# define BFI_FLINEARC_1253_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1252(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1251, v ds
+# define BFI_FLINEARC_1252_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1251(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1250, v ds
+# define BFI_FLINEARC_1251_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1250(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1249, v ds
+# define BFI_FLINEARC_1250_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1249(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1248, v ds
+# define BFI_FLINEARC_1249_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1248(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1247, v ds
+# define BFI_FLINEARC_1248_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1247(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1246, v ds
+# define BFI_FLINEARC_1247_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1246(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1245, v ds
+# define BFI_FLINEARC_1246_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1245(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1244, v ds
+# define BFI_FLINEARC_1245_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1244(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1243, v ds
+# define BFI_FLINEARC_1244_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1243(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1242, v ds
+# define BFI_FLINEARC_1243_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1242(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1241, v ds
+# define BFI_FLINEARC_1242_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1241(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1240, v ds
+# define BFI_FLINEARC_1241_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1240(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1239, v ds
+# define BFI_FLINEARC_1240_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1239(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1238, v ds
+# define BFI_FLINEARC_1239_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1238(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1237, v ds
+# define BFI_FLINEARC_1238_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1237(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1236, v ds
+# define BFI_FLINEARC_1237_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1236(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1235, v ds
+# define BFI_FLINEARC_1236_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1235(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1234, v ds
+# define BFI_FLINEARC_1235_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1234(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1233, v ds
+# define BFI_FLINEARC_1234_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1233(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1232, v ds
+# define BFI_FLINEARC_1233_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1232(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1231, v ds
+# define BFI_FLINEARC_1232_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1231(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1230, v ds
+# define BFI_FLINEARC_1231_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1230(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1229, v ds
+# define BFI_FLINEARC_1230_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1229(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1228, v ds
+# define BFI_FLINEARC_1229_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1228(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1227, v ds
+# define BFI_FLINEARC_1228_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1227(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1226, v ds
+# define BFI_FLINEARC_1227_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1226(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1225, v ds
+# define BFI_FLINEARC_1226_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1225(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1224, v ds
+# define BFI_FLINEARC_1225_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1224(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1223, v ds
+# define BFI_FLINEARC_1224_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1223(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1222, v ds
+# define BFI_FLINEARC_1223_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1222(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1221, v ds
+# define BFI_FLINEARC_1222_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1221(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1220, v ds
+# define BFI_FLINEARC_1221_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1220(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1219, v ds
+# define BFI_FLINEARC_1220_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1219(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1218, v ds
+# define BFI_FLINEARC_1219_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1218(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1217, v ds
+# define BFI_FLINEARC_1218_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1217(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1216, v ds
+# define BFI_FLINEARC_1217_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1216(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1215, v ds
+# define BFI_FLINEARC_1216_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1215(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1214, v ds
+# define BFI_FLINEARC_1215_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1214(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1213, v ds
+# define BFI_FLINEARC_1214_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1213(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1212, v ds
+# define BFI_FLINEARC_1213_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1212(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1211, v ds
+# define BFI_FLINEARC_1212_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1211(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1210, v ds
+# define BFI_FLINEARC_1211_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1210(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1209, v ds
+# define BFI_FLINEARC_1210_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1209(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1208, v ds
+# define BFI_FLINEARC_1209_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1208(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1207, v ds
+# define BFI_FLINEARC_1208_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1207(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1206, v ds
+# define BFI_FLINEARC_1207_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1206(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1205, v ds
+# define BFI_FLINEARC_1206_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1205(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1204, v ds
+# define BFI_FLINEARC_1205_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1204(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1203, v ds
+# define BFI_FLINEARC_1204_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1203(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1202, v ds
+# define BFI_FLINEARC_1203_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1202(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1201, v ds
+# define BFI_FLINEARC_1202_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1201(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1200, v ds
+# define BFI_FLINEARC_1201_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1200(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1199, v ds
+# define BFI_FLINEARC_1200_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1199(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1198, v ds
+# define BFI_FLINEARC_1199_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1198(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1197, v ds
+# define BFI_FLINEARC_1198_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1197(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1196, v ds
+# define BFI_FLINEARC_1197_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1196(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1195, v ds
+# define BFI_FLINEARC_1196_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1195(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1194, v ds
+# define BFI_FLINEARC_1195_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1194(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1193, v ds
+# define BFI_FLINEARC_1194_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1193(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1192, v ds
+# define BFI_FLINEARC_1193_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1192(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1191, v ds
+# define BFI_FLINEARC_1192_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1191(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1190, v ds
+# define BFI_FLINEARC_1191_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1190(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1189, v ds
+# define BFI_FLINEARC_1190_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1189(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1188, v ds
+# define BFI_FLINEARC_1189_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1188(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1187, v ds
+# define BFI_FLINEARC_1188_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1187(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1186, v ds
+# define BFI_FLINEARC_1187_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1186(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1185, v ds
+# define BFI_FLINEARC_1186_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1185(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1184, v ds
+# define BFI_FLINEARC_1185_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1184(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1183, v ds
+# define BFI_FLINEARC_1184_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1183(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1182, v ds
+# define BFI_FLINEARC_1183_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1182(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1181, v ds
+# define BFI_FLINEARC_1182_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1181(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1180, v ds
+# define BFI_FLINEARC_1181_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1180(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1179, v ds
+# define BFI_FLINEARC_1180_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1179(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1178, v ds
+# define BFI_FLINEARC_1179_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1178(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1177, v ds
+# define BFI_FLINEARC_1178_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1177(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1176, v ds
+# define BFI_FLINEARC_1177_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1176(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1175, v ds
+# define BFI_FLINEARC_1176_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1175(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1174, v ds
+# define BFI_FLINEARC_1175_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1174(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1173, v ds
+# define BFI_FLINEARC_1174_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1173(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1172, v ds
+# define BFI_FLINEARC_1173_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1172(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1171, v ds
+# define BFI_FLINEARC_1172_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1171(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1170, v ds
+# define BFI_FLINEARC_1171_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1170(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1169, v ds
+# define BFI_FLINEARC_1170_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1169(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1168, v ds
+# define BFI_FLINEARC_1169_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1168(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1167, v ds
+# define BFI_FLINEARC_1168_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1167(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1166, v ds
+# define BFI_FLINEARC_1167_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1166(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1165, v ds
+# define BFI_FLINEARC_1166_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1165(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1164, v ds
+# define BFI_FLINEARC_1165_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1164(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1163, v ds
+# define BFI_FLINEARC_1164_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1163(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1162, v ds
+# define BFI_FLINEARC_1163_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1162(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1161, v ds
+# define BFI_FLINEARC_1162_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1161(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1160, v ds
+# define BFI_FLINEARC_1161_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1160(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1159, v ds
+# define BFI_FLINEARC_1160_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1159(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1158, v ds
+# define BFI_FLINEARC_1159_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1158(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1157, v ds
+# define BFI_FLINEARC_1158_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1157(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1156, v ds
+# define BFI_FLINEARC_1157_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1156(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1155, v ds
+# define BFI_FLINEARC_1156_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1155(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1154, v ds
+# define BFI_FLINEARC_1155_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1154(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1153, v ds
+# define BFI_FLINEARC_1154_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1153(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1152, v ds
+# define BFI_FLINEARC_1153_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1152(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1151, v ds
+# define BFI_FLINEARC_1152_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1151(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1150, v ds
+# define BFI_FLINEARC_1151_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1150(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1149, v ds
+# define BFI_FLINEARC_1150_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1149(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1148, v ds
+# define BFI_FLINEARC_1149_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1148(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1147, v ds
+# define BFI_FLINEARC_1148_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1147(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1146, v ds
+# define BFI_FLINEARC_1147_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1146(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1145, v ds
+# define BFI_FLINEARC_1146_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1145(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1144, v ds
+# define BFI_FLINEARC_1145_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1144(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1143, v ds
+# define BFI_FLINEARC_1144_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1143(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1142, v ds
+# define BFI_FLINEARC_1143_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1142(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1141, v ds
+# define BFI_FLINEARC_1142_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1141(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1140, v ds
+# define BFI_FLINEARC_1141_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1140(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1139, v ds
+# define BFI_FLINEARC_1140_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1139(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1138, v ds
+# define BFI_FLINEARC_1139_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1138(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1137, v ds
+# define BFI_FLINEARC_1138_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1137(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1136, v ds
+# define BFI_FLINEARC_1137_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1136(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1135, v ds
+# define BFI_FLINEARC_1136_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1135(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1134, v ds
+# define BFI_FLINEARC_1135_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1134(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1133, v ds
+# define BFI_FLINEARC_1134_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1133(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1132, v ds
+# define BFI_FLINEARC_1133_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1132(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1131, v ds
+# define BFI_FLINEARC_1132_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1131(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1130, v ds
+# define BFI_FLINEARC_1131_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1130(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1129, v ds
+# define BFI_FLINEARC_1130_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1129(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1128, v ds
+# define BFI_FLINEARC_1129_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1128(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1127, v ds
+# define BFI_FLINEARC_1128_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1127(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1126, v ds
+# define BFI_FLINEARC_1127_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1126(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1125, v ds
+# define BFI_FLINEARC_1126_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1125(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1124, v ds
+# define BFI_FLINEARC_1125_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1124(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1123, v ds
+# define BFI_FLINEARC_1124_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1123(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1122, v ds
+# define BFI_FLINEARC_1123_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1122(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1121, v ds
+# define BFI_FLINEARC_1122_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1121(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1120, v ds
+# define BFI_FLINEARC_1121_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1120(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1119, v ds
+# define BFI_FLINEARC_1120_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1119(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1118, v ds
+# define BFI_FLINEARC_1119_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1118(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1117, v ds
+# define BFI_FLINEARC_1118_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1117(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1116, v ds
+# define BFI_FLINEARC_1117_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1116(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1115, v ds
+# define BFI_FLINEARC_1116_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1115(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1114, v ds
+# define BFI_FLINEARC_1115_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1114(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1113, v ds
+# define BFI_FLINEARC_1114_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1113(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1112, v ds
+# define BFI_FLINEARC_1113_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1112(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1111, v ds
+# define BFI_FLINEARC_1112_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1111(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1110, v ds
+# define BFI_FLINEARC_1111_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1110(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1109, v ds
+# define BFI_FLINEARC_1110_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1109(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1108, v ds
+# define BFI_FLINEARC_1109_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1108(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1107, v ds
+# define BFI_FLINEARC_1108_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1107(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1106, v ds
+# define BFI_FLINEARC_1107_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1106(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1105, v ds
+# define BFI_FLINEARC_1106_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1105(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1104, v ds
+# define BFI_FLINEARC_1105_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1104(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1103, v ds
+# define BFI_FLINEARC_1104_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1103(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1102, v ds
+# define BFI_FLINEARC_1103_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1102(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1101, v ds
+# define BFI_FLINEARC_1102_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1101(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1100, v ds
+# define BFI_FLINEARC_1101_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1100(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1099, v ds
+# define BFI_FLINEARC_1100_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1099(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1098, v ds
+# define BFI_FLINEARC_1099_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1098(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1097, v ds
+# define BFI_FLINEARC_1098_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1097(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1096, v ds
+# define BFI_FLINEARC_1097_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1096(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1095, v ds
+# define BFI_FLINEARC_1096_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1095(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1094, v ds
+# define BFI_FLINEARC_1095_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1094(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1093, v ds
+# define BFI_FLINEARC_1094_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1093(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1092, v ds
+# define BFI_FLINEARC_1093_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1092(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1091, v ds
+# define BFI_FLINEARC_1092_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1091(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1090, v ds
+# define BFI_FLINEARC_1091_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1090(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1089, v ds
+# define BFI_FLINEARC_1090_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1089(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1088, v ds
+# define BFI_FLINEARC_1089_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1088(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1087, v ds
+# define BFI_FLINEARC_1088_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1087(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1086, v ds
+# define BFI_FLINEARC_1087_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1086(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1085, v ds
+# define BFI_FLINEARC_1086_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1085(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1084, v ds
+# define BFI_FLINEARC_1085_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1084(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1083, v ds
+# define BFI_FLINEARC_1084_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1083(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1082, v ds
+# define BFI_FLINEARC_1083_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1082(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1081, v ds
+# define BFI_FLINEARC_1082_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1081(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1080, v ds
+# define BFI_FLINEARC_1081_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1080(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1079, v ds
+# define BFI_FLINEARC_1080_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1079(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1078, v ds
+# define BFI_FLINEARC_1079_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1078(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1077, v ds
+# define BFI_FLINEARC_1078_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1077(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1076, v ds
+# define BFI_FLINEARC_1077_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1076(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1075, v ds
+# define BFI_FLINEARC_1076_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1075(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1074, v ds
+# define BFI_FLINEARC_1075_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1074(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1073, v ds
+# define BFI_FLINEARC_1074_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1073(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1072, v ds
+# define BFI_FLINEARC_1073_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1072(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1071, v ds
+# define BFI_FLINEARC_1072_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1071(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1070, v ds
+# define BFI_FLINEARC_1071_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1070(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1069, v ds
+# define BFI_FLINEARC_1070_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1069(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1068, v ds
+# define BFI_FLINEARC_1069_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1068(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1067, v ds
+# define BFI_FLINEARC_1068_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1067(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1066, v ds
+# define BFI_FLINEARC_1067_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1066(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1065, v ds
+# define BFI_FLINEARC_1066_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1065(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1064, v ds
+# define BFI_FLINEARC_1065_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1064(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1063, v ds
+# define BFI_FLINEARC_1064_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1063(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1062, v ds
+# define BFI_FLINEARC_1063_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1062(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1061, v ds
+# define BFI_FLINEARC_1062_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1061(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1060, v ds
+# define BFI_FLINEARC_1061_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1060(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1059, v ds
+# define BFI_FLINEARC_1060_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1059(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1058, v ds
+# define BFI_FLINEARC_1059_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1058(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1057, v ds
+# define BFI_FLINEARC_1058_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1057(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1056, v ds
+# define BFI_FLINEARC_1057_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1056(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1055, v ds
+# define BFI_FLINEARC_1056_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1055(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1054, v ds
+# define BFI_FLINEARC_1055_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1054(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1053, v ds
+# define BFI_FLINEARC_1054_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1053(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1052, v ds
+# define BFI_FLINEARC_1053_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1052(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1051, v ds
+# define BFI_FLINEARC_1052_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1051(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1050, v ds
+# define BFI_FLINEARC_1051_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1050(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1049, v ds
+# define BFI_FLINEARC_1050_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1049(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1048, v ds
+# define BFI_FLINEARC_1049_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1048(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1047, v ds
+# define BFI_FLINEARC_1048_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1047(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1046, v ds
+# define BFI_FLINEARC_1047_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1046(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1045, v ds
+# define BFI_FLINEARC_1046_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1045(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1044, v ds
+# define BFI_FLINEARC_1045_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1044(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1043, v ds
+# define BFI_FLINEARC_1044_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1043(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1042, v ds
+# define BFI_FLINEARC_1043_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1042(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1041, v ds
+# define BFI_FLINEARC_1042_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1041(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1040, v ds
+# define BFI_FLINEARC_1041_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1040(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1039, v ds
+# define BFI_FLINEARC_1040_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1039(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1038, v ds
+# define BFI_FLINEARC_1039_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1038(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1037, v ds
+# define BFI_FLINEARC_1038_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1037(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1036, v ds
+# define BFI_FLINEARC_1037_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1036(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1035, v ds
+# define BFI_FLINEARC_1036_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1035(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1034, v ds
+# define BFI_FLINEARC_1035_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1034(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1033, v ds
+# define BFI_FLINEARC_1034_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1033(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1032, v ds
+# define BFI_FLINEARC_1033_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1032(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1031, v ds
+# define BFI_FLINEARC_1032_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1031(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1030, v ds
+# define BFI_FLINEARC_1031_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1030(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1029, v ds
+# define BFI_FLINEARC_1030_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1029(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1028, v ds
+# define BFI_FLINEARC_1029_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1028(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1027, v ds
+# define BFI_FLINEARC_1028_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1027(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1026, v ds
+# define BFI_FLINEARC_1027_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1026(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1025, v ds
+# define BFI_FLINEARC_1026_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1025(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1024, v ds
+# define BFI_FLINEARC_1025_TICK(t) (0fast(0i##t))
+
+# endif
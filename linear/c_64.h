@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_C_64_H
+# define BFI_LINEAR_C_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARC_64(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_63, v ds
+# define BFI_FLINEARC_64_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_63(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_62, v ds
+# define BFI_FLINEARC_63_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_62(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_61, v ds
+# define BFI_FLINEARC_62_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_61(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_60, v ds
+# define BFI_FLINEARC_61_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_60(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_59, v ds
+# define BFI_FLINEARC_60_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_59(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_58, v ds
+# define BFI_FLINEARC_59_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_58(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_57, v ds
+# define BFI_FLINEARC_58_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_57(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_56, v ds
+# define BFI_FLINEARC_57_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_56(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_55, v ds
+# define BFI_FLINEARC_56_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_55(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_54, v ds
+# define BFI_FLINEARC_55_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_54(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_53, v ds
+# define BFI_FLINEARC_54_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_53(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_52, v ds
+# define BFI_FLINEARC_53_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_52(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_51, v ds
+# define BFI_FLINEARC_52_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_51(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_50, v ds
+# define BFI_FLINEARC_51_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_50(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_49, v ds
+# define BFI_FLINEARC_50_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_49(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_48, v ds
+# define BFI_FLINEARC_49_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_48(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_47, v ds
+# define BFI_FLINEARC_48_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_47(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_46, v ds
+# define BFI_FLINEARC_47_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_46(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_45, v ds
+# define BFI_FLINEARC_46_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_45(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_44, v ds
+# define BFI_FLINEARC_45_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_44(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_43, v ds
+# define BFI_FLINEARC_44_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_43(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_42, v ds
+# define BFI_FLINEARC_43_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_42(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_41, v ds
+# define BFI_FLINEARC_42_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_41(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_40, v ds
+# define BFI_FLINEARC_41_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_40(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_39, v ds
+# define BFI_FLINEARC_40_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_39(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_38, v ds
+# define BFI_FLINEARC_39_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_38(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_37, v ds
+# define BFI_FLINEARC_38_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_37(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_36, v ds
+# define BFI_FLINEARC_37_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_36(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_35, v ds
+# define BFI_FLINEARC_36_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_35(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_34, v ds
+# define BFI_FLINEARC_35_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_34(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_33, v ds
+# define BFI_FLINEARC_34_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_33(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_32, v ds
+# define BFI_FLINEARC_33_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_32(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_31, v ds
+# define BFI_FLINEARC_32_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_31(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_30, v ds
+# define BFI_FLINEARC_31_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_30(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_29, v ds
+# define BFI_FLINEARC_30_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_29(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_28, v ds
+# define BFI_FLINEARC_29_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_28(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_27, v ds
+# define BFI_FLINEARC_28_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_27(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_26, v ds
+# define BFI_FLINEARC_27_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_26(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_25, v ds
+# define BFI_FLINEARC_26_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_25(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_24, v ds
+# define BFI_FLINEARC_25_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_24(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_23, v ds
+# define BFI_FLINEARC_24_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_23(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_22, v ds
+# define BFI_FLINEARC_23_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_22(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_21, v ds
+# define BFI_FLINEARC_22_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_21(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_20, v ds
+# define BFI_FLINEARC_21_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_20(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_19, v ds
+# define BFI_FLINEARC_20_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_19(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_18, v ds
+# define BFI_FLINEARC_19_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_18(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_17, v ds
+# define BFI_FLINEARC_18_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_17(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_16, v ds
+# define BFI_FLINEARC_17_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_16(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_15, v ds
+# define BFI_FLINEARC_16_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_15(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_14, v ds
+# define BFI_FLINEARC_15_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_14(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_13, v ds
+# define BFI_FLINEARC_14_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_13(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_12, v ds
+# define BFI_FLINEARC_13_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_12(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_11, v ds
+# define BFI_FLINEARC_12_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_11(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_10, v ds
+# define BFI_FLINEARC_11_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_10(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_9, v ds
+# define BFI_FLINEARC_10_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_9(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_8, v ds
+# define BFI_FLINEARC_9_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_8(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_7, v ds
+# define BFI_FLINEARC_8_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_7(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_6, v ds
+# define BFI_FLINEARC_7_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_6(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_5, v ds
+# define BFI_FLINEARC_6_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_5(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_4, v ds
+# define BFI_FLINEARC_5_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_4(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_3, v ds
+# define BFI_FLINEARC_4_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_3(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_2, v ds
+# define BFI_FLINEARC_3_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_2(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_1, v ds
+# define BFI_FLINEARC_2_TICK(t) (0fast(0i##t))
+# define BFI_FLINEARC_1(v, f, ds) (0slow(0i##f))BFI_FINST_##f(BFI_FLINEARC_0, v ds
+# define BFI_FLINEARC_1_TICK(t) (0fast(0i##t))
+
+# endif
@@ -0,0 +1,1543 @@
+# ifndef BFI_LINEAR_S_1024_H
+# define BFI_LINEAR_S_1024_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARS_1024(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1023, v ds
+# define BFI_FLINEARS_1024_TICK(t)
+# define BFI_FLINEARS_1023(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1022, v ds
+# define BFI_FLINEARS_1023_TICK(t)
+# define BFI_FLINEARS_1022(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1021, v ds
+# define BFI_FLINEARS_1022_TICK(t)
+# define BFI_FLINEARS_1021(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1020, v ds
+# define BFI_FLINEARS_1021_TICK(t)
+# define BFI_FLINEARS_1020(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1019, v ds
+# define BFI_FLINEARS_1020_TICK(t)
+# define BFI_FLINEARS_1019(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1018, v ds
+# define BFI_FLINEARS_1019_TICK(t)
+# define BFI_FLINEARS_1018(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1017, v ds
+# define BFI_FLINEARS_1018_TICK(t)
+# define BFI_FLINEARS_1017(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1016, v ds
+# define BFI_FLINEARS_1017_TICK(t)
+# define BFI_FLINEARS_1016(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1015, v ds
+# define BFI_FLINEARS_1016_TICK(t)
+# define BFI_FLINEARS_1015(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1014, v ds
+# define BFI_FLINEARS_1015_TICK(t)
+# define BFI_FLINEARS_1014(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1013, v ds
+# define BFI_FLINEARS_1014_TICK(t)
+# define BFI_FLINEARS_1013(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1012, v ds
+# define BFI_FLINEARS_1013_TICK(t)
+# define BFI_FLINEARS_1012(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1011, v ds
+# define BFI_FLINEARS_1012_TICK(t)
+# define BFI_FLINEARS_1011(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1010, v ds
+# define BFI_FLINEARS_1011_TICK(t)
+# define BFI_FLINEARS_1010(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1009, v ds
+# define BFI_FLINEARS_1010_TICK(t)
+# define BFI_FLINEARS_1009(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1008, v ds
+# define BFI_FLINEARS_1009_TICK(t)
+# define BFI_FLINEARS_1008(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1007, v ds
+# define BFI_FLINEARS_1008_TICK(t)
+# define BFI_FLINEARS_1007(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1006, v ds
+# define BFI_FLINEARS_1007_TICK(t)
+# define BFI_FLINEARS_1006(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1005, v ds
+# define BFI_FLINEARS_1006_TICK(t)
+# define BFI_FLINEARS_1005(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1004, v ds
+# define BFI_FLINEARS_1005_TICK(t)
+# define BFI_FLINEARS_1004(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1003, v ds
+# define BFI_FLINEARS_1004_TICK(t)
+# define BFI_FLINEARS_1003(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1002, v ds
+# define BFI_FLINEARS_1003_TICK(t)
+# define BFI_FLINEARS_1002(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1001, v ds
+# define BFI_FLINEARS_1002_TICK(t)
+# define BFI_FLINEARS_1001(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1000, v ds
+# define BFI_FLINEARS_1001_TICK(t)
+# define BFI_FLINEARS_1000(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_999, v ds
+# define BFI_FLINEARS_1000_TICK(t)
+# define BFI_FLINEARS_999(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_998, v ds
+# define BFI_FLINEARS_999_TICK(t)
+# define BFI_FLINEARS_998(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_997, v ds
+# define BFI_FLINEARS_998_TICK(t)
+# define BFI_FLINEARS_997(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_996, v ds
+# define BFI_FLINEARS_997_TICK(t)
+# define BFI_FLINEARS_996(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_995, v ds
+# define BFI_FLINEARS_996_TICK(t)
+# define BFI_FLINEARS_995(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_994, v ds
+# define BFI_FLINEARS_995_TICK(t)
+# define BFI_FLINEARS_994(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_993, v ds
+# define BFI_FLINEARS_994_TICK(t)
+# define BFI_FLINEARS_993(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_992, v ds
+# define BFI_FLINEARS_993_TICK(t)
+# define BFI_FLINEARS_992(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_991, v ds
+# define BFI_FLINEARS_992_TICK(t)
+# define BFI_FLINEARS_991(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_990, v ds
+# define BFI_FLINEARS_991_TICK(t)
+# define BFI_FLINEARS_990(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_989, v ds
+# define BFI_FLINEARS_990_TICK(t)
+# define BFI_FLINEARS_989(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_988, v ds
+# define BFI_FLINEARS_989_TICK(t)
+# define BFI_FLINEARS_988(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_987, v ds
+# define BFI_FLINEARS_988_TICK(t)
+# define BFI_FLINEARS_987(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_986, v ds
+# define BFI_FLINEARS_987_TICK(t)
+# define BFI_FLINEARS_986(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_985, v ds
+# define BFI_FLINEARS_986_TICK(t)
+# define BFI_FLINEARS_985(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_984, v ds
+# define BFI_FLINEARS_985_TICK(t)
+# define BFI_FLINEARS_984(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_983, v ds
+# define BFI_FLINEARS_984_TICK(t)
+# define BFI_FLINEARS_983(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_982, v ds
+# define BFI_FLINEARS_983_TICK(t)
+# define BFI_FLINEARS_982(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_981, v ds
+# define BFI_FLINEARS_982_TICK(t)
+# define BFI_FLINEARS_981(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_980, v ds
+# define BFI_FLINEARS_981_TICK(t)
+# define BFI_FLINEARS_980(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_979, v ds
+# define BFI_FLINEARS_980_TICK(t)
+# define BFI_FLINEARS_979(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_978, v ds
+# define BFI_FLINEARS_979_TICK(t)
+# define BFI_FLINEARS_978(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_977, v ds
+# define BFI_FLINEARS_978_TICK(t)
+# define BFI_FLINEARS_977(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_976, v ds
+# define BFI_FLINEARS_977_TICK(t)
+# define BFI_FLINEARS_976(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_975, v ds
+# define BFI_FLINEARS_976_TICK(t)
+# define BFI_FLINEARS_975(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_974, v ds
+# define BFI_FLINEARS_975_TICK(t)
+# define BFI_FLINEARS_974(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_973, v ds
+# define BFI_FLINEARS_974_TICK(t)
+# define BFI_FLINEARS_973(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_972, v ds
+# define BFI_FLINEARS_973_TICK(t)
+# define BFI_FLINEARS_972(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_971, v ds
+# define BFI_FLINEARS_972_TICK(t)
+# define BFI_FLINEARS_971(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_970, v ds
+# define BFI_FLINEARS_971_TICK(t)
+# define BFI_FLINEARS_970(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_969, v ds
+# define BFI_FLINEARS_970_TICK(t)
+# define BFI_FLINEARS_969(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_968, v ds
+# define BFI_FLINEARS_969_TICK(t)
+# define BFI_FLINEARS_968(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_967, v ds
+# define BFI_FLINEARS_968_TICK(t)
+# define BFI_FLINEARS_967(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_966, v ds
+# define BFI_FLINEARS_967_TICK(t)
+# define BFI_FLINEARS_966(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_965, v ds
+# define BFI_FLINEARS_966_TICK(t)
+# define BFI_FLINEARS_965(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_964, v ds
+# define BFI_FLINEARS_965_TICK(t)
+# define BFI_FLINEARS_964(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_963, v ds
+# define BFI_FLINEARS_964_TICK(t)
+# define BFI_FLINEARS_963(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_962, v ds
+# define BFI_FLINEARS_963_TICK(t)
+# define BFI_FLINEARS_962(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_961, v ds
+# define BFI_FLINEARS_962_TICK(t)
+# define BFI_FLINEARS_961(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_960, v ds
+# define BFI_FLINEARS_961_TICK(t)
+# define BFI_FLINEARS_960(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_959, v ds
+# define BFI_FLINEARS_960_TICK(t)
+# define BFI_FLINEARS_959(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_958, v ds
+# define BFI_FLINEARS_959_TICK(t)
+# define BFI_FLINEARS_958(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_957, v ds
+# define BFI_FLINEARS_958_TICK(t)
+# define BFI_FLINEARS_957(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_956, v ds
+# define BFI_FLINEARS_957_TICK(t)
+# define BFI_FLINEARS_956(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_955, v ds
+# define BFI_FLINEARS_956_TICK(t)
+# define BFI_FLINEARS_955(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_954, v ds
+# define BFI_FLINEARS_955_TICK(t)
+# define BFI_FLINEARS_954(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_953, v ds
+# define BFI_FLINEARS_954_TICK(t)
+# define BFI_FLINEARS_953(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_952, v ds
+# define BFI_FLINEARS_953_TICK(t)
+# define BFI_FLINEARS_952(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_951, v ds
+# define BFI_FLINEARS_952_TICK(t)
+# define BFI_FLINEARS_951(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_950, v ds
+# define BFI_FLINEARS_951_TICK(t)
+# define BFI_FLINEARS_950(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_949, v ds
+# define BFI_FLINEARS_950_TICK(t)
+# define BFI_FLINEARS_949(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_948, v ds
+# define BFI_FLINEARS_949_TICK(t)
+# define BFI_FLINEARS_948(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_947, v ds
+# define BFI_FLINEARS_948_TICK(t)
+# define BFI_FLINEARS_947(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_946, v ds
+# define BFI_FLINEARS_947_TICK(t)
+# define BFI_FLINEARS_946(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_945, v ds
+# define BFI_FLINEARS_946_TICK(t)
+# define BFI_FLINEARS_945(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_944, v ds
+# define BFI_FLINEARS_945_TICK(t)
+# define BFI_FLINEARS_944(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_943, v ds
+# define BFI_FLINEARS_944_TICK(t)
+# define BFI_FLINEARS_943(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_942, v ds
+# define BFI_FLINEARS_943_TICK(t)
+# define BFI_FLINEARS_942(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_941, v ds
+# define BFI_FLINEARS_942_TICK(t)
+# define BFI_FLINEARS_941(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_940, v ds
+# define BFI_FLINEARS_941_TICK(t)
+# define BFI_FLINEARS_940(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_939, v ds
+# define BFI_FLINEARS_940_TICK(t)
+# define BFI_FLINEARS_939(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_938, v ds
+# define BFI_FLINEARS_939_TICK(t)
+# define BFI_FLINEARS_938(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_937, v ds
+# define BFI_FLINEARS_938_TICK(t)
+# define BFI_FLINEARS_937(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_936, v ds
+# define BFI_FLINEARS_937_TICK(t)
+# define BFI_FLINEARS_936(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_935, v ds
+# define BFI_FLINEARS_936_TICK(t)
+# define BFI_FLINEARS_935(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_934, v ds
+# define BFI_FLINEARS_935_TICK(t)
+# define BFI_FLINEARS_934(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_933, v ds
+# define BFI_FLINEARS_934_TICK(t)
+# define BFI_FLINEARS_933(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_932, v ds
+# define BFI_FLINEARS_933_TICK(t)
+# define BFI_FLINEARS_932(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_931, v ds
+# define BFI_FLINEARS_932_TICK(t)
+# define BFI_FLINEARS_931(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_930, v ds
+# define BFI_FLINEARS_931_TICK(t)
+# define BFI_FLINEARS_930(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_929, v ds
+# define BFI_FLINEARS_930_TICK(t)
+# define BFI_FLINEARS_929(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_928, v ds
+# define BFI_FLINEARS_929_TICK(t)
+# define BFI_FLINEARS_928(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_927, v ds
+# define BFI_FLINEARS_928_TICK(t)
+# define BFI_FLINEARS_927(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_926, v ds
+# define BFI_FLINEARS_927_TICK(t)
+# define BFI_FLINEARS_926(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_925, v ds
+# define BFI_FLINEARS_926_TICK(t)
+# define BFI_FLINEARS_925(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_924, v ds
+# define BFI_FLINEARS_925_TICK(t)
+# define BFI_FLINEARS_924(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_923, v ds
+# define BFI_FLINEARS_924_TICK(t)
+# define BFI_FLINEARS_923(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_922, v ds
+# define BFI_FLINEARS_923_TICK(t)
+# define BFI_FLINEARS_922(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_921, v ds
+# define BFI_FLINEARS_922_TICK(t)
+# define BFI_FLINEARS_921(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_920, v ds
+# define BFI_FLINEARS_921_TICK(t)
+# define BFI_FLINEARS_920(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_919, v ds
+# define BFI_FLINEARS_920_TICK(t)
+# define BFI_FLINEARS_919(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_918, v ds
+# define BFI_FLINEARS_919_TICK(t)
+# define BFI_FLINEARS_918(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_917, v ds
+# define BFI_FLINEARS_918_TICK(t)
+# define BFI_FLINEARS_917(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_916, v ds
+# define BFI_FLINEARS_917_TICK(t)
+# define BFI_FLINEARS_916(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_915, v ds
+# define BFI_FLINEARS_916_TICK(t)
+# define BFI_FLINEARS_915(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_914, v ds
+# define BFI_FLINEARS_915_TICK(t)
+# define BFI_FLINEARS_914(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_913, v ds
+# define BFI_FLINEARS_914_TICK(t)
+# define BFI_FLINEARS_913(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_912, v ds
+# define BFI_FLINEARS_913_TICK(t)
+# define BFI_FLINEARS_912(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_911, v ds
+# define BFI_FLINEARS_912_TICK(t)
+# define BFI_FLINEARS_911(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_910, v ds
+# define BFI_FLINEARS_911_TICK(t)
+# define BFI_FLINEARS_910(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_909, v ds
+# define BFI_FLINEARS_910_TICK(t)
+# define BFI_FLINEARS_909(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_908, v ds
+# define BFI_FLINEARS_909_TICK(t)
+# define BFI_FLINEARS_908(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_907, v ds
+# define BFI_FLINEARS_908_TICK(t)
+# define BFI_FLINEARS_907(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_906, v ds
+# define BFI_FLINEARS_907_TICK(t)
+# define BFI_FLINEARS_906(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_905, v ds
+# define BFI_FLINEARS_906_TICK(t)
+# define BFI_FLINEARS_905(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_904, v ds
+# define BFI_FLINEARS_905_TICK(t)
+# define BFI_FLINEARS_904(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_903, v ds
+# define BFI_FLINEARS_904_TICK(t)
+# define BFI_FLINEARS_903(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_902, v ds
+# define BFI_FLINEARS_903_TICK(t)
+# define BFI_FLINEARS_902(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_901, v ds
+# define BFI_FLINEARS_902_TICK(t)
+# define BFI_FLINEARS_901(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_900, v ds
+# define BFI_FLINEARS_901_TICK(t)
+# define BFI_FLINEARS_900(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_899, v ds
+# define BFI_FLINEARS_900_TICK(t)
+# define BFI_FLINEARS_899(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_898, v ds
+# define BFI_FLINEARS_899_TICK(t)
+# define BFI_FLINEARS_898(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_897, v ds
+# define BFI_FLINEARS_898_TICK(t)
+# define BFI_FLINEARS_897(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_896, v ds
+# define BFI_FLINEARS_897_TICK(t)
+# define BFI_FLINEARS_896(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_895, v ds
+# define BFI_FLINEARS_896_TICK(t)
+# define BFI_FLINEARS_895(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_894, v ds
+# define BFI_FLINEARS_895_TICK(t)
+# define BFI_FLINEARS_894(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_893, v ds
+# define BFI_FLINEARS_894_TICK(t)
+# define BFI_FLINEARS_893(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_892, v ds
+# define BFI_FLINEARS_893_TICK(t)
+# define BFI_FLINEARS_892(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_891, v ds
+# define BFI_FLINEARS_892_TICK(t)
+# define BFI_FLINEARS_891(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_890, v ds
+# define BFI_FLINEARS_891_TICK(t)
+# define BFI_FLINEARS_890(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_889, v ds
+# define BFI_FLINEARS_890_TICK(t)
+# define BFI_FLINEARS_889(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_888, v ds
+# define BFI_FLINEARS_889_TICK(t)
+# define BFI_FLINEARS_888(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_887, v ds
+# define BFI_FLINEARS_888_TICK(t)
+# define BFI_FLINEARS_887(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_886, v ds
+# define BFI_FLINEARS_887_TICK(t)
+# define BFI_FLINEARS_886(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_885, v ds
+# define BFI_FLINEARS_886_TICK(t)
+# define BFI_FLINEARS_885(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_884, v ds
+# define BFI_FLINEARS_885_TICK(t)
+# define BFI_FLINEARS_884(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_883, v ds
+# define BFI_FLINEARS_884_TICK(t)
+# define BFI_FLINEARS_883(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_882, v ds
+# define BFI_FLINEARS_883_TICK(t)
+# define BFI_FLINEARS_882(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_881, v ds
+# define BFI_FLINEARS_882_TICK(t)
+# define BFI_FLINEARS_881(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_880, v ds
+# define BFI_FLINEARS_881_TICK(t)
+# define BFI_FLINEARS_880(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_879, v ds
+# define BFI_FLINEARS_880_TICK(t)
+# define BFI_FLINEARS_879(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_878, v ds
+# define BFI_FLINEARS_879_TICK(t)
+# define BFI_FLINEARS_878(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_877, v ds
+# define BFI_FLINEARS_878_TICK(t)
+# define BFI_FLINEARS_877(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_876, v ds
+# define BFI_FLINEARS_877_TICK(t)
+# define BFI_FLINEARS_876(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_875, v ds
+# define BFI_FLINEARS_876_TICK(t)
+# define BFI_FLINEARS_875(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_874, v ds
+# define BFI_FLINEARS_875_TICK(t)
+# define BFI_FLINEARS_874(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_873, v ds
+# define BFI_FLINEARS_874_TICK(t)
+# define BFI_FLINEARS_873(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_872, v ds
+# define BFI_FLINEARS_873_TICK(t)
+# define BFI_FLINEARS_872(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_871, v ds
+# define BFI_FLINEARS_872_TICK(t)
+# define BFI_FLINEARS_871(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_870, v ds
+# define BFI_FLINEARS_871_TICK(t)
+# define BFI_FLINEARS_870(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_869, v ds
+# define BFI_FLINEARS_870_TICK(t)
+# define BFI_FLINEARS_869(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_868, v ds
+# define BFI_FLINEARS_869_TICK(t)
+# define BFI_FLINEARS_868(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_867, v ds
+# define BFI_FLINEARS_868_TICK(t)
+# define BFI_FLINEARS_867(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_866, v ds
+# define BFI_FLINEARS_867_TICK(t)
+# define BFI_FLINEARS_866(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_865, v ds
+# define BFI_FLINEARS_866_TICK(t)
+# define BFI_FLINEARS_865(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_864, v ds
+# define BFI_FLINEARS_865_TICK(t)
+# define BFI_FLINEARS_864(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_863, v ds
+# define BFI_FLINEARS_864_TICK(t)
+# define BFI_FLINEARS_863(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_862, v ds
+# define BFI_FLINEARS_863_TICK(t)
+# define BFI_FLINEARS_862(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_861, v ds
+# define BFI_FLINEARS_862_TICK(t)
+# define BFI_FLINEARS_861(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_860, v ds
+# define BFI_FLINEARS_861_TICK(t)
+# define BFI_FLINEARS_860(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_859, v ds
+# define BFI_FLINEARS_860_TICK(t)
+# define BFI_FLINEARS_859(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_858, v ds
+# define BFI_FLINEARS_859_TICK(t)
+# define BFI_FLINEARS_858(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_857, v ds
+# define BFI_FLINEARS_858_TICK(t)
+# define BFI_FLINEARS_857(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_856, v ds
+# define BFI_FLINEARS_857_TICK(t)
+# define BFI_FLINEARS_856(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_855, v ds
+# define BFI_FLINEARS_856_TICK(t)
+# define BFI_FLINEARS_855(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_854, v ds
+# define BFI_FLINEARS_855_TICK(t)
+# define BFI_FLINEARS_854(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_853, v ds
+# define BFI_FLINEARS_854_TICK(t)
+# define BFI_FLINEARS_853(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_852, v ds
+# define BFI_FLINEARS_853_TICK(t)
+# define BFI_FLINEARS_852(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_851, v ds
+# define BFI_FLINEARS_852_TICK(t)
+# define BFI_FLINEARS_851(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_850, v ds
+# define BFI_FLINEARS_851_TICK(t)
+# define BFI_FLINEARS_850(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_849, v ds
+# define BFI_FLINEARS_850_TICK(t)
+# define BFI_FLINEARS_849(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_848, v ds
+# define BFI_FLINEARS_849_TICK(t)
+# define BFI_FLINEARS_848(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_847, v ds
+# define BFI_FLINEARS_848_TICK(t)
+# define BFI_FLINEARS_847(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_846, v ds
+# define BFI_FLINEARS_847_TICK(t)
+# define BFI_FLINEARS_846(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_845, v ds
+# define BFI_FLINEARS_846_TICK(t)
+# define BFI_FLINEARS_845(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_844, v ds
+# define BFI_FLINEARS_845_TICK(t)
+# define BFI_FLINEARS_844(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_843, v ds
+# define BFI_FLINEARS_844_TICK(t)
+# define BFI_FLINEARS_843(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_842, v ds
+# define BFI_FLINEARS_843_TICK(t)
+# define BFI_FLINEARS_842(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_841, v ds
+# define BFI_FLINEARS_842_TICK(t)
+# define BFI_FLINEARS_841(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_840, v ds
+# define BFI_FLINEARS_841_TICK(t)
+# define BFI_FLINEARS_840(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_839, v ds
+# define BFI_FLINEARS_840_TICK(t)
+# define BFI_FLINEARS_839(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_838, v ds
+# define BFI_FLINEARS_839_TICK(t)
+# define BFI_FLINEARS_838(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_837, v ds
+# define BFI_FLINEARS_838_TICK(t)
+# define BFI_FLINEARS_837(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_836, v ds
+# define BFI_FLINEARS_837_TICK(t)
+# define BFI_FLINEARS_836(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_835, v ds
+# define BFI_FLINEARS_836_TICK(t)
+# define BFI_FLINEARS_835(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_834, v ds
+# define BFI_FLINEARS_835_TICK(t)
+# define BFI_FLINEARS_834(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_833, v ds
+# define BFI_FLINEARS_834_TICK(t)
+# define BFI_FLINEARS_833(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_832, v ds
+# define BFI_FLINEARS_833_TICK(t)
+# define BFI_FLINEARS_832(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_831, v ds
+# define BFI_FLINEARS_832_TICK(t)
+# define BFI_FLINEARS_831(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_830, v ds
+# define BFI_FLINEARS_831_TICK(t)
+# define BFI_FLINEARS_830(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_829, v ds
+# define BFI_FLINEARS_830_TICK(t)
+# define BFI_FLINEARS_829(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_828, v ds
+# define BFI_FLINEARS_829_TICK(t)
+# define BFI_FLINEARS_828(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_827, v ds
+# define BFI_FLINEARS_828_TICK(t)
+# define BFI_FLINEARS_827(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_826, v ds
+# define BFI_FLINEARS_827_TICK(t)
+# define BFI_FLINEARS_826(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_825, v ds
+# define BFI_FLINEARS_826_TICK(t)
+# define BFI_FLINEARS_825(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_824, v ds
+# define BFI_FLINEARS_825_TICK(t)
+# define BFI_FLINEARS_824(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_823, v ds
+# define BFI_FLINEARS_824_TICK(t)
+# define BFI_FLINEARS_823(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_822, v ds
+# define BFI_FLINEARS_823_TICK(t)
+# define BFI_FLINEARS_822(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_821, v ds
+# define BFI_FLINEARS_822_TICK(t)
+# define BFI_FLINEARS_821(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_820, v ds
+# define BFI_FLINEARS_821_TICK(t)
+# define BFI_FLINEARS_820(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_819, v ds
+# define BFI_FLINEARS_820_TICK(t)
+# define BFI_FLINEARS_819(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_818, v ds
+# define BFI_FLINEARS_819_TICK(t)
+# define BFI_FLINEARS_818(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_817, v ds
+# define BFI_FLINEARS_818_TICK(t)
+# define BFI_FLINEARS_817(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_816, v ds
+# define BFI_FLINEARS_817_TICK(t)
+# define BFI_FLINEARS_816(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_815, v ds
+# define BFI_FLINEARS_816_TICK(t)
+# define BFI_FLINEARS_815(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_814, v ds
+# define BFI_FLINEARS_815_TICK(t)
+# define BFI_FLINEARS_814(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_813, v ds
+# define BFI_FLINEARS_814_TICK(t)
+# define BFI_FLINEARS_813(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_812, v ds
+# define BFI_FLINEARS_813_TICK(t)
+# define BFI_FLINEARS_812(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_811, v ds
+# define BFI_FLINEARS_812_TICK(t)
+# define BFI_FLINEARS_811(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_810, v ds
+# define BFI_FLINEARS_811_TICK(t)
+# define BFI_FLINEARS_810(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_809, v ds
+# define BFI_FLINEARS_810_TICK(t)
+# define BFI_FLINEARS_809(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_808, v ds
+# define BFI_FLINEARS_809_TICK(t)
+# define BFI_FLINEARS_808(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_807, v ds
+# define BFI_FLINEARS_808_TICK(t)
+# define BFI_FLINEARS_807(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_806, v ds
+# define BFI_FLINEARS_807_TICK(t)
+# define BFI_FLINEARS_806(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_805, v ds
+# define BFI_FLINEARS_806_TICK(t)
+# define BFI_FLINEARS_805(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_804, v ds
+# define BFI_FLINEARS_805_TICK(t)
+# define BFI_FLINEARS_804(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_803, v ds
+# define BFI_FLINEARS_804_TICK(t)
+# define BFI_FLINEARS_803(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_802, v ds
+# define BFI_FLINEARS_803_TICK(t)
+# define BFI_FLINEARS_802(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_801, v ds
+# define BFI_FLINEARS_802_TICK(t)
+# define BFI_FLINEARS_801(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_800, v ds
+# define BFI_FLINEARS_801_TICK(t)
+# define BFI_FLINEARS_800(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_799, v ds
+# define BFI_FLINEARS_800_TICK(t)
+# define BFI_FLINEARS_799(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_798, v ds
+# define BFI_FLINEARS_799_TICK(t)
+# define BFI_FLINEARS_798(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_797, v ds
+# define BFI_FLINEARS_798_TICK(t)
+# define BFI_FLINEARS_797(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_796, v ds
+# define BFI_FLINEARS_797_TICK(t)
+# define BFI_FLINEARS_796(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_795, v ds
+# define BFI_FLINEARS_796_TICK(t)
+# define BFI_FLINEARS_795(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_794, v ds
+# define BFI_FLINEARS_795_TICK(t)
+# define BFI_FLINEARS_794(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_793, v ds
+# define BFI_FLINEARS_794_TICK(t)
+# define BFI_FLINEARS_793(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_792, v ds
+# define BFI_FLINEARS_793_TICK(t)
+# define BFI_FLINEARS_792(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_791, v ds
+# define BFI_FLINEARS_792_TICK(t)
+# define BFI_FLINEARS_791(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_790, v ds
+# define BFI_FLINEARS_791_TICK(t)
+# define BFI_FLINEARS_790(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_789, v ds
+# define BFI_FLINEARS_790_TICK(t)
+# define BFI_FLINEARS_789(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_788, v ds
+# define BFI_FLINEARS_789_TICK(t)
+# define BFI_FLINEARS_788(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_787, v ds
+# define BFI_FLINEARS_788_TICK(t)
+# define BFI_FLINEARS_787(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_786, v ds
+# define BFI_FLINEARS_787_TICK(t)
+# define BFI_FLINEARS_786(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_785, v ds
+# define BFI_FLINEARS_786_TICK(t)
+# define BFI_FLINEARS_785(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_784, v ds
+# define BFI_FLINEARS_785_TICK(t)
+# define BFI_FLINEARS_784(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_783, v ds
+# define BFI_FLINEARS_784_TICK(t)
+# define BFI_FLINEARS_783(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_782, v ds
+# define BFI_FLINEARS_783_TICK(t)
+# define BFI_FLINEARS_782(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_781, v ds
+# define BFI_FLINEARS_782_TICK(t)
+# define BFI_FLINEARS_781(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_780, v ds
+# define BFI_FLINEARS_781_TICK(t)
+# define BFI_FLINEARS_780(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_779, v ds
+# define BFI_FLINEARS_780_TICK(t)
+# define BFI_FLINEARS_779(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_778, v ds
+# define BFI_FLINEARS_779_TICK(t)
+# define BFI_FLINEARS_778(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_777, v ds
+# define BFI_FLINEARS_778_TICK(t)
+# define BFI_FLINEARS_777(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_776, v ds
+# define BFI_FLINEARS_777_TICK(t)
+# define BFI_FLINEARS_776(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_775, v ds
+# define BFI_FLINEARS_776_TICK(t)
+# define BFI_FLINEARS_775(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_774, v ds
+# define BFI_FLINEARS_775_TICK(t)
+# define BFI_FLINEARS_774(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_773, v ds
+# define BFI_FLINEARS_774_TICK(t)
+# define BFI_FLINEARS_773(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_772, v ds
+# define BFI_FLINEARS_773_TICK(t)
+# define BFI_FLINEARS_772(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_771, v ds
+# define BFI_FLINEARS_772_TICK(t)
+# define BFI_FLINEARS_771(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_770, v ds
+# define BFI_FLINEARS_771_TICK(t)
+# define BFI_FLINEARS_770(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_769, v ds
+# define BFI_FLINEARS_770_TICK(t)
+# define BFI_FLINEARS_769(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_768, v ds
+# define BFI_FLINEARS_769_TICK(t)
+# define BFI_FLINEARS_768(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_767, v ds
+# define BFI_FLINEARS_768_TICK(t)
+# define BFI_FLINEARS_767(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_766, v ds
+# define BFI_FLINEARS_767_TICK(t)
+# define BFI_FLINEARS_766(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_765, v ds
+# define BFI_FLINEARS_766_TICK(t)
+# define BFI_FLINEARS_765(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_764, v ds
+# define BFI_FLINEARS_765_TICK(t)
+# define BFI_FLINEARS_764(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_763, v ds
+# define BFI_FLINEARS_764_TICK(t)
+# define BFI_FLINEARS_763(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_762, v ds
+# define BFI_FLINEARS_763_TICK(t)
+# define BFI_FLINEARS_762(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_761, v ds
+# define BFI_FLINEARS_762_TICK(t)
+# define BFI_FLINEARS_761(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_760, v ds
+# define BFI_FLINEARS_761_TICK(t)
+# define BFI_FLINEARS_760(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_759, v ds
+# define BFI_FLINEARS_760_TICK(t)
+# define BFI_FLINEARS_759(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_758, v ds
+# define BFI_FLINEARS_759_TICK(t)
+# define BFI_FLINEARS_758(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_757, v ds
+# define BFI_FLINEARS_758_TICK(t)
+# define BFI_FLINEARS_757(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_756, v ds
+# define BFI_FLINEARS_757_TICK(t)
+# define BFI_FLINEARS_756(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_755, v ds
+# define BFI_FLINEARS_756_TICK(t)
+# define BFI_FLINEARS_755(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_754, v ds
+# define BFI_FLINEARS_755_TICK(t)
+# define BFI_FLINEARS_754(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_753, v ds
+# define BFI_FLINEARS_754_TICK(t)
+# define BFI_FLINEARS_753(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_752, v ds
+# define BFI_FLINEARS_753_TICK(t)
+# define BFI_FLINEARS_752(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_751, v ds
+# define BFI_FLINEARS_752_TICK(t)
+# define BFI_FLINEARS_751(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_750, v ds
+# define BFI_FLINEARS_751_TICK(t)
+# define BFI_FLINEARS_750(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_749, v ds
+# define BFI_FLINEARS_750_TICK(t)
+# define BFI_FLINEARS_749(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_748, v ds
+# define BFI_FLINEARS_749_TICK(t)
+# define BFI_FLINEARS_748(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_747, v ds
+# define BFI_FLINEARS_748_TICK(t)
+# define BFI_FLINEARS_747(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_746, v ds
+# define BFI_FLINEARS_747_TICK(t)
+# define BFI_FLINEARS_746(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_745, v ds
+# define BFI_FLINEARS_746_TICK(t)
+# define BFI_FLINEARS_745(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_744, v ds
+# define BFI_FLINEARS_745_TICK(t)
+# define BFI_FLINEARS_744(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_743, v ds
+# define BFI_FLINEARS_744_TICK(t)
+# define BFI_FLINEARS_743(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_742, v ds
+# define BFI_FLINEARS_743_TICK(t)
+# define BFI_FLINEARS_742(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_741, v ds
+# define BFI_FLINEARS_742_TICK(t)
+# define BFI_FLINEARS_741(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_740, v ds
+# define BFI_FLINEARS_741_TICK(t)
+# define BFI_FLINEARS_740(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_739, v ds
+# define BFI_FLINEARS_740_TICK(t)
+# define BFI_FLINEARS_739(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_738, v ds
+# define BFI_FLINEARS_739_TICK(t)
+# define BFI_FLINEARS_738(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_737, v ds
+# define BFI_FLINEARS_738_TICK(t)
+# define BFI_FLINEARS_737(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_736, v ds
+# define BFI_FLINEARS_737_TICK(t)
+# define BFI_FLINEARS_736(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_735, v ds
+# define BFI_FLINEARS_736_TICK(t)
+# define BFI_FLINEARS_735(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_734, v ds
+# define BFI_FLINEARS_735_TICK(t)
+# define BFI_FLINEARS_734(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_733, v ds
+# define BFI_FLINEARS_734_TICK(t)
+# define BFI_FLINEARS_733(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_732, v ds
+# define BFI_FLINEARS_733_TICK(t)
+# define BFI_FLINEARS_732(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_731, v ds
+# define BFI_FLINEARS_732_TICK(t)
+# define BFI_FLINEARS_731(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_730, v ds
+# define BFI_FLINEARS_731_TICK(t)
+# define BFI_FLINEARS_730(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_729, v ds
+# define BFI_FLINEARS_730_TICK(t)
+# define BFI_FLINEARS_729(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_728, v ds
+# define BFI_FLINEARS_729_TICK(t)
+# define BFI_FLINEARS_728(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_727, v ds
+# define BFI_FLINEARS_728_TICK(t)
+# define BFI_FLINEARS_727(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_726, v ds
+# define BFI_FLINEARS_727_TICK(t)
+# define BFI_FLINEARS_726(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_725, v ds
+# define BFI_FLINEARS_726_TICK(t)
+# define BFI_FLINEARS_725(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_724, v ds
+# define BFI_FLINEARS_725_TICK(t)
+# define BFI_FLINEARS_724(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_723, v ds
+# define BFI_FLINEARS_724_TICK(t)
+# define BFI_FLINEARS_723(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_722, v ds
+# define BFI_FLINEARS_723_TICK(t)
+# define BFI_FLINEARS_722(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_721, v ds
+# define BFI_FLINEARS_722_TICK(t)
+# define BFI_FLINEARS_721(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_720, v ds
+# define BFI_FLINEARS_721_TICK(t)
+# define BFI_FLINEARS_720(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_719, v ds
+# define BFI_FLINEARS_720_TICK(t)
+# define BFI_FLINEARS_719(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_718, v ds
+# define BFI_FLINEARS_719_TICK(t)
+# define BFI_FLINEARS_718(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_717, v ds
+# define BFI_FLINEARS_718_TICK(t)
+# define BFI_FLINEARS_717(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_716, v ds
+# define BFI_FLINEARS_717_TICK(t)
+# define BFI_FLINEARS_716(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_715, v ds
+# define BFI_FLINEARS_716_TICK(t)
+# define BFI_FLINEARS_715(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_714, v ds
+# define BFI_FLINEARS_715_TICK(t)
+# define BFI_FLINEARS_714(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_713, v ds
+# define BFI_FLINEARS_714_TICK(t)
+# define BFI_FLINEARS_713(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_712, v ds
+# define BFI_FLINEARS_713_TICK(t)
+# define BFI_FLINEARS_712(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_711, v ds
+# define BFI_FLINEARS_712_TICK(t)
+# define BFI_FLINEARS_711(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_710, v ds
+# define BFI_FLINEARS_711_TICK(t)
+# define BFI_FLINEARS_710(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_709, v ds
+# define BFI_FLINEARS_710_TICK(t)
+# define BFI_FLINEARS_709(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_708, v ds
+# define BFI_FLINEARS_709_TICK(t)
+# define BFI_FLINEARS_708(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_707, v ds
+# define BFI_FLINEARS_708_TICK(t)
+# define BFI_FLINEARS_707(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_706, v ds
+# define BFI_FLINEARS_707_TICK(t)
+# define BFI_FLINEARS_706(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_705, v ds
+# define BFI_FLINEARS_706_TICK(t)
+# define BFI_FLINEARS_705(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_704, v ds
+# define BFI_FLINEARS_705_TICK(t)
+# define BFI_FLINEARS_704(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_703, v ds
+# define BFI_FLINEARS_704_TICK(t)
+# define BFI_FLINEARS_703(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_702, v ds
+# define BFI_FLINEARS_703_TICK(t)
+# define BFI_FLINEARS_702(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_701, v ds
+# define BFI_FLINEARS_702_TICK(t)
+# define BFI_FLINEARS_701(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_700, v ds
+# define BFI_FLINEARS_701_TICK(t)
+# define BFI_FLINEARS_700(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_699, v ds
+# define BFI_FLINEARS_700_TICK(t)
+# define BFI_FLINEARS_699(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_698, v ds
+# define BFI_FLINEARS_699_TICK(t)
+# define BFI_FLINEARS_698(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_697, v ds
+# define BFI_FLINEARS_698_TICK(t)
+# define BFI_FLINEARS_697(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_696, v ds
+# define BFI_FLINEARS_697_TICK(t)
+# define BFI_FLINEARS_696(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_695, v ds
+# define BFI_FLINEARS_696_TICK(t)
+# define BFI_FLINEARS_695(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_694, v ds
+# define BFI_FLINEARS_695_TICK(t)
+# define BFI_FLINEARS_694(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_693, v ds
+# define BFI_FLINEARS_694_TICK(t)
+# define BFI_FLINEARS_693(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_692, v ds
+# define BFI_FLINEARS_693_TICK(t)
+# define BFI_FLINEARS_692(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_691, v ds
+# define BFI_FLINEARS_692_TICK(t)
+# define BFI_FLINEARS_691(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_690, v ds
+# define BFI_FLINEARS_691_TICK(t)
+# define BFI_FLINEARS_690(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_689, v ds
+# define BFI_FLINEARS_690_TICK(t)
+# define BFI_FLINEARS_689(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_688, v ds
+# define BFI_FLINEARS_689_TICK(t)
+# define BFI_FLINEARS_688(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_687, v ds
+# define BFI_FLINEARS_688_TICK(t)
+# define BFI_FLINEARS_687(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_686, v ds
+# define BFI_FLINEARS_687_TICK(t)
+# define BFI_FLINEARS_686(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_685, v ds
+# define BFI_FLINEARS_686_TICK(t)
+# define BFI_FLINEARS_685(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_684, v ds
+# define BFI_FLINEARS_685_TICK(t)
+# define BFI_FLINEARS_684(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_683, v ds
+# define BFI_FLINEARS_684_TICK(t)
+# define BFI_FLINEARS_683(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_682, v ds
+# define BFI_FLINEARS_683_TICK(t)
+# define BFI_FLINEARS_682(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_681, v ds
+# define BFI_FLINEARS_682_TICK(t)
+# define BFI_FLINEARS_681(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_680, v ds
+# define BFI_FLINEARS_681_TICK(t)
+# define BFI_FLINEARS_680(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_679, v ds
+# define BFI_FLINEARS_680_TICK(t)
+# define BFI_FLINEARS_679(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_678, v ds
+# define BFI_FLINEARS_679_TICK(t)
+# define BFI_FLINEARS_678(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_677, v ds
+# define BFI_FLINEARS_678_TICK(t)
+# define BFI_FLINEARS_677(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_676, v ds
+# define BFI_FLINEARS_677_TICK(t)
+# define BFI_FLINEARS_676(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_675, v ds
+# define BFI_FLINEARS_676_TICK(t)
+# define BFI_FLINEARS_675(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_674, v ds
+# define BFI_FLINEARS_675_TICK(t)
+# define BFI_FLINEARS_674(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_673, v ds
+# define BFI_FLINEARS_674_TICK(t)
+# define BFI_FLINEARS_673(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_672, v ds
+# define BFI_FLINEARS_673_TICK(t)
+# define BFI_FLINEARS_672(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_671, v ds
+# define BFI_FLINEARS_672_TICK(t)
+# define BFI_FLINEARS_671(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_670, v ds
+# define BFI_FLINEARS_671_TICK(t)
+# define BFI_FLINEARS_670(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_669, v ds
+# define BFI_FLINEARS_670_TICK(t)
+# define BFI_FLINEARS_669(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_668, v ds
+# define BFI_FLINEARS_669_TICK(t)
+# define BFI_FLINEARS_668(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_667, v ds
+# define BFI_FLINEARS_668_TICK(t)
+# define BFI_FLINEARS_667(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_666, v ds
+# define BFI_FLINEARS_667_TICK(t)
+# define BFI_FLINEARS_666(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_665, v ds
+# define BFI_FLINEARS_666_TICK(t)
+# define BFI_FLINEARS_665(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_664, v ds
+# define BFI_FLINEARS_665_TICK(t)
+# define BFI_FLINEARS_664(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_663, v ds
+# define BFI_FLINEARS_664_TICK(t)
+# define BFI_FLINEARS_663(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_662, v ds
+# define BFI_FLINEARS_663_TICK(t)
+# define BFI_FLINEARS_662(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_661, v ds
+# define BFI_FLINEARS_662_TICK(t)
+# define BFI_FLINEARS_661(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_660, v ds
+# define BFI_FLINEARS_661_TICK(t)
+# define BFI_FLINEARS_660(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_659, v ds
+# define BFI_FLINEARS_660_TICK(t)
+# define BFI_FLINEARS_659(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_658, v ds
+# define BFI_FLINEARS_659_TICK(t)
+# define BFI_FLINEARS_658(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_657, v ds
+# define BFI_FLINEARS_658_TICK(t)
+# define BFI_FLINEARS_657(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_656, v ds
+# define BFI_FLINEARS_657_TICK(t)
+# define BFI_FLINEARS_656(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_655, v ds
+# define BFI_FLINEARS_656_TICK(t)
+# define BFI_FLINEARS_655(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_654, v ds
+# define BFI_FLINEARS_655_TICK(t)
+# define BFI_FLINEARS_654(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_653, v ds
+# define BFI_FLINEARS_654_TICK(t)
+# define BFI_FLINEARS_653(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_652, v ds
+# define BFI_FLINEARS_653_TICK(t)
+# define BFI_FLINEARS_652(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_651, v ds
+# define BFI_FLINEARS_652_TICK(t)
+# define BFI_FLINEARS_651(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_650, v ds
+# define BFI_FLINEARS_651_TICK(t)
+# define BFI_FLINEARS_650(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_649, v ds
+# define BFI_FLINEARS_650_TICK(t)
+# define BFI_FLINEARS_649(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_648, v ds
+# define BFI_FLINEARS_649_TICK(t)
+# define BFI_FLINEARS_648(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_647, v ds
+# define BFI_FLINEARS_648_TICK(t)
+# define BFI_FLINEARS_647(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_646, v ds
+# define BFI_FLINEARS_647_TICK(t)
+# define BFI_FLINEARS_646(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_645, v ds
+# define BFI_FLINEARS_646_TICK(t)
+# define BFI_FLINEARS_645(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_644, v ds
+# define BFI_FLINEARS_645_TICK(t)
+# define BFI_FLINEARS_644(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_643, v ds
+# define BFI_FLINEARS_644_TICK(t)
+# define BFI_FLINEARS_643(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_642, v ds
+# define BFI_FLINEARS_643_TICK(t)
+# define BFI_FLINEARS_642(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_641, v ds
+# define BFI_FLINEARS_642_TICK(t)
+# define BFI_FLINEARS_641(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_640, v ds
+# define BFI_FLINEARS_641_TICK(t)
+# define BFI_FLINEARS_640(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_639, v ds
+# define BFI_FLINEARS_640_TICK(t)
+# define BFI_FLINEARS_639(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_638, v ds
+# define BFI_FLINEARS_639_TICK(t)
+# define BFI_FLINEARS_638(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_637, v ds
+# define BFI_FLINEARS_638_TICK(t)
+# define BFI_FLINEARS_637(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_636, v ds
+# define BFI_FLINEARS_637_TICK(t)
+# define BFI_FLINEARS_636(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_635, v ds
+# define BFI_FLINEARS_636_TICK(t)
+# define BFI_FLINEARS_635(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_634, v ds
+# define BFI_FLINEARS_635_TICK(t)
+# define BFI_FLINEARS_634(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_633, v ds
+# define BFI_FLINEARS_634_TICK(t)
+# define BFI_FLINEARS_633(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_632, v ds
+# define BFI_FLINEARS_633_TICK(t)
+# define BFI_FLINEARS_632(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_631, v ds
+# define BFI_FLINEARS_632_TICK(t)
+# define BFI_FLINEARS_631(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_630, v ds
+# define BFI_FLINEARS_631_TICK(t)
+# define BFI_FLINEARS_630(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_629, v ds
+# define BFI_FLINEARS_630_TICK(t)
+# define BFI_FLINEARS_629(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_628, v ds
+# define BFI_FLINEARS_629_TICK(t)
+# define BFI_FLINEARS_628(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_627, v ds
+# define BFI_FLINEARS_628_TICK(t)
+# define BFI_FLINEARS_627(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_626, v ds
+# define BFI_FLINEARS_627_TICK(t)
+# define BFI_FLINEARS_626(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_625, v ds
+# define BFI_FLINEARS_626_TICK(t)
+# define BFI_FLINEARS_625(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_624, v ds
+# define BFI_FLINEARS_625_TICK(t)
+# define BFI_FLINEARS_624(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_623, v ds
+# define BFI_FLINEARS_624_TICK(t)
+# define BFI_FLINEARS_623(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_622, v ds
+# define BFI_FLINEARS_623_TICK(t)
+# define BFI_FLINEARS_622(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_621, v ds
+# define BFI_FLINEARS_622_TICK(t)
+# define BFI_FLINEARS_621(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_620, v ds
+# define BFI_FLINEARS_621_TICK(t)
+# define BFI_FLINEARS_620(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_619, v ds
+# define BFI_FLINEARS_620_TICK(t)
+# define BFI_FLINEARS_619(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_618, v ds
+# define BFI_FLINEARS_619_TICK(t)
+# define BFI_FLINEARS_618(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_617, v ds
+# define BFI_FLINEARS_618_TICK(t)
+# define BFI_FLINEARS_617(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_616, v ds
+# define BFI_FLINEARS_617_TICK(t)
+# define BFI_FLINEARS_616(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_615, v ds
+# define BFI_FLINEARS_616_TICK(t)
+# define BFI_FLINEARS_615(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_614, v ds
+# define BFI_FLINEARS_615_TICK(t)
+# define BFI_FLINEARS_614(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_613, v ds
+# define BFI_FLINEARS_614_TICK(t)
+# define BFI_FLINEARS_613(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_612, v ds
+# define BFI_FLINEARS_613_TICK(t)
+# define BFI_FLINEARS_612(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_611, v ds
+# define BFI_FLINEARS_612_TICK(t)
+# define BFI_FLINEARS_611(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_610, v ds
+# define BFI_FLINEARS_611_TICK(t)
+# define BFI_FLINEARS_610(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_609, v ds
+# define BFI_FLINEARS_610_TICK(t)
+# define BFI_FLINEARS_609(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_608, v ds
+# define BFI_FLINEARS_609_TICK(t)
+# define BFI_FLINEARS_608(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_607, v ds
+# define BFI_FLINEARS_608_TICK(t)
+# define BFI_FLINEARS_607(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_606, v ds
+# define BFI_FLINEARS_607_TICK(t)
+# define BFI_FLINEARS_606(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_605, v ds
+# define BFI_FLINEARS_606_TICK(t)
+# define BFI_FLINEARS_605(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_604, v ds
+# define BFI_FLINEARS_605_TICK(t)
+# define BFI_FLINEARS_604(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_603, v ds
+# define BFI_FLINEARS_604_TICK(t)
+# define BFI_FLINEARS_603(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_602, v ds
+# define BFI_FLINEARS_603_TICK(t)
+# define BFI_FLINEARS_602(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_601, v ds
+# define BFI_FLINEARS_602_TICK(t)
+# define BFI_FLINEARS_601(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_600, v ds
+# define BFI_FLINEARS_601_TICK(t)
+# define BFI_FLINEARS_600(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_599, v ds
+# define BFI_FLINEARS_600_TICK(t)
+# define BFI_FLINEARS_599(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_598, v ds
+# define BFI_FLINEARS_599_TICK(t)
+# define BFI_FLINEARS_598(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_597, v ds
+# define BFI_FLINEARS_598_TICK(t)
+# define BFI_FLINEARS_597(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_596, v ds
+# define BFI_FLINEARS_597_TICK(t)
+# define BFI_FLINEARS_596(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_595, v ds
+# define BFI_FLINEARS_596_TICK(t)
+# define BFI_FLINEARS_595(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_594, v ds
+# define BFI_FLINEARS_595_TICK(t)
+# define BFI_FLINEARS_594(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_593, v ds
+# define BFI_FLINEARS_594_TICK(t)
+# define BFI_FLINEARS_593(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_592, v ds
+# define BFI_FLINEARS_593_TICK(t)
+# define BFI_FLINEARS_592(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_591, v ds
+# define BFI_FLINEARS_592_TICK(t)
+# define BFI_FLINEARS_591(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_590, v ds
+# define BFI_FLINEARS_591_TICK(t)
+# define BFI_FLINEARS_590(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_589, v ds
+# define BFI_FLINEARS_590_TICK(t)
+# define BFI_FLINEARS_589(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_588, v ds
+# define BFI_FLINEARS_589_TICK(t)
+# define BFI_FLINEARS_588(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_587, v ds
+# define BFI_FLINEARS_588_TICK(t)
+# define BFI_FLINEARS_587(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_586, v ds
+# define BFI_FLINEARS_587_TICK(t)
+# define BFI_FLINEARS_586(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_585, v ds
+# define BFI_FLINEARS_586_TICK(t)
+# define BFI_FLINEARS_585(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_584, v ds
+# define BFI_FLINEARS_585_TICK(t)
+# define BFI_FLINEARS_584(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_583, v ds
+# define BFI_FLINEARS_584_TICK(t)
+# define BFI_FLINEARS_583(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_582, v ds
+# define BFI_FLINEARS_583_TICK(t)
+# define BFI_FLINEARS_582(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_581, v ds
+# define BFI_FLINEARS_582_TICK(t)
+# define BFI_FLINEARS_581(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_580, v ds
+# define BFI_FLINEARS_581_TICK(t)
+# define BFI_FLINEARS_580(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_579, v ds
+# define BFI_FLINEARS_580_TICK(t)
+# define BFI_FLINEARS_579(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_578, v ds
+# define BFI_FLINEARS_579_TICK(t)
+# define BFI_FLINEARS_578(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_577, v ds
+# define BFI_FLINEARS_578_TICK(t)
+# define BFI_FLINEARS_577(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_576, v ds
+# define BFI_FLINEARS_577_TICK(t)
+# define BFI_FLINEARS_576(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_575, v ds
+# define BFI_FLINEARS_576_TICK(t)
+# define BFI_FLINEARS_575(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_574, v ds
+# define BFI_FLINEARS_575_TICK(t)
+# define BFI_FLINEARS_574(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_573, v ds
+# define BFI_FLINEARS_574_TICK(t)
+# define BFI_FLINEARS_573(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_572, v ds
+# define BFI_FLINEARS_573_TICK(t)
+# define BFI_FLINEARS_572(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_571, v ds
+# define BFI_FLINEARS_572_TICK(t)
+# define BFI_FLINEARS_571(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_570, v ds
+# define BFI_FLINEARS_571_TICK(t)
+# define BFI_FLINEARS_570(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_569, v ds
+# define BFI_FLINEARS_570_TICK(t)
+# define BFI_FLINEARS_569(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_568, v ds
+# define BFI_FLINEARS_569_TICK(t)
+# define BFI_FLINEARS_568(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_567, v ds
+# define BFI_FLINEARS_568_TICK(t)
+# define BFI_FLINEARS_567(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_566, v ds
+# define BFI_FLINEARS_567_TICK(t)
+# define BFI_FLINEARS_566(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_565, v ds
+# define BFI_FLINEARS_566_TICK(t)
+# define BFI_FLINEARS_565(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_564, v ds
+# define BFI_FLINEARS_565_TICK(t)
+# define BFI_FLINEARS_564(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_563, v ds
+# define BFI_FLINEARS_564_TICK(t)
+# define BFI_FLINEARS_563(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_562, v ds
+# define BFI_FLINEARS_563_TICK(t)
+# define BFI_FLINEARS_562(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_561, v ds
+# define BFI_FLINEARS_562_TICK(t)
+# define BFI_FLINEARS_561(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_560, v ds
+# define BFI_FLINEARS_561_TICK(t)
+# define BFI_FLINEARS_560(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_559, v ds
+# define BFI_FLINEARS_560_TICK(t)
+# define BFI_FLINEARS_559(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_558, v ds
+# define BFI_FLINEARS_559_TICK(t)
+# define BFI_FLINEARS_558(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_557, v ds
+# define BFI_FLINEARS_558_TICK(t)
+# define BFI_FLINEARS_557(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_556, v ds
+# define BFI_FLINEARS_557_TICK(t)
+# define BFI_FLINEARS_556(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_555, v ds
+# define BFI_FLINEARS_556_TICK(t)
+# define BFI_FLINEARS_555(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_554, v ds
+# define BFI_FLINEARS_555_TICK(t)
+# define BFI_FLINEARS_554(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_553, v ds
+# define BFI_FLINEARS_554_TICK(t)
+# define BFI_FLINEARS_553(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_552, v ds
+# define BFI_FLINEARS_553_TICK(t)
+# define BFI_FLINEARS_552(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_551, v ds
+# define BFI_FLINEARS_552_TICK(t)
+# define BFI_FLINEARS_551(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_550, v ds
+# define BFI_FLINEARS_551_TICK(t)
+# define BFI_FLINEARS_550(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_549, v ds
+# define BFI_FLINEARS_550_TICK(t)
+# define BFI_FLINEARS_549(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_548, v ds
+# define BFI_FLINEARS_549_TICK(t)
+# define BFI_FLINEARS_548(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_547, v ds
+# define BFI_FLINEARS_548_TICK(t)
+# define BFI_FLINEARS_547(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_546, v ds
+# define BFI_FLINEARS_547_TICK(t)
+# define BFI_FLINEARS_546(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_545, v ds
+# define BFI_FLINEARS_546_TICK(t)
+# define BFI_FLINEARS_545(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_544, v ds
+# define BFI_FLINEARS_545_TICK(t)
+# define BFI_FLINEARS_544(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_543, v ds
+# define BFI_FLINEARS_544_TICK(t)
+# define BFI_FLINEARS_543(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_542, v ds
+# define BFI_FLINEARS_543_TICK(t)
+# define BFI_FLINEARS_542(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_541, v ds
+# define BFI_FLINEARS_542_TICK(t)
+# define BFI_FLINEARS_541(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_540, v ds
+# define BFI_FLINEARS_541_TICK(t)
+# define BFI_FLINEARS_540(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_539, v ds
+# define BFI_FLINEARS_540_TICK(t)
+# define BFI_FLINEARS_539(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_538, v ds
+# define BFI_FLINEARS_539_TICK(t)
+# define BFI_FLINEARS_538(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_537, v ds
+# define BFI_FLINEARS_538_TICK(t)
+# define BFI_FLINEARS_537(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_536, v ds
+# define BFI_FLINEARS_537_TICK(t)
+# define BFI_FLINEARS_536(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_535, v ds
+# define BFI_FLINEARS_536_TICK(t)
+# define BFI_FLINEARS_535(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_534, v ds
+# define BFI_FLINEARS_535_TICK(t)
+# define BFI_FLINEARS_534(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_533, v ds
+# define BFI_FLINEARS_534_TICK(t)
+# define BFI_FLINEARS_533(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_532, v ds
+# define BFI_FLINEARS_533_TICK(t)
+# define BFI_FLINEARS_532(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_531, v ds
+# define BFI_FLINEARS_532_TICK(t)
+# define BFI_FLINEARS_531(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_530, v ds
+# define BFI_FLINEARS_531_TICK(t)
+# define BFI_FLINEARS_530(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_529, v ds
+# define BFI_FLINEARS_530_TICK(t)
+# define BFI_FLINEARS_529(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_528, v ds
+# define BFI_FLINEARS_529_TICK(t)
+# define BFI_FLINEARS_528(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_527, v ds
+# define BFI_FLINEARS_528_TICK(t)
+# define BFI_FLINEARS_527(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_526, v ds
+# define BFI_FLINEARS_527_TICK(t)
+# define BFI_FLINEARS_526(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_525, v ds
+# define BFI_FLINEARS_526_TICK(t)
+# define BFI_FLINEARS_525(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_524, v ds
+# define BFI_FLINEARS_525_TICK(t)
+# define BFI_FLINEARS_524(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_523, v ds
+# define BFI_FLINEARS_524_TICK(t)
+# define BFI_FLINEARS_523(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_522, v ds
+# define BFI_FLINEARS_523_TICK(t)
+# define BFI_FLINEARS_522(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_521, v ds
+# define BFI_FLINEARS_522_TICK(t)
+# define BFI_FLINEARS_521(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_520, v ds
+# define BFI_FLINEARS_521_TICK(t)
+# define BFI_FLINEARS_520(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_519, v ds
+# define BFI_FLINEARS_520_TICK(t)
+# define BFI_FLINEARS_519(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_518, v ds
+# define BFI_FLINEARS_519_TICK(t)
+# define BFI_FLINEARS_518(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_517, v ds
+# define BFI_FLINEARS_518_TICK(t)
+# define BFI_FLINEARS_517(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_516, v ds
+# define BFI_FLINEARS_517_TICK(t)
+# define BFI_FLINEARS_516(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_515, v ds
+# define BFI_FLINEARS_516_TICK(t)
+# define BFI_FLINEARS_515(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_514, v ds
+# define BFI_FLINEARS_515_TICK(t)
+# define BFI_FLINEARS_514(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_513, v ds
+# define BFI_FLINEARS_514_TICK(t)
+# define BFI_FLINEARS_513(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_512, v ds
+# define BFI_FLINEARS_513_TICK(t)
+# define BFI_FLINEARS_512(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_511, v ds
+# define BFI_FLINEARS_512_TICK(t)
+# define BFI_FLINEARS_511(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_510, v ds
+# define BFI_FLINEARS_511_TICK(t)
+# define BFI_FLINEARS_510(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_509, v ds
+# define BFI_FLINEARS_510_TICK(t)
+# define BFI_FLINEARS_509(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_508, v ds
+# define BFI_FLINEARS_509_TICK(t)
+# define BFI_FLINEARS_508(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_507, v ds
+# define BFI_FLINEARS_508_TICK(t)
+# define BFI_FLINEARS_507(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_506, v ds
+# define BFI_FLINEARS_507_TICK(t)
+# define BFI_FLINEARS_506(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_505, v ds
+# define BFI_FLINEARS_506_TICK(t)
+# define BFI_FLINEARS_505(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_504, v ds
+# define BFI_FLINEARS_505_TICK(t)
+# define BFI_FLINEARS_504(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_503, v ds
+# define BFI_FLINEARS_504_TICK(t)
+# define BFI_FLINEARS_503(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_502, v ds
+# define BFI_FLINEARS_503_TICK(t)
+# define BFI_FLINEARS_502(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_501, v ds
+# define BFI_FLINEARS_502_TICK(t)
+# define BFI_FLINEARS_501(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_500, v ds
+# define BFI_FLINEARS_501_TICK(t)
+# define BFI_FLINEARS_500(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_499, v ds
+# define BFI_FLINEARS_500_TICK(t)
+# define BFI_FLINEARS_499(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_498, v ds
+# define BFI_FLINEARS_499_TICK(t)
+# define BFI_FLINEARS_498(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_497, v ds
+# define BFI_FLINEARS_498_TICK(t)
+# define BFI_FLINEARS_497(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_496, v ds
+# define BFI_FLINEARS_497_TICK(t)
+# define BFI_FLINEARS_496(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_495, v ds
+# define BFI_FLINEARS_496_TICK(t)
+# define BFI_FLINEARS_495(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_494, v ds
+# define BFI_FLINEARS_495_TICK(t)
+# define BFI_FLINEARS_494(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_493, v ds
+# define BFI_FLINEARS_494_TICK(t)
+# define BFI_FLINEARS_493(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_492, v ds
+# define BFI_FLINEARS_493_TICK(t)
+# define BFI_FLINEARS_492(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_491, v ds
+# define BFI_FLINEARS_492_TICK(t)
+# define BFI_FLINEARS_491(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_490, v ds
+# define BFI_FLINEARS_491_TICK(t)
+# define BFI_FLINEARS_490(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_489, v ds
+# define BFI_FLINEARS_490_TICK(t)
+# define BFI_FLINEARS_489(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_488, v ds
+# define BFI_FLINEARS_489_TICK(t)
+# define BFI_FLINEARS_488(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_487, v ds
+# define BFI_FLINEARS_488_TICK(t)
+# define BFI_FLINEARS_487(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_486, v ds
+# define BFI_FLINEARS_487_TICK(t)
+# define BFI_FLINEARS_486(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_485, v ds
+# define BFI_FLINEARS_486_TICK(t)
+# define BFI_FLINEARS_485(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_484, v ds
+# define BFI_FLINEARS_485_TICK(t)
+# define BFI_FLINEARS_484(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_483, v ds
+# define BFI_FLINEARS_484_TICK(t)
+# define BFI_FLINEARS_483(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_482, v ds
+# define BFI_FLINEARS_483_TICK(t)
+# define BFI_FLINEARS_482(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_481, v ds
+# define BFI_FLINEARS_482_TICK(t)
+# define BFI_FLINEARS_481(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_480, v ds
+# define BFI_FLINEARS_481_TICK(t)
+# define BFI_FLINEARS_480(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_479, v ds
+# define BFI_FLINEARS_480_TICK(t)
+# define BFI_FLINEARS_479(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_478, v ds
+# define BFI_FLINEARS_479_TICK(t)
+# define BFI_FLINEARS_478(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_477, v ds
+# define BFI_FLINEARS_478_TICK(t)
+# define BFI_FLINEARS_477(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_476, v ds
+# define BFI_FLINEARS_477_TICK(t)
+# define BFI_FLINEARS_476(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_475, v ds
+# define BFI_FLINEARS_476_TICK(t)
+# define BFI_FLINEARS_475(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_474, v ds
+# define BFI_FLINEARS_475_TICK(t)
+# define BFI_FLINEARS_474(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_473, v ds
+# define BFI_FLINEARS_474_TICK(t)
+# define BFI_FLINEARS_473(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_472, v ds
+# define BFI_FLINEARS_473_TICK(t)
+# define BFI_FLINEARS_472(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_471, v ds
+# define BFI_FLINEARS_472_TICK(t)
+# define BFI_FLINEARS_471(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_470, v ds
+# define BFI_FLINEARS_471_TICK(t)
+# define BFI_FLINEARS_470(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_469, v ds
+# define BFI_FLINEARS_470_TICK(t)
+# define BFI_FLINEARS_469(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_468, v ds
+# define BFI_FLINEARS_469_TICK(t)
+# define BFI_FLINEARS_468(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_467, v ds
+# define BFI_FLINEARS_468_TICK(t)
+# define BFI_FLINEARS_467(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_466, v ds
+# define BFI_FLINEARS_467_TICK(t)
+# define BFI_FLINEARS_466(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_465, v ds
+# define BFI_FLINEARS_466_TICK(t)
+# define BFI_FLINEARS_465(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_464, v ds
+# define BFI_FLINEARS_465_TICK(t)
+# define BFI_FLINEARS_464(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_463, v ds
+# define BFI_FLINEARS_464_TICK(t)
+# define BFI_FLINEARS_463(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_462, v ds
+# define BFI_FLINEARS_463_TICK(t)
+# define BFI_FLINEARS_462(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_461, v ds
+# define BFI_FLINEARS_462_TICK(t)
+# define BFI_FLINEARS_461(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_460, v ds
+# define BFI_FLINEARS_461_TICK(t)
+# define BFI_FLINEARS_460(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_459, v ds
+# define BFI_FLINEARS_460_TICK(t)
+# define BFI_FLINEARS_459(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_458, v ds
+# define BFI_FLINEARS_459_TICK(t)
+# define BFI_FLINEARS_458(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_457, v ds
+# define BFI_FLINEARS_458_TICK(t)
+# define BFI_FLINEARS_457(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_456, v ds
+# define BFI_FLINEARS_457_TICK(t)
+# define BFI_FLINEARS_456(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_455, v ds
+# define BFI_FLINEARS_456_TICK(t)
+# define BFI_FLINEARS_455(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_454, v ds
+# define BFI_FLINEARS_455_TICK(t)
+# define BFI_FLINEARS_454(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_453, v ds
+# define BFI_FLINEARS_454_TICK(t)
+# define BFI_FLINEARS_453(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_452, v ds
+# define BFI_FLINEARS_453_TICK(t)
+# define BFI_FLINEARS_452(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_451, v ds
+# define BFI_FLINEARS_452_TICK(t)
+# define BFI_FLINEARS_451(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_450, v ds
+# define BFI_FLINEARS_451_TICK(t)
+# define BFI_FLINEARS_450(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_449, v ds
+# define BFI_FLINEARS_450_TICK(t)
+# define BFI_FLINEARS_449(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_448, v ds
+# define BFI_FLINEARS_449_TICK(t)
+# define BFI_FLINEARS_448(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_447, v ds
+# define BFI_FLINEARS_448_TICK(t)
+# define BFI_FLINEARS_447(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_446, v ds
+# define BFI_FLINEARS_447_TICK(t)
+# define BFI_FLINEARS_446(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_445, v ds
+# define BFI_FLINEARS_446_TICK(t)
+# define BFI_FLINEARS_445(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_444, v ds
+# define BFI_FLINEARS_445_TICK(t)
+# define BFI_FLINEARS_444(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_443, v ds
+# define BFI_FLINEARS_444_TICK(t)
+# define BFI_FLINEARS_443(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_442, v ds
+# define BFI_FLINEARS_443_TICK(t)
+# define BFI_FLINEARS_442(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_441, v ds
+# define BFI_FLINEARS_442_TICK(t)
+# define BFI_FLINEARS_441(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_440, v ds
+# define BFI_FLINEARS_441_TICK(t)
+# define BFI_FLINEARS_440(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_439, v ds
+# define BFI_FLINEARS_440_TICK(t)
+# define BFI_FLINEARS_439(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_438, v ds
+# define BFI_FLINEARS_439_TICK(t)
+# define BFI_FLINEARS_438(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_437, v ds
+# define BFI_FLINEARS_438_TICK(t)
+# define BFI_FLINEARS_437(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_436, v ds
+# define BFI_FLINEARS_437_TICK(t)
+# define BFI_FLINEARS_436(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_435, v ds
+# define BFI_FLINEARS_436_TICK(t)
+# define BFI_FLINEARS_435(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_434, v ds
+# define BFI_FLINEARS_435_TICK(t)
+# define BFI_FLINEARS_434(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_433, v ds
+# define BFI_FLINEARS_434_TICK(t)
+# define BFI_FLINEARS_433(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_432, v ds
+# define BFI_FLINEARS_433_TICK(t)
+# define BFI_FLINEARS_432(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_431, v ds
+# define BFI_FLINEARS_432_TICK(t)
+# define BFI_FLINEARS_431(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_430, v ds
+# define BFI_FLINEARS_431_TICK(t)
+# define BFI_FLINEARS_430(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_429, v ds
+# define BFI_FLINEARS_430_TICK(t)
+# define BFI_FLINEARS_429(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_428, v ds
+# define BFI_FLINEARS_429_TICK(t)
+# define BFI_FLINEARS_428(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_427, v ds
+# define BFI_FLINEARS_428_TICK(t)
+# define BFI_FLINEARS_427(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_426, v ds
+# define BFI_FLINEARS_427_TICK(t)
+# define BFI_FLINEARS_426(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_425, v ds
+# define BFI_FLINEARS_426_TICK(t)
+# define BFI_FLINEARS_425(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_424, v ds
+# define BFI_FLINEARS_425_TICK(t)
+# define BFI_FLINEARS_424(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_423, v ds
+# define BFI_FLINEARS_424_TICK(t)
+# define BFI_FLINEARS_423(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_422, v ds
+# define BFI_FLINEARS_423_TICK(t)
+# define BFI_FLINEARS_422(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_421, v ds
+# define BFI_FLINEARS_422_TICK(t)
+# define BFI_FLINEARS_421(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_420, v ds
+# define BFI_FLINEARS_421_TICK(t)
+# define BFI_FLINEARS_420(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_419, v ds
+# define BFI_FLINEARS_420_TICK(t)
+# define BFI_FLINEARS_419(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_418, v ds
+# define BFI_FLINEARS_419_TICK(t)
+# define BFI_FLINEARS_418(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_417, v ds
+# define BFI_FLINEARS_418_TICK(t)
+# define BFI_FLINEARS_417(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_416, v ds
+# define BFI_FLINEARS_417_TICK(t)
+# define BFI_FLINEARS_416(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_415, v ds
+# define BFI_FLINEARS_416_TICK(t)
+# define BFI_FLINEARS_415(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_414, v ds
+# define BFI_FLINEARS_415_TICK(t)
+# define BFI_FLINEARS_414(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_413, v ds
+# define BFI_FLINEARS_414_TICK(t)
+# define BFI_FLINEARS_413(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_412, v ds
+# define BFI_FLINEARS_413_TICK(t)
+# define BFI_FLINEARS_412(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_411, v ds
+# define BFI_FLINEARS_412_TICK(t)
+# define BFI_FLINEARS_411(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_410, v ds
+# define BFI_FLINEARS_411_TICK(t)
+# define BFI_FLINEARS_410(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_409, v ds
+# define BFI_FLINEARS_410_TICK(t)
+# define BFI_FLINEARS_409(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_408, v ds
+# define BFI_FLINEARS_409_TICK(t)
+# define BFI_FLINEARS_408(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_407, v ds
+# define BFI_FLINEARS_408_TICK(t)
+# define BFI_FLINEARS_407(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_406, v ds
+# define BFI_FLINEARS_407_TICK(t)
+# define BFI_FLINEARS_406(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_405, v ds
+# define BFI_FLINEARS_406_TICK(t)
+# define BFI_FLINEARS_405(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_404, v ds
+# define BFI_FLINEARS_405_TICK(t)
+# define BFI_FLINEARS_404(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_403, v ds
+# define BFI_FLINEARS_404_TICK(t)
+# define BFI_FLINEARS_403(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_402, v ds
+# define BFI_FLINEARS_403_TICK(t)
+# define BFI_FLINEARS_402(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_401, v ds
+# define BFI_FLINEARS_402_TICK(t)
+# define BFI_FLINEARS_401(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_400, v ds
+# define BFI_FLINEARS_401_TICK(t)
+# define BFI_FLINEARS_400(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_399, v ds
+# define BFI_FLINEARS_400_TICK(t)
+# define BFI_FLINEARS_399(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_398, v ds
+# define BFI_FLINEARS_399_TICK(t)
+# define BFI_FLINEARS_398(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_397, v ds
+# define BFI_FLINEARS_398_TICK(t)
+# define BFI_FLINEARS_397(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_396, v ds
+# define BFI_FLINEARS_397_TICK(t)
+# define BFI_FLINEARS_396(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_395, v ds
+# define BFI_FLINEARS_396_TICK(t)
+# define BFI_FLINEARS_395(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_394, v ds
+# define BFI_FLINEARS_395_TICK(t)
+# define BFI_FLINEARS_394(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_393, v ds
+# define BFI_FLINEARS_394_TICK(t)
+# define BFI_FLINEARS_393(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_392, v ds
+# define BFI_FLINEARS_393_TICK(t)
+# define BFI_FLINEARS_392(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_391, v ds
+# define BFI_FLINEARS_392_TICK(t)
+# define BFI_FLINEARS_391(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_390, v ds
+# define BFI_FLINEARS_391_TICK(t)
+# define BFI_FLINEARS_390(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_389, v ds
+# define BFI_FLINEARS_390_TICK(t)
+# define BFI_FLINEARS_389(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_388, v ds
+# define BFI_FLINEARS_389_TICK(t)
+# define BFI_FLINEARS_388(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_387, v ds
+# define BFI_FLINEARS_388_TICK(t)
+# define BFI_FLINEARS_387(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_386, v ds
+# define BFI_FLINEARS_387_TICK(t)
+# define BFI_FLINEARS_386(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_385, v ds
+# define BFI_FLINEARS_386_TICK(t)
+# define BFI_FLINEARS_385(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_384, v ds
+# define BFI_FLINEARS_385_TICK(t)
+# define BFI_FLINEARS_384(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_383, v ds
+# define BFI_FLINEARS_384_TICK(t)
+# define BFI_FLINEARS_383(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_382, v ds
+# define BFI_FLINEARS_383_TICK(t)
+# define BFI_FLINEARS_382(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_381, v ds
+# define BFI_FLINEARS_382_TICK(t)
+# define BFI_FLINEARS_381(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_380, v ds
+# define BFI_FLINEARS_381_TICK(t)
+# define BFI_FLINEARS_380(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_379, v ds
+# define BFI_FLINEARS_380_TICK(t)
+# define BFI_FLINEARS_379(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_378, v ds
+# define BFI_FLINEARS_379_TICK(t)
+# define BFI_FLINEARS_378(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_377, v ds
+# define BFI_FLINEARS_378_TICK(t)
+# define BFI_FLINEARS_377(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_376, v ds
+# define BFI_FLINEARS_377_TICK(t)
+# define BFI_FLINEARS_376(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_375, v ds
+# define BFI_FLINEARS_376_TICK(t)
+# define BFI_FLINEARS_375(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_374, v ds
+# define BFI_FLINEARS_375_TICK(t)
+# define BFI_FLINEARS_374(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_373, v ds
+# define BFI_FLINEARS_374_TICK(t)
+# define BFI_FLINEARS_373(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_372, v ds
+# define BFI_FLINEARS_373_TICK(t)
+# define BFI_FLINEARS_372(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_371, v ds
+# define BFI_FLINEARS_372_TICK(t)
+# define BFI_FLINEARS_371(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_370, v ds
+# define BFI_FLINEARS_371_TICK(t)
+# define BFI_FLINEARS_370(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_369, v ds
+# define BFI_FLINEARS_370_TICK(t)
+# define BFI_FLINEARS_369(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_368, v ds
+# define BFI_FLINEARS_369_TICK(t)
+# define BFI_FLINEARS_368(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_367, v ds
+# define BFI_FLINEARS_368_TICK(t)
+# define BFI_FLINEARS_367(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_366, v ds
+# define BFI_FLINEARS_367_TICK(t)
+# define BFI_FLINEARS_366(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_365, v ds
+# define BFI_FLINEARS_366_TICK(t)
+# define BFI_FLINEARS_365(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_364, v ds
+# define BFI_FLINEARS_365_TICK(t)
+# define BFI_FLINEARS_364(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_363, v ds
+# define BFI_FLINEARS_364_TICK(t)
+# define BFI_FLINEARS_363(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_362, v ds
+# define BFI_FLINEARS_363_TICK(t)
+# define BFI_FLINEARS_362(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_361, v ds
+# define BFI_FLINEARS_362_TICK(t)
+# define BFI_FLINEARS_361(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_360, v ds
+# define BFI_FLINEARS_361_TICK(t)
+# define BFI_FLINEARS_360(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_359, v ds
+# define BFI_FLINEARS_360_TICK(t)
+# define BFI_FLINEARS_359(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_358, v ds
+# define BFI_FLINEARS_359_TICK(t)
+# define BFI_FLINEARS_358(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_357, v ds
+# define BFI_FLINEARS_358_TICK(t)
+# define BFI_FLINEARS_357(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_356, v ds
+# define BFI_FLINEARS_357_TICK(t)
+# define BFI_FLINEARS_356(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_355, v ds
+# define BFI_FLINEARS_356_TICK(t)
+# define BFI_FLINEARS_355(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_354, v ds
+# define BFI_FLINEARS_355_TICK(t)
+# define BFI_FLINEARS_354(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_353, v ds
+# define BFI_FLINEARS_354_TICK(t)
+# define BFI_FLINEARS_353(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_352, v ds
+# define BFI_FLINEARS_353_TICK(t)
+# define BFI_FLINEARS_352(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_351, v ds
+# define BFI_FLINEARS_352_TICK(t)
+# define BFI_FLINEARS_351(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_350, v ds
+# define BFI_FLINEARS_351_TICK(t)
+# define BFI_FLINEARS_350(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_349, v ds
+# define BFI_FLINEARS_350_TICK(t)
+# define BFI_FLINEARS_349(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_348, v ds
+# define BFI_FLINEARS_349_TICK(t)
+# define BFI_FLINEARS_348(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_347, v ds
+# define BFI_FLINEARS_348_TICK(t)
+# define BFI_FLINEARS_347(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_346, v ds
+# define BFI_FLINEARS_347_TICK(t)
+# define BFI_FLINEARS_346(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_345, v ds
+# define BFI_FLINEARS_346_TICK(t)
+# define BFI_FLINEARS_345(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_344, v ds
+# define BFI_FLINEARS_345_TICK(t)
+# define BFI_FLINEARS_344(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_343, v ds
+# define BFI_FLINEARS_344_TICK(t)
+# define BFI_FLINEARS_343(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_342, v ds
+# define BFI_FLINEARS_343_TICK(t)
+# define BFI_FLINEARS_342(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_341, v ds
+# define BFI_FLINEARS_342_TICK(t)
+# define BFI_FLINEARS_341(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_340, v ds
+# define BFI_FLINEARS_341_TICK(t)
+# define BFI_FLINEARS_340(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_339, v ds
+# define BFI_FLINEARS_340_TICK(t)
+# define BFI_FLINEARS_339(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_338, v ds
+# define BFI_FLINEARS_339_TICK(t)
+# define BFI_FLINEARS_338(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_337, v ds
+# define BFI_FLINEARS_338_TICK(t)
+# define BFI_FLINEARS_337(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_336, v ds
+# define BFI_FLINEARS_337_TICK(t)
+# define BFI_FLINEARS_336(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_335, v ds
+# define BFI_FLINEARS_336_TICK(t)
+# define BFI_FLINEARS_335(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_334, v ds
+# define BFI_FLINEARS_335_TICK(t)
+# define BFI_FLINEARS_334(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_333, v ds
+# define BFI_FLINEARS_334_TICK(t)
+# define BFI_FLINEARS_333(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_332, v ds
+# define BFI_FLINEARS_333_TICK(t)
+# define BFI_FLINEARS_332(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_331, v ds
+# define BFI_FLINEARS_332_TICK(t)
+# define BFI_FLINEARS_331(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_330, v ds
+# define BFI_FLINEARS_331_TICK(t)
+# define BFI_FLINEARS_330(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_329, v ds
+# define BFI_FLINEARS_330_TICK(t)
+# define BFI_FLINEARS_329(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_328, v ds
+# define BFI_FLINEARS_329_TICK(t)
+# define BFI_FLINEARS_328(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_327, v ds
+# define BFI_FLINEARS_328_TICK(t)
+# define BFI_FLINEARS_327(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_326, v ds
+# define BFI_FLINEARS_327_TICK(t)
+# define BFI_FLINEARS_326(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_325, v ds
+# define BFI_FLINEARS_326_TICK(t)
+# define BFI_FLINEARS_325(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_324, v ds
+# define BFI_FLINEARS_325_TICK(t)
+# define BFI_FLINEARS_324(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_323, v ds
+# define BFI_FLINEARS_324_TICK(t)
+# define BFI_FLINEARS_323(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_322, v ds
+# define BFI_FLINEARS_323_TICK(t)
+# define BFI_FLINEARS_322(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_321, v ds
+# define BFI_FLINEARS_322_TICK(t)
+# define BFI_FLINEARS_321(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_320, v ds
+# define BFI_FLINEARS_321_TICK(t)
+# define BFI_FLINEARS_320(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_319, v ds
+# define BFI_FLINEARS_320_TICK(t)
+# define BFI_FLINEARS_319(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_318, v ds
+# define BFI_FLINEARS_319_TICK(t)
+# define BFI_FLINEARS_318(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_317, v ds
+# define BFI_FLINEARS_318_TICK(t)
+# define BFI_FLINEARS_317(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_316, v ds
+# define BFI_FLINEARS_317_TICK(t)
+# define BFI_FLINEARS_316(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_315, v ds
+# define BFI_FLINEARS_316_TICK(t)
+# define BFI_FLINEARS_315(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_314, v ds
+# define BFI_FLINEARS_315_TICK(t)
+# define BFI_FLINEARS_314(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_313, v ds
+# define BFI_FLINEARS_314_TICK(t)
+# define BFI_FLINEARS_313(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_312, v ds
+# define BFI_FLINEARS_313_TICK(t)
+# define BFI_FLINEARS_312(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_311, v ds
+# define BFI_FLINEARS_312_TICK(t)
+# define BFI_FLINEARS_311(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_310, v ds
+# define BFI_FLINEARS_311_TICK(t)
+# define BFI_FLINEARS_310(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_309, v ds
+# define BFI_FLINEARS_310_TICK(t)
+# define BFI_FLINEARS_309(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_308, v ds
+# define BFI_FLINEARS_309_TICK(t)
+# define BFI_FLINEARS_308(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_307, v ds
+# define BFI_FLINEARS_308_TICK(t)
+# define BFI_FLINEARS_307(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_306, v ds
+# define BFI_FLINEARS_307_TICK(t)
+# define BFI_FLINEARS_306(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_305, v ds
+# define BFI_FLINEARS_306_TICK(t)
+# define BFI_FLINEARS_305(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_304, v ds
+# define BFI_FLINEARS_305_TICK(t)
+# define BFI_FLINEARS_304(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_303, v ds
+# define BFI_FLINEARS_304_TICK(t)
+# define BFI_FLINEARS_303(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_302, v ds
+# define BFI_FLINEARS_303_TICK(t)
+# define BFI_FLINEARS_302(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_301, v ds
+# define BFI_FLINEARS_302_TICK(t)
+# define BFI_FLINEARS_301(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_300, v ds
+# define BFI_FLINEARS_301_TICK(t)
+# define BFI_FLINEARS_300(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_299, v ds
+# define BFI_FLINEARS_300_TICK(t)
+# define BFI_FLINEARS_299(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_298, v ds
+# define BFI_FLINEARS_299_TICK(t)
+# define BFI_FLINEARS_298(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_297, v ds
+# define BFI_FLINEARS_298_TICK(t)
+# define BFI_FLINEARS_297(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_296, v ds
+# define BFI_FLINEARS_297_TICK(t)
+# define BFI_FLINEARS_296(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_295, v ds
+# define BFI_FLINEARS_296_TICK(t)
+# define BFI_FLINEARS_295(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_294, v ds
+# define BFI_FLINEARS_295_TICK(t)
+# define BFI_FLINEARS_294(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_293, v ds
+# define BFI_FLINEARS_294_TICK(t)
+# define BFI_FLINEARS_293(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_292, v ds
+# define BFI_FLINEARS_293_TICK(t)
+# define BFI_FLINEARS_292(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_291, v ds
+# define BFI_FLINEARS_292_TICK(t)
+# define BFI_FLINEARS_291(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_290, v ds
+# define BFI_FLINEARS_291_TICK(t)
+# define BFI_FLINEARS_290(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_289, v ds
+# define BFI_FLINEARS_290_TICK(t)
+# define BFI_FLINEARS_289(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_288, v ds
+# define BFI_FLINEARS_289_TICK(t)
+# define BFI_FLINEARS_288(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_287, v ds
+# define BFI_FLINEARS_288_TICK(t)
+# define BFI_FLINEARS_287(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_286, v ds
+# define BFI_FLINEARS_287_TICK(t)
+# define BFI_FLINEARS_286(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_285, v ds
+# define BFI_FLINEARS_286_TICK(t)
+# define BFI_FLINEARS_285(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_284, v ds
+# define BFI_FLINEARS_285_TICK(t)
+# define BFI_FLINEARS_284(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_283, v ds
+# define BFI_FLINEARS_284_TICK(t)
+# define BFI_FLINEARS_283(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_282, v ds
+# define BFI_FLINEARS_283_TICK(t)
+# define BFI_FLINEARS_282(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_281, v ds
+# define BFI_FLINEARS_282_TICK(t)
+# define BFI_FLINEARS_281(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_280, v ds
+# define BFI_FLINEARS_281_TICK(t)
+# define BFI_FLINEARS_280(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_279, v ds
+# define BFI_FLINEARS_280_TICK(t)
+# define BFI_FLINEARS_279(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_278, v ds
+# define BFI_FLINEARS_279_TICK(t)
+# define BFI_FLINEARS_278(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_277, v ds
+# define BFI_FLINEARS_278_TICK(t)
+# define BFI_FLINEARS_277(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_276, v ds
+# define BFI_FLINEARS_277_TICK(t)
+# define BFI_FLINEARS_276(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_275, v ds
+# define BFI_FLINEARS_276_TICK(t)
+# define BFI_FLINEARS_275(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_274, v ds
+# define BFI_FLINEARS_275_TICK(t)
+# define BFI_FLINEARS_274(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_273, v ds
+# define BFI_FLINEARS_274_TICK(t)
+# define BFI_FLINEARS_273(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_272, v ds
+# define BFI_FLINEARS_273_TICK(t)
+# define BFI_FLINEARS_272(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_271, v ds
+# define BFI_FLINEARS_272_TICK(t)
+# define BFI_FLINEARS_271(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_270, v ds
+# define BFI_FLINEARS_271_TICK(t)
+# define BFI_FLINEARS_270(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_269, v ds
+# define BFI_FLINEARS_270_TICK(t)
+# define BFI_FLINEARS_269(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_268, v ds
+# define BFI_FLINEARS_269_TICK(t)
+# define BFI_FLINEARS_268(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_267, v ds
+# define BFI_FLINEARS_268_TICK(t)
+# define BFI_FLINEARS_267(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_266, v ds
+# define BFI_FLINEARS_267_TICK(t)
+# define BFI_FLINEARS_266(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_265, v ds
+# define BFI_FLINEARS_266_TICK(t)
+# define BFI_FLINEARS_265(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_264, v ds
+# define BFI_FLINEARS_265_TICK(t)
+# define BFI_FLINEARS_264(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_263, v ds
+# define BFI_FLINEARS_264_TICK(t)
+# define BFI_FLINEARS_263(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_262, v ds
+# define BFI_FLINEARS_263_TICK(t)
+# define BFI_FLINEARS_262(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_261, v ds
+# define BFI_FLINEARS_262_TICK(t)
+# define BFI_FLINEARS_261(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_260, v ds
+# define BFI_FLINEARS_261_TICK(t)
+# define BFI_FLINEARS_260(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_259, v ds
+# define BFI_FLINEARS_260_TICK(t)
+# define BFI_FLINEARS_259(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_258, v ds
+# define BFI_FLINEARS_259_TICK(t)
+# define BFI_FLINEARS_258(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_257, v ds
+# define BFI_FLINEARS_258_TICK(t)
+# define BFI_FLINEARS_257(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_256, v ds
+# define BFI_FLINEARS_257_TICK(t)
+
+# endif
@@ -0,0 +1,391 @@
+# ifndef BFI_LINEAR_S_256_H
+# define BFI_LINEAR_S_256_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARS_256(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_255, v ds
+# define BFI_FLINEARS_256_TICK(t)
+# define BFI_FLINEARS_255(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_254, v ds
+# define BFI_FLINEARS_255_TICK(t)
+# define BFI_FLINEARS_254(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_253, v ds
+# define BFI_FLINEARS_254_TICK(t)
+# define BFI_FLINEARS_253(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_252, v ds
+# define BFI_FLINEARS_253_TICK(t)
+# define BFI_FLINEARS_252(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_251, v ds
+# define BFI_FLINEARS_252_TICK(t)
+# define BFI_FLINEARS_251(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_250, v ds
+# define BFI_FLINEARS_251_TICK(t)
+# define BFI_FLINEARS_250(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_249, v ds
+# define BFI_FLINEARS_250_TICK(t)
+# define BFI_FLINEARS_249(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_248, v ds
+# define BFI_FLINEARS_249_TICK(t)
+# define BFI_FLINEARS_248(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_247, v ds
+# define BFI_FLINEARS_248_TICK(t)
+# define BFI_FLINEARS_247(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_246, v ds
+# define BFI_FLINEARS_247_TICK(t)
+# define BFI_FLINEARS_246(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_245, v ds
+# define BFI_FLINEARS_246_TICK(t)
+# define BFI_FLINEARS_245(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_244, v ds
+# define BFI_FLINEARS_245_TICK(t)
+# define BFI_FLINEARS_244(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_243, v ds
+# define BFI_FLINEARS_244_TICK(t)
+# define BFI_FLINEARS_243(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_242, v ds
+# define BFI_FLINEARS_243_TICK(t)
+# define BFI_FLINEARS_242(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_241, v ds
+# define BFI_FLINEARS_242_TICK(t)
+# define BFI_FLINEARS_241(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_240, v ds
+# define BFI_FLINEARS_241_TICK(t)
+# define BFI_FLINEARS_240(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_239, v ds
+# define BFI_FLINEARS_240_TICK(t)
+# define BFI_FLINEARS_239(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_238, v ds
+# define BFI_FLINEARS_239_TICK(t)
+# define BFI_FLINEARS_238(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_237, v ds
+# define BFI_FLINEARS_238_TICK(t)
+# define BFI_FLINEARS_237(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_236, v ds
+# define BFI_FLINEARS_237_TICK(t)
+# define BFI_FLINEARS_236(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_235, v ds
+# define BFI_FLINEARS_236_TICK(t)
+# define BFI_FLINEARS_235(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_234, v ds
+# define BFI_FLINEARS_235_TICK(t)
+# define BFI_FLINEARS_234(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_233, v ds
+# define BFI_FLINEARS_234_TICK(t)
+# define BFI_FLINEARS_233(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_232, v ds
+# define BFI_FLINEARS_233_TICK(t)
+# define BFI_FLINEARS_232(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_231, v ds
+# define BFI_FLINEARS_232_TICK(t)
+# define BFI_FLINEARS_231(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_230, v ds
+# define BFI_FLINEARS_231_TICK(t)
+# define BFI_FLINEARS_230(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_229, v ds
+# define BFI_FLINEARS_230_TICK(t)
+# define BFI_FLINEARS_229(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_228, v ds
+# define BFI_FLINEARS_229_TICK(t)
+# define BFI_FLINEARS_228(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_227, v ds
+# define BFI_FLINEARS_228_TICK(t)
+# define BFI_FLINEARS_227(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_226, v ds
+# define BFI_FLINEARS_227_TICK(t)
+# define BFI_FLINEARS_226(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_225, v ds
+# define BFI_FLINEARS_226_TICK(t)
+# define BFI_FLINEARS_225(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_224, v ds
+# define BFI_FLINEARS_225_TICK(t)
+# define BFI_FLINEARS_224(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_223, v ds
+# define BFI_FLINEARS_224_TICK(t)
+# define BFI_FLINEARS_223(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_222, v ds
+# define BFI_FLINEARS_223_TICK(t)
+# define BFI_FLINEARS_222(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_221, v ds
+# define BFI_FLINEARS_222_TICK(t)
+# define BFI_FLINEARS_221(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_220, v ds
+# define BFI_FLINEARS_221_TICK(t)
+# define BFI_FLINEARS_220(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_219, v ds
+# define BFI_FLINEARS_220_TICK(t)
+# define BFI_FLINEARS_219(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_218, v ds
+# define BFI_FLINEARS_219_TICK(t)
+# define BFI_FLINEARS_218(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_217, v ds
+# define BFI_FLINEARS_218_TICK(t)
+# define BFI_FLINEARS_217(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_216, v ds
+# define BFI_FLINEARS_217_TICK(t)
+# define BFI_FLINEARS_216(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_215, v ds
+# define BFI_FLINEARS_216_TICK(t)
+# define BFI_FLINEARS_215(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_214, v ds
+# define BFI_FLINEARS_215_TICK(t)
+# define BFI_FLINEARS_214(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_213, v ds
+# define BFI_FLINEARS_214_TICK(t)
+# define BFI_FLINEARS_213(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_212, v ds
+# define BFI_FLINEARS_213_TICK(t)
+# define BFI_FLINEARS_212(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_211, v ds
+# define BFI_FLINEARS_212_TICK(t)
+# define BFI_FLINEARS_211(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_210, v ds
+# define BFI_FLINEARS_211_TICK(t)
+# define BFI_FLINEARS_210(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_209, v ds
+# define BFI_FLINEARS_210_TICK(t)
+# define BFI_FLINEARS_209(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_208, v ds
+# define BFI_FLINEARS_209_TICK(t)
+# define BFI_FLINEARS_208(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_207, v ds
+# define BFI_FLINEARS_208_TICK(t)
+# define BFI_FLINEARS_207(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_206, v ds
+# define BFI_FLINEARS_207_TICK(t)
+# define BFI_FLINEARS_206(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_205, v ds
+# define BFI_FLINEARS_206_TICK(t)
+# define BFI_FLINEARS_205(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_204, v ds
+# define BFI_FLINEARS_205_TICK(t)
+# define BFI_FLINEARS_204(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_203, v ds
+# define BFI_FLINEARS_204_TICK(t)
+# define BFI_FLINEARS_203(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_202, v ds
+# define BFI_FLINEARS_203_TICK(t)
+# define BFI_FLINEARS_202(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_201, v ds
+# define BFI_FLINEARS_202_TICK(t)
+# define BFI_FLINEARS_201(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_200, v ds
+# define BFI_FLINEARS_201_TICK(t)
+# define BFI_FLINEARS_200(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_199, v ds
+# define BFI_FLINEARS_200_TICK(t)
+# define BFI_FLINEARS_199(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_198, v ds
+# define BFI_FLINEARS_199_TICK(t)
+# define BFI_FLINEARS_198(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_197, v ds
+# define BFI_FLINEARS_198_TICK(t)
+# define BFI_FLINEARS_197(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_196, v ds
+# define BFI_FLINEARS_197_TICK(t)
+# define BFI_FLINEARS_196(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_195, v ds
+# define BFI_FLINEARS_196_TICK(t)
+# define BFI_FLINEARS_195(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_194, v ds
+# define BFI_FLINEARS_195_TICK(t)
+# define BFI_FLINEARS_194(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_193, v ds
+# define BFI_FLINEARS_194_TICK(t)
+# define BFI_FLINEARS_193(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_192, v ds
+# define BFI_FLINEARS_193_TICK(t)
+# define BFI_FLINEARS_192(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_191, v ds
+# define BFI_FLINEARS_192_TICK(t)
+# define BFI_FLINEARS_191(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_190, v ds
+# define BFI_FLINEARS_191_TICK(t)
+# define BFI_FLINEARS_190(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_189, v ds
+# define BFI_FLINEARS_190_TICK(t)
+# define BFI_FLINEARS_189(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_188, v ds
+# define BFI_FLINEARS_189_TICK(t)
+# define BFI_FLINEARS_188(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_187, v ds
+# define BFI_FLINEARS_188_TICK(t)
+# define BFI_FLINEARS_187(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_186, v ds
+# define BFI_FLINEARS_187_TICK(t)
+# define BFI_FLINEARS_186(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_185, v ds
+# define BFI_FLINEARS_186_TICK(t)
+# define BFI_FLINEARS_185(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_184, v ds
+# define BFI_FLINEARS_185_TICK(t)
+# define BFI_FLINEARS_184(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_183, v ds
+# define BFI_FLINEARS_184_TICK(t)
+# define BFI_FLINEARS_183(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_182, v ds
+# define BFI_FLINEARS_183_TICK(t)
+# define BFI_FLINEARS_182(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_181, v ds
+# define BFI_FLINEARS_182_TICK(t)
+# define BFI_FLINEARS_181(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_180, v ds
+# define BFI_FLINEARS_181_TICK(t)
+# define BFI_FLINEARS_180(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_179, v ds
+# define BFI_FLINEARS_180_TICK(t)
+# define BFI_FLINEARS_179(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_178, v ds
+# define BFI_FLINEARS_179_TICK(t)
+# define BFI_FLINEARS_178(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_177, v ds
+# define BFI_FLINEARS_178_TICK(t)
+# define BFI_FLINEARS_177(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_176, v ds
+# define BFI_FLINEARS_177_TICK(t)
+# define BFI_FLINEARS_176(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_175, v ds
+# define BFI_FLINEARS_176_TICK(t)
+# define BFI_FLINEARS_175(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_174, v ds
+# define BFI_FLINEARS_175_TICK(t)
+# define BFI_FLINEARS_174(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_173, v ds
+# define BFI_FLINEARS_174_TICK(t)
+# define BFI_FLINEARS_173(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_172, v ds
+# define BFI_FLINEARS_173_TICK(t)
+# define BFI_FLINEARS_172(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_171, v ds
+# define BFI_FLINEARS_172_TICK(t)
+# define BFI_FLINEARS_171(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_170, v ds
+# define BFI_FLINEARS_171_TICK(t)
+# define BFI_FLINEARS_170(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_169, v ds
+# define BFI_FLINEARS_170_TICK(t)
+# define BFI_FLINEARS_169(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_168, v ds
+# define BFI_FLINEARS_169_TICK(t)
+# define BFI_FLINEARS_168(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_167, v ds
+# define BFI_FLINEARS_168_TICK(t)
+# define BFI_FLINEARS_167(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_166, v ds
+# define BFI_FLINEARS_167_TICK(t)
+# define BFI_FLINEARS_166(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_165, v ds
+# define BFI_FLINEARS_166_TICK(t)
+# define BFI_FLINEARS_165(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_164, v ds
+# define BFI_FLINEARS_165_TICK(t)
+# define BFI_FLINEARS_164(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_163, v ds
+# define BFI_FLINEARS_164_TICK(t)
+# define BFI_FLINEARS_163(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_162, v ds
+# define BFI_FLINEARS_163_TICK(t)
+# define BFI_FLINEARS_162(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_161, v ds
+# define BFI_FLINEARS_162_TICK(t)
+# define BFI_FLINEARS_161(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_160, v ds
+# define BFI_FLINEARS_161_TICK(t)
+# define BFI_FLINEARS_160(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_159, v ds
+# define BFI_FLINEARS_160_TICK(t)
+# define BFI_FLINEARS_159(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_158, v ds
+# define BFI_FLINEARS_159_TICK(t)
+# define BFI_FLINEARS_158(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_157, v ds
+# define BFI_FLINEARS_158_TICK(t)
+# define BFI_FLINEARS_157(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_156, v ds
+# define BFI_FLINEARS_157_TICK(t)
+# define BFI_FLINEARS_156(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_155, v ds
+# define BFI_FLINEARS_156_TICK(t)
+# define BFI_FLINEARS_155(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_154, v ds
+# define BFI_FLINEARS_155_TICK(t)
+# define BFI_FLINEARS_154(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_153, v ds
+# define BFI_FLINEARS_154_TICK(t)
+# define BFI_FLINEARS_153(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_152, v ds
+# define BFI_FLINEARS_153_TICK(t)
+# define BFI_FLINEARS_152(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_151, v ds
+# define BFI_FLINEARS_152_TICK(t)
+# define BFI_FLINEARS_151(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_150, v ds
+# define BFI_FLINEARS_151_TICK(t)
+# define BFI_FLINEARS_150(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_149, v ds
+# define BFI_FLINEARS_150_TICK(t)
+# define BFI_FLINEARS_149(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_148, v ds
+# define BFI_FLINEARS_149_TICK(t)
+# define BFI_FLINEARS_148(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_147, v ds
+# define BFI_FLINEARS_148_TICK(t)
+# define BFI_FLINEARS_147(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_146, v ds
+# define BFI_FLINEARS_147_TICK(t)
+# define BFI_FLINEARS_146(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_145, v ds
+# define BFI_FLINEARS_146_TICK(t)
+# define BFI_FLINEARS_145(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_144, v ds
+# define BFI_FLINEARS_145_TICK(t)
+# define BFI_FLINEARS_144(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_143, v ds
+# define BFI_FLINEARS_144_TICK(t)
+# define BFI_FLINEARS_143(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_142, v ds
+# define BFI_FLINEARS_143_TICK(t)
+# define BFI_FLINEARS_142(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_141, v ds
+# define BFI_FLINEARS_142_TICK(t)
+# define BFI_FLINEARS_141(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_140, v ds
+# define BFI_FLINEARS_141_TICK(t)
+# define BFI_FLINEARS_140(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_139, v ds
+# define BFI_FLINEARS_140_TICK(t)
+# define BFI_FLINEARS_139(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_138, v ds
+# define BFI_FLINEARS_139_TICK(t)
+# define BFI_FLINEARS_138(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_137, v ds
+# define BFI_FLINEARS_138_TICK(t)
+# define BFI_FLINEARS_137(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_136, v ds
+# define BFI_FLINEARS_137_TICK(t)
+# define BFI_FLINEARS_136(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_135, v ds
+# define BFI_FLINEARS_136_TICK(t)
+# define BFI_FLINEARS_135(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_134, v ds
+# define BFI_FLINEARS_135_TICK(t)
+# define BFI_FLINEARS_134(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_133, v ds
+# define BFI_FLINEARS_134_TICK(t)
+# define BFI_FLINEARS_133(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_132, v ds
+# define BFI_FLINEARS_133_TICK(t)
+# define BFI_FLINEARS_132(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_131, v ds
+# define BFI_FLINEARS_132_TICK(t)
+# define BFI_FLINEARS_131(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_130, v ds
+# define BFI_FLINEARS_131_TICK(t)
+# define BFI_FLINEARS_130(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_129, v ds
+# define BFI_FLINEARS_130_TICK(t)
+# define BFI_FLINEARS_129(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_128, v ds
+# define BFI_FLINEARS_129_TICK(t)
+# define BFI_FLINEARS_128(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_127, v ds
+# define BFI_FLINEARS_128_TICK(t)
+# define BFI_FLINEARS_127(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_126, v ds
+# define BFI_FLINEARS_127_TICK(t)
+# define BFI_FLINEARS_126(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_125, v ds
+# define BFI_FLINEARS_126_TICK(t)
+# define BFI_FLINEARS_125(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_124, v ds
+# define BFI_FLINEARS_125_TICK(t)
+# define BFI_FLINEARS_124(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_123, v ds
+# define BFI_FLINEARS_124_TICK(t)
+# define BFI_FLINEARS_123(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_122, v ds
+# define BFI_FLINEARS_123_TICK(t)
+# define BFI_FLINEARS_122(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_121, v ds
+# define BFI_FLINEARS_122_TICK(t)
+# define BFI_FLINEARS_121(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_120, v ds
+# define BFI_FLINEARS_121_TICK(t)
+# define BFI_FLINEARS_120(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_119, v ds
+# define BFI_FLINEARS_120_TICK(t)
+# define BFI_FLINEARS_119(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_118, v ds
+# define BFI_FLINEARS_119_TICK(t)
+# define BFI_FLINEARS_118(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_117, v ds
+# define BFI_FLINEARS_118_TICK(t)
+# define BFI_FLINEARS_117(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_116, v ds
+# define BFI_FLINEARS_117_TICK(t)
+# define BFI_FLINEARS_116(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_115, v ds
+# define BFI_FLINEARS_116_TICK(t)
+# define BFI_FLINEARS_115(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_114, v ds
+# define BFI_FLINEARS_115_TICK(t)
+# define BFI_FLINEARS_114(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_113, v ds
+# define BFI_FLINEARS_114_TICK(t)
+# define BFI_FLINEARS_113(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_112, v ds
+# define BFI_FLINEARS_113_TICK(t)
+# define BFI_FLINEARS_112(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_111, v ds
+# define BFI_FLINEARS_112_TICK(t)
+# define BFI_FLINEARS_111(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_110, v ds
+# define BFI_FLINEARS_111_TICK(t)
+# define BFI_FLINEARS_110(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_109, v ds
+# define BFI_FLINEARS_110_TICK(t)
+# define BFI_FLINEARS_109(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_108, v ds
+# define BFI_FLINEARS_109_TICK(t)
+# define BFI_FLINEARS_108(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_107, v ds
+# define BFI_FLINEARS_108_TICK(t)
+# define BFI_FLINEARS_107(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_106, v ds
+# define BFI_FLINEARS_107_TICK(t)
+# define BFI_FLINEARS_106(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_105, v ds
+# define BFI_FLINEARS_106_TICK(t)
+# define BFI_FLINEARS_105(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_104, v ds
+# define BFI_FLINEARS_105_TICK(t)
+# define BFI_FLINEARS_104(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_103, v ds
+# define BFI_FLINEARS_104_TICK(t)
+# define BFI_FLINEARS_103(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_102, v ds
+# define BFI_FLINEARS_103_TICK(t)
+# define BFI_FLINEARS_102(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_101, v ds
+# define BFI_FLINEARS_102_TICK(t)
+# define BFI_FLINEARS_101(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_100, v ds
+# define BFI_FLINEARS_101_TICK(t)
+# define BFI_FLINEARS_100(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_99, v ds
+# define BFI_FLINEARS_100_TICK(t)
+# define BFI_FLINEARS_99(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_98, v ds
+# define BFI_FLINEARS_99_TICK(t)
+# define BFI_FLINEARS_98(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_97, v ds
+# define BFI_FLINEARS_98_TICK(t)
+# define BFI_FLINEARS_97(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_96, v ds
+# define BFI_FLINEARS_97_TICK(t)
+# define BFI_FLINEARS_96(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_95, v ds
+# define BFI_FLINEARS_96_TICK(t)
+# define BFI_FLINEARS_95(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_94, v ds
+# define BFI_FLINEARS_95_TICK(t)
+# define BFI_FLINEARS_94(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_93, v ds
+# define BFI_FLINEARS_94_TICK(t)
+# define BFI_FLINEARS_93(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_92, v ds
+# define BFI_FLINEARS_93_TICK(t)
+# define BFI_FLINEARS_92(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_91, v ds
+# define BFI_FLINEARS_92_TICK(t)
+# define BFI_FLINEARS_91(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_90, v ds
+# define BFI_FLINEARS_91_TICK(t)
+# define BFI_FLINEARS_90(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_89, v ds
+# define BFI_FLINEARS_90_TICK(t)
+# define BFI_FLINEARS_89(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_88, v ds
+# define BFI_FLINEARS_89_TICK(t)
+# define BFI_FLINEARS_88(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_87, v ds
+# define BFI_FLINEARS_88_TICK(t)
+# define BFI_FLINEARS_87(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_86, v ds
+# define BFI_FLINEARS_87_TICK(t)
+# define BFI_FLINEARS_86(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_85, v ds
+# define BFI_FLINEARS_86_TICK(t)
+# define BFI_FLINEARS_85(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_84, v ds
+# define BFI_FLINEARS_85_TICK(t)
+# define BFI_FLINEARS_84(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_83, v ds
+# define BFI_FLINEARS_84_TICK(t)
+# define BFI_FLINEARS_83(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_82, v ds
+# define BFI_FLINEARS_83_TICK(t)
+# define BFI_FLINEARS_82(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_81, v ds
+# define BFI_FLINEARS_82_TICK(t)
+# define BFI_FLINEARS_81(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_80, v ds
+# define BFI_FLINEARS_81_TICK(t)
+# define BFI_FLINEARS_80(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_79, v ds
+# define BFI_FLINEARS_80_TICK(t)
+# define BFI_FLINEARS_79(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_78, v ds
+# define BFI_FLINEARS_79_TICK(t)
+# define BFI_FLINEARS_78(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_77, v ds
+# define BFI_FLINEARS_78_TICK(t)
+# define BFI_FLINEARS_77(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_76, v ds
+# define BFI_FLINEARS_77_TICK(t)
+# define BFI_FLINEARS_76(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_75, v ds
+# define BFI_FLINEARS_76_TICK(t)
+# define BFI_FLINEARS_75(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_74, v ds
+# define BFI_FLINEARS_75_TICK(t)
+# define BFI_FLINEARS_74(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_73, v ds
+# define BFI_FLINEARS_74_TICK(t)
+# define BFI_FLINEARS_73(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_72, v ds
+# define BFI_FLINEARS_73_TICK(t)
+# define BFI_FLINEARS_72(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_71, v ds
+# define BFI_FLINEARS_72_TICK(t)
+# define BFI_FLINEARS_71(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_70, v ds
+# define BFI_FLINEARS_71_TICK(t)
+# define BFI_FLINEARS_70(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_69, v ds
+# define BFI_FLINEARS_70_TICK(t)
+# define BFI_FLINEARS_69(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_68, v ds
+# define BFI_FLINEARS_69_TICK(t)
+# define BFI_FLINEARS_68(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_67, v ds
+# define BFI_FLINEARS_68_TICK(t)
+# define BFI_FLINEARS_67(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_66, v ds
+# define BFI_FLINEARS_67_TICK(t)
+# define BFI_FLINEARS_66(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_65, v ds
+# define BFI_FLINEARS_66_TICK(t)
+# define BFI_FLINEARS_65(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_64, v ds
+# define BFI_FLINEARS_65_TICK(t)
+
+# endif
@@ -0,0 +1,6151 @@
+# ifndef BFI_LINEAR_S_4096_H
+# define BFI_LINEAR_S_4096_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARS_4096(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4095, v ds
+# define BFI_FLINEARS_4096_TICK(t)
+# define BFI_FLINEARS_4095(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4094, v ds
+# define BFI_FLINEARS_4095_TICK(t)
+# define BFI_FLINEARS_4094(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4093, v ds
+# define BFI_FLINEARS_4094_TICK(t)
+# define BFI_FLINEARS_4093(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4092, v ds
+# define BFI_FLINEARS_4093_TICK(t)
+# define BFI_FLINEARS_4092(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4091, v ds
+# define BFI_FLINEARS_4092_TICK(t)
+# define BFI_FLINEARS_4091(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4090, v ds
+# define BFI_FLINEARS_4091_TICK(t)
+# define BFI_FLINEARS_4090(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4089, v ds
+# define BFI_FLINEARS_4090_TICK(t)
+# define BFI_FLINEARS_4089(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4088, v ds
+# define BFI_FLINEARS_4089_TICK(t)
+# define BFI_FLINEARS_4088(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4087, v ds
+# define BFI_FLINEARS_4088_TICK(t)
+# define BFI_FLINEARS_4087(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4086, v ds
+# define BFI_FLINEARS_4087_TICK(t)
+# define BFI_FLINEARS_4086(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4085, v ds
+# define BFI_FLINEARS_4086_TICK(t)
+# define BFI_FLINEARS_4085(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4084, v ds
+# define BFI_FLINEARS_4085_TICK(t)
+# define BFI_FLINEARS_4084(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4083, v ds
+# define BFI_FLINEARS_4084_TICK(t)
+# define BFI_FLINEARS_4083(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4082, v ds
+# define BFI_FLINEARS_4083_TICK(t)
+# define BFI_FLINEARS_4082(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4081, v ds
+# define BFI_FLINEARS_4082_TICK(t)
+# define BFI_FLINEARS_4081(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4080, v ds
+# define BFI_FLINEARS_4081_TICK(t)
+# define BFI_FLINEARS_4080(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4079, v ds
+# define BFI_FLINEARS_4080_TICK(t)
+# define BFI_FLINEARS_4079(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4078, v ds
+# define BFI_FLINEARS_4079_TICK(t)
+# define BFI_FLINEARS_4078(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4077, v ds
+# define BFI_FLINEARS_4078_TICK(t)
+# define BFI_FLINEARS_4077(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4076, v ds
+# define BFI_FLINEARS_4077_TICK(t)
+# define BFI_FLINEARS_4076(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4075, v ds
+# define BFI_FLINEARS_4076_TICK(t)
+# define BFI_FLINEARS_4075(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4074, v ds
+# define BFI_FLINEARS_4075_TICK(t)
+# define BFI_FLINEARS_4074(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4073, v ds
+# define BFI_FLINEARS_4074_TICK(t)
+# define BFI_FLINEARS_4073(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4072, v ds
+# define BFI_FLINEARS_4073_TICK(t)
+# define BFI_FLINEARS_4072(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4071, v ds
+# define BFI_FLINEARS_4072_TICK(t)
+# define BFI_FLINEARS_4071(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4070, v ds
+# define BFI_FLINEARS_4071_TICK(t)
+# define BFI_FLINEARS_4070(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4069, v ds
+# define BFI_FLINEARS_4070_TICK(t)
+# define BFI_FLINEARS_4069(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4068, v ds
+# define BFI_FLINEARS_4069_TICK(t)
+# define BFI_FLINEARS_4068(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4067, v ds
+# define BFI_FLINEARS_4068_TICK(t)
+# define BFI_FLINEARS_4067(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4066, v ds
+# define BFI_FLINEARS_4067_TICK(t)
+# define BFI_FLINEARS_4066(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4065, v ds
+# define BFI_FLINEARS_4066_TICK(t)
+# define BFI_FLINEARS_4065(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4064, v ds
+# define BFI_FLINEARS_4065_TICK(t)
+# define BFI_FLINEARS_4064(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4063, v ds
+# define BFI_FLINEARS_4064_TICK(t)
+# define BFI_FLINEARS_4063(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4062, v ds
+# define BFI_FLINEARS_4063_TICK(t)
+# define BFI_FLINEARS_4062(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4061, v ds
+# define BFI_FLINEARS_4062_TICK(t)
+# define BFI_FLINEARS_4061(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4060, v ds
+# define BFI_FLINEARS_4061_TICK(t)
+# define BFI_FLINEARS_4060(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4059, v ds
+# define BFI_FLINEARS_4060_TICK(t)
+# define BFI_FLINEARS_4059(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4058, v ds
+# define BFI_FLINEARS_4059_TICK(t)
+# define BFI_FLINEARS_4058(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4057, v ds
+# define BFI_FLINEARS_4058_TICK(t)
+# define BFI_FLINEARS_4057(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4056, v ds
+# define BFI_FLINEARS_4057_TICK(t)
+# define BFI_FLINEARS_4056(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4055, v ds
+# define BFI_FLINEARS_4056_TICK(t)
+# define BFI_FLINEARS_4055(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4054, v ds
+# define BFI_FLINEARS_4055_TICK(t)
+# define BFI_FLINEARS_4054(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4053, v ds
+# define BFI_FLINEARS_4054_TICK(t)
+# define BFI_FLINEARS_4053(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4052, v ds
+# define BFI_FLINEARS_4053_TICK(t)
+# define BFI_FLINEARS_4052(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4051, v ds
+# define BFI_FLINEARS_4052_TICK(t)
+# define BFI_FLINEARS_4051(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4050, v ds
+# define BFI_FLINEARS_4051_TICK(t)
+# define BFI_FLINEARS_4050(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4049, v ds
+# define BFI_FLINEARS_4050_TICK(t)
+# define BFI_FLINEARS_4049(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4048, v ds
+# define BFI_FLINEARS_4049_TICK(t)
+# define BFI_FLINEARS_4048(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4047, v ds
+# define BFI_FLINEARS_4048_TICK(t)
+# define BFI_FLINEARS_4047(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4046, v ds
+# define BFI_FLINEARS_4047_TICK(t)
+# define BFI_FLINEARS_4046(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4045, v ds
+# define BFI_FLINEARS_4046_TICK(t)
+# define BFI_FLINEARS_4045(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4044, v ds
+# define BFI_FLINEARS_4045_TICK(t)
+# define BFI_FLINEARS_4044(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4043, v ds
+# define BFI_FLINEARS_4044_TICK(t)
+# define BFI_FLINEARS_4043(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4042, v ds
+# define BFI_FLINEARS_4043_TICK(t)
+# define BFI_FLINEARS_4042(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4041, v ds
+# define BFI_FLINEARS_4042_TICK(t)
+# define BFI_FLINEARS_4041(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4040, v ds
+# define BFI_FLINEARS_4041_TICK(t)
+# define BFI_FLINEARS_4040(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4039, v ds
+# define BFI_FLINEARS_4040_TICK(t)
+# define BFI_FLINEARS_4039(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4038, v ds
+# define BFI_FLINEARS_4039_TICK(t)
+# define BFI_FLINEARS_4038(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4037, v ds
+# define BFI_FLINEARS_4038_TICK(t)
+# define BFI_FLINEARS_4037(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4036, v ds
+# define BFI_FLINEARS_4037_TICK(t)
+# define BFI_FLINEARS_4036(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4035, v ds
+# define BFI_FLINEARS_4036_TICK(t)
+# define BFI_FLINEARS_4035(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4034, v ds
+# define BFI_FLINEARS_4035_TICK(t)
+# define BFI_FLINEARS_4034(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4033, v ds
+# define BFI_FLINEARS_4034_TICK(t)
+# define BFI_FLINEARS_4033(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4032, v ds
+# define BFI_FLINEARS_4033_TICK(t)
+# define BFI_FLINEARS_4032(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4031, v ds
+# define BFI_FLINEARS_4032_TICK(t)
+# define BFI_FLINEARS_4031(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4030, v ds
+# define BFI_FLINEARS_4031_TICK(t)
+# define BFI_FLINEARS_4030(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4029, v ds
+# define BFI_FLINEARS_4030_TICK(t)
+# define BFI_FLINEARS_4029(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4028, v ds
+# define BFI_FLINEARS_4029_TICK(t)
+# define BFI_FLINEARS_4028(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4027, v ds
+# define BFI_FLINEARS_4028_TICK(t)
+# define BFI_FLINEARS_4027(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4026, v ds
+# define BFI_FLINEARS_4027_TICK(t)
+# define BFI_FLINEARS_4026(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4025, v ds
+# define BFI_FLINEARS_4026_TICK(t)
+# define BFI_FLINEARS_4025(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4024, v ds
+# define BFI_FLINEARS_4025_TICK(t)
+# define BFI_FLINEARS_4024(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4023, v ds
+# define BFI_FLINEARS_4024_TICK(t)
+# define BFI_FLINEARS_4023(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4022, v ds
+# define BFI_FLINEARS_4023_TICK(t)
+# define BFI_FLINEARS_4022(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4021, v ds
+# define BFI_FLINEARS_4022_TICK(t)
+# define BFI_FLINEARS_4021(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4020, v ds
+# define BFI_FLINEARS_4021_TICK(t)
+# define BFI_FLINEARS_4020(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4019, v ds
+# define BFI_FLINEARS_4020_TICK(t)
+# define BFI_FLINEARS_4019(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4018, v ds
+# define BFI_FLINEARS_4019_TICK(t)
+# define BFI_FLINEARS_4018(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4017, v ds
+# define BFI_FLINEARS_4018_TICK(t)
+# define BFI_FLINEARS_4017(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4016, v ds
+# define BFI_FLINEARS_4017_TICK(t)
+# define BFI_FLINEARS_4016(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4015, v ds
+# define BFI_FLINEARS_4016_TICK(t)
+# define BFI_FLINEARS_4015(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4014, v ds
+# define BFI_FLINEARS_4015_TICK(t)
+# define BFI_FLINEARS_4014(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4013, v ds
+# define BFI_FLINEARS_4014_TICK(t)
+# define BFI_FLINEARS_4013(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4012, v ds
+# define BFI_FLINEARS_4013_TICK(t)
+# define BFI_FLINEARS_4012(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4011, v ds
+# define BFI_FLINEARS_4012_TICK(t)
+# define BFI_FLINEARS_4011(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4010, v ds
+# define BFI_FLINEARS_4011_TICK(t)
+# define BFI_FLINEARS_4010(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4009, v ds
+# define BFI_FLINEARS_4010_TICK(t)
+# define BFI_FLINEARS_4009(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4008, v ds
+# define BFI_FLINEARS_4009_TICK(t)
+# define BFI_FLINEARS_4008(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4007, v ds
+# define BFI_FLINEARS_4008_TICK(t)
+# define BFI_FLINEARS_4007(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4006, v ds
+# define BFI_FLINEARS_4007_TICK(t)
+# define BFI_FLINEARS_4006(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4005, v ds
+# define BFI_FLINEARS_4006_TICK(t)
+# define BFI_FLINEARS_4005(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4004, v ds
+# define BFI_FLINEARS_4005_TICK(t)
+# define BFI_FLINEARS_4004(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4003, v ds
+# define BFI_FLINEARS_4004_TICK(t)
+# define BFI_FLINEARS_4003(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4002, v ds
+# define BFI_FLINEARS_4003_TICK(t)
+# define BFI_FLINEARS_4002(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4001, v ds
+# define BFI_FLINEARS_4002_TICK(t)
+# define BFI_FLINEARS_4001(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4000, v ds
+# define BFI_FLINEARS_4001_TICK(t)
+# define BFI_FLINEARS_4000(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3999, v ds
+# define BFI_FLINEARS_4000_TICK(t)
+# define BFI_FLINEARS_3999(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3998, v ds
+# define BFI_FLINEARS_3999_TICK(t)
+# define BFI_FLINEARS_3998(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3997, v ds
+# define BFI_FLINEARS_3998_TICK(t)
+# define BFI_FLINEARS_3997(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3996, v ds
+# define BFI_FLINEARS_3997_TICK(t)
+# define BFI_FLINEARS_3996(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3995, v ds
+# define BFI_FLINEARS_3996_TICK(t)
+# define BFI_FLINEARS_3995(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3994, v ds
+# define BFI_FLINEARS_3995_TICK(t)
+# define BFI_FLINEARS_3994(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3993, v ds
+# define BFI_FLINEARS_3994_TICK(t)
+# define BFI_FLINEARS_3993(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3992, v ds
+# define BFI_FLINEARS_3993_TICK(t)
+# define BFI_FLINEARS_3992(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3991, v ds
+# define BFI_FLINEARS_3992_TICK(t)
+# define BFI_FLINEARS_3991(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3990, v ds
+# define BFI_FLINEARS_3991_TICK(t)
+# define BFI_FLINEARS_3990(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3989, v ds
+# define BFI_FLINEARS_3990_TICK(t)
+# define BFI_FLINEARS_3989(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3988, v ds
+# define BFI_FLINEARS_3989_TICK(t)
+# define BFI_FLINEARS_3988(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3987, v ds
+# define BFI_FLINEARS_3988_TICK(t)
+# define BFI_FLINEARS_3987(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3986, v ds
+# define BFI_FLINEARS_3987_TICK(t)
+# define BFI_FLINEARS_3986(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3985, v ds
+# define BFI_FLINEARS_3986_TICK(t)
+# define BFI_FLINEARS_3985(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3984, v ds
+# define BFI_FLINEARS_3985_TICK(t)
+# define BFI_FLINEARS_3984(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3983, v ds
+# define BFI_FLINEARS_3984_TICK(t)
+# define BFI_FLINEARS_3983(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3982, v ds
+# define BFI_FLINEARS_3983_TICK(t)
+# define BFI_FLINEARS_3982(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3981, v ds
+# define BFI_FLINEARS_3982_TICK(t)
+# define BFI_FLINEARS_3981(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3980, v ds
+# define BFI_FLINEARS_3981_TICK(t)
+# define BFI_FLINEARS_3980(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3979, v ds
+# define BFI_FLINEARS_3980_TICK(t)
+# define BFI_FLINEARS_3979(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3978, v ds
+# define BFI_FLINEARS_3979_TICK(t)
+# define BFI_FLINEARS_3978(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3977, v ds
+# define BFI_FLINEARS_3978_TICK(t)
+# define BFI_FLINEARS_3977(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3976, v ds
+# define BFI_FLINEARS_3977_TICK(t)
+# define BFI_FLINEARS_3976(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3975, v ds
+# define BFI_FLINEARS_3976_TICK(t)
+# define BFI_FLINEARS_3975(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3974, v ds
+# define BFI_FLINEARS_3975_TICK(t)
+# define BFI_FLINEARS_3974(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3973, v ds
+# define BFI_FLINEARS_3974_TICK(t)
+# define BFI_FLINEARS_3973(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3972, v ds
+# define BFI_FLINEARS_3973_TICK(t)
+# define BFI_FLINEARS_3972(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3971, v ds
+# define BFI_FLINEARS_3972_TICK(t)
+# define BFI_FLINEARS_3971(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3970, v ds
+# define BFI_FLINEARS_3971_TICK(t)
+# define BFI_FLINEARS_3970(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3969, v ds
+# define BFI_FLINEARS_3970_TICK(t)
+# define BFI_FLINEARS_3969(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3968, v ds
+# define BFI_FLINEARS_3969_TICK(t)
+# define BFI_FLINEARS_3968(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3967, v ds
+# define BFI_FLINEARS_3968_TICK(t)
+# define BFI_FLINEARS_3967(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3966, v ds
+# define BFI_FLINEARS_3967_TICK(t)
+# define BFI_FLINEARS_3966(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3965, v ds
+# define BFI_FLINEARS_3966_TICK(t)
+# define BFI_FLINEARS_3965(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3964, v ds
+# define BFI_FLINEARS_3965_TICK(t)
+# define BFI_FLINEARS_3964(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3963, v ds
+# define BFI_FLINEARS_3964_TICK(t)
+# define BFI_FLINEARS_3963(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3962, v ds
+# define BFI_FLINEARS_3963_TICK(t)
+# define BFI_FLINEARS_3962(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3961, v ds
+# define BFI_FLINEARS_3962_TICK(t)
+# define BFI_FLINEARS_3961(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3960, v ds
+# define BFI_FLINEARS_3961_TICK(t)
+# define BFI_FLINEARS_3960(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3959, v ds
+# define BFI_FLINEARS_3960_TICK(t)
+# define BFI_FLINEARS_3959(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3958, v ds
+# define BFI_FLINEARS_3959_TICK(t)
+# define BFI_FLINEARS_3958(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3957, v ds
+# define BFI_FLINEARS_3958_TICK(t)
+# define BFI_FLINEARS_3957(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3956, v ds
+# define BFI_FLINEARS_3957_TICK(t)
+# define BFI_FLINEARS_3956(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3955, v ds
+# define BFI_FLINEARS_3956_TICK(t)
+# define BFI_FLINEARS_3955(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3954, v ds
+# define BFI_FLINEARS_3955_TICK(t)
+# define BFI_FLINEARS_3954(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3953, v ds
+# define BFI_FLINEARS_3954_TICK(t)
+# define BFI_FLINEARS_3953(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3952, v ds
+# define BFI_FLINEARS_3953_TICK(t)
+# define BFI_FLINEARS_3952(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3951, v ds
+# define BFI_FLINEARS_3952_TICK(t)
+# define BFI_FLINEARS_3951(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3950, v ds
+# define BFI_FLINEARS_3951_TICK(t)
+# define BFI_FLINEARS_3950(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3949, v ds
+# define BFI_FLINEARS_3950_TICK(t)
+# define BFI_FLINEARS_3949(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3948, v ds
+# define BFI_FLINEARS_3949_TICK(t)
+# define BFI_FLINEARS_3948(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3947, v ds
+# define BFI_FLINEARS_3948_TICK(t)
+# define BFI_FLINEARS_3947(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3946, v ds
+# define BFI_FLINEARS_3947_TICK(t)
+# define BFI_FLINEARS_3946(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3945, v ds
+# define BFI_FLINEARS_3946_TICK(t)
+# define BFI_FLINEARS_3945(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3944, v ds
+# define BFI_FLINEARS_3945_TICK(t)
+# define BFI_FLINEARS_3944(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3943, v ds
+# define BFI_FLINEARS_3944_TICK(t)
+# define BFI_FLINEARS_3943(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3942, v ds
+# define BFI_FLINEARS_3943_TICK(t)
+# define BFI_FLINEARS_3942(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3941, v ds
+# define BFI_FLINEARS_3942_TICK(t)
+# define BFI_FLINEARS_3941(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3940, v ds
+# define BFI_FLINEARS_3941_TICK(t)
+# define BFI_FLINEARS_3940(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3939, v ds
+# define BFI_FLINEARS_3940_TICK(t)
+# define BFI_FLINEARS_3939(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3938, v ds
+# define BFI_FLINEARS_3939_TICK(t)
+# define BFI_FLINEARS_3938(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3937, v ds
+# define BFI_FLINEARS_3938_TICK(t)
+# define BFI_FLINEARS_3937(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3936, v ds
+# define BFI_FLINEARS_3937_TICK(t)
+# define BFI_FLINEARS_3936(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3935, v ds
+# define BFI_FLINEARS_3936_TICK(t)
+# define BFI_FLINEARS_3935(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3934, v ds
+# define BFI_FLINEARS_3935_TICK(t)
+# define BFI_FLINEARS_3934(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3933, v ds
+# define BFI_FLINEARS_3934_TICK(t)
+# define BFI_FLINEARS_3933(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3932, v ds
+# define BFI_FLINEARS_3933_TICK(t)
+# define BFI_FLINEARS_3932(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3931, v ds
+# define BFI_FLINEARS_3932_TICK(t)
+# define BFI_FLINEARS_3931(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3930, v ds
+# define BFI_FLINEARS_3931_TICK(t)
+# define BFI_FLINEARS_3930(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3929, v ds
+# define BFI_FLINEARS_3930_TICK(t)
+# define BFI_FLINEARS_3929(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3928, v ds
+# define BFI_FLINEARS_3929_TICK(t)
+# define BFI_FLINEARS_3928(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3927, v ds
+# define BFI_FLINEARS_3928_TICK(t)
+# define BFI_FLINEARS_3927(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3926, v ds
+# define BFI_FLINEARS_3927_TICK(t)
+# define BFI_FLINEARS_3926(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3925, v ds
+# define BFI_FLINEARS_3926_TICK(t)
+# define BFI_FLINEARS_3925(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3924, v ds
+# define BFI_FLINEARS_3925_TICK(t)
+# define BFI_FLINEARS_3924(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3923, v ds
+# define BFI_FLINEARS_3924_TICK(t)
+# define BFI_FLINEARS_3923(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3922, v ds
+# define BFI_FLINEARS_3923_TICK(t)
+# define BFI_FLINEARS_3922(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3921, v ds
+# define BFI_FLINEARS_3922_TICK(t)
+# define BFI_FLINEARS_3921(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3920, v ds
+# define BFI_FLINEARS_3921_TICK(t)
+# define BFI_FLINEARS_3920(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3919, v ds
+# define BFI_FLINEARS_3920_TICK(t)
+# define BFI_FLINEARS_3919(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3918, v ds
+# define BFI_FLINEARS_3919_TICK(t)
+# define BFI_FLINEARS_3918(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3917, v ds
+# define BFI_FLINEARS_3918_TICK(t)
+# define BFI_FLINEARS_3917(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3916, v ds
+# define BFI_FLINEARS_3917_TICK(t)
+# define BFI_FLINEARS_3916(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3915, v ds
+# define BFI_FLINEARS_3916_TICK(t)
+# define BFI_FLINEARS_3915(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3914, v ds
+# define BFI_FLINEARS_3915_TICK(t)
+# define BFI_FLINEARS_3914(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3913, v ds
+# define BFI_FLINEARS_3914_TICK(t)
+# define BFI_FLINEARS_3913(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3912, v ds
+# define BFI_FLINEARS_3913_TICK(t)
+# define BFI_FLINEARS_3912(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3911, v ds
+# define BFI_FLINEARS_3912_TICK(t)
+# define BFI_FLINEARS_3911(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3910, v ds
+# define BFI_FLINEARS_3911_TICK(t)
+# define BFI_FLINEARS_3910(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3909, v ds
+# define BFI_FLINEARS_3910_TICK(t)
+# define BFI_FLINEARS_3909(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3908, v ds
+# define BFI_FLINEARS_3909_TICK(t)
+# define BFI_FLINEARS_3908(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3907, v ds
+# define BFI_FLINEARS_3908_TICK(t)
+# define BFI_FLINEARS_3907(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3906, v ds
+# define BFI_FLINEARS_3907_TICK(t)
+# define BFI_FLINEARS_3906(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3905, v ds
+# define BFI_FLINEARS_3906_TICK(t)
+# define BFI_FLINEARS_3905(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3904, v ds
+# define BFI_FLINEARS_3905_TICK(t)
+# define BFI_FLINEARS_3904(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3903, v ds
+# define BFI_FLINEARS_3904_TICK(t)
+# define BFI_FLINEARS_3903(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3902, v ds
+# define BFI_FLINEARS_3903_TICK(t)
+# define BFI_FLINEARS_3902(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3901, v ds
+# define BFI_FLINEARS_3902_TICK(t)
+# define BFI_FLINEARS_3901(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3900, v ds
+# define BFI_FLINEARS_3901_TICK(t)
+# define BFI_FLINEARS_3900(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3899, v ds
+# define BFI_FLINEARS_3900_TICK(t)
+# define BFI_FLINEARS_3899(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3898, v ds
+# define BFI_FLINEARS_3899_TICK(t)
+# define BFI_FLINEARS_3898(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3897, v ds
+# define BFI_FLINEARS_3898_TICK(t)
+# define BFI_FLINEARS_3897(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3896, v ds
+# define BFI_FLINEARS_3897_TICK(t)
+# define BFI_FLINEARS_3896(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3895, v ds
+# define BFI_FLINEARS_3896_TICK(t)
+# define BFI_FLINEARS_3895(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3894, v ds
+# define BFI_FLINEARS_3895_TICK(t)
+# define BFI_FLINEARS_3894(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3893, v ds
+# define BFI_FLINEARS_3894_TICK(t)
+# define BFI_FLINEARS_3893(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3892, v ds
+# define BFI_FLINEARS_3893_TICK(t)
+# define BFI_FLINEARS_3892(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3891, v ds
+# define BFI_FLINEARS_3892_TICK(t)
+# define BFI_FLINEARS_3891(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3890, v ds
+# define BFI_FLINEARS_3891_TICK(t)
+# define BFI_FLINEARS_3890(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3889, v ds
+# define BFI_FLINEARS_3890_TICK(t)
+# define BFI_FLINEARS_3889(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3888, v ds
+# define BFI_FLINEARS_3889_TICK(t)
+# define BFI_FLINEARS_3888(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3887, v ds
+# define BFI_FLINEARS_3888_TICK(t)
+# define BFI_FLINEARS_3887(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3886, v ds
+# define BFI_FLINEARS_3887_TICK(t)
+# define BFI_FLINEARS_3886(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3885, v ds
+# define BFI_FLINEARS_3886_TICK(t)
+# define BFI_FLINEARS_3885(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3884, v ds
+# define BFI_FLINEARS_3885_TICK(t)
+# define BFI_FLINEARS_3884(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3883, v ds
+# define BFI_FLINEARS_3884_TICK(t)
+# define BFI_FLINEARS_3883(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3882, v ds
+# define BFI_FLINEARS_3883_TICK(t)
+# define BFI_FLINEARS_3882(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3881, v ds
+# define BFI_FLINEARS_3882_TICK(t)
+# define BFI_FLINEARS_3881(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3880, v ds
+# define BFI_FLINEARS_3881_TICK(t)
+# define BFI_FLINEARS_3880(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3879, v ds
+# define BFI_FLINEARS_3880_TICK(t)
+# define BFI_FLINEARS_3879(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3878, v ds
+# define BFI_FLINEARS_3879_TICK(t)
+# define BFI_FLINEARS_3878(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3877, v ds
+# define BFI_FLINEARS_3878_TICK(t)
+# define BFI_FLINEARS_3877(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3876, v ds
+# define BFI_FLINEARS_3877_TICK(t)
+# define BFI_FLINEARS_3876(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3875, v ds
+# define BFI_FLINEARS_3876_TICK(t)
+# define BFI_FLINEARS_3875(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3874, v ds
+# define BFI_FLINEARS_3875_TICK(t)
+# define BFI_FLINEARS_3874(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3873, v ds
+# define BFI_FLINEARS_3874_TICK(t)
+# define BFI_FLINEARS_3873(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3872, v ds
+# define BFI_FLINEARS_3873_TICK(t)
+# define BFI_FLINEARS_3872(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3871, v ds
+# define BFI_FLINEARS_3872_TICK(t)
+# define BFI_FLINEARS_3871(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3870, v ds
+# define BFI_FLINEARS_3871_TICK(t)
+# define BFI_FLINEARS_3870(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3869, v ds
+# define BFI_FLINEARS_3870_TICK(t)
+# define BFI_FLINEARS_3869(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3868, v ds
+# define BFI_FLINEARS_3869_TICK(t)
+# define BFI_FLINEARS_3868(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3867, v ds
+# define BFI_FLINEARS_3868_TICK(t)
+# define BFI_FLINEARS_3867(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3866, v ds
+# define BFI_FLINEARS_3867_TICK(t)
+# define BFI_FLINEARS_3866(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3865, v ds
+# define BFI_FLINEARS_3866_TICK(t)
+# define BFI_FLINEARS_3865(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3864, v ds
+# define BFI_FLINEARS_3865_TICK(t)
+# define BFI_FLINEARS_3864(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3863, v ds
+# define BFI_FLINEARS_3864_TICK(t)
+# define BFI_FLINEARS_3863(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3862, v ds
+# define BFI_FLINEARS_3863_TICK(t)
+# define BFI_FLINEARS_3862(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3861, v ds
+# define BFI_FLINEARS_3862_TICK(t)
+# define BFI_FLINEARS_3861(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3860, v ds
+# define BFI_FLINEARS_3861_TICK(t)
+# define BFI_FLINEARS_3860(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3859, v ds
+# define BFI_FLINEARS_3860_TICK(t)
+# define BFI_FLINEARS_3859(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3858, v ds
+# define BFI_FLINEARS_3859_TICK(t)
+# define BFI_FLINEARS_3858(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3857, v ds
+# define BFI_FLINEARS_3858_TICK(t)
+# define BFI_FLINEARS_3857(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3856, v ds
+# define BFI_FLINEARS_3857_TICK(t)
+# define BFI_FLINEARS_3856(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3855, v ds
+# define BFI_FLINEARS_3856_TICK(t)
+# define BFI_FLINEARS_3855(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3854, v ds
+# define BFI_FLINEARS_3855_TICK(t)
+# define BFI_FLINEARS_3854(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3853, v ds
+# define BFI_FLINEARS_3854_TICK(t)
+# define BFI_FLINEARS_3853(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3852, v ds
+# define BFI_FLINEARS_3853_TICK(t)
+# define BFI_FLINEARS_3852(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3851, v ds
+# define BFI_FLINEARS_3852_TICK(t)
+# define BFI_FLINEARS_3851(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3850, v ds
+# define BFI_FLINEARS_3851_TICK(t)
+# define BFI_FLINEARS_3850(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3849, v ds
+# define BFI_FLINEARS_3850_TICK(t)
+# define BFI_FLINEARS_3849(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3848, v ds
+# define BFI_FLINEARS_3849_TICK(t)
+# define BFI_FLINEARS_3848(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3847, v ds
+# define BFI_FLINEARS_3848_TICK(t)
+# define BFI_FLINEARS_3847(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3846, v ds
+# define BFI_FLINEARS_3847_TICK(t)
+# define BFI_FLINEARS_3846(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3845, v ds
+# define BFI_FLINEARS_3846_TICK(t)
+# define BFI_FLINEARS_3845(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3844, v ds
+# define BFI_FLINEARS_3845_TICK(t)
+# define BFI_FLINEARS_3844(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3843, v ds
+# define BFI_FLINEARS_3844_TICK(t)
+# define BFI_FLINEARS_3843(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3842, v ds
+# define BFI_FLINEARS_3843_TICK(t)
+# define BFI_FLINEARS_3842(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3841, v ds
+# define BFI_FLINEARS_3842_TICK(t)
+# define BFI_FLINEARS_3841(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3840, v ds
+# define BFI_FLINEARS_3841_TICK(t)
+# define BFI_FLINEARS_3840(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3839, v ds
+# define BFI_FLINEARS_3840_TICK(t)
+# define BFI_FLINEARS_3839(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3838, v ds
+# define BFI_FLINEARS_3839_TICK(t)
+# define BFI_FLINEARS_3838(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3837, v ds
+# define BFI_FLINEARS_3838_TICK(t)
+# define BFI_FLINEARS_3837(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3836, v ds
+# define BFI_FLINEARS_3837_TICK(t)
+# define BFI_FLINEARS_3836(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3835, v ds
+# define BFI_FLINEARS_3836_TICK(t)
+# define BFI_FLINEARS_3835(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3834, v ds
+# define BFI_FLINEARS_3835_TICK(t)
+# define BFI_FLINEARS_3834(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3833, v ds
+# define BFI_FLINEARS_3834_TICK(t)
+# define BFI_FLINEARS_3833(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3832, v ds
+# define BFI_FLINEARS_3833_TICK(t)
+# define BFI_FLINEARS_3832(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3831, v ds
+# define BFI_FLINEARS_3832_TICK(t)
+# define BFI_FLINEARS_3831(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3830, v ds
+# define BFI_FLINEARS_3831_TICK(t)
+# define BFI_FLINEARS_3830(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3829, v ds
+# define BFI_FLINEARS_3830_TICK(t)
+# define BFI_FLINEARS_3829(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3828, v ds
+# define BFI_FLINEARS_3829_TICK(t)
+# define BFI_FLINEARS_3828(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3827, v ds
+# define BFI_FLINEARS_3828_TICK(t)
+# define BFI_FLINEARS_3827(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3826, v ds
+# define BFI_FLINEARS_3827_TICK(t)
+# define BFI_FLINEARS_3826(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3825, v ds
+# define BFI_FLINEARS_3826_TICK(t)
+# define BFI_FLINEARS_3825(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3824, v ds
+# define BFI_FLINEARS_3825_TICK(t)
+# define BFI_FLINEARS_3824(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3823, v ds
+# define BFI_FLINEARS_3824_TICK(t)
+# define BFI_FLINEARS_3823(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3822, v ds
+# define BFI_FLINEARS_3823_TICK(t)
+# define BFI_FLINEARS_3822(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3821, v ds
+# define BFI_FLINEARS_3822_TICK(t)
+# define BFI_FLINEARS_3821(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3820, v ds
+# define BFI_FLINEARS_3821_TICK(t)
+# define BFI_FLINEARS_3820(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3819, v ds
+# define BFI_FLINEARS_3820_TICK(t)
+# define BFI_FLINEARS_3819(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3818, v ds
+# define BFI_FLINEARS_3819_TICK(t)
+# define BFI_FLINEARS_3818(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3817, v ds
+# define BFI_FLINEARS_3818_TICK(t)
+# define BFI_FLINEARS_3817(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3816, v ds
+# define BFI_FLINEARS_3817_TICK(t)
+# define BFI_FLINEARS_3816(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3815, v ds
+# define BFI_FLINEARS_3816_TICK(t)
+# define BFI_FLINEARS_3815(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3814, v ds
+# define BFI_FLINEARS_3815_TICK(t)
+# define BFI_FLINEARS_3814(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3813, v ds
+# define BFI_FLINEARS_3814_TICK(t)
+# define BFI_FLINEARS_3813(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3812, v ds
+# define BFI_FLINEARS_3813_TICK(t)
+# define BFI_FLINEARS_3812(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3811, v ds
+# define BFI_FLINEARS_3812_TICK(t)
+# define BFI_FLINEARS_3811(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3810, v ds
+# define BFI_FLINEARS_3811_TICK(t)
+# define BFI_FLINEARS_3810(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3809, v ds
+# define BFI_FLINEARS_3810_TICK(t)
+# define BFI_FLINEARS_3809(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3808, v ds
+# define BFI_FLINEARS_3809_TICK(t)
+# define BFI_FLINEARS_3808(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3807, v ds
+# define BFI_FLINEARS_3808_TICK(t)
+# define BFI_FLINEARS_3807(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3806, v ds
+# define BFI_FLINEARS_3807_TICK(t)
+# define BFI_FLINEARS_3806(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3805, v ds
+# define BFI_FLINEARS_3806_TICK(t)
+# define BFI_FLINEARS_3805(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3804, v ds
+# define BFI_FLINEARS_3805_TICK(t)
+# define BFI_FLINEARS_3804(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3803, v ds
+# define BFI_FLINEARS_3804_TICK(t)
+# define BFI_FLINEARS_3803(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3802, v ds
+# define BFI_FLINEARS_3803_TICK(t)
+# define BFI_FLINEARS_3802(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3801, v ds
+# define BFI_FLINEARS_3802_TICK(t)
+# define BFI_FLINEARS_3801(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3800, v ds
+# define BFI_FLINEARS_3801_TICK(t)
+# define BFI_FLINEARS_3800(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3799, v ds
+# define BFI_FLINEARS_3800_TICK(t)
+# define BFI_FLINEARS_3799(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3798, v ds
+# define BFI_FLINEARS_3799_TICK(t)
+# define BFI_FLINEARS_3798(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3797, v ds
+# define BFI_FLINEARS_3798_TICK(t)
+# define BFI_FLINEARS_3797(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3796, v ds
+# define BFI_FLINEARS_3797_TICK(t)
+# define BFI_FLINEARS_3796(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3795, v ds
+# define BFI_FLINEARS_3796_TICK(t)
+# define BFI_FLINEARS_3795(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3794, v ds
+# define BFI_FLINEARS_3795_TICK(t)
+# define BFI_FLINEARS_3794(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3793, v ds
+# define BFI_FLINEARS_3794_TICK(t)
+# define BFI_FLINEARS_3793(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3792, v ds
+# define BFI_FLINEARS_3793_TICK(t)
+# define BFI_FLINEARS_3792(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3791, v ds
+# define BFI_FLINEARS_3792_TICK(t)
+# define BFI_FLINEARS_3791(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3790, v ds
+# define BFI_FLINEARS_3791_TICK(t)
+# define BFI_FLINEARS_3790(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3789, v ds
+# define BFI_FLINEARS_3790_TICK(t)
+# define BFI_FLINEARS_3789(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3788, v ds
+# define BFI_FLINEARS_3789_TICK(t)
+# define BFI_FLINEARS_3788(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3787, v ds
+# define BFI_FLINEARS_3788_TICK(t)
+# define BFI_FLINEARS_3787(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3786, v ds
+# define BFI_FLINEARS_3787_TICK(t)
+# define BFI_FLINEARS_3786(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3785, v ds
+# define BFI_FLINEARS_3786_TICK(t)
+# define BFI_FLINEARS_3785(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3784, v ds
+# define BFI_FLINEARS_3785_TICK(t)
+# define BFI_FLINEARS_3784(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3783, v ds
+# define BFI_FLINEARS_3784_TICK(t)
+# define BFI_FLINEARS_3783(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3782, v ds
+# define BFI_FLINEARS_3783_TICK(t)
+# define BFI_FLINEARS_3782(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3781, v ds
+# define BFI_FLINEARS_3782_TICK(t)
+# define BFI_FLINEARS_3781(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3780, v ds
+# define BFI_FLINEARS_3781_TICK(t)
+# define BFI_FLINEARS_3780(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3779, v ds
+# define BFI_FLINEARS_3780_TICK(t)
+# define BFI_FLINEARS_3779(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3778, v ds
+# define BFI_FLINEARS_3779_TICK(t)
+# define BFI_FLINEARS_3778(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3777, v ds
+# define BFI_FLINEARS_3778_TICK(t)
+# define BFI_FLINEARS_3777(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3776, v ds
+# define BFI_FLINEARS_3777_TICK(t)
+# define BFI_FLINEARS_3776(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3775, v ds
+# define BFI_FLINEARS_3776_TICK(t)
+# define BFI_FLINEARS_3775(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3774, v ds
+# define BFI_FLINEARS_3775_TICK(t)
+# define BFI_FLINEARS_3774(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3773, v ds
+# define BFI_FLINEARS_3774_TICK(t)
+# define BFI_FLINEARS_3773(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3772, v ds
+# define BFI_FLINEARS_3773_TICK(t)
+# define BFI_FLINEARS_3772(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3771, v ds
+# define BFI_FLINEARS_3772_TICK(t)
+# define BFI_FLINEARS_3771(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3770, v ds
+# define BFI_FLINEARS_3771_TICK(t)
+# define BFI_FLINEARS_3770(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3769, v ds
+# define BFI_FLINEARS_3770_TICK(t)
+# define BFI_FLINEARS_3769(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3768, v ds
+# define BFI_FLINEARS_3769_TICK(t)
+# define BFI_FLINEARS_3768(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3767, v ds
+# define BFI_FLINEARS_3768_TICK(t)
+# define BFI_FLINEARS_3767(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3766, v ds
+# define BFI_FLINEARS_3767_TICK(t)
+# define BFI_FLINEARS_3766(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3765, v ds
+# define BFI_FLINEARS_3766_TICK(t)
+# define BFI_FLINEARS_3765(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3764, v ds
+# define BFI_FLINEARS_3765_TICK(t)
+# define BFI_FLINEARS_3764(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3763, v ds
+# define BFI_FLINEARS_3764_TICK(t)
+# define BFI_FLINEARS_3763(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3762, v ds
+# define BFI_FLINEARS_3763_TICK(t)
+# define BFI_FLINEARS_3762(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3761, v ds
+# define BFI_FLINEARS_3762_TICK(t)
+# define BFI_FLINEARS_3761(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3760, v ds
+# define BFI_FLINEARS_3761_TICK(t)
+# define BFI_FLINEARS_3760(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3759, v ds
+# define BFI_FLINEARS_3760_TICK(t)
+# define BFI_FLINEARS_3759(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3758, v ds
+# define BFI_FLINEARS_3759_TICK(t)
+# define BFI_FLINEARS_3758(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3757, v ds
+# define BFI_FLINEARS_3758_TICK(t)
+# define BFI_FLINEARS_3757(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3756, v ds
+# define BFI_FLINEARS_3757_TICK(t)
+# define BFI_FLINEARS_3756(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3755, v ds
+# define BFI_FLINEARS_3756_TICK(t)
+# define BFI_FLINEARS_3755(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3754, v ds
+# define BFI_FLINEARS_3755_TICK(t)
+# define BFI_FLINEARS_3754(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3753, v ds
+# define BFI_FLINEARS_3754_TICK(t)
+# define BFI_FLINEARS_3753(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3752, v ds
+# define BFI_FLINEARS_3753_TICK(t)
+# define BFI_FLINEARS_3752(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3751, v ds
+# define BFI_FLINEARS_3752_TICK(t)
+# define BFI_FLINEARS_3751(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3750, v ds
+# define BFI_FLINEARS_3751_TICK(t)
+# define BFI_FLINEARS_3750(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3749, v ds
+# define BFI_FLINEARS_3750_TICK(t)
+# define BFI_FLINEARS_3749(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3748, v ds
+# define BFI_FLINEARS_3749_TICK(t)
+# define BFI_FLINEARS_3748(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3747, v ds
+# define BFI_FLINEARS_3748_TICK(t)
+# define BFI_FLINEARS_3747(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3746, v ds
+# define BFI_FLINEARS_3747_TICK(t)
+# define BFI_FLINEARS_3746(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3745, v ds
+# define BFI_FLINEARS_3746_TICK(t)
+# define BFI_FLINEARS_3745(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3744, v ds
+# define BFI_FLINEARS_3745_TICK(t)
+# define BFI_FLINEARS_3744(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3743, v ds
+# define BFI_FLINEARS_3744_TICK(t)
+# define BFI_FLINEARS_3743(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3742, v ds
+# define BFI_FLINEARS_3743_TICK(t)
+# define BFI_FLINEARS_3742(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3741, v ds
+# define BFI_FLINEARS_3742_TICK(t)
+# define BFI_FLINEARS_3741(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3740, v ds
+# define BFI_FLINEARS_3741_TICK(t)
+# define BFI_FLINEARS_3740(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3739, v ds
+# define BFI_FLINEARS_3740_TICK(t)
+# define BFI_FLINEARS_3739(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3738, v ds
+# define BFI_FLINEARS_3739_TICK(t)
+# define BFI_FLINEARS_3738(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3737, v ds
+# define BFI_FLINEARS_3738_TICK(t)
+# define BFI_FLINEARS_3737(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3736, v ds
+# define BFI_FLINEARS_3737_TICK(t)
+# define BFI_FLINEARS_3736(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3735, v ds
+# define BFI_FLINEARS_3736_TICK(t)
+# define BFI_FLINEARS_3735(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3734, v ds
+# define BFI_FLINEARS_3735_TICK(t)
+# define BFI_FLINEARS_3734(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3733, v ds
+# define BFI_FLINEARS_3734_TICK(t)
+# define BFI_FLINEARS_3733(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3732, v ds
+# define BFI_FLINEARS_3733_TICK(t)
+# define BFI_FLINEARS_3732(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3731, v ds
+# define BFI_FLINEARS_3732_TICK(t)
+# define BFI_FLINEARS_3731(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3730, v ds
+# define BFI_FLINEARS_3731_TICK(t)
+# define BFI_FLINEARS_3730(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3729, v ds
+# define BFI_FLINEARS_3730_TICK(t)
+# define BFI_FLINEARS_3729(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3728, v ds
+# define BFI_FLINEARS_3729_TICK(t)
+# define BFI_FLINEARS_3728(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3727, v ds
+# define BFI_FLINEARS_3728_TICK(t)
+# define BFI_FLINEARS_3727(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3726, v ds
+# define BFI_FLINEARS_3727_TICK(t)
+# define BFI_FLINEARS_3726(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3725, v ds
+# define BFI_FLINEARS_3726_TICK(t)
+# define BFI_FLINEARS_3725(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3724, v ds
+# define BFI_FLINEARS_3725_TICK(t)
+# define BFI_FLINEARS_3724(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3723, v ds
+# define BFI_FLINEARS_3724_TICK(t)
+# define BFI_FLINEARS_3723(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3722, v ds
+# define BFI_FLINEARS_3723_TICK(t)
+# define BFI_FLINEARS_3722(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3721, v ds
+# define BFI_FLINEARS_3722_TICK(t)
+# define BFI_FLINEARS_3721(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3720, v ds
+# define BFI_FLINEARS_3721_TICK(t)
+# define BFI_FLINEARS_3720(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3719, v ds
+# define BFI_FLINEARS_3720_TICK(t)
+# define BFI_FLINEARS_3719(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3718, v ds
+# define BFI_FLINEARS_3719_TICK(t)
+# define BFI_FLINEARS_3718(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3717, v ds
+# define BFI_FLINEARS_3718_TICK(t)
+# define BFI_FLINEARS_3717(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3716, v ds
+# define BFI_FLINEARS_3717_TICK(t)
+# define BFI_FLINEARS_3716(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3715, v ds
+# define BFI_FLINEARS_3716_TICK(t)
+# define BFI_FLINEARS_3715(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3714, v ds
+# define BFI_FLINEARS_3715_TICK(t)
+# define BFI_FLINEARS_3714(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3713, v ds
+# define BFI_FLINEARS_3714_TICK(t)
+# define BFI_FLINEARS_3713(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3712, v ds
+# define BFI_FLINEARS_3713_TICK(t)
+# define BFI_FLINEARS_3712(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3711, v ds
+# define BFI_FLINEARS_3712_TICK(t)
+# define BFI_FLINEARS_3711(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3710, v ds
+# define BFI_FLINEARS_3711_TICK(t)
+# define BFI_FLINEARS_3710(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3709, v ds
+# define BFI_FLINEARS_3710_TICK(t)
+# define BFI_FLINEARS_3709(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3708, v ds
+# define BFI_FLINEARS_3709_TICK(t)
+# define BFI_FLINEARS_3708(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3707, v ds
+# define BFI_FLINEARS_3708_TICK(t)
+# define BFI_FLINEARS_3707(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3706, v ds
+# define BFI_FLINEARS_3707_TICK(t)
+# define BFI_FLINEARS_3706(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3705, v ds
+# define BFI_FLINEARS_3706_TICK(t)
+# define BFI_FLINEARS_3705(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3704, v ds
+# define BFI_FLINEARS_3705_TICK(t)
+# define BFI_FLINEARS_3704(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3703, v ds
+# define BFI_FLINEARS_3704_TICK(t)
+# define BFI_FLINEARS_3703(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3702, v ds
+# define BFI_FLINEARS_3703_TICK(t)
+# define BFI_FLINEARS_3702(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3701, v ds
+# define BFI_FLINEARS_3702_TICK(t)
+# define BFI_FLINEARS_3701(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3700, v ds
+# define BFI_FLINEARS_3701_TICK(t)
+# define BFI_FLINEARS_3700(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3699, v ds
+# define BFI_FLINEARS_3700_TICK(t)
+# define BFI_FLINEARS_3699(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3698, v ds
+# define BFI_FLINEARS_3699_TICK(t)
+# define BFI_FLINEARS_3698(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3697, v ds
+# define BFI_FLINEARS_3698_TICK(t)
+# define BFI_FLINEARS_3697(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3696, v ds
+# define BFI_FLINEARS_3697_TICK(t)
+# define BFI_FLINEARS_3696(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3695, v ds
+# define BFI_FLINEARS_3696_TICK(t)
+# define BFI_FLINEARS_3695(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3694, v ds
+# define BFI_FLINEARS_3695_TICK(t)
+# define BFI_FLINEARS_3694(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3693, v ds
+# define BFI_FLINEARS_3694_TICK(t)
+# define BFI_FLINEARS_3693(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3692, v ds
+# define BFI_FLINEARS_3693_TICK(t)
+# define BFI_FLINEARS_3692(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3691, v ds
+# define BFI_FLINEARS_3692_TICK(t)
+# define BFI_FLINEARS_3691(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3690, v ds
+# define BFI_FLINEARS_3691_TICK(t)
+# define BFI_FLINEARS_3690(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3689, v ds
+# define BFI_FLINEARS_3690_TICK(t)
+# define BFI_FLINEARS_3689(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3688, v ds
+# define BFI_FLINEARS_3689_TICK(t)
+# define BFI_FLINEARS_3688(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3687, v ds
+# define BFI_FLINEARS_3688_TICK(t)
+# define BFI_FLINEARS_3687(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3686, v ds
+# define BFI_FLINEARS_3687_TICK(t)
+# define BFI_FLINEARS_3686(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3685, v ds
+# define BFI_FLINEARS_3686_TICK(t)
+# define BFI_FLINEARS_3685(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3684, v ds
+# define BFI_FLINEARS_3685_TICK(t)
+# define BFI_FLINEARS_3684(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3683, v ds
+# define BFI_FLINEARS_3684_TICK(t)
+# define BFI_FLINEARS_3683(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3682, v ds
+# define BFI_FLINEARS_3683_TICK(t)
+# define BFI_FLINEARS_3682(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3681, v ds
+# define BFI_FLINEARS_3682_TICK(t)
+# define BFI_FLINEARS_3681(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3680, v ds
+# define BFI_FLINEARS_3681_TICK(t)
+# define BFI_FLINEARS_3680(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3679, v ds
+# define BFI_FLINEARS_3680_TICK(t)
+# define BFI_FLINEARS_3679(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3678, v ds
+# define BFI_FLINEARS_3679_TICK(t)
+# define BFI_FLINEARS_3678(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3677, v ds
+# define BFI_FLINEARS_3678_TICK(t)
+# define BFI_FLINEARS_3677(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3676, v ds
+# define BFI_FLINEARS_3677_TICK(t)
+# define BFI_FLINEARS_3676(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3675, v ds
+# define BFI_FLINEARS_3676_TICK(t)
+# define BFI_FLINEARS_3675(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3674, v ds
+# define BFI_FLINEARS_3675_TICK(t)
+# define BFI_FLINEARS_3674(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3673, v ds
+# define BFI_FLINEARS_3674_TICK(t)
+# define BFI_FLINEARS_3673(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3672, v ds
+# define BFI_FLINEARS_3673_TICK(t)
+# define BFI_FLINEARS_3672(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3671, v ds
+# define BFI_FLINEARS_3672_TICK(t)
+# define BFI_FLINEARS_3671(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3670, v ds
+# define BFI_FLINEARS_3671_TICK(t)
+# define BFI_FLINEARS_3670(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3669, v ds
+# define BFI_FLINEARS_3670_TICK(t)
+# define BFI_FLINEARS_3669(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3668, v ds
+# define BFI_FLINEARS_3669_TICK(t)
+# define BFI_FLINEARS_3668(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3667, v ds
+# define BFI_FLINEARS_3668_TICK(t)
+# define BFI_FLINEARS_3667(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3666, v ds
+# define BFI_FLINEARS_3667_TICK(t)
+# define BFI_FLINEARS_3666(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3665, v ds
+# define BFI_FLINEARS_3666_TICK(t)
+# define BFI_FLINEARS_3665(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3664, v ds
+# define BFI_FLINEARS_3665_TICK(t)
+# define BFI_FLINEARS_3664(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3663, v ds
+# define BFI_FLINEARS_3664_TICK(t)
+# define BFI_FLINEARS_3663(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3662, v ds
+# define BFI_FLINEARS_3663_TICK(t)
+# define BFI_FLINEARS_3662(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3661, v ds
+# define BFI_FLINEARS_3662_TICK(t)
+# define BFI_FLINEARS_3661(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3660, v ds
+# define BFI_FLINEARS_3661_TICK(t)
+# define BFI_FLINEARS_3660(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3659, v ds
+# define BFI_FLINEARS_3660_TICK(t)
+# define BFI_FLINEARS_3659(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3658, v ds
+# define BFI_FLINEARS_3659_TICK(t)
+# define BFI_FLINEARS_3658(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3657, v ds
+# define BFI_FLINEARS_3658_TICK(t)
+# define BFI_FLINEARS_3657(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3656, v ds
+# define BFI_FLINEARS_3657_TICK(t)
+# define BFI_FLINEARS_3656(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3655, v ds
+# define BFI_FLINEARS_3656_TICK(t)
+# define BFI_FLINEARS_3655(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3654, v ds
+# define BFI_FLINEARS_3655_TICK(t)
+# define BFI_FLINEARS_3654(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3653, v ds
+# define BFI_FLINEARS_3654_TICK(t)
+# define BFI_FLINEARS_3653(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3652, v ds
+# define BFI_FLINEARS_3653_TICK(t)
+# define BFI_FLINEARS_3652(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3651, v ds
+# define BFI_FLINEARS_3652_TICK(t)
+# define BFI_FLINEARS_3651(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3650, v ds
+# define BFI_FLINEARS_3651_TICK(t)
+# define BFI_FLINEARS_3650(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3649, v ds
+# define BFI_FLINEARS_3650_TICK(t)
+# define BFI_FLINEARS_3649(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3648, v ds
+# define BFI_FLINEARS_3649_TICK(t)
+# define BFI_FLINEARS_3648(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3647, v ds
+# define BFI_FLINEARS_3648_TICK(t)
+# define BFI_FLINEARS_3647(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3646, v ds
+# define BFI_FLINEARS_3647_TICK(t)
+# define BFI_FLINEARS_3646(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3645, v ds
+# define BFI_FLINEARS_3646_TICK(t)
+# define BFI_FLINEARS_3645(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3644, v ds
+# define BFI_FLINEARS_3645_TICK(t)
+# define BFI_FLINEARS_3644(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3643, v ds
+# define BFI_FLINEARS_3644_TICK(t)
+# define BFI_FLINEARS_3643(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3642, v ds
+# define BFI_FLINEARS_3643_TICK(t)
+# define BFI_FLINEARS_3642(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3641, v ds
+# define BFI_FLINEARS_3642_TICK(t)
+# define BFI_FLINEARS_3641(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3640, v ds
+# define BFI_FLINEARS_3641_TICK(t)
+# define BFI_FLINEARS_3640(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3639, v ds
+# define BFI_FLINEARS_3640_TICK(t)
+# define BFI_FLINEARS_3639(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3638, v ds
+# define BFI_FLINEARS_3639_TICK(t)
+# define BFI_FLINEARS_3638(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3637, v ds
+# define BFI_FLINEARS_3638_TICK(t)
+# define BFI_FLINEARS_3637(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3636, v ds
+# define BFI_FLINEARS_3637_TICK(t)
+# define BFI_FLINEARS_3636(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3635, v ds
+# define BFI_FLINEARS_3636_TICK(t)
+# define BFI_FLINEARS_3635(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3634, v ds
+# define BFI_FLINEARS_3635_TICK(t)
+# define BFI_FLINEARS_3634(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3633, v ds
+# define BFI_FLINEARS_3634_TICK(t)
+# define BFI_FLINEARS_3633(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3632, v ds
+# define BFI_FLINEARS_3633_TICK(t)
+# define BFI_FLINEARS_3632(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3631, v ds
+# define BFI_FLINEARS_3632_TICK(t)
+# define BFI_FLINEARS_3631(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3630, v ds
+# define BFI_FLINEARS_3631_TICK(t)
+# define BFI_FLINEARS_3630(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3629, v ds
+# define BFI_FLINEARS_3630_TICK(t)
+# define BFI_FLINEARS_3629(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3628, v ds
+# define BFI_FLINEARS_3629_TICK(t)
+# define BFI_FLINEARS_3628(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3627, v ds
+# define BFI_FLINEARS_3628_TICK(t)
+# define BFI_FLINEARS_3627(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3626, v ds
+# define BFI_FLINEARS_3627_TICK(t)
+# define BFI_FLINEARS_3626(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3625, v ds
+# define BFI_FLINEARS_3626_TICK(t)
+# define BFI_FLINEARS_3625(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3624, v ds
+# define BFI_FLINEARS_3625_TICK(t)
+# define BFI_FLINEARS_3624(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3623, v ds
+# define BFI_FLINEARS_3624_TICK(t)
+# define BFI_FLINEARS_3623(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3622, v ds
+# define BFI_FLINEARS_3623_TICK(t)
+# define BFI_FLINEARS_3622(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3621, v ds
+# define BFI_FLINEARS_3622_TICK(t)
+# define BFI_FLINEARS_3621(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3620, v ds
+# define BFI_FLINEARS_3621_TICK(t)
+# define BFI_FLINEARS_3620(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3619, v ds
+# define BFI_FLINEARS_3620_TICK(t)
+# define BFI_FLINEARS_3619(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3618, v ds
+# define BFI_FLINEARS_3619_TICK(t)
+# define BFI_FLINEARS_3618(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3617, v ds
+# define BFI_FLINEARS_3618_TICK(t)
+# define BFI_FLINEARS_3617(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3616, v ds
+# define BFI_FLINEARS_3617_TICK(t)
+# define BFI_FLINEARS_3616(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3615, v ds
+# define BFI_FLINEARS_3616_TICK(t)
+# define BFI_FLINEARS_3615(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3614, v ds
+# define BFI_FLINEARS_3615_TICK(t)
+# define BFI_FLINEARS_3614(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3613, v ds
+# define BFI_FLINEARS_3614_TICK(t)
+# define BFI_FLINEARS_3613(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3612, v ds
+# define BFI_FLINEARS_3613_TICK(t)
+# define BFI_FLINEARS_3612(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3611, v ds
+# define BFI_FLINEARS_3612_TICK(t)
+# define BFI_FLINEARS_3611(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3610, v ds
+# define BFI_FLINEARS_3611_TICK(t)
+# define BFI_FLINEARS_3610(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3609, v ds
+# define BFI_FLINEARS_3610_TICK(t)
+# define BFI_FLINEARS_3609(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3608, v ds
+# define BFI_FLINEARS_3609_TICK(t)
+# define BFI_FLINEARS_3608(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3607, v ds
+# define BFI_FLINEARS_3608_TICK(t)
+# define BFI_FLINEARS_3607(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3606, v ds
+# define BFI_FLINEARS_3607_TICK(t)
+# define BFI_FLINEARS_3606(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3605, v ds
+# define BFI_FLINEARS_3606_TICK(t)
+# define BFI_FLINEARS_3605(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3604, v ds
+# define BFI_FLINEARS_3605_TICK(t)
+# define BFI_FLINEARS_3604(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3603, v ds
+# define BFI_FLINEARS_3604_TICK(t)
+# define BFI_FLINEARS_3603(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3602, v ds
+# define BFI_FLINEARS_3603_TICK(t)
+# define BFI_FLINEARS_3602(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3601, v ds
+# define BFI_FLINEARS_3602_TICK(t)
+# define BFI_FLINEARS_3601(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3600, v ds
+# define BFI_FLINEARS_3601_TICK(t)
+# define BFI_FLINEARS_3600(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3599, v ds
+# define BFI_FLINEARS_3600_TICK(t)
+# define BFI_FLINEARS_3599(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3598, v ds
+# define BFI_FLINEARS_3599_TICK(t)
+# define BFI_FLINEARS_3598(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3597, v ds
+# define BFI_FLINEARS_3598_TICK(t)
+# define BFI_FLINEARS_3597(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3596, v ds
+# define BFI_FLINEARS_3597_TICK(t)
+# define BFI_FLINEARS_3596(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3595, v ds
+# define BFI_FLINEARS_3596_TICK(t)
+# define BFI_FLINEARS_3595(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3594, v ds
+# define BFI_FLINEARS_3595_TICK(t)
+# define BFI_FLINEARS_3594(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3593, v ds
+# define BFI_FLINEARS_3594_TICK(t)
+# define BFI_FLINEARS_3593(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3592, v ds
+# define BFI_FLINEARS_3593_TICK(t)
+# define BFI_FLINEARS_3592(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3591, v ds
+# define BFI_FLINEARS_3592_TICK(t)
+# define BFI_FLINEARS_3591(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3590, v ds
+# define BFI_FLINEARS_3591_TICK(t)
+# define BFI_FLINEARS_3590(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3589, v ds
+# define BFI_FLINEARS_3590_TICK(t)
+# define BFI_FLINEARS_3589(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3588, v ds
+# define BFI_FLINEARS_3589_TICK(t)
+# define BFI_FLINEARS_3588(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3587, v ds
+# define BFI_FLINEARS_3588_TICK(t)
+# define BFI_FLINEARS_3587(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3586, v ds
+# define BFI_FLINEARS_3587_TICK(t)
+# define BFI_FLINEARS_3586(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3585, v ds
+# define BFI_FLINEARS_3586_TICK(t)
+# define BFI_FLINEARS_3585(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3584, v ds
+# define BFI_FLINEARS_3585_TICK(t)
+# define BFI_FLINEARS_3584(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3583, v ds
+# define BFI_FLINEARS_3584_TICK(t)
+# define BFI_FLINEARS_3583(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3582, v ds
+# define BFI_FLINEARS_3583_TICK(t)
+# define BFI_FLINEARS_3582(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3581, v ds
+# define BFI_FLINEARS_3582_TICK(t)
+# define BFI_FLINEARS_3581(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3580, v ds
+# define BFI_FLINEARS_3581_TICK(t)
+# define BFI_FLINEARS_3580(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3579, v ds
+# define BFI_FLINEARS_3580_TICK(t)
+# define BFI_FLINEARS_3579(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3578, v ds
+# define BFI_FLINEARS_3579_TICK(t)
+# define BFI_FLINEARS_3578(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3577, v ds
+# define BFI_FLINEARS_3578_TICK(t)
+# define BFI_FLINEARS_3577(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3576, v ds
+# define BFI_FLINEARS_3577_TICK(t)
+# define BFI_FLINEARS_3576(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3575, v ds
+# define BFI_FLINEARS_3576_TICK(t)
+# define BFI_FLINEARS_3575(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3574, v ds
+# define BFI_FLINEARS_3575_TICK(t)
+# define BFI_FLINEARS_3574(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3573, v ds
+# define BFI_FLINEARS_3574_TICK(t)
+# define BFI_FLINEARS_3573(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3572, v ds
+# define BFI_FLINEARS_3573_TICK(t)
+# define BFI_FLINEARS_3572(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3571, v ds
+# define BFI_FLINEARS_3572_TICK(t)
+# define BFI_FLINEARS_3571(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3570, v ds
+# define BFI_FLINEARS_3571_TICK(t)
+# define BFI_FLINEARS_3570(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3569, v ds
+# define BFI_FLINEARS_3570_TICK(t)
+# define BFI_FLINEARS_3569(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3568, v ds
+# define BFI_FLINEARS_3569_TICK(t)
+# define BFI_FLINEARS_3568(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3567, v ds
+# define BFI_FLINEARS_3568_TICK(t)
+# define BFI_FLINEARS_3567(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3566, v ds
+# define BFI_FLINEARS_3567_TICK(t)
+# define BFI_FLINEARS_3566(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3565, v ds
+# define BFI_FLINEARS_3566_TICK(t)
+# define BFI_FLINEARS_3565(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3564, v ds
+# define BFI_FLINEARS_3565_TICK(t)
+# define BFI_FLINEARS_3564(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3563, v ds
+# define BFI_FLINEARS_3564_TICK(t)
+# define BFI_FLINEARS_3563(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3562, v ds
+# define BFI_FLINEARS_3563_TICK(t)
+# define BFI_FLINEARS_3562(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3561, v ds
+# define BFI_FLINEARS_3562_TICK(t)
+# define BFI_FLINEARS_3561(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3560, v ds
+# define BFI_FLINEARS_3561_TICK(t)
+# define BFI_FLINEARS_3560(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3559, v ds
+# define BFI_FLINEARS_3560_TICK(t)
+# define BFI_FLINEARS_3559(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3558, v ds
+# define BFI_FLINEARS_3559_TICK(t)
+# define BFI_FLINEARS_3558(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3557, v ds
+# define BFI_FLINEARS_3558_TICK(t)
+# define BFI_FLINEARS_3557(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3556, v ds
+# define BFI_FLINEARS_3557_TICK(t)
+# define BFI_FLINEARS_3556(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3555, v ds
+# define BFI_FLINEARS_3556_TICK(t)
+# define BFI_FLINEARS_3555(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3554, v ds
+# define BFI_FLINEARS_3555_TICK(t)
+# define BFI_FLINEARS_3554(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3553, v ds
+# define BFI_FLINEARS_3554_TICK(t)
+# define BFI_FLINEARS_3553(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3552, v ds
+# define BFI_FLINEARS_3553_TICK(t)
+# define BFI_FLINEARS_3552(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3551, v ds
+# define BFI_FLINEARS_3552_TICK(t)
+# define BFI_FLINEARS_3551(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3550, v ds
+# define BFI_FLINEARS_3551_TICK(t)
+# define BFI_FLINEARS_3550(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3549, v ds
+# define BFI_FLINEARS_3550_TICK(t)
+# define BFI_FLINEARS_3549(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3548, v ds
+# define BFI_FLINEARS_3549_TICK(t)
+# define BFI_FLINEARS_3548(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3547, v ds
+# define BFI_FLINEARS_3548_TICK(t)
+# define BFI_FLINEARS_3547(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3546, v ds
+# define BFI_FLINEARS_3547_TICK(t)
+# define BFI_FLINEARS_3546(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3545, v ds
+# define BFI_FLINEARS_3546_TICK(t)
+# define BFI_FLINEARS_3545(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3544, v ds
+# define BFI_FLINEARS_3545_TICK(t)
+# define BFI_FLINEARS_3544(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3543, v ds
+# define BFI_FLINEARS_3544_TICK(t)
+# define BFI_FLINEARS_3543(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3542, v ds
+# define BFI_FLINEARS_3543_TICK(t)
+# define BFI_FLINEARS_3542(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3541, v ds
+# define BFI_FLINEARS_3542_TICK(t)
+# define BFI_FLINEARS_3541(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3540, v ds
+# define BFI_FLINEARS_3541_TICK(t)
+# define BFI_FLINEARS_3540(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3539, v ds
+# define BFI_FLINEARS_3540_TICK(t)
+# define BFI_FLINEARS_3539(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3538, v ds
+# define BFI_FLINEARS_3539_TICK(t)
+# define BFI_FLINEARS_3538(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3537, v ds
+# define BFI_FLINEARS_3538_TICK(t)
+# define BFI_FLINEARS_3537(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3536, v ds
+# define BFI_FLINEARS_3537_TICK(t)
+# define BFI_FLINEARS_3536(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3535, v ds
+# define BFI_FLINEARS_3536_TICK(t)
+# define BFI_FLINEARS_3535(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3534, v ds
+# define BFI_FLINEARS_3535_TICK(t)
+# define BFI_FLINEARS_3534(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3533, v ds
+# define BFI_FLINEARS_3534_TICK(t)
+# define BFI_FLINEARS_3533(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3532, v ds
+# define BFI_FLINEARS_3533_TICK(t)
+# define BFI_FLINEARS_3532(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3531, v ds
+# define BFI_FLINEARS_3532_TICK(t)
+# define BFI_FLINEARS_3531(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3530, v ds
+# define BFI_FLINEARS_3531_TICK(t)
+# define BFI_FLINEARS_3530(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3529, v ds
+# define BFI_FLINEARS_3530_TICK(t)
+# define BFI_FLINEARS_3529(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3528, v ds
+# define BFI_FLINEARS_3529_TICK(t)
+# define BFI_FLINEARS_3528(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3527, v ds
+# define BFI_FLINEARS_3528_TICK(t)
+# define BFI_FLINEARS_3527(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3526, v ds
+# define BFI_FLINEARS_3527_TICK(t)
+# define BFI_FLINEARS_3526(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3525, v ds
+# define BFI_FLINEARS_3526_TICK(t)
+# define BFI_FLINEARS_3525(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3524, v ds
+# define BFI_FLINEARS_3525_TICK(t)
+# define BFI_FLINEARS_3524(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3523, v ds
+# define BFI_FLINEARS_3524_TICK(t)
+# define BFI_FLINEARS_3523(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3522, v ds
+# define BFI_FLINEARS_3523_TICK(t)
+# define BFI_FLINEARS_3522(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3521, v ds
+# define BFI_FLINEARS_3522_TICK(t)
+# define BFI_FLINEARS_3521(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3520, v ds
+# define BFI_FLINEARS_3521_TICK(t)
+# define BFI_FLINEARS_3520(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3519, v ds
+# define BFI_FLINEARS_3520_TICK(t)
+# define BFI_FLINEARS_3519(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3518, v ds
+# define BFI_FLINEARS_3519_TICK(t)
+# define BFI_FLINEARS_3518(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3517, v ds
+# define BFI_FLINEARS_3518_TICK(t)
+# define BFI_FLINEARS_3517(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3516, v ds
+# define BFI_FLINEARS_3517_TICK(t)
+# define BFI_FLINEARS_3516(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3515, v ds
+# define BFI_FLINEARS_3516_TICK(t)
+# define BFI_FLINEARS_3515(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3514, v ds
+# define BFI_FLINEARS_3515_TICK(t)
+# define BFI_FLINEARS_3514(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3513, v ds
+# define BFI_FLINEARS_3514_TICK(t)
+# define BFI_FLINEARS_3513(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3512, v ds
+# define BFI_FLINEARS_3513_TICK(t)
+# define BFI_FLINEARS_3512(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3511, v ds
+# define BFI_FLINEARS_3512_TICK(t)
+# define BFI_FLINEARS_3511(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3510, v ds
+# define BFI_FLINEARS_3511_TICK(t)
+# define BFI_FLINEARS_3510(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3509, v ds
+# define BFI_FLINEARS_3510_TICK(t)
+# define BFI_FLINEARS_3509(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3508, v ds
+# define BFI_FLINEARS_3509_TICK(t)
+# define BFI_FLINEARS_3508(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3507, v ds
+# define BFI_FLINEARS_3508_TICK(t)
+# define BFI_FLINEARS_3507(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3506, v ds
+# define BFI_FLINEARS_3507_TICK(t)
+# define BFI_FLINEARS_3506(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3505, v ds
+# define BFI_FLINEARS_3506_TICK(t)
+# define BFI_FLINEARS_3505(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3504, v ds
+# define BFI_FLINEARS_3505_TICK(t)
+# define BFI_FLINEARS_3504(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3503, v ds
+# define BFI_FLINEARS_3504_TICK(t)
+# define BFI_FLINEARS_3503(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3502, v ds
+# define BFI_FLINEARS_3503_TICK(t)
+# define BFI_FLINEARS_3502(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3501, v ds
+# define BFI_FLINEARS_3502_TICK(t)
+# define BFI_FLINEARS_3501(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3500, v ds
+# define BFI_FLINEARS_3501_TICK(t)
+# define BFI_FLINEARS_3500(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3499, v ds
+# define BFI_FLINEARS_3500_TICK(t)
+# define BFI_FLINEARS_3499(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3498, v ds
+# define BFI_FLINEARS_3499_TICK(t)
+# define BFI_FLINEARS_3498(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3497, v ds
+# define BFI_FLINEARS_3498_TICK(t)
+# define BFI_FLINEARS_3497(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3496, v ds
+# define BFI_FLINEARS_3497_TICK(t)
+# define BFI_FLINEARS_3496(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3495, v ds
+# define BFI_FLINEARS_3496_TICK(t)
+# define BFI_FLINEARS_3495(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3494, v ds
+# define BFI_FLINEARS_3495_TICK(t)
+# define BFI_FLINEARS_3494(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3493, v ds
+# define BFI_FLINEARS_3494_TICK(t)
+# define BFI_FLINEARS_3493(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3492, v ds
+# define BFI_FLINEARS_3493_TICK(t)
+# define BFI_FLINEARS_3492(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3491, v ds
+# define BFI_FLINEARS_3492_TICK(t)
+# define BFI_FLINEARS_3491(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3490, v ds
+# define BFI_FLINEARS_3491_TICK(t)
+# define BFI_FLINEARS_3490(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3489, v ds
+# define BFI_FLINEARS_3490_TICK(t)
+# define BFI_FLINEARS_3489(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3488, v ds
+# define BFI_FLINEARS_3489_TICK(t)
+# define BFI_FLINEARS_3488(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3487, v ds
+# define BFI_FLINEARS_3488_TICK(t)
+# define BFI_FLINEARS_3487(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3486, v ds
+# define BFI_FLINEARS_3487_TICK(t)
+# define BFI_FLINEARS_3486(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3485, v ds
+# define BFI_FLINEARS_3486_TICK(t)
+# define BFI_FLINEARS_3485(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3484, v ds
+# define BFI_FLINEARS_3485_TICK(t)
+# define BFI_FLINEARS_3484(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3483, v ds
+# define BFI_FLINEARS_3484_TICK(t)
+# define BFI_FLINEARS_3483(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3482, v ds
+# define BFI_FLINEARS_3483_TICK(t)
+# define BFI_FLINEARS_3482(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3481, v ds
+# define BFI_FLINEARS_3482_TICK(t)
+# define BFI_FLINEARS_3481(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3480, v ds
+# define BFI_FLINEARS_3481_TICK(t)
+# define BFI_FLINEARS_3480(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3479, v ds
+# define BFI_FLINEARS_3480_TICK(t)
+# define BFI_FLINEARS_3479(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3478, v ds
+# define BFI_FLINEARS_3479_TICK(t)
+# define BFI_FLINEARS_3478(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3477, v ds
+# define BFI_FLINEARS_3478_TICK(t)
+# define BFI_FLINEARS_3477(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3476, v ds
+# define BFI_FLINEARS_3477_TICK(t)
+# define BFI_FLINEARS_3476(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3475, v ds
+# define BFI_FLINEARS_3476_TICK(t)
+# define BFI_FLINEARS_3475(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3474, v ds
+# define BFI_FLINEARS_3475_TICK(t)
+# define BFI_FLINEARS_3474(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3473, v ds
+# define BFI_FLINEARS_3474_TICK(t)
+# define BFI_FLINEARS_3473(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3472, v ds
+# define BFI_FLINEARS_3473_TICK(t)
+# define BFI_FLINEARS_3472(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3471, v ds
+# define BFI_FLINEARS_3472_TICK(t)
+# define BFI_FLINEARS_3471(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3470, v ds
+# define BFI_FLINEARS_3471_TICK(t)
+# define BFI_FLINEARS_3470(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3469, v ds
+# define BFI_FLINEARS_3470_TICK(t)
+# define BFI_FLINEARS_3469(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3468, v ds
+# define BFI_FLINEARS_3469_TICK(t)
+# define BFI_FLINEARS_3468(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3467, v ds
+# define BFI_FLINEARS_3468_TICK(t)
+# define BFI_FLINEARS_3467(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3466, v ds
+# define BFI_FLINEARS_3467_TICK(t)
+# define BFI_FLINEARS_3466(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3465, v ds
+# define BFI_FLINEARS_3466_TICK(t)
+# define BFI_FLINEARS_3465(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3464, v ds
+# define BFI_FLINEARS_3465_TICK(t)
+# define BFI_FLINEARS_3464(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3463, v ds
+# define BFI_FLINEARS_3464_TICK(t)
+# define BFI_FLINEARS_3463(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3462, v ds
+# define BFI_FLINEARS_3463_TICK(t)
+# define BFI_FLINEARS_3462(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3461, v ds
+# define BFI_FLINEARS_3462_TICK(t)
+# define BFI_FLINEARS_3461(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3460, v ds
+# define BFI_FLINEARS_3461_TICK(t)
+# define BFI_FLINEARS_3460(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3459, v ds
+# define BFI_FLINEARS_3460_TICK(t)
+# define BFI_FLINEARS_3459(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3458, v ds
+# define BFI_FLINEARS_3459_TICK(t)
+# define BFI_FLINEARS_3458(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3457, v ds
+# define BFI_FLINEARS_3458_TICK(t)
+# define BFI_FLINEARS_3457(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3456, v ds
+# define BFI_FLINEARS_3457_TICK(t)
+# define BFI_FLINEARS_3456(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3455, v ds
+# define BFI_FLINEARS_3456_TICK(t)
+# define BFI_FLINEARS_3455(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3454, v ds
+# define BFI_FLINEARS_3455_TICK(t)
+# define BFI_FLINEARS_3454(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3453, v ds
+# define BFI_FLINEARS_3454_TICK(t)
+# define BFI_FLINEARS_3453(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3452, v ds
+# define BFI_FLINEARS_3453_TICK(t)
+# define BFI_FLINEARS_3452(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3451, v ds
+# define BFI_FLINEARS_3452_TICK(t)
+# define BFI_FLINEARS_3451(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3450, v ds
+# define BFI_FLINEARS_3451_TICK(t)
+# define BFI_FLINEARS_3450(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3449, v ds
+# define BFI_FLINEARS_3450_TICK(t)
+# define BFI_FLINEARS_3449(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3448, v ds
+# define BFI_FLINEARS_3449_TICK(t)
+# define BFI_FLINEARS_3448(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3447, v ds
+# define BFI_FLINEARS_3448_TICK(t)
+# define BFI_FLINEARS_3447(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3446, v ds
+# define BFI_FLINEARS_3447_TICK(t)
+# define BFI_FLINEARS_3446(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3445, v ds
+# define BFI_FLINEARS_3446_TICK(t)
+# define BFI_FLINEARS_3445(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3444, v ds
+# define BFI_FLINEARS_3445_TICK(t)
+# define BFI_FLINEARS_3444(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3443, v ds
+# define BFI_FLINEARS_3444_TICK(t)
+# define BFI_FLINEARS_3443(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3442, v ds
+# define BFI_FLINEARS_3443_TICK(t)
+# define BFI_FLINEARS_3442(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3441, v ds
+# define BFI_FLINEARS_3442_TICK(t)
+# define BFI_FLINEARS_3441(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3440, v ds
+# define BFI_FLINEARS_3441_TICK(t)
+# define BFI_FLINEARS_3440(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3439, v ds
+# define BFI_FLINEARS_3440_TICK(t)
+# define BFI_FLINEARS_3439(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3438, v ds
+# define BFI_FLINEARS_3439_TICK(t)
+# define BFI_FLINEARS_3438(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3437, v ds
+# define BFI_FLINEARS_3438_TICK(t)
+# define BFI_FLINEARS_3437(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3436, v ds
+# define BFI_FLINEARS_3437_TICK(t)
+# define BFI_FLINEARS_3436(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3435, v ds
+# define BFI_FLINEARS_3436_TICK(t)
+# define BFI_FLINEARS_3435(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3434, v ds
+# define BFI_FLINEARS_3435_TICK(t)
+# define BFI_FLINEARS_3434(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3433, v ds
+# define BFI_FLINEARS_3434_TICK(t)
+# define BFI_FLINEARS_3433(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3432, v ds
+# define BFI_FLINEARS_3433_TICK(t)
+# define BFI_FLINEARS_3432(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3431, v ds
+# define BFI_FLINEARS_3432_TICK(t)
+# define BFI_FLINEARS_3431(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3430, v ds
+# define BFI_FLINEARS_3431_TICK(t)
+# define BFI_FLINEARS_3430(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3429, v ds
+# define BFI_FLINEARS_3430_TICK(t)
+# define BFI_FLINEARS_3429(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3428, v ds
+# define BFI_FLINEARS_3429_TICK(t)
+# define BFI_FLINEARS_3428(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3427, v ds
+# define BFI_FLINEARS_3428_TICK(t)
+# define BFI_FLINEARS_3427(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3426, v ds
+# define BFI_FLINEARS_3427_TICK(t)
+# define BFI_FLINEARS_3426(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3425, v ds
+# define BFI_FLINEARS_3426_TICK(t)
+# define BFI_FLINEARS_3425(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3424, v ds
+# define BFI_FLINEARS_3425_TICK(t)
+# define BFI_FLINEARS_3424(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3423, v ds
+# define BFI_FLINEARS_3424_TICK(t)
+# define BFI_FLINEARS_3423(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3422, v ds
+# define BFI_FLINEARS_3423_TICK(t)
+# define BFI_FLINEARS_3422(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3421, v ds
+# define BFI_FLINEARS_3422_TICK(t)
+# define BFI_FLINEARS_3421(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3420, v ds
+# define BFI_FLINEARS_3421_TICK(t)
+# define BFI_FLINEARS_3420(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3419, v ds
+# define BFI_FLINEARS_3420_TICK(t)
+# define BFI_FLINEARS_3419(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3418, v ds
+# define BFI_FLINEARS_3419_TICK(t)
+# define BFI_FLINEARS_3418(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3417, v ds
+# define BFI_FLINEARS_3418_TICK(t)
+# define BFI_FLINEARS_3417(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3416, v ds
+# define BFI_FLINEARS_3417_TICK(t)
+# define BFI_FLINEARS_3416(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3415, v ds
+# define BFI_FLINEARS_3416_TICK(t)
+# define BFI_FLINEARS_3415(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3414, v ds
+# define BFI_FLINEARS_3415_TICK(t)
+# define BFI_FLINEARS_3414(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3413, v ds
+# define BFI_FLINEARS_3414_TICK(t)
+# define BFI_FLINEARS_3413(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3412, v ds
+# define BFI_FLINEARS_3413_TICK(t)
+# define BFI_FLINEARS_3412(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3411, v ds
+# define BFI_FLINEARS_3412_TICK(t)
+# define BFI_FLINEARS_3411(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3410, v ds
+# define BFI_FLINEARS_3411_TICK(t)
+# define BFI_FLINEARS_3410(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3409, v ds
+# define BFI_FLINEARS_3410_TICK(t)
+# define BFI_FLINEARS_3409(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3408, v ds
+# define BFI_FLINEARS_3409_TICK(t)
+# define BFI_FLINEARS_3408(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3407, v ds
+# define BFI_FLINEARS_3408_TICK(t)
+# define BFI_FLINEARS_3407(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3406, v ds
+# define BFI_FLINEARS_3407_TICK(t)
+# define BFI_FLINEARS_3406(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3405, v ds
+# define BFI_FLINEARS_3406_TICK(t)
+# define BFI_FLINEARS_3405(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3404, v ds
+# define BFI_FLINEARS_3405_TICK(t)
+# define BFI_FLINEARS_3404(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3403, v ds
+# define BFI_FLINEARS_3404_TICK(t)
+# define BFI_FLINEARS_3403(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3402, v ds
+# define BFI_FLINEARS_3403_TICK(t)
+# define BFI_FLINEARS_3402(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3401, v ds
+# define BFI_FLINEARS_3402_TICK(t)
+# define BFI_FLINEARS_3401(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3400, v ds
+# define BFI_FLINEARS_3401_TICK(t)
+# define BFI_FLINEARS_3400(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3399, v ds
+# define BFI_FLINEARS_3400_TICK(t)
+# define BFI_FLINEARS_3399(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3398, v ds
+# define BFI_FLINEARS_3399_TICK(t)
+# define BFI_FLINEARS_3398(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3397, v ds
+# define BFI_FLINEARS_3398_TICK(t)
+# define BFI_FLINEARS_3397(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3396, v ds
+# define BFI_FLINEARS_3397_TICK(t)
+# define BFI_FLINEARS_3396(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3395, v ds
+# define BFI_FLINEARS_3396_TICK(t)
+# define BFI_FLINEARS_3395(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3394, v ds
+# define BFI_FLINEARS_3395_TICK(t)
+# define BFI_FLINEARS_3394(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3393, v ds
+# define BFI_FLINEARS_3394_TICK(t)
+# define BFI_FLINEARS_3393(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3392, v ds
+# define BFI_FLINEARS_3393_TICK(t)
+# define BFI_FLINEARS_3392(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3391, v ds
+# define BFI_FLINEARS_3392_TICK(t)
+# define BFI_FLINEARS_3391(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3390, v ds
+# define BFI_FLINEARS_3391_TICK(t)
+# define BFI_FLINEARS_3390(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3389, v ds
+# define BFI_FLINEARS_3390_TICK(t)
+# define BFI_FLINEARS_3389(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3388, v ds
+# define BFI_FLINEARS_3389_TICK(t)
+# define BFI_FLINEARS_3388(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3387, v ds
+# define BFI_FLINEARS_3388_TICK(t)
+# define BFI_FLINEARS_3387(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3386, v ds
+# define BFI_FLINEARS_3387_TICK(t)
+# define BFI_FLINEARS_3386(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3385, v ds
+# define BFI_FLINEARS_3386_TICK(t)
+# define BFI_FLINEARS_3385(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3384, v ds
+# define BFI_FLINEARS_3385_TICK(t)
+# define BFI_FLINEARS_3384(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3383, v ds
+# define BFI_FLINEARS_3384_TICK(t)
+# define BFI_FLINEARS_3383(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3382, v ds
+# define BFI_FLINEARS_3383_TICK(t)
+# define BFI_FLINEARS_3382(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3381, v ds
+# define BFI_FLINEARS_3382_TICK(t)
+# define BFI_FLINEARS_3381(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3380, v ds
+# define BFI_FLINEARS_3381_TICK(t)
+# define BFI_FLINEARS_3380(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3379, v ds
+# define BFI_FLINEARS_3380_TICK(t)
+# define BFI_FLINEARS_3379(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3378, v ds
+# define BFI_FLINEARS_3379_TICK(t)
+# define BFI_FLINEARS_3378(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3377, v ds
+# define BFI_FLINEARS_3378_TICK(t)
+# define BFI_FLINEARS_3377(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3376, v ds
+# define BFI_FLINEARS_3377_TICK(t)
+# define BFI_FLINEARS_3376(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3375, v ds
+# define BFI_FLINEARS_3376_TICK(t)
+# define BFI_FLINEARS_3375(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3374, v ds
+# define BFI_FLINEARS_3375_TICK(t)
+# define BFI_FLINEARS_3374(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3373, v ds
+# define BFI_FLINEARS_3374_TICK(t)
+# define BFI_FLINEARS_3373(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3372, v ds
+# define BFI_FLINEARS_3373_TICK(t)
+# define BFI_FLINEARS_3372(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3371, v ds
+# define BFI_FLINEARS_3372_TICK(t)
+# define BFI_FLINEARS_3371(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3370, v ds
+# define BFI_FLINEARS_3371_TICK(t)
+# define BFI_FLINEARS_3370(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3369, v ds
+# define BFI_FLINEARS_3370_TICK(t)
+# define BFI_FLINEARS_3369(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3368, v ds
+# define BFI_FLINEARS_3369_TICK(t)
+# define BFI_FLINEARS_3368(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3367, v ds
+# define BFI_FLINEARS_3368_TICK(t)
+# define BFI_FLINEARS_3367(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3366, v ds
+# define BFI_FLINEARS_3367_TICK(t)
+# define BFI_FLINEARS_3366(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3365, v ds
+# define BFI_FLINEARS_3366_TICK(t)
+# define BFI_FLINEARS_3365(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3364, v ds
+# define BFI_FLINEARS_3365_TICK(t)
+# define BFI_FLINEARS_3364(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3363, v ds
+# define BFI_FLINEARS_3364_TICK(t)
+# define BFI_FLINEARS_3363(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3362, v ds
+# define BFI_FLINEARS_3363_TICK(t)
+# define BFI_FLINEARS_3362(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3361, v ds
+# define BFI_FLINEARS_3362_TICK(t)
+# define BFI_FLINEARS_3361(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3360, v ds
+# define BFI_FLINEARS_3361_TICK(t)
+# define BFI_FLINEARS_3360(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3359, v ds
+# define BFI_FLINEARS_3360_TICK(t)
+# define BFI_FLINEARS_3359(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3358, v ds
+# define BFI_FLINEARS_3359_TICK(t)
+# define BFI_FLINEARS_3358(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3357, v ds
+# define BFI_FLINEARS_3358_TICK(t)
+# define BFI_FLINEARS_3357(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3356, v ds
+# define BFI_FLINEARS_3357_TICK(t)
+# define BFI_FLINEARS_3356(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3355, v ds
+# define BFI_FLINEARS_3356_TICK(t)
+# define BFI_FLINEARS_3355(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3354, v ds
+# define BFI_FLINEARS_3355_TICK(t)
+# define BFI_FLINEARS_3354(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3353, v ds
+# define BFI_FLINEARS_3354_TICK(t)
+# define BFI_FLINEARS_3353(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3352, v ds
+# define BFI_FLINEARS_3353_TICK(t)
+# define BFI_FLINEARS_3352(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3351, v ds
+# define BFI_FLINEARS_3352_TICK(t)
+# define BFI_FLINEARS_3351(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3350, v ds
+# define BFI_FLINEARS_3351_TICK(t)
+# define BFI_FLINEARS_3350(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3349, v ds
+# define BFI_FLINEARS_3350_TICK(t)
+# define BFI_FLINEARS_3349(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3348, v ds
+# define BFI_FLINEARS_3349_TICK(t)
+# define BFI_FLINEARS_3348(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3347, v ds
+# define BFI_FLINEARS_3348_TICK(t)
+# define BFI_FLINEARS_3347(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3346, v ds
+# define BFI_FLINEARS_3347_TICK(t)
+# define BFI_FLINEARS_3346(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3345, v ds
+# define BFI_FLINEARS_3346_TICK(t)
+# define BFI_FLINEARS_3345(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3344, v ds
+# define BFI_FLINEARS_3345_TICK(t)
+# define BFI_FLINEARS_3344(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3343, v ds
+# define BFI_FLINEARS_3344_TICK(t)
+# define BFI_FLINEARS_3343(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3342, v ds
+# define BFI_FLINEARS_3343_TICK(t)
+# define BFI_FLINEARS_3342(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3341, v ds
+# define BFI_FLINEARS_3342_TICK(t)
+# define BFI_FLINEARS_3341(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3340, v ds
+# define BFI_FLINEARS_3341_TICK(t)
+# define BFI_FLINEARS_3340(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3339, v ds
+# define BFI_FLINEARS_3340_TICK(t)
+# define BFI_FLINEARS_3339(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3338, v ds
+# define BFI_FLINEARS_3339_TICK(t)
+# define BFI_FLINEARS_3338(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3337, v ds
+# define BFI_FLINEARS_3338_TICK(t)
+# define BFI_FLINEARS_3337(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3336, v ds
+# define BFI_FLINEARS_3337_TICK(t)
+# define BFI_FLINEARS_3336(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3335, v ds
+# define BFI_FLINEARS_3336_TICK(t)
+# define BFI_FLINEARS_3335(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3334, v ds
+# define BFI_FLINEARS_3335_TICK(t)
+# define BFI_FLINEARS_3334(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3333, v ds
+# define BFI_FLINEARS_3334_TICK(t)
+# define BFI_FLINEARS_3333(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3332, v ds
+# define BFI_FLINEARS_3333_TICK(t)
+# define BFI_FLINEARS_3332(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3331, v ds
+# define BFI_FLINEARS_3332_TICK(t)
+# define BFI_FLINEARS_3331(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3330, v ds
+# define BFI_FLINEARS_3331_TICK(t)
+# define BFI_FLINEARS_3330(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3329, v ds
+# define BFI_FLINEARS_3330_TICK(t)
+# define BFI_FLINEARS_3329(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3328, v ds
+# define BFI_FLINEARS_3329_TICK(t)
+# define BFI_FLINEARS_3328(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3327, v ds
+# define BFI_FLINEARS_3328_TICK(t)
+# define BFI_FLINEARS_3327(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3326, v ds
+# define BFI_FLINEARS_3327_TICK(t)
+# define BFI_FLINEARS_3326(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3325, v ds
+# define BFI_FLINEARS_3326_TICK(t)
+# define BFI_FLINEARS_3325(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3324, v ds
+# define BFI_FLINEARS_3325_TICK(t)
+# define BFI_FLINEARS_3324(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3323, v ds
+# define BFI_FLINEARS_3324_TICK(t)
+# define BFI_FLINEARS_3323(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3322, v ds
+# define BFI_FLINEARS_3323_TICK(t)
+# define BFI_FLINEARS_3322(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3321, v ds
+# define BFI_FLINEARS_3322_TICK(t)
+# define BFI_FLINEARS_3321(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3320, v ds
+# define BFI_FLINEARS_3321_TICK(t)
+# define BFI_FLINEARS_3320(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3319, v ds
+# define BFI_FLINEARS_3320_TICK(t)
+# define BFI_FLINEARS_3319(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3318, v ds
+# define BFI_FLINEARS_3319_TICK(t)
+# define BFI_FLINEARS_3318(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3317, v ds
+# define BFI_FLINEARS_3318_TICK(t)
+# define BFI_FLINEARS_3317(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3316, v ds
+# define BFI_FLINEARS_3317_TICK(t)
+# define BFI_FLINEARS_3316(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3315, v ds
+# define BFI_FLINEARS_3316_TICK(t)
+# define BFI_FLINEARS_3315(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3314, v ds
+# define BFI_FLINEARS_3315_TICK(t)
+# define BFI_FLINEARS_3314(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3313, v ds
+# define BFI_FLINEARS_3314_TICK(t)
+# define BFI_FLINEARS_3313(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3312, v ds
+# define BFI_FLINEARS_3313_TICK(t)
+# define BFI_FLINEARS_3312(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3311, v ds
+# define BFI_FLINEARS_3312_TICK(t)
+# define BFI_FLINEARS_3311(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3310, v ds
+# define BFI_FLINEARS_3311_TICK(t)
+# define BFI_FLINEARS_3310(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3309, v ds
+# define BFI_FLINEARS_3310_TICK(t)
+# define BFI_FLINEARS_3309(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3308, v ds
+# define BFI_FLINEARS_3309_TICK(t)
+# define BFI_FLINEARS_3308(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3307, v ds
+# define BFI_FLINEARS_3308_TICK(t)
+# define BFI_FLINEARS_3307(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3306, v ds
+# define BFI_FLINEARS_3307_TICK(t)
+# define BFI_FLINEARS_3306(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3305, v ds
+# define BFI_FLINEARS_3306_TICK(t)
+# define BFI_FLINEARS_3305(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3304, v ds
+# define BFI_FLINEARS_3305_TICK(t)
+# define BFI_FLINEARS_3304(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3303, v ds
+# define BFI_FLINEARS_3304_TICK(t)
+# define BFI_FLINEARS_3303(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3302, v ds
+# define BFI_FLINEARS_3303_TICK(t)
+# define BFI_FLINEARS_3302(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3301, v ds
+# define BFI_FLINEARS_3302_TICK(t)
+# define BFI_FLINEARS_3301(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3300, v ds
+# define BFI_FLINEARS_3301_TICK(t)
+# define BFI_FLINEARS_3300(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3299, v ds
+# define BFI_FLINEARS_3300_TICK(t)
+# define BFI_FLINEARS_3299(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3298, v ds
+# define BFI_FLINEARS_3299_TICK(t)
+# define BFI_FLINEARS_3298(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3297, v ds
+# define BFI_FLINEARS_3298_TICK(t)
+# define BFI_FLINEARS_3297(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3296, v ds
+# define BFI_FLINEARS_3297_TICK(t)
+# define BFI_FLINEARS_3296(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3295, v ds
+# define BFI_FLINEARS_3296_TICK(t)
+# define BFI_FLINEARS_3295(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3294, v ds
+# define BFI_FLINEARS_3295_TICK(t)
+# define BFI_FLINEARS_3294(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3293, v ds
+# define BFI_FLINEARS_3294_TICK(t)
+# define BFI_FLINEARS_3293(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3292, v ds
+# define BFI_FLINEARS_3293_TICK(t)
+# define BFI_FLINEARS_3292(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3291, v ds
+# define BFI_FLINEARS_3292_TICK(t)
+# define BFI_FLINEARS_3291(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3290, v ds
+# define BFI_FLINEARS_3291_TICK(t)
+# define BFI_FLINEARS_3290(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3289, v ds
+# define BFI_FLINEARS_3290_TICK(t)
+# define BFI_FLINEARS_3289(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3288, v ds
+# define BFI_FLINEARS_3289_TICK(t)
+# define BFI_FLINEARS_3288(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3287, v ds
+# define BFI_FLINEARS_3288_TICK(t)
+# define BFI_FLINEARS_3287(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3286, v ds
+# define BFI_FLINEARS_3287_TICK(t)
+# define BFI_FLINEARS_3286(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3285, v ds
+# define BFI_FLINEARS_3286_TICK(t)
+# define BFI_FLINEARS_3285(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3284, v ds
+# define BFI_FLINEARS_3285_TICK(t)
+# define BFI_FLINEARS_3284(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3283, v ds
+# define BFI_FLINEARS_3284_TICK(t)
+# define BFI_FLINEARS_3283(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3282, v ds
+# define BFI_FLINEARS_3283_TICK(t)
+# define BFI_FLINEARS_3282(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3281, v ds
+# define BFI_FLINEARS_3282_TICK(t)
+# define BFI_FLINEARS_3281(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3280, v ds
+# define BFI_FLINEARS_3281_TICK(t)
+# define BFI_FLINEARS_3280(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3279, v ds
+# define BFI_FLINEARS_3280_TICK(t)
+# define BFI_FLINEARS_3279(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3278, v ds
+# define BFI_FLINEARS_3279_TICK(t)
+# define BFI_FLINEARS_3278(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3277, v ds
+# define BFI_FLINEARS_3278_TICK(t)
+# define BFI_FLINEARS_3277(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3276, v ds
+# define BFI_FLINEARS_3277_TICK(t)
+# define BFI_FLINEARS_3276(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3275, v ds
+# define BFI_FLINEARS_3276_TICK(t)
+# define BFI_FLINEARS_3275(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3274, v ds
+# define BFI_FLINEARS_3275_TICK(t)
+# define BFI_FLINEARS_3274(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3273, v ds
+# define BFI_FLINEARS_3274_TICK(t)
+# define BFI_FLINEARS_3273(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3272, v ds
+# define BFI_FLINEARS_3273_TICK(t)
+# define BFI_FLINEARS_3272(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3271, v ds
+# define BFI_FLINEARS_3272_TICK(t)
+# define BFI_FLINEARS_3271(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3270, v ds
+# define BFI_FLINEARS_3271_TICK(t)
+# define BFI_FLINEARS_3270(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3269, v ds
+# define BFI_FLINEARS_3270_TICK(t)
+# define BFI_FLINEARS_3269(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3268, v ds
+# define BFI_FLINEARS_3269_TICK(t)
+# define BFI_FLINEARS_3268(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3267, v ds
+# define BFI_FLINEARS_3268_TICK(t)
+# define BFI_FLINEARS_3267(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3266, v ds
+# define BFI_FLINEARS_3267_TICK(t)
+# define BFI_FLINEARS_3266(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3265, v ds
+# define BFI_FLINEARS_3266_TICK(t)
+# define BFI_FLINEARS_3265(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3264, v ds
+# define BFI_FLINEARS_3265_TICK(t)
+# define BFI_FLINEARS_3264(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3263, v ds
+# define BFI_FLINEARS_3264_TICK(t)
+# define BFI_FLINEARS_3263(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3262, v ds
+# define BFI_FLINEARS_3263_TICK(t)
+# define BFI_FLINEARS_3262(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3261, v ds
+# define BFI_FLINEARS_3262_TICK(t)
+# define BFI_FLINEARS_3261(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3260, v ds
+# define BFI_FLINEARS_3261_TICK(t)
+# define BFI_FLINEARS_3260(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3259, v ds
+# define BFI_FLINEARS_3260_TICK(t)
+# define BFI_FLINEARS_3259(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3258, v ds
+# define BFI_FLINEARS_3259_TICK(t)
+# define BFI_FLINEARS_3258(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3257, v ds
+# define BFI_FLINEARS_3258_TICK(t)
+# define BFI_FLINEARS_3257(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3256, v ds
+# define BFI_FLINEARS_3257_TICK(t)
+# define BFI_FLINEARS_3256(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3255, v ds
+# define BFI_FLINEARS_3256_TICK(t)
+# define BFI_FLINEARS_3255(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3254, v ds
+# define BFI_FLINEARS_3255_TICK(t)
+# define BFI_FLINEARS_3254(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3253, v ds
+# define BFI_FLINEARS_3254_TICK(t)
+# define BFI_FLINEARS_3253(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3252, v ds
+# define BFI_FLINEARS_3253_TICK(t)
+# define BFI_FLINEARS_3252(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3251, v ds
+# define BFI_FLINEARS_3252_TICK(t)
+# define BFI_FLINEARS_3251(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3250, v ds
+# define BFI_FLINEARS_3251_TICK(t)
+# define BFI_FLINEARS_3250(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3249, v ds
+# define BFI_FLINEARS_3250_TICK(t)
+# define BFI_FLINEARS_3249(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3248, v ds
+# define BFI_FLINEARS_3249_TICK(t)
+# define BFI_FLINEARS_3248(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3247, v ds
+# define BFI_FLINEARS_3248_TICK(t)
+# define BFI_FLINEARS_3247(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3246, v ds
+# define BFI_FLINEARS_3247_TICK(t)
+# define BFI_FLINEARS_3246(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3245, v ds
+# define BFI_FLINEARS_3246_TICK(t)
+# define BFI_FLINEARS_3245(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3244, v ds
+# define BFI_FLINEARS_3245_TICK(t)
+# define BFI_FLINEARS_3244(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3243, v ds
+# define BFI_FLINEARS_3244_TICK(t)
+# define BFI_FLINEARS_3243(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3242, v ds
+# define BFI_FLINEARS_3243_TICK(t)
+# define BFI_FLINEARS_3242(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3241, v ds
+# define BFI_FLINEARS_3242_TICK(t)
+# define BFI_FLINEARS_3241(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3240, v ds
+# define BFI_FLINEARS_3241_TICK(t)
+# define BFI_FLINEARS_3240(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3239, v ds
+# define BFI_FLINEARS_3240_TICK(t)
+# define BFI_FLINEARS_3239(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3238, v ds
+# define BFI_FLINEARS_3239_TICK(t)
+# define BFI_FLINEARS_3238(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3237, v ds
+# define BFI_FLINEARS_3238_TICK(t)
+# define BFI_FLINEARS_3237(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3236, v ds
+# define BFI_FLINEARS_3237_TICK(t)
+# define BFI_FLINEARS_3236(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3235, v ds
+# define BFI_FLINEARS_3236_TICK(t)
+# define BFI_FLINEARS_3235(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3234, v ds
+# define BFI_FLINEARS_3235_TICK(t)
+# define BFI_FLINEARS_3234(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3233, v ds
+# define BFI_FLINEARS_3234_TICK(t)
+# define BFI_FLINEARS_3233(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3232, v ds
+# define BFI_FLINEARS_3233_TICK(t)
+# define BFI_FLINEARS_3232(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3231, v ds
+# define BFI_FLINEARS_3232_TICK(t)
+# define BFI_FLINEARS_3231(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3230, v ds
+# define BFI_FLINEARS_3231_TICK(t)
+# define BFI_FLINEARS_3230(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3229, v ds
+# define BFI_FLINEARS_3230_TICK(t)
+# define BFI_FLINEARS_3229(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3228, v ds
+# define BFI_FLINEARS_3229_TICK(t)
+# define BFI_FLINEARS_3228(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3227, v ds
+# define BFI_FLINEARS_3228_TICK(t)
+# define BFI_FLINEARS_3227(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3226, v ds
+# define BFI_FLINEARS_3227_TICK(t)
+# define BFI_FLINEARS_3226(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3225, v ds
+# define BFI_FLINEARS_3226_TICK(t)
+# define BFI_FLINEARS_3225(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3224, v ds
+# define BFI_FLINEARS_3225_TICK(t)
+# define BFI_FLINEARS_3224(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3223, v ds
+# define BFI_FLINEARS_3224_TICK(t)
+# define BFI_FLINEARS_3223(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3222, v ds
+# define BFI_FLINEARS_3223_TICK(t)
+# define BFI_FLINEARS_3222(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3221, v ds
+# define BFI_FLINEARS_3222_TICK(t)
+# define BFI_FLINEARS_3221(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3220, v ds
+# define BFI_FLINEARS_3221_TICK(t)
+# define BFI_FLINEARS_3220(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3219, v ds
+# define BFI_FLINEARS_3220_TICK(t)
+# define BFI_FLINEARS_3219(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3218, v ds
+# define BFI_FLINEARS_3219_TICK(t)
+# define BFI_FLINEARS_3218(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3217, v ds
+# define BFI_FLINEARS_3218_TICK(t)
+# define BFI_FLINEARS_3217(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3216, v ds
+# define BFI_FLINEARS_3217_TICK(t)
+# define BFI_FLINEARS_3216(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3215, v ds
+# define BFI_FLINEARS_3216_TICK(t)
+# define BFI_FLINEARS_3215(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3214, v ds
+# define BFI_FLINEARS_3215_TICK(t)
+# define BFI_FLINEARS_3214(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3213, v ds
+# define BFI_FLINEARS_3214_TICK(t)
+# define BFI_FLINEARS_3213(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3212, v ds
+# define BFI_FLINEARS_3213_TICK(t)
+# define BFI_FLINEARS_3212(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3211, v ds
+# define BFI_FLINEARS_3212_TICK(t)
+# define BFI_FLINEARS_3211(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3210, v ds
+# define BFI_FLINEARS_3211_TICK(t)
+# define BFI_FLINEARS_3210(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3209, v ds
+# define BFI_FLINEARS_3210_TICK(t)
+# define BFI_FLINEARS_3209(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3208, v ds
+# define BFI_FLINEARS_3209_TICK(t)
+# define BFI_FLINEARS_3208(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3207, v ds
+# define BFI_FLINEARS_3208_TICK(t)
+# define BFI_FLINEARS_3207(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3206, v ds
+# define BFI_FLINEARS_3207_TICK(t)
+# define BFI_FLINEARS_3206(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3205, v ds
+# define BFI_FLINEARS_3206_TICK(t)
+# define BFI_FLINEARS_3205(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3204, v ds
+# define BFI_FLINEARS_3205_TICK(t)
+# define BFI_FLINEARS_3204(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3203, v ds
+# define BFI_FLINEARS_3204_TICK(t)
+# define BFI_FLINEARS_3203(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3202, v ds
+# define BFI_FLINEARS_3203_TICK(t)
+# define BFI_FLINEARS_3202(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3201, v ds
+# define BFI_FLINEARS_3202_TICK(t)
+# define BFI_FLINEARS_3201(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3200, v ds
+# define BFI_FLINEARS_3201_TICK(t)
+# define BFI_FLINEARS_3200(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3199, v ds
+# define BFI_FLINEARS_3200_TICK(t)
+# define BFI_FLINEARS_3199(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3198, v ds
+# define BFI_FLINEARS_3199_TICK(t)
+# define BFI_FLINEARS_3198(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3197, v ds
+# define BFI_FLINEARS_3198_TICK(t)
+# define BFI_FLINEARS_3197(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3196, v ds
+# define BFI_FLINEARS_3197_TICK(t)
+# define BFI_FLINEARS_3196(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3195, v ds
+# define BFI_FLINEARS_3196_TICK(t)
+# define BFI_FLINEARS_3195(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3194, v ds
+# define BFI_FLINEARS_3195_TICK(t)
+# define BFI_FLINEARS_3194(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3193, v ds
+# define BFI_FLINEARS_3194_TICK(t)
+# define BFI_FLINEARS_3193(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3192, v ds
+# define BFI_FLINEARS_3193_TICK(t)
+# define BFI_FLINEARS_3192(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3191, v ds
+# define BFI_FLINEARS_3192_TICK(t)
+# define BFI_FLINEARS_3191(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3190, v ds
+# define BFI_FLINEARS_3191_TICK(t)
+# define BFI_FLINEARS_3190(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3189, v ds
+# define BFI_FLINEARS_3190_TICK(t)
+# define BFI_FLINEARS_3189(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3188, v ds
+# define BFI_FLINEARS_3189_TICK(t)
+# define BFI_FLINEARS_3188(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3187, v ds
+# define BFI_FLINEARS_3188_TICK(t)
+# define BFI_FLINEARS_3187(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3186, v ds
+# define BFI_FLINEARS_3187_TICK(t)
+# define BFI_FLINEARS_3186(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3185, v ds
+# define BFI_FLINEARS_3186_TICK(t)
+# define BFI_FLINEARS_3185(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3184, v ds
+# define BFI_FLINEARS_3185_TICK(t)
+# define BFI_FLINEARS_3184(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3183, v ds
+# define BFI_FLINEARS_3184_TICK(t)
+# define BFI_FLINEARS_3183(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3182, v ds
+# define BFI_FLINEARS_3183_TICK(t)
+# define BFI_FLINEARS_3182(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3181, v ds
+# define BFI_FLINEARS_3182_TICK(t)
+# define BFI_FLINEARS_3181(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3180, v ds
+# define BFI_FLINEARS_3181_TICK(t)
+# define BFI_FLINEARS_3180(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3179, v ds
+# define BFI_FLINEARS_3180_TICK(t)
+# define BFI_FLINEARS_3179(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3178, v ds
+# define BFI_FLINEARS_3179_TICK(t)
+# define BFI_FLINEARS_3178(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3177, v ds
+# define BFI_FLINEARS_3178_TICK(t)
+# define BFI_FLINEARS_3177(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3176, v ds
+# define BFI_FLINEARS_3177_TICK(t)
+# define BFI_FLINEARS_3176(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3175, v ds
+# define BFI_FLINEARS_3176_TICK(t)
+# define BFI_FLINEARS_3175(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3174, v ds
+# define BFI_FLINEARS_3175_TICK(t)
+# define BFI_FLINEARS_3174(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3173, v ds
+# define BFI_FLINEARS_3174_TICK(t)
+# define BFI_FLINEARS_3173(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3172, v ds
+# define BFI_FLINEARS_3173_TICK(t)
+# define BFI_FLINEARS_3172(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3171, v ds
+# define BFI_FLINEARS_3172_TICK(t)
+# define BFI_FLINEARS_3171(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3170, v ds
+# define BFI_FLINEARS_3171_TICK(t)
+# define BFI_FLINEARS_3170(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3169, v ds
+# define BFI_FLINEARS_3170_TICK(t)
+# define BFI_FLINEARS_3169(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3168, v ds
+# define BFI_FLINEARS_3169_TICK(t)
+# define BFI_FLINEARS_3168(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3167, v ds
+# define BFI_FLINEARS_3168_TICK(t)
+# define BFI_FLINEARS_3167(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3166, v ds
+# define BFI_FLINEARS_3167_TICK(t)
+# define BFI_FLINEARS_3166(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3165, v ds
+# define BFI_FLINEARS_3166_TICK(t)
+# define BFI_FLINEARS_3165(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3164, v ds
+# define BFI_FLINEARS_3165_TICK(t)
+# define BFI_FLINEARS_3164(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3163, v ds
+# define BFI_FLINEARS_3164_TICK(t)
+# define BFI_FLINEARS_3163(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3162, v ds
+# define BFI_FLINEARS_3163_TICK(t)
+# define BFI_FLINEARS_3162(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3161, v ds
+# define BFI_FLINEARS_3162_TICK(t)
+# define BFI_FLINEARS_3161(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3160, v ds
+# define BFI_FLINEARS_3161_TICK(t)
+# define BFI_FLINEARS_3160(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3159, v ds
+# define BFI_FLINEARS_3160_TICK(t)
+# define BFI_FLINEARS_3159(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3158, v ds
+# define BFI_FLINEARS_3159_TICK(t)
+# define BFI_FLINEARS_3158(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3157, v ds
+# define BFI_FLINEARS_3158_TICK(t)
+# define BFI_FLINEARS_3157(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3156, v ds
+# define BFI_FLINEARS_3157_TICK(t)
+# define BFI_FLINEARS_3156(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3155, v ds
+# define BFI_FLINEARS_3156_TICK(t)
+# define BFI_FLINEARS_3155(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3154, v ds
+# define BFI_FLINEARS_3155_TICK(t)
+# define BFI_FLINEARS_3154(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3153, v ds
+# define BFI_FLINEARS_3154_TICK(t)
+# define BFI_FLINEARS_3153(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3152, v ds
+# define BFI_FLINEARS_3153_TICK(t)
+# define BFI_FLINEARS_3152(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3151, v ds
+# define BFI_FLINEARS_3152_TICK(t)
+# define BFI_FLINEARS_3151(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3150, v ds
+# define BFI_FLINEARS_3151_TICK(t)
+# define BFI_FLINEARS_3150(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3149, v ds
+# define BFI_FLINEARS_3150_TICK(t)
+# define BFI_FLINEARS_3149(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3148, v ds
+# define BFI_FLINEARS_3149_TICK(t)
+# define BFI_FLINEARS_3148(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3147, v ds
+# define BFI_FLINEARS_3148_TICK(t)
+# define BFI_FLINEARS_3147(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3146, v ds
+# define BFI_FLINEARS_3147_TICK(t)
+# define BFI_FLINEARS_3146(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3145, v ds
+# define BFI_FLINEARS_3146_TICK(t)
+# define BFI_FLINEARS_3145(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3144, v ds
+# define BFI_FLINEARS_3145_TICK(t)
+# define BFI_FLINEARS_3144(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3143, v ds
+# define BFI_FLINEARS_3144_TICK(t)
+# define BFI_FLINEARS_3143(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3142, v ds
+# define BFI_FLINEARS_3143_TICK(t)
+# define BFI_FLINEARS_3142(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3141, v ds
+# define BFI_FLINEARS_3142_TICK(t)
+# define BFI_FLINEARS_3141(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3140, v ds
+# define BFI_FLINEARS_3141_TICK(t)
+# define BFI_FLINEARS_3140(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3139, v ds
+# define BFI_FLINEARS_3140_TICK(t)
+# define BFI_FLINEARS_3139(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3138, v ds
+# define BFI_FLINEARS_3139_TICK(t)
+# define BFI_FLINEARS_3138(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3137, v ds
+# define BFI_FLINEARS_3138_TICK(t)
+# define BFI_FLINEARS_3137(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3136, v ds
+# define BFI_FLINEARS_3137_TICK(t)
+# define BFI_FLINEARS_3136(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3135, v ds
+# define BFI_FLINEARS_3136_TICK(t)
+# define BFI_FLINEARS_3135(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3134, v ds
+# define BFI_FLINEARS_3135_TICK(t)
+# define BFI_FLINEARS_3134(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3133, v ds
+# define BFI_FLINEARS_3134_TICK(t)
+# define BFI_FLINEARS_3133(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3132, v ds
+# define BFI_FLINEARS_3133_TICK(t)
+# define BFI_FLINEARS_3132(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3131, v ds
+# define BFI_FLINEARS_3132_TICK(t)
+# define BFI_FLINEARS_3131(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3130, v ds
+# define BFI_FLINEARS_3131_TICK(t)
+# define BFI_FLINEARS_3130(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3129, v ds
+# define BFI_FLINEARS_3130_TICK(t)
+# define BFI_FLINEARS_3129(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3128, v ds
+# define BFI_FLINEARS_3129_TICK(t)
+# define BFI_FLINEARS_3128(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3127, v ds
+# define BFI_FLINEARS_3128_TICK(t)
+# define BFI_FLINEARS_3127(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3126, v ds
+# define BFI_FLINEARS_3127_TICK(t)
+# define BFI_FLINEARS_3126(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3125, v ds
+# define BFI_FLINEARS_3126_TICK(t)
+# define BFI_FLINEARS_3125(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3124, v ds
+# define BFI_FLINEARS_3125_TICK(t)
+# define BFI_FLINEARS_3124(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3123, v ds
+# define BFI_FLINEARS_3124_TICK(t)
+# define BFI_FLINEARS_3123(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3122, v ds
+# define BFI_FLINEARS_3123_TICK(t)
+# define BFI_FLINEARS_3122(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3121, v ds
+# define BFI_FLINEARS_3122_TICK(t)
+# define BFI_FLINEARS_3121(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3120, v ds
+# define BFI_FLINEARS_3121_TICK(t)
+# define BFI_FLINEARS_3120(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3119, v ds
+# define BFI_FLINEARS_3120_TICK(t)
+# define BFI_FLINEARS_3119(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3118, v ds
+# define BFI_FLINEARS_3119_TICK(t)
+# define BFI_FLINEARS_3118(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3117, v ds
+# define BFI_FLINEARS_3118_TICK(t)
+# define BFI_FLINEARS_3117(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3116, v ds
+# define BFI_FLINEARS_3117_TICK(t)
+# define BFI_FLINEARS_3116(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3115, v ds
+# define BFI_FLINEARS_3116_TICK(t)
+# define BFI_FLINEARS_3115(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3114, v ds
+# define BFI_FLINEARS_3115_TICK(t)
+# define BFI_FLINEARS_3114(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3113, v ds
+# define BFI_FLINEARS_3114_TICK(t)
+# define BFI_FLINEARS_3113(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3112, v ds
+# define BFI_FLINEARS_3113_TICK(t)
+# define BFI_FLINEARS_3112(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3111, v ds
+# define BFI_FLINEARS_3112_TICK(t)
+# define BFI_FLINEARS_3111(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3110, v ds
+# define BFI_FLINEARS_3111_TICK(t)
+# define BFI_FLINEARS_3110(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3109, v ds
+# define BFI_FLINEARS_3110_TICK(t)
+# define BFI_FLINEARS_3109(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3108, v ds
+# define BFI_FLINEARS_3109_TICK(t)
+# define BFI_FLINEARS_3108(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3107, v ds
+# define BFI_FLINEARS_3108_TICK(t)
+# define BFI_FLINEARS_3107(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3106, v ds
+# define BFI_FLINEARS_3107_TICK(t)
+# define BFI_FLINEARS_3106(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3105, v ds
+# define BFI_FLINEARS_3106_TICK(t)
+# define BFI_FLINEARS_3105(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3104, v ds
+# define BFI_FLINEARS_3105_TICK(t)
+# define BFI_FLINEARS_3104(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3103, v ds
+# define BFI_FLINEARS_3104_TICK(t)
+# define BFI_FLINEARS_3103(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3102, v ds
+# define BFI_FLINEARS_3103_TICK(t)
+# define BFI_FLINEARS_3102(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3101, v ds
+# define BFI_FLINEARS_3102_TICK(t)
+# define BFI_FLINEARS_3101(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3100, v ds
+# define BFI_FLINEARS_3101_TICK(t)
+# define BFI_FLINEARS_3100(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3099, v ds
+# define BFI_FLINEARS_3100_TICK(t)
+# define BFI_FLINEARS_3099(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3098, v ds
+# define BFI_FLINEARS_3099_TICK(t)
+# define BFI_FLINEARS_3098(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3097, v ds
+# define BFI_FLINEARS_3098_TICK(t)
+# define BFI_FLINEARS_3097(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3096, v ds
+# define BFI_FLINEARS_3097_TICK(t)
+# define BFI_FLINEARS_3096(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3095, v ds
+# define BFI_FLINEARS_3096_TICK(t)
+# define BFI_FLINEARS_3095(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3094, v ds
+# define BFI_FLINEARS_3095_TICK(t)
+# define BFI_FLINEARS_3094(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3093, v ds
+# define BFI_FLINEARS_3094_TICK(t)
+# define BFI_FLINEARS_3093(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3092, v ds
+# define BFI_FLINEARS_3093_TICK(t)
+# define BFI_FLINEARS_3092(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3091, v ds
+# define BFI_FLINEARS_3092_TICK(t)
+# define BFI_FLINEARS_3091(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3090, v ds
+# define BFI_FLINEARS_3091_TICK(t)
+# define BFI_FLINEARS_3090(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3089, v ds
+# define BFI_FLINEARS_3090_TICK(t)
+# define BFI_FLINEARS_3089(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3088, v ds
+# define BFI_FLINEARS_3089_TICK(t)
+# define BFI_FLINEARS_3088(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3087, v ds
+# define BFI_FLINEARS_3088_TICK(t)
+# define BFI_FLINEARS_3087(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3086, v ds
+# define BFI_FLINEARS_3087_TICK(t)
+# define BFI_FLINEARS_3086(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3085, v ds
+# define BFI_FLINEARS_3086_TICK(t)
+# define BFI_FLINEARS_3085(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3084, v ds
+# define BFI_FLINEARS_3085_TICK(t)
+# define BFI_FLINEARS_3084(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3083, v ds
+# define BFI_FLINEARS_3084_TICK(t)
+# define BFI_FLINEARS_3083(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3082, v ds
+# define BFI_FLINEARS_3083_TICK(t)
+# define BFI_FLINEARS_3082(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3081, v ds
+# define BFI_FLINEARS_3082_TICK(t)
+# define BFI_FLINEARS_3081(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3080, v ds
+# define BFI_FLINEARS_3081_TICK(t)
+# define BFI_FLINEARS_3080(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3079, v ds
+# define BFI_FLINEARS_3080_TICK(t)
+# define BFI_FLINEARS_3079(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3078, v ds
+# define BFI_FLINEARS_3079_TICK(t)
+# define BFI_FLINEARS_3078(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3077, v ds
+# define BFI_FLINEARS_3078_TICK(t)
+# define BFI_FLINEARS_3077(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3076, v ds
+# define BFI_FLINEARS_3077_TICK(t)
+# define BFI_FLINEARS_3076(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3075, v ds
+# define BFI_FLINEARS_3076_TICK(t)
+# define BFI_FLINEARS_3075(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3074, v ds
+# define BFI_FLINEARS_3075_TICK(t)
+# define BFI_FLINEARS_3074(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3073, v ds
+# define BFI_FLINEARS_3074_TICK(t)
+# define BFI_FLINEARS_3073(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3072, v ds
+# define BFI_FLINEARS_3073_TICK(t)
+# define BFI_FLINEARS_3072(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3071, v ds
+# define BFI_FLINEARS_3072_TICK(t)
+# define BFI_FLINEARS_3071(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3070, v ds
+# define BFI_FLINEARS_3071_TICK(t)
+# define BFI_FLINEARS_3070(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3069, v ds
+# define BFI_FLINEARS_3070_TICK(t)
+# define BFI_FLINEARS_3069(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3068, v ds
+# define BFI_FLINEARS_3069_TICK(t)
+# define BFI_FLINEARS_3068(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3067, v ds
+# define BFI_FLINEARS_3068_TICK(t)
+# define BFI_FLINEARS_3067(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3066, v ds
+# define BFI_FLINEARS_3067_TICK(t)
+# define BFI_FLINEARS_3066(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3065, v ds
+# define BFI_FLINEARS_3066_TICK(t)
+# define BFI_FLINEARS_3065(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3064, v ds
+# define BFI_FLINEARS_3065_TICK(t)
+# define BFI_FLINEARS_3064(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3063, v ds
+# define BFI_FLINEARS_3064_TICK(t)
+# define BFI_FLINEARS_3063(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3062, v ds
+# define BFI_FLINEARS_3063_TICK(t)
+# define BFI_FLINEARS_3062(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3061, v ds
+# define BFI_FLINEARS_3062_TICK(t)
+# define BFI_FLINEARS_3061(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3060, v ds
+# define BFI_FLINEARS_3061_TICK(t)
+# define BFI_FLINEARS_3060(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3059, v ds
+# define BFI_FLINEARS_3060_TICK(t)
+# define BFI_FLINEARS_3059(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3058, v ds
+# define BFI_FLINEARS_3059_TICK(t)
+# define BFI_FLINEARS_3058(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3057, v ds
+# define BFI_FLINEARS_3058_TICK(t)
+# define BFI_FLINEARS_3057(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3056, v ds
+# define BFI_FLINEARS_3057_TICK(t)
+# define BFI_FLINEARS_3056(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3055, v ds
+# define BFI_FLINEARS_3056_TICK(t)
+# define BFI_FLINEARS_3055(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3054, v ds
+# define BFI_FLINEARS_3055_TICK(t)
+# define BFI_FLINEARS_3054(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3053, v ds
+# define BFI_FLINEARS_3054_TICK(t)
+# define BFI_FLINEARS_3053(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3052, v ds
+# define BFI_FLINEARS_3053_TICK(t)
+# define BFI_FLINEARS_3052(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3051, v ds
+# define BFI_FLINEARS_3052_TICK(t)
+# define BFI_FLINEARS_3051(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3050, v ds
+# define BFI_FLINEARS_3051_TICK(t)
+# define BFI_FLINEARS_3050(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3049, v ds
+# define BFI_FLINEARS_3050_TICK(t)
+# define BFI_FLINEARS_3049(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3048, v ds
+# define BFI_FLINEARS_3049_TICK(t)
+# define BFI_FLINEARS_3048(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3047, v ds
+# define BFI_FLINEARS_3048_TICK(t)
+# define BFI_FLINEARS_3047(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3046, v ds
+# define BFI_FLINEARS_3047_TICK(t)
+# define BFI_FLINEARS_3046(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3045, v ds
+# define BFI_FLINEARS_3046_TICK(t)
+# define BFI_FLINEARS_3045(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3044, v ds
+# define BFI_FLINEARS_3045_TICK(t)
+# define BFI_FLINEARS_3044(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3043, v ds
+# define BFI_FLINEARS_3044_TICK(t)
+# define BFI_FLINEARS_3043(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3042, v ds
+# define BFI_FLINEARS_3043_TICK(t)
+# define BFI_FLINEARS_3042(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3041, v ds
+# define BFI_FLINEARS_3042_TICK(t)
+# define BFI_FLINEARS_3041(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3040, v ds
+# define BFI_FLINEARS_3041_TICK(t)
+# define BFI_FLINEARS_3040(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3039, v ds
+# define BFI_FLINEARS_3040_TICK(t)
+# define BFI_FLINEARS_3039(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3038, v ds
+# define BFI_FLINEARS_3039_TICK(t)
+# define BFI_FLINEARS_3038(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3037, v ds
+# define BFI_FLINEARS_3038_TICK(t)
+# define BFI_FLINEARS_3037(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3036, v ds
+# define BFI_FLINEARS_3037_TICK(t)
+# define BFI_FLINEARS_3036(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3035, v ds
+# define BFI_FLINEARS_3036_TICK(t)
+# define BFI_FLINEARS_3035(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3034, v ds
+# define BFI_FLINEARS_3035_TICK(t)
+# define BFI_FLINEARS_3034(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3033, v ds
+# define BFI_FLINEARS_3034_TICK(t)
+# define BFI_FLINEARS_3033(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3032, v ds
+# define BFI_FLINEARS_3033_TICK(t)
+# define BFI_FLINEARS_3032(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3031, v ds
+# define BFI_FLINEARS_3032_TICK(t)
+# define BFI_FLINEARS_3031(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3030, v ds
+# define BFI_FLINEARS_3031_TICK(t)
+# define BFI_FLINEARS_3030(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3029, v ds
+# define BFI_FLINEARS_3030_TICK(t)
+# define BFI_FLINEARS_3029(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3028, v ds
+# define BFI_FLINEARS_3029_TICK(t)
+# define BFI_FLINEARS_3028(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3027, v ds
+# define BFI_FLINEARS_3028_TICK(t)
+# define BFI_FLINEARS_3027(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3026, v ds
+# define BFI_FLINEARS_3027_TICK(t)
+# define BFI_FLINEARS_3026(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3025, v ds
+# define BFI_FLINEARS_3026_TICK(t)
+# define BFI_FLINEARS_3025(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3024, v ds
+# define BFI_FLINEARS_3025_TICK(t)
+# define BFI_FLINEARS_3024(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3023, v ds
+# define BFI_FLINEARS_3024_TICK(t)
+# define BFI_FLINEARS_3023(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3022, v ds
+# define BFI_FLINEARS_3023_TICK(t)
+# define BFI_FLINEARS_3022(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3021, v ds
+# define BFI_FLINEARS_3022_TICK(t)
+# define BFI_FLINEARS_3021(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3020, v ds
+# define BFI_FLINEARS_3021_TICK(t)
+# define BFI_FLINEARS_3020(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3019, v ds
+# define BFI_FLINEARS_3020_TICK(t)
+# define BFI_FLINEARS_3019(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3018, v ds
+# define BFI_FLINEARS_3019_TICK(t)
+# define BFI_FLINEARS_3018(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3017, v ds
+# define BFI_FLINEARS_3018_TICK(t)
+# define BFI_FLINEARS_3017(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3016, v ds
+# define BFI_FLINEARS_3017_TICK(t)
+# define BFI_FLINEARS_3016(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3015, v ds
+# define BFI_FLINEARS_3016_TICK(t)
+# define BFI_FLINEARS_3015(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3014, v ds
+# define BFI_FLINEARS_3015_TICK(t)
+# define BFI_FLINEARS_3014(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3013, v ds
+# define BFI_FLINEARS_3014_TICK(t)
+# define BFI_FLINEARS_3013(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3012, v ds
+# define BFI_FLINEARS_3013_TICK(t)
+# define BFI_FLINEARS_3012(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3011, v ds
+# define BFI_FLINEARS_3012_TICK(t)
+# define BFI_FLINEARS_3011(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3010, v ds
+# define BFI_FLINEARS_3011_TICK(t)
+# define BFI_FLINEARS_3010(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3009, v ds
+# define BFI_FLINEARS_3010_TICK(t)
+# define BFI_FLINEARS_3009(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3008, v ds
+# define BFI_FLINEARS_3009_TICK(t)
+# define BFI_FLINEARS_3008(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3007, v ds
+# define BFI_FLINEARS_3008_TICK(t)
+# define BFI_FLINEARS_3007(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3006, v ds
+# define BFI_FLINEARS_3007_TICK(t)
+# define BFI_FLINEARS_3006(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3005, v ds
+# define BFI_FLINEARS_3006_TICK(t)
+# define BFI_FLINEARS_3005(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3004, v ds
+# define BFI_FLINEARS_3005_TICK(t)
+# define BFI_FLINEARS_3004(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3003, v ds
+# define BFI_FLINEARS_3004_TICK(t)
+# define BFI_FLINEARS_3003(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3002, v ds
+# define BFI_FLINEARS_3003_TICK(t)
+# define BFI_FLINEARS_3002(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3001, v ds
+# define BFI_FLINEARS_3002_TICK(t)
+# define BFI_FLINEARS_3001(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3000, v ds
+# define BFI_FLINEARS_3001_TICK(t)
+# define BFI_FLINEARS_3000(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2999, v ds
+# define BFI_FLINEARS_3000_TICK(t)
+# define BFI_FLINEARS_2999(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2998, v ds
+# define BFI_FLINEARS_2999_TICK(t)
+# define BFI_FLINEARS_2998(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2997, v ds
+# define BFI_FLINEARS_2998_TICK(t)
+# define BFI_FLINEARS_2997(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2996, v ds
+# define BFI_FLINEARS_2997_TICK(t)
+# define BFI_FLINEARS_2996(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2995, v ds
+# define BFI_FLINEARS_2996_TICK(t)
+# define BFI_FLINEARS_2995(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2994, v ds
+# define BFI_FLINEARS_2995_TICK(t)
+# define BFI_FLINEARS_2994(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2993, v ds
+# define BFI_FLINEARS_2994_TICK(t)
+# define BFI_FLINEARS_2993(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2992, v ds
+# define BFI_FLINEARS_2993_TICK(t)
+# define BFI_FLINEARS_2992(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2991, v ds
+# define BFI_FLINEARS_2992_TICK(t)
+# define BFI_FLINEARS_2991(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2990, v ds
+# define BFI_FLINEARS_2991_TICK(t)
+# define BFI_FLINEARS_2990(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2989, v ds
+# define BFI_FLINEARS_2990_TICK(t)
+# define BFI_FLINEARS_2989(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2988, v ds
+# define BFI_FLINEARS_2989_TICK(t)
+# define BFI_FLINEARS_2988(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2987, v ds
+# define BFI_FLINEARS_2988_TICK(t)
+# define BFI_FLINEARS_2987(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2986, v ds
+# define BFI_FLINEARS_2987_TICK(t)
+# define BFI_FLINEARS_2986(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2985, v ds
+# define BFI_FLINEARS_2986_TICK(t)
+# define BFI_FLINEARS_2985(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2984, v ds
+# define BFI_FLINEARS_2985_TICK(t)
+# define BFI_FLINEARS_2984(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2983, v ds
+# define BFI_FLINEARS_2984_TICK(t)
+# define BFI_FLINEARS_2983(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2982, v ds
+# define BFI_FLINEARS_2983_TICK(t)
+# define BFI_FLINEARS_2982(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2981, v ds
+# define BFI_FLINEARS_2982_TICK(t)
+# define BFI_FLINEARS_2981(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2980, v ds
+# define BFI_FLINEARS_2981_TICK(t)
+# define BFI_FLINEARS_2980(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2979, v ds
+# define BFI_FLINEARS_2980_TICK(t)
+# define BFI_FLINEARS_2979(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2978, v ds
+# define BFI_FLINEARS_2979_TICK(t)
+# define BFI_FLINEARS_2978(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2977, v ds
+# define BFI_FLINEARS_2978_TICK(t)
+# define BFI_FLINEARS_2977(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2976, v ds
+# define BFI_FLINEARS_2977_TICK(t)
+# define BFI_FLINEARS_2976(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2975, v ds
+# define BFI_FLINEARS_2976_TICK(t)
+# define BFI_FLINEARS_2975(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2974, v ds
+# define BFI_FLINEARS_2975_TICK(t)
+# define BFI_FLINEARS_2974(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2973, v ds
+# define BFI_FLINEARS_2974_TICK(t)
+# define BFI_FLINEARS_2973(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2972, v ds
+# define BFI_FLINEARS_2973_TICK(t)
+# define BFI_FLINEARS_2972(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2971, v ds
+# define BFI_FLINEARS_2972_TICK(t)
+# define BFI_FLINEARS_2971(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2970, v ds
+# define BFI_FLINEARS_2971_TICK(t)
+# define BFI_FLINEARS_2970(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2969, v ds
+# define BFI_FLINEARS_2970_TICK(t)
+# define BFI_FLINEARS_2969(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2968, v ds
+# define BFI_FLINEARS_2969_TICK(t)
+# define BFI_FLINEARS_2968(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2967, v ds
+# define BFI_FLINEARS_2968_TICK(t)
+# define BFI_FLINEARS_2967(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2966, v ds
+# define BFI_FLINEARS_2967_TICK(t)
+# define BFI_FLINEARS_2966(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2965, v ds
+# define BFI_FLINEARS_2966_TICK(t)
+# define BFI_FLINEARS_2965(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2964, v ds
+# define BFI_FLINEARS_2965_TICK(t)
+# define BFI_FLINEARS_2964(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2963, v ds
+# define BFI_FLINEARS_2964_TICK(t)
+# define BFI_FLINEARS_2963(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2962, v ds
+# define BFI_FLINEARS_2963_TICK(t)
+# define BFI_FLINEARS_2962(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2961, v ds
+# define BFI_FLINEARS_2962_TICK(t)
+# define BFI_FLINEARS_2961(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2960, v ds
+# define BFI_FLINEARS_2961_TICK(t)
+# define BFI_FLINEARS_2960(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2959, v ds
+# define BFI_FLINEARS_2960_TICK(t)
+# define BFI_FLINEARS_2959(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2958, v ds
+# define BFI_FLINEARS_2959_TICK(t)
+# define BFI_FLINEARS_2958(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2957, v ds
+# define BFI_FLINEARS_2958_TICK(t)
+# define BFI_FLINEARS_2957(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2956, v ds
+# define BFI_FLINEARS_2957_TICK(t)
+# define BFI_FLINEARS_2956(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2955, v ds
+# define BFI_FLINEARS_2956_TICK(t)
+# define BFI_FLINEARS_2955(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2954, v ds
+# define BFI_FLINEARS_2955_TICK(t)
+# define BFI_FLINEARS_2954(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2953, v ds
+# define BFI_FLINEARS_2954_TICK(t)
+# define BFI_FLINEARS_2953(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2952, v ds
+# define BFI_FLINEARS_2953_TICK(t)
+# define BFI_FLINEARS_2952(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2951, v ds
+# define BFI_FLINEARS_2952_TICK(t)
+# define BFI_FLINEARS_2951(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2950, v ds
+# define BFI_FLINEARS_2951_TICK(t)
+# define BFI_FLINEARS_2950(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2949, v ds
+# define BFI_FLINEARS_2950_TICK(t)
+# define BFI_FLINEARS_2949(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2948, v ds
+# define BFI_FLINEARS_2949_TICK(t)
+# define BFI_FLINEARS_2948(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2947, v ds
+# define BFI_FLINEARS_2948_TICK(t)
+# define BFI_FLINEARS_2947(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2946, v ds
+# define BFI_FLINEARS_2947_TICK(t)
+# define BFI_FLINEARS_2946(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2945, v ds
+# define BFI_FLINEARS_2946_TICK(t)
+# define BFI_FLINEARS_2945(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2944, v ds
+# define BFI_FLINEARS_2945_TICK(t)
+# define BFI_FLINEARS_2944(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2943, v ds
+# define BFI_FLINEARS_2944_TICK(t)
+# define BFI_FLINEARS_2943(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2942, v ds
+# define BFI_FLINEARS_2943_TICK(t)
+# define BFI_FLINEARS_2942(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2941, v ds
+# define BFI_FLINEARS_2942_TICK(t)
+# define BFI_FLINEARS_2941(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2940, v ds
+# define BFI_FLINEARS_2941_TICK(t)
+# define BFI_FLINEARS_2940(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2939, v ds
+# define BFI_FLINEARS_2940_TICK(t)
+# define BFI_FLINEARS_2939(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2938, v ds
+# define BFI_FLINEARS_2939_TICK(t)
+# define BFI_FLINEARS_2938(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2937, v ds
+# define BFI_FLINEARS_2938_TICK(t)
+# define BFI_FLINEARS_2937(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2936, v ds
+# define BFI_FLINEARS_2937_TICK(t)
+# define BFI_FLINEARS_2936(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2935, v ds
+# define BFI_FLINEARS_2936_TICK(t)
+# define BFI_FLINEARS_2935(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2934, v ds
+# define BFI_FLINEARS_2935_TICK(t)
+# define BFI_FLINEARS_2934(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2933, v ds
+# define BFI_FLINEARS_2934_TICK(t)
+# define BFI_FLINEARS_2933(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2932, v ds
+# define BFI_FLINEARS_2933_TICK(t)
+# define BFI_FLINEARS_2932(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2931, v ds
+# define BFI_FLINEARS_2932_TICK(t)
+# define BFI_FLINEARS_2931(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2930, v ds
+# define BFI_FLINEARS_2931_TICK(t)
+# define BFI_FLINEARS_2930(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2929, v ds
+# define BFI_FLINEARS_2930_TICK(t)
+# define BFI_FLINEARS_2929(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2928, v ds
+# define BFI_FLINEARS_2929_TICK(t)
+# define BFI_FLINEARS_2928(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2927, v ds
+# define BFI_FLINEARS_2928_TICK(t)
+# define BFI_FLINEARS_2927(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2926, v ds
+# define BFI_FLINEARS_2927_TICK(t)
+# define BFI_FLINEARS_2926(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2925, v ds
+# define BFI_FLINEARS_2926_TICK(t)
+# define BFI_FLINEARS_2925(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2924, v ds
+# define BFI_FLINEARS_2925_TICK(t)
+# define BFI_FLINEARS_2924(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2923, v ds
+# define BFI_FLINEARS_2924_TICK(t)
+# define BFI_FLINEARS_2923(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2922, v ds
+# define BFI_FLINEARS_2923_TICK(t)
+# define BFI_FLINEARS_2922(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2921, v ds
+# define BFI_FLINEARS_2922_TICK(t)
+# define BFI_FLINEARS_2921(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2920, v ds
+# define BFI_FLINEARS_2921_TICK(t)
+# define BFI_FLINEARS_2920(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2919, v ds
+# define BFI_FLINEARS_2920_TICK(t)
+# define BFI_FLINEARS_2919(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2918, v ds
+# define BFI_FLINEARS_2919_TICK(t)
+# define BFI_FLINEARS_2918(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2917, v ds
+# define BFI_FLINEARS_2918_TICK(t)
+# define BFI_FLINEARS_2917(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2916, v ds
+# define BFI_FLINEARS_2917_TICK(t)
+# define BFI_FLINEARS_2916(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2915, v ds
+# define BFI_FLINEARS_2916_TICK(t)
+# define BFI_FLINEARS_2915(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2914, v ds
+# define BFI_FLINEARS_2915_TICK(t)
+# define BFI_FLINEARS_2914(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2913, v ds
+# define BFI_FLINEARS_2914_TICK(t)
+# define BFI_FLINEARS_2913(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2912, v ds
+# define BFI_FLINEARS_2913_TICK(t)
+# define BFI_FLINEARS_2912(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2911, v ds
+# define BFI_FLINEARS_2912_TICK(t)
+# define BFI_FLINEARS_2911(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2910, v ds
+# define BFI_FLINEARS_2911_TICK(t)
+# define BFI_FLINEARS_2910(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2909, v ds
+# define BFI_FLINEARS_2910_TICK(t)
+# define BFI_FLINEARS_2909(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2908, v ds
+# define BFI_FLINEARS_2909_TICK(t)
+# define BFI_FLINEARS_2908(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2907, v ds
+# define BFI_FLINEARS_2908_TICK(t)
+# define BFI_FLINEARS_2907(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2906, v ds
+# define BFI_FLINEARS_2907_TICK(t)
+# define BFI_FLINEARS_2906(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2905, v ds
+# define BFI_FLINEARS_2906_TICK(t)
+# define BFI_FLINEARS_2905(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2904, v ds
+# define BFI_FLINEARS_2905_TICK(t)
+# define BFI_FLINEARS_2904(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2903, v ds
+# define BFI_FLINEARS_2904_TICK(t)
+# define BFI_FLINEARS_2903(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2902, v ds
+# define BFI_FLINEARS_2903_TICK(t)
+# define BFI_FLINEARS_2902(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2901, v ds
+# define BFI_FLINEARS_2902_TICK(t)
+# define BFI_FLINEARS_2901(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2900, v ds
+# define BFI_FLINEARS_2901_TICK(t)
+# define BFI_FLINEARS_2900(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2899, v ds
+# define BFI_FLINEARS_2900_TICK(t)
+# define BFI_FLINEARS_2899(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2898, v ds
+# define BFI_FLINEARS_2899_TICK(t)
+# define BFI_FLINEARS_2898(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2897, v ds
+# define BFI_FLINEARS_2898_TICK(t)
+# define BFI_FLINEARS_2897(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2896, v ds
+# define BFI_FLINEARS_2897_TICK(t)
+# define BFI_FLINEARS_2896(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2895, v ds
+# define BFI_FLINEARS_2896_TICK(t)
+# define BFI_FLINEARS_2895(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2894, v ds
+# define BFI_FLINEARS_2895_TICK(t)
+# define BFI_FLINEARS_2894(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2893, v ds
+# define BFI_FLINEARS_2894_TICK(t)
+# define BFI_FLINEARS_2893(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2892, v ds
+# define BFI_FLINEARS_2893_TICK(t)
+# define BFI_FLINEARS_2892(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2891, v ds
+# define BFI_FLINEARS_2892_TICK(t)
+# define BFI_FLINEARS_2891(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2890, v ds
+# define BFI_FLINEARS_2891_TICK(t)
+# define BFI_FLINEARS_2890(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2889, v ds
+# define BFI_FLINEARS_2890_TICK(t)
+# define BFI_FLINEARS_2889(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2888, v ds
+# define BFI_FLINEARS_2889_TICK(t)
+# define BFI_FLINEARS_2888(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2887, v ds
+# define BFI_FLINEARS_2888_TICK(t)
+# define BFI_FLINEARS_2887(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2886, v ds
+# define BFI_FLINEARS_2887_TICK(t)
+# define BFI_FLINEARS_2886(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2885, v ds
+# define BFI_FLINEARS_2886_TICK(t)
+# define BFI_FLINEARS_2885(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2884, v ds
+# define BFI_FLINEARS_2885_TICK(t)
+# define BFI_FLINEARS_2884(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2883, v ds
+# define BFI_FLINEARS_2884_TICK(t)
+# define BFI_FLINEARS_2883(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2882, v ds
+# define BFI_FLINEARS_2883_TICK(t)
+# define BFI_FLINEARS_2882(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2881, v ds
+# define BFI_FLINEARS_2882_TICK(t)
+# define BFI_FLINEARS_2881(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2880, v ds
+# define BFI_FLINEARS_2881_TICK(t)
+# define BFI_FLINEARS_2880(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2879, v ds
+# define BFI_FLINEARS_2880_TICK(t)
+# define BFI_FLINEARS_2879(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2878, v ds
+# define BFI_FLINEARS_2879_TICK(t)
+# define BFI_FLINEARS_2878(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2877, v ds
+# define BFI_FLINEARS_2878_TICK(t)
+# define BFI_FLINEARS_2877(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2876, v ds
+# define BFI_FLINEARS_2877_TICK(t)
+# define BFI_FLINEARS_2876(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2875, v ds
+# define BFI_FLINEARS_2876_TICK(t)
+# define BFI_FLINEARS_2875(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2874, v ds
+# define BFI_FLINEARS_2875_TICK(t)
+# define BFI_FLINEARS_2874(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2873, v ds
+# define BFI_FLINEARS_2874_TICK(t)
+# define BFI_FLINEARS_2873(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2872, v ds
+# define BFI_FLINEARS_2873_TICK(t)
+# define BFI_FLINEARS_2872(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2871, v ds
+# define BFI_FLINEARS_2872_TICK(t)
+# define BFI_FLINEARS_2871(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2870, v ds
+# define BFI_FLINEARS_2871_TICK(t)
+# define BFI_FLINEARS_2870(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2869, v ds
+# define BFI_FLINEARS_2870_TICK(t)
+# define BFI_FLINEARS_2869(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2868, v ds
+# define BFI_FLINEARS_2869_TICK(t)
+# define BFI_FLINEARS_2868(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2867, v ds
+# define BFI_FLINEARS_2868_TICK(t)
+# define BFI_FLINEARS_2867(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2866, v ds
+# define BFI_FLINEARS_2867_TICK(t)
+# define BFI_FLINEARS_2866(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2865, v ds
+# define BFI_FLINEARS_2866_TICK(t)
+# define BFI_FLINEARS_2865(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2864, v ds
+# define BFI_FLINEARS_2865_TICK(t)
+# define BFI_FLINEARS_2864(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2863, v ds
+# define BFI_FLINEARS_2864_TICK(t)
+# define BFI_FLINEARS_2863(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2862, v ds
+# define BFI_FLINEARS_2863_TICK(t)
+# define BFI_FLINEARS_2862(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2861, v ds
+# define BFI_FLINEARS_2862_TICK(t)
+# define BFI_FLINEARS_2861(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2860, v ds
+# define BFI_FLINEARS_2861_TICK(t)
+# define BFI_FLINEARS_2860(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2859, v ds
+# define BFI_FLINEARS_2860_TICK(t)
+# define BFI_FLINEARS_2859(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2858, v ds
+# define BFI_FLINEARS_2859_TICK(t)
+# define BFI_FLINEARS_2858(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2857, v ds
+# define BFI_FLINEARS_2858_TICK(t)
+# define BFI_FLINEARS_2857(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2856, v ds
+# define BFI_FLINEARS_2857_TICK(t)
+# define BFI_FLINEARS_2856(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2855, v ds
+# define BFI_FLINEARS_2856_TICK(t)
+# define BFI_FLINEARS_2855(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2854, v ds
+# define BFI_FLINEARS_2855_TICK(t)
+# define BFI_FLINEARS_2854(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2853, v ds
+# define BFI_FLINEARS_2854_TICK(t)
+# define BFI_FLINEARS_2853(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2852, v ds
+# define BFI_FLINEARS_2853_TICK(t)
+# define BFI_FLINEARS_2852(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2851, v ds
+# define BFI_FLINEARS_2852_TICK(t)
+# define BFI_FLINEARS_2851(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2850, v ds
+# define BFI_FLINEARS_2851_TICK(t)
+# define BFI_FLINEARS_2850(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2849, v ds
+# define BFI_FLINEARS_2850_TICK(t)
+# define BFI_FLINEARS_2849(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2848, v ds
+# define BFI_FLINEARS_2849_TICK(t)
+# define BFI_FLINEARS_2848(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2847, v ds
+# define BFI_FLINEARS_2848_TICK(t)
+# define BFI_FLINEARS_2847(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2846, v ds
+# define BFI_FLINEARS_2847_TICK(t)
+# define BFI_FLINEARS_2846(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2845, v ds
+# define BFI_FLINEARS_2846_TICK(t)
+# define BFI_FLINEARS_2845(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2844, v ds
+# define BFI_FLINEARS_2845_TICK(t)
+# define BFI_FLINEARS_2844(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2843, v ds
+# define BFI_FLINEARS_2844_TICK(t)
+# define BFI_FLINEARS_2843(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2842, v ds
+# define BFI_FLINEARS_2843_TICK(t)
+# define BFI_FLINEARS_2842(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2841, v ds
+# define BFI_FLINEARS_2842_TICK(t)
+# define BFI_FLINEARS_2841(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2840, v ds
+# define BFI_FLINEARS_2841_TICK(t)
+# define BFI_FLINEARS_2840(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2839, v ds
+# define BFI_FLINEARS_2840_TICK(t)
+# define BFI_FLINEARS_2839(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2838, v ds
+# define BFI_FLINEARS_2839_TICK(t)
+# define BFI_FLINEARS_2838(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2837, v ds
+# define BFI_FLINEARS_2838_TICK(t)
+# define BFI_FLINEARS_2837(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2836, v ds
+# define BFI_FLINEARS_2837_TICK(t)
+# define BFI_FLINEARS_2836(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2835, v ds
+# define BFI_FLINEARS_2836_TICK(t)
+# define BFI_FLINEARS_2835(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2834, v ds
+# define BFI_FLINEARS_2835_TICK(t)
+# define BFI_FLINEARS_2834(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2833, v ds
+# define BFI_FLINEARS_2834_TICK(t)
+# define BFI_FLINEARS_2833(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2832, v ds
+# define BFI_FLINEARS_2833_TICK(t)
+# define BFI_FLINEARS_2832(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2831, v ds
+# define BFI_FLINEARS_2832_TICK(t)
+# define BFI_FLINEARS_2831(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2830, v ds
+# define BFI_FLINEARS_2831_TICK(t)
+# define BFI_FLINEARS_2830(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2829, v ds
+# define BFI_FLINEARS_2830_TICK(t)
+# define BFI_FLINEARS_2829(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2828, v ds
+# define BFI_FLINEARS_2829_TICK(t)
+# define BFI_FLINEARS_2828(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2827, v ds
+# define BFI_FLINEARS_2828_TICK(t)
+# define BFI_FLINEARS_2827(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2826, v ds
+# define BFI_FLINEARS_2827_TICK(t)
+# define BFI_FLINEARS_2826(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2825, v ds
+# define BFI_FLINEARS_2826_TICK(t)
+# define BFI_FLINEARS_2825(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2824, v ds
+# define BFI_FLINEARS_2825_TICK(t)
+# define BFI_FLINEARS_2824(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2823, v ds
+# define BFI_FLINEARS_2824_TICK(t)
+# define BFI_FLINEARS_2823(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2822, v ds
+# define BFI_FLINEARS_2823_TICK(t)
+# define BFI_FLINEARS_2822(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2821, v ds
+# define BFI_FLINEARS_2822_TICK(t)
+# define BFI_FLINEARS_2821(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2820, v ds
+# define BFI_FLINEARS_2821_TICK(t)
+# define BFI_FLINEARS_2820(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2819, v ds
+# define BFI_FLINEARS_2820_TICK(t)
+# define BFI_FLINEARS_2819(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2818, v ds
+# define BFI_FLINEARS_2819_TICK(t)
+# define BFI_FLINEARS_2818(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2817, v ds
+# define BFI_FLINEARS_2818_TICK(t)
+# define BFI_FLINEARS_2817(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2816, v ds
+# define BFI_FLINEARS_2817_TICK(t)
+# define BFI_FLINEARS_2816(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2815, v ds
+# define BFI_FLINEARS_2816_TICK(t)
+# define BFI_FLINEARS_2815(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2814, v ds
+# define BFI_FLINEARS_2815_TICK(t)
+# define BFI_FLINEARS_2814(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2813, v ds
+# define BFI_FLINEARS_2814_TICK(t)
+# define BFI_FLINEARS_2813(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2812, v ds
+# define BFI_FLINEARS_2813_TICK(t)
+# define BFI_FLINEARS_2812(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2811, v ds
+# define BFI_FLINEARS_2812_TICK(t)
+# define BFI_FLINEARS_2811(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2810, v ds
+# define BFI_FLINEARS_2811_TICK(t)
+# define BFI_FLINEARS_2810(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2809, v ds
+# define BFI_FLINEARS_2810_TICK(t)
+# define BFI_FLINEARS_2809(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2808, v ds
+# define BFI_FLINEARS_2809_TICK(t)
+# define BFI_FLINEARS_2808(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2807, v ds
+# define BFI_FLINEARS_2808_TICK(t)
+# define BFI_FLINEARS_2807(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2806, v ds
+# define BFI_FLINEARS_2807_TICK(t)
+# define BFI_FLINEARS_2806(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2805, v ds
+# define BFI_FLINEARS_2806_TICK(t)
+# define BFI_FLINEARS_2805(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2804, v ds
+# define BFI_FLINEARS_2805_TICK(t)
+# define BFI_FLINEARS_2804(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2803, v ds
+# define BFI_FLINEARS_2804_TICK(t)
+# define BFI_FLINEARS_2803(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2802, v ds
+# define BFI_FLINEARS_2803_TICK(t)
+# define BFI_FLINEARS_2802(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2801, v ds
+# define BFI_FLINEARS_2802_TICK(t)
+# define BFI_FLINEARS_2801(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2800, v ds
+# define BFI_FLINEARS_2801_TICK(t)
+# define BFI_FLINEARS_2800(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2799, v ds
+# define BFI_FLINEARS_2800_TICK(t)
+# define BFI_FLINEARS_2799(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2798, v ds
+# define BFI_FLINEARS_2799_TICK(t)
+# define BFI_FLINEARS_2798(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2797, v ds
+# define BFI_FLINEARS_2798_TICK(t)
+# define BFI_FLINEARS_2797(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2796, v ds
+# define BFI_FLINEARS_2797_TICK(t)
+# define BFI_FLINEARS_2796(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2795, v ds
+# define BFI_FLINEARS_2796_TICK(t)
+# define BFI_FLINEARS_2795(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2794, v ds
+# define BFI_FLINEARS_2795_TICK(t)
+# define BFI_FLINEARS_2794(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2793, v ds
+# define BFI_FLINEARS_2794_TICK(t)
+# define BFI_FLINEARS_2793(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2792, v ds
+# define BFI_FLINEARS_2793_TICK(t)
+# define BFI_FLINEARS_2792(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2791, v ds
+# define BFI_FLINEARS_2792_TICK(t)
+# define BFI_FLINEARS_2791(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2790, v ds
+# define BFI_FLINEARS_2791_TICK(t)
+# define BFI_FLINEARS_2790(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2789, v ds
+# define BFI_FLINEARS_2790_TICK(t)
+# define BFI_FLINEARS_2789(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2788, v ds
+# define BFI_FLINEARS_2789_TICK(t)
+# define BFI_FLINEARS_2788(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2787, v ds
+# define BFI_FLINEARS_2788_TICK(t)
+# define BFI_FLINEARS_2787(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2786, v ds
+# define BFI_FLINEARS_2787_TICK(t)
+# define BFI_FLINEARS_2786(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2785, v ds
+# define BFI_FLINEARS_2786_TICK(t)
+# define BFI_FLINEARS_2785(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2784, v ds
+# define BFI_FLINEARS_2785_TICK(t)
+# define BFI_FLINEARS_2784(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2783, v ds
+# define BFI_FLINEARS_2784_TICK(t)
+# define BFI_FLINEARS_2783(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2782, v ds
+# define BFI_FLINEARS_2783_TICK(t)
+# define BFI_FLINEARS_2782(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2781, v ds
+# define BFI_FLINEARS_2782_TICK(t)
+# define BFI_FLINEARS_2781(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2780, v ds
+# define BFI_FLINEARS_2781_TICK(t)
+# define BFI_FLINEARS_2780(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2779, v ds
+# define BFI_FLINEARS_2780_TICK(t)
+# define BFI_FLINEARS_2779(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2778, v ds
+# define BFI_FLINEARS_2779_TICK(t)
+# define BFI_FLINEARS_2778(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2777, v ds
+# define BFI_FLINEARS_2778_TICK(t)
+# define BFI_FLINEARS_2777(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2776, v ds
+# define BFI_FLINEARS_2777_TICK(t)
+# define BFI_FLINEARS_2776(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2775, v ds
+# define BFI_FLINEARS_2776_TICK(t)
+# define BFI_FLINEARS_2775(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2774, v ds
+# define BFI_FLINEARS_2775_TICK(t)
+# define BFI_FLINEARS_2774(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2773, v ds
+# define BFI_FLINEARS_2774_TICK(t)
+# define BFI_FLINEARS_2773(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2772, v ds
+# define BFI_FLINEARS_2773_TICK(t)
+# define BFI_FLINEARS_2772(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2771, v ds
+# define BFI_FLINEARS_2772_TICK(t)
+# define BFI_FLINEARS_2771(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2770, v ds
+# define BFI_FLINEARS_2771_TICK(t)
+# define BFI_FLINEARS_2770(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2769, v ds
+# define BFI_FLINEARS_2770_TICK(t)
+# define BFI_FLINEARS_2769(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2768, v ds
+# define BFI_FLINEARS_2769_TICK(t)
+# define BFI_FLINEARS_2768(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2767, v ds
+# define BFI_FLINEARS_2768_TICK(t)
+# define BFI_FLINEARS_2767(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2766, v ds
+# define BFI_FLINEARS_2767_TICK(t)
+# define BFI_FLINEARS_2766(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2765, v ds
+# define BFI_FLINEARS_2766_TICK(t)
+# define BFI_FLINEARS_2765(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2764, v ds
+# define BFI_FLINEARS_2765_TICK(t)
+# define BFI_FLINEARS_2764(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2763, v ds
+# define BFI_FLINEARS_2764_TICK(t)
+# define BFI_FLINEARS_2763(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2762, v ds
+# define BFI_FLINEARS_2763_TICK(t)
+# define BFI_FLINEARS_2762(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2761, v ds
+# define BFI_FLINEARS_2762_TICK(t)
+# define BFI_FLINEARS_2761(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2760, v ds
+# define BFI_FLINEARS_2761_TICK(t)
+# define BFI_FLINEARS_2760(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2759, v ds
+# define BFI_FLINEARS_2760_TICK(t)
+# define BFI_FLINEARS_2759(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2758, v ds
+# define BFI_FLINEARS_2759_TICK(t)
+# define BFI_FLINEARS_2758(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2757, v ds
+# define BFI_FLINEARS_2758_TICK(t)
+# define BFI_FLINEARS_2757(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2756, v ds
+# define BFI_FLINEARS_2757_TICK(t)
+# define BFI_FLINEARS_2756(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2755, v ds
+# define BFI_FLINEARS_2756_TICK(t)
+# define BFI_FLINEARS_2755(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2754, v ds
+# define BFI_FLINEARS_2755_TICK(t)
+# define BFI_FLINEARS_2754(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2753, v ds
+# define BFI_FLINEARS_2754_TICK(t)
+# define BFI_FLINEARS_2753(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2752, v ds
+# define BFI_FLINEARS_2753_TICK(t)
+# define BFI_FLINEARS_2752(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2751, v ds
+# define BFI_FLINEARS_2752_TICK(t)
+# define BFI_FLINEARS_2751(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2750, v ds
+# define BFI_FLINEARS_2751_TICK(t)
+# define BFI_FLINEARS_2750(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2749, v ds
+# define BFI_FLINEARS_2750_TICK(t)
+# define BFI_FLINEARS_2749(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2748, v ds
+# define BFI_FLINEARS_2749_TICK(t)
+# define BFI_FLINEARS_2748(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2747, v ds
+# define BFI_FLINEARS_2748_TICK(t)
+# define BFI_FLINEARS_2747(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2746, v ds
+# define BFI_FLINEARS_2747_TICK(t)
+# define BFI_FLINEARS_2746(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2745, v ds
+# define BFI_FLINEARS_2746_TICK(t)
+# define BFI_FLINEARS_2745(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2744, v ds
+# define BFI_FLINEARS_2745_TICK(t)
+# define BFI_FLINEARS_2744(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2743, v ds
+# define BFI_FLINEARS_2744_TICK(t)
+# define BFI_FLINEARS_2743(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2742, v ds
+# define BFI_FLINEARS_2743_TICK(t)
+# define BFI_FLINEARS_2742(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2741, v ds
+# define BFI_FLINEARS_2742_TICK(t)
+# define BFI_FLINEARS_2741(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2740, v ds
+# define BFI_FLINEARS_2741_TICK(t)
+# define BFI_FLINEARS_2740(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2739, v ds
+# define BFI_FLINEARS_2740_TICK(t)
+# define BFI_FLINEARS_2739(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2738, v ds
+# define BFI_FLINEARS_2739_TICK(t)
+# define BFI_FLINEARS_2738(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2737, v ds
+# define BFI_FLINEARS_2738_TICK(t)
+# define BFI_FLINEARS_2737(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2736, v ds
+# define BFI_FLINEARS_2737_TICK(t)
+# define BFI_FLINEARS_2736(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2735, v ds
+# define BFI_FLINEARS_2736_TICK(t)
+# define BFI_FLINEARS_2735(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2734, v ds
+# define BFI_FLINEARS_2735_TICK(t)
+# define BFI_FLINEARS_2734(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2733, v ds
+# define BFI_FLINEARS_2734_TICK(t)
+# define BFI_FLINEARS_2733(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2732, v ds
+# define BFI_FLINEARS_2733_TICK(t)
+# define BFI_FLINEARS_2732(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2731, v ds
+# define BFI_FLINEARS_2732_TICK(t)
+# define BFI_FLINEARS_2731(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2730, v ds
+# define BFI_FLINEARS_2731_TICK(t)
+# define BFI_FLINEARS_2730(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2729, v ds
+# define BFI_FLINEARS_2730_TICK(t)
+# define BFI_FLINEARS_2729(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2728, v ds
+# define BFI_FLINEARS_2729_TICK(t)
+# define BFI_FLINEARS_2728(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2727, v ds
+# define BFI_FLINEARS_2728_TICK(t)
+# define BFI_FLINEARS_2727(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2726, v ds
+# define BFI_FLINEARS_2727_TICK(t)
+# define BFI_FLINEARS_2726(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2725, v ds
+# define BFI_FLINEARS_2726_TICK(t)
+# define BFI_FLINEARS_2725(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2724, v ds
+# define BFI_FLINEARS_2725_TICK(t)
+# define BFI_FLINEARS_2724(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2723, v ds
+# define BFI_FLINEARS_2724_TICK(t)
+# define BFI_FLINEARS_2723(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2722, v ds
+# define BFI_FLINEARS_2723_TICK(t)
+# define BFI_FLINEARS_2722(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2721, v ds
+# define BFI_FLINEARS_2722_TICK(t)
+# define BFI_FLINEARS_2721(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2720, v ds
+# define BFI_FLINEARS_2721_TICK(t)
+# define BFI_FLINEARS_2720(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2719, v ds
+# define BFI_FLINEARS_2720_TICK(t)
+# define BFI_FLINEARS_2719(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2718, v ds
+# define BFI_FLINEARS_2719_TICK(t)
+# define BFI_FLINEARS_2718(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2717, v ds
+# define BFI_FLINEARS_2718_TICK(t)
+# define BFI_FLINEARS_2717(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2716, v ds
+# define BFI_FLINEARS_2717_TICK(t)
+# define BFI_FLINEARS_2716(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2715, v ds
+# define BFI_FLINEARS_2716_TICK(t)
+# define BFI_FLINEARS_2715(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2714, v ds
+# define BFI_FLINEARS_2715_TICK(t)
+# define BFI_FLINEARS_2714(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2713, v ds
+# define BFI_FLINEARS_2714_TICK(t)
+# define BFI_FLINEARS_2713(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2712, v ds
+# define BFI_FLINEARS_2713_TICK(t)
+# define BFI_FLINEARS_2712(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2711, v ds
+# define BFI_FLINEARS_2712_TICK(t)
+# define BFI_FLINEARS_2711(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2710, v ds
+# define BFI_FLINEARS_2711_TICK(t)
+# define BFI_FLINEARS_2710(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2709, v ds
+# define BFI_FLINEARS_2710_TICK(t)
+# define BFI_FLINEARS_2709(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2708, v ds
+# define BFI_FLINEARS_2709_TICK(t)
+# define BFI_FLINEARS_2708(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2707, v ds
+# define BFI_FLINEARS_2708_TICK(t)
+# define BFI_FLINEARS_2707(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2706, v ds
+# define BFI_FLINEARS_2707_TICK(t)
+# define BFI_FLINEARS_2706(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2705, v ds
+# define BFI_FLINEARS_2706_TICK(t)
+# define BFI_FLINEARS_2705(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2704, v ds
+# define BFI_FLINEARS_2705_TICK(t)
+# define BFI_FLINEARS_2704(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2703, v ds
+# define BFI_FLINEARS_2704_TICK(t)
+# define BFI_FLINEARS_2703(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2702, v ds
+# define BFI_FLINEARS_2703_TICK(t)
+# define BFI_FLINEARS_2702(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2701, v ds
+# define BFI_FLINEARS_2702_TICK(t)
+# define BFI_FLINEARS_2701(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2700, v ds
+# define BFI_FLINEARS_2701_TICK(t)
+# define BFI_FLINEARS_2700(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2699, v ds
+# define BFI_FLINEARS_2700_TICK(t)
+# define BFI_FLINEARS_2699(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2698, v ds
+# define BFI_FLINEARS_2699_TICK(t)
+# define BFI_FLINEARS_2698(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2697, v ds
+# define BFI_FLINEARS_2698_TICK(t)
+# define BFI_FLINEARS_2697(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2696, v ds
+# define BFI_FLINEARS_2697_TICK(t)
+# define BFI_FLINEARS_2696(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2695, v ds
+# define BFI_FLINEARS_2696_TICK(t)
+# define BFI_FLINEARS_2695(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2694, v ds
+# define BFI_FLINEARS_2695_TICK(t)
+# define BFI_FLINEARS_2694(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2693, v ds
+# define BFI_FLINEARS_2694_TICK(t)
+# define BFI_FLINEARS_2693(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2692, v ds
+# define BFI_FLINEARS_2693_TICK(t)
+# define BFI_FLINEARS_2692(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2691, v ds
+# define BFI_FLINEARS_2692_TICK(t)
+# define BFI_FLINEARS_2691(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2690, v ds
+# define BFI_FLINEARS_2691_TICK(t)
+# define BFI_FLINEARS_2690(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2689, v ds
+# define BFI_FLINEARS_2690_TICK(t)
+# define BFI_FLINEARS_2689(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2688, v ds
+# define BFI_FLINEARS_2689_TICK(t)
+# define BFI_FLINEARS_2688(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2687, v ds
+# define BFI_FLINEARS_2688_TICK(t)
+# define BFI_FLINEARS_2687(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2686, v ds
+# define BFI_FLINEARS_2687_TICK(t)
+# define BFI_FLINEARS_2686(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2685, v ds
+# define BFI_FLINEARS_2686_TICK(t)
+# define BFI_FLINEARS_2685(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2684, v ds
+# define BFI_FLINEARS_2685_TICK(t)
+# define BFI_FLINEARS_2684(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2683, v ds
+# define BFI_FLINEARS_2684_TICK(t)
+# define BFI_FLINEARS_2683(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2682, v ds
+# define BFI_FLINEARS_2683_TICK(t)
+# define BFI_FLINEARS_2682(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2681, v ds
+# define BFI_FLINEARS_2682_TICK(t)
+# define BFI_FLINEARS_2681(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2680, v ds
+# define BFI_FLINEARS_2681_TICK(t)
+# define BFI_FLINEARS_2680(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2679, v ds
+# define BFI_FLINEARS_2680_TICK(t)
+# define BFI_FLINEARS_2679(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2678, v ds
+# define BFI_FLINEARS_2679_TICK(t)
+# define BFI_FLINEARS_2678(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2677, v ds
+# define BFI_FLINEARS_2678_TICK(t)
+# define BFI_FLINEARS_2677(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2676, v ds
+# define BFI_FLINEARS_2677_TICK(t)
+# define BFI_FLINEARS_2676(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2675, v ds
+# define BFI_FLINEARS_2676_TICK(t)
+# define BFI_FLINEARS_2675(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2674, v ds
+# define BFI_FLINEARS_2675_TICK(t)
+# define BFI_FLINEARS_2674(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2673, v ds
+# define BFI_FLINEARS_2674_TICK(t)
+# define BFI_FLINEARS_2673(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2672, v ds
+# define BFI_FLINEARS_2673_TICK(t)
+# define BFI_FLINEARS_2672(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2671, v ds
+# define BFI_FLINEARS_2672_TICK(t)
+# define BFI_FLINEARS_2671(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2670, v ds
+# define BFI_FLINEARS_2671_TICK(t)
+# define BFI_FLINEARS_2670(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2669, v ds
+# define BFI_FLINEARS_2670_TICK(t)
+# define BFI_FLINEARS_2669(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2668, v ds
+# define BFI_FLINEARS_2669_TICK(t)
+# define BFI_FLINEARS_2668(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2667, v ds
+# define BFI_FLINEARS_2668_TICK(t)
+# define BFI_FLINEARS_2667(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2666, v ds
+# define BFI_FLINEARS_2667_TICK(t)
+# define BFI_FLINEARS_2666(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2665, v ds
+# define BFI_FLINEARS_2666_TICK(t)
+# define BFI_FLINEARS_2665(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2664, v ds
+# define BFI_FLINEARS_2665_TICK(t)
+# define BFI_FLINEARS_2664(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2663, v ds
+# define BFI_FLINEARS_2664_TICK(t)
+# define BFI_FLINEARS_2663(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2662, v ds
+# define BFI_FLINEARS_2663_TICK(t)
+# define BFI_FLINEARS_2662(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2661, v ds
+# define BFI_FLINEARS_2662_TICK(t)
+# define BFI_FLINEARS_2661(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2660, v ds
+# define BFI_FLINEARS_2661_TICK(t)
+# define BFI_FLINEARS_2660(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2659, v ds
+# define BFI_FLINEARS_2660_TICK(t)
+# define BFI_FLINEARS_2659(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2658, v ds
+# define BFI_FLINEARS_2659_TICK(t)
+# define BFI_FLINEARS_2658(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2657, v ds
+# define BFI_FLINEARS_2658_TICK(t)
+# define BFI_FLINEARS_2657(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2656, v ds
+# define BFI_FLINEARS_2657_TICK(t)
+# define BFI_FLINEARS_2656(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2655, v ds
+# define BFI_FLINEARS_2656_TICK(t)
+# define BFI_FLINEARS_2655(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2654, v ds
+# define BFI_FLINEARS_2655_TICK(t)
+# define BFI_FLINEARS_2654(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2653, v ds
+# define BFI_FLINEARS_2654_TICK(t)
+# define BFI_FLINEARS_2653(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2652, v ds
+# define BFI_FLINEARS_2653_TICK(t)
+# define BFI_FLINEARS_2652(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2651, v ds
+# define BFI_FLINEARS_2652_TICK(t)
+# define BFI_FLINEARS_2651(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2650, v ds
+# define BFI_FLINEARS_2651_TICK(t)
+# define BFI_FLINEARS_2650(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2649, v ds
+# define BFI_FLINEARS_2650_TICK(t)
+# define BFI_FLINEARS_2649(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2648, v ds
+# define BFI_FLINEARS_2649_TICK(t)
+# define BFI_FLINEARS_2648(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2647, v ds
+# define BFI_FLINEARS_2648_TICK(t)
+# define BFI_FLINEARS_2647(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2646, v ds
+# define BFI_FLINEARS_2647_TICK(t)
+# define BFI_FLINEARS_2646(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2645, v ds
+# define BFI_FLINEARS_2646_TICK(t)
+# define BFI_FLINEARS_2645(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2644, v ds
+# define BFI_FLINEARS_2645_TICK(t)
+# define BFI_FLINEARS_2644(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2643, v ds
+# define BFI_FLINEARS_2644_TICK(t)
+# define BFI_FLINEARS_2643(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2642, v ds
+# define BFI_FLINEARS_2643_TICK(t)
+# define BFI_FLINEARS_2642(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2641, v ds
+# define BFI_FLINEARS_2642_TICK(t)
+# define BFI_FLINEARS_2641(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2640, v ds
+# define BFI_FLINEARS_2641_TICK(t)
+# define BFI_FLINEARS_2640(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2639, v ds
+# define BFI_FLINEARS_2640_TICK(t)
+# define BFI_FLINEARS_2639(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2638, v ds
+# define BFI_FLINEARS_2639_TICK(t)
+# define BFI_FLINEARS_2638(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2637, v ds
+# define BFI_FLINEARS_2638_TICK(t)
+# define BFI_FLINEARS_2637(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2636, v ds
+# define BFI_FLINEARS_2637_TICK(t)
+# define BFI_FLINEARS_2636(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2635, v ds
+# define BFI_FLINEARS_2636_TICK(t)
+# define BFI_FLINEARS_2635(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2634, v ds
+# define BFI_FLINEARS_2635_TICK(t)
+# define BFI_FLINEARS_2634(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2633, v ds
+# define BFI_FLINEARS_2634_TICK(t)
+# define BFI_FLINEARS_2633(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2632, v ds
+# define BFI_FLINEARS_2633_TICK(t)
+# define BFI_FLINEARS_2632(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2631, v ds
+# define BFI_FLINEARS_2632_TICK(t)
+# define BFI_FLINEARS_2631(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2630, v ds
+# define BFI_FLINEARS_2631_TICK(t)
+# define BFI_FLINEARS_2630(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2629, v ds
+# define BFI_FLINEARS_2630_TICK(t)
+# define BFI_FLINEARS_2629(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2628, v ds
+# define BFI_FLINEARS_2629_TICK(t)
+# define BFI_FLINEARS_2628(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2627, v ds
+# define BFI_FLINEARS_2628_TICK(t)
+# define BFI_FLINEARS_2627(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2626, v ds
+# define BFI_FLINEARS_2627_TICK(t)
+# define BFI_FLINEARS_2626(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2625, v ds
+# define BFI_FLINEARS_2626_TICK(t)
+# define BFI_FLINEARS_2625(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2624, v ds
+# define BFI_FLINEARS_2625_TICK(t)
+# define BFI_FLINEARS_2624(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2623, v ds
+# define BFI_FLINEARS_2624_TICK(t)
+# define BFI_FLINEARS_2623(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2622, v ds
+# define BFI_FLINEARS_2623_TICK(t)
+# define BFI_FLINEARS_2622(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2621, v ds
+# define BFI_FLINEARS_2622_TICK(t)
+# define BFI_FLINEARS_2621(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2620, v ds
+# define BFI_FLINEARS_2621_TICK(t)
+# define BFI_FLINEARS_2620(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2619, v ds
+# define BFI_FLINEARS_2620_TICK(t)
+# define BFI_FLINEARS_2619(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2618, v ds
+# define BFI_FLINEARS_2619_TICK(t)
+# define BFI_FLINEARS_2618(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2617, v ds
+# define BFI_FLINEARS_2618_TICK(t)
+# define BFI_FLINEARS_2617(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2616, v ds
+# define BFI_FLINEARS_2617_TICK(t)
+# define BFI_FLINEARS_2616(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2615, v ds
+# define BFI_FLINEARS_2616_TICK(t)
+# define BFI_FLINEARS_2615(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2614, v ds
+# define BFI_FLINEARS_2615_TICK(t)
+# define BFI_FLINEARS_2614(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2613, v ds
+# define BFI_FLINEARS_2614_TICK(t)
+# define BFI_FLINEARS_2613(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2612, v ds
+# define BFI_FLINEARS_2613_TICK(t)
+# define BFI_FLINEARS_2612(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2611, v ds
+# define BFI_FLINEARS_2612_TICK(t)
+# define BFI_FLINEARS_2611(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2610, v ds
+# define BFI_FLINEARS_2611_TICK(t)
+# define BFI_FLINEARS_2610(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2609, v ds
+# define BFI_FLINEARS_2610_TICK(t)
+# define BFI_FLINEARS_2609(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2608, v ds
+# define BFI_FLINEARS_2609_TICK(t)
+# define BFI_FLINEARS_2608(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2607, v ds
+# define BFI_FLINEARS_2608_TICK(t)
+# define BFI_FLINEARS_2607(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2606, v ds
+# define BFI_FLINEARS_2607_TICK(t)
+# define BFI_FLINEARS_2606(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2605, v ds
+# define BFI_FLINEARS_2606_TICK(t)
+# define BFI_FLINEARS_2605(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2604, v ds
+# define BFI_FLINEARS_2605_TICK(t)
+# define BFI_FLINEARS_2604(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2603, v ds
+# define BFI_FLINEARS_2604_TICK(t)
+# define BFI_FLINEARS_2603(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2602, v ds
+# define BFI_FLINEARS_2603_TICK(t)
+# define BFI_FLINEARS_2602(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2601, v ds
+# define BFI_FLINEARS_2602_TICK(t)
+# define BFI_FLINEARS_2601(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2600, v ds
+# define BFI_FLINEARS_2601_TICK(t)
+# define BFI_FLINEARS_2600(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2599, v ds
+# define BFI_FLINEARS_2600_TICK(t)
+# define BFI_FLINEARS_2599(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2598, v ds
+# define BFI_FLINEARS_2599_TICK(t)
+# define BFI_FLINEARS_2598(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2597, v ds
+# define BFI_FLINEARS_2598_TICK(t)
+# define BFI_FLINEARS_2597(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2596, v ds
+# define BFI_FLINEARS_2597_TICK(t)
+# define BFI_FLINEARS_2596(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2595, v ds
+# define BFI_FLINEARS_2596_TICK(t)
+# define BFI_FLINEARS_2595(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2594, v ds
+# define BFI_FLINEARS_2595_TICK(t)
+# define BFI_FLINEARS_2594(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2593, v ds
+# define BFI_FLINEARS_2594_TICK(t)
+# define BFI_FLINEARS_2593(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2592, v ds
+# define BFI_FLINEARS_2593_TICK(t)
+# define BFI_FLINEARS_2592(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2591, v ds
+# define BFI_FLINEARS_2592_TICK(t)
+# define BFI_FLINEARS_2591(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2590, v ds
+# define BFI_FLINEARS_2591_TICK(t)
+# define BFI_FLINEARS_2590(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2589, v ds
+# define BFI_FLINEARS_2590_TICK(t)
+# define BFI_FLINEARS_2589(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2588, v ds
+# define BFI_FLINEARS_2589_TICK(t)
+# define BFI_FLINEARS_2588(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2587, v ds
+# define BFI_FLINEARS_2588_TICK(t)
+# define BFI_FLINEARS_2587(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2586, v ds
+# define BFI_FLINEARS_2587_TICK(t)
+# define BFI_FLINEARS_2586(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2585, v ds
+# define BFI_FLINEARS_2586_TICK(t)
+# define BFI_FLINEARS_2585(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2584, v ds
+# define BFI_FLINEARS_2585_TICK(t)
+# define BFI_FLINEARS_2584(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2583, v ds
+# define BFI_FLINEARS_2584_TICK(t)
+# define BFI_FLINEARS_2583(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2582, v ds
+# define BFI_FLINEARS_2583_TICK(t)
+# define BFI_FLINEARS_2582(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2581, v ds
+# define BFI_FLINEARS_2582_TICK(t)
+# define BFI_FLINEARS_2581(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2580, v ds
+# define BFI_FLINEARS_2581_TICK(t)
+# define BFI_FLINEARS_2580(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2579, v ds
+# define BFI_FLINEARS_2580_TICK(t)
+# define BFI_FLINEARS_2579(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2578, v ds
+# define BFI_FLINEARS_2579_TICK(t)
+# define BFI_FLINEARS_2578(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2577, v ds
+# define BFI_FLINEARS_2578_TICK(t)
+# define BFI_FLINEARS_2577(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2576, v ds
+# define BFI_FLINEARS_2577_TICK(t)
+# define BFI_FLINEARS_2576(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2575, v ds
+# define BFI_FLINEARS_2576_TICK(t)
+# define BFI_FLINEARS_2575(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2574, v ds
+# define BFI_FLINEARS_2575_TICK(t)
+# define BFI_FLINEARS_2574(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2573, v ds
+# define BFI_FLINEARS_2574_TICK(t)
+# define BFI_FLINEARS_2573(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2572, v ds
+# define BFI_FLINEARS_2573_TICK(t)
+# define BFI_FLINEARS_2572(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2571, v ds
+# define BFI_FLINEARS_2572_TICK(t)
+# define BFI_FLINEARS_2571(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2570, v ds
+# define BFI_FLINEARS_2571_TICK(t)
+# define BFI_FLINEARS_2570(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2569, v ds
+# define BFI_FLINEARS_2570_TICK(t)
+# define BFI_FLINEARS_2569(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2568, v ds
+# define BFI_FLINEARS_2569_TICK(t)
+# define BFI_FLINEARS_2568(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2567, v ds
+# define BFI_FLINEARS_2568_TICK(t)
+# define BFI_FLINEARS_2567(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2566, v ds
+# define BFI_FLINEARS_2567_TICK(t)
+# define BFI_FLINEARS_2566(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2565, v ds
+# define BFI_FLINEARS_2566_TICK(t)
+# define BFI_FLINEARS_2565(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2564, v ds
+# define BFI_FLINEARS_2565_TICK(t)
+# define BFI_FLINEARS_2564(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2563, v ds
+# define BFI_FLINEARS_2564_TICK(t)
+# define BFI_FLINEARS_2563(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2562, v ds
+# define BFI_FLINEARS_2563_TICK(t)
+# define BFI_FLINEARS_2562(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2561, v ds
+# define BFI_FLINEARS_2562_TICK(t)
+# define BFI_FLINEARS_2561(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2560, v ds
+# define BFI_FLINEARS_2561_TICK(t)
+# define BFI_FLINEARS_2560(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2559, v ds
+# define BFI_FLINEARS_2560_TICK(t)
+# define BFI_FLINEARS_2559(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2558, v ds
+# define BFI_FLINEARS_2559_TICK(t)
+# define BFI_FLINEARS_2558(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2557, v ds
+# define BFI_FLINEARS_2558_TICK(t)
+# define BFI_FLINEARS_2557(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2556, v ds
+# define BFI_FLINEARS_2557_TICK(t)
+# define BFI_FLINEARS_2556(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2555, v ds
+# define BFI_FLINEARS_2556_TICK(t)
+# define BFI_FLINEARS_2555(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2554, v ds
+# define BFI_FLINEARS_2555_TICK(t)
+# define BFI_FLINEARS_2554(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2553, v ds
+# define BFI_FLINEARS_2554_TICK(t)
+# define BFI_FLINEARS_2553(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2552, v ds
+# define BFI_FLINEARS_2553_TICK(t)
+# define BFI_FLINEARS_2552(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2551, v ds
+# define BFI_FLINEARS_2552_TICK(t)
+# define BFI_FLINEARS_2551(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2550, v ds
+# define BFI_FLINEARS_2551_TICK(t)
+# define BFI_FLINEARS_2550(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2549, v ds
+# define BFI_FLINEARS_2550_TICK(t)
+# define BFI_FLINEARS_2549(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2548, v ds
+# define BFI_FLINEARS_2549_TICK(t)
+# define BFI_FLINEARS_2548(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2547, v ds
+# define BFI_FLINEARS_2548_TICK(t)
+# define BFI_FLINEARS_2547(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2546, v ds
+# define BFI_FLINEARS_2547_TICK(t)
+# define BFI_FLINEARS_2546(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2545, v ds
+# define BFI_FLINEARS_2546_TICK(t)
+# define BFI_FLINEARS_2545(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2544, v ds
+# define BFI_FLINEARS_2545_TICK(t)
+# define BFI_FLINEARS_2544(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2543, v ds
+# define BFI_FLINEARS_2544_TICK(t)
+# define BFI_FLINEARS_2543(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2542, v ds
+# define BFI_FLINEARS_2543_TICK(t)
+# define BFI_FLINEARS_2542(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2541, v ds
+# define BFI_FLINEARS_2542_TICK(t)
+# define BFI_FLINEARS_2541(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2540, v ds
+# define BFI_FLINEARS_2541_TICK(t)
+# define BFI_FLINEARS_2540(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2539, v ds
+# define BFI_FLINEARS_2540_TICK(t)
+# define BFI_FLINEARS_2539(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2538, v ds
+# define BFI_FLINEARS_2539_TICK(t)
+# define BFI_FLINEARS_2538(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2537, v ds
+# define BFI_FLINEARS_2538_TICK(t)
+# define BFI_FLINEARS_2537(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2536, v ds
+# define BFI_FLINEARS_2537_TICK(t)
+# define BFI_FLINEARS_2536(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2535, v ds
+# define BFI_FLINEARS_2536_TICK(t)
+# define BFI_FLINEARS_2535(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2534, v ds
+# define BFI_FLINEARS_2535_TICK(t)
+# define BFI_FLINEARS_2534(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2533, v ds
+# define BFI_FLINEARS_2534_TICK(t)
+# define BFI_FLINEARS_2533(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2532, v ds
+# define BFI_FLINEARS_2533_TICK(t)
+# define BFI_FLINEARS_2532(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2531, v ds
+# define BFI_FLINEARS_2532_TICK(t)
+# define BFI_FLINEARS_2531(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2530, v ds
+# define BFI_FLINEARS_2531_TICK(t)
+# define BFI_FLINEARS_2530(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2529, v ds
+# define BFI_FLINEARS_2530_TICK(t)
+# define BFI_FLINEARS_2529(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2528, v ds
+# define BFI_FLINEARS_2529_TICK(t)
+# define BFI_FLINEARS_2528(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2527, v ds
+# define BFI_FLINEARS_2528_TICK(t)
+# define BFI_FLINEARS_2527(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2526, v ds
+# define BFI_FLINEARS_2527_TICK(t)
+# define BFI_FLINEARS_2526(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2525, v ds
+# define BFI_FLINEARS_2526_TICK(t)
+# define BFI_FLINEARS_2525(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2524, v ds
+# define BFI_FLINEARS_2525_TICK(t)
+# define BFI_FLINEARS_2524(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2523, v ds
+# define BFI_FLINEARS_2524_TICK(t)
+# define BFI_FLINEARS_2523(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2522, v ds
+# define BFI_FLINEARS_2523_TICK(t)
+# define BFI_FLINEARS_2522(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2521, v ds
+# define BFI_FLINEARS_2522_TICK(t)
+# define BFI_FLINEARS_2521(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2520, v ds
+# define BFI_FLINEARS_2521_TICK(t)
+# define BFI_FLINEARS_2520(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2519, v ds
+# define BFI_FLINEARS_2520_TICK(t)
+# define BFI_FLINEARS_2519(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2518, v ds
+# define BFI_FLINEARS_2519_TICK(t)
+# define BFI_FLINEARS_2518(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2517, v ds
+# define BFI_FLINEARS_2518_TICK(t)
+# define BFI_FLINEARS_2517(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2516, v ds
+# define BFI_FLINEARS_2517_TICK(t)
+# define BFI_FLINEARS_2516(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2515, v ds
+# define BFI_FLINEARS_2516_TICK(t)
+# define BFI_FLINEARS_2515(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2514, v ds
+# define BFI_FLINEARS_2515_TICK(t)
+# define BFI_FLINEARS_2514(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2513, v ds
+# define BFI_FLINEARS_2514_TICK(t)
+# define BFI_FLINEARS_2513(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2512, v ds
+# define BFI_FLINEARS_2513_TICK(t)
+# define BFI_FLINEARS_2512(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2511, v ds
+# define BFI_FLINEARS_2512_TICK(t)
+# define BFI_FLINEARS_2511(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2510, v ds
+# define BFI_FLINEARS_2511_TICK(t)
+# define BFI_FLINEARS_2510(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2509, v ds
+# define BFI_FLINEARS_2510_TICK(t)
+# define BFI_FLINEARS_2509(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2508, v ds
+# define BFI_FLINEARS_2509_TICK(t)
+# define BFI_FLINEARS_2508(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2507, v ds
+# define BFI_FLINEARS_2508_TICK(t)
+# define BFI_FLINEARS_2507(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2506, v ds
+# define BFI_FLINEARS_2507_TICK(t)
+# define BFI_FLINEARS_2506(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2505, v ds
+# define BFI_FLINEARS_2506_TICK(t)
+# define BFI_FLINEARS_2505(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2504, v ds
+# define BFI_FLINEARS_2505_TICK(t)
+# define BFI_FLINEARS_2504(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2503, v ds
+# define BFI_FLINEARS_2504_TICK(t)
+# define BFI_FLINEARS_2503(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2502, v ds
+# define BFI_FLINEARS_2503_TICK(t)
+# define BFI_FLINEARS_2502(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2501, v ds
+# define BFI_FLINEARS_2502_TICK(t)
+# define BFI_FLINEARS_2501(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2500, v ds
+# define BFI_FLINEARS_2501_TICK(t)
+# define BFI_FLINEARS_2500(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2499, v ds
+# define BFI_FLINEARS_2500_TICK(t)
+# define BFI_FLINEARS_2499(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2498, v ds
+# define BFI_FLINEARS_2499_TICK(t)
+# define BFI_FLINEARS_2498(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2497, v ds
+# define BFI_FLINEARS_2498_TICK(t)
+# define BFI_FLINEARS_2497(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2496, v ds
+# define BFI_FLINEARS_2497_TICK(t)
+# define BFI_FLINEARS_2496(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2495, v ds
+# define BFI_FLINEARS_2496_TICK(t)
+# define BFI_FLINEARS_2495(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2494, v ds
+# define BFI_FLINEARS_2495_TICK(t)
+# define BFI_FLINEARS_2494(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2493, v ds
+# define BFI_FLINEARS_2494_TICK(t)
+# define BFI_FLINEARS_2493(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2492, v ds
+# define BFI_FLINEARS_2493_TICK(t)
+# define BFI_FLINEARS_2492(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2491, v ds
+# define BFI_FLINEARS_2492_TICK(t)
+# define BFI_FLINEARS_2491(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2490, v ds
+# define BFI_FLINEARS_2491_TICK(t)
+# define BFI_FLINEARS_2490(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2489, v ds
+# define BFI_FLINEARS_2490_TICK(t)
+# define BFI_FLINEARS_2489(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2488, v ds
+# define BFI_FLINEARS_2489_TICK(t)
+# define BFI_FLINEARS_2488(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2487, v ds
+# define BFI_FLINEARS_2488_TICK(t)
+# define BFI_FLINEARS_2487(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2486, v ds
+# define BFI_FLINEARS_2487_TICK(t)
+# define BFI_FLINEARS_2486(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2485, v ds
+# define BFI_FLINEARS_2486_TICK(t)
+# define BFI_FLINEARS_2485(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2484, v ds
+# define BFI_FLINEARS_2485_TICK(t)
+# define BFI_FLINEARS_2484(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2483, v ds
+# define BFI_FLINEARS_2484_TICK(t)
+# define BFI_FLINEARS_2483(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2482, v ds
+# define BFI_FLINEARS_2483_TICK(t)
+# define BFI_FLINEARS_2482(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2481, v ds
+# define BFI_FLINEARS_2482_TICK(t)
+# define BFI_FLINEARS_2481(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2480, v ds
+# define BFI_FLINEARS_2481_TICK(t)
+# define BFI_FLINEARS_2480(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2479, v ds
+# define BFI_FLINEARS_2480_TICK(t)
+# define BFI_FLINEARS_2479(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2478, v ds
+# define BFI_FLINEARS_2479_TICK(t)
+# define BFI_FLINEARS_2478(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2477, v ds
+# define BFI_FLINEARS_2478_TICK(t)
+# define BFI_FLINEARS_2477(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2476, v ds
+# define BFI_FLINEARS_2477_TICK(t)
+# define BFI_FLINEARS_2476(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2475, v ds
+# define BFI_FLINEARS_2476_TICK(t)
+# define BFI_FLINEARS_2475(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2474, v ds
+# define BFI_FLINEARS_2475_TICK(t)
+# define BFI_FLINEARS_2474(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2473, v ds
+# define BFI_FLINEARS_2474_TICK(t)
+# define BFI_FLINEARS_2473(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2472, v ds
+# define BFI_FLINEARS_2473_TICK(t)
+# define BFI_FLINEARS_2472(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2471, v ds
+# define BFI_FLINEARS_2472_TICK(t)
+# define BFI_FLINEARS_2471(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2470, v ds
+# define BFI_FLINEARS_2471_TICK(t)
+# define BFI_FLINEARS_2470(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2469, v ds
+# define BFI_FLINEARS_2470_TICK(t)
+# define BFI_FLINEARS_2469(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2468, v ds
+# define BFI_FLINEARS_2469_TICK(t)
+# define BFI_FLINEARS_2468(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2467, v ds
+# define BFI_FLINEARS_2468_TICK(t)
+# define BFI_FLINEARS_2467(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2466, v ds
+# define BFI_FLINEARS_2467_TICK(t)
+# define BFI_FLINEARS_2466(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2465, v ds
+# define BFI_FLINEARS_2466_TICK(t)
+# define BFI_FLINEARS_2465(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2464, v ds
+# define BFI_FLINEARS_2465_TICK(t)
+# define BFI_FLINEARS_2464(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2463, v ds
+# define BFI_FLINEARS_2464_TICK(t)
+# define BFI_FLINEARS_2463(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2462, v ds
+# define BFI_FLINEARS_2463_TICK(t)
+# define BFI_FLINEARS_2462(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2461, v ds
+# define BFI_FLINEARS_2462_TICK(t)
+# define BFI_FLINEARS_2461(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2460, v ds
+# define BFI_FLINEARS_2461_TICK(t)
+# define BFI_FLINEARS_2460(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2459, v ds
+# define BFI_FLINEARS_2460_TICK(t)
+# define BFI_FLINEARS_2459(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2458, v ds
+# define BFI_FLINEARS_2459_TICK(t)
+# define BFI_FLINEARS_2458(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2457, v ds
+# define BFI_FLINEARS_2458_TICK(t)
+# define BFI_FLINEARS_2457(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2456, v ds
+# define BFI_FLINEARS_2457_TICK(t)
+# define BFI_FLINEARS_2456(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2455, v ds
+# define BFI_FLINEARS_2456_TICK(t)
+# define BFI_FLINEARS_2455(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2454, v ds
+# define BFI_FLINEARS_2455_TICK(t)
+# define BFI_FLINEARS_2454(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2453, v ds
+# define BFI_FLINEARS_2454_TICK(t)
+# define BFI_FLINEARS_2453(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2452, v ds
+# define BFI_FLINEARS_2453_TICK(t)
+# define BFI_FLINEARS_2452(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2451, v ds
+# define BFI_FLINEARS_2452_TICK(t)
+# define BFI_FLINEARS_2451(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2450, v ds
+# define BFI_FLINEARS_2451_TICK(t)
+# define BFI_FLINEARS_2450(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2449, v ds
+# define BFI_FLINEARS_2450_TICK(t)
+# define BFI_FLINEARS_2449(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2448, v ds
+# define BFI_FLINEARS_2449_TICK(t)
+# define BFI_FLINEARS_2448(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2447, v ds
+# define BFI_FLINEARS_2448_TICK(t)
+# define BFI_FLINEARS_2447(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2446, v ds
+# define BFI_FLINEARS_2447_TICK(t)
+# define BFI_FLINEARS_2446(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2445, v ds
+# define BFI_FLINEARS_2446_TICK(t)
+# define BFI_FLINEARS_2445(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2444, v ds
+# define BFI_FLINEARS_2445_TICK(t)
+# define BFI_FLINEARS_2444(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2443, v ds
+# define BFI_FLINEARS_2444_TICK(t)
+# define BFI_FLINEARS_2443(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2442, v ds
+# define BFI_FLINEARS_2443_TICK(t)
+# define BFI_FLINEARS_2442(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2441, v ds
+# define BFI_FLINEARS_2442_TICK(t)
+# define BFI_FLINEARS_2441(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2440, v ds
+# define BFI_FLINEARS_2441_TICK(t)
+# define BFI_FLINEARS_2440(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2439, v ds
+# define BFI_FLINEARS_2440_TICK(t)
+# define BFI_FLINEARS_2439(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2438, v ds
+# define BFI_FLINEARS_2439_TICK(t)
+# define BFI_FLINEARS_2438(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2437, v ds
+# define BFI_FLINEARS_2438_TICK(t)
+# define BFI_FLINEARS_2437(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2436, v ds
+# define BFI_FLINEARS_2437_TICK(t)
+# define BFI_FLINEARS_2436(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2435, v ds
+# define BFI_FLINEARS_2436_TICK(t)
+# define BFI_FLINEARS_2435(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2434, v ds
+# define BFI_FLINEARS_2435_TICK(t)
+# define BFI_FLINEARS_2434(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2433, v ds
+# define BFI_FLINEARS_2434_TICK(t)
+# define BFI_FLINEARS_2433(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2432, v ds
+# define BFI_FLINEARS_2433_TICK(t)
+# define BFI_FLINEARS_2432(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2431, v ds
+# define BFI_FLINEARS_2432_TICK(t)
+# define BFI_FLINEARS_2431(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2430, v ds
+# define BFI_FLINEARS_2431_TICK(t)
+# define BFI_FLINEARS_2430(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2429, v ds
+# define BFI_FLINEARS_2430_TICK(t)
+# define BFI_FLINEARS_2429(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2428, v ds
+# define BFI_FLINEARS_2429_TICK(t)
+# define BFI_FLINEARS_2428(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2427, v ds
+# define BFI_FLINEARS_2428_TICK(t)
+# define BFI_FLINEARS_2427(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2426, v ds
+# define BFI_FLINEARS_2427_TICK(t)
+# define BFI_FLINEARS_2426(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2425, v ds
+# define BFI_FLINEARS_2426_TICK(t)
+# define BFI_FLINEARS_2425(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2424, v ds
+# define BFI_FLINEARS_2425_TICK(t)
+# define BFI_FLINEARS_2424(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2423, v ds
+# define BFI_FLINEARS_2424_TICK(t)
+# define BFI_FLINEARS_2423(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2422, v ds
+# define BFI_FLINEARS_2423_TICK(t)
+# define BFI_FLINEARS_2422(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2421, v ds
+# define BFI_FLINEARS_2422_TICK(t)
+# define BFI_FLINEARS_2421(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2420, v ds
+# define BFI_FLINEARS_2421_TICK(t)
+# define BFI_FLINEARS_2420(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2419, v ds
+# define BFI_FLINEARS_2420_TICK(t)
+# define BFI_FLINEARS_2419(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2418, v ds
+# define BFI_FLINEARS_2419_TICK(t)
+# define BFI_FLINEARS_2418(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2417, v ds
+# define BFI_FLINEARS_2418_TICK(t)
+# define BFI_FLINEARS_2417(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2416, v ds
+# define BFI_FLINEARS_2417_TICK(t)
+# define BFI_FLINEARS_2416(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2415, v ds
+# define BFI_FLINEARS_2416_TICK(t)
+# define BFI_FLINEARS_2415(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2414, v ds
+# define BFI_FLINEARS_2415_TICK(t)
+# define BFI_FLINEARS_2414(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2413, v ds
+# define BFI_FLINEARS_2414_TICK(t)
+# define BFI_FLINEARS_2413(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2412, v ds
+# define BFI_FLINEARS_2413_TICK(t)
+# define BFI_FLINEARS_2412(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2411, v ds
+# define BFI_FLINEARS_2412_TICK(t)
+# define BFI_FLINEARS_2411(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2410, v ds
+# define BFI_FLINEARS_2411_TICK(t)
+# define BFI_FLINEARS_2410(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2409, v ds
+# define BFI_FLINEARS_2410_TICK(t)
+# define BFI_FLINEARS_2409(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2408, v ds
+# define BFI_FLINEARS_2409_TICK(t)
+# define BFI_FLINEARS_2408(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2407, v ds
+# define BFI_FLINEARS_2408_TICK(t)
+# define BFI_FLINEARS_2407(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2406, v ds
+# define BFI_FLINEARS_2407_TICK(t)
+# define BFI_FLINEARS_2406(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2405, v ds
+# define BFI_FLINEARS_2406_TICK(t)
+# define BFI_FLINEARS_2405(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2404, v ds
+# define BFI_FLINEARS_2405_TICK(t)
+# define BFI_FLINEARS_2404(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2403, v ds
+# define BFI_FLINEARS_2404_TICK(t)
+# define BFI_FLINEARS_2403(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2402, v ds
+# define BFI_FLINEARS_2403_TICK(t)
+# define BFI_FLINEARS_2402(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2401, v ds
+# define BFI_FLINEARS_2402_TICK(t)
+# define BFI_FLINEARS_2401(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2400, v ds
+# define BFI_FLINEARS_2401_TICK(t)
+# define BFI_FLINEARS_2400(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2399, v ds
+# define BFI_FLINEARS_2400_TICK(t)
+# define BFI_FLINEARS_2399(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2398, v ds
+# define BFI_FLINEARS_2399_TICK(t)
+# define BFI_FLINEARS_2398(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2397, v ds
+# define BFI_FLINEARS_2398_TICK(t)
+# define BFI_FLINEARS_2397(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2396, v ds
+# define BFI_FLINEARS_2397_TICK(t)
+# define BFI_FLINEARS_2396(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2395, v ds
+# define BFI_FLINEARS_2396_TICK(t)
+# define BFI_FLINEARS_2395(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2394, v ds
+# define BFI_FLINEARS_2395_TICK(t)
+# define BFI_FLINEARS_2394(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2393, v ds
+# define BFI_FLINEARS_2394_TICK(t)
+# define BFI_FLINEARS_2393(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2392, v ds
+# define BFI_FLINEARS_2393_TICK(t)
+# define BFI_FLINEARS_2392(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2391, v ds
+# define BFI_FLINEARS_2392_TICK(t)
+# define BFI_FLINEARS_2391(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2390, v ds
+# define BFI_FLINEARS_2391_TICK(t)
+# define BFI_FLINEARS_2390(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2389, v ds
+# define BFI_FLINEARS_2390_TICK(t)
+# define BFI_FLINEARS_2389(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2388, v ds
+# define BFI_FLINEARS_2389_TICK(t)
+# define BFI_FLINEARS_2388(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2387, v ds
+# define BFI_FLINEARS_2388_TICK(t)
+# define BFI_FLINEARS_2387(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2386, v ds
+# define BFI_FLINEARS_2387_TICK(t)
+# define BFI_FLINEARS_2386(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2385, v ds
+# define BFI_FLINEARS_2386_TICK(t)
+# define BFI_FLINEARS_2385(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2384, v ds
+# define BFI_FLINEARS_2385_TICK(t)
+# define BFI_FLINEARS_2384(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2383, v ds
+# define BFI_FLINEARS_2384_TICK(t)
+# define BFI_FLINEARS_2383(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2382, v ds
+# define BFI_FLINEARS_2383_TICK(t)
+# define BFI_FLINEARS_2382(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2381, v ds
+# define BFI_FLINEARS_2382_TICK(t)
+# define BFI_FLINEARS_2381(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2380, v ds
+# define BFI_FLINEARS_2381_TICK(t)
+# define BFI_FLINEARS_2380(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2379, v ds
+# define BFI_FLINEARS_2380_TICK(t)
+# define BFI_FLINEARS_2379(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2378, v ds
+# define BFI_FLINEARS_2379_TICK(t)
+# define BFI_FLINEARS_2378(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2377, v ds
+# define BFI_FLINEARS_2378_TICK(t)
+# define BFI_FLINEARS_2377(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2376, v ds
+# define BFI_FLINEARS_2377_TICK(t)
+# define BFI_FLINEARS_2376(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2375, v ds
+# define BFI_FLINEARS_2376_TICK(t)
+# define BFI_FLINEARS_2375(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2374, v ds
+# define BFI_FLINEARS_2375_TICK(t)
+# define BFI_FLINEARS_2374(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2373, v ds
+# define BFI_FLINEARS_2374_TICK(t)
+# define BFI_FLINEARS_2373(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2372, v ds
+# define BFI_FLINEARS_2373_TICK(t)
+# define BFI_FLINEARS_2372(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2371, v ds
+# define BFI_FLINEARS_2372_TICK(t)
+# define BFI_FLINEARS_2371(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2370, v ds
+# define BFI_FLINEARS_2371_TICK(t)
+# define BFI_FLINEARS_2370(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2369, v ds
+# define BFI_FLINEARS_2370_TICK(t)
+# define BFI_FLINEARS_2369(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2368, v ds
+# define BFI_FLINEARS_2369_TICK(t)
+# define BFI_FLINEARS_2368(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2367, v ds
+# define BFI_FLINEARS_2368_TICK(t)
+# define BFI_FLINEARS_2367(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2366, v ds
+# define BFI_FLINEARS_2367_TICK(t)
+# define BFI_FLINEARS_2366(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2365, v ds
+# define BFI_FLINEARS_2366_TICK(t)
+# define BFI_FLINEARS_2365(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2364, v ds
+# define BFI_FLINEARS_2365_TICK(t)
+# define BFI_FLINEARS_2364(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2363, v ds
+# define BFI_FLINEARS_2364_TICK(t)
+# define BFI_FLINEARS_2363(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2362, v ds
+# define BFI_FLINEARS_2363_TICK(t)
+# define BFI_FLINEARS_2362(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2361, v ds
+# define BFI_FLINEARS_2362_TICK(t)
+# define BFI_FLINEARS_2361(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2360, v ds
+# define BFI_FLINEARS_2361_TICK(t)
+# define BFI_FLINEARS_2360(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2359, v ds
+# define BFI_FLINEARS_2360_TICK(t)
+# define BFI_FLINEARS_2359(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2358, v ds
+# define BFI_FLINEARS_2359_TICK(t)
+# define BFI_FLINEARS_2358(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2357, v ds
+# define BFI_FLINEARS_2358_TICK(t)
+# define BFI_FLINEARS_2357(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2356, v ds
+# define BFI_FLINEARS_2357_TICK(t)
+# define BFI_FLINEARS_2356(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2355, v ds
+# define BFI_FLINEARS_2356_TICK(t)
+# define BFI_FLINEARS_2355(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2354, v ds
+# define BFI_FLINEARS_2355_TICK(t)
+# define BFI_FLINEARS_2354(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2353, v ds
+# define BFI_FLINEARS_2354_TICK(t)
+# define BFI_FLINEARS_2353(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2352, v ds
+# define BFI_FLINEARS_2353_TICK(t)
+# define BFI_FLINEARS_2352(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2351, v ds
+# define BFI_FLINEARS_2352_TICK(t)
+# define BFI_FLINEARS_2351(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2350, v ds
+# define BFI_FLINEARS_2351_TICK(t)
+# define BFI_FLINEARS_2350(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2349, v ds
+# define BFI_FLINEARS_2350_TICK(t)
+# define BFI_FLINEARS_2349(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2348, v ds
+# define BFI_FLINEARS_2349_TICK(t)
+# define BFI_FLINEARS_2348(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2347, v ds
+# define BFI_FLINEARS_2348_TICK(t)
+# define BFI_FLINEARS_2347(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2346, v ds
+# define BFI_FLINEARS_2347_TICK(t)
+# define BFI_FLINEARS_2346(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2345, v ds
+# define BFI_FLINEARS_2346_TICK(t)
+# define BFI_FLINEARS_2345(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2344, v ds
+# define BFI_FLINEARS_2345_TICK(t)
+# define BFI_FLINEARS_2344(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2343, v ds
+# define BFI_FLINEARS_2344_TICK(t)
+# define BFI_FLINEARS_2343(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2342, v ds
+# define BFI_FLINEARS_2343_TICK(t)
+# define BFI_FLINEARS_2342(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2341, v ds
+# define BFI_FLINEARS_2342_TICK(t)
+# define BFI_FLINEARS_2341(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2340, v ds
+# define BFI_FLINEARS_2341_TICK(t)
+# define BFI_FLINEARS_2340(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2339, v ds
+# define BFI_FLINEARS_2340_TICK(t)
+# define BFI_FLINEARS_2339(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2338, v ds
+# define BFI_FLINEARS_2339_TICK(t)
+# define BFI_FLINEARS_2338(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2337, v ds
+# define BFI_FLINEARS_2338_TICK(t)
+# define BFI_FLINEARS_2337(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2336, v ds
+# define BFI_FLINEARS_2337_TICK(t)
+# define BFI_FLINEARS_2336(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2335, v ds
+# define BFI_FLINEARS_2336_TICK(t)
+# define BFI_FLINEARS_2335(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2334, v ds
+# define BFI_FLINEARS_2335_TICK(t)
+# define BFI_FLINEARS_2334(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2333, v ds
+# define BFI_FLINEARS_2334_TICK(t)
+# define BFI_FLINEARS_2333(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2332, v ds
+# define BFI_FLINEARS_2333_TICK(t)
+# define BFI_FLINEARS_2332(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2331, v ds
+# define BFI_FLINEARS_2332_TICK(t)
+# define BFI_FLINEARS_2331(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2330, v ds
+# define BFI_FLINEARS_2331_TICK(t)
+# define BFI_FLINEARS_2330(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2329, v ds
+# define BFI_FLINEARS_2330_TICK(t)
+# define BFI_FLINEARS_2329(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2328, v ds
+# define BFI_FLINEARS_2329_TICK(t)
+# define BFI_FLINEARS_2328(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2327, v ds
+# define BFI_FLINEARS_2328_TICK(t)
+# define BFI_FLINEARS_2327(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2326, v ds
+# define BFI_FLINEARS_2327_TICK(t)
+# define BFI_FLINEARS_2326(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2325, v ds
+# define BFI_FLINEARS_2326_TICK(t)
+# define BFI_FLINEARS_2325(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2324, v ds
+# define BFI_FLINEARS_2325_TICK(t)
+# define BFI_FLINEARS_2324(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2323, v ds
+# define BFI_FLINEARS_2324_TICK(t)
+# define BFI_FLINEARS_2323(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2322, v ds
+# define BFI_FLINEARS_2323_TICK(t)
+# define BFI_FLINEARS_2322(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2321, v ds
+# define BFI_FLINEARS_2322_TICK(t)
+# define BFI_FLINEARS_2321(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2320, v ds
+# define BFI_FLINEARS_2321_TICK(t)
+# define BFI_FLINEARS_2320(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2319, v ds
+# define BFI_FLINEARS_2320_TICK(t)
+# define BFI_FLINEARS_2319(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2318, v ds
+# define BFI_FLINEARS_2319_TICK(t)
+# define BFI_FLINEARS_2318(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2317, v ds
+# define BFI_FLINEARS_2318_TICK(t)
+# define BFI_FLINEARS_2317(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2316, v ds
+# define BFI_FLINEARS_2317_TICK(t)
+# define BFI_FLINEARS_2316(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2315, v ds
+# define BFI_FLINEARS_2316_TICK(t)
+# define BFI_FLINEARS_2315(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2314, v ds
+# define BFI_FLINEARS_2315_TICK(t)
+# define BFI_FLINEARS_2314(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2313, v ds
+# define BFI_FLINEARS_2314_TICK(t)
+# define BFI_FLINEARS_2313(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2312, v ds
+# define BFI_FLINEARS_2313_TICK(t)
+# define BFI_FLINEARS_2312(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2311, v ds
+# define BFI_FLINEARS_2312_TICK(t)
+# define BFI_FLINEARS_2311(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2310, v ds
+# define BFI_FLINEARS_2311_TICK(t)
+# define BFI_FLINEARS_2310(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2309, v ds
+# define BFI_FLINEARS_2310_TICK(t)
+# define BFI_FLINEARS_2309(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2308, v ds
+# define BFI_FLINEARS_2309_TICK(t)
+# define BFI_FLINEARS_2308(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2307, v ds
+# define BFI_FLINEARS_2308_TICK(t)
+# define BFI_FLINEARS_2307(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2306, v ds
+# define BFI_FLINEARS_2307_TICK(t)
+# define BFI_FLINEARS_2306(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2305, v ds
+# define BFI_FLINEARS_2306_TICK(t)
+# define BFI_FLINEARS_2305(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2304, v ds
+# define BFI_FLINEARS_2305_TICK(t)
+# define BFI_FLINEARS_2304(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2303, v ds
+# define BFI_FLINEARS_2304_TICK(t)
+# define BFI_FLINEARS_2303(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2302, v ds
+# define BFI_FLINEARS_2303_TICK(t)
+# define BFI_FLINEARS_2302(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2301, v ds
+# define BFI_FLINEARS_2302_TICK(t)
+# define BFI_FLINEARS_2301(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2300, v ds
+# define BFI_FLINEARS_2301_TICK(t)
+# define BFI_FLINEARS_2300(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2299, v ds
+# define BFI_FLINEARS_2300_TICK(t)
+# define BFI_FLINEARS_2299(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2298, v ds
+# define BFI_FLINEARS_2299_TICK(t)
+# define BFI_FLINEARS_2298(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2297, v ds
+# define BFI_FLINEARS_2298_TICK(t)
+# define BFI_FLINEARS_2297(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2296, v ds
+# define BFI_FLINEARS_2297_TICK(t)
+# define BFI_FLINEARS_2296(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2295, v ds
+# define BFI_FLINEARS_2296_TICK(t)
+# define BFI_FLINEARS_2295(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2294, v ds
+# define BFI_FLINEARS_2295_TICK(t)
+# define BFI_FLINEARS_2294(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2293, v ds
+# define BFI_FLINEARS_2294_TICK(t)
+# define BFI_FLINEARS_2293(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2292, v ds
+# define BFI_FLINEARS_2293_TICK(t)
+# define BFI_FLINEARS_2292(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2291, v ds
+# define BFI_FLINEARS_2292_TICK(t)
+# define BFI_FLINEARS_2291(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2290, v ds
+# define BFI_FLINEARS_2291_TICK(t)
+# define BFI_FLINEARS_2290(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2289, v ds
+# define BFI_FLINEARS_2290_TICK(t)
+# define BFI_FLINEARS_2289(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2288, v ds
+# define BFI_FLINEARS_2289_TICK(t)
+# define BFI_FLINEARS_2288(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2287, v ds
+# define BFI_FLINEARS_2288_TICK(t)
+# define BFI_FLINEARS_2287(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2286, v ds
+# define BFI_FLINEARS_2287_TICK(t)
+# define BFI_FLINEARS_2286(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2285, v ds
+# define BFI_FLINEARS_2286_TICK(t)
+# define BFI_FLINEARS_2285(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2284, v ds
+# define BFI_FLINEARS_2285_TICK(t)
+# define BFI_FLINEARS_2284(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2283, v ds
+# define BFI_FLINEARS_2284_TICK(t)
+# define BFI_FLINEARS_2283(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2282, v ds
+# define BFI_FLINEARS_2283_TICK(t)
+# define BFI_FLINEARS_2282(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2281, v ds
+# define BFI_FLINEARS_2282_TICK(t)
+# define BFI_FLINEARS_2281(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2280, v ds
+# define BFI_FLINEARS_2281_TICK(t)
+# define BFI_FLINEARS_2280(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2279, v ds
+# define BFI_FLINEARS_2280_TICK(t)
+# define BFI_FLINEARS_2279(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2278, v ds
+# define BFI_FLINEARS_2279_TICK(t)
+# define BFI_FLINEARS_2278(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2277, v ds
+# define BFI_FLINEARS_2278_TICK(t)
+# define BFI_FLINEARS_2277(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2276, v ds
+# define BFI_FLINEARS_2277_TICK(t)
+# define BFI_FLINEARS_2276(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2275, v ds
+# define BFI_FLINEARS_2276_TICK(t)
+# define BFI_FLINEARS_2275(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2274, v ds
+# define BFI_FLINEARS_2275_TICK(t)
+# define BFI_FLINEARS_2274(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2273, v ds
+# define BFI_FLINEARS_2274_TICK(t)
+# define BFI_FLINEARS_2273(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2272, v ds
+# define BFI_FLINEARS_2273_TICK(t)
+# define BFI_FLINEARS_2272(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2271, v ds
+# define BFI_FLINEARS_2272_TICK(t)
+# define BFI_FLINEARS_2271(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2270, v ds
+# define BFI_FLINEARS_2271_TICK(t)
+# define BFI_FLINEARS_2270(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2269, v ds
+# define BFI_FLINEARS_2270_TICK(t)
+# define BFI_FLINEARS_2269(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2268, v ds
+# define BFI_FLINEARS_2269_TICK(t)
+# define BFI_FLINEARS_2268(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2267, v ds
+# define BFI_FLINEARS_2268_TICK(t)
+# define BFI_FLINEARS_2267(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2266, v ds
+# define BFI_FLINEARS_2267_TICK(t)
+# define BFI_FLINEARS_2266(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2265, v ds
+# define BFI_FLINEARS_2266_TICK(t)
+# define BFI_FLINEARS_2265(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2264, v ds
+# define BFI_FLINEARS_2265_TICK(t)
+# define BFI_FLINEARS_2264(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2263, v ds
+# define BFI_FLINEARS_2264_TICK(t)
+# define BFI_FLINEARS_2263(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2262, v ds
+# define BFI_FLINEARS_2263_TICK(t)
+# define BFI_FLINEARS_2262(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2261, v ds
+# define BFI_FLINEARS_2262_TICK(t)
+# define BFI_FLINEARS_2261(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2260, v ds
+# define BFI_FLINEARS_2261_TICK(t)
+# define BFI_FLINEARS_2260(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2259, v ds
+# define BFI_FLINEARS_2260_TICK(t)
+# define BFI_FLINEARS_2259(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2258, v ds
+# define BFI_FLINEARS_2259_TICK(t)
+# define BFI_FLINEARS_2258(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2257, v ds
+# define BFI_FLINEARS_2258_TICK(t)
+# define BFI_FLINEARS_2257(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2256, v ds
+# define BFI_FLINEARS_2257_TICK(t)
+# define BFI_FLINEARS_2256(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2255, v ds
+# define BFI_FLINEARS_2256_TICK(t)
+# define BFI_FLINEARS_2255(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2254, v ds
+# define BFI_FLINEARS_2255_TICK(t)
+# define BFI_FLINEARS_2254(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2253, v ds
+# define BFI_FLINEARS_2254_TICK(t)
+# define BFI_FLINEARS_2253(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2252, v ds
+# define BFI_FLINEARS_2253_TICK(t)
+# define BFI_FLINEARS_2252(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2251, v ds
+# define BFI_FLINEARS_2252_TICK(t)
+# define BFI_FLINEARS_2251(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2250, v ds
+# define BFI_FLINEARS_2251_TICK(t)
+# define BFI_FLINEARS_2250(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2249, v ds
+# define BFI_FLINEARS_2250_TICK(t)
+# define BFI_FLINEARS_2249(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2248, v ds
+# define BFI_FLINEARS_2249_TICK(t)
+# define BFI_FLINEARS_2248(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2247, v ds
+# define BFI_FLINEARS_2248_TICK(t)
+# define BFI_FLINEARS_2247(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2246, v ds
+# define BFI_FLINEARS_2247_TICK(t)
+# define BFI_FLINEARS_2246(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2245, v ds
+# define BFI_FLINEARS_2246_TICK(t)
+# define BFI_FLINEARS_2245(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2244, v ds
+# define BFI_FLINEARS_2245_TICK(t)
+# define BFI_FLINEARS_2244(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2243, v ds
+# define BFI_FLINEARS_2244_TICK(t)
+# define BFI_FLINEARS_2243(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2242, v ds
+# define BFI_FLINEARS_2243_TICK(t)
+# define BFI_FLINEARS_2242(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2241, v ds
+# define BFI_FLINEARS_2242_TICK(t)
+# define BFI_FLINEARS_2241(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2240, v ds
+# define BFI_FLINEARS_2241_TICK(t)
+# define BFI_FLINEARS_2240(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2239, v ds
+# define BFI_FLINEARS_2240_TICK(t)
+# define BFI_FLINEARS_2239(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2238, v ds
+# define BFI_FLINEARS_2239_TICK(t)
+# define BFI_FLINEARS_2238(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2237, v ds
+# define BFI_FLINEARS_2238_TICK(t)
+# define BFI_FLINEARS_2237(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2236, v ds
+# define BFI_FLINEARS_2237_TICK(t)
+# define BFI_FLINEARS_2236(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2235, v ds
+# define BFI_FLINEARS_2236_TICK(t)
+# define BFI_FLINEARS_2235(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2234, v ds
+# define BFI_FLINEARS_2235_TICK(t)
+# define BFI_FLINEARS_2234(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2233, v ds
+# define BFI_FLINEARS_2234_TICK(t)
+# define BFI_FLINEARS_2233(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2232, v ds
+# define BFI_FLINEARS_2233_TICK(t)
+# define BFI_FLINEARS_2232(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2231, v ds
+# define BFI_FLINEARS_2232_TICK(t)
+# define BFI_FLINEARS_2231(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2230, v ds
+# define BFI_FLINEARS_2231_TICK(t)
+# define BFI_FLINEARS_2230(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2229, v ds
+# define BFI_FLINEARS_2230_TICK(t)
+# define BFI_FLINEARS_2229(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2228, v ds
+# define BFI_FLINEARS_2229_TICK(t)
+# define BFI_FLINEARS_2228(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2227, v ds
+# define BFI_FLINEARS_2228_TICK(t)
+# define BFI_FLINEARS_2227(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2226, v ds
+# define BFI_FLINEARS_2227_TICK(t)
+# define BFI_FLINEARS_2226(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2225, v ds
+# define BFI_FLINEARS_2226_TICK(t)
+# define BFI_FLINEARS_2225(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2224, v ds
+# define BFI_FLINEARS_2225_TICK(t)
+# define BFI_FLINEARS_2224(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2223, v ds
+# define BFI_FLINEARS_2224_TICK(t)
+# define BFI_FLINEARS_2223(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2222, v ds
+# define BFI_FLINEARS_2223_TICK(t)
+# define BFI_FLINEARS_2222(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2221, v ds
+# define BFI_FLINEARS_2222_TICK(t)
+# define BFI_FLINEARS_2221(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2220, v ds
+# define BFI_FLINEARS_2221_TICK(t)
+# define BFI_FLINEARS_2220(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2219, v ds
+# define BFI_FLINEARS_2220_TICK(t)
+# define BFI_FLINEARS_2219(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2218, v ds
+# define BFI_FLINEARS_2219_TICK(t)
+# define BFI_FLINEARS_2218(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2217, v ds
+# define BFI_FLINEARS_2218_TICK(t)
+# define BFI_FLINEARS_2217(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2216, v ds
+# define BFI_FLINEARS_2217_TICK(t)
+# define BFI_FLINEARS_2216(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2215, v ds
+# define BFI_FLINEARS_2216_TICK(t)
+# define BFI_FLINEARS_2215(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2214, v ds
+# define BFI_FLINEARS_2215_TICK(t)
+# define BFI_FLINEARS_2214(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2213, v ds
+# define BFI_FLINEARS_2214_TICK(t)
+# define BFI_FLINEARS_2213(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2212, v ds
+# define BFI_FLINEARS_2213_TICK(t)
+# define BFI_FLINEARS_2212(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2211, v ds
+# define BFI_FLINEARS_2212_TICK(t)
+# define BFI_FLINEARS_2211(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2210, v ds
+# define BFI_FLINEARS_2211_TICK(t)
+# define BFI_FLINEARS_2210(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2209, v ds
+# define BFI_FLINEARS_2210_TICK(t)
+# define BFI_FLINEARS_2209(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2208, v ds
+# define BFI_FLINEARS_2209_TICK(t)
+# define BFI_FLINEARS_2208(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2207, v ds
+# define BFI_FLINEARS_2208_TICK(t)
+# define BFI_FLINEARS_2207(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2206, v ds
+# define BFI_FLINEARS_2207_TICK(t)
+# define BFI_FLINEARS_2206(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2205, v ds
+# define BFI_FLINEARS_2206_TICK(t)
+# define BFI_FLINEARS_2205(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2204, v ds
+# define BFI_FLINEARS_2205_TICK(t)
+# define BFI_FLINEARS_2204(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2203, v ds
+# define BFI_FLINEARS_2204_TICK(t)
+# define BFI_FLINEARS_2203(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2202, v ds
+# define BFI_FLINEARS_2203_TICK(t)
+# define BFI_FLINEARS_2202(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2201, v ds
+# define BFI_FLINEARS_2202_TICK(t)
+# define BFI_FLINEARS_2201(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2200, v ds
+# define BFI_FLINEARS_2201_TICK(t)
+# define BFI_FLINEARS_2200(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2199, v ds
+# define BFI_FLINEARS_2200_TICK(t)
+# define BFI_FLINEARS_2199(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2198, v ds
+# define BFI_FLINEARS_2199_TICK(t)
+# define BFI_FLINEARS_2198(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2197, v ds
+# define BFI_FLINEARS_2198_TICK(t)
+# define BFI_FLINEARS_2197(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2196, v ds
+# define BFI_FLINEARS_2197_TICK(t)
+# define BFI_FLINEARS_2196(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2195, v ds
+# define BFI_FLINEARS_2196_TICK(t)
+# define BFI_FLINEARS_2195(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2194, v ds
+# define BFI_FLINEARS_2195_TICK(t)
+# define BFI_FLINEARS_2194(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2193, v ds
+# define BFI_FLINEARS_2194_TICK(t)
+# define BFI_FLINEARS_2193(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2192, v ds
+# define BFI_FLINEARS_2193_TICK(t)
+# define BFI_FLINEARS_2192(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2191, v ds
+# define BFI_FLINEARS_2192_TICK(t)
+# define BFI_FLINEARS_2191(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2190, v ds
+# define BFI_FLINEARS_2191_TICK(t)
+# define BFI_FLINEARS_2190(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2189, v ds
+# define BFI_FLINEARS_2190_TICK(t)
+# define BFI_FLINEARS_2189(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2188, v ds
+# define BFI_FLINEARS_2189_TICK(t)
+# define BFI_FLINEARS_2188(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2187, v ds
+# define BFI_FLINEARS_2188_TICK(t)
+# define BFI_FLINEARS_2187(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2186, v ds
+# define BFI_FLINEARS_2187_TICK(t)
+# define BFI_FLINEARS_2186(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2185, v ds
+# define BFI_FLINEARS_2186_TICK(t)
+# define BFI_FLINEARS_2185(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2184, v ds
+# define BFI_FLINEARS_2185_TICK(t)
+# define BFI_FLINEARS_2184(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2183, v ds
+# define BFI_FLINEARS_2184_TICK(t)
+# define BFI_FLINEARS_2183(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2182, v ds
+# define BFI_FLINEARS_2183_TICK(t)
+# define BFI_FLINEARS_2182(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2181, v ds
+# define BFI_FLINEARS_2182_TICK(t)
+# define BFI_FLINEARS_2181(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2180, v ds
+# define BFI_FLINEARS_2181_TICK(t)
+# define BFI_FLINEARS_2180(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2179, v ds
+# define BFI_FLINEARS_2180_TICK(t)
+# define BFI_FLINEARS_2179(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2178, v ds
+# define BFI_FLINEARS_2179_TICK(t)
+# define BFI_FLINEARS_2178(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2177, v ds
+# define BFI_FLINEARS_2178_TICK(t)
+# define BFI_FLINEARS_2177(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2176, v ds
+# define BFI_FLINEARS_2177_TICK(t)
+# define BFI_FLINEARS_2176(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2175, v ds
+# define BFI_FLINEARS_2176_TICK(t)
+# define BFI_FLINEARS_2175(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2174, v ds
+# define BFI_FLINEARS_2175_TICK(t)
+# define BFI_FLINEARS_2174(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2173, v ds
+# define BFI_FLINEARS_2174_TICK(t)
+# define BFI_FLINEARS_2173(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2172, v ds
+# define BFI_FLINEARS_2173_TICK(t)
+# define BFI_FLINEARS_2172(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2171, v ds
+# define BFI_FLINEARS_2172_TICK(t)
+# define BFI_FLINEARS_2171(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2170, v ds
+# define BFI_FLINEARS_2171_TICK(t)
+# define BFI_FLINEARS_2170(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2169, v ds
+# define BFI_FLINEARS_2170_TICK(t)
+# define BFI_FLINEARS_2169(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2168, v ds
+# define BFI_FLINEARS_2169_TICK(t)
+# define BFI_FLINEARS_2168(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2167, v ds
+# define BFI_FLINEARS_2168_TICK(t)
+# define BFI_FLINEARS_2167(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2166, v ds
+# define BFI_FLINEARS_2167_TICK(t)
+# define BFI_FLINEARS_2166(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2165, v ds
+# define BFI_FLINEARS_2166_TICK(t)
+# define BFI_FLINEARS_2165(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2164, v ds
+# define BFI_FLINEARS_2165_TICK(t)
+# define BFI_FLINEARS_2164(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2163, v ds
+# define BFI_FLINEARS_2164_TICK(t)
+# define BFI_FLINEARS_2163(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2162, v ds
+# define BFI_FLINEARS_2163_TICK(t)
+# define BFI_FLINEARS_2162(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2161, v ds
+# define BFI_FLINEARS_2162_TICK(t)
+# define BFI_FLINEARS_2161(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2160, v ds
+# define BFI_FLINEARS_2161_TICK(t)
+# define BFI_FLINEARS_2160(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2159, v ds
+# define BFI_FLINEARS_2160_TICK(t)
+# define BFI_FLINEARS_2159(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2158, v ds
+# define BFI_FLINEARS_2159_TICK(t)
+# define BFI_FLINEARS_2158(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2157, v ds
+# define BFI_FLINEARS_2158_TICK(t)
+# define BFI_FLINEARS_2157(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2156, v ds
+# define BFI_FLINEARS_2157_TICK(t)
+# define BFI_FLINEARS_2156(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2155, v ds
+# define BFI_FLINEARS_2156_TICK(t)
+# define BFI_FLINEARS_2155(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2154, v ds
+# define BFI_FLINEARS_2155_TICK(t)
+# define BFI_FLINEARS_2154(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2153, v ds
+# define BFI_FLINEARS_2154_TICK(t)
+# define BFI_FLINEARS_2153(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2152, v ds
+# define BFI_FLINEARS_2153_TICK(t)
+# define BFI_FLINEARS_2152(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2151, v ds
+# define BFI_FLINEARS_2152_TICK(t)
+# define BFI_FLINEARS_2151(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2150, v ds
+# define BFI_FLINEARS_2151_TICK(t)
+# define BFI_FLINEARS_2150(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2149, v ds
+# define BFI_FLINEARS_2150_TICK(t)
+# define BFI_FLINEARS_2149(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2148, v ds
+# define BFI_FLINEARS_2149_TICK(t)
+# define BFI_FLINEARS_2148(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2147, v ds
+# define BFI_FLINEARS_2148_TICK(t)
+# define BFI_FLINEARS_2147(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2146, v ds
+# define BFI_FLINEARS_2147_TICK(t)
+# define BFI_FLINEARS_2146(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2145, v ds
+# define BFI_FLINEARS_2146_TICK(t)
+# define BFI_FLINEARS_2145(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2144, v ds
+# define BFI_FLINEARS_2145_TICK(t)
+# define BFI_FLINEARS_2144(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2143, v ds
+# define BFI_FLINEARS_2144_TICK(t)
+# define BFI_FLINEARS_2143(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2142, v ds
+# define BFI_FLINEARS_2143_TICK(t)
+# define BFI_FLINEARS_2142(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2141, v ds
+# define BFI_FLINEARS_2142_TICK(t)
+# define BFI_FLINEARS_2141(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2140, v ds
+# define BFI_FLINEARS_2141_TICK(t)
+# define BFI_FLINEARS_2140(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2139, v ds
+# define BFI_FLINEARS_2140_TICK(t)
+# define BFI_FLINEARS_2139(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2138, v ds
+# define BFI_FLINEARS_2139_TICK(t)
+# define BFI_FLINEARS_2138(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2137, v ds
+# define BFI_FLINEARS_2138_TICK(t)
+# define BFI_FLINEARS_2137(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2136, v ds
+# define BFI_FLINEARS_2137_TICK(t)
+# define BFI_FLINEARS_2136(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2135, v ds
+# define BFI_FLINEARS_2136_TICK(t)
+# define BFI_FLINEARS_2135(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2134, v ds
+# define BFI_FLINEARS_2135_TICK(t)
+# define BFI_FLINEARS_2134(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2133, v ds
+# define BFI_FLINEARS_2134_TICK(t)
+# define BFI_FLINEARS_2133(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2132, v ds
+# define BFI_FLINEARS_2133_TICK(t)
+# define BFI_FLINEARS_2132(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2131, v ds
+# define BFI_FLINEARS_2132_TICK(t)
+# define BFI_FLINEARS_2131(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2130, v ds
+# define BFI_FLINEARS_2131_TICK(t)
+# define BFI_FLINEARS_2130(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2129, v ds
+# define BFI_FLINEARS_2130_TICK(t)
+# define BFI_FLINEARS_2129(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2128, v ds
+# define BFI_FLINEARS_2129_TICK(t)
+# define BFI_FLINEARS_2128(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2127, v ds
+# define BFI_FLINEARS_2128_TICK(t)
+# define BFI_FLINEARS_2127(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2126, v ds
+# define BFI_FLINEARS_2127_TICK(t)
+# define BFI_FLINEARS_2126(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2125, v ds
+# define BFI_FLINEARS_2126_TICK(t)
+# define BFI_FLINEARS_2125(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2124, v ds
+# define BFI_FLINEARS_2125_TICK(t)
+# define BFI_FLINEARS_2124(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2123, v ds
+# define BFI_FLINEARS_2124_TICK(t)
+# define BFI_FLINEARS_2123(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2122, v ds
+# define BFI_FLINEARS_2123_TICK(t)
+# define BFI_FLINEARS_2122(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2121, v ds
+# define BFI_FLINEARS_2122_TICK(t)
+# define BFI_FLINEARS_2121(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2120, v ds
+# define BFI_FLINEARS_2121_TICK(t)
+# define BFI_FLINEARS_2120(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2119, v ds
+# define BFI_FLINEARS_2120_TICK(t)
+# define BFI_FLINEARS_2119(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2118, v ds
+# define BFI_FLINEARS_2119_TICK(t)
+# define BFI_FLINEARS_2118(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2117, v ds
+# define BFI_FLINEARS_2118_TICK(t)
+# define BFI_FLINEARS_2117(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2116, v ds
+# define BFI_FLINEARS_2117_TICK(t)
+# define BFI_FLINEARS_2116(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2115, v ds
+# define BFI_FLINEARS_2116_TICK(t)
+# define BFI_FLINEARS_2115(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2114, v ds
+# define BFI_FLINEARS_2115_TICK(t)
+# define BFI_FLINEARS_2114(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2113, v ds
+# define BFI_FLINEARS_2114_TICK(t)
+# define BFI_FLINEARS_2113(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2112, v ds
+# define BFI_FLINEARS_2113_TICK(t)
+# define BFI_FLINEARS_2112(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2111, v ds
+# define BFI_FLINEARS_2112_TICK(t)
+# define BFI_FLINEARS_2111(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2110, v ds
+# define BFI_FLINEARS_2111_TICK(t)
+# define BFI_FLINEARS_2110(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2109, v ds
+# define BFI_FLINEARS_2110_TICK(t)
+# define BFI_FLINEARS_2109(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2108, v ds
+# define BFI_FLINEARS_2109_TICK(t)
+# define BFI_FLINEARS_2108(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2107, v ds
+# define BFI_FLINEARS_2108_TICK(t)
+# define BFI_FLINEARS_2107(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2106, v ds
+# define BFI_FLINEARS_2107_TICK(t)
+# define BFI_FLINEARS_2106(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2105, v ds
+# define BFI_FLINEARS_2106_TICK(t)
+# define BFI_FLINEARS_2105(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2104, v ds
+# define BFI_FLINEARS_2105_TICK(t)
+# define BFI_FLINEARS_2104(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2103, v ds
+# define BFI_FLINEARS_2104_TICK(t)
+# define BFI_FLINEARS_2103(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2102, v ds
+# define BFI_FLINEARS_2103_TICK(t)
+# define BFI_FLINEARS_2102(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2101, v ds
+# define BFI_FLINEARS_2102_TICK(t)
+# define BFI_FLINEARS_2101(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2100, v ds
+# define BFI_FLINEARS_2101_TICK(t)
+# define BFI_FLINEARS_2100(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2099, v ds
+# define BFI_FLINEARS_2100_TICK(t)
+# define BFI_FLINEARS_2099(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2098, v ds
+# define BFI_FLINEARS_2099_TICK(t)
+# define BFI_FLINEARS_2098(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2097, v ds
+# define BFI_FLINEARS_2098_TICK(t)
+# define BFI_FLINEARS_2097(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2096, v ds
+# define BFI_FLINEARS_2097_TICK(t)
+# define BFI_FLINEARS_2096(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2095, v ds
+# define BFI_FLINEARS_2096_TICK(t)
+# define BFI_FLINEARS_2095(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2094, v ds
+# define BFI_FLINEARS_2095_TICK(t)
+# define BFI_FLINEARS_2094(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2093, v ds
+# define BFI_FLINEARS_2094_TICK(t)
+# define BFI_FLINEARS_2093(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2092, v ds
+# define BFI_FLINEARS_2093_TICK(t)
+# define BFI_FLINEARS_2092(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2091, v ds
+# define BFI_FLINEARS_2092_TICK(t)
+# define BFI_FLINEARS_2091(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2090, v ds
+# define BFI_FLINEARS_2091_TICK(t)
+# define BFI_FLINEARS_2090(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2089, v ds
+# define BFI_FLINEARS_2090_TICK(t)
+# define BFI_FLINEARS_2089(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2088, v ds
+# define BFI_FLINEARS_2089_TICK(t)
+# define BFI_FLINEARS_2088(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2087, v ds
+# define BFI_FLINEARS_2088_TICK(t)
+# define BFI_FLINEARS_2087(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2086, v ds
+# define BFI_FLINEARS_2087_TICK(t)
+# define BFI_FLINEARS_2086(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2085, v ds
+# define BFI_FLINEARS_2086_TICK(t)
+# define BFI_FLINEARS_2085(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2084, v ds
+# define BFI_FLINEARS_2085_TICK(t)
+# define BFI_FLINEARS_2084(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2083, v ds
+# define BFI_FLINEARS_2084_TICK(t)
+# define BFI_FLINEARS_2083(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2082, v ds
+# define BFI_FLINEARS_2083_TICK(t)
+# define BFI_FLINEARS_2082(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2081, v ds
+# define BFI_FLINEARS_2082_TICK(t)
+# define BFI_FLINEARS_2081(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2080, v ds
+# define BFI_FLINEARS_2081_TICK(t)
+# define BFI_FLINEARS_2080(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2079, v ds
+# define BFI_FLINEARS_2080_TICK(t)
+# define BFI_FLINEARS_2079(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2078, v ds
+# define BFI_FLINEARS_2079_TICK(t)
+# define BFI_FLINEARS_2078(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2077, v ds
+# define BFI_FLINEARS_2078_TICK(t)
+# define BFI_FLINEARS_2077(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2076, v ds
+# define BFI_FLINEARS_2077_TICK(t)
+# define BFI_FLINEARS_2076(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2075, v ds
+# define BFI_FLINEARS_2076_TICK(t)
+# define BFI_FLINEARS_2075(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2074, v ds
+# define BFI_FLINEARS_2075_TICK(t)
+# define BFI_FLINEARS_2074(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2073, v ds
+# define BFI_FLINEARS_2074_TICK(t)
+# define BFI_FLINEARS_2073(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2072, v ds
+# define BFI_FLINEARS_2073_TICK(t)
+# define BFI_FLINEARS_2072(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2071, v ds
+# define BFI_FLINEARS_2072_TICK(t)
+# define BFI_FLINEARS_2071(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2070, v ds
+# define BFI_FLINEARS_2071_TICK(t)
+# define BFI_FLINEARS_2070(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2069, v ds
+# define BFI_FLINEARS_2070_TICK(t)
+# define BFI_FLINEARS_2069(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2068, v ds
+# define BFI_FLINEARS_2069_TICK(t)
+# define BFI_FLINEARS_2068(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2067, v ds
+# define BFI_FLINEARS_2068_TICK(t)
+# define BFI_FLINEARS_2067(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2066, v ds
+# define BFI_FLINEARS_2067_TICK(t)
+# define BFI_FLINEARS_2066(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2065, v ds
+# define BFI_FLINEARS_2066_TICK(t)
+# define BFI_FLINEARS_2065(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2064, v ds
+# define BFI_FLINEARS_2065_TICK(t)
+# define BFI_FLINEARS_2064(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2063, v ds
+# define BFI_FLINEARS_2064_TICK(t)
+# define BFI_FLINEARS_2063(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2062, v ds
+# define BFI_FLINEARS_2063_TICK(t)
+# define BFI_FLINEARS_2062(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2061, v ds
+# define BFI_FLINEARS_2062_TICK(t)
+# define BFI_FLINEARS_2061(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2060, v ds
+# define BFI_FLINEARS_2061_TICK(t)
+# define BFI_FLINEARS_2060(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2059, v ds
+# define BFI_FLINEARS_2060_TICK(t)
+# define BFI_FLINEARS_2059(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2058, v ds
+# define BFI_FLINEARS_2059_TICK(t)
+# define BFI_FLINEARS_2058(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2057, v ds
+# define BFI_FLINEARS_2058_TICK(t)
+# define BFI_FLINEARS_2057(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2056, v ds
+# define BFI_FLINEARS_2057_TICK(t)
+# define BFI_FLINEARS_2056(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2055, v ds
+# define BFI_FLINEARS_2056_TICK(t)
+# define BFI_FLINEARS_2055(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2054, v ds
+# define BFI_FLINEARS_2055_TICK(t)
+# define BFI_FLINEARS_2054(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2053, v ds
+# define BFI_FLINEARS_2054_TICK(t)
+# define BFI_FLINEARS_2053(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2052, v ds
+# define BFI_FLINEARS_2053_TICK(t)
+# define BFI_FLINEARS_2052(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2051, v ds
+# define BFI_FLINEARS_2052_TICK(t)
+# define BFI_FLINEARS_2051(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2050, v ds
+# define BFI_FLINEARS_2051_TICK(t)
+# define BFI_FLINEARS_2050(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2049, v ds
+# define BFI_FLINEARS_2050_TICK(t)
+# define BFI_FLINEARS_2049(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2048, v ds
+# define BFI_FLINEARS_2049_TICK(t)
+# define BFI_FLINEARS_2048(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2047, v ds
+# define BFI_FLINEARS_2048_TICK(t)
+# define BFI_FLINEARS_2047(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2046, v ds
+# define BFI_FLINEARS_2047_TICK(t)
+# define BFI_FLINEARS_2046(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2045, v ds
+# define BFI_FLINEARS_2046_TICK(t)
+# define BFI_FLINEARS_2045(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2044, v ds
+# define BFI_FLINEARS_2045_TICK(t)
+# define BFI_FLINEARS_2044(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2043, v ds
+# define BFI_FLINEARS_2044_TICK(t)
+# define BFI_FLINEARS_2043(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2042, v ds
+# define BFI_FLINEARS_2043_TICK(t)
+# define BFI_FLINEARS_2042(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2041, v ds
+# define BFI_FLINEARS_2042_TICK(t)
+# define BFI_FLINEARS_2041(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2040, v ds
+# define BFI_FLINEARS_2041_TICK(t)
+# define BFI_FLINEARS_2040(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2039, v ds
+# define BFI_FLINEARS_2040_TICK(t)
+# define BFI_FLINEARS_2039(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2038, v ds
+# define BFI_FLINEARS_2039_TICK(t)
+# define BFI_FLINEARS_2038(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2037, v ds
+# define BFI_FLINEARS_2038_TICK(t)
+# define BFI_FLINEARS_2037(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2036, v ds
+# define BFI_FLINEARS_2037_TICK(t)
+# define BFI_FLINEARS_2036(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2035, v ds
+# define BFI_FLINEARS_2036_TICK(t)
+# define BFI_FLINEARS_2035(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2034, v ds
+# define BFI_FLINEARS_2035_TICK(t)
+# define BFI_FLINEARS_2034(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2033, v ds
+# define BFI_FLINEARS_2034_TICK(t)
+# define BFI_FLINEARS_2033(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2032, v ds
+# define BFI_FLINEARS_2033_TICK(t)
+# define BFI_FLINEARS_2032(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2031, v ds
+# define BFI_FLINEARS_2032_TICK(t)
+# define BFI_FLINEARS_2031(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2030, v ds
+# define BFI_FLINEARS_2031_TICK(t)
+# define BFI_FLINEARS_2030(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2029, v ds
+# define BFI_FLINEARS_2030_TICK(t)
+# define BFI_FLINEARS_2029(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2028, v ds
+# define BFI_FLINEARS_2029_TICK(t)
+# define BFI_FLINEARS_2028(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2027, v ds
+# define BFI_FLINEARS_2028_TICK(t)
+# define BFI_FLINEARS_2027(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2026, v ds
+# define BFI_FLINEARS_2027_TICK(t)
+# define BFI_FLINEARS_2026(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2025, v ds
+# define BFI_FLINEARS_2026_TICK(t)
+# define BFI_FLINEARS_2025(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2024, v ds
+# define BFI_FLINEARS_2025_TICK(t)
+# define BFI_FLINEARS_2024(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2023, v ds
+# define BFI_FLINEARS_2024_TICK(t)
+# define BFI_FLINEARS_2023(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2022, v ds
+# define BFI_FLINEARS_2023_TICK(t)
+# define BFI_FLINEARS_2022(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2021, v ds
+# define BFI_FLINEARS_2022_TICK(t)
+# define BFI_FLINEARS_2021(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2020, v ds
+# define BFI_FLINEARS_2021_TICK(t)
+# define BFI_FLINEARS_2020(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2019, v ds
+# define BFI_FLINEARS_2020_TICK(t)
+# define BFI_FLINEARS_2019(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2018, v ds
+# define BFI_FLINEARS_2019_TICK(t)
+# define BFI_FLINEARS_2018(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2017, v ds
+# define BFI_FLINEARS_2018_TICK(t)
+# define BFI_FLINEARS_2017(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2016, v ds
+# define BFI_FLINEARS_2017_TICK(t)
+# define BFI_FLINEARS_2016(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2015, v ds
+# define BFI_FLINEARS_2016_TICK(t)
+# define BFI_FLINEARS_2015(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2014, v ds
+# define BFI_FLINEARS_2015_TICK(t)
+# define BFI_FLINEARS_2014(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2013, v ds
+# define BFI_FLINEARS_2014_TICK(t)
+# define BFI_FLINEARS_2013(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2012, v ds
+# define BFI_FLINEARS_2013_TICK(t)
+# define BFI_FLINEARS_2012(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2011, v ds
+# define BFI_FLINEARS_2012_TICK(t)
+# define BFI_FLINEARS_2011(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2010, v ds
+# define BFI_FLINEARS_2011_TICK(t)
+# define BFI_FLINEARS_2010(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2009, v ds
+# define BFI_FLINEARS_2010_TICK(t)
+# define BFI_FLINEARS_2009(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2008, v ds
+# define BFI_FLINEARS_2009_TICK(t)
+# define BFI_FLINEARS_2008(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2007, v ds
+# define BFI_FLINEARS_2008_TICK(t)
+# define BFI_FLINEARS_2007(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2006, v ds
+# define BFI_FLINEARS_2007_TICK(t)
+# define BFI_FLINEARS_2006(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2005, v ds
+# define BFI_FLINEARS_2006_TICK(t)
+# define BFI_FLINEARS_2005(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2004, v ds
+# define BFI_FLINEARS_2005_TICK(t)
+# define BFI_FLINEARS_2004(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2003, v ds
+# define BFI_FLINEARS_2004_TICK(t)
+# define BFI_FLINEARS_2003(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2002, v ds
+# define BFI_FLINEARS_2003_TICK(t)
+# define BFI_FLINEARS_2002(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2001, v ds
+# define BFI_FLINEARS_2002_TICK(t)
+# define BFI_FLINEARS_2001(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2000, v ds
+# define BFI_FLINEARS_2001_TICK(t)
+# define BFI_FLINEARS_2000(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1999, v ds
+# define BFI_FLINEARS_2000_TICK(t)
+# define BFI_FLINEARS_1999(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1998, v ds
+# define BFI_FLINEARS_1999_TICK(t)
+# define BFI_FLINEARS_1998(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1997, v ds
+# define BFI_FLINEARS_1998_TICK(t)
+# define BFI_FLINEARS_1997(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1996, v ds
+# define BFI_FLINEARS_1997_TICK(t)
+# define BFI_FLINEARS_1996(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1995, v ds
+# define BFI_FLINEARS_1996_TICK(t)
+# define BFI_FLINEARS_1995(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1994, v ds
+# define BFI_FLINEARS_1995_TICK(t)
+# define BFI_FLINEARS_1994(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1993, v ds
+# define BFI_FLINEARS_1994_TICK(t)
+# define BFI_FLINEARS_1993(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1992, v ds
+# define BFI_FLINEARS_1993_TICK(t)
+# define BFI_FLINEARS_1992(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1991, v ds
+# define BFI_FLINEARS_1992_TICK(t)
+# define BFI_FLINEARS_1991(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1990, v ds
+# define BFI_FLINEARS_1991_TICK(t)
+# define BFI_FLINEARS_1990(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1989, v ds
+# define BFI_FLINEARS_1990_TICK(t)
+# define BFI_FLINEARS_1989(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1988, v ds
+# define BFI_FLINEARS_1989_TICK(t)
+# define BFI_FLINEARS_1988(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1987, v ds
+# define BFI_FLINEARS_1988_TICK(t)
+# define BFI_FLINEARS_1987(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1986, v ds
+# define BFI_FLINEARS_1987_TICK(t)
+# define BFI_FLINEARS_1986(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1985, v ds
+# define BFI_FLINEARS_1986_TICK(t)
+# define BFI_FLINEARS_1985(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1984, v ds
+# define BFI_FLINEARS_1985_TICK(t)
+# define BFI_FLINEARS_1984(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1983, v ds
+# define BFI_FLINEARS_1984_TICK(t)
+# define BFI_FLINEARS_1983(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1982, v ds
+# define BFI_FLINEARS_1983_TICK(t)
+# define BFI_FLINEARS_1982(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1981, v ds
+# define BFI_FLINEARS_1982_TICK(t)
+# define BFI_FLINEARS_1981(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1980, v ds
+# define BFI_FLINEARS_1981_TICK(t)
+# define BFI_FLINEARS_1980(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1979, v ds
+# define BFI_FLINEARS_1980_TICK(t)
+# define BFI_FLINEARS_1979(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1978, v ds
+# define BFI_FLINEARS_1979_TICK(t)
+# define BFI_FLINEARS_1978(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1977, v ds
+# define BFI_FLINEARS_1978_TICK(t)
+# define BFI_FLINEARS_1977(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1976, v ds
+# define BFI_FLINEARS_1977_TICK(t)
+# define BFI_FLINEARS_1976(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1975, v ds
+# define BFI_FLINEARS_1976_TICK(t)
+# define BFI_FLINEARS_1975(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1974, v ds
+# define BFI_FLINEARS_1975_TICK(t)
+# define BFI_FLINEARS_1974(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1973, v ds
+# define BFI_FLINEARS_1974_TICK(t)
+# define BFI_FLINEARS_1973(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1972, v ds
+# define BFI_FLINEARS_1973_TICK(t)
+# define BFI_FLINEARS_1972(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1971, v ds
+# define BFI_FLINEARS_1972_TICK(t)
+# define BFI_FLINEARS_1971(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1970, v ds
+# define BFI_FLINEARS_1971_TICK(t)
+# define BFI_FLINEARS_1970(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1969, v ds
+# define BFI_FLINEARS_1970_TICK(t)
+# define BFI_FLINEARS_1969(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1968, v ds
+# define BFI_FLINEARS_1969_TICK(t)
+# define BFI_FLINEARS_1968(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1967, v ds
+# define BFI_FLINEARS_1968_TICK(t)
+# define BFI_FLINEARS_1967(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1966, v ds
+# define BFI_FLINEARS_1967_TICK(t)
+# define BFI_FLINEARS_1966(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1965, v ds
+# define BFI_FLINEARS_1966_TICK(t)
+# define BFI_FLINEARS_1965(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1964, v ds
+# define BFI_FLINEARS_1965_TICK(t)
+# define BFI_FLINEARS_1964(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1963, v ds
+# define BFI_FLINEARS_1964_TICK(t)
+# define BFI_FLINEARS_1963(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1962, v ds
+# define BFI_FLINEARS_1963_TICK(t)
+# define BFI_FLINEARS_1962(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1961, v ds
+# define BFI_FLINEARS_1962_TICK(t)
+# define BFI_FLINEARS_1961(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1960, v ds
+# define BFI_FLINEARS_1961_TICK(t)
+# define BFI_FLINEARS_1960(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1959, v ds
+# define BFI_FLINEARS_1960_TICK(t)
+# define BFI_FLINEARS_1959(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1958, v ds
+# define BFI_FLINEARS_1959_TICK(t)
+# define BFI_FLINEARS_1958(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1957, v ds
+# define BFI_FLINEARS_1958_TICK(t)
+# define BFI_FLINEARS_1957(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1956, v ds
+# define BFI_FLINEARS_1957_TICK(t)
+# define BFI_FLINEARS_1956(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1955, v ds
+# define BFI_FLINEARS_1956_TICK(t)
+# define BFI_FLINEARS_1955(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1954, v ds
+# define BFI_FLINEARS_1955_TICK(t)
+# define BFI_FLINEARS_1954(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1953, v ds
+# define BFI_FLINEARS_1954_TICK(t)
+# define BFI_FLINEARS_1953(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1952, v ds
+# define BFI_FLINEARS_1953_TICK(t)
+# define BFI_FLINEARS_1952(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1951, v ds
+# define BFI_FLINEARS_1952_TICK(t)
+# define BFI_FLINEARS_1951(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1950, v ds
+# define BFI_FLINEARS_1951_TICK(t)
+# define BFI_FLINEARS_1950(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1949, v ds
+# define BFI_FLINEARS_1950_TICK(t)
+# define BFI_FLINEARS_1949(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1948, v ds
+# define BFI_FLINEARS_1949_TICK(t)
+# define BFI_FLINEARS_1948(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1947, v ds
+# define BFI_FLINEARS_1948_TICK(t)
+# define BFI_FLINEARS_1947(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1946, v ds
+# define BFI_FLINEARS_1947_TICK(t)
+# define BFI_FLINEARS_1946(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1945, v ds
+# define BFI_FLINEARS_1946_TICK(t)
+# define BFI_FLINEARS_1945(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1944, v ds
+# define BFI_FLINEARS_1945_TICK(t)
+# define BFI_FLINEARS_1944(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1943, v ds
+# define BFI_FLINEARS_1944_TICK(t)
+# define BFI_FLINEARS_1943(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1942, v ds
+# define BFI_FLINEARS_1943_TICK(t)
+# define BFI_FLINEARS_1942(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1941, v ds
+# define BFI_FLINEARS_1942_TICK(t)
+# define BFI_FLINEARS_1941(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1940, v ds
+# define BFI_FLINEARS_1941_TICK(t)
+# define BFI_FLINEARS_1940(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1939, v ds
+# define BFI_FLINEARS_1940_TICK(t)
+# define BFI_FLINEARS_1939(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1938, v ds
+# define BFI_FLINEARS_1939_TICK(t)
+# define BFI_FLINEARS_1938(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1937, v ds
+# define BFI_FLINEARS_1938_TICK(t)
+# define BFI_FLINEARS_1937(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1936, v ds
+# define BFI_FLINEARS_1937_TICK(t)
+# define BFI_FLINEARS_1936(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1935, v ds
+# define BFI_FLINEARS_1936_TICK(t)
+# define BFI_FLINEARS_1935(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1934, v ds
+# define BFI_FLINEARS_1935_TICK(t)
+# define BFI_FLINEARS_1934(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1933, v ds
+# define BFI_FLINEARS_1934_TICK(t)
+# define BFI_FLINEARS_1933(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1932, v ds
+# define BFI_FLINEARS_1933_TICK(t)
+# define BFI_FLINEARS_1932(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1931, v ds
+# define BFI_FLINEARS_1932_TICK(t)
+# define BFI_FLINEARS_1931(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1930, v ds
+# define BFI_FLINEARS_1931_TICK(t)
+# define BFI_FLINEARS_1930(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1929, v ds
+# define BFI_FLINEARS_1930_TICK(t)
+# define BFI_FLINEARS_1929(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1928, v ds
+# define BFI_FLINEARS_1929_TICK(t)
+# define BFI_FLINEARS_1928(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1927, v ds
+# define BFI_FLINEARS_1928_TICK(t)
+# define BFI_FLINEARS_1927(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1926, v ds
+# define BFI_FLINEARS_1927_TICK(t)
+# define BFI_FLINEARS_1926(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1925, v ds
+# define BFI_FLINEARS_1926_TICK(t)
+# define BFI_FLINEARS_1925(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1924, v ds
+# define BFI_FLINEARS_1925_TICK(t)
+# define BFI_FLINEARS_1924(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1923, v ds
+# define BFI_FLINEARS_1924_TICK(t)
+# define BFI_FLINEARS_1923(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1922, v ds
+# define BFI_FLINEARS_1923_TICK(t)
+# define BFI_FLINEARS_1922(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1921, v ds
+# define BFI_FLINEARS_1922_TICK(t)
+# define BFI_FLINEARS_1921(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1920, v ds
+# define BFI_FLINEARS_1921_TICK(t)
+# define BFI_FLINEARS_1920(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1919, v ds
+# define BFI_FLINEARS_1920_TICK(t)
+# define BFI_FLINEARS_1919(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1918, v ds
+# define BFI_FLINEARS_1919_TICK(t)
+# define BFI_FLINEARS_1918(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1917, v ds
+# define BFI_FLINEARS_1918_TICK(t)
+# define BFI_FLINEARS_1917(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1916, v ds
+# define BFI_FLINEARS_1917_TICK(t)
+# define BFI_FLINEARS_1916(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1915, v ds
+# define BFI_FLINEARS_1916_TICK(t)
+# define BFI_FLINEARS_1915(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1914, v ds
+# define BFI_FLINEARS_1915_TICK(t)
+# define BFI_FLINEARS_1914(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1913, v ds
+# define BFI_FLINEARS_1914_TICK(t)
+# define BFI_FLINEARS_1913(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1912, v ds
+# define BFI_FLINEARS_1913_TICK(t)
+# define BFI_FLINEARS_1912(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1911, v ds
+# define BFI_FLINEARS_1912_TICK(t)
+# define BFI_FLINEARS_1911(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1910, v ds
+# define BFI_FLINEARS_1911_TICK(t)
+# define BFI_FLINEARS_1910(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1909, v ds
+# define BFI_FLINEARS_1910_TICK(t)
+# define BFI_FLINEARS_1909(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1908, v ds
+# define BFI_FLINEARS_1909_TICK(t)
+# define BFI_FLINEARS_1908(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1907, v ds
+# define BFI_FLINEARS_1908_TICK(t)
+# define BFI_FLINEARS_1907(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1906, v ds
+# define BFI_FLINEARS_1907_TICK(t)
+# define BFI_FLINEARS_1906(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1905, v ds
+# define BFI_FLINEARS_1906_TICK(t)
+# define BFI_FLINEARS_1905(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1904, v ds
+# define BFI_FLINEARS_1905_TICK(t)
+# define BFI_FLINEARS_1904(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1903, v ds
+# define BFI_FLINEARS_1904_TICK(t)
+# define BFI_FLINEARS_1903(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1902, v ds
+# define BFI_FLINEARS_1903_TICK(t)
+# define BFI_FLINEARS_1902(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1901, v ds
+# define BFI_FLINEARS_1902_TICK(t)
+# define BFI_FLINEARS_1901(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1900, v ds
+# define BFI_FLINEARS_1901_TICK(t)
+# define BFI_FLINEARS_1900(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1899, v ds
+# define BFI_FLINEARS_1900_TICK(t)
+# define BFI_FLINEARS_1899(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1898, v ds
+# define BFI_FLINEARS_1899_TICK(t)
+# define BFI_FLINEARS_1898(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1897, v ds
+# define BFI_FLINEARS_1898_TICK(t)
+# define BFI_FLINEARS_1897(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1896, v ds
+# define BFI_FLINEARS_1897_TICK(t)
+# define BFI_FLINEARS_1896(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1895, v ds
+# define BFI_FLINEARS_1896_TICK(t)
+# define BFI_FLINEARS_1895(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1894, v ds
+# define BFI_FLINEARS_1895_TICK(t)
+# define BFI_FLINEARS_1894(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1893, v ds
+# define BFI_FLINEARS_1894_TICK(t)
+# define BFI_FLINEARS_1893(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1892, v ds
+# define BFI_FLINEARS_1893_TICK(t)
+# define BFI_FLINEARS_1892(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1891, v ds
+# define BFI_FLINEARS_1892_TICK(t)
+# define BFI_FLINEARS_1891(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1890, v ds
+# define BFI_FLINEARS_1891_TICK(t)
+# define BFI_FLINEARS_1890(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1889, v ds
+# define BFI_FLINEARS_1890_TICK(t)
+# define BFI_FLINEARS_1889(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1888, v ds
+# define BFI_FLINEARS_1889_TICK(t)
+# define BFI_FLINEARS_1888(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1887, v ds
+# define BFI_FLINEARS_1888_TICK(t)
+# define BFI_FLINEARS_1887(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1886, v ds
+# define BFI_FLINEARS_1887_TICK(t)
+# define BFI_FLINEARS_1886(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1885, v ds
+# define BFI_FLINEARS_1886_TICK(t)
+# define BFI_FLINEARS_1885(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1884, v ds
+# define BFI_FLINEARS_1885_TICK(t)
+# define BFI_FLINEARS_1884(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1883, v ds
+# define BFI_FLINEARS_1884_TICK(t)
+# define BFI_FLINEARS_1883(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1882, v ds
+# define BFI_FLINEARS_1883_TICK(t)
+# define BFI_FLINEARS_1882(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1881, v ds
+# define BFI_FLINEARS_1882_TICK(t)
+# define BFI_FLINEARS_1881(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1880, v ds
+# define BFI_FLINEARS_1881_TICK(t)
+# define BFI_FLINEARS_1880(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1879, v ds
+# define BFI_FLINEARS_1880_TICK(t)
+# define BFI_FLINEARS_1879(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1878, v ds
+# define BFI_FLINEARS_1879_TICK(t)
+# define BFI_FLINEARS_1878(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1877, v ds
+# define BFI_FLINEARS_1878_TICK(t)
+# define BFI_FLINEARS_1877(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1876, v ds
+# define BFI_FLINEARS_1877_TICK(t)
+# define BFI_FLINEARS_1876(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1875, v ds
+# define BFI_FLINEARS_1876_TICK(t)
+# define BFI_FLINEARS_1875(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1874, v ds
+# define BFI_FLINEARS_1875_TICK(t)
+# define BFI_FLINEARS_1874(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1873, v ds
+# define BFI_FLINEARS_1874_TICK(t)
+# define BFI_FLINEARS_1873(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1872, v ds
+# define BFI_FLINEARS_1873_TICK(t)
+# define BFI_FLINEARS_1872(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1871, v ds
+# define BFI_FLINEARS_1872_TICK(t)
+# define BFI_FLINEARS_1871(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1870, v ds
+# define BFI_FLINEARS_1871_TICK(t)
+# define BFI_FLINEARS_1870(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1869, v ds
+# define BFI_FLINEARS_1870_TICK(t)
+# define BFI_FLINEARS_1869(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1868, v ds
+# define BFI_FLINEARS_1869_TICK(t)
+# define BFI_FLINEARS_1868(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1867, v ds
+# define BFI_FLINEARS_1868_TICK(t)
+# define BFI_FLINEARS_1867(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1866, v ds
+# define BFI_FLINEARS_1867_TICK(t)
+# define BFI_FLINEARS_1866(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1865, v ds
+# define BFI_FLINEARS_1866_TICK(t)
+# define BFI_FLINEARS_1865(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1864, v ds
+# define BFI_FLINEARS_1865_TICK(t)
+# define BFI_FLINEARS_1864(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1863, v ds
+# define BFI_FLINEARS_1864_TICK(t)
+# define BFI_FLINEARS_1863(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1862, v ds
+# define BFI_FLINEARS_1863_TICK(t)
+# define BFI_FLINEARS_1862(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1861, v ds
+# define BFI_FLINEARS_1862_TICK(t)
+# define BFI_FLINEARS_1861(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1860, v ds
+# define BFI_FLINEARS_1861_TICK(t)
+# define BFI_FLINEARS_1860(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1859, v ds
+# define BFI_FLINEARS_1860_TICK(t)
+# define BFI_FLINEARS_1859(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1858, v ds
+# define BFI_FLINEARS_1859_TICK(t)
+# define BFI_FLINEARS_1858(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1857, v ds
+# define BFI_FLINEARS_1858_TICK(t)
+# define BFI_FLINEARS_1857(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1856, v ds
+# define BFI_FLINEARS_1857_TICK(t)
+# define BFI_FLINEARS_1856(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1855, v ds
+# define BFI_FLINEARS_1856_TICK(t)
+# define BFI_FLINEARS_1855(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1854, v ds
+# define BFI_FLINEARS_1855_TICK(t)
+# define BFI_FLINEARS_1854(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1853, v ds
+# define BFI_FLINEARS_1854_TICK(t)
+# define BFI_FLINEARS_1853(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1852, v ds
+# define BFI_FLINEARS_1853_TICK(t)
+# define BFI_FLINEARS_1852(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1851, v ds
+# define BFI_FLINEARS_1852_TICK(t)
+# define BFI_FLINEARS_1851(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1850, v ds
+# define BFI_FLINEARS_1851_TICK(t)
+# define BFI_FLINEARS_1850(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1849, v ds
+# define BFI_FLINEARS_1850_TICK(t)
+# define BFI_FLINEARS_1849(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1848, v ds
+# define BFI_FLINEARS_1849_TICK(t)
+# define BFI_FLINEARS_1848(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1847, v ds
+# define BFI_FLINEARS_1848_TICK(t)
+# define BFI_FLINEARS_1847(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1846, v ds
+# define BFI_FLINEARS_1847_TICK(t)
+# define BFI_FLINEARS_1846(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1845, v ds
+# define BFI_FLINEARS_1846_TICK(t)
+# define BFI_FLINEARS_1845(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1844, v ds
+# define BFI_FLINEARS_1845_TICK(t)
+# define BFI_FLINEARS_1844(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1843, v ds
+# define BFI_FLINEARS_1844_TICK(t)
+# define BFI_FLINEARS_1843(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1842, v ds
+# define BFI_FLINEARS_1843_TICK(t)
+# define BFI_FLINEARS_1842(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1841, v ds
+# define BFI_FLINEARS_1842_TICK(t)
+# define BFI_FLINEARS_1841(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1840, v ds
+# define BFI_FLINEARS_1841_TICK(t)
+# define BFI_FLINEARS_1840(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1839, v ds
+# define BFI_FLINEARS_1840_TICK(t)
+# define BFI_FLINEARS_1839(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1838, v ds
+# define BFI_FLINEARS_1839_TICK(t)
+# define BFI_FLINEARS_1838(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1837, v ds
+# define BFI_FLINEARS_1838_TICK(t)
+# define BFI_FLINEARS_1837(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1836, v ds
+# define BFI_FLINEARS_1837_TICK(t)
+# define BFI_FLINEARS_1836(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1835, v ds
+# define BFI_FLINEARS_1836_TICK(t)
+# define BFI_FLINEARS_1835(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1834, v ds
+# define BFI_FLINEARS_1835_TICK(t)
+# define BFI_FLINEARS_1834(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1833, v ds
+# define BFI_FLINEARS_1834_TICK(t)
+# define BFI_FLINEARS_1833(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1832, v ds
+# define BFI_FLINEARS_1833_TICK(t)
+# define BFI_FLINEARS_1832(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1831, v ds
+# define BFI_FLINEARS_1832_TICK(t)
+# define BFI_FLINEARS_1831(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1830, v ds
+# define BFI_FLINEARS_1831_TICK(t)
+# define BFI_FLINEARS_1830(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1829, v ds
+# define BFI_FLINEARS_1830_TICK(t)
+# define BFI_FLINEARS_1829(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1828, v ds
+# define BFI_FLINEARS_1829_TICK(t)
+# define BFI_FLINEARS_1828(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1827, v ds
+# define BFI_FLINEARS_1828_TICK(t)
+# define BFI_FLINEARS_1827(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1826, v ds
+# define BFI_FLINEARS_1827_TICK(t)
+# define BFI_FLINEARS_1826(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1825, v ds
+# define BFI_FLINEARS_1826_TICK(t)
+# define BFI_FLINEARS_1825(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1824, v ds
+# define BFI_FLINEARS_1825_TICK(t)
+# define BFI_FLINEARS_1824(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1823, v ds
+# define BFI_FLINEARS_1824_TICK(t)
+# define BFI_FLINEARS_1823(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1822, v ds
+# define BFI_FLINEARS_1823_TICK(t)
+# define BFI_FLINEARS_1822(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1821, v ds
+# define BFI_FLINEARS_1822_TICK(t)
+# define BFI_FLINEARS_1821(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1820, v ds
+# define BFI_FLINEARS_1821_TICK(t)
+# define BFI_FLINEARS_1820(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1819, v ds
+# define BFI_FLINEARS_1820_TICK(t)
+# define BFI_FLINEARS_1819(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1818, v ds
+# define BFI_FLINEARS_1819_TICK(t)
+# define BFI_FLINEARS_1818(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1817, v ds
+# define BFI_FLINEARS_1818_TICK(t)
+# define BFI_FLINEARS_1817(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1816, v ds
+# define BFI_FLINEARS_1817_TICK(t)
+# define BFI_FLINEARS_1816(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1815, v ds
+# define BFI_FLINEARS_1816_TICK(t)
+# define BFI_FLINEARS_1815(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1814, v ds
+# define BFI_FLINEARS_1815_TICK(t)
+# define BFI_FLINEARS_1814(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1813, v ds
+# define BFI_FLINEARS_1814_TICK(t)
+# define BFI_FLINEARS_1813(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1812, v ds
+# define BFI_FLINEARS_1813_TICK(t)
+# define BFI_FLINEARS_1812(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1811, v ds
+# define BFI_FLINEARS_1812_TICK(t)
+# define BFI_FLINEARS_1811(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1810, v ds
+# define BFI_FLINEARS_1811_TICK(t)
+# define BFI_FLINEARS_1810(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1809, v ds
+# define BFI_FLINEARS_1810_TICK(t)
+# define BFI_FLINEARS_1809(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1808, v ds
+# define BFI_FLINEARS_1809_TICK(t)
+# define BFI_FLINEARS_1808(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1807, v ds
+# define BFI_FLINEARS_1808_TICK(t)
+# define BFI_FLINEARS_1807(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1806, v ds
+# define BFI_FLINEARS_1807_TICK(t)
+# define BFI_FLINEARS_1806(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1805, v ds
+# define BFI_FLINEARS_1806_TICK(t)
+# define BFI_FLINEARS_1805(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1804, v ds
+# define BFI_FLINEARS_1805_TICK(t)
+# define BFI_FLINEARS_1804(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1803, v ds
+# define BFI_FLINEARS_1804_TICK(t)
+# define BFI_FLINEARS_1803(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1802, v ds
+# define BFI_FLINEARS_1803_TICK(t)
+# define BFI_FLINEARS_1802(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1801, v ds
+# define BFI_FLINEARS_1802_TICK(t)
+# define BFI_FLINEARS_1801(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1800, v ds
+# define BFI_FLINEARS_1801_TICK(t)
+# define BFI_FLINEARS_1800(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1799, v ds
+# define BFI_FLINEARS_1800_TICK(t)
+# define BFI_FLINEARS_1799(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1798, v ds
+# define BFI_FLINEARS_1799_TICK(t)
+# define BFI_FLINEARS_1798(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1797, v ds
+# define BFI_FLINEARS_1798_TICK(t)
+# define BFI_FLINEARS_1797(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1796, v ds
+# define BFI_FLINEARS_1797_TICK(t)
+# define BFI_FLINEARS_1796(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1795, v ds
+# define BFI_FLINEARS_1796_TICK(t)
+# define BFI_FLINEARS_1795(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1794, v ds
+# define BFI_FLINEARS_1795_TICK(t)
+# define BFI_FLINEARS_1794(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1793, v ds
+# define BFI_FLINEARS_1794_TICK(t)
+# define BFI_FLINEARS_1793(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1792, v ds
+# define BFI_FLINEARS_1793_TICK(t)
+# define BFI_FLINEARS_1792(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1791, v ds
+# define BFI_FLINEARS_1792_TICK(t)
+# define BFI_FLINEARS_1791(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1790, v ds
+# define BFI_FLINEARS_1791_TICK(t)
+# define BFI_FLINEARS_1790(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1789, v ds
+# define BFI_FLINEARS_1790_TICK(t)
+# define BFI_FLINEARS_1789(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1788, v ds
+# define BFI_FLINEARS_1789_TICK(t)
+# define BFI_FLINEARS_1788(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1787, v ds
+# define BFI_FLINEARS_1788_TICK(t)
+# define BFI_FLINEARS_1787(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1786, v ds
+# define BFI_FLINEARS_1787_TICK(t)
+# define BFI_FLINEARS_1786(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1785, v ds
+# define BFI_FLINEARS_1786_TICK(t)
+# define BFI_FLINEARS_1785(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1784, v ds
+# define BFI_FLINEARS_1785_TICK(t)
+# define BFI_FLINEARS_1784(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1783, v ds
+# define BFI_FLINEARS_1784_TICK(t)
+# define BFI_FLINEARS_1783(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1782, v ds
+# define BFI_FLINEARS_1783_TICK(t)
+# define BFI_FLINEARS_1782(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1781, v ds
+# define BFI_FLINEARS_1782_TICK(t)
+# define BFI_FLINEARS_1781(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1780, v ds
+# define BFI_FLINEARS_1781_TICK(t)
+# define BFI_FLINEARS_1780(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1779, v ds
+# define BFI_FLINEARS_1780_TICK(t)
+# define BFI_FLINEARS_1779(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1778, v ds
+# define BFI_FLINEARS_1779_TICK(t)
+# define BFI_FLINEARS_1778(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1777, v ds
+# define BFI_FLINEARS_1778_TICK(t)
+# define BFI_FLINEARS_1777(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1776, v ds
+# define BFI_FLINEARS_1777_TICK(t)
+# define BFI_FLINEARS_1776(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1775, v ds
+# define BFI_FLINEARS_1776_TICK(t)
+# define BFI_FLINEARS_1775(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1774, v ds
+# define BFI_FLINEARS_1775_TICK(t)
+# define BFI_FLINEARS_1774(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1773, v ds
+# define BFI_FLINEARS_1774_TICK(t)
+# define BFI_FLINEARS_1773(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1772, v ds
+# define BFI_FLINEARS_1773_TICK(t)
+# define BFI_FLINEARS_1772(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1771, v ds
+# define BFI_FLINEARS_1772_TICK(t)
+# define BFI_FLINEARS_1771(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1770, v ds
+# define BFI_FLINEARS_1771_TICK(t)
+# define BFI_FLINEARS_1770(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1769, v ds
+# define BFI_FLINEARS_1770_TICK(t)
+# define BFI_FLINEARS_1769(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1768, v ds
+# define BFI_FLINEARS_1769_TICK(t)
+# define BFI_FLINEARS_1768(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1767, v ds
+# define BFI_FLINEARS_1768_TICK(t)
+# define BFI_FLINEARS_1767(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1766, v ds
+# define BFI_FLINEARS_1767_TICK(t)
+# define BFI_FLINEARS_1766(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1765, v ds
+# define BFI_FLINEARS_1766_TICK(t)
+# define BFI_FLINEARS_1765(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1764, v ds
+# define BFI_FLINEARS_1765_TICK(t)
+# define BFI_FLINEARS_1764(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1763, v ds
+# define BFI_FLINEARS_1764_TICK(t)
+# define BFI_FLINEARS_1763(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1762, v ds
+# define BFI_FLINEARS_1763_TICK(t)
+# define BFI_FLINEARS_1762(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1761, v ds
+# define BFI_FLINEARS_1762_TICK(t)
+# define BFI_FLINEARS_1761(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1760, v ds
+# define BFI_FLINEARS_1761_TICK(t)
+# define BFI_FLINEARS_1760(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1759, v ds
+# define BFI_FLINEARS_1760_TICK(t)
+# define BFI_FLINEARS_1759(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1758, v ds
+# define BFI_FLINEARS_1759_TICK(t)
+# define BFI_FLINEARS_1758(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1757, v ds
+# define BFI_FLINEARS_1758_TICK(t)
+# define BFI_FLINEARS_1757(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1756, v ds
+# define BFI_FLINEARS_1757_TICK(t)
+# define BFI_FLINEARS_1756(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1755, v ds
+# define BFI_FLINEARS_1756_TICK(t)
+# define BFI_FLINEARS_1755(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1754, v ds
+# define BFI_FLINEARS_1755_TICK(t)
+# define BFI_FLINEARS_1754(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1753, v ds
+# define BFI_FLINEARS_1754_TICK(t)
+# define BFI_FLINEARS_1753(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1752, v ds
+# define BFI_FLINEARS_1753_TICK(t)
+# define BFI_FLINEARS_1752(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1751, v ds
+# define BFI_FLINEARS_1752_TICK(t)
+# define BFI_FLINEARS_1751(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1750, v ds
+# define BFI_FLINEARS_1751_TICK(t)
+# define BFI_FLINEARS_1750(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1749, v ds
+# define BFI_FLINEARS_1750_TICK(t)
+# define BFI_FLINEARS_1749(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1748, v ds
+# define BFI_FLINEARS_1749_TICK(t)
+# define BFI_FLINEARS_1748(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1747, v ds
+# define BFI_FLINEARS_1748_TICK(t)
+# define BFI_FLINEARS_1747(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1746, v ds
+# define BFI_FLINEARS_1747_TICK(t)
+# define BFI_FLINEARS_1746(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1745, v ds
+# define BFI_FLINEARS_1746_TICK(t)
+# define BFI_FLINEARS_1745(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1744, v ds
+# define BFI_FLINEARS_1745_TICK(t)
+# define BFI_FLINEARS_1744(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1743, v ds
+# define BFI_FLINEARS_1744_TICK(t)
+# define BFI_FLINEARS_1743(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1742, v ds
+# define BFI_FLINEARS_1743_TICK(t)
+# define BFI_FLINEARS_1742(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1741, v ds
+# define BFI_FLINEARS_1742_TICK(t)
+# define BFI_FLINEARS_1741(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1740, v ds
+# define BFI_FLINEARS_1741_TICK(t)
+# define BFI_FLINEARS_1740(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1739, v ds
+# define BFI_FLINEARS_1740_TICK(t)
+# define BFI_FLINEARS_1739(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1738, v ds
+# define BFI_FLINEARS_1739_TICK(t)
+# define BFI_FLINEARS_1738(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1737, v ds
+# define BFI_FLINEARS_1738_TICK(t)
+# define BFI_FLINEARS_1737(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1736, v ds
+# define BFI_FLINEARS_1737_TICK(t)
+# define BFI_FLINEARS_1736(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1735, v ds
+# define BFI_FLINEARS_1736_TICK(t)
+# define BFI_FLINEARS_1735(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1734, v ds
+# define BFI_FLINEARS_1735_TICK(t)
+# define BFI_FLINEARS_1734(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1733, v ds
+# define BFI_FLINEARS_1734_TICK(t)
+# define BFI_FLINEARS_1733(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1732, v ds
+# define BFI_FLINEARS_1733_TICK(t)
+# define BFI_FLINEARS_1732(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1731, v ds
+# define BFI_FLINEARS_1732_TICK(t)
+# define BFI_FLINEARS_1731(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1730, v ds
+# define BFI_FLINEARS_1731_TICK(t)
+# define BFI_FLINEARS_1730(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1729, v ds
+# define BFI_FLINEARS_1730_TICK(t)
+# define BFI_FLINEARS_1729(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1728, v ds
+# define BFI_FLINEARS_1729_TICK(t)
+# define BFI_FLINEARS_1728(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1727, v ds
+# define BFI_FLINEARS_1728_TICK(t)
+# define BFI_FLINEARS_1727(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1726, v ds
+# define BFI_FLINEARS_1727_TICK(t)
+# define BFI_FLINEARS_1726(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1725, v ds
+# define BFI_FLINEARS_1726_TICK(t)
+# define BFI_FLINEARS_1725(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1724, v ds
+# define BFI_FLINEARS_1725_TICK(t)
+# define BFI_FLINEARS_1724(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1723, v ds
+# define BFI_FLINEARS_1724_TICK(t)
+# define BFI_FLINEARS_1723(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1722, v ds
+# define BFI_FLINEARS_1723_TICK(t)
+# define BFI_FLINEARS_1722(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1721, v ds
+# define BFI_FLINEARS_1722_TICK(t)
+# define BFI_FLINEARS_1721(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1720, v ds
+# define BFI_FLINEARS_1721_TICK(t)
+# define BFI_FLINEARS_1720(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1719, v ds
+# define BFI_FLINEARS_1720_TICK(t)
+# define BFI_FLINEARS_1719(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1718, v ds
+# define BFI_FLINEARS_1719_TICK(t)
+# define BFI_FLINEARS_1718(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1717, v ds
+# define BFI_FLINEARS_1718_TICK(t)
+# define BFI_FLINEARS_1717(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1716, v ds
+# define BFI_FLINEARS_1717_TICK(t)
+# define BFI_FLINEARS_1716(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1715, v ds
+# define BFI_FLINEARS_1716_TICK(t)
+# define BFI_FLINEARS_1715(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1714, v ds
+# define BFI_FLINEARS_1715_TICK(t)
+# define BFI_FLINEARS_1714(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1713, v ds
+# define BFI_FLINEARS_1714_TICK(t)
+# define BFI_FLINEARS_1713(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1712, v ds
+# define BFI_FLINEARS_1713_TICK(t)
+# define BFI_FLINEARS_1712(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1711, v ds
+# define BFI_FLINEARS_1712_TICK(t)
+# define BFI_FLINEARS_1711(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1710, v ds
+# define BFI_FLINEARS_1711_TICK(t)
+# define BFI_FLINEARS_1710(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1709, v ds
+# define BFI_FLINEARS_1710_TICK(t)
+# define BFI_FLINEARS_1709(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1708, v ds
+# define BFI_FLINEARS_1709_TICK(t)
+# define BFI_FLINEARS_1708(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1707, v ds
+# define BFI_FLINEARS_1708_TICK(t)
+# define BFI_FLINEARS_1707(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1706, v ds
+# define BFI_FLINEARS_1707_TICK(t)
+# define BFI_FLINEARS_1706(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1705, v ds
+# define BFI_FLINEARS_1706_TICK(t)
+# define BFI_FLINEARS_1705(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1704, v ds
+# define BFI_FLINEARS_1705_TICK(t)
+# define BFI_FLINEARS_1704(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1703, v ds
+# define BFI_FLINEARS_1704_TICK(t)
+# define BFI_FLINEARS_1703(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1702, v ds
+# define BFI_FLINEARS_1703_TICK(t)
+# define BFI_FLINEARS_1702(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1701, v ds
+# define BFI_FLINEARS_1702_TICK(t)
+# define BFI_FLINEARS_1701(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1700, v ds
+# define BFI_FLINEARS_1701_TICK(t)
+# define BFI_FLINEARS_1700(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1699, v ds
+# define BFI_FLINEARS_1700_TICK(t)
+# define BFI_FLINEARS_1699(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1698, v ds
+# define BFI_FLINEARS_1699_TICK(t)
+# define BFI_FLINEARS_1698(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1697, v ds
+# define BFI_FLINEARS_1698_TICK(t)
+# define BFI_FLINEARS_1697(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1696, v ds
+# define BFI_FLINEARS_1697_TICK(t)
+# define BFI_FLINEARS_1696(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1695, v ds
+# define BFI_FLINEARS_1696_TICK(t)
+# define BFI_FLINEARS_1695(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1694, v ds
+# define BFI_FLINEARS_1695_TICK(t)
+# define BFI_FLINEARS_1694(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1693, v ds
+# define BFI_FLINEARS_1694_TICK(t)
+# define BFI_FLINEARS_1693(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1692, v ds
+# define BFI_FLINEARS_1693_TICK(t)
+# define BFI_FLINEARS_1692(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1691, v ds
+# define BFI_FLINEARS_1692_TICK(t)
+# define BFI_FLINEARS_1691(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1690, v ds
+# define BFI_FLINEARS_1691_TICK(t)
+# define BFI_FLINEARS_1690(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1689, v ds
+# define BFI_FLINEARS_1690_TICK(t)
+# define BFI_FLINEARS_1689(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1688, v ds
+# define BFI_FLINEARS_1689_TICK(t)
+# define BFI_FLINEARS_1688(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1687, v ds
+# define BFI_FLINEARS_1688_TICK(t)
+# define BFI_FLINEARS_1687(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1686, v ds
+# define BFI_FLINEARS_1687_TICK(t)
+# define BFI_FLINEARS_1686(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1685, v ds
+# define BFI_FLINEARS_1686_TICK(t)
+# define BFI_FLINEARS_1685(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1684, v ds
+# define BFI_FLINEARS_1685_TICK(t)
+# define BFI_FLINEARS_1684(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1683, v ds
+# define BFI_FLINEARS_1684_TICK(t)
+# define BFI_FLINEARS_1683(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1682, v ds
+# define BFI_FLINEARS_1683_TICK(t)
+# define BFI_FLINEARS_1682(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1681, v ds
+# define BFI_FLINEARS_1682_TICK(t)
+# define BFI_FLINEARS_1681(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1680, v ds
+# define BFI_FLINEARS_1681_TICK(t)
+# define BFI_FLINEARS_1680(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1679, v ds
+# define BFI_FLINEARS_1680_TICK(t)
+# define BFI_FLINEARS_1679(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1678, v ds
+# define BFI_FLINEARS_1679_TICK(t)
+# define BFI_FLINEARS_1678(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1677, v ds
+# define BFI_FLINEARS_1678_TICK(t)
+# define BFI_FLINEARS_1677(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1676, v ds
+# define BFI_FLINEARS_1677_TICK(t)
+# define BFI_FLINEARS_1676(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1675, v ds
+# define BFI_FLINEARS_1676_TICK(t)
+# define BFI_FLINEARS_1675(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1674, v ds
+# define BFI_FLINEARS_1675_TICK(t)
+# define BFI_FLINEARS_1674(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1673, v ds
+# define BFI_FLINEARS_1674_TICK(t)
+# define BFI_FLINEARS_1673(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1672, v ds
+# define BFI_FLINEARS_1673_TICK(t)
+# define BFI_FLINEARS_1672(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1671, v ds
+# define BFI_FLINEARS_1672_TICK(t)
+# define BFI_FLINEARS_1671(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1670, v ds
+# define BFI_FLINEARS_1671_TICK(t)
+# define BFI_FLINEARS_1670(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1669, v ds
+# define BFI_FLINEARS_1670_TICK(t)
+# define BFI_FLINEARS_1669(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1668, v ds
+# define BFI_FLINEARS_1669_TICK(t)
+# define BFI_FLINEARS_1668(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1667, v ds
+# define BFI_FLINEARS_1668_TICK(t)
+# define BFI_FLINEARS_1667(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1666, v ds
+# define BFI_FLINEARS_1667_TICK(t)
+# define BFI_FLINEARS_1666(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1665, v ds
+# define BFI_FLINEARS_1666_TICK(t)
+# define BFI_FLINEARS_1665(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1664, v ds
+# define BFI_FLINEARS_1665_TICK(t)
+# define BFI_FLINEARS_1664(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1663, v ds
+# define BFI_FLINEARS_1664_TICK(t)
+# define BFI_FLINEARS_1663(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1662, v ds
+# define BFI_FLINEARS_1663_TICK(t)
+# define BFI_FLINEARS_1662(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1661, v ds
+# define BFI_FLINEARS_1662_TICK(t)
+# define BFI_FLINEARS_1661(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1660, v ds
+# define BFI_FLINEARS_1661_TICK(t)
+# define BFI_FLINEARS_1660(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1659, v ds
+# define BFI_FLINEARS_1660_TICK(t)
+# define BFI_FLINEARS_1659(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1658, v ds
+# define BFI_FLINEARS_1659_TICK(t)
+# define BFI_FLINEARS_1658(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1657, v ds
+# define BFI_FLINEARS_1658_TICK(t)
+# define BFI_FLINEARS_1657(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1656, v ds
+# define BFI_FLINEARS_1657_TICK(t)
+# define BFI_FLINEARS_1656(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1655, v ds
+# define BFI_FLINEARS_1656_TICK(t)
+# define BFI_FLINEARS_1655(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1654, v ds
+# define BFI_FLINEARS_1655_TICK(t)
+# define BFI_FLINEARS_1654(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1653, v ds
+# define BFI_FLINEARS_1654_TICK(t)
+# define BFI_FLINEARS_1653(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1652, v ds
+# define BFI_FLINEARS_1653_TICK(t)
+# define BFI_FLINEARS_1652(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1651, v ds
+# define BFI_FLINEARS_1652_TICK(t)
+# define BFI_FLINEARS_1651(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1650, v ds
+# define BFI_FLINEARS_1651_TICK(t)
+# define BFI_FLINEARS_1650(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1649, v ds
+# define BFI_FLINEARS_1650_TICK(t)
+# define BFI_FLINEARS_1649(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1648, v ds
+# define BFI_FLINEARS_1649_TICK(t)
+# define BFI_FLINEARS_1648(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1647, v ds
+# define BFI_FLINEARS_1648_TICK(t)
+# define BFI_FLINEARS_1647(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1646, v ds
+# define BFI_FLINEARS_1647_TICK(t)
+# define BFI_FLINEARS_1646(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1645, v ds
+# define BFI_FLINEARS_1646_TICK(t)
+# define BFI_FLINEARS_1645(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1644, v ds
+# define BFI_FLINEARS_1645_TICK(t)
+# define BFI_FLINEARS_1644(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1643, v ds
+# define BFI_FLINEARS_1644_TICK(t)
+# define BFI_FLINEARS_1643(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1642, v ds
+# define BFI_FLINEARS_1643_TICK(t)
+# define BFI_FLINEARS_1642(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1641, v ds
+# define BFI_FLINEARS_1642_TICK(t)
+# define BFI_FLINEARS_1641(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1640, v ds
+# define BFI_FLINEARS_1641_TICK(t)
+# define BFI_FLINEARS_1640(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1639, v ds
+# define BFI_FLINEARS_1640_TICK(t)
+# define BFI_FLINEARS_1639(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1638, v ds
+# define BFI_FLINEARS_1639_TICK(t)
+# define BFI_FLINEARS_1638(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1637, v ds
+# define BFI_FLINEARS_1638_TICK(t)
+# define BFI_FLINEARS_1637(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1636, v ds
+# define BFI_FLINEARS_1637_TICK(t)
+# define BFI_FLINEARS_1636(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1635, v ds
+# define BFI_FLINEARS_1636_TICK(t)
+# define BFI_FLINEARS_1635(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1634, v ds
+# define BFI_FLINEARS_1635_TICK(t)
+# define BFI_FLINEARS_1634(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1633, v ds
+# define BFI_FLINEARS_1634_TICK(t)
+# define BFI_FLINEARS_1633(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1632, v ds
+# define BFI_FLINEARS_1633_TICK(t)
+# define BFI_FLINEARS_1632(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1631, v ds
+# define BFI_FLINEARS_1632_TICK(t)
+# define BFI_FLINEARS_1631(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1630, v ds
+# define BFI_FLINEARS_1631_TICK(t)
+# define BFI_FLINEARS_1630(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1629, v ds
+# define BFI_FLINEARS_1630_TICK(t)
+# define BFI_FLINEARS_1629(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1628, v ds
+# define BFI_FLINEARS_1629_TICK(t)
+# define BFI_FLINEARS_1628(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1627, v ds
+# define BFI_FLINEARS_1628_TICK(t)
+# define BFI_FLINEARS_1627(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1626, v ds
+# define BFI_FLINEARS_1627_TICK(t)
+# define BFI_FLINEARS_1626(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1625, v ds
+# define BFI_FLINEARS_1626_TICK(t)
+# define BFI_FLINEARS_1625(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1624, v ds
+# define BFI_FLINEARS_1625_TICK(t)
+# define BFI_FLINEARS_1624(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1623, v ds
+# define BFI_FLINEARS_1624_TICK(t)
+# define BFI_FLINEARS_1623(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1622, v ds
+# define BFI_FLINEARS_1623_TICK(t)
+# define BFI_FLINEARS_1622(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1621, v ds
+# define BFI_FLINEARS_1622_TICK(t)
+# define BFI_FLINEARS_1621(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1620, v ds
+# define BFI_FLINEARS_1621_TICK(t)
+# define BFI_FLINEARS_1620(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1619, v ds
+# define BFI_FLINEARS_1620_TICK(t)
+# define BFI_FLINEARS_1619(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1618, v ds
+# define BFI_FLINEARS_1619_TICK(t)
+# define BFI_FLINEARS_1618(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1617, v ds
+# define BFI_FLINEARS_1618_TICK(t)
+# define BFI_FLINEARS_1617(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1616, v ds
+# define BFI_FLINEARS_1617_TICK(t)
+# define BFI_FLINEARS_1616(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1615, v ds
+# define BFI_FLINEARS_1616_TICK(t)
+# define BFI_FLINEARS_1615(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1614, v ds
+# define BFI_FLINEARS_1615_TICK(t)
+# define BFI_FLINEARS_1614(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1613, v ds
+# define BFI_FLINEARS_1614_TICK(t)
+# define BFI_FLINEARS_1613(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1612, v ds
+# define BFI_FLINEARS_1613_TICK(t)
+# define BFI_FLINEARS_1612(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1611, v ds
+# define BFI_FLINEARS_1612_TICK(t)
+# define BFI_FLINEARS_1611(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1610, v ds
+# define BFI_FLINEARS_1611_TICK(t)
+# define BFI_FLINEARS_1610(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1609, v ds
+# define BFI_FLINEARS_1610_TICK(t)
+# define BFI_FLINEARS_1609(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1608, v ds
+# define BFI_FLINEARS_1609_TICK(t)
+# define BFI_FLINEARS_1608(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1607, v ds
+# define BFI_FLINEARS_1608_TICK(t)
+# define BFI_FLINEARS_1607(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1606, v ds
+# define BFI_FLINEARS_1607_TICK(t)
+# define BFI_FLINEARS_1606(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1605, v ds
+# define BFI_FLINEARS_1606_TICK(t)
+# define BFI_FLINEARS_1605(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1604, v ds
+# define BFI_FLINEARS_1605_TICK(t)
+# define BFI_FLINEARS_1604(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1603, v ds
+# define BFI_FLINEARS_1604_TICK(t)
+# define BFI_FLINEARS_1603(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1602, v ds
+# define BFI_FLINEARS_1603_TICK(t)
+# define BFI_FLINEARS_1602(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1601, v ds
+# define BFI_FLINEARS_1602_TICK(t)
+# define BFI_FLINEARS_1601(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1600, v ds
+# define BFI_FLINEARS_1601_TICK(t)
+# define BFI_FLINEARS_1600(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1599, v ds
+# define BFI_FLINEARS_1600_TICK(t)
+# define BFI_FLINEARS_1599(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1598, v ds
+# define BFI_FLINEARS_1599_TICK(t)
+# define BFI_FLINEARS_1598(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1597, v ds
+# define BFI_FLINEARS_1598_TICK(t)
+# define BFI_FLINEARS_1597(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1596, v ds
+# define BFI_FLINEARS_1597_TICK(t)
+# define BFI_FLINEARS_1596(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1595, v ds
+# define BFI_FLINEARS_1596_TICK(t)
+# define BFI_FLINEARS_1595(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1594, v ds
+# define BFI_FLINEARS_1595_TICK(t)
+# define BFI_FLINEARS_1594(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1593, v ds
+# define BFI_FLINEARS_1594_TICK(t)
+# define BFI_FLINEARS_1593(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1592, v ds
+# define BFI_FLINEARS_1593_TICK(t)
+# define BFI_FLINEARS_1592(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1591, v ds
+# define BFI_FLINEARS_1592_TICK(t)
+# define BFI_FLINEARS_1591(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1590, v ds
+# define BFI_FLINEARS_1591_TICK(t)
+# define BFI_FLINEARS_1590(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1589, v ds
+# define BFI_FLINEARS_1590_TICK(t)
+# define BFI_FLINEARS_1589(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1588, v ds
+# define BFI_FLINEARS_1589_TICK(t)
+# define BFI_FLINEARS_1588(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1587, v ds
+# define BFI_FLINEARS_1588_TICK(t)
+# define BFI_FLINEARS_1587(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1586, v ds
+# define BFI_FLINEARS_1587_TICK(t)
+# define BFI_FLINEARS_1586(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1585, v ds
+# define BFI_FLINEARS_1586_TICK(t)
+# define BFI_FLINEARS_1585(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1584, v ds
+# define BFI_FLINEARS_1585_TICK(t)
+# define BFI_FLINEARS_1584(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1583, v ds
+# define BFI_FLINEARS_1584_TICK(t)
+# define BFI_FLINEARS_1583(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1582, v ds
+# define BFI_FLINEARS_1583_TICK(t)
+# define BFI_FLINEARS_1582(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1581, v ds
+# define BFI_FLINEARS_1582_TICK(t)
+# define BFI_FLINEARS_1581(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1580, v ds
+# define BFI_FLINEARS_1581_TICK(t)
+# define BFI_FLINEARS_1580(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1579, v ds
+# define BFI_FLINEARS_1580_TICK(t)
+# define BFI_FLINEARS_1579(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1578, v ds
+# define BFI_FLINEARS_1579_TICK(t)
+# define BFI_FLINEARS_1578(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1577, v ds
+# define BFI_FLINEARS_1578_TICK(t)
+# define BFI_FLINEARS_1577(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1576, v ds
+# define BFI_FLINEARS_1577_TICK(t)
+# define BFI_FLINEARS_1576(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1575, v ds
+# define BFI_FLINEARS_1576_TICK(t)
+# define BFI_FLINEARS_1575(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1574, v ds
+# define BFI_FLINEARS_1575_TICK(t)
+# define BFI_FLINEARS_1574(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1573, v ds
+# define BFI_FLINEARS_1574_TICK(t)
+# define BFI_FLINEARS_1573(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1572, v ds
+# define BFI_FLINEARS_1573_TICK(t)
+# define BFI_FLINEARS_1572(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1571, v ds
+# define BFI_FLINEARS_1572_TICK(t)
+# define BFI_FLINEARS_1571(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1570, v ds
+# define BFI_FLINEARS_1571_TICK(t)
+# define BFI_FLINEARS_1570(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1569, v ds
+# define BFI_FLINEARS_1570_TICK(t)
+# define BFI_FLINEARS_1569(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1568, v ds
+# define BFI_FLINEARS_1569_TICK(t)
+# define BFI_FLINEARS_1568(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1567, v ds
+# define BFI_FLINEARS_1568_TICK(t)
+# define BFI_FLINEARS_1567(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1566, v ds
+# define BFI_FLINEARS_1567_TICK(t)
+# define BFI_FLINEARS_1566(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1565, v ds
+# define BFI_FLINEARS_1566_TICK(t)
+# define BFI_FLINEARS_1565(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1564, v ds
+# define BFI_FLINEARS_1565_TICK(t)
+# define BFI_FLINEARS_1564(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1563, v ds
+# define BFI_FLINEARS_1564_TICK(t)
+# define BFI_FLINEARS_1563(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1562, v ds
+# define BFI_FLINEARS_1563_TICK(t)
+# define BFI_FLINEARS_1562(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1561, v ds
+# define BFI_FLINEARS_1562_TICK(t)
+# define BFI_FLINEARS_1561(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1560, v ds
+# define BFI_FLINEARS_1561_TICK(t)
+# define BFI_FLINEARS_1560(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1559, v ds
+# define BFI_FLINEARS_1560_TICK(t)
+# define BFI_FLINEARS_1559(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1558, v ds
+# define BFI_FLINEARS_1559_TICK(t)
+# define BFI_FLINEARS_1558(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1557, v ds
+# define BFI_FLINEARS_1558_TICK(t)
+# define BFI_FLINEARS_1557(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1556, v ds
+# define BFI_FLINEARS_1557_TICK(t)
+# define BFI_FLINEARS_1556(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1555, v ds
+# define BFI_FLINEARS_1556_TICK(t)
+# define BFI_FLINEARS_1555(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1554, v ds
+# define BFI_FLINEARS_1555_TICK(t)
+# define BFI_FLINEARS_1554(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1553, v ds
+# define BFI_FLINEARS_1554_TICK(t)
+# define BFI_FLINEARS_1553(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1552, v ds
+# define BFI_FLINEARS_1553_TICK(t)
+# define BFI_FLINEARS_1552(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1551, v ds
+# define BFI_FLINEARS_1552_TICK(t)
+# define BFI_FLINEARS_1551(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1550, v ds
+# define BFI_FLINEARS_1551_TICK(t)
+# define BFI_FLINEARS_1550(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1549, v ds
+# define BFI_FLINEARS_1550_TICK(t)
+# define BFI_FLINEARS_1549(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1548, v ds
+# define BFI_FLINEARS_1549_TICK(t)
+# define BFI_FLINEARS_1548(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1547, v ds
+# define BFI_FLINEARS_1548_TICK(t)
+# define BFI_FLINEARS_1547(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1546, v ds
+# define BFI_FLINEARS_1547_TICK(t)
+# define BFI_FLINEARS_1546(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1545, v ds
+# define BFI_FLINEARS_1546_TICK(t)
+# define BFI_FLINEARS_1545(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1544, v ds
+# define BFI_FLINEARS_1545_TICK(t)
+# define BFI_FLINEARS_1544(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1543, v ds
+# define BFI_FLINEARS_1544_TICK(t)
+# define BFI_FLINEARS_1543(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1542, v ds
+# define BFI_FLINEARS_1543_TICK(t)
+# define BFI_FLINEARS_1542(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1541, v ds
+# define BFI_FLINEARS_1542_TICK(t)
+# define BFI_FLINEARS_1541(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1540, v ds
+# define BFI_FLINEARS_1541_TICK(t)
+# define BFI_FLINEARS_1540(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1539, v ds
+# define BFI_FLINEARS_1540_TICK(t)
+# define BFI_FLINEARS_1539(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1538, v ds
+# define BFI_FLINEARS_1539_TICK(t)
+# define BFI_FLINEARS_1538(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1537, v ds
+# define BFI_FLINEARS_1538_TICK(t)
+# define BFI_FLINEARS_1537(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1536, v ds
+# define BFI_FLINEARS_1537_TICK(t)
+# define BFI_FLINEARS_1536(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1535, v ds
+# define BFI_FLINEARS_1536_TICK(t)
+# define BFI_FLINEARS_1535(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1534, v ds
+# define BFI_FLINEARS_1535_TICK(t)
+# define BFI_FLINEARS_1534(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1533, v ds
+# define BFI_FLINEARS_1534_TICK(t)
+# define BFI_FLINEARS_1533(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1532, v ds
+# define BFI_FLINEARS_1533_TICK(t)
+# define BFI_FLINEARS_1532(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1531, v ds
+# define BFI_FLINEARS_1532_TICK(t)
+# define BFI_FLINEARS_1531(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1530, v ds
+# define BFI_FLINEARS_1531_TICK(t)
+# define BFI_FLINEARS_1530(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1529, v ds
+# define BFI_FLINEARS_1530_TICK(t)
+# define BFI_FLINEARS_1529(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1528, v ds
+# define BFI_FLINEARS_1529_TICK(t)
+# define BFI_FLINEARS_1528(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1527, v ds
+# define BFI_FLINEARS_1528_TICK(t)
+# define BFI_FLINEARS_1527(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1526, v ds
+# define BFI_FLINEARS_1527_TICK(t)
+# define BFI_FLINEARS_1526(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1525, v ds
+# define BFI_FLINEARS_1526_TICK(t)
+# define BFI_FLINEARS_1525(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1524, v ds
+# define BFI_FLINEARS_1525_TICK(t)
+# define BFI_FLINEARS_1524(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1523, v ds
+# define BFI_FLINEARS_1524_TICK(t)
+# define BFI_FLINEARS_1523(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1522, v ds
+# define BFI_FLINEARS_1523_TICK(t)
+# define BFI_FLINEARS_1522(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1521, v ds
+# define BFI_FLINEARS_1522_TICK(t)
+# define BFI_FLINEARS_1521(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1520, v ds
+# define BFI_FLINEARS_1521_TICK(t)
+# define BFI_FLINEARS_1520(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1519, v ds
+# define BFI_FLINEARS_1520_TICK(t)
+# define BFI_FLINEARS_1519(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1518, v ds
+# define BFI_FLINEARS_1519_TICK(t)
+# define BFI_FLINEARS_1518(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1517, v ds
+# define BFI_FLINEARS_1518_TICK(t)
+# define BFI_FLINEARS_1517(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1516, v ds
+# define BFI_FLINEARS_1517_TICK(t)
+# define BFI_FLINEARS_1516(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1515, v ds
+# define BFI_FLINEARS_1516_TICK(t)
+# define BFI_FLINEARS_1515(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1514, v ds
+# define BFI_FLINEARS_1515_TICK(t)
+# define BFI_FLINEARS_1514(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1513, v ds
+# define BFI_FLINEARS_1514_TICK(t)
+# define BFI_FLINEARS_1513(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1512, v ds
+# define BFI_FLINEARS_1513_TICK(t)
+# define BFI_FLINEARS_1512(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1511, v ds
+# define BFI_FLINEARS_1512_TICK(t)
+# define BFI_FLINEARS_1511(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1510, v ds
+# define BFI_FLINEARS_1511_TICK(t)
+# define BFI_FLINEARS_1510(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1509, v ds
+# define BFI_FLINEARS_1510_TICK(t)
+# define BFI_FLINEARS_1509(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1508, v ds
+# define BFI_FLINEARS_1509_TICK(t)
+# define BFI_FLINEARS_1508(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1507, v ds
+# define BFI_FLINEARS_1508_TICK(t)
+# define BFI_FLINEARS_1507(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1506, v ds
+# define BFI_FLINEARS_1507_TICK(t)
+# define BFI_FLINEARS_1506(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1505, v ds
+# define BFI_FLINEARS_1506_TICK(t)
+# define BFI_FLINEARS_1505(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1504, v ds
+# define BFI_FLINEARS_1505_TICK(t)
+# define BFI_FLINEARS_1504(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1503, v ds
+# define BFI_FLINEARS_1504_TICK(t)
+# define BFI_FLINEARS_1503(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1502, v ds
+# define BFI_FLINEARS_1503_TICK(t)
+# define BFI_FLINEARS_1502(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1501, v ds
+# define BFI_FLINEARS_1502_TICK(t)
+# define BFI_FLINEARS_1501(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1500, v ds
+# define BFI_FLINEARS_1501_TICK(t)
+# define BFI_FLINEARS_1500(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1499, v ds
+# define BFI_FLINEARS_1500_TICK(t)
+# define BFI_FLINEARS_1499(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1498, v ds
+# define BFI_FLINEARS_1499_TICK(t)
+# define BFI_FLINEARS_1498(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1497, v ds
+# define BFI_FLINEARS_1498_TICK(t)
+# define BFI_FLINEARS_1497(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1496, v ds
+# define BFI_FLINEARS_1497_TICK(t)
+# define BFI_FLINEARS_1496(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1495, v ds
+# define BFI_FLINEARS_1496_TICK(t)
+# define BFI_FLINEARS_1495(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1494, v ds
+# define BFI_FLINEARS_1495_TICK(t)
+# define BFI_FLINEARS_1494(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1493, v ds
+# define BFI_FLINEARS_1494_TICK(t)
+# define BFI_FLINEARS_1493(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1492, v ds
+# define BFI_FLINEARS_1493_TICK(t)
+# define BFI_FLINEARS_1492(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1491, v ds
+# define BFI_FLINEARS_1492_TICK(t)
+# define BFI_FLINEARS_1491(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1490, v ds
+# define BFI_FLINEARS_1491_TICK(t)
+# define BFI_FLINEARS_1490(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1489, v ds
+# define BFI_FLINEARS_1490_TICK(t)
+# define BFI_FLINEARS_1489(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1488, v ds
+# define BFI_FLINEARS_1489_TICK(t)
+# define BFI_FLINEARS_1488(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1487, v ds
+# define BFI_FLINEARS_1488_TICK(t)
+# define BFI_FLINEARS_1487(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1486, v ds
+# define BFI_FLINEARS_1487_TICK(t)
+# define BFI_FLINEARS_1486(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1485, v ds
+# define BFI_FLINEARS_1486_TICK(t)
+# define BFI_FLINEARS_1485(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1484, v ds
+# define BFI_FLINEARS_1485_TICK(t)
+# define BFI_FLINEARS_1484(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1483, v ds
+# define BFI_FLINEARS_1484_TICK(t)
+# define BFI_FLINEARS_1483(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1482, v ds
+# define BFI_FLINEARS_1483_TICK(t)
+# define BFI_FLINEARS_1482(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1481, v ds
+# define BFI_FLINEARS_1482_TICK(t)
+# define BFI_FLINEARS_1481(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1480, v ds
+# define BFI_FLINEARS_1481_TICK(t)
+# define BFI_FLINEARS_1480(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1479, v ds
+# define BFI_FLINEARS_1480_TICK(t)
+# define BFI_FLINEARS_1479(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1478, v ds
+# define BFI_FLINEARS_1479_TICK(t)
+# define BFI_FLINEARS_1478(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1477, v ds
+# define BFI_FLINEARS_1478_TICK(t)
+# define BFI_FLINEARS_1477(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1476, v ds
+# define BFI_FLINEARS_1477_TICK(t)
+# define BFI_FLINEARS_1476(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1475, v ds
+# define BFI_FLINEARS_1476_TICK(t)
+# define BFI_FLINEARS_1475(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1474, v ds
+# define BFI_FLINEARS_1475_TICK(t)
+# define BFI_FLINEARS_1474(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1473, v ds
+# define BFI_FLINEARS_1474_TICK(t)
+# define BFI_FLINEARS_1473(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1472, v ds
+# define BFI_FLINEARS_1473_TICK(t)
+# define BFI_FLINEARS_1472(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1471, v ds
+# define BFI_FLINEARS_1472_TICK(t)
+# define BFI_FLINEARS_1471(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1470, v ds
+# define BFI_FLINEARS_1471_TICK(t)
+# define BFI_FLINEARS_1470(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1469, v ds
+# define BFI_FLINEARS_1470_TICK(t)
+# define BFI_FLINEARS_1469(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1468, v ds
+# define BFI_FLINEARS_1469_TICK(t)
+# define BFI_FLINEARS_1468(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1467, v ds
+# define BFI_FLINEARS_1468_TICK(t)
+# define BFI_FLINEARS_1467(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1466, v ds
+# define BFI_FLINEARS_1467_TICK(t)
+# define BFI_FLINEARS_1466(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1465, v ds
+# define BFI_FLINEARS_1466_TICK(t)
+# define BFI_FLINEARS_1465(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1464, v ds
+# define BFI_FLINEARS_1465_TICK(t)
+# define BFI_FLINEARS_1464(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1463, v ds
+# define BFI_FLINEARS_1464_TICK(t)
+# define BFI_FLINEARS_1463(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1462, v ds
+# define BFI_FLINEARS_1463_TICK(t)
+# define BFI_FLINEARS_1462(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1461, v ds
+# define BFI_FLINEARS_1462_TICK(t)
+# define BFI_FLINEARS_1461(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1460, v ds
+# define BFI_FLINEARS_1461_TICK(t)
+# define BFI_FLINEARS_1460(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1459, v ds
+# define BFI_FLINEARS_1460_TICK(t)
+# define BFI_FLINEARS_1459(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1458, v ds
+# define BFI_FLINEARS_1459_TICK(t)
+# define BFI_FLINEARS_1458(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1457, v ds
+# define BFI_FLINEARS_1458_TICK(t)
+# define BFI_FLINEARS_1457(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1456, v ds
+# define BFI_FLINEARS_1457_TICK(t)
+# define BFI_FLINEARS_1456(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1455, v ds
+# define BFI_FLINEARS_1456_TICK(t)
+# define BFI_FLINEARS_1455(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1454, v ds
+# define BFI_FLINEARS_1455_TICK(t)
+# define BFI_FLINEARS_1454(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1453, v ds
+# define BFI_FLINEARS_1454_TICK(t)
+# define BFI_FLINEARS_1453(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1452, v ds
+# define BFI_FLINEARS_1453_TICK(t)
+# define BFI_FLINEARS_1452(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1451, v ds
+# define BFI_FLINEARS_1452_TICK(t)
+# define BFI_FLINEARS_1451(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1450, v ds
+# define BFI_FLINEARS_1451_TICK(t)
+# define BFI_FLINEARS_1450(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1449, v ds
+# define BFI_FLINEARS_1450_TICK(t)
+# define BFI_FLINEARS_1449(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1448, v ds
+# define BFI_FLINEARS_1449_TICK(t)
+# define BFI_FLINEARS_1448(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1447, v ds
+# define BFI_FLINEARS_1448_TICK(t)
+# define BFI_FLINEARS_1447(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1446, v ds
+# define BFI_FLINEARS_1447_TICK(t)
+# define BFI_FLINEARS_1446(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1445, v ds
+# define BFI_FLINEARS_1446_TICK(t)
+# define BFI_FLINEARS_1445(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1444, v ds
+# define BFI_FLINEARS_1445_TICK(t)
+# define BFI_FLINEARS_1444(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1443, v ds
+# define BFI_FLINEARS_1444_TICK(t)
+# define BFI_FLINEARS_1443(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1442, v ds
+# define BFI_FLINEARS_1443_TICK(t)
+# define BFI_FLINEARS_1442(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1441, v ds
+# define BFI_FLINEARS_1442_TICK(t)
+# define BFI_FLINEARS_1441(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1440, v ds
+# define BFI_FLINEARS_1441_TICK(t)
+# define BFI_FLINEARS_1440(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1439, v ds
+# define BFI_FLINEARS_1440_TICK(t)
+# define BFI_FLINEARS_1439(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1438, v ds
+# define BFI_FLINEARS_1439_TICK(t)
+# define BFI_FLINEARS_1438(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1437, v ds
+# define BFI_FLINEARS_1438_TICK(t)
+# define BFI_FLINEARS_1437(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1436, v ds
+# define BFI_FLINEARS_1437_TICK(t)
+# define BFI_FLINEARS_1436(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1435, v ds
+# define BFI_FLINEARS_1436_TICK(t)
+# define BFI_FLINEARS_1435(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1434, v ds
+# define BFI_FLINEARS_1435_TICK(t)
+# define BFI_FLINEARS_1434(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1433, v ds
+# define BFI_FLINEARS_1434_TICK(t)
+# define BFI_FLINEARS_1433(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1432, v ds
+# define BFI_FLINEARS_1433_TICK(t)
+# define BFI_FLINEARS_1432(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1431, v ds
+# define BFI_FLINEARS_1432_TICK(t)
+# define BFI_FLINEARS_1431(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1430, v ds
+# define BFI_FLINEARS_1431_TICK(t)
+# define BFI_FLINEARS_1430(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1429, v ds
+# define BFI_FLINEARS_1430_TICK(t)
+# define BFI_FLINEARS_1429(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1428, v ds
+# define BFI_FLINEARS_1429_TICK(t)
+# define BFI_FLINEARS_1428(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1427, v ds
+# define BFI_FLINEARS_1428_TICK(t)
+# define BFI_FLINEARS_1427(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1426, v ds
+# define BFI_FLINEARS_1427_TICK(t)
+# define BFI_FLINEARS_1426(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1425, v ds
+# define BFI_FLINEARS_1426_TICK(t)
+# define BFI_FLINEARS_1425(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1424, v ds
+# define BFI_FLINEARS_1425_TICK(t)
+# define BFI_FLINEARS_1424(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1423, v ds
+# define BFI_FLINEARS_1424_TICK(t)
+# define BFI_FLINEARS_1423(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1422, v ds
+# define BFI_FLINEARS_1423_TICK(t)
+# define BFI_FLINEARS_1422(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1421, v ds
+# define BFI_FLINEARS_1422_TICK(t)
+# define BFI_FLINEARS_1421(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1420, v ds
+# define BFI_FLINEARS_1421_TICK(t)
+# define BFI_FLINEARS_1420(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1419, v ds
+# define BFI_FLINEARS_1420_TICK(t)
+# define BFI_FLINEARS_1419(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1418, v ds
+# define BFI_FLINEARS_1419_TICK(t)
+# define BFI_FLINEARS_1418(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1417, v ds
+# define BFI_FLINEARS_1418_TICK(t)
+# define BFI_FLINEARS_1417(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1416, v ds
+# define BFI_FLINEARS_1417_TICK(t)
+# define BFI_FLINEARS_1416(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1415, v ds
+# define BFI_FLINEARS_1416_TICK(t)
+# define BFI_FLINEARS_1415(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1414, v ds
+# define BFI_FLINEARS_1415_TICK(t)
+# define BFI_FLINEARS_1414(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1413, v ds
+# define BFI_FLINEARS_1414_TICK(t)
+# define BFI_FLINEARS_1413(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1412, v ds
+# define BFI_FLINEARS_1413_TICK(t)
+# define BFI_FLINEARS_1412(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1411, v ds
+# define BFI_FLINEARS_1412_TICK(t)
+# define BFI_FLINEARS_1411(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1410, v ds
+# define BFI_FLINEARS_1411_TICK(t)
+# define BFI_FLINEARS_1410(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1409, v ds
+# define BFI_FLINEARS_1410_TICK(t)
+# define BFI_FLINEARS_1409(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1408, v ds
+# define BFI_FLINEARS_1409_TICK(t)
+# define BFI_FLINEARS_1408(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1407, v ds
+# define BFI_FLINEARS_1408_TICK(t)
+# define BFI_FLINEARS_1407(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1406, v ds
+# define BFI_FLINEARS_1407_TICK(t)
+# define BFI_FLINEARS_1406(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1405, v ds
+# define BFI_FLINEARS_1406_TICK(t)
+# define BFI_FLINEARS_1405(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1404, v ds
+# define BFI_FLINEARS_1405_TICK(t)
+# define BFI_FLINEARS_1404(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1403, v ds
+# define BFI_FLINEARS_1404_TICK(t)
+# define BFI_FLINEARS_1403(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1402, v ds
+# define BFI_FLINEARS_1403_TICK(t)
+# define BFI_FLINEARS_1402(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1401, v ds
+# define BFI_FLINEARS_1402_TICK(t)
+# define BFI_FLINEARS_1401(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1400, v ds
+# define BFI_FLINEARS_1401_TICK(t)
+# define BFI_FLINEARS_1400(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1399, v ds
+# define BFI_FLINEARS_1400_TICK(t)
+# define BFI_FLINEARS_1399(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1398, v ds
+# define BFI_FLINEARS_1399_TICK(t)
+# define BFI_FLINEARS_1398(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1397, v ds
+# define BFI_FLINEARS_1398_TICK(t)
+# define BFI_FLINEARS_1397(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1396, v ds
+# define BFI_FLINEARS_1397_TICK(t)
+# define BFI_FLINEARS_1396(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1395, v ds
+# define BFI_FLINEARS_1396_TICK(t)
+# define BFI_FLINEARS_1395(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1394, v ds
+# define BFI_FLINEARS_1395_TICK(t)
+# define BFI_FLINEARS_1394(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1393, v ds
+# define BFI_FLINEARS_1394_TICK(t)
+# define BFI_FLINEARS_1393(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1392, v ds
+# define BFI_FLINEARS_1393_TICK(t)
+# define BFI_FLINEARS_1392(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1391, v ds
+# define BFI_FLINEARS_1392_TICK(t)
+# define BFI_FLINEARS_1391(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1390, v ds
+# define BFI_FLINEARS_1391_TICK(t)
+# define BFI_FLINEARS_1390(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1389, v ds
+# define BFI_FLINEARS_1390_TICK(t)
+# define BFI_FLINEARS_1389(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1388, v ds
+# define BFI_FLINEARS_1389_TICK(t)
+# define BFI_FLINEARS_1388(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1387, v ds
+# define BFI_FLINEARS_1388_TICK(t)
+# define BFI_FLINEARS_1387(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1386, v ds
+# define BFI_FLINEARS_1387_TICK(t)
+# define BFI_FLINEARS_1386(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1385, v ds
+# define BFI_FLINEARS_1386_TICK(t)
+# define BFI_FLINEARS_1385(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1384, v ds
+# define BFI_FLINEARS_1385_TICK(t)
+# define BFI_FLINEARS_1384(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1383, v ds
+# define BFI_FLINEARS_1384_TICK(t)
+# define BFI_FLINEARS_1383(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1382, v ds
+# define BFI_FLINEARS_1383_TICK(t)
+# define BFI_FLINEARS_1382(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1381, v ds
+# define BFI_FLINEARS_1382_TICK(t)
+# define BFI_FLINEARS_1381(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1380, v ds
+# define BFI_FLINEARS_1381_TICK(t)
+# define BFI_FLINEARS_1380(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1379, v ds
+# define BFI_FLINEARS_1380_TICK(t)
+# define BFI_FLINEARS_1379(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1378, v ds
+# define BFI_FLINEARS_1379_TICK(t)
+# define BFI_FLINEARS_1378(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1377, v ds
+# define BFI_FLINEARS_1378_TICK(t)
+# define BFI_FLINEARS_1377(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1376, v ds
+# define BFI_FLINEARS_1377_TICK(t)
+# define BFI_FLINEARS_1376(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1375, v ds
+# define BFI_FLINEARS_1376_TICK(t)
+# define BFI_FLINEARS_1375(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1374, v ds
+# define BFI_FLINEARS_1375_TICK(t)
+# define BFI_FLINEARS_1374(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1373, v ds
+# define BFI_FLINEARS_1374_TICK(t)
+# define BFI_FLINEARS_1373(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1372, v ds
+# define BFI_FLINEARS_1373_TICK(t)
+# define BFI_FLINEARS_1372(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1371, v ds
+# define BFI_FLINEARS_1372_TICK(t)
+# define BFI_FLINEARS_1371(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1370, v ds
+# define BFI_FLINEARS_1371_TICK(t)
+# define BFI_FLINEARS_1370(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1369, v ds
+# define BFI_FLINEARS_1370_TICK(t)
+# define BFI_FLINEARS_1369(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1368, v ds
+# define BFI_FLINEARS_1369_TICK(t)
+# define BFI_FLINEARS_1368(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1367, v ds
+# define BFI_FLINEARS_1368_TICK(t)
+# define BFI_FLINEARS_1367(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1366, v ds
+# define BFI_FLINEARS_1367_TICK(t)
+# define BFI_FLINEARS_1366(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1365, v ds
+# define BFI_FLINEARS_1366_TICK(t)
+# define BFI_FLINEARS_1365(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1364, v ds
+# define BFI_FLINEARS_1365_TICK(t)
+# define BFI_FLINEARS_1364(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1363, v ds
+# define BFI_FLINEARS_1364_TICK(t)
+# define BFI_FLINEARS_1363(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1362, v ds
+# define BFI_FLINEARS_1363_TICK(t)
+# define BFI_FLINEARS_1362(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1361, v ds
+# define BFI_FLINEARS_1362_TICK(t)
+# define BFI_FLINEARS_1361(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1360, v ds
+# define BFI_FLINEARS_1361_TICK(t)
+# define BFI_FLINEARS_1360(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1359, v ds
+# define BFI_FLINEARS_1360_TICK(t)
+# define BFI_FLINEARS_1359(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1358, v ds
+# define BFI_FLINEARS_1359_TICK(t)
+# define BFI_FLINEARS_1358(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1357, v ds
+# define BFI_FLINEARS_1358_TICK(t)
+# define BFI_FLINEARS_1357(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1356, v ds
+# define BFI_FLINEARS_1357_TICK(t)
+# define BFI_FLINEARS_1356(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1355, v ds
+# define BFI_FLINEARS_1356_TICK(t)
+# define BFI_FLINEARS_1355(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1354, v ds
+# define BFI_FLINEARS_1355_TICK(t)
+# define BFI_FLINEARS_1354(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1353, v ds
+# define BFI_FLINEARS_1354_TICK(t)
+# define BFI_FLINEARS_1353(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1352, v ds
+# define BFI_FLINEARS_1353_TICK(t)
+# define BFI_FLINEARS_1352(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1351, v ds
+# define BFI_FLINEARS_1352_TICK(t)
+# define BFI_FLINEARS_1351(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1350, v ds
+# define BFI_FLINEARS_1351_TICK(t)
+# define BFI_FLINEARS_1350(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1349, v ds
+# define BFI_FLINEARS_1350_TICK(t)
+# define BFI_FLINEARS_1349(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1348, v ds
+# define BFI_FLINEARS_1349_TICK(t)
+# define BFI_FLINEARS_1348(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1347, v ds
+# define BFI_FLINEARS_1348_TICK(t)
+# define BFI_FLINEARS_1347(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1346, v ds
+# define BFI_FLINEARS_1347_TICK(t)
+# define BFI_FLINEARS_1346(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1345, v ds
+# define BFI_FLINEARS_1346_TICK(t)
+# define BFI_FLINEARS_1345(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1344, v ds
+# define BFI_FLINEARS_1345_TICK(t)
+# define BFI_FLINEARS_1344(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1343, v ds
+# define BFI_FLINEARS_1344_TICK(t)
+# define BFI_FLINEARS_1343(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1342, v ds
+# define BFI_FLINEARS_1343_TICK(t)
+# define BFI_FLINEARS_1342(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1341, v ds
+# define BFI_FLINEARS_1342_TICK(t)
+# define BFI_FLINEARS_1341(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1340, v ds
+# define BFI_FLINEARS_1341_TICK(t)
+# define BFI_FLINEARS_1340(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1339, v ds
+# define BFI_FLINEARS_1340_TICK(t)
+# define BFI_FLINEARS_1339(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1338, v ds
+# define BFI_FLINEARS_1339_TICK(t)
+# define BFI_FLINEARS_1338(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1337, v ds
+# define BFI_FLINEARS_1338_TICK(t)
+# define BFI_FLINEARS_1337(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1336, v ds
+# define BFI_FLINEARS_1337_TICK(t)
+# define BFI_FLINEARS_1336(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1335, v ds
+# define BFI_FLINEARS_1336_TICK(t)
+# define BFI_FLINEARS_1335(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1334, v ds
+# define BFI_FLINEARS_1335_TICK(t)
+# define BFI_FLINEARS_1334(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1333, v ds
+# define BFI_FLINEARS_1334_TICK(t)
+# define BFI_FLINEARS_1333(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1332, v ds
+# define BFI_FLINEARS_1333_TICK(t)
+# define BFI_FLINEARS_1332(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1331, v ds
+# define BFI_FLINEARS_1332_TICK(t)
+# define BFI_FLINEARS_1331(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1330, v ds
+# define BFI_FLINEARS_1331_TICK(t)
+# define BFI_FLINEARS_1330(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1329, v ds
+# define BFI_FLINEARS_1330_TICK(t)
+# define BFI_FLINEARS_1329(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1328, v ds
+# define BFI_FLINEARS_1329_TICK(t)
+# define BFI_FLINEARS_1328(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1327, v ds
+# define BFI_FLINEARS_1328_TICK(t)
+# define BFI_FLINEARS_1327(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1326, v ds
+# define BFI_FLINEARS_1327_TICK(t)
+# define BFI_FLINEARS_1326(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1325, v ds
+# define BFI_FLINEARS_1326_TICK(t)
+# define BFI_FLINEARS_1325(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1324, v ds
+# define BFI_FLINEARS_1325_TICK(t)
+# define BFI_FLINEARS_1324(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1323, v ds
+# define BFI_FLINEARS_1324_TICK(t)
+# define BFI_FLINEARS_1323(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1322, v ds
+# define BFI_FLINEARS_1323_TICK(t)
+# define BFI_FLINEARS_1322(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1321, v ds
+# define BFI_FLINEARS_1322_TICK(t)
+# define BFI_FLINEARS_1321(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1320, v ds
+# define BFI_FLINEARS_1321_TICK(t)
+# define BFI_FLINEARS_1320(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1319, v ds
+# define BFI_FLINEARS_1320_TICK(t)
+# define BFI_FLINEARS_1319(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1318, v ds
+# define BFI_FLINEARS_1319_TICK(t)
+# define BFI_FLINEARS_1318(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1317, v ds
+# define BFI_FLINEARS_1318_TICK(t)
+# define BFI_FLINEARS_1317(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1316, v ds
+# define BFI_FLINEARS_1317_TICK(t)
+# define BFI_FLINEARS_1316(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1315, v ds
+# define BFI_FLINEARS_1316_TICK(t)
+# define BFI_FLINEARS_1315(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1314, v ds
+# define BFI_FLINEARS_1315_TICK(t)
+# define BFI_FLINEARS_1314(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1313, v ds
+# define BFI_FLINEARS_1314_TICK(t)
+# define BFI_FLINEARS_1313(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1312, v ds
+# define BFI_FLINEARS_1313_TICK(t)
+# define BFI_FLINEARS_1312(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1311, v ds
+# define BFI_FLINEARS_1312_TICK(t)
+# define BFI_FLINEARS_1311(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1310, v ds
+# define BFI_FLINEARS_1311_TICK(t)
+# define BFI_FLINEARS_1310(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1309, v ds
+# define BFI_FLINEARS_1310_TICK(t)
+# define BFI_FLINEARS_1309(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1308, v ds
+# define BFI_FLINEARS_1309_TICK(t)
+# define BFI_FLINEARS_1308(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1307, v ds
+# define BFI_FLINEARS_1308_TICK(t)
+# define BFI_FLINEARS_1307(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1306, v ds
+# define BFI_FLINEARS_1307_TICK(t)
+# define BFI_FLINEARS_1306(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1305, v ds
+# define BFI_FLINEARS_1306_TICK(t)
+# define BFI_FLINEARS_1305(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1304, v ds
+# define BFI_FLINEARS_1305_TICK(t)
+# define BFI_FLINEARS_1304(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1303, v ds
+# define BFI_FLINEARS_1304_TICK(t)
+# define BFI_FLINEARS_1303(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1302, v ds
+# define BFI_FLINEARS_1303_TICK(t)
+# define BFI_FLINEARS_1302(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1301, v ds
+# define BFI_FLINEARS_1302_TICK(t)
+# define BFI_FLINEARS_1301(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1300, v ds
+# define BFI_FLINEARS_1301_TICK(t)
+# define BFI_FLINEARS_1300(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1299, v ds
+# define BFI_FLINEARS_1300_TICK(t)
+# define BFI_FLINEARS_1299(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1298, v ds
+# define BFI_FLINEARS_1299_TICK(t)
+# define BFI_FLINEARS_1298(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1297, v ds
+# define BFI_FLINEARS_1298_TICK(t)
+# define BFI_FLINEARS_1297(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1296, v ds
+# define BFI_FLINEARS_1297_TICK(t)
+# define BFI_FLINEARS_1296(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1295, v ds
+# define BFI_FLINEARS_1296_TICK(t)
+# define BFI_FLINEARS_1295(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1294, v ds
+# define BFI_FLINEARS_1295_TICK(t)
+# define BFI_FLINEARS_1294(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1293, v ds
+# define BFI_FLINEARS_1294_TICK(t)
+# define BFI_FLINEARS_1293(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1292, v ds
+# define BFI_FLINEARS_1293_TICK(t)
+# define BFI_FLINEARS_1292(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1291, v ds
+# define BFI_FLINEARS_1292_TICK(t)
+# define BFI_FLINEARS_1291(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1290, v ds
+# define BFI_FLINEARS_1291_TICK(t)
+# define BFI_FLINEARS_1290(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1289, v ds
+# define BFI_FLINEARS_1290_TICK(t)
+# define BFI_FLINEARS_1289(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1288, v ds
+# define BFI_FLINEARS_1289_TICK(t)
+# define BFI_FLINEARS_1288(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1287, v ds
+# define BFI_FLINEARS_1288_TICK(t)
+# define BFI_FLINEARS_1287(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1286, v ds
+# define BFI_FLINEARS_1287_TICK(t)
+# define BFI_FLINEARS_1286(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1285, v ds
+# define BFI_FLINEARS_1286_TICK(t)
+# define BFI_FLINEARS_1285(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1284, v ds
+# define BFI_FLINEARS_1285_TICK(t)
+# define BFI_FLINEARS_1284(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1283, v ds
+# define BFI_FLINEARS_1284_TICK(t)
+# define BFI_FLINEARS_1283(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1282, v ds
+# define BFI_FLINEARS_1283_TICK(t)
+# define BFI_FLINEARS_1282(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1281, v ds
+# define BFI_FLINEARS_1282_TICK(t)
+# define BFI_FLINEARS_1281(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1280, v ds
+# define BFI_FLINEARS_1281_TICK(t)
+# define BFI_FLINEARS_1280(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1279, v ds
+# define BFI_FLINEARS_1280_TICK(t)
+# define BFI_FLINEARS_1279(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1278, v ds
+# define BFI_FLINEARS_1279_TICK(t)
+# define BFI_FLINEARS_1278(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1277, v ds
+# define BFI_FLINEARS_1278_TICK(t)
+# define BFI_FLINEARS_1277(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1276, v ds
+# define BFI_FLINEARS_1277_TICK(t)
+# define BFI_FLINEARS_1276(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1275, v ds
+# define BFI_FLINEARS_1276_TICK(t)
+# define BFI_FLINEARS_1275(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1274, v ds
+# define BFI_FLINEARS_1275_TICK(t)
+# define BFI_FLINEARS_1274(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1273, v ds
+# define BFI_FLINEARS_1274_TICK(t)
+# define BFI_FLINEARS_1273(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1272, v ds
+# define BFI_FLINEARS_1273_TICK(t)
+# define BFI_FLINEARS_1272(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1271, v ds
+# define BFI_FLINEARS_1272_TICK(t)
+# define BFI_FLINEARS_1271(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1270, v ds
+# define BFI_FLINEARS_1271_TICK(t)
+# define BFI_FLINEARS_1270(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1269, v ds
+# define BFI_FLINEARS_1270_TICK(t)
+# define BFI_FLINEARS_1269(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1268, v ds
+# define BFI_FLINEARS_1269_TICK(t)
+# define BFI_FLINEARS_1268(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1267, v ds
+# define BFI_FLINEARS_1268_TICK(t)
+# define BFI_FLINEARS_1267(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1266, v ds
+# define BFI_FLINEARS_1267_TICK(t)
+# define BFI_FLINEARS_1266(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1265, v ds
+# define BFI_FLINEARS_1266_TICK(t)
+# define BFI_FLINEARS_1265(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1264, v ds
+# define BFI_FLINEARS_1265_TICK(t)
+# define BFI_FLINEARS_1264(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1263, v ds
+# define BFI_FLINEARS_1264_TICK(t)
+# define BFI_FLINEARS_1263(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1262, v ds
+# define BFI_FLINEARS_1263_TICK(t)
+# define BFI_FLINEARS_1262(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1261, v ds
+# define BFI_FLINEARS_1262_TICK(t)
+# define BFI_FLINEARS_1261(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1260, v ds
+# define BFI_FLINEARS_1261_TICK(t)
+# define BFI_FLINEARS_1260(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1259, v ds
+# define BFI_FLINEARS_1260_TICK(t)
+# define BFI_FLINEARS_1259(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1258, v ds
+# define BFI_FLINEARS_1259_TICK(t)
+# define BFI_FLINEARS_1258(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1257, v ds
+# define BFI_FLINEARS_1258_TICK(t)
+# define BFI_FLINEARS_1257(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1256, v ds
+# define BFI_FLINEARS_1257_TICK(t)
+# define BFI_FLINEARS_1256(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1255, v ds
+# define BFI_FLINEARS_1256_TICK(t)
+# define BFI_FLINEARS_1255(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1254, v ds
+# define BFI_FLINEARS_1255_TICK(t)
+# define BFI_FLINEARS_1254(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1253, v ds
+# define BFI_FLINEARS_1254_TICK(t)
+# define BFI_FLINEARS_1253(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1252, v ds
+# define BFI_FLINEARS_1253_TICK(t)
+# define BFI_FLINEARS_1252(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1251, v ds
+# define BFI_FLINEARS_1252_TICK(t)
+# define BFI_FLINEARS_1251(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1250, v ds
+# define BFI_FLINEARS_1251_TICK(t)
+# define BFI_FLINEARS_1250(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1249, v ds
+# define BFI_FLINEARS_1250_TICK(t)
+# define BFI_FLINEARS_1249(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1248, v ds
+# define BFI_FLINEARS_1249_TICK(t)
+# define BFI_FLINEARS_1248(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1247, v ds
+# define BFI_FLINEARS_1248_TICK(t)
+# define BFI_FLINEARS_1247(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1246, v ds
+# define BFI_FLINEARS_1247_TICK(t)
+# define BFI_FLINEARS_1246(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1245, v ds
+# define BFI_FLINEARS_1246_TICK(t)
+# define BFI_FLINEARS_1245(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1244, v ds
+# define BFI_FLINEARS_1245_TICK(t)
+# define BFI_FLINEARS_1244(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1243, v ds
+# define BFI_FLINEARS_1244_TICK(t)
+# define BFI_FLINEARS_1243(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1242, v ds
+# define BFI_FLINEARS_1243_TICK(t)
+# define BFI_FLINEARS_1242(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1241, v ds
+# define BFI_FLINEARS_1242_TICK(t)
+# define BFI_FLINEARS_1241(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1240, v ds
+# define BFI_FLINEARS_1241_TICK(t)
+# define BFI_FLINEARS_1240(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1239, v ds
+# define BFI_FLINEARS_1240_TICK(t)
+# define BFI_FLINEARS_1239(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1238, v ds
+# define BFI_FLINEARS_1239_TICK(t)
+# define BFI_FLINEARS_1238(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1237, v ds
+# define BFI_FLINEARS_1238_TICK(t)
+# define BFI_FLINEARS_1237(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1236, v ds
+# define BFI_FLINEARS_1237_TICK(t)
+# define BFI_FLINEARS_1236(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1235, v ds
+# define BFI_FLINEARS_1236_TICK(t)
+# define BFI_FLINEARS_1235(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1234, v ds
+# define BFI_FLINEARS_1235_TICK(t)
+# define BFI_FLINEARS_1234(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1233, v ds
+# define BFI_FLINEARS_1234_TICK(t)
+# define BFI_FLINEARS_1233(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1232, v ds
+# define BFI_FLINEARS_1233_TICK(t)
+# define BFI_FLINEARS_1232(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1231, v ds
+# define BFI_FLINEARS_1232_TICK(t)
+# define BFI_FLINEARS_1231(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1230, v ds
+# define BFI_FLINEARS_1231_TICK(t)
+# define BFI_FLINEARS_1230(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1229, v ds
+# define BFI_FLINEARS_1230_TICK(t)
+# define BFI_FLINEARS_1229(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1228, v ds
+# define BFI_FLINEARS_1229_TICK(t)
+# define BFI_FLINEARS_1228(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1227, v ds
+# define BFI_FLINEARS_1228_TICK(t)
+# define BFI_FLINEARS_1227(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1226, v ds
+# define BFI_FLINEARS_1227_TICK(t)
+# define BFI_FLINEARS_1226(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1225, v ds
+# define BFI_FLINEARS_1226_TICK(t)
+# define BFI_FLINEARS_1225(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1224, v ds
+# define BFI_FLINEARS_1225_TICK(t)
+# define BFI_FLINEARS_1224(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1223, v ds
+# define BFI_FLINEARS_1224_TICK(t)
+# define BFI_FLINEARS_1223(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1222, v ds
+# define BFI_FLINEARS_1223_TICK(t)
+# define BFI_FLINEARS_1222(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1221, v ds
+# define BFI_FLINEARS_1222_TICK(t)
+# define BFI_FLINEARS_1221(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1220, v ds
+# define BFI_FLINEARS_1221_TICK(t)
+# define BFI_FLINEARS_1220(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1219, v ds
+# define BFI_FLINEARS_1220_TICK(t)
+# define BFI_FLINEARS_1219(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1218, v ds
+# define BFI_FLINEARS_1219_TICK(t)
+# define BFI_FLINEARS_1218(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1217, v ds
+# define BFI_FLINEARS_1218_TICK(t)
+# define BFI_FLINEARS_1217(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1216, v ds
+# define BFI_FLINEARS_1217_TICK(t)
+# define BFI_FLINEARS_1216(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1215, v ds
+# define BFI_FLINEARS_1216_TICK(t)
+# define BFI_FLINEARS_1215(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1214, v ds
+# define BFI_FLINEARS_1215_TICK(t)
+# define BFI_FLINEARS_1214(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1213, v ds
+# define BFI_FLINEARS_1214_TICK(t)
+# define BFI_FLINEARS_1213(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1212, v ds
+# define BFI_FLINEARS_1213_TICK(t)
+# define BFI_FLINEARS_1212(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1211, v ds
+# define BFI_FLINEARS_1212_TICK(t)
+# define BFI_FLINEARS_1211(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1210, v ds
+# define BFI_FLINEARS_1211_TICK(t)
+# define BFI_FLINEARS_1210(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1209, v ds
+# define BFI_FLINEARS_1210_TICK(t)
+# define BFI_FLINEARS_1209(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1208, v ds
+# define BFI_FLINEARS_1209_TICK(t)
+# define BFI_FLINEARS_1208(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1207, v ds
+# define BFI_FLINEARS_1208_TICK(t)
+# define BFI_FLINEARS_1207(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1206, v ds
+# define BFI_FLINEARS_1207_TICK(t)
+# define BFI_FLINEARS_1206(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1205, v ds
+# define BFI_FLINEARS_1206_TICK(t)
+# define BFI_FLINEARS_1205(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1204, v ds
+# define BFI_FLINEARS_1205_TICK(t)
+# define BFI_FLINEARS_1204(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1203, v ds
+# define BFI_FLINEARS_1204_TICK(t)
+# define BFI_FLINEARS_1203(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1202, v ds
+# define BFI_FLINEARS_1203_TICK(t)
+# define BFI_FLINEARS_1202(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1201, v ds
+# define BFI_FLINEARS_1202_TICK(t)
+# define BFI_FLINEARS_1201(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1200, v ds
+# define BFI_FLINEARS_1201_TICK(t)
+# define BFI_FLINEARS_1200(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1199, v ds
+# define BFI_FLINEARS_1200_TICK(t)
+# define BFI_FLINEARS_1199(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1198, v ds
+# define BFI_FLINEARS_1199_TICK(t)
+# define BFI_FLINEARS_1198(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1197, v ds
+# define BFI_FLINEARS_1198_TICK(t)
+# define BFI_FLINEARS_1197(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1196, v ds
+# define BFI_FLINEARS_1197_TICK(t)
+# define BFI_FLINEARS_1196(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1195, v ds
+# define BFI_FLINEARS_1196_TICK(t)
+# define BFI_FLINEARS_1195(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1194, v ds
+# define BFI_FLINEARS_1195_TICK(t)
+# define BFI_FLINEARS_1194(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1193, v ds
+# define BFI_FLINEARS_1194_TICK(t)
+# define BFI_FLINEARS_1193(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1192, v ds
+# define BFI_FLINEARS_1193_TICK(t)
+# define BFI_FLINEARS_1192(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1191, v ds
+# define BFI_FLINEARS_1192_TICK(t)
+# define BFI_FLINEARS_1191(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1190, v ds
+# define BFI_FLINEARS_1191_TICK(t)
+# define BFI_FLINEARS_1190(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1189, v ds
+# define BFI_FLINEARS_1190_TICK(t)
+# define BFI_FLINEARS_1189(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1188, v ds
+# define BFI_FLINEARS_1189_TICK(t)
+# define BFI_FLINEARS_1188(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1187, v ds
+# define BFI_FLINEARS_1188_TICK(t)
+# define BFI_FLINEARS_1187(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1186, v ds
+# define BFI_FLINEARS_1187_TICK(t)
+# define BFI_FLINEARS_1186(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1185, v ds
+# define BFI_FLINEARS_1186_TICK(t)
+# define BFI_FLINEARS_1185(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1184, v ds
+# define BFI_FLINEARS_1185_TICK(t)
+# define BFI_FLINEARS_1184(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1183, v ds
+# define BFI_FLINEARS_1184_TICK(t)
+# define BFI_FLINEARS_1183(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1182, v ds
+# define BFI_FLINEARS_1183_TICK(t)
+# define BFI_FLINEARS_1182(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1181, v ds
+# define BFI_FLINEARS_1182_TICK(t)
+# define BFI_FLINEARS_1181(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1180, v ds
+# define BFI_FLINEARS_1181_TICK(t)
+# define BFI_FLINEARS_1180(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1179, v ds
+# define BFI_FLINEARS_1180_TICK(t)
+# define BFI_FLINEARS_1179(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1178, v ds
+# define BFI_FLINEARS_1179_TICK(t)
+# define BFI_FLINEARS_1178(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1177, v ds
+# define BFI_FLINEARS_1178_TICK(t)
+# define BFI_FLINEARS_1177(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1176, v ds
+# define BFI_FLINEARS_1177_TICK(t)
+# define BFI_FLINEARS_1176(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1175, v ds
+# define BFI_FLINEARS_1176_TICK(t)
+# define BFI_FLINEARS_1175(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1174, v ds
+# define BFI_FLINEARS_1175_TICK(t)
+# define BFI_FLINEARS_1174(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1173, v ds
+# define BFI_FLINEARS_1174_TICK(t)
+# define BFI_FLINEARS_1173(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1172, v ds
+# define BFI_FLINEARS_1173_TICK(t)
+# define BFI_FLINEARS_1172(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1171, v ds
+# define BFI_FLINEARS_1172_TICK(t)
+# define BFI_FLINEARS_1171(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1170, v ds
+# define BFI_FLINEARS_1171_TICK(t)
+# define BFI_FLINEARS_1170(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1169, v ds
+# define BFI_FLINEARS_1170_TICK(t)
+# define BFI_FLINEARS_1169(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1168, v ds
+# define BFI_FLINEARS_1169_TICK(t)
+# define BFI_FLINEARS_1168(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1167, v ds
+# define BFI_FLINEARS_1168_TICK(t)
+# define BFI_FLINEARS_1167(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1166, v ds
+# define BFI_FLINEARS_1167_TICK(t)
+# define BFI_FLINEARS_1166(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1165, v ds
+# define BFI_FLINEARS_1166_TICK(t)
+# define BFI_FLINEARS_1165(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1164, v ds
+# define BFI_FLINEARS_1165_TICK(t)
+# define BFI_FLINEARS_1164(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1163, v ds
+# define BFI_FLINEARS_1164_TICK(t)
+# define BFI_FLINEARS_1163(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1162, v ds
+# define BFI_FLINEARS_1163_TICK(t)
+# define BFI_FLINEARS_1162(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1161, v ds
+# define BFI_FLINEARS_1162_TICK(t)
+# define BFI_FLINEARS_1161(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1160, v ds
+# define BFI_FLINEARS_1161_TICK(t)
+# define BFI_FLINEARS_1160(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1159, v ds
+# define BFI_FLINEARS_1160_TICK(t)
+# define BFI_FLINEARS_1159(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1158, v ds
+# define BFI_FLINEARS_1159_TICK(t)
+# define BFI_FLINEARS_1158(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1157, v ds
+# define BFI_FLINEARS_1158_TICK(t)
+# define BFI_FLINEARS_1157(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1156, v ds
+# define BFI_FLINEARS_1157_TICK(t)
+# define BFI_FLINEARS_1156(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1155, v ds
+# define BFI_FLINEARS_1156_TICK(t)
+# define BFI_FLINEARS_1155(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1154, v ds
+# define BFI_FLINEARS_1155_TICK(t)
+# define BFI_FLINEARS_1154(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1153, v ds
+# define BFI_FLINEARS_1154_TICK(t)
+# define BFI_FLINEARS_1153(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1152, v ds
+# define BFI_FLINEARS_1153_TICK(t)
+# define BFI_FLINEARS_1152(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1151, v ds
+# define BFI_FLINEARS_1152_TICK(t)
+# define BFI_FLINEARS_1151(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1150, v ds
+# define BFI_FLINEARS_1151_TICK(t)
+# define BFI_FLINEARS_1150(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1149, v ds
+# define BFI_FLINEARS_1150_TICK(t)
+# define BFI_FLINEARS_1149(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1148, v ds
+# define BFI_FLINEARS_1149_TICK(t)
+# define BFI_FLINEARS_1148(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1147, v ds
+# define BFI_FLINEARS_1148_TICK(t)
+# define BFI_FLINEARS_1147(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1146, v ds
+# define BFI_FLINEARS_1147_TICK(t)
+# define BFI_FLINEARS_1146(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1145, v ds
+# define BFI_FLINEARS_1146_TICK(t)
+# define BFI_FLINEARS_1145(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1144, v ds
+# define BFI_FLINEARS_1145_TICK(t)
+# define BFI_FLINEARS_1144(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1143, v ds
+# define BFI_FLINEARS_1144_TICK(t)
+# define BFI_FLINEARS_1143(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1142, v ds
+# define BFI_FLINEARS_1143_TICK(t)
+# define BFI_FLINEARS_1142(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1141, v ds
+# define BFI_FLINEARS_1142_TICK(t)
+# define BFI_FLINEARS_1141(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1140, v ds
+# define BFI_FLINEARS_1141_TICK(t)
+# define BFI_FLINEARS_1140(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1139, v ds
+# define BFI_FLINEARS_1140_TICK(t)
+# define BFI_FLINEARS_1139(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1138, v ds
+# define BFI_FLINEARS_1139_TICK(t)
+# define BFI_FLINEARS_1138(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1137, v ds
+# define BFI_FLINEARS_1138_TICK(t)
+# define BFI_FLINEARS_1137(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1136, v ds
+# define BFI_FLINEARS_1137_TICK(t)
+# define BFI_FLINEARS_1136(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1135, v ds
+# define BFI_FLINEARS_1136_TICK(t)
+# define BFI_FLINEARS_1135(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1134, v ds
+# define BFI_FLINEARS_1135_TICK(t)
+# define BFI_FLINEARS_1134(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1133, v ds
+# define BFI_FLINEARS_1134_TICK(t)
+# define BFI_FLINEARS_1133(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1132, v ds
+# define BFI_FLINEARS_1133_TICK(t)
+# define BFI_FLINEARS_1132(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1131, v ds
+# define BFI_FLINEARS_1132_TICK(t)
+# define BFI_FLINEARS_1131(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1130, v ds
+# define BFI_FLINEARS_1131_TICK(t)
+# define BFI_FLINEARS_1130(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1129, v ds
+# define BFI_FLINEARS_1130_TICK(t)
+# define BFI_FLINEARS_1129(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1128, v ds
+# define BFI_FLINEARS_1129_TICK(t)
+# define BFI_FLINEARS_1128(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1127, v ds
+# define BFI_FLINEARS_1128_TICK(t)
+# define BFI_FLINEARS_1127(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1126, v ds
+# define BFI_FLINEARS_1127_TICK(t)
+# define BFI_FLINEARS_1126(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1125, v ds
+# define BFI_FLINEARS_1126_TICK(t)
+# define BFI_FLINEARS_1125(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1124, v ds
+# define BFI_FLINEARS_1125_TICK(t)
+# define BFI_FLINEARS_1124(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1123, v ds
+# define BFI_FLINEARS_1124_TICK(t)
+# define BFI_FLINEARS_1123(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1122, v ds
+# define BFI_FLINEARS_1123_TICK(t)
+# define BFI_FLINEARS_1122(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1121, v ds
+# define BFI_FLINEARS_1122_TICK(t)
+# define BFI_FLINEARS_1121(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1120, v ds
+# define BFI_FLINEARS_1121_TICK(t)
+# define BFI_FLINEARS_1120(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1119, v ds
+# define BFI_FLINEARS_1120_TICK(t)
+# define BFI_FLINEARS_1119(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1118, v ds
+# define BFI_FLINEARS_1119_TICK(t)
+# define BFI_FLINEARS_1118(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1117, v ds
+# define BFI_FLINEARS_1118_TICK(t)
+# define BFI_FLINEARS_1117(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1116, v ds
+# define BFI_FLINEARS_1117_TICK(t)
+# define BFI_FLINEARS_1116(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1115, v ds
+# define BFI_FLINEARS_1116_TICK(t)
+# define BFI_FLINEARS_1115(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1114, v ds
+# define BFI_FLINEARS_1115_TICK(t)
+# define BFI_FLINEARS_1114(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1113, v ds
+# define BFI_FLINEARS_1114_TICK(t)
+# define BFI_FLINEARS_1113(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1112, v ds
+# define BFI_FLINEARS_1113_TICK(t)
+# define BFI_FLINEARS_1112(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1111, v ds
+# define BFI_FLINEARS_1112_TICK(t)
+# define BFI_FLINEARS_1111(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1110, v ds
+# define BFI_FLINEARS_1111_TICK(t)
+# define BFI_FLINEARS_1110(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1109, v ds
+# define BFI_FLINEARS_1110_TICK(t)
+# define BFI_FLINEARS_1109(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1108, v ds
+# define BFI_FLINEARS_1109_TICK(t)
+# define BFI_FLINEARS_1108(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1107, v ds
+# define BFI_FLINEARS_1108_TICK(t)
+# define BFI_FLINEARS_1107(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1106, v ds
+# define BFI_FLINEARS_1107_TICK(t)
+# define BFI_FLINEARS_1106(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1105, v ds
+# define BFI_FLINEARS_1106_TICK(t)
+# define BFI_FLINEARS_1105(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1104, v ds
+# define BFI_FLINEARS_1105_TICK(t)
+# define BFI_FLINEARS_1104(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1103, v ds
+# define BFI_FLINEARS_1104_TICK(t)
+# define BFI_FLINEARS_1103(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1102, v ds
+# define BFI_FLINEARS_1103_TICK(t)
+# define BFI_FLINEARS_1102(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1101, v ds
+# define BFI_FLINEARS_1102_TICK(t)
+# define BFI_FLINEARS_1101(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1100, v ds
+# define BFI_FLINEARS_1101_TICK(t)
+# define BFI_FLINEARS_1100(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1099, v ds
+# define BFI_FLINEARS_1100_TICK(t)
+# define BFI_FLINEARS_1099(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1098, v ds
+# define BFI_FLINEARS_1099_TICK(t)
+# define BFI_FLINEARS_1098(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1097, v ds
+# define BFI_FLINEARS_1098_TICK(t)
+# define BFI_FLINEARS_1097(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1096, v ds
+# define BFI_FLINEARS_1097_TICK(t)
+# define BFI_FLINEARS_1096(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1095, v ds
+# define BFI_FLINEARS_1096_TICK(t)
+# define BFI_FLINEARS_1095(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1094, v ds
+# define BFI_FLINEARS_1095_TICK(t)
+# define BFI_FLINEARS_1094(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1093, v ds
+# define BFI_FLINEARS_1094_TICK(t)
+# define BFI_FLINEARS_1093(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1092, v ds
+# define BFI_FLINEARS_1093_TICK(t)
+# define BFI_FLINEARS_1092(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1091, v ds
+# define BFI_FLINEARS_1092_TICK(t)
+# define BFI_FLINEARS_1091(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1090, v ds
+# define BFI_FLINEARS_1091_TICK(t)
+# define BFI_FLINEARS_1090(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1089, v ds
+# define BFI_FLINEARS_1090_TICK(t)
+# define BFI_FLINEARS_1089(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1088, v ds
+# define BFI_FLINEARS_1089_TICK(t)
+# define BFI_FLINEARS_1088(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1087, v ds
+# define BFI_FLINEARS_1088_TICK(t)
+# define BFI_FLINEARS_1087(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1086, v ds
+# define BFI_FLINEARS_1087_TICK(t)
+# define BFI_FLINEARS_1086(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1085, v ds
+# define BFI_FLINEARS_1086_TICK(t)
+# define BFI_FLINEARS_1085(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1084, v ds
+# define BFI_FLINEARS_1085_TICK(t)
+# define BFI_FLINEARS_1084(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1083, v ds
+# define BFI_FLINEARS_1084_TICK(t)
+# define BFI_FLINEARS_1083(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1082, v ds
+# define BFI_FLINEARS_1083_TICK(t)
+# define BFI_FLINEARS_1082(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1081, v ds
+# define BFI_FLINEARS_1082_TICK(t)
+# define BFI_FLINEARS_1081(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1080, v ds
+# define BFI_FLINEARS_1081_TICK(t)
+# define BFI_FLINEARS_1080(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1079, v ds
+# define BFI_FLINEARS_1080_TICK(t)
+# define BFI_FLINEARS_1079(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1078, v ds
+# define BFI_FLINEARS_1079_TICK(t)
+# define BFI_FLINEARS_1078(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1077, v ds
+# define BFI_FLINEARS_1078_TICK(t)
+# define BFI_FLINEARS_1077(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1076, v ds
+# define BFI_FLINEARS_1077_TICK(t)
+# define BFI_FLINEARS_1076(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1075, v ds
+# define BFI_FLINEARS_1076_TICK(t)
+# define BFI_FLINEARS_1075(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1074, v ds
+# define BFI_FLINEARS_1075_TICK(t)
+# define BFI_FLINEARS_1074(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1073, v ds
+# define BFI_FLINEARS_1074_TICK(t)
+# define BFI_FLINEARS_1073(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1072, v ds
+# define BFI_FLINEARS_1073_TICK(t)
+# define BFI_FLINEARS_1072(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1071, v ds
+# define BFI_FLINEARS_1072_TICK(t)
+# define BFI_FLINEARS_1071(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1070, v ds
+# define BFI_FLINEARS_1071_TICK(t)
+# define BFI_FLINEARS_1070(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1069, v ds
+# define BFI_FLINEARS_1070_TICK(t)
+# define BFI_FLINEARS_1069(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1068, v ds
+# define BFI_FLINEARS_1069_TICK(t)
+# define BFI_FLINEARS_1068(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1067, v ds
+# define BFI_FLINEARS_1068_TICK(t)
+# define BFI_FLINEARS_1067(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1066, v ds
+# define BFI_FLINEARS_1067_TICK(t)
+# define BFI_FLINEARS_1066(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1065, v ds
+# define BFI_FLINEARS_1066_TICK(t)
+# define BFI_FLINEARS_1065(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1064, v ds
+# define BFI_FLINEARS_1065_TICK(t)
+# define BFI_FLINEARS_1064(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1063, v ds
+# define BFI_FLINEARS_1064_TICK(t)
+# define BFI_FLINEARS_1063(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1062, v ds
+# define BFI_FLINEARS_1063_TICK(t)
+# define BFI_FLINEARS_1062(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1061, v ds
+# define BFI_FLINEARS_1062_TICK(t)
+# define BFI_FLINEARS_1061(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1060, v ds
+# define BFI_FLINEARS_1061_TICK(t)
+# define BFI_FLINEARS_1060(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1059, v ds
+# define BFI_FLINEARS_1060_TICK(t)
+# define BFI_FLINEARS_1059(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1058, v ds
+# define BFI_FLINEARS_1059_TICK(t)
+# define BFI_FLINEARS_1058(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1057, v ds
+# define BFI_FLINEARS_1058_TICK(t)
+# define BFI_FLINEARS_1057(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1056, v ds
+# define BFI_FLINEARS_1057_TICK(t)
+# define BFI_FLINEARS_1056(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1055, v ds
+# define BFI_FLINEARS_1056_TICK(t)
+# define BFI_FLINEARS_1055(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1054, v ds
+# define BFI_FLINEARS_1055_TICK(t)
+# define BFI_FLINEARS_1054(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1053, v ds
+# define BFI_FLINEARS_1054_TICK(t)
+# define BFI_FLINEARS_1053(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1052, v ds
+# define BFI_FLINEARS_1053_TICK(t)
+# define BFI_FLINEARS_1052(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1051, v ds
+# define BFI_FLINEARS_1052_TICK(t)
+# define BFI_FLINEARS_1051(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1050, v ds
+# define BFI_FLINEARS_1051_TICK(t)
+# define BFI_FLINEARS_1050(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1049, v ds
+# define BFI_FLINEARS_1050_TICK(t)
+# define BFI_FLINEARS_1049(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1048, v ds
+# define BFI_FLINEARS_1049_TICK(t)
+# define BFI_FLINEARS_1048(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1047, v ds
+# define BFI_FLINEARS_1048_TICK(t)
+# define BFI_FLINEARS_1047(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1046, v ds
+# define BFI_FLINEARS_1047_TICK(t)
+# define BFI_FLINEARS_1046(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1045, v ds
+# define BFI_FLINEARS_1046_TICK(t)
+# define BFI_FLINEARS_1045(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1044, v ds
+# define BFI_FLINEARS_1045_TICK(t)
+# define BFI_FLINEARS_1044(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1043, v ds
+# define BFI_FLINEARS_1044_TICK(t)
+# define BFI_FLINEARS_1043(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1042, v ds
+# define BFI_FLINEARS_1043_TICK(t)
+# define BFI_FLINEARS_1042(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1041, v ds
+# define BFI_FLINEARS_1042_TICK(t)
+# define BFI_FLINEARS_1041(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1040, v ds
+# define BFI_FLINEARS_1041_TICK(t)
+# define BFI_FLINEARS_1040(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1039, v ds
+# define BFI_FLINEARS_1040_TICK(t)
+# define BFI_FLINEARS_1039(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1038, v ds
+# define BFI_FLINEARS_1039_TICK(t)
+# define BFI_FLINEARS_1038(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1037, v ds
+# define BFI_FLINEARS_1038_TICK(t)
+# define BFI_FLINEARS_1037(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1036, v ds
+# define BFI_FLINEARS_1037_TICK(t)
+# define BFI_FLINEARS_1036(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1035, v ds
+# define BFI_FLINEARS_1036_TICK(t)
+# define BFI_FLINEARS_1035(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1034, v ds
+# define BFI_FLINEARS_1035_TICK(t)
+# define BFI_FLINEARS_1034(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1033, v ds
+# define BFI_FLINEARS_1034_TICK(t)
+# define BFI_FLINEARS_1033(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1032, v ds
+# define BFI_FLINEARS_1033_TICK(t)
+# define BFI_FLINEARS_1032(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1031, v ds
+# define BFI_FLINEARS_1032_TICK(t)
+# define BFI_FLINEARS_1031(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1030, v ds
+# define BFI_FLINEARS_1031_TICK(t)
+# define BFI_FLINEARS_1030(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1029, v ds
+# define BFI_FLINEARS_1030_TICK(t)
+# define BFI_FLINEARS_1029(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1028, v ds
+# define BFI_FLINEARS_1029_TICK(t)
+# define BFI_FLINEARS_1028(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1027, v ds
+# define BFI_FLINEARS_1028_TICK(t)
+# define BFI_FLINEARS_1027(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1026, v ds
+# define BFI_FLINEARS_1027_TICK(t)
+# define BFI_FLINEARS_1026(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1025, v ds
+# define BFI_FLINEARS_1026_TICK(t)
+# define BFI_FLINEARS_1025(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1024, v ds
+# define BFI_FLINEARS_1025_TICK(t)
+
+# endif
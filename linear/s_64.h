@@ -0,0 +1,135 @@
+# ifndef BFI_LINEAR_S_64_H
+# define BFI_LINEAR_S_64_H
+
+/* generated by gen_linear.hs */
+
+# define BFI_FLINEARS_64(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_63, v ds
+# define BFI_FLINEARS_64_TICK(t)
+# define BFI_FLINEARS_63(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_62, v ds
+# define BFI_FLINEARS_63_TICK(t)
+# define BFI_FLINEARS_62(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_61, v ds
+# define BFI_FLINEARS_62_TICK(t)
+# define BFI_FLINEARS_61(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_60, v ds
+# define BFI_FLINEARS_61_TICK(t)
+# define BFI_FLINEARS_60(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_59, v ds
+# define BFI_FLINEARS_60_TICK(t)
+# define BFI_FLINEARS_59(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_58, v ds
+# define BFI_FLINEARS_59_TICK(t)
+# define BFI_FLINEARS_58(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_57, v ds
+# define BFI_FLINEARS_58_TICK(t)
+# define BFI_FLINEARS_57(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_56, v ds
+# define BFI_FLINEARS_57_TICK(t)
+# define BFI_FLINEARS_56(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_55, v ds
+# define BFI_FLINEARS_56_TICK(t)
+# define BFI_FLINEARS_55(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_54, v ds
+# define BFI_FLINEARS_55_TICK(t)
+# define BFI_FLINEARS_54(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_53, v ds
+# define BFI_FLINEARS_54_TICK(t)
+# define BFI_FLINEARS_53(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_52, v ds
+# define BFI_FLINEARS_53_TICK(t)
+# define BFI_FLINEARS_52(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_51, v ds
+# define BFI_FLINEARS_52_TICK(t)
+# define BFI_FLINEARS_51(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_50, v ds
+# define BFI_FLINEARS_51_TICK(t)
+# define BFI_FLINEARS_50(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_49, v ds
+# define BFI_FLINEARS_50_TICK(t)
+# define BFI_FLINEARS_49(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_48, v ds
+# define BFI_FLINEARS_49_TICK(t)
+# define BFI_FLINEARS_48(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_47, v ds
+# define BFI_FLINEARS_48_TICK(t)
+# define BFI_FLINEARS_47(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_46, v ds
+# define BFI_FLINEARS_47_TICK(t)
+# define BFI_FLINEARS_46(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_45, v ds
+# define BFI_FLINEARS_46_TICK(t)
+# define BFI_FLINEARS_45(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_44, v ds
+# define BFI_FLINEARS_45_TICK(t)
+# define BFI_FLINEARS_44(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_43, v ds
+# define BFI_FLINEARS_44_TICK(t)
+# define BFI_FLINEARS_43(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_42, v ds
+# define BFI_FLINEARS_43_TICK(t)
+# define BFI_FLINEARS_42(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_41, v ds
+# define BFI_FLINEARS_42_TICK(t)
+# define BFI_FLINEARS_41(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_40, v ds
+# define BFI_FLINEARS_41_TICK(t)
+# define BFI_FLINEARS_40(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_39, v ds
+# define BFI_FLINEARS_40_TICK(t)
+# define BFI_FLINEARS_39(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_38, v ds
+# define BFI_FLINEARS_39_TICK(t)
+# define BFI_FLINEARS_38(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_37, v ds
+# define BFI_FLINEARS_38_TICK(t)
+# define BFI_FLINEARS_37(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_36, v ds
+# define BFI_FLINEARS_37_TICK(t)
+# define BFI_FLINEARS_36(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_35, v ds
+# define BFI_FLINEARS_36_TICK(t)
+# define BFI_FLINEARS_35(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_34, v ds
+# define BFI_FLINEARS_35_TICK(t)
+# define BFI_FLINEARS_34(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_33, v ds
+# define BFI_FLINEARS_34_TICK(t)
+# define BFI_FLINEARS_33(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_32, v ds
+# define BFI_FLINEARS_33_TICK(t)
+# define BFI_FLINEARS_32(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_31, v ds
+# define BFI_FLINEARS_32_TICK(t)
+# define BFI_FLINEARS_31(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_30, v ds
+# define BFI_FLINEARS_31_TICK(t)
+# define BFI_FLINEARS_30(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_29, v ds
+# define BFI_FLINEARS_30_TICK(t)
+# define BFI_FLINEARS_29(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_28, v ds
+# define BFI_FLINEARS_29_TICK(t)
+# define BFI_FLINEARS_28(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_27, v ds
+# define BFI_FLINEARS_28_TICK(t)
+# define BFI_FLINEARS_27(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_26, v ds
+# define BFI_FLINEARS_27_TICK(t)
+# define BFI_FLINEARS_26(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_25, v ds
+# define BFI_FLINEARS_26_TICK(t)
+# define BFI_FLINEARS_25(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_24, v ds
+# define BFI_FLINEARS_25_TICK(t)
+# define BFI_FLINEARS_24(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_23, v ds
+# define BFI_FLINEARS_24_TICK(t)
+# define BFI_FLINEARS_23(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_22, v ds
+# define BFI_FLINEARS_23_TICK(t)
+# define BFI_FLINEARS_22(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_21, v ds
+# define BFI_FLINEARS_22_TICK(t)
+# define BFI_FLINEARS_21(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_20, v ds
+# define BFI_FLINEARS_21_TICK(t)
+# define BFI_FLINEARS_20(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_19, v ds
+# define BFI_FLINEARS_20_TICK(t)
+# define BFI_FLINEARS_19(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_18, v ds
+# define BFI_FLINEARS_19_TICK(t)
+# define BFI_FLINEARS_18(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_17, v ds
+# define BFI_FLINEARS_18_TICK(t)
+# define BFI_FLINEARS_17(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_16, v ds
+# define BFI_FLINEARS_17_TICK(t)
+# define BFI_FLINEARS_16(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_15, v ds
+# define BFI_FLINEARS_16_TICK(t)
+# define BFI_FLINEARS_15(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_14, v ds
+# define BFI_FLINEARS_15_TICK(t)
+# define BFI_FLINEARS_14(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_13, v ds
+# define BFI_FLINEARS_14_TICK(t)
+# define BFI_FLINEARS_13(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_12, v ds
+# define BFI_FLINEARS_13_TICK(t)
+# define BFI_FLINEARS_12(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_11, v ds
+# define BFI_FLINEARS_12_TICK(t)
+# define BFI_FLINEARS_11(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_10, v ds
+# define BFI_FLINEARS_11_TICK(t)
+# define BFI_FLINEARS_10(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_9, v ds
+# define BFI_FLINEARS_10_TICK(t)
+# define BFI_FLINEARS_9(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_8, v ds
+# define BFI_FLINEARS_9_TICK(t)
+# define BFI_FLINEARS_8(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_7, v ds
+# define BFI_FLINEARS_8_TICK(t)
+# define BFI_FLINEARS_7(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_6, v ds
+# define BFI_FLINEARS_7_TICK(t)
+# define BFI_FLINEARS_6(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_5, v ds
+# define BFI_FLINEARS_6_TICK(t)
+# define BFI_FLINEARS_5(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_4, v ds
+# define BFI_FLINEARS_5_TICK(t)
+# define BFI_FLINEARS_4(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_3, v ds
+# define BFI_FLINEARS_4_TICK(t)
+# define BFI_FLINEARS_3(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_2, v ds
+# define BFI_FLINEARS_3_TICK(t)
+# define BFI_FLINEARS_2(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_1, v ds
+# define BFI_FLINEARS_2_TICK(t)
+# define BFI_FLINEARS_1(v, f, ds) BFI_FINST_##f(BFI_FLINEARS_0, v ds
+# define BFI_FLINEARS_1_TICK(t)
+
+# endif
@@ -30,7 +30,9 @@
  * 4. When the stack is empty and the instruction register does not contain
  *  6stop, the behavior is undefined.
  * 5. When the number of executed slow steps (defined below) exceeds a limit,
- *  the machine aborts by causing a CPP error. The limit is roughly 2**33.
+ *  the machine aborts by causing a CPP error. The limit is roughly
+ *  (2**BFI_MACHINE_LEVELS * BFI_LINEAR_DEPTH), which is 2**33 with the
+ *  default settings.
  *
  * The single-step update is defined as follows:
  *
@@ -75,6 +77,10 @@
  *    expand to a portable. In this form, 'new_am' and 'am' must be distinct
  *    macro names.
  *
+ *    'o' may be preceded by f##_TICK(t), which expands to nothing unless
+ *    the machine is run by BFI_FMACHINE_TALLY. Fast steps that omit it are
+ *    not seen by BFI_FMACHINE_TALLY.
+ *
  * 2. The machine state is updated as follows:
  *
  *  - The A register contains 'new_v_1' through 'new_v_M'.
@@ -89,7 +95,16 @@
  *
  * Remarks:
  *
- *  - In the fast form, nothing can be pushed to the stack.
+ *  - In the fast form, nothing can be pushed to the stack. A pushed frame
+ *    stays in the active representation until it is popped, and so would the
+ *    accompanying macro that pushed it, which would then be disabled for the
+ *    rest of the linear driver chain. An instruction that needs to push must
+ *    use the slow form.
+ *  - Fast steps do not nest. The next accompanying macro collects its
+ *    arguments past the end of the one that called it, so the preprocessor
+ *    has left that expansion before the next one starts. A long chain of
+ *    fast steps takes no more memory per step than slow steps do, and there
+ *    is no need to return to the linear driver now and then.
  *  - An instruction can "call" itself by simply arranging that it is placed in
  *    the instruction register, either immediately (using the slow form) or at
  *    some later step. This does not cause a macro calling itself, because an
@@ -146,10 +161,31 @@
  *   step, and once for a fast step.
  * - The content of the stack is scanned less than once in 10 slow steps on
  *   average.
- * - Any part of the output buffer is scanned only O(log(steps)) times.
+ * - Any part of the output buffer is scanned only a constant number of times.
+ *
+ * The second scan of a slow step is the linear driver, and it cannot be
+ * left out. Something has to collect its arguments past the end of the
+ * accompanying macro, or the macro would still be disabled when the next
+ * instruction is the same one, and whatever collects them collects the new
+ * A register too. The driver does prescan that register, but not
+ * prescanning it (by passing the portables as separate arguments glued to an
+ * empty one with ##) made no measurable difference: the expansion of the
+ * driver holds the register either way, and that is what GCC pays for.
+ *
+ * The machine has no way to report its progress while it runs. The only
+ * thing a macro can make the preprocessor do besides expanding is a
+ * _Pragma, and GCC holds back a _Pragma found inside macro arguments until
+ * the outermost macro has been expanded. Every step of the machine happens
+ * inside the arguments of the levels, so a report made by a step, or by
+ * the end of a slice, comes out only when the whole run is over. With -E
+ * a "message" pragma is not even printed; it is left in the output. A long
+ * run is better split with BFI_FMACHINE_SLICE, whose results show the
+ * progress one expansion at a time.
  */
 
 # include "util.h"
+# include "linear.h"
+# include "levels.h"
 
 /* BFI_FMACHINE_O(v, f, d)
  * BFI_FMACHINE_V(v, f, d)
@@ -161,19 +197,106 @@
  *  BFI_FMACHINE_O returns the content of the output buffer.
  *  BFI_FMACHINE_V returns the content of the A register.
  *
- *  These macros are not reentrant. This means that if a macro is implemented
- *  using the continuation machine, it cannot be used to implement a
- *  continuation machine instruction. Usually you can work around this
- *  limitation by using the underlying instruction directly, rather than using
- *  the macro that wraps the instruction.
+ *  These macros are reentrant up to BFI_MACHINE_FAMILIES levels, i.e. an
+ *  instruction can call a macro that is implemented using the continuation
+ *  machine, which in turn can run instructions that do the same. Each
+ *  machine runs on the first family that is not already in use. The only
+ *  restriction is that the nested machine cannot execute the instruction
+ *  that started it, because its accompanying macro is still being expanded.
  */
-# define BFI_FMACHINE_O(v, f, d) BFI_FMACHINE_G(BFI_LEFT, v, f, d)()
-# define BFI_FMACHINE_V(v, f, d) BFI_FMACHINE_G(BFI_RIGHT, v, f, d)
-# define BFI_FMACHINE_G(m, v, f, d) m(BFI_FMACHINE_R((f)((BFI_FLINEAR_ENTRANCE_A, v, d, 6stop))(~)(6stack_error,~)))
-# define BFI_FMACHINE_R(r) BFI_FMACHINE_END(BFI_FCM_OUTER_C_0(r))
+# define BFI_FMACHINE_O BFI_FMACHINE_FAMILY(O)
+# define BFI_FMACHINE_V BFI_FMACHINE_FAMILY(V)
 # define BFI_FMACHINE_END(x) BFI_TAKE_OUTPUT(x
 # define BFI_TAKE_OUTPUT(o, d) o,
 
+/* BFI_FMACHINE_START(v, f, d)
+ *    v : portable
+ *    f : instruction
+ *    d : portable
+ *  Expand to the portable representation of a machine initialized as in
+ *  BFI_FMACHINE_O.
+ *
+ * BFI_FMACHINE_SLICE(n, z)
+ *    n : integer, 0 <= n < BFI_MACHINE_LEVELS
+ *    z : portable representation
+ *  Run the machine represented by 'z' for at most
+ *  (2**n * BFI_LINEAR_DEPTH) steps. Expands to a ternary tuple (c, o, r),
+ *  where 'o' is what has been appended to the output buffer. If the machine
+ *  has been suspended, 'c' is 1 and 'r' is the new portable representation,
+ *  which can be given to BFI_FMACHINE_SLICE again. Otherwise 'c' is 0 and
+ *  'r' is the content of the A register.
+ *
+ *  BFI_FMACHINE_SLICE always uses the first machine family, so it must not
+ *  be called from inside an instruction.
+ */
+# define BFI_FMACHINE_START(v, f, d) BFI_FMACHINE_START_K(0, v, f, d)
+# define BFI_FMACHINE_START_K(k, v, f, d) (f)((BFI_FLINEAR##k##_ENTRANCE_A, v, d, 6stop))(~)(6stack_error,~)
+# define BFI_FMACHINE_SLICE(n, z) BFI_FMACHINE_SLICE_K(0, n, z)
+# define BFI_FMACHINE_SLICE_K(k, n, z) BFI_FMACHINE_SLICE_KI(k, n, z)
+# define BFI_FMACHINE_SLICE_KI(k, n, z) BFI_FMACHINE_SLICE_I(BFI_FCM##k##_INNER_C_##n(z))
+# define BFI_FMACHINE_SLICE_I(x) BFI_FMACHINE_SLICE_TAKE(x)
+# define BFI_FMACHINE_SLICE_TAKE(o, c) (c, o(), BFI_FMACHINE_SLICE_CLOSE(
+# define BFI_FMACHINE_SLICE_CLOSE(r) r)
+
+/* BFI_FMACHINE_TALLY(v, f, d, k, a)
+ *    v : portable
+ *    f : instruction
+ *    d : portable
+ *    k : macro
+ *    a : portable
+ *  Run the machine like BFI_FMACHINE_O, on the BFI_FLINEARC_* drivers. The
+ *  output is given to 'k' one slice at a time, together with the
+ *  accumulator 'a', which starts as the given value. "k(j, a, o)" must
+ *  expand to the items of 'o' that should be kept, followed by "j(a',",
+ *  where a' is the new accumulator. Expands to a binary tuple (o, a), where
+ *  'o' is the kept items, and 'a' is the final accumulator.
+ *
+ *  Besides the output of the machine, 'o' contains (0slow(0i##g)) for every
+ *  slow step that runs the instruction g, and (0fast(0i##g)) for every
+ *  fast step that uses f##_TICK(g). The output buffer must be a sequence of
+ *  unary tuples, each beginning with an identifier or a pp-number.
+ *  BFI_FMACHINE_TALLY can be nested inside BFI_FMACHINE_O, but not inside
+ *  another BFI_FMACHINE_TALLY.
+ */
+# define BFI_FMACHINE_TALLY(v, f, d, k, a) BFI_FMACHINE_TALLY_SPLIT(BFI_FMACHINE_O(BFI_FMACHINE_START_K(C, v, f, d), 6tally_start, (k, a)))
+
+/* BFI_FMACHINE_STATS(v, f, d)
+ *    v : portable
+ *    f : instruction
+ *    d : portable
+ *  Run the machine like BFI_FMACHINE_O, and count the steps it takes.
+ *  Expands to a quaternary tuple (o, s, t, n), where 'o' is the content of
+ *  the output buffer, 's' and 't' are the numbers of slow and fast steps, and
+ *  'n' is the number of items in 'o'. The numbers are decimal pp-numbers.
+ *  The restrictions of BFI_FMACHINE_TALLY apply.
+ */
+# define BFI_FMACHINE_STATS(v, f, d) BFI_FMACHINE_STATS_I(BFI_FMACHINE_TALLY(v, f, d, BFI_FMACHINE_COUNT, ((0)(), (0)(), (0)())))
+# define BFI_FMACHINE_STATS_I(r) BFI_FMACHINE_STATS_II r
+# define BFI_FMACHINE_STATS_II(o, a) BFI_FMACHINE_STATS_III(o, BFI_REM_3 a)
+# define BFI_FMACHINE_STATS_III(o, r) BFI_FMACHINE_STATS_IV(o, r)
+# define BFI_FMACHINE_STATS_IV(o, s, x, n) (o, BFI_FMACHINE_NUMBER(s), BFI_FMACHINE_NUMBER(x), BFI_FMACHINE_NUMBER(n))
+
+/* BFI_FMACHINE_SAMPLE(v, f, d)
+ *    v : portable
+ *    f : instruction
+ *    d : portable
+ *  Run the machine like BFI_FMACHINE_O, on the BFI_FLINEARS_* drivers.
+ *  Every time the machine suspends itself, which happens once every
+ *  BFI_LINEAR_DEPTH slow steps, (0sample(g, t)) is appended to the output
+ *  buffer, where 'g' is the instruction register and 't' is the
+ *  instruction word of the top frame. Counting the samples tells where a
+ *  long run spends its time, at the cost of one more copy of the A register
+ *  per suspension.
+ *
+ *  When the machine suspends itself, the A register must hold four
+ *  portables, as it does while BFI_EXEC runs a program, unless the
+ *  instruction register is 6stop. BFI_FMACHINE_SAMPLE can be nested inside
+ *  BFI_FMACHINE_O, but not inside another BFI_FMACHINE_SAMPLE.
+ */
+# define BFI_FMACHINE_SAMPLE(v, f, d) BFI_FMACHINE_SAMPLE_I(BFI_FMACHINE_PICK(), BFI_FMACHINE_START_K(S, v, f, d))
+# define BFI_FMACHINE_SAMPLE_I(k, z) BFI_FMACHINE_SAMPLE_II(k, z)
+# define BFI_FMACHINE_SAMPLE_II(k, z) BFI_LEFT(BFI_FMACHINE##k##_R(z))()
+
 /* Useful macros for writing instructions */
 
 # define BFI_RETURN ,
@@ -210,7 +333,7 @@
  * outp drv(a, inst, BFI_RETURN)p0, w0))p1, w1)) ... pN, 6stop))~, 6stack_error))~, 6bottom))
  *
  *  outp : recent addition to the output buffer
- *  drv : a linear driver macro, e.g. BFI_FLINEAR_123
+ *  drv : a linear driver macro, e.g. BFI_FLINEAR0_123
  *  a : A register contents, separated by commas
  *  inst : instruction reigster content
  *  p, w0 : top stack frame
@@ -224,7 +347,8 @@
  *
  * (inst)((entrance, a, p0, w0))(p1)(w1, p2) ... (6stop,~)(6stack_error,~)
  *
- * where 'entrance' is either BFI_FLINEAR_ENTRANCE_A or BFI_FLINEAR_ENTRANCE_B.
+ * where 'entrance' is either BFI_FLINEAR{K}_ENTRANCE_A or
+ * BFI_FLINEAR{K}_ENTRANCE_B.
  *
  * BFI_SETUP_REGS turns a portable representation into an active
  * representation. The active representation turns itself
@@ -238,137 +362,76 @@
  * it has ended. I'll refer to these forms as "intermediate results".
  */
 
-/* BFI_FCM_{INNER,OUTER}_*
- *  These macros are used to invoke BFI_FENTER_LINEAR up to (2**25-1) times
- *  until the execution stops. All these macros expands to an intermediate
- *  result. Of these macros, the ones with _C_ in the name takes a portable
- *  repsentation, and the ones with _I_ takes an intermediate result.
- *
- * BFI_FCM_OUTER_C_{N}(z)
+/*** Machine families
+ *
+ * All the macros that are being expanded while a machine is running come
+ * in BFI_MACHINE_FAMILIES copies, one per family. They are the linear
+ * drivers, the BFI_FCM{K}_* macros, and BFI_FMACHINE{K}_{O,V,R}, where {K}
+ * is the number of the family. A machine started from inside an instruction
+ * of another machine runs on a different family, so none of the macros it
+ * needs are disabled.
+ *
+ * BFI_FMACHINE_O and BFI_FMACHINE_V are object-like macros that expand to
+ * the function-like BFI_FMACHINE{K}_O or BFI_FMACHINE{K}_V of a free family.
+ * Because the arguments follow the expansion instead of being part of it,
+ * neither of them is still being expanded when the machine runs.
+ *
+ * BFI_FMACHINE_FREEP(k)
+ *  Expands to 1 if the family 'k' exists and no machine is running on it.
+ *  A running machine is always inside the expansion of
+ *  BFI_ENTER_LINEAR{K}, so we test whether that macro is expandable.
+ */
+# define BFI_FMACHINE_FAMILY(m) BFI_FMACHINE_FAMILY_I(m, BFI_FMACHINE_PICK())
+# define BFI_FMACHINE_FAMILY_I(m, k) BFI_FMACHINE_FAMILY_II(m, k)
+# define BFI_FMACHINE_FAMILY_II(m, k) BFI_FMACHINE##k##_##m
+# define BFI_FMACHINE_FREEP(k) BFI_NULLARYP(BFI_ENTER_LINEAR##k((BFI_FMACHINE_FREE_TEST)))
+# define BFI_FINST_BFI_FMACHINE_FREE_TEST ()
+
+/* BFI_FCM{K}_{INNER,OUTER}_*
+ *  These macros are used to invoke BFI_ENTER_LINEAR{K} up to
+ *  (2**BFI_MACHINE_LEVELS-1) times until the execution stops. All these macros
+ *  expands to an intermediate result. Of these macros, the ones with _C_ in
+ *  the name takes a portable repsentation, and the ones with _I_ takes an
+ *  intermediate result.
+ *
+ * BFI_FCM{K}_OUTER_C_{N}(z)
  *  Perform the rest of the computation and return the final result.
  *
- * BFI_FCM_INNER_C_{N}(z)
- *  Apply BFI_FENTER_LINAR at most (2**N) times and return the intermediate
- *  result.
- *
- * BFI_FCM_OUTER_C_{N}(x)
- *  Call BFI_FCM_OUTER_C_{N+1} if x is not a final state.
- *
- * BFI_FCM_INNER_C_{N}(x)
- *  Call BFI_FCM_INNER_C_{N} if x is not a final state.
+ * BFI_FCM{K}_INNER_C_{N}(z)
+ *  Apply BFI_ENTER_LINEAR{K} at most (2**N) times and return the
+ *  intermediate result.
+ *
+ * BFI_FCM{K}_OUTER_I_{N}(x)
+ *  Call BFI_FCM{K}_OUTER_C_{N+1} if x is not a final state.
+ *
+ * They are generated into levels.h, together with BFI_FMACHINE{K}_O,
+ * BFI_FMACHINE{K}_V and BFI_FMACHINE{K}_R.
+ *
+ * The inner levels do not nest, because a nested level would pass
+ * everything written to the output buffer below it as a macro argument.
+ * Instead, BFI_FCM{K}_INNER_C_{N} runs a chain of BFI_FCM{K}_STEP_A and
+ * BFI_FCM{K}_STEP_B on BFI_FMACHINE_FUEL_{N} followed by ",0)", in the same
+ * way as the accompanying macros run on the stack. Each step applies
+ * BFI_ENTER_LINEAR{K} once, leaves its output behind, and calls the other
+ * step macro, which takes the next ",E)" of the fuel as the end of its
+ * argument list. The step that takes the ",0)" is the last one.
+ *
+ * BFI_FMACHINE_FUEL_{N} is ",1),2) ... ,N)". Writing out all the (2**N-1)
+ * steps up front would take memory in proportion to the slice, so a ",E)"
+ * with E > 1 stands for 2**(E-1) steps: the step that takes it puts
+ * BFI_FMACHINE_FUEL_{E-1} in front of the rest of the fuel, through
+ * BFI_FCM{K}_STEP_A_REFILL_{E} or BFI_FCM{K}_STEP_B_REFILL_{E}. There is
+ * a pair of these for each E, so none of them is used again while the fuel
+ * it has put out is still being taken.
  */
-# define BFI_FCM_OUTER_C_0(z) BFI_FCM_OUTER_I_0(BFI_FCM_INNER_C_0(z))
-# define BFI_FCM_OUTER_C_1(z) BFI_FCM_OUTER_I_1(BFI_FCM_INNER_C_1(z))
-# define BFI_FCM_OUTER_C_2(z) BFI_FCM_OUTER_I_2(BFI_FCM_INNER_C_2(z))
-# define BFI_FCM_OUTER_C_3(z) BFI_FCM_OUTER_I_3(BFI_FCM_INNER_C_3(z))
-# define BFI_FCM_OUTER_C_4(z) BFI_FCM_OUTER_I_4(BFI_FCM_INNER_C_4(z))
-# define BFI_FCM_OUTER_C_5(z) BFI_FCM_OUTER_I_5(BFI_FCM_INNER_C_5(z))
-# define BFI_FCM_OUTER_C_6(z) BFI_FCM_OUTER_I_6(BFI_FCM_INNER_C_6(z))
-# define BFI_FCM_OUTER_C_7(z) BFI_FCM_OUTER_I_7(BFI_FCM_INNER_C_7(z))
-# define BFI_FCM_OUTER_C_8(z) BFI_FCM_OUTER_I_8(BFI_FCM_INNER_C_8(z))
-# define BFI_FCM_OUTER_C_9(z) BFI_FCM_OUTER_I_9(BFI_FCM_INNER_C_9(z))
-# define BFI_FCM_OUTER_C_10(z) BFI_FCM_OUTER_I_10(BFI_FCM_INNER_C_10(z))
-# define BFI_FCM_OUTER_C_11(z) BFI_FCM_OUTER_I_11(BFI_FCM_INNER_C_11(z))
-# define BFI_FCM_OUTER_C_12(z) BFI_FCM_OUTER_I_12(BFI_FCM_INNER_C_12(z))
-# define BFI_FCM_OUTER_C_13(z) BFI_FCM_OUTER_I_13(BFI_FCM_INNER_C_13(z))
-# define BFI_FCM_OUTER_C_14(z) BFI_FCM_OUTER_I_14(BFI_FCM_INNER_C_14(z))
-# define BFI_FCM_OUTER_C_15(z) BFI_FCM_OUTER_I_15(BFI_FCM_INNER_C_15(z))
-# define BFI_FCM_OUTER_C_16(z) BFI_FCM_OUTER_I_16(BFI_FCM_INNER_C_16(z))
-# define BFI_FCM_OUTER_C_17(z) BFI_FCM_OUTER_I_17(BFI_FCM_INNER_C_17(z))
-# define BFI_FCM_OUTER_C_18(z) BFI_FCM_OUTER_I_18(BFI_FCM_INNER_C_18(z))
-# define BFI_FCM_OUTER_C_19(z) BFI_FCM_OUTER_I_19(BFI_FCM_INNER_C_19(z))
-# define BFI_FCM_OUTER_C_20(z) BFI_FCM_OUTER_I_20(BFI_FCM_INNER_C_20(z))
-# define BFI_FCM_OUTER_C_21(z) BFI_FCM_OUTER_I_21(BFI_FCM_INNER_C_21(z))
-# define BFI_FCM_OUTER_C_22(z) BFI_FCM_OUTER_I_22(BFI_FCM_INNER_C_22(z))
-# define BFI_FCM_OUTER_C_23(z) BFI_FCM_OUTER_I_23(BFI_FCM_INNER_C_23(z))
-# define BFI_FCM_OUTER_C_24(z) BFI_FCM_OUTER_I_24(BFI_FCM_INNER_C_24(z))
-# define BFI_FCM_OUTER_C_25(z) BFI_EMPTY, 0)BFI_MACHINE_OVERFLOW():z
-
-/* If all the available execution steps are exhausted, abort by causing
- * a too-few-arguments error.
+
+/* If all the available execution steps or machine families are exhausted,
+ * abort by causing a too-few-arguments error.
  */
 # define BFI_MACHINE_OVERFLOW(a,b,c)
 
-# define BFI_FCM_INNER_C_0(z) BFI_ENTER_LINEAR(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END))
-# define BFI_FCM_INNER_C_1(z) BFI_FCM_INNER_I_0(BFI_FCM_INNER_C_0(z))
-# define BFI_FCM_INNER_C_2(z) BFI_FCM_INNER_I_1(BFI_FCM_INNER_C_1(z))
-# define BFI_FCM_INNER_C_3(z) BFI_FCM_INNER_I_2(BFI_FCM_INNER_C_2(z))
-# define BFI_FCM_INNER_C_4(z) BFI_FCM_INNER_I_3(BFI_FCM_INNER_C_3(z))
-# define BFI_FCM_INNER_C_5(z) BFI_FCM_INNER_I_4(BFI_FCM_INNER_C_4(z))
-# define BFI_FCM_INNER_C_6(z) BFI_FCM_INNER_I_5(BFI_FCM_INNER_C_5(z))
-# define BFI_FCM_INNER_C_7(z) BFI_FCM_INNER_I_6(BFI_FCM_INNER_C_6(z))
-# define BFI_FCM_INNER_C_8(z) BFI_FCM_INNER_I_7(BFI_FCM_INNER_C_7(z))
-# define BFI_FCM_INNER_C_9(z) BFI_FCM_INNER_I_8(BFI_FCM_INNER_C_8(z))
-# define BFI_FCM_INNER_C_10(z) BFI_FCM_INNER_I_9(BFI_FCM_INNER_C_9(z))
-# define BFI_FCM_INNER_C_11(z) BFI_FCM_INNER_I_10(BFI_FCM_INNER_C_10(z))
-# define BFI_FCM_INNER_C_12(z) BFI_FCM_INNER_I_11(BFI_FCM_INNER_C_11(z))
-# define BFI_FCM_INNER_C_13(z) BFI_FCM_INNER_I_12(BFI_FCM_INNER_C_12(z))
-# define BFI_FCM_INNER_C_14(z) BFI_FCM_INNER_I_13(BFI_FCM_INNER_C_13(z))
-# define BFI_FCM_INNER_C_15(z) BFI_FCM_INNER_I_14(BFI_FCM_INNER_C_14(z))
-# define BFI_FCM_INNER_C_16(z) BFI_FCM_INNER_I_15(BFI_FCM_INNER_C_15(z))
-# define BFI_FCM_INNER_C_17(z) BFI_FCM_INNER_I_16(BFI_FCM_INNER_C_16(z))
-# define BFI_FCM_INNER_C_18(z) BFI_FCM_INNER_I_17(BFI_FCM_INNER_C_17(z))
-# define BFI_FCM_INNER_C_19(z) BFI_FCM_INNER_I_18(BFI_FCM_INNER_C_18(z))
-# define BFI_FCM_INNER_C_20(z) BFI_FCM_INNER_I_19(BFI_FCM_INNER_C_19(z))
-# define BFI_FCM_INNER_C_21(z) BFI_FCM_INNER_I_20(BFI_FCM_INNER_C_20(z))
-# define BFI_FCM_INNER_C_22(z) BFI_FCM_INNER_I_21(BFI_FCM_INNER_C_21(z))
-# define BFI_FCM_INNER_C_23(z) BFI_FCM_INNER_I_22(BFI_FCM_INNER_C_22(z))
-# define BFI_FCM_INNER_C_24(z) BFI_FCM_INNER_I_23(BFI_FCM_INNER_C_23(z))
-
-# define BFI_FCM_OUTER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_1, x)
-# define BFI_FCM_OUTER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_2, x)
-# define BFI_FCM_OUTER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_3, x)
-# define BFI_FCM_OUTER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_4, x)
-# define BFI_FCM_OUTER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_5, x)
-# define BFI_FCM_OUTER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_6, x)
-# define BFI_FCM_OUTER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_7, x)
-# define BFI_FCM_OUTER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_8, x)
-# define BFI_FCM_OUTER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_9, x)
-# define BFI_FCM_OUTER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_10, x)
-# define BFI_FCM_OUTER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_11, x)
-# define BFI_FCM_OUTER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_12, x)
-# define BFI_FCM_OUTER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_13, x)
-# define BFI_FCM_OUTER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_14, x)
-# define BFI_FCM_OUTER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_15, x)
-# define BFI_FCM_OUTER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_16, x)
-# define BFI_FCM_OUTER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_17, x)
-# define BFI_FCM_OUTER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_18, x)
-# define BFI_FCM_OUTER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_19, x)
-# define BFI_FCM_OUTER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_20, x)
-# define BFI_FCM_OUTER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_21, x)
-# define BFI_FCM_OUTER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_22, x)
-# define BFI_FCM_OUTER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_23, x)
-# define BFI_FCM_OUTER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_24, x)
-# define BFI_FCM_OUTER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM_OUTER_C_25, x)
-
-# define BFI_FCM_INNER_I_0(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_0, x)
-# define BFI_FCM_INNER_I_1(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_1, x)
-# define BFI_FCM_INNER_I_2(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_2, x)
-# define BFI_FCM_INNER_I_3(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_3, x)
-# define BFI_FCM_INNER_I_4(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_4, x)
-# define BFI_FCM_INNER_I_5(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_5, x)
-# define BFI_FCM_INNER_I_6(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_6, x)
-# define BFI_FCM_INNER_I_7(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_7, x)
-# define BFI_FCM_INNER_I_8(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_8, x)
-# define BFI_FCM_INNER_I_9(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_9, x)
-# define BFI_FCM_INNER_I_10(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_10, x)
-# define BFI_FCM_INNER_I_11(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_11, x)
-# define BFI_FCM_INNER_I_12(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_12, x)
-# define BFI_FCM_INNER_I_13(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_13, x)
-# define BFI_FCM_INNER_I_14(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_14, x)
-# define BFI_FCM_INNER_I_15(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_15, x)
-# define BFI_FCM_INNER_I_16(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_16, x)
-# define BFI_FCM_INNER_I_17(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_17, x)
-# define BFI_FCM_INNER_I_18(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_18, x)
-# define BFI_FCM_INNER_I_19(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_19, x)
-# define BFI_FCM_INNER_I_20(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_20, x)
-# define BFI_FCM_INNER_I_21(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_21, x)
-# define BFI_FCM_INNER_I_22(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_22, x)
-# define BFI_FCM_INNER_I_23(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_23, x)
-# define BFI_FCM_INNER_I_24(x) BFI_FMACHINE_RESUME(BFI_FCM_INNER_C_24, x)
-
 /* BFI_FMACHINE_RESUME(f, x)
- *    f : one of the BFI_FCM_*_C_* functions
+ *    f : one of the BFI_FCM{K}_OUTER_C_* functions
  *    x : intermediate result
  *  If x is a final state, it expands to x.
  *  Otherwise it calls f to continue execution.
@@ -382,11 +445,43 @@
 # define BFI_FMACHINE_RESUME_0(k) BFI_EMPTY, 0)BFI_REM
 # define BFI_FMACHINE_RESUME_1(k) k
 
-/* BFI_ENTER_LINEAR(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END))
+/* BFI_FMACHINE_FEED(k, e, o, d)
+ *    k : BFI_FCM{K}_STEP_A or BFI_FCM{K}_STEP_B, the step to take next
+ *    e : the E of the ",E)" the step has taken; 0 if this was the last
+ *        step
+ *    o : what the step has appended to the output buffer, followed by
+ *        BFI_EMPTY
+ *    d : 1 if the machine has been suspended, 0 if it has stopped
+ *  It is called as "BFI_FMACHINE_FEED(k, e, x", where x is the
+ *  intermediate result of the step, which supplies 'o', 'd' and the closing
+ *  parenthesis. Like BFI_FMACHINE_RESUME, it puts out the output and then
+ *  calls 'k' on the portable representation that follows x, but the
+ *  closing parenthesis of that call comes from the next ",E)" of the fuel.
+ *  If e is more than 1, BFI_FMACHINE_FEED_1{E}, generated into levels.h,
+ *  refills the fuel before that. If the machine has stopped, the rest of
+ *  the chain is skipped with BFI_FMACHINE_EAT_A. If this was the last step,
+ *  the intermediate result is left as it is.
+ *
+ * BFI_FMACHINE_EAT_A(r, e) ,E) ,E) ... ,0)
+ *  Expands to r.
+ */
+# define BFI_FMACHINE_FEED(k, e, o, d) o()BFI_FMACHINE_FEED_##d##e(k)
+# define BFI_FMACHINE_FEED_00(k) BFI_EMPTY, 0)
+# define BFI_FMACHINE_FEED_01(k) BFI_EMPTY, 0)BFI_FMACHINE_EAT_A(
+# define BFI_FMACHINE_FEED_10(k) BFI_EMPTY, 1)
+# define BFI_FMACHINE_FEED_11(k) k(
+# define BFI_FMACHINE_EAT_A(r, e) BFI_FMACHINE_EAT_A_##e(r)
+# define BFI_FMACHINE_EAT_B(r, e) BFI_FMACHINE_EAT_B_##e(r)
+# define BFI_FMACHINE_EAT_A_0(r) r
+# define BFI_FMACHINE_EAT_B_0(r) r
+# define BFI_FMACHINE_EAT_A_1(r) BFI_FMACHINE_EAT_B(r
+# define BFI_FMACHINE_EAT_B_1(r) BFI_FMACHINE_EAT_A(r
+
+/* BFI_ENTER_LINEAR{K}(BFI_SETUP_REGS z(6bottom, BFI_EASY_OPEN_CONT_END))
  *    z : portable representation
- *  Turns z into an active representation and run it at most 256 steps.
+ *  Turns z into an active representation and run it at most BFI_LINEAR_DEPTH
+ *  steps.
  */
-# define BFI_ENTER_LINEAR(r) BFI_ENTER_LINEAR_I r
 # define BFI_ENTER_LINEAR_I(f) BFI_FINST_##f
 # define BFI_SETUP_REGS(f) (f)BFI_SETUP_REGS_A
 # define BFI_SETUP_REGS_A(args) args)BFI_SETUP_REGS_B
@@ -401,290 +496,177 @@
 # define BFI_EASY_OPEN_CONT_NEXT BFI_PCAT(BFI_EASY_OPEN_CONT_,
 # define BFI_EASY_OPEN_CONT_END BFI_DEFER(BFI_EAT_2)(~
 
-/* BFI_FLINEAR_ENTRANCE_A
- * BFI_FLINEAR_ENTRANCE_B
- * BFI_FLINEAR_{N}
+/* BFI_FLINEAR{K}_ENTRANCE_A
+ * BFI_FLINEAR{K}_ENTRANCE_B
+ * BFI_FLINEAR{K}_{N}
  *  These are macros that are passed as the first argument to accompanying
- *  macros.
+ *  macros. They are generated into linear.h and the headers in linear/,
+ *  and there are BFI_LINEAR_DEPTH of them in each family. BFI_FLINEAR{K}_0
+ *  suspends the machine.
  */
-# define BFI_FLINEAR_ENTRANCE_A(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_254, v ds
-# define BFI_FLINEAR_ENTRANCE_B(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_254, v ds
-
-# define BFI_FLINEAR_256(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_255, v ds
-# define BFI_FLINEAR_255(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_254, v ds
-# define BFI_FLINEAR_254(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_253, v ds
-# define BFI_FLINEAR_253(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_252, v ds
-# define BFI_FLINEAR_252(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_251, v ds
-# define BFI_FLINEAR_251(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_250, v ds
-# define BFI_FLINEAR_250(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_249, v ds
-# define BFI_FLINEAR_249(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_248, v ds
-# define BFI_FLINEAR_248(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_247, v ds
-# define BFI_FLINEAR_247(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_246, v ds
-# define BFI_FLINEAR_246(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_245, v ds
-# define BFI_FLINEAR_245(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_244, v ds
-# define BFI_FLINEAR_244(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_243, v ds
-# define BFI_FLINEAR_243(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_242, v ds
-# define BFI_FLINEAR_242(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_241, v ds
-# define BFI_FLINEAR_241(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_240, v ds
-# define BFI_FLINEAR_240(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_239, v ds
-# define BFI_FLINEAR_239(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_238, v ds
-# define BFI_FLINEAR_238(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_237, v ds
-# define BFI_FLINEAR_237(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_236, v ds
-# define BFI_FLINEAR_236(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_235, v ds
-# define BFI_FLINEAR_235(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_234, v ds
-# define BFI_FLINEAR_234(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_233, v ds
-# define BFI_FLINEAR_233(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_232, v ds
-# define BFI_FLINEAR_232(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_231, v ds
-# define BFI_FLINEAR_231(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_230, v ds
-# define BFI_FLINEAR_230(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_229, v ds
-# define BFI_FLINEAR_229(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_228, v ds
-# define BFI_FLINEAR_228(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_227, v ds
-# define BFI_FLINEAR_227(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_226, v ds
-# define BFI_FLINEAR_226(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_225, v ds
-# define BFI_FLINEAR_225(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_224, v ds
-# define BFI_FLINEAR_224(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_223, v ds
-# define BFI_FLINEAR_223(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_222, v ds
-# define BFI_FLINEAR_222(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_221, v ds
-# define BFI_FLINEAR_221(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_220, v ds
-# define BFI_FLINEAR_220(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_219, v ds
-# define BFI_FLINEAR_219(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_218, v ds
-# define BFI_FLINEAR_218(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_217, v ds
-# define BFI_FLINEAR_217(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_216, v ds
-# define BFI_FLINEAR_216(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_215, v ds
-# define BFI_FLINEAR_215(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_214, v ds
-# define BFI_FLINEAR_214(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_213, v ds
-# define BFI_FLINEAR_213(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_212, v ds
-# define BFI_FLINEAR_212(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_211, v ds
-# define BFI_FLINEAR_211(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_210, v ds
-# define BFI_FLINEAR_210(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_209, v ds
-# define BFI_FLINEAR_209(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_208, v ds
-# define BFI_FLINEAR_208(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_207, v ds
-# define BFI_FLINEAR_207(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_206, v ds
-# define BFI_FLINEAR_206(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_205, v ds
-# define BFI_FLINEAR_205(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_204, v ds
-# define BFI_FLINEAR_204(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_203, v ds
-# define BFI_FLINEAR_203(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_202, v ds
-# define BFI_FLINEAR_202(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_201, v ds
-# define BFI_FLINEAR_201(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_200, v ds
-# define BFI_FLINEAR_200(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_199, v ds
-# define BFI_FLINEAR_199(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_198, v ds
-# define BFI_FLINEAR_198(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_197, v ds
-# define BFI_FLINEAR_197(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_196, v ds
-# define BFI_FLINEAR_196(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_195, v ds
-# define BFI_FLINEAR_195(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_194, v ds
-# define BFI_FLINEAR_194(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_193, v ds
-# define BFI_FLINEAR_193(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_192, v ds
-# define BFI_FLINEAR_192(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_191, v ds
-# define BFI_FLINEAR_191(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_190, v ds
-# define BFI_FLINEAR_190(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_189, v ds
-# define BFI_FLINEAR_189(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_188, v ds
-# define BFI_FLINEAR_188(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_187, v ds
-# define BFI_FLINEAR_187(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_186, v ds
-# define BFI_FLINEAR_186(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_185, v ds
-# define BFI_FLINEAR_185(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_184, v ds
-# define BFI_FLINEAR_184(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_183, v ds
-# define BFI_FLINEAR_183(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_182, v ds
-# define BFI_FLINEAR_182(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_181, v ds
-# define BFI_FLINEAR_181(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_180, v ds
-# define BFI_FLINEAR_180(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_179, v ds
-# define BFI_FLINEAR_179(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_178, v ds
-# define BFI_FLINEAR_178(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_177, v ds
-# define BFI_FLINEAR_177(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_176, v ds
-# define BFI_FLINEAR_176(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_175, v ds
-# define BFI_FLINEAR_175(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_174, v ds
-# define BFI_FLINEAR_174(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_173, v ds
-# define BFI_FLINEAR_173(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_172, v ds
-# define BFI_FLINEAR_172(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_171, v ds
-# define BFI_FLINEAR_171(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_170, v ds
-# define BFI_FLINEAR_170(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_169, v ds
-# define BFI_FLINEAR_169(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_168, v ds
-# define BFI_FLINEAR_168(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_167, v ds
-# define BFI_FLINEAR_167(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_166, v ds
-# define BFI_FLINEAR_166(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_165, v ds
-# define BFI_FLINEAR_165(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_164, v ds
-# define BFI_FLINEAR_164(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_163, v ds
-# define BFI_FLINEAR_163(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_162, v ds
-# define BFI_FLINEAR_162(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_161, v ds
-# define BFI_FLINEAR_161(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_160, v ds
-# define BFI_FLINEAR_160(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_159, v ds
-# define BFI_FLINEAR_159(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_158, v ds
-# define BFI_FLINEAR_158(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_157, v ds
-# define BFI_FLINEAR_157(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_156, v ds
-# define BFI_FLINEAR_156(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_155, v ds
-# define BFI_FLINEAR_155(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_154, v ds
-# define BFI_FLINEAR_154(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_153, v ds
-# define BFI_FLINEAR_153(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_152, v ds
-# define BFI_FLINEAR_152(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_151, v ds
-# define BFI_FLINEAR_151(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_150, v ds
-# define BFI_FLINEAR_150(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_149, v ds
-# define BFI_FLINEAR_149(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_148, v ds
-# define BFI_FLINEAR_148(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_147, v ds
-# define BFI_FLINEAR_147(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_146, v ds
-# define BFI_FLINEAR_146(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_145, v ds
-# define BFI_FLINEAR_145(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_144, v ds
-# define BFI_FLINEAR_144(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_143, v ds
-# define BFI_FLINEAR_143(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_142, v ds
-# define BFI_FLINEAR_142(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_141, v ds
-# define BFI_FLINEAR_141(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_140, v ds
-# define BFI_FLINEAR_140(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_139, v ds
-# define BFI_FLINEAR_139(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_138, v ds
-# define BFI_FLINEAR_138(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_137, v ds
-# define BFI_FLINEAR_137(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_136, v ds
-# define BFI_FLINEAR_136(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_135, v ds
-# define BFI_FLINEAR_135(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_134, v ds
-# define BFI_FLINEAR_134(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_133, v ds
-# define BFI_FLINEAR_133(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_132, v ds
-# define BFI_FLINEAR_132(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_131, v ds
-# define BFI_FLINEAR_131(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_130, v ds
-# define BFI_FLINEAR_130(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_129, v ds
-# define BFI_FLINEAR_129(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_128, v ds
-# define BFI_FLINEAR_128(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_127, v ds
-# define BFI_FLINEAR_127(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_126, v ds
-# define BFI_FLINEAR_126(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_125, v ds
-# define BFI_FLINEAR_125(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_124, v ds
-# define BFI_FLINEAR_124(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_123, v ds
-# define BFI_FLINEAR_123(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_122, v ds
-# define BFI_FLINEAR_122(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_121, v ds
-# define BFI_FLINEAR_121(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_120, v ds
-# define BFI_FLINEAR_120(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_119, v ds
-# define BFI_FLINEAR_119(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_118, v ds
-# define BFI_FLINEAR_118(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_117, v ds
-# define BFI_FLINEAR_117(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_116, v ds
-# define BFI_FLINEAR_116(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_115, v ds
-# define BFI_FLINEAR_115(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_114, v ds
-# define BFI_FLINEAR_114(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_113, v ds
-# define BFI_FLINEAR_113(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_112, v ds
-# define BFI_FLINEAR_112(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_111, v ds
-# define BFI_FLINEAR_111(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_110, v ds
-# define BFI_FLINEAR_110(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_109, v ds
-# define BFI_FLINEAR_109(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_108, v ds
-# define BFI_FLINEAR_108(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_107, v ds
-# define BFI_FLINEAR_107(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_106, v ds
-# define BFI_FLINEAR_106(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_105, v ds
-# define BFI_FLINEAR_105(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_104, v ds
-# define BFI_FLINEAR_104(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_103, v ds
-# define BFI_FLINEAR_103(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_102, v ds
-# define BFI_FLINEAR_102(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_101, v ds
-# define BFI_FLINEAR_101(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_100, v ds
-# define BFI_FLINEAR_100(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_99, v ds
-# define BFI_FLINEAR_99(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_98, v ds
-# define BFI_FLINEAR_98(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_97, v ds
-# define BFI_FLINEAR_97(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_96, v ds
-# define BFI_FLINEAR_96(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_95, v ds
-# define BFI_FLINEAR_95(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_94, v ds
-# define BFI_FLINEAR_94(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_93, v ds
-# define BFI_FLINEAR_93(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_92, v ds
-# define BFI_FLINEAR_92(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_91, v ds
-# define BFI_FLINEAR_91(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_90, v ds
-# define BFI_FLINEAR_90(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_89, v ds
-# define BFI_FLINEAR_89(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_88, v ds
-# define BFI_FLINEAR_88(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_87, v ds
-# define BFI_FLINEAR_87(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_86, v ds
-# define BFI_FLINEAR_86(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_85, v ds
-# define BFI_FLINEAR_85(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_84, v ds
-# define BFI_FLINEAR_84(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_83, v ds
-# define BFI_FLINEAR_83(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_82, v ds
-# define BFI_FLINEAR_82(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_81, v ds
-# define BFI_FLINEAR_81(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_80, v ds
-# define BFI_FLINEAR_80(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_79, v ds
-# define BFI_FLINEAR_79(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_78, v ds
-# define BFI_FLINEAR_78(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_77, v ds
-# define BFI_FLINEAR_77(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_76, v ds
-# define BFI_FLINEAR_76(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_75, v ds
-# define BFI_FLINEAR_75(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_74, v ds
-# define BFI_FLINEAR_74(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_73, v ds
-# define BFI_FLINEAR_73(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_72, v ds
-# define BFI_FLINEAR_72(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_71, v ds
-# define BFI_FLINEAR_71(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_70, v ds
-# define BFI_FLINEAR_70(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_69, v ds
-# define BFI_FLINEAR_69(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_68, v ds
-# define BFI_FLINEAR_68(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_67, v ds
-# define BFI_FLINEAR_67(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_66, v ds
-# define BFI_FLINEAR_66(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_65, v ds
-# define BFI_FLINEAR_65(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_64, v ds
-# define BFI_FLINEAR_64(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_63, v ds
-# define BFI_FLINEAR_63(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_62, v ds
-# define BFI_FLINEAR_62(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_61, v ds
-# define BFI_FLINEAR_61(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_60, v ds
-# define BFI_FLINEAR_60(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_59, v ds
-# define BFI_FLINEAR_59(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_58, v ds
-# define BFI_FLINEAR_58(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_57, v ds
-# define BFI_FLINEAR_57(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_56, v ds
-# define BFI_FLINEAR_56(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_55, v ds
-# define BFI_FLINEAR_55(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_54, v ds
-# define BFI_FLINEAR_54(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_53, v ds
-# define BFI_FLINEAR_53(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_52, v ds
-# define BFI_FLINEAR_52(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_51, v ds
-# define BFI_FLINEAR_51(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_50, v ds
-# define BFI_FLINEAR_50(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_49, v ds
-# define BFI_FLINEAR_49(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_48, v ds
-# define BFI_FLINEAR_48(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_47, v ds
-# define BFI_FLINEAR_47(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_46, v ds
-# define BFI_FLINEAR_46(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_45, v ds
-# define BFI_FLINEAR_45(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_44, v ds
-# define BFI_FLINEAR_44(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_43, v ds
-# define BFI_FLINEAR_43(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_42, v ds
-# define BFI_FLINEAR_42(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_41, v ds
-# define BFI_FLINEAR_41(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_40, v ds
-# define BFI_FLINEAR_40(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_39, v ds
-# define BFI_FLINEAR_39(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_38, v ds
-# define BFI_FLINEAR_38(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_37, v ds
-# define BFI_FLINEAR_37(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_36, v ds
-# define BFI_FLINEAR_36(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_35, v ds
-# define BFI_FLINEAR_35(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_34, v ds
-# define BFI_FLINEAR_34(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_33, v ds
-# define BFI_FLINEAR_33(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_32, v ds
-# define BFI_FLINEAR_32(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_31, v ds
-# define BFI_FLINEAR_31(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_30, v ds
-# define BFI_FLINEAR_30(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_29, v ds
-# define BFI_FLINEAR_29(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_28, v ds
-# define BFI_FLINEAR_28(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_27, v ds
-# define BFI_FLINEAR_27(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_26, v ds
-# define BFI_FLINEAR_26(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_25, v ds
-# define BFI_FLINEAR_25(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_24, v ds
-# define BFI_FLINEAR_24(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_23, v ds
-# define BFI_FLINEAR_23(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_22, v ds
-# define BFI_FLINEAR_22(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_21, v ds
-# define BFI_FLINEAR_21(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_20, v ds
-# define BFI_FLINEAR_20(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_19, v ds
-# define BFI_FLINEAR_19(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_18, v ds
-# define BFI_FLINEAR_18(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_17, v ds
-# define BFI_FLINEAR_17(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_16, v ds
-# define BFI_FLINEAR_16(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_15, v ds
-# define BFI_FLINEAR_15(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_14, v ds
-# define BFI_FLINEAR_14(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_13, v ds
-# define BFI_FLINEAR_13(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_12, v ds
-# define BFI_FLINEAR_12(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_11, v ds
-# define BFI_FLINEAR_11(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_10, v ds
-# define BFI_FLINEAR_10(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_9, v ds
-# define BFI_FLINEAR_9(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_8, v ds
-# define BFI_FLINEAR_8(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_7, v ds
-# define BFI_FLINEAR_7(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_6, v ds
-# define BFI_FLINEAR_6(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_5, v ds
-# define BFI_FLINEAR_5(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_4, v ds
-# define BFI_FLINEAR_4(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_3, v ds
-# define BFI_FLINEAR_3(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_2, v ds
-# define BFI_FLINEAR_2(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_1, v ds
-# define BFI_FLINEAR_1(v, f, ds) BFI_FINST_##f(BFI_FLINEAR_0, v ds
-# define BFI_FLINEAR_0(v, f, ds) BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(), v, BFI_CLEANUP_REST(~ds
 
 /* BFI_CLEANUP_REST(~, d_1, t_1)) d_2, t_2)) d_3, t_3)) ... d_N,6bottom))
  *  Expands to:
  *    d_1, t_1))(d_2)(t_2, d_3) ... (t_N, d_N)
+ *
+ *  This walks every frame at every suspension, but the few macro calls per
+ *  frame are cheap next to copying the frames themselves. The portable
+ *  representation is rescanned as a macro argument at every level of
+ *  BFI_FCM{K}_*, so the cost of a suspension follows the number of tokens on
+ *  the stack (such as the loop bodies kept by the frames of 6loop), not the
+ *  number of frames. Packing the lower frames into a single argument would
+ *  not make it cheaper.
  */
 # define BFI_CLEANUP_REST(_, d, t) d, t))(BFI_CLEANUP_REST_A(
 # define BFI_CLEANUP_REST_A() BFI_CLOSE_CONT(
 # define BFI_CLOSE_CONT(d, k) d)BFI_IFN(BFI_BOTTOM_TEST_##k)(BFI_EAT, BFI_CLOSE_CONT_NEXT)(k
 # define BFI_CLOSE_CONT_NEXT(k) (k,BFI_CLOSE_CONT(
 
-/* BFI_AVAILABLE_ENTRANCE()
- *  Returns either BFI_FLINEAR_ENTRANCE_A or BFI_FLINEAR_ENTRANCE_B, whichever
- *  is "free", i.e. expandable in the current context.
+/* BFI_AVAILABLE_ENTRANCE(k)
+ *  Returns either BFI_FLINEAR{K}_ENTRANCE_A or BFI_FLINEAR{K}_ENTRANCE_B,
+ *  whichever is "free", i.e. expandable in the current context.
+ *  BFI_FLINEAR{K}_ENTRANCE_TEST removes the (0slow(...)) that the counted
+ *  entrances put before the test instruction.
  */
-# define BFI_AVAILABLE_ENTRANCE() BFI_IF(BFI_NULLARYP(BFI_FLINEAR_ENTRANCE_A(~, BFI_AVAILABLE_ENTRANCE_TEST, BFI_RPAREN())))(BFI_FLINEAR_ENTRANCE_A, BFI_FLINEAR_ENTRANCE_B)
+# define BFI_AVAILABLE_ENTRANCE(k) BFI_IF(BFI_NULLARYP(BFI_FLINEAR##k##_ENTRANCE_TEST(BFI_FLINEAR##k##_ENTRANCE_A(~, BFI_AVAILABLE_ENTRANCE_TEST, BFI_RPAREN()))))(BFI_FLINEAR##k##_ENTRANCE_A, BFI_FLINEAR##k##_ENTRANCE_B)
 # define BFI_FINST_BFI_AVAILABLE_ENTRANCE_TEST ()
 # define BFI_AVAILABLE_ENTRANCE_TEST (
 
+/*** Counted runs
+ *
+ * BFI_FMACHINE_TALLY runs the counted machine on the BFI_FLINEARC_* drivers
+ * from inside an instruction of another machine, 6tally. Every step of
+ * 6tally runs one slice and gives its output to the tally macro. The items
+ * it keeps are passed to the output buffer of the outer machine, which gets
+ * (0tally(a)) with the final accumulator as its last item.
+ *
+ * The slices follow a plan, which starts as BFI_FMACHINE_LADDER_{N}, where N
+ * is BFI_MACHINE_LEVELS: the levels that BFI_FCM{K}_OUTER_C_0 goes through.
+ * A level up to 4 is run as a slice of that level (BFI_FMACHINE_TALLY_AT_*).
+ * A higher one is replaced by its two halves, so that the tally macro never
+ * gets more than a slice of level 4 at a time. When the plan runs out before
+ * the machine stops, the run has taken as many steps as BFI_FMACHINE_O
+ * allows, and it is aborted with BFI_MACHINE_OVERFLOW in the same way. That
+ * is expanded only once, as the argument of BFI_EAT; left in the output
+ * buffer, it would be reported again at every rescan.
+ *
+ * 6tally: quaternary instruction
+ *  The arguments are the portable representation of the counted machine,
+ *  the tally macro, the accumulator and the plan.
+ */
+# define BFI_FINST_6tally_start(f, z, d, t) f(z BFI_COMMA() BFI_REM_2 d BFI_COMMA() BFI_FMACHINE_TALLY_PLAN(BFI_MACHINE_LEVELS), 6tally, BFI_PASS_AUX d BFI_PUSH(t)
+# define BFI_FINST_6tally(f, z, k, a, p, d, t) BFI_FMACHINE_TALLY_PICK(f, z, k, a, d, t, BFI_FMACHINE_TALLY_HEAD p)
+# define BFI_FMACHINE_TALLY_PLAN(n) BFI_FMACHINE_TALLY_PLAN_I(n)
+# define BFI_FMACHINE_TALLY_PLAN_I(n) BFI_FMACHINE_LADDER_##n(0over)
+# define BFI_FMACHINE_TALLY_HEAD(e) e,
+# define BFI_FMACHINE_TALLY_PICK(f, z, k, a, d, t, r) BFI_FMACHINE_TALLY_PICK_I(f, z, k, a, d, t, r)
+# define BFI_FMACHINE_TALLY_PICK_I(f, z, k, a, d, t, e, p) BFI_SWITCH((BFI_FMACHINE_TALLY_AT_##e, BFI_FMACHINE_TALLY_HALVE))(f, z, k, a, d, t, e, p)
+# define BFI_FMACHINE_TALLY_AT_0 BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_SLICE)
+# define BFI_FMACHINE_TALLY_AT_1 BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_SLICE)
+# define BFI_FMACHINE_TALLY_AT_2 BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_SLICE)
+# define BFI_FMACHINE_TALLY_AT_3 BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_SLICE)
+# define BFI_FMACHINE_TALLY_AT_4 BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_SLICE)
+# define BFI_FMACHINE_TALLY_AT_0over BFI_TEST_SUCCESS(BFI_FMACHINE_TALLY_OVERFLOW)
+# define BFI_FMACHINE_TALLY_HALVE(f, z, k, a, d, t, e, p) f(z BFI_COMMA() k BFI_COMMA() a BFI_COMMA() BFI_FMACHINE_HALVE_##e p, 6tally, BFI_PASS_AUX d BFI_PUSH(t)
+# define BFI_FMACHINE_TALLY_OVERFLOW(f, z, k, a, d, t, e, p) BFI_FMACHINE_TALLY_ABORT(BFI_MACHINE_OVERFLOW())BFI_FMACHINE_TALLY_NEXT_0(a, f, k, p, d, t, ~)
+# define BFI_FMACHINE_TALLY_ABORT(x) BFI_EAT(x)
+# define BFI_FMACHINE_TALLY_SLICE(f, z, k, a, d, t, e, p) BFI_FMACHINE_TALLY_I(f, k, a, p, d, t, BFI_FMACHINE_SLICE_K(BFI_FMACHINE_PICK(), e, z))
+# define BFI_FMACHINE_TALLY_I(f, k, a, p, d, t, r) BFI_FMACHINE_TALLY_II(f, k, a, p, d, t, BFI_REM_3 r)
+# define BFI_FMACHINE_TALLY_II(f, k, a, p, d, t, r) BFI_FMACHINE_TALLY_III(f, k, a, p, d, t, r)
+# define BFI_FMACHINE_TALLY_III(f, k, a, p, d, t, c, o, z) k(BFI_FMACHINE_TALLY_NEXT_##c, a, o) f, k, p, d, t, z)
+# define BFI_FMACHINE_TALLY_NEXT_1(a, f, k, p, d, t, z) f(z BFI_COMMA() k BFI_COMMA() a BFI_COMMA() p, 6tally, BFI_PASS_AUX d BFI_PUSH(t)
+# define BFI_FMACHINE_TALLY_NEXT_0(a, f, k, p, d, t, z) (0tally(a))f(z, t, BFI_RETURN
+
+/* BFI_FMACHINE_TALLY_SPLIT(o)
+ *  Separate the (0tally(a)) item at the end of 'o' from the rest.
+ */
+# define BFI_FMACHINE_TALLY_SPLIT(o) BFI_FMACHINE_TALLY_SPLIT_I(BFI_SCAN_N(BFI_SEQ_FOR_EACH(BFI_FMACHINE_TALLY_SPLIT_OP, o, ~)))
+# define BFI_FMACHINE_TALLY_SPLIT_I(r) BFI_FMACHINE_TALLY_SPLIT_II(r)
+# define BFI_FMACHINE_TALLY_SPLIT_II(o, a) (o, a)
+# define BFI_FMACHINE_TALLY_SPLIT_OP(x, _) BFI_SWITCH((BFI_FMACHINE_TALLY_RESULT_##x, (x)))
+# define BFI_FMACHINE_TALLY_RESULT_0tally(a) BFI_TEST_SUCCESS(BFI_DEFER_1(BFI_FMACHINE_TALLY_TAIL)(a))
+# define BFI_FMACHINE_TALLY_TAIL(a) , a
+
+/* BFI_FMACHINE_COUNT(j, a, o)
+ *    j : macro
+ *    a : ternary tuple of counters (s, x, n)
+ *    o : sequence of unary tuples
+ *  The tally macro of BFI_FMACHINE_STATS. Expands to the items of 'o' other
+ *  than (0slow(g)) and (0fast(g)), followed by "j((s', x', n'),", where 's''
+ *  and 'x'' are 's' and 'x' increased by the number of (0slow(g)) and
+ *  (0fast(g)) items respectively, and 'n'' is 'n' increased by the number of
+ *  the other items.
+ */
+# define BFI_FMACHINE_COUNT(j, a, o) BFI_FMACHINE_COUNT_X(j, BFI_REM_3 a, o)
+# define BFI_FMACHINE_COUNT_X(j, r, o) BFI_FMACHINE_COUNT_I(j, r, BFI_SEQ_TO_GUIDE(o))
+# define BFI_FMACHINE_COUNT_I(j, s, x, n, g) BFI_FMACHINE_COUNT_GO(j, s, x, n, g
+# define BFI_FMACHINE_COUNT_GO(j, s, x, n, i, c) BFI_IF(c)(BFI_FMACHINE_COUNT_ITEM, BFI_FMACHINE_COUNT_END)(j, s, x, n, i
+# define BFI_FMACHINE_COUNT_ITEM(j, s, x, n, i) BFI_SWITCH((BFI_FMACHINE_TICK_##i, BFI_FMACHINE_COUNT_OTHER))(j, s, x, n, i)
+# define BFI_FMACHINE_COUNT_END(j, s, x, n, i) j((s, x, n),
+# define BFI_FMACHINE_COUNT_SLOW(j, s, x, n, i) BFI_FMACHINE_COUNT_GO(j, BFI_FMACHINE_INC(s), x, n,
+# define BFI_FMACHINE_COUNT_FAST(j, s, x, n, i) BFI_FMACHINE_COUNT_GO(j, s, BFI_FMACHINE_INC(x), n,
+# define BFI_FMACHINE_COUNT_OTHER(j, s, x, n, i) (i)BFI_FMACHINE_COUNT_GO(j, s, x, BFI_FMACHINE_INC(n),
+
+# define BFI_FMACHINE_TICK_0slow(g) BFI_TEST_SUCCESS(BFI_FMACHINE_COUNT_SLOW)
+# define BFI_FMACHINE_TICK_0fast(g) BFI_TEST_SUCCESS(BFI_FMACHINE_COUNT_FAST)
+
+/*** Sampled runs
+ *
+ * BFI_FMACHINE_SAMPLE_SUSPEND(f, (v), d, t)
+ *  The suspension of the BFI_FLINEARS_* drivers. BFI_FLINEARS_0 passes the
+ *  A register in parentheses, so the top frame (d, t) that follows it in the
+ *  active representation arrives as the last two arguments. The register is
+ *  opened again with BFI_REM_4, or with BFI_REM if 'f' is 6stop. Otherwise
+ *  this is BFI_FLINEAR{K}_0, preceded by the sample.
+ */
+# define BFI_FMACHINE_SAMPLE_SUSPEND(f, v, d, t) (0sample(f, t))BFI_EMPTY,1)(f)((BFI_AVAILABLE_ENTRANCE(S), BFI_FMACHINE_SAMPLE_OPEN(f) v, BFI_CLEANUP_REST(~, d, t)
+# define BFI_FMACHINE_SAMPLE_OPEN(f) BFI_IFN(BFI_FMACHINE_SAMPLE_ONE_##f)(BFI_REM, BFI_REM_4)
+# define BFI_FMACHINE_SAMPLE_ONE_6stop ()
+
+/* BFI_FMACHINE_INC(n)
+ *    n : counter
+ *  Increment a counter.
+ *
+ *  BFI_FMACHINE_INC((9)(9)()) => (0)(0)(1)()
+ */
+# define BFI_FMACHINE_INC(n) BFI_FMACHINE_INC_A n
+# define BFI_FMACHINE_INC_A(d) BFI_FMACHINE_INC_A_##d
+# define BFI_FMACHINE_INC_B(d) BFI_FMACHINE_INC_B_##d
+# define BFI_FMACHINE_INC_A_0 (1)
+# define BFI_FMACHINE_INC_A_1 (2)
+# define BFI_FMACHINE_INC_A_2 (3)
+# define BFI_FMACHINE_INC_A_3 (4)
+# define BFI_FMACHINE_INC_A_4 (5)
+# define BFI_FMACHINE_INC_A_5 (6)
+# define BFI_FMACHINE_INC_A_6 (7)
+# define BFI_FMACHINE_INC_A_7 (8)
+# define BFI_FMACHINE_INC_A_8 (9)
+# define BFI_FMACHINE_INC_A_9 (0)BFI_FMACHINE_INC_B
+# define BFI_FMACHINE_INC_A_ (1)()
+# define BFI_FMACHINE_INC_B_0 (1)
+# define BFI_FMACHINE_INC_B_1 (2)
+# define BFI_FMACHINE_INC_B_2 (3)
+# define BFI_FMACHINE_INC_B_3 (4)
+# define BFI_FMACHINE_INC_B_4 (5)
+# define BFI_FMACHINE_INC_B_5 (6)
+# define BFI_FMACHINE_INC_B_6 (7)
+# define BFI_FMACHINE_INC_B_7 (8)
+# define BFI_FMACHINE_INC_B_8 (9)
+# define BFI_FMACHINE_INC_B_9 (0)BFI_FMACHINE_INC_A
+# define BFI_FMACHINE_INC_B_ (1)()
+
+/* BFI_FMACHINE_NUMBER(n)
+ *    n : counter
+ *  Convert a counter to a pp-number.
+ *
+ *  BFI_FMACHINE_NUMBER((0)(0)(1)()) => 100
+ */
+# define BFI_FMACHINE_NUMBER(n) BFI_FMACHINE_NUMBER_I(BFI_SEQ_TO_GUIDE(n))
+# define BFI_FMACHINE_NUMBER_I(g) BFI_FMACHINE_NUMBER_GO(, g
+# define BFI_FMACHINE_NUMBER_GO(r, d, c) BFI_IF(c)(BFI_FMACHINE_NUMBER_NEXT, BFI_FMACHINE_NUMBER_END)(r, d
+# define BFI_FMACHINE_NUMBER_NEXT(r, d) BFI_FMACHINE_NUMBER_GO(BFI_PCAT(d, r),
+# define BFI_FMACHINE_NUMBER_END(r, d) r
+
 /* Internal instructions
  *
  * 6stop: terminate the machine
@@ -0,0 +1,1044 @@
+# ifndef BFI_MOVE_H
+# define BFI_MOVE_H
+
+/* generated by gen_move.hs */
+
+/* BFI_UNCONS_##n##l
+ * BFI_CONS_MANY_##n##7c(t, x0, ..., xm)
+ * BFI_CONS_MANY_##n##7z(_, x0, ..., xm)
+ *    n : octet, not 0x00, m = n - 1
+ *    l, t : octet-list
+ *    x0, ..., xm : octet
+ *  The tables behind BFI_MOVE_FORWARD in bfi.h.
+ *  BFI_UNCONS_##n##l expands to the first m items of 'l', a closing paren,
+ *  then the n-th item and the rest of 'l', separated by commas.
+ *  BFI_CONS_MANY_##n##7c pushes x0 to xm onto 't', in this order.
+ *  BFI_CONS_MANY_##n##7z does the same onto 7z, but drops leading zeros so
+ *  that the result stays canonical.
+ */
+
+# define BFI_UNCONS_0x017c(h, t) , h, t
+# define BFI_UNCONS_0x027c(h, t) h)BFI_UNCONS_0x01##t
+# define BFI_UNCONS_0x037c(h, t) h,BFI_UNCONS_0x02##t
+# define BFI_UNCONS_0x047c(h, t) h,BFI_UNCONS_0x03##t
+# define BFI_UNCONS_0x057c(h, t) h,BFI_UNCONS_0x04##t
+# define BFI_UNCONS_0x067c(h, t) h,BFI_UNCONS_0x05##t
+# define BFI_UNCONS_0x077c(h, t) h,BFI_UNCONS_0x06##t
+# define BFI_UNCONS_0x087c(h, t) h,BFI_UNCONS_0x07##t
+# define BFI_UNCONS_0x097c(h, t) h,BFI_UNCONS_0x08##t
+# define BFI_UNCONS_0x0a7c(h, t) h,BFI_UNCONS_0x09##t
+# define BFI_UNCONS_0x0b7c(h, t) h,BFI_UNCONS_0x0a##t
+# define BFI_UNCONS_0x0c7c(h, t) h,BFI_UNCONS_0x0b##t
+# define BFI_UNCONS_0x0d7c(h, t) h,BFI_UNCONS_0x0c##t
+# define BFI_UNCONS_0x0e7c(h, t) h,BFI_UNCONS_0x0d##t
+# define BFI_UNCONS_0x0f7c(h, t) h,BFI_UNCONS_0x0e##t
+# define BFI_UNCONS_0x107c(h, t) h,BFI_UNCONS_0x0f##t
+# define BFI_UNCONS_0x117c(h, t) h,BFI_UNCONS_0x10##t
+# define BFI_UNCONS_0x127c(h, t) h,BFI_UNCONS_0x11##t
+# define BFI_UNCONS_0x137c(h, t) h,BFI_UNCONS_0x12##t
+# define BFI_UNCONS_0x147c(h, t) h,BFI_UNCONS_0x13##t
+# define BFI_UNCONS_0x157c(h, t) h,BFI_UNCONS_0x14##t
+# define BFI_UNCONS_0x167c(h, t) h,BFI_UNCONS_0x15##t
+# define BFI_UNCONS_0x177c(h, t) h,BFI_UNCONS_0x16##t
+# define BFI_UNCONS_0x187c(h, t) h,BFI_UNCONS_0x17##t
+# define BFI_UNCONS_0x197c(h, t) h,BFI_UNCONS_0x18##t
+# define BFI_UNCONS_0x1a7c(h, t) h,BFI_UNCONS_0x19##t
+# define BFI_UNCONS_0x1b7c(h, t) h,BFI_UNCONS_0x1a##t
+# define BFI_UNCONS_0x1c7c(h, t) h,BFI_UNCONS_0x1b##t
+# define BFI_UNCONS_0x1d7c(h, t) h,BFI_UNCONS_0x1c##t
+# define BFI_UNCONS_0x1e7c(h, t) h,BFI_UNCONS_0x1d##t
+# define BFI_UNCONS_0x1f7c(h, t) h,BFI_UNCONS_0x1e##t
+# define BFI_UNCONS_0x207c(h, t) h,BFI_UNCONS_0x1f##t
+# define BFI_UNCONS_0x217c(h, t) h,BFI_UNCONS_0x20##t
+# define BFI_UNCONS_0x227c(h, t) h,BFI_UNCONS_0x21##t
+# define BFI_UNCONS_0x237c(h, t) h,BFI_UNCONS_0x22##t
+# define BFI_UNCONS_0x247c(h, t) h,BFI_UNCONS_0x23##t
+# define BFI_UNCONS_0x257c(h, t) h,BFI_UNCONS_0x24##t
+# define BFI_UNCONS_0x267c(h, t) h,BFI_UNCONS_0x25##t
+# define BFI_UNCONS_0x277c(h, t) h,BFI_UNCONS_0x26##t
+# define BFI_UNCONS_0x287c(h, t) h,BFI_UNCONS_0x27##t
+# define BFI_UNCONS_0x297c(h, t) h,BFI_UNCONS_0x28##t
+# define BFI_UNCONS_0x2a7c(h, t) h,BFI_UNCONS_0x29##t
+# define BFI_UNCONS_0x2b7c(h, t) h,BFI_UNCONS_0x2a##t
+# define BFI_UNCONS_0x2c7c(h, t) h,BFI_UNCONS_0x2b##t
+# define BFI_UNCONS_0x2d7c(h, t) h,BFI_UNCONS_0x2c##t
+# define BFI_UNCONS_0x2e7c(h, t) h,BFI_UNCONS_0x2d##t
+# define BFI_UNCONS_0x2f7c(h, t) h,BFI_UNCONS_0x2e##t
+# define BFI_UNCONS_0x307c(h, t) h,BFI_UNCONS_0x2f##t
+# define BFI_UNCONS_0x317c(h, t) h,BFI_UNCONS_0x30##t
+# define BFI_UNCONS_0x327c(h, t) h,BFI_UNCONS_0x31##t
+# define BFI_UNCONS_0x337c(h, t) h,BFI_UNCONS_0x32##t
+# define BFI_UNCONS_0x347c(h, t) h,BFI_UNCONS_0x33##t
+# define BFI_UNCONS_0x357c(h, t) h,BFI_UNCONS_0x34##t
+# define BFI_UNCONS_0x367c(h, t) h,BFI_UNCONS_0x35##t
+# define BFI_UNCONS_0x377c(h, t) h,BFI_UNCONS_0x36##t
+# define BFI_UNCONS_0x387c(h, t) h,BFI_UNCONS_0x37##t
+# define BFI_UNCONS_0x397c(h, t) h,BFI_UNCONS_0x38##t
+# define BFI_UNCONS_0x3a7c(h, t) h,BFI_UNCONS_0x39##t
+# define BFI_UNCONS_0x3b7c(h, t) h,BFI_UNCONS_0x3a##t
+# define BFI_UNCONS_0x3c7c(h, t) h,BFI_UNCONS_0x3b##t
+# define BFI_UNCONS_0x3d7c(h, t) h,BFI_UNCONS_0x3c##t
+# define BFI_UNCONS_0x3e7c(h, t) h,BFI_UNCONS_0x3d##t
+# define BFI_UNCONS_0x3f7c(h, t) h,BFI_UNCONS_0x3e##t
+# define BFI_UNCONS_0x407c(h, t) h,BFI_UNCONS_0x3f##t
+# define BFI_UNCONS_0x417c(h, t) h,BFI_UNCONS_0x40##t
+# define BFI_UNCONS_0x427c(h, t) h,BFI_UNCONS_0x41##t
+# define BFI_UNCONS_0x437c(h, t) h,BFI_UNCONS_0x42##t
+# define BFI_UNCONS_0x447c(h, t) h,BFI_UNCONS_0x43##t
+# define BFI_UNCONS_0x457c(h, t) h,BFI_UNCONS_0x44##t
+# define BFI_UNCONS_0x467c(h, t) h,BFI_UNCONS_0x45##t
+# define BFI_UNCONS_0x477c(h, t) h,BFI_UNCONS_0x46##t
+# define BFI_UNCONS_0x487c(h, t) h,BFI_UNCONS_0x47##t
+# define BFI_UNCONS_0x497c(h, t) h,BFI_UNCONS_0x48##t
+# define BFI_UNCONS_0x4a7c(h, t) h,BFI_UNCONS_0x49##t
+# define BFI_UNCONS_0x4b7c(h, t) h,BFI_UNCONS_0x4a##t
+# define BFI_UNCONS_0x4c7c(h, t) h,BFI_UNCONS_0x4b##t
+# define BFI_UNCONS_0x4d7c(h, t) h,BFI_UNCONS_0x4c##t
+# define BFI_UNCONS_0x4e7c(h, t) h,BFI_UNCONS_0x4d##t
+# define BFI_UNCONS_0x4f7c(h, t) h,BFI_UNCONS_0x4e##t
+# define BFI_UNCONS_0x507c(h, t) h,BFI_UNCONS_0x4f##t
+# define BFI_UNCONS_0x517c(h, t) h,BFI_UNCONS_0x50##t
+# define BFI_UNCONS_0x527c(h, t) h,BFI_UNCONS_0x51##t
+# define BFI_UNCONS_0x537c(h, t) h,BFI_UNCONS_0x52##t
+# define BFI_UNCONS_0x547c(h, t) h,BFI_UNCONS_0x53##t
+# define BFI_UNCONS_0x557c(h, t) h,BFI_UNCONS_0x54##t
+# define BFI_UNCONS_0x567c(h, t) h,BFI_UNCONS_0x55##t
+# define BFI_UNCONS_0x577c(h, t) h,BFI_UNCONS_0x56##t
+# define BFI_UNCONS_0x587c(h, t) h,BFI_UNCONS_0x57##t
+# define BFI_UNCONS_0x597c(h, t) h,BFI_UNCONS_0x58##t
+# define BFI_UNCONS_0x5a7c(h, t) h,BFI_UNCONS_0x59##t
+# define BFI_UNCONS_0x5b7c(h, t) h,BFI_UNCONS_0x5a##t
+# define BFI_UNCONS_0x5c7c(h, t) h,BFI_UNCONS_0x5b##t
+# define BFI_UNCONS_0x5d7c(h, t) h,BFI_UNCONS_0x5c##t
+# define BFI_UNCONS_0x5e7c(h, t) h,BFI_UNCONS_0x5d##t
+# define BFI_UNCONS_0x5f7c(h, t) h,BFI_UNCONS_0x5e##t
+# define BFI_UNCONS_0x607c(h, t) h,BFI_UNCONS_0x5f##t
+# define BFI_UNCONS_0x617c(h, t) h,BFI_UNCONS_0x60##t
+# define BFI_UNCONS_0x627c(h, t) h,BFI_UNCONS_0x61##t
+# define BFI_UNCONS_0x637c(h, t) h,BFI_UNCONS_0x62##t
+# define BFI_UNCONS_0x647c(h, t) h,BFI_UNCONS_0x63##t
+# define BFI_UNCONS_0x657c(h, t) h,BFI_UNCONS_0x64##t
+# define BFI_UNCONS_0x667c(h, t) h,BFI_UNCONS_0x65##t
+# define BFI_UNCONS_0x677c(h, t) h,BFI_UNCONS_0x66##t
+# define BFI_UNCONS_0x687c(h, t) h,BFI_UNCONS_0x67##t
+# define BFI_UNCONS_0x697c(h, t) h,BFI_UNCONS_0x68##t
+# define BFI_UNCONS_0x6a7c(h, t) h,BFI_UNCONS_0x69##t
+# define BFI_UNCONS_0x6b7c(h, t) h,BFI_UNCONS_0x6a##t
+# define BFI_UNCONS_0x6c7c(h, t) h,BFI_UNCONS_0x6b##t
+# define BFI_UNCONS_0x6d7c(h, t) h,BFI_UNCONS_0x6c##t
+# define BFI_UNCONS_0x6e7c(h, t) h,BFI_UNCONS_0x6d##t
+# define BFI_UNCONS_0x6f7c(h, t) h,BFI_UNCONS_0x6e##t
+# define BFI_UNCONS_0x707c(h, t) h,BFI_UNCONS_0x6f##t
+# define BFI_UNCONS_0x717c(h, t) h,BFI_UNCONS_0x70##t
+# define BFI_UNCONS_0x727c(h, t) h,BFI_UNCONS_0x71##t
+# define BFI_UNCONS_0x737c(h, t) h,BFI_UNCONS_0x72##t
+# define BFI_UNCONS_0x747c(h, t) h,BFI_UNCONS_0x73##t
+# define BFI_UNCONS_0x757c(h, t) h,BFI_UNCONS_0x74##t
+# define BFI_UNCONS_0x767c(h, t) h,BFI_UNCONS_0x75##t
+# define BFI_UNCONS_0x777c(h, t) h,BFI_UNCONS_0x76##t
+# define BFI_UNCONS_0x787c(h, t) h,BFI_UNCONS_0x77##t
+# define BFI_UNCONS_0x797c(h, t) h,BFI_UNCONS_0x78##t
+# define BFI_UNCONS_0x7a7c(h, t) h,BFI_UNCONS_0x79##t
+# define BFI_UNCONS_0x7b7c(h, t) h,BFI_UNCONS_0x7a##t
+# define BFI_UNCONS_0x7c7c(h, t) h,BFI_UNCONS_0x7b##t
+# define BFI_UNCONS_0x7d7c(h, t) h,BFI_UNCONS_0x7c##t
+# define BFI_UNCONS_0x7e7c(h, t) h,BFI_UNCONS_0x7d##t
+# define BFI_UNCONS_0x7f7c(h, t) h,BFI_UNCONS_0x7e##t
+# define BFI_UNCONS_0x807c(h, t) h,BFI_UNCONS_0x7f##t
+# define BFI_UNCONS_0x817c(h, t) h,BFI_UNCONS_0x80##t
+# define BFI_UNCONS_0x827c(h, t) h,BFI_UNCONS_0x81##t
+# define BFI_UNCONS_0x837c(h, t) h,BFI_UNCONS_0x82##t
+# define BFI_UNCONS_0x847c(h, t) h,BFI_UNCONS_0x83##t
+# define BFI_UNCONS_0x857c(h, t) h,BFI_UNCONS_0x84##t
+# define BFI_UNCONS_0x867c(h, t) h,BFI_UNCONS_0x85##t
+# define BFI_UNCONS_0x877c(h, t) h,BFI_UNCONS_0x86##t
+# define BFI_UNCONS_0x887c(h, t) h,BFI_UNCONS_0x87##t
+# define BFI_UNCONS_0x897c(h, t) h,BFI_UNCONS_0x88##t
+# define BFI_UNCONS_0x8a7c(h, t) h,BFI_UNCONS_0x89##t
+# define BFI_UNCONS_0x8b7c(h, t) h,BFI_UNCONS_0x8a##t
+# define BFI_UNCONS_0x8c7c(h, t) h,BFI_UNCONS_0x8b##t
+# define BFI_UNCONS_0x8d7c(h, t) h,BFI_UNCONS_0x8c##t
+# define BFI_UNCONS_0x8e7c(h, t) h,BFI_UNCONS_0x8d##t
+# define BFI_UNCONS_0x8f7c(h, t) h,BFI_UNCONS_0x8e##t
+# define BFI_UNCONS_0x907c(h, t) h,BFI_UNCONS_0x8f##t
+# define BFI_UNCONS_0x917c(h, t) h,BFI_UNCONS_0x90##t
+# define BFI_UNCONS_0x927c(h, t) h,BFI_UNCONS_0x91##t
+# define BFI_UNCONS_0x937c(h, t) h,BFI_UNCONS_0x92##t
+# define BFI_UNCONS_0x947c(h, t) h,BFI_UNCONS_0x93##t
+# define BFI_UNCONS_0x957c(h, t) h,BFI_UNCONS_0x94##t
+# define BFI_UNCONS_0x967c(h, t) h,BFI_UNCONS_0x95##t
+# define BFI_UNCONS_0x977c(h, t) h,BFI_UNCONS_0x96##t
+# define BFI_UNCONS_0x987c(h, t) h,BFI_UNCONS_0x97##t
+# define BFI_UNCONS_0x997c(h, t) h,BFI_UNCONS_0x98##t
+# define BFI_UNCONS_0x9a7c(h, t) h,BFI_UNCONS_0x99##t
+# define BFI_UNCONS_0x9b7c(h, t) h,BFI_UNCONS_0x9a##t
+# define BFI_UNCONS_0x9c7c(h, t) h,BFI_UNCONS_0x9b##t
+# define BFI_UNCONS_0x9d7c(h, t) h,BFI_UNCONS_0x9c##t
+# define BFI_UNCONS_0x9e7c(h, t) h,BFI_UNCONS_0x9d##t
+# define BFI_UNCONS_0x9f7c(h, t) h,BFI_UNCONS_0x9e##t
+# define BFI_UNCONS_0xa07c(h, t) h,BFI_UNCONS_0x9f##t
+# define BFI_UNCONS_0xa17c(h, t) h,BFI_UNCONS_0xa0##t
+# define BFI_UNCONS_0xa27c(h, t) h,BFI_UNCONS_0xa1##t
+# define BFI_UNCONS_0xa37c(h, t) h,BFI_UNCONS_0xa2##t
+# define BFI_UNCONS_0xa47c(h, t) h,BFI_UNCONS_0xa3##t
+# define BFI_UNCONS_0xa57c(h, t) h,BFI_UNCONS_0xa4##t
+# define BFI_UNCONS_0xa67c(h, t) h,BFI_UNCONS_0xa5##t
+# define BFI_UNCONS_0xa77c(h, t) h,BFI_UNCONS_0xa6##t
+# define BFI_UNCONS_0xa87c(h, t) h,BFI_UNCONS_0xa7##t
+# define BFI_UNCONS_0xa97c(h, t) h,BFI_UNCONS_0xa8##t
+# define BFI_UNCONS_0xaa7c(h, t) h,BFI_UNCONS_0xa9##t
+# define BFI_UNCONS_0xab7c(h, t) h,BFI_UNCONS_0xaa##t
+# define BFI_UNCONS_0xac7c(h, t) h,BFI_UNCONS_0xab##t
+# define BFI_UNCONS_0xad7c(h, t) h,BFI_UNCONS_0xac##t
+# define BFI_UNCONS_0xae7c(h, t) h,BFI_UNCONS_0xad##t
+# define BFI_UNCONS_0xaf7c(h, t) h,BFI_UNCONS_0xae##t
+# define BFI_UNCONS_0xb07c(h, t) h,BFI_UNCONS_0xaf##t
+# define BFI_UNCONS_0xb17c(h, t) h,BFI_UNCONS_0xb0##t
+# define BFI_UNCONS_0xb27c(h, t) h,BFI_UNCONS_0xb1##t
+# define BFI_UNCONS_0xb37c(h, t) h,BFI_UNCONS_0xb2##t
+# define BFI_UNCONS_0xb47c(h, t) h,BFI_UNCONS_0xb3##t
+# define BFI_UNCONS_0xb57c(h, t) h,BFI_UNCONS_0xb4##t
+# define BFI_UNCONS_0xb67c(h, t) h,BFI_UNCONS_0xb5##t
+# define BFI_UNCONS_0xb77c(h, t) h,BFI_UNCONS_0xb6##t
+# define BFI_UNCONS_0xb87c(h, t) h,BFI_UNCONS_0xb7##t
+# define BFI_UNCONS_0xb97c(h, t) h,BFI_UNCONS_0xb8##t
+# define BFI_UNCONS_0xba7c(h, t) h,BFI_UNCONS_0xb9##t
+# define BFI_UNCONS_0xbb7c(h, t) h,BFI_UNCONS_0xba##t
+# define BFI_UNCONS_0xbc7c(h, t) h,BFI_UNCONS_0xbb##t
+# define BFI_UNCONS_0xbd7c(h, t) h,BFI_UNCONS_0xbc##t
+# define BFI_UNCONS_0xbe7c(h, t) h,BFI_UNCONS_0xbd##t
+# define BFI_UNCONS_0xbf7c(h, t) h,BFI_UNCONS_0xbe##t
+# define BFI_UNCONS_0xc07c(h, t) h,BFI_UNCONS_0xbf##t
+# define BFI_UNCONS_0xc17c(h, t) h,BFI_UNCONS_0xc0##t
+# define BFI_UNCONS_0xc27c(h, t) h,BFI_UNCONS_0xc1##t
+# define BFI_UNCONS_0xc37c(h, t) h,BFI_UNCONS_0xc2##t
+# define BFI_UNCONS_0xc47c(h, t) h,BFI_UNCONS_0xc3##t
+# define BFI_UNCONS_0xc57c(h, t) h,BFI_UNCONS_0xc4##t
+# define BFI_UNCONS_0xc67c(h, t) h,BFI_UNCONS_0xc5##t
+# define BFI_UNCONS_0xc77c(h, t) h,BFI_UNCONS_0xc6##t
+# define BFI_UNCONS_0xc87c(h, t) h,BFI_UNCONS_0xc7##t
+# define BFI_UNCONS_0xc97c(h, t) h,BFI_UNCONS_0xc8##t
+# define BFI_UNCONS_0xca7c(h, t) h,BFI_UNCONS_0xc9##t
+# define BFI_UNCONS_0xcb7c(h, t) h,BFI_UNCONS_0xca##t
+# define BFI_UNCONS_0xcc7c(h, t) h,BFI_UNCONS_0xcb##t
+# define BFI_UNCONS_0xcd7c(h, t) h,BFI_UNCONS_0xcc##t
+# define BFI_UNCONS_0xce7c(h, t) h,BFI_UNCONS_0xcd##t
+# define BFI_UNCONS_0xcf7c(h, t) h,BFI_UNCONS_0xce##t
+# define BFI_UNCONS_0xd07c(h, t) h,BFI_UNCONS_0xcf##t
+# define BFI_UNCONS_0xd17c(h, t) h,BFI_UNCONS_0xd0##t
+# define BFI_UNCONS_0xd27c(h, t) h,BFI_UNCONS_0xd1##t
+# define BFI_UNCONS_0xd37c(h, t) h,BFI_UNCONS_0xd2##t
+# define BFI_UNCONS_0xd47c(h, t) h,BFI_UNCONS_0xd3##t
+# define BFI_UNCONS_0xd57c(h, t) h,BFI_UNCONS_0xd4##t
+# define BFI_UNCONS_0xd67c(h, t) h,BFI_UNCONS_0xd5##t
+# define BFI_UNCONS_0xd77c(h, t) h,BFI_UNCONS_0xd6##t
+# define BFI_UNCONS_0xd87c(h, t) h,BFI_UNCONS_0xd7##t
+# define BFI_UNCONS_0xd97c(h, t) h,BFI_UNCONS_0xd8##t
+# define BFI_UNCONS_0xda7c(h, t) h,BFI_UNCONS_0xd9##t
+# define BFI_UNCONS_0xdb7c(h, t) h,BFI_UNCONS_0xda##t
+# define BFI_UNCONS_0xdc7c(h, t) h,BFI_UNCONS_0xdb##t
+# define BFI_UNCONS_0xdd7c(h, t) h,BFI_UNCONS_0xdc##t
+# define BFI_UNCONS_0xde7c(h, t) h,BFI_UNCONS_0xdd##t
+# define BFI_UNCONS_0xdf7c(h, t) h,BFI_UNCONS_0xde##t
+# define BFI_UNCONS_0xe07c(h, t) h,BFI_UNCONS_0xdf##t
+# define BFI_UNCONS_0xe17c(h, t) h,BFI_UNCONS_0xe0##t
+# define BFI_UNCONS_0xe27c(h, t) h,BFI_UNCONS_0xe1##t
+# define BFI_UNCONS_0xe37c(h, t) h,BFI_UNCONS_0xe2##t
+# define BFI_UNCONS_0xe47c(h, t) h,BFI_UNCONS_0xe3##t
+# define BFI_UNCONS_0xe57c(h, t) h,BFI_UNCONS_0xe4##t
+# define BFI_UNCONS_0xe67c(h, t) h,BFI_UNCONS_0xe5##t
+# define BFI_UNCONS_0xe77c(h, t) h,BFI_UNCONS_0xe6##t
+# define BFI_UNCONS_0xe87c(h, t) h,BFI_UNCONS_0xe7##t
+# define BFI_UNCONS_0xe97c(h, t) h,BFI_UNCONS_0xe8##t
+# define BFI_UNCONS_0xea7c(h, t) h,BFI_UNCONS_0xe9##t
+# define BFI_UNCONS_0xeb7c(h, t) h,BFI_UNCONS_0xea##t
+# define BFI_UNCONS_0xec7c(h, t) h,BFI_UNCONS_0xeb##t
+# define BFI_UNCONS_0xed7c(h, t) h,BFI_UNCONS_0xec##t
+# define BFI_UNCONS_0xee7c(h, t) h,BFI_UNCONS_0xed##t
+# define BFI_UNCONS_0xef7c(h, t) h,BFI_UNCONS_0xee##t
+# define BFI_UNCONS_0xf07c(h, t) h,BFI_UNCONS_0xef##t
+# define BFI_UNCONS_0xf17c(h, t) h,BFI_UNCONS_0xf0##t
+# define BFI_UNCONS_0xf27c(h, t) h,BFI_UNCONS_0xf1##t
+# define BFI_UNCONS_0xf37c(h, t) h,BFI_UNCONS_0xf2##t
+# define BFI_UNCONS_0xf47c(h, t) h,BFI_UNCONS_0xf3##t
+# define BFI_UNCONS_0xf57c(h, t) h,BFI_UNCONS_0xf4##t
+# define BFI_UNCONS_0xf67c(h, t) h,BFI_UNCONS_0xf5##t
+# define BFI_UNCONS_0xf77c(h, t) h,BFI_UNCONS_0xf6##t
+# define BFI_UNCONS_0xf87c(h, t) h,BFI_UNCONS_0xf7##t
+# define BFI_UNCONS_0xf97c(h, t) h,BFI_UNCONS_0xf8##t
+# define BFI_UNCONS_0xfa7c(h, t) h,BFI_UNCONS_0xf9##t
+# define BFI_UNCONS_0xfb7c(h, t) h,BFI_UNCONS_0xfa##t
+# define BFI_UNCONS_0xfc7c(h, t) h,BFI_UNCONS_0xfb##t
+# define BFI_UNCONS_0xfd7c(h, t) h,BFI_UNCONS_0xfc##t
+# define BFI_UNCONS_0xfe7c(h, t) h,BFI_UNCONS_0xfd##t
+# define BFI_UNCONS_0xff7c(h, t) h,BFI_UNCONS_0xfe##t
+
+# define BFI_UNCONS_0x017z , 0x00, 7z
+# define BFI_UNCONS_0x027z 0x00), 0x00, 7z
+# define BFI_UNCONS_0x037z 0x00,BFI_UNCONS_0x027z
+# define BFI_UNCONS_0x047z 0x00,BFI_UNCONS_0x037z
+# define BFI_UNCONS_0x057z 0x00,BFI_UNCONS_0x047z
+# define BFI_UNCONS_0x067z 0x00,BFI_UNCONS_0x057z
+# define BFI_UNCONS_0x077z 0x00,BFI_UNCONS_0x067z
+# define BFI_UNCONS_0x087z 0x00,BFI_UNCONS_0x077z
+# define BFI_UNCONS_0x097z 0x00,BFI_UNCONS_0x087z
+# define BFI_UNCONS_0x0a7z 0x00,BFI_UNCONS_0x097z
+# define BFI_UNCONS_0x0b7z 0x00,BFI_UNCONS_0x0a7z
+# define BFI_UNCONS_0x0c7z 0x00,BFI_UNCONS_0x0b7z
+# define BFI_UNCONS_0x0d7z 0x00,BFI_UNCONS_0x0c7z
+# define BFI_UNCONS_0x0e7z 0x00,BFI_UNCONS_0x0d7z
+# define BFI_UNCONS_0x0f7z 0x00,BFI_UNCONS_0x0e7z
+# define BFI_UNCONS_0x107z 0x00,BFI_UNCONS_0x0f7z
+# define BFI_UNCONS_0x117z 0x00,BFI_UNCONS_0x107z
+# define BFI_UNCONS_0x127z 0x00,BFI_UNCONS_0x117z
+# define BFI_UNCONS_0x137z 0x00,BFI_UNCONS_0x127z
+# define BFI_UNCONS_0x147z 0x00,BFI_UNCONS_0x137z
+# define BFI_UNCONS_0x157z 0x00,BFI_UNCONS_0x147z
+# define BFI_UNCONS_0x167z 0x00,BFI_UNCONS_0x157z
+# define BFI_UNCONS_0x177z 0x00,BFI_UNCONS_0x167z
+# define BFI_UNCONS_0x187z 0x00,BFI_UNCONS_0x177z
+# define BFI_UNCONS_0x197z 0x00,BFI_UNCONS_0x187z
+# define BFI_UNCONS_0x1a7z 0x00,BFI_UNCONS_0x197z
+# define BFI_UNCONS_0x1b7z 0x00,BFI_UNCONS_0x1a7z
+# define BFI_UNCONS_0x1c7z 0x00,BFI_UNCONS_0x1b7z
+# define BFI_UNCONS_0x1d7z 0x00,BFI_UNCONS_0x1c7z
+# define BFI_UNCONS_0x1e7z 0x00,BFI_UNCONS_0x1d7z
+# define BFI_UNCONS_0x1f7z 0x00,BFI_UNCONS_0x1e7z
+# define BFI_UNCONS_0x207z 0x00,BFI_UNCONS_0x1f7z
+# define BFI_UNCONS_0x217z 0x00,BFI_UNCONS_0x207z
+# define BFI_UNCONS_0x227z 0x00,BFI_UNCONS_0x217z
+# define BFI_UNCONS_0x237z 0x00,BFI_UNCONS_0x227z
+# define BFI_UNCONS_0x247z 0x00,BFI_UNCONS_0x237z
+# define BFI_UNCONS_0x257z 0x00,BFI_UNCONS_0x247z
+# define BFI_UNCONS_0x267z 0x00,BFI_UNCONS_0x257z
+# define BFI_UNCONS_0x277z 0x00,BFI_UNCONS_0x267z
+# define BFI_UNCONS_0x287z 0x00,BFI_UNCONS_0x277z
+# define BFI_UNCONS_0x297z 0x00,BFI_UNCONS_0x287z
+# define BFI_UNCONS_0x2a7z 0x00,BFI_UNCONS_0x297z
+# define BFI_UNCONS_0x2b7z 0x00,BFI_UNCONS_0x2a7z
+# define BFI_UNCONS_0x2c7z 0x00,BFI_UNCONS_0x2b7z
+# define BFI_UNCONS_0x2d7z 0x00,BFI_UNCONS_0x2c7z
+# define BFI_UNCONS_0x2e7z 0x00,BFI_UNCONS_0x2d7z
+# define BFI_UNCONS_0x2f7z 0x00,BFI_UNCONS_0x2e7z
+# define BFI_UNCONS_0x307z 0x00,BFI_UNCONS_0x2f7z
+# define BFI_UNCONS_0x317z 0x00,BFI_UNCONS_0x307z
+# define BFI_UNCONS_0x327z 0x00,BFI_UNCONS_0x317z
+# define BFI_UNCONS_0x337z 0x00,BFI_UNCONS_0x327z
+# define BFI_UNCONS_0x347z 0x00,BFI_UNCONS_0x337z
+# define BFI_UNCONS_0x357z 0x00,BFI_UNCONS_0x347z
+# define BFI_UNCONS_0x367z 0x00,BFI_UNCONS_0x357z
+# define BFI_UNCONS_0x377z 0x00,BFI_UNCONS_0x367z
+# define BFI_UNCONS_0x387z 0x00,BFI_UNCONS_0x377z
+# define BFI_UNCONS_0x397z 0x00,BFI_UNCONS_0x387z
+# define BFI_UNCONS_0x3a7z 0x00,BFI_UNCONS_0x397z
+# define BFI_UNCONS_0x3b7z 0x00,BFI_UNCONS_0x3a7z
+# define BFI_UNCONS_0x3c7z 0x00,BFI_UNCONS_0x3b7z
+# define BFI_UNCONS_0x3d7z 0x00,BFI_UNCONS_0x3c7z
+# define BFI_UNCONS_0x3e7z 0x00,BFI_UNCONS_0x3d7z
+# define BFI_UNCONS_0x3f7z 0x00,BFI_UNCONS_0x3e7z
+# define BFI_UNCONS_0x407z 0x00,BFI_UNCONS_0x3f7z
+# define BFI_UNCONS_0x417z 0x00,BFI_UNCONS_0x407z
+# define BFI_UNCONS_0x427z 0x00,BFI_UNCONS_0x417z
+# define BFI_UNCONS_0x437z 0x00,BFI_UNCONS_0x427z
+# define BFI_UNCONS_0x447z 0x00,BFI_UNCONS_0x437z
+# define BFI_UNCONS_0x457z 0x00,BFI_UNCONS_0x447z
+# define BFI_UNCONS_0x467z 0x00,BFI_UNCONS_0x457z
+# define BFI_UNCONS_0x477z 0x00,BFI_UNCONS_0x467z
+# define BFI_UNCONS_0x487z 0x00,BFI_UNCONS_0x477z
+# define BFI_UNCONS_0x497z 0x00,BFI_UNCONS_0x487z
+# define BFI_UNCONS_0x4a7z 0x00,BFI_UNCONS_0x497z
+# define BFI_UNCONS_0x4b7z 0x00,BFI_UNCONS_0x4a7z
+# define BFI_UNCONS_0x4c7z 0x00,BFI_UNCONS_0x4b7z
+# define BFI_UNCONS_0x4d7z 0x00,BFI_UNCONS_0x4c7z
+# define BFI_UNCONS_0x4e7z 0x00,BFI_UNCONS_0x4d7z
+# define BFI_UNCONS_0x4f7z 0x00,BFI_UNCONS_0x4e7z
+# define BFI_UNCONS_0x507z 0x00,BFI_UNCONS_0x4f7z
+# define BFI_UNCONS_0x517z 0x00,BFI_UNCONS_0x507z
+# define BFI_UNCONS_0x527z 0x00,BFI_UNCONS_0x517z
+# define BFI_UNCONS_0x537z 0x00,BFI_UNCONS_0x527z
+# define BFI_UNCONS_0x547z 0x00,BFI_UNCONS_0x537z
+# define BFI_UNCONS_0x557z 0x00,BFI_UNCONS_0x547z
+# define BFI_UNCONS_0x567z 0x00,BFI_UNCONS_0x557z
+# define BFI_UNCONS_0x577z 0x00,BFI_UNCONS_0x567z
+# define BFI_UNCONS_0x587z 0x00,BFI_UNCONS_0x577z
+# define BFI_UNCONS_0x597z 0x00,BFI_UNCONS_0x587z
+# define BFI_UNCONS_0x5a7z 0x00,BFI_UNCONS_0x597z
+# define BFI_UNCONS_0x5b7z 0x00,BFI_UNCONS_0x5a7z
+# define BFI_UNCONS_0x5c7z 0x00,BFI_UNCONS_0x5b7z
+# define BFI_UNCONS_0x5d7z 0x00,BFI_UNCONS_0x5c7z
+# define BFI_UNCONS_0x5e7z 0x00,BFI_UNCONS_0x5d7z
+# define BFI_UNCONS_0x5f7z 0x00,BFI_UNCONS_0x5e7z
+# define BFI_UNCONS_0x607z 0x00,BFI_UNCONS_0x5f7z
+# define BFI_UNCONS_0x617z 0x00,BFI_UNCONS_0x607z
+# define BFI_UNCONS_0x627z 0x00,BFI_UNCONS_0x617z
+# define BFI_UNCONS_0x637z 0x00,BFI_UNCONS_0x627z
+# define BFI_UNCONS_0x647z 0x00,BFI_UNCONS_0x637z
+# define BFI_UNCONS_0x657z 0x00,BFI_UNCONS_0x647z
+# define BFI_UNCONS_0x667z 0x00,BFI_UNCONS_0x657z
+# define BFI_UNCONS_0x677z 0x00,BFI_UNCONS_0x667z
+# define BFI_UNCONS_0x687z 0x00,BFI_UNCONS_0x677z
+# define BFI_UNCONS_0x697z 0x00,BFI_UNCONS_0x687z
+# define BFI_UNCONS_0x6a7z 0x00,BFI_UNCONS_0x697z
+# define BFI_UNCONS_0x6b7z 0x00,BFI_UNCONS_0x6a7z
+# define BFI_UNCONS_0x6c7z 0x00,BFI_UNCONS_0x6b7z
+# define BFI_UNCONS_0x6d7z 0x00,BFI_UNCONS_0x6c7z
+# define BFI_UNCONS_0x6e7z 0x00,BFI_UNCONS_0x6d7z
+# define BFI_UNCONS_0x6f7z 0x00,BFI_UNCONS_0x6e7z
+# define BFI_UNCONS_0x707z 0x00,BFI_UNCONS_0x6f7z
+# define BFI_UNCONS_0x717z 0x00,BFI_UNCONS_0x707z
+# define BFI_UNCONS_0x727z 0x00,BFI_UNCONS_0x717z
+# define BFI_UNCONS_0x737z 0x00,BFI_UNCONS_0x727z
+# define BFI_UNCONS_0x747z 0x00,BFI_UNCONS_0x737z
+# define BFI_UNCONS_0x757z 0x00,BFI_UNCONS_0x747z
+# define BFI_UNCONS_0x767z 0x00,BFI_UNCONS_0x757z
+# define BFI_UNCONS_0x777z 0x00,BFI_UNCONS_0x767z
+# define BFI_UNCONS_0x787z 0x00,BFI_UNCONS_0x777z
+# define BFI_UNCONS_0x797z 0x00,BFI_UNCONS_0x787z
+# define BFI_UNCONS_0x7a7z 0x00,BFI_UNCONS_0x797z
+# define BFI_UNCONS_0x7b7z 0x00,BFI_UNCONS_0x7a7z
+# define BFI_UNCONS_0x7c7z 0x00,BFI_UNCONS_0x7b7z
+# define BFI_UNCONS_0x7d7z 0x00,BFI_UNCONS_0x7c7z
+# define BFI_UNCONS_0x7e7z 0x00,BFI_UNCONS_0x7d7z
+# define BFI_UNCONS_0x7f7z 0x00,BFI_UNCONS_0x7e7z
+# define BFI_UNCONS_0x807z 0x00,BFI_UNCONS_0x7f7z
+# define BFI_UNCONS_0x817z 0x00,BFI_UNCONS_0x807z
+# define BFI_UNCONS_0x827z 0x00,BFI_UNCONS_0x817z
+# define BFI_UNCONS_0x837z 0x00,BFI_UNCONS_0x827z
+# define BFI_UNCONS_0x847z 0x00,BFI_UNCONS_0x837z
+# define BFI_UNCONS_0x857z 0x00,BFI_UNCONS_0x847z
+# define BFI_UNCONS_0x867z 0x00,BFI_UNCONS_0x857z
+# define BFI_UNCONS_0x877z 0x00,BFI_UNCONS_0x867z
+# define BFI_UNCONS_0x887z 0x00,BFI_UNCONS_0x877z
+# define BFI_UNCONS_0x897z 0x00,BFI_UNCONS_0x887z
+# define BFI_UNCONS_0x8a7z 0x00,BFI_UNCONS_0x897z
+# define BFI_UNCONS_0x8b7z 0x00,BFI_UNCONS_0x8a7z
+# define BFI_UNCONS_0x8c7z 0x00,BFI_UNCONS_0x8b7z
+# define BFI_UNCONS_0x8d7z 0x00,BFI_UNCONS_0x8c7z
+# define BFI_UNCONS_0x8e7z 0x00,BFI_UNCONS_0x8d7z
+# define BFI_UNCONS_0x8f7z 0x00,BFI_UNCONS_0x8e7z
+# define BFI_UNCONS_0x907z 0x00,BFI_UNCONS_0x8f7z
+# define BFI_UNCONS_0x917z 0x00,BFI_UNCONS_0x907z
+# define BFI_UNCONS_0x927z 0x00,BFI_UNCONS_0x917z
+# define BFI_UNCONS_0x937z 0x00,BFI_UNCONS_0x927z
+# define BFI_UNCONS_0x947z 0x00,BFI_UNCONS_0x937z
+# define BFI_UNCONS_0x957z 0x00,BFI_UNCONS_0x947z
+# define BFI_UNCONS_0x967z 0x00,BFI_UNCONS_0x957z
+# define BFI_UNCONS_0x977z 0x00,BFI_UNCONS_0x967z
+# define BFI_UNCONS_0x987z 0x00,BFI_UNCONS_0x977z
+# define BFI_UNCONS_0x997z 0x00,BFI_UNCONS_0x987z
+# define BFI_UNCONS_0x9a7z 0x00,BFI_UNCONS_0x997z
+# define BFI_UNCONS_0x9b7z 0x00,BFI_UNCONS_0x9a7z
+# define BFI_UNCONS_0x9c7z 0x00,BFI_UNCONS_0x9b7z
+# define BFI_UNCONS_0x9d7z 0x00,BFI_UNCONS_0x9c7z
+# define BFI_UNCONS_0x9e7z 0x00,BFI_UNCONS_0x9d7z
+# define BFI_UNCONS_0x9f7z 0x00,BFI_UNCONS_0x9e7z
+# define BFI_UNCONS_0xa07z 0x00,BFI_UNCONS_0x9f7z
+# define BFI_UNCONS_0xa17z 0x00,BFI_UNCONS_0xa07z
+# define BFI_UNCONS_0xa27z 0x00,BFI_UNCONS_0xa17z
+# define BFI_UNCONS_0xa37z 0x00,BFI_UNCONS_0xa27z
+# define BFI_UNCONS_0xa47z 0x00,BFI_UNCONS_0xa37z
+# define BFI_UNCONS_0xa57z 0x00,BFI_UNCONS_0xa47z
+# define BFI_UNCONS_0xa67z 0x00,BFI_UNCONS_0xa57z
+# define BFI_UNCONS_0xa77z 0x00,BFI_UNCONS_0xa67z
+# define BFI_UNCONS_0xa87z 0x00,BFI_UNCONS_0xa77z
+# define BFI_UNCONS_0xa97z 0x00,BFI_UNCONS_0xa87z
+# define BFI_UNCONS_0xaa7z 0x00,BFI_UNCONS_0xa97z
+# define BFI_UNCONS_0xab7z 0x00,BFI_UNCONS_0xaa7z
+# define BFI_UNCONS_0xac7z 0x00,BFI_UNCONS_0xab7z
+# define BFI_UNCONS_0xad7z 0x00,BFI_UNCONS_0xac7z
+# define BFI_UNCONS_0xae7z 0x00,BFI_UNCONS_0xad7z
+# define BFI_UNCONS_0xaf7z 0x00,BFI_UNCONS_0xae7z
+# define BFI_UNCONS_0xb07z 0x00,BFI_UNCONS_0xaf7z
+# define BFI_UNCONS_0xb17z 0x00,BFI_UNCONS_0xb07z
+# define BFI_UNCONS_0xb27z 0x00,BFI_UNCONS_0xb17z
+# define BFI_UNCONS_0xb37z 0x00,BFI_UNCONS_0xb27z
+# define BFI_UNCONS_0xb47z 0x00,BFI_UNCONS_0xb37z
+# define BFI_UNCONS_0xb57z 0x00,BFI_UNCONS_0xb47z
+# define BFI_UNCONS_0xb67z 0x00,BFI_UNCONS_0xb57z
+# define BFI_UNCONS_0xb77z 0x00,BFI_UNCONS_0xb67z
+# define BFI_UNCONS_0xb87z 0x00,BFI_UNCONS_0xb77z
+# define BFI_UNCONS_0xb97z 0x00,BFI_UNCONS_0xb87z
+# define BFI_UNCONS_0xba7z 0x00,BFI_UNCONS_0xb97z
+# define BFI_UNCONS_0xbb7z 0x00,BFI_UNCONS_0xba7z
+# define BFI_UNCONS_0xbc7z 0x00,BFI_UNCONS_0xbb7z
+# define BFI_UNCONS_0xbd7z 0x00,BFI_UNCONS_0xbc7z
+# define BFI_UNCONS_0xbe7z 0x00,BFI_UNCONS_0xbd7z
+# define BFI_UNCONS_0xbf7z 0x00,BFI_UNCONS_0xbe7z
+# define BFI_UNCONS_0xc07z 0x00,BFI_UNCONS_0xbf7z
+# define BFI_UNCONS_0xc17z 0x00,BFI_UNCONS_0xc07z
+# define BFI_UNCONS_0xc27z 0x00,BFI_UNCONS_0xc17z
+# define BFI_UNCONS_0xc37z 0x00,BFI_UNCONS_0xc27z
+# define BFI_UNCONS_0xc47z 0x00,BFI_UNCONS_0xc37z
+# define BFI_UNCONS_0xc57z 0x00,BFI_UNCONS_0xc47z
+# define BFI_UNCONS_0xc67z 0x00,BFI_UNCONS_0xc57z
+# define BFI_UNCONS_0xc77z 0x00,BFI_UNCONS_0xc67z
+# define BFI_UNCONS_0xc87z 0x00,BFI_UNCONS_0xc77z
+# define BFI_UNCONS_0xc97z 0x00,BFI_UNCONS_0xc87z
+# define BFI_UNCONS_0xca7z 0x00,BFI_UNCONS_0xc97z
+# define BFI_UNCONS_0xcb7z 0x00,BFI_UNCONS_0xca7z
+# define BFI_UNCONS_0xcc7z 0x00,BFI_UNCONS_0xcb7z
+# define BFI_UNCONS_0xcd7z 0x00,BFI_UNCONS_0xcc7z
+# define BFI_UNCONS_0xce7z 0x00,BFI_UNCONS_0xcd7z
+# define BFI_UNCONS_0xcf7z 0x00,BFI_UNCONS_0xce7z
+# define BFI_UNCONS_0xd07z 0x00,BFI_UNCONS_0xcf7z
+# define BFI_UNCONS_0xd17z 0x00,BFI_UNCONS_0xd07z
+# define BFI_UNCONS_0xd27z 0x00,BFI_UNCONS_0xd17z
+# define BFI_UNCONS_0xd37z 0x00,BFI_UNCONS_0xd27z
+# define BFI_UNCONS_0xd47z 0x00,BFI_UNCONS_0xd37z
+# define BFI_UNCONS_0xd57z 0x00,BFI_UNCONS_0xd47z
+# define BFI_UNCONS_0xd67z 0x00,BFI_UNCONS_0xd57z
+# define BFI_UNCONS_0xd77z 0x00,BFI_UNCONS_0xd67z
+# define BFI_UNCONS_0xd87z 0x00,BFI_UNCONS_0xd77z
+# define BFI_UNCONS_0xd97z 0x00,BFI_UNCONS_0xd87z
+# define BFI_UNCONS_0xda7z 0x00,BFI_UNCONS_0xd97z
+# define BFI_UNCONS_0xdb7z 0x00,BFI_UNCONS_0xda7z
+# define BFI_UNCONS_0xdc7z 0x00,BFI_UNCONS_0xdb7z
+# define BFI_UNCONS_0xdd7z 0x00,BFI_UNCONS_0xdc7z
+# define BFI_UNCONS_0xde7z 0x00,BFI_UNCONS_0xdd7z
+# define BFI_UNCONS_0xdf7z 0x00,BFI_UNCONS_0xde7z
+# define BFI_UNCONS_0xe07z 0x00,BFI_UNCONS_0xdf7z
+# define BFI_UNCONS_0xe17z 0x00,BFI_UNCONS_0xe07z
+# define BFI_UNCONS_0xe27z 0x00,BFI_UNCONS_0xe17z
+# define BFI_UNCONS_0xe37z 0x00,BFI_UNCONS_0xe27z
+# define BFI_UNCONS_0xe47z 0x00,BFI_UNCONS_0xe37z
+# define BFI_UNCONS_0xe57z 0x00,BFI_UNCONS_0xe47z
+# define BFI_UNCONS_0xe67z 0x00,BFI_UNCONS_0xe57z
+# define BFI_UNCONS_0xe77z 0x00,BFI_UNCONS_0xe67z
+# define BFI_UNCONS_0xe87z 0x00,BFI_UNCONS_0xe77z
+# define BFI_UNCONS_0xe97z 0x00,BFI_UNCONS_0xe87z
+# define BFI_UNCONS_0xea7z 0x00,BFI_UNCONS_0xe97z
+# define BFI_UNCONS_0xeb7z 0x00,BFI_UNCONS_0xea7z
+# define BFI_UNCONS_0xec7z 0x00,BFI_UNCONS_0xeb7z
+# define BFI_UNCONS_0xed7z 0x00,BFI_UNCONS_0xec7z
+# define BFI_UNCONS_0xee7z 0x00,BFI_UNCONS_0xed7z
+# define BFI_UNCONS_0xef7z 0x00,BFI_UNCONS_0xee7z
+# define BFI_UNCONS_0xf07z 0x00,BFI_UNCONS_0xef7z
+# define BFI_UNCONS_0xf17z 0x00,BFI_UNCONS_0xf07z
+# define BFI_UNCONS_0xf27z 0x00,BFI_UNCONS_0xf17z
+# define BFI_UNCONS_0xf37z 0x00,BFI_UNCONS_0xf27z
+# define BFI_UNCONS_0xf47z 0x00,BFI_UNCONS_0xf37z
+# define BFI_UNCONS_0xf57z 0x00,BFI_UNCONS_0xf47z
+# define BFI_UNCONS_0xf67z 0x00,BFI_UNCONS_0xf57z
+# define BFI_UNCONS_0xf77z 0x00,BFI_UNCONS_0xf67z
+# define BFI_UNCONS_0xf87z 0x00,BFI_UNCONS_0xf77z
+# define BFI_UNCONS_0xf97z 0x00,BFI_UNCONS_0xf87z
+# define BFI_UNCONS_0xfa7z 0x00,BFI_UNCONS_0xf97z
+# define BFI_UNCONS_0xfb7z 0x00,BFI_UNCONS_0xfa7z
+# define BFI_UNCONS_0xfc7z 0x00,BFI_UNCONS_0xfb7z
+# define BFI_UNCONS_0xfd7z 0x00,BFI_UNCONS_0xfc7z
+# define BFI_UNCONS_0xfe7z 0x00,BFI_UNCONS_0xfd7z
+# define BFI_UNCONS_0xff7z 0x00,BFI_UNCONS_0xfe7z
+
+# define BFI_CONS_MANY_0x017c(t, x0) 7c(x0,t)
+# define BFI_CONS_MANY_0x027c(t, x0, x1) 7c(x1,7c(x0,t))
+# define BFI_CONS_MANY_0x037c(t, x0, x1, x2) 7c(x2,7c(x1,7c(x0,t)))
+# define BFI_CONS_MANY_0x047c(t, x0, x1, x2, x3) 7c(x3,7c(x2,7c(x1,7c(x0,t))))
+# define BFI_CONS_MANY_0x057c(t, x0, x1, x2, x3, x4) 7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))
+# define BFI_CONS_MANY_0x067c(t, x0, x1, x2, x3, x4, x5) 7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))
+# define BFI_CONS_MANY_0x077c(t, x0, x1, x2, x3, x4, x5, x6) 7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))
+# define BFI_CONS_MANY_0x087c(t, x0, x1, x2, x3, x4, x5, x6, x7) 7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))
+# define BFI_CONS_MANY_0x097c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8) 7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))
+# define BFI_CONS_MANY_0x0a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9) 7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))
+# define BFI_CONS_MANY_0x0b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10) 7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))
+# define BFI_CONS_MANY_0x0c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11) 7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))
+# define BFI_CONS_MANY_0x0d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12) 7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))
+# define BFI_CONS_MANY_0x0e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13) 7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))
+# define BFI_CONS_MANY_0x0f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14) 7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))
+# define BFI_CONS_MANY_0x107c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) 7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))
+# define BFI_CONS_MANY_0x117c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16) 7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))
+# define BFI_CONS_MANY_0x127c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17) 7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))
+# define BFI_CONS_MANY_0x137c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18) 7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))
+# define BFI_CONS_MANY_0x147c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19) 7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))
+# define BFI_CONS_MANY_0x157c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20) 7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))
+# define BFI_CONS_MANY_0x167c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21) 7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))
+# define BFI_CONS_MANY_0x177c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22) 7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))
+# define BFI_CONS_MANY_0x187c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23) 7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x197c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24) 7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25) 7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26) 7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27) 7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28) 7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29) 7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x1f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30) 7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x207c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31) 7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x217c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32) 7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x227c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33) 7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x237c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34) 7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x247c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35) 7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x257c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36) 7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x267c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37) 7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x277c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38) 7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x287c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39) 7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x297c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40) 7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41) 7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42) 7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43) 7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44) 7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45) 7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x2f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46) 7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x307c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47) 7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x317c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48) 7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x327c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49) 7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x337c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50) 7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x347c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51) 7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x357c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52) 7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x367c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53) 7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x377c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54) 7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x387c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55) 7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x397c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56) 7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57) 7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58) 7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59) 7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60) 7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61) 7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x3f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62) 7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x407c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63) 7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x417c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64) 7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x427c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65) 7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x437c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66) 7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x447c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67) 7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x457c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68) 7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x467c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69) 7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x477c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70) 7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x487c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71) 7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x497c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72) 7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73) 7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74) 7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75) 7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76) 7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77) 7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x4f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78) 7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x507c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79) 7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x517c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80) 7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x527c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81) 7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x537c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82) 7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x547c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83) 7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x557c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84) 7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x567c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85) 7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x577c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86) 7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x587c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87) 7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x597c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88) 7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89) 7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90) 7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91) 7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92) 7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93) 7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x5f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94) 7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x607c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95) 7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x617c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96) 7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x627c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97) 7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x637c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98) 7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x647c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99) 7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x657c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100) 7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x667c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101) 7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x677c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102) 7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x687c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103) 7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x697c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104) 7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105) 7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106) 7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107) 7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108) 7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109) 7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x6f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110) 7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x707c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111) 7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x717c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112) 7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x727c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113) 7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x737c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114) 7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x747c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115) 7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x757c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116) 7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x767c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117) 7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x777c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118) 7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x787c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119) 7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x797c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120) 7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121) 7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122) 7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123) 7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124) 7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125) 7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x7f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126) 7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x807c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127) 7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x817c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128) 7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x827c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129) 7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x837c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130) 7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x847c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131) 7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x857c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132) 7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x867c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133) 7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x877c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134) 7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x887c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135) 7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x897c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136) 7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137) 7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138) 7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139) 7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140) 7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141) 7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x8f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142) 7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x907c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143) 7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x917c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144) 7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x927c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145) 7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x937c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146) 7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x947c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147) 7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x957c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148) 7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x967c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149) 7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x977c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150) 7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x987c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151) 7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x997c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152) 7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9a7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153) 7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9b7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154) 7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9c7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155) 7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9d7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156) 7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9e7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157) 7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0x9f7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158) 7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159) 7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160) 7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161) 7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162) 7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163) 7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164) 7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165) 7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166) 7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167) 7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xa97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168) 7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xaa7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169) 7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xab7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170) 7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xac7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171) 7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xad7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172) 7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xae7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173) 7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xaf7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174) 7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175) 7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176) 7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177) 7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178) 7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179) 7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180) 7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181) 7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182) 7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183) 7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xb97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184) 7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xba7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185) 7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xbb7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186) 7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xbc7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187) 7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xbd7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188) 7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xbe7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189) 7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xbf7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190) 7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191) 7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192) 7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193) 7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194) 7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195) 7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196) 7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197) 7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198) 7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199) 7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xc97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200) 7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xca7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201) 7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xcb7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202) 7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xcc7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203) 7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xcd7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204) 7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xce7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205) 7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xcf7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206) 7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207) 7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208) 7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209) 7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210) 7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211) 7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212) 7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213) 7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214) 7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215) 7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xd97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216) 7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xda7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217) 7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xdb7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218) 7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xdc7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219) 7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xdd7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220) 7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xde7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221) 7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xdf7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222) 7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223) 7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224) 7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225) 7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226) 7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227) 7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228) 7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229) 7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230) 7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231) 7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xe97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232) 7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xea7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233) 7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xeb7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234) 7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xec7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235) 7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xed7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236) 7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xee7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237) 7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xef7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238) 7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf07c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239) 7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf17c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240) 7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf27c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241) 7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf37c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242) 7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf47c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243) 7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf57c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244) 7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf67c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245) 7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf77c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246) 7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf87c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247) 7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xf97c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248) 7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xfa7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249) 7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xfb7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250) 7c(x250,7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xfc7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251) 7c(x251,7c(x250,7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xfd7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252) 7c(x252,7c(x251,7c(x250,7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xfe7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253) 7c(x253,7c(x252,7c(x251,7c(x250,7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+# define BFI_CONS_MANY_0xff7c(t, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253, x254) 7c(x254,7c(x253,7c(x252,7c(x251,7c(x250,7c(x249,7c(x248,7c(x247,7c(x246,7c(x245,7c(x244,7c(x243,7c(x242,7c(x241,7c(x240,7c(x239,7c(x238,7c(x237,7c(x236,7c(x235,7c(x234,7c(x233,7c(x232,7c(x231,7c(x230,7c(x229,7c(x228,7c(x227,7c(x226,7c(x225,7c(x224,7c(x223,7c(x222,7c(x221,7c(x220,7c(x219,7c(x218,7c(x217,7c(x216,7c(x215,7c(x214,7c(x213,7c(x212,7c(x211,7c(x210,7c(x209,7c(x208,7c(x207,7c(x206,7c(x205,7c(x204,7c(x203,7c(x202,7c(x201,7c(x200,7c(x199,7c(x198,7c(x197,7c(x196,7c(x195,7c(x194,7c(x193,7c(x192,7c(x191,7c(x190,7c(x189,7c(x188,7c(x187,7c(x186,7c(x185,7c(x184,7c(x183,7c(x182,7c(x181,7c(x180,7c(x179,7c(x178,7c(x177,7c(x176,7c(x175,7c(x174,7c(x173,7c(x172,7c(x171,7c(x170,7c(x169,7c(x168,7c(x167,7c(x166,7c(x165,7c(x164,7c(x163,7c(x162,7c(x161,7c(x160,7c(x159,7c(x158,7c(x157,7c(x156,7c(x155,7c(x154,7c(x153,7c(x152,7c(x151,7c(x150,7c(x149,7c(x148,7c(x147,7c(x146,7c(x145,7c(x144,7c(x143,7c(x142,7c(x141,7c(x140,7c(x139,7c(x138,7c(x137,7c(x136,7c(x135,7c(x134,7c(x133,7c(x132,7c(x131,7c(x130,7c(x129,7c(x128,7c(x127,7c(x126,7c(x125,7c(x124,7c(x123,7c(x122,7c(x121,7c(x120,7c(x119,7c(x118,7c(x117,7c(x116,7c(x115,7c(x114,7c(x113,7c(x112,7c(x111,7c(x110,7c(x109,7c(x108,7c(x107,7c(x106,7c(x105,7c(x104,7c(x103,7c(x102,7c(x101,7c(x100,7c(x99,7c(x98,7c(x97,7c(x96,7c(x95,7c(x94,7c(x93,7c(x92,7c(x91,7c(x90,7c(x89,7c(x88,7c(x87,7c(x86,7c(x85,7c(x84,7c(x83,7c(x82,7c(x81,7c(x80,7c(x79,7c(x78,7c(x77,7c(x76,7c(x75,7c(x74,7c(x73,7c(x72,7c(x71,7c(x70,7c(x69,7c(x68,7c(x67,7c(x66,7c(x65,7c(x64,7c(x63,7c(x62,7c(x61,7c(x60,7c(x59,7c(x58,7c(x57,7c(x56,7c(x55,7c(x54,7c(x53,7c(x52,7c(x51,7c(x50,7c(x49,7c(x48,7c(x47,7c(x46,7c(x45,7c(x44,7c(x43,7c(x42,7c(x41,7c(x40,7c(x39,7c(x38,7c(x37,7c(x36,7c(x35,7c(x34,7c(x33,7c(x32,7c(x31,7c(x30,7c(x29,7c(x28,7c(x27,7c(x26,7c(x25,7c(x24,7c(x23,7c(x22,7c(x21,7c(x20,7c(x19,7c(x18,7c(x17,7c(x16,7c(x15,7c(x14,7c(x13,7c(x12,7c(x11,7c(x10,7c(x9,7c(x8,7c(x7,7c(x6,7c(x5,7c(x4,7c(x3,7c(x2,7c(x1,7c(x0,t)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+
+# define BFI_CONS_MANY_0x017z(_, x0) BFI_IFN(BFI_TEST_ZERO_##x0)(7z, 7c(x0,7z))
+# define BFI_CONS_MANY_0x027z(_, x0, x1) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x017z, BFI_CONS_MANY_0x017c)(7c(x0,7z), x1)
+# define BFI_CONS_MANY_0x037z(_, x0, x1, x2) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x027z, BFI_CONS_MANY_0x027c)(7c(x0,7z), x1, x2)
+# define BFI_CONS_MANY_0x047z(_, x0, x1, x2, x3) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x037z, BFI_CONS_MANY_0x037c)(7c(x0,7z), x1, x2, x3)
+# define BFI_CONS_MANY_0x057z(_, x0, x1, x2, x3, x4) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x047z, BFI_CONS_MANY_0x047c)(7c(x0,7z), x1, x2, x3, x4)
+# define BFI_CONS_MANY_0x067z(_, x0, x1, x2, x3, x4, x5) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x057z, BFI_CONS_MANY_0x057c)(7c(x0,7z), x1, x2, x3, x4, x5)
+# define BFI_CONS_MANY_0x077z(_, x0, x1, x2, x3, x4, x5, x6) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x067z, BFI_CONS_MANY_0x067c)(7c(x0,7z), x1, x2, x3, x4, x5, x6)
+# define BFI_CONS_MANY_0x087z(_, x0, x1, x2, x3, x4, x5, x6, x7) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x077z, BFI_CONS_MANY_0x077c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7)
+# define BFI_CONS_MANY_0x097z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x087z, BFI_CONS_MANY_0x087c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8)
+# define BFI_CONS_MANY_0x0a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x097z, BFI_CONS_MANY_0x097c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9)
+# define BFI_CONS_MANY_0x0b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0a7z, BFI_CONS_MANY_0x0a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10)
+# define BFI_CONS_MANY_0x0c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0b7z, BFI_CONS_MANY_0x0b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11)
+# define BFI_CONS_MANY_0x0d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0c7z, BFI_CONS_MANY_0x0c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12)
+# define BFI_CONS_MANY_0x0e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0d7z, BFI_CONS_MANY_0x0d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13)
+# define BFI_CONS_MANY_0x0f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0e7z, BFI_CONS_MANY_0x0e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14)
+# define BFI_CONS_MANY_0x107z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x0f7z, BFI_CONS_MANY_0x0f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)
+# define BFI_CONS_MANY_0x117z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x107z, BFI_CONS_MANY_0x107c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16)
+# define BFI_CONS_MANY_0x127z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x117z, BFI_CONS_MANY_0x117c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17)
+# define BFI_CONS_MANY_0x137z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x127z, BFI_CONS_MANY_0x127c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18)
+# define BFI_CONS_MANY_0x147z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x137z, BFI_CONS_MANY_0x137c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19)
+# define BFI_CONS_MANY_0x157z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x147z, BFI_CONS_MANY_0x147c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20)
+# define BFI_CONS_MANY_0x167z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x157z, BFI_CONS_MANY_0x157c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21)
+# define BFI_CONS_MANY_0x177z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x167z, BFI_CONS_MANY_0x167c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22)
+# define BFI_CONS_MANY_0x187z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x177z, BFI_CONS_MANY_0x177c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23)
+# define BFI_CONS_MANY_0x197z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x187z, BFI_CONS_MANY_0x187c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24)
+# define BFI_CONS_MANY_0x1a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x197z, BFI_CONS_MANY_0x197c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25)
+# define BFI_CONS_MANY_0x1b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1a7z, BFI_CONS_MANY_0x1a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26)
+# define BFI_CONS_MANY_0x1c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1b7z, BFI_CONS_MANY_0x1b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27)
+# define BFI_CONS_MANY_0x1d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1c7z, BFI_CONS_MANY_0x1c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28)
+# define BFI_CONS_MANY_0x1e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1d7z, BFI_CONS_MANY_0x1d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29)
+# define BFI_CONS_MANY_0x1f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1e7z, BFI_CONS_MANY_0x1e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30)
+# define BFI_CONS_MANY_0x207z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x1f7z, BFI_CONS_MANY_0x1f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31)
+# define BFI_CONS_MANY_0x217z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x207z, BFI_CONS_MANY_0x207c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32)
+# define BFI_CONS_MANY_0x227z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x217z, BFI_CONS_MANY_0x217c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33)
+# define BFI_CONS_MANY_0x237z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x227z, BFI_CONS_MANY_0x227c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34)
+# define BFI_CONS_MANY_0x247z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x237z, BFI_CONS_MANY_0x237c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35)
+# define BFI_CONS_MANY_0x257z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x247z, BFI_CONS_MANY_0x247c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36)
+# define BFI_CONS_MANY_0x267z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x257z, BFI_CONS_MANY_0x257c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37)
+# define BFI_CONS_MANY_0x277z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x267z, BFI_CONS_MANY_0x267c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38)
+# define BFI_CONS_MANY_0x287z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x277z, BFI_CONS_MANY_0x277c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39)
+# define BFI_CONS_MANY_0x297z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x287z, BFI_CONS_MANY_0x287c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40)
+# define BFI_CONS_MANY_0x2a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x297z, BFI_CONS_MANY_0x297c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41)
+# define BFI_CONS_MANY_0x2b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2a7z, BFI_CONS_MANY_0x2a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42)
+# define BFI_CONS_MANY_0x2c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2b7z, BFI_CONS_MANY_0x2b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43)
+# define BFI_CONS_MANY_0x2d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2c7z, BFI_CONS_MANY_0x2c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44)
+# define BFI_CONS_MANY_0x2e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2d7z, BFI_CONS_MANY_0x2d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45)
+# define BFI_CONS_MANY_0x2f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2e7z, BFI_CONS_MANY_0x2e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46)
+# define BFI_CONS_MANY_0x307z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x2f7z, BFI_CONS_MANY_0x2f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47)
+# define BFI_CONS_MANY_0x317z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x307z, BFI_CONS_MANY_0x307c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48)
+# define BFI_CONS_MANY_0x327z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x317z, BFI_CONS_MANY_0x317c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49)
+# define BFI_CONS_MANY_0x337z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x327z, BFI_CONS_MANY_0x327c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50)
+# define BFI_CONS_MANY_0x347z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x337z, BFI_CONS_MANY_0x337c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51)
+# define BFI_CONS_MANY_0x357z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x347z, BFI_CONS_MANY_0x347c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52)
+# define BFI_CONS_MANY_0x367z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x357z, BFI_CONS_MANY_0x357c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53)
+# define BFI_CONS_MANY_0x377z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x367z, BFI_CONS_MANY_0x367c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54)
+# define BFI_CONS_MANY_0x387z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x377z, BFI_CONS_MANY_0x377c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55)
+# define BFI_CONS_MANY_0x397z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x387z, BFI_CONS_MANY_0x387c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56)
+# define BFI_CONS_MANY_0x3a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x397z, BFI_CONS_MANY_0x397c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57)
+# define BFI_CONS_MANY_0x3b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3a7z, BFI_CONS_MANY_0x3a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58)
+# define BFI_CONS_MANY_0x3c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3b7z, BFI_CONS_MANY_0x3b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59)
+# define BFI_CONS_MANY_0x3d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3c7z, BFI_CONS_MANY_0x3c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60)
+# define BFI_CONS_MANY_0x3e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3d7z, BFI_CONS_MANY_0x3d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61)
+# define BFI_CONS_MANY_0x3f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3e7z, BFI_CONS_MANY_0x3e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62)
+# define BFI_CONS_MANY_0x407z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x3f7z, BFI_CONS_MANY_0x3f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63)
+# define BFI_CONS_MANY_0x417z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x407z, BFI_CONS_MANY_0x407c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64)
+# define BFI_CONS_MANY_0x427z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x417z, BFI_CONS_MANY_0x417c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65)
+# define BFI_CONS_MANY_0x437z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x427z, BFI_CONS_MANY_0x427c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66)
+# define BFI_CONS_MANY_0x447z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x437z, BFI_CONS_MANY_0x437c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67)
+# define BFI_CONS_MANY_0x457z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x447z, BFI_CONS_MANY_0x447c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68)
+# define BFI_CONS_MANY_0x467z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x457z, BFI_CONS_MANY_0x457c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69)
+# define BFI_CONS_MANY_0x477z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x467z, BFI_CONS_MANY_0x467c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70)
+# define BFI_CONS_MANY_0x487z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x477z, BFI_CONS_MANY_0x477c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71)
+# define BFI_CONS_MANY_0x497z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x487z, BFI_CONS_MANY_0x487c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72)
+# define BFI_CONS_MANY_0x4a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x497z, BFI_CONS_MANY_0x497c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73)
+# define BFI_CONS_MANY_0x4b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4a7z, BFI_CONS_MANY_0x4a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74)
+# define BFI_CONS_MANY_0x4c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4b7z, BFI_CONS_MANY_0x4b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75)
+# define BFI_CONS_MANY_0x4d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4c7z, BFI_CONS_MANY_0x4c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76)
+# define BFI_CONS_MANY_0x4e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4d7z, BFI_CONS_MANY_0x4d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77)
+# define BFI_CONS_MANY_0x4f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4e7z, BFI_CONS_MANY_0x4e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78)
+# define BFI_CONS_MANY_0x507z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x4f7z, BFI_CONS_MANY_0x4f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79)
+# define BFI_CONS_MANY_0x517z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x507z, BFI_CONS_MANY_0x507c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80)
+# define BFI_CONS_MANY_0x527z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x517z, BFI_CONS_MANY_0x517c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81)
+# define BFI_CONS_MANY_0x537z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x527z, BFI_CONS_MANY_0x527c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82)
+# define BFI_CONS_MANY_0x547z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x537z, BFI_CONS_MANY_0x537c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83)
+# define BFI_CONS_MANY_0x557z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x547z, BFI_CONS_MANY_0x547c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84)
+# define BFI_CONS_MANY_0x567z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x557z, BFI_CONS_MANY_0x557c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85)
+# define BFI_CONS_MANY_0x577z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x567z, BFI_CONS_MANY_0x567c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86)
+# define BFI_CONS_MANY_0x587z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x577z, BFI_CONS_MANY_0x577c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87)
+# define BFI_CONS_MANY_0x597z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x587z, BFI_CONS_MANY_0x587c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88)
+# define BFI_CONS_MANY_0x5a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x597z, BFI_CONS_MANY_0x597c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89)
+# define BFI_CONS_MANY_0x5b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5a7z, BFI_CONS_MANY_0x5a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90)
+# define BFI_CONS_MANY_0x5c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5b7z, BFI_CONS_MANY_0x5b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91)
+# define BFI_CONS_MANY_0x5d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5c7z, BFI_CONS_MANY_0x5c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92)
+# define BFI_CONS_MANY_0x5e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5d7z, BFI_CONS_MANY_0x5d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93)
+# define BFI_CONS_MANY_0x5f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5e7z, BFI_CONS_MANY_0x5e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94)
+# define BFI_CONS_MANY_0x607z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x5f7z, BFI_CONS_MANY_0x5f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95)
+# define BFI_CONS_MANY_0x617z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x607z, BFI_CONS_MANY_0x607c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96)
+# define BFI_CONS_MANY_0x627z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x617z, BFI_CONS_MANY_0x617c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97)
+# define BFI_CONS_MANY_0x637z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x627z, BFI_CONS_MANY_0x627c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98)
+# define BFI_CONS_MANY_0x647z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x637z, BFI_CONS_MANY_0x637c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99)
+# define BFI_CONS_MANY_0x657z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x647z, BFI_CONS_MANY_0x647c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100)
+# define BFI_CONS_MANY_0x667z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x657z, BFI_CONS_MANY_0x657c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101)
+# define BFI_CONS_MANY_0x677z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x667z, BFI_CONS_MANY_0x667c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102)
+# define BFI_CONS_MANY_0x687z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x677z, BFI_CONS_MANY_0x677c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103)
+# define BFI_CONS_MANY_0x697z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x687z, BFI_CONS_MANY_0x687c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104)
+# define BFI_CONS_MANY_0x6a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x697z, BFI_CONS_MANY_0x697c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105)
+# define BFI_CONS_MANY_0x6b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6a7z, BFI_CONS_MANY_0x6a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106)
+# define BFI_CONS_MANY_0x6c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6b7z, BFI_CONS_MANY_0x6b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107)
+# define BFI_CONS_MANY_0x6d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6c7z, BFI_CONS_MANY_0x6c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108)
+# define BFI_CONS_MANY_0x6e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6d7z, BFI_CONS_MANY_0x6d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109)
+# define BFI_CONS_MANY_0x6f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6e7z, BFI_CONS_MANY_0x6e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110)
+# define BFI_CONS_MANY_0x707z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x6f7z, BFI_CONS_MANY_0x6f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111)
+# define BFI_CONS_MANY_0x717z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x707z, BFI_CONS_MANY_0x707c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112)
+# define BFI_CONS_MANY_0x727z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x717z, BFI_CONS_MANY_0x717c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113)
+# define BFI_CONS_MANY_0x737z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x727z, BFI_CONS_MANY_0x727c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114)
+# define BFI_CONS_MANY_0x747z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x737z, BFI_CONS_MANY_0x737c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115)
+# define BFI_CONS_MANY_0x757z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x747z, BFI_CONS_MANY_0x747c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116)
+# define BFI_CONS_MANY_0x767z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x757z, BFI_CONS_MANY_0x757c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117)
+# define BFI_CONS_MANY_0x777z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x767z, BFI_CONS_MANY_0x767c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118)
+# define BFI_CONS_MANY_0x787z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x777z, BFI_CONS_MANY_0x777c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119)
+# define BFI_CONS_MANY_0x797z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x787z, BFI_CONS_MANY_0x787c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120)
+# define BFI_CONS_MANY_0x7a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x797z, BFI_CONS_MANY_0x797c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121)
+# define BFI_CONS_MANY_0x7b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7a7z, BFI_CONS_MANY_0x7a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122)
+# define BFI_CONS_MANY_0x7c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7b7z, BFI_CONS_MANY_0x7b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123)
+# define BFI_CONS_MANY_0x7d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7c7z, BFI_CONS_MANY_0x7c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124)
+# define BFI_CONS_MANY_0x7e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7d7z, BFI_CONS_MANY_0x7d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125)
+# define BFI_CONS_MANY_0x7f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7e7z, BFI_CONS_MANY_0x7e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126)
+# define BFI_CONS_MANY_0x807z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x7f7z, BFI_CONS_MANY_0x7f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127)
+# define BFI_CONS_MANY_0x817z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x807z, BFI_CONS_MANY_0x807c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128)
+# define BFI_CONS_MANY_0x827z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x817z, BFI_CONS_MANY_0x817c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129)
+# define BFI_CONS_MANY_0x837z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x827z, BFI_CONS_MANY_0x827c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130)
+# define BFI_CONS_MANY_0x847z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x837z, BFI_CONS_MANY_0x837c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131)
+# define BFI_CONS_MANY_0x857z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x847z, BFI_CONS_MANY_0x847c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132)
+# define BFI_CONS_MANY_0x867z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x857z, BFI_CONS_MANY_0x857c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133)
+# define BFI_CONS_MANY_0x877z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x867z, BFI_CONS_MANY_0x867c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134)
+# define BFI_CONS_MANY_0x887z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x877z, BFI_CONS_MANY_0x877c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135)
+# define BFI_CONS_MANY_0x897z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x887z, BFI_CONS_MANY_0x887c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136)
+# define BFI_CONS_MANY_0x8a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x897z, BFI_CONS_MANY_0x897c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137)
+# define BFI_CONS_MANY_0x8b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8a7z, BFI_CONS_MANY_0x8a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138)
+# define BFI_CONS_MANY_0x8c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8b7z, BFI_CONS_MANY_0x8b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139)
+# define BFI_CONS_MANY_0x8d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8c7z, BFI_CONS_MANY_0x8c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140)
+# define BFI_CONS_MANY_0x8e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8d7z, BFI_CONS_MANY_0x8d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141)
+# define BFI_CONS_MANY_0x8f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8e7z, BFI_CONS_MANY_0x8e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142)
+# define BFI_CONS_MANY_0x907z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x8f7z, BFI_CONS_MANY_0x8f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143)
+# define BFI_CONS_MANY_0x917z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x907z, BFI_CONS_MANY_0x907c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144)
+# define BFI_CONS_MANY_0x927z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x917z, BFI_CONS_MANY_0x917c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145)
+# define BFI_CONS_MANY_0x937z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x927z, BFI_CONS_MANY_0x927c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146)
+# define BFI_CONS_MANY_0x947z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x937z, BFI_CONS_MANY_0x937c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147)
+# define BFI_CONS_MANY_0x957z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x947z, BFI_CONS_MANY_0x947c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148)
+# define BFI_CONS_MANY_0x967z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x957z, BFI_CONS_MANY_0x957c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149)
+# define BFI_CONS_MANY_0x977z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x967z, BFI_CONS_MANY_0x967c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150)
+# define BFI_CONS_MANY_0x987z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x977z, BFI_CONS_MANY_0x977c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151)
+# define BFI_CONS_MANY_0x997z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x987z, BFI_CONS_MANY_0x987c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152)
+# define BFI_CONS_MANY_0x9a7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x997z, BFI_CONS_MANY_0x997c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153)
+# define BFI_CONS_MANY_0x9b7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9a7z, BFI_CONS_MANY_0x9a7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154)
+# define BFI_CONS_MANY_0x9c7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9b7z, BFI_CONS_MANY_0x9b7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155)
+# define BFI_CONS_MANY_0x9d7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9c7z, BFI_CONS_MANY_0x9c7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156)
+# define BFI_CONS_MANY_0x9e7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9d7z, BFI_CONS_MANY_0x9d7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157)
+# define BFI_CONS_MANY_0x9f7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9e7z, BFI_CONS_MANY_0x9e7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158)
+# define BFI_CONS_MANY_0xa07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0x9f7z, BFI_CONS_MANY_0x9f7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159)
+# define BFI_CONS_MANY_0xa17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa07z, BFI_CONS_MANY_0xa07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160)
+# define BFI_CONS_MANY_0xa27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa17z, BFI_CONS_MANY_0xa17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161)
+# define BFI_CONS_MANY_0xa37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa27z, BFI_CONS_MANY_0xa27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162)
+# define BFI_CONS_MANY_0xa47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa37z, BFI_CONS_MANY_0xa37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163)
+# define BFI_CONS_MANY_0xa57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa47z, BFI_CONS_MANY_0xa47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164)
+# define BFI_CONS_MANY_0xa67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa57z, BFI_CONS_MANY_0xa57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165)
+# define BFI_CONS_MANY_0xa77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa67z, BFI_CONS_MANY_0xa67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166)
+# define BFI_CONS_MANY_0xa87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa77z, BFI_CONS_MANY_0xa77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167)
+# define BFI_CONS_MANY_0xa97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa87z, BFI_CONS_MANY_0xa87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168)
+# define BFI_CONS_MANY_0xaa7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xa97z, BFI_CONS_MANY_0xa97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169)
+# define BFI_CONS_MANY_0xab7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xaa7z, BFI_CONS_MANY_0xaa7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170)
+# define BFI_CONS_MANY_0xac7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xab7z, BFI_CONS_MANY_0xab7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171)
+# define BFI_CONS_MANY_0xad7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xac7z, BFI_CONS_MANY_0xac7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172)
+# define BFI_CONS_MANY_0xae7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xad7z, BFI_CONS_MANY_0xad7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173)
+# define BFI_CONS_MANY_0xaf7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xae7z, BFI_CONS_MANY_0xae7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174)
+# define BFI_CONS_MANY_0xb07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xaf7z, BFI_CONS_MANY_0xaf7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175)
+# define BFI_CONS_MANY_0xb17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb07z, BFI_CONS_MANY_0xb07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176)
+# define BFI_CONS_MANY_0xb27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb17z, BFI_CONS_MANY_0xb17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177)
+# define BFI_CONS_MANY_0xb37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb27z, BFI_CONS_MANY_0xb27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178)
+# define BFI_CONS_MANY_0xb47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb37z, BFI_CONS_MANY_0xb37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179)
+# define BFI_CONS_MANY_0xb57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb47z, BFI_CONS_MANY_0xb47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180)
+# define BFI_CONS_MANY_0xb67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb57z, BFI_CONS_MANY_0xb57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181)
+# define BFI_CONS_MANY_0xb77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb67z, BFI_CONS_MANY_0xb67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182)
+# define BFI_CONS_MANY_0xb87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb77z, BFI_CONS_MANY_0xb77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183)
+# define BFI_CONS_MANY_0xb97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb87z, BFI_CONS_MANY_0xb87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184)
+# define BFI_CONS_MANY_0xba7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xb97z, BFI_CONS_MANY_0xb97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185)
+# define BFI_CONS_MANY_0xbb7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xba7z, BFI_CONS_MANY_0xba7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186)
+# define BFI_CONS_MANY_0xbc7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xbb7z, BFI_CONS_MANY_0xbb7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187)
+# define BFI_CONS_MANY_0xbd7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xbc7z, BFI_CONS_MANY_0xbc7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188)
+# define BFI_CONS_MANY_0xbe7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xbd7z, BFI_CONS_MANY_0xbd7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189)
+# define BFI_CONS_MANY_0xbf7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xbe7z, BFI_CONS_MANY_0xbe7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190)
+# define BFI_CONS_MANY_0xc07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xbf7z, BFI_CONS_MANY_0xbf7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191)
+# define BFI_CONS_MANY_0xc17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc07z, BFI_CONS_MANY_0xc07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192)
+# define BFI_CONS_MANY_0xc27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc17z, BFI_CONS_MANY_0xc17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193)
+# define BFI_CONS_MANY_0xc37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc27z, BFI_CONS_MANY_0xc27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194)
+# define BFI_CONS_MANY_0xc47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc37z, BFI_CONS_MANY_0xc37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195)
+# define BFI_CONS_MANY_0xc57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc47z, BFI_CONS_MANY_0xc47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196)
+# define BFI_CONS_MANY_0xc67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc57z, BFI_CONS_MANY_0xc57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197)
+# define BFI_CONS_MANY_0xc77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc67z, BFI_CONS_MANY_0xc67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198)
+# define BFI_CONS_MANY_0xc87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc77z, BFI_CONS_MANY_0xc77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199)
+# define BFI_CONS_MANY_0xc97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc87z, BFI_CONS_MANY_0xc87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200)
+# define BFI_CONS_MANY_0xca7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xc97z, BFI_CONS_MANY_0xc97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201)
+# define BFI_CONS_MANY_0xcb7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xca7z, BFI_CONS_MANY_0xca7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202)
+# define BFI_CONS_MANY_0xcc7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xcb7z, BFI_CONS_MANY_0xcb7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203)
+# define BFI_CONS_MANY_0xcd7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xcc7z, BFI_CONS_MANY_0xcc7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204)
+# define BFI_CONS_MANY_0xce7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xcd7z, BFI_CONS_MANY_0xcd7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205)
+# define BFI_CONS_MANY_0xcf7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xce7z, BFI_CONS_MANY_0xce7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206)
+# define BFI_CONS_MANY_0xd07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xcf7z, BFI_CONS_MANY_0xcf7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207)
+# define BFI_CONS_MANY_0xd17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd07z, BFI_CONS_MANY_0xd07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208)
+# define BFI_CONS_MANY_0xd27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd17z, BFI_CONS_MANY_0xd17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209)
+# define BFI_CONS_MANY_0xd37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd27z, BFI_CONS_MANY_0xd27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210)
+# define BFI_CONS_MANY_0xd47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd37z, BFI_CONS_MANY_0xd37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211)
+# define BFI_CONS_MANY_0xd57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd47z, BFI_CONS_MANY_0xd47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212)
+# define BFI_CONS_MANY_0xd67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd57z, BFI_CONS_MANY_0xd57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213)
+# define BFI_CONS_MANY_0xd77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd67z, BFI_CONS_MANY_0xd67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214)
+# define BFI_CONS_MANY_0xd87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd77z, BFI_CONS_MANY_0xd77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215)
+# define BFI_CONS_MANY_0xd97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd87z, BFI_CONS_MANY_0xd87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216)
+# define BFI_CONS_MANY_0xda7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xd97z, BFI_CONS_MANY_0xd97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217)
+# define BFI_CONS_MANY_0xdb7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xda7z, BFI_CONS_MANY_0xda7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218)
+# define BFI_CONS_MANY_0xdc7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xdb7z, BFI_CONS_MANY_0xdb7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219)
+# define BFI_CONS_MANY_0xdd7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xdc7z, BFI_CONS_MANY_0xdc7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220)
+# define BFI_CONS_MANY_0xde7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xdd7z, BFI_CONS_MANY_0xdd7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221)
+# define BFI_CONS_MANY_0xdf7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xde7z, BFI_CONS_MANY_0xde7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222)
+# define BFI_CONS_MANY_0xe07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xdf7z, BFI_CONS_MANY_0xdf7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223)
+# define BFI_CONS_MANY_0xe17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe07z, BFI_CONS_MANY_0xe07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224)
+# define BFI_CONS_MANY_0xe27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe17z, BFI_CONS_MANY_0xe17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225)
+# define BFI_CONS_MANY_0xe37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe27z, BFI_CONS_MANY_0xe27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226)
+# define BFI_CONS_MANY_0xe47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe37z, BFI_CONS_MANY_0xe37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227)
+# define BFI_CONS_MANY_0xe57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe47z, BFI_CONS_MANY_0xe47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228)
+# define BFI_CONS_MANY_0xe67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe57z, BFI_CONS_MANY_0xe57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229)
+# define BFI_CONS_MANY_0xe77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe67z, BFI_CONS_MANY_0xe67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230)
+# define BFI_CONS_MANY_0xe87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe77z, BFI_CONS_MANY_0xe77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231)
+# define BFI_CONS_MANY_0xe97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe87z, BFI_CONS_MANY_0xe87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232)
+# define BFI_CONS_MANY_0xea7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xe97z, BFI_CONS_MANY_0xe97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233)
+# define BFI_CONS_MANY_0xeb7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xea7z, BFI_CONS_MANY_0xea7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234)
+# define BFI_CONS_MANY_0xec7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xeb7z, BFI_CONS_MANY_0xeb7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235)
+# define BFI_CONS_MANY_0xed7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xec7z, BFI_CONS_MANY_0xec7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236)
+# define BFI_CONS_MANY_0xee7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xed7z, BFI_CONS_MANY_0xed7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237)
+# define BFI_CONS_MANY_0xef7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xee7z, BFI_CONS_MANY_0xee7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238)
+# define BFI_CONS_MANY_0xf07z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xef7z, BFI_CONS_MANY_0xef7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239)
+# define BFI_CONS_MANY_0xf17z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf07z, BFI_CONS_MANY_0xf07c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240)
+# define BFI_CONS_MANY_0xf27z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf17z, BFI_CONS_MANY_0xf17c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241)
+# define BFI_CONS_MANY_0xf37z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf27z, BFI_CONS_MANY_0xf27c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242)
+# define BFI_CONS_MANY_0xf47z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf37z, BFI_CONS_MANY_0xf37c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243)
+# define BFI_CONS_MANY_0xf57z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf47z, BFI_CONS_MANY_0xf47c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244)
+# define BFI_CONS_MANY_0xf67z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf57z, BFI_CONS_MANY_0xf57c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245)
+# define BFI_CONS_MANY_0xf77z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf67z, BFI_CONS_MANY_0xf67c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246)
+# define BFI_CONS_MANY_0xf87z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf77z, BFI_CONS_MANY_0xf77c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247)
+# define BFI_CONS_MANY_0xf97z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf87z, BFI_CONS_MANY_0xf87c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248)
+# define BFI_CONS_MANY_0xfa7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xf97z, BFI_CONS_MANY_0xf97c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249)
+# define BFI_CONS_MANY_0xfb7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xfa7z, BFI_CONS_MANY_0xfa7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250)
+# define BFI_CONS_MANY_0xfc7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xfb7z, BFI_CONS_MANY_0xfb7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251)
+# define BFI_CONS_MANY_0xfd7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xfc7z, BFI_CONS_MANY_0xfc7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252)
+# define BFI_CONS_MANY_0xfe7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xfd7z, BFI_CONS_MANY_0xfd7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253)
+# define BFI_CONS_MANY_0xff7z(_, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253, x254) BFI_IFN(BFI_TEST_ZERO_##x0)(BFI_CONS_MANY_0xfe7z, BFI_CONS_MANY_0xfe7c)(7c(x0,7z), x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38, x39, x40, x41, x42, x43, x44, x45, x46, x47, x48, x49, x50, x51, x52, x53, x54, x55, x56, x57, x58, x59, x60, x61, x62, x63, x64, x65, x66, x67, x68, x69, x70, x71, x72, x73, x74, x75, x76, x77, x78, x79, x80, x81, x82, x83, x84, x85, x86, x87, x88, x89, x90, x91, x92, x93, x94, x95, x96, x97, x98, x99, x100, x101, x102, x103, x104, x105, x106, x107, x108, x109, x110, x111, x112, x113, x114, x115, x116, x117, x118, x119, x120, x121, x122, x123, x124, x125, x126, x127, x128, x129, x130, x131, x132, x133, x134, x135, x136, x137, x138, x139, x140, x141, x142, x143, x144, x145, x146, x147, x148, x149, x150, x151, x152, x153, x154, x155, x156, x157, x158, x159, x160, x161, x162, x163, x164, x165, x166, x167, x168, x169, x170, x171, x172, x173, x174, x175, x176, x177, x178, x179, x180, x181, x182, x183, x184, x185, x186, x187, x188, x189, x190, x191, x192, x193, x194, x195, x196, x197, x198, x199, x200, x201, x202, x203, x204, x205, x206, x207, x208, x209, x210, x211, x212, x213, x214, x215, x216, x217, x218, x219, x220, x221, x222, x223, x224, x225, x226, x227, x228, x229, x230, x231, x232, x233, x234, x235, x236, x237, x238, x239, x240, x241, x242, x243, x244, x245, x246, x247, x248, x249, x250, x251, x252, x253, x254)
+
+# endif
@@ -0,0 +1,65 @@
+/* Writes a C file that runs a BF loop body 'count' times, with 'cells'
+ * cells set to 1 to the left of the loop, to measure the body on its own:
+ *
+ *   ./ppbody '>+<' 1000 100 > body.c && time gcc -E -P body.c > /dev/null
+ *
+ * The body starts on the counter of the loop and must end there without
+ * changing it; the cells to its right are free. The counter is written
+ * after each iteration, which keeps the loop from being turned into a
+ * multiplication. A count above 255 takes an outer loop, so it must be a
+ * multiple of at most 255 of a number up to 255.
+ */
+# include <stdio.h>
+# include <stdlib.h>
+
+void emit(const char *s)
+{
+  for(; *s; s++)
+    switch(*s)
+    {
+    case '+': printf("x "); break;
+    case '-': printf("_ "); break;
+    case '>': printf("b "); break;
+    case '<': printf("d "); break;
+    case '.': printf("w "); break;
+    case '[': printf("L "); break;
+    case ']': printf("R "); break;
+    }
+}
+
+void emitn(const char *s, int n)
+{
+  while(n-- > 0)
+    emit(s);
+}
+
+int main(int argc, char **argv)
+{
+  int count, cells = 0, inner = 0;
+  if((argc == 3 || argc == 4) && (count = atoi(argv[2])) > 0 &&
+    (argc == 3 || (cells = atoi(argv[3])) >= 0))
+    for(inner = count < 255 ? count : 255;
+      inner > 0 && (count % inner || count / inner > 255); inner--)
+      ;
+  if(inner == 0)
+  {
+    fprintf(stderr, "usage: %s body count [cells]\n", argv[0]);
+    return 1;
+  }
+  printf("# include \"bfi.h\"\n\nBFI_RUN1(");
+  emitn("+>", cells);
+  if(count > inner)
+  {
+    emitn("+", count / inner);
+    emit("[>");
+  }
+  emitn("+", inner);
+  emit("[-");
+  emit(argv[1]);
+  emit(".]");
+  if(count > inner)
+    emit("<-]");
+  emit(".");
+  printf(")\n");
+  return 0;
+}
@@ -0,0 +1,47 @@
+/* Writes a C file that runs a BF program with loops nested 'depth' deep,
+ * to measure how the cost of a run grows with the nesting:
+ *
+ *   ./ppnest 32 > nest.c && time gcc -E -P nest.c > /dev/null
+ *
+ * Each level is a loop that runs once, and ends with a short tail, so that
+ * every frame of the stack keeps a loop body. The innermost level runs a
+ * loop of 127 iterations 16 times. As it cannot be turned into a
+ * multiplication, it takes slow steps, and the machine suspends itself
+ * with the whole nest on the stack.
+ */
+# include <stdio.h>
+# include <stdlib.h>
+
+void emit(const char *s)
+{
+  for(; *s; s++)
+    switch(*s)
+    {
+    case '+': printf("x "); break;
+    case '-': printf("_ "); break;
+    case '>': printf("b "); break;
+    case '<': printf("d "); break;
+    case '.': printf("w "); break;
+    case '[': printf("L "); break;
+    case ']': printf("R "); break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+  int depth, i;
+  if(argc != 2 || (depth = atoi(argv[1])) < 0)
+  {
+    fprintf(stderr, "usage: %s depth\n", argv[0]);
+    return 1;
+  }
+  printf("# include \"bfi.h\"\n\nBFI_RUN1(");
+  for(i = 0; i < depth; i++)
+    emit("+[>");
+  emit("++++++++++++++++[>--[-->+<]>[-]<<-]");
+  for(i = 0; i < depth; i++)
+    emit("<>>+<<>+<-]");
+  emit(">.");
+  printf(")\n");
+  return 0;
+}
@@ -0,0 +1,48 @@
+/* Writes a C file that runs a BF program printing the squares from 0 up to
+ * 'n' squared, one per line, to measure how the cost of a run depends on
+ * BFI_LINEAR_DEPTH:
+ *
+ *   ./ppsquares 100 > sq.c && time gcc -E -P sq.c > /dev/null
+ *
+ * The program is Daniel B. Cristofani's squares.b, which counts to 100;
+ * only the counter it starts with is changed. It keeps the digits of the
+ * square and of the next odd number in records of 3 cells, so it takes
+ * many slow steps on a short tape.
+ */
+# include <stdio.h>
+# include <stdlib.h>
+
+void emit(const char *s)
+{
+  for(; *s; s++)
+    switch(*s)
+    {
+    case '+': printf("x "); break;
+    case '-': printf("_ "); break;
+    case '>': printf("b "); break;
+    case '<': printf("d "); break;
+    case '.': printf("w "); break;
+    case '[': printf("L "); break;
+    case ']': printf("R "); break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+  int n, i;
+  if(argc != 2 || (n = atoi(argv[1])) < 0 || n > 254)
+  {
+    fprintf(stderr, "usage: %s n\n", argv[0]);
+    return 1;
+  }
+  printf("# include \"bfi.h\"\n\nBFI_RUN1(");
+  emit(">+<");
+  for(i = 0; i <= n; i++)
+    emit("+");
+  emit("[>[>+>+<<-]++>>[<<+>>-]>>>[-]++>[-]+>>>+[[-]++++++>>>]<<<"
+    "[[<++++++++<++>>-]+<.<[>----<-]<]<<"
+    "[>>>>>[>>>[-]+++++++++<[>-<-]+++++++++>[-[<->-]+[<<<]]<[>+<-]>]<<-]"
+    "<<-]");
+  printf(")\n");
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* Writes a C file that runs a BF program which first sets 'n' cells to 1,
+ * 'stride' cells apart, to measure how the cost of a step grows with the
+ * length of the tape:
+ *
+ *   ./pptape loop 1024 > tape.c && time gcc -E -P tape.c > /dev/null
+ *
+ * The program then does one of:
+ *
+ *   set     nothing else;
+ *   loop    a loop of 2032 iterations to the right of the cells, the same
+ *           as the innermost level of ppnest.c;
+ *   trips   'count' round trips over the cells, adding 1 to each on the
+ *           way back, and writing the counter after each, which keeps the
+ *           loop from being turned into a multiplication;
+ *   walk    a walk back over the cells with a loop that moves by
+ *           'stride', which stops 'stride' cells before the first;
+ *   scan    'count' round trips over the cells, each a walk back and a
+ *           walk forth like the one above, with the counter to the right;
+ *
+ * and ends by writing the cell it is on.
+ */
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+void emit(const char *s)
+{
+  for(; *s; s++)
+    switch(*s)
+    {
+    case '+': printf("x "); break;
+    case '-': printf("_ "); break;
+    case '>': printf("b "); break;
+    case '<': printf("d "); break;
+    case '.': printf("w "); break;
+    case '[': printf("L "); break;
+    case ']': printf("R "); break;
+    }
+}
+
+void emitn(const char *s, int n)
+{
+  while(n-- > 0)
+    emit(s);
+}
+
+int main(int argc, char **argv)
+{
+  int n, stride = 1, count = 8, i;
+  const char *prog;
+  if(argc < 3 || argc > 5 || (n = atoi(argv[2])) < 0 ||
+    (argc > 3 && (stride = atoi(argv[3])) < 1) ||
+    (argc > 4 && ((count = atoi(argv[4])) < 1 || count > 255)) ||
+    (strcmp(prog = argv[1], "set") && strcmp(prog, "loop") &&
+      strcmp(prog, "trips") && strcmp(prog, "walk") &&
+      strcmp(prog, "scan")))
+  {
+    fprintf(stderr,
+      "usage: %s set|loop|trips|walk|scan n [stride [count]]\n", argv[0]);
+    return 1;
+  }
+  printf("# include \"bfi.h\"\n\nBFI_RUN1(");
+  for(i = 0; i < n; i++)
+  {
+    emit("+");
+    emitn(">", stride);
+  }
+  if(!strcmp(prog, "loop"))
+    emit("++++++++++++++++[>--[-->+<]>[-]<<-]");
+  else if(!strcmp(prog, "trips"))
+  {
+    emitn("+", count);
+    emit("[");
+    for(i = 0; i < n; i++)
+    {
+      emitn("<", stride);
+      emit("+");
+    }
+    emitn(">", n * stride);
+    emit(".-]");
+  }
+  else if(!strcmp(prog, "walk"))
+  {
+    emitn("<", stride);
+    emit("[");
+    emitn("<", stride);
+    emit("]");
+  }
+  else if(!strcmp(prog, "scan"))
+  {
+    emit(">");
+    emitn("+", count);
+    emit("[-<");
+    emitn("<", stride);
+    emit("[");
+    emitn("<", stride);
+    emit("]");
+    emitn(">", stride);
+    emit("[");
+    emitn(">", stride);
+    emit("]>]");
+  }
+  emit(".");
+  printf(")\n");
+  return 0;
+}
@@ -0,0 +1,152 @@
+/* Reads the expansion of BFI_RUN_TRACE from stdin and prints a line for
+ * every loop of the compiled program that has been checked at least once:
+ *
+ *   iterations entries item
+ *
+ * 'item' is the loop as it appears in the trace, with its body. For a 6if,
+ * 'iterations' is the number of times the body has run. A 6scanR or 6scanL
+ * moves in a single step, so for these 'iterations' is the number of times
+ * they have moved at all, not the number of cells they have passed. Loops
+ * with the same body are counted together.
+ */
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <ctype.h>
+
+struct loop
+{
+  char *item;
+  int once;
+  unsigned long checks, zeros;
+};
+
+struct loop *loops;
+size_t nloops, maxloops;
+
+char *slurp(void)
+{
+  size_t len = 0, max = 1 << 16;
+  char *buf = malloc(max), *more;
+  int c;
+  while(buf && (c = getchar()) != EOF)
+  {
+    if(len + 1 == max)
+    {
+      if(!(more = realloc(buf, max *= 2)))
+        return free(buf), NULL;
+      buf = more;
+    }
+    buf[len++] = c;
+  }
+  if(buf)
+    buf[len] = 0;
+  return buf;
+}
+
+/* Copy the parenthesized item at p without whitespace. Return a pointer
+ * past it, or NULL if it is not closed. */
+const char *item(const char *p, char **out)
+{
+  const char *q = p;
+  int depth = 0;
+  char *s;
+  size_t n = 0;
+  do
+  {
+    if(*q == '(')
+      depth++;
+    else if(*q == ')')
+      depth--;
+    else if(!*q)
+      return NULL;
+    q++;
+  }
+  while(depth);
+  if(!(s = malloc(q - p + 1)))
+    return NULL;
+  for(; p < q; p++)
+    if(!isspace((unsigned char)*p))
+      s[n++] = *p;
+  s[n] = 0;
+  *out = s;
+  return q;
+}
+
+struct loop *find(char *s)
+{
+  size_t i, max;
+  struct loop *more;
+  for(i = 0; i < nloops; i++)
+    if(!strcmp(loops[i].item, s))
+      return free(s), &loops[i];
+  if(nloops == maxloops)
+  {
+    max = maxloops ? maxloops * 2 : 64;
+    if(!(more = realloc(loops, max * sizeof *loops)))
+      return free(s), NULL;
+    loops = more;
+    maxloops = max;
+  }
+  loops[nloops].item = s;
+  loops[nloops].once = !strncmp(s, "(6if,", 5) || !strncmp(s, "(6scan", 6);
+  loops[nloops].checks = loops[nloops].zeros = 0;
+  return &loops[nloops++];
+}
+
+unsigned long iterations(const struct loop *l)
+{
+  return l->checks - l->zeros;
+}
+
+unsigned long entries(const struct loop *l)
+{
+  return l->once ? l->checks : l->zeros;
+}
+
+int compare(const void *a, const void *b)
+{
+  unsigned long x = iterations(a), y = iterations(b);
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+int main(void)
+{
+  char *buf = slurp(), *s;
+  const char *p;
+  struct loop *l;
+  size_t i;
+  if(!buf)
+    return perror("pptrace"), 1;
+  for(p = buf; (p = strstr(p, "0trace")); )
+  {
+    p += 6;
+    while(isspace((unsigned char)*p))
+      p++;
+    if(*p++ != '(')
+      continue;
+    while(isspace((unsigned char)*p))
+      p++;
+    if(*p != '(')
+      continue;
+    if(!(p = item(p, &s)))
+      break;
+    if(strncmp(s, "(6loop,", 7) && strncmp(s, "(6loopA,", 8) && strncmp(s, "(6if,", 5)
+      && strncmp(s, "(6scanR,", 8) && strncmp(s, "(6scanL,", 8))
+    {
+      free(s);
+      continue;
+    }
+    if(!(l = find(s)))
+      return perror("pptrace"), 1;
+    while(isspace((unsigned char)*p) || *p == ',')
+      p++;
+    l->checks++;
+    if(!strncmp(p, "0x00", 4))
+      l->zeros++;
+  }
+  qsort(loops, nloops, sizeof *loops, compare);
+  for(i = 0; i < nloops; i++)
+    printf("%lu %lu %s\n", iterations(&loops[i]), entries(&loops[i]), loops[i].item);
+  return 0;
+}
@@ -0,0 +1,119 @@
+# ifndef BFI_PROF_H
+# define BFI_PROF_H
+
+/* generated by gen_prof.hs */
+
+/* BFI_PROF_ZERO
+ * BFI_PROF_SLOT_0i##g
+ * BFI_PROF_REPORT_I(c0, ..., cm)
+ *    g : instruction
+ *    c0, ..., cm : counter
+ *  The tables behind BFI_EXEC_PROFILE in bfi.h, with one counter for each
+ *  of the 31 counted instructions.
+ *  BFI_PROF_ZERO is the tuple of counters before the run.
+ *  BFI_PROF_SLOT_0i##g is a BFI_SWITCH case for a tick of 'g', which
+ *  bumps the counter of 'g' through BFI_PROF_COUNT_{N} and BFI_PROF_BUMP_{N}.
+ *  BFI_PROF_REPORT_I expands to a BFI_PROF_ROW for each counter.
+ */
+
+# define BFI_PROF_ZERO ((0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)(), (0)())
+
+# define BFI_PROF_SLOT_0i6inc BFI_TEST_SUCCESS(BFI_PROF_COUNT_0)
+# define BFI_PROF_SLOT_0i6dec BFI_TEST_SUCCESS(BFI_PROF_COUNT_1)
+# define BFI_PROF_SLOT_0i6add BFI_TEST_SUCCESS(BFI_PROF_COUNT_2)
+# define BFI_PROF_SLOT_0i6next BFI_TEST_SUCCESS(BFI_PROF_COUNT_3)
+# define BFI_PROF_SLOT_0i6prev BFI_TEST_SUCCESS(BFI_PROF_COUNT_4)
+# define BFI_PROF_SLOT_0i6next1 BFI_TEST_SUCCESS(BFI_PROF_COUNT_5)
+# define BFI_PROF_SLOT_0i6prev1 BFI_TEST_SUCCESS(BFI_PROF_COUNT_6)
+# define BFI_PROF_SLOT_0i6nextA BFI_TEST_SUCCESS(BFI_PROF_COUNT_7)
+# define BFI_PROF_SLOT_0i6nextB BFI_TEST_SUCCESS(BFI_PROF_COUNT_8)
+# define BFI_PROF_SLOT_0i6prevA BFI_TEST_SUCCESS(BFI_PROF_COUNT_9)
+# define BFI_PROF_SLOT_0i6prevB BFI_TEST_SUCCESS(BFI_PROF_COUNT_10)
+# define BFI_PROF_SLOT_0i6loop BFI_TEST_SUCCESS(BFI_PROF_COUNT_11)
+# define BFI_PROF_SLOT_0i6loopA BFI_TEST_SUCCESS(BFI_PROF_COUNT_12)
+# define BFI_PROF_SLOT_0i6if BFI_TEST_SUCCESS(BFI_PROF_COUNT_13)
+# define BFI_PROF_SLOT_0i6read BFI_TEST_SUCCESS(BFI_PROF_COUNT_14)
+# define BFI_PROF_SLOT_0i6readA BFI_TEST_SUCCESS(BFI_PROF_COUNT_15)
+# define BFI_PROF_SLOT_0i6readB BFI_TEST_SUCCESS(BFI_PROF_COUNT_16)
+# define BFI_PROF_SLOT_0i6write BFI_TEST_SUCCESS(BFI_PROF_COUNT_17)
+# define BFI_PROF_SLOT_0i6writeA BFI_TEST_SUCCESS(BFI_PROF_COUNT_18)
+# define BFI_PROF_SLOT_0i6writeB BFI_TEST_SUCCESS(BFI_PROF_COUNT_19)
+# define BFI_PROF_SLOT_0i6senter BFI_TEST_SUCCESS(BFI_PROF_COUNT_20)
+# define BFI_PROF_SLOT_0i6sadd BFI_TEST_SUCCESS(BFI_PROF_COUNT_21)
+# define BFI_PROF_SLOT_0i6sexit BFI_TEST_SUCCESS(BFI_PROF_COUNT_22)
+# define BFI_PROF_SLOT_0i6id_4 BFI_TEST_SUCCESS(BFI_PROF_COUNT_23)
+# define BFI_PROF_SLOT_0i6seek BFI_TEST_SUCCESS(BFI_PROF_COUNT_24)
+# define BFI_PROF_SLOT_0i6scanR BFI_TEST_SUCCESS(BFI_PROF_COUNT_25)
+# define BFI_PROF_SLOT_0i6scanL BFI_TEST_SUCCESS(BFI_PROF_COUNT_26)
+# define BFI_PROF_SLOT_0i6addA BFI_TEST_SUCCESS(BFI_PROF_COUNT_27)
+# define BFI_PROF_SLOT_0i6addB BFI_TEST_SUCCESS(BFI_PROF_COUNT_28)
+# define BFI_PROF_SLOT_0i6setA BFI_TEST_SUCCESS(BFI_PROF_COUNT_29)
+# define BFI_PROF_SLOT_0i6setB BFI_TEST_SUCCESS(BFI_PROF_COUNT_30)
+
+# define BFI_PROF_COUNT_0(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_0 a,
+# define BFI_PROF_COUNT_1(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_1 a,
+# define BFI_PROF_COUNT_2(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_2 a,
+# define BFI_PROF_COUNT_3(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_3 a,
+# define BFI_PROF_COUNT_4(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_4 a,
+# define BFI_PROF_COUNT_5(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_5 a,
+# define BFI_PROF_COUNT_6(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_6 a,
+# define BFI_PROF_COUNT_7(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_7 a,
+# define BFI_PROF_COUNT_8(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_8 a,
+# define BFI_PROF_COUNT_9(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_9 a,
+# define BFI_PROF_COUNT_10(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_10 a,
+# define BFI_PROF_COUNT_11(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_11 a,
+# define BFI_PROF_COUNT_12(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_12 a,
+# define BFI_PROF_COUNT_13(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_13 a,
+# define BFI_PROF_COUNT_14(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_14 a,
+# define BFI_PROF_COUNT_15(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_15 a,
+# define BFI_PROF_COUNT_16(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_16 a,
+# define BFI_PROF_COUNT_17(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_17 a,
+# define BFI_PROF_COUNT_18(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_18 a,
+# define BFI_PROF_COUNT_19(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_19 a,
+# define BFI_PROF_COUNT_20(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_20 a,
+# define BFI_PROF_COUNT_21(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_21 a,
+# define BFI_PROF_COUNT_22(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_22 a,
+# define BFI_PROF_COUNT_23(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_23 a,
+# define BFI_PROF_COUNT_24(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_24 a,
+# define BFI_PROF_COUNT_25(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_25 a,
+# define BFI_PROF_COUNT_26(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_26 a,
+# define BFI_PROF_COUNT_27(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_27 a,
+# define BFI_PROF_COUNT_28(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_28 a,
+# define BFI_PROF_COUNT_29(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_29 a,
+# define BFI_PROF_COUNT_30(j, a, i) BFI_PROF_GO(j, BFI_PROF_BUMP_30 a,
+
+# define BFI_PROF_BUMP_0(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (BFI_FMACHINE_INC(c0), c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_1(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, BFI_FMACHINE_INC(c1), c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_2(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, BFI_FMACHINE_INC(c2), c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_3(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, BFI_FMACHINE_INC(c3), c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_4(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, BFI_FMACHINE_INC(c4), c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_5(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, BFI_FMACHINE_INC(c5), c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_6(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, BFI_FMACHINE_INC(c6), c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_7(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, BFI_FMACHINE_INC(c7), c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_8(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, BFI_FMACHINE_INC(c8), c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_9(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, BFI_FMACHINE_INC(c9), c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_10(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, BFI_FMACHINE_INC(c10), c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_11(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, BFI_FMACHINE_INC(c11), c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_12(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, BFI_FMACHINE_INC(c12), c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_13(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, BFI_FMACHINE_INC(c13), c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_14(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, BFI_FMACHINE_INC(c14), c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_15(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, BFI_FMACHINE_INC(c15), c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_16(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, BFI_FMACHINE_INC(c16), c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_17(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, BFI_FMACHINE_INC(c17), c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_18(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, BFI_FMACHINE_INC(c18), c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_19(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, BFI_FMACHINE_INC(c19), c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_20(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, BFI_FMACHINE_INC(c20), c21, c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_21(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, BFI_FMACHINE_INC(c21), c22, c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_22(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, BFI_FMACHINE_INC(c22), c23, c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_23(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, BFI_FMACHINE_INC(c23), c24, c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_24(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, BFI_FMACHINE_INC(c24), c25, c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_25(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, BFI_FMACHINE_INC(c25), c26, c27, c28, c29, c30)
+# define BFI_PROF_BUMP_26(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, BFI_FMACHINE_INC(c26), c27, c28, c29, c30)
+# define BFI_PROF_BUMP_27(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, BFI_FMACHINE_INC(c27), c28, c29, c30)
+# define BFI_PROF_BUMP_28(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, BFI_FMACHINE_INC(c28), c29, c30)
+# define BFI_PROF_BUMP_29(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, BFI_FMACHINE_INC(c29), c30)
+# define BFI_PROF_BUMP_30(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) (c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, BFI_FMACHINE_INC(c30))
+
+# define BFI_PROF_REPORT_I(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23, c24, c25, c26, c27, c28, c29, c30) BFI_PROF_ROW(6inc, c0) BFI_PROF_ROW(6dec, c1) BFI_PROF_ROW(6add, c2) BFI_PROF_ROW(6next, c3) BFI_PROF_ROW(6prev, c4) BFI_PROF_ROW(6next1, c5) BFI_PROF_ROW(6prev1, c6) BFI_PROF_ROW(6nextA, c7) BFI_PROF_ROW(6nextB, c8) BFI_PROF_ROW(6prevA, c9) BFI_PROF_ROW(6prevB, c10) BFI_PROF_ROW(6loop, c11) BFI_PROF_ROW(6loopA, c12) BFI_PROF_ROW(6if, c13) BFI_PROF_ROW(6read, c14) BFI_PROF_ROW(6readA, c15) BFI_PROF_ROW(6readB, c16) BFI_PROF_ROW(6write, c17) BFI_PROF_ROW(6writeA, c18) BFI_PROF_ROW(6writeB, c19) BFI_PROF_ROW(6senter, c20) BFI_PROF_ROW(6sadd, c21) BFI_PROF_ROW(6sexit, c22) BFI_PROF_ROW(6id_4, c23) BFI_PROF_ROW(6seek, c24) BFI_PROF_ROW(6scanR, c25) BFI_PROF_ROW(6scanL, c26) BFI_PROF_ROW(6addA, c27) BFI_PROF_ROW(6addB, c28) BFI_PROF_ROW(6setA, c29) BFI_PROF_ROW(6setB, c30)
+
+# endif
@@ -0,0 +1,274 @@
+# ifndef BFI_SINK_H
+# define BFI_SINK_H
+
+/* generated by gen_sink.hs */
+
+/* BFI_TEST_SINKMOVES_GAIN_##b
+ * BFI_TEST_SINKMOVES_FAR_##b
+ *    b : octet
+ *  The tables behind BFI_SINKMOVES in bfi.h, which read 'b' as a signed
+ *  number from -128 to 127.
+ *  BFI_TEST_SINKMOVES_GAIN_##b expands to () if 'b' is positive.
+ *  BFI_TEST_SINKMOVES_FAR_##b expands to () if 'b' is at least 64 or
+ *  at most -64.
+ */
+
+# define BFI_TEST_SINKMOVES_GAIN_0x01 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x02 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x03 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x04 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x05 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x06 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x07 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x08 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x09 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x0f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x10 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x11 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x12 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x13 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x14 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x15 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x16 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x17 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x18 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x19 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x1f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x20 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x21 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x22 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x23 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x24 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x25 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x26 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x27 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x28 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x29 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x2f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x30 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x31 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x32 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x33 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x34 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x35 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x36 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x37 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x38 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x39 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x3f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x40 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x41 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x42 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x43 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x44 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x45 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x46 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x47 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x48 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x49 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x4f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x50 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x51 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x52 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x53 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x54 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x55 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x56 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x57 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x58 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x59 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x5f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x60 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x61 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x62 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x63 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x64 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x65 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x66 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x67 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x68 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x69 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x6f ()
+# define BFI_TEST_SINKMOVES_GAIN_0x70 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x71 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x72 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x73 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x74 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x75 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x76 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x77 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x78 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x79 ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7a ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7b ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7c ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7d ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7e ()
+# define BFI_TEST_SINKMOVES_GAIN_0x7f ()
+
+# define BFI_TEST_SINKMOVES_FAR_0x40 ()
+# define BFI_TEST_SINKMOVES_FAR_0x41 ()
+# define BFI_TEST_SINKMOVES_FAR_0x42 ()
+# define BFI_TEST_SINKMOVES_FAR_0x43 ()
+# define BFI_TEST_SINKMOVES_FAR_0x44 ()
+# define BFI_TEST_SINKMOVES_FAR_0x45 ()
+# define BFI_TEST_SINKMOVES_FAR_0x46 ()
+# define BFI_TEST_SINKMOVES_FAR_0x47 ()
+# define BFI_TEST_SINKMOVES_FAR_0x48 ()
+# define BFI_TEST_SINKMOVES_FAR_0x49 ()
+# define BFI_TEST_SINKMOVES_FAR_0x4a ()
+# define BFI_TEST_SINKMOVES_FAR_0x4b ()
+# define BFI_TEST_SINKMOVES_FAR_0x4c ()
+# define BFI_TEST_SINKMOVES_FAR_0x4d ()
+# define BFI_TEST_SINKMOVES_FAR_0x4e ()
+# define BFI_TEST_SINKMOVES_FAR_0x4f ()
+# define BFI_TEST_SINKMOVES_FAR_0x50 ()
+# define BFI_TEST_SINKMOVES_FAR_0x51 ()
+# define BFI_TEST_SINKMOVES_FAR_0x52 ()
+# define BFI_TEST_SINKMOVES_FAR_0x53 ()
+# define BFI_TEST_SINKMOVES_FAR_0x54 ()
+# define BFI_TEST_SINKMOVES_FAR_0x55 ()
+# define BFI_TEST_SINKMOVES_FAR_0x56 ()
+# define BFI_TEST_SINKMOVES_FAR_0x57 ()
+# define BFI_TEST_SINKMOVES_FAR_0x58 ()
+# define BFI_TEST_SINKMOVES_FAR_0x59 ()
+# define BFI_TEST_SINKMOVES_FAR_0x5a ()
+# define BFI_TEST_SINKMOVES_FAR_0x5b ()
+# define BFI_TEST_SINKMOVES_FAR_0x5c ()
+# define BFI_TEST_SINKMOVES_FAR_0x5d ()
+# define BFI_TEST_SINKMOVES_FAR_0x5e ()
+# define BFI_TEST_SINKMOVES_FAR_0x5f ()
+# define BFI_TEST_SINKMOVES_FAR_0x60 ()
+# define BFI_TEST_SINKMOVES_FAR_0x61 ()
+# define BFI_TEST_SINKMOVES_FAR_0x62 ()
+# define BFI_TEST_SINKMOVES_FAR_0x63 ()
+# define BFI_TEST_SINKMOVES_FAR_0x64 ()
+# define BFI_TEST_SINKMOVES_FAR_0x65 ()
+# define BFI_TEST_SINKMOVES_FAR_0x66 ()
+# define BFI_TEST_SINKMOVES_FAR_0x67 ()
+# define BFI_TEST_SINKMOVES_FAR_0x68 ()
+# define BFI_TEST_SINKMOVES_FAR_0x69 ()
+# define BFI_TEST_SINKMOVES_FAR_0x6a ()
+# define BFI_TEST_SINKMOVES_FAR_0x6b ()
+# define BFI_TEST_SINKMOVES_FAR_0x6c ()
+# define BFI_TEST_SINKMOVES_FAR_0x6d ()
+# define BFI_TEST_SINKMOVES_FAR_0x6e ()
+# define BFI_TEST_SINKMOVES_FAR_0x6f ()
+# define BFI_TEST_SINKMOVES_FAR_0x70 ()
+# define BFI_TEST_SINKMOVES_FAR_0x71 ()
+# define BFI_TEST_SINKMOVES_FAR_0x72 ()
+# define BFI_TEST_SINKMOVES_FAR_0x73 ()
+# define BFI_TEST_SINKMOVES_FAR_0x74 ()
+# define BFI_TEST_SINKMOVES_FAR_0x75 ()
+# define BFI_TEST_SINKMOVES_FAR_0x76 ()
+# define BFI_TEST_SINKMOVES_FAR_0x77 ()
+# define BFI_TEST_SINKMOVES_FAR_0x78 ()
+# define BFI_TEST_SINKMOVES_FAR_0x79 ()
+# define BFI_TEST_SINKMOVES_FAR_0x7a ()
+# define BFI_TEST_SINKMOVES_FAR_0x7b ()
+# define BFI_TEST_SINKMOVES_FAR_0x7c ()
+# define BFI_TEST_SINKMOVES_FAR_0x7d ()
+# define BFI_TEST_SINKMOVES_FAR_0x7e ()
+# define BFI_TEST_SINKMOVES_FAR_0x7f ()
+# define BFI_TEST_SINKMOVES_FAR_0x80 ()
+# define BFI_TEST_SINKMOVES_FAR_0x81 ()
+# define BFI_TEST_SINKMOVES_FAR_0x82 ()
+# define BFI_TEST_SINKMOVES_FAR_0x83 ()
+# define BFI_TEST_SINKMOVES_FAR_0x84 ()
+# define BFI_TEST_SINKMOVES_FAR_0x85 ()
+# define BFI_TEST_SINKMOVES_FAR_0x86 ()
+# define BFI_TEST_SINKMOVES_FAR_0x87 ()
+# define BFI_TEST_SINKMOVES_FAR_0x88 ()
+# define BFI_TEST_SINKMOVES_FAR_0x89 ()
+# define BFI_TEST_SINKMOVES_FAR_0x8a ()
+# define BFI_TEST_SINKMOVES_FAR_0x8b ()
+# define BFI_TEST_SINKMOVES_FAR_0x8c ()
+# define BFI_TEST_SINKMOVES_FAR_0x8d ()
+# define BFI_TEST_SINKMOVES_FAR_0x8e ()
+# define BFI_TEST_SINKMOVES_FAR_0x8f ()
+# define BFI_TEST_SINKMOVES_FAR_0x90 ()
+# define BFI_TEST_SINKMOVES_FAR_0x91 ()
+# define BFI_TEST_SINKMOVES_FAR_0x92 ()
+# define BFI_TEST_SINKMOVES_FAR_0x93 ()
+# define BFI_TEST_SINKMOVES_FAR_0x94 ()
+# define BFI_TEST_SINKMOVES_FAR_0x95 ()
+# define BFI_TEST_SINKMOVES_FAR_0x96 ()
+# define BFI_TEST_SINKMOVES_FAR_0x97 ()
+# define BFI_TEST_SINKMOVES_FAR_0x98 ()
+# define BFI_TEST_SINKMOVES_FAR_0x99 ()
+# define BFI_TEST_SINKMOVES_FAR_0x9a ()
+# define BFI_TEST_SINKMOVES_FAR_0x9b ()
+# define BFI_TEST_SINKMOVES_FAR_0x9c ()
+# define BFI_TEST_SINKMOVES_FAR_0x9d ()
+# define BFI_TEST_SINKMOVES_FAR_0x9e ()
+# define BFI_TEST_SINKMOVES_FAR_0x9f ()
+# define BFI_TEST_SINKMOVES_FAR_0xa0 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa1 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa2 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa3 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa4 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa5 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa6 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa7 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa8 ()
+# define BFI_TEST_SINKMOVES_FAR_0xa9 ()
+# define BFI_TEST_SINKMOVES_FAR_0xaa ()
+# define BFI_TEST_SINKMOVES_FAR_0xab ()
+# define BFI_TEST_SINKMOVES_FAR_0xac ()
+# define BFI_TEST_SINKMOVES_FAR_0xad ()
+# define BFI_TEST_SINKMOVES_FAR_0xae ()
+# define BFI_TEST_SINKMOVES_FAR_0xaf ()
+# define BFI_TEST_SINKMOVES_FAR_0xb0 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb1 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb2 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb3 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb4 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb5 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb6 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb7 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb8 ()
+# define BFI_TEST_SINKMOVES_FAR_0xb9 ()
+# define BFI_TEST_SINKMOVES_FAR_0xba ()
+# define BFI_TEST_SINKMOVES_FAR_0xbb ()
+# define BFI_TEST_SINKMOVES_FAR_0xbc ()
+# define BFI_TEST_SINKMOVES_FAR_0xbd ()
+# define BFI_TEST_SINKMOVES_FAR_0xbe ()
+# define BFI_TEST_SINKMOVES_FAR_0xbf ()
+# define BFI_TEST_SINKMOVES_FAR_0xc0 ()
+
+# endif
@@ -0,0 +1,9 @@
+/* configs: - */
+#include "bfi.h"
+BFI_RUN(r (w (_) r), 0x61 0x62 0x63)
+BFI_RUN(r (w (_) r), a b c (F 0comma 0space G) )
+BFI_RUN1(x x x x x x x x L b x x x x x x x x d _ R b x w)
+BFI_RUN(r w r w r w, a)
+BFI_RUN(_ w x x w, )
+BFI_RUN(x x x L b x x x L b x x d _ R d _ R b b w, )
+BFI_RUN(x x L b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b x d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d d _ R b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b b w, )
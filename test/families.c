@@ -0,0 +1,11 @@
+/* configs: - BFI_MACHINE_FAMILIES=4 */
+# include "bfi.h"
+
+/* an instruction that runs a BF program, on a machine of its own */
+# define BFI_FINST_6nest(f, v, d, t) f((BFI_RUN v), t, BFI_RETURN
+
+/* the nested BFI_RUN takes the second family */
+BFI_FMACHINE_V((r (w (_) r), a b c (F 0comma 0space G) ), 6nest, ~)
+
+/* and a BFI_RUN next to it is back on the first one */
+BFI_RUN(r (w (_) r), a b c)
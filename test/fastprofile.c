@@ -0,0 +1,7 @@
+/* configs: BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+/* the example of BFI_RUN_PROFILE, with no (fast steps, not counted) */
+BFI_RUN_PROFILE(r (w (_) r), a b c)
+/* ++[->++<]>. */
+BFI_RUN_PROFILE(x x L _ b x x d R b w, 0eof)
@@ -0,0 +1,10 @@
+/* configs: - BFI_LINEAR_DEPTH=64 */
+/* limits: 10 200 */
+# include "bfi.h"
+
+/* a budget far larger than the run must cost no more than the run */
+BFI_RUN_LIMITED(r (w (_) r), a b c, 24)
+BFI_RUN_SLICE(r (w (_) r), a b c, 24)
+
+/* three nested loops of 16, which take a few hundred steps */
+BFI_RUN_LIMITED(x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x d _ R d _ R d _ R b w, 0eof, 24)
@@ -0,0 +1,11 @@
+/* configs: BFI_MACHINE_FAMILIES=1 */
+# include "bfi.h"
+
+/* as in test/families.c, but there is no second family to run on */
+# define BFI_FINST_6nest(f, v, d, t) f((BFI_RUN v), t, BFI_RETURN
+# define DROP(x) BFI_EAT(x)
+
+DROP(BFI_FMACHINE_V((r (w (_) r), a b c (F 0comma 0space G) ), 6nest, ~))
+
+/* a machine that is not nested still runs */
+BFI_RUN(r (w (_) r), a b c)
@@ -0,0 +1,7 @@
+/* configs: BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+/* ++[->++<]>. */
+BFI_RUN_PROFILE(x x L _ b x x d R b w, 0eof)
+/* a walk 20 cells away and back */
+BFI_RUN_PROFILE(b b b b b b b b b b b b b b b b b b b b x w d d d d d d d d d d d d d d d d d d d d w, 0eof)
@@ -0,0 +1,51 @@
+#!/bin/sh
+# Runs the tests in this directory:
+#
+#   sh test/run.sh [gcc]
+#
+# Every test/NAME.c is preprocessed with each configuration listed in its
+# first line, and the output must match test/NAME.out. The first line looks
+# like
+#
+#   /* configs: - FOO=1 FOO=2,BAR=1 */
+#
+# where '-' is the default configuration and each other word is a macro
+# definition given with -D, or several of them separated by commas. A
+# second line such as
+#
+#   /* limits: 10 200 */
+#
+# makes each run fail if it takes more than 10 seconds or 200 MB.
+#
+# Of what the preprocessor writes to stderr, only the errors are kept,
+# without their locations, and they follow the output.
+
+cc=${1:-gcc}
+dir=$(dirname "$0")
+err=$(mktemp)
+trap 'rm -f "$err"' EXIT
+fail=0
+for t in "$dir"/*.c; do
+  name=${t%.c}
+  configs=$(sed -n '1s/^\/\* configs: \(.*\) \*\/$/\1/p' "$t")
+  limits=$(sed -n '2s/^\/\* limits: \(.*\) \*\/$/\1/p' "$t")
+  secs=${limits% *}
+  mb=${limits#* }
+  for c in ${configs:--}; do
+    if [ "$c" = - ]; then def=; else def=-D$(echo "$c" | sed 's/,/ -D/g'); fi
+    if [ -n "$limits" ]; then
+      out=$( (ulimit -v $((mb * 1024)); timeout "$secs" "$cc" -E -P -I"$dir/.." $def "$t") 2>"$err")
+    else
+      out=$("$cc" -E -P -I"$dir/.." $def "$t" 2>"$err")
+    fi
+    out=$( (printf '%s\n' "$out"; sed -n 's/^.*: \(error: \)/\1/p' "$err") | grep -v '^$')
+    if [ "$out" = "$(cat "$name.out")" ]; then
+      echo "ok   $(basename "$name") $c"
+    else
+      echo "FAIL $(basename "$name") $c"
+      echo "$out" | head -5
+      fail=1
+    fi
+  done
+done
+exit $fail
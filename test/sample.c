@@ -0,0 +1,13 @@
+/* configs: BFI_MACHINE_LEVELS=2,BFI_LINEAR_DEPTH=64 BFI_MACHINE_LEVELS=2,BFI_LINEAR_DEPTH=64,BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+# define DROP(x) BFI_EAT(x)
+
+/* fewer than BFI_LINEAR_DEPTH slow steps, so no samples */
+BFI_RUN_SAMPLE(r (w (_) r), a b c)
+
+/* 178 slow steps, which suspend twice */
+BFI_RUN_SAMPLE(x x x x x x x x x x x x x x x x L b x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x d _ R d _ R d _ R b w, )
+
+/* 274 slow steps, which give up where BFI_RUN does */
+DROP(BFI_RUN_SAMPLE(x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x d _ R d _ R d _ R b w, ))
@@ -0,0 +1,31 @@
+/* configs: - BFI_CHUNKED_TAPE=1 BFI_ZERO_RUNS=1 BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+/* >+<>+< : a loop body whose moves end where they start */
+BFI_RUN(x L _ b x d b x d R b w, 0eof)
+/* ++[->+<<>>+<]>. */
+BFI_RUN(x x L _ b x d d b b x d R b w, 0eof)
+/* +[->+>+<<>>+<<]>.>. */
+BFI_RUN(x L _ b x b x d d b b x d d R b w b w, 0eof)
+
+/* programs of moves only, which optimize to a block that ends where it
+   starts */
+(BFI_RUN(b d, 0eof))
+(BFI_RUN(b b d d, 0eof))
+(BFI_RUN(d b x _, 0eof))
+(BFI_RUN(b d b d, 0eof))
+BFI_RUN(x b d w, 0eof)
+
+/* changes to cells next to the current one */
+BFI_RUN(x x x L _ b b x x d d R b b w, 0eof)
+BFI_RUN(b b x x x d d L _ R b b w, 0eof)
+
+/* blocks whose balance goes past 127 either way, which must not wrap: the
+   first gains on every move, and its start is rewritten; the second loses
+   on every pair of items, and its start is left as it is */
+# define PN4 (6prev)(6next)(6prev)(6next)(6prev)(6next)(6prev)(6next)
+# define PN32 PN4 PN4 PN4 PN4 PN4 PN4 PN4 PN4
+# define IPIN4 (6inc)(6prev)(6inc)(6next)(6inc)(6prev)(6inc)(6next)(6inc)(6prev)(6inc)(6next)(6inc)(6prev)(6inc)(6next)
+# define IPIN48 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4 IPIN4
+BFI_SINKMOVES((6next)(6inc) PN32 (6write))
+BFI_SINKMOVES((6next)(6next)(6next)(6next) IPIN48 (6write))
@@ -0,0 +1,15 @@
+/* configs: BFI_MACHINE_LEVELS=1 BFI_MACHINE_LEVELS=2,BFI_LINEAR_DEPTH=64 */
+# include "bfi.h"
+
+/* BFI_RUN_STATS and BFI_RUN_PROFILE give up where BFI_RUN does */
+# define DROP(x) BFI_EAT(x)
+
+/* 178 slow steps, within both limits */
+BFI_RUN(x x x x x x x x x x x x x x x x L b x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x d _ R d _ R d _ R b w, )
+BFI_RUN_STATS(x x x x x x x x x x x x x x x x L b x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x d _ R d _ R d _ R b w, )
+BFI_RUN_PROFILE(x x x x x x x x x x x x x x x x L b x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x d _ R d _ R d _ R b w, )
+
+/* 274 slow steps, past both limits */
+DROP(BFI_RUN(x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x d _ R d _ R d _ R b w, ))
+DROP(BFI_RUN_STATS(x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x d _ R d _ R d _ R b w, ))
+DROP(BFI_RUN_PROFILE(x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x x x x x x x x x x x x x L b x x x x d _ R d _ R d _ R b w, ))
@@ -0,0 +1,11 @@
+/* configs: - BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+/* the example of BFI_RUN_TRACE */
+BFI_RUN_TRACE(r (w r), a 0x00)
+
+/* ++[>+<[>.<-]]>. : a 6if whose body ends with a loop */
+BFI_RUN_TRACE(x x L b x d L b w d _ R R b w, )
+
+/* ++[>]+. : a [>] loop, traced as a single 6scanR */
+BFI_RUN_TRACE(x x L b R x w, )
@@ -0,0 +1,34 @@
+/* configs: BFI_TREE_TAPE=1 BFI_TREE_TAPE=1,BFI_COUNT_FAST_STEPS=1 */
+# include "bfi.h"
+
+# define R4 b b b b
+# define R16 R4 R4 R4 R4
+# define R64 R16 R16 R16 R16
+# define R255 R64 R64 R64 R16 R16 R16 R4 R4 R4 b b b
+# define R300 R255 R16 R16 R4 R4 R4 b
+# define L4 d d d d
+# define L16 L4 L4 L4 L4
+# define L64 L16 L16 L16 L16
+# define L300 L64 L64 L64 L64 L16 L16 L4 L4 L4
+
+/* moves within the first leaf: +>++>+++<.<.>>. */
+BFI_RUN(x b x x b x x x d w d w b b w, 0eof)
+
+/* single moves across the edge of a leaf, between the cells 0x0f and
+   0x10, also in a loop: >>>>>>>>>>>>>+>+>+>+>+>+[<]>.>>>. */
+BFI_RUN(R4 R4 R4 b x b x b x b x b x b x L d R b w b b b w, 0eof)
+
+/* runs of moves, which BFI_PEEPHOLE turns into 6seek, within a leaf and
+   across the upper levels of the tree */
+BFI_OPTIMIZE(BFI_TRANSLATE(b b b x d d d w))
+BFI_OPTIMIZE(BFI_TRANSLATE(R255 x L300 w))
+/* +>(255 times)++<(300 times)>(45 times).>(255 times). */
+BFI_RUN(x R255 x x L300 R16 R16 R4 R4 R4 b w R255 w, 0eof)
+/* +++[->(300 times)+<(300 times)]>(300 times). */
+BFI_RUN(x x x L _ R300 x L300 R R300 w, 0eof)
+
+/* the tape wraps around after 65536 cells: < from the first cell reaches
+   the last, moving 256 cells at a time from the cell 255 reaches it after
+   255 moves, where the loop stops, and > from there reaches the first
+   again: +++<->(255 times)+[>(256 times)+]>. */
+BFI_RUN(x x x d _ b R255 x L R255 b x R b w, 0eof)
@@ -0,0 +1,18 @@
+/* configs: - BFI_REGISTER_WINDOW=1 BFI_REGISTER_WINDOW=1,BFI_CHUNKED_TAPE=1 */
+# include "bfi.h"
+
+/* a copy loop and a move loop over cells of the window:
+   +++[->+>+<<]>.>.<<++[->>>>++<<<<]>>>>. */
+BFI_RUN(x x x L _ b x b x d d R b w b w d d x x L _ b b b b x x d d d d R b b b b w, 0eof)
+
+/* moves past the right end of the window, one cell and 4 cells at a
+   time, and back: +>>>>>>>>>+<<<<<<<<<.>>>>>>>>>.<<<<<<<.>+>+>+>+>+>+>+<.<<<<<<. */
+BFI_RUN(x b b b b b b b b b x d d d d d d d d d w b b b b b b b b b w d d d d d d d w b x b x b x b x b x b x b x d w d d d d d d w, 0eof)
+
+/* moves to the left of the first cell, where the window starts:
+   <+<++<+++>>>.<.<.<. */
+BFI_RUN(d x d x x d x x x b b b w d w d w d w, 0eof)
+
+/* input, 6senter and 6sadd, and a loop that shifts the window at every
+   iteration: ,>,<.>.[-<++>]<.+++[>>>>>>+<<<<<<-]>>>>>>. */
+BFI_RUN(r b r d w b w L _ d x x b R d w x x x L b b b b b b x d d d d d d _ R b b b b b b w, 0x01 0x02)